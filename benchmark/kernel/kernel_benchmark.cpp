@@ -0,0 +1,392 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "micro_benchmark.h"
+#include <random>
+
+import stl;
+import third_party;
+import logger;
+import default_values;
+import internal_types;
+import logical_type;
+import data_type;
+import value;
+import bitmask;
+import selection;
+import column_vector;
+import binary_operator;
+import merge_knn;
+import knn_result_handler;
+import memory_pool;
+import byte_slice;
+import posting_field;
+import posting_list_format;
+import index_defines;
+import skiplist_writer;
+import skiplist_reader;
+import segment_entry;
+import block_entry;
+import binary_fuse_filter;
+
+using namespace infinity;
+
+namespace {
+
+// The kernels work on a block of rows, the selectivity arguments are the percent of rows which are kept.
+constexpr SizeT ROW_COUNT = DEFAULT_VECTOR_SIZE;
+
+void InitBitmask(Bitmask &bitmask, SizeT count, i64 selectivity, u32 seed) {
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<i64> percent(0, 99);
+    bitmask.Reset();
+    bitmask.Initialize(count);
+    for (SizeT i = 0; i < count; ++i) {
+        if (percent(rng) >= selectivity) {
+            bitmask.SetFalse(i);
+        }
+    }
+}
+
+SharedPtr<ColumnVector> MakeBigIntColumn(SizeT count, u32 seed) {
+    std::mt19937_64 rng(seed);
+    auto column = MakeShared<ColumnVector>(MakeShared<DataType>(LogicalType::kBigInt));
+    column->Initialize(ColumnVectorType::kFlat, count);
+    for (SizeT i = 0; i < count; ++i) {
+        column->AppendValue(Value::MakeBigInt(static_cast<BigIntT>(rng() >> 1)));
+    }
+    return column;
+}
+
+SharedPtr<ColumnVector> MakeVarcharColumn(SizeT count, u32 seed) {
+    std::mt19937 rng(seed);
+    // The short strings are inlined, the long ones are stored in the heap of the vector.
+    std::uniform_int_distribution<SizeT> length(4, 40);
+    auto column = MakeShared<ColumnVector>(MakeShared<DataType>(LogicalType::kVarchar));
+    column->Initialize(ColumnVectorType::kFlat, count);
+    for (SizeT i = 0; i < count; ++i) {
+        column->AppendValue(Value::MakeVarchar(String(length(rng), char('a' + i % 26))));
+    }
+    return column;
+}
+
+// Bitmask
+
+void BM_BitmaskMerge(benchmark::State &state) {
+    Bitmask left;
+    Bitmask right;
+    InitBitmask(left, ROW_COUNT, state.range(0), 1);
+    InitBitmask(right, ROW_COUNT, state.range(0), 2);
+    // The AND is idempotent, so every iteration does the same work on the same words.
+    for (auto _ : state) {
+        left.Merge(right);
+        benchmark::DoNotOptimize(left.GetData());
+    }
+    state.SetItemsProcessed(state.iterations() * ROW_COUNT);
+}
+BENCHMARK(BM_BitmaskMerge)->ArgName("selectivity:")->Arg(1)->Arg(10)->Arg(50)->Arg(90)->Arg(99);
+
+void BM_BitmaskMergeOr(benchmark::State &state) {
+    Bitmask left;
+    Bitmask right;
+    InitBitmask(left, ROW_COUNT, state.range(0), 1);
+    InitBitmask(right, ROW_COUNT, state.range(0), 2);
+    for (auto _ : state) {
+        left.MergeOr(right);
+        benchmark::DoNotOptimize(left.GetData());
+    }
+    state.SetItemsProcessed(state.iterations() * ROW_COUNT);
+}
+BENCHMARK(BM_BitmaskMergeOr)->ArgName("selectivity:")->Arg(1)->Arg(10)->Arg(50)->Arg(90)->Arg(99);
+
+void BM_BitmaskCountTrue(benchmark::State &state) {
+    Bitmask bitmask;
+    InitBitmask(bitmask, ROW_COUNT, state.range(0), 1);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(bitmask.CountTrue());
+    }
+    state.SetItemsProcessed(state.iterations() * ROW_COUNT);
+}
+BENCHMARK(BM_BitmaskCountTrue)->ArgName("selectivity:")->Arg(10)->Arg(90);
+
+// ColumnVector
+
+void BM_ColumnVectorCopyBigInt(benchmark::State &state) {
+    SharedPtr<ColumnVector> source = MakeBigIntColumn(ROW_COUNT, 1);
+    for (auto _ : state) {
+        ColumnVector target(source->data_type());
+        target.Initialize(*source, 0, ROW_COUNT);
+        benchmark::DoNotOptimize(target.data());
+    }
+    state.SetItemsProcessed(state.iterations() * ROW_COUNT);
+    state.SetBytesProcessed(state.iterations() * ROW_COUNT * sizeof(BigIntT));
+}
+BENCHMARK(BM_ColumnVectorCopyBigInt);
+
+void BM_ColumnVectorCopyVarchar(benchmark::State &state) {
+    SharedPtr<ColumnVector> source = MakeVarcharColumn(ROW_COUNT, 1);
+    for (auto _ : state) {
+        ColumnVector target(source->data_type());
+        target.Initialize(*source, 0, ROW_COUNT);
+        benchmark::DoNotOptimize(target.data());
+    }
+    state.SetItemsProcessed(state.iterations() * ROW_COUNT);
+}
+BENCHMARK(BM_ColumnVectorCopyVarchar);
+
+// The rows of a filter result, the selectivity decides how many rows are gathered from the source.
+void BM_ColumnVectorSelect(benchmark::State &state) {
+    SharedPtr<ColumnVector> source = MakeBigIntColumn(ROW_COUNT, 1);
+    Bitmask bitmask;
+    InitBitmask(bitmask, ROW_COUNT, state.range(0), 2);
+    Selection selection;
+    selection.Initialize(ROW_COUNT);
+    for (SizeT i = 0; i < ROW_COUNT; ++i) {
+        if (bitmask.IsTrue(i)) {
+            selection.Append(i);
+        }
+    }
+    for (auto _ : state) {
+        ColumnVector target(source->data_type());
+        target.Initialize(*source, selection);
+        benchmark::DoNotOptimize(target.data());
+    }
+    state.SetItemsProcessed(state.iterations() * ROW_COUNT);
+}
+BENCHMARK(BM_ColumnVectorSelect)->ArgName("selectivity:")->Arg(1)->Arg(10)->Arg(50)->Arg(90);
+
+// Concatenate the blocks of a scan into a vector, the argument is the rows of each block.
+void BM_ColumnVectorAppendWith(benchmark::State &state) {
+    SizeT chunk_rows = state.range(0);
+    SharedPtr<ColumnVector> source = MakeBigIntColumn(ROW_COUNT, 1);
+    for (auto _ : state) {
+        ColumnVector target(source->data_type());
+        target.Initialize(ColumnVectorType::kFlat, ROW_COUNT);
+        for (SizeT start = 0; start < ROW_COUNT; start += chunk_rows) {
+            target.AppendWith(*source, start, std::min(chunk_rows, ROW_COUNT - start));
+        }
+        benchmark::DoNotOptimize(target.data());
+    }
+    state.SetItemsProcessed(state.iterations() * ROW_COUNT);
+}
+BENCHMARK(BM_ColumnVectorAppendWith)->ArgName("chunk:")->Arg(64)->Arg(1024)->Arg(8192);
+
+void BM_ColumnVectorAppendWithVarchar(benchmark::State &state) {
+    SizeT chunk_rows = state.range(0);
+    SharedPtr<ColumnVector> source = MakeVarcharColumn(ROW_COUNT, 1);
+    for (auto _ : state) {
+        ColumnVector target(source->data_type());
+        target.Initialize(ColumnVectorType::kFlat, ROW_COUNT);
+        for (SizeT start = 0; start < ROW_COUNT; start += chunk_rows) {
+            target.AppendWith(*source, start, std::min(chunk_rows, ROW_COUNT - start));
+        }
+        benchmark::DoNotOptimize(target.data());
+    }
+    state.SetItemsProcessed(state.iterations() * ROW_COUNT);
+}
+BENCHMARK(BM_ColumnVectorAppendWithVarchar)->ArgName("chunk:")->Arg(64)->Arg(8192);
+
+// BinaryOperator
+
+struct AddOperator {
+    template <typename LeftType, typename RightType, typename ResultType>
+    static inline void Execute(LeftType left, RightType right, ResultType &result, Bitmask *, SizeT, void *) {
+        result = left + right;
+    }
+};
+
+struct LessThanOperator {
+    template <typename LeftType, typename RightType, typename ResultType>
+    static inline void Execute(LeftType left, RightType right, ResultType &result, Bitmask *, SizeT, void *) {
+        result = left < right;
+    }
+};
+
+// The argument is the percent of null rows in the left input, zero runs the loop without null handling.
+void BM_BinaryOperatorAdd(benchmark::State &state) {
+    i64 null_percent = state.range(0);
+    SharedPtr<ColumnVector> left = MakeBigIntColumn(ROW_COUNT, 1);
+    SharedPtr<ColumnVector> right = MakeBigIntColumn(ROW_COUNT, 2);
+    if (null_percent > 0) {
+        InitBitmask(*left->nulls_ptr_, ROW_COUNT, 100 - null_percent, 3);
+    }
+    auto result = MakeShared<ColumnVector>(left->data_type());
+    result->Initialize(ColumnVectorType::kFlat, ROW_COUNT);
+    for (auto _ : state) {
+        BinaryOperator::Execute<BigIntT, BigIntT, BigIntT, AddOperator>(left, right, result, ROW_COUNT, nullptr, true);
+        benchmark::DoNotOptimize(result->data());
+    }
+    state.SetItemsProcessed(state.iterations() * ROW_COUNT);
+}
+BENCHMARK(BM_BinaryOperatorAdd)->ArgName("nulls:")->Arg(0)->Arg(10)->Arg(50);
+
+// A constant right side, as in a filter of column < literal. The selectivity is the percent of rows which pass.
+void BM_BinaryOperatorCompareConstant(benchmark::State &state) {
+    SharedPtr<ColumnVector> left = MakeBigIntColumn(ROW_COUNT, 1);
+    auto right = MakeShared<ColumnVector>(left->data_type());
+    right->Initialize(ColumnVectorType::kConstant, 1);
+    BigIntT threshold = static_cast<BigIntT>(std::numeric_limits<BigIntT>::max() / 100 * state.range(0));
+    right->AppendValue(Value::MakeBigInt(threshold));
+    auto result = MakeShared<ColumnVector>(MakeShared<DataType>(LogicalType::kBoolean));
+    result->Initialize(ColumnVectorType::kFlat, ROW_COUNT);
+    for (auto _ : state) {
+        BinaryOperator::Execute<BigIntT, BigIntT, BooleanT, LessThanOperator>(left, right, result, ROW_COUNT, nullptr, true);
+        benchmark::DoNotOptimize(result->data());
+    }
+    state.SetItemsProcessed(state.iterations() * ROW_COUNT);
+}
+BENCHMARK(BM_BinaryOperatorCompareConstant)->ArgName("selectivity:")->Arg(1)->Arg(50)->Arg(99);
+
+// MergeKnn
+
+// Merge the distances of the rows of a block into the top k heap of one query, the argument is k.
+void BM_MergeKnnSearch(benchmark::State &state) {
+    u64 topk = state.range(0);
+    std::mt19937 rng(1);
+    std::uniform_real_distribution<f32> distance(0, 1);
+    Vector<f32> distances(ROW_COUNT);
+    Vector<RowID> row_ids(ROW_COUNT);
+    for (SizeT i = 0; i < ROW_COUNT; ++i) {
+        distances[i] = distance(rng);
+        row_ids[i] = RowID(0, i);
+    }
+    for (auto _ : state) {
+        MergeKnn<f32, CompareMax> merge_knn(1, topk);
+        merge_knn.Begin();
+        merge_knn.Search(distances.data(), row_ids.data(), ROW_COUNT);
+        merge_knn.End();
+        benchmark::DoNotOptimize(merge_knn.GetDistances());
+    }
+    state.SetItemsProcessed(state.iterations() * ROW_COUNT);
+}
+BENCHMARK(BM_MergeKnnSearch)->ArgName("topk:")->Arg(10)->Arg(100)->Arg(1000);
+
+// SkipListReader
+
+// Skip through the skip list of a posting list of 64K docs, the argument is the gap between the queried doc ids.
+// A gap of one decodes every record, larger gaps skip over the buffers.
+void BM_SkipListReaderSkipTo(benchmark::State &state) {
+    constexpr u32 DOC_COUNT = 64 * 1024;
+    constexpr SizeT POOL_SIZE = 1024;
+    u32 stride = state.range(0);
+
+    MemoryPool byte_slice_pool(POOL_SIZE);
+    RecyclePool buffer_pool(POOL_SIZE);
+    PostingFields posting_fields;
+    u32 offset = 0;
+    for (u8 location = 0; location < 3; ++location) {
+        auto posting_field = new TypedPostingField<u32>;
+        posting_field->location_ = location;
+        posting_field->offset_ = offset;
+        posting_field->encoder_ = GetSkipListEncoder();
+        offset += sizeof(u32);
+        posting_fields.AddValue(posting_field);
+    }
+    SkipListWriter skiplist_writer(&byte_slice_pool, &buffer_pool);
+    skiplist_writer.Init(&posting_fields);
+    for (u32 doc_id = 0; doc_id < DOC_COUNT; ++doc_id) {
+        skiplist_writer.AddItem(doc_id * 3, doc_id % 7 + 1, 64);
+    }
+    skiplist_writer.Flush();
+    const ByteSliceList *byte_slice_list = skiplist_writer.GetByteSliceList();
+
+    PostingFormatOption format_option(of_term_frequency);
+    u32 doc_id = 0;
+    u32 prev_doc_id = 0;
+    u32 skip_offset = 0;
+    u32 delta = 0;
+    for (auto _ : state) {
+        SkipListReaderByteSlice skiplist_reader(format_option.GetDocListFormatOption());
+        skiplist_reader.Load(byte_slice_list, 0, byte_slice_list->GetTotalSize());
+        for (u32 query_doc_id = 0; query_doc_id < DOC_COUNT * 3; query_doc_id += stride * 3) {
+            if (!skiplist_reader.SkipTo(query_doc_id, doc_id, prev_doc_id, skip_offset, delta)) {
+                break;
+            }
+        }
+        benchmark::DoNotOptimize(doc_id);
+    }
+    state.SetItemsProcessed(state.iterations() * (DOC_COUNT + stride - 1) / stride);
+}
+BENCHMARK(BM_SkipListReaderSkipTo)->ArgName("stride:")->Arg(1)->Arg(16)->Arg(256)->Arg(4096);
+
+// BlockEntry
+
+// The visibility bitmask of a full block, the argument is the percent of rows deleted before the query.
+void BM_BlockEntrySetDeleteBitmask(benchmark::State &state) {
+    constexpr TxnTimeStamp INSERT_TS = 10;
+    constexpr TxnTimeStamp DELETE_TS = 20;
+    constexpr TxnTimeStamp QUERY_TS = 30;
+    // DeleteData logs at the trace level.
+    infinity_logger = MakeShared<spdlog::logger>("kernel_benchmark");
+
+    SegmentEntry segment_entry(nullptr, MakeShared<String>("kernel_benchmark"), 0, ROW_COUNT, 1, SegmentStatus::kUnsealed);
+    UniquePtr<BlockEntry> block_entry =
+        BlockEntry::NewReplayBlockEntry(&segment_entry, 0, ROW_COUNT, ROW_COUNT, INSERT_TS, INSERT_TS, INSERT_TS, INSERT_TS, ROW_COUNT, nullptr);
+    Bitmask deleted;
+    InitBitmask(deleted, ROW_COUNT, 100 - state.range(0), 1);
+    Vector<BlockOffset> rows;
+    for (SizeT i = 0; i < ROW_COUNT; ++i) {
+        if (!deleted.IsTrue(i)) {
+            rows.push_back(i);
+        }
+    }
+    if (!rows.empty()) {
+        block_entry->DeleteData(1, DELETE_TS, rows);
+    }
+
+    Bitmask bitmask;
+    bitmask.Initialize(ROW_COUNT);
+    for (auto _ : state) {
+        bitmask.SetAllTrue();
+        block_entry->SetDeleteBitmask(QUERY_TS, bitmask);
+        benchmark::DoNotOptimize(bitmask.GetData());
+    }
+    state.SetItemsProcessed(state.iterations() * ROW_COUNT);
+    infinity_logger = nullptr;
+}
+BENCHMARK(BM_BlockEntrySetDeleteBitmask)->ArgName("deleted:")->Arg(0)->Arg(1)->Arg(10)->Arg(50);
+
+// BinaryFuse
+
+// Probe the filter of a segment, the argument is the percent of probes which hit a key in the filter.
+void BM_BinaryFuseContain(benchmark::State &state) {
+    constexpr SizeT KEY_COUNT = 1024 * 1024;
+    constexpr SizeT PROBE_COUNT = 64 * 1024;
+    std::mt19937_64 rng(1);
+    Vector<u64> keys(KEY_COUNT);
+    for (auto &key : keys) {
+        key = rng();
+    }
+    BinaryFuse filter;
+    filter.Build(1, keys.data(), keys.size());
+
+    std::uniform_int_distribution<i64> percent(0, 99);
+    Vector<u64> probes(PROBE_COUNT);
+    for (auto &probe : probes) {
+        probe = percent(rng) < state.range(0) ? keys[rng() % KEY_COUNT] : rng();
+    }
+    SizeT found = 0;
+    for (auto _ : state) {
+        for (auto &probe : probes) {
+            found += filter.Contain(2, probe);
+        }
+        benchmark::DoNotOptimize(found);
+    }
+    state.SetItemsProcessed(state.iterations() * PROBE_COUNT);
+}
+BENCHMARK(BM_BinaryFuseContain)->ArgName("hit:")->Arg(0)->Arg(50)->Arg(100);
+
+} // namespace
+
+BENCHMARK_MAIN();
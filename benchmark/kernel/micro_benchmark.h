@@ -0,0 +1,221 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+// A small harness with the interface of Google Benchmark, which is not among the third party libraries.
+// A benchmark runs with growing iteration counts until it takes --benchmark_min_time seconds, then reports the time per iteration.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <regex>
+#include <string>
+#include <vector>
+
+namespace benchmark {
+
+template <typename T>
+inline void DoNotOptimize(T const &value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+template <typename T>
+inline void DoNotOptimize(T &value) {
+    asm volatile("" : "+r,m"(value) : : "memory");
+}
+
+inline void ClobberMemory() { asm volatile("" : : : "memory"); }
+
+class State {
+    using Clock = std::chrono::steady_clock;
+
+public:
+    State(std::vector<int64_t> args, int64_t max_iterations) : args_(std::move(args)), max_iterations_(max_iterations) {}
+
+    struct Iterator {
+        State *state_;
+        int64_t remaining_;
+
+        bool operator!=(const Iterator &) const {
+            if (remaining_ != 0) {
+                return true;
+            }
+            state_->Finish();
+            return false;
+        }
+        void operator++() { --remaining_; }
+        int operator*() const { return 0; }
+    };
+
+    Iterator begin() {
+        start_ = Clock::now();
+        return Iterator{this, max_iterations_};
+    }
+    Iterator end() { return Iterator{this, 0}; }
+
+    // Exclude the setup inside of the loop, each pause costs two clock reads.
+    void PauseTiming() { elapsed_ += Clock::now() - start_; }
+    void ResumeTiming() { start_ = Clock::now(); }
+
+    [[nodiscard]] int64_t range(std::size_t idx = 0) const { return args_[idx]; }
+    [[nodiscard]] int64_t iterations() const { return max_iterations_; }
+
+    void SetItemsProcessed(int64_t items) { items_processed_ = items; }
+    void SetBytesProcessed(int64_t bytes) { bytes_processed_ = bytes; }
+    void SetLabel(std::string label) { label_ = std::move(label); }
+
+    [[nodiscard]] double seconds() const { return std::chrono::duration<double>(elapsed_).count(); }
+    [[nodiscard]] int64_t items_processed() const { return items_processed_; }
+    [[nodiscard]] int64_t bytes_processed() const { return bytes_processed_; }
+    [[nodiscard]] const std::string &label() const { return label_; }
+
+private:
+    void Finish() { elapsed_ += Clock::now() - start_; }
+
+    std::vector<int64_t> args_;
+    int64_t max_iterations_;
+    Clock::time_point start_{};
+    Clock::duration elapsed_{};
+    int64_t items_processed_{0};
+    int64_t bytes_processed_{0};
+    std::string label_{};
+};
+
+using Function = void (*)(State &);
+
+class Benchmark {
+public:
+    Benchmark(std::string name, Function function) : name_(std::move(name)), function_(function) {}
+
+    Benchmark *Arg(int64_t arg) {
+        args_.push_back({arg});
+        return this;
+    }
+
+    Benchmark *Args(std::vector<int64_t> args) {
+        args_.push_back(std::move(args));
+        return this;
+    }
+
+    Benchmark *ArgName(std::string arg_name) {
+        arg_name_ = std::move(arg_name);
+        return this;
+    }
+
+    [[nodiscard]] const std::string &name() const { return name_; }
+    [[nodiscard]] Function function() const { return function_; }
+    [[nodiscard]] const std::vector<std::vector<int64_t>> &args() const { return args_; }
+    [[nodiscard]] const std::string &arg_name() const { return arg_name_; }
+
+private:
+    std::string name_;
+    Function function_;
+    std::vector<std::vector<int64_t>> args_{};
+    std::string arg_name_{};
+};
+
+inline std::vector<std::unique_ptr<Benchmark>> &Registry() {
+    static std::vector<std::unique_ptr<Benchmark>> benchmarks;
+    return benchmarks;
+}
+
+inline Benchmark *RegisterBenchmark(const char *name, Function function) {
+    Registry().push_back(std::make_unique<Benchmark>(name, function));
+    return Registry().back().get();
+}
+
+inline std::string HumanRate(double rate, const char *unit) {
+    const char *prefixes[] = {"", "k", "M", "G", "T"};
+    std::size_t idx = 0;
+    while (rate >= 1000 && idx + 1 < std::size(prefixes)) {
+        rate /= 1000;
+        ++idx;
+    }
+    char buffer[64];
+    std::snprintf(buffer, sizeof(buffer), "%.3g%s%s/s", rate, prefixes[idx], unit);
+    return buffer;
+}
+
+inline int RunSpecifiedBenchmarks(int argc, char **argv) {
+    std::string filter = ".";
+    double min_time = 0.5;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strncmp(argv[i], "--benchmark_filter=", 19) == 0) {
+            filter = argv[i] + 19;
+        } else if (std::strncmp(argv[i], "--benchmark_min_time=", 21) == 0) {
+            min_time = std::stod(argv[i] + 21);
+        } else {
+            std::fprintf(stderr, "Usage: %s [--benchmark_filter=<regex>] [--benchmark_min_time=<seconds>]\n", argv[0]);
+            return 1;
+        }
+    }
+    std::regex filter_regex(filter);
+
+    std::printf("%-48s %14s %14s  %s\n", "Benchmark", "Time(ns)", "Iterations", "Rate");
+    for (const auto &benchmark : Registry()) {
+        std::vector<std::vector<int64_t>> args_list = benchmark->args();
+        if (args_list.empty()) {
+            args_list.push_back({});
+        }
+        for (const auto &args : args_list) {
+            std::string name = benchmark->name();
+            for (int64_t arg : args) {
+                name += "/" + benchmark->arg_name() + std::to_string(arg);
+            }
+            if (!std::regex_search(name, filter_regex)) {
+                continue;
+            }
+            int64_t iterations = 1;
+            while (true) {
+                State state(args, iterations);
+                benchmark->function()(state);
+                double seconds = state.seconds();
+                if (seconds >= min_time || iterations >= (int64_t(1) << 40)) {
+                    std::string rate;
+                    if (state.items_processed() > 0) {
+                        rate = HumanRate(state.items_processed() / seconds, " items");
+                    }
+                    if (state.bytes_processed() > 0) {
+                        rate += (rate.empty() ? "" : " ") + HumanRate(state.bytes_processed() / seconds, "B");
+                    }
+                    if (!state.label().empty()) {
+                        rate += " " + state.label();
+                    }
+                    std::printf("%-48s %14.1f %14ld  %s\n", name.c_str(), seconds * 1e9 / iterations, iterations, rate.c_str());
+                    break;
+                }
+                // Aim for the min time from the last run, at most ten times as many iterations.
+                double multiplier = seconds <= 0 ? 10 : std::min(10.0, 1.4 * min_time / seconds);
+                iterations = std::max(iterations + 1, int64_t(iterations * multiplier));
+            }
+        }
+    }
+    return 0;
+}
+
+} // namespace benchmark
+
+#define BENCHMARK_CONCAT_IMPL(a, b) a##b
+#define BENCHMARK_CONCAT(a, b) BENCHMARK_CONCAT_IMPL(a, b)
+
+#define BENCHMARK(func)                                                                                                                              \
+    static ::benchmark::Benchmark *BENCHMARK_CONCAT(benchmark_registration_, __LINE__) = ::benchmark::RegisterBenchmark(#func, func)
+
+#define BENCHMARK_MAIN()                                                                                                                             \
+    int main(int argc, char **argv) { return ::benchmark::RunSpecifiedBenchmarks(argc, argv); }
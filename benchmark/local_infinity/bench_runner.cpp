@@ -0,0 +1,564 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+import stl;
+import third_party;
+import compilation_config;
+import local_file_system;
+import infinity;
+
+import internal_types;
+import logical_type;
+import embedding_info;
+import create_index_info;
+import column_def;
+import data_type;
+import query_options;
+import query_result;
+import extra_ddl_info;
+import statement_common;
+import knn_expr;
+import match_expr;
+import column_expr;
+import parsed_expr;
+import search_expr;
+import function_expr;
+import data_table;
+import data_block;
+import column_vector;
+import value;
+
+using namespace infinity;
+
+// One runner for the datasets of the local benchmarks, it builds the table and the index, sweeps the search parameter and
+// the client threads, and writes recall@k, QPS, latency percentiles, build time and memory and disk size as json.
+
+namespace {
+
+enum class DatasetKind { kVector, kFullText };
+
+struct DatasetSpec {
+    String name_;
+    DatasetKind kind_;
+    // the dimension of the vectors
+    SizeT dimension_;
+    // relative to the test data path
+    String base_file_;
+    String query_file_;
+    String groundtruth_file_;
+};
+
+const Vector<DatasetSpec> DATASETS = {
+    {"sift1m", DatasetKind::kVector, 128, "sift_1m/sift_base.fvecs", "sift_1m/sift_query.fvecs", "sift_1m/sift_groundtruth.ivecs"},
+    {"gist1m", DatasetKind::kVector, 960, "gist_1m/gist_base.fvecs", "gist_1m/gist_query.fvecs", "gist_1m/gist_groundtruth.ivecs"},
+    {"dbpedia", DatasetKind::kFullText, 0, "dbpedia-entity/corpus.jsonl", "dbpedia-entity/queries.jsonl", "dbpedia-entity/qrels/test.tsv"},
+    {"msmarco", DatasetKind::kFullText, 0, "msmarco/corpus.jsonl", "msmarco/queries.jsonl", "msmarco/qrels/dev.tsv"},
+};
+
+struct RunnerOptions {
+    String dataset_{"sift1m"};
+    String data_dir_{};
+    String infinity_dir_{"/tmp/infinity"};
+    String output_{};
+    bool build_{false};
+    SizeT top_k_{10};
+    SizeT rounds_{3};
+    SizeT warmup_rounds_{1};
+    SizeT query_limit_{0};
+    SizeT m_{16};
+    SizeT ef_construction_{200};
+    Vector<SizeT> ef_list_{100};
+    Vector<SizeT> thread_list_{1};
+    Vector<f64> recall_targets_{0.9, 0.95, 0.99};
+};
+
+struct Workload {
+    // the vectors of the queries one after the other, or the texts of the queries
+    Vector<f32> query_vectors_;
+    Vector<String> query_texts_;
+    SizeT query_count_{};
+    // the expected ids of each query, in the order of the groundtruth
+    Vector<Vector<String>> groundtruth_;
+};
+
+struct RunResult {
+    SizeT ef_{};
+    SizeT threads_{};
+    SizeT queries_{};
+    f64 qps_{};
+    f64 recall_{};
+    f64 latency_p50_ms_{};
+    f64 latency_p99_ms_{};
+    f64 latency_mean_ms_{};
+};
+
+// fvecs and ivecs, each vector is its dimension as an i32 followed by the elements
+template <typename T>
+Vector<T> LoadVecs(const String &path, SizeT &count, SizeT &dimension) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in.is_open()) {
+        throw std::runtime_error(fmt::format("Can't open {}", path));
+    }
+    i32 dim = 0;
+    in.read(reinterpret_cast<char *>(&dim), sizeof(dim));
+    in.seekg(0, std::ios::end);
+    SizeT file_size = in.tellg();
+    dimension = dim;
+    count = file_size / ((dimension + 1) * sizeof(T));
+    Vector<T> data(count * dimension);
+    in.seekg(0, std::ios::beg);
+    for (SizeT i = 0; i < count; ++i) {
+        in.seekg(sizeof(i32), std::ios::cur);
+        in.read(reinterpret_cast<char *>(data.data() + i * dimension), dimension * sizeof(T));
+    }
+    return data;
+}
+
+Workload LoadVectorWorkload(const DatasetSpec &spec, const RunnerOptions &options) {
+    Workload workload;
+    SizeT dimension = 0;
+    workload.query_vectors_ = LoadVecs<f32>(options.data_dir_ + "/" + spec.query_file_, workload.query_count_, dimension);
+    if (dimension != spec.dimension_) {
+        throw std::runtime_error(fmt::format("The queries of {} are of dimension {}, expect {}", spec.name_, dimension, spec.dimension_));
+    }
+    SizeT gt_count = 0;
+    SizeT gt_top_k = 0;
+    Vector<i32> gt = LoadVecs<i32>(options.data_dir_ + "/" + spec.groundtruth_file_, gt_count, gt_top_k);
+    if (gt_count != workload.query_count_ || gt_top_k < options.top_k_) {
+        throw std::runtime_error(fmt::format("The groundtruth has {} queries of top {}", gt_count, gt_top_k));
+    }
+    workload.groundtruth_.resize(gt_count);
+    for (SizeT i = 0; i < gt_count; ++i) {
+        for (SizeT j = 0; j < options.top_k_; ++j) {
+            workload.groundtruth_[i].push_back(std::to_string(gt[i * gt_top_k + j]));
+        }
+    }
+    return workload;
+}
+
+// BEIR layout: queries.jsonl of {"_id", "text"}, and a qrels tsv of query id, corpus id and score with a header line.
+Workload LoadFullTextWorkload(const DatasetSpec &spec, const RunnerOptions &options) {
+    HashMap<String, Vector<String>> relevant_docs;
+    {
+        std::ifstream in(options.data_dir_ + "/" + spec.groundtruth_file_);
+        if (!in.is_open()) {
+            throw std::runtime_error(fmt::format("Can't open {}", spec.groundtruth_file_));
+        }
+        String line;
+        std::getline(in, line);
+        while (std::getline(in, line)) {
+            SizeT pos1 = line.find('\t');
+            SizeT pos2 = line.find('\t', pos1 + 1);
+            if (pos1 == String::npos || pos2 == String::npos) {
+                continue;
+            }
+            if (std::stoi(line.substr(pos2 + 1)) > 0) {
+                relevant_docs[line.substr(0, pos1)].push_back(line.substr(pos1 + 1, pos2 - pos1 - 1));
+            }
+        }
+    }
+
+    Workload workload;
+    std::ifstream in(options.data_dir_ + "/" + spec.query_file_);
+    if (!in.is_open()) {
+        throw std::runtime_error(fmt::format("Can't open {}", spec.query_file_));
+    }
+    String line;
+    while (std::getline(in, line)) {
+        if (line.empty()) {
+            continue;
+        }
+        nlohmann::json json = nlohmann::json::parse(line);
+        String query_id = json["_id"];
+        auto iter = relevant_docs.find(query_id);
+        // queries without a judged document can't be scored
+        if (iter == relevant_docs.end()) {
+            continue;
+        }
+        workload.query_texts_.push_back(json["text"]);
+        workload.groundtruth_.push_back(std::move(iter->second));
+    }
+    workload.query_count_ = workload.query_texts_.size();
+    return workload;
+}
+
+String TableName(const DatasetSpec &spec) { return fmt::format("bench_{}", spec.name_); }
+
+Vector<ColumnDef *> TableColumns(const DatasetSpec &spec) {
+    Vector<ColumnDef *> column_defs;
+    if (spec.kind_ == DatasetKind::kVector) {
+        auto embedding_info = MakeShared<EmbeddingInfo>(EmbeddingDataType::kElemFloat, spec.dimension_);
+        auto embedding_type = MakeShared<DataType>(LogicalType::kEmbedding, embedding_info);
+        column_defs.push_back(new ColumnDef(0, embedding_type, "col1", HashSet<ConstraintType>()));
+    } else {
+        auto varchar_type = MakeShared<DataType>(LogicalType::kVarchar);
+        column_defs.push_back(new ColumnDef(0, varchar_type, "_id", HashSet<ConstraintType>()));
+        column_defs.push_back(new ColumnDef(1, varchar_type, "title", HashSet<ConstraintType>()));
+        column_defs.push_back(new ColumnDef(2, varchar_type, "text", HashSet<ConstraintType>()));
+    }
+    return column_defs;
+}
+
+Vector<IndexInfo *> *TableIndex(const DatasetSpec &spec, const RunnerOptions &options) {
+    auto index_info_list = new Vector<IndexInfo *>();
+    auto index_info = new IndexInfo();
+    index_info->index_param_list_ = new Vector<InitParameter *>();
+    if (spec.kind_ == DatasetKind::kVector) {
+        index_info->index_type_ = IndexType::kHnsw;
+        index_info->column_name_ = "col1";
+        index_info->index_param_list_->push_back(new InitParameter("M", std::to_string(options.m_)));
+        index_info->index_param_list_->push_back(new InitParameter("ef_construction", std::to_string(options.ef_construction_)));
+        index_info->index_param_list_->push_back(new InitParameter("ef", std::to_string(options.ef_construction_)));
+        index_info->index_param_list_->push_back(new InitParameter("metric", "l2"));
+        index_info->index_param_list_->push_back(new InitParameter("encode", "lvq"));
+    } else {
+        index_info->index_type_ = IndexType::kFullText;
+        index_info->column_name_ = "text";
+    }
+    index_info_list->push_back(index_info);
+    return index_info_list;
+}
+
+f64 SecondsSince(std::chrono::steady_clock::time_point begin) {
+    return std::chrono::duration<f64>(std::chrono::steady_clock::now() - begin).count();
+}
+
+nlohmann::json BuildTable(const DatasetSpec &spec, const RunnerOptions &options) {
+    SharedPtr<Infinity> infinity = Infinity::LocalConnect();
+    String table_name = TableName(spec);
+
+    DropTableOptions drop_tb_options;
+    drop_tb_options.conflict_type_ = ConflictType::kIgnore;
+    infinity->DropTable("default", table_name, drop_tb_options);
+    QueryResult result = infinity->CreateTable("default", table_name, TableColumns(spec), Vector<TableConstraint *>{}, CreateTableOptions());
+    if (!result.IsOk()) {
+        throw std::runtime_error(fmt::format("Fail to create table {}: {}", table_name, result.ToString()));
+    }
+
+    auto begin = std::chrono::steady_clock::now();
+    ImportOptions import_options;
+    import_options.copy_file_type_ = spec.kind_ == DatasetKind::kVector ? CopyFileType::kFVECS : CopyFileType::kJSONL;
+    result = infinity->Import("default", table_name, options.data_dir_ + "/" + spec.base_file_, import_options);
+    if (!result.IsOk()) {
+        throw std::runtime_error(fmt::format("Fail to import {}: {}", spec.base_file_, result.ToString()));
+    }
+    f64 import_seconds = SecondsSince(begin);
+
+    begin = std::chrono::steady_clock::now();
+    result = infinity->CreateIndex("default", table_name, "bench_index", TableIndex(spec, options), CreateIndexOptions());
+    if (!result.IsOk()) {
+        throw std::runtime_error(fmt::format("Fail to create index: {}", result.ToString()));
+    }
+    infinity->Flush();
+    f64 index_seconds = SecondsSince(begin);
+
+    nlohmann::json build;
+    build["import_seconds"] = import_seconds;
+    build["index_seconds"] = index_seconds;
+    build["total_seconds"] = import_seconds + index_seconds;
+    return build;
+}
+
+SearchExpr *MakeSearch(const DatasetSpec &spec, const RunnerOptions &options, const Workload &workload, SizeT query_idx, SizeT ef) {
+    auto exprs = new Vector<ParsedExpr *>();
+    if (spec.kind_ == DatasetKind::kVector) {
+        auto knn_expr = new KnnExpr();
+        knn_expr->dimension_ = spec.dimension_;
+        knn_expr->distance_type_ = KnnDistanceType::kL2;
+        knn_expr->topn_ = options.top_k_;
+        knn_expr->opt_params_ = new Vector<InitParameter *>();
+        knn_expr->opt_params_->push_back(new InitParameter("ef", std::to_string(ef)));
+        knn_expr->embedding_data_type_ = EmbeddingDataType::kElemFloat;
+        auto embedding_data = new f32[spec.dimension_];
+        std::memcpy(embedding_data, workload.query_vectors_.data() + query_idx * spec.dimension_, spec.dimension_ * sizeof(f32));
+        knn_expr->embedding_data_ptr_ = embedding_data;
+        auto column_expr = new ColumnExpr();
+        column_expr->names_.emplace_back("col1");
+        knn_expr->column_expr_ = column_expr;
+        exprs->push_back(knn_expr);
+    } else {
+        auto match_expr = new MatchExpr();
+        match_expr->fields_ = "text";
+        match_expr->matching_text_ = workload.query_texts_[query_idx];
+        match_expr->options_text_ = fmt::format("topn={}", options.top_k_);
+        exprs->push_back(match_expr);
+    }
+    auto search_expr = new SearchExpr();
+    search_expr->SetExprs(exprs);
+    return search_expr;
+}
+
+// The ids of the result, row ids for the vectors as in the groundtruth of the fvecs datasets, _id for the documents.
+Vector<String> ResultIDs(const DatasetSpec &spec, const QueryResult &result) {
+    Vector<String> ids;
+    if (!result.IsOk() || result.result_table_.get() == nullptr || result.result_table_->DataBlockCount() == 0) {
+        return ids;
+    }
+    auto &column = *result.result_table_->GetDataBlockById(0)->column_vectors[0];
+    SizeT row_count = column.Size();
+    if (spec.kind_ == DatasetKind::kVector) {
+        auto row_ids = reinterpret_cast<const RowID *>(column.data());
+        for (SizeT i = 0; i < row_count; ++i) {
+            ids.push_back(std::to_string(row_ids[i].ToUint64()));
+        }
+    } else {
+        for (SizeT i = 0; i < row_count; ++i) {
+            ids.push_back(column.GetValue(i).GetVarchar());
+        }
+    }
+    return ids;
+}
+
+f64 Recall(const Vector<Vector<String>> &results, const Workload &workload, SizeT top_k) {
+    f64 recall_sum = 0;
+    for (SizeT query_idx = 0; query_idx < workload.query_count_; ++query_idx) {
+        const Vector<String> &expected = workload.groundtruth_[query_idx];
+        HashSet<String> expected_set(expected.begin(), expected.end());
+        SizeT found = 0;
+        for (SizeT i = 0; i < std::min(top_k, results[query_idx].size()); ++i) {
+            found += expected_set.contains(results[query_idx][i]);
+        }
+        recall_sum += static_cast<f64>(found) / std::min(top_k, expected.size());
+    }
+    return workload.query_count_ == 0 ? 0 : recall_sum / workload.query_count_;
+}
+
+f64 Percentile(Vector<f64> &sorted_latencies, f64 percentile) {
+    if (sorted_latencies.empty()) {
+        return 0;
+    }
+    SizeT idx = std::min(sorted_latencies.size() - 1, static_cast<SizeT>(percentile * sorted_latencies.size()));
+    return sorted_latencies[idx];
+}
+
+// Each client thread has its own connection and takes the next query until all of them are done, the recall is of the
+// results of the last round.
+RunResult RunQueries(const DatasetSpec &spec, const RunnerOptions &options, const Workload &workload, SizeT ef, SizeT thread_count) {
+    SizeT query_count = workload.query_count_;
+    Vector<Vector<String>> results(query_count);
+    Vector<f64> latencies_ms(query_count * options.rounds_);
+    f64 measured_seconds = 0;
+
+    for (SizeT round = 0; round < options.warmup_rounds_ + options.rounds_; ++round) {
+        bool measured = round >= options.warmup_rounds_;
+        SizeT latency_offset = measured ? (round - options.warmup_rounds_) * query_count : 0;
+        std::atomic<SizeT> next_query{0};
+
+        auto client = [&] {
+            SharedPtr<Infinity> infinity = Infinity::LocalConnect();
+            for (SizeT query_idx = next_query++; query_idx < query_count; query_idx = next_query++) {
+                SearchExpr *search_expr = MakeSearch(spec, options, workload, query_idx, ef);
+                auto output_columns = new Vector<ParsedExpr *>();
+                auto id_expr = new FunctionExpr();
+                id_expr->func_name_ = spec.kind_ == DatasetKind::kVector ? "row_id" : "_id";
+                output_columns->push_back(id_expr);
+
+                auto begin = std::chrono::steady_clock::now();
+                QueryResult result = infinity->Search("default", TableName(spec), search_expr, nullptr, output_columns);
+                f64 latency_ms = std::chrono::duration<f64, std::milli>(std::chrono::steady_clock::now() - begin).count();
+                if (measured) {
+                    latencies_ms[latency_offset + query_idx] = latency_ms;
+                }
+                results[query_idx] = ResultIDs(spec, result);
+            }
+            infinity->LocalDisconnect();
+        };
+
+        auto begin = std::chrono::steady_clock::now();
+        Vector<std::thread> threads;
+        for (SizeT i = 0; i < thread_count; ++i) {
+            threads.emplace_back(client);
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+        if (measured) {
+            measured_seconds += SecondsSince(begin);
+        }
+    }
+
+    RunResult run;
+    run.ef_ = ef;
+    run.threads_ = thread_count;
+    run.queries_ = query_count * options.rounds_;
+    run.qps_ = measured_seconds > 0 ? run.queries_ / measured_seconds : 0;
+    run.recall_ = Recall(results, workload, options.top_k_);
+    std::sort(latencies_ms.begin(), latencies_ms.end());
+    run.latency_p50_ms_ = Percentile(latencies_ms, 0.5);
+    run.latency_p99_ms_ = Percentile(latencies_ms, 0.99);
+    f64 latency_sum = 0;
+    for (f64 latency : latencies_ms) {
+        latency_sum += latency;
+    }
+    run.latency_mean_ms_ = latencies_ms.empty() ? 0 : latency_sum / latencies_ms.size();
+    return run;
+}
+
+// VmHWM of /proc/self/status, the peak resident set of the process in bytes
+u64 PeakResidentBytes() {
+    std::ifstream in("/proc/self/status");
+    String line;
+    while (std::getline(in, line)) {
+        if (line.starts_with("VmHWM:")) {
+            return std::stoull(line.substr(6)) * 1024;
+        }
+    }
+    return 0;
+}
+
+u64 DirectorySize(const String &path) {
+    u64 size = 0;
+    std::error_code ec;
+    for (const auto &entry : std::filesystem::recursive_directory_iterator(path, ec)) {
+        if (entry.is_regular_file(ec)) {
+            size += entry.file_size(ec);
+        }
+    }
+    return size;
+}
+
+nlohmann::json RunBenchmark(const DatasetSpec &spec, const RunnerOptions &options) {
+    nlohmann::json report;
+    report["dataset"] = spec.name_;
+    report["top_k"] = options.top_k_;
+    report["rounds"] = options.rounds_;
+    report["hardware_concurrency"] = std::thread::hardware_concurrency();
+
+    if (options.build_) {
+        report["build"] = BuildTable(spec, options);
+    }
+
+    Workload workload = spec.kind_ == DatasetKind::kVector ? LoadVectorWorkload(spec, options) : LoadFullTextWorkload(spec, options);
+    if (options.query_limit_ != 0 && options.query_limit_ < workload.query_count_) {
+        workload.query_count_ = options.query_limit_;
+    }
+    report["queries"] = workload.query_count_;
+
+    // the search parameter only applies to the vector index
+    Vector<SizeT> ef_list = spec.kind_ == DatasetKind::kVector ? options.ef_list_ : Vector<SizeT>{0};
+    Vector<RunResult> runs;
+    for (SizeT ef : ef_list) {
+        for (SizeT thread_count : options.thread_list_) {
+            RunResult run = RunQueries(spec, options, workload, ef, thread_count);
+            std::cerr << fmt::format("ef: {}, threads: {}, recall@{}: {:.4f}, qps: {:.1f}, p50: {:.3f}ms, p99: {:.3f}ms",
+                                     run.ef_,
+                                     run.threads_,
+                                     options.top_k_,
+                                     run.recall_,
+                                     run.qps_,
+                                     run.latency_p50_ms_,
+                                     run.latency_p99_ms_)
+                      << std::endl;
+            nlohmann::json json_run;
+            json_run["ef"] = run.ef_;
+            json_run["threads"] = run.threads_;
+            json_run["queries"] = run.queries_;
+            json_run["qps"] = run.qps_;
+            json_run[fmt::format("recall@{}", options.top_k_)] = run.recall_;
+            json_run["latency_ms"] = {{"p50", run.latency_p50_ms_}, {"p99", run.latency_p99_ms_}, {"mean", run.latency_mean_ms_}};
+            report["runs"].push_back(json_run);
+            runs.push_back(run);
+        }
+    }
+
+    // The best QPS of each thread count among the runs reaching the recall target, null if none reaches it.
+    for (f64 target : options.recall_targets_) {
+        for (SizeT thread_count : options.thread_list_) {
+            const RunResult *best = nullptr;
+            for (const RunResult &run : runs) {
+                if (run.threads_ == thread_count && run.recall_ >= target && (best == nullptr || run.qps_ > best->qps_)) {
+                    best = &run;
+                }
+            }
+            nlohmann::json json_target;
+            json_target["recall_target"] = target;
+            json_target["threads"] = thread_count;
+            json_target["qps"] = best == nullptr ? nlohmann::json() : nlohmann::json(best->qps_);
+            json_target["ef"] = best == nullptr ? nlohmann::json() : nlohmann::json(best->ef_);
+            report["qps_at_recall"].push_back(json_target);
+        }
+    }
+
+    report["memory"] = {{"peak_rss_bytes", PeakResidentBytes()}};
+    report["disk"] = {{"data_bytes", DirectorySize(options.infinity_dir_ + "/data")}};
+    return report;
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+    RunnerOptions options;
+    options.data_dir_ = String(test_data_path()) + "/benchmark";
+
+    CLI::App app{"Runs a benchmark dataset against the embedded infinity, writes recall, QPS, latency, build time and sizes as json."};
+    String dataset_names;
+    for (const auto &spec : DATASETS) {
+        dataset_names += dataset_names.empty() ? spec.name_ : ", " + spec.name_;
+    }
+    app.add_option("-d,--dataset", options.dataset_, fmt::format("One of {}.", dataset_names))->default_val(options.dataset_);
+    app.add_option("--data-dir", options.data_dir_, "The directory of the dataset files.")->default_val(options.data_dir_);
+    app.add_option("--infinity-dir", options.infinity_dir_, "The directory of the infinity data.")->default_val(options.infinity_dir_);
+    app.add_option("-o,--output", options.output_, "The json report file, stdout by default.");
+    app.add_flag("-b,--build", options.build_, "Recreates the table from the base file and builds the index before the queries.");
+    app.add_option("-k,--top-k", options.top_k_, "The k of recall@k.")->default_val(options.top_k_);
+    app.add_option("-r,--rounds", options.rounds_, "The measured rounds over the queries.")->default_val(options.rounds_);
+    app.add_option("--warmup", options.warmup_rounds_, "The rounds over the queries before the measured ones.")->default_val(options.warmup_rounds_);
+    app.add_option("--query-limit", options.query_limit_, "Runs only the first queries, 0 runs all.")->default_val(options.query_limit_);
+    app.add_option("--m", options.m_, "M of the HNSW index.")->default_val(options.m_);
+    app.add_option("--ef-construction", options.ef_construction_, "ef_construction of the HNSW index.")->default_val(options.ef_construction_);
+    app.add_option("--ef", options.ef_list_, "The ef of the HNSW search to sweep.")->delimiter(',');
+    app.add_option("-t,--threads", options.thread_list_, "The client thread counts to sweep.")->delimiter(',');
+    app.add_option("--recall-targets", options.recall_targets_, "The recall targets to report the QPS at.")->delimiter(',');
+    try {
+        app.parse(argc, argv);
+    } catch (const CLI::ParseError &e) {
+        return app.exit(e);
+    }
+
+    auto spec_iter = std::find_if(DATASETS.begin(), DATASETS.end(), [&](const DatasetSpec &spec) { return spec.name_ == options.dataset_; });
+    if (spec_iter == DATASETS.end()) {
+        std::cerr << fmt::format("Unknown dataset {}, expect one of {}", options.dataset_, dataset_names) << std::endl;
+        return 1;
+    }
+
+    Infinity::LocalInit(options.infinity_dir_);
+    int exit_code = 0;
+    try {
+        nlohmann::json report = RunBenchmark(*spec_iter, options);
+        if (options.output_.empty()) {
+            std::cout << report.dump(4) << std::endl;
+        } else {
+            std::ofstream out(options.output_);
+            out << report.dump(4) << std::endl;
+        }
+    } catch (const std::exception &e) {
+        std::cerr << e.what() << std::endl;
+        exit_code = 1;
+    }
+    Infinity::LocalUnInit();
+    return exit_code;
+}
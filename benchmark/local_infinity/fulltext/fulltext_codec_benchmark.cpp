@@ -0,0 +1,82 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+import stl;
+import profiler;
+import index_defines;
+import posting_field;
+import byte_slice_writer;
+import byte_slice_reader;
+
+using namespace infinity;
+
+// Decoding speed of the doc list codecs: doc id deltas are coded in records of MAX_DOC_PER_RECORD like the doc lists of a chunk.
+// bp128 bit packs full records and VariableByte codes the remainder, stream_vbyte codes the remainder with StreamVByte.
+
+std::vector<u32> MakeDeltas(size_t doc_count, u32 avg_gap, std::mt19937 &rng) {
+    std::geometric_distribution<u32> gap(1.0 / avg_gap);
+    std::vector<u32> deltas(doc_count);
+    for (auto &delta : deltas) {
+        delta = gap(rng) + 1;
+    }
+    return deltas;
+}
+
+void BenchmarkCodec(const std::string &codec_name, bool stream_vbyte, const std::vector<u32> &deltas, size_t rounds) {
+    const Int32Encoder *encoder = GetDocIDEncoder(stream_vbyte);
+    ByteSliceWriter writer;
+    size_t encoded_bytes = 0;
+    for (size_t i = 0; i < deltas.size(); i += MAX_DOC_PER_RECORD) {
+        u32 record_len = std::min<size_t>(MAX_DOC_PER_RECORD, deltas.size() - i);
+        encoded_bytes += encoder->Encode(writer, deltas.data() + i, record_len);
+    }
+
+    u32 buffer[MAX_DOC_PER_RECORD];
+    u64 checksum = 0;
+    BaseProfiler profiler(codec_name);
+    profiler.Begin();
+    for (size_t round = 0; round < rounds; ++round) {
+        ByteSliceReader reader;
+        reader.Open(writer.GetByteSliceList());
+        for (size_t i = 0; i < deltas.size(); i += MAX_DOC_PER_RECORD) {
+            u32 len = encoder->Decode(buffer, MAX_DOC_PER_RECORD, reader);
+            checksum += buffer[len - 1];
+        }
+    }
+    profiler.End();
+    double ns_per_doc = double(profiler.Elapsed()) / (rounds * deltas.size());
+    std::cout << codec_name << "\tdocs: " << deltas.size() << "\tbytes: " << encoded_bytes << "\tns/doc: " << ns_per_doc
+              << "\tchecksum: " << checksum << std::endl;
+}
+
+int main() {
+    std::mt19937 rng(0);
+    // short lists are made of a single partial record, long lists are mostly full records
+    for (size_t doc_count : {10, 100, 1000, 100000}) {
+        for (u32 avg_gap : {4, 256}) {
+            std::vector<u32> deltas = MakeDeltas(doc_count, avg_gap, rng);
+            size_t rounds = std::max<size_t>(1, 10'000'000 / doc_count);
+            std::cout << "average gap: " << avg_gap << std::endl;
+            BenchmarkCodec("bp128", false, deltas, rounds);
+            BenchmarkCodec("stream_vbyte", true, deltas, rounds);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,507 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+import stl;
+import third_party;
+import infinity;
+
+import internal_types;
+import logical_type;
+import embedding_info;
+import create_index_info;
+import column_def;
+import data_type;
+import query_options;
+import query_result;
+import extra_ddl_info;
+import statement_common;
+import knn_expr;
+import match_expr;
+import column_expr;
+import constant_expr;
+import function_expr;
+import parsed_expr;
+import search_expr;
+
+using namespace infinity;
+
+// Inserts, KNN and MATCH queries, deletes and the index merges and checkpoints run together on one table with an HNSW and
+// a full-text index, so the inserts go through the memory indexes. The latencies of each operation are reported by time
+// window as json, to show the interference between the foreground and the background work over time.
+
+namespace {
+
+struct MixedOptions {
+    String infinity_dir_{"/tmp/infinity"};
+    String output_{};
+    SizeT duration_seconds_{60};
+    f64 window_seconds_{1};
+    SizeT dimension_{128};
+    SizeT initial_rows_{100'000};
+    SizeT insert_threads_{1};
+    SizeT insert_batch_rows_{1000};
+    SizeT knn_threads_{2};
+    SizeT match_threads_{2};
+    SizeT top_k_{10};
+    SizeT ef_{100};
+    SizeT delete_interval_seconds_{5};
+    SizeT optimize_interval_seconds_{20};
+    SizeT flush_interval_seconds_{10};
+    u64 seed_{42};
+};
+
+enum class OpType : u8 { kInsert = 0, kKnn, kMatch, kDelete, kOptimize, kFlush, kCount };
+
+const char *OpTypeName(OpType op_type) {
+    switch (op_type) {
+        case OpType::kInsert:
+            return "insert";
+        case OpType::kKnn:
+            return "knn";
+        case OpType::kMatch:
+            return "match";
+        case OpType::kDelete:
+            return "delete";
+        case OpType::kOptimize:
+            return "optimize";
+        case OpType::kFlush:
+            return "flush";
+        default:
+            return "invalid";
+    }
+}
+
+struct OpEvent {
+    OpType op_type_;
+    bool ok_;
+    // since the start of the run
+    f64 start_seconds_;
+    f64 latency_ms_;
+};
+
+const String DB_NAME = "default";
+const String TABLE_NAME = "mixed_workload_benchmark";
+
+using SteadyClock = std::chrono::steady_clock;
+
+// The texts are made of words from a small zipf-like vocabulary, so that the MATCH queries hit posting lists of every length.
+class TextGenerator {
+public:
+    explicit TextGenerator(u64 seed) : rng_(seed) {
+        for (SizeT i = 0; i < VOCABULARY_SIZE; ++i) {
+            vocabulary_.push_back(fmt::format("w{}", i));
+        }
+    }
+
+    String Next(SizeT word_count) {
+        String text;
+        for (SizeT i = 0; i < word_count; ++i) {
+            if (i > 0) {
+                text += ' ';
+            }
+            text += vocabulary_[Word()];
+        }
+        return text;
+    }
+
+private:
+    static constexpr SizeT VOCABULARY_SIZE = 10'000;
+
+    SizeT Word() {
+        // the square of a uniform value skews toward the first words
+        f64 u = uniform_(rng_);
+        return static_cast<SizeT>(u * u * VOCABULARY_SIZE) % VOCABULARY_SIZE;
+    }
+
+    std::mt19937_64 rng_;
+    std::uniform_real_distribution<f64> uniform_{0, 1};
+    Vector<String> vocabulary_;
+};
+
+void CheckResult(const QueryResult &result, const String &what) {
+    if (!result.IsOk()) {
+        throw std::runtime_error(fmt::format("{}: {}", what, result.ToString()));
+    }
+}
+
+void CreateTable(const MixedOptions &options) {
+    SharedPtr<Infinity> infinity = Infinity::LocalConnect();
+    DropTableOptions drop_tb_options;
+    drop_tb_options.conflict_type_ = ConflictType::kIgnore;
+    infinity->DropTable(DB_NAME, TABLE_NAME, drop_tb_options);
+
+    Vector<ColumnDef *> column_defs;
+    column_defs.push_back(new ColumnDef(0, MakeShared<DataType>(LogicalType::kBigInt), "id", HashSet<ConstraintType>()));
+    auto embedding_info = MakeShared<EmbeddingInfo>(EmbeddingDataType::kElemFloat, options.dimension_);
+    column_defs.push_back(new ColumnDef(1, MakeShared<DataType>(LogicalType::kEmbedding, embedding_info), "vec", HashSet<ConstraintType>()));
+    column_defs.push_back(new ColumnDef(2, MakeShared<DataType>(LogicalType::kVarchar), "text", HashSet<ConstraintType>()));
+    QueryResult result = infinity->CreateTable(DB_NAME, TABLE_NAME, std::move(column_defs), Vector<TableConstraint *>{}, CreateTableOptions());
+    CheckResult(result, "Create table");
+
+    auto hnsw_index_list = new Vector<IndexInfo *>();
+    auto hnsw_index = new IndexInfo();
+    hnsw_index->index_type_ = IndexType::kHnsw;
+    hnsw_index->column_name_ = "vec";
+    hnsw_index->index_param_list_ = new Vector<InitParameter *>();
+    hnsw_index->index_param_list_->push_back(new InitParameter("M", "16"));
+    hnsw_index->index_param_list_->push_back(new InitParameter("ef_construction", "200"));
+    hnsw_index->index_param_list_->push_back(new InitParameter("ef", "200"));
+    hnsw_index->index_param_list_->push_back(new InitParameter("metric", "l2"));
+    hnsw_index_list->push_back(hnsw_index);
+    CheckResult(infinity->CreateIndex(DB_NAME, TABLE_NAME, "vec_index", hnsw_index_list, CreateIndexOptions()), "Create hnsw index");
+
+    auto fulltext_index_list = new Vector<IndexInfo *>();
+    auto fulltext_index = new IndexInfo();
+    fulltext_index->index_type_ = IndexType::kFullText;
+    fulltext_index->column_name_ = "text";
+    fulltext_index->index_param_list_ = new Vector<InitParameter *>();
+    fulltext_index_list->push_back(fulltext_index);
+    CheckResult(infinity->CreateIndex(DB_NAME, TABLE_NAME, "text_index", fulltext_index_list, CreateIndexOptions()), "Create full-text index");
+}
+
+// One batch of rows in the binary columnar layout of InsertColumnar, the varchars are prefixed by their i32 length.
+QueryResult InsertBatch(Infinity *infinity, const MixedOptions &options, i64 first_id, std::mt19937_64 &rng, TextGenerator &text_generator) {
+    SizeT row_count = options.insert_batch_rows_;
+    String ids(row_count * sizeof(i64), '\0');
+    String vectors(row_count * options.dimension_ * sizeof(f32), '\0');
+    String texts;
+    std::normal_distribution<f32> normal(0, 1);
+    for (SizeT row = 0; row < row_count; ++row) {
+        i64 id = first_id + row;
+        std::memcpy(ids.data() + row * sizeof(i64), &id, sizeof(i64));
+        auto *vec = reinterpret_cast<f32 *>(vectors.data()) + row * options.dimension_;
+        for (SizeT i = 0; i < options.dimension_; ++i) {
+            vec[i] = normal(rng);
+        }
+        String text = text_generator.Next(32);
+        i32 length = text.size();
+        texts.append(reinterpret_cast<const char *>(&length), sizeof(i32));
+        texts.append(text);
+    }
+    auto columns = new Vector<String>{"id", "vec", "text"};
+    Vector<Vector<std::string_view>> column_data{{ids}, {vectors}, {texts}};
+    return infinity->InsertColumnar(DB_NAME, TABLE_NAME, columns, std::move(column_data));
+}
+
+QueryResult KnnQuery(Infinity *infinity, const MixedOptions &options, std::mt19937_64 &rng) {
+    std::normal_distribution<f32> normal(0, 1);
+    auto knn_expr = new KnnExpr();
+    knn_expr->dimension_ = options.dimension_;
+    knn_expr->distance_type_ = KnnDistanceType::kL2;
+    knn_expr->topn_ = options.top_k_;
+    knn_expr->opt_params_ = new Vector<InitParameter *>();
+    knn_expr->opt_params_->push_back(new InitParameter("ef", std::to_string(options.ef_)));
+    knn_expr->embedding_data_type_ = EmbeddingDataType::kElemFloat;
+    auto embedding_data = new f32[options.dimension_];
+    for (SizeT i = 0; i < options.dimension_; ++i) {
+        embedding_data[i] = normal(rng);
+    }
+    knn_expr->embedding_data_ptr_ = embedding_data;
+    auto column_expr = new ColumnExpr();
+    column_expr->names_.emplace_back("vec");
+    knn_expr->column_expr_ = column_expr;
+
+    auto exprs = new Vector<ParsedExpr *>{knn_expr};
+    auto search_expr = new SearchExpr();
+    search_expr->SetExprs(exprs);
+    auto id_expr = new ColumnExpr();
+    id_expr->names_.emplace_back("id");
+    auto output_columns = new Vector<ParsedExpr *>{id_expr};
+    return infinity->Search(DB_NAME, TABLE_NAME, search_expr, nullptr, output_columns);
+}
+
+QueryResult MatchQuery(Infinity *infinity, const MixedOptions &options, TextGenerator &text_generator) {
+    auto match_expr = new MatchExpr();
+    match_expr->fields_ = "text";
+    match_expr->matching_text_ = text_generator.Next(3);
+    match_expr->options_text_ = fmt::format("topn={}", options.top_k_);
+
+    auto exprs = new Vector<ParsedExpr *>{match_expr};
+    auto search_expr = new SearchExpr();
+    search_expr->SetExprs(exprs);
+    auto id_expr = new ColumnExpr();
+    id_expr->names_.emplace_back("id");
+    auto output_columns = new Vector<ParsedExpr *>{id_expr};
+    return infinity->Search(DB_NAME, TABLE_NAME, search_expr, nullptr, output_columns);
+}
+
+// Deletes the rows with an id below the bound, the deleted rows make the segments candidates of the compaction.
+QueryResult DeleteBelow(Infinity *infinity, i64 id_bound) {
+    auto id_expr = new ColumnExpr();
+    id_expr->names_.emplace_back("id");
+    auto bound_expr = new ConstantExpr(LiteralType::kInteger);
+    bound_expr->integer_value_ = id_bound;
+    auto filter = new FunctionExpr();
+    filter->func_name_ = "<";
+    filter->arguments_ = new Vector<ParsedExpr *>{id_expr, bound_expr};
+    return infinity->Delete(DB_NAME, TABLE_NAME, filter);
+}
+
+class EventRecorder {
+public:
+    explicit EventRecorder(SteadyClock::time_point run_begin) : run_begin_(run_begin) {}
+
+    template <typename Function>
+    void Run(OpType op_type, Function &&fn) {
+        auto begin = SteadyClock::now();
+        bool ok = fn().IsOk();
+        auto end = SteadyClock::now();
+        events_.push_back({op_type,
+                           ok,
+                           std::chrono::duration<f64>(begin - run_begin_).count(),
+                           std::chrono::duration<f64, std::milli>(end - begin).count()});
+    }
+
+    Vector<OpEvent> &events() { return events_; }
+
+private:
+    SteadyClock::time_point run_begin_;
+    Vector<OpEvent> events_;
+};
+
+nlohmann::json LatencySummary(Vector<f64> &latencies_ms, SizeT errors) {
+    std::sort(latencies_ms.begin(), latencies_ms.end());
+    auto percentile = [&](f64 p) { return latencies_ms[std::min(latencies_ms.size() - 1, static_cast<SizeT>(p * latencies_ms.size()))]; };
+    nlohmann::json summary;
+    summary["count"] = latencies_ms.size();
+    summary["errors"] = errors;
+    if (!latencies_ms.empty()) {
+        summary["p50_ms"] = percentile(0.5);
+        summary["p99_ms"] = percentile(0.99);
+        summary["max_ms"] = latencies_ms.back();
+    }
+    return summary;
+}
+
+nlohmann::json Report(const MixedOptions &options, const Vector<OpEvent> &events, f64 run_seconds) {
+    constexpr SizeT op_type_count = static_cast<SizeT>(OpType::kCount);
+    SizeT window_count = static_cast<SizeT>(run_seconds / options.window_seconds_) + 1;
+    // [window][op type]
+    Vector<Array<Vector<f64>, op_type_count>> window_latencies(window_count);
+    Vector<Array<SizeT, op_type_count>> window_errors(window_count);
+    Array<Vector<f64>, op_type_count> total_latencies;
+    Array<SizeT, op_type_count> total_errors{};
+    nlohmann::json report;
+    for (const OpEvent &event : events) {
+        SizeT op_idx = static_cast<SizeT>(event.op_type_);
+        SizeT window = std::min(window_count - 1, static_cast<SizeT>(event.start_seconds_ / options.window_seconds_));
+        if (event.ok_) {
+            window_latencies[window][op_idx].push_back(event.latency_ms_);
+            total_latencies[op_idx].push_back(event.latency_ms_);
+        } else {
+            ++window_errors[window][op_idx];
+            ++total_errors[op_idx];
+        }
+        // the background operations are few and long, each of them is listed
+        if (event.op_type_ == OpType::kDelete || event.op_type_ == OpType::kOptimize || event.op_type_ == OpType::kFlush) {
+            report["background"].push_back(
+                {{"op", OpTypeName(event.op_type_)}, {"ok", event.ok_}, {"start_s", event.start_seconds_}, {"duration_ms", event.latency_ms_}});
+        }
+    }
+
+    report["config"] = {{"duration_seconds", options.duration_seconds_},
+                        {"window_seconds", options.window_seconds_},
+                        {"dimension", options.dimension_},
+                        {"initial_rows", options.initial_rows_},
+                        {"insert_threads", options.insert_threads_},
+                        {"insert_batch_rows", options.insert_batch_rows_},
+                        {"knn_threads", options.knn_threads_},
+                        {"match_threads", options.match_threads_},
+                        {"top_k", options.top_k_},
+                        {"ef", options.ef_}};
+    for (SizeT window = 0; window < window_count; ++window) {
+        nlohmann::json json_window;
+        json_window["start_s"] = window * options.window_seconds_;
+        for (OpType op_type : {OpType::kInsert, OpType::kKnn, OpType::kMatch}) {
+            SizeT op_idx = static_cast<SizeT>(op_type);
+            json_window[OpTypeName(op_type)] = LatencySummary(window_latencies[window][op_idx], window_errors[window][op_idx]);
+        }
+        report["windows"].push_back(json_window);
+    }
+    for (SizeT op_idx = 0; op_idx < op_type_count; ++op_idx) {
+        nlohmann::json summary = LatencySummary(total_latencies[op_idx], total_errors[op_idx]);
+        summary["per_second"] = summary["count"].get<SizeT>() / run_seconds;
+        report["totals"][OpTypeName(static_cast<OpType>(op_idx))] = summary;
+    }
+    if (options.insert_batch_rows_ > 0) {
+        report["totals"]["insert"]["rows_per_second"] = total_latencies[0].size() * options.insert_batch_rows_ / run_seconds;
+    }
+    return report;
+}
+
+nlohmann::json RunMixedWorkload(const MixedOptions &options) {
+    CreateTable(options);
+
+    std::atomic<i64> next_id{0};
+    {
+        SharedPtr<Infinity> infinity = Infinity::LocalConnect();
+        std::mt19937_64 rng(options.seed_);
+        TextGenerator text_generator(options.seed_);
+        for (SizeT rows = 0; rows < options.initial_rows_; rows += options.insert_batch_rows_) {
+            CheckResult(InsertBatch(infinity.get(), options, next_id.fetch_add(options.insert_batch_rows_), rng, text_generator), "Initial insert");
+        }
+        infinity->LocalDisconnect();
+    }
+    std::cerr << fmt::format("Inserted {} initial rows", next_id.load()) << std::endl;
+
+    auto run_begin = SteadyClock::now();
+    auto run_end = run_begin + std::chrono::seconds(options.duration_seconds_);
+    auto running = [&] { return SteadyClock::now() < run_end; };
+
+    SizeT thread_count = options.insert_threads_ + options.knn_threads_ + options.match_threads_ + 1;
+    Vector<UniquePtr<EventRecorder>> recorders;
+    for (SizeT i = 0; i < thread_count; ++i) {
+        recorders.push_back(MakeUnique<EventRecorder>(run_begin));
+    }
+
+    Vector<std::thread> threads;
+    SizeT thread_idx = 0;
+    for (SizeT i = 0; i < options.insert_threads_; ++i, ++thread_idx) {
+        threads.emplace_back([&, thread_idx] {
+            SharedPtr<Infinity> infinity = Infinity::LocalConnect();
+            std::mt19937_64 rng(options.seed_ + thread_idx + 1);
+            TextGenerator text_generator(options.seed_ + thread_idx + 1);
+            while (running()) {
+                recorders[thread_idx]->Run(OpType::kInsert, [&] {
+                    return InsertBatch(infinity.get(), options, next_id.fetch_add(options.insert_batch_rows_), rng, text_generator);
+                });
+            }
+            infinity->LocalDisconnect();
+        });
+    }
+    for (SizeT i = 0; i < options.knn_threads_; ++i, ++thread_idx) {
+        threads.emplace_back([&, thread_idx] {
+            SharedPtr<Infinity> infinity = Infinity::LocalConnect();
+            std::mt19937_64 rng(options.seed_ + thread_idx + 1);
+            while (running()) {
+                recorders[thread_idx]->Run(OpType::kKnn, [&] { return KnnQuery(infinity.get(), options, rng); });
+            }
+            infinity->LocalDisconnect();
+        });
+    }
+    for (SizeT i = 0; i < options.match_threads_; ++i, ++thread_idx) {
+        threads.emplace_back([&, thread_idx] {
+            SharedPtr<Infinity> infinity = Infinity::LocalConnect();
+            TextGenerator text_generator(options.seed_ + thread_idx + 1);
+            while (running()) {
+                recorders[thread_idx]->Run(OpType::kMatch, [&] { return MatchQuery(infinity.get(), options, text_generator); });
+            }
+            infinity->LocalDisconnect();
+        });
+    }
+    // The background thread deletes the oldest tenth of the rows, merges the indexes and checkpoints at their intervals.
+    threads.emplace_back([&, thread_idx] {
+        SharedPtr<Infinity> infinity = Infinity::LocalConnect();
+        auto due = [&](SizeT interval_seconds, SteadyClock::time_point &last) {
+            if (interval_seconds == 0 || SteadyClock::now() - last < std::chrono::seconds(interval_seconds)) {
+                return false;
+            }
+            last = SteadyClock::now();
+            return true;
+        };
+        auto last_delete = run_begin;
+        auto last_optimize = run_begin;
+        auto last_flush = run_begin;
+        i64 deleted_below = 0;
+        while (running()) {
+            if (due(options.delete_interval_seconds_, last_delete)) {
+                deleted_below += (next_id.load() - deleted_below) / 10;
+                recorders[thread_idx]->Run(OpType::kDelete, [&] { return DeleteBelow(infinity.get(), deleted_below); });
+            }
+            if (due(options.optimize_interval_seconds_, last_optimize)) {
+                recorders[thread_idx]->Run(OpType::kOptimize, [&] { return infinity->Optimize(DB_NAME, TABLE_NAME); });
+            }
+            if (due(options.flush_interval_seconds_, last_flush)) {
+                recorders[thread_idx]->Run(OpType::kFlush, [&] { return infinity->Flush(); });
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        }
+        infinity->LocalDisconnect();
+    });
+
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    f64 run_seconds = std::chrono::duration<f64>(SteadyClock::now() - run_begin).count();
+
+    Vector<OpEvent> events;
+    for (auto &recorder : recorders) {
+        events.insert(events.end(), recorder->events().begin(), recorder->events().end());
+    }
+    return Report(options, events, run_seconds);
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+    MixedOptions options;
+    CLI::App app{"Runs inserts, KNN and MATCH queries, deletes, index merges and checkpoints together, writes the latencies over time as json."};
+    app.add_option("--infinity-dir", options.infinity_dir_, "The directory of the infinity data.")->default_val(options.infinity_dir_);
+    app.add_option("-o,--output", options.output_, "The json report file, stdout by default.");
+    app.add_option("-d,--duration", options.duration_seconds_, "Seconds of the mixed workload.")->default_val(options.duration_seconds_);
+    app.add_option("--window", options.window_seconds_, "Seconds of each reported time window.")->default_val(options.window_seconds_);
+    app.add_option("--dimension", options.dimension_, "Dimension of the vectors.")->default_val(options.dimension_);
+    app.add_option("--initial-rows", options.initial_rows_, "Rows inserted before the workload starts.")->default_val(options.initial_rows_);
+    app.add_option("--insert-threads", options.insert_threads_, "Threads inserting batches.")->default_val(options.insert_threads_);
+    app.add_option("--batch-rows", options.insert_batch_rows_, "Rows of each insert.")->default_val(options.insert_batch_rows_);
+    app.add_option("--knn-threads", options.knn_threads_, "Threads of KNN queries.")->default_val(options.knn_threads_);
+    app.add_option("--match-threads", options.match_threads_, "Threads of MATCH queries.")->default_val(options.match_threads_);
+    app.add_option("-k,--top-k", options.top_k_, "Top k of the queries.")->default_val(options.top_k_);
+    app.add_option("--ef", options.ef_, "ef of the KNN queries.")->default_val(options.ef_);
+    app.add_option("--delete-interval", options.delete_interval_seconds_, "Seconds between deletes, 0 disables.")
+        ->default_val(options.delete_interval_seconds_);
+    app.add_option("--optimize-interval", options.optimize_interval_seconds_, "Seconds between index merges, 0 disables.")
+        ->default_val(options.optimize_interval_seconds_);
+    app.add_option("--flush-interval", options.flush_interval_seconds_, "Seconds between checkpoints, 0 disables.")
+        ->default_val(options.flush_interval_seconds_);
+    app.add_option("--seed", options.seed_, "Seed of the generated data.")->default_val(options.seed_);
+    try {
+        app.parse(argc, argv);
+    } catch (const CLI::ParseError &e) {
+        return app.exit(e);
+    }
+    if (options.insert_batch_rows_ == 0 || options.window_seconds_ <= 0) {
+        std::cerr << "The batch rows and the window must be positive" << std::endl;
+        return 1;
+    }
+
+    Infinity::LocalInit(options.infinity_dir_);
+    int exit_code = 0;
+    try {
+        nlohmann::json report = RunMixedWorkload(options);
+        if (options.output_.empty()) {
+            std::cout << report.dump(4) << std::endl;
+        } else {
+            std::ofstream out(options.output_);
+            out << report.dump(4) << std::endl;
+        }
+    } catch (const std::exception &e) {
+        std::cerr << e.what() << std::endl;
+        exit_code = 1;
+    }
+    Infinity::LocalUnInit();
+    return exit_code;
+}
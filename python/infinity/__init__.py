@@ -19,12 +19,13 @@ __version__ = importlib.metadata.version("infinity_sdk")
 from infinity.common import URI, NetworkAddress, LOCAL_HOST
 from infinity.infinity import InfinityConnection
 from infinity.remote_thrift.infinity import RemoteThriftInfinityConnection
+from infinity.remote_thrift.multiplexed import MUX_SDK_PORT
 
 
 def connect(
         uri: URI = LOCAL_HOST
 ) -> InfinityConnection:
-    if isinstance(uri, NetworkAddress) and (uri.port == 9090 or uri.port == 23817 or uri.port == 9070):
+    if isinstance(uri, NetworkAddress) and (uri.port == 9090 or uri.port == 23817 or uri.port == 9070 or uri.port == MUX_SDK_PORT):
         return RemoteThriftInfinityConnection(uri)
     else:
         raise Exception(f"unknown uri: {uri}")
@@ -95,6 +95,8 @@ class ErrorCode(IntEnum):
     MUTIPLE_FUNCTION_MATCHED = 3064,
     INSERT_WITHOUT_VALUES = 3065,
     INVALID_CONFLICT_TYPE = 3066,
+    CURSOR_NOT_FOUND = 3073,
+    READ_ONLY_REPLICA = 3074,
 
     TXN_ROLLBACK = 4001,
     TXN_CONFLICT = 4002,
@@ -104,10 +106,13 @@ class ErrorCode(IntEnum):
     TOO_MANY_CONNECTIONS = 5003,
     CONFIGURATION_LIMIT_EXCEED = 5004,
     QUERY_IS_TOO_COMPLEX = 5005,
+    TOO_MANY_CURSORS = 5006,
+    REPLICA_TOO_STALE = 5007,
 
     QUERY_CANCELLED = 6001,
     QUERY_NOT_SUPPORTED = 6002,
     CLIENT_CLOSE = 6003,
+    QUERY_NOT_FOUND = 6004,
 
     DISK_IO_ERROR = 7001,
     DUPLICATED_FILE = 7002,
@@ -32,6 +32,7 @@ class ShowVariable(Enum):
     HTTP_API_PORT = "http_api_port"
     DATA_URL = "data_url"
     TIME_ZONE = "time_zone"
+    BACKGROUND_TASK_QUEUE = "background_task_queue"
 
 
 # abstract class
@@ -19,20 +19,29 @@ from infinity import URI
 from infinity.infinity import ShowVariable
 from infinity.remote_thrift.infinity_thrift_rpc import *
 from infinity.remote_thrift.infinity_thrift_rpc.ttypes import *
+from infinity.remote_thrift.compression import COMPRESSION, compress, decompress_select_response
+from infinity.remote_thrift.multiplexed import MUX_SDK_PORT, MultiplexedClient, acquire_connection, release_connection
 
 
 class ThriftInfinityClient:
     def __init__(self, uri: URI):
+        self.mux_connection = None
         match uri.port:
             case 9070:
                 self.transport = TTransport.TFramedTransport(
                     TSocket.TSocket(uri.ip, uri.port))  # async
+            case port if port == MUX_SDK_PORT:
+                # the clients of the address share one connection, each with a session of its own
+                self.transport = None
+                self.mux_connection = acquire_connection(uri.ip, uri.port)
+                self.client = MultiplexedClient(self.mux_connection)
             case _:
                 self.transport = TTransport.TBufferedTransport(
                     TSocket.TSocket(uri.ip, uri.port))  # sync
-        self.protocol = TBinaryProtocol.TBinaryProtocol(self.transport)
-        self.client = InfinityService.Client(self.protocol)
-        self.transport.open()
+        if self.transport is not None:
+            self.protocol = TBinaryProtocol.TBinaryProtocol(self.transport)
+            self.client = InfinityService.Client(self.protocol)
+            self.transport.open()
         res = self.client.Connect()
         self.session_id = res.session_id
 
@@ -127,6 +136,13 @@ class ThriftInfinityClient:
                                                 column_names=column_names,
                                                 fields=fields))
 
+    def insert_columnar(self, db_name: str, table_name: str, column_names: list[str], columns: list[ColumnField]):
+        return self.client.InsertColumnar(InsertColumnarRequest(session_id=self.session_id,
+                                                                db_name=db_name,
+                                                                table_name=table_name,
+                                                                column_names=column_names,
+                                                                columns=columns))
+
     def import_data(self, db_name: str, table_name: str, file_name: str, import_options):
         return self.client.Import(ImportRequest(session_id=self.session_id,
                                                 db_name=db_name,
@@ -135,17 +151,62 @@ class ThriftInfinityClient:
                                                 import_option=import_options))
 
     def select(self, db_name: str, table_name: str, select_list, search_expr,
-               where_expr, group_by_list, limit_expr, offset_expr):
-        return self.client.Select(SelectRequest(session_id=self.session_id,
-                                                db_name=db_name,
-                                                table_name=table_name,
-                                                select_list=select_list,
-                                                search_expr=search_expr,
-                                                where_expr=where_expr,
-                                                group_by_list=group_by_list,
-                                                limit_expr=limit_expr,
-                                                offset_expr=offset_expr,
-                                                ))
+               where_expr, group_by_list, limit_expr, offset_expr, arrow_layout: bool = False):
+        res = self.client.Select(SelectRequest(session_id=self.session_id,
+                                               db_name=db_name,
+                                               table_name=table_name,
+                                               select_list=select_list,
+                                               search_expr=search_expr,
+                                               where_expr=where_expr,
+                                               group_by_list=group_by_list,
+                                               limit_expr=limit_expr,
+                                               offset_expr=offset_expr,
+                                               arrow_layout=arrow_layout,
+                                               compression=COMPRESSION,
+                                               ))
+        return decompress_select_response(res)
+
+    def batch_select(self, db_name: str, table_name: str, queries):
+        # the queries run under one snapshot on the server, one response per query in their order
+        requests = [SelectRequest(session_id=self.session_id,
+                                  db_name=db_name,
+                                  table_name=table_name,
+                                  select_list=query.columns,
+                                  search_expr=query.search,
+                                  where_expr=query.filter,
+                                  group_by_list=None,
+                                  limit_expr=query.limit,
+                                  offset_expr=query.offset,
+                                  compression=COMPRESSION) for query in queries]
+        res = self.client.BatchSelect(BatchSelectRequest(session_id=self.session_id, requests=requests))
+        if res.responses is not None:
+            for response in res.responses:
+                decompress_select_response(response)
+        return res
+
+    def open_cursor(self, db_name: str, table_name: str, select_list, search_expr,
+                    where_expr, group_by_list, limit_expr, offset_expr):
+        return self.client.OpenCursor(SelectRequest(session_id=self.session_id,
+                                                    db_name=db_name,
+                                                    table_name=table_name,
+                                                    select_list=select_list,
+                                                    search_expr=search_expr,
+                                                    where_expr=where_expr,
+                                                    group_by_list=group_by_list,
+                                                    limit_expr=limit_expr,
+                                                    offset_expr=offset_expr,
+                                                    compression=COMPRESSION,
+                                                    ))
+
+    def fetch_cursor(self, cursor_id: int, block_count: int):
+        res = self.client.FetchCursor(CursorRequest(session_id=self.session_id,
+                                                    cursor_id=cursor_id,
+                                                    block_count=block_count))
+        return decompress_select_response(res)
+
+    def close_cursor(self, cursor_id: int):
+        return self.client.CloseCursor(CursorRequest(session_id=self.session_id,
+                                                     cursor_id=cursor_id))
 
     def explain(self, db_name: str, table_name: str, select_list, search_expr,
                 where_expr, group_by_list, limit_expr, offset_expr, explain_type):
@@ -176,10 +237,19 @@ class ThriftInfinityClient:
 
     def disconnect(self):
         res = self.client.Disconnect(CommonRequest(session_id=self.session_id))
-        self.transport.close()
+        if self.transport is not None:
+            self.transport.close()
+        else:
+            release_connection(self.mux_connection)
         return res
 
     def upload(self, db_name: str, table_name: str, file_name: str, data, index: int, is_last: bool, total_size: int):
+        compression = CompressionType.NoCompression
+        if COMPRESSION == CompressionType.LZ4:
+            compressed = compress(data)
+            # a chunk that doesn't get smaller is sent as it is
+            if len(compressed) < len(data):
+                data, compression = compressed, CompressionType.LZ4
         return self.client.UploadFileChunk(FileChunk(session_id=self.session_id,
                                                      db_name=db_name,
                                                      table_name=table_name,
@@ -187,7 +257,8 @@ class ThriftInfinityClient:
                                                      index=index,
                                                      data=data,
                                                      is_last=is_last,
-                                                     total_size=total_size))
+                                                     total_size=total_size,
+                                                     compression=compression))
 
     def show_variable(self, variable: ShowVariable):
         return self.client.ShowVariable(ShowVariableRequest(session_id=self.session_id,
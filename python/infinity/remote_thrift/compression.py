@@ -0,0 +1,44 @@
+# Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#      https://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import struct
+
+from infinity.remote_thrift.infinity_thrift_rpc.ttypes import CompressionType
+
+try:
+    import lz4.block as lz4_block
+except ImportError:
+    lz4_block = None
+
+# the compression asked of the server, none without the lz4 package
+COMPRESSION = CompressionType.NoCompression if lz4_block is None else CompressionType.LZ4
+
+
+def compress(data: bytes) -> bytes:
+    """The LZ4 block of the data, prefixed with its size as a 4-byte little-endian integer."""
+    return struct.pack("<I", len(data)) + lz4_block.compress(data, store_size=False)
+
+
+def decompress(data: bytes) -> bytes:
+    (size,) = struct.unpack("<I", data[:4])
+    return lz4_block.decompress(data[4:], uncompressed_size=size)
+
+
+def decompress_select_response(res):
+    """The server compresses the columns of a large response only if the request asked for it."""
+    if res.compression == CompressionType.LZ4:
+        for column_field in res.column_fields:
+            column_field.column_vectors = [decompress(column_vector) for column_vector in column_field.column_vectors]
+        res.compression = CompressionType.NoCompression
+    return res
@@ -165,6 +165,7 @@ struct SearchExpr {
 	1: optional list<MatchExpr> match_exprs,
 	2: optional list<KnnExpr> knn_exprs,
 	3: optional FusionExpr fusion_expr,
+	4: optional KnnExpr rerank_expr,
 }
 
 struct ConstantExpr {
@@ -209,6 +210,16 @@ CSV,
 JSON,
 JSONL,
 FVECS,
+PARQUET,
+ARROW,
+}
+
+/*
+ * A compressed binary is the LZ4 block of the data, prefixed with the size of the data as a 4-byte little-endian integer.
+ */
+enum CompressionType {
+NoCompression,
+LZ4,
 }
 
 enum ColumnType {
@@ -420,6 +431,14 @@ struct InsertRequest {
 5:  i64 session_id,
 }
 
+struct InsertColumnarRequest {
+1:  string db_name,
+2:  string table_name,
+3:  list<string> column_names = [],
+4:  list<ColumnField> columns = [],
+5:  i64 session_id,
+}
+
 struct ImportRequest{
 1:  string db_name,
 2:  string table_name,
@@ -438,6 +457,7 @@ struct FileChunk {
 6:  bool is_last
 7:  i64 session_id,
 8:  i64 total_size,
+9:  CompressionType compression,
 }
 
 enum ExplainType {
@@ -484,6 +504,8 @@ struct SelectRequest {
 9:  optional ParsedExpr limit_expr,
 10:  optional ParsedExpr offset_expr,
 11:  optional list<OrderByExpr> order_by_list = [],
+12:  bool arrow_layout,
+13:  CompressionType compression,
 }
 
 struct SelectResponse {
@@ -491,6 +513,25 @@ struct SelectResponse {
 2: string error_msg,
 3: list<ColumnDef> column_defs = [],
 4: list<ColumnField> column_fields = [];
+5: i64 cursor_id,
+6: CompressionType compression,
+}
+
+struct BatchSelectRequest {
+1: i64 session_id,
+2: list<SelectRequest> requests,
+}
+
+struct BatchSelectResponse {
+1: i64 error_code,
+2: string error_msg,
+3: list<SelectResponse> responses,
+}
+
+struct CursorRequest {
+1: i64 session_id,
+2: i64 cursor_id,
+3: i64 block_count,
 }
 
 struct DeleteRequest {
@@ -529,9 +570,14 @@ CommonResponse CreateTable(1:CreateTableRequest request),
 CommonResponse DropTable(1:DropTableRequest request),
 CommonResponse Insert(1:InsertRequest request),
 CommonResponse Import(1:ImportRequest request),
+CommonResponse InsertColumnar(1:InsertColumnarRequest request),
 SelectResponse Select(1:SelectRequest request),
+BatchSelectResponse BatchSelect(1:BatchSelectRequest request),
+SelectResponse OpenCursor(1:SelectRequest request),
+SelectResponse FetchCursor(1:CursorRequest request),
 SelectResponse Explain(1:ExplainRequest request),
 CommonResponse Delete(1:DeleteRequest request),
+CommonResponse CloseCursor(1:CursorRequest request),
 CommonResponse Update(1:UpdateRequest request),
 UploadResponse UploadFileChunk(1:FileChunk request),
 
@@ -201,12 +201,16 @@ class CopyFileType(object):
     JSON = 1
     JSONL = 2
     FVECS = 3
+    PARQUET = 4
+    ARROW = 5
 
     _VALUES_TO_NAMES = {
         0: "CSV",
         1: "JSON",
         2: "JSONL",
         3: "FVECS",
+        4: "PARQUET",
+        5: "ARROW",
     }
 
     _NAMES_TO_VALUES = {
@@ -214,6 +218,23 @@ class CopyFileType(object):
         "JSON": 1,
         "JSONL": 2,
         "FVECS": 3,
+        "PARQUET": 4,
+        "ARROW": 5,
+    }
+
+
+class CompressionType(object):
+    NoCompression = 0
+    LZ4 = 1
+
+    _VALUES_TO_NAMES = {
+        0: "NoCompression",
+        1: "LZ4",
+    }
+
+    _NAMES_TO_VALUES = {
+        "NoCompression": 0,
+        "LZ4": 1,
     }
 
 
@@ -994,6 +1015,12 @@ class ParsedExprType(object):
                     self.fusion_expr.read(iprot)
                 else:
                     iprot.skip(ftype)
+            elif fid == 4:
+                if ftype == TType.STRUCT:
+                    self.rerank_expr = KnnExpr()
+                    self.rerank_expr.read(iprot)
+                else:
+                    iprot.skip(ftype)
             elif fid == 8:
                 if ftype == TType.STRUCT:
                     self.search_expr = SearchExpr()
@@ -1736,14 +1763,16 @@ class SearchExpr(object):
      - match_exprs
      - knn_exprs
      - fusion_expr
+     - rerank_expr
 
     """
 
 
-    def __init__(self, match_exprs=None, knn_exprs=None, fusion_expr=None,):
+    def __init__(self, match_exprs=None, knn_exprs=None, fusion_expr=None, rerank_expr=None,):
         self.match_exprs = match_exprs
         self.knn_exprs = knn_exprs
         self.fusion_expr = fusion_expr
+        self.rerank_expr = rerank_expr
 
     def read(self, iprot):
         if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
@@ -1810,6 +1839,10 @@ class SearchExpr(object):
             oprot.writeFieldBegin('fusion_expr', TType.STRUCT, 3)
             self.fusion_expr.write(oprot)
             oprot.writeFieldEnd()
+        if self.rerank_expr is not None:
+            oprot.writeFieldBegin('rerank_expr', TType.STRUCT, 4)
+            self.rerank_expr.write(oprot)
+            oprot.writeFieldEnd()
         oprot.writeFieldStop()
         oprot.writeStructEnd()
 
@@ -4884,6 +4917,132 @@ class InsertRequest(object):
         return not (self == other)
 
 
+class InsertColumnarRequest(object):
+    """
+    Attributes:
+     - db_name
+     - table_name
+     - column_names
+     - columns
+     - session_id
+
+    """
+
+
+    def __init__(self, db_name=None, table_name=None, column_names=[
+    ], columns=[
+    ], session_id=None,):
+        self.db_name = db_name
+        self.table_name = table_name
+        if column_names is self.thrift_spec[3][4]:
+            column_names = [
+            ]
+        self.column_names = column_names
+        if columns is self.thrift_spec[4][4]:
+            columns = [
+            ]
+        self.columns = columns
+        self.session_id = session_id
+
+    def read(self, iprot):
+        if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
+            iprot._fast_decode(self, iprot, [self.__class__, self.thrift_spec])
+            return
+        iprot.readStructBegin()
+        while True:
+            (fname, ftype, fid) = iprot.readFieldBegin()
+            if ftype == TType.STOP:
+                break
+            if fid == 1:
+                if ftype == TType.STRING:
+                    self.db_name = iprot.readString().decode('utf-8', errors='replace') if sys.version_info[0] == 2 else iprot.readString()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 2:
+                if ftype == TType.STRING:
+                    self.table_name = iprot.readString().decode('utf-8', errors='replace') if sys.version_info[0] == 2 else iprot.readString()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 3:
+                if ftype == TType.LIST:
+                    self.column_names = []
+                    (_etype171, _size168) = iprot.readListBegin()
+                    for _i172 in range(_size168):
+                        _elem173 = iprot.readString().decode('utf-8', errors='replace') if sys.version_info[0] == 2 else iprot.readString()
+                        self.column_names.append(_elem173)
+                    iprot.readListEnd()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 4:
+                if ftype == TType.LIST:
+                    self.columns = []
+                    (_etype177, _size174) = iprot.readListBegin()
+                    for _i178 in range(_size174):
+                        _elem179 = ColumnField()
+                        _elem179.read(iprot)
+                        self.columns.append(_elem179)
+                    iprot.readListEnd()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 5:
+                if ftype == TType.I64:
+                    self.session_id = iprot.readI64()
+                else:
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('InsertColumnarRequest')
+        if self.db_name is not None:
+            oprot.writeFieldBegin('db_name', TType.STRING, 1)
+            oprot.writeString(self.db_name.encode('utf-8') if sys.version_info[0] == 2 else self.db_name)
+            oprot.writeFieldEnd()
+        if self.table_name is not None:
+            oprot.writeFieldBegin('table_name', TType.STRING, 2)
+            oprot.writeString(self.table_name.encode('utf-8') if sys.version_info[0] == 2 else self.table_name)
+            oprot.writeFieldEnd()
+        if self.column_names is not None:
+            oprot.writeFieldBegin('column_names', TType.LIST, 3)
+            oprot.writeListBegin(TType.STRING, len(self.column_names))
+            for iter180 in self.column_names:
+                oprot.writeString(iter180.encode('utf-8') if sys.version_info[0] == 2 else iter180)
+            oprot.writeListEnd()
+            oprot.writeFieldEnd()
+        if self.columns is not None:
+            oprot.writeFieldBegin('columns', TType.LIST, 4)
+            oprot.writeListBegin(TType.STRUCT, len(self.columns))
+            for iter181 in self.columns:
+                iter181.write(oprot)
+            oprot.writeListEnd()
+            oprot.writeFieldEnd()
+        if self.session_id is not None:
+            oprot.writeFieldBegin('session_id', TType.I64, 5)
+            oprot.writeI64(self.session_id)
+            oprot.writeFieldEnd()
+        oprot.writeFieldStop()
+        oprot.writeStructEnd()
+
+    def validate(self):
+        return
+
+    def __repr__(self):
+        L = ['%s=%r' % (key, value)
+             for key, value in self.__dict__.items()]
+        return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+    def __eq__(self, other):
+        return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+    def __ne__(self, other):
+        return not (self == other)
+
+
 class ImportRequest(object):
     """
     Attributes:
@@ -5008,11 +5167,12 @@ class FileChunk(object):
      - is_last
      - session_id
      - total_size
+     - compression
 
     """
 
 
-    def __init__(self, db_name=None, table_name=None, file_name=None, data=None, index=None, is_last=None, session_id=None, total_size=None,):
+    def __init__(self, db_name=None, table_name=None, file_name=None, data=None, index=None, is_last=None, session_id=None, total_size=None, compression=None,):
         self.db_name = db_name
         self.table_name = table_name
         self.file_name = file_name
@@ -5021,6 +5181,7 @@ class FileChunk(object):
         self.is_last = is_last
         self.session_id = session_id
         self.total_size = total_size
+        self.compression = compression
 
     def read(self, iprot):
         if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
@@ -5071,6 +5232,11 @@ class FileChunk(object):
                     self.total_size = iprot.readI64()
                 else:
                     iprot.skip(ftype)
+            elif fid == 9:
+                if ftype == TType.I32:
+                    self.compression = iprot.readI32()
+                else:
+                    iprot.skip(ftype)
             else:
                 iprot.skip(ftype)
             iprot.readFieldEnd()
@@ -5113,6 +5279,10 @@ class FileChunk(object):
             oprot.writeFieldBegin('total_size', TType.I64, 8)
             oprot.writeI64(self.total_size)
             oprot.writeFieldEnd()
+        if self.compression is not None:
+            oprot.writeFieldBegin('compression', TType.I32, 9)
+            oprot.writeI32(self.compression)
+            oprot.writeFieldEnd()
         oprot.writeFieldStop()
         oprot.writeStructEnd()
 
@@ -5483,6 +5653,8 @@ class SelectRequest(object):
      - limit_expr
      - offset_expr
      - order_by_list
+     - arrow_layout
+     - compression
 
     """
 
@@ -5490,7 +5662,7 @@ class SelectRequest(object):
     def __init__(self, session_id=None, db_name=None, table_name=None, select_list=[
     ], search_expr=None, where_expr=None, group_by_list=[
     ], having_expr=None, limit_expr=None, offset_expr=None, order_by_list=[
-    ],):
+    ], arrow_layout=None, compression=None,):
         self.session_id = session_id
         self.db_name = db_name
         self.table_name = table_name
@@ -5511,6 +5683,8 @@ class SelectRequest(object):
             order_by_list = [
             ]
         self.order_by_list = order_by_list
+        self.arrow_layout = arrow_layout
+        self.compression = compression
 
     def read(self, iprot):
         if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
@@ -5599,6 +5773,16 @@ class SelectRequest(object):
                     iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
+            elif fid == 12:
+                if ftype == TType.BOOL:
+                    self.arrow_layout = iprot.readBool()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 13:
+                if ftype == TType.I32:
+                    self.compression = iprot.readI32()
+                else:
+                    iprot.skip(ftype)
             else:
                 iprot.skip(ftype)
             iprot.readFieldEnd()
@@ -5662,6 +5846,14 @@ class SelectRequest(object):
                 iter237.write(oprot)
             oprot.writeListEnd()
             oprot.writeFieldEnd()
+        if self.arrow_layout is not None:
+            oprot.writeFieldBegin('arrow_layout', TType.BOOL, 12)
+            oprot.writeBool(self.arrow_layout)
+            oprot.writeFieldEnd()
+        if self.compression is not None:
+            oprot.writeFieldBegin('compression', TType.I32, 13)
+            oprot.writeI32(self.compression)
+            oprot.writeFieldEnd()
         oprot.writeFieldStop()
         oprot.writeStructEnd()
 
@@ -5687,13 +5879,15 @@ class SelectResponse(object):
      - error_msg
      - column_defs
      - column_fields
+     - cursor_id
+     - compression
 
     """
 
 
     def __init__(self, error_code=None, error_msg=None, column_defs=[
     ], column_fields=[
-    ],):
+    ], cursor_id=None, compression=None,):
         self.error_code = error_code
         self.error_msg = error_msg
         if column_defs is self.thrift_spec[3][4]:
@@ -5704,6 +5898,8 @@ class SelectResponse(object):
             column_fields = [
             ]
         self.column_fields = column_fields
+        self.cursor_id = cursor_id
+        self.compression = compression
 
     def read(self, iprot):
         if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
@@ -5746,6 +5942,16 @@ class SelectResponse(object):
                     iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
+            elif fid == 5:
+                if ftype == TType.I64:
+                    self.cursor_id = iprot.readI64()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 6:
+                if ftype == TType.I32:
+                    self.compression = iprot.readI32()
+                else:
+                    iprot.skip(ftype)
             else:
                 iprot.skip(ftype)
             iprot.readFieldEnd()
@@ -5778,6 +5984,258 @@ class SelectResponse(object):
                 iter251.write(oprot)
             oprot.writeListEnd()
             oprot.writeFieldEnd()
+        if self.cursor_id is not None:
+            oprot.writeFieldBegin('cursor_id', TType.I64, 5)
+            oprot.writeI64(self.cursor_id)
+            oprot.writeFieldEnd()
+        if self.compression is not None:
+            oprot.writeFieldBegin('compression', TType.I32, 6)
+            oprot.writeI32(self.compression)
+            oprot.writeFieldEnd()
+        oprot.writeFieldStop()
+        oprot.writeStructEnd()
+
+    def validate(self):
+        return
+
+    def __repr__(self):
+        L = ['%s=%r' % (key, value)
+             for key, value in self.__dict__.items()]
+        return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+    def __eq__(self, other):
+        return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+    def __ne__(self, other):
+        return not (self == other)
+
+
+class BatchSelectRequest(object):
+    """
+    Attributes:
+     - session_id
+     - requests
+
+    """
+
+
+    def __init__(self, session_id=None, requests=None,):
+        self.session_id = session_id
+        self.requests = requests
+
+    def read(self, iprot):
+        if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
+            iprot._fast_decode(self, iprot, [self.__class__, self.thrift_spec])
+            return
+        iprot.readStructBegin()
+        while True:
+            (fname, ftype, fid) = iprot.readFieldBegin()
+            if ftype == TType.STOP:
+                break
+            if fid == 1:
+                if ftype == TType.I64:
+                    self.session_id = iprot.readI64()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 2:
+                if ftype == TType.LIST:
+                    self.requests = []
+                    (_etype262, _size259) = iprot.readListBegin()
+                    for _i263 in range(_size259):
+                        _elem264 = SelectRequest()
+                        _elem264.read(iprot)
+                        self.requests.append(_elem264)
+                    iprot.readListEnd()
+                else:
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('BatchSelectRequest')
+        if self.session_id is not None:
+            oprot.writeFieldBegin('session_id', TType.I64, 1)
+            oprot.writeI64(self.session_id)
+            oprot.writeFieldEnd()
+        if self.requests is not None:
+            oprot.writeFieldBegin('requests', TType.LIST, 2)
+            oprot.writeListBegin(TType.STRUCT, len(self.requests))
+            for iter265 in self.requests:
+                iter265.write(oprot)
+            oprot.writeListEnd()
+            oprot.writeFieldEnd()
+        oprot.writeFieldStop()
+        oprot.writeStructEnd()
+
+    def validate(self):
+        return
+
+    def __repr__(self):
+        L = ['%s=%r' % (key, value)
+             for key, value in self.__dict__.items()]
+        return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+    def __eq__(self, other):
+        return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+    def __ne__(self, other):
+        return not (self == other)
+
+
+class BatchSelectResponse(object):
+    """
+    Attributes:
+     - error_code
+     - error_msg
+     - responses
+
+    """
+
+
+    def __init__(self, error_code=None, error_msg=None, responses=None,):
+        self.error_code = error_code
+        self.error_msg = error_msg
+        self.responses = responses
+
+    def read(self, iprot):
+        if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
+            iprot._fast_decode(self, iprot, [self.__class__, self.thrift_spec])
+            return
+        iprot.readStructBegin()
+        while True:
+            (fname, ftype, fid) = iprot.readFieldBegin()
+            if ftype == TType.STOP:
+                break
+            if fid == 1:
+                if ftype == TType.I64:
+                    self.error_code = iprot.readI64()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 2:
+                if ftype == TType.STRING:
+                    self.error_msg = iprot.readString().decode('utf-8', errors='replace') if sys.version_info[0] == 2 else iprot.readString()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 3:
+                if ftype == TType.LIST:
+                    self.responses = []
+                    (_etype269, _size266) = iprot.readListBegin()
+                    for _i270 in range(_size266):
+                        _elem271 = SelectResponse()
+                        _elem271.read(iprot)
+                        self.responses.append(_elem271)
+                    iprot.readListEnd()
+                else:
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('BatchSelectResponse')
+        if self.error_code is not None:
+            oprot.writeFieldBegin('error_code', TType.I64, 1)
+            oprot.writeI64(self.error_code)
+            oprot.writeFieldEnd()
+        if self.error_msg is not None:
+            oprot.writeFieldBegin('error_msg', TType.STRING, 2)
+            oprot.writeString(self.error_msg.encode('utf-8') if sys.version_info[0] == 2 else self.error_msg)
+            oprot.writeFieldEnd()
+        if self.responses is not None:
+            oprot.writeFieldBegin('responses', TType.LIST, 3)
+            oprot.writeListBegin(TType.STRUCT, len(self.responses))
+            for iter272 in self.responses:
+                iter272.write(oprot)
+            oprot.writeListEnd()
+            oprot.writeFieldEnd()
+        oprot.writeFieldStop()
+        oprot.writeStructEnd()
+
+    def validate(self):
+        return
+
+    def __repr__(self):
+        L = ['%s=%r' % (key, value)
+             for key, value in self.__dict__.items()]
+        return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+    def __eq__(self, other):
+        return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+    def __ne__(self, other):
+        return not (self == other)
+
+
+class CursorRequest(object):
+    """
+    Attributes:
+     - session_id
+     - cursor_id
+     - block_count
+
+    """
+
+
+    def __init__(self, session_id=None, cursor_id=None, block_count=None,):
+        self.session_id = session_id
+        self.cursor_id = cursor_id
+        self.block_count = block_count
+
+    def read(self, iprot):
+        if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
+            iprot._fast_decode(self, iprot, [self.__class__, self.thrift_spec])
+            return
+        iprot.readStructBegin()
+        while True:
+            (fname, ftype, fid) = iprot.readFieldBegin()
+            if ftype == TType.STOP:
+                break
+            if fid == 1:
+                if ftype == TType.I64:
+                    self.session_id = iprot.readI64()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 2:
+                if ftype == TType.I64:
+                    self.cursor_id = iprot.readI64()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 3:
+                if ftype == TType.I64:
+                    self.block_count = iprot.readI64()
+                else:
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('CursorRequest')
+        if self.session_id is not None:
+            oprot.writeFieldBegin('session_id', TType.I64, 1)
+            oprot.writeI64(self.session_id)
+            oprot.writeFieldEnd()
+        if self.cursor_id is not None:
+            oprot.writeFieldBegin('cursor_id', TType.I64, 2)
+            oprot.writeI64(self.cursor_id)
+            oprot.writeFieldEnd()
+        if self.block_count is not None:
+            oprot.writeFieldBegin('block_count', TType.I64, 3)
+            oprot.writeI64(self.block_count)
+            oprot.writeFieldEnd()
         oprot.writeFieldStop()
         oprot.writeStructEnd()
 
@@ -6260,6 +6718,7 @@ SearchExpr.thrift_spec = (
     (1, TType.LIST, 'match_exprs', (TType.STRUCT, [MatchExpr, None], False), None, ),  # 1
     (2, TType.LIST, 'knn_exprs', (TType.STRUCT, [KnnExpr, None], False), None, ),  # 2
     (3, TType.STRUCT, 'fusion_expr', [FusionExpr, None], None, ),  # 3
+    (4, TType.STRUCT, 'rerank_expr', [KnnExpr, None], None, ),  # 4
 )
 all_structs.append(ConstantExpr)
 ConstantExpr.thrift_spec = (
@@ -6531,6 +6990,17 @@ InsertRequest.thrift_spec = (
     ], ),  # 4
     (5, TType.I64, 'session_id', None, None, ),  # 5
 )
+all_structs.append(InsertColumnarRequest)
+InsertColumnarRequest.thrift_spec = (
+    None,  # 0
+    (1, TType.STRING, 'db_name', 'UTF8', None, ),  # 1
+    (2, TType.STRING, 'table_name', 'UTF8', None, ),  # 2
+    (3, TType.LIST, 'column_names', (TType.STRING, 'UTF8', False), [
+    ], ),  # 3
+    (4, TType.LIST, 'columns', (TType.STRUCT, [ColumnField, None], False), [
+    ], ),  # 4
+    (5, TType.I64, 'session_id', None, None, ),  # 5
+)
 all_structs.append(ImportRequest)
 ImportRequest.thrift_spec = (
     None,  # 0
@@ -6552,6 +7022,7 @@ FileChunk.thrift_spec = (
     (6, TType.BOOL, 'is_last', None, None, ),  # 6
     (7, TType.I64, 'session_id', None, None, ),  # 7
     (8, TType.I64, 'total_size', None, None, ),  # 8
+    (9, TType.I32, 'compression', None, None, ),  # 9
 )
 all_structs.append(ExplainRequest)
 ExplainRequest.thrift_spec = (
@@ -6599,6 +7070,8 @@ SelectRequest.thrift_spec = (
     (10, TType.STRUCT, 'offset_expr', [ParsedExpr, None], None, ),  # 10
     (11, TType.LIST, 'order_by_list', (TType.STRUCT, [OrderByExpr, None], False), [
     ], ),  # 11
+    (12, TType.BOOL, 'arrow_layout', None, None, ),  # 12
+    (13, TType.I32, 'compression', None, None, ),  # 13
 )
 all_structs.append(SelectResponse)
 SelectResponse.thrift_spec = (
@@ -6609,6 +7082,28 @@ SelectResponse.thrift_spec = (
     ], ),  # 3
     (4, TType.LIST, 'column_fields', (TType.STRUCT, [ColumnField, None], False), [
     ], ),  # 4
+    (5, TType.I64, 'cursor_id', None, None, ),  # 5
+    (6, TType.I32, 'compression', None, None, ),  # 6
+)
+all_structs.append(BatchSelectRequest)
+BatchSelectRequest.thrift_spec = (
+    None,  # 0
+    (1, TType.I64, 'session_id', None, None, ),  # 1
+    (2, TType.LIST, 'requests', (TType.STRUCT, [SelectRequest, None], False), None, ),  # 2
+)
+all_structs.append(BatchSelectResponse)
+BatchSelectResponse.thrift_spec = (
+    None,  # 0
+    (1, TType.I64, 'error_code', None, None, ),  # 1
+    (2, TType.STRING, 'error_msg', 'UTF8', None, ),  # 2
+    (3, TType.LIST, 'responses', (TType.STRUCT, [SelectResponse, None], False), None, ),  # 3
+)
+all_structs.append(CursorRequest)
+CursorRequest.thrift_spec = (
+    None,  # 0
+    (1, TType.I64, 'session_id', None, None, ),  # 1
+    (2, TType.I64, 'cursor_id', None, None, ),  # 2
+    (3, TType.I64, 'block_count', None, None, ),  # 3
 )
 all_structs.append(DeleteRequest)
 DeleteRequest.thrift_spec = (
@@ -0,0 +1,166 @@
+# Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#      https://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import socket
+import struct
+import threading
+from concurrent.futures import Future
+
+from thrift.protocol import TBinaryProtocol
+from thrift.transport import TTransport
+
+from infinity.remote_thrift.infinity_thrift_rpc import InfinityService
+
+# the default port of the multiplexed thrift server
+MUX_SDK_PORT = 23818
+
+
+class MultiplexedConnection:
+    """
+    One socket to the multiplexed thrift server, shared by the clients of one address. Each request is a framed message
+    with a seqid of its own, the responses come back in any order and are matched to their requests by the seqid.
+    The requests of a client, one session, are still sent one at a time.
+    """
+
+    def __init__(self, ip: str, port: int):
+        self._socket = socket.create_connection((ip, port))
+        self._socket.setsockopt(socket.IPPROTO_TCP, socket.TCP_NODELAY, 1)
+        self._send_lock = threading.Lock()
+        self._lock = threading.Lock()
+        self._next_seqid = 0
+        self._pending: dict[int, Future] = {}
+        self._closed = False
+        self._ref_count = 0
+        self._reader = threading.Thread(target=self._read_responses, daemon=True)
+        self._reader.start()
+
+    def call(self, method: str, *args) -> Future:
+        """Send a request, the future is completed with the result once its response arrives."""
+        future = Future()
+        future.method = method
+        with self._lock:
+            if self._closed:
+                raise ConnectionError("multiplexed connection is closed")
+            seqid = self._next_seqid
+            self._next_seqid = (self._next_seqid + 1) & 0x7fffffff
+            self._pending[seqid] = future
+
+        buffer = TTransport.TMemoryBuffer()
+        client = InfinityService.Client(TBinaryProtocol.TBinaryProtocol(buffer))
+        client._seqid = seqid
+        getattr(client, "send_" + method)(*args)
+        message = buffer.getvalue()
+        try:
+            with self._send_lock:
+                self._socket.sendall(struct.pack("!I", len(message)) + message)
+        except OSError as e:
+            with self._lock:
+                self._pending.pop(seqid, None)
+            raise ConnectionError(e)
+        return future
+
+    def _read_exactly(self, size: int) -> bytes:
+        chunks = []
+        while size > 0:
+            chunk = self._socket.recv(min(size, 1 << 20))
+            if not chunk:
+                raise ConnectionError("multiplexed connection is closed by the server")
+            chunks.append(chunk)
+            size -= len(chunk)
+        return b"".join(chunks)
+
+    def _read_responses(self):
+        error = None
+        try:
+            while True:
+                (size,) = struct.unpack("!I", self._read_exactly(4))
+                message = self._read_exactly(size)
+                # the seqid follows the version, the method name and its length of the message header
+                (name_length,) = struct.unpack("!i", message[4:8])
+                (seqid,) = struct.unpack("!i", message[8 + name_length:12 + name_length])
+                with self._lock:
+                    future = self._pending.pop(seqid, None)
+                if future is None:
+                    continue
+                client = InfinityService.Client(TBinaryProtocol.TBinaryProtocol(TTransport.TMemoryBuffer(message)))
+                try:
+                    future.set_result(getattr(client, "recv_" + future.method)())
+                except Exception as e:
+                    future.set_exception(e)
+        except (OSError, ConnectionError) as e:
+            error = e
+        with self._lock:
+            self._closed = True
+            pending, self._pending = self._pending, {}
+        for future in pending.values():
+            future.set_exception(ConnectionError(error))
+
+    def acquire(self):
+        with self._lock:
+            self._ref_count += 1
+        return self
+
+    def release(self) -> bool:
+        """Drop a reference, the socket is closed with the last one. True if it was the last."""
+        with self._lock:
+            self._ref_count -= 1
+            if self._ref_count > 0:
+                return False
+            self._closed = True
+        try:
+            self._socket.shutdown(socket.SHUT_RDWR)
+        except OSError:
+            pass
+        self._socket.close()
+        return True
+
+
+class MultiplexedClient:
+    """The methods of InfinityService.Client, each a request on the shared connection."""
+
+    def __init__(self, connection: MultiplexedConnection):
+        self._connection = connection
+
+    def call_async(self, method: str, *args) -> Future:
+        return self._connection.call(method, *args)
+
+    def __getattr__(self, method: str):
+        if not hasattr(InfinityService.Client, "send_" + method):
+            raise AttributeError(method)
+
+        def call(*args):
+            return self._connection.call(method, *args).result()
+
+        return call
+
+
+_connections: dict[tuple[str, int], MultiplexedConnection] = {}
+_connections_lock = threading.Lock()
+
+
+def acquire_connection(ip: str, port: int) -> MultiplexedConnection:
+    with _connections_lock:
+        connection = _connections.get((ip, port))
+        if connection is None or connection._closed:
+            connection = MultiplexedConnection(ip, port)
+            _connections[(ip, port)] = connection
+        return connection.acquire()
+
+
+def release_connection(connection: MultiplexedConnection):
+    with _connections_lock:
+        if connection.release():
+            for key, value in list(_connections.items()):
+                if value is connection:
+                    del _connections[key]
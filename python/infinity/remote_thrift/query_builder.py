@@ -15,7 +15,7 @@
 from __future__ import annotations
 
 from abc import ABC
-from typing import List, Optional, Any
+from typing import List, Optional, Any, Iterator
 
 import numpy as np
 import pandas as pd
@@ -72,6 +72,22 @@ class InfinityThriftQueryBuilder(ABC):
         if self._search.knn_exprs is None:
             self._search.knn_exprs = list()
 
+        knn_expr = self._knn_expr(vector_column_name, embedding_data, embedding_data_type, distance_type, topn,
+                                  knn_params)
+        self._search.knn_exprs.append(knn_expr)
+        return self
+
+    def rerank(self, vector_column_name: str, embedding_data: VEC, embedding_data_type: str, distance_type: str,
+               topn: int, knn_params: {} = None) -> InfinityThriftQueryBuilder:
+        if self._search is None or self._search.fusion_expr is None:
+            raise Exception("rerank reranks the rows of fusion, call fusion first")
+        self._search.rerank_expr = self._knn_expr(vector_column_name, embedding_data, embedding_data_type,
+                                                  distance_type, topn, knn_params)
+        return self
+
+    @staticmethod
+    def _knn_expr(vector_column_name: str, embedding_data: VEC, embedding_data_type: str, distance_type: str,
+                  topn: int, knn_params: {} = None) -> KnnExpr:
         column_expr = ColumnExpr(column_name=[vector_column_name], star=False)
 
         if not isinstance(topn, int):
@@ -136,11 +152,8 @@ class InfinityThriftQueryBuilder(ABC):
             for k, v in knn_params.items():
                 knn_opt_params.append(InitParameter(k, v))
 
-        knn_expr = KnnExpr(column_expr=column_expr, embedding_data=data, embedding_data_type=elem_type,
-                           distance_type=dist_type, topn=topn, opt_params=knn_opt_params)
-        # print(knn_expr)
-        self._search.knn_exprs.append(knn_expr)
-        return self
+        return KnnExpr(column_expr=column_expr, embedding_data=data, embedding_data_type=elem_type,
+                       distance_type=dist_type, topn=topn, opt_params=knn_opt_params)
 
     def match(self, fields: str, matching_text: str, options_text: str = '') -> InfinityThriftQueryBuilder:
         if self._search is None:
@@ -226,6 +239,18 @@ class InfinityThriftQueryBuilder(ABC):
         self.reset()
         return self._table._execute_query(query)
 
+    def to_query(self) -> Query:
+        # the query built so far, to be run later, as one of a batch
+        query = Query(
+            columns=self._columns,
+            search=self._search,
+            filter=self._filter,
+            limit=self._limit,
+            offset=self._offset
+        )
+        self.reset()
+        return query
+
     def to_df(self) -> pd.DataFrame:
         df_dict = {}
         data_dict, data_type_dict = self.to_result()
@@ -235,11 +260,32 @@ class InfinityThriftQueryBuilder(ABC):
             df_dict[k] = data_series
         return pd.DataFrame(df_dict)
 
+    def to_df_batches(self, block_count: int = 1) -> Iterator[pd.DataFrame]:
+        # the result through a cursor, one DataFrame of block_count blocks at a time instead of the whole result at once
+        query = Query(
+            columns=self._columns,
+            search=self._search,
+            filter=self._filter,
+            limit=self._limit,
+            offset=self._offset
+        )
+        self.reset()
+        for data_dict, data_type_dict in self._table._execute_query_batches(query, block_count):
+            yield pd.DataFrame({k: pd.Series(v, dtype=logic_type_to_dtype(data_type_dict[k])) for k, v in data_dict.items()})
+
     def to_pl(self) -> pl.DataFrame:
-        return pl.from_pandas(self.to_df())
+        return pl.from_arrow(self.to_arrow())
 
     def to_arrow(self) -> Table:
-        return pa.Table.from_pandas(self.to_df())
+        query = Query(
+            columns=self._columns,
+            search=self._search,
+            filter=self._filter,
+            limit=self._limit,
+            offset=self._offset
+        )
+        self.reset()
+        return self._table._execute_query_arrow(query)
 
     def explain(self, explain_type=ExplainType.Physical) -> Any:
         query = ExplainQuery(
@@ -15,6 +15,7 @@ import functools
 import inspect
 import os
 import numpy as np
+import pandas as pd
 from abc import ABC
 from typing import Optional, Union, List, Any
 
@@ -25,7 +26,7 @@ from infinity.common import INSERT_DATA, VEC
 from infinity.errors import ErrorCode
 from infinity.index import IndexInfo
 from infinity.remote_thrift.query_builder import Query, InfinityThriftQueryBuilder, ExplainQuery
-from infinity.remote_thrift.types import build_result
+from infinity.remote_thrift.types import build_result, build_arrow_table, logic_type_to_dtype
 from infinity.remote_thrift.utils import traverse_conditions, name_validity_check, select_res_to_polars
 from infinity.table import Table, ExplainType
 from infinity.common import ConflictType
@@ -175,6 +176,46 @@ class RemoteTable(Table, ABC):
         else:
             raise Exception(f"ERROR:{res.error_code}, {res.error_msg}")
 
+    def insert_columnar(self, data: dict[str, Union[np.ndarray, list[str]]]):
+        # {"c1": np.array([1, 2], dtype=np.int32), "c2": ["a", "b"], "c3": np.array([[1.0, 2.0], [3.0, 4.0]], dtype=np.float32)}
+        # the arrays must have the dtype of the columns, embeddings are 2-D arrays of one row per embedding
+        column_names: list[str] = []
+        columns: list[ttypes.ColumnField] = []
+        for column_name, values in data.items():
+            if isinstance(values, np.ndarray):
+                column_type = {np.dtype(np.bool_): ttypes.ColumnType.ColumnBool,
+                               np.dtype(np.int8): ttypes.ColumnType.ColumnInt8,
+                               np.dtype(np.int16): ttypes.ColumnType.ColumnInt16,
+                               np.dtype(np.int32): ttypes.ColumnType.ColumnInt32,
+                               np.dtype(np.int64): ttypes.ColumnType.ColumnInt64,
+                               np.dtype(np.float32): ttypes.ColumnType.ColumnFloat32,
+                               np.dtype(np.float64): ttypes.ColumnType.ColumnFloat64}.get(values.dtype)
+                if column_type is None:
+                    raise Exception(f"Invalid column data type: {values.dtype}")
+                if values.ndim == 2:
+                    column_type = ttypes.ColumnType.ColumnEmbedding
+                column_vector = np.ascontiguousarray(values).tobytes()
+            elif isinstance(values, list):
+                column_type = ttypes.ColumnType.ColumnVarchar
+                column_vector = bytearray()
+                for value in values:
+                    encoded = value.encode("utf-8")
+                    column_vector += len(encoded).to_bytes(4, byteorder="little", signed=True)
+                    column_vector += encoded
+                column_vector = bytes(column_vector)
+            else:
+                raise Exception(f"Invalid column data: {column_name}")
+            column_names.append(column_name)
+            columns.append(ttypes.ColumnField(column_type=column_type, column_vectors=[column_vector],
+                                              column_name=column_name))
+
+        res = self._conn.insert_columnar(db_name=self._db_name, table_name=self._table_name,
+                                         column_names=column_names, columns=columns)
+        if res.error_code == ErrorCode.OK:
+            return res
+        else:
+            raise Exception(f"ERROR:{res.error_code}, {res.error_msg}")
+
     def import_data(self, file_path: str, import_options: {} = None):
         options = ttypes.ImportOption()
         options.has_header = False
@@ -193,6 +234,10 @@ class RemoteTable(Table, ABC):
                         options.copy_file_type = ttypes.CopyFileType.JSONL
                     elif file_type == 'fvecs':
                         options.copy_file_type = ttypes.CopyFileType.FVECS
+                    elif file_type == 'parquet':
+                        options.copy_file_type = ttypes.CopyFileType.PARQUET
+                    elif file_type == 'arrow':
+                        options.copy_file_type = ttypes.CopyFileType.ARROW
                     else:
                         raise Exception("Unrecognized import file type")
                 elif key == 'delimiter':
@@ -213,14 +258,11 @@ class RemoteTable(Table, ABC):
         file_name = os.path.basename(file_path)
 
         with open(file_path, 'rb') as f:
-            file_data = f.read()
-            num_chunks = len(file_data) // chunk_size + 1
-
-            for index in range(num_chunks):
-                start = index * chunk_size
-                end = min((index + 1) * chunk_size, len(file_data))
-                chunk_data = file_data[start:end]
-                is_last = (index == num_chunks - 1)
+            # one chunk of the file in memory at a time, the next one is read once the server has written this one
+            index = 0
+            while True:
+                chunk_data = f.read(chunk_size)
+                is_last = len(chunk_data) < chunk_size
                 res = self._conn.upload(db_name=self._db_name,
                                         table_name=self._table_name,
                                         file_name=file_name,
@@ -238,6 +280,9 @@ class RemoteTable(Table, ABC):
                             raise Exception(f"upload failed: {res.error_msg}")
                         if res.can_skip:
                             break
+                if is_last:
+                    break
+                index += 1
 
         res = self._conn.import_data(db_name=self._db_name,
                                      table_name=self._table_name,
@@ -317,6 +362,12 @@ class RemoteTable(Table, ABC):
             vector_column_name, embedding_data, embedding_data_type, distance_type, topn, knn_params)
         return self
 
+    def rerank(self, vector_column_name: str, embedding_data: VEC, embedding_data_type: str, distance_type: str,
+               topn: int, knn_params: {} = None):
+        self.query_builder.rerank(
+            vector_column_name, embedding_data, embedding_data_type, distance_type, topn, knn_params)
+        return self
+
     @params_type_check
     def match(self, fields: str, matching_text: str, options_text: str = ''):
         self.query_builder.match(fields, matching_text, options_text)
@@ -346,6 +397,22 @@ class RemoteTable(Table, ABC):
     def to_result(self):
         return self.query_builder.to_result()
 
+    def to_query(self) -> Query:
+        return self.query_builder.to_query()
+
+    def batch_search(self, queries: List[Query]) -> List[pd.DataFrame]:
+        """Run the queries of to_query() in one request, all of them see the same snapshot of the table."""
+        res = self._conn.batch_select(db_name=self._db_name, table_name=self._table_name, queries=queries)
+        if res.error_code != ErrorCode.OK:
+            raise Exception(f"ERROR:{res.error_code}, {res.error_msg}")
+        dfs = []
+        for response in res.responses:
+            if response.error_code != ErrorCode.OK:
+                raise Exception(f"ERROR:{response.error_code}, {response.error_msg}")
+            data_dict, data_type_dict = build_result(response)
+            dfs.append(pd.DataFrame({k: pd.Series(v, dtype=logic_type_to_dtype(data_type_dict[k])) for k, v in data_dict.items()}))
+        return dfs
+
     def to_df(self):
         return self.query_builder.to_df()
 
@@ -376,6 +443,48 @@ class RemoteTable(Table, ABC):
         else:
             raise Exception(f"ERROR:{res.error_code}, {res.error_msg}")
 
+    def _execute_query_arrow(self, query: Query):
+        # the server sends the columns in the buffer layout of arrow, they are wrapped without being decoded
+        res = self._conn.select(db_name=self._db_name,
+                                table_name=self._table_name,
+                                select_list=query.columns,
+                                search_expr=query.search,
+                                where_expr=query.filter,
+                                group_by_list=None,
+                                limit_expr=query.limit,
+                                offset_expr=query.offset,
+                                arrow_layout=True)
+        if res.error_code == ErrorCode.OK:
+            return build_arrow_table(res)
+        else:
+            raise Exception(f"ERROR:{res.error_code}, {res.error_msg}")
+
+    def _execute_query_batches(self, query: Query, block_count: int):
+        # open a cursor on the result and fetch it block_count blocks at a time
+        res = self._conn.open_cursor(db_name=self._db_name,
+                                     table_name=self._table_name,
+                                     select_list=query.columns,
+                                     search_expr=query.search,
+                                     where_expr=query.filter,
+                                     group_by_list=None,
+                                     limit_expr=query.limit,
+                                     offset_expr=query.offset)
+        if res.error_code != ErrorCode.OK:
+            raise Exception(f"ERROR:{res.error_code}, {res.error_msg}")
+
+        cursor_id = res.cursor_id
+        try:
+            while cursor_id:
+                res = self._conn.fetch_cursor(cursor_id=cursor_id, block_count=block_count)
+                if res.error_code != ErrorCode.OK:
+                    raise Exception(f"ERROR:{res.error_code}, {res.error_msg}")
+                # no cursor id in the last batch, the cursor is closed by the server
+                cursor_id = res.cursor_id
+                yield build_result(res)
+        finally:
+            if cursor_id:
+                self._conn.close_cursor(cursor_id=cursor_id)
+
     def _explain_query(self, query: ExplainQuery) -> Any:
         res = self._conn.explain(db_name=self._db_name,
                                  table_name=self._table_name,
@@ -16,7 +16,9 @@ import struct
 from collections import defaultdict
 from typing import Any, Tuple, Dict, List
 
+import numpy as np
 import polars as pl
+import pyarrow as pa
 from numpy import dtype
 
 import infinity.remote_thrift.infinity_thrift_rpc.ttypes as ttypes
@@ -220,3 +222,127 @@ def build_result(res: ttypes.SelectResponse) -> tuple[dict[str | Any, list[Any,
         data_type_dict[column_name] = column_data_type
 
     return data_dict, data_type_dict
+
+
+def embedding_element_to_pa_type(element_type: ttypes.ElementType):
+    match element_type:
+        case ttypes.ElementType.ElementInt8:
+            return pa.int8()
+        case ttypes.ElementType.ElementInt16:
+            return pa.int16()
+        case ttypes.ElementType.ElementInt32:
+            return pa.int32()
+        case ttypes.ElementType.ElementFloat32:
+            return pa.float32()
+        case ttypes.ElementType.ElementFloat64:
+            return pa.float64()
+        case ttypes.ElementType.ElementBit:
+            return pa.bool_()
+        case _:
+            raise NotImplementedError(f"Unsupported type {element_type}")
+
+
+def logic_type_to_column_type(ttype: ttypes.DataType) -> ttypes.ColumnType:
+    match ttype.logic_type:
+        case ttypes.LogicType.Boolean:
+            return ttypes.ColumnType.ColumnBool
+        case ttypes.LogicType.TinyInt:
+            return ttypes.ColumnType.ColumnInt8
+        case ttypes.LogicType.SmallInt:
+            return ttypes.ColumnType.ColumnInt16
+        case ttypes.LogicType.Integer:
+            return ttypes.ColumnType.ColumnInt32
+        case ttypes.LogicType.BigInt:
+            return ttypes.ColumnType.ColumnInt64
+        case ttypes.LogicType.Float:
+            return ttypes.ColumnType.ColumnFloat32
+        case ttypes.LogicType.Double:
+            return ttypes.ColumnType.ColumnFloat64
+        case ttypes.LogicType.Varchar:
+            return ttypes.ColumnType.ColumnVarchar
+        case ttypes.LogicType.Embedding:
+            return ttypes.ColumnType.ColumnEmbedding
+        case _:
+            raise NotImplementedError(f"Unsupported type {ttype}")
+
+
+def column_type_to_pa_type(column_type: ttypes.ColumnType, column_data_type: ttypes.DataType):
+    match column_type:
+        case ttypes.ColumnType.ColumnBool:
+            return pa.bool_()
+        case ttypes.ColumnType.ColumnInt8:
+            return pa.int8()
+        case ttypes.ColumnType.ColumnInt16:
+            return pa.int16()
+        case ttypes.ColumnType.ColumnInt32:
+            return pa.int32()
+        case ttypes.ColumnType.ColumnInt64:
+            return pa.int64()
+        case ttypes.ColumnType.ColumnFloat32:
+            return pa.float32()
+        case ttypes.ColumnType.ColumnFloat64:
+            return pa.float64()
+        case ttypes.ColumnType.ColumnVarchar:
+            return pa.string()
+        case ttypes.ColumnType.ColumnRowID:
+            return pa.list_(pa.int32(), 2)
+        case ttypes.ColumnType.ColumnEmbedding:
+            embedding_type = column_data_type.physical_type.embedding_type
+            return pa.list_(embedding_element_to_pa_type(embedding_type.element_type), embedding_type.dimension)
+        case _:
+            raise NotImplementedError(f"Unsupported type {column_type}")
+
+
+def column_vectors_to_arrow(column_type: ttypes.ColumnType, pa_type, column_vectors) -> list[pa.Array]:
+    # one array per block, the fixed width columns and the strings wrap the received bytes without a copy
+    match column_type:
+        case ttypes.ColumnType.ColumnVarchar:
+            # an offsets binary and a data binary per block
+            chunks = []
+            for offsets, data in zip(column_vectors[0::2], column_vectors[1::2]):
+                row_count = len(offsets) // 4 - 1
+                chunks.append(pa.Array.from_buffers(pa_type, row_count, [None, pa.py_buffer(offsets), pa.py_buffer(data)]))
+            return chunks
+        case ttypes.ColumnType.ColumnBool:
+            # one byte per value instead of a bitmap
+            return [pa.array(np.frombuffer(column_vector, dtype=np.bool_)) for column_vector in column_vectors]
+        case ttypes.ColumnType.ColumnRowID | ttypes.ColumnType.ColumnEmbedding:
+            value_type = pa_type.value_type
+            list_size = pa_type.list_size
+            chunks = []
+            for column_vector in column_vectors:
+                if value_type == pa.bool_():
+                    values = pa.array(np.frombuffer(column_vector, dtype=np.bool_))
+                else:
+                    value_count = len(column_vector) // (value_type.bit_width // 8)
+                    values = pa.Array.from_buffers(value_type, value_count, [None, pa.py_buffer(column_vector)])
+                chunks.append(pa.FixedSizeListArray.from_arrays(values, list_size))
+            return chunks
+        case _:
+            row_width = pa_type.bit_width // 8
+            return [pa.Array.from_buffers(pa_type, len(column_vector) // row_width, [None, pa.py_buffer(column_vector)])
+                    for column_vector in column_vectors]
+
+
+def build_arrow_table(res: ttypes.SelectResponse) -> pa.Table:
+    # the response of a select with arrow_layout set
+    arrays = []
+    names = []
+    column_counter = defaultdict(int)
+    for column_def, column_field in zip(res.column_defs, res.column_fields):
+        original_column_name = column_def.name
+        column_counter[original_column_name] += 1
+        column_name = f"{original_column_name}_{column_counter[original_column_name]}" \
+            if column_counter[original_column_name] > 1 \
+            else original_column_name
+
+        column_type = column_field.column_type
+        if column_type is None:
+            # no block in the result to take the column type from
+            column_type = logic_type_to_column_type(column_def.data_type)
+        pa_type = column_type_to_pa_type(column_type, column_def.data_type)
+        chunks = column_vectors_to_arrow(column_type, pa_type, column_field.column_vectors)
+        arrays.append(pa.chunked_array(chunks, type=pa_type))
+        names.append(column_name)
+
+    return pa.Table.from_arrays(arrays, names=names)
@@ -5,6 +5,8 @@ TEST_REMOTE_HOST = NetworkAddress("127.0.0.1", 23817)
 # TEST_REMOTE_HOST = NetworkAddress("192.168.200.151", 23817)
 # infinity thrift server port
 infinity_server_port = 23817
+# many requests in flight on one connection
+TEST_MUX_REMOTE_HOST = NetworkAddress("127.0.0.1", 23818)
 
 identifier_limit = 65536
 database_count_limit = 65536
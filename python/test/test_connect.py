@@ -12,6 +12,8 @@
 # See the License for the specific language governing permissions and
 # limitations under the License.
 
+from concurrent.futures import ThreadPoolExecutor
+
 import pytest
 from common import common_values
 import infinity
@@ -113,3 +115,24 @@ class TestConnection:
             infinity_instance.disconnect()
         except Exception as e:
             print(e)
+
+    def test_multiplexed_connect(self):
+        """
+        target: run the queries of many sessions on one connection
+        method: connect the multiplexed port in several threads -> list databases in each -> disconnect
+        expected: all the clients share one connection, every query gets its own response
+        """
+        session_count = 16
+
+        def list_databases(i):
+            infinity_instance = infinity.connect(common_values.TEST_MUX_REMOTE_HOST)
+            try:
+                for _ in range(10):
+                    res = infinity_instance.list_databases()
+                    assert "default" in res.db_names
+            finally:
+                assert infinity_instance.disconnect()
+            return i
+
+        with ThreadPoolExecutor(max_workers=session_count) as executor:
+            assert sorted(executor.map(list_databases, range(session_count))) == list(range(session_count))
@@ -66,6 +66,7 @@ class TestExplain:
             res = table.output(["*"]).explain(ExplainType.Fragment)
             print(res)
 
-            with pytest.raises(Exception, match=r".*Not implement*"):
-                res = table.output(["*"]).explain(ExplainType.Analyze)
-                print(res)
+            res = table.output(["*"]).explain(ExplainType.Analyze)
+            print(res)
+            # the plan runs, each operator reports the rows it output
+            assert any("actual: rows: 3" in line for line in res.to_series(0).to_list())
@@ -13,7 +13,10 @@
 # limitations under the License.
 
 import os
+import pandas as pd
+import pyarrow as pa
 import pytest
+from numpy import dtype
 from infinity import index
 
 from common import common_values
@@ -22,7 +25,7 @@ from infinity.errors import ErrorCode
 from infinity.common import ConflictType
 
 from utils import generate_big_int_csv, copy_data, generate_big_rows_csv, generate_big_columns_csv, generate_fvecs, \
-    generate_commas_enwiki
+    generate_commas_enwiki, generate_arrow_file
 
 
 class TestImport:
@@ -444,4 +447,71 @@ class TestImport:
         res = table_obj.output(["*"]).to_df()
         print(res)
 
+    # import parquet and arrow files, whose batches span several blocks
+    @pytest.mark.parametrize("file_format", ["parquet", "arrow"])
+    def test_import_arrow_formats(self, get_infinity_db, file_format):
+        row_count = 10000
+        c1 = list(range(row_count))
+        table = pa.table({"c1": pa.array(c1, type=pa.int32()),
+                          "c2": pa.array([i / 4 for i in c1], type=pa.float32()),
+                          "c3": pa.array(["row " + str(i) for i in c1], type=pa.string()),
+                          "c4": pa.array([[i, i + 0.5, i + 0.25, -i] for i in c1], type=pa.list_(pa.float32(), 4)),
+                          "unused": pa.array(c1, type=pa.int64())})
+        file_name = "pysdk_test_arrow_formats." + file_format
+        generate_arrow_file(table, file_name, file_format, 3000)
+
+        db_obj = get_infinity_db
+        db_obj.drop_table("test_import_arrow_formats")
+        # int32 is widened into int64 and float32 into double, the columns are matched by name
+        table_obj = db_obj.create_table("test_import_arrow_formats",
+                                        {"c4": "vector,4,float", "c3": "varchar", "c2": "double", "c1": "int64"})
+        res = table_obj.import_data(common_values.TEST_TMP_DIR + file_name, {"file_type": file_format})
+        assert res.error_code == ErrorCode.OK
+
+        res = table_obj.output(["count(*)"]).to_df()
+        assert res.iloc[0, 0] == row_count
+        res = table_obj.output(["c1", "c2", "c3"]).filter("c1 = 8193").to_df()
+        pd.testing.assert_frame_equal(res, pd.DataFrame({'c1': (8193,), 'c2': (2048.25,), 'c3': ("row 8193",)})
+                                      .astype({'c1': dtype('int64'), 'c2': dtype('float64')}))
+        res = table_obj.output(["c4"]).filter("c1 = 8193").to_df()
+        assert res["c4"].tolist() == [[8193.0, 8193.5, 8193.25, -8193.0]]
+
+        res = db_obj.drop_table("test_import_arrow_formats")
+        assert res.error_code == ErrorCode.OK
+
+    # a parquet or arrow file that doesn't fit the table is rejected as a whole
+    @pytest.mark.parametrize("file_format", ["parquet", "arrow"])
+    @pytest.mark.parametrize("case, columns", [
+        ("missing_column", {"c1": pa.array([1, 2, 3], type=pa.int32())}),
+        ("null_number", {"c1": pa.array([1, None, 3], type=pa.int32()),
+                         "c2": pa.array([[1, 2], [3, 4], [5, 6]], type=pa.list_(pa.float32(), 2))}),
+        ("null_embedding", {"c1": pa.array([1, 2, 3], type=pa.int32()),
+                            "c2": pa.array([[1, 2], None, [5, 6]], type=pa.list_(pa.float32(), 2))}),
+        ("null_embedding_element", {"c1": pa.array([1, 2, 3], type=pa.int32()),
+                                    "c2": pa.array([[1, 2], [3, None], [5, 6]], type=pa.list_(pa.float32(), 2))}),
+        ("wrong_dimension", {"c1": pa.array([1, 2, 3], type=pa.int32()),
+                             "c2": pa.array([[1, 2, 0], [3, 4, 0], [5, 6, 0]], type=pa.list_(pa.float32(), 3))}),
+        # an int64 or a double may not fit into an int or a float
+        ("narrowing_number", {"c1": pa.array([1, 2, 1 << 40], type=pa.int64()),
+                              "c2": pa.array([[1, 2], [3, 4], [5, 6]], type=pa.list_(pa.float32(), 2))}),
+        ("narrowing_embedding", {"c1": pa.array([1, 2, 3], type=pa.int32()),
+                                 "c2": pa.array([[1, 2], [3, 4], [5, 6]], type=pa.list_(pa.float64(), 2))}),
+    ])
+    def test_import_arrow_formats_rejected(self, get_infinity_db, file_format, case, columns):
+        # one file per case, an uploaded file of the same name and size isn't sent again
+        file_name = "pysdk_test_arrow_formats_" + case + "." + file_format
+        generate_arrow_file(pa.table(columns), file_name, file_format, 2)
+
+        db_obj = get_infinity_db
+        db_obj.drop_table("test_import_arrow_formats_rejected")
+        table_obj = db_obj.create_table("test_import_arrow_formats_rejected", {"c1": "int", "c2": "vector,2,float"})
+        with pytest.raises(Exception, match="ERROR:3037, Import file format error:*"):
+            table_obj.import_data(common_values.TEST_TMP_DIR + file_name, {"file_type": file_format})
+
+        res = table_obj.output(["count(*)"]).to_df()
+        assert res.iloc[0, 0] == 0
+
+        res = db_obj.drop_table("test_import_arrow_formats_rejected")
+        assert res.error_code == ErrorCode.OK
+
     # TODO: JSON file type import test
\ No newline at end of file
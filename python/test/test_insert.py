@@ -15,6 +15,7 @@ import os
 import signal
 import time
 
+import numpy as np
 import pandas as pd
 import pytest
 from numpy import dtype
@@ -110,6 +111,43 @@ class TestInsert:
                                                                 "^789$ test insert varchar")}))
         db_obj.drop_table("test_insert_varchar")
 
+    def test_insert_columnar(self):
+        """
+        target: test insert the columns in their binary layout
+        method: create table with int, double, varchar and embedding columns, insert them as columns
+        expected: ok
+        """
+        infinity_obj = infinity.connect(common_values.TEST_REMOTE_HOST)
+        db_obj = infinity_obj.get_database("default")
+        db_obj.drop_table("test_insert_columnar", ConflictType.Ignore)
+        table_obj = db_obj.create_table("test_insert_columnar", {
+            "c1": "int", "c2": "double", "c3": "varchar", "c4": "vector,2,float"}, ConflictType.Error)
+        assert table_obj
+
+        row_count = 10000
+        c1 = np.arange(row_count, dtype=np.int32)
+        res = table_obj.insert_columnar({"c3": [str(i) for i in range(row_count)],
+                                         "c1": c1,
+                                         "c2": c1.astype(np.float64) / 2,
+                                         "c4": np.stack([c1, c1 + 1], axis=1).astype(np.float32)})
+        assert res.error_code == ErrorCode.OK
+
+        res = table_obj.output(["count(*)"]).to_df()
+        assert res.iloc[0, 0] == row_count
+        res = table_obj.output(["c1", "c2", "c3"]).filter("c1 = 8193").to_df()
+        pd.testing.assert_frame_equal(res, pd.DataFrame({'c1': (8193,), 'c2': (4096.5,), 'c3': ("8193",)})
+                                      .astype({'c1': dtype('int32'), 'c2': dtype('float64')}))
+
+        # the columns must have as many rows
+        with pytest.raises(Exception):
+            table_obj.insert_columnar({"c1": c1, "c2": c1.astype(np.float64), "c3": ["a"],
+                                       "c4": np.zeros((row_count, 2), dtype=np.float32)})
+
+        db_obj.drop_table("test_insert_columnar")
+
+        res = infinity_obj.disconnect()
+        assert res.error_code == ErrorCode.OK
+
     def test_insert_big_varchar(self):
         """
         target: test insert varchar with big length
@@ -110,6 +110,67 @@ class TestKnn:
                            "query_price": 1.0
                            }])
 
+    def test_batch_search(self):
+        """
+        target: test many knn searches in one request
+        method: batch searches of the same shape and of another one, with one on a column that doesn't exist
+        expected: the result of each search as if it were alone, the failed one raises
+        """
+        infinity_obj = infinity.connect(common_values.TEST_REMOTE_HOST)
+        db_obj = infinity_obj.get_database("default")
+        db_obj.drop_table("test_batch_search", conflict_type=ConflictType.Ignore)
+        table_obj = db_obj.create_table("test_batch_search", {"c1": "int", "c2": "vector,2,float"}, ConflictType.Error)
+        table_obj.insert([{"c1": 1, "c2": [0.0, 0.0]}, {"c1": 2, "c2": [10.0, 0.0]},
+                          {"c1": 3, "c2": [0.0, 10.0]}, {"c1": 4, "c2": [10.0, 10.0]}])
+
+        points = [[0.0, 0.0], [10.0, 0.0], [0.0, 10.0], [10.0, 10.0]]
+        queries = [table_obj.output(["c1"]).knn("c2", point, "float", "l2", 1).to_query() for point in points]
+        queries.append(table_obj.output(["c1"]).knn("c2", [0.0, 0.0], "float", "l2", 2).filter("c1 > 2").to_query())
+        res = table_obj.batch_search(queries)
+        assert [df["c1"].tolist() for df in res[:4]] == [[1], [2], [3], [4]]
+        assert sorted(res[4]["c1"].tolist()) == [3, 4]
+
+        queries = [table_obj.output(["c1"]).knn("c2", [0.0, 0.0], "float", "l2", 1).to_query(),
+                   table_obj.output(["c3"]).to_query()]
+        with pytest.raises(Exception):
+            table_obj.batch_search(queries)
+
+        res = db_obj.drop_table("test_batch_search", ConflictType.Error)
+        assert res.error_code == ErrorCode.OK
+
+    def test_fusion_rerank(self):
+        """
+        target: test the rerank of the fused rows by another embedding column
+        method: fuse a match and a knn, then rerank by the inner product with a second column
+        expected: the topn of the rerank among the fused rows only
+        """
+        infinity_obj = infinity.connect(common_values.TEST_REMOTE_HOST)
+        db_obj = infinity_obj.get_database("default")
+        db_obj.drop_table("test_fusion_rerank", conflict_type=ConflictType.Ignore)
+        table_obj = db_obj.create_table("test_fusion_rerank", {"c1": "int", "body": "varchar", "vec": "vector,2,float",
+                                                               "rerank_vec": "vector,2,float"}, ConflictType.Error)
+        table_obj.insert([{"c1": 1, "body": "apple apple apple", "vec": [0.0, 0.0], "rerank_vec": [1.0, 0.0]},
+                          {"c1": 2, "body": "apple banana cherry date", "vec": [1.0, 0.0], "rerank_vec": [2.0, 0.0]},
+                          {"c1": 3, "body": "banana", "vec": [2.0, 0.0], "rerank_vec": [3.0, 0.0]},
+                          {"c1": 4, "body": "cherry", "vec": [3.0, 0.0], "rerank_vec": [4.0, 0.0]}])
+        table_obj.create_index("ft_index", [index.IndexInfo("body", index.IndexType.FullText, [])], ConflictType.Error)
+
+        res = (table_obj
+               .output(["c1"])
+               .match("body", "apple", "topn=2")
+               .knn("vec", [3.0, 0.0], "float", "l2", 2)
+               .fusion('rrf', 'topn=2')
+               .rerank("rerank_vec", [1.0, 0.0], "float", "ip", 2)
+               .to_pl())
+        assert res["c1"].to_list() == [4, 1]
+
+        with pytest.raises(Exception):
+            table_obj.output(["c1"]).knn("vec", [3.0, 0.0], "float", "l2", 2).rerank("rerank_vec", [1.0, 0.0],
+                                                                                        "float", "ip", 2)
+
+        res = db_obj.drop_table("test_fusion_rerank", ConflictType.Error)
+        assert res.error_code == ErrorCode.OK
+
     # knn various column name
     @pytest.mark.parametrize("check_data", [{"file_name": "tmp_20240116.csv",
                                              "data_dir": common_values.TEST_TMP_DIR}], indirect=True)
@@ -13,6 +13,7 @@
 # limitations under the License.
 import os
 
+import numpy as np
 import pandas as pd
 import pytest
 
@@ -475,6 +476,96 @@ class TestSelect:
         res = table_obj.output(["c1", "c2", "c1"]).to_df()
         print(res)
 
+    def test_select_batches(self):
+        """
+        target: test fetch the result through a cursor
+        method: select a result of several blocks batch by batch
+        expected: the batches make up the result, a cursor left early is closed
+        """
+        infinity_obj = infinity.connect(common_values.TEST_REMOTE_HOST)
+        db_obj = infinity_obj.get_database("default")
+        db_obj.drop_table("test_select_batches", True)
+        table_obj = db_obj.create_table("test_select_batches", {"c1": "int", "c2": "varchar"}, ConflictType.Error)
+
+        row_count = 20000
+        table_obj.insert_columnar({"c1": np.arange(row_count, dtype=np.int32), "c2": [str(i) for i in range(row_count)]})
+
+        batches = list(table_obj.output(["c1", "c2"]).to_df_batches())
+        assert len(batches) > 1
+        res = pd.concat(batches, ignore_index=True).sort_values("c1", ignore_index=True)
+        assert len(res) == row_count
+        assert (res["c1"] == range(row_count)).all()
+        assert (res["c2"] == res["c1"].astype(str)).all()
+
+        # stop after the first batch, and again more times than a session may keep cursors open
+        for i in range(16):
+            for batch in table_obj.output(["c1"]).filter("c1 >= 10").to_df_batches():
+                assert len(batch) > 0
+                break
+
+        res = db_obj.drop_table("test_select_batches")
+        assert res.error_code == ErrorCode.OK
+
+    def test_select_arrow(self):
+        """
+        target: test the result as an arrow table
+        method: select a result of several blocks with to_arrow and to_pl
+        expected: one chunk per block, the same values as to_df
+        """
+        infinity_obj = infinity.connect(common_values.TEST_REMOTE_HOST)
+        db_obj = infinity_obj.get_database("default")
+        db_obj.drop_table("test_select_arrow", True)
+        table_obj = db_obj.create_table("test_select_arrow", {"c1": "int", "c2": "varchar", "c3": "double"},
+                                        ConflictType.Error)
+
+        row_count = 10000
+        table_obj.insert_columnar({"c1": np.arange(row_count, dtype=np.int32), "c2": [str(i) for i in range(row_count)],
+                                   "c3": np.arange(row_count, dtype=np.float64) / 2})
+
+        res = table_obj.output(["c1", "c2", "c3"]).to_arrow()
+        assert res.num_rows == row_count
+        assert res.column("c1").num_chunks > 1
+        df = res.to_pandas().sort_values("c1", ignore_index=True)
+        pd.testing.assert_frame_equal(df, table_obj.output(["c1", "c2", "c3"]).to_df().sort_values("c1", ignore_index=True))
+
+        res = table_obj.output(["c1", "c2"]).filter("c1 < 10").to_pl()
+        assert res.height == 10 and res.width == 2
+        assert sorted(res["c2"].to_list()) == sorted(str(i) for i in range(10))
+
+        res = table_obj.output(["c1"]).filter("c1 < 0").to_arrow()
+        assert res.num_rows == 0
+
+        res = db_obj.drop_table("test_select_arrow")
+        assert res.error_code == ErrorCode.OK
+
+    def test_select_compressed(self, tmp_path):
+        """
+        target: test the import and the select of data large enough to be compressed on the wire
+        method: import a csv file of several chunks, select the embeddings back
+        expected: the same values as in the file, whether the lz4 package is installed or not
+        """
+        infinity_obj = infinity.connect(common_values.TEST_REMOTE_HOST)
+        db_obj = infinity_obj.get_database("default")
+        db_obj.drop_table("test_select_compressed", True)
+        table_obj = db_obj.create_table("test_select_compressed", {"c1": "int", "c2": "vector,16,float"},
+                                        ConflictType.Error)
+
+        row_count = 20000
+        embeddings = np.tile(np.arange(16, dtype=np.float32), (row_count, 1)) + np.arange(row_count, dtype=np.float32)[:, None]
+        csv_path = tmp_path / "test_select_compressed.csv"
+        with open(csv_path, "w") as f:
+            for i in range(row_count):
+                f.write(f"{i},\"[{','.join(str(v) for v in embeddings[i])}]\"\n")
+        res = table_obj.import_data(str(csv_path), None)
+        assert res.error_code == ErrorCode.OK
+
+        res = table_obj.output(["c1", "c2"]).to_df().sort_values("c1", ignore_index=True)
+        assert len(res) == row_count
+        assert np.array_equal(np.stack(res["c2"].to_numpy()), embeddings)
+
+        res = db_obj.drop_table("test_select_compressed")
+        assert res.error_code == ErrorCode.OK
+
     def test_empty_table(self):
         infinity_obj = infinity.connect(common_values.TEST_REMOTE_HOST)
         db_obj = infinity_obj.get_database("default")
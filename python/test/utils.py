@@ -6,6 +6,8 @@ import time
 import traceback
 from shutil import copyfile
 import numpy as np
+import pyarrow as pa
+import pyarrow.parquet as pq
 import pytest
 
 from common import common_values
@@ -86,6 +88,17 @@ def generate_fvecs(num, dim, filename):
     fvecs_file.close()
 
 
+# writes the table to a parquet file or an arrow ipc file, in row groups or record batches of batch_size rows
+def generate_arrow_file(table, filename, file_format, batch_size):
+    os.makedirs(copy_dir, exist_ok=True)
+    if file_format == "parquet":
+        pq.write_table(table, copy_dir + filename, row_group_size=batch_size)
+    else:
+        with pa.OSFile(copy_dir + filename, "wb") as sink:
+            with pa.ipc.new_file(sink, table.schema) as writer:
+                writer.write_table(table, max_chunksize=batch_size)
+
+
 def generate_commas_enwiki(in_filename, out_filename, is_embedding):
     with open(os.getcwd() + common_values.TEST_DATA_DIR + "csv/" + in_filename, "r") as infile, \
          open(os.getcwd() + common_values.TEST_DATA_DIR + "csv/" + out_filename, "w") as outfile:
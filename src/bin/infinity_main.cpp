@@ -34,6 +34,9 @@ infinity::PGServer pg_server;
 infinity::Thread pool_thrift_thread;
 infinity::PoolThriftServer pool_thrift_server;
 
+infinity::Thread mux_thrift_thread;
+infinity::MultiplexedThriftServer mux_thrift_server;
+
 infinity::Thread http_server_thread;
 infinity::HTTPServer http_server;
 // infinity::NonBlockPoolThriftServer non_block_pool_thrift_server;
@@ -60,6 +63,8 @@ void ShutdownServer() {
     fmt::print("HTTP Server is shutdown.\n");
     pool_thrift_server.Shutdown();
     pool_thrift_thread.join();
+    mux_thrift_server.Shutdown();
+    mux_thrift_thread.join();
     fmt::print("Thrift Server is shutdown.\n");
     //            non_block_pool_thrift_server.Shutdown();
     pg_server.Shutdown();
@@ -159,6 +164,9 @@ auto main(int argc, char **argv) -> int {
     pool_thrift_server.Init(thrift_server_port, thrift_server_pool_size);
     pool_thrift_thread = infinity::Thread([&]() { pool_thrift_server.Start(); });
 
+    mux_thrift_server.Init(InfinityContext::instance().config()->mux_sdk_port(), thrift_server_pool_size);
+    mux_thrift_thread = infinity::Thread([&]() { mux_thrift_server.Start(); });
+
     //    non_block_pool_thrift_server.Init(9070, 64);
     //    non_block_pool_thrift_server.Start();
     shutdown_thread = infinity::Thread([&]() { ShutdownServer(); });
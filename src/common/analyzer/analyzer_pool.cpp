@@ -22,6 +22,7 @@ import analyzer;
 import chinese_analyzer;
 import standard_analyzer;
 import ngram_analyzer;
+import sparse_analyzer;
 
 module analyzer_pool;
 
@@ -30,6 +31,7 @@ namespace infinity {
 constexpr std::string_view CHINESE = "chinese";
 constexpr std::string_view STANDARD = "standard";
 constexpr std::string_view NGRAM = "ngram";
+constexpr std::string_view SPARSE = SPARSE_ANALYZER;
 
 constexpr u64 basis = 0xCBF29CE484222325ull;
 constexpr u64 prime = 0x100000001B3ull;
@@ -39,6 +41,7 @@ constexpr u64 Str2Int(char const *str, u64 last_value = basis) { return *str ? S
 UniquePtr<Analyzer> AnalyzerPool::Get(const std::string_view &name) {
     switch (Str2Int(name.data())) {
         case Str2Int(CHINESE.data()): {
+            std::lock_guard lock(cache_mutex_);
             Analyzer *prototype = cache_[CHINESE].get();
             if (prototype == nullptr) {
                 String path = InfinityContext::instance().config()->resource_dict_path();
@@ -58,9 +61,35 @@ UniquePtr<Analyzer> AnalyzerPool::Get(const std::string_view &name) {
             u32 ngram = 2; /// TODO config
             return MakeUnique<NGramAnalyzer>(ngram);
         }
+        case Str2Int(SPARSE.data()): {
+            return MakeUnique<SparseAnalyzer>();
+        }
         default:
             return nullptr;
     }
 }
 
+// idle analyzers kept per name, enough for the concurrent queries and inverters
+constexpr SizeT MAX_IDLE_ANALYZERS = 64;
+
+UniquePtr<Analyzer> AnalyzerPool::Checkout(const std::string_view &name) {
+    {
+        std::lock_guard lock(idle_mutex_);
+        if (auto iter = idle_analyzers_.find(String(name)); iter != idle_analyzers_.end() and !iter->second.empty()) {
+            UniquePtr<Analyzer> analyzer = std::move(iter->second.back());
+            iter->second.pop_back();
+            return analyzer;
+        }
+    }
+    return Get(name);
+}
+
+void AnalyzerPool::Return(const std::string_view &name, UniquePtr<Analyzer> analyzer) {
+    std::lock_guard lock(idle_mutex_);
+    Vector<UniquePtr<Analyzer>> &idle = idle_analyzers_[String(name)];
+    if (idle.size() < MAX_IDLE_ANALYZERS) {
+        idle.push_back(std::move(analyzer));
+    }
+}
+
 } // namespace infinity
\ No newline at end of file
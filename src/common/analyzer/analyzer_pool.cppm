@@ -29,10 +29,40 @@ public:
 
     UniquePtr<Analyzer> Get(const std::string_view &name);
 
+    // Reuse an analyzer given back by Return() if there is one, so that a query or an inverter does not set up a new analyzer each time.
+    // The caller owns the analyzer until it is given back.
+    UniquePtr<Analyzer> Checkout(const std::string_view &name);
+
+    void Return(const std::string_view &name, UniquePtr<Analyzer> analyzer);
+
     void Set(const std::string_view &name);
 
 private:
+    std::mutex cache_mutex_;
     CacheType cache_{};
+
+    std::mutex idle_mutex_;
+    HashMap<String, Vector<UniquePtr<Analyzer>>> idle_analyzers_{};
+};
+
+// Checks out an analyzer from the pool and gives it back when going out of scope.
+export class ScopedAnalyzer {
+public:
+    explicit ScopedAnalyzer(const std::string_view &name) : name_(name), analyzer_(AnalyzerPool::instance().Checkout(name)) {}
+    ScopedAnalyzer(const ScopedAnalyzer &) = delete;
+    ScopedAnalyzer &operator=(const ScopedAnalyzer &) = delete;
+    ~ScopedAnalyzer() {
+        if (analyzer_.get() != nullptr) {
+            AnalyzerPool::instance().Return(name_, std::move(analyzer_));
+        }
+    }
+
+    Analyzer *get() const { return analyzer_.get(); }
+    Analyzer *operator->() const { return analyzer_.get(); }
+
+private:
+    String name_;
+    UniquePtr<Analyzer> analyzer_;
 };
 
 } // namespace infinity
\ No newline at end of file
@@ -34,6 +34,19 @@ CommonLanguageAnalyzer::CommonLanguageAnalyzer()
 
 CommonLanguageAnalyzer::~CommonLanguageAnalyzer() {}
 
+const String &CommonLanguageAnalyzer::Stem(std::string_view lowercase_term) {
+    if (auto iter = stem_cache_.find(lowercase_term); iter != stem_cache_.end()) {
+        return iter->second;
+    }
+    if (stem_cache_.size() >= stem_cache_capacity_) {
+        stem_cache_.clear();
+    }
+    String term(lowercase_term);
+    String stem_term;
+    stemmer_->Stem(term, stem_term);
+    return stem_cache_.emplace(std::move(term), std::move(stem_term)).first->second;
+}
+
 int CommonLanguageAnalyzer::AnalyzeImpl(const Term &input, void *data, HookType func) {
     Parse(input.text_);
 
@@ -77,11 +90,12 @@ int CommonLanguageAnalyzer::AnalyzeImpl(const Term &input, void *data, HookType
                 char *lowercase_term = lowercase_string_buffer_.data();
                 ToLower(token_, len_, lowercase_term, term_string_buffer_limit_);
                 SizeT stemming_term_str_size = 0;
-                String stem_term;
+                const char *stem_term = nullptr;
                 if (extract_eng_stem_) {
-                    stemmer_->Stem(lowercase_term, stem_term);
-                    if (strcmp(stem_term.c_str(), lowercase_term)) {
-                        stemming_term_str_size = stem_term.length();
+                    const String &stem = Stem(std::string_view(lowercase_term, len_));
+                    if (strcmp(stem.c_str(), lowercase_term)) {
+                        stem_term = stem.c_str();
+                        stemming_term_str_size = stem.length();
                     }
                 }
                 bool lowercase_is_different = memcmp(token_, lowercase_term, len_) != 0;
@@ -96,7 +110,7 @@ int CommonLanguageAnalyzer::AnalyzeImpl(const Term &input, void *data, HookType
                         temp_offset = offset_;
                     }
                     if (stemming_term_str_size) {
-                        func(data, stem_term.c_str(), stemming_term_str_size, offset_, Term::OR, level_ + 1, false);
+                        func(data, stem_term, stemming_term_str_size, offset_, Term::OR, level_ + 1, false);
                         temp_offset = offset_;
                     }
                     if (case_sensitive_ && contain_lower_ && lowercase_is_different) {
@@ -57,6 +57,9 @@ protected:
     /// whether current token is stopword
     virtual bool IsStopword() { return false; }
 
+    /// stem of the lowercase term, looked up in stem_cache_ first
+    const String &Stem(std::string_view lowercase_term);
+
     inline void ResetToken() {
         token_ = nullptr;
         len_ = 0;
@@ -70,9 +73,23 @@ protected:
 
 protected:
     static const SizeT term_string_buffer_limit_ = 4096 * 3;
+    /// the cache is dropped when it is full, the frequent words are cached again soon
+    static const SizeT stem_cache_capacity_ = 64 * 1024;
+
+    struct StemCacheHash {
+        using is_transparent = void;
+        SizeT operator()(std::string_view term) const { return std::hash<std::string_view>{}(term); }
+    };
+
+    struct StemCacheEqual {
+        using is_transparent = void;
+        bool operator()(std::string_view lhs, std::string_view rhs) const { return lhs == rhs; }
+    };
 
     Vector<char> lowercase_string_buffer_;
     UniquePtr<Stemmer> stemmer_{nullptr};
+    /// lowercase term -> stem, the vocabulary of a corpus has a heavy head
+    HashMap<String, String, StemCacheHash, StemCacheEqual> stem_cache_;
     const char *token_{nullptr};
     SizeT len_{0};
     const char *native_token_{nullptr};
@@ -0,0 +1,65 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <cctype>
+#include <cstdlib>
+
+import stl;
+import term;
+import analyzer;
+module sparse_analyzer;
+
+namespace infinity {
+
+int SparseAnalyzer::AnalyzeImpl(const Term &input, void *data, HookType func) {
+    const char *text = input.text_.c_str();
+    SizeT len = input.text_.length();
+    int term_count = 0;
+    SizeT cur = 0;
+    while (cur < len) {
+        while (cur < len && (std::isspace(text[cur]) || text[cur] == ',')) {
+            ++cur;
+        }
+        SizeT token_start = cur;
+        while (cur < len && !std::isspace(text[cur]) && text[cur] != ',') {
+            ++cur;
+        }
+        if (cur == token_start) {
+            break;
+        }
+        std::string_view token(text + token_start, cur - token_start);
+        float weight = 1.0F;
+        if (SizeT colon = token.rfind(':'); colon != std::string_view::npos) {
+            String weight_str(token.substr(colon + 1));
+            char *end = nullptr;
+            weight = std::strtof(weight_str.c_str(), &end);
+            if (end == weight_str.c_str() || *end != '\0') {
+                // not a weight, keep the whole token as term
+                weight = 1.0F;
+            } else {
+                token = token.substr(0, colon);
+            }
+        }
+        if (token.empty() || !(weight > 0.0F)) {
+            continue;
+        }
+        func(data, token.data(), token.length(), QuantizeSparseWeight(weight), Term::OR, 0, false);
+        ++term_count;
+    }
+    return term_count;
+}
+
+} // namespace infinity
@@ -0,0 +1,51 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module sparse_analyzer;
+
+import stl;
+import term;
+import analyzer;
+
+namespace infinity {
+
+export constexpr std::string_view SPARSE_ANALYZER = "sparse";
+// weights are stored as term frequency, quantized with this scale
+export constexpr float SPARSE_WEIGHT_SCALE = 1000.0F;
+// weights above this value are clamped, it bounds the score of a term
+export constexpr float SPARSE_WEIGHT_MAX = 64.0F;
+
+export inline u32 QuantizeSparseWeight(float weight) {
+    weight = std::min(weight, SPARSE_WEIGHT_MAX);
+    return std::max(static_cast<u32>(weight * SPARSE_WEIGHT_SCALE + 0.5F), 1u);
+}
+
+export inline float DequantizeSparseWeight(u32 quantized_weight) { return quantized_weight / SPARSE_WEIGHT_SCALE; }
+
+// Input is a sparse vector written as "term:weight" pairs separated by spaces or commas,
+// e.g. "apple:0.53 fruit:1.2". A term without weight has weight 1.
+// Each term is emitted once, with its quantized weight as word_offset_.
+// Terms with non-positive weight are dropped.
+export class SparseAnalyzer : public Analyzer {
+public:
+    SparseAnalyzer() = default;
+
+    ~SparseAnalyzer() = default;
+
+protected:
+    int AnalyzeImpl(const Term &input, void *data, HookType func) override;
+};
+} // namespace infinity
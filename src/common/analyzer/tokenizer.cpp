@@ -14,8 +14,10 @@
 
 module;
 
+#include <bit>
 #include <cctype>
 #include <cstring>
+#include <immintrin.h>
 
 import stl;
 import term;
@@ -28,6 +30,57 @@ const CharType DELIMITER_CHR = 1; /// < delimiter
 const CharType SPACE_CHR = 2;     /// < space term
 const CharType UNITE_CHR = 3;     /// < united term
 
+// Returns the length of the run of ASCII letters and digits at the beginning of data, 32 or 16 bytes are checked at a time.
+static SizeT AsciiAlnumRunLength(const char *data, SizeT length) {
+    SizeT i = 0;
+#if defined(__AVX2__)
+    {
+        // the bytes of non ASCII chars are negative, so they are out of both ranges
+        const __m256i zero_minus1 = _mm256_set1_epi8('0' - 1);
+        const __m256i nine_plus1 = _mm256_set1_epi8('9' + 1);
+        const __m256i a_minus1 = _mm256_set1_epi8('a' - 1);
+        const __m256i z_plus1 = _mm256_set1_epi8('z' + 1);
+        const __m256i case_bit = _mm256_set1_epi8(0x20);
+        for (; i + sizeof(__m256i) <= length; i += sizeof(__m256i)) {
+            __m256i bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + i));
+            __m256i digit = _mm256_and_si256(_mm256_cmpgt_epi8(bytes, zero_minus1), _mm256_cmpgt_epi8(nine_plus1, bytes));
+            __m256i lower = _mm256_or_si256(bytes, case_bit);
+            __m256i alpha = _mm256_and_si256(_mm256_cmpgt_epi8(lower, a_minus1), _mm256_cmpgt_epi8(z_plus1, lower));
+            u32 mask = static_cast<u32>(_mm256_movemask_epi8(_mm256_or_si256(digit, alpha)));
+            if (mask != 0xFFFFFFFFu) {
+                return i + std::countr_one(mask);
+            }
+        }
+    }
+#endif
+#if defined(__SSE2__)
+    {
+        const __m128i zero_minus1 = _mm_set1_epi8('0' - 1);
+        const __m128i nine_plus1 = _mm_set1_epi8('9' + 1);
+        const __m128i a_minus1 = _mm_set1_epi8('a' - 1);
+        const __m128i z_plus1 = _mm_set1_epi8('z' + 1);
+        const __m128i case_bit = _mm_set1_epi8(0x20);
+        for (; i + sizeof(__m128i) <= length; i += sizeof(__m128i)) {
+            __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + i));
+            __m128i digit = _mm_and_si128(_mm_cmpgt_epi8(bytes, zero_minus1), _mm_cmpgt_epi8(nine_plus1, bytes));
+            __m128i lower = _mm_or_si128(bytes, case_bit);
+            __m128i alpha = _mm_and_si128(_mm_cmpgt_epi8(lower, a_minus1), _mm_cmpgt_epi8(z_plus1, lower));
+            u32 mask = static_cast<u32>(_mm_movemask_epi8(_mm_or_si128(digit, alpha)));
+            if (mask != 0xFFFFu) {
+                return i + std::countr_one(mask);
+            }
+        }
+    }
+#endif
+    for (; i < length; ++i) {
+        u8 c = static_cast<u8>(data[i]);
+        if (c >= 128 || !std::isalnum(c)) {
+            break;
+        }
+    }
+    return i;
+}
+
 CharTypeTable::CharTypeTable(bool use_def_delim) {
     memset(char_type_table_, 0, BYTE_MAX);
     // if use_def_delim is set, all the characters are allows
@@ -44,6 +97,16 @@ CharTypeTable::CharTypeTable(bool use_def_delim) {
     }
 }
 
+void CharTypeTable::UpdateAsciiAlnumAllowed() {
+    ascii_alnum_allowed_ = true;
+    for (u8 i = 0; i < 128; i++) {
+        if (std::isalnum(i) && char_type_table_[i] != ALLOW_CHR) {
+            ascii_alnum_allowed_ = false;
+            return;
+        }
+    }
+}
+
 void CharTypeTable::SetConfig(const TokenizeConfig &conf) {
     // set the higher 4 bit to record user defined option type
     String str; // why need to copy?
@@ -68,6 +131,7 @@ void CharTypeTable::SetConfig(const TokenizeConfig &conf) {
             char_type_table_[(u8)str[j]] = ALLOW_CHR;
         }
     }
+    UpdateAsciiAlnumAllowed();
 }
 
 void Tokenizer::SetConfig(const TokenizeConfig &conf) { table_.SetConfig(conf); }
@@ -99,6 +163,19 @@ bool Tokenizer::NextToken() {
         is_delimiter_ = false;
 
         while (input_cursor_ < input_->length()) {
+            if (table_.IsAsciiAlnumAllowed()) {
+                // copy the run of ASCII letters and digits at once, the other bytes are classified one by one
+                SizeT run_length = AsciiAlnumRunLength(input_->data() + input_cursor_, input_->length() - input_cursor_);
+                if (run_length > 0) {
+                    while (output_buffer_cursor_ + run_length > output_buffer_size_) {
+                        GrowOutputBuffer();
+                    }
+                    std::memcpy(output_buffer_ + output_buffer_cursor_, input_->data() + input_cursor_, run_length);
+                    output_buffer_cursor_ += run_length;
+                    input_cursor_ += run_length;
+                    continue;
+                }
+            }
             CharType cur_type = table_.GetType(input_->at(input_cursor_));
             if (cur_type == SPACE_CHR || cur_type == DELIMITER_CHR) {
                 return true;
@@ -118,6 +195,7 @@ bool Tokenizer::NextToken() {
 bool Tokenizer::GrowOutputBuffer() {
     char *new_output_buffer = new char[output_buffer_size_ * 2];
     memcpy(new_output_buffer, output_buffer_, output_buffer_size_ * sizeof(char));
+    delete[] output_buffer_;
     output_buffer_ = new_output_buffer;
     output_buffer_size_ *= 2;
     return true;
@@ -41,6 +41,10 @@ export extern const CharType UNITE_CHR;     /// < united term
 
 export class CharTypeTable {
     CharType char_type_table_[BYTE_MAX];
+    // whether all the ASCII letters and digits are allows, so that runs of them can be found by SIMD
+    bool ascii_alnum_allowed_{true};
+
+    void UpdateAsciiAlnumAllowed();
 
 public:
     CharTypeTable(bool use_def_delim = true);
@@ -56,6 +60,8 @@ public:
     bool IsUnite(u8 c) { return char_type_table_[c] == UNITE_CHR; }
 
     bool IsEqualType(u8 c1, u8 c2) { return char_type_table_[c1] == char_type_table_[c2]; }
+
+    bool IsAsciiAlnumAllowed() const { return ascii_alnum_allowed_; }
 };
 
 export class Tokenizer {
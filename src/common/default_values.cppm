@@ -30,6 +30,7 @@ export {
     constexpr ColumnID COLUMN_IDENTIFIER_DELETE = (ColumnID)(std::numeric_limits<u64>::max() - 3);
     constexpr ColumnID COLUMN_IDENTIFIER_SCORE = (ColumnID)(std::numeric_limits<u64>::max() - 4);
     constexpr ColumnID COLUMN_IDENTIFIER_DISTANCE = (ColumnID)(std::numeric_limits<u64>::max() - 5);
+    constexpr ColumnID INVALID_COLUMN_ID = (ColumnID)(std::numeric_limits<u64>::max());
     constexpr std::string_view COLUMN_NAME_ROW_ID = "__rowid";
     constexpr std::string_view COLUMN_NAME_CREATE = "__create";
     constexpr std::string_view COLUMN_NAME_DELETE = "__delete";
@@ -42,6 +43,7 @@ export {
     constexpr i64 MAX_BITMAP_SIZE = 65536;
     constexpr i64 EMBEDDING_LIMIT = 65536;
     constexpr auto PG_MSG_BUFFER_SIZE = 4096u;
+    constexpr SizeT PG_IO_THREAD_COUNT = 4;
 
     // column vector related constants
     constexpr i64 MAX_BLOCK_CAPACITY = 65536L;
@@ -53,23 +55,51 @@ export {
     // column vector related constants
     constexpr i64 DEFAULT_VECTOR_SIZE = DEFAULT_BLOCK_CAPACITY;
     constexpr u64 INITIAL_VECTOR_CHUNK_ID = std::numeric_limits<u64>::max();
+    // blocks a projection or filter task evaluates with the interpreter, before it looks for a fused program of its expressions
+    constexpr SizeT FUSED_EXPRESSION_MIN_BLOCKS = 4;
 
     constexpr u64 MIN_VECTOR_CHUNK_SIZE = 4096UL;
     constexpr u64 MAX_VECTOR_CHUNK_SIZE = 1024 * 1024UL;
     constexpr u64 MAX_VECTOR_CHUNK_COUNT = std::numeric_limits<u64>::max();
     // Each row has one chunk.
     constexpr u64 DEFAULT_FIXLEN_CHUNK_SIZE = 65536L;
+    // The chunks of the memory pool of a query, the pool keeps them between the statements of the query context.
+    constexpr SizeT DEFAULT_QUERY_POOL_CHUNK_SIZE = 256 * 1024UL;
 
     // segment related constants
     constexpr SizeT DEFAULT_SEGMENT_CAPACITY = 1024 * 8192; // 1024 * 8192 = 8M rows
     constexpr SizeT SEGMENT_OFFSET_IN_DOCID = 23;           // it should be adjusted together with DEFAULT_SEGMENT_CAPACITY
     constexpr u64 SEGMENT_MASK_IN_DOCID = 0x7FFFFF;         // it should be adjusted together with DEFAULT_SEGMENT_CAPACITY
     constexpr u32 INVALID_SEGMENT_ID = std::numeric_limits<u32>::max();
+    constexpr SizeT TABLE_SCAN_MORSEL_BLOCK_COUNT = 2; // blocks a table scan task claims from the shared cursor at a time
+    constexpr u64 DEFAULT_ZONE_MAP_ROW_COUNT = 1024; // rows of a zone of the min-max filter inside a block, 0 for no zone map
+    constexpr SizeT PARALLEL_SCAN_MIN_ROWS_PER_TASK = 8 * DEFAULT_BLOCK_CAPACITY; // a scan is split into more tasks only above 64K rows each
+    constexpr SizeT AGGREGATE_PARTITION_MIN_GROUPS = 16384; // a parallel group by is merged by more tasks only above 16K groups each
 
     // queue related constants, TODO: double check the necessary
     constexpr SizeT BG_GROUND_TASK_QUEUE_SIZE = 65536;
     constexpr SizeT EXECUTOR_TASK_QUEUE_SIZE = 1024;
     constexpr SizeT DEFAULT_BLOCKING_QUEUE_SIZE = 1024;
+    constexpr SizeT BUFFER_PREFETCH_THREAD_NUM = 2; // threads reading buffers ahead of the operators
+    constexpr SizeT WARMUP_THREAD_NUM = 8;          // threads loading the segments of the indexes by WARMUP and at startup
+    constexpr SizeT WAL_REPLAY_THREAD_NUM = 8;      // threads replaying the data of the tables from the wal at startup
+    constexpr SizeT COMPACT_THREAD_NUM = 4;         // threads copying the blocks of a compaction
+    constexpr SizeT IMPORT_MIN_RANGE_SIZE = 64 * 1024 * 1024; // bytes of a csv or jsonl file parsed by one thread of an import at least
+    constexpr SizeT DATA_FILE_MMAP_MIN_SIZE = 1024 * 1024; // a plain column file of at least 1 MB is mapped instead of read
+    constexpr f64 MEMORY_PRESSURE_HIGH_RATIO = 0.8;      // share of the buffer memory held by buffers in use above which compaction slows down
+    constexpr f64 MEMORY_PRESSURE_CRITICAL_RATIO = 0.95; // above it background tasks are deferred and hnsw chunks are dumped early
+    constexpr SizeT BG_TASK_MEMORY_WAIT_MS = 10000;      // a background task is deferred at most 10 s by the memory pressure
+    constexpr SizeT COMPACT_BLOCK_MEMORY_WAIT_MS = 100;  // compaction waits at most 100 ms per block under high memory pressure
+    constexpr SizeT WORKER_STEAL_INTERVAL_US = 1000; // an idle worker looks for tasks to steal every 1 ms
+    constexpr SizeT STREAM_QUEUE_BACKPRESSURE_SIZE = 64; // a stream task yields while its parent has this many unconsumed blocks
+    constexpr SizeT CLEANUP_BATCH_SIZE = 64;  // obsolete entries deleted together by one thread of a cleanup
+    constexpr SizeT CLEANUP_THREAD_COUNT = 4; // threads deleting the files of a cleanup
+    constexpr u32 QUERY_CANCEL_CHECK_INTERVAL = 1024;    // full text search checks the query cancellation every 1024 docs
+    // share of the worker turns of the interactive, batch and background query lanes
+    constexpr SizeT INTERACTIVE_LANE_SHARE = 8;
+    constexpr SizeT BATCH_LANE_SHARE = 3;
+    constexpr SizeT BACKGROUND_LANE_SHARE = 1;
+    constexpr SizeT TRACE_RING_CAPACITY = 32768; // trace spans kept per thread, the older ones are overwritten
 
     // transaction related constants
     constexpr u64 MAX_TXN_ID = std::numeric_limits<u64>::max();
@@ -90,12 +120,26 @@ export {
     constexpr SizeT FULL_CHECKPOINT_INTERVAL_SEC = 30;          // 30 seconds
     constexpr SizeT DELTA_CHECKPOINT_INTERVAL_SEC = 5;         // 5 seconds
     constexpr SizeT DELTA_CHECKPOINT_INTERVAL_WAL_BYTES = 64 * 1024;
+    constexpr SizeT DEFAULT_WAL_GROUP_COMMIT_MAX_ENTRIES = 1024; // at most one full blocking queue
+    constexpr SizeT DEFAULT_WAL_GROUP_COMMIT_LATENCY_US = 0;     // don't wait for more entries
+    constexpr SizeT DEFAULT_WAL_COMPRESS_THRESHOLD = 64 * 1024;   // blocks appended in the wal are compressed from this size
+    constexpr SizeT DEFAULT_INSERT_BULK_THRESHOLD = 0;            // inserts are always appended to the wal
+    constexpr u64 DEFAULT_CHECKPOINT_FLUSH_RATE_LIMIT = 0;        // bytes per second written by a checkpoint, 0 for no limit
     constexpr std::string_view WAL_FILE_TEMP_FILE = "wal.log";
     constexpr std::string_view WAL_FILE_PREFIX = "wal.log";
     constexpr std::string_view CATALOG_FILE_DIR = "catalog";
 
     constexpr SizeT DEFAULT_CLEANUP_INTERVAL_SEC = 10;
     constexpr bool DEFAULT_ENABLE_COMPACTION = true;
+    constexpr SizeT DEFAULT_TTL_INTERVAL_SEC = 60; // how often the expired rows of the tables with a ttl are dropped
+    constexpr u64 DEFAULT_FULLTEXT_MERGE_RATE_LIMIT = 0; // bytes per second written by a background full-text chunk merge, 0 for no limit
+
+    constexpr u64 DEFAULT_REPLICATION_POLL_INTERVAL_MS = 100;
+    constexpr u64 DEFAULT_REPLICATION_MAX_STALENESS_MS = 0;     // no bound
+    constexpr SizeT REPLICATION_WAL_BATCH_BYTES = 4 * 1024 * 1024; // wal bytes a follower fetches at a time
+    constexpr SizeT REPLICATION_FILE_CHUNK_BYTES = 16 * 1024 * 1024; // file bytes a follower fetches at a time
+
+    constexpr u64 DEFAULT_SHARD_TIMEOUT_MS = 1000;
 
     constexpr std::string_view SYSTEM_DB_NAME = "system";
     constexpr std::string_view DEFAULT_DB_NAME = "default";
@@ -106,17 +150,70 @@ export {
     constexpr SizeT HNSW_M = 16;
     constexpr SizeT HNSW_EF_CONSTRUCTION = 200;
     constexpr SizeT HNSW_EF = 200;
+    constexpr SizeT HNSW_BUILD_BATCH_SIZE = 128; // vertices a create index task claims at a time
+    constexpr f64 HNSW_FILTER_BRUTE_FORCE_SELECTIVITY = 0.01; // below it a filtered search scans the passing rows instead
+    constexpr f64 HNSW_FILTER_WIDEN_EF_SELECTIVITY = 0.2;     // below it a filtered search widens ef by 1 / selectivity
+    constexpr SizeT HNSW_FILTER_MAX_EF_FACTOR = 16;           // the widened ef is at most this multiple of ef
+    constexpr SizeT HNSW_MEM_INDEX_DUMP_ROW_COUNT = 8 * DEFAULT_BLOCK_CAPACITY; // rows a mutable hnsw chunk takes before it is dumped
+    constexpr SizeT HNSW_MEM_INDEX_PRESSURE_DUMP_ROW_COUNT = DEFAULT_BLOCK_CAPACITY; // the same under critical memory pressure
+    constexpr f64 HNSW_TOMBSTONE_REBUILD_RATIO = 0.3;                          // share of deleted rows in a hnsw graph that triggers a rebuild
+    constexpr SizeT HNSW_TOMBSTONE_REBUILD_MIN_ROWS = DEFAULT_BLOCK_CAPACITY;   // smaller segments are never rebuilt
+
+    // default hnsw product quantization parameter
+    constexpr SizeT PQ_SUBSPACE_DIM = 8;
+    constexpr SizeT PQ_CENTROID_NUM = 256;
+    constexpr SizeT PQ_TRAIN_SAMPLE_NUM = 16384;
+    constexpr SizeT PQ_KMEANS_ITER = 8;
+    constexpr SizeT PQ_RERANK_FACTOR = 4; // candidates per requested neighbor rescored with the full precision vector
+
+    // default ivfpq search parameter
+    constexpr SizeT IVF_PQ_NPROBE = 8; // lists probed by a query
+
+    // segment knn results kept for the queries run with the cache option
+    constexpr SizeT KNN_RESULT_CACHE_CAPACITY = 4096;
+
+    // optimized plans kept for the selects of the same shape
+    constexpr SizeT PLAN_CACHE_CAPACITY = 1024;
 
     // default distance compute blas parameter
     constexpr SizeT DISTANCE_COMPUTE_BLAS_QUERY_BS = 4096;
     constexpr SizeT DISTANCE_COMPUTE_BLAS_DATABASE_BS = 1024;
+    constexpr SizeT DISTANCE_COMPUTE_BLAS_MIN_QUERY_COUNT = 8; // from this many queries brute force computes a block with gemm
 
     constexpr SizeT DBT_COMPACTION_M = 4;
     constexpr SizeT DBT_COMPACTION_C = 4;
     constexpr SizeT DBT_COMPACTION_S = DEFAULT_BLOCK_CAPACITY;
 
+    // cost-aware compaction: a table keeps at most this many segments that are less than half full before they are merged
+    constexpr SizeT COST_COMPACTION_MAX_SMALL_SEGMENTS = 8;
+    constexpr double COST_COMPACTION_DELETE_RATIO = 0.3;     // a segment with this ratio of deleted rows is compacted first
+    constexpr SizeT COST_COMPACTION_MIN_INTERVAL_MS = 10000; // a table is compacted again this long after, unless it has twice the segments
+    constexpr SizeT COST_COMPACTION_MIN_SEGMENT_AGE_MS = 1000; // newer segments are left for the next pick, unless the table has twice the segments
+    constexpr SizeT COST_COMPACTION_MAX_RUNNING_TASKS = 4;    // compaction tasks of all tables running at once
+
+    // full-text chunks of a segment are merged in tiers: a chunk of less than S * C^(t+1) rows is in tier t,
+    // and C chunks of a tier next to each other are merged into one of the next tier
+    constexpr u32 FULL_TEXT_CHUNK_MERGE_C = 4;
+    constexpr u32 FULL_TEXT_CHUNK_MERGE_S = 8 * DEFAULT_BLOCK_CAPACITY;
+
     // default query option parameter
     constexpr u32 DEFAULT_FULL_TEXT_OPTION_TOP_N = 100;
+    constexpr u32 DEFAULT_FULL_TEXT_PREFIX_MAX_EXPANSION = 64;
+    // unions of up to this many children use block max wand, longer ones block max maxscore
+    constexpr u32 FULL_TEXT_WAND_MAX_CHILDREN = 4;
+    // early terminate iterators are chosen automatically for queries of at least this many terms,
+    // or when the matched docs outnumber top_n by this factor
+    constexpr u32 FULL_TEXT_EARLY_TERMINATE_MIN_TERMS = 4;
+    constexpr u32 FULL_TEXT_EARLY_TERMINATE_DOCS_PER_RESULT = 64;
+    // posting lists of disk chunks of at least this many bytes are advised for sequential read-ahead
+    constexpr SizeT FULL_TEXT_SEQUENTIAL_POSTING_SIZE = 1024 * 1024;
+    // term metas of disk chunks cached across queries
+    constexpr SizeT TERM_META_CACHE_CAPACITY = 1024 * 1024;
+    // bytes of the analyzed terms a full-text memory indexer keeps for the rows that UPDATE appends again unchanged
+    constexpr SizeT FULL_TEXT_TERM_LIST_CACHE_BYTES = 8 * 1024 * 1024;
+
+    // default export parameter
+    constexpr SizeT DEFAULT_EXPORT_WRITE_BUFFER_SIZE = 4 * 1024 * 1024;
 }
 
 // constexpr SizeT DEFAULT_BUFFER_SIZE = 8192;
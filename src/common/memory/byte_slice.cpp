@@ -22,6 +22,14 @@ ByteSlice *ByteSlice::CreateSlice(SizeT data_size, MemoryPool *pool) {
     return slice;
 }
 
+ByteSlice *ByteSlice::WrapData(u8 *data, SizeT data_size) {
+    ByteSlice *slice = new (new u8[GetHeadSize()]) ByteSlice;
+    slice->data_ = data;
+    slice->size_ = data_size;
+    slice->offset_ = 0;
+    return slice;
+}
+
 void ByteSlice::DestroySlice(ByteSlice *slice, MemoryPool *pool) {
     u8 *mem = (u8 *)slice;
     if (pool == nullptr) {
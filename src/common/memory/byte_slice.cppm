@@ -20,6 +20,9 @@ export struct ByteSlice {
 
     static ByteSlice *CreateSlice(SizeT data_size, MemoryPool *pool = nullptr);
 
+    // A slice over data it doesn't own, e.g. a mapped file. Only the head is freed by DestroySlice.
+    static ByteSlice *WrapData(u8 *data, SizeT data_size);
+
     static void DestroySlice(ByteSlice *slice, MemoryPool *pool = nullptr);
 
     static ByteSlice *GetEmptySlice() {
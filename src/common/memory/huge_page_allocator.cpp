@@ -0,0 +1,81 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+module;
+
+#include <cstdint>
+#include <new>
+#include <sys/mman.h>
+
+module huge_page_allocator;
+
+import stl;
+
+namespace infinity {
+
+namespace {
+
+constexpr SizeT HUGE_PAGE_SIZE = HugePageAllocator::HUGE_PAGE_SIZE;
+
+inline SizeT MappedSize(SizeT size) { return (size + HUGE_PAGE_SIZE - 1) / HUGE_PAGE_SIZE * HUGE_PAGE_SIZE; }
+
+} // namespace
+
+void *HugePageAllocator::Allocate(SizeT size, SizeT align) {
+    if (size < HUGE_PAGE_SIZE) {
+        void *ptr = operator new[](size, std::align_val_t(align));
+        std::memset(ptr, 0, size);
+        return ptr;
+    }
+    SizeT mapped_size = MappedSize(size);
+    HugePageMode mode = mode_.load();
+    if (mode == HugePageMode::kExplicit) {
+        void *ptr = mmap(nullptr, mapped_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (ptr != MAP_FAILED) {
+            return ptr;
+        }
+    }
+    // map a huge page more and unmap the parts out of the aligned range
+    auto *ptr = static_cast<char *>(mmap(nullptr, mapped_size + HUGE_PAGE_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
+    if (ptr == MAP_FAILED) {
+        throw std::bad_alloc();
+    }
+    auto *aligned_ptr = reinterpret_cast<char *>((reinterpret_cast<uintptr_t>(ptr) + HUGE_PAGE_SIZE - 1) & ~(HUGE_PAGE_SIZE - 1));
+    if (aligned_ptr > ptr) {
+        munmap(ptr, aligned_ptr - ptr);
+    }
+    SizeT tail_size = HUGE_PAGE_SIZE - (aligned_ptr - ptr);
+    if (tail_size > 0) {
+        munmap(aligned_ptr + mapped_size, tail_size);
+    }
+    if (mode != HugePageMode::kOff) {
+        // best effort, the kernel may have transparent huge pages disabled
+        madvise(aligned_ptr, mapped_size, MADV_HUGEPAGE);
+    }
+    return aligned_ptr;
+}
+
+void HugePageAllocator::Deallocate(void *ptr, SizeT size, SizeT align) {
+    if (ptr == nullptr) {
+        return;
+    }
+    if (size < HUGE_PAGE_SIZE) {
+        operator delete[](ptr, std::align_val_t(align));
+        return;
+    }
+    munmap(ptr, MappedSize(size));
+}
+
+} // namespace infinity
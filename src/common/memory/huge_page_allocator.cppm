@@ -0,0 +1,54 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+module;
+
+#include <cstddef>
+
+export module huge_page_allocator;
+
+import stl;
+
+namespace infinity {
+
+export enum class HugePageMode : u8 {
+    kOff,         // large allocations are mapped with the normal pages
+    kTransparent, // large allocations are advised to the kernel for transparent huge pages
+    kExplicit,    // large allocations are taken from the reserved huge pages (vm.nr_hugepages), kTransparent when there are none left
+};
+
+// Allocator of the large, long lived buffers: the HNSW graphs, the LVQ vector stores and the column block buffers.
+// An allocation of HUGE_PAGE_SIZE bytes or more is mapped on its own and aligned to HUGE_PAGE_SIZE, so that it can be backed by
+// 2 MB pages, which saves the TLB misses of the random accesses of graph search, and it does not fragment the malloc arenas.
+// Smaller allocations are left to operator new. The memory is zeroed.
+// Deallocate must be given the size and the alignment of the allocation.
+export class HugePageAllocator {
+public:
+    static constexpr SizeT HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+
+    static void SetMode(HugePageMode mode) { mode_.store(mode); }
+
+    static HugePageMode mode() { return mode_.load(); }
+
+    // align: at most 4096 for the large allocations
+    static void *Allocate(SizeT size, SizeT align = alignof(std::max_align_t));
+
+    static void Deallocate(void *ptr, SizeT size, SizeT align = alignof(std::max_align_t));
+
+private:
+    static inline Atomic<HugePageMode> mode_{HugePageMode::kOff};
+};
+
+} // namespace infinity
@@ -361,6 +361,14 @@ Status Status::AggregateFunctionWithEmptyArgs() {
     return Status(ErrorCode::kAggregateFunctionWithEmptyArgs, MakeUnique<String>("Aggregate function with empty arguments"));
 }
 
+Status Status::CursorNotFound(i64 cursor_id) {
+    return Status(ErrorCode::kCursorNotFound, MakeUnique<String>(fmt::format("Cursor id: {} isn't found", cursor_id)));
+}
+
+Status Status::ReadOnlyReplica(const String &query_text) {
+    return Status(ErrorCode::kReadOnlyReplica, MakeUnique<String>(fmt::format("Query: {} writes, but this node is a read-only replica", query_text)));
+}
+
 // 4. TXN fail
 Status Status::TxnRollback(u64 txn_id) {
     return Status(ErrorCode::kTxnRollback, MakeUnique<String>(fmt::format("Transaction: {} is rollback", txn_id)));
@@ -394,6 +402,16 @@ Status Status::QueryTooBig(const String &query_text, u64 ast_node) {
     return Status(ErrorCode::kQueryIsTooComplex, MakeUnique<String>(fmt::format("Query: {} is too complex with {} AST nodes", query_text, ast_node)));
 }
 
+Status Status::TooManyCursors(i64 session_id, SizeT cursor_limit) {
+    return Status(ErrorCode::kTooManyCursors, MakeUnique<String>(fmt::format("Session: {} already has {} open cursors", session_id, cursor_limit)));
+}
+
+Status Status::ReplicaTooStale(u64 staleness_ms, u64 max_staleness_ms) {
+    return Status(ErrorCode::kReplicaTooStale,
+                  MakeUnique<String>(
+                      fmt::format("The replica is {}ms behind its leader, more than the max staleness {}ms", staleness_ms, max_staleness_ms)));
+}
+
 // 6. Operation intervention
 Status Status::QueryCancelled(const String &query_text) {
     return Status(ErrorCode::kQueryCancelled, MakeUnique<String>(fmt::format("Query: {} is cancelled", query_text)));
@@ -405,6 +423,10 @@ Status Status::QueryNotSupported(const String &query_text, const String &detaile
 
 Status Status::ClientClose() { return Status(ErrorCode::kClientClose); }
 
+Status Status::QueryNotFound(u64 query_id) {
+    return Status(ErrorCode::kQueryNotFound, MakeUnique<String>(fmt::format("Query: {} is not running", query_id)));
+}
+
 // 7. System error
 Status Status::IOError(const String &detailed_info) {
     return Status(ErrorCode::kIOError, MakeUnique<String>(fmt::format("IO error: {}", detailed_info)));
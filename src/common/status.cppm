@@ -112,6 +112,8 @@ export enum class ErrorCode : long {
     kSegmentNotExist = 3070,
     kAggregateFunctionWithEmptyArgs = 3071,
     kBlockNotExist = 3072,
+    kCursorNotFound = 3073,
+    kReadOnlyReplica = 3074,
 
     // 4. Txn fail
     kTxnRollback = 4001,
@@ -123,11 +125,14 @@ export enum class ErrorCode : long {
     kTooManyConnections = 5003,
     kConfigurationLimitExceed = 5004,
     kQueryIsTooComplex = 5005,
+    kTooManyCursors = 5006,
+    kReplicaTooStale = 5007,
 
     // 6. Query intervention
     kQueryCancelled = 6001,
     kQueryNotSupported = 6002,
     kClientClose = 6003,
+    kQueryNotFound = 6004,
 
     // 7. System error
     kIOError = 7001,
@@ -242,6 +247,8 @@ public:
     static Status SegmentNotExist(const SegmentID &segment_id);
     static Status BlockNotExist(const BlockID &block_id);
     static Status AggregateFunctionWithEmptyArgs();
+    static Status CursorNotFound(i64 cursor_id);
+    static Status ReadOnlyReplica(const String &query_text);
 
     // 4. TXN fail
     static Status TxnRollback(u64 txn_id);
@@ -253,11 +260,14 @@ public:
     static Status TooManyConnections(const String &detailed_info);
     static Status ConfigurationLimitExceed(const String &config_name, const String &config_value, const String &valid_value_range);
     static Status QueryTooBig(const String &query_text, u64 ast_node);
+    static Status TooManyCursors(i64 session_id, SizeT cursor_limit);
+    static Status ReplicaTooStale(u64 staleness_ms, u64 max_staleness_ms);
 
     // 6. Operation intervention
     static Status QueryCancelled(const String &query_text);
     static Status QueryNotSupported(const String &query_text, const String &detailed_reason);
     static Status ClientClose();
+    static Status QueryNotFound(u64 query_id);
 
     // 7. System error
     static Status IOError(const String &detailed_info);
@@ -363,6 +363,9 @@ namespace infinity {
     // Concurrency
     using ThreadPool = ctpl::thread_pool;
 
+    template <typename T>
+    using Future = std::future<T>;
+
     using Thread = std::thread;
 
     // template< class Rep, class Period >
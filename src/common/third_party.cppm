@@ -42,6 +42,8 @@ module;
 #include "parallel_hashmap/phmap.h"
 #include "pgm/pgm_index.hpp"
 
+#include "roaring/roaring.hh"
+
 #include "oatpp/web/server/HttpConnectionHandler.hpp"
 #include "oatpp/network/Server.hpp"
 #include "oatpp/network/tcp/server/ConnectionProvider.hpp"
@@ -171,11 +173,19 @@ using FlatHashSet = phmap::flat_hash_set<T, Hash, Eq, Alloc>;
 export template <typename K, size_t Epsilon = 64, size_t EpsilonRecursive = 4, typename Floating = float>
 using PGMIndex = pgm::PGMIndex<K, Epsilon, EpsilonRecursive, Floating>;
 
+export using RoaringBitmap = roaring::Roaring;
+
 
 // Http
 export using HttpRequestHandler = oatpp::web::server::HttpRequestHandler;
 export using HttpRouter = oatpp::web::server::HttpRouter;
 export using HttpConnectionHandler = oatpp::web::server::HttpConnectionHandler;
+export using HttpProcessor = oatpp::web::server::HttpProcessor;
+export using WebConnectionHandler = oatpp::network::ConnectionHandler;
+export using WebIOStream = oatpp::data::stream::IOStream;
+export using WebIOMode = oatpp::data::stream::IOMode;
+export template <typename T>
+using WebResourceHandle = oatpp::provider::ResourceHandle<T>;
 export using HttpConnectionProvider = oatpp::network::tcp::server::ConnectionProvider;
 export using WebServer = oatpp::network::Server;
 export using WebEnvironment = oatpp::base::Environment;
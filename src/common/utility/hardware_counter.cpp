@@ -0,0 +1,105 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+import stl;
+
+module hardware_counter;
+
+namespace infinity {
+
+#if defined(__linux__)
+
+namespace {
+
+// The events are opened as one group, so that they are scheduled on the pmu together and read with one syscall.
+class ThreadPerfEvents {
+public:
+    ThreadPerfEvents() {
+        constexpr Array<Pair<u32, u64>, 3> events = {{
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES},
+        }};
+        for (SizeT i = 0; i < events.size(); ++i) {
+            perf_event_attr attr{};
+            attr.size = sizeof(perf_event_attr);
+            attr.type = events[i].first;
+            attr.config = events[i].second;
+            attr.read_format = PERF_FORMAT_GROUP;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            int group_fd = i == 0 ? -1 : fds_[0];
+            // pid 0 and cpu -1, the calling thread on any cpu
+            fds_[i] = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, group_fd, 0));
+            if (fds_[i] < 0) {
+                Close();
+                return;
+            }
+        }
+    }
+
+    ~ThreadPerfEvents() { Close(); }
+
+    bool Read(HardwareCounter &counter) const {
+        if (fds_[0] < 0) {
+            return false;
+        }
+        // nr, then the values in the order the events are opened
+        u64 values[1 + EVENT_COUNT]{};
+        if (read(fds_[0], values, sizeof(values)) != static_cast<ssize_t>(sizeof(values))) {
+            return false;
+        }
+        counter.cycles_ = values[1];
+        counter.instructions_ = values[2];
+        counter.llc_misses_ = values[3];
+        return true;
+    }
+
+private:
+    static constexpr SizeT EVENT_COUNT = 3;
+
+    void Close() {
+        for (int &fd : fds_) {
+            if (fd >= 0) {
+                close(fd);
+                fd = -1;
+            }
+        }
+    }
+
+    int fds_[EVENT_COUNT]{-1, -1, -1};
+};
+
+} // namespace
+
+bool ReadThreadHardwareCounter(HardwareCounter &counter) {
+    thread_local ThreadPerfEvents events;
+    return events.Read(counter);
+}
+
+#else
+
+bool ReadThreadHardwareCounter(HardwareCounter &) { return false; }
+
+#endif
+
+} // namespace infinity
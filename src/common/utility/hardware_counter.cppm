@@ -0,0 +1,34 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module hardware_counter;
+
+import stl;
+
+namespace infinity {
+
+// The counts of the calling thread since its first read, only the user space is counted.
+export struct HardwareCounter {
+    u64 cycles_{};
+    u64 instructions_{};
+    u64 llc_misses_{};
+};
+
+// Opens the perf events of the calling thread at the first call. Returns false if perf events are unavailable, as
+// with perf_event_paranoid > 2 or on another platform than Linux, then the counter is left unchanged.
+export bool ReadThreadHardwareCounter(HardwareCounter &counter);
+
+} // namespace infinity
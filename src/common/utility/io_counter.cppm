@@ -0,0 +1,33 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module io_counter;
+
+import stl;
+
+namespace infinity {
+
+// The buffer loads and spill writes of the current thread. The task profiler takes the difference
+// around an operator, since an operator runs on one worker thread from its start to its stop.
+export struct IOCounter {
+    u64 buffer_hits_{};
+    u64 buffer_misses_{};
+    u64 spilled_bytes_{};
+};
+
+export IOCounter &ThreadIOCounter();
+
+} // namespace infinity
@@ -0,0 +1,63 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <charconv>
+
+export module number_parser;
+
+import stl;
+
+namespace infinity {
+
+// Parses the whole string as a number with std::from_chars, which libstdc++ implements with the fast_float algorithm.
+export template <typename T>
+inline bool ParseNumber(std::string_view str, T &value) {
+    const char *end = str.data() + str.size();
+    auto [ptr, ec] = std::from_chars(str.data(), end, value);
+    return ec == std::errc() && ptr == end;
+}
+
+// Parses an embedding string like [0.1,0.2,...] into dst, the elements are separated by the delimiter or spaces. Each
+// std::from_chars stops at the end of its element, so the string is scanned once without splitting it first.
+// Returns the element count, or -1 if the string is malformed or has more than dimension elements.
+export template <typename T>
+i64 ParseEmbedding(std::string_view str, char delimiter, T *dst, SizeT dimension) {
+    if (str.size() < 2 || str.front() != '[' || str.back() != ']') {
+        return -1;
+    }
+    const char *ptr = str.data() + 1;
+    const char *end = str.data() + str.size() - 1;
+    SizeT count = 0;
+    while (true) {
+        while (ptr < end && (*ptr == delimiter || *ptr == ' ')) {
+            ++ptr;
+        }
+        if (ptr == end) {
+            return count;
+        }
+        if (count == dimension) {
+            return -1;
+        }
+        auto [next, ec] = std::from_chars(ptr, end, dst[count]);
+        if (ec != std::errc() || (next < end && *next != delimiter && *next != ' ')) {
+            return -1;
+        }
+        ++count;
+        ptr = next;
+    }
+}
+
+} // namespace infinity
@@ -14,6 +14,7 @@
 
 module;
 
+#include <filesystem>
 #include <thread>
 
 import stl;
@@ -38,4 +39,21 @@ bool ThreadUtil::pin(Thread &thread, const u16 cpu_id) {
 #endif
 }
 
+i64 ThreadUtil::NumaNodeOfCpu(u64 cpu_id) {
+#if defined(__APPLE__)
+    return 0;
+#else
+    // /sys/devices/system/cpu/cpuN has a nodeK link to its node.
+    std::error_code error_code;
+    std::filesystem::path cpu_path = std::filesystem::path("/sys/devices/system/cpu") / ("cpu" + std::to_string(cpu_id));
+    for (const auto &entry : std::filesystem::directory_iterator(cpu_path, error_code)) {
+        String name = entry.path().filename().string();
+        if (name.size() > 4 && name.compare(0, 4, "node") == 0) {
+            return std::stoll(name.substr(4));
+        }
+    }
+    return 0;
+#endif
+}
+
 } // namespace infinity
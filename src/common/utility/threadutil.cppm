@@ -11,6 +11,9 @@ namespace infinity {
 export class ThreadUtil {
 public:
     static bool pin(Thread &thread, const u16 cpu_id);
+
+    // NUMA node of the cpu from sysfs, 0 when the topology isn't available.
+    static i64 NumaNodeOfCpu(u64 cpu_id);
 };
 
 } // namespace infinity
\ No newline at end of file
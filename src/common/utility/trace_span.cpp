@@ -0,0 +1,123 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+module trace_span;
+
+import stl;
+import third_party;
+import default_values;
+
+namespace infinity {
+
+namespace {
+
+struct TraceEvent {
+    const char *category_{nullptr};
+    const char *name_{nullptr};
+    i64 arg_{-1};
+    i64 begin_ns_{0};
+    i64 end_ns_{0};
+};
+
+// Written by its thread and read by a dump, the lock is not contended while no dump runs.
+struct TraceRing {
+    explicit TraceRing(u64 thread_id) : thread_id_(thread_id), events_(TRACE_RING_CAPACITY) {}
+
+    std::mutex mutex_{};
+    const u64 thread_id_;
+    Vector<TraceEvent> events_;
+    // spans recorded since the start of the trace, the ring keeps the last TRACE_RING_CAPACITY of them
+    u64 count_{0};
+};
+
+struct TraceRings {
+    std::mutex mutex_{};
+    // the rings of the exited threads are kept for the dump
+    Vector<SharedPtr<TraceRing>> rings_{};
+    i64 start_ns_{0};
+};
+
+TraceRings &GlobalTraceRings() {
+    static TraceRings trace_rings;
+    return trace_rings;
+}
+
+TraceRing &ThreadTraceRing() {
+    thread_local SharedPtr<TraceRing> ring = [] {
+        TraceRings &trace_rings = GlobalTraceRings();
+        std::unique_lock<std::mutex> lock(trace_rings.mutex_);
+        auto new_ring = MakeShared<TraceRing>(trace_rings.rings_.size() + 1);
+        trace_rings.rings_.push_back(new_ring);
+        return new_ring;
+    }();
+    return *ring;
+}
+
+} // namespace
+
+void TraceRecorder::Start() {
+    TraceRings &trace_rings = GlobalTraceRings();
+    {
+        std::unique_lock<std::mutex> lock(trace_rings.mutex_);
+        for (const auto &ring : trace_rings.rings_) {
+            std::unique_lock<std::mutex> ring_lock(ring->mutex_);
+            ring->count_ = 0;
+        }
+        trace_rings.start_ns_ = NowNs();
+    }
+    enabled_.store(true, std::memory_order_relaxed);
+}
+
+void TraceRecorder::Stop() { enabled_.store(false, std::memory_order_relaxed); }
+
+void TraceRecorder::Record(const char *category, const char *name, i64 arg, i64 begin_ns, i64 end_ns) {
+    TraceRing &ring = ThreadTraceRing();
+    std::unique_lock<std::mutex> lock(ring.mutex_);
+    ring.events_[ring.count_ % TRACE_RING_CAPACITY] = TraceEvent{category, name, arg, begin_ns, end_ns};
+    ++ring.count_;
+}
+
+String TraceRecorder::DumpChromeTrace() {
+    TraceRings &trace_rings = GlobalTraceRings();
+    String trace = R"({"displayTimeUnit":"ns","traceEvents":[)";
+    bool first = true;
+    std::unique_lock<std::mutex> lock(trace_rings.mutex_);
+    for (const auto &ring : trace_rings.rings_) {
+        std::unique_lock<std::mutex> ring_lock(ring->mutex_);
+        u64 event_count = std::min<u64>(ring->count_, TRACE_RING_CAPACITY);
+        for (u64 idx = ring->count_ - event_count; idx < ring->count_; ++idx) {
+            const TraceEvent &event = ring->events_[idx % TRACE_RING_CAPACITY];
+            // a span begun before the start of the trace is cut at the start
+            i64 begin_ns = std::max(event.begin_ns_, trace_rings.start_ns_);
+            trace += fmt::format(R"({}{{"name":"{}","cat":"{}","ph":"X","pid":1,"tid":{},"ts":{:.3f},"dur":{:.3f})",
+                                 first ? "" : ",",
+                                 event.name_,
+                                 event.category_,
+                                 ring->thread_id_,
+                                 (begin_ns - trace_rings.start_ns_) / 1000.0,
+                                 (event.end_ns_ - begin_ns) / 1000.0);
+            if (event.arg_ >= 0) {
+                trace += fmt::format(R"(,"args":{{"arg":{}}})", event.arg_);
+            }
+            trace += "}";
+            first = false;
+        }
+    }
+    trace += "]}";
+    return trace;
+}
+
+} // namespace infinity
@@ -0,0 +1,74 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module trace_span;
+
+import stl;
+
+namespace infinity {
+
+// Trace spans are recorded into a ring of each thread while tracing is started, and dumped in the Chrome trace event
+// format, which chrome://tracing and the Perfetto UI open. While tracing is stopped a span costs an atomic load.
+export class TraceRecorder {
+public:
+    static inline bool enabled() { return enabled_.load(std::memory_order_relaxed); }
+
+    // Drops the spans of the last trace
+    static void Start();
+
+    static void Stop();
+
+    // The spans of the rings, each ring keeps the last TRACE_RING_CAPACITY ones of its thread
+    static String DumpChromeTrace();
+
+    static void Record(const char *category, const char *name, i64 arg, i64 begin_ns, i64 end_ns);
+
+    static inline i64 NowNs() { return ChronoCast<NanoSeconds>(Clock::now().time_since_epoch()).count(); }
+
+private:
+    static inline Atomic<bool> enabled_{false};
+};
+
+// The category and the name are string literals, only the pointers are kept. arg is shown in the args of the span,
+// e.g. the task id, -1 for none.
+export class TraceSpan {
+public:
+    TraceSpan(const char *category, const char *name, i64 arg = -1) {
+        if (TraceRecorder::enabled()) {
+            category_ = category;
+            name_ = name;
+            arg_ = arg;
+            begin_ns_ = TraceRecorder::NowNs();
+        }
+    }
+
+    ~TraceSpan() {
+        if (category_ != nullptr) {
+            TraceRecorder::Record(category_, name_, arg_, begin_ns_, TraceRecorder::NowNs());
+        }
+    }
+
+    TraceSpan(const TraceSpan &) = delete;
+    TraceSpan &operator=(const TraceSpan &) = delete;
+
+private:
+    const char *category_{nullptr};
+    const char *name_{nullptr};
+    i64 arg_{-1};
+    i64 begin_ns_{0};
+};
+
+} // namespace infinity
@@ -0,0 +1,215 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+module aggregate_hash_table;
+
+import stl;
+import hash_table;
+import data_block;
+import column_vector;
+import base_expression;
+import aggregate_expression;
+import expression_state;
+import expression_evaluator;
+import selection;
+import default_values;
+import logical_type;
+import internal_types;
+import data_type;
+
+namespace infinity {
+
+AggregateHashTable::AggregateHashTable(Vector<SharedPtr<BaseExpression>> groups, Vector<SharedPtr<BaseExpression>> aggregates)
+    : groups_(std::move(groups)), aggregates_(std::move(aggregates)) {
+    group_types_.reserve(groups_.size());
+    for (const auto &group : groups_) {
+        group_types_.emplace_back(MakeShared<DataType>(group->Type()));
+    }
+    hash_table_.Init(group_types_);
+}
+
+void AggregateHashTable::Update(const DataBlock *input_block) {
+    SizeT row_count = input_block->row_count();
+    if (row_count == 0) {
+        return;
+    }
+    ExpressionEvaluator evaluator;
+    evaluator.Init(input_block);
+
+    // 1. Evaluate the group by keys and find the group of each row.
+    DataBlock key_block;
+    key_block.Init(group_types_);
+    for (SizeT group_idx = 0; group_idx < groups_.size(); ++group_idx) {
+        SharedPtr<ExpressionState> expr_state = ExpressionState::CreateState(groups_[group_idx]);
+        evaluator.Execute(groups_[group_idx], expr_state, key_block.column_vectors[group_idx]);
+    }
+    Vector<u32> group_ids;
+    hash_table_.FindOrInsert(key_block.column_vectors, row_count, group_ids);
+
+    // 2. Keep the key and initialize the aggregate states of the new groups, group ids are assigned in the order of rows.
+    SizeT aggregate_count = aggregates_.size();
+    for (SizeT row_idx = 0; row_idx < row_count; ++row_idx) {
+        if (group_ids[row_idx] != group_states_.size()) {
+            continue;
+        }
+        if (group_key_blocks_.empty() || group_key_blocks_.back()->column_vectors[0]->Size() == (SizeT)DEFAULT_BLOCK_CAPACITY) {
+            group_key_blocks_.emplace_back(DataBlock::MakeUniquePtr());
+            group_key_blocks_.back()->Init(group_types_);
+        }
+        DataBlock *group_key_block = group_key_blocks_.back().get();
+        for (SizeT group_idx = 0; group_idx < groups_.size(); ++group_idx) {
+            group_key_block->column_vectors[group_idx]->AppendWith(*key_block.column_vectors[group_idx], row_idx, 1);
+        }
+
+        Vector<UniquePtr<char[]>> &states = group_states_.emplace_back();
+        states.reserve(aggregate_count);
+        for (const auto &aggregate : aggregates_) {
+            auto *aggregate_expression = static_cast<AggregateExpression *>(aggregate.get());
+            states.emplace_back(aggregate_expression->aggregate_function_.InitState());
+            aggregate_expression->aggregate_function_.init_func_(states.back().get());
+        }
+    }
+    if (aggregate_count == 0) {
+        return;
+    }
+
+    // 3. Order the rows by group, so that the rows of each group are in one range.
+    Vector<u32> block_groups;
+    HashMap<u32, SizeT> block_group_index;
+    Vector<SizeT> block_group_counts;
+    Vector<SizeT> row_block_groups(row_count);
+    for (SizeT row_idx = 0; row_idx < row_count; ++row_idx) {
+        auto [iter, inserted] = block_group_index.emplace(group_ids[row_idx], block_groups.size());
+        if (inserted) {
+            block_groups.emplace_back(group_ids[row_idx]);
+            block_group_counts.emplace_back(0);
+        }
+        row_block_groups[row_idx] = iter->second;
+        ++block_group_counts[iter->second];
+    }
+    Vector<SizeT> block_group_offsets(block_groups.size() + 1, 0);
+    for (SizeT idx = 0; idx < block_groups.size(); ++idx) {
+        block_group_offsets[idx + 1] = block_group_offsets[idx] + block_group_counts[idx];
+    }
+    Vector<SizeT> sorted_rows(row_count);
+    {
+        Vector<SizeT> cursors(block_group_offsets.begin(), block_group_offsets.end() - 1);
+        for (SizeT row_idx = 0; row_idx < row_count; ++row_idx) {
+            sorted_rows[cursors[row_block_groups[row_idx]]++] = row_idx;
+        }
+    }
+    Selection sorted_selection;
+    sorted_selection.Initialize(row_count);
+    for (SizeT row_idx : sorted_rows) {
+        sorted_selection.Append(row_idx);
+    }
+
+    // 4. Update the aggregate states with the argument of each group.
+    for (SizeT aggregate_idx = 0; aggregate_idx < aggregate_count; ++aggregate_idx) {
+        auto aggregate_expression = std::static_pointer_cast<AggregateExpression>(aggregates_[aggregate_idx]);
+        SharedPtr<BaseExpression> &argument = aggregate_expression->arguments()[0];
+        SharedPtr<ColumnVector> argument_column = ColumnVector::Make(MakeShared<DataType>(argument->Type()));
+        argument_column->Initialize(argument->Type().type() == LogicalType::kBoolean ? ColumnVectorType::kCompactBit : ColumnVectorType::kFlat);
+        SharedPtr<ExpressionState> argument_state = ExpressionState::CreateState(argument);
+        evaluator.Execute(argument, argument_state, argument_column);
+
+        SharedPtr<ColumnVector> sorted_column = ColumnVector::Make(argument_column->data_type());
+        sorted_column->Initialize(*argument_column, sorted_selection);
+        for (SizeT idx = 0; idx < block_groups.size(); ++idx) {
+            SharedPtr<ColumnVector> group_column = ColumnVector::Make(argument_column->data_type());
+            group_column->Initialize(sorted_column->vector_type(), *sorted_column, block_group_offsets[idx], block_group_offsets[idx + 1]);
+            aggregate_expression->aggregate_function_.update_func_(group_states_[block_groups[idx]][aggregate_idx].get(), group_column);
+        }
+    }
+}
+
+void AggregateHashTable::Finalize(const Vector<SharedPtr<DataType>> &output_types, Vector<UniquePtr<DataBlock>> &output_blocks) const {
+    SizeT group_id = 0;
+    for (const auto &group_key_block : group_key_blocks_) {
+        SizeT row_count = group_key_block->column_vectors[0]->Size();
+        output_blocks.emplace_back(DataBlock::MakeUniquePtr());
+        DataBlock *output_block = output_blocks.back().get();
+        output_block->Init(output_types);
+        for (SizeT group_idx = 0; group_idx < groups_.size(); ++group_idx) {
+            output_block->column_vectors[group_idx]->AppendWith(*group_key_block->column_vectors[group_idx], 0, row_count);
+        }
+        for (SizeT row_idx = 0; row_idx < row_count; ++row_idx, ++group_id) {
+            AppendAggregates(output_block, group_id);
+        }
+        output_block->Finalize();
+    }
+}
+
+void AggregateHashTable::FinalizePartitions(const Vector<SharedPtr<DataType>> &output_types,
+                                            SizeT partition_count,
+                                            Vector<UniquePtr<DataBlock>> &output_blocks,
+                                            Vector<SizeT> &partition_ids) const {
+    // The block being filled of each partition, the index in output_blocks.
+    Vector<SizeT> partition_blocks(partition_count, std::numeric_limits<SizeT>::max());
+    Vector<u64> hashes;
+    SizeT group_id = 0;
+    for (const auto &group_key_block : group_key_blocks_) {
+        SizeT row_count = group_key_block->column_vectors[0]->Size();
+        hash_table_.Hash(group_key_block->column_vectors, row_count, hashes);
+        for (SizeT row_idx = 0; row_idx < row_count; ++row_idx, ++group_id) {
+            // The low bits of the hash locate the slot in the hash table of the merge, partition by the high bits.
+            SizeT partition_id = ((hashes[row_idx] >> 32) * partition_count) >> 32;
+            SizeT &block_idx = partition_blocks[partition_id];
+            if (block_idx == std::numeric_limits<SizeT>::max() || output_blocks[block_idx]->column_vectors[0]->Size() == (SizeT)DEFAULT_BLOCK_CAPACITY) {
+                if (block_idx != std::numeric_limits<SizeT>::max()) {
+                    output_blocks[block_idx]->Finalize();
+                }
+                block_idx = output_blocks.size();
+                output_blocks.emplace_back(DataBlock::MakeUniquePtr());
+                output_blocks.back()->Init(output_types);
+                partition_ids.emplace_back(partition_id);
+            }
+            DataBlock *output_block = output_blocks[block_idx].get();
+            for (SizeT group_idx = 0; group_idx < groups_.size(); ++group_idx) {
+                output_block->column_vectors[group_idx]->AppendWith(*group_key_block->column_vectors[group_idx], row_idx, 1);
+            }
+            AppendAggregates(output_block, group_id);
+        }
+    }
+    for (SizeT block_idx : partition_blocks) {
+        if (block_idx != std::numeric_limits<SizeT>::max()) {
+            output_blocks[block_idx]->Finalize();
+        }
+    }
+}
+
+void AggregateHashTable::AppendAggregates(DataBlock *output_block, SizeT group_id) const {
+    for (SizeT aggregate_idx = 0; aggregate_idx < aggregates_.size(); ++aggregate_idx) {
+        auto *aggregate_expression = static_cast<AggregateExpression *>(aggregates_[aggregate_idx].get());
+        const_ptr_t result_ptr = aggregate_expression->aggregate_function_.finalize_func_(group_states_[group_id][aggregate_idx].get());
+        output_block->column_vectors[groups_.size() + aggregate_idx]->AppendByPtr(result_ptr);
+    }
+}
+
+SizeT AggregateHashTable::MemoryUsage() const {
+    SizeT state_size = 0;
+    for (const auto &aggregate : aggregates_) {
+        state_size += static_cast<AggregateExpression *>(aggregate.get())->aggregate_function_.state_size_ + sizeof(UniquePtr<char[]>);
+    }
+    // The key blocks aren't finalized yet, count their full capacity.
+    SizeT key_size = 0;
+    for (const auto &group_type : group_types_) {
+        key_size += group_type->Size();
+    }
+    return hash_table_.MemoryUsage() + group_states_.size() * state_size + group_key_blocks_.size() * DEFAULT_BLOCK_CAPACITY * key_size;
+}
+
+} // namespace infinity
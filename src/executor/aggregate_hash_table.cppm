@@ -0,0 +1,67 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module aggregate_hash_table;
+
+import stl;
+import hash_table;
+import data_block;
+import base_expression;
+import internal_types;
+import data_type;
+
+namespace infinity {
+
+// The aggregate states of each group of a group by aggregate.
+// Rows are grouped by the hash table on the group by keys, the states of each group are updated with the rows of the group in one batch.
+export class AggregateHashTable {
+public:
+    explicit AggregateHashTable(Vector<SharedPtr<BaseExpression>> groups, Vector<SharedPtr<BaseExpression>> aggregates);
+
+    // Accumulate the rows of the input block into the aggregate states of their groups.
+    void Update(const DataBlock *input_block);
+
+    // One row for each group: the group by keys followed by the aggregate results.
+    void Finalize(const Vector<SharedPtr<DataType>> &output_types, Vector<UniquePtr<DataBlock>> &output_blocks) const;
+
+    // Same rows as Finalize, the groups are partitioned by the high bits of the key hash, so a group is always in the same partition.
+    // partition_ids holds the partition of each output block.
+    void FinalizePartitions(const Vector<SharedPtr<DataType>> &output_types,
+                            SizeT partition_count,
+                            Vector<UniquePtr<DataBlock>> &output_blocks,
+                            Vector<SizeT> &partition_ids) const;
+
+    inline SizeT GroupCount() const { return group_states_.size(); }
+
+    // Bytes held by the hash table, the group keys and the aggregate states, charged to the query memory tracker.
+    SizeT MemoryUsage() const;
+
+private:
+    // Append the aggregate results of the group after the group by keys.
+    void AppendAggregates(DataBlock *output_block, SizeT group_id) const;
+
+    Vector<SharedPtr<BaseExpression>> groups_{};
+    Vector<SharedPtr<BaseExpression>> aggregates_{};
+    Vector<SharedPtr<DataType>> group_types_{};
+
+    HashTable hash_table_{};
+    // Group by key of each group, group i is the row (i % DEFAULT_BLOCK_CAPACITY) of block (i / DEFAULT_BLOCK_CAPACITY).
+    Vector<UniquePtr<DataBlock>> group_key_blocks_{};
+    // Aggregate states of each group.
+    Vector<Vector<UniquePtr<char[]>>> group_states_{};
+};
+
+} // namespace infinity
@@ -21,6 +21,7 @@ module explain_physical_plan;
 import stl;
 import internal_types;
 import physical_operator;
+import profiler;
 import physical_union_all;
 import physical_index_scan;
 import physical_dummy_scan;
@@ -67,11 +68,13 @@ import physical_merge_top;
 import physical_merge_sort;
 import physical_merge_knn;
 import physical_match;
+import physical_merge_match;
 import physical_fusion;
 import status;
 import physical_operator_type;
 
 import explain_logical_plan;
+import join_reference;
 import logical_show;
 import infinity_exception;
 
@@ -239,9 +242,11 @@ void ExplainPhysicalPlan::Explain(const PhysicalOperator *op, SharedPtr<Vector<S
             break;
         }
         case PhysicalOperatorType::kParallelAggregate: {
+            Explain((PhysicalParallelAggregate *)op, result, intent_size);
             break;
         }
         case PhysicalOperatorType::kMergeParallelAggregate: {
+            Explain((PhysicalMergeParallelAggregate *)op, result, intent_size);
             break;
         }
         case PhysicalOperatorType::kIntersect: {
@@ -274,6 +279,10 @@ void ExplainPhysicalPlan::Explain(const PhysicalOperator *op, SharedPtr<Vector<S
             Explain((PhysicalMatch *)op, result, intent_size);
             break;
         }
+        case PhysicalOperatorType::kMergeMatch: {
+            Explain((PhysicalMergeMatch *)op, result, intent_size);
+            break;
+        }
         case PhysicalOperatorType::kFusion: {
             Explain((PhysicalFusion *)op, result, intent_size);
             break;
@@ -294,6 +303,46 @@ void ExplainPhysicalPlan::Explain(const PhysicalOperator *op, SharedPtr<Vector<S
     }
 }
 
+void ExplainPhysicalPlan::Explain(const PhysicalOperator *op,
+                                  const HashMap<u64, OperatorStatistics> &statistics,
+                                  SharedPtr<Vector<SharedPtr<String>>> &result,
+                                  i64 intent_size) {
+    Explain(op, result, false, intent_size);
+
+    String actual_str = String(intent_size, ' ') + " - actual: ";
+    auto iter = statistics.find(op->node_id());
+    if (iter == statistics.end()) {
+        actual_str += "never executed";
+    } else {
+        const OperatorStatistics &op_statistics = iter->second;
+        actual_str += fmt::format("rows: {}, input rows: {}, executions: {}, time: {}, cpu time: {}, "
+                                  "buffer hits: {}, buffer misses: {}, spilled bytes: {}",
+                                  op_statistics.output_rows_,
+                                  op_statistics.input_rows_,
+                                  op_statistics.executions_,
+                                  BaseProfiler::ElapsedToString(NanoSeconds(op_statistics.elapsed_)),
+                                  BaseProfiler::ElapsedToString(NanoSeconds(op_statistics.cpu_time_)),
+                                  op_statistics.buffer_hits_,
+                                  op_statistics.buffer_misses_,
+                                  op_statistics.spilled_bytes_);
+        if (op_statistics.cycles_ != 0) {
+            actual_str += fmt::format(", cycles: {}, instructions: {}, ipc: {:.2f}, llc misses: {}",
+                                      op_statistics.cycles_,
+                                      op_statistics.instructions_,
+                                      static_cast<f64>(op_statistics.instructions_) / op_statistics.cycles_,
+                                      op_statistics.llc_misses_);
+        }
+    }
+    result->emplace_back(MakeShared<String>(actual_str));
+
+    if (op->left() != nullptr) {
+        Explain(op->left(), statistics, result, intent_size + 2);
+    }
+    if (op->right() != nullptr) {
+        Explain(op->right(), statistics, result, intent_size + 2);
+    }
+}
+
 void ExplainPhysicalPlan::Explain(const PhysicalCreateSchema *create_node, SharedPtr<Vector<SharedPtr<String>>> &result, i64 intent_size) {
     {
         String create_header_str;
@@ -1279,6 +1328,43 @@ void ExplainPhysicalPlan::Explain(const PhysicalShow *show_node, SharedPtr<Vecto
             result->emplace_back(MakeShared<String>(output_columns_str));
             break;
         }
+        case ShowType::kShowSlowQueries: {
+            String show_str;
+            if (intent_size != 0) {
+                show_str = String(intent_size - 2, ' ');
+                show_str += "-> SHOW SLOW_QUERIES ";
+            } else {
+                show_str = "SHOW SLOW_QUERIES ";
+            }
+            show_str += "(";
+            show_str += std::to_string(show_node->node_id());
+            show_str += ")";
+            result->emplace_back(MakeShared<String>(show_str));
+
+            String output_columns_str = String(intent_size, ' ');
+            output_columns_str += " - output columns: [record_no, session_id, reason, query, parser, logical planner, optimizer, physical planner, "
+                                  "pipeline builder, task builder, executor, commit, rollback, total_cost]";
+            result->emplace_back(MakeShared<String>(output_columns_str));
+            break;
+        }
+        case ShowType::kShowQueries: {
+            String show_str;
+            if (intent_size != 0) {
+                show_str = String(intent_size - 2, ' ');
+                show_str += "-> SHOW QUERIES ";
+            } else {
+                show_str = "SHOW QUERIES ";
+            }
+            show_str += "(";
+            show_str += std::to_string(show_node->node_id());
+            show_str += ")";
+            result->emplace_back(MakeShared<String>(show_str));
+
+            String output_columns_str = String(intent_size, ' ');
+            output_columns_str += " - output columns: [query_id, session_id, elapsed, fragments, tasks, rows_scanned, memory, operator, query]";
+            result->emplace_back(MakeShared<String>(output_columns_str));
+            break;
+        }
         case ShowType::kShowSegments: {
             String show_str;
             if (intent_size != 0) {
@@ -1411,20 +1497,129 @@ void ExplainPhysicalPlan::Explain(const PhysicalShow *show_node, SharedPtr<Vecto
     }
 }
 
-void ExplainPhysicalPlan::Explain(const PhysicalUnionAll *, SharedPtr<Vector<SharedPtr<String>>> &, i64) {
-    RecoverableError(Status::NotSupport("Not implemented"));
+void ExplainPhysicalPlan::Explain(const PhysicalUnionAll *union_all_node, SharedPtr<Vector<SharedPtr<String>>> &result, i64 intent_size) {
+    {
+        String union_all_header;
+        if (intent_size != 0) {
+            union_all_header = String(intent_size - 2, ' ') + "-> UNION ALL ";
+        } else {
+            union_all_header = "UNION ALL ";
+        }
+        union_all_header += "(" + std::to_string(union_all_node->node_id()) + ")";
+        result->emplace_back(MakeShared<String>(union_all_header));
+    }
+
+    // Output column
+    {
+        String output_columns_str = String(intent_size, ' ') + " - output columns: [";
+        SharedPtr<Vector<String>> output_columns = union_all_node->GetOutputNames();
+        SizeT column_count = output_columns->size();
+        for (SizeT idx = 0; idx < column_count - 1; ++idx) {
+            output_columns_str += output_columns->at(idx) + ", ";
+        }
+        output_columns_str += output_columns->back() + "]";
+        result->emplace_back(MakeShared<String>(output_columns_str));
+    }
 }
 
 void ExplainPhysicalPlan::Explain(const PhysicalDummyScan *, SharedPtr<Vector<SharedPtr<String>>> &, i64) {
     UnrecoverableError("Not implement: PhysicalDummyScan");
 }
 
-void ExplainPhysicalPlan::Explain(const PhysicalHashJoin *, SharedPtr<Vector<SharedPtr<String>>> &, i64) {
-    UnrecoverableError("Not implement: PhysicalHashJoin");
+void ExplainPhysicalPlan::Explain(const PhysicalHashJoin *join_node, SharedPtr<Vector<SharedPtr<String>>> &result, i64 intent_size) {
+    String join_header;
+    if (intent_size != 0) {
+        join_header = String(intent_size - 2, ' ') + "-> HASH JOIN ";
+    } else {
+        join_header = "HASH JOIN ";
+    }
+
+    join_header += "(" + std::to_string(join_node->node_id()) + ")";
+    result->emplace_back(MakeShared<String>(join_header));
+
+    // Join type
+    {
+        String join_type_str = String(intent_size, ' ') + " - type: " + JoinReference::ToString(join_node->join_type());
+        result->emplace_back(MakeShared<String>(join_type_str));
+    }
+
+    // Conditions
+    {
+        String condition_str = String(intent_size, ' ') + " - filters: [";
+
+        SizeT conditions_count = join_node->conditions().size();
+        if (conditions_count == 0) {
+            UnrecoverableError("JOIN without any condition.");
+        }
+
+        for (SizeT idx = 0; idx < conditions_count - 1; ++idx) {
+            ExplainLogicalPlan::Explain(join_node->conditions()[idx].get(), condition_str);
+            condition_str += ", ";
+        }
+        ExplainLogicalPlan::Explain(join_node->conditions().back().get(), condition_str);
+        condition_str += "]";
+        result->emplace_back(MakeShared<String>(condition_str));
+    }
+
+    // Output column
+    {
+        String output_columns_str = String(intent_size, ' ') + " - output columns: [";
+        SharedPtr<Vector<String>> output_columns = join_node->GetOutputNames();
+        SizeT column_count = output_columns->size();
+        for (SizeT idx = 0; idx < column_count - 1; ++idx) {
+            output_columns_str += output_columns->at(idx) + ", ";
+        }
+        output_columns_str += output_columns->back() + "]";
+        result->emplace_back(MakeShared<String>(output_columns_str));
+    }
 }
 
-void ExplainPhysicalPlan::Explain(const PhysicalSortMergeJoin *, SharedPtr<Vector<SharedPtr<String>>> &, i64) {
-    UnrecoverableError("Not implement: PhysicalSortMergeJoin");
+void ExplainPhysicalPlan::Explain(const PhysicalSortMergeJoin *join_node, SharedPtr<Vector<SharedPtr<String>>> &result, i64 intent_size) {
+    String join_header;
+    if (intent_size != 0) {
+        join_header = String(intent_size - 2, ' ') + "-> SORT MERGE JOIN ";
+    } else {
+        join_header = "SORT MERGE JOIN ";
+    }
+
+    join_header += "(" + std::to_string(join_node->node_id()) + ")";
+    result->emplace_back(MakeShared<String>(join_header));
+
+    // Join type
+    {
+        String join_type_str = String(intent_size, ' ') + " - type: " + JoinReference::ToString(join_node->join_type());
+        result->emplace_back(MakeShared<String>(join_type_str));
+    }
+
+    // Conditions
+    {
+        String condition_str = String(intent_size, ' ') + " - filters: [";
+
+        SizeT conditions_count = join_node->conditions().size();
+        if (conditions_count == 0) {
+            UnrecoverableError("JOIN without any condition.");
+        }
+
+        for (SizeT idx = 0; idx < conditions_count - 1; ++idx) {
+            ExplainLogicalPlan::Explain(join_node->conditions()[idx].get(), condition_str);
+            condition_str += ", ";
+        }
+        ExplainLogicalPlan::Explain(join_node->conditions().back().get(), condition_str);
+        condition_str += "]";
+        result->emplace_back(MakeShared<String>(condition_str));
+    }
+
+    // Output column
+    {
+        String output_columns_str = String(intent_size, ' ') + " - output columns: [";
+        SharedPtr<Vector<String>> output_columns = join_node->GetOutputNames();
+        SizeT column_count = output_columns->size();
+        for (SizeT idx = 0; idx < column_count - 1; ++idx) {
+            output_columns_str += output_columns->at(idx) + ", ";
+        }
+        output_columns_str += output_columns->back() + "]";
+        result->emplace_back(MakeShared<String>(output_columns_str));
+    }
 }
 
 void ExplainPhysicalPlan::Explain(const PhysicalIndexJoin *, SharedPtr<Vector<SharedPtr<String>>> &, i64) {
@@ -1507,6 +1702,31 @@ void ExplainPhysicalPlan::Explain(const PhysicalImport *import_node, SharedPtr<V
             result->emplace_back(file_type);
             break;
         }
+        case CopyFileType::kBVECS: {
+            SharedPtr<String> file_type = MakeShared<String>(String(intent_size, ' ') + " - type: BVECS");
+            result->emplace_back(file_type);
+            break;
+        }
+        case CopyFileType::kIVECS: {
+            SharedPtr<String> file_type = MakeShared<String>(String(intent_size, ' ') + " - type: IVECS");
+            result->emplace_back(file_type);
+            break;
+        }
+        case CopyFileType::kFBIN: {
+            SharedPtr<String> file_type = MakeShared<String>(String(intent_size, ' ') + " - type: FBIN");
+            result->emplace_back(file_type);
+            break;
+        }
+        case CopyFileType::kPARQUET: {
+            SharedPtr<String> file_type = MakeShared<String>(String(intent_size, ' ') + " - type: PARQUET");
+            result->emplace_back(file_type);
+            break;
+        }
+        case CopyFileType::kARROW: {
+            SharedPtr<String> file_type = MakeShared<String>(String(intent_size, ' ') + " - type: ARROW");
+            result->emplace_back(file_type);
+            break;
+        }
         case CopyFileType::kFVECS: {
             SharedPtr<String> file_type = MakeShared<String>(String(intent_size, ' ') + " - type: FVECS");
             result->emplace_back(file_type);
@@ -1572,6 +1792,31 @@ void ExplainPhysicalPlan::Explain(const PhysicalExport *export_node, SharedPtr<V
             result->emplace_back(file_type);
             break;
         }
+        case CopyFileType::kBVECS: {
+            SharedPtr<String> file_type = MakeShared<String>(String(intent_size, ' ') + " - type: BVECS");
+            result->emplace_back(file_type);
+            break;
+        }
+        case CopyFileType::kIVECS: {
+            SharedPtr<String> file_type = MakeShared<String>(String(intent_size, ' ') + " - type: IVECS");
+            result->emplace_back(file_type);
+            break;
+        }
+        case CopyFileType::kFBIN: {
+            SharedPtr<String> file_type = MakeShared<String>(String(intent_size, ' ') + " - type: FBIN");
+            result->emplace_back(file_type);
+            break;
+        }
+        case CopyFileType::kPARQUET: {
+            SharedPtr<String> file_type = MakeShared<String>(String(intent_size, ' ') + " - type: PARQUET");
+            result->emplace_back(file_type);
+            break;
+        }
+        case CopyFileType::kARROW: {
+            SharedPtr<String> file_type = MakeShared<String>(String(intent_size, ' ') + " - type: ARROW");
+            result->emplace_back(file_type);
+            break;
+        }
         case CopyFileType::kFVECS: {
             SharedPtr<String> file_type = MakeShared<String>(String(intent_size, ' ') + " - type: FVECS");
             result->emplace_back(file_type);
@@ -1736,6 +1981,51 @@ void ExplainPhysicalPlan::Explain(const PhysicalParallelAggregate *parallel_aggr
     }
     explain_header_str += "(" + std::to_string(parallel_aggregate_node->node_id()) + ")";
     result->emplace_back(MakeShared<String>(explain_header_str));
+
+    // Aggregate Table index
+    {
+        String aggregate_table_index =
+            String(intent_size, ' ') + " - aggregate table index: #" + std::to_string(parallel_aggregate_node->AggregateTableIndex());
+        result->emplace_back(MakeShared<String>(aggregate_table_index));
+    }
+
+    // Aggregate expressions
+    {
+        String aggregate_expression_str = String(intent_size, ' ') + " - aggregate: [";
+        SizeT aggregates_count = parallel_aggregate_node->aggregates_.size();
+        for (SizeT idx = 0; idx < aggregates_count; ++idx) {
+            if (idx != 0) {
+                aggregate_expression_str += ", ";
+            }
+            ExplainLogicalPlan::Explain(parallel_aggregate_node->aggregates_[idx].get(), aggregate_expression_str);
+        }
+        aggregate_expression_str += "]";
+        result->emplace_back(MakeShared<String>(aggregate_expression_str));
+    }
+
+    // Group by expressions
+    {
+        String group_table_index =
+            String(intent_size, ' ') + " - group by table index: #" + std::to_string(parallel_aggregate_node->GroupTableIndex());
+        result->emplace_back(MakeShared<String>(group_table_index));
+
+        String group_by_expression_str = String(intent_size, ' ') + " - group by: [";
+        SizeT groups_count = parallel_aggregate_node->groups_.size();
+        for (SizeT idx = 0; idx < groups_count; ++idx) {
+            if (idx != 0) {
+                group_by_expression_str += ", ";
+            }
+            ExplainLogicalPlan::Explain(parallel_aggregate_node->groups_[idx].get(), group_by_expression_str);
+        }
+        group_by_expression_str += "]";
+        result->emplace_back(MakeShared<String>(group_by_expression_str));
+    }
+
+    // Partition count
+    {
+        String partition_count_str = String(intent_size, ' ') + " - partition count: " + std::to_string(parallel_aggregate_node->PartitionCount());
+        result->emplace_back(MakeShared<String>(partition_count_str));
+    }
 }
 
 void ExplainPhysicalPlan::Explain(const PhysicalMergeParallelAggregate *merge_parallel_aggregate_node,
@@ -1750,6 +2040,13 @@ void ExplainPhysicalPlan::Explain(const PhysicalMergeParallelAggregate *merge_pa
     }
     explain_header_str += "(" + std::to_string(merge_parallel_aggregate_node->node_id()) + ")";
     result->emplace_back(MakeShared<String>(explain_header_str));
+
+    // Partition count
+    {
+        String partition_count_str =
+            String(intent_size, ' ') + " - partition count: " + std::to_string(merge_parallel_aggregate_node->PartitionCount());
+        result->emplace_back(MakeShared<String>(partition_count_str));
+    }
 }
 
 void ExplainPhysicalPlan::Explain(const PhysicalIntersect *intersect_node,
@@ -1888,6 +2185,35 @@ void ExplainPhysicalPlan::Explain(const PhysicalMergeSort *merge_sort_node,
     }
     explain_header_str += "(" + std::to_string(merge_sort_node->node_id()) + ")";
     result->emplace_back(MakeShared<String>(explain_header_str));
+
+    {
+        String sort_expression_str = String(intent_size, ' ') + " - sort expressions: [";
+        auto &sort_expressions = merge_sort_node->GetSortExpressions();
+        SizeT order_by_count = sort_expressions.size();
+        if (order_by_count == 0) {
+            UnrecoverableError("MERGE SORT without any sort expression.");
+        }
+        auto &order_by_types = merge_sort_node->GetOrderbyTypes();
+        for (SizeT idx = 0; idx < order_by_count - 1; ++idx) {
+            ExplainLogicalPlan::Explain(sort_expressions[idx].get(), sort_expression_str);
+            sort_expression_str += " " + SelectStatement::ToString(order_by_types[idx]) + ", ";
+        }
+        ExplainLogicalPlan::Explain(sort_expressions.back().get(), sort_expression_str);
+        sort_expression_str += " " + SelectStatement::ToString(order_by_types.back()) + "]";
+        result->emplace_back(MakeShared<String>(sort_expression_str));
+    }
+
+    // Output column
+    {
+        String output_columns_str = String(intent_size, ' ') + " - output columns: [";
+        SharedPtr<Vector<String>> output_columns = merge_sort_node->GetOutputNames();
+        SizeT column_count = output_columns->size();
+        for (SizeT idx = 0; idx < column_count - 1; ++idx) {
+            output_columns_str += output_columns->at(idx) + ", ";
+        }
+        output_columns_str += output_columns->back() + "]";
+        result->emplace_back(MakeShared<String>(output_columns_str));
+    }
 }
 
 void ExplainPhysicalPlan::Explain(const PhysicalMergeKnn *merge_knn_node,
@@ -1921,6 +2247,37 @@ void ExplainPhysicalPlan::Explain(const PhysicalMergeKnn *merge_knn_node,
     result->emplace_back(MakeShared<String>(output_columns));
 }
 
+void ExplainPhysicalPlan::Explain(const PhysicalMergeMatch *merge_match_node, SharedPtr<Vector<SharedPtr<String>>> &result, i64 intent_size) {
+    String explain_header_str;
+    if (intent_size != 0) {
+        explain_header_str = String(intent_size - 2, ' ') + "-> MERGE MATCH ";
+    } else {
+        explain_header_str = "MERGE MATCH ";
+    }
+    explain_header_str += "(" + std::to_string(merge_match_node->node_id()) + ")";
+    result->emplace_back(MakeShared<String>(explain_header_str));
+
+    // Table index
+    String table_index = String(intent_size, ' ') + " - table index: #" + std::to_string(merge_match_node->table_index());
+    result->emplace_back(MakeShared<String>(table_index));
+
+    String top_n = String(intent_size, ' ') + " - top n: " + std::to_string(merge_match_node->top_n());
+    result->emplace_back(MakeShared<String>(top_n));
+
+    // Output columns
+    String output_columns = String(intent_size, ' ') + " - output columns: [";
+    SizeT column_count = merge_match_node->GetOutputNames()->size();
+    if (column_count == 0) {
+        UnrecoverableError("No column in merge match node.");
+    }
+    for (SizeT idx = 0; idx < column_count - 1; ++idx) {
+        output_columns += merge_match_node->GetOutputNames()->at(idx) + ", ";
+    }
+    output_columns += merge_match_node->GetOutputNames()->back();
+    output_columns += "]";
+    result->emplace_back(MakeShared<String>(output_columns));
+}
+
 void ExplainPhysicalPlan::Explain(const PhysicalMatch *match_node, SharedPtr<Vector<SharedPtr<String>>> &result, i64 intent_size) {
     String explain_header_str;
     if (intent_size != 0) {
@@ -1945,6 +2302,14 @@ void ExplainPhysicalPlan::Explain(const PhysicalMatch *match_node, SharedPtr<Vec
     String match_expression = String(intent_size, ' ') + " - match expression: " + match_node->match_expr()->ToString();
     result->emplace_back(MakeShared<String>(match_expression));
 
+    // filter expression
+    BaseExpression *filter_expr = match_node->filter_expression();
+    if (filter_expr != nullptr) {
+        String filter_str = String(intent_size, ' ') + " - filter: ";
+        ExplainLogicalPlan::Explain(filter_expr, filter_str);
+        result->emplace_back(MakeShared<String>(filter_str));
+    }
+
     // Output columns
     String output_columns = String(intent_size, ' ') + " - output columns: [";
     SizeT column_count = match_node->GetOutputNames()->size();
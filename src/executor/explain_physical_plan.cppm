@@ -16,6 +16,7 @@ module;
 
 import stl;
 import physical_operator;
+import profiler;
 import physical_union_all;
 import physical_index_scan;
 import physical_dummy_scan;
@@ -62,6 +63,7 @@ import physical_merge_top;
 import physical_merge_sort;
 import physical_merge_knn;
 import physical_match;
+import physical_merge_match;
 import physical_fusion;
 
 export module explain_physical_plan;
@@ -72,6 +74,12 @@ export class ExplainPhysicalPlan {
 public:
     static void Explain(const PhysicalOperator *op, SharedPtr<Vector<SharedPtr<String>>> &result, bool is_recursive = true, i64 intent_size = 0);
 
+    // The plan of EXPLAIN ANALYZE, each operator is followed by the statistics of its run.
+    static void Explain(const PhysicalOperator *op,
+                        const HashMap<u64, OperatorStatistics> &statistics,
+                        SharedPtr<Vector<SharedPtr<String>>> &result,
+                        i64 intent_size = 0);
+
     static void Explain(const PhysicalUnionAll *create_node, SharedPtr<Vector<SharedPtr<String>>> &result, i64 intent_size = 0);
 
     static void Explain(const PhysicalIndexScan *create_node, SharedPtr<Vector<SharedPtr<String>>> &result, i64 intent_size = 0);
@@ -172,6 +180,8 @@ public:
     static void Explain(const PhysicalMergeKnn *merge_knn_node, SharedPtr<Vector<SharedPtr<String>>> &result, i64 intent_size = 0);
 
     static void Explain(const PhysicalMatch *match_node, SharedPtr<Vector<SharedPtr<String>>> &result, i64 intent_size = 0);
+
+    static void Explain(const PhysicalMergeMatch *merge_match_node, SharedPtr<Vector<SharedPtr<String>>> &result, i64 intent_size = 0);
     static void Explain(const PhysicalFusion *fusion_node, SharedPtr<Vector<SharedPtr<String>>> &result, i64 intent_size = 0);
 };
 
@@ -26,6 +26,7 @@ import function_expression;
 import reference_expression;
 import value_expression;
 import in_expression;
+import in_value_set;
 import data_block;
 import column_vector;
 import expression_state;
@@ -34,13 +35,50 @@ import third_party;
 import infinity_exception;
 import expression_type;
 import bound_cast_func;
+import default_values;
 
 namespace infinity {
 
-void ExpressionEvaluator::Init(const DataBlock *input_data_block) { input_data_block_ = input_data_block; }
+namespace {
+
+atomic_u64 next_evaluation_id{1};
+
+} // namespace
+
+void ExpressionEvaluator::Init(const DataBlock *input_data_block) {
+    input_data_block_ = input_data_block;
+    evaluation_id_ = next_evaluation_id.fetch_add(1);
+    materialized_columns_.clear();
+    if (input_data_block_ != nullptr && input_data_block_->HasSelection()) {
+        materialized_columns_.resize(input_data_block_->column_count());
+    }
+}
 
 void ExpressionEvaluator::Execute(const SharedPtr<BaseExpression> &expr, SharedPtr<ExpressionState> &state, SharedPtr<ColumnVector> &output_column) {
+    if (state->shared_) {
+        return ExecuteShared(expr, state, output_column);
+    }
+    Dispatch(expr, state, output_column);
+}
 
+void ExpressionEvaluator::ExecuteShared(const SharedPtr<BaseExpression> &expr,
+                                        SharedPtr<ExpressionState> &state,
+                                        SharedPtr<ColumnVector> &output_column_vector) {
+    SharedPtr<ColumnVector> &state_output = state->OutputColumnVector();
+    if (evaluation_id_ == 0 || state->evaluation_id_ != evaluation_id_) {
+        if (state->evaluation_id_ != 0) {
+            // The output of another evaluation may still be referenced by its result
+            auto column_vector = MakeShared<ColumnVector>(state_output->data_type());
+            column_vector->Initialize(state_output->vector_type(), DEFAULT_VECTOR_SIZE);
+            state_output = std::move(column_vector);
+        }
+        Dispatch(expr, state, state_output);
+        state->evaluation_id_ = evaluation_id_;
+    }
+    output_column_vector = state_output;
+}
+
+void ExpressionEvaluator::Dispatch(const SharedPtr<BaseExpression> &expr, SharedPtr<ExpressionState> &state, SharedPtr<ColumnVector> &output_column) {
     switch (expr->type()) {
         case ExpressionType::kAggregate:
             return Execute(std::static_pointer_cast<AggregateExpression>(expr), state, output_column);
@@ -166,11 +204,30 @@ void ExpressionEvaluator::Execute(const SharedPtr<ReferenceExpression> &expr,
         UnrecoverableError("Invalid column index");
     }
 
+    if (input_data_block_->HasSelection()) {
+        SharedPtr<ColumnVector> &materialized_column = materialized_columns_[column_index];
+        if (materialized_column.get() == nullptr) {
+            materialized_column = input_data_block_->MaterializeColumn(column_index);
+        }
+        output_column_vector = materialized_column;
+        return;
+    }
     output_column_vector = input_data_block_->column_vectors[column_index];
 }
 
-void ExpressionEvaluator::Execute(const SharedPtr<InExpression> &, SharedPtr<ExpressionState> &, SharedPtr<ColumnVector> &) {
-    RecoverableError(Status::NotSupport("IN execution isn't implemented yet."));
+void ExpressionEvaluator::Execute(const SharedPtr<InExpression> &expr,
+                                  SharedPtr<ExpressionState> &state,
+                                  SharedPtr<ColumnVector> &output_column_vector) {
+    const InValueSet *value_set = state->in_value_set_.get();
+    if (value_set == nullptr) {
+        RecoverableError(Status::NotSupport(fmt::format("IN of {} with a list of non-constant values isn't supported yet.",
+                                                        expr->left_operand()->Type().ToString())));
+    }
+    SharedPtr<ExpressionState> &left_state = state->Children()[0];
+    SharedPtr<ColumnVector> &left_output = left_state->OutputColumnVector();
+    Execute(expr->left_operand(), left_state, left_output);
+
+    value_set->Execute(left_output, left_output->Size(), expr->in_type() == InType::kNotIn, *output_column_vector);
 }
 
 } // namespace infinity
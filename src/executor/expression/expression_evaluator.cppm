@@ -55,7 +55,16 @@ public:
     void Execute(const SharedPtr<InExpression> &expr, SharedPtr<ExpressionState> &state, SharedPtr<ColumnVector> &output_column_vector);
 
 private:
+    void Dispatch(const SharedPtr<BaseExpression> &expr, SharedPtr<ExpressionState> &state, SharedPtr<ColumnVector> &output_column_vector);
+
+    // The output of a shared state is computed once per evaluation, the other occurrences of the subexpression take it
+    void ExecuteShared(const SharedPtr<BaseExpression> &expr, SharedPtr<ExpressionState> &state, SharedPtr<ColumnVector> &output_column_vector);
+
     const DataBlock *input_data_block_{};
+    // Identifies the input of Init, 0 until Init is called
+    u64 evaluation_id_{0};
+    // Dense copies of the referenced columns when the input block has a selection, each column is copied once.
+    Vector<SharedPtr<ColumnVector>> materialized_columns_{};
     bool in_aggregate_{false};
 };
 
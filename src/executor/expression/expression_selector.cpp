@@ -29,6 +29,8 @@ import expression_evaluator;
 import internal_types;
 import third_party;
 import data_type;
+import function_expression;
+import expression_type;
 
 import infinity_exception;
 
@@ -40,6 +42,7 @@ SizeT ExpressionSelector::Select(const SharedPtr<BaseExpression> &expr,
                                  DataBlock *output_data_block,
                                  SizeT count) {
     this->input_data_ = input_data_block;
+    evaluator_.Init(input_data_block);
     SharedPtr<Selection> input_select = nullptr;
     SharedPtr<Selection> output_true_select = MakeShared<Selection>();
     output_true_select->Initialize(count);
@@ -53,6 +56,19 @@ SizeT ExpressionSelector::Select(const SharedPtr<BaseExpression> &expr,
     return output_true_select->Size();
 }
 
+SharedPtr<Selection>
+ExpressionSelector::Select(const SharedPtr<BaseExpression> &expr, SharedPtr<ExpressionState> &state, const DataBlock *input_data_block, SizeT count) {
+    this->input_data_ = input_data_block;
+    evaluator_.Init(input_data_block);
+    SharedPtr<Selection> input_select = nullptr;
+    SharedPtr<Selection> output_true_select = MakeShared<Selection>();
+    output_true_select->Initialize(count);
+    SharedPtr<Selection> output_false_select = nullptr;
+
+    Select(expr, state, count, input_select, output_true_select, output_false_select);
+    return output_true_select;
+}
+
 void ExpressionSelector::Select(const SharedPtr<BaseExpression> &expr,
                                 SharedPtr<ExpressionState> &state,
                                 SizeT count,
@@ -75,16 +91,60 @@ void ExpressionSelector::Select(const SharedPtr<BaseExpression> &expr,
                                 SharedPtr<ExpressionState> &state,
                                 SizeT count,
                                 SharedPtr<Selection> &output_true_select) {
+    if (input_data_ != nullptr && expr->type() == ExpressionType::kFunction &&
+        static_cast<const FunctionExpression *>(expr.get())->ScalarFunctionName() == "AND") {
+        return SelectAnd(expr, state, count, output_true_select);
+    }
     SharedPtr<ColumnVector> bool_column = MakeShared<ColumnVector>(MakeShared<DataType>(LogicalType::kBoolean));
     bool_column->Initialize(ColumnVectorType::kCompactBit);
 
-    ExpressionEvaluator expr_evaluator;
-    expr_evaluator.Init(input_data_);
-    expr_evaluator.Execute(expr, state, bool_column);
+    evaluator_.Execute(expr, state, bool_column);
 
     Select(bool_column, count, output_true_select, true);
 }
 
+void ExpressionSelector::SelectAnd(const SharedPtr<BaseExpression> &expr,
+                                   SharedPtr<ExpressionState> &state,
+                                   SizeT count,
+                                   SharedPtr<Selection> &output_true_select) {
+    // The right conjunct is only evaluated on the rows selected by the left one, ConjunctReorder puts the cheap and selective
+    // conjuncts first.
+    SharedPtr<Selection> left_select = MakeShared<Selection>();
+    left_select->Initialize(count);
+    Select(expr->arguments()[0], state->Children()[0], count, left_select);
+    SizeT left_count = left_select->Size();
+    if (left_count == 0) {
+        return;
+    }
+    if (left_count == count) {
+        return Select(expr->arguments()[1], state->Children()[1], count, output_true_select);
+    }
+
+    // The selected rows as a view of the dense columns of the input
+    SharedPtr<Selection> view_select = left_select;
+    if (input_data_->HasSelection()) {
+        const Selection &input_select = *input_data_->selection();
+        view_select = MakeShared<Selection>();
+        view_select->Initialize(left_count);
+        for (SizeT idx = 0; idx < left_count; ++idx) {
+            view_select->Append(input_select.Get(left_select->Get(idx)));
+        }
+    }
+    DataBlock view_data_block;
+    view_data_block.InitWithSelection(input_data_->column_vectors, std::move(view_select));
+
+    ExpressionSelector right_selector;
+    right_selector.input_data_ = &view_data_block;
+    right_selector.evaluator_.Init(&view_data_block);
+    SharedPtr<Selection> right_select = MakeShared<Selection>();
+    right_select->Initialize(left_count);
+    right_selector.Select(expr->arguments()[1], state->Children()[1], left_count, right_select);
+    SizeT right_count = right_select->Size();
+    for (SizeT idx = 0; idx < right_count; ++idx) {
+        output_true_select->Append(left_select->Get(right_select->Get(idx)));
+    }
+}
+
 void ExpressionSelector::Select(const SharedPtr<ColumnVector> &bool_column, SizeT count, SharedPtr<Selection> &output_true_select, bool nullable) {
     if (bool_column->vector_type() != ColumnVectorType::kCompactBit || bool_column->data_type()->type() != LogicalType::kBoolean) {
         UnrecoverableError("Attempting to select non-boolean expression");
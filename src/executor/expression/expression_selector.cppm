@@ -20,6 +20,7 @@ import expression_state;
 import data_block;
 import selection;
 import bitmask;
+import expression_evaluator;
 
 export module expression_selector;
 
@@ -34,6 +35,9 @@ public:
                  DataBlock *output_data_block,
                  SizeT count);
 
+    // Rows of the input data block where the expression is true, the input isn't copied.
+    SharedPtr<Selection> Select(const SharedPtr<BaseExpression> &expr, SharedPtr<ExpressionState> &state, const DataBlock *input_data_block, SizeT count);
+
     void Select(const SharedPtr<BaseExpression> &expr,
                 SharedPtr<ExpressionState> &state,
                 SizeT count,
@@ -46,7 +50,12 @@ public:
     static void Select(const SharedPtr<ColumnVector> &bool_column, SizeT count, SharedPtr<Selection> &output_true_select, bool nullable);
 
 private:
+    // "a AND b" is selected in two steps, b on the rows selected by a
+    void SelectAnd(const SharedPtr<BaseExpression> &expr, SharedPtr<ExpressionState> &state, SizeT count, SharedPtr<Selection> &output_true_select);
+
     const DataBlock *input_data_{nullptr};
+    // One evaluator for the whole input, the shared subexpressions of the conjuncts are computed once
+    ExpressionEvaluator evaluator_{};
 };
 
 } // namespace infinity
@@ -33,6 +33,8 @@ import function_expression;
 import in_expression;
 import reference_expression;
 import value_expression;
+import value;
+import in_value_set;
 import status;
 
 import default_values;
@@ -69,7 +71,8 @@ SharedPtr<ExpressionState> ExpressionState::CreateState(const SharedPtr<BaseExpr
 }
 
 SharedPtr<ExpressionState> ExpressionState::CreateState(const SharedPtr<AggregateExpression> &agg_expr, char *agg_state) {
-    if (agg_expr->arguments().size() != 1) {
+    // The arguments after the first one are constant parameters bound into the function, e.g. the fraction of APPROX_PERCENTILE.
+    if (agg_expr->arguments().empty()) {
         RecoverableError(Status::FunctionArgsError(agg_expr->ToString()));
     }
 
@@ -116,6 +119,7 @@ SharedPtr<ExpressionState> ExpressionState::CreateState(const SharedPtr<CastExpr
 
     SharedPtr<ExpressionState> result = MakeShared<ExpressionState>();
     result->AddChild(cast_expr->arguments()[0]);
+    result->reusable_output_ = true;
 
 
     ColumnVectorType result_column_vector_type = ColumnVectorType::kFlat;
@@ -142,6 +146,7 @@ SharedPtr<ExpressionState> ExpressionState::CreateState(const SharedPtr<Function
     for (auto &arg : function_expr->arguments()) {
         result->AddChild(arg);
     }
+    result->reusable_output_ = true;
 
     //    Vector<ColumnVectorType> result_column_vector_type(block_count, ColumnVectorType::kConstant);
     //
@@ -194,21 +199,166 @@ SharedPtr<ExpressionState> ExpressionState::CreateState(const SharedPtr<InExpres
     for (auto &argument_expr : in_expr->arguments()) {
         result->AddChild(argument_expr);
     }
+    result->reusable_output_ = true;
 
     ColumnVectorType result_column_vector_type = ColumnVectorType::kConstant;
     for (SizeT idx = 0; idx < result->Children().size(); ++idx) {
         if (result->Children()[idx]->OutputColumnVector()->vector_type() != ColumnVectorType::kConstant) {
-            result_column_vector_type = ColumnVectorType::kFlat;
+            result_column_vector_type = ColumnVectorType::kCompactBit;
             break;
         }
     }
 
+    // The set of the constants is built once here, not for each block
+    Vector<Value> values;
+    values.reserve(in_expr->arguments().size());
+    for (auto &argument_expr : in_expr->arguments()) {
+        if (argument_expr->type() != ExpressionType::kValue) {
+            break;
+        }
+        values.push_back(static_cast<const ValueExpression *>(argument_expr.get())->GetValue());
+    }
+    if (values.size() == in_expr->arguments().size()) {
+        result->in_value_set_ = InValueSet::Make(in_expr->left_operand()->Type(), values);
+    }
+
     result->column_vector_ = MakeShared<ColumnVector>(in_expr_data_type);
     result->column_vector_->Initialize(result_column_vector_type, DEFAULT_VECTOR_SIZE);
 
     return result;
 }
 
+namespace {
+
+// The expressions the children of the state were created for, in order
+Vector<SharedPtr<BaseExpression>> ChildExpressions(const SharedPtr<BaseExpression> &expression) {
+    switch (expression->type()) {
+        case ExpressionType::kAggregate:
+        case ExpressionType::kCast:
+        case ExpressionType::kFunction: {
+            return expression->arguments();
+        }
+        case ExpressionType::kIn: {
+            Vector<SharedPtr<BaseExpression>> children{static_cast<const InExpression &>(*expression).left_operand()};
+            children.insert(children.end(), expression->arguments().begin(), expression->arguments().end());
+            return children;
+        }
+        default: {
+            return {};
+        }
+    }
+}
+
+void ShareSubexpressions(const SharedPtr<BaseExpression> &expression,
+                         SharedPtr<ExpressionState> &state,
+                         HashMap<String, SharedPtr<ExpressionState>> &states) {
+    ExpressionType type = expression->type();
+    // A constant output is cheap to compute, and is left to each occurrence
+    bool constant = state->OutputColumnVector() && state->OutputColumnVector()->vector_type() == ColumnVectorType::kConstant;
+    if (!constant && (type == ExpressionType::kCast || type == ExpressionType::kFunction || type == ExpressionType::kIn)) {
+        String key = ExpressionState::SubexpressionKey(expression);
+        if (!key.empty()) {
+            auto [iter, inserted] = states.emplace(std::move(key), state);
+            if (!inserted) {
+                // Evaluated by the first occurrence, its children aren't needed any more
+                iter->second->shared_ = true;
+                state = iter->second;
+                return;
+            }
+        }
+    }
+    Vector<SharedPtr<BaseExpression>> children = ChildExpressions(expression);
+    Vector<SharedPtr<ExpressionState>> &child_states = state->Children();
+    for (SizeT idx = 0; idx < children.size() && idx < child_states.size(); ++idx) {
+        ShareSubexpressions(children[idx], child_states[idx], states);
+    }
+}
+
+} // namespace
+
+String ExpressionState::SubexpressionKey(const SharedPtr<BaseExpression> &expression) {
+    switch (expression->type()) {
+        case ExpressionType::kReference: {
+            return fmt::format("#{}:{}", static_cast<const ReferenceExpression &>(*expression).column_index(), expression->Type().ToString());
+        }
+        case ExpressionType::kValue: {
+            switch (expression->Type().type()) {
+                case LogicalType::kBoolean:
+                case LogicalType::kTinyInt:
+                case LogicalType::kSmallInt:
+                case LogicalType::kInteger:
+                case LogicalType::kBigInt:
+                case LogicalType::kFloat:
+                case LogicalType::kDouble:
+                case LogicalType::kDate:
+                case LogicalType::kTime:
+                case LogicalType::kDateTime:
+                case LogicalType::kTimestamp:
+                case LogicalType::kInterval:
+                case LogicalType::kVarchar: {
+                    return fmt::format("{}:'{}'", expression->Type().ToString(), expression->ToString());
+                }
+                default: {
+                    return {};
+                }
+            }
+        }
+        case ExpressionType::kCast:
+        case ExpressionType::kFunction:
+        case ExpressionType::kIn: {
+            String key;
+            if (expression->type() == ExpressionType::kCast) {
+                key = fmt::format("CAST AS {}(", expression->Type().ToString());
+            } else if (expression->type() == ExpressionType::kFunction) {
+                key = fmt::format("{}:{}(", static_cast<const FunctionExpression &>(*expression).ScalarFunctionName(), expression->Type().ToString());
+            } else {
+                const auto &in_expr = static_cast<const InExpression &>(*expression);
+                String operand_key = SubexpressionKey(in_expr.left_operand());
+                if (operand_key.empty()) {
+                    return {};
+                }
+                key = fmt::format("{}({},", in_expr.in_type() == InType::kNotIn ? "NOT IN" : "IN", operand_key);
+            }
+            for (const auto &argument : expression->arguments()) {
+                String argument_key = SubexpressionKey(argument);
+                if (argument_key.empty()) {
+                    return {};
+                }
+                key += argument_key;
+                key += ',';
+            }
+            key += ')';
+            return key;
+        }
+        default: {
+            return {};
+        }
+    }
+}
+
+Vector<SharedPtr<ExpressionState>> ExpressionState::CreateStates(const Vector<SharedPtr<BaseExpression>> &expressions) {
+    Vector<SharedPtr<ExpressionState>> expression_states;
+    expression_states.reserve(expressions.size());
+    HashMap<String, SharedPtr<ExpressionState>> states;
+    for (const auto &expression : expressions) {
+        expression_states.emplace_back(CreateState(expression));
+        ShareSubexpressions(expression, expression_states.back(), states);
+    }
+    return expression_states;
+}
+
 void ExpressionState::AddChild(const SharedPtr<BaseExpression> &expression) { children_.emplace_back(CreateState(expression)); }
 
+void ExpressionState::ResetOutputs() {
+    // The output of a shared state may be held by the result of the last input, the evaluator replaces it
+    if (reusable_output_ && !shared_ && column_vector_.get() != nullptr && column_vector_->initialized) {
+        ColumnVectorType vector_type = column_vector_->vector_type();
+        column_vector_->Reset();
+        column_vector_->Initialize(vector_type, DEFAULT_VECTOR_SIZE);
+    }
+    for (auto &child : children_) {
+        child->ResetOutputs();
+    }
+}
+
 } // namespace infinity
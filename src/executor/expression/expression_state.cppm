@@ -24,6 +24,7 @@ import function_expression;
 import value_expression;
 import in_expression;
 import column_vector;
+import in_value_set;
 
 export module expression_state;
 
@@ -48,15 +49,36 @@ public:
 
     static SharedPtr<ExpressionState> CreateState(const SharedPtr<InExpression> &in_expr);
 
+    // The states of the expressions of one operator. The equal function, cast and IN subexpressions share one state, which is
+    // evaluated once per evaluation of the operator.
+    static Vector<SharedPtr<ExpressionState>> CreateStates(const Vector<SharedPtr<BaseExpression>> &expressions);
+
+    // The same key for structurally equal expressions, empty if the expression has a part which isn't keyed
+    static String SubexpressionKey(const SharedPtr<BaseExpression> &expression);
+
 public:
     void AddChild(const SharedPtr<BaseExpression> &expression);
 
+    // Empties the intermediate outputs of the state tree for the next input, their buffers are kept
+    void ResetOutputs();
+
     Vector<SharedPtr<ExpressionState>> &Children() { return children_; }
 
     SharedPtr<ColumnVector> &OutputColumnVector() { return column_vector_; }
 
     char *agg_state_{};
 
+    // The constants of an IN expression, null if the list isn't constant or x has no value set
+    UniquePtr<InValueSet> in_value_set_{};
+
+    // The state belongs to more than one occurrence of the subexpression, its output is kept for the evaluator which computed it
+    bool shared_{false};
+    // ExpressionEvaluator::evaluation_id_ of the evaluator which computed the output of a shared state, 0 if none did
+    u64 evaluation_id_{0};
+
+    // The output is an intermediate result owned by the state, and not handed to the caller
+    bool reusable_output_{false};
+
 private:
     Vector<SharedPtr<ExpressionState>> children_;
     String name_;
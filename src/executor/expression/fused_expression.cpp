@@ -0,0 +1,667 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <cmath>
+#include <limits>
+
+module fused_expression;
+
+import stl;
+import base_expression;
+import cast_expression;
+import function_expression;
+import reference_expression;
+import value_expression;
+import expression_type;
+import expression_state;
+import data_block;
+import column_vector;
+import selection;
+import value;
+import logical_type;
+import internal_types;
+import data_type;
+
+namespace infinity {
+
+namespace {
+
+// Rows of a batch, the registers of a program on a batch stay in the cache
+constexpr SizeT kFusedBatchSize = 256;
+
+// The cache keeps the failed compilations too, and is emptied when full
+constexpr SizeT kFusedExpressionCacheCapacity = 1024;
+
+enum class RegisterKind {
+    kInteger,
+    kDouble,
+    // a float input, which is only compared or cast to double: float arithmetic isn't computed as double
+    kFloat,
+    kBoolean,
+};
+
+struct CompiledRegister {
+    u32 register_idx_{};
+    RegisterKind kind_{};
+    // of an integer
+    u32 integer_size_{};
+};
+
+u32 IntegerSize(LogicalType type) {
+    switch (type) {
+        case LogicalType::kTinyInt:
+            return 1;
+        case LogicalType::kSmallInt:
+            return 2;
+        case LogicalType::kInteger:
+            return 4;
+        case LogicalType::kBigInt:
+            return 8;
+        default:
+            return 0;
+    }
+}
+
+class FusedCompiler {
+public:
+    explicit FusedCompiler(Vector<FusedInstruction> &instructions) : instructions_(instructions) {}
+
+    Optional<CompiledRegister> Compile(const SharedPtr<BaseExpression> &expression) {
+        switch (expression->type()) {
+            case ExpressionType::kReference: {
+                return CompileReference(static_cast<const ReferenceExpression &>(*expression));
+            }
+            case ExpressionType::kValue: {
+                return CompileValue(static_cast<const ValueExpression &>(*expression));
+            }
+            case ExpressionType::kCast: {
+                return CompileCast(expression);
+            }
+            case ExpressionType::kFunction: {
+                return CompileFunction(expression);
+            }
+            default: {
+                return None;
+            }
+        }
+    }
+
+    SizeT register_count() const { return register_count_; }
+
+private:
+    CompiledRegister Emit(FusedInstruction instruction, RegisterKind kind, u32 integer_size = 0) {
+        instruction.result_ = register_count_++;
+        instructions_.push_back(instruction);
+        return CompiledRegister{instruction.result_, kind, integer_size};
+    }
+
+    Optional<CompiledRegister> CompileReference(const ReferenceExpression &reference) {
+        FusedInstruction instruction;
+        instruction.column_idx_ = reference.column_index();
+        LogicalType type = reference.Type().type();
+        if (u32 integer_size = IntegerSize(type); integer_size != 0) {
+            instruction.op_code_ = FusedOpCode::kLoadInteger;
+            instruction.integer_size_ = integer_size;
+            return Emit(instruction, RegisterKind::kInteger, integer_size);
+        }
+        if (type == LogicalType::kDouble) {
+            instruction.op_code_ = FusedOpCode::kLoadDouble;
+            return Emit(instruction, RegisterKind::kDouble);
+        }
+        if (type == LogicalType::kFloat) {
+            instruction.op_code_ = FusedOpCode::kLoadFloat;
+            return Emit(instruction, RegisterKind::kFloat);
+        }
+        return None;
+    }
+
+    Optional<CompiledRegister> CompileValue(const ValueExpression &value_expression) {
+        const Value &value = value_expression.GetValue();
+        FusedInstruction instruction;
+        switch (value.type().type()) {
+            case LogicalType::kTinyInt: {
+                instruction.integer_constant_ = value.GetValue<TinyIntT>();
+                break;
+            }
+            case LogicalType::kSmallInt: {
+                instruction.integer_constant_ = value.GetValue<SmallIntT>();
+                break;
+            }
+            case LogicalType::kInteger: {
+                instruction.integer_constant_ = value.GetValue<IntegerT>();
+                break;
+            }
+            case LogicalType::kBigInt: {
+                instruction.integer_constant_ = value.GetValue<BigIntT>();
+                break;
+            }
+            case LogicalType::kFloat: {
+                instruction.op_code_ = FusedOpCode::kConstantDouble;
+                instruction.double_constant_ = value.GetValue<FloatT>();
+                return Emit(instruction, RegisterKind::kFloat);
+            }
+            case LogicalType::kDouble: {
+                instruction.op_code_ = FusedOpCode::kConstantDouble;
+                instruction.double_constant_ = value.GetValue<DoubleT>();
+                return Emit(instruction, RegisterKind::kDouble);
+            }
+            default: {
+                return None;
+            }
+        }
+        instruction.op_code_ = FusedOpCode::kConstantInteger;
+        u32 integer_size = IntegerSize(value.type().type());
+        return Emit(instruction, RegisterKind::kInteger, integer_size);
+    }
+
+    Optional<CompiledRegister> CompileCast(const SharedPtr<BaseExpression> &cast_expression) {
+        Optional<CompiledRegister> argument = Compile(cast_expression->arguments()[0]);
+        if (!argument.has_value()) {
+            return None;
+        }
+        LogicalType target_type = cast_expression->Type().type();
+        if (target_type == LogicalType::kDouble) {
+            if (argument->kind_ == RegisterKind::kFloat || argument->kind_ == RegisterKind::kDouble) {
+                return CompiledRegister{argument->register_idx_, RegisterKind::kDouble, 0};
+            }
+            if (argument->kind_ == RegisterKind::kInteger) {
+                FusedInstruction instruction;
+                instruction.op_code_ = FusedOpCode::kIntegerToDouble;
+                instruction.left_ = argument->register_idx_;
+                return Emit(instruction, RegisterKind::kDouble);
+            }
+            return None;
+        }
+        // a wider integer holds every value
+        u32 target_size = IntegerSize(target_type);
+        if (target_size != 0 && argument->kind_ == RegisterKind::kInteger && argument->integer_size_ <= target_size) {
+            return CompiledRegister{argument->register_idx_, RegisterKind::kInteger, target_size};
+        }
+        return None;
+    }
+
+    Optional<CompiledRegister> CompileFunction(const SharedPtr<BaseExpression> &function_expression) {
+        const String &name = static_cast<const FunctionExpression &>(*function_expression).ScalarFunctionName();
+        const auto &arguments = function_expression->arguments();
+        Vector<CompiledRegister> operands;
+        for (const auto &argument : arguments) {
+            Optional<CompiledRegister> operand = Compile(argument);
+            if (!operand.has_value()) {
+                return None;
+            }
+            operands.push_back(*operand);
+        }
+
+        FusedInstruction instruction;
+        instruction.left_ = operands.empty() ? 0 : operands[0].register_idx_;
+        instruction.right_ = operands.size() < 2 ? 0 : operands[1].register_idx_;
+        if (operands.size() == 1) {
+            const CompiledRegister &operand = operands[0];
+            if (name == "NOT" && operand.kind_ == RegisterKind::kBoolean) {
+                instruction.op_code_ = FusedOpCode::kNot;
+                return Emit(instruction, RegisterKind::kBoolean);
+            }
+            if (name == "+" && (operand.kind_ == RegisterKind::kInteger || operand.kind_ == RegisterKind::kDouble)) {
+                return operand;
+            }
+            if (name == "-" && operand.kind_ == RegisterKind::kInteger) {
+                instruction.op_code_ = FusedOpCode::kNegateInteger;
+                instruction.integer_size_ = operand.integer_size_;
+                return Emit(instruction, RegisterKind::kInteger, operand.integer_size_);
+            }
+            if (name == "-" && operand.kind_ == RegisterKind::kDouble) {
+                instruction.op_code_ = FusedOpCode::kNegateDouble;
+                return Emit(instruction, RegisterKind::kDouble);
+            }
+            return None;
+        }
+        if (operands.size() != 2 || operands[0].kind_ != operands[1].kind_) {
+            return None;
+        }
+
+        RegisterKind kind = operands[0].kind_;
+        if (kind == RegisterKind::kBoolean) {
+            if (name == "AND") {
+                instruction.op_code_ = FusedOpCode::kAnd;
+            } else if (name == "OR") {
+                instruction.op_code_ = FusedOpCode::kOr;
+            } else {
+                return None;
+            }
+            return Emit(instruction, RegisterKind::kBoolean);
+        }
+
+        bool is_integer = kind == RegisterKind::kInteger;
+        static const HashMap<String, Pair<FusedOpCode, FusedOpCode>> comparisons = {
+            {"=", {FusedOpCode::kEqualsInteger, FusedOpCode::kEqualsDouble}},
+            {"<>", {FusedOpCode::kNotEqualsInteger, FusedOpCode::kNotEqualsDouble}},
+            {"<", {FusedOpCode::kLessInteger, FusedOpCode::kLessDouble}},
+            {"<=", {FusedOpCode::kLessEqualsInteger, FusedOpCode::kLessEqualsDouble}},
+            {">", {FusedOpCode::kGreaterInteger, FusedOpCode::kGreaterDouble}},
+            {">=", {FusedOpCode::kGreaterEqualsInteger, FusedOpCode::kGreaterEqualsDouble}},
+        };
+        if (auto iter = comparisons.find(name); iter != comparisons.end()) {
+            instruction.op_code_ = is_integer ? iter->second.first : iter->second.second;
+            return Emit(instruction, RegisterKind::kBoolean);
+        }
+
+        static const HashMap<String, Pair<FusedOpCode, FusedOpCode>> arithmetics = {
+            {"+", {FusedOpCode::kAddInteger, FusedOpCode::kAddDouble}},
+            {"-", {FusedOpCode::kSubtractInteger, FusedOpCode::kSubtractDouble}},
+            {"*", {FusedOpCode::kMultiplyInteger, FusedOpCode::kMultiplyDouble}},
+        };
+        auto iter = arithmetics.find(name);
+        if (iter == arithmetics.end() || kind == RegisterKind::kFloat) {
+            return None;
+        }
+        if (!is_integer) {
+            instruction.op_code_ = iter->second.second;
+            return Emit(instruction, RegisterKind::kDouble);
+        }
+        // the integer result has the type of the function, which is checked for overflow
+        u32 result_size = IntegerSize(function_expression->Type().type());
+        if (result_size == 0) {
+            return None;
+        }
+        instruction.op_code_ = iter->second.first;
+        instruction.integer_size_ = result_size;
+        return Emit(instruction, RegisterKind::kInteger, result_size);
+    }
+
+    Vector<FusedInstruction> &instructions_;
+    u32 register_count_{};
+};
+
+template <typename T>
+void LoadInteger(const ColumnVector &column_vector, SizeT offset, SizeT count, i64 *result) {
+    const T *data = reinterpret_cast<const T *>(column_vector.data());
+    if (column_vector.vector_type() == ColumnVectorType::kConstant) {
+        std::fill_n(result, count, static_cast<i64>(data[0]));
+        return;
+    }
+    for (SizeT idx = 0; idx < count; ++idx) {
+        result[idx] = data[offset + idx];
+    }
+}
+
+template <typename T>
+void LoadDouble(const ColumnVector &column_vector, SizeT offset, SizeT count, f64 *result) {
+    const T *data = reinterpret_cast<const T *>(column_vector.data());
+    if (column_vector.vector_type() == ColumnVectorType::kConstant) {
+        std::fill_n(result, count, static_cast<f64>(data[0]));
+        return;
+    }
+    for (SizeT idx = 0; idx < count; ++idx) {
+        result[idx] = data[offset + idx];
+    }
+}
+
+// Whether the integer fits the integer type of the size
+bool IntegerInRange(i64 value, u32 integer_size) {
+    switch (integer_size) {
+        case 1:
+            return value >= std::numeric_limits<i8>::min() && value <= std::numeric_limits<i8>::max();
+        case 2:
+            return value >= std::numeric_limits<i16>::min() && value <= std::numeric_limits<i16>::max();
+        case 4:
+            return value >= std::numeric_limits<i32>::min() && value <= std::numeric_limits<i32>::max();
+        default:
+            return true;
+    }
+}
+
+} // namespace
+
+SharedPtr<FusedExpression> FusedExpression::Get(const SharedPtr<BaseExpression> &expression) {
+    String key = ExpressionState::SubexpressionKey(expression);
+    if (key.empty()) {
+        return nullptr;
+    }
+    static std::mutex mutex;
+    static HashMap<String, SharedPtr<FusedExpression>> cache;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (auto iter = cache.find(key); iter != cache.end()) {
+            return iter->second;
+        }
+    }
+    SharedPtr<FusedExpression> fused_expression = Compile(expression);
+    std::lock_guard<std::mutex> lock(mutex);
+    if (cache.size() >= kFusedExpressionCacheCapacity) {
+        cache.clear();
+    }
+    cache.emplace(std::move(key), fused_expression);
+    return fused_expression;
+}
+
+SharedPtr<FusedExpression> FusedExpression::Compile(const SharedPtr<BaseExpression> &expression) {
+    auto fused_expression = MakeShared<FusedExpression>();
+    FusedCompiler compiler(fused_expression->instructions_);
+    Optional<CompiledRegister> result = compiler.Compile(expression);
+    // A lone column or constant gains nothing from a program
+    if (!result.has_value() || result->kind_ == RegisterKind::kFloat || fused_expression->instructions_.size() < 2) {
+        return nullptr;
+    }
+    fused_expression->register_count_ = compiler.register_count();
+    fused_expression->result_register_ = result->register_idx_;
+    fused_expression->result_is_boolean_ = result->kind_ == RegisterKind::kBoolean;
+    fused_expression->result_is_double_ = result->kind_ == RegisterKind::kDouble;
+    fused_expression->result_integer_size_ = result->integer_size_;
+    return fused_expression;
+}
+
+bool FusedExpression::Run(const DataBlock &input_data_block, SizeT offset, SizeT count, Vector<i64> &integers, Vector<f64> &doubles) const {
+    bool failed = false;
+    for (const FusedInstruction &instruction : instructions_) {
+        i64 *result = integers.data() + instruction.result_ * kFusedBatchSize;
+        f64 *double_result = doubles.data() + instruction.result_ * kFusedBatchSize;
+        const i64 *left = integers.data() + instruction.left_ * kFusedBatchSize;
+        const i64 *right = integers.data() + instruction.right_ * kFusedBatchSize;
+        const f64 *double_left = doubles.data() + instruction.left_ * kFusedBatchSize;
+        const f64 *double_right = doubles.data() + instruction.right_ * kFusedBatchSize;
+        switch (instruction.op_code_) {
+            case FusedOpCode::kLoadInteger: {
+                const ColumnVector &column_vector = *input_data_block.column_vectors[instruction.column_idx_];
+                switch (instruction.integer_size_) {
+                    case 1: {
+                        LoadInteger<TinyIntT>(column_vector, offset, count, result);
+                        break;
+                    }
+                    case 2: {
+                        LoadInteger<SmallIntT>(column_vector, offset, count, result);
+                        break;
+                    }
+                    case 4: {
+                        LoadInteger<IntegerT>(column_vector, offset, count, result);
+                        break;
+                    }
+                    default: {
+                        LoadInteger<BigIntT>(column_vector, offset, count, result);
+                        break;
+                    }
+                }
+                break;
+            }
+            case FusedOpCode::kLoadDouble: {
+                LoadDouble<DoubleT>(*input_data_block.column_vectors[instruction.column_idx_], offset, count, double_result);
+                break;
+            }
+            case FusedOpCode::kLoadFloat: {
+                LoadDouble<FloatT>(*input_data_block.column_vectors[instruction.column_idx_], offset, count, double_result);
+                break;
+            }
+            case FusedOpCode::kConstantInteger: {
+                std::fill_n(result, count, instruction.integer_constant_);
+                break;
+            }
+            case FusedOpCode::kConstantDouble: {
+                std::fill_n(double_result, count, instruction.double_constant_);
+                break;
+            }
+            case FusedOpCode::kIntegerToDouble: {
+                for (SizeT idx = 0; idx < count; ++idx) {
+                    double_result[idx] = static_cast<f64>(left[idx]);
+                }
+                break;
+            }
+            case FusedOpCode::kAddInteger:
+            case FusedOpCode::kSubtractInteger:
+            case FusedOpCode::kMultiplyInteger: {
+                bool overflow = false;
+                for (SizeT idx = 0; idx < count; ++idx) {
+                    if (instruction.op_code_ == FusedOpCode::kAddInteger) {
+                        overflow |= __builtin_add_overflow(left[idx], right[idx], &result[idx]);
+                    } else if (instruction.op_code_ == FusedOpCode::kSubtractInteger) {
+                        overflow |= __builtin_sub_overflow(left[idx], right[idx], &result[idx]);
+                    } else {
+                        overflow |= __builtin_mul_overflow(left[idx], right[idx], &result[idx]);
+                    }
+                    overflow |= !IntegerInRange(result[idx], instruction.integer_size_);
+                }
+                failed |= overflow;
+                break;
+            }
+            case FusedOpCode::kNegateInteger: {
+                bool overflow = false;
+                for (SizeT idx = 0; idx < count; ++idx) {
+                    // the minimum of the type has no negation in it
+                    overflow |= __builtin_sub_overflow(i64(0), left[idx], &result[idx]);
+                    overflow |= !IntegerInRange(result[idx], instruction.integer_size_);
+                }
+                failed |= overflow;
+                break;
+            }
+            case FusedOpCode::kAddDouble:
+            case FusedOpCode::kSubtractDouble:
+            case FusedOpCode::kMultiplyDouble: {
+                bool not_finite = false;
+                for (SizeT idx = 0; idx < count; ++idx) {
+                    if (instruction.op_code_ == FusedOpCode::kAddDouble) {
+                        double_result[idx] = double_left[idx] + double_right[idx];
+                    } else if (instruction.op_code_ == FusedOpCode::kSubtractDouble) {
+                        double_result[idx] = double_left[idx] - double_right[idx];
+                    } else {
+                        double_result[idx] = double_left[idx] * double_right[idx];
+                    }
+                    not_finite |= !std::isfinite(double_result[idx]);
+                }
+                failed |= not_finite;
+                break;
+            }
+            case FusedOpCode::kNegateDouble: {
+                bool not_finite = false;
+                for (SizeT idx = 0; idx < count; ++idx) {
+                    not_finite |= !std::isfinite(double_left[idx]);
+                    double_result[idx] = -double_left[idx];
+                }
+                failed |= not_finite;
+                break;
+            }
+            case FusedOpCode::kEqualsInteger: {
+                for (SizeT idx = 0; idx < count; ++idx) {
+                    result[idx] = left[idx] == right[idx];
+                }
+                break;
+            }
+            case FusedOpCode::kNotEqualsInteger: {
+                for (SizeT idx = 0; idx < count; ++idx) {
+                    result[idx] = left[idx] != right[idx];
+                }
+                break;
+            }
+            case FusedOpCode::kLessInteger: {
+                for (SizeT idx = 0; idx < count; ++idx) {
+                    result[idx] = left[idx] < right[idx];
+                }
+                break;
+            }
+            case FusedOpCode::kLessEqualsInteger: {
+                for (SizeT idx = 0; idx < count; ++idx) {
+                    result[idx] = left[idx] <= right[idx];
+                }
+                break;
+            }
+            case FusedOpCode::kGreaterInteger: {
+                for (SizeT idx = 0; idx < count; ++idx) {
+                    result[idx] = left[idx] > right[idx];
+                }
+                break;
+            }
+            case FusedOpCode::kGreaterEqualsInteger: {
+                for (SizeT idx = 0; idx < count; ++idx) {
+                    result[idx] = left[idx] >= right[idx];
+                }
+                break;
+            }
+            case FusedOpCode::kEqualsDouble: {
+                for (SizeT idx = 0; idx < count; ++idx) {
+                    result[idx] = double_left[idx] == double_right[idx];
+                }
+                break;
+            }
+            case FusedOpCode::kNotEqualsDouble: {
+                for (SizeT idx = 0; idx < count; ++idx) {
+                    result[idx] = double_left[idx] != double_right[idx];
+                }
+                break;
+            }
+            case FusedOpCode::kLessDouble: {
+                for (SizeT idx = 0; idx < count; ++idx) {
+                    result[idx] = double_left[idx] < double_right[idx];
+                }
+                break;
+            }
+            case FusedOpCode::kLessEqualsDouble: {
+                for (SizeT idx = 0; idx < count; ++idx) {
+                    result[idx] = double_left[idx] <= double_right[idx];
+                }
+                break;
+            }
+            case FusedOpCode::kGreaterDouble: {
+                for (SizeT idx = 0; idx < count; ++idx) {
+                    result[idx] = double_left[idx] > double_right[idx];
+                }
+                break;
+            }
+            case FusedOpCode::kGreaterEqualsDouble: {
+                for (SizeT idx = 0; idx < count; ++idx) {
+                    result[idx] = double_left[idx] >= double_right[idx];
+                }
+                break;
+            }
+            case FusedOpCode::kAnd: {
+                for (SizeT idx = 0; idx < count; ++idx) {
+                    result[idx] = left[idx] & right[idx];
+                }
+                break;
+            }
+            case FusedOpCode::kOr: {
+                for (SizeT idx = 0; idx < count; ++idx) {
+                    result[idx] = left[idx] | right[idx];
+                }
+                break;
+            }
+            case FusedOpCode::kNot: {
+                for (SizeT idx = 0; idx < count; ++idx) {
+                    result[idx] = left[idx] ^ 1;
+                }
+                break;
+            }
+        }
+        if (failed) {
+            return false;
+        }
+    }
+    return true;
+}
+
+namespace {
+
+// The program reads the values of the loaded columns directly, the rows of a null must go to the interpreter
+bool CanRun(const Vector<FusedInstruction> &instructions, const DataBlock &input_data_block) {
+    if (input_data_block.HasSelection()) {
+        return false;
+    }
+    for (const FusedInstruction &instruction : instructions) {
+        if (instruction.op_code_ != FusedOpCode::kLoadInteger && instruction.op_code_ != FusedOpCode::kLoadDouble &&
+            instruction.op_code_ != FusedOpCode::kLoadFloat) {
+            continue;
+        }
+        const ColumnVector &column_vector = *input_data_block.column_vectors[instruction.column_idx_];
+        if (column_vector.vector_type() != ColumnVectorType::kFlat && column_vector.vector_type() != ColumnVectorType::kConstant) {
+            return false;
+        }
+        if (!column_vector.nulls_ptr_->IsAllTrue()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+bool FusedExpression::Execute(const DataBlock &input_data_block, ColumnVector &output_column_vector) const {
+    if (result_is_boolean_ || !CanRun(instructions_, input_data_block)) {
+        return false;
+    }
+    SizeT row_count = input_data_block.row_count();
+    Vector<i64> integers(register_count_ * kFusedBatchSize);
+    Vector<f64> doubles(register_count_ * kFusedBatchSize);
+    ptr_t output = output_column_vector.data();
+    for (SizeT offset = 0; offset < row_count; offset += kFusedBatchSize) {
+        SizeT count = std::min(kFusedBatchSize, row_count - offset);
+        if (!Run(input_data_block, offset, count, integers, doubles)) {
+            return false;
+        }
+        if (result_is_double_) {
+            const f64 *result = doubles.data() + result_register_ * kFusedBatchSize;
+            std::copy_n(result, count, reinterpret_cast<DoubleT *>(output) + offset);
+            continue;
+        }
+        const i64 *result = integers.data() + result_register_ * kFusedBatchSize;
+        switch (result_integer_size_) {
+            case 1: {
+                std::copy_n(result, count, reinterpret_cast<TinyIntT *>(output) + offset);
+                break;
+            }
+            case 2: {
+                std::copy_n(result, count, reinterpret_cast<SmallIntT *>(output) + offset);
+                break;
+            }
+            case 4: {
+                std::copy_n(result, count, reinterpret_cast<IntegerT *>(output) + offset);
+                break;
+            }
+            default: {
+                std::copy_n(result, count, reinterpret_cast<BigIntT *>(output) + offset);
+                break;
+            }
+        }
+    }
+    output_column_vector.nulls_ptr_->SetAllTrue();
+    output_column_vector.Finalize(row_count);
+    return true;
+}
+
+bool FusedExpression::Select(const DataBlock &input_data_block, Selection &output_true_select) const {
+    if (!result_is_boolean_ || !CanRun(instructions_, input_data_block)) {
+        return false;
+    }
+    SizeT row_count = input_data_block.row_count();
+    Vector<i64> integers(register_count_ * kFusedBatchSize);
+    Vector<f64> doubles(register_count_ * kFusedBatchSize);
+    // The rows are only appended once the whole block ran, a failed batch leaves the selection empty for the interpreter
+    Vector<u32> selected_rows;
+    selected_rows.reserve(row_count);
+    for (SizeT offset = 0; offset < row_count; offset += kFusedBatchSize) {
+        SizeT count = std::min(kFusedBatchSize, row_count - offset);
+        if (!Run(input_data_block, offset, count, integers, doubles)) {
+            return false;
+        }
+        const i64 *result = integers.data() + result_register_ * kFusedBatchSize;
+        for (SizeT idx = 0; idx < count; ++idx) {
+            if (result[idx]) {
+                selected_rows.push_back(offset + idx);
+            }
+        }
+    }
+    for (u32 row_idx : selected_rows) {
+        output_true_select.Append(row_idx);
+    }
+    return true;
+}
+
+} // namespace infinity
@@ -0,0 +1,109 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module fused_expression;
+
+import stl;
+import base_expression;
+import data_block;
+import column_vector;
+import selection;
+
+namespace infinity {
+
+enum class FusedOpCode : u8 {
+    kLoadInteger,
+    kLoadDouble,
+    kLoadFloat,
+    kConstantInteger,
+    kConstantDouble,
+    kIntegerToDouble,
+    kAddInteger,
+    kSubtractInteger,
+    kMultiplyInteger,
+    kNegateInteger,
+    kAddDouble,
+    kSubtractDouble,
+    kMultiplyDouble,
+    kNegateDouble,
+    kEqualsInteger,
+    kNotEqualsInteger,
+    kLessInteger,
+    kLessEqualsInteger,
+    kGreaterInteger,
+    kGreaterEqualsInteger,
+    kEqualsDouble,
+    kNotEqualsDouble,
+    kLessDouble,
+    kLessEqualsDouble,
+    kGreaterDouble,
+    kGreaterEqualsDouble,
+    kAnd,
+    kOr,
+    kNot,
+};
+
+// One step of the program, it computes a register of the batch from the registers of its operands
+struct FusedInstruction {
+    FusedOpCode op_code_{};
+    u32 result_{};
+    u32 left_{};
+    u32 right_{};
+    // the input column of a load
+    SizeT column_idx_{};
+    // the size in bytes of the integer of a load, or of the result of an integer arithmetic
+    u32 integer_size_{};
+    i64 integer_constant_{};
+    f64 double_constant_{};
+};
+
+// A filter or projection expression over the numeric columns of the input, compiled into a flat program. The program runs on
+// batches of rows which stay in the cache: each instruction is one tight loop over the batch, there is no ColumnVector for the
+// subexpressions and no dispatch on the expression type. Integers are computed as i64 and doubles as f64, booleans as bytes.
+//
+// The program has the result of the interpreter or none: a null input, an integer overflow or a double which isn't finite makes
+// Execute and Select return false, and the block is evaluated by ExpressionEvaluator.
+export class FusedExpression {
+public:
+    // The program of the expression, shared by the operators with the same expression. Null if the expression has a part the
+    // program can't compute.
+    static SharedPtr<FusedExpression> Get(const SharedPtr<BaseExpression> &expression);
+
+    // Null if the expression has a part the program can't compute
+    static SharedPtr<FusedExpression> Compile(const SharedPtr<BaseExpression> &expression);
+
+    // The values of a numeric expression on the rows of the dense input, into the output which is initialized as flat.
+    bool Execute(const DataBlock &input_data_block, ColumnVector &output_column_vector) const;
+
+    // The rows of the dense input where the boolean expression is true.
+    bool Select(const DataBlock &input_data_block, Selection &output_true_select) const;
+
+    [[nodiscard]] bool IsBoolean() const { return result_is_boolean_; }
+
+private:
+    // Runs the program on rows [offset, offset + count) of the input. False if the result of the block would have a null.
+    bool Run(const DataBlock &input_data_block, SizeT offset, SizeT count, Vector<i64> &integers, Vector<f64> &doubles) const;
+
+    Vector<FusedInstruction> instructions_{};
+    SizeT register_count_{};
+    u32 result_register_{};
+    bool result_is_boolean_{false};
+    bool result_is_double_{false};
+    // of an integer result
+    u32 result_integer_size_{};
+};
+
+} // namespace infinity
@@ -0,0 +1,292 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <type_traits>
+
+module in_value_set;
+
+import stl;
+import third_party;
+import value;
+import data_type;
+import logical_type;
+import internal_types;
+import column_vector;
+import vector_buffer;
+import bitmask;
+import status;
+import infinity_exception;
+
+namespace infinity {
+
+namespace {
+
+// The values of an integer x are kept in its own type, the constants that no value of x equals are left out. The values of a
+// float x are kept as doubles, as "=" compares them.
+template <typename T, typename KeyT>
+class NumericInValueSet final : public InValueSet {
+public:
+    NumericInValueSet(Vector<KeyT> keys, bool has_null) : InValueSet(has_null), keys_(std::move(keys)) {
+        std::sort(keys_.begin(), keys_.end());
+        keys_.erase(std::unique(keys_.begin(), keys_.end()), keys_.end());
+        if (keys_.size() > SMALL_LIST_SIZE) {
+            for (KeyT key : keys_) {
+                key_set_.insert(Normalize(key));
+            }
+        }
+    }
+
+protected:
+    void Probe(const SharedPtr<ColumnVector> &input, SizeT count, VectorBuffer &hits) const final {
+        const auto *data = reinterpret_cast<const T *>(input->data());
+        if (keys_.size() <= SMALL_LIST_SIZE) {
+            const KeyT *keys = keys_.data();
+            SizeT key_count = keys_.size();
+            for (SizeT i = 0; i < count; ++i) {
+                auto value = static_cast<KeyT>(data[i]);
+                bool hit = false;
+                for (SizeT k = 0; k < key_count; ++k) {
+                    hit |= value == keys[k];
+                }
+                hits.SetCompactBit(i, hit);
+            }
+        } else {
+            for (SizeT i = 0; i < count; ++i) {
+                hits.SetCompactBit(i, key_set_.contains(Normalize(static_cast<KeyT>(data[i]))));
+            }
+        }
+    }
+
+private:
+    // -0.0 equals 0.0 but doesn't hash the same
+    static KeyT Normalize(KeyT key) {
+        if constexpr (std::is_floating_point_v<KeyT>) {
+            return key + KeyT{};
+        } else {
+            return key;
+        }
+    }
+
+    Vector<KeyT> keys_{};
+    FlatHashSet<KeyT> key_set_{};
+};
+
+class VarcharInValueSet final : public InValueSet {
+public:
+    VarcharInValueSet(Vector<String> keys, bool has_null)
+        : InValueSet(has_null), keys_(std::make_move_iterator(keys.begin()), std::make_move_iterator(keys.end())) {}
+
+protected:
+    void Probe(const SharedPtr<ColumnVector> &input, SizeT count, VectorBuffer &hits) const final {
+        ColumnValueReader<VarcharT> reader(input);
+        const Bitmask &nulls = *input->nulls_ptr_;
+        bool all_valid = nulls.IsAllTrue();
+        String buffer;
+        for (SizeT i = 0; i < count; ++i) {
+            if (!all_valid && !nulls.IsTrue(i)) {
+                continue;
+            }
+            reader[i].GetString(buffer);
+            hits.SetCompactBit(i, keys_.contains(buffer));
+        }
+    }
+
+private:
+    HashSet<String> keys_{};
+};
+
+template <typename T>
+UniquePtr<InValueSet> MakeIntegerSet(const Vector<Value> &values, bool has_null) {
+    Vector<T> keys;
+    keys.reserve(values.size());
+    for (const Value &value : values) {
+        switch (value.type().type()) {
+            case LogicalType::kNull: {
+                break;
+            }
+            case LogicalType::kTinyInt:
+            case LogicalType::kSmallInt:
+            case LogicalType::kInteger:
+            case LogicalType::kBigInt: {
+                i64 key = 0;
+                switch (value.type().type()) {
+                    case LogicalType::kTinyInt: {
+                        key = value.GetValue<TinyIntT>();
+                        break;
+                    }
+                    case LogicalType::kSmallInt: {
+                        key = value.GetValue<SmallIntT>();
+                        break;
+                    }
+                    case LogicalType::kInteger: {
+                        key = value.GetValue<IntegerT>();
+                        break;
+                    }
+                    default: {
+                        key = value.GetValue<BigIntT>();
+                    }
+                }
+                if (key >= std::numeric_limits<T>::min() && key <= std::numeric_limits<T>::max()) {
+                    keys.push_back(static_cast<T>(key));
+                }
+                break;
+            }
+            case LogicalType::kFloat:
+            case LogicalType::kDouble: {
+                DoubleT key = value.type().type() == LogicalType::kFloat ? value.GetValue<FloatT>() : value.GetValue<DoubleT>();
+                // only a whole number in the range of T equals a value of T
+                if (std::trunc(key) == key && key >= static_cast<DoubleT>(std::numeric_limits<T>::min()) &&
+                    key < -static_cast<DoubleT>(std::numeric_limits<T>::min())) {
+                    keys.push_back(static_cast<T>(key));
+                }
+                break;
+            }
+            default: {
+                RecoverableError(Status::DataTypeMismatch(value.type().ToString(), DataType(LogicalType::kBigInt).ToString()));
+            }
+        }
+    }
+    return MakeUnique<NumericInValueSet<T, T>>(std::move(keys), has_null);
+}
+
+template <typename T>
+UniquePtr<InValueSet> MakeFloatSet(const Vector<Value> &values, bool has_null) {
+    Vector<DoubleT> keys;
+    keys.reserve(values.size());
+    for (const Value &value : values) {
+        switch (value.type().type()) {
+            case LogicalType::kNull: {
+                break;
+            }
+            case LogicalType::kTinyInt: {
+                keys.push_back(value.GetValue<TinyIntT>());
+                break;
+            }
+            case LogicalType::kSmallInt: {
+                keys.push_back(value.GetValue<SmallIntT>());
+                break;
+            }
+            case LogicalType::kInteger: {
+                keys.push_back(value.GetValue<IntegerT>());
+                break;
+            }
+            case LogicalType::kBigInt: {
+                keys.push_back(static_cast<DoubleT>(value.GetValue<BigIntT>()));
+                break;
+            }
+            case LogicalType::kFloat: {
+                keys.push_back(value.GetValue<FloatT>());
+                break;
+            }
+            case LogicalType::kDouble: {
+                keys.push_back(value.GetValue<DoubleT>());
+                break;
+            }
+            default: {
+                RecoverableError(Status::DataTypeMismatch(value.type().ToString(), DataType(LogicalType::kDouble).ToString()));
+            }
+        }
+    }
+    return MakeUnique<NumericInValueSet<T, DoubleT>>(std::move(keys), has_null);
+}
+
+UniquePtr<InValueSet> MakeVarcharSet(const Vector<Value> &values, bool has_null) {
+    Vector<String> keys;
+    keys.reserve(values.size());
+    for (const Value &value : values) {
+        if (value.type().type() == LogicalType::kNull) {
+            continue;
+        }
+        if (value.type().type() != LogicalType::kVarchar) {
+            RecoverableError(Status::DataTypeMismatch(value.type().ToString(), DataType(LogicalType::kVarchar).ToString()));
+        }
+        keys.push_back(value.GetVarchar());
+    }
+    return MakeUnique<VarcharInValueSet>(std::move(keys), has_null);
+}
+
+} // namespace
+
+UniquePtr<InValueSet> InValueSet::Make(const DataType &left_type, const Vector<Value> &values) {
+    bool has_null = std::any_of(values.begin(), values.end(), [](const Value &value) { return value.type().type() == LogicalType::kNull; });
+    switch (left_type.type()) {
+        case LogicalType::kTinyInt: {
+            return MakeIntegerSet<TinyIntT>(values, has_null);
+        }
+        case LogicalType::kSmallInt: {
+            return MakeIntegerSet<SmallIntT>(values, has_null);
+        }
+        case LogicalType::kInteger: {
+            return MakeIntegerSet<IntegerT>(values, has_null);
+        }
+        case LogicalType::kBigInt: {
+            return MakeIntegerSet<BigIntT>(values, has_null);
+        }
+        case LogicalType::kFloat: {
+            return MakeFloatSet<FloatT>(values, has_null);
+        }
+        case LogicalType::kDouble: {
+            return MakeFloatSet<DoubleT>(values, has_null);
+        }
+        case LogicalType::kVarchar: {
+            return MakeVarcharSet(values, has_null);
+        }
+        default: {
+            return nullptr;
+        }
+    }
+}
+
+void InValueSet::Execute(const SharedPtr<ColumnVector> &input, SizeT count, bool not_in, ColumnVector &result) const {
+    VectorBuffer &hits = *result.buffer_;
+    if (input->vector_type() == ColumnVectorType::kDictionary) {
+        // each distinct value is looked up once
+        const SharedPtr<ColumnVector> &dictionary = input->dictionary();
+        SizeT dictionary_size = dictionary->Size();
+        ColumnVector dictionary_hits(MakeShared<DataType>(LogicalType::kBoolean));
+        dictionary_hits.Initialize(ColumnVectorType::kCompactBit, std::max<SizeT>(dictionary_size, 1));
+        Probe(dictionary, dictionary_size, *dictionary_hits.buffer_);
+        const u32 *codes = input->dictionary_codes();
+        for (SizeT i = 0; i < count; ++i) {
+            hits.SetCompactBit(i, dictionary_hits.buffer_->GetCompactBit(codes[i]));
+        }
+    } else {
+        Probe(input, count, hits);
+    }
+
+    Bitmask &result_nulls = *result.nulls_ptr_;
+    result_nulls.DeepCopy(*input->nulls_ptr_);
+    if (has_null_ || not_in) {
+        for (SizeT i = 0; i < count; ++i) {
+            if (!result_nulls.IsTrue(i)) {
+                continue;
+            }
+            bool hit = hits.GetCompactBit(i);
+            if (!hit && has_null_) {
+                // "x IN (..., NULL)" is unknown unless x is in the list
+                result_nulls.SetFalse(i);
+            } else if (not_in) {
+                hits.SetCompactBit(i, !hit);
+            }
+        }
+    }
+    result.Finalize(count);
+}
+
+} // namespace infinity
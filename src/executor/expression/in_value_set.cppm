@@ -0,0 +1,53 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module in_value_set;
+
+import stl;
+import value;
+import data_type;
+import column_vector;
+import vector_buffer;
+
+namespace infinity {
+
+// The constants of "x IN (...)", converted once to the type of x. A short list is compared with every value in a loop without
+// branches, which the compiler turns into SIMD compares, a long list is a flat hash set.
+export class InValueSet {
+public:
+    // Lists up to this size are compared one by one
+    static constexpr SizeT SMALL_LIST_SIZE = 16;
+
+    // Null if x isn't of a type with a value set: integers, floats and varchars.
+    static UniquePtr<InValueSet> Make(const DataType &left_type, const Vector<Value> &values);
+
+    virtual ~InValueSet() = default;
+
+    // The result of IN, or of NOT IN, for the count rows of the input. A null input is null, so is a value not in the set when
+    // the list has a null.
+    void Execute(const SharedPtr<ColumnVector> &input, SizeT count, bool not_in, ColumnVector &result) const;
+
+protected:
+    explicit InValueSet(bool has_null) : has_null_(has_null) {}
+
+    // Sets the bit of each row of the kFlat or kConstant input to whether its value is in the set, the null rows are skipped
+    virtual void Probe(const SharedPtr<ColumnVector> &input, SizeT count, VectorBuffer &hits) const = 0;
+
+private:
+    const bool has_null_;
+};
+
+} // namespace infinity
@@ -26,6 +26,7 @@ import physical_sink;
 import query_context;
 import internal_types;
 import data_type;
+import join_runtime_filter;
 
 namespace infinity {
 
@@ -70,6 +71,20 @@ public:
 
     inline bool HasChild() { return !children_.empty(); }
 
+    // The build fragment of a hash join with a runtime filter publishes it and starts the probe fragment once it completes.
+    inline void SetRuntimeFilter(SharedPtr<JoinRuntimeFilter> runtime_filter, PlanFragment *probe_fragment) {
+        runtime_filter_ = std::move(runtime_filter);
+        probe_fragment_ = probe_fragment;
+        probe_fragment->wait_runtime_filter_ = true;
+    }
+
+    [[nodiscard]] inline JoinRuntimeFilter *GetRuntimeFilter() const { return runtime_filter_.get(); }
+
+    [[nodiscard]] inline PlanFragment *GetProbeFragment() const { return probe_fragment_; }
+
+    // not started with the other leaf fragments
+    [[nodiscard]] inline bool WaitRuntimeFilter() const { return wait_runtime_filter_; }
+
     SharedPtr<Vector<String>> ToString();
 
     [[nodiscard]] inline u64 FragmentID() const { return fragment_id_; }
@@ -96,6 +111,10 @@ private:
     UniquePtr<FragmentContext> context_{};
 
     FragmentType fragment_type_{FragmentType::kSerialMaterialize};
+
+    SharedPtr<JoinRuntimeFilter> runtime_filter_{};
+    PlanFragment *probe_fragment_{};
+    bool wait_runtime_filter_{false};
 };
 
 } // namespace infinity
@@ -24,6 +24,8 @@ import physical_sink;
 import physical_source;
 import physical_explain;
 import physical_knn_scan;
+import physical_aggregate;
+import physical_hash_join;
 import status;
 import infinity_exception;
 
@@ -50,9 +52,8 @@ void FragmentBuilder::BuildExplain(PhysicalOperator *phys_op, PlanFragment *curr
     PhysicalExplain *explain_op = (PhysicalExplain *)phys_op;
     switch (explain_op->explain_type()) {
 
-        case ExplainType::kAnalyze: {
-            RecoverableError(Status::NotSupport("Not implement: Query analyze"));
-        }
+        case ExplainType::kAnalyze:
+            // The query context ran the child plan already and set the texts with its statistics.
         case ExplainType::kAst:
         case ExplainType::kUnOpt:
         case ExplainType::kOpt:
@@ -85,6 +86,23 @@ void FragmentBuilder::BuildExplain(PhysicalOperator *phys_op, PlanFragment *curr
     }
 }
 
+void FragmentBuilder::BuildUnionAllInputs(PhysicalOperator *phys_op, PlanFragment *union_fragment_ptr) {
+    if (phys_op->left() == nullptr or phys_op->right() == nullptr) {
+        UnrecoverableError(fmt::format("{} should have two inputs.", phys_op->GetName()));
+    }
+    Vector<PhysicalOperator *> input_ops{phys_op->left(), phys_op->right()};
+    for (PhysicalOperator *input_op : input_ops) {
+        if (input_op->operator_type() == PhysicalOperatorType::kUnionAll) {
+            BuildUnionAllInputs(input_op, union_fragment_ptr);
+            continue;
+        }
+        auto next_plan_fragment = MakeUnique<PlanFragment>(GetFragmentId());
+        next_plan_fragment->SetSinkNode(query_context_ptr_, SinkType::kLocalQueue, input_op->GetOutputNames(), input_op->GetOutputTypes());
+        BuildFragments(input_op, next_plan_fragment.get());
+        union_fragment_ptr->AddChild(std::move(next_plan_fragment));
+    }
+}
+
 void FragmentBuilder::BuildFragments(PhysicalOperator *phys_op, PlanFragment *current_fragment_ptr) {
     switch (phys_op->operator_type()) {
         case PhysicalOperatorType::kInvalid: {
@@ -111,9 +129,7 @@ void FragmentBuilder::BuildFragments(PhysicalOperator *phys_op, PlanFragment *cu
         case PhysicalOperatorType::kFlush:
         case PhysicalOperatorType::kOptimize:
         case PhysicalOperatorType::kInsert:
-        case PhysicalOperatorType::kImport:
-        case PhysicalOperatorType::kExport:
-        case PhysicalOperatorType::kMatch: {
+        case PhysicalOperatorType::kImport: {
             current_fragment_ptr->AddOperator(phys_op);
             if (phys_op->left() != nullptr or phys_op->right() != nullptr) {
                 UnrecoverableError(fmt::format("{} shouldn't have child.", phys_op->GetName()));
@@ -122,14 +138,59 @@ void FragmentBuilder::BuildFragments(PhysicalOperator *phys_op, PlanFragment *cu
             current_fragment_ptr->SetSourceNode(query_context_ptr_, SourceType::kEmpty, phys_op->GetOutputNames(), phys_op->GetOutputTypes());
             return;
         }
+        case PhysicalOperatorType::kMatch: {
+            current_fragment_ptr->AddOperator(phys_op);
+            if (phys_op->left() != nullptr or phys_op->right() != nullptr) {
+                UnrecoverableError(fmt::format("{} shouldn't have child.", phys_op->GetName()));
+            }
+            // A match on more than one segment is under a merge match, which is planned by the physical planner.
+            if (phys_op->TaskletCount() <= 1) {
+                current_fragment_ptr->SetFragmentType(FragmentType::kSerialMaterialize);
+            } else {
+                current_fragment_ptr->SetFragmentType(FragmentType::kParallelMaterialize);
+            }
+            current_fragment_ptr->SetSourceNode(query_context_ptr_, SourceType::kEmpty, phys_op->GetOutputNames(), phys_op->GetOutputTypes());
+            return;
+        }
         case PhysicalOperatorType::kAggregate: {
             current_fragment_ptr->AddOperator(phys_op);
             if (phys_op->left() == nullptr) {
                 UnrecoverableError("No input node of aggregate operator");
-            } else {
+            }
+            if (static_cast<PhysicalAggregate *>(phys_op)->groups_.empty()) {
                 current_fragment_ptr->SetFragmentType(FragmentType::kParallelMaterialize);
                 BuildFragments(phys_op->left(), current_fragment_ptr);
+                return;
+            }
+
+            // Group by aggregate builds one hash table on all input, the input is sent by the child fragment.
+            current_fragment_ptr->SetSourceNode(query_context_ptr_, SourceType::kLocalQueue, phys_op->GetOutputNames(), phys_op->GetOutputTypes());
+            current_fragment_ptr->SetFragmentType(FragmentType::kSerialMaterialize);
+            auto next_plan_fragment = MakeUnique<PlanFragment>(GetFragmentId());
+            next_plan_fragment->SetSinkNode(query_context_ptr_,
+                                            SinkType::kLocalQueue,
+                                            phys_op->left()->GetOutputNames(),
+                                            phys_op->left()->GetOutputTypes());
+            BuildFragments(phys_op->left(), next_plan_fragment.get());
+            current_fragment_ptr->AddChild(std::move(next_plan_fragment));
+            return;
+        }
+        case PhysicalOperatorType::kMergeParallelAggregate: {
+            // Each task merges one partition of the partial results, which are sent by the parallel aggregate in the child fragment.
+            current_fragment_ptr->AddOperator(phys_op);
+            current_fragment_ptr->SetSourceNode(query_context_ptr_, SourceType::kLocalQueue, phys_op->GetOutputNames(), phys_op->GetOutputTypes());
+            if (phys_op->left() == nullptr) {
+                UnrecoverableError(fmt::format("No input node of {}", phys_op->GetName()));
             }
+            current_fragment_ptr->SetFragmentType(FragmentType::kParallelMaterialize);
+
+            auto next_plan_fragment = MakeUnique<PlanFragment>(GetFragmentId());
+            next_plan_fragment->SetSinkNode(query_context_ptr_,
+                                            SinkType::kLocalQueue,
+                                            phys_op->left()->GetOutputNames(),
+                                            phys_op->left()->GetOutputTypes());
+            BuildFragments(phys_op->left(), next_plan_fragment.get());
+            current_fragment_ptr->AddChild(std::move(next_plan_fragment));
             return;
         }
         case PhysicalOperatorType::kParallelAggregate:
@@ -164,13 +225,34 @@ void FragmentBuilder::BuildFragments(PhysicalOperator *phys_op, PlanFragment *cu
             current_fragment_ptr->SetFragmentType(FragmentType::kSerialMaterialize);
             break;
         }
+        case PhysicalOperatorType::kMergeSort: {
+            current_fragment_ptr->AddOperator(phys_op);
+            current_fragment_ptr->SetSourceNode(query_context_ptr_, SourceType::kLocalQueue, phys_op->GetOutputNames(), phys_op->GetOutputTypes());
+            if (phys_op->left() == nullptr) {
+                UnrecoverableError(fmt::format("No input node of {}", phys_op->GetName()));
+            }
+            current_fragment_ptr->SetFragmentType(FragmentType::kSerialMaterialize);
+
+            auto next_plan_fragment = MakeUnique<PlanFragment>(GetFragmentId());
+            next_plan_fragment->SetSinkNode(query_context_ptr_,
+                                            SinkType::kLocalQueue,
+                                            phys_op->left()->GetOutputNames(),
+                                            phys_op->left()->GetOutputTypes());
+            BuildFragments(phys_op->left(), next_plan_fragment.get());
+            // Each task of the child fragment sorts the blocks of its scan range into one sorted run.
+            next_plan_fragment->SetFragmentType(FragmentType::kParallelMaterialize);
+            current_fragment_ptr->AddChild(std::move(next_plan_fragment));
+            return;
+        }
         case PhysicalOperatorType::kFusion:
+        case PhysicalOperatorType::kJoinHash:
+        case PhysicalOperatorType::kJoinMerge:
         case PhysicalOperatorType::kMergeAggregate:
         case PhysicalOperatorType::kMergeHash:
         case PhysicalOperatorType::kMergeLimit:
         case PhysicalOperatorType::kMergeTop:
-        case PhysicalOperatorType::kMergeSort:
-        case PhysicalOperatorType::kMergeKnn: {
+        case PhysicalOperatorType::kMergeKnn:
+        case PhysicalOperatorType::kMergeMatch: {
             current_fragment_ptr->AddOperator(phys_op);
             current_fragment_ptr->SetSourceNode(query_context_ptr_, SourceType::kLocalQueue, phys_op->GetOutputNames(), phys_op->GetOutputTypes());
             if (phys_op->left() == nullptr) {
@@ -184,6 +266,7 @@ void FragmentBuilder::BuildFragments(PhysicalOperator *phys_op, PlanFragment *cu
                                             phys_op->left()->GetOutputNames(),
                                             phys_op->left()->GetOutputTypes());
             BuildFragments(phys_op->left(), next_plan_fragment.get());
+            PlanFragment *left_fragment_ptr = next_plan_fragment.get();
             current_fragment_ptr->AddChild(std::move(next_plan_fragment));
             if (phys_op->right() != nullptr) {
                 auto next_plan_fragment = MakeUnique<PlanFragment>(GetFragmentId());
@@ -192,17 +275,30 @@ void FragmentBuilder::BuildFragments(PhysicalOperator *phys_op, PlanFragment *cu
                                                 phys_op->right()->GetOutputNames(),
                                                 phys_op->right()->GetOutputTypes());
                 BuildFragments(phys_op->right(), next_plan_fragment.get());
+                if (phys_op->operator_type() == PhysicalOperatorType::kJoinHash) {
+                    // the build fragment collects the keys of the runtime filter, the probe fragment waits for it
+                    const auto &runtime_filter = static_cast<PhysicalHashJoin *>(phys_op)->runtime_filter();
+                    if (runtime_filter.get() != nullptr) {
+                        next_plan_fragment->GetSinkNode()->SetRuntimeFilter(runtime_filter);
+                        next_plan_fragment->SetRuntimeFilter(runtime_filter, left_fragment_ptr);
+                    }
+                }
                 current_fragment_ptr->AddChild(std::move(next_plan_fragment));
             }
             return;
         }
-        case PhysicalOperatorType::kUnionAll:
+        case PhysicalOperatorType::kUnionAll: {
+            current_fragment_ptr->AddOperator(phys_op);
+            current_fragment_ptr->SetSourceNode(query_context_ptr_, SourceType::kLocalQueue, phys_op->GetOutputNames(), phys_op->GetOutputTypes());
+            // The child fragments run concurrently, their blocks are passed through as soon as an input task completes.
+            current_fragment_ptr->SetFragmentType(FragmentType::kParallelStream);
+            BuildUnionAllInputs(phys_op, current_fragment_ptr);
+            return;
+        }
         case PhysicalOperatorType::kIntersect:
         case PhysicalOperatorType::kExcept:
         case PhysicalOperatorType::kDummyScan:
-        case PhysicalOperatorType::kJoinHash:
         case PhysicalOperatorType::kJoinNestedLoop:
-        case PhysicalOperatorType::kJoinMerge:
         case PhysicalOperatorType::kJoinIndex:
         case PhysicalOperatorType::kCrossProduct: {
             UnrecoverableError(fmt::format("Not support {}.", phys_op->GetName()));
@@ -245,6 +341,16 @@ void FragmentBuilder::BuildFragments(PhysicalOperator *phys_op, PlanFragment *cu
             }
             return;
         }
+        case PhysicalOperatorType::kExport: {
+            // Each task exports the blocks of its segments, the tasks write into the same file.
+            if (phys_op->left() != nullptr or phys_op->right() != nullptr) {
+                UnrecoverableError(fmt::format("{} shouldn't have child.", phys_op->GetName()));
+            }
+            current_fragment_ptr->AddOperator(phys_op);
+            current_fragment_ptr->SetFragmentType(FragmentType::kParallelMaterialize);
+            current_fragment_ptr->SetSourceNode(query_context_ptr_, SourceType::kEmpty, phys_op->GetOutputNames(), phys_op->GetOutputTypes());
+            return;
+        }
         case PhysicalOperatorType::kCreateIndexPrepare: {
             if (phys_op->left() != nullptr || phys_op->right() != nullptr) {
                 UnrecoverableError(fmt::format("Invalid input node of {}", phys_op->GetName()));
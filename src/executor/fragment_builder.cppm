@@ -34,6 +34,9 @@ private:
 
     void BuildExplain(PhysicalOperator *phys_op, PlanFragment *current_fragment_ptr);
 
+    // Add a child fragment for each input of the union, the inputs of nested unions are added to the same fragment.
+    void BuildUnionAllInputs(PhysicalOperator *phys_op, PlanFragment *union_fragment_ptr);
+
     idx_t GetFragmentId() { return fragment_id_++; }
 
 private:
@@ -14,111 +14,499 @@
 
 module;
 
-#include <string>
-import stl;
+#include <cstring>
 
-import column_vector;
+module hash_table;
 
+import stl;
+import column_vector;
+import internal_types;
+import logical_type;
+import data_type;
 import infinity_exception;
+import third_party;
+import status;
 
-module hash_table;
-
-#if 0
 namespace infinity {
 
-void HashTable::Init(const Vector<DataType> &types) {
-    types_ = types;
-    SizeT type_count = types.size();
-    for (SizeT idx = 0; idx < type_count; ++idx) {
-        const DataType &data_type = types[idx];
-        switch (data_type.type()) {
-            case kBoolean:
-            case kTinyInt:
-            case kSmallInt:
-            case kInteger:
-            case kBigInt:
-            case kHugeInt:
-            case kFloat:
-            case kDouble:
-            case kDecimal:
-            case kVarchar:
-            case kDate:
-            case kTime:
-            case kDateTime:
-            case kMixed: {
-                break; // All these type can be hashed.
-            }
-            case kTimestamp:
-            case kInterval:
-            case kArray:
-            case kTuple:
-            case kPoint:
-            case kLine:
-            case kLineSeg:
-            case kBox:
-//            case kPath:
-//            case kPolygon:
-            case kCircle:
-//            case kBitmap:
-            case kUuid:
-//            case kBlob:
-            case kEmbedding:
-            case kRowID:
-            case kNull:
-            case kMissing:
-            case kInvalid: {
-                RecoverableError(Status::NotSupport(fmt::format("Attempt to construct hash key for type: {}", data_type.ToString())));
-            }
+namespace {
+
+constexpr u64 NULL_KEY_HASH = 0x5bd1e9955bd1e995ULL;
+
+inline u64 MixHash(u64 h) {
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+    return h;
+}
+
+inline u64 CombineHash(u64 seed, u64 h) { return seed ^ (h + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2)); }
+
+inline u64 HashBytes(const char *data, SizeT length) {
+    u64 h = MixHash(length);
+    while (length >= sizeof(u64)) {
+        u64 value{};
+        std::memcpy(&value, data, sizeof(u64));
+        h = CombineHash(h, MixHash(value));
+        data += sizeof(u64);
+        length -= sizeof(u64);
+    }
+    if (length > 0) {
+        u64 value{};
+        std::memcpy(&value, data, length);
+        h = CombineHash(h, MixHash(value));
+    }
+    return h;
+}
+
+inline bool IsConstantColumn(const ColumnVector &column) { return column.vector_type() == ColumnVectorType::kConstant; }
+
+// The column keeping the values: the dictionary of a kDictionary column, otherwise the column itself.
+inline const ColumnVector &ValueColumn(const ColumnVector &column) {
+    return column.vector_type() == ColumnVectorType::kDictionary ? *column.dictionary() : column;
+}
+
+// Index of the value of the row in ValueColumn(column).
+inline SizeT ValueIndex(const ColumnVector &column, SizeT row_idx) {
+    switch (column.vector_type()) {
+        case ColumnVectorType::kConstant: {
+            return 0;
         }
+        case ColumnVectorType::kDictionary: {
+            return column.dictionary_codes()[row_idx];
+        }
+        default: {
+            return row_idx;
+        }
+    }
+}
 
-        SizeT type_size = data_type.Size();
-        key_size_ += type_size;
+inline bool IsNullAt(const ColumnVector &column, SizeT row_idx) {
+    return !column.nulls_ptr_->IsAllTrue() && !column.nulls_ptr_->IsTrue(IsConstantColumn(column) ? 0 : row_idx);
+}
+
+// Read the content of a varchar, the content not inlined is copied into the buffer.
+inline const char *VarcharData(const ColumnVector &column, const VarcharT &varchar, Vector<char> &buffer) {
+    if (varchar.IsInlined()) {
+        return varchar.short_.data_;
     }
+    buffer.resize(varchar.length_);
+    column.buffer_->fix_heap_mgr_->ReadFromHeap(buffer.data(), varchar.vector_.chunk_id_, varchar.vector_.chunk_offset_, varchar.length_);
+    return buffer.data();
+}
+
+// Width of the encoded value of a fixed width column, boolean is encoded as one byte since it can be stored as bits.
+inline SizeT EncodedWidth(const DataType &data_type) { return data_type.type() == LogicalType::kBoolean ? 1 : data_type.Size(); }
 
-    // Key layout: col1\0col2\0col3\0.
-    key_size_ += type_count;
+// Copy the value of the fixed width column at the row into the target.
+inline void EncodeFixedValue(const ColumnVector &column, SizeT row_idx, SizeT width, char *target) {
+    const ColumnVector &values = ValueColumn(column);
+    SizeT idx = ValueIndex(column, row_idx);
+    if (values.data_type()->type() == LogicalType::kBoolean) {
+        *target = values.buffer_->GetCompactBit(idx) ? 1 : 0;
+        return;
+    }
+    std::memcpy(target, values.data() + idx * width, width);
 }
 
-void HashTable::Append(const Vector<SharedPtr<ColumnVector>> &columns, SizeT block_id, SizeT row_count) {
-    UniquePtr<char[]> hash_key = MakeUnique<char[]>(key_size_);
-    SizeT column_count = columns.size();
-    for (SizeT row_id = 0; row_id < row_count; ++row_id) {
-        std::memset(hash_key.get(), 0, key_size_);
-        SizeT offset = 0;
+} // namespace
+
+// Implementation of the hash table on the rows of one key layout.
+class HashTableBase {
+public:
+    virtual ~HashTableBase() = default;
+
+    virtual void FindOrInsert(const Vector<SharedPtr<ColumnVector>> &key_columns, SizeT row_count, const Vector<u64> &hashes, Vector<u32> &group_ids) = 0;
+
+    virtual void Find(const Vector<SharedPtr<ColumnVector>> &key_columns, SizeT row_count, const Vector<u64> &hashes, Vector<u32> &group_ids) = 0;
 
-        for (SizeT column_id = 0; column_id < column_count; ++column_id) {
-            char *target_ptr = hash_key.get() + offset;
-            if (!columns[column_id]->nulls_ptr_->IsTrue(row_id)) {
-                *(target_ptr) = '\0';
-                offset += 2;
+    virtual SizeT GroupCount() const = 0;
+
+    virtual SizeT MemoryUsage() const = 0;
+};
+
+namespace {
+
+// Key of fixed width types. Layout: null flag of each column, then the value of each column. NULL value is zero filled.
+template <SizeT KEY_WIDTH>
+class FixedKeyStore {
+public:
+    using KeyType = Array<char, KEY_WIDTH>;
+
+    explicit FixedKeyStore(const Vector<SharedPtr<DataType>> &types) {
+        SizeT offset = types.size();
+        for (const auto &type : types) {
+            widths_.emplace_back(EncodedWidth(*type));
+            offsets_.emplace_back(offset);
+            offset += widths_.back();
+        }
+    }
+
+    void EncodeBatch(const Vector<SharedPtr<ColumnVector>> &key_columns, SizeT row_count) {
+        batch_keys_.assign(row_count, KeyType{});
+        for (SizeT column_idx = 0; column_idx < key_columns.size(); ++column_idx) {
+            const ColumnVector &column = *key_columns[column_idx];
+            SizeT width = widths_[column_idx];
+            SizeT offset = offsets_[column_idx];
+            for (SizeT row_idx = 0; row_idx < row_count; ++row_idx) {
+                char *key = batch_keys_[row_idx].data();
+                if (IsNullAt(column, row_idx)) {
+                    key[column_idx] = 1;
+                } else {
+                    EncodeFixedValue(column, row_idx, width, key + offset);
+                }
+            }
+        }
+    }
+
+    inline bool Equal(u32 group_id, SizeT row_idx) const {
+        return std::memcmp(group_keys_[group_id].data(), batch_keys_[row_idx].data(), KEY_WIDTH) == 0;
+    }
+
+    inline void Add(SizeT row_idx) { group_keys_.emplace_back(batch_keys_[row_idx]); }
+
+    inline SizeT MemoryUsage() const { return (batch_keys_.capacity() + group_keys_.capacity()) * sizeof(KeyType); }
+
+private:
+    Vector<SizeT> widths_{};
+    Vector<SizeT> offsets_{};
+    Vector<KeyType> batch_keys_{};
+    Vector<KeyType> group_keys_{};
+};
+
+// Key with varchar. Layout: null flag of each column, then the value of each column. Varchar is encoded as its length and content.
+class VarKeyStore {
+public:
+    explicit VarKeyStore(const Vector<SharedPtr<DataType>> &types) {
+        for (const auto &type : types) {
+            widths_.emplace_back(type->type() == LogicalType::kVarchar ? 0 : EncodedWidth(*type));
+        }
+    }
+
+    void EncodeBatch(const Vector<SharedPtr<ColumnVector>> &key_columns, SizeT row_count) {
+        SizeT column_count = key_columns.size();
+
+        // 1. Length of the key of each row.
+        Vector<SizeT> &cursors = batch_cursors_;
+        cursors.assign(row_count, column_count);
+        for (SizeT column_idx = 0; column_idx < column_count; ++column_idx) {
+            const ColumnVector &column = *key_columns[column_idx];
+            if (widths_[column_idx] > 0) {
+                for (SizeT row_idx = 0; row_idx < row_count; ++row_idx) {
+                    cursors[row_idx] += widths_[column_idx];
+                }
                 continue;
             }
+            const auto *varchars = reinterpret_cast<const VarcharT *>(ValueColumn(column).data());
+            for (SizeT row_idx = 0; row_idx < row_count; ++row_idx) {
+                cursors[row_idx] += sizeof(u32);
+                if (!IsNullAt(column, row_idx)) {
+                    cursors[row_idx] += varchars[ValueIndex(column, row_idx)].length_;
+                }
+            }
+        }
+        batch_offsets_.resize(row_count + 1);
+        batch_offsets_[0] = 0;
+        for (SizeT row_idx = 0; row_idx < row_count; ++row_idx) {
+            batch_offsets_[row_idx + 1] = batch_offsets_[row_idx] + cursors[row_idx];
+        }
+        batch_arena_.assign(batch_offsets_[row_count], 0);
 
-            DataType &data_type = types_[column_id];
-            if (data_type.type() == kMixed) {
-                // Only float/boolean/integer/string can be built as hash key. Array/Tuple will be treated as null
-                RecoverableError(Status::NotSupport("Attempt to construct hash key for heterogeneous type"));
+        // 2. Fill the key column by column.
+        for (SizeT row_idx = 0; row_idx < row_count; ++row_idx) {
+            cursors[row_idx] = batch_offsets_[row_idx] + column_count;
+        }
+        for (SizeT column_idx = 0; column_idx < column_count; ++column_idx) {
+            const ColumnVector &column = *key_columns[column_idx];
+            SizeT width = widths_[column_idx];
+            const ColumnVector &values = ValueColumn(column);
+            const auto *varchars = reinterpret_cast<const VarcharT *>(values.data());
+            for (SizeT row_idx = 0; row_idx < row_count; ++row_idx) {
+                char *key = batch_arena_.data() + batch_offsets_[row_idx];
+                char *target = batch_arena_.data() + cursors[row_idx];
+                bool is_null = IsNullAt(column, row_idx);
+                if (is_null) {
+                    key[column_idx] = 1;
+                }
+                if (width > 0) {
+                    if (!is_null) {
+                        EncodeFixedValue(column, row_idx, width, target);
+                    }
+                    cursors[row_idx] += width;
+                    continue;
+                }
+                const VarcharT &varchar = varchars[ValueIndex(column, row_idx)];
+                u32 length = is_null ? 0 : varchar.length_;
+                std::memcpy(target, &length, sizeof(length));
+                if (length > 0) {
+                    std::memcpy(target + sizeof(length), VarcharData(values, varchar, buffer_), length);
+                }
+                cursors[row_idx] += sizeof(length) + length;
             }
+        }
+    }
 
-            if (data_type.type() == kVarchar) {
-                VarcharT *vchar_ptr = &((VarcharT *)(columns[column_id]->data_ptr_))[row_id];
-                if (vchar_ptr->IsInlined()) {
-                    std::memcpy(target_ptr, vchar_ptr->prefix, vchar_ptr->length);
-                } else {
-                    std::memcpy(target_ptr, vchar_ptr->ptr, vchar_ptr->length);
+    inline bool Equal(u32 group_id, SizeT row_idx) const {
+        SizeT length = batch_offsets_[row_idx + 1] - batch_offsets_[row_idx];
+        return group_lengths_[group_id] == length &&
+               std::memcmp(arena_.data() + group_offsets_[group_id], batch_arena_.data() + batch_offsets_[row_idx], length) == 0;
+    }
+
+    inline void Add(SizeT row_idx) {
+        SizeT length = batch_offsets_[row_idx + 1] - batch_offsets_[row_idx];
+        group_offsets_.emplace_back(arena_.size());
+        group_lengths_.emplace_back(length);
+        const char *key = batch_arena_.data() + batch_offsets_[row_idx];
+        arena_.insert(arena_.end(), key, key + length);
+    }
+
+    inline SizeT MemoryUsage() const {
+        return batch_arena_.capacity() + arena_.capacity() + (group_offsets_.capacity() + group_lengths_.capacity()) * sizeof(SizeT);
+    }
+
+private:
+    // 0 for varchar column
+    Vector<SizeT> widths_{};
+
+    Vector<SizeT> batch_offsets_{};
+    Vector<SizeT> batch_cursors_{};
+    Vector<char> batch_arena_{};
+    Vector<char> buffer_{};
+
+    Vector<SizeT> group_offsets_{};
+    Vector<SizeT> group_lengths_{};
+    Vector<char> arena_{};
+};
+
+// Linear probing on the slots of group id. The hash of each group is kept, so that growing the slots doesn't touch the keys.
+template <typename KeyStore>
+class HashTableImpl final : public HashTableBase {
+public:
+    explicit HashTableImpl(const Vector<SharedPtr<DataType>> &types) : key_store_(types) { Resize(INITIAL_SLOT_COUNT); }
+
+    void FindOrInsert(const Vector<SharedPtr<ColumnVector>> &key_columns, SizeT row_count, const Vector<u64> &hashes, Vector<u32> &group_ids) final {
+        key_store_.EncodeBatch(key_columns, row_count);
+        group_ids.resize(row_count);
+        for (SizeT row_idx = 0; row_idx < row_count; ++row_idx) {
+            u64 hash = hashes[row_idx];
+            SizeT slot_idx = hash & slot_mask_;
+            while (true) {
+                u32 group_id = slots_[slot_idx];
+                if (group_id == INVALID_GROUP_ID) {
+                    group_id = group_hashes_.size();
+                    if (group_id == INVALID_GROUP_ID) {
+                        UnrecoverableError("Too many groups in hash table.");
+                    }
+                    key_store_.Add(row_idx);
+                    group_hashes_.emplace_back(hash);
+                    slots_[slot_idx] = group_id;
+                    group_ids[row_idx] = group_id;
+                    if (group_hashes_.size() * 2 > slots_.size()) {
+                        Resize(slots_.size() * 2);
+                    }
+                    break;
+                }
+                if (group_hashes_[group_id] == hash && key_store_.Equal(group_id, row_idx)) {
+                    group_ids[row_idx] = group_id;
+                    break;
                 }
-                offset += (vchar_ptr->length + 1);
-            } else {
-                SizeT type_size = types_[column_id].Size();
-                std::memcpy(target_ptr, columns[column_id]->data_ptr_ + type_size * row_id, type_size);
-                offset += (type_size + 1);
+                slot_idx = (slot_idx + 1) & slot_mask_;
+            }
+        }
+    }
+
+    void Find(const Vector<SharedPtr<ColumnVector>> &key_columns, SizeT row_count, const Vector<u64> &hashes, Vector<u32> &group_ids) final {
+        key_store_.EncodeBatch(key_columns, row_count);
+        group_ids.resize(row_count);
+        for (SizeT row_idx = 0; row_idx < row_count; ++row_idx) {
+            u64 hash = hashes[row_idx];
+            SizeT slot_idx = hash & slot_mask_;
+            u32 group_id = slots_[slot_idx];
+            while (group_id != INVALID_GROUP_ID && (group_hashes_[group_id] != hash || !key_store_.Equal(group_id, row_idx))) {
+                slot_idx = (slot_idx + 1) & slot_mask_;
+                group_id = slots_[slot_idx];
+            }
+            group_ids[row_idx] = group_id;
+        }
+    }
+
+    SizeT GroupCount() const final { return group_hashes_.size(); }
+
+    SizeT MemoryUsage() const final { return key_store_.MemoryUsage() + group_hashes_.capacity() * sizeof(u64) + slots_.capacity() * sizeof(u32); }
+
+private:
+    static constexpr SizeT INITIAL_SLOT_COUNT = 1024;
+
+    void Resize(SizeT slot_count) {
+        slots_.assign(slot_count, INVALID_GROUP_ID);
+        slot_mask_ = slot_count - 1;
+        for (u32 group_id = 0; group_id < group_hashes_.size(); ++group_id) {
+            SizeT slot_idx = group_hashes_[group_id] & slot_mask_;
+            while (slots_[slot_idx] != INVALID_GROUP_ID) {
+                slot_idx = (slot_idx + 1) & slot_mask_;
             }
+            slots_[slot_idx] = group_id;
         }
+    }
+
+    KeyStore key_store_;
+    Vector<u64> group_hashes_{};
+    Vector<u32> slots_{};
+    SizeT slot_mask_{};
+};
 
-        String key(hash_key.get(), key_size_);
-        hash_table_[key][block_id].emplace_back(row_id);
+// Hash of the value at the row of a column without dictionary.
+u64 HashValue(const ColumnVector &column, SizeT row_idx, SizeT width, Vector<char> &buffer) {
+    if (column.data_type()->type() == LogicalType::kVarchar) {
+        const VarcharT &varchar = reinterpret_cast<const VarcharT *>(column.data())[ValueIndex(column, row_idx)];
+        return HashBytes(VarcharData(column, varchar, buffer), varchar.length_);
     }
+    char value_buffer[64]{};
+    EncodeFixedValue(column, row_idx, width, value_buffer);
+    if (width <= sizeof(u64)) {
+        u64 value{};
+        std::memcpy(&value, value_buffer, width);
+        return MixHash(value);
+    }
+    return HashBytes(value_buffer, width);
+}
+
+// Hash of each row of the column is combined into the hashes.
+void HashColumn(const ColumnVector &column, SizeT row_count, Vector<u64> &hashes) {
+    const DataType &data_type = *column.data_type();
+    bool has_null = !column.nulls_ptr_->IsAllTrue();
+    SizeT width = data_type.type() == LogicalType::kVarchar ? 0 : EncodedWidth(data_type);
+    if (width > 64) {
+        UnrecoverableError(fmt::format("Attempt to hash type: {}", data_type.ToString()));
+    }
+    Vector<char> buffer;
+    // A value of the dictionary is hashed once for all its rows.
+    bool is_dictionary = column.vector_type() == ColumnVectorType::kDictionary;
+    Vector<u64> value_hashes;
+    if (is_dictionary) {
+        const ColumnVector &dictionary = *column.dictionary();
+        value_hashes.resize(dictionary.Size());
+        for (SizeT value_idx = 0; value_idx < value_hashes.size(); ++value_idx) {
+            value_hashes[value_idx] = HashValue(dictionary, value_idx, width, buffer);
+        }
+    }
+    for (SizeT row_idx = 0; row_idx < row_count; ++row_idx) {
+        if (has_null && IsNullAt(column, row_idx)) {
+            hashes[row_idx] = CombineHash(hashes[row_idx], NULL_KEY_HASH);
+            continue;
+        }
+        u64 value_hash = is_dictionary ? value_hashes[column.dictionary_codes()[row_idx]] : HashValue(column, row_idx, width, buffer);
+        hashes[row_idx] = CombineHash(hashes[row_idx], value_hash);
+    }
+}
+
+template <SizeT KEY_WIDTH>
+UniquePtr<HashTableBase> MakeFixedHashTable(const Vector<SharedPtr<DataType>> &types) {
+    return MakeUnique<HashTableImpl<FixedKeyStore<KEY_WIDTH>>>(types);
 }
 
+} // namespace
+
+HashTable::HashTable() = default;
+
+HashTable::~HashTable() = default;
+
+bool HashTable::IsHashableType(const DataType &data_type) {
+    switch (data_type.type()) {
+        case LogicalType::kBoolean:
+        case LogicalType::kTinyInt:
+        case LogicalType::kSmallInt:
+        case LogicalType::kInteger:
+        case LogicalType::kBigInt:
+        case LogicalType::kHugeInt:
+        case LogicalType::kFloat:
+        case LogicalType::kDouble:
+        case LogicalType::kDecimal:
+        case LogicalType::kDate:
+        case LogicalType::kTime:
+        case LogicalType::kDateTime:
+        case LogicalType::kTimestamp:
+        case LogicalType::kVarchar: {
+            return true;
+        }
+        default: {
+            return false;
+        }
+    }
+}
+
+void HashTable::Init(const Vector<SharedPtr<DataType>> &types) {
+    types_ = types;
+    bool has_varchar = false;
+    // One byte null flag for each column.
+    SizeT key_width = types.size();
+    for (const auto &type : types) {
+        if (!IsHashableType(*type)) {
+            RecoverableError(Status::NotSupport(fmt::format("Attempt to construct hash key for type: {}", type->ToString())));
+        }
+        if (type->type() == LogicalType::kVarchar) {
+            has_varchar = true;
+        } else {
+            key_width += EncodedWidth(*type);
+        }
+    }
+
+    if (has_varchar) {
+        impl_ = MakeUnique<HashTableImpl<VarKeyStore>>(types);
+    } else if (key_width <= 8) {
+        impl_ = MakeFixedHashTable<8>(types);
+    } else if (key_width <= 16) {
+        impl_ = MakeFixedHashTable<16>(types);
+    } else if (key_width <= 32) {
+        impl_ = MakeFixedHashTable<32>(types);
+    } else if (key_width <= 64) {
+        impl_ = MakeFixedHashTable<64>(types);
+    } else {
+        impl_ = MakeUnique<HashTableImpl<VarKeyStore>>(types);
+    }
+}
+
+void HashTable::Hash(const Vector<SharedPtr<ColumnVector>> &key_columns, SizeT row_count, Vector<u64> &hashes) const {
+    if (key_columns.size() != types_.size()) {
+        UnrecoverableError(fmt::format("Expect {} key columns, but got {}", types_.size(), key_columns.size()));
+    }
+    hashes.assign(row_count, 0);
+    for (const auto &key_column : key_columns) {
+        HashColumn(*key_column, row_count, hashes);
+    }
+    for (SizeT row_idx = 0; row_idx < row_count; ++row_idx) {
+        hashes[row_idx] = MixHash(hashes[row_idx]);
+    }
+}
+
+void HashTable::FindOrInsert(const Vector<SharedPtr<ColumnVector>> &key_columns, SizeT row_count, Vector<u32> &group_ids) {
+    Hash(key_columns, row_count, hashes_);
+    impl_->FindOrInsert(key_columns, row_count, hashes_, group_ids);
+}
+
+void HashTable::Find(const Vector<SharedPtr<ColumnVector>> &key_columns, SizeT row_count, Vector<u32> &group_ids) {
+    Hash(key_columns, row_count, hashes_);
+    impl_->Find(key_columns, row_count, hashes_, group_ids);
+}
+
+void HashTable::HasNull(const Vector<SharedPtr<ColumnVector>> &key_columns, SizeT row_count, Vector<bool> &has_null) {
+    has_null.assign(row_count, false);
+    for (const auto &key_column : key_columns) {
+        if (key_column->nulls_ptr_->IsAllTrue()) {
+            continue;
+        }
+        for (SizeT row_idx = 0; row_idx < row_count; ++row_idx) {
+            if (IsNullAt(*key_column, row_idx)) {
+                has_null[row_idx] = true;
+            }
+        }
+    }
+}
+
+SizeT HashTable::GroupCount() const { return impl_.get() == nullptr ? 0 : impl_->GroupCount(); }
+
+SizeT HashTable::MemoryUsage() const { return impl_.get() == nullptr ? 0 : impl_->MemoryUsage(); }
+
 } // namespace infinity
-#endif
\ No newline at end of file
@@ -23,18 +23,47 @@ import data_type;
 
 namespace infinity {
 
+// Group id of the key which isn't in the hash table.
+export constexpr u32 INVALID_GROUP_ID = std::numeric_limits<u32>::max();
+
+class HashTableBase;
+
+// Open addressing hash table from the key of a row to a dense group id, group ids are assigned from 0 in the order of insertion.
+// The key of all rows of a block are hashed and encoded column by column. Keys of fixed width types are packed inline in the table,
+// the implementation is chosen by the key width. Keys with varchar are stored in an arena.
 export class HashTable {
 public:
-    void Init(const Vector<DataType> &types);
+    HashTable();
 
-    void Append(const Vector<SharedPtr<ColumnVector>> &columns, SizeT block_id, SizeT row_count);
+    ~HashTable();
 
-public:
-    Vector<DataType> types_{};
-    SizeT key_size_{};
+    static bool IsHashableType(const DataType &data_type);
+
+    void Init(const Vector<SharedPtr<DataType>> &types);
+
+    // Hash of the key of each row.
+    void Hash(const Vector<SharedPtr<ColumnVector>> &key_columns, SizeT row_count, Vector<u64> &hashes) const;
+
+    // Group id of the key of each row, the key not in the table is inserted as a new group.
+    void FindOrInsert(const Vector<SharedPtr<ColumnVector>> &key_columns, SizeT row_count, Vector<u32> &group_ids);
+
+    // Group id of the key of each row, INVALID_GROUP_ID if the key isn't in the table.
+    void Find(const Vector<SharedPtr<ColumnVector>> &key_columns, SizeT row_count, Vector<u32> &group_ids);
+
+    // Whether the key of each row has NULL.
+    static void HasNull(const Vector<SharedPtr<ColumnVector>> &key_columns, SizeT row_count, Vector<bool> &has_null);
+
+    SizeT GroupCount() const;
+
+    // Bytes held by the slots and the group keys.
+    SizeT MemoryUsage() const;
+
+    inline const Vector<SharedPtr<DataType>> &types() const { return types_; }
 
-    // Key -> (block id -> row array)
-    HashMap<String, HashMap<SizeT, Vector<SizeT>>> hash_table_{};
+private:
+    Vector<SharedPtr<DataType>> types_{};
+    UniquePtr<HashTableBase> impl_{};
+    Vector<u64> hashes_{};
 };
 
 } // namespace infinity
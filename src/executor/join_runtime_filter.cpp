@@ -0,0 +1,132 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <algorithm>
+
+module join_runtime_filter;
+
+import stl;
+import data_type;
+import logical_type;
+import data_block;
+import column_vector;
+import internal_types;
+import value;
+import fast_rough_filter;
+import filter_value_type_classification;
+import filter_expression_push_down;
+import third_party;
+import logger;
+
+namespace infinity {
+
+template <typename T, Value (*MakeValue)(T)>
+class JoinRuntimeFilterT final : public JoinRuntimeFilter {
+public:
+    JoinRuntimeFilterT(SizeT build_key_idx, ColumnID probe_column_id) : JoinRuntimeFilter(build_key_idx, probe_column_id) {}
+
+    void AddBuildBlock(const DataBlock &data_block) final {
+        const ColumnVector &column = *data_block.column_vectors[build_key_idx_];
+        SizeT row_count = data_block.row_count();
+        if (column.vector_type() == ColumnVectorType::kConstant) {
+            row_count = std::min<SizeT>(row_count, 1);
+        }
+        const auto *data = reinterpret_cast<const T *>(column.data());
+        std::lock_guard lock(mutex_);
+        for (SizeT i = 0; i < row_count; ++i) {
+            if (!column.nulls_ptr_->IsTrue(i)) {
+                // a null key matches no probe row
+                continue;
+            }
+            const T &key = data[i];
+            if (!min_max_.has_value()) {
+                min_max_ = Pair<T, T>(key, key);
+            } else {
+                min_max_->first = std::min(min_max_->first, key);
+                min_max_->second = std::max(min_max_->second, key);
+            }
+            if constexpr (CanBuildBloomFilter<T>) {
+                if (keys_.size() <= kMaxCheckedKeyCount) {
+                    keys_.insert(key);
+                }
+            }
+        }
+    }
+
+protected:
+    Optional<Pair<Value, Value>> MinMaxKey(Vector<Value> &keys) const final {
+        if (!min_max_.has_value()) {
+            return None;
+        }
+        if (keys_.size() <= kMaxCheckedKeyCount) {
+            for (const T &key : keys_) {
+                keys.push_back(MakeValue(key));
+            }
+        }
+        return Pair<Value, Value>(MakeValue(min_max_->first), MakeValue(min_max_->second));
+    }
+
+private:
+    Optional<Pair<T, T>> min_max_{};
+    // one more than kMaxCheckedKeyCount means too many
+    Set<T> keys_{};
+};
+
+SharedPtr<JoinRuntimeFilter> JoinRuntimeFilter::Make(const DataType &key_type, SizeT build_key_idx, ColumnID probe_column_id) {
+    switch (key_type.type()) {
+        case LogicalType::kTinyInt: {
+            return MakeShared<JoinRuntimeFilterT<TinyIntT, Value::MakeTinyInt>>(build_key_idx, probe_column_id);
+        }
+        case LogicalType::kSmallInt: {
+            return MakeShared<JoinRuntimeFilterT<SmallIntT, Value::MakeSmallInt>>(build_key_idx, probe_column_id);
+        }
+        case LogicalType::kInteger: {
+            return MakeShared<JoinRuntimeFilterT<IntegerT, Value::MakeInt>>(build_key_idx, probe_column_id);
+        }
+        case LogicalType::kBigInt: {
+            return MakeShared<JoinRuntimeFilterT<BigIntT, Value::MakeBigInt>>(build_key_idx, probe_column_id);
+        }
+        case LogicalType::kFloat: {
+            return MakeShared<JoinRuntimeFilterT<FloatT, Value::MakeFloat>>(build_key_idx, probe_column_id);
+        }
+        case LogicalType::kDouble: {
+            return MakeShared<JoinRuntimeFilterT<DoubleT, Value::MakeDouble>>(build_key_idx, probe_column_id);
+        }
+        case LogicalType::kDate: {
+            return MakeShared<JoinRuntimeFilterT<DateT, Value::MakeDate>>(build_key_idx, probe_column_id);
+        }
+        default: {
+            return nullptr;
+        }
+    }
+}
+
+void JoinRuntimeFilter::Publish() {
+    if (published_.test(std::memory_order_acquire)) {
+        return;
+    }
+    Vector<Value> keys;
+    Optional<Pair<Value, Value>> min_max_key;
+    {
+        std::lock_guard lock(mutex_);
+        min_max_key = MinMaxKey(keys);
+    }
+    evaluator_ = FilterExpressionPushDown::PushDownJoinKeysToFastRoughFilter(probe_column_id_, min_max_key, keys);
+    LOG_TRACE(fmt::format("JoinRuntimeFilter: published on column {}, {} keys checked", probe_column_id_, keys.size()));
+    published_.test_and_set(std::memory_order_release);
+}
+
+} // namespace infinity
@@ -0,0 +1,67 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module join_runtime_filter;
+
+import stl;
+import data_type;
+import data_block;
+import internal_types;
+import value;
+import fast_rough_filter;
+
+namespace infinity {
+
+// The keys of the build side of a hash join, collected by the sink of the build fragment while the probe fragment waits.
+// Once all build blocks are added, Publish() turns them into a FastRoughFilterEvaluator on the probe column, which the
+// scan of the probe side uses to skip the blocks and segments without any of the keys.
+export class JoinRuntimeFilter {
+public:
+    // at most so many distinct keys are checked one by one against the probabilistic filters, only min/max for more keys
+    static constexpr SizeT kMaxCheckedKeyCount = 64;
+
+    virtual ~JoinRuntimeFilter() = default;
+
+    // nullptr if there is no FastRoughFilter for the key type
+    static SharedPtr<JoinRuntimeFilter> Make(const DataType &key_type, SizeT build_key_idx, ColumnID probe_column_id);
+
+    // called by the build tasks in parallel
+    virtual void AddBuildBlock(const DataBlock &data_block) = 0;
+
+    // called once all build tasks are completed, before the probe fragment is scheduled
+    void Publish();
+
+    // nullptr until published
+    const FastRoughFilterEvaluator *Get() const { return published_.test(std::memory_order_acquire) ? evaluator_.get() : nullptr; }
+
+    inline ColumnID probe_column_id() const { return probe_column_id_; }
+
+protected:
+    JoinRuntimeFilter(SizeT build_key_idx, ColumnID probe_column_id) : build_key_idx_(build_key_idx), probe_column_id_(probe_column_id) {}
+
+    // the min and max keys as values of the key type, None if no key, and the distinct keys unless there are too many
+    virtual Optional<Pair<Value, Value>> MinMaxKey(Vector<Value> &keys) const = 0;
+
+    std::mutex mutex_;
+    SizeT build_key_idx_{};
+
+private:
+    ColumnID probe_column_id_{};
+    UniquePtr<FastRoughFilterEvaluator> evaluator_{};
+    atomic_flag published_{};
+};
+
+} // namespace infinity
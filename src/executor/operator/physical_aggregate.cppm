@@ -23,7 +23,6 @@ import operator_state;
 import physical_operator;
 import physical_operator_type;
 import data_table;
-import hash_table;
 import base_expression;
 import load_meta;
 import infinity_exception;
@@ -61,13 +60,8 @@ public:
         return 0;
     }
 
-    void GroupByInputTable(const SharedPtr<DataTable> &input_table, SharedPtr<DataTable> &output_table);
-
-    void GenerateGroupByResult(const SharedPtr<DataTable> &input_table, SharedPtr<DataTable> &output_table);
-
     Vector<SharedPtr<BaseExpression>> groups_{};
     Vector<SharedPtr<BaseExpression>> aggregates_{};
-    HashTable hash_table_;
 
     bool SimpleAggregateExecute(const Vector<UniquePtr<DataBlock>> &input_blocks,
                                 Vector<UniquePtr<DataBlock>> &output_blocks,
@@ -86,6 +80,11 @@ public:
     Vector<HashRange> GetHashRanges(i64 parallel_count) const;
 
 private:
+    bool GroupByExecute(QueryContext *query_context, AggregateOperatorState *aggregate_operator_state);
+
+    // Outputs the partial result of the blocks which the table scan of the task answered from their metadata, as one more row.
+    void OutputStatisticsPartial(OperatorState *input_state, Vector<UniquePtr<DataBlock>> &output_blocks) const;
+
     SharedPtr<DataTable> input_table_{};
     u64 groupby_index_{};
     u64 aggregate_index_{};
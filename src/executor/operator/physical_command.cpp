@@ -21,6 +21,7 @@ module physical_command;
 
 import stl;
 import query_context;
+import session_manager;
 import operator_state;
 
 import profiler;
@@ -35,6 +36,7 @@ import config;
 import status;
 import infinity_exception;
 import compact_segments_task;
+import table_entry;
 
 namespace infinity {
 
@@ -66,6 +68,43 @@ bool PhysicalCommand::Execute(QueryContext *query_context, OperatorState *operat
                 return true;
             }
 
+            if (set_command->var_name() == query_priority_name) {
+                if (set_command->value_type() != SetVarType::kString) {
+                    RecoverableError(Status::DataTypeMismatch("String", set_command->value_type_str()));
+                }
+
+                if (set_command->scope() != SetScope::kSession) {
+                    RecoverableError(Status::SyntaxError(fmt::format("{} is a session config parameter.", set_command->var_name())));
+                }
+
+                for (SizeT idx = 0; idx < QUERY_PRIORITY_COUNT; ++idx) {
+                    QueryPriority priority = static_cast<QueryPriority>(idx);
+                    if (set_command->value_str() == QueryPriorityToString(priority)) {
+                        query_context->current_session()->options()->query_priority_ = priority;
+                        return true;
+                    }
+                }
+
+                RecoverableError(Status::SetInvalidVarValue("query priority", "interactive, batch, background"));
+                return true;
+            }
+
+            if (set_command->var_name() == query_timeout_name) {
+                if (set_command->value_type() != SetVarType::kInteger) {
+                    RecoverableError(Status::DataTypeMismatch("Integer", set_command->value_type_str()));
+                }
+
+                if (set_command->scope() != SetScope::kSession) {
+                    RecoverableError(Status::SyntaxError(fmt::format("{} is a session config parameter.", set_command->var_name())));
+                }
+
+                if (set_command->value_int() < 0) {
+                    RecoverableError(Status::SetInvalidVarValue("query timeout", "0 (no timeout) or a positive number of milliseconds"));
+                }
+                query_context->current_session()->options()->query_timeout_ms_ = set_command->value_int();
+                return true;
+            }
+
             if (set_command->var_name() == log_level) {
                 if (set_command->value_type() != SetVarType::kString) {
                     RecoverableError(Status::DataTypeMismatch("String", set_command->value_type_str()));
@@ -143,6 +182,18 @@ bool PhysicalCommand::Execute(QueryContext *query_context, OperatorState *operat
             compact_task->Execute();
             break;
         }
+        case CommandType::kWarmup: {
+            auto *warmup_cmd = static_cast<WarmupCmd *>(command_info_.get());
+            table_entry_->WarmupIndexes(query_context->GetTxn(), warmup_cmd->index_name_);
+            break;
+        }
+        case CommandType::kKillQuery: {
+            auto *kill_query_cmd = static_cast<KillQueryCmd *>(command_info_.get());
+            if (!query_context->session_manager()->CancelQuery(kill_query_cmd->query_id_)) {
+                RecoverableError(Status::QueryNotFound(kill_query_cmd->query_id_));
+            }
+            break;
+        }
         default: {
             UnrecoverableError("Invalid command type.");
         }
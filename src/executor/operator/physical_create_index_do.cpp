@@ -40,6 +40,7 @@ import buffer_manager;
 import txn_store;
 import third_party;
 import logger;
+import io_stats;
 
 module physical_create_index_do;
 
@@ -58,6 +59,7 @@ void PhysicalCreateIndexDo::Init() {}
 
 // FIXME: fetch and add a block one time
 bool PhysicalCreateIndexDo::Execute(QueryContext *query_context, OperatorState *operator_state) {
+    IOPurposeScope io_purpose_scope(IOPurpose::kIndexBuild);
     auto *txn = query_context->GetTxn();
     auto *create_index_do_state = static_cast<CreateIndexDoOperatorState *>(operator_state);
     auto &create_index_idxes = create_index_do_state->create_index_shared_data_->create_index_idxes_;
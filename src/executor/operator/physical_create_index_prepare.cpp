@@ -43,6 +43,9 @@ import hnsw_alg;
 import lvq_store;
 import plain_store;
 import extra_ddl_info;
+import table_entry;
+import table_index_entry;
+import io_stats;
 
 namespace infinity {
 PhysicalCreateIndexPrepare::PhysicalCreateIndexPrepare(u64 id,
@@ -59,12 +62,14 @@ PhysicalCreateIndexPrepare::PhysicalCreateIndexPrepare(u64 id,
 void PhysicalCreateIndexPrepare::Init() {}
 
 bool PhysicalCreateIndexPrepare::Execute(QueryContext *query_context, OperatorState *operator_state) {
+    IOPurposeScope io_purpose_scope(IOPurpose::kIndexBuild);
     auto *txn = query_context->GetTxn();
     auto *table_entry = base_table_ref_->table_entry_ptr_;
     auto [table_index_entry, status] = txn->CreateIndexDef(table_entry, index_def_ptr_, conflict_type_);
     if (!status.ok()) {
         operator_state->status_ = status;
     } else {
+        table_index_entry->BeginBuildProgress(*table_entry->GetDBName(), *table_entry->GetTableName());
         auto status = txn->CreateIndexPrepare(table_index_entry, base_table_ref_.get(), prepare_);
         if (!status.ok()) {
             operator_state->status_ = status;
@@ -14,6 +14,8 @@
 
 module;
 
+#include <thread>
+
 import stl;
 import txn;
 import query_context;
@@ -25,6 +27,18 @@ import operator_state;
 import status;
 import load_meta;
 import extra_ddl_info;
+import catalog;
+import table_entry;
+import segment_entry;
+import table_index_meta;
+import table_index_entry;
+import index_base;
+import block_index;
+import internal_types;
+import storage;
+import txn_manager;
+import wal_manager;
+import bg_task;
 
 module physical_create_table;
 
@@ -60,6 +74,9 @@ bool PhysicalCreateTable::Execute(QueryContext *query_context, OperatorState *op
     auto txn = query_context->GetTxn();
 
     Status status = txn->CreateTable(*schema_name_, table_def_ptr_, conflict_type_);
+    if (status.ok() && clone_table_name_.get() != nullptr) {
+        status = CloneTable(query_context);
+    }
     if (!status.ok()) {
         operator_state->status_ = status;
     }
@@ -67,4 +84,81 @@ bool PhysicalCreateTable::Execute(QueryContext *query_context, OperatorState *op
     return true;
 }
 
+Status PhysicalCreateTable::CloneTable(QueryContext *query_context) {
+    Txn *txn = query_context->GetTxn();
+    const String &db_name = *schema_name_;
+    const String &table_name = *table_def_ptr_->table_name();
+    auto [table_entry, status] = txn->GetTableByName(db_name, table_name);
+    if (!status.ok()) {
+        return status;
+    }
+    if (table_entry->txn_id_ != txn->TxnID()) {
+        // The table exists and the conflict is ignored.
+        return Status::OK();
+    }
+    auto [source_table_entry, source_status] = txn->GetTableByName(db_name, *clone_table_name_);
+    if (!source_status.ok()) {
+        return source_status;
+    }
+
+    // A full checkpoint started after the txn flushes all the rows visible to it, so the linked files hold them.
+    TxnManager *txn_mgr = query_context->storage()->txn_manager();
+    WalManager *wal_mgr = query_context->storage()->wal_manager();
+    Txn *checkpoint_txn = txn_mgr->BeginTxn();
+    auto force_ckp_task = MakeShared<ForceCheckpointTask>(checkpoint_txn, true /*is_full_checkpoint*/);
+    while (!wal_mgr->TrySubmitCheckpointTask(force_ckp_task)) {
+        // the running checkpoint may have started before the txn
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    force_ckp_task->Wait();
+    txn_mgr->CommitTxn(checkpoint_txn);
+
+    TxnTimeStamp begin_ts = txn->BeginTS();
+    SharedPtr<BlockIndex> source_block_index = source_table_entry->GetBlockIndex(begin_ts);
+    BlockIndex block_index;
+    Vector<RowID> deleted_rows;
+    for (SegmentEntry *source_segment : source_block_index->segments_) {
+        SegmentID segment_id = Catalog::GetNextSegmentID(table_entry);
+        auto [segment_entry, segment_status] = SegmentEntry::NewCloneSegmentEntry(table_entry, segment_id, source_segment, txn, deleted_rows);
+        if (!segment_status.ok()) {
+            return segment_status;
+        }
+        block_index.Insert(segment_entry.get(), begin_ts, false /*check_ts*/);
+        txn->Import(db_name, table_name, std::move(segment_entry));
+    }
+    if (!deleted_rows.empty()) {
+        status = txn->Delete(db_name, table_name, deleted_rows, false /*check_conflict*/);
+        if (!status.ok()) {
+            return status;
+        }
+    }
+
+    // The index files are rebuilt, their chunks belong to the index dir of each table.
+    Vector<SharedPtr<IndexBase>> index_bases;
+    {
+        auto index_meta_map_guard = source_table_entry->IndexMetaMap();
+        for (auto &[index_name, table_index_meta] : *index_meta_map_guard) {
+            auto [source_index_entry, index_status] = table_index_meta->GetEntryNolock(txn->TxnID(), begin_ts);
+            if (index_status.ok()) {
+                index_bases.push_back(source_index_entry->table_index_def());
+            }
+        }
+    }
+    for (const auto &index_base : index_bases) {
+        auto [table_index_entry, index_status] = txn->CreateIndexDef(table_entry, index_base, ConflictType::kError);
+        if (!index_status.ok()) {
+            return index_status;
+        }
+        status = txn->CreateIndexPrepare(table_index_entry, table_entry, &block_index, false /*prepare*/, false /*check_ts*/);
+        if (!status.ok()) {
+            return status;
+        }
+        status = txn->CreateIndexFinish(table_entry, table_index_entry);
+        if (!status.ok()) {
+            return status;
+        }
+    }
+    return Status::OK();
+}
+
 } // namespace infinity
@@ -29,6 +29,7 @@ import infinity_exception;
 import internal_types;
 import extra_ddl_info;
 import data_type;
+import status;
 
 namespace infinity {
 
@@ -74,11 +75,20 @@ public:
 
     inline const SharedPtr<String> &schema_name() const { return schema_name_; }
 
+    inline const SharedPtr<String> &clone_table_name() const { return clone_table_name_; }
+
+    void set_clone_table_name(SharedPtr<String> clone_table_name) { clone_table_name_ = std::move(clone_table_name); }
+
+private:
+    // Import segments which share the data files of the source table, then build the indexes of the source on them.
+    Status CloneTable(QueryContext *query_context);
+
 private:
     SharedPtr<TableDef> table_def_ptr_{};
     SharedPtr<String> schema_name_{};
     u64 table_index_{};
     ConflictType conflict_type_{ConflictType::kInvalid};
+    SharedPtr<String> clone_table_name_{};
 
     SharedPtr<Vector<String>> output_names_{};
     SharedPtr<Vector<SharedPtr<DataType>>> output_types_{};
@@ -54,7 +54,7 @@ void PhysicalExplain::Init() {
     switch (explain_type_) {
         case ExplainType::kAnalyze: {
             output_names_->emplace_back("Query Analyze");
-            RecoverableError(Status::NotSupport("Not implement: Query analyze"));
+            break;
         }
         case ExplainType::kAst: {
             output_names_->emplace_back("Abstract Syntax Tree");
@@ -103,7 +103,7 @@ bool PhysicalExplain::Execute(QueryContext *, OperatorState *operator_state) {
     switch (explain_type_) {
         case ExplainType::kAnalyze: {
             title = "Query Analyze";
-            RecoverableError(Status::NotSupport("Not implement: Query analyze"));
+            break;
         }
         case ExplainType::kAst: {
             title = "Abstract Syntax Tree";
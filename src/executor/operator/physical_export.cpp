@@ -14,22 +14,416 @@
 
 module;
 
-import query_context;
-import operator_state;
+#include <charconv>
+#include <cmath>
 
 module physical_export;
 
+import stl;
+import query_context;
+import operator_state;
+import txn;
+import storage;
+import buffer_manager;
+import table_entry;
+import block_index;
+import block_entry;
+import block_column_entry;
+import global_block_id;
+import column_vector;
+import column_def;
+import bitmask;
+import export_data;
+import default_values;
+import logical_type;
+import internal_types;
+import data_type;
+import embedding_info;
+import statement_common;
+import infinity_exception;
+import third_party;
+
 namespace infinity {
 
-void PhysicalExport::Init() {}
+namespace {
+
+template <typename T>
+inline void AppendNumber(String &buffer, T value) {
+    char chars[64];
+    auto [ptr, ec] = std::to_chars(chars, chars + sizeof(chars), value);
+    buffer.append(chars, ptr - chars);
+}
+
+// Append the value of a numeric column, return false when the column isn't a number.
+bool AppendNumericValue(String &buffer, const ColumnVector &column, SizeT row_idx) {
+    const ptr_t data = column.data();
+    switch (column.data_type()->type()) {
+        case kTinyInt: {
+            AppendNumber(buffer, reinterpret_cast<const TinyIntT *>(data)[row_idx]);
+            return true;
+        }
+        case kSmallInt: {
+            AppendNumber(buffer, reinterpret_cast<const SmallIntT *>(data)[row_idx]);
+            return true;
+        }
+        case kInteger: {
+            AppendNumber(buffer, reinterpret_cast<const IntegerT *>(data)[row_idx]);
+            return true;
+        }
+        case kBigInt: {
+            AppendNumber(buffer, reinterpret_cast<const BigIntT *>(data)[row_idx]);
+            return true;
+        }
+        case kFloat: {
+            AppendNumber(buffer, reinterpret_cast<const FloatT *>(data)[row_idx]);
+            return true;
+        }
+        case kDouble: {
+            AppendNumber(buffer, reinterpret_cast<const DoubleT *>(data)[row_idx]);
+            return true;
+        }
+        default: {
+            return false;
+        }
+    }
+}
+
+// JSON has no literal for inf and nan.
+bool IsFiniteValue(const ColumnVector &column, SizeT row_idx) {
+    switch (column.data_type()->type()) {
+        case kFloat: {
+            return std::isfinite(reinterpret_cast<const FloatT *>(column.data())[row_idx]);
+        }
+        case kDouble: {
+            return std::isfinite(reinterpret_cast<const DoubleT *>(column.data())[row_idx]);
+        }
+        default: {
+            return true;
+        }
+    }
+}
 
-bool PhysicalExport::Execute(QueryContext *, OperatorState *operator_state) {
-    operator_state->SetComplete();
+template <typename T>
+inline void AppendEmbeddingElements(String &buffer, const char *ptr, SizeT dimension, char separator) {
+    const T *elements = reinterpret_cast<const T *>(ptr);
+    for (SizeT i = 0; i < dimension; ++i) {
+        if (i > 0) {
+            buffer.push_back(separator);
+        }
+        AppendNumber(buffer, elements[i]);
+    }
+}
+
+// Append the embedding as [e0<separator>e1...], which is the format read by import.
+void AppendEmbedding(String &buffer, const ColumnVector &column, SizeT row_idx, char separator) {
+    const auto *embedding_info = static_cast<EmbeddingInfo *>(column.data_type()->type_info().get());
+    SizeT dimension = embedding_info->Dimension();
+    const char *ptr = column.data() + row_idx * embedding_info->Size();
+    buffer.push_back('[');
+    switch (embedding_info->Type()) {
+        case kElemInt8: {
+            AppendEmbeddingElements<i8>(buffer, ptr, dimension, separator);
+            break;
+        }
+        case kElemInt16: {
+            AppendEmbeddingElements<i16>(buffer, ptr, dimension, separator);
+            break;
+        }
+        case kElemInt32: {
+            AppendEmbeddingElements<i32>(buffer, ptr, dimension, separator);
+            break;
+        }
+        case kElemInt64: {
+            AppendEmbeddingElements<i64>(buffer, ptr, dimension, separator);
+            break;
+        }
+        case kElemFloat: {
+            AppendEmbeddingElements<float>(buffer, ptr, dimension, separator);
+            break;
+        }
+        case kElemDouble: {
+            AppendEmbeddingElements<double>(buffer, ptr, dimension, separator);
+            break;
+        }
+        default: {
+            // Bit embedding is rejected by the planner.
+            UnrecoverableError("Not implement: Export embedding type.");
+        }
+    }
+    buffer.push_back(']');
+}
+
+// Quote the field as RFC 4180 when it contains the delimiter, a quote or a line break.
+void AppendCSVField(String &buffer, std::string_view field, char delimiter) {
+    const char special_chars[] = {delimiter, '"', '\n', '\r'};
+    if (field.find_first_of(std::string_view(special_chars, sizeof(special_chars))) == std::string_view::npos) {
+        buffer.append(field);
+        return;
+    }
+    buffer.push_back('"');
+    for (char c : field) {
+        if (c == '"') {
+            buffer.push_back('"');
+        }
+        buffer.push_back(c);
+    }
+    buffer.push_back('"');
+}
+
+void AppendJSONString(String &buffer, std::string_view str) {
+    buffer.push_back('"');
+    for (char c : str) {
+        switch (c) {
+            case '"': {
+                buffer.append("\\\"");
+                break;
+            }
+            case '\\': {
+                buffer.append("\\\\");
+                break;
+            }
+            case '\n': {
+                buffer.append("\\n");
+                break;
+            }
+            case '\r': {
+                buffer.append("\\r");
+                break;
+            }
+            case '\t': {
+                buffer.append("\\t");
+                break;
+            }
+            default: {
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    buffer.append(fmt::format("\\u{:04x}", static_cast<unsigned char>(c)));
+                } else {
+                    buffer.push_back(c);
+                }
+            }
+        }
+    }
+    buffer.push_back('"');
+}
+
+} // namespace
+
+void PhysicalExport::Init() {
+    json_keys_.clear();
+    json_keys_.reserve(table_entry_->ColumnCount());
+    for (const auto &column_def : table_entry_->column_defs()) {
+        String key;
+        AppendJSONString(key, column_def->name_);
+        key.push_back(':');
+        json_keys_.push_back(std::move(key));
+    }
+}
+
+Vector<Vector<GlobalBlockID>> PhysicalExport::PlanSegmentBlocks(SizeT task_count) const {
+    Vector<Vector<GlobalBlockID>> result(task_count);
+    HashMap<SegmentID, SizeT> segment_task_ids;
+    for (SizeT segment_idx = 0; segment_idx < block_index_->segments_.size(); ++segment_idx) {
+        segment_task_ids.emplace(block_index_->segments_[segment_idx]->segment_id(), segment_idx % task_count);
+    }
+    for (const auto &global_block_id : block_index_->global_blocks_) {
+        result[segment_task_ids[global_block_id.segment_id_]].push_back(global_block_id);
+    }
+    return result;
+}
+
+UniquePtr<ExportSharedData> PhysicalExport::MakeSharedData(SizeT task_count) const {
+    auto shared_data = MakeUnique<ExportSharedData>(file_path_, task_count);
+    switch (file_type_) {
+        case CopyFileType::kCSV: {
+            if (header_) {
+                String header_line;
+                for (SizeT column_idx = 0; const auto &column_def : table_entry_->column_defs()) {
+                    if (column_idx++ > 0) {
+                        header_line.push_back(delimiter_);
+                    }
+                    AppendCSVField(header_line, column_def->name_, delimiter_);
+                }
+                header_line.push_back('\n');
+                shared_data->AppendRaw(header_line);
+            }
+            break;
+        }
+        case CopyFileType::kJSON: {
+            shared_data->AppendRaw("[\n");
+            break;
+        }
+        default: {
+            break;
+        }
+    }
+    return shared_data;
+}
+
+bool PhysicalExport::Execute(QueryContext *query_context, OperatorState *operator_state) {
+    auto *export_op_state = static_cast<ExportOperatorState *>(operator_state);
+    ExportSharedData *export_shared_data = export_op_state->export_shared_data_;
+    const Vector<GlobalBlockID> &block_ids = export_op_state->block_ids_;
+    SizeT &block_ids_idx = export_op_state->block_ids_idx_;
+
+    BufferManager *buffer_mgr = query_context->storage()->buffer_manager();
+    TxnTimeStamp begin_ts = query_context->GetTxn()->BeginTS();
+    SizeT column_count = table_entry_->ColumnCount();
+
+    // Export one segment in each call, the rows are formatted into the buffer and written when the buffer is full.
+    String buffer;
+    SizeT buffer_row_count = 0;
+    if (block_ids_idx < block_ids.size()) {
+        SegmentID segment_id = block_ids[block_ids_idx].segment_id_;
+        for (; block_ids_idx < block_ids.size() && block_ids[block_ids_idx].segment_id_ == segment_id; ++block_ids_idx) {
+            BlockEntry *block_entry = block_index_->GetBlockEntry(segment_id, block_ids[block_ids_idx].block_id_);
+            Vector<ColumnVector> column_vectors;
+            column_vectors.reserve(column_count);
+            for (SizeT column_id = 0; column_id < column_count; ++column_id) {
+                BlockColumnEntry *block_column_entry = block_entry->GetColumnBlockEntry(column_id);
+                ColumnVector column_vector = block_column_entry->GetColumnVector(buffer_mgr);
+                if (!BlockColumnEntry::InPlaceUpdatable(*block_column_entry->column_type())) {
+                    column_vectors.push_back(std::move(column_vector));
+                    continue;
+                }
+                // A column updatable in place is copied, a later update doesn't change the rows being exported.
+                SizeT row_count = block_entry->row_count();
+                ColumnVector restored_vector(column_vector.data_type());
+                restored_vector.Initialize(ColumnVectorType::kFlat, row_count);
+                block_column_entry->ReadRows(restored_vector, column_vector, 0, row_count, begin_ts);
+                column_vectors.push_back(std::move(restored_vector));
+            }
+
+            BlockOffset read_offset = 0;
+            while (true) {
+                auto [row_begin, row_end] = block_entry->GetVisibleRange(begin_ts, read_offset);
+                if (row_begin == row_end) {
+                    break;
+                }
+                for (SizeT row_idx = row_begin; row_idx < row_end; ++row_idx) {
+                    switch (file_type_) {
+                        case CopyFileType::kCSV: {
+                            ExportCSVRow(column_vectors, row_idx, buffer);
+                            break;
+                        }
+                        case CopyFileType::kJSON: {
+                            if (!buffer.empty()) {
+                                buffer.append(RowSeparator());
+                            }
+                            ExportJSONRow(column_vectors, row_idx, buffer);
+                            break;
+                        }
+                        case CopyFileType::kJSONL: {
+                            ExportJSONRow(column_vectors, row_idx, buffer);
+                            buffer.push_back('\n');
+                            break;
+                        }
+                        case CopyFileType::kFVECS: {
+                            ExportFVECSRow(column_vectors, row_idx, buffer);
+                            break;
+                        }
+                        case CopyFileType::kBVECS:
+                        case CopyFileType::kIVECS:
+                        case CopyFileType::kFBIN:
+                        case CopyFileType::kPARQUET:
+                        case CopyFileType::kARROW:
+                        case CopyFileType::kInvalid: {
+                            UnrecoverableError("Invalid file type");
+                        }
+                    }
+                    ++buffer_row_count;
+                    if (buffer.size() >= DEFAULT_EXPORT_WRITE_BUFFER_SIZE) {
+                        export_shared_data->AppendRows(buffer, buffer_row_count, RowSeparator());
+                        buffer.clear();
+                        buffer_row_count = 0;
+                    }
+                }
+                read_offset = row_end;
+            }
+        }
+        if (buffer_row_count > 0) {
+            export_shared_data->AppendRows(buffer, buffer_row_count, RowSeparator());
+        }
+    }
+
+    if (block_ids_idx >= block_ids.size()) {
+        if (export_shared_data->FinishTask()) {
+            // The last task closes the file.
+            if (file_type_ == CopyFileType::kJSON) {
+                export_shared_data->AppendRaw(export_shared_data->RowCount() > 0 ? "\n]\n" : "]\n");
+            }
+            export_shared_data->Close();
+            export_op_state->result_msg_ = MakeUnique<String>(fmt::format("EXPORT {} Rows", export_shared_data->RowCount()));
+        }
+        export_op_state->SetComplete();
+    }
     return true;
 }
 
-void PhysicalExport::ExportCSV(QueryContext *) {}
+void PhysicalExport::ExportCSVRow(const Vector<ColumnVector> &column_vectors, SizeT row_idx, String &buffer) const {
+    for (SizeT column_idx = 0; column_idx < column_vectors.size(); ++column_idx) {
+        if (column_idx > 0) {
+            buffer.push_back(delimiter_);
+        }
+        const ColumnVector &column = column_vectors[column_idx];
+        if (!column.nulls_ptr_->IsTrue(row_idx)) {
+            // Null is an empty field
+            continue;
+        }
+        if (AppendNumericValue(buffer, column, row_idx)) {
+            continue;
+        }
+        if (column.data_type()->type() == kEmbedding) {
+            String embedding;
+            AppendEmbedding(embedding, column, row_idx, delimiter_);
+            AppendCSVField(buffer, embedding, delimiter_);
+        } else {
+            AppendCSVField(buffer, column.ToString(row_idx), delimiter_);
+        }
+    }
+    buffer.push_back('\n');
+}
+
+void PhysicalExport::ExportJSONRow(const Vector<ColumnVector> &column_vectors, SizeT row_idx, String &buffer) const {
+    buffer.push_back('{');
+    for (SizeT column_idx = 0; column_idx < column_vectors.size(); ++column_idx) {
+        if (column_idx > 0) {
+            buffer.push_back(',');
+        }
+        buffer.append(json_keys_[column_idx]);
+        const ColumnVector &column = column_vectors[column_idx];
+        if (!column.nulls_ptr_->IsTrue(row_idx) || !IsFiniteValue(column, row_idx)) {
+            buffer.append("null");
+            continue;
+        }
+        if (AppendNumericValue(buffer, column, row_idx)) {
+            continue;
+        }
+        switch (column.data_type()->type()) {
+            case kBoolean: {
+                buffer.append(column.ToString(row_idx));
+                break;
+            }
+            case kEmbedding: {
+                AppendEmbedding(buffer, column, row_idx, ',');
+                break;
+            }
+            default: {
+                AppendJSONString(buffer, column.ToString(row_idx));
+            }
+        }
+    }
+    buffer.push_back('}');
+}
+
+void PhysicalExport::ExportFVECSRow(const Vector<ColumnVector> &column_vectors, SizeT row_idx, String &buffer) const {
+    // The planner checks that the table has only one embedding column with float element.
+    const ColumnVector &column = column_vectors[0];
+    const auto *embedding_info = static_cast<EmbeddingInfo *>(column.data_type()->type_info().get());
+    i32 dimension = embedding_info->Dimension();
+    buffer.append(reinterpret_cast<const char *>(&dimension), sizeof(dimension));
+    buffer.append(column.data() + row_idx * embedding_info->Size(), embedding_info->Size());
+}
 
-void PhysicalExport::ExportJSON(QueryContext *) {}
+std::string_view PhysicalExport::RowSeparator() const { return file_type_ == CopyFileType::kJSON ? ",\n" : ""; }
 
 } // namespace infinity
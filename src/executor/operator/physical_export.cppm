@@ -27,12 +27,19 @@ import infinity_exception;
 import internal_types;
 import statement_common;
 import data_type;
+import table_entry;
+import block_index;
+import global_block_id;
+import column_vector;
+import export_data;
 
 namespace infinity {
 
 export class PhysicalExport : public PhysicalOperator {
 public:
     explicit PhysicalExport(u64 id,
+                            TableEntry *table_entry,
+                            SharedPtr<BlockIndex> block_index,
                             String schema_name,
                             String table_name,
                             String file_path,
@@ -40,8 +47,9 @@ public:
                             char delimiter,
                             CopyFileType type,
                             SharedPtr<Vector<LoadMeta>> load_metas)
-        : PhysicalOperator(PhysicalOperatorType::kExport, nullptr, nullptr, id, load_metas), file_type_(type), file_path_(std::move(file_path)),
-          table_name_(std::move(table_name)), schema_name_(std::move(schema_name)), header_(header), delimiter_(delimiter) {}
+        : PhysicalOperator(PhysicalOperatorType::kExport, nullptr, nullptr, id, load_metas), table_entry_(table_entry),
+          block_index_(std::move(block_index)), file_type_(type), file_path_(std::move(file_path)), table_name_(std::move(table_name)),
+          schema_name_(std::move(schema_name)), header_(header), delimiter_(delimiter) {}
 
     ~PhysicalExport() override = default;
 
@@ -53,14 +61,16 @@ public:
 
     inline SharedPtr<Vector<SharedPtr<DataType>>> GetOutputTypes() const final { return output_types_; }
 
-    SizeT TaskletCount() override {
-        UnrecoverableError("Not implement: TaskletCount not Implement");
-        return 0;
-    }
+    // One tasklet for each segment of the table.
+    SizeT TaskletCount() override { return block_index_->SegmentCount(); }
 
-    void ExportCSV(QueryContext *query_context);
+    // Assign the segments to the tasks in turn, the blocks of a task are grouped by segment.
+    Vector<Vector<GlobalBlockID>> PlanSegmentBlocks(SizeT task_count) const;
 
-    void ExportJSON(QueryContext *query_context);
+    // Create the output file shared by the tasks and write the header of the file.
+    UniquePtr<ExportSharedData> MakeSharedData(SizeT task_count) const;
+
+    inline TableEntry *table_entry() const { return table_entry_; }
 
     inline CopyFileType FileType() const { return file_type_; }
 
@@ -75,9 +85,24 @@ public:
     inline char delimiter() const { return delimiter_; }
 
 private:
+    // Append the row of the block to the buffer in the format of the file.
+    void ExportCSVRow(const Vector<ColumnVector> &column_vectors, SizeT row_idx, String &buffer) const;
+
+    void ExportJSONRow(const Vector<ColumnVector> &column_vectors, SizeT row_idx, String &buffer) const;
+
+    void ExportFVECSRow(const Vector<ColumnVector> &column_vectors, SizeT row_idx, String &buffer) const;
+
+    // Separator written between the buffers of rows.
+    std::string_view RowSeparator() const;
+
     SharedPtr<Vector<String>> output_names_{};
     SharedPtr<Vector<SharedPtr<DataType>>> output_types_{};
 
+    TableEntry *table_entry_{};
+    SharedPtr<BlockIndex> block_index_{};
+    // Quoted JSON keys of the columns.
+    Vector<String> json_keys_{};
+
     CopyFileType file_type_{CopyFileType::kCSV};
     String file_path_{};
     String table_name_{};
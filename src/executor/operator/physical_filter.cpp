@@ -26,7 +26,10 @@ import physical_operator_type;
 import operator_state;
 import expression_state;
 import expression_selector;
+import fused_expression;
+import default_values;
 import data_block;
+import selection;
 import logger;
 import third_party;
 
@@ -64,20 +67,48 @@ bool PhysicalFilter::Execute(QueryContext *, OperatorState *operator_state) {
     }
 
     SizeT input_block_count = prev_op_state->data_block_array_.size();
+    SharedPtr<ExpressionState> &condition_state = filter_operator_state->condition_state_;
 
     for(SizeT block_idx = 0; block_idx < input_block_count; ++ block_idx) {
-
-        // create uninitialized data block for output
-        UniquePtr<DataBlock> data_block = DataBlock::MakeUniquePtr();
-        DataBlock* output_data_block = data_block.get();
-        operator_state->data_block_array_.emplace_back(std::move(data_block));
-
-        SharedPtr<ExpressionState> condition_state = ExpressionState::CreateState(condition_);
-        DataBlock* input_data_block = prev_op_state->data_block_array_[block_idx].get();
-
-        // selector contains a pointer to input data, which should not be shared by multiple tasks
-        ExpressionSelector selector;
-        SizeT selected_count = selector.Select(condition_, condition_state, input_data_block, output_data_block, input_data_block->row_count());
+        UniquePtr<DataBlock> &input_data_block = prev_op_state->data_block_array_[block_idx];
+        // The predicate selects the rows of the dense columns.
+        input_data_block->Materialize();
+
+        if (filter_operator_state->evaluated_block_count_++ == FUSED_EXPRESSION_MIN_BLOCKS) {
+            filter_operator_state->fused_condition_ = FusedExpression::Get(condition_);
+        }
+        SharedPtr<Selection> selection = nullptr;
+        if (const FusedExpression *fused_condition = filter_operator_state->fused_condition_.get(); fused_condition != nullptr) {
+            selection = MakeShared<Selection>();
+            selection->Initialize(input_data_block->row_count());
+            if (!fused_condition->Select(*input_data_block, *selection)) {
+                // a null or an overflow in the block
+                selection = nullptr;
+            }
+        }
+        if (selection.get() == nullptr) {
+            condition_state->ResetOutputs();
+
+            // selector contains a pointer to input data, which should not be shared by multiple tasks
+            ExpressionSelector selector;
+            selection = selector.Select(condition_, condition_state, input_data_block.get(), input_data_block->row_count());
+        }
+        SizeT selected_count = selection->Size();
+
+        if (selected_count == input_data_block->row_count()) {
+            // All rows are selected, the input block is the output.
+            operator_state->data_block_array_.emplace_back(std::move(input_data_block));
+        } else {
+            // create uninitialized data block for output
+            UniquePtr<DataBlock> output_data_block = DataBlock::MakeUniquePtr();
+            if (filter_operator_state->keep_selection_) {
+                // The columns are copied by the sink or evaluated by the projection on the selected rows only.
+                output_data_block->InitWithSelection(input_data_block.get(), std::move(selection));
+            } else {
+                output_data_block->Init(input_data_block.get(), selection);
+            }
+            operator_state->data_block_array_.emplace_back(std::move(output_data_block));
+        }
 
         LOG_TRACE(fmt::format("{} rows after filter", selected_count));
     }
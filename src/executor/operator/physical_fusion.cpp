@@ -14,8 +14,12 @@
 
 module;
 
+#include <algorithm>
+#include <bit>
+#include <cmath>
 #include <cstdlib>
 #include <string>
+#include <tuple>
 
 module physical_fusion;
 
@@ -41,21 +45,140 @@ import third_party;
 import infinity_exception;
 import value;
 import internal_types;
+import physical_knn_scan;
+import physical_merge_knn;
+import knn_expression;
+import knn_expr;
+import base_table_ref;
+import block_entry;
+import block_column_entry;
+import buffer_manager;
+import column_expression;
+import merge_knn;
+import knn_result_handler;
+import bitmask;
+import index_base;
+import vector_distance;
+import txn;
+import block_index;
+import storage;
+import embedding_info;
+import data_type;
+import pool_allocator;
 
 namespace infinity {
 
-struct RRFRankDoc {
-    RowID row_id;
-    float score;
-    Vector<SizeT> ranks;
+namespace {
+
+enum class FusionMethod {
+    kRRF,
+    kWeightedSum,
+};
+
+enum class FusionNormalization {
+    kNone,
+    kMinMax,
+    kZScore,
+};
+
+struct FusionDoc {
+    RowID row_id_;
+    f32 score_{0.0F};
+    // The columns are output from the first input with the doc
+    u32 input_idx_{0};
+    u32 block_idx_{0};
+    u32 row_idx_{0};
 };
 
+// The topn of the rows, the index of a row is the segment offset of its result
+template <template <typename, typename> typename C>
+Vector<Pair<SizeT, f32>> RerankTopN(const KnnExpression &rerank_expr, const f32 *query, const f32 *rows, u32 row_dim, SizeT row_count) {
+    MetricType metric = MetricType::kMetricL2;
+    if (rerank_expr.distance_type_ == KnnDistanceType::kInnerProduct) {
+        metric = MetricType::kMetricInnerProduct;
+    } else if (rerank_expr.distance_type_ == KnnDistanceType::kCosine) {
+        metric = MetricType::kMetricCosine;
+    }
+    u32 token_dim = 0;
+    for (const auto &opt_param : rerank_expr.opt_params_) {
+        if (opt_param.param_name_ == "token_dim") {
+            token_dim = std::strtoul(opt_param.param_value_.c_str(), nullptr, 10);
+        }
+    }
+
+    MergeKnn<f32, C> merge_knn(1, rerank_expr.topn_);
+    merge_knn.Begin();
+    for (SizeT begin_idx = 0; begin_idx < row_count; begin_idx += DEFAULT_BLOCK_CAPACITY) {
+        u16 block_row_count = std::min<SizeT>(DEFAULT_BLOCK_CAPACITY, row_count - begin_idx);
+        u16 block_id = begin_idx / DEFAULT_BLOCK_CAPACITY;
+        const f32 *block_rows = rows + begin_idx * row_dim;
+        Bitmask bitmask;
+        bitmask.Initialize(std::bit_ceil(block_row_count));
+        if (rerank_expr.distance_type_ == KnnDistanceType::kMaxSim) {
+            merge_knn.SearchMaxSim(query, rerank_expr.dimension_, block_rows, row_dim, token_dim, block_row_count, 0, block_id, bitmask);
+        } else {
+            merge_knn.SearchGemm(query, block_rows, row_dim, metric, block_row_count, 0, block_id, bitmask);
+        }
+    }
+    merge_knn.End();
+
+    i64 result_count = merge_knn.ResultCount(0);
+    const f32 *scores = merge_knn.GetDistancesByIdx(0);
+    const RowID *ids = merge_knn.GetIDsByIdx(0);
+    Vector<Pair<SizeT, f32>> result;
+    result.reserve(result_count);
+    for (i64 i = 0; i < result_count; ++i) {
+        result.emplace_back(ids[i].segment_offset_, scores[i]);
+    }
+    return result;
+}
+
+// A knn input is ranked by distance for l2 and hamming, the lower the better
+bool LowerIsBetter(const PhysicalOperator *input) {
+    const KnnExpression *knn_expression = nullptr;
+    switch (input->operator_type()) {
+        case PhysicalOperatorType::kKnnScan: {
+            knn_expression = static_cast<const PhysicalKnnScan *>(input)->knn_expression_.get();
+            break;
+        }
+        case PhysicalOperatorType::kMergeKnn: {
+            knn_expression = static_cast<const PhysicalMergeKnn *>(input)->knn_expression_.get();
+            break;
+        }
+        default: {
+            return false;
+        }
+    }
+    return knn_expression->distance_type_ == KnnDistanceType::kL2 || knn_expression->distance_type_ == KnnDistanceType::kHamming;
+}
+
+Vector<f64> ParseWeights(const String &weights_str) {
+    Vector<f64> weights;
+    SizeT begin_idx = 0;
+    while (begin_idx <= weights_str.size()) {
+        SizeT comma_idx = std::min(weights_str.find(',', begin_idx), weights_str.size());
+        String weight_str = weights_str.substr(begin_idx, comma_idx - begin_idx);
+        char *end_ptr = nullptr;
+        f64 weight = std::strtod(weight_str.c_str(), &end_ptr);
+        if (weight_str.empty() || *end_ptr != '\0' || !std::isfinite(weight)) {
+            RecoverableError(Status::InvalidParameterValue("weights", weights_str, "comma separated numbers, one for each input"));
+        }
+        weights.push_back(weight);
+        begin_idx = comma_idx + 1;
+    }
+    return weights;
+}
+
+} // namespace
+
 PhysicalFusion::PhysicalFusion(u64 id,
                                UniquePtr<PhysicalOperator> left,
                                UniquePtr<PhysicalOperator> right,
                                SharedPtr<FusionExpression> fusion_expr,
+                               SharedPtr<BaseTableRef> base_table_ref,
                                SharedPtr<Vector<LoadMeta>> load_metas)
-    : PhysicalOperator(PhysicalOperatorType::kFusion, std::move(left), std::move(right), id, load_metas), fusion_expr_(fusion_expr) {}
+    : PhysicalOperator(PhysicalOperatorType::kFusion, std::move(left), std::move(right), id, load_metas), fusion_expr_(fusion_expr),
+      base_table_ref_(std::move(base_table_ref)) {}
 
 PhysicalFusion::~PhysicalFusion() {}
 
@@ -66,106 +189,190 @@ bool PhysicalFusion::Execute(QueryContext *query_context, OperatorState *operato
     if (!fusion_operator_state->input_complete_) {
         return false;
     }
-    if (fusion_expr_->method_.compare("rrf") != 0) {
+    FusionMethod method = FusionMethod::kRRF;
+    if (fusion_expr_->method_.compare("rrf") == 0) {
+        method = FusionMethod::kRRF;
+    } else if (fusion_expr_->method_.compare("weighted_sum") == 0) {
+        method = FusionMethod::kWeightedSum;
+    } else {
         RecoverableError(Status::NotSupport(fmt::format("Fusion method {} is not implemented.", fusion_expr_->method_)));
     }
+    Map<String, String> empty_options;
+    const Map<String, String> &options = fusion_expr_->options_.get() != nullptr ? fusion_expr_->options_->options_ : empty_options;
+
     SizeT rank_constant = 60;
-    if (fusion_expr_->options_.get() != nullptr) {
-        if (auto it = fusion_expr_->options_->options_.find("rank_constant"); it != fusion_expr_->options_->options_.end()) {
-            long l = std::strtol(it->second.c_str(), NULL, 10);
-            if (l > 1) {
-                rank_constant = (SizeT)l;
-            }
+    if (auto it = options.find("rank_constant"); it != options.end()) {
+        long l = std::strtol(it->second.c_str(), NULL, 10);
+        if (l > 1) {
+            rank_constant = (SizeT)l;
+        }
+    }
+    // All the docs are output without topn
+    SizeT topn = std::numeric_limits<SizeT>::max();
+    if (auto it = options.find("topn"); it != options.end()) {
+        long l = std::strtol(it->second.c_str(), NULL, 10);
+        if (l <= 0) {
+            RecoverableError(Status::InvalidParameterValue("topn", it->second, "a positive integer"));
+        }
+        topn = (SizeT)l;
+    }
+    FusionNormalization normalization = FusionNormalization::kMinMax;
+    if (auto it = options.find("normalize"); it != options.end()) {
+        if (it->second == "minmax") {
+            normalization = FusionNormalization::kMinMax;
+        } else if (it->second == "zscore") {
+            normalization = FusionNormalization::kZScore;
+        } else if (it->second == "none") {
+            normalization = FusionNormalization::kNone;
+        } else {
+            RecoverableError(Status::InvalidParameterValue("normalize", it->second, "minmax, zscore or none"));
         }
     }
 
-    Vector<RRFRankDoc> rrf_vec;
-    Map<RowID, SizeT> rrf_map; // row_id to index of rrf_vec_
-    Vector<u64> fragment_ids;
-    SizeT fragment_idx = 0;
-    // 1 calculate every doc's ranks
-    for (auto &[fragment_id, input_blocks] : fusion_operator_state->input_data_blocks_) {
-        fragment_ids.push_back(fragment_id);
-        SizeT base_rank = 1;
+    // The child fragments are numbered in the order of the inputs, left before right
+    auto &inputs = fusion_operator_state->input_data_blocks_;
+    PhysicalOperator *input_ops[] = {left_.get(), right_.get()};
+    if (inputs.size() > 2 || (inputs.size() == 2 && right_.get() == nullptr)) {
+        UnrecoverableError(fmt::format("Fusion has {} inputs, expect at most 2.", inputs.size()));
+    }
+    Vector<f64> weights(inputs.size(), 1.0);
+    if (auto it = options.find("weights"); it != options.end()) {
+        weights = ParseWeights(it->second);
+        if (weights.size() != inputs.size()) {
+            RecoverableError(Status::InvalidParameterValue("weights", it->second, fmt::format("{} weights, one for each input", inputs.size())));
+        }
+    }
+
+    SizeT total_row_count = 0;
+    for (auto &[fragment_id, input_blocks] : inputs) {
         for (UniquePtr<DataBlock> &input_data_block : input_blocks) {
             if (input_data_block->column_count() != GetOutputTypes()->size()) {
                 UnrecoverableError(fmt::format("input_data_block column count {} is incorrect, expect {}.",
                                                input_data_block->column_count(),
                                                GetOutputTypes()->size()));
             }
-            auto &row_id_column = *input_data_block->column_vectors[input_data_block->column_count() - 1];
-            auto row_ids = reinterpret_cast<RowID *>(row_id_column.data());
-            SizeT row_n = input_data_block->row_count();
-            for (SizeT i = 0; i < row_n; i++) {
-                RowID docId = row_ids[i];
-                if (rrf_map.find(docId) == rrf_map.end()) {
-                    RRFRankDoc doc;
-                    doc.row_id = docId;
-                    rrf_vec.push_back(doc);
-                    rrf_map[docId] = rrf_vec.size() - 1;
+            total_row_count += input_data_block->row_count();
+        }
+    }
+
+    // 1 merge the inputs, each of which is sorted from the best, in one pass over its rows
+    using FusionDocs = Vector<FusionDoc, PoolAllocator<FusionDoc>>;
+    PoolAllocator<FusionDoc> doc_allocator(query_context->query_pool());
+    FusionDocs docs(doc_allocator);
+    docs.reserve(total_row_count);
+    FlatHashMap<u64, SizeT> doc_idx_map; // row id to the index of docs
+    doc_idx_map.reserve(total_row_count);
+    u32 input_idx = 0;
+    for (auto &[fragment_id, input_blocks] : inputs) {
+        f64 sign = LowerIsBetter(input_ops[input_idx]) ? -1.0 : 1.0;
+        f64 offset = 0.0;
+        f64 scale = 1.0;
+        if (method == FusionMethod::kWeightedSum && normalization != FusionNormalization::kNone) {
+            f64 min_score = std::numeric_limits<f64>::max();
+            f64 max_score = std::numeric_limits<f64>::lowest();
+            f64 sum = 0.0;
+            f64 square_sum = 0.0;
+            SizeT row_count = 0;
+            for (UniquePtr<DataBlock> &input_data_block : input_blocks) {
+                auto scores = reinterpret_cast<const f32 *>(input_data_block->column_vectors[input_data_block->column_count() - 2]->data());
+                for (SizeT i = 0; i < input_data_block->row_count(); ++i) {
+                    f64 score = sign * scores[i];
+                    min_score = std::min(min_score, score);
+                    max_score = std::max(max_score, score);
+                    sum += score;
+                    square_sum += score * score;
                 }
-                RRFRankDoc &doc = rrf_vec[rrf_map[docId]];
-                doc.ranks.resize(fragment_idx + 1, 0);
-                doc.ranks[fragment_idx] = base_rank + i;
+                row_count += input_data_block->row_count();
+            }
+            if (normalization == FusionNormalization::kMinMax) {
+                // Equal scores are all the best
+                offset = max_score > min_score ? min_score : min_score - 1.0;
+                scale = max_score > min_score ? 1.0 / (max_score - min_score) : 1.0;
+            } else if (row_count > 0) {
+                f64 mean = sum / row_count;
+                f64 stddev = std::sqrt(std::max(0.0, square_sum / row_count - mean * mean));
+                offset = mean;
+                scale = stddev > 0.0 ? 1.0 / stddev : 0.0;
             }
-            base_rank += row_n;
         }
-        fragment_idx++;
+
+        SizeT rank = 1;
+        for (u32 block_idx = 0; block_idx < input_blocks.size(); ++block_idx) {
+            DataBlock *input_data_block = input_blocks[block_idx].get();
+            auto scores = reinterpret_cast<const f32 *>(input_data_block->column_vectors[input_data_block->column_count() - 2]->data());
+            auto row_ids = reinterpret_cast<const RowID *>(input_data_block->column_vectors[input_data_block->column_count() - 1]->data());
+            for (u32 row_idx = 0; row_idx < input_data_block->row_count(); ++row_idx, ++rank) {
+                f64 score;
+                if (method == FusionMethod::kRRF) {
+                    score = 1.0 / (rank_constant + rank);
+                } else {
+                    // A doc missing from an input gets 0 from it
+                    score = weights[input_idx] * (sign * scores[row_idx] - offset) * scale;
+                }
+                auto [iter, inserted] = doc_idx_map.try_emplace(row_ids[row_idx].ToUint64(), docs.size());
+                if (inserted) {
+                    docs.push_back(FusionDoc{row_ids[row_idx], 0.0F, input_idx, block_idx, row_idx});
+                }
+                docs[iter->second].score_ += score;
+            }
+        }
+        ++input_idx;
+    }
+
+    // 2 select the topn docs in reverse per their score, the ties in the order they are met
+    auto doc_greater = [](const FusionDoc &lhs, const FusionDoc &rhs) noexcept {
+        return std::tie(rhs.score_, lhs.input_idx_, lhs.block_idx_, lhs.row_idx_) <
+               std::tie(lhs.score_, rhs.input_idx_, rhs.block_idx_, rhs.row_idx_);
+    };
+    if (topn < docs.size()) {
+        std::partial_sort(docs.begin(), docs.begin() + topn, docs.end(), doc_greater);
+        docs.resize(topn);
+    } else {
+        std::sort(docs.begin(), docs.end(), doc_greater);
     }
 
-    // 2 calculate every doc's score
-    for (auto &doc : rrf_vec) {
-        doc.score = 0.0F;
-        for (auto &rank : doc.ranks) {
-            if (rank == 0)
-                continue;
-            doc.score += 1.0F / (rank_constant + rank);
+    // 3 rerank the fused docs, the score of the rerank replaces the fused one
+    if (fusion_expr_->rerank_expr_.get() != nullptr) {
+        Vector<RowID> candidates;
+        candidates.reserve(docs.size());
+        for (const FusionDoc &doc : docs) {
+            candidates.push_back(doc.row_id_);
         }
+        FusionDocs reranked_docs(doc_allocator);
+        reranked_docs.reserve(docs.size());
+        for (const auto &[doc_idx, score] : Rerank(query_context, candidates)) {
+            reranked_docs.push_back(docs[doc_idx]);
+            reranked_docs.back().score_ = score;
+        }
+        docs = std::move(reranked_docs);
     }
-    // 3 sort docs in reverse per their score
-    std::sort(std::begin(rrf_vec), std::end(rrf_vec), [](const RRFRankDoc &lhs, const RRFRankDoc &rhs) noexcept { return lhs.score > rhs.score; });
 
     // 4 generate output data blocks
     UniquePtr<DataBlock> output_data_block = DataBlock::MakeUniquePtr();
     output_data_block->Init(*GetOutputTypes());
     SizeT row_count = 0;
-    for (RRFRankDoc &doc : rrf_vec) {
-        // 4.1 get every doc's columns from input data blocks
+    SizeT column_n = GetOutputTypes()->size() - 2;
+    Vector<Vector<UniquePtr<DataBlock>> *> input_blocks_list;
+    for (auto &[fragment_id, input_blocks] : inputs) {
+        input_blocks_list.push_back(&input_blocks);
+    }
+    for (const FusionDoc &doc : docs) {
         if (row_count == output_data_block->capacity()) {
             output_data_block->Finalize();
             operator_state->data_block_array_.push_back(std::move(output_data_block));
             output_data_block = DataBlock::MakeUniquePtr();
+            output_data_block->Init(*GetOutputTypes());
             row_count = 0;
         }
-        SizeT fragment_idx = 0;
-        while (fragment_idx < doc.ranks.size() && doc.ranks[fragment_idx] == 0)
-            fragment_idx++;
-        if (fragment_idx >= doc.ranks.size()) {
-            UnrecoverableError(fmt::format("Cannot find fragment_idx"));
-        }
-        u64 fragment_id = fragment_ids[fragment_idx];
-        auto &input_blocks = fusion_operator_state->input_data_blocks_[fragment_id];
-        if (input_blocks.size() == 0) {
-            UnrecoverableError(fmt::format("input_data_blocks_[{}] is empty.", fragment_id));
-        }
-        SizeT block_idx = 0;
-        SizeT row_idx = doc.ranks[fragment_idx] - 1;
-        while (row_idx >= input_blocks[block_idx]->row_count()) {
-            row_idx -= input_blocks[block_idx]->row_count();
-            block_idx++;
-        }
-        if (block_idx >= input_blocks.size()) {
-            UnrecoverableError(fmt::format("Cannot find block_idx"));
-        }
-
-        SizeT column_n = GetOutputTypes()->size() - 2;
+        // 4.1 get every doc's columns from its input data block
+        DataBlock *input_data_block = (*input_blocks_list[doc.input_idx_])[doc.block_idx_].get();
         for (SizeT i = 0; i < column_n; ++i) {
-            output_data_block->column_vectors[i]->AppendWith(*input_blocks[block_idx]->column_vectors[i], row_idx, 1);
+            output_data_block->column_vectors[i]->AppendWith(*input_data_block->column_vectors[i], doc.row_idx_, 1);
         }
         // 4.2 add hidden columns: score, row_id
-        Value v = Value::MakeFloat(doc.score);
+        Value v = Value::MakeFloat(doc.score_);
         output_data_block->column_vectors[column_n]->AppendValue(v);
-        output_data_block->column_vectors[column_n + 1]->AppendWith(doc.row_id, 1);
+        output_data_block->column_vectors[column_n + 1]->AppendWith(doc.row_id_, 1);
         row_count++;
     }
     output_data_block->Finalize();
@@ -175,6 +382,53 @@ bool PhysicalFusion::Execute(QueryContext *query_context, OperatorState *operato
     return true;
 }
 
+Vector<Pair<SizeT, f32>> PhysicalFusion::Rerank(QueryContext *query_context, const Vector<RowID> &candidates) const {
+    const KnnExpression &rerank_expr = *fusion_expr_->rerank_expr_;
+    auto *column_expr = static_cast<ColumnExpression *>(rerank_expr.arguments()[0].get());
+    SizeT column_id = column_expr->binding().column_idx;
+    SharedPtr<DataType> column_type = MakeShared<DataType>(column_expr->Type());
+    const u32 row_dim = static_cast<const EmbeddingInfo *>(column_type->type_info().get())->Dimension();
+    if (candidates.empty()) {
+        return {};
+    }
+
+    // 1 only the embeddings of the candidates are read
+    BufferManager *buffer_mgr = query_context->storage()->buffer_manager();
+    TxnTimeStamp begin_ts = query_context->GetTxn()->BeginTS();
+    ColumnVector embeddings(column_type);
+    embeddings.Initialize(ColumnVectorType::kFlat, candidates.size());
+    for (const RowID &row_id : candidates) {
+        u16 block_id = row_id.segment_offset_ / DEFAULT_BLOCK_CAPACITY;
+        u16 block_offset = row_id.segment_offset_ % DEFAULT_BLOCK_CAPACITY;
+        const BlockEntry *block_entry = base_table_ref_->block_index_->GetBlockEntry(row_id.segment_id_, block_id);
+        BlockColumnEntry *block_column_entry = block_entry->GetColumnBlockEntry(column_id);
+        ColumnVector column_vector = block_column_entry->GetColumnVector(buffer_mgr);
+        block_column_entry->ReadRows(embeddings, column_vector, block_offset, 1, begin_ts);
+    }
+    const auto *rows = reinterpret_cast<const f32 *>(embeddings.data());
+
+    // 2 score them with the kernels of the knn scan
+    const auto *query = reinterpret_cast<const f32 *>(rerank_expr.query_embedding_.ptr);
+    switch (rerank_expr.distance_type_) {
+        case KnnDistanceType::kL2: {
+            return RerankTopN<CompareMax>(rerank_expr, query, rows, row_dim, candidates.size());
+        }
+        case KnnDistanceType::kCosine: {
+            Vector<f32> unit_query(rerank_expr.dimension_);
+            L2Normalize(unit_query.data(), query, rerank_expr.dimension_);
+            return RerankTopN<CompareMin>(rerank_expr, unit_query.data(), rows, row_dim, candidates.size());
+        }
+        case KnnDistanceType::kInnerProduct:
+        case KnnDistanceType::kMaxSim: {
+            return RerankTopN<CompareMin>(rerank_expr, query, rows, row_dim, candidates.size());
+        }
+        default: {
+            UnrecoverableError(fmt::format("Invalid rerank distance type: {}", (i32)rerank_expr.distance_type_));
+        }
+    }
+    return {};
+}
+
 String PhysicalFusion::ToString(i64 &space) const {
     String arrow_str;
     if (space != 0) {
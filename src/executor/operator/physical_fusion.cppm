@@ -28,6 +28,7 @@ import load_meta;
 import infinity_exception;
 import internal_types;
 import data_type;
+import base_table_ref;
 
 namespace infinity {
 
@@ -37,6 +38,7 @@ public:
                             UniquePtr<PhysicalOperator> left,
                             UniquePtr<PhysicalOperator> right,
                             SharedPtr<FusionExpression> fusion_expr,
+                            SharedPtr<BaseTableRef> base_table_ref,
                             SharedPtr<Vector<LoadMeta>> load_metas);
     ~PhysicalFusion() override;
 
@@ -58,7 +60,11 @@ public:
     SharedPtr<FusionExpression> fusion_expr_;
 
 private:
+    // Scores the candidates against the rerank embedding, which is read for them only, and returns the topn of the rerank as
+    // pairs of the candidate index and the score, from the best.
+    Vector<Pair<SizeT, f32>> Rerank(QueryContext *query_context, const Vector<RowID> &candidates) const;
 
+    SharedPtr<BaseTableRef> base_table_ref_{};
 };
 
 } // namespace infinity
@@ -14,19 +14,714 @@
 
 module;
 
+#include <cstring>
 #include <string>
+
+module physical_hash_join;
+
+import stl;
 import query_context;
 import operator_state;
-import stl;
+import query_memory_tracker;
+import physical_operator;
+import physical_operator_type;
+import base_expression;
+import expression_type;
+import function_expression;
+import reference_expression;
+import data_block;
+import column_vector;
+import selection;
+import expression_evaluator;
+import expression_selector;
+import expression_state;
+import default_values;
+import internal_types;
+import logical_type;
+import data_type;
+import join_reference;
+import storage;
+import buffer_manager;
+import local_file_system;
+import file_system;
+import file_system_type;
+import random;
+import io_counter;
+import hash_table;
+import infinity_exception;
+import third_party;
+import logger;
+import physical_table_scan;
+import physical_index_scan;
+import block_index;
+import join_runtime_filter;
 
+namespace infinity {
 
-module physical_hash_join;
+namespace {
 
-namespace infinity {
+// Both inputs are split into 2^JOIN_PARTITION_BITS partitions by the high bits of the key hash when spilled.
+constexpr SizeT JOIN_PARTITION_BITS = 4;
+constexpr SizeT JOIN_PARTITION_COUNT = 1 << JOIN_PARTITION_BITS;
+constexpr u32 INVALID_ROW = std::numeric_limits<u32>::max();
+
+inline SizeT JoinPartitionOf(u64 hash) { return hash >> (64 - JOIN_PARTITION_BITS); }
+
+// A runtime filter only pays for the delayed start of the probe scan if it is at least so many times larger than the build scan.
+constexpr SizeT RUNTIME_FILTER_MIN_PROBE_BUILD_RATIO = 4;
+
+// The table or index scan under a chain of filters which keep the columns of the scan, nullptr if there isn't.
+PhysicalOperator *ScanUnderFilters(PhysicalOperator *op) {
+    while (op != nullptr) {
+        if (op->load_metas().get() != nullptr && !op->load_metas()->empty()) {
+            return nullptr;
+        }
+        switch (op->operator_type()) {
+            case PhysicalOperatorType::kFilter: {
+                op = op->left();
+                break;
+            }
+            case PhysicalOperatorType::kTableScan:
+            case PhysicalOperatorType::kIndexScan: {
+                return op;
+            }
+            default: {
+                return nullptr;
+            }
+        }
+    }
+    return nullptr;
+}
+
+SizeT ScanRowCount(PhysicalOperator *scan) {
+    if (scan->operator_type() == PhysicalOperatorType::kTableScan) {
+        return static_cast<PhysicalTableScan *>(scan)->GetBlockIndex()->RowCount();
+    }
+    return static_cast<PhysicalIndexScan *>(scan)->EstimatedRowCount();
+}
+
+// The table column of the output column column_idx of the scan, None for the row id.
+Optional<ColumnID> ScanColumnID(PhysicalOperator *scan, SizeT column_idx) {
+    if (scan->operator_type() == PhysicalOperatorType::kTableScan) {
+        const Vector<SizeT> &column_ids = static_cast<PhysicalTableScan *>(scan)->ColumnIDs();
+        if (column_idx >= column_ids.size() || column_ids[column_idx] == COLUMN_IDENTIFIER_ROW_ID) {
+            return None;
+        }
+        return column_ids[column_idx];
+    }
+    const Optional<ColumnID> &covered_column_id = static_cast<PhysicalIndexScan *>(scan)->covered_column_id();
+    if (column_idx != 0) {
+        return None;
+    }
+    return covered_column_id;
+}
+
+Vector<SharedPtr<ColumnVector>> KeyColumns(const DataBlock *data_block, const Vector<SizeT> &key_ids) {
+    Vector<SharedPtr<ColumnVector>> key_columns;
+    key_columns.reserve(key_ids.size());
+    for (SizeT key_id : key_ids) {
+        key_columns.emplace_back(data_block->column_vectors[key_id]);
+    }
+    return key_columns;
+}
+
+// Rows of the build side, chained by the group of their key in the hash table.
+struct JoinBuildRows {
+    void Build(const Vector<DataBlock *> &data_blocks, const Vector<SizeT> &key_ids, HashTable &hash_table) {
+        Vector<u32> group_ids;
+        Vector<bool> has_null;
+        for (SizeT block_idx = 0; block_idx < data_blocks.size(); ++block_idx) {
+            const DataBlock *data_block = data_blocks[block_idx];
+            SizeT row_count = data_block->row_count();
+            Vector<SharedPtr<ColumnVector>> key_columns = KeyColumns(data_block, key_ids);
+            HashTable::HasNull(key_columns, row_count, has_null);
+            hash_table.FindOrInsert(key_columns, row_count, group_ids);
+            for (SizeT row_idx = 0; row_idx < row_count; ++row_idx) {
+                if (rows_.size() >= INVALID_ROW) {
+                    UnrecoverableError("Too many rows in the build side of hash join.");
+                }
+                u32 build_row = rows_.size();
+                rows_.emplace_back(block_idx, row_idx);
+                next_.emplace_back(INVALID_ROW);
+                if (has_null[row_idx]) {
+                    // NULL equals nothing, the row is kept to be output as an unmatched row of outer join.
+                    continue;
+                }
+                u32 group_id = group_ids[row_idx];
+                if (group_id >= heads_.size()) {
+                    heads_.resize(group_id + 1, INVALID_ROW);
+                }
+                next_[build_row] = heads_[group_id];
+                heads_[group_id] = build_row;
+            }
+        }
+        matched_.assign(rows_.size(), false);
+    }
+
+    inline u32 Head(u32 group_id) const { return group_id < heads_.size() ? heads_[group_id] : INVALID_ROW; }
+
+    // (block index, row index) of each build row
+    Vector<Pair<u32, u32>> rows_{};
+    Vector<u32> next_{};
+    Vector<u32> heads_{};
+    Vector<bool> matched_{};
+};
+
+String SpillFilePath(const String &spill_dir, bool build_side, SizeT partition_idx) {
+    return fmt::format("{}/{}_{}", spill_dir, build_side ? "build" : "probe", partition_idx);
+}
+
+// Each block is written as its size followed by the serialized block.
+void WriteSpillFile(const String &file_path, const Vector<UniquePtr<DataBlock>> &data_blocks) {
+    LocalFileSystem fs;
+    u8 flags = FileFlags::WRITE_FLAG | FileFlags::CREATE_FLAG | FileFlags::APPEND_FLAG;
+    UniquePtr<FileHandler> file_handler = fs.OpenFile(file_path, flags, FileLockType::kWriteLock);
+    for (const auto &data_block : data_blocks) {
+        i32 block_size = data_block->GetSizeInBytes();
+        Vector<char> buffer(sizeof(block_size) + block_size);
+        std::memcpy(buffer.data(), &block_size, sizeof(block_size));
+        char *ptr = buffer.data() + sizeof(block_size);
+        data_block->WriteAdv(ptr);
+        fs.Write(*file_handler, buffer.data(), buffer.size());
+        ThreadIOCounter().spilled_bytes_ += buffer.size();
+    }
+    fs.Close(*file_handler);
+}
+
+Vector<SharedPtr<DataBlock>> ReadSpillFile(const String &file_path) {
+    Vector<SharedPtr<DataBlock>> data_blocks;
+    LocalFileSystem fs;
+    if (!fs.Exists(file_path)) {
+        return data_blocks;
+    }
+    UniquePtr<FileHandler> file_handler = fs.OpenFile(file_path, FileFlags::READ_FLAG, FileLockType::kReadLock);
+    SizeT file_size = fs.GetFileSize(*file_handler);
+    Vector<char> buffer(file_size);
+    i64 read_size = fs.Read(*file_handler, buffer.data(), file_size);
+    fs.Close(*file_handler);
+    if (read_size != (i64)file_size) {
+        UnrecoverableError(fmt::format("Fail to read hash join spill file: {}", file_path));
+    }
+
+    char *ptr = buffer.data();
+    char *const ptr_end = buffer.data() + file_size;
+    while (ptr < ptr_end) {
+        i32 block_size{};
+        std::memcpy(&block_size, ptr, sizeof(block_size));
+        ptr += sizeof(block_size);
+        data_blocks.emplace_back(DataBlock::ReadAdv(ptr, block_size));
+    }
+    return data_blocks;
+}
+
+// Split the rows of data blocks into the partitions by the hash of join key.
+Vector<Vector<UniquePtr<DataBlock>>>
+PartitionDataBlocks(const Vector<UniquePtr<DataBlock>> &data_blocks, const Vector<SizeT> &key_ids, const HashTable &hash_table) {
+    Vector<Vector<UniquePtr<DataBlock>>> partitions(JOIN_PARTITION_COUNT);
+    Vector<u64> hashes;
+    Vector<bool> has_null;
+    for (const auto &data_block : data_blocks) {
+        SizeT row_count = data_block->row_count();
+        Vector<SharedPtr<ColumnVector>> key_columns = KeyColumns(data_block.get(), key_ids);
+        hash_table.Hash(key_columns, row_count, hashes);
+        HashTable::HasNull(key_columns, row_count, has_null);
+
+        Vector<SharedPtr<Selection>> partition_selections(JOIN_PARTITION_COUNT);
+        for (SizeT row_idx = 0; row_idx < row_count; ++row_idx) {
+            SizeT partition_idx = has_null[row_idx] ? 0 : JoinPartitionOf(hashes[row_idx]);
+            SharedPtr<Selection> &selection = partition_selections[partition_idx];
+            if (selection.get() == nullptr) {
+                selection = MakeShared<Selection>();
+                selection->Initialize(row_count);
+            }
+            selection->Append(row_idx);
+        }
+
+        for (SizeT partition_idx = 0; partition_idx < JOIN_PARTITION_COUNT; ++partition_idx) {
+            if (partition_selections[partition_idx].get() == nullptr) {
+                continue;
+            }
+            UniquePtr<DataBlock> partition_block = DataBlock::MakeUniquePtr();
+            partition_block->Init(data_block.get(), partition_selections[partition_idx]);
+            partitions[partition_idx].emplace_back(std::move(partition_block));
+        }
+    }
+    return partitions;
+}
+
+} // namespace
+
+void PhysicalHashJoin::Init() {
+    left_column_count_ = left_->GetOutputTypes()->size();
+    for (const auto &condition : conditions_) {
+        SizeT left_idx{};
+        SizeT right_idx{};
+        if (IsEquiCondition(condition, left_column_count_, left_idx, right_idx)) {
+            left_key_ids_.emplace_back(left_idx);
+            right_key_ids_.emplace_back(right_idx);
+        } else {
+            residual_conditions_.emplace_back(condition);
+        }
+    }
+    if (left_key_ids_.empty()) {
+        UnrecoverableError("Hash join requires at least one equal condition between left and right input.");
+    }
+    SharedPtr<Vector<SharedPtr<DataType>>> right_types = right_->GetOutputTypes();
+    for (SizeT right_key_id : right_key_ids_) {
+        key_types_.emplace_back((*right_types)[right_key_id]);
+    }
+    input_types_ = *left_->GetOutputTypes();
+    input_types_.insert(input_types_.end(), right_types->begin(), right_types->end());
 
-void PhysicalHashJoin::Init() {}
+    output_types_ = GetOutputTypes();
+    SizeT max_type_size = 0;
+    for (const auto &output_type : *output_types_) {
+        max_type_size = std::max(max_type_size, output_type->Size());
+    }
+    padding_buffer_.assign(max_type_size, 0);
+}
 
-bool PhysicalHashJoin::Execute(QueryContext *, OperatorState *) { return true; }
+bool PhysicalHashJoin::IsEquiCondition(const SharedPtr<BaseExpression> &condition, SizeT left_column_count, SizeT &left_idx, SizeT &right_idx) {
+    if (condition->type() != ExpressionType::kFunction) {
+        return false;
+    }
+    auto *function_expression = static_cast<FunctionExpression *>(condition.get());
+    auto &arguments = function_expression->arguments();
+    if (function_expression->ScalarFunctionName() != "=" || arguments.size() != 2) {
+        return false;
+    }
+    if (arguments[0]->type() != ExpressionType::kReference || arguments[1]->type() != ExpressionType::kReference) {
+        return false;
+    }
+    if (arguments[0]->Type() != arguments[1]->Type() || !HashTable::IsHashableType(arguments[0]->Type())) {
+        return false;
+    }
+
+    SizeT lhs_idx = static_cast<ReferenceExpression *>(arguments[0].get())->column_index();
+    SizeT rhs_idx = static_cast<ReferenceExpression *>(arguments[1].get())->column_index();
+    if (lhs_idx < left_column_count && rhs_idx >= left_column_count) {
+        left_idx = lhs_idx;
+        right_idx = rhs_idx - left_column_count;
+        return true;
+    }
+    if (rhs_idx < left_column_count && lhs_idx >= left_column_count) {
+        left_idx = rhs_idx;
+        right_idx = lhs_idx - left_column_count;
+        return true;
+    }
+    return false;
+}
+
+bool PhysicalHashJoin::CanUseHashJoin(JoinType join_type, const Vector<SharedPtr<BaseExpression>> &conditions, SizeT left_column_count) {
+    switch (join_type) {
+        case JoinType::kInner:
+        case JoinType::kLeft:
+        case JoinType::kRight:
+        case JoinType::kFull:
+        case JoinType::kSemi:
+        case JoinType::kAnti: {
+            break;
+        }
+        default: {
+            return false;
+        }
+    }
+    for (const auto &condition : conditions) {
+        SizeT left_idx{};
+        SizeT right_idx{};
+        if (IsEquiCondition(condition, left_column_count, left_idx, right_idx)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void PhysicalHashJoin::PlanRuntimeFilter() {
+    // the unmatched probe rows of a left, full or anti join are output, they can't be skipped
+    if (join_type_ != JoinType::kInner && join_type_ != JoinType::kRight && join_type_ != JoinType::kSemi) {
+        return;
+    }
+    PhysicalOperator *probe_scan = ScanUnderFilters(left_.get());
+    PhysicalOperator *build_scan = ScanUnderFilters(right_.get());
+    if (probe_scan == nullptr || build_scan == nullptr) {
+        return;
+    }
+    if (ScanRowCount(build_scan) * RUNTIME_FILTER_MIN_PROBE_BUILD_RATIO > ScanRowCount(probe_scan)) {
+        return;
+    }
+    SizeT left_column_count = left_->GetOutputTypes()->size();
+    SharedPtr<Vector<SharedPtr<DataType>>> right_types = right_->GetOutputTypes();
+    for (const auto &condition : conditions_) {
+        SizeT left_idx{};
+        SizeT right_idx{};
+        if (!IsEquiCondition(condition, left_column_count, left_idx, right_idx)) {
+            continue;
+        }
+        Optional<ColumnID> probe_column_id = ScanColumnID(probe_scan, left_idx);
+        if (!probe_column_id.has_value()) {
+            continue;
+        }
+        runtime_filter_ = JoinRuntimeFilter::Make(*(*right_types)[right_idx], right_idx, *probe_column_id);
+        if (runtime_filter_.get() == nullptr) {
+            continue;
+        }
+        if (probe_scan->operator_type() == PhysicalOperatorType::kTableScan) {
+            static_cast<PhysicalTableScan *>(probe_scan)->AddJoinRuntimeFilter(runtime_filter_);
+        } else {
+            static_cast<PhysicalIndexScan *>(probe_scan)->AddJoinRuntimeFilter(runtime_filter_);
+        }
+        return;
+    }
+}
+
+bool PhysicalHashJoin::Execute(QueryContext *query_context, OperatorState *operator_state) {
+    auto *join_state = static_cast<HashJoinOperatorState *>(operator_state);
+    u64 memory_limit = query_context->memory_size_limit();
+    MemoryReservation &memory_reservation = join_state->memory_reservation_;
+    memory_reservation.Init(query_context->memory_tracker());
+    // The cached input is over the memory of the operator or the query takes more than the query memory limit.
+    bool within_query_limit = memory_reservation.Resize(join_state->buffered_bytes_);
+    bool over_limit = !within_query_limit || (memory_limit > 0 && join_state->buffered_bytes_ > memory_limit);
+    if (!join_state->input_complete_) {
+        // Partition the cached input into files to bound the memory, they are joined partition by partition at last.
+        if (over_limit) {
+            SpillInput(query_context, join_state);
+            memory_reservation.Resize(0);
+        }
+        return false;
+    }
+
+    if (join_state->spill_dir_.get() == nullptr && !over_limit) {
+        Vector<DataBlock *> build_blocks;
+        Vector<DataBlock *> probe_blocks;
+        for (const auto &data_block : join_state->build_data_blocks_) {
+            build_blocks.emplace_back(data_block.get());
+        }
+        for (const auto &data_block : join_state->probe_data_blocks_) {
+            probe_blocks.emplace_back(data_block.get());
+        }
+        JoinPartition(build_blocks, probe_blocks, join_state);
+    } else {
+        SpillInput(query_context, join_state);
+        const String &spill_dir = *join_state->spill_dir_;
+        for (SizeT partition_idx = 0; partition_idx < JOIN_PARTITION_COUNT; ++partition_idx) {
+            Vector<SharedPtr<DataBlock>> build_data_blocks = ReadSpillFile(SpillFilePath(spill_dir, true, partition_idx));
+            Vector<SharedPtr<DataBlock>> probe_data_blocks = ReadSpillFile(SpillFilePath(spill_dir, false, partition_idx));
+            Vector<DataBlock *> build_blocks;
+            Vector<DataBlock *> probe_blocks;
+            for (const auto &data_block : build_data_blocks) {
+                build_blocks.emplace_back(data_block.get());
+            }
+            for (const auto &data_block : probe_data_blocks) {
+                probe_blocks.emplace_back(data_block.get());
+            }
+            JoinPartition(build_blocks, probe_blocks, join_state);
+        }
+        LocalFileSystem fs;
+        fs.DeleteDirectory(spill_dir);
+        join_state->spill_dir_.reset();
+    }
+
+    join_state->build_data_blocks_.clear();
+    join_state->probe_data_blocks_.clear();
+    join_state->buffered_bytes_ = 0;
+    memory_reservation.Resize(0);
+
+    for (auto &output_block : join_state->data_block_array_) {
+        output_block->Finalize();
+    }
+    if (join_state->data_block_array_.empty()) {
+        // The operators after join always expect one block at least.
+        UniquePtr<DataBlock> output_block = DataBlock::MakeUniquePtr();
+        output_block->Init(*output_types_);
+        output_block->Finalize();
+        join_state->data_block_array_.emplace_back(std::move(output_block));
+    }
+    join_state->SetComplete();
+    return true;
+}
+
+void PhysicalHashJoin::SpillInput(QueryContext *query_context, HashJoinOperatorState *join_state) const {
+    if (join_state->spill_dir_.get() == nullptr) {
+        String temp_dir = *query_context->storage()->buffer_manager()->GetTempDir();
+        LocalFileSystem fs;
+        if (!fs.Exists(temp_dir)) {
+            fs.CreateDirectory(temp_dir);
+        }
+        join_state->spill_dir_ = DetermineRandomString(temp_dir, fmt::format("hash_join_{}", node_id()));
+        LOG_TRACE(fmt::format("Hash join {} spills input into {}", node_id(), *join_state->spill_dir_));
+    }
+
+    const String &spill_dir = *join_state->spill_dir_;
+    HashTable hash_table;
+    hash_table.Init(key_types_);
+    Vector<Vector<UniquePtr<DataBlock>>> build_partitions = PartitionDataBlocks(join_state->build_data_blocks_, right_key_ids_, hash_table);
+    Vector<Vector<UniquePtr<DataBlock>>> probe_partitions = PartitionDataBlocks(join_state->probe_data_blocks_, left_key_ids_, hash_table);
+    for (SizeT partition_idx = 0; partition_idx < JOIN_PARTITION_COUNT; ++partition_idx) {
+        if (!build_partitions[partition_idx].empty()) {
+            WriteSpillFile(SpillFilePath(spill_dir, true, partition_idx), build_partitions[partition_idx]);
+        }
+        if (!probe_partitions[partition_idx].empty()) {
+            WriteSpillFile(SpillFilePath(spill_dir, false, partition_idx), probe_partitions[partition_idx]);
+        }
+    }
+    join_state->build_data_blocks_.clear();
+    join_state->probe_data_blocks_.clear();
+    join_state->buffered_bytes_ = 0;
+    memory_reservation.Resize(0);
+}
+
+void PhysicalHashJoin::JoinPartition(const Vector<DataBlock *> &build_blocks,
+                                     const Vector<DataBlock *> &probe_blocks,
+                                     HashJoinOperatorState *join_state) const {
+    if (join_type_ == JoinType::kSemi || join_type_ == JoinType::kAnti) {
+        SemiJoinPartition(build_blocks, probe_blocks, join_state);
+        return;
+    }
+    bool output_left_unmatched = join_type_ == JoinType::kLeft || join_type_ == JoinType::kFull;
+    bool output_right_unmatched = join_type_ == JoinType::kRight || join_type_ == JoinType::kFull;
+
+    HashTable hash_table;
+    hash_table.Init(key_types_);
+    JoinBuildRows build_rows;
+    build_rows.Build(build_blocks, right_key_ids_, hash_table);
+
+    Vector<u32> group_ids;
+    Vector<bool> has_null;
+    for (const DataBlock *probe_block : probe_blocks) {
+        SizeT row_count = probe_block->row_count();
+        Vector<SharedPtr<ColumnVector>> key_columns = KeyColumns(probe_block, left_key_ids_);
+        HashTable::HasNull(key_columns, row_count, has_null);
+        hash_table.Find(key_columns, row_count, group_ids);
+        Vector<bool> probe_matched(row_count, false);
+
+        // (probe row, build row) pairs with equal keys, materialized into one block each time it is full.
+        Vector<Pair<u32, u32>> candidates;
+        candidates.reserve(DEFAULT_BLOCK_CAPACITY);
+        auto flush_candidates = [&]() {
+            if (candidates.empty()) {
+                return;
+            }
+            UniquePtr<DataBlock> candidate_block = DataBlock::MakeUniquePtr();
+            MakeCandidateBlock(build_blocks, build_rows.rows_, probe_block, candidates, candidate_block.get());
+
+            if (residual_conditions_.empty()) {
+                for (const auto &candidate : candidates) {
+                    probe_matched[candidate.first] = true;
+                    build_rows.matched_[candidate.second] = true;
+                }
+                join_state->data_block_array_.emplace_back(std::move(candidate_block));
+            } else {
+                Vector<bool> keep = EvaluateConditions(residual_conditions_, candidate_block.get());
+                SharedPtr<Selection> selection = MakeShared<Selection>();
+                selection->Initialize(candidates.size());
+                for (SizeT idx = 0; idx < candidates.size(); ++idx) {
+                    if (keep[idx]) {
+                        probe_matched[candidates[idx].first] = true;
+                        build_rows.matched_[candidates[idx].second] = true;
+                        selection->Append(idx);
+                    }
+                }
+                if (selection->Size() > 0) {
+                    UniquePtr<DataBlock> output_block = DataBlock::MakeUniquePtr();
+                    output_block->Init(candidate_block.get(), selection);
+                    join_state->data_block_array_.emplace_back(std::move(output_block));
+                }
+            }
+            candidates.clear();
+        };
+
+        for (SizeT row_idx = 0; row_idx < row_count; ++row_idx) {
+            if (has_null[row_idx] || group_ids[row_idx] == INVALID_GROUP_ID) {
+                continue;
+            }
+            for (u32 build_row = build_rows.Head(group_ids[row_idx]); build_row != INVALID_ROW; build_row = build_rows.next_[build_row]) {
+                candidates.emplace_back(row_idx, build_row);
+                if (candidates.size() == (SizeT)DEFAULT_BLOCK_CAPACITY) {
+                    flush_candidates();
+                }
+            }
+        }
+        flush_candidates();
+
+        if (output_left_unmatched) {
+            for (SizeT row_idx = 0; row_idx < row_count; ++row_idx) {
+                if (!probe_matched[row_idx]) {
+                    AppendPaddedRow(OutputBlock(*output_types_, join_state->data_block_array_), probe_block, row_idx, 0, padding_buffer_);
+                }
+            }
+        }
+    }
+
+    if (output_right_unmatched) {
+        for (SizeT build_row = 0; build_row < build_rows.rows_.size(); ++build_row) {
+            if (!build_rows.matched_[build_row]) {
+                const auto &row = build_rows.rows_[build_row];
+                AppendPaddedRow(OutputBlock(*output_types_, join_state->data_block_array_),
+                                build_blocks[row.first],
+                                row.second,
+                                left_column_count_,
+                                padding_buffer_);
+            }
+        }
+    }
+}
+
+void PhysicalHashJoin::SemiJoinPartition(const Vector<DataBlock *> &build_blocks,
+                                         const Vector<DataBlock *> &probe_blocks,
+                                         HashJoinOperatorState *join_state) const {
+    bool output_matched = join_type_ == JoinType::kSemi;
+
+    HashTable hash_table;
+    hash_table.Init(key_types_);
+    JoinBuildRows build_rows;
+    build_rows.Build(build_blocks, right_key_ids_, hash_table);
+
+    Vector<u32> group_ids;
+    Vector<bool> has_null;
+    for (const DataBlock *probe_block : probe_blocks) {
+        SizeT row_count = probe_block->row_count();
+        Vector<SharedPtr<ColumnVector>> key_columns = KeyColumns(probe_block, left_key_ids_);
+        HashTable::HasNull(key_columns, row_count, has_null);
+        hash_table.Find(key_columns, row_count, group_ids);
+        Vector<bool> probe_matched(row_count, false);
+
+        if (residual_conditions_.empty()) {
+            for (SizeT row_idx = 0; row_idx < row_count; ++row_idx) {
+                probe_matched[row_idx] =
+                    !has_null[row_idx] && group_ids[row_idx] != INVALID_GROUP_ID && build_rows.Head(group_ids[row_idx]) != INVALID_ROW;
+            }
+        } else {
+            // The pairs are checked in batches, the build rows of a probe row which matched in an earlier batch are skipped.
+            Vector<Pair<u32, u32>> candidates;
+            candidates.reserve(DEFAULT_BLOCK_CAPACITY);
+            auto flush_candidates = [&]() {
+                if (candidates.empty()) {
+                    return;
+                }
+                UniquePtr<DataBlock> candidate_block = DataBlock::MakeUniquePtr();
+                MakeCandidateBlock(build_blocks, build_rows.rows_, probe_block, candidates, candidate_block.get());
+                Vector<bool> keep = EvaluateConditions(residual_conditions_, candidate_block.get());
+                for (SizeT idx = 0; idx < candidates.size(); ++idx) {
+                    if (keep[idx]) {
+                        probe_matched[candidates[idx].first] = true;
+                    }
+                }
+                candidates.clear();
+            };
+
+            for (SizeT row_idx = 0; row_idx < row_count; ++row_idx) {
+                if (has_null[row_idx] || group_ids[row_idx] == INVALID_GROUP_ID) {
+                    continue;
+                }
+                for (u32 build_row = build_rows.Head(group_ids[row_idx]); build_row != INVALID_ROW && !probe_matched[row_idx];
+                     build_row = build_rows.next_[build_row]) {
+                    candidates.emplace_back(row_idx, build_row);
+                    if (candidates.size() == (SizeT)DEFAULT_BLOCK_CAPACITY) {
+                        flush_candidates();
+                    }
+                }
+            }
+            flush_candidates();
+        }
+
+        SharedPtr<Selection> selection = MakeShared<Selection>();
+        selection->Initialize(row_count);
+        for (SizeT row_idx = 0; row_idx < row_count; ++row_idx) {
+            if (probe_matched[row_idx] == output_matched) {
+                selection->Append(row_idx);
+            }
+        }
+        if (selection->Size() > 0) {
+            UniquePtr<DataBlock> output_block = DataBlock::MakeUniquePtr();
+            output_block->Init(probe_block, selection);
+            join_state->data_block_array_.emplace_back(std::move(output_block));
+        }
+    }
+}
+
+void PhysicalHashJoin::MakeCandidateBlock(const Vector<DataBlock *> &build_blocks,
+                                          const Vector<Pair<u32, u32>> &build_rows,
+                                          const DataBlock *probe_block,
+                                          const Vector<Pair<u32, u32>> &candidates,
+                                          DataBlock *candidate_block) const {
+    candidate_block->Init(input_types_);
+    SizeT column_count = input_types_.size();
+    for (SizeT column_idx = 0; column_idx < column_count; ++column_idx) {
+        ColumnVector &output_column = *candidate_block->column_vectors[column_idx];
+        if (column_idx < left_column_count_) {
+            const ColumnVector &input_column = *probe_block->column_vectors[column_idx];
+            for (const auto &candidate : candidates) {
+                output_column.AppendWith(input_column, candidate.first, 1);
+            }
+        } else {
+            SizeT right_column_idx = column_idx - left_column_count_;
+            for (const auto &candidate : candidates) {
+                const auto &build_row = build_rows[candidate.second];
+                output_column.AppendWith(*build_blocks[build_row.first]->column_vectors[right_column_idx], build_row.second, 1);
+            }
+        }
+    }
+    candidate_block->Finalize();
+}
+
+Vector<bool> PhysicalHashJoin::EvaluateConditions(const Vector<SharedPtr<BaseExpression>> &conditions, const DataBlock *candidate_block) {
+    SizeT row_count = candidate_block->row_count();
+    Vector<bool> keep(row_count, true);
+
+    ExpressionEvaluator evaluator;
+    evaluator.Init(candidate_block);
+    for (const auto &condition : conditions) {
+        SharedPtr<ExpressionState> condition_state = ExpressionState::CreateState(condition);
+        SharedPtr<ColumnVector> bool_column = MakeShared<ColumnVector>(MakeShared<DataType>(LogicalType::kBoolean));
+        bool_column->Initialize(ColumnVectorType::kCompactBit);
+        evaluator.Execute(condition, condition_state, bool_column);
+
+        SharedPtr<Selection> true_selection = MakeShared<Selection>();
+        true_selection->Initialize(row_count);
+        ExpressionSelector::Select(bool_column, row_count, true_selection, true);
+
+        Vector<bool> selected(row_count, false);
+        for (SizeT idx = 0; idx < true_selection->Size(); ++idx) {
+            selected[true_selection->Get(idx)] = true;
+        }
+        for (SizeT idx = 0; idx < row_count; ++idx) {
+            keep[idx] = keep[idx] && selected[idx];
+        }
+    }
+    return keep;
+}
+
+void PhysicalHashJoin::AppendPaddedRow(DataBlock *output_block,
+                                       const DataBlock *input_block,
+                                       SizeT row_idx,
+                                       SizeT input_begin,
+                                       const Vector<char> &padding_buffer) {
+    SizeT output_column_count = output_block->column_count();
+    SizeT input_end = input_begin + input_block->column_count();
+    for (SizeT column_idx = 0; column_idx < output_column_count; ++column_idx) {
+        ColumnVector &output_column = *output_block->column_vectors[column_idx];
+        if (column_idx >= input_begin && column_idx < input_end) {
+            output_column.AppendWith(*input_block->column_vectors[column_idx - input_begin], row_idx, 1);
+        } else {
+            output_column.AppendByPtr(padding_buffer.data());
+            output_column.nulls_ptr_->SetFalse(output_column.Size() - 1);
+        }
+    }
+}
+
+DataBlock *PhysicalHashJoin::OutputBlock(const Vector<SharedPtr<DataType>> &output_types, Vector<UniquePtr<DataBlock>> &data_block_array) {
+    if (!data_block_array.empty()) {
+        DataBlock *last_block = data_block_array.back().get();
+        if (!last_block->Finalized() && last_block->column_vectors[0]->Size() < last_block->capacity()) {
+            return last_block;
+        }
+    }
+    UniquePtr<DataBlock> output_block = DataBlock::MakeUniquePtr();
+    output_block->Init(output_types);
+    data_block_array.emplace_back(std::move(output_block));
+    return data_block_array.back().get();
+}
 
 SharedPtr<Vector<String>> PhysicalHashJoin::GetOutputNames() const {
     SharedPtr<Vector<String>> result = MakeShared<Vector<String>>();
@@ -37,6 +732,9 @@ SharedPtr<Vector<String>> PhysicalHashJoin::GetOutputNames() const {
     for (auto &name_str : *left_output_names) {
         result->emplace_back(name_str);
     }
+    if (join_type_ == JoinType::kSemi || join_type_ == JoinType::kAnti) {
+        return result;
+    }
 
     for (auto &name_str : *right_output_names) {
         result->emplace_back(name_str);
@@ -54,6 +752,9 @@ SharedPtr<Vector<SharedPtr<DataType>>> PhysicalHashJoin::GetOutputTypes() const
     for (auto &left_type : *left_output_types) {
         result->emplace_back(left_type);
     }
+    if (join_type_ == JoinType::kSemi || join_type_ == JoinType::kAnti) {
+        return result;
+    }
 
     for (auto &right_type : *right_output_types) {
         result->emplace_back(right_type);
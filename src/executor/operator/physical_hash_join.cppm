@@ -22,17 +22,27 @@ import query_context;
 import operator_state;
 import physical_operator;
 import physical_operator_type;
+import base_expression;
+import data_block;
 import load_meta;
 import infinity_exception;
 import internal_types;
+import join_reference;
 import data_type;
+import join_runtime_filter;
 
 namespace infinity {
 
 export class PhysicalHashJoin : public PhysicalOperator {
 public:
-    explicit PhysicalHashJoin(u64 id, SharedPtr<Vector<LoadMeta>> load_metas)
-        : PhysicalOperator(PhysicalOperatorType::kJoinHash, nullptr, nullptr, id, load_metas) {}
+    explicit PhysicalHashJoin(u64 id,
+                              JoinType join_type,
+                              Vector<SharedPtr<BaseExpression>> conditions,
+                              UniquePtr<PhysicalOperator> left,
+                              UniquePtr<PhysicalOperator> right,
+                              SharedPtr<Vector<LoadMeta>> load_metas)
+        : PhysicalOperator(PhysicalOperatorType::kJoinHash, std::move(left), std::move(right), id, load_metas), join_type_(join_type),
+          conditions_(std::move(conditions)) {}
 
     ~PhysicalHashJoin() override = default;
 
@@ -44,10 +54,76 @@ public:
 
     SharedPtr<Vector<SharedPtr<DataType>>> GetOutputTypes() const final;
 
-    SizeT TaskletCount() override {
-        UnrecoverableError("Not implement: TaskletCount not Implement");
-        return 0;
-    }
+    // The child fragments are scheduled in parallel, the build and probe run in the single task of the join fragment.
+    SizeT TaskletCount() override { return 1; }
+
+    // Hash join needs at least one equality between a left column and a right column of the same type.
+    // Left column index is in [0, left_column_count), right column index is in [left_column_count, ...).
+    static bool IsEquiCondition(const SharedPtr<BaseExpression> &condition, SizeT left_column_count, SizeT &left_idx, SizeT &right_idx);
+
+    static bool CanUseHashJoin(JoinType join_type, const Vector<SharedPtr<BaseExpression>> &conditions, SizeT left_column_count);
+
+    inline JoinType join_type() const { return join_type_; }
+
+    inline const Vector<SharedPtr<BaseExpression>> &conditions() const { return conditions_; }
+
+    inline const Vector<SizeT> &left_key_ids() const { return left_key_ids_; }
+
+    inline const Vector<SizeT> &right_key_ids() const { return right_key_ids_; }
+
+    // For an inner, right or semi join of a scan much larger than the build input, the build keys are collected into a runtime filter
+    // which the probe scan checks against its block and segment filters, so the probe fragment is started after the build one.
+    // The probe and build inputs are scans under filters only, so the fragments of both are the leaf fragments of the scans.
+    void PlanRuntimeFilter();
+
+    inline const SharedPtr<JoinRuntimeFilter> &runtime_filter() const { return runtime_filter_; }
+
+    // for HashJoin and SortMergeJoin
+    // Evaluate the conditions on the candidate rows, return whether each row satisfies all of them.
+    static Vector<bool> EvaluateConditions(const Vector<SharedPtr<BaseExpression>> &conditions, const DataBlock *candidate_block);
+
+    // Append the row of one input, the output columns of the other input are NULL.
+    // input_begin is the first output column of the input, padding_buffer is the zero filled value of the NULL columns.
+    static void
+    AppendPaddedRow(DataBlock *output_block, const DataBlock *input_block, SizeT row_idx, SizeT input_begin, const Vector<char> &padding_buffer);
+
+    // The last output block if it isn't full, otherwise a new output block.
+    static DataBlock *OutputBlock(const Vector<SharedPtr<DataType>> &output_types, Vector<UniquePtr<DataBlock>> &data_block_array);
+
+private:
+    void SpillInput(QueryContext *query_context, HashJoinOperatorState *join_state) const;
+
+    // Build the hash table on the right input rows and probe it with the left input rows.
+    void JoinPartition(const Vector<DataBlock *> &build_blocks, const Vector<DataBlock *> &probe_blocks, HashJoinOperatorState *join_state) const;
+
+    // A semi join outputs the left rows with a match and an anti join the left rows without one, each left row once. Without residual
+    // conditions the probe stops at the first build row of the key.
+    void SemiJoinPartition(const Vector<DataBlock *> &build_blocks, const Vector<DataBlock *> &probe_blocks, HashJoinOperatorState *join_state) const;
+
+    // The candidate rows of the residual conditions have the columns of both inputs.
+    void MakeCandidateBlock(const Vector<DataBlock *> &build_blocks,
+                            const Vector<Pair<u32, u32>> &build_rows,
+                            const DataBlock *probe_block,
+                            const Vector<Pair<u32, u32>> &candidates,
+                            DataBlock *candidate_block) const;
+
+    JoinType join_type_{JoinType::kInner};
+    Vector<SharedPtr<BaseExpression>> conditions_{};
+
+    SizeT left_column_count_{};
+    Vector<SizeT> left_key_ids_{};
+    Vector<SizeT> right_key_ids_{};
+    Vector<SharedPtr<DataType>> key_types_{};
+    Vector<SharedPtr<BaseExpression>> residual_conditions_{};
+
+    // the columns of both inputs, the output of a semi or anti join is the left columns only
+    Vector<SharedPtr<DataType>> input_types_{};
+    SharedPtr<Vector<SharedPtr<DataType>>> output_types_{};
+    // Zero filled buffer used as the value of the padded NULL columns of outer join.
+    Vector<char> padding_buffer_{};
+
+    // set by PlanRuntimeFilter(), filled by the sink of the build fragment
+    SharedPtr<JoinRuntimeFilter> runtime_filter_{};
 };
 
 } // namespace infinity
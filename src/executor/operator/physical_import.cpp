@@ -19,12 +19,24 @@ module;
 // #include "zsv/common.h"
 // }
 
+#include <algorithm>
+#include <cctype>
 #include <cerrno>
 #include <cstdio>
 #include <cstring>
+#include <exception>
 
 #include <vector>
 
+#include "simdjson.h"
+
+#ifdef INFINITY_WITH_ARROW
+#include <arrow/api.h>
+#include <arrow/io/file.h>
+#include <arrow/ipc/reader.h>
+#include <parquet/arrow/reader.h>
+#endif
+
 module physical_import;
 
 import stl;
@@ -59,9 +71,688 @@ import wal_entry;
 import catalog;
 import catalog_delta_entry;
 import build_fast_rough_filter_task;
+import sort_key;
+import select_statement;
+import data_type;
+import mmap;
 
 namespace infinity {
 
+namespace {
+
+// A range of the csv file read by the parser of one thread.
+struct CSVRangeStream {
+    FILE *fp_{};
+    SizeT remaining_{};
+};
+
+size_t ReadCSVRange(void *buffer, size_t n, size_t size, void *stream) {
+    auto *range_stream = static_cast<CSVRangeStream *>(stream);
+    SizeT read_size = fread(buffer, 1, std::min(n * size, range_stream->remaining_), range_stream->fp_);
+    range_stream->remaining_ -= read_size;
+    return read_size / n;
+}
+
+// Reads [begin, end) of the file in chunks, until visit returns false.
+template <typename Visit>
+void ScanFile(const String &file_path, SizeT begin, SizeT end, Visit &&visit) {
+    FILE *fp = fopen(file_path.c_str(), "rb");
+    if (!fp) {
+        UnrecoverableError(strerror(errno));
+    }
+    DeferFn close_fp([&]() { fclose(fp); });
+    fseeko(fp, begin, SEEK_SET);
+    Vector<char> buffer(1 << 20);
+    for (SizeT offset = begin; offset < end;) {
+        SizeT read_size = fread(buffer.data(), 1, std::min(buffer.size(), end - offset), fp);
+        if (read_size == 0 || !visit(offset, buffer.data(), read_size)) {
+            return;
+        }
+        offset += read_size;
+    }
+}
+
+// The ranges of the file are split after a newline out of quotes, so a quoted field with newlines isn't split. Whether an
+// offset is in quotes is told by the parity of the quotes before it, which are counted in parallel.
+Vector<SizeT> CSVRangeBounds(ThreadPool &pool, const String &file_path, SizeT file_size, SizeT range_count) {
+    SizeT range_size = file_size / range_count;
+    Vector<Future<SizeT>> quote_counts;
+    for (SizeT range_idx = 0; range_idx + 1 < range_count; ++range_idx) {
+        quote_counts.push_back(pool.push([&, range_idx](int) {
+            SizeT quote_count = 0;
+            ScanFile(file_path, range_idx * range_size, (range_idx + 1) * range_size, [&](SizeT, const char *data, SizeT size) {
+                quote_count += std::count(data, data + size, '"');
+                return true;
+            });
+            return quote_count;
+        }));
+    }
+
+    Vector<SizeT> bounds{0};
+    SizeT quote_count = 0;
+    for (SizeT range_idx = 1; range_idx < range_count; ++range_idx) {
+        quote_count += quote_counts[range_idx - 1].get();
+        bool in_quotes = quote_count % 2 == 1;
+        SizeT bound = file_size;
+        ScanFile(file_path, range_idx * range_size, file_size, [&](SizeT offset, const char *data, SizeT size) {
+            for (SizeT i = 0; i < size; ++i) {
+                if (data[i] == '"') {
+                    in_quotes = !in_quotes;
+                } else if (data[i] == '\n' && !in_quotes) {
+                    bound = offset + i + 1;
+                    return false;
+                }
+            }
+            return true;
+        });
+        // a quoted field across several ranges leaves the ranges in between empty
+        bounds.push_back(std::max(bound, bounds.back()));
+    }
+    bounds.push_back(file_size);
+    return bounds;
+}
+
+// Runs parse_range on each range, on the pool if there are several ranges. The first exception is returned when all the
+// ranges end, so the segments of the other ranges can be imported and cleaned up by the rollback.
+template <typename ParseRange>
+std::exception_ptr ParseRanges(ThreadPool *pool, SizeT range_count, ParseRange &&parse_range) {
+    std::exception_ptr parse_exception;
+    if (pool == nullptr) {
+        for (SizeT range_idx = 0; range_idx < range_count; ++range_idx) {
+            try {
+                parse_range(range_idx);
+            } catch (...) {
+                return std::current_exception();
+            }
+        }
+        return parse_exception;
+    }
+    Vector<Future<void>> futures;
+    futures.reserve(range_count);
+    for (SizeT range_idx = 0; range_idx < range_count; ++range_idx) {
+        futures.push_back(pool->push([&parse_range, range_idx](int) { parse_range(range_idx); }));
+    }
+    for (auto &future : futures) {
+        try {
+            future.get();
+        } catch (...) {
+            if (!parse_exception) {
+                parse_exception = std::current_exception();
+            }
+        }
+    }
+    return parse_exception;
+}
+
+void CheckJSONError(simdjson::error_code error) {
+    if (error != simdjson::SUCCESS) {
+        RecoverableError(Status::ImportFileFormatError(fmt::format("Invalid JSONL row: {}.", simdjson::error_message(error))));
+    }
+}
+
+template <typename T>
+void AppendJSONNumber(simdjson::ondemand::value &value, ColumnVector &column_vector) {
+    T v{};
+    if constexpr (std::is_floating_point_v<T>) {
+        double number = 0;
+        CheckJSONError(value.get_double().get(number));
+        v = number;
+    } else {
+        i64 number = 0;
+        CheckJSONError(value.get_int64().get(number));
+        v = number;
+    }
+    column_vector.AppendByPtr(reinterpret_cast<const_ptr_t>(&v));
+}
+
+// The elements are decoded into the buffer of the column vector, without a DOM or a temporary vector.
+template <typename T>
+void AppendJSONEmbedding(simdjson::ondemand::value &value, ColumnVector &column_vector, SizeT dimension) {
+    simdjson::ondemand::array array;
+    CheckJSONError(value.get_array().get(array));
+    T *dst = reinterpret_cast<T *>(column_vector.data()) + column_vector.Size() * dimension;
+    SizeT element_count = 0;
+    for (auto element : array) {
+        if (element_count == dimension) {
+            RecoverableError(Status::ImportFileFormatError("Embedding data size exceeds dimension."));
+        }
+        if constexpr (std::is_floating_point_v<T>) {
+            double number = 0;
+            CheckJSONError(element.get_double().get(number));
+            dst[element_count] = number;
+        } else {
+            i64 number = 0;
+            CheckJSONError(element.get_int64().get(number));
+            dst[element_count] = number;
+        }
+        ++element_count;
+    }
+    if (element_count != dimension) {
+        RecoverableError(
+            Status::ImportFileFormatError(fmt::format("Embedding data size ({}) doesn't match with dimension ({}).", element_count, dimension)));
+    }
+    column_vector.Finalize(column_vector.Size() + 1);
+}
+
+void AppendJSONLRow(simdjson::ondemand::document &doc, TableEntry *table_entry, Vector<ColumnVector> &column_vectors) {
+    simdjson::ondemand::object object;
+    CheckJSONError(doc.get_object().get(object));
+    for (SizeT i = 0; auto &column_vector : column_vectors) {
+        const ColumnDef *column_def = table_entry->GetColumnDefByID(i++);
+        simdjson::ondemand::value value;
+        CheckJSONError(object.find_field_unordered(column_def->name_).get(value));
+
+        switch (column_vector.data_type()->type()) {
+            case kBoolean: {
+                bool v = false;
+                CheckJSONError(value.get_bool().get(v));
+                column_vector.AppendByPtr(reinterpret_cast<const_ptr_t>(&v));
+                break;
+            }
+            case kTinyInt: {
+                AppendJSONNumber<i8>(value, column_vector);
+                break;
+            }
+            case kSmallInt: {
+                AppendJSONNumber<i16>(value, column_vector);
+                break;
+            }
+            case kInteger: {
+                AppendJSONNumber<i32>(value, column_vector);
+                break;
+            }
+            case kBigInt: {
+                AppendJSONNumber<i64>(value, column_vector);
+                break;
+            }
+            case kFloat: {
+                AppendJSONNumber<float>(value, column_vector);
+                break;
+            }
+            case kDouble: {
+                AppendJSONNumber<double>(value, column_vector);
+                break;
+            }
+            case kVarchar: {
+                std::string_view str_view;
+                CheckJSONError(value.get_string().get(str_view));
+                column_vector.AppendByStringView(str_view, ',');
+                break;
+            }
+            case kEmbedding: {
+                auto embedding_info = static_cast<EmbeddingInfo *>(column_vector.data_type()->type_info().get());
+                SizeT dimension = embedding_info->Dimension();
+                switch (embedding_info->Type()) {
+                    case kElemInt8: {
+                        AppendJSONEmbedding<i8>(value, column_vector, dimension);
+                        break;
+                    }
+                    case kElemInt16: {
+                        AppendJSONEmbedding<i16>(value, column_vector, dimension);
+                        break;
+                    }
+                    case kElemInt32: {
+                        AppendJSONEmbedding<i32>(value, column_vector, dimension);
+                        break;
+                    }
+                    case kElemInt64: {
+                        AppendJSONEmbedding<i64>(value, column_vector, dimension);
+                        break;
+                    }
+                    case kElemFloat: {
+                        AppendJSONEmbedding<float>(value, column_vector, dimension);
+                        break;
+                    }
+                    case kElemDouble: {
+                        AppendJSONEmbedding<double>(value, column_vector, dimension);
+                        break;
+                    }
+                    default: {
+                        UnrecoverableError("Not implement: Embedding type.");
+                    }
+                }
+                break;
+            }
+            default: {
+                UnrecoverableError("Not implement: Invalid data type.");
+            }
+        }
+    }
+}
+
+template <typename FileT, typename T>
+void CopyVecsRows(const u8 *rows, SizeT row_count, SizeT row_size, SizeT row_header_size, SizeT dimension, T *dst) {
+    for (SizeT row_idx = 0; row_idx < row_count; ++row_idx, rows += row_size, dst += dimension) {
+        if (row_header_size > 0) {
+            u32 row_dimension = 0;
+            std::memcpy(&row_dimension, rows, sizeof(row_dimension));
+            if (row_dimension != dimension) {
+                RecoverableError(Status::ImportFileFormatError(
+                    fmt::format("Dimension in file ({}) doesn't match with table definition ({}).", row_dimension, dimension)));
+            }
+        }
+        const u8 *elements = rows + row_header_size;
+        if constexpr (std::is_same_v<FileT, T>) {
+            std::memcpy(dst, elements, dimension * sizeof(T));
+        } else {
+            for (SizeT i = 0; i < dimension; ++i) {
+                FileT element;
+                std::memcpy(&element, elements + i * sizeof(FileT), sizeof(FileT));
+                dst[i] = element;
+            }
+        }
+    }
+}
+
+template <typename FileT>
+void CopyVecsRowsAs(const u8 *rows, SizeT row_count, SizeT row_size, SizeT row_header_size, SizeT dimension, EmbeddingDataType type, void *dst) {
+    switch (type) {
+        case kElemInt8: {
+            CopyVecsRows<FileT>(rows, row_count, row_size, row_header_size, dimension, static_cast<i8 *>(dst));
+            break;
+        }
+        case kElemInt16: {
+            CopyVecsRows<FileT>(rows, row_count, row_size, row_header_size, dimension, static_cast<i16 *>(dst));
+            break;
+        }
+        case kElemInt32: {
+            CopyVecsRows<FileT>(rows, row_count, row_size, row_header_size, dimension, static_cast<i32 *>(dst));
+            break;
+        }
+        case kElemInt64: {
+            CopyVecsRows<FileT>(rows, row_count, row_size, row_header_size, dimension, static_cast<i64 *>(dst));
+            break;
+        }
+        case kElemFloat: {
+            CopyVecsRows<FileT>(rows, row_count, row_size, row_header_size, dimension, static_cast<float *>(dst));
+            break;
+        }
+        case kElemDouble: {
+            CopyVecsRows<FileT>(rows, row_count, row_size, row_header_size, dimension, static_cast<double *>(dst));
+            break;
+        }
+        default: {
+            UnrecoverableError("Not implement: Embedding type.");
+        }
+    }
+}
+
+// The rows of a fixed stride vector file. FVECS, IVECS and BVECS rows are a u32 dimension and the elements, an FBIN file
+// has a u32 row count and a u32 dimension at the beginning and rows of float elements only.
+struct VecsFileLayout {
+    CopyFileType file_type_{};
+    SizeT file_header_size_{};
+    SizeT row_header_size_{};
+    SizeT element_size_{};
+    SizeT dimension_{};
+    SizeT row_count_{};
+
+    static VecsFileLayout Make(CopyFileType file_type, const u8 *data, SizeT file_size) {
+        VecsFileLayout layout;
+        layout.file_type_ = file_type;
+        layout.element_size_ = file_type == CopyFileType::kBVECS ? sizeof(u8) : sizeof(u32);
+        u32 header[2] = {};
+        if (file_type == CopyFileType::kFBIN) {
+            layout.file_header_size_ = sizeof(header);
+            if (file_size < sizeof(header)) {
+                RecoverableError(Status::ImportFileFormatError("FBIN file is shorter than its header."));
+            }
+            std::memcpy(header, data, sizeof(header));
+            layout.dimension_ = header[1];
+            layout.row_count_ = header[0];
+            if (file_size != sizeof(header) + layout.row_count_ * layout.dimension_ * layout.element_size_) {
+                RecoverableError(Status::ImportFileFormatError(
+                    fmt::format("FBIN file size {} doesn't match with {} rows of dimension {}.", file_size, header[0], header[1])));
+            }
+            return layout;
+        }
+        layout.row_header_size_ = sizeof(u32);
+        if (file_size < sizeof(u32)) {
+            RecoverableError(Status::ImportFileFormatError("Vector file is shorter than a dimension."));
+        }
+        std::memcpy(header, data, sizeof(u32));
+        layout.dimension_ = header[0];
+        if (file_size % layout.RowSize() != 0) {
+            RecoverableError(
+                Status::ImportFileFormatError(fmt::format("File size {} isn't a multiple of the row size {}.", file_size, layout.RowSize())));
+        }
+        layout.row_count_ = file_size / layout.RowSize();
+        return layout;
+    }
+
+    SizeT RowSize() const { return row_header_size_ + dimension_ * element_size_; }
+
+    // Copies the elements of [begin_row, end_row) to dst as the elements of the embedding column, stripping the headers.
+    void CopyRows(const u8 *data, SizeT begin_row, SizeT end_row, EmbeddingDataType type, void *dst) const {
+        const u8 *rows = data + file_header_size_ + begin_row * RowSize();
+        SizeT row_count = end_row - begin_row;
+        switch (file_type_) {
+            case CopyFileType::kBVECS: {
+                CopyVecsRowsAs<u8>(rows, row_count, RowSize(), row_header_size_, dimension_, type, dst);
+                break;
+            }
+            case CopyFileType::kIVECS: {
+                CopyVecsRowsAs<i32>(rows, row_count, RowSize(), row_header_size_, dimension_, type, dst);
+                break;
+            }
+            default: {
+                CopyVecsRowsAs<float>(rows, row_count, RowSize(), row_header_size_, dimension_, type, dst);
+                break;
+            }
+        }
+    }
+};
+
+#ifdef INFINITY_WITH_ARROW
+
+void CheckArrowStatus(const arrow::Status &status) {
+    if (!status.ok()) {
+        RecoverableError(Status::ImportFileFormatError(status.ToString()));
+    }
+}
+
+template <typename T>
+T CheckArrowResult(arrow::Result<T> result) {
+    CheckArrowStatus(result.status());
+    return std::move(result).ValueUnsafe();
+}
+
+// A file type is only converted to a column type that holds all of its values, e.g. int32 into bigint or double, but not
+// int64 into tinyint or double into integer.
+template <typename From, typename To>
+constexpr bool kLosslessArrowCast =
+    std::is_same_v<From, To> || (std::is_integral_v<From> && std::is_integral_v<To> && sizeof(From) < sizeof(To)) ||
+    (std::is_integral_v<From> && std::is_floating_point_v<To> && std::numeric_limits<From>::digits <= std::numeric_limits<To>::digits) ||
+    (std::is_floating_point_v<From> && std::is_floating_point_v<To> && sizeof(From) < sizeof(To));
+
+template <typename T, typename ArrowType>
+void CopyArrowValues(const arrow::Array &array, SizeT offset, SizeT count, T *dst) {
+    using From = typename ArrowType::c_type;
+    if constexpr (!kLosslessArrowCast<From, T>) {
+        RecoverableError(Status::ImportFileFormatError(
+            fmt::format("Can't import {} into a column of {}, the values may not fit.", array.type()->ToString(), DataType::TypeToString<T>())));
+    } else {
+        const auto *src = static_cast<const arrow::NumericArray<ArrowType> &>(array).raw_values() + offset;
+        if constexpr (std::is_same_v<T, From>) {
+            std::memcpy(dst, src, count * sizeof(T));
+        } else {
+            std::copy(src, src + count, dst);
+        }
+    }
+}
+
+// Copies [offset, offset + count) of a numeric array to dst, with one memcpy if the types are the same.
+template <typename T>
+void CopyArrowNumbers(const arrow::Array &array, SizeT offset, SizeT count, T *dst) {
+    switch (array.type_id()) {
+        case arrow::Type::INT8: {
+            CopyArrowValues<T, arrow::Int8Type>(array, offset, count, dst);
+            break;
+        }
+        case arrow::Type::INT16: {
+            CopyArrowValues<T, arrow::Int16Type>(array, offset, count, dst);
+            break;
+        }
+        case arrow::Type::INT32: {
+            CopyArrowValues<T, arrow::Int32Type>(array, offset, count, dst);
+            break;
+        }
+        case arrow::Type::INT64: {
+            CopyArrowValues<T, arrow::Int64Type>(array, offset, count, dst);
+            break;
+        }
+        case arrow::Type::FLOAT: {
+            CopyArrowValues<T, arrow::FloatType>(array, offset, count, dst);
+            break;
+        }
+        case arrow::Type::DOUBLE: {
+            CopyArrowValues<T, arrow::DoubleType>(array, offset, count, dst);
+            break;
+        }
+        default: {
+            RecoverableError(Status::ImportFileFormatError(fmt::format("Can't import {} into a numeric column.", array.type()->ToString())));
+        }
+    }
+}
+
+template <typename T>
+void AppendArrowNumbers(const arrow::Array &array, SizeT offset, SizeT count, ColumnVector &column_vector) {
+    CopyArrowNumbers(array, offset, count, reinterpret_cast<T *>(column_vector.data()) + column_vector.Size());
+    column_vector.Finalize(column_vector.Size() + count);
+}
+
+// The values of a fixed size list are contiguous, so the embeddings are copied as a whole.
+template <typename T>
+void AppendArrowEmbeddings(const arrow::Array &array, SizeT offset, SizeT count, SizeT dimension, ColumnVector &column_vector) {
+    if (array.type_id() != arrow::Type::FIXED_SIZE_LIST) {
+        RecoverableError(Status::ImportFileFormatError(fmt::format("Can't import {} into an embedding column.", array.type()->ToString())));
+    }
+    const auto &list_array = static_cast<const arrow::FixedSizeListArray &>(array);
+    if (static_cast<SizeT>(list_array.value_length()) != dimension) {
+        RecoverableError(Status::ImportFileFormatError(
+            fmt::format("Embedding data size ({}) doesn't match with dimension ({}).", list_array.value_length(), dimension)));
+    }
+    // The null bitmap of the lists doesn't cover their elements, which have their own.
+    const arrow::Array &values = *list_array.values();
+    if (values.null_count() > 0) {
+        RecoverableError(Status::ImportFileFormatError("Null element in imported embedding column."));
+    }
+    T *dst = reinterpret_cast<T *>(column_vector.data()) + column_vector.Size() * dimension;
+    CopyArrowNumbers(values, list_array.value_offset(offset), count * dimension, dst);
+    column_vector.Finalize(column_vector.Size() + count);
+}
+
+template <typename StringArray>
+void AppendArrowStrings(const arrow::Array &array, SizeT offset, SizeT count, ColumnVector &column_vector) {
+    const auto &string_array = static_cast<const StringArray &>(array);
+    for (SizeT i = offset; i < offset + count; ++i) {
+        column_vector.AppendByStringView(string_array.GetView(i), ',');
+    }
+}
+
+void AppendArrowColumn(const arrow::Array &array, SizeT offset, SizeT count, ColumnVector &column_vector) {
+    if (array.null_count() > 0) {
+        RecoverableError(Status::ImportFileFormatError("Null value in imported column."));
+    }
+    switch (column_vector.data_type()->type()) {
+        case kBoolean: {
+            if (array.type_id() != arrow::Type::BOOL) {
+                RecoverableError(Status::ImportFileFormatError(fmt::format("Can't import {} into a boolean column.", array.type()->ToString())));
+            }
+            const auto &bool_array = static_cast<const arrow::BooleanArray &>(array);
+            for (SizeT i = offset; i < offset + count; ++i) {
+                bool v = bool_array.Value(i);
+                column_vector.AppendByPtr(reinterpret_cast<const_ptr_t>(&v));
+            }
+            break;
+        }
+        case kTinyInt: {
+            AppendArrowNumbers<i8>(array, offset, count, column_vector);
+            break;
+        }
+        case kSmallInt: {
+            AppendArrowNumbers<i16>(array, offset, count, column_vector);
+            break;
+        }
+        case kInteger: {
+            AppendArrowNumbers<i32>(array, offset, count, column_vector);
+            break;
+        }
+        case kBigInt: {
+            AppendArrowNumbers<i64>(array, offset, count, column_vector);
+            break;
+        }
+        case kFloat: {
+            AppendArrowNumbers<float>(array, offset, count, column_vector);
+            break;
+        }
+        case kDouble: {
+            AppendArrowNumbers<double>(array, offset, count, column_vector);
+            break;
+        }
+        case kVarchar: {
+            if (array.type_id() == arrow::Type::STRING) {
+                AppendArrowStrings<arrow::StringArray>(array, offset, count, column_vector);
+            } else if (array.type_id() == arrow::Type::LARGE_STRING) {
+                AppendArrowStrings<arrow::LargeStringArray>(array, offset, count, column_vector);
+            } else {
+                RecoverableError(Status::ImportFileFormatError(fmt::format("Can't import {} into a varchar column.", array.type()->ToString())));
+            }
+            break;
+        }
+        case kEmbedding: {
+            auto embedding_info = static_cast<EmbeddingInfo *>(column_vector.data_type()->type_info().get());
+            SizeT dimension = embedding_info->Dimension();
+            switch (embedding_info->Type()) {
+                case kElemInt8: {
+                    AppendArrowEmbeddings<i8>(array, offset, count, dimension, column_vector);
+                    break;
+                }
+                case kElemInt16: {
+                    AppendArrowEmbeddings<i16>(array, offset, count, dimension, column_vector);
+                    break;
+                }
+                case kElemInt32: {
+                    AppendArrowEmbeddings<i32>(array, offset, count, dimension, column_vector);
+                    break;
+                }
+                case kElemInt64: {
+                    AppendArrowEmbeddings<i64>(array, offset, count, dimension, column_vector);
+                    break;
+                }
+                case kElemFloat: {
+                    AppendArrowEmbeddings<float>(array, offset, count, dimension, column_vector);
+                    break;
+                }
+                case kElemDouble: {
+                    AppendArrowEmbeddings<double>(array, offset, count, dimension, column_vector);
+                    break;
+                }
+                default: {
+                    UnrecoverableError("Not implement: Embedding type.");
+                }
+            }
+            break;
+        }
+        default: {
+            UnrecoverableError("Not implement: Invalid data type.");
+        }
+    }
+}
+
+// Appends the record batches of a parquet or arrow file to new segments of the table. The columns of a batch are matched
+// by name and copied into the column vectors of the block in parallel.
+class ArrowBatchImporter {
+public:
+    ArrowBatchImporter(QueryContext *query_context, TableEntry *table_entry)
+        : query_context_(query_context), table_entry_(table_entry), txn_(query_context->GetTxn()) {
+        SizeT thread_count = std::min(SizeT(query_context->cpu_number_limit()), table_entry->ColumnCount());
+        if (thread_count > 1) {
+            pool_ = MakeUnique<ThreadPool>(thread_count);
+        }
+        segment_entry_ = SegmentEntry::NewSegmentEntry(table_entry_, Catalog::GetNextSegmentID(table_entry_), txn_);
+        NewBlock();
+    }
+
+    void Append(const arrow::RecordBatch &batch) {
+        SizeT column_count = table_entry_->ColumnCount();
+        Vector<const arrow::Array *> arrays;
+        for (SizeT i = 0; i < column_count; ++i) {
+            const String &column_name = table_entry_->GetColumnDefByID(i)->name_;
+            int field_idx = batch.schema()->GetFieldIndex(column_name);
+            if (field_idx < 0) {
+                RecoverableError(Status::ImportFileFormatError(fmt::format("Column {} isn't found in the file.", column_name)));
+            }
+            arrays.push_back(batch.column(field_idx).get());
+        }
+
+        for (SizeT offset = 0; offset < SizeT(batch.num_rows());) {
+            SizeT count = std::min(SizeT(block_entry_->GetAvailableCapacity()), batch.num_rows() - offset);
+            std::exception_ptr copy_exception = ParseRanges(pool_.get(), column_count, [&](SizeT column_idx) {
+                AppendArrowColumn(*arrays[column_idx], offset, count, column_vectors_[column_idx]);
+            });
+            if (copy_exception) {
+                std::rethrow_exception(copy_exception);
+            }
+            block_entry_->IncreaseRowCount(count);
+            row_count_ += count;
+            offset += count;
+
+            if (block_entry_->GetAvailableCapacity() <= 0) {
+                segment_entry_->AppendBlockEntry(std::move(block_entry_));
+                column_vectors_.clear();
+                if (segment_entry_->Room() <= 0) {
+                    LOG_INFO(fmt::format("Segment {} saved", segment_entry_->segment_id()));
+                    segments_.push_back(PhysicalImport::FinishSegmentData(table_entry_, txn_, std::move(segment_entry_)));
+                    query_context_->CheckCanceled();
+                    segment_entry_ = SegmentEntry::NewSegmentEntry(table_entry_, Catalog::GetNextSegmentID(table_entry_), txn_);
+                }
+                NewBlock();
+            }
+        }
+    }
+
+    // Imports the saved segments into the txn, also after a failure so the rollback cleans them up.
+    SizeT Finish(bool success) {
+        column_vectors_.clear();
+        if (block_entry_.get() != nullptr) {
+            if (success && block_entry_->row_count() > 0) {
+                segment_entry_->AppendBlockEntry(std::move(block_entry_));
+            } else {
+                std::move(*block_entry_).Cleanup();
+            }
+        }
+        if (segment_entry_.get() != nullptr) {
+            if (success && segment_entry_->row_count() > 0) {
+                segments_.push_back(PhysicalImport::FinishSegmentData(table_entry_, txn_, std::move(segment_entry_)));
+            } else {
+                std::move(*segment_entry_).Cleanup();
+            }
+        }
+        for (auto &segment_entry : segments_) {
+            txn_->Import(*table_entry_->GetDBName(), *table_entry_->GetTableName(), std::move(segment_entry));
+        }
+        return row_count_;
+    }
+
+private:
+    void NewBlock() {
+        block_entry_ = BlockEntry::NewBlockEntry(segment_entry_.get(), segment_entry_->GetNextBlockID(), 0, table_entry_->ColumnCount(), txn_);
+        for (SizeT i = 0; i < table_entry_->ColumnCount(); ++i) {
+            column_vectors_.emplace_back(block_entry_->GetColumnBlockEntry(i)->GetColumnVector(txn_->buffer_mgr()));
+        }
+    }
+
+    QueryContext *query_context_{};
+    TableEntry *table_entry_{};
+    Txn *txn_{};
+    UniquePtr<ThreadPool> pool_{};
+    SharedPtr<SegmentEntry> segment_entry_{};
+    UniquePtr<BlockEntry> block_entry_{};
+    Vector<ColumnVector> column_vectors_{};
+    Vector<SharedPtr<SegmentEntry>> segments_{};
+    SizeT row_count_{};
+};
+
+// Feeds the batches from next_batch to the importer until it returns null.
+template <typename NextBatch>
+SizeT ImportArrowBatches(QueryContext *query_context, TableEntry *table_entry, NextBatch &&next_batch) {
+    ArrowBatchImporter importer(query_context, table_entry);
+    try {
+        while (SharedPtr<arrow::RecordBatch> batch = next_batch()) {
+            importer.Append(*batch);
+        }
+    } catch (...) {
+        importer.Finish(false);
+        throw;
+    }
+    return importer.Finish(true);
+}
+
+#endif
+
+} // namespace
+
 void PhysicalImport::Init() {}
 
 /**
@@ -85,8 +776,19 @@ bool PhysicalImport::Execute(QueryContext *query_context, OperatorState *operato
             ImportJSONL(query_context, import_op_state);
             break;
         }
-        case CopyFileType::kFVECS: {
-            ImportFVECS(query_context, import_op_state);
+        case CopyFileType::kFVECS:
+        case CopyFileType::kBVECS:
+        case CopyFileType::kIVECS:
+        case CopyFileType::kFBIN: {
+            ImportVecs(query_context, import_op_state);
+            break;
+        }
+        case CopyFileType::kPARQUET: {
+            ImportParquet(query_context, import_op_state);
+            break;
+        }
+        case CopyFileType::kARROW: {
+            ImportArrow(query_context, import_op_state);
             break;
         }
         case CopyFileType::kInvalid: {
@@ -99,93 +801,168 @@ bool PhysicalImport::Execute(QueryContext *query_context, OperatorState *operato
     return true;
 }
 
-void PhysicalImport::ImportFVECS(QueryContext *query_context, ImportOperatorState *import_op_state) {
+void PhysicalImport::ImportVecs(QueryContext *query_context, ImportOperatorState *import_op_state) {
+    const String file_type = *copy_file_to_str(file_type_);
     if (table_entry_->ColumnCount() != 1) {
-        RecoverableError(Status::ImportFileFormatError("FVECS file must have only one column."));
+        RecoverableError(Status::ImportFileFormatError(fmt::format("{} file must have only one column.", file_type)));
     }
     auto &column_type = table_entry_->GetColumnDefByID(0)->column_type_;
     if (column_type->type() != kEmbedding) {
-        RecoverableError(Status::ImportFileFormatError("FVECS file must have only one embedding column."));
+        RecoverableError(Status::ImportFileFormatError(fmt::format("{} file must have only one embedding column.", file_type)));
     }
     auto embedding_info = static_cast<EmbeddingInfo *>(column_type->type_info().get());
-    if (embedding_info->Type() != kElemFloat) {
-        RecoverableError(Status::ImportFileFormatError("FVECS file must have only one embedding column with float element."));
+    EmbeddingDataType element_type = embedding_info->Type();
+    if (element_type == kElemBit || (file_type_ == CopyFileType::kBVECS && element_type == kElemInt8)) {
+        String element_name = EmbeddingType::EmbeddingDataType2String(element_type);
+        RecoverableError(
+            Status::ImportFileFormatError(fmt::format("Can't import {} file into embedding column with {} element.", file_type, element_name)));
     }
 
-    LocalFileSystem fs;
-
-    UniquePtr<FileHandler> file_handler = fs.OpenFile(file_path_, FileFlags::READ_FLAG, FileLockType::kReadLock);
-    DeferFn defer_fn([&]() { fs.Close(*file_handler); });
-
-    int dimension = 0;
-    i64 nbytes = fs.Read(*file_handler, &dimension, sizeof(dimension));
-    fs.Seek(*file_handler, 0);
-    if (nbytes == 0) {
-        // file is empty
+    u8 *data = nullptr;
+    SizeT file_size = 0;
+    if (LocalFileSystem::GetFileSizeByPath(file_path_) == 0) {
         auto result_msg = MakeUnique<String>("IMPORT 0 Rows");
         import_op_state->result_msg_ = std::move(result_msg);
         return;
     }
-
-    if (nbytes != sizeof(dimension)) {
-        RecoverableError(Status::ImportFileFormatError(fmt::format("Read dimension which length isn't {}.", nbytes)));
+    if (MmapFile(file_path_, data, file_size) != 0) {
+        RecoverableError(Status::ImportFileFormatError(fmt::format("Can't mmap {}.", file_path_)));
     }
-    if ((int)embedding_info->Dimension() != dimension) {
+    DeferFn unmap_file([&]() { MunmapFile(data, file_size); });
+    MmapAdvise(data, file_size, MmapAdvice::kSequential);
+
+    VecsFileLayout layout = VecsFileLayout::Make(file_type_, data, file_size);
+    if (layout.dimension_ != embedding_info->Dimension()) {
         RecoverableError(Status::ImportFileFormatError(
-            fmt::format("Dimension in file ({}) doesn't match with table definition ({}).", dimension, embedding_info->Dimension())));
+            fmt::format("Dimension in file ({}) doesn't match with table definition ({}).", layout.dimension_, embedding_info->Dimension())));
     }
-    SizeT file_size = fs.GetFileSize(*file_handler);
-    SizeT row_size = dimension * sizeof(FloatT) + sizeof(dimension);
-    if (file_size % row_size != 0) {
-        UnrecoverableError("Weird file size.");
-    }
-    SizeT vector_n = file_size / row_size;
 
+    // The segments and the ids of their blocks are known from the row count, so the blocks are filled by the threads in
+    // any order and appended to their segments afterwards.
     Txn *txn = query_context->GetTxn();
+    SizeT segment_count = (layout.row_count_ + DEFAULT_SEGMENT_CAPACITY - 1) / DEFAULT_SEGMENT_CAPACITY;
+    SizeT block_count = (layout.row_count_ + DEFAULT_BLOCK_CAPACITY - 1) / DEFAULT_BLOCK_CAPACITY;
+    constexpr SizeT segment_block_count = DEFAULT_SEGMENT_CAPACITY / DEFAULT_BLOCK_CAPACITY;
+    Vector<SharedPtr<SegmentEntry>> segments;
+    Vector<UniquePtr<BlockEntry>> blocks(block_count);
+    for (SizeT segment_idx = 0; segment_idx < segment_count; ++segment_idx) {
+        segments.push_back(SegmentEntry::NewSegmentEntry(table_entry_, Catalog::GetNextSegmentID(table_entry_), txn));
+    }
 
-    SegmentID segment_id = Catalog::GetNextSegmentID(table_entry_);
-    SharedPtr<SegmentEntry> segment_entry = SegmentEntry::NewSegmentEntry(table_entry_, segment_id, query_context->GetTxn());
-    UniquePtr<BlockEntry> block_entry = BlockEntry::NewBlockEntry(segment_entry.get(), 0, 0, table_entry_->ColumnCount(), txn);
-    BufferHandle buffer_handle = block_entry->GetColumnBlockEntry(0)->buffer()->Load();
-    SizeT row_idx = 0;
-    auto buf_ptr = static_cast<ptr_t>(buffer_handle.GetDataMut());
-    while (true) {
-        int dim;
-        nbytes = fs.Read(*file_handler, &dim, sizeof(dimension));
-        if (dim != dimension or nbytes != sizeof(dimension)) {
-            RecoverableError(
-                Status::ImportFileFormatError(fmt::format("Dimension in file ({}) doesn't match with table definition ({}).", dim, dimension)));
+    SizeT range_count = std::min(SizeT(query_context->cpu_number_limit()), block_count);
+    UniquePtr<ThreadPool> pool;
+    if (range_count > 1) {
+        pool = MakeUnique<ThreadPool>(range_count);
+    }
+    std::exception_ptr import_exception = ParseRanges(pool.get(), range_count, [&](SizeT range_idx) {
+        for (SizeT block_idx = range_idx * block_count / range_count; block_idx < (range_idx + 1) * block_count / range_count; ++block_idx) {
+            SegmentEntry *segment_entry = segments[block_idx / segment_block_count].get();
+            auto block_entry = BlockEntry::NewBlockEntry(segment_entry, block_idx % segment_block_count, 0, 1, txn);
+            SizeT begin_row = block_idx * DEFAULT_BLOCK_CAPACITY;
+            SizeT end_row = std::min(begin_row + DEFAULT_BLOCK_CAPACITY, layout.row_count_);
+            BufferHandle buffer_handle = block_entry->GetColumnBlockEntry(0)->buffer()->Load();
+            layout.CopyRows(data, begin_row, end_row, element_type, buffer_handle.GetDataMut());
+            block_entry->IncreaseRowCount(end_row - begin_row);
+            blocks[block_idx] = std::move(block_entry);
+            query_context->CheckCanceled();
         }
-        ptr_t dst_ptr = buf_ptr + block_entry->row_count() * sizeof(FloatT) * dimension;
-        fs.Read(*file_handler, dst_ptr, sizeof(FloatT) * dimension);
-        block_entry->IncreaseRowCount(1);
-        ++row_idx;
+    });
 
-        if (row_idx == vector_n) {
-            segment_entry->AppendBlockEntry(std::move(block_entry));
-            SaveSegmentData(table_entry_, txn, segment_entry);
-            break;
+    for (SizeT block_idx = 0; block_idx < block_count; ++block_idx) {
+        if (blocks[block_idx].get() != nullptr) {
+            segments[block_idx / segment_block_count]->AppendBlockEntry(std::move(blocks[block_idx]));
+        }
+    }
+    if (!import_exception) {
+        import_exception = ParseRanges(pool.get(), segment_count, [&](SizeT segment_idx) {
+            segments[segment_idx] = FinishSegmentData(table_entry_, txn, std::move(segments[segment_idx]));
+        });
+    }
+    // The segments are imported even if a block failed, so the rollback cleans them up.
+    for (auto &segment_entry : segments) {
+        if (segment_entry.get() != nullptr) {
+            txn->Import(*table_entry_->GetDBName(), *table_entry_->GetTableName(), std::move(segment_entry));
         }
+    }
+    if (import_exception) {
+        std::rethrow_exception(import_exception);
+    }
 
-        if (block_entry->GetAvailableCapacity() <= 0) {
-            segment_entry->AppendBlockEntry(std::move(block_entry));
-            if (segment_entry->Room() <= 0) {
-                SaveSegmentData(table_entry_, txn, segment_entry);
+    auto result_msg = MakeUnique<String>(fmt::format("IMPORT {} Rows", layout.row_count_));
+    import_op_state->result_msg_ = std::move(result_msg);
+}
 
-                segment_id = Catalog::GetNextSegmentID(table_entry_);
-                segment_entry = SegmentEntry::NewSegmentEntry(table_entry_, segment_id, query_context->GetTxn());
-            }
+void PhysicalImport::ImportCSV(QueryContext *query_context, ImportOperatorState *import_op_state) {
+    FILE *fp = fopen(file_path_.c_str(), "rb");
+    if (!fp) {
+        UnrecoverableError(strerror(errno));
+    }
+    fseeko(fp, 0, SEEK_END);
+    SizeT file_size = ftello(fp);
+    fclose(fp);
 
-            block_entry = BlockEntry::NewBlockEntry(segment_entry.get(), segment_entry->GetNextBlockID(), 0, table_entry_->ColumnCount(), txn);
-            buffer_handle = block_entry->GetColumnBlockEntry(0)->buffer()->Load();
-            buf_ptr = static_cast<ptr_t>(buffer_handle.GetDataMut());
+    // A large file is split into one range per cpu, the ranges are parsed in parallel into their own segments.
+    Txn *txn = query_context->GetTxn();
+    SizeT range_count = std::max(SizeT(1), std::min(SizeT(query_context->cpu_number_limit()), file_size / IMPORT_MIN_RANGE_SIZE));
+    Vector<UniquePtr<ZxvParserCtx>> parser_contexts;
+    for (SizeT range_idx = 0; range_idx < range_count; ++range_idx) {
+        parser_contexts.emplace_back(NewCSVParserContext(query_context, txn));
+    }
+    UniquePtr<ThreadPool> pool;
+    Vector<SizeT> bounds{0, file_size};
+    if (range_count > 1) {
+        pool = MakeUnique<ThreadPool>(range_count);
+        bounds = CSVRangeBounds(*pool, file_path_, file_size, range_count);
+    }
+    std::exception_ptr parse_exception = ParseRanges(pool.get(), range_count, [&](SizeT range_idx) {
+        ParseCSVRange(parser_contexts[range_idx].get(), bounds[range_idx], bounds[range_idx + 1], header_ && range_idx == 0);
+    });
+
+    // The segments are imported in the order of the ranges even if a range failed, so the rollback cleans them up.
+    const String &db_name = *table_entry_->GetDBName();
+    const String &table_name = *table_entry_->GetTableName();
+    SizeT row_count = 0;
+    for (auto &parser_context : parser_contexts) {
+        for (auto &segment_entry : parser_context->segments_) {
+            txn->Import(db_name, table_name, std::move(segment_entry));
+        }
+        row_count += parser_context->row_count_;
+    }
+    if (parse_exception) {
+        std::rethrow_exception(parse_exception);
+    }
+
+    for (auto &parser_context : parser_contexts) {
+        ZsvStatus csv_parser_status = parser_context->status_;
+        if (csv_parser_status != zsv_status_no_more_input) {
+            if (parser_context->err_msg_.get() != nullptr) {
+                UnrecoverableError(*parser_context->err_msg_);
+            } else {
+                String err_msg = ZsvParser::ParseStatusDesc(csv_parser_status);
+                UnrecoverableError(err_msg);
+            }
         }
     }
-    auto result_msg = MakeUnique<String>(fmt::format("IMPORT {} Rows", vector_n));
+
+    auto result_msg = MakeUnique<String>(fmt::format("IMPORT {} Rows", row_count));
     import_op_state->result_msg_ = std::move(result_msg);
 }
 
-void PhysicalImport::ImportCSV(QueryContext *query_context, ImportOperatorState *import_op_state) {
+UniquePtr<ZxvParserCtx> PhysicalImport::NewCSVParserContext(QueryContext *query_context, Txn *txn) const {
+    auto *buffer_mgr = txn->buffer_mgr();
+    u64 segment_id = Catalog::GetNextSegmentID(table_entry_);
+    SharedPtr<SegmentEntry> segment_entry = SegmentEntry::NewSegmentEntry(table_entry_, segment_id, txn);
+    UniquePtr<BlockEntry> block_entry = BlockEntry::NewBlockEntry(segment_entry.get(), 0, 0, table_entry_->ColumnCount(), txn);
+    Vector<ColumnVector> column_vectors;
+    int column_count = table_entry_->ColumnCount();
+    for (int i = 0; i < column_count; ++i) {
+        auto *block_column_entry = block_entry->GetColumnBlockEntry(i);
+        column_vectors.emplace_back(block_column_entry->GetColumnVector(buffer_mgr));
+    }
+    return MakeUnique<ZxvParserCtx>(query_context, table_entry_, txn, segment_entry, std::move(block_entry), std::move(column_vectors), delimiter_);
+}
+
+void PhysicalImport::ParseCSVRange(ZxvParserCtx *parser_context, SizeT begin, SizeT end, bool header) const {
     // opts, parser and parser_context points to each other.
     // opt -> parser_context
     // parser->opt
@@ -194,41 +971,29 @@ void PhysicalImport::ImportCSV(QueryContext *query_context, ImportOperatorState
     if (!fp) {
         UnrecoverableError(strerror(errno));
     }
-
-    UniquePtr<ZxvParserCtx> parser_context = nullptr;
-    Txn *txn = query_context->GetTxn();
-    {
-        auto *buffer_mgr = txn->buffer_mgr();
-        u64 segment_id = Catalog::GetNextSegmentID(table_entry_);
-        SharedPtr<SegmentEntry> segment_entry = SegmentEntry::NewSegmentEntry(table_entry_, segment_id, txn);
-        UniquePtr<BlockEntry> block_entry = BlockEntry::NewBlockEntry(segment_entry.get(), 0, 0, table_entry_->ColumnCount(), txn);
-        Vector<ColumnVector> column_vectors;
-        int column_count = table_entry_->ColumnCount();
-        for (int i = 0; i < column_count; ++i) {
-            auto *block_column_entry = block_entry->GetColumnBlockEntry(i);
-            column_vectors.emplace_back(block_column_entry->GetColumnVector(buffer_mgr));
-        }
-        parser_context = MakeUnique<ZxvParserCtx>(table_entry_, txn, segment_entry, std::move(block_entry), std::move(column_vectors), delimiter_);
-    }
+    DeferFn close_fp([&]() { fclose(fp); });
+    fseeko(fp, begin, SEEK_SET);
+    CSVRangeStream range_stream{fp, end - begin};
 
     auto opts = MakeUnique<ZsvOpts>();
-    if (header_) {
+    if (header) {
         opts->row_handler = CSVHeaderHandler;
     } else {
         opts->row_handler = CSVRowHandler;
     }
     opts->delimiter = delimiter_;
-    opts->stream = fp;
-    opts->ctx = parser_context.get();
+    opts->read = ReadCSVRange;
+    opts->stream = &range_stream;
+    opts->ctx = parser_context;
     opts->buffsize = (1 << 20); // default buffer size 256k, we use 1M
 
     parser_context->parser_ = ZsvParser(opts.get());
 
-    ZsvStatus csv_parser_status;
-    while ((csv_parser_status = parser_context->parser_.ParseMore()) == zsv_status_ok) {
+    while ((parser_context->status_ = parser_context->parser_.ParseMore()) == zsv_status_ok) {
         ;
     }
     parser_context->parser_.Finish();
+    FlushCSVRows(parser_context);
 
     { // add the last segment entry
         auto segment_entry = parser_context->segment_entry_;
@@ -239,26 +1004,13 @@ void PhysicalImport::ImportCSV(QueryContext *query_context, ImportOperatorState
             parser_context->column_vectors_.clear();
             std::move(*block_entry).Cleanup();
         }
+        parser_context->column_vectors_.clear();
         if (segment_entry->row_count() == 0) {
-            parser_context->column_vectors_.clear();
             std::move(*segment_entry).Cleanup();
         } else {
-            SaveSegmentData(table_entry_, txn, segment_entry);
-        }
-    }
-    fclose(fp);
-
-    if (csv_parser_status != zsv_status_no_more_input) {
-        if (parser_context->err_msg_.get() != nullptr) {
-            UnrecoverableError(*parser_context->err_msg_);
-        } else {
-            String err_msg = ZsvParser::ParseStatusDesc(csv_parser_status);
-            UnrecoverableError(err_msg);
+            parser_context->segments_.push_back(FinishSegmentData(table_entry_, parser_context->txn_, segment_entry));
         }
     }
-
-    auto result_msg = MakeUnique<String>(fmt::format("IMPORT {} Rows", parser_context->row_count_));
-    import_op_state->result_msg_ = std::move(result_msg);
 }
 
 void PhysicalImport::ImportJSONL(QueryContext *query_context, ImportOperatorState *import_op_state) {
@@ -267,53 +1019,102 @@ void PhysicalImport::ImportJSONL(QueryContext *query_context, ImportOperatorStat
     DeferFn file_defer([&]() { fs.Close(*file_handler); });
 
     SizeT file_size = fs.GetFileSize(*file_handler);
-    String jsonl_str(file_size + 1, 0);
+    simdjson::padded_string jsonl_str(file_size);
     SizeT read_n = file_handler->Read(jsonl_str.data(), file_size);
     if (read_n != file_size) {
         UnrecoverableError(fmt::format("Read file size {} doesn't match with file size {}.", read_n, file_size));
     }
 
+    // The file is split after newlines into one range per cpu, the ranges are parsed in parallel into their own segments.
+    const char *data = jsonl_str.data();
+    SizeT range_count = std::max(SizeT(1), std::min(SizeT(query_context->cpu_number_limit()), file_size / IMPORT_MIN_RANGE_SIZE));
+    Vector<SizeT> bounds{0};
+    for (SizeT range_idx = 1; range_idx < range_count; ++range_idx) {
+        SizeT bound = std::max(range_idx * (file_size / range_count), bounds.back());
+        const char *newline = static_cast<const char *>(std::memchr(data + bound, '\n', file_size - bound));
+        bounds.push_back(newline == nullptr ? file_size : newline - data + 1);
+    }
+    bounds.push_back(file_size);
+
+    UniquePtr<ThreadPool> pool;
+    if (range_count > 1) {
+        pool = MakeUnique<ThreadPool>(range_count);
+    }
+    Vector<Vector<SharedPtr<SegmentEntry>>> range_segments(range_count);
+    Vector<SizeT> range_row_counts(range_count);
+    const char *capacity_end = data + file_size + simdjson::SIMDJSON_PADDING;
+    std::exception_ptr parse_exception = ParseRanges(pool.get(), range_count, [&](SizeT range_idx) {
+        range_row_counts[range_idx] =
+            ParseJSONLRange(query_context, data + bounds[range_idx], data + bounds[range_idx + 1], capacity_end, range_segments[range_idx]);
+    });
+
+    // The segments are imported in the order of the ranges even if a range failed, so the rollback cleans them up.
+    Txn *txn = query_context->GetTxn();
+    const String &db_name = *table_entry_->GetDBName();
+    const String &table_name = *table_entry_->GetTableName();
+    SizeT row_count = 0;
+    for (SizeT range_idx = 0; range_idx < range_count; ++range_idx) {
+        for (auto &segment_entry : range_segments[range_idx]) {
+            txn->Import(db_name, table_name, std::move(segment_entry));
+        }
+        row_count += range_row_counts[range_idx];
+    }
+    if (parse_exception) {
+        std::rethrow_exception(parse_exception);
+    }
+
+    auto result_msg = MakeUnique<String>(fmt::format("IMPORT {} Rows", row_count));
+    import_op_state->result_msg_ = std::move(result_msg);
+}
+
+SizeT PhysicalImport::ParseJSONLRange(QueryContext *query_context,
+                                      const char *begin,
+                                      const char *end,
+                                      const char *capacity_end,
+                                      Vector<SharedPtr<SegmentEntry>> &segments) const {
     Txn *txn = query_context->GetTxn();
     u64 segment_id = Catalog::GetNextSegmentID(table_entry_);
     SharedPtr<SegmentEntry> segment_entry = SegmentEntry::NewSegmentEntry(table_entry_, segment_id, txn);
     UniquePtr<BlockEntry> block_entry = BlockEntry::NewBlockEntry(segment_entry.get(), 0, 0, table_entry_->ColumnCount(), txn);
 
-    SizeT start_pos = 0;
     Vector<ColumnVector> column_vectors;
     for (SizeT i = 0; i < table_entry_->ColumnCount(); ++i) {
         auto *block_column_entry = block_entry->GetColumnBlockEntry(i);
         column_vectors.emplace_back(block_column_entry->GetColumnVector(txn->buffer_mgr()));
     }
-    while (true) {
-        SizeT end_pos = jsonl_str.find('\n', start_pos);
-        if (end_pos == String::npos) {
-            end_pos = file_size;
+    simdjson::ondemand::parser parser;
+    SizeT row_count = 0;
+    for (const char *line_begin = begin; line_begin < end;) {
+        const char *line_end = static_cast<const char *>(std::memchr(line_begin, '\n', end - line_begin));
+        if (line_end == nullptr) {
+            line_end = end;
         }
-        std::string_view json_sv(jsonl_str.data() + start_pos, end_pos - start_pos);
-        if (end_pos == file_size) {
-            segment_entry->AppendBlockEntry(std::move(block_entry));
-            SaveSegmentData(table_entry_, txn, segment_entry);
-            break;
+        SizeT line_size = line_end - line_begin;
+        const char *next_line = line_end + 1;
+        if (std::all_of(line_begin, line_end, [](char c) { return std::isspace(static_cast<unsigned char>(c)); })) {
+            line_begin = next_line;
+            continue;
         }
-        start_pos = end_pos + 1;
-
-        nlohmann::json line_json = nlohmann::json::parse(json_sv);
 
-        JSONLRowHandler(line_json, column_vectors);
+        simdjson::ondemand::document doc;
+        CheckJSONError(parser.iterate(line_begin, line_size, capacity_end - line_begin).get(doc));
+        AppendJSONLRow(doc, table_entry_, column_vectors);
         block_entry->IncreaseRowCount(1);
+        ++row_count;
+        line_begin = next_line;
 
         if (block_entry->GetAvailableCapacity() <= 0) {
-            LOG_INFO(fmt::format("Block {} saved", block_entry->block_id()));
             segment_entry->AppendBlockEntry(std::move(block_entry));
+            column_vectors.clear();
             if (segment_entry->Room() <= 0) {
                 LOG_INFO(fmt::format("Segment {} saved", segment_entry->segment_id()));
-                SaveSegmentData(table_entry_, txn, segment_entry);
+                segments.push_back(FinishSegmentData(table_entry_, txn, segment_entry));
+                query_context->CheckCanceled();
                 u64 segment_id = Catalog::GetNextSegmentID(table_entry_);
                 segment_entry = SegmentEntry::NewSegmentEntry(table_entry_, segment_id, txn);
             }
 
             block_entry = BlockEntry::NewBlockEntry(segment_entry.get(), segment_entry->GetNextBlockID(), 0, table_entry_->ColumnCount(), txn);
-            column_vectors.clear();
             for (SizeT i = 0; i < table_entry_->ColumnCount(); ++i) {
                 auto *block_column_entry = block_entry->GetColumnBlockEntry(i);
                 column_vectors.emplace_back(block_column_entry->GetColumnVector(txn->buffer_mgr()));
@@ -321,14 +1122,84 @@ void PhysicalImport::ImportJSONL(QueryContext *query_context, ImportOperatorStat
         }
     }
 
-    auto result_msg = MakeUnique<String>(fmt::format("IMPORT {} Rows", table_entry_->row_count()));
-    import_op_state->result_msg_ = std::move(result_msg);
+    column_vectors.clear();
+    if (block_entry->row_count() > 0) {
+        segment_entry->AppendBlockEntry(std::move(block_entry));
+    } else {
+        std::move(*block_entry).Cleanup();
+    }
+    if (segment_entry->row_count() == 0) {
+        std::move(*segment_entry).Cleanup();
+    } else {
+        segments.push_back(FinishSegmentData(table_entry_, txn, segment_entry));
+    }
+    return row_count;
 }
 
 void PhysicalImport::ImportJSON(QueryContext *, ImportOperatorState *) {
     RecoverableError(Status::NotSupport("Import JSON is not implemented yet."));
 }
 
+void PhysicalImport::ImportParquet(QueryContext *query_context, ImportOperatorState *import_op_state) {
+#ifdef INFINITY_WITH_ARROW
+    auto file = CheckArrowResult(arrow::io::ReadableFile::Open(file_path_));
+    // the column chunks of a row group are decoded by the threads of arrow
+    parquet::ArrowReaderProperties properties;
+    properties.set_use_threads(true);
+    parquet::arrow::FileReaderBuilder reader_builder;
+    CheckArrowStatus(reader_builder.Open(file));
+    reader_builder.properties(properties);
+    std::unique_ptr<parquet::arrow::FileReader> reader;
+    CheckArrowStatus(reader_builder.Build(&reader));
+
+    int row_group_count = reader->num_row_groups();
+    int row_group_idx = 0;
+    std::shared_ptr<arrow::Table> row_group;
+    UniquePtr<arrow::TableBatchReader> batch_reader;
+    SizeT row_count = ImportArrowBatches(query_context, table_entry_, [&]() -> SharedPtr<arrow::RecordBatch> {
+        while (true) {
+            if (batch_reader) {
+                auto batch = CheckArrowResult(batch_reader->Next());
+                if (batch) {
+                    return batch;
+                }
+            }
+            if (row_group_idx == row_group_count) {
+                return nullptr;
+            }
+            CheckArrowStatus(reader->ReadRowGroup(row_group_idx++, &row_group));
+            batch_reader = MakeUnique<arrow::TableBatchReader>(*row_group);
+        }
+    });
+
+    auto result_msg = MakeUnique<String>(fmt::format("IMPORT {} Rows", row_count));
+    import_op_state->result_msg_ = std::move(result_msg);
+#else
+    RecoverableError(Status::NotSupport("Import PARQUET file, infinity is built without arrow."));
+#endif
+}
+
+void PhysicalImport::ImportArrow(QueryContext *query_context, ImportOperatorState *import_op_state) {
+#ifdef INFINITY_WITH_ARROW
+    auto file = CheckArrowResult(arrow::io::MemoryMappedFile::Open(file_path_, arrow::io::FileMode::READ));
+    auto reader = CheckArrowResult(arrow::ipc::RecordBatchFileReader::Open(file));
+
+    int batch_count = reader->num_record_batches();
+    int batch_idx = 0;
+    SizeT row_count = ImportArrowBatches(query_context, table_entry_, [&]() -> SharedPtr<arrow::RecordBatch> {
+        if (batch_idx == batch_count) {
+            return nullptr;
+        }
+        return CheckArrowResult(reader->ReadRecordBatch(batch_idx++));
+    });
+
+    auto result_msg = MakeUnique<String>(fmt::format("IMPORT {} Rows", row_count));
+    import_op_state->result_msg_ = std::move(result_msg);
+#else
+    RecoverableError(Status::NotSupport("Import ARROW file, infinity is built without arrow."));
+#endif
+}
+
 void PhysicalImport::CSVHeaderHandler(void *context) {
     ZxvParserCtx *parser_context = static_cast<ZxvParserCtx *>(context);
     ZsvParser &parser = parser_context->parser_;
@@ -364,12 +1235,6 @@ void PhysicalImport::CSVRowHandler(void *context) {
     auto *table_entry = parser_context->table_entry_;
     SizeT column_count = parser_context->parser_.CellCount();
 
-    auto *txn = parser_context->txn_;
-    auto *buffer_mgr = txn->buffer_mgr();
-
-    auto segment_entry = parser_context->segment_entry_;
-    UniquePtr<BlockEntry> block_entry = std::move(parser_context->block_entry_);
-
     // if column count is larger than columns defined from schema, extra columns are abandoned
     if (column_count != table_entry->ColumnCount()) {
         UniquePtr<String> err_msg =
@@ -378,140 +1243,137 @@ void PhysicalImport::CSVRowHandler(void *context) {
         RecoverableError(Status::ColumnCountMismatch(*err_msg));
     }
 
-    // append data to segment entry
+    // the cells are copied, the buffer of the parser is reused by the next rows
+    String &cell_data = parser_context->cell_data_;
     for (SizeT column_idx = 0; column_idx < column_count; ++column_idx) {
         ZsvCell cell = parser_context->parser_.GetCell(column_idx);
-        std::string_view str_view{};
-        if (cell.len) {
-            str_view = std::string_view((char *)cell.str, cell.len);
-        }
-        auto &column_vector = parser_context->column_vectors_[column_idx];
-        column_vector.AppendByStringView(str_view, parser_context->delimiter_);
+        parser_context->cells_[column_idx].emplace_back(cell_data.size(), cell.len);
+        cell_data.append(reinterpret_cast<const char *>(cell.str), cell.len);
     }
-    block_entry->IncreaseRowCount(1);
+    ++parser_context->batch_row_count_;
     ++parser_context->row_count_;
 
+    if (parser_context->batch_row_count_ >= parser_context->block_entry_->GetAvailableCapacity()) {
+        FlushCSVRows(parser_context);
+    }
+}
+
+void PhysicalImport::FlushCSVRows(ZxvParserCtx *parser_context) {
+    SizeT row_count = parser_context->batch_row_count_;
+    if (row_count == 0) {
+        return;
+    }
+    auto *table_entry = parser_context->table_entry_;
+    auto *txn = parser_context->txn_;
+    auto *buffer_mgr = txn->buffer_mgr();
+    SizeT column_count = table_entry->ColumnCount();
+
+    // append data to segment entry
+    Vector<std::string_view> column_cells(row_count);
+    for (SizeT column_idx = 0; column_idx < column_count; ++column_idx) {
+        auto &cells = parser_context->cells_[column_idx];
+        for (SizeT row_idx = 0; row_idx < row_count; ++row_idx) {
+            auto [offset, length] = cells[row_idx];
+            column_cells[row_idx] = std::string_view(parser_context->cell_data_.data() + offset, length);
+        }
+        parser_context->column_vectors_[column_idx].AppendByStringViews(column_cells, parser_context->delimiter_);
+        cells.clear();
+    }
+    parser_context->cell_data_.clear();
+    parser_context->batch_row_count_ = 0;
+
+    auto &segment_entry = parser_context->segment_entry_;
+    auto &block_entry = parser_context->block_entry_;
+    block_entry->IncreaseRowCount(row_count);
     if (block_entry->GetAvailableCapacity() <= 0) {
         segment_entry->AppendBlockEntry(std::move(block_entry));
+        parser_context->column_vectors_.clear();
         // we have already used all space of the segment
         if (segment_entry->Room() <= 0) {
-            SaveSegmentData(table_entry, txn, segment_entry);
-            u64 segment_id = Catalog::GetNextSegmentID(parser_context->table_entry_);
+            parser_context->segments_.push_back(FinishSegmentData(table_entry, txn, segment_entry));
+            parser_context->query_context_->CheckCanceled();
+            u64 segment_id = Catalog::GetNextSegmentID(table_entry);
             segment_entry = SegmentEntry::NewSegmentEntry(table_entry, segment_id, txn);
-            parser_context->segment_entry_ = segment_entry;
         }
 
         block_entry = BlockEntry::NewBlockEntry(segment_entry.get(), segment_entry->GetNextBlockID(), 0, table_entry->ColumnCount(), txn);
-        parser_context->column_vectors_.clear();
         for (SizeT i = 0; i < column_count; ++i) {
             auto *block_column_entry = block_entry->GetColumnBlockEntry(i);
             parser_context->column_vectors_.emplace_back(block_column_entry->GetColumnVector(buffer_mgr));
         }
     }
+}
 
-    // set parser context
-    parser_context->block_entry_ = std::move(block_entry);
+void PhysicalImport::SaveSegmentData(TableEntry *table_entry, Txn *txn, SharedPtr<SegmentEntry> segment_entry) {
+    segment_entry = FinishSegmentData(table_entry, txn, std::move(segment_entry));
+
+    const String &db_name = *table_entry->GetDBName();
+    const String &table_name = *table_entry->GetTableName();
+    txn->Import(db_name, table_name, std::move(segment_entry));
 }
 
-void PhysicalImport::JSONLRowHandler(const nlohmann::json &line_json, Vector<ColumnVector> &column_vectors) {
-    for (SizeT i = 0; auto &column_vector : column_vectors) {
-        const ColumnDef *column_def = table_entry_->GetColumnDefByID(i++);
+SharedPtr<SegmentEntry> PhysicalImport::FinishSegmentData(TableEntry *table_entry, Txn *txn, SharedPtr<SegmentEntry> segment_entry) {
+    if (table_entry->sort_column_id() != INVALID_COLUMN_ID) {
+        segment_entry = SortSegmentRows(table_entry, txn, std::move(segment_entry));
+    }
+    TxnTimeStamp flush_ts = txn->BeginTS();
+    segment_entry->FlushNewData(flush_ts);
+    return segment_entry;
+}
 
-        switch (column_vector.data_type()->type()) {
-            case kBoolean: {
-                bool v = line_json[column_def->name_];
-                column_vector.AppendByPtr(reinterpret_cast<const_ptr_t>(&v));
-                break;
-            }
-            case kTinyInt: {
-                i8 v = line_json[column_def->name_];
-                column_vector.AppendByPtr(reinterpret_cast<const_ptr_t>(&v));
-                break;
-            }
-            case kSmallInt: {
-                i16 v = line_json[column_def->name_];
-                column_vector.AppendByPtr(reinterpret_cast<const_ptr_t>(&v));
-                break;
-            }
-            case kInteger: {
-                i32 v = line_json[column_def->name_];
-                column_vector.AppendByPtr(reinterpret_cast<const_ptr_t>(&v));
-                break;
-            }
-            case kBigInt: {
-                i64 v = line_json[column_def->name_];
-                column_vector.AppendByPtr(reinterpret_cast<const_ptr_t>(&v));
-                break;
-            }
-            case kFloat: {
-                float v = line_json[column_def->name_];
-                column_vector.AppendByPtr(reinterpret_cast<const_ptr_t>(&v));
-                break;
-            }
-            case kDouble: {
-                double v = line_json[column_def->name_];
-                column_vector.AppendByPtr(reinterpret_cast<const_ptr_t>(&v));
-                break;
+SharedPtr<SegmentEntry> PhysicalImport::SortSegmentRows(TableEntry *table_entry, Txn *txn, SharedPtr<SegmentEntry> segment_entry) {
+    BufferManager *buffer_mgr = txn->buffer_mgr();
+    SizeT column_count = table_entry->ColumnCount();
+    ColumnID sort_column_id = table_entry->sort_column_id();
+    const DataType &sort_type = *table_entry->GetColumnDefByID(sort_column_id)->type();
+
+    SharedPtr<SegmentEntry> sorted_segment;
+    {
+        // the old block index and block offset of each row
+        Vector<Vector<ColumnVector>> block_columns;
+        Vector<Pair<u32, BlockOffset>> rows;
+        Vector<u64> keys;
+        for (const auto &block_entry : segment_entry->block_entries()) {
+            u32 block_idx = block_columns.size();
+            Vector<ColumnVector> &column_vectors = block_columns.emplace_back();
+            for (ColumnID column_id = 0; column_id < column_count; ++column_id) {
+                column_vectors.emplace_back(block_entry->GetColumnBlockEntry(column_id)->GetColumnVector(buffer_mgr));
             }
-            case kVarchar: {
-                std::string_view str_view = line_json[column_def->name_].get<std::string_view>();
-                column_vector.AppendByStringView(str_view, ',');
-                break;
+            for (BlockOffset block_offset = 0; block_offset < block_entry->row_count(); ++block_offset) {
+                rows.emplace_back(block_idx, block_offset);
+                keys.push_back(SortKeyEncoder::EncodeFixed(column_vectors[sort_column_id], sort_type, OrderType::kAsc, block_offset));
             }
-            case kEmbedding: {
-                auto embedding_info = static_cast<EmbeddingInfo *>(column_vector.data_type()->type_info().get());
-                // SizeT dim = embedding_info->Dimension();
-                switch (embedding_info->Type()) {
-                    case kElemInt8: {
-                        Vector<i8> &&embedding = line_json[column_def->name_].get<Vector<i8>>();
-                        column_vector.AppendByPtr(reinterpret_cast<const_ptr_t>(embedding.data()));
-                        break;
-                    }
-                    case kElemInt16: {
-                        Vector<i16> &&embedding = line_json[column_def->name_].get<Vector<i16>>();
-                        column_vector.AppendByPtr(reinterpret_cast<const_ptr_t>(embedding.data()));
-                        break;
-                    }
-                    case kElemInt32: {
-                        Vector<i32> &&embedding = line_json[column_def->name_].get<Vector<i32>>();
-                        column_vector.AppendByPtr(reinterpret_cast<const_ptr_t>(embedding.data()));
-                        break;
-                    }
-                    case kElemInt64: {
-                        Vector<i64> &&embedding = line_json[column_def->name_].get<Vector<i64>>();
-                        column_vector.AppendByPtr(reinterpret_cast<const_ptr_t>(embedding.data()));
-                        break;
-                    }
-                    case kElemFloat: {
-                        Vector<float> &&embedding = line_json[column_def->name_].get<Vector<float>>();
-                        column_vector.AppendByPtr(reinterpret_cast<const_ptr_t>(embedding.data()));
-                        break;
-                    }
-                    case kElemDouble: {
-                        Vector<double> &&embedding = line_json[column_def->name_].get<Vector<double>>();
-                        column_vector.AppendByPtr(reinterpret_cast<const_ptr_t>(embedding.data()));
-                        break;
-                    }
-                    default: {
-                        UnrecoverableError("Not implement: Embedding type.");
-                    }
-                }
-                break;
+        }
+        Vector<u32> order = OrderByFixedKeys(keys);
+        if (std::is_sorted(order.begin(), order.end())) {
+            return segment_entry;
+        }
+
+        // the rows following each other in an old block are copied in one batch
+        sorted_segment = SegmentEntry::NewSegmentEntry(table_entry, Catalog::GetNextSegmentID(table_entry), txn);
+        auto new_block = BlockEntry::NewBlockEntry(sorted_segment.get(), 0, 0, column_count, txn);
+        for (SizeT i = 0; i < order.size();) {
+            if (new_block->GetAvailableCapacity() <= 0) {
+                sorted_segment->AppendBlockEntry(std::move(new_block));
+                new_block = BlockEntry::NewBlockEntry(sorted_segment.get(), sorted_segment->GetNextBlockID(), 0, column_count, txn);
             }
-            default: {
-                UnrecoverableError("Not implement: Invalid data type.");
+            auto [block_idx, block_offset] = rows[order[i]];
+            SizeT room = new_block->GetAvailableCapacity();
+            SizeT batch_size = 1;
+            while (batch_size < room && i + batch_size < order.size() && rows[order[i + batch_size]].first == block_idx &&
+                   rows[order[i + batch_size]].second == block_offset + batch_size) {
+                ++batch_size;
             }
+            new_block->AppendBlock(block_columns[block_idx], block_offset, batch_size, buffer_mgr);
+            i += batch_size;
+        }
+        if (new_block->row_count() > 0) {
+            sorted_segment->AppendBlockEntry(std::move(new_block));
         }
     }
-}
-
-void PhysicalImport::SaveSegmentData(TableEntry *table_entry, Txn *txn, SharedPtr<SegmentEntry> segment_entry) {
-    TxnTimeStamp flush_ts = txn->BeginTS();
-    segment_entry->FlushNewData(flush_ts);
-
-    const String &db_name = *table_entry->GetDBName();
-    const String &table_name = *table_entry->GetTableName();
-    txn->Import(db_name, table_name, std::move(segment_entry));
+    // the column vectors of the old blocks are released
+    segment_entry->Cleanup();
+    return sorted_segment;
 }
 
 } // namespace infinity
@@ -49,16 +49,26 @@ public:
     UniquePtr<BlockEntry> block_entry_{};
     Vector<ColumnVector> column_vectors_{};
     const char delimiter_{};
+    const QueryContext *const query_context_{};
+    ZsvStatus status_{zsv_status_ok};
+    // The cells of the rows not appended to the block yet, as offset and length in cell_data_ by column. They are
+    // converted a column at a time when the block is full or the range ends.
+    String cell_data_{};
+    Vector<Vector<Pair<SizeT, SizeT>>> cells_{};
+    SizeT batch_row_count_{};
+    // The full segments, sorted and flushed, to be imported by the txn in order.
+    Vector<SharedPtr<SegmentEntry>> segments_{};
 
 public:
-    ZxvParserCtx(TableEntry *table_entry,
+    ZxvParserCtx(const QueryContext *query_context,
+                 TableEntry *table_entry,
                  Txn *txn,
                  SharedPtr<SegmentEntry> segment_entry,
                  UniquePtr<BlockEntry> block_entry,
                  Vector<ColumnVector> &&column_vectors,
                  char delimiter)
         : row_count_(0), err_msg_(nullptr), table_entry_(table_entry), txn_(txn), segment_entry_(segment_entry), block_entry_(std::move(block_entry)),
-          column_vectors_(std::move(column_vectors)), delimiter_(delimiter) {}
+          column_vectors_(std::move(column_vectors)), delimiter_(delimiter), query_context_(query_context), cells_(column_vectors_.size()) {}
 };
 
 export class PhysicalImport : public PhysicalOperator {
@@ -88,7 +98,8 @@ public:
         return 0;
     }
 
-    void ImportFVECS(QueryContext *query_context, ImportOperatorState *import_op_state);
+    // FVECS, BVECS, IVECS and FBIN files are mmapped and their blocks are filled by several threads.
+    void ImportVecs(QueryContext *query_context, ImportOperatorState *import_op_state);
 
     /// for push based execution
     void ImportCSV(QueryContext *query_context, ImportOperatorState *import_op_state);
@@ -98,6 +109,11 @@ public:
 
     void ImportJSONL(QueryContext *query_context, ImportOperatorState *import_op_state);
 
+    // Parquet and arrow IPC files are read by the arrow library, which is optional in the build.
+    void ImportParquet(QueryContext *query_context, ImportOperatorState *import_op_state);
+
+    void ImportArrow(QueryContext *query_context, ImportOperatorState *import_op_state);
+
     inline const TableEntry *table_entry() const { return table_entry_; }
 
     inline CopyFileType FileType() const { return file_type_; }
@@ -108,14 +124,38 @@ public:
 
     inline char delimiter() const { return delimiter_; }
 
+    // The column vectors of the blocks of the segment must be released before, the rows of the segment may be moved to
+    // a new segment sorted by the sort key of the table.
     static void SaveSegmentData(TableEntry *table_entry, Txn *txn, SharedPtr<SegmentEntry> segment_entry);
 
+    // SaveSegmentData without the import into the txn, for the threads of a parallel import. The returned segment is
+    // imported by the txn later.
+    static SharedPtr<SegmentEntry> FinishSegmentData(TableEntry *table_entry, Txn *txn, SharedPtr<SegmentEntry> segment_entry);
+
 private:
+    // Copies the rows of an imported segment into a new segment in the order of the sort key of the table and cleans up the
+    // segment, which is not flushed yet. The segment is returned as is if its rows are in order already.
+    static SharedPtr<SegmentEntry> SortSegmentRows(TableEntry *table_entry, Txn *txn, SharedPtr<SegmentEntry> segment_entry);
+
+    UniquePtr<ZxvParserCtx> NewCSVParserContext(QueryContext *query_context, Txn *txn) const;
+
+    // Parses the records in [begin, end) of the csv file, begin is the start of a record.
+    void ParseCSVRange(ZxvParserCtx *parser_context, SizeT begin, SizeT end, bool header) const;
+
     static void CSVHeaderHandler(void *);
 
     static void CSVRowHandler(void *);
 
-    void JSONLRowHandler(const nlohmann::json &line_json, Vector<ColumnVector> &column_vectors);
+    // Appends the buffered rows to the block, moves on to a new block and a new segment when they are full.
+    static void FlushCSVRows(ZxvParserCtx *parser_context);
+
+    // Parses the lines in [begin, end) of the jsonl file into new segments. The bytes up to capacity_end are readable, as
+    // the padding of simdjson. Returns the row count.
+    SizeT ParseJSONLRange(QueryContext *query_context,
+                          const char *begin,
+                          const char *end,
+                          const char *capacity_end,
+                          Vector<SharedPtr<SegmentEntry>> &segments) const;
 
 private:
     SharedPtr<Vector<String>> output_names_{};
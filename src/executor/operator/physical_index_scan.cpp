@@ -14,7 +14,8 @@
 
 module;
 
-#include <bit>
+#include <algorithm>
+#include <cstring>
 #include <vector>
 
 module physical_index_scan;
@@ -33,9 +34,17 @@ import logical_type;
 import table_index_entry;
 import segment_index_entry;
 import segment_entry;
+import block_entry;
+import block_column_entry;
+import column_vector;
+import buffer_manager;
 import fast_rough_filter;
+import join_runtime_filter;
+import secondary_index_in_mem;
+import bitmap_index_data;
+import index_base;
+import create_index_info;
 // TODO:use bitset
-import bitmask;
 import filter_value_type_classification;
 
 namespace infinity {
@@ -43,19 +52,26 @@ namespace infinity {
 PhysicalIndexScan::PhysicalIndexScan(u64 id,
                                      SharedPtr<BaseTableRef> base_table_ref,
                                      SharedPtr<BaseExpression> index_filter_qualified,
-                                     HashMap<ColumnID, TableIndexEntry *> &&column_index_map,
-                                     Vector<FilterExecuteElem> &&filter_execute_command,
-                                     UniquePtr<FastRoughFilterEvaluator> &&fast_rough_filter_evaluator,
+                                     HashMap<ColumnID, TableIndexEntry *> column_index_map,
+                                     Vector<FilterExecuteElem> filter_execute_command,
+                                     SharedPtr<FastRoughFilterEvaluator> fast_rough_filter_evaluator,
+                                     Optional<ColumnID> covered_column_id,
                                      SharedPtr<Vector<LoadMeta>> load_metas,
                                      bool add_row_id)
     : PhysicalOperator(PhysicalOperatorType::kIndexScan, nullptr, nullptr, id, load_metas), base_table_ref_(std::move(base_table_ref)),
       index_filter_qualified_(std::move(index_filter_qualified)), column_index_map_(std::move(column_index_map)),
       filter_execute_command_(std::move(filter_execute_command)), fast_rough_filter_evaluator_(std::move(fast_rough_filter_evaluator)),
-      add_row_id_(add_row_id) {
-    // output only one hidden column: RowID
-    // create empty output_names_ and output_types_
+      add_row_id_(add_row_id), covered_column_id_(covered_column_id) {
+    // output the hidden column RowID, after the column covered by the index if any
     output_names_ = MakeShared<Vector<String>>();
     output_types_ = MakeShared<Vector<SharedPtr<DataType>>>();
+    if (covered_column_id_.has_value()) {
+        if (base_table_ref_->column_ids_.size() != 1 || base_table_ref_->column_ids_[0] != *covered_column_id_) {
+            UnrecoverableError("PhysicalIndexScan: the covered column should be the only column of the table ref.");
+        }
+        output_names_->emplace_back(base_table_ref_->column_names_->at(0));
+        output_types_->emplace_back(base_table_ref_->column_types_->at(0));
+    }
     // TODO: what if add_row_id_ is false?
     if (add_row_id_) {
         output_names_->emplace_back(COLUMN_NAME_ROW_ID);
@@ -99,20 +115,22 @@ bool PhysicalIndexScan::Execute(QueryContext *query_context, OperatorState *oper
     return true;
 }
 
-// TODO: replace bitmask with bitmap
-// Vector<u32>: selected rows in segment (used when selected_num <= (segment_row_cnt / 32)), i.e. size(Vector) <= size(Bitmask)
-// Bitmask: selected rows in segment (used when selected_num > (segment_row_cnt / 32))
+// RoaringBitmap: selected rows in segment
+// the containers of a roaring bitmap pick between sorted arrays, bitsets and runs by the density of each 65536 rows,
+// so the intersection and union of results of any selectivity run container by container without a conversion
 class FilterResult {
 private:
-    using SelectedRows = std::variant<Vector<u32>, Bitmask>;
-
     const u32 segment_row_count_{};        // count of rows in segment, include deleted rows
     const u32 segment_row_actual_count_{}; // count of rows in segment, exclude deleted rows
-    SelectedRows selected_rows_;           // default to Vector<u32>()
+    RoaringBitmap selected_rows_;          // default to empty
+    // for a covering scan, the keys of the rows found in the index, which are the values of the covered column
+    // a key is kept in the first bytes of the u64
+    const bool collect_keys_{};
+    Vector<Pair<u32, u64>> row_keys_;
 
 public:
-    explicit FilterResult(u32 segment_row_count, u32 segment_row_actual_count)
-        : segment_row_count_(segment_row_count), segment_row_actual_count_(segment_row_actual_count) {}
+    explicit FilterResult(u32 segment_row_count, u32 segment_row_actual_count, bool collect_keys)
+        : segment_row_count_(segment_row_count), segment_row_actual_count_(segment_row_actual_count), collect_keys_(collect_keys) {}
 
     // count of rows in segment, include deleted rows
     [[nodiscard]] inline u32 SegmentRowCount() const { return segment_row_count_; }
@@ -122,122 +140,74 @@ public:
     [[nodiscard]] inline u32 SegmentRowActualCount() const { return segment_row_actual_count_; }
 
     // result after consider if_reverse_select_
-    [[nodiscard]] inline u32 SelectedNum() const {
-        return std::visit(Overload{[](const Vector<u32> &selected_rows) -> u32 { return selected_rows.size(); },
-                                   [](const Bitmask &bitmask) -> u32 { return bitmask.CountTrue(); }},
-                          selected_rows_);
-    }
+    [[nodiscard]] inline u32 SelectedNum() const { return selected_rows_.cardinality(); }
 
     inline void MergeOr(FilterResult &other) {
-        // merge selected_rows_
-        std::visit(Overload{[](Bitmask &left_bitmask, const Bitmask &right_bitmask) { left_bitmask.MergeOr(right_bitmask); },
-                            [](Bitmask &left_bitmask, const Vector<u32> &right_selected_rows) {
-                                for (auto offset : right_selected_rows) {
-                                    left_bitmask.SetTrue(offset);
-                                }
-                            },
-                            [&](Vector<u32> &left_selected_rows, Bitmask &right_bitmask) {
-                                for (auto offset : left_selected_rows) {
-                                    right_bitmask.SetTrue(offset);
-                                }
-                                std::swap(selected_rows_, other.selected_rows_);
-                            },
-                            [](Vector<u32> &left_selected_rows, const Vector<u32> &right_selected_rows) {
-                                const u32 left_size = left_selected_rows.size();
-                                const u32 right_size = right_selected_rows.size();
-                                u32 i = 0, j = 0;
-                                Vector<u32> merged_selected_rows;
-                                merged_selected_rows.reserve(left_size + right_size);
-                                while (i < left_size and j < right_size) {
-                                    if (left_selected_rows[i] < right_selected_rows[j]) {
-                                        merged_selected_rows.emplace_back(left_selected_rows[i]);
-                                        ++i;
-                                    } else if (left_selected_rows[i] > right_selected_rows[j]) {
-                                        merged_selected_rows.emplace_back(right_selected_rows[j]);
-                                        ++j;
-                                    } else {
-                                        merged_selected_rows.emplace_back(left_selected_rows[i]);
-                                        ++i;
-                                        ++j;
-                                    }
-                                }
-                                while (i < left_size) {
-                                    merged_selected_rows.emplace_back(left_selected_rows[i]);
-                                    ++i;
-                                }
-                                while (j < right_size) {
-                                    merged_selected_rows.emplace_back(right_selected_rows[j]);
-                                    ++j;
-                                }
-                                std::swap(merged_selected_rows, left_selected_rows);
-                            }},
-                   selected_rows_,
-                   other.selected_rows_);
+        selected_rows_ |= other.selected_rows_;
+        MergeRowKeys(other);
     }
 
     inline void MergeAnd(FilterResult &other) {
-        // merge selected_rows_
-        std::visit(Overload{[](Bitmask &left_bitmask, const Bitmask &right_bitmask) { left_bitmask.Merge(right_bitmask); },
-                            [&](Bitmask &left_bitmask, Vector<u32> &right_selected_rows) {
-                                // apply left bitmask as filter on right vector
-                                u32 new_right_size = 0;
-                                for (auto offset : right_selected_rows) {
-                                    if (left_bitmask.IsTrue(offset)) {
-                                        right_selected_rows[new_right_size++] = offset;
-                                    }
-                                }
-                                // possible: new_right_size = 0
-                                right_selected_rows.resize(new_right_size);
-                                std::swap(selected_rows_, other.selected_rows_);
-                            },
-                            [](Vector<u32> &left_selected_rows, const Bitmask &right_bitmask) {
-                                // apply right bitmask as filter on left vector
-                                u32 new_left_size = 0;
-                                for (auto offset : left_selected_rows) {
-                                    if (right_bitmask.IsTrue(offset)) {
-                                        left_selected_rows[new_left_size++] = offset;
-                                    }
-                                }
-                                // possible: new_left_size = 0
-                                left_selected_rows.resize(new_left_size);
-                            },
-                            [](Vector<u32> &left_selected_rows, const Vector<u32> &right_selected_rows) {
-                                // apply right vector as filter on left vector
-                                const u32 right_size = right_selected_rows.size();
-                                u32 i = 0;
-                                u32 new_left_size = 0;
-                                for (u32 offset : left_selected_rows) {
-                                    while (i < right_size and right_selected_rows[i] < offset) {
-                                        ++i;
-                                    }
-                                    if (i < right_size and right_selected_rows[i] == offset) {
-                                        left_selected_rows[new_left_size++] = offset;
-                                        ++i;
-                                    }
-                                }
-                                // possible: new_left_size = 0
-                                left_selected_rows.resize(new_left_size);
-                            }},
-                   selected_rows_,
-                   other.selected_rows_);
+        selected_rows_ &= other.selected_rows_;
+        MergeRowKeys(other);
+    }
+
+    // the keys of the rows no longer selected are skipped by Output()
+    inline void MergeRowKeys(FilterResult &other) {
+        if (row_keys_.empty()) {
+            row_keys_ = std::move(other.row_keys_);
+        } else {
+            row_keys_.insert(row_keys_.end(), other.row_keys_.begin(), other.row_keys_.end());
+        }
+    }
+
+    inline void SetEmptyResult() { selected_rows_ = RoaringBitmap(); }
+
+    template <typename ColumnValueType>
+    inline void ExecuteSingleRangeT(const FilterIntervalRangeT<ColumnValueType> &interval_range,
+                                    SegmentIndexEntry &index_entry,
+                                    TxnTimeStamp begin_ts) {
+        const SecondaryIndexInMem *index_in_mem = index_entry.GetSecondaryIndexInMem();
+        const u32 in_mem_row_count = index_in_mem == nullptr ? 0 : index_in_mem->GetRowCount();
+        if (index_entry.table_index_entry()->index_base()->index_type_ == IndexType::kBitmap) {
+            SearchBitmap(interval_range, index_entry, in_mem_row_count);
+        } else {
+            SearchPGM(interval_range, index_entry, in_mem_row_count);
+        }
+        if (index_in_mem != nullptr) {
+            // the rows appended after the segment index was built
+            auto [begin_val, end_val] = interval_range.GetRange();
+            index_in_mem->RangeQuery(&begin_val, &end_val, begin_ts, selected_rows_);
+        }
     }
 
-    inline void SetEmptyResult() {
-        // use empty vector
-        selected_rows_.emplace<Vector<u32>>();
+    // the rows of the keys in the range are the union of their bitmaps, an equality is a copy of one bitmap
+    template <typename ColumnValueType>
+    inline void SearchBitmap(const FilterIntervalRangeT<ColumnValueType> &interval_range, SegmentIndexEntry &index_entry, u32 in_mem_row_count) {
+        BufferHandle index_handle = index_entry.GetIndex();
+        auto index = static_cast<const BitmapIndexData *>(index_handle.GetData());
+        auto index_data_num = index->GetDataNum();
+        if (index_data_num + in_mem_row_count < SegmentRowActualCount()) {
+            UnrecoverableError("FilterResult::ExecuteSingleRange(): index_data_num < SegmentRowActualCount(). index error.");
+        }
+        SetEmptyResult();
+        if (index_data_num == 0) {
+            return;
+        }
+        auto [begin_val, end_val] = interval_range.GetRange();
+        index->RangeQuery(&begin_val, &end_val, selected_rows_);
     }
 
     template <typename ColumnValueType>
-    inline void
-    ExecuteSingleRangeT(const FilterIntervalRangeT<ColumnValueType> &interval_range, SegmentIndexEntry &index_entry, SegmentID segment_id) {
+    inline void SearchPGM(const FilterIntervalRangeT<ColumnValueType> &interval_range, SegmentIndexEntry &index_entry, u32 in_mem_row_count) {
         using T = FilterIntervalRangeT<ColumnValueType>::T;
         BufferHandle index_handle_head = index_entry.GetIndex();
         auto index = static_cast<const SecondaryIndexDataHead *>(index_handle_head.GetData());
         auto index_part_capacity = index->GetPartCapacity();
         auto index_part_num = index->GetPartNum();
         auto index_data_num = index->GetDataNum();
-        if (index_data_num != SegmentRowActualCount()) {
-            if (index_data_num < SegmentRowActualCount()) {
+        if (index_data_num + in_mem_row_count != SegmentRowActualCount()) {
+            if (index_data_num + in_mem_row_count < SegmentRowActualCount()) {
                 UnrecoverableError("FilterResult::ExecuteSingleRange(): index_data_num < SegmentRowActualCount(). index error.");
             } else {
                 LOG_INFO(fmt::format("FilterResult::ExecuteSingleRange(): index_data_num: {}, SegmentRowActualCount(): {}. Some rows are deleted.",
@@ -245,6 +215,10 @@ public:
                                      SegmentRowActualCount()));
             }
         }
+        if (index_data_num == 0) {
+            // the segment was created after the index, all its rows are in the in-memory delta
+            return SetEmptyResult();
+        }
         auto [begin_val, end_val] = interval_range.GetRange();
         // 1. search PGM and get approximate search range
         // result:
@@ -373,50 +347,41 @@ public:
             return SetEmptyResult();
         }
         u32 result_size = end_pos - begin_pos;
-        // use array or bitmask for result
-        // use array when result_size <= 1024 or size of array (u32 type) <= size of bitmask
-        bool use_array = result_size <= 1024 or result_size <= (std::bit_ceil(SegmentRowCount()) / 32);
         // 4. output result
+        // the offsets of a part are added at once, addMany() keeps the container of the last row to add the next row quickly
         auto index_offset_b_ptr = static_cast<const u32 *>(index_data_b->GetColumnOffsetData());
-        if (use_array) {
-            auto &selected_rows = selected_rows_.emplace<Vector<u32>>();
-            selected_rows.reserve(result_size);
-            for (u32 i = 0; i < result_size; ++i) {
-                if (begin_part_offset == begin_part_size) {
-                    index_handle_b = index_entry.GetIndexPartAt(++begin_part_id);
-                    index_data_b = static_cast<const SecondaryIndexDataPart *>(index_handle_b.GetData());
-                    index_offset_b_ptr = static_cast<const u32 *>(index_data_b->GetColumnOffsetData());
-                    begin_part_size = index_data_b->GetPartSize();
-                    begin_part_offset = 0;
-                }
-                selected_rows.emplace_back(index_offset_b_ptr[begin_part_offset]);
-                ++begin_part_offset;
+        SetEmptyResult();
+        if (collect_keys_) {
+            row_keys_.reserve(row_keys_.size() + result_size);
+        }
+        while (result_size > 0) {
+            if (begin_part_offset == begin_part_size) {
+                index_handle_b = index_entry.GetIndexPartAt(++begin_part_id);
+                index_data_b = static_cast<const SecondaryIndexDataPart *>(index_handle_b.GetData());
+                index_key_b_ptr = static_cast<const T *>(index_data_b->GetColumnKeyData());
+                index_offset_b_ptr = static_cast<const u32 *>(index_data_b->GetColumnOffsetData());
+                begin_part_size = index_data_b->GetPartSize();
+                begin_part_offset = 0;
             }
-            // need to sort
-            std::sort(selected_rows.begin(), selected_rows.end());
-            return;
-        } else {
-            auto &bitmask = selected_rows_.emplace<Bitmask>();
-            bitmask.Initialize(std::bit_ceil(SegmentRowCount()));
-            bitmask.SetAllFalse();
-            for (u32 i = 0; i < result_size; ++i) {
-                if (begin_part_offset == begin_part_size) {
-                    index_handle_b = index_entry.GetIndexPartAt(++begin_part_id);
-                    index_data_b = static_cast<const SecondaryIndexDataPart *>(index_handle_b.GetData());
-                    index_offset_b_ptr = static_cast<const u32 *>(index_data_b->GetColumnOffsetData());
-                    begin_part_size = index_data_b->GetPartSize();
-                    begin_part_offset = 0;
+            u32 add_size = std::min<u32>(result_size, begin_part_size - begin_part_offset);
+            selected_rows_.addMany(add_size, index_offset_b_ptr + begin_part_offset);
+            if (collect_keys_) {
+                for (u32 i = begin_part_offset; i < begin_part_offset + add_size; ++i) {
+                    u64 key_bits = 0;
+                    std::memcpy(&key_bits, index_key_b_ptr + i, sizeof(T));
+                    row_keys_.emplace_back(index_offset_b_ptr[i], key_bits);
                 }
-                bitmask.SetTrue(index_offset_b_ptr[begin_part_offset]);
-                ++begin_part_offset;
             }
-            return;
+            begin_part_offset += add_size;
+            result_size -= add_size;
         }
+        selected_rows_.runOptimize();
     }
 
     inline void ExecuteSingleRange(const HashMap<ColumnID, TableIndexEntry *> &column_index_map,
                                    const FilterExecuteSingleRange &single_range,
-                                   SegmentID segment_id) {
+                                   SegmentID segment_id,
+                                   TxnTimeStamp begin_ts) {
         // step 1. check if range is empty
         if (single_range.IsEmpty()) {
             return SetEmptyResult();
@@ -428,7 +393,7 @@ public:
         // step 3. search index
         auto &interval_range_variant = single_range.GetIntervalRange();
         std::visit(Overload{[&]<typename ColumnValueType>(const FilterIntervalRangeT<ColumnValueType> &interval_range) {
-                                ExecuteSingleRangeT(interval_range, index_entry, segment_id);
+                                ExecuteSingleRangeT(interval_range, index_entry, begin_ts);
                             },
                             [](const std::monostate &empty) {
                                 UnrecoverableError("FilterResult::ExecuteSingleRange(): class member interval_range_ not initialized!");
@@ -436,17 +401,32 @@ public:
                    interval_range_variant);
     }
 
-    inline void Output(Vector<UniquePtr<DataBlock>> &output_data_blocks, SegmentID segment_id, const DeleteFilter &delete_filter) const {
+    // covered_column_id: the column output before the row ids, from the keys of the index. The rows not in the index part, i.e. in
+    // its in-memory delta, are read from the column.
+    // At most max_output_rows rows are output, the number of rows output is returned.
+    inline u32 Output(Vector<UniquePtr<DataBlock>> &output_data_blocks,
+                      const Vector<SharedPtr<DataType>> &output_types,
+                      Optional<ColumnID> covered_column_id,
+                      SegmentEntry *segment_entry,
+                      BufferManager *buffer_mgr,
+                      const DeleteFilter &delete_filter,
+                      u32 max_output_rows) {
+        const SegmentID segment_id = segment_entry->segment_id();
         const u32 block_capacity = DEFAULT_BLOCK_CAPACITY;
         const u32 selected_row_num = SelectedNum(); // before delete filter
+        const SizeT row_id_column_idx = output_types.size() - 1;
         u32 output_rows = 0;
         u32 invalid_rows = 0;
         // check if output_data_blocks is empty
         if (!output_data_blocks.empty()) {
             UnrecoverableError("FilterResult::Output(): output data block array should be empty.");
         }
-        Vector<SharedPtr<DataType>> output_types;
-        output_types.emplace_back(MakeShared<DataType>(LogicalType::kRowID));
+        if (covered_column_id.has_value()) {
+            std::sort(row_keys_.begin(), row_keys_.end(), [](const auto &lhs, const auto &rhs) { return lhs.first < rhs.first; });
+        }
+        auto row_key_iter = row_keys_.cbegin();
+        BlockID column_block_id = INVALID_BLOCK_ID;
+        Optional<ColumnVector> column_vector;
         // 1. prepare first output_data_block
         auto append_data_block = [&]() {
             auto data_block = DataBlock::MakeUniquePtr();
@@ -458,62 +438,51 @@ public:
         append_data_block();
         // 2. output
         // delete_filter: return false if the row is deleted
-        std::visit(Overload{[&](const Bitmask &bitmask) {
-                                u32 output_block_row_id = 0;
-                                DataBlock *output_block_ptr = output_data_blocks.back().get();
-                                // TODO: 64 bit in a loop?
-                                const u32 segment_row_count = SegmentRowCount();
-                                for (u32 segment_offset = 0; segment_offset < segment_row_count; ++segment_offset) {
-                                    if (bitmask.IsTrue(segment_offset)) {
-                                        if (!delete_filter(segment_offset)) {
-                                            // deleted
-                                            ++invalid_rows;
-                                            continue;
-                                        }
-                                        if (output_block_row_id == block_capacity) {
-                                            output_block_ptr->Finalize();
-                                            append_data_block();
-                                            output_block_ptr = output_data_blocks.back().get();
-                                            output_block_row_id = 0;
-                                        }
-                                        RowID row_id(segment_id, segment_offset);
-                                        output_block_ptr->AppendValueByPtr(0, (ptr_t)&row_id);
-                                        ++output_block_row_id;
-                                        ++output_rows;
-                                    }
-                                }
-                                output_block_ptr->Finalize();
-                                if (output_rows + invalid_rows != selected_row_num) {
-                                    UnrecoverableError("FilterResult::Output(): output row num error.");
-                                }
-                            },
-                            [&](const Vector<u32> &selected_rows) {
-                                u32 output_block_row_id = 0;
-                                DataBlock *output_block_ptr = output_data_blocks.back().get();
-                                for (u32 segment_offset : selected_rows) {
-                                    if (!delete_filter(segment_offset)) {
-                                        // deleted
-                                        ++invalid_rows;
-                                        continue;
-                                    }
-                                    if (output_block_row_id == block_capacity) {
-                                        output_block_ptr->Finalize();
-                                        append_data_block();
-                                        output_block_ptr = output_data_blocks.back().get();
-                                        output_block_row_id = 0;
-                                    }
-                                    RowID row_id(segment_id, segment_offset);
-                                    output_block_ptr->AppendValueByPtr(0, (ptr_t)&row_id);
-                                    ++output_block_row_id;
-                                    ++output_rows;
-                                }
-                                output_block_ptr->Finalize();
-                                if (output_rows + invalid_rows != selected_row_num) {
-                                    UnrecoverableError("FilterResult::Output(): output row num error.");
-                                }
-                            }},
-                   selected_rows_);
+        u32 output_block_row_id = 0;
+        DataBlock *output_block_ptr = output_data_blocks.back().get();
+        for (u32 segment_offset : selected_rows_) {
+            if (output_rows == max_output_rows) {
+                break;
+            }
+            if (!delete_filter(segment_offset)) {
+                // deleted
+                ++invalid_rows;
+                continue;
+            }
+            if (output_block_row_id == block_capacity) {
+                output_block_ptr->Finalize();
+                append_data_block();
+                output_block_ptr = output_data_blocks.back().get();
+                output_block_row_id = 0;
+            }
+            if (covered_column_id.has_value()) {
+                while (row_key_iter != row_keys_.cend() && row_key_iter->first < segment_offset) {
+                    ++row_key_iter;
+                }
+                if (row_key_iter != row_keys_.cend() && row_key_iter->first == segment_offset) {
+                    output_block_ptr->AppendValueByPtr(0, (ptr_t)&row_key_iter->second);
+                } else {
+                    const BlockID block_id = segment_offset / DEFAULT_BLOCK_CAPACITY;
+                    if (block_id != column_block_id) {
+                        auto block_entry = segment_entry->GetBlockEntryByID(block_id);
+                        column_vector.emplace(block_entry->GetColumnBlockEntry(*covered_column_id)->GetColumnVector(buffer_mgr));
+                        column_block_id = block_id;
+                    }
+                    const SizeT value_size = output_types[0]->Size();
+                    output_block_ptr->AppendValueByPtr(0, column_vector->data() + (segment_offset % DEFAULT_BLOCK_CAPACITY) * value_size);
+                }
+            }
+            RowID row_id(segment_id, segment_offset);
+            output_block_ptr->AppendValueByPtr(row_id_column_idx, (ptr_t)&row_id);
+            ++output_block_row_id;
+            ++output_rows;
+        }
+        output_block_ptr->Finalize();
+        if (output_rows < max_output_rows && output_rows + invalid_rows != selected_row_num) {
+            UnrecoverableError("FilterResult::Output(): output row num error.");
+        }
         LOG_INFO(fmt::format("FilterResult::Output(): output rows: {}, invalid candidate rows: {}", output_rows, invalid_rows));
+        return output_rows;
     }
 };
 
@@ -545,15 +514,19 @@ void PhysicalIndexScan::ExecuteInternal(QueryContext *query_context, IndexScanOp
     }
     // check FastRoughFilter
     const auto &fast_rough_filter = *segment_entry->GetFastRoughFilter();
-    if (fast_rough_filter_evaluator_ and !fast_rough_filter_evaluator_->Evaluate(begin_ts, fast_rough_filter)) {
+    bool segment_may_pass = !fast_rough_filter_evaluator_ || fast_rough_filter_evaluator_->Evaluate(begin_ts, fast_rough_filter);
+    for (const auto &runtime_filter : join_runtime_filters_) {
+        // none of the keys of the build side of the join is in this segment
+        const FastRoughFilterEvaluator *evaluator = runtime_filter->Get();
+        segment_may_pass = segment_may_pass && (evaluator == nullptr || evaluator->Evaluate(begin_ts, fast_rough_filter));
+    }
+    if (!segment_may_pass) {
         // skip this segment
         LOG_TRACE(fmt::format("IndexScan: job number: {}, segment_ids.size(): {}, skipped after FastRoughFilter", next_idx, segment_ids.size()));
         // output one empty data block
         // some operator expect at least one input block
-        Vector<SharedPtr<DataType>> output_types;
-        output_types.emplace_back(MakeShared<DataType>(LogicalType::kRowID));
         auto data_block = DataBlock::MakeUniquePtr();
-        data_block->Init(output_types);
+        data_block->Init(*output_types_);
         output_data_blocks.emplace_back(std::move(data_block));
         // update next_idx
         // check if jobs are all done
@@ -596,8 +569,8 @@ void PhysicalIndexScan::ExecuteInternal(QueryContext *query_context, IndexScanOp
                                 }
                             },
                             [&](const FilterExecuteSingleRange &single_range) {
-                                result_stack.emplace_back(segment_row_count, segment_row_actual_count);
-                                result_stack.back().ExecuteSingleRange(column_index_map_, single_range, segment_id);
+                                result_stack.emplace_back(segment_row_count, segment_row_actual_count, covered_column_id_.has_value());
+                                result_stack.back().ExecuteSingleRange(column_index_map_, single_range, segment_id, begin_ts);
                             }},
                    elem);
     }
@@ -609,12 +582,23 @@ void PhysicalIndexScan::ExecuteInternal(QueryContext *query_context, IndexScanOp
     DeleteFilter delete_filter(segment_entry, begin_ts);
     // output
     auto &result = result_stack.back();
-    result.Output(output_data_blocks, segment_id, delete_filter);
+    SizeT &output_row_count = index_scan_operator_state->output_row_count_;
+    u32 max_output_rows = std::numeric_limits<u32>::max();
+    if (row_limit_.has_value()) {
+        max_output_rows = std::min<SizeT>(max_output_rows, *row_limit_ - output_row_count);
+    }
+    output_row_count += result.Output(output_data_blocks,
+                                      *output_types_,
+                                      covered_column_id_,
+                                      segment_entry,
+                                      query_context->storage()->buffer_manager(),
+                                      delete_filter,
+                                      max_output_rows);
 
     LOG_TRACE(fmt::format("IndexScan: job number: {}, segment_ids.size(): {}, finished", next_idx, segment_ids.size()));
     // update next_idx
-    // check if jobs are all done
-    if (++next_idx >= segment_ids.size()) {
+    // check if jobs are all done, the segments after the row limit aren't searched
+    if (++next_idx >= segment_ids.size() || (row_limit_.has_value() && output_row_count >= *row_limit_)) {
         // Finished
         index_scan_operator_state->SetComplete();
     }
@@ -35,6 +35,7 @@ import secondary_index_scan_execute_expression;
 import table_index_entry;
 import segment_index_entry;
 import fast_rough_filter;
+import join_runtime_filter;
 
 namespace infinity {
 
@@ -42,16 +43,17 @@ namespace infinity {
 // for float range filter, x > f is equivalent to x >= std::nextafter(f, INFINITY)
 // we can use this to simplify the filter
 
-// output: only selected RowIDs
-// load columns by LoadMeta
+// output: selected RowIDs, after the values of the column covered by the secondary index if the next operator only needs it
+// load other columns by LoadMeta
 export class PhysicalIndexScan final : public PhysicalOperator {
 public:
     explicit PhysicalIndexScan(u64 id,
                                SharedPtr<BaseTableRef> base_table_ref,
                                SharedPtr<BaseExpression> index_filter_qualified,
-                               HashMap<ColumnID, TableIndexEntry *> &&column_index_map,
-                               Vector<FilterExecuteElem> &&filter_execute_command,
-                               UniquePtr<FastRoughFilterEvaluator> &&fast_rough_filter_evaluator,
+                               HashMap<ColumnID, TableIndexEntry *> column_index_map,
+                               Vector<FilterExecuteElem> filter_execute_command,
+                               SharedPtr<FastRoughFilterEvaluator> fast_rough_filter_evaluator,
+                               Optional<ColumnID> covered_column_id,
                                SharedPtr<Vector<LoadMeta>> load_metas,
                                bool add_row_id = true);
 
@@ -70,6 +72,8 @@ public:
     // index scan: one tasklet scan one segment
     SizeT TaskletCount() final { return base_table_ref_->block_index_->SegmentCount(); }
 
+    SizeT EstimatedRowCount() const { return base_table_ref_->block_index_->RowCount(); }
+
     // for InputLoad
     void FillingTableRefs(HashMap<SizeT, SharedPtr<BaseTableRef>> &table_refs) override {
         table_refs.insert({base_table_ref_->table_index_, base_table_ref_});
@@ -85,6 +89,14 @@ public:
 
     inline auto &FilterExpression() const { return index_filter_qualified_; }
 
+    inline const Optional<ColumnID> &covered_column_id() const { return covered_column_id_; }
+
+    // the keys of the build side of a hash join which this scan is the probe of, checked once published
+    void AddJoinRuntimeFilter(SharedPtr<JoinRuntimeFilter> runtime_filter) { join_runtime_filters_.emplace_back(std::move(runtime_filter)); }
+
+    // the scan is right under a LIMIT of so many rows, each task stops when it has output them
+    void SetRowLimit(SizeT row_limit) { row_limit_ = row_limit; }
+
 private:
     void ExecuteInternal(QueryContext *query_context, IndexScanOperatorState *index_scan_operator_state) const;
 
@@ -98,10 +110,15 @@ private:
     // Commands used in ExecuteInternal()
     Vector<FilterExecuteElem> filter_execute_command_{};
 
-    UniquePtr<FastRoughFilterEvaluator> fast_rough_filter_evaluator_{};
+    SharedPtr<FastRoughFilterEvaluator> fast_rough_filter_evaluator_{};
+
+    Vector<SharedPtr<JoinRuntimeFilter>> join_runtime_filters_{};
 
     bool add_row_id_{};
     mutable Vector<SizeT> column_ids_{};
+    // the column output from the keys of its secondary index
+    Optional<ColumnID> covered_column_id_{};
+    Optional<SizeT> row_limit_{};
 };
 
 } // namespace infinity
@@ -36,12 +36,31 @@ import status;
 import infinity_exception;
 
 import column_def;
+import config;
+import catalog;
+import segment_entry;
+import block_entry;
+import block_column_entry;
+import column_vector;
+import value_expression;
+import cast_expression;
+import bound_cast_func;
+import expression_type;
+import data_type;
+import physical_import;
 
 namespace infinity {
 
 void PhysicalInsert::Init() {}
 
 bool PhysicalInsert::Execute(QueryContext *query_context, OperatorState *operator_state) {
+    if (!data_blocks_.empty()) {
+        SizeT inserted_row_count = InsertDataBlocks(query_context);
+        SetResultMsg(operator_state, MakeUnique<String>(fmt::format("INSERTED {} Rows", inserted_row_count)));
+        operator_state->SetComplete();
+        return true;
+    }
+
     SizeT row_count = value_list_.size();
     SizeT column_count = value_list_[0].size();
     SizeT table_collection_column_count = table_entry_->ColumnCount();
@@ -69,28 +88,28 @@ bool PhysicalInsert::Execute(QueryContext *query_context, OperatorState *operato
 
     SharedPtr<DataBlock> output_block = DataBlock::Make();
     output_block->Init(output_types);
-    SharedPtr<DataBlock> output_block_tmp = DataBlock::Make();
-    output_block_tmp->Init(output_types);
-
-    ExpressionEvaluator evaluator;
-    evaluator.Init(nullptr);
-    // Each cell's expression of a column may differ. So we have to evaluate each cell instead of column here.
-    for (SizeT row_idx = 0; row_idx < row_count; ++row_idx) {
-        for (SizeT expr_idx = 0; expr_idx < column_count; ++expr_idx) {
-            const SharedPtr<BaseExpression> &expr = value_list_[row_idx][expr_idx];
-            SharedPtr<ExpressionState> expr_state = ExpressionState::CreateState(expr);
-            evaluator.Execute(expr, expr_state, output_block_tmp->column_vectors[expr_idx]);
-        }
-        output_block->AppendWith(output_block_tmp);
+    for (SizeT column_idx = 0; column_idx < column_count; ++column_idx) {
+        FillColumn(column_idx, output_block->column_vectors[column_idx]);
     }
     output_block->Finalize();
 
     auto *txn = query_context->GetTxn();
     const String &db_name = *table_entry_->GetDBName();
     const String &table_name = *table_entry_->GetTableName();
-    txn->Append(db_name, table_name, output_block);
+    u64 bulk_threshold = query_context->global_config()->insert_bulk_threshold();
+    if (bulk_threshold > 0 && row_count >= bulk_threshold) {
+        // Write the rows as a new sealed segment like IMPORT, so the wal only logs its metadata instead of the data.
+        ImportDataBlocks(query_context, {output_block});
+    } else {
+        txn->Append(db_name, table_name, output_block);
+    }
+
+    SetResultMsg(operator_state, MakeUnique<String>(fmt::format("INSERTED {} Rows", output_block->row_count())));
+    operator_state->SetComplete();
+    return true;
+}
 
-    UniquePtr<String> result_msg = MakeUnique<String>(fmt::format("INSERTED {} Rows", output_block->row_count()));
+void PhysicalInsert::SetResultMsg(OperatorState *operator_state, UniquePtr<String> result_msg) {
     if (operator_state == nullptr) {
         // Generate the result table
         Vector<SharedPtr<ColumnDef>> column_defs;
@@ -101,8 +120,109 @@ bool PhysicalInsert::Execute(QueryContext *query_context, OperatorState *operato
         InsertOperatorState *insert_operator_state = static_cast<InsertOperatorState *>(operator_state);
         insert_operator_state->result_msg_ = std::move(result_msg);
     }
-    operator_state->SetComplete();
-    return true;
+}
+
+SizeT PhysicalInsert::InsertDataBlocks(QueryContext *query_context) {
+    auto *txn = query_context->GetTxn();
+    const String &db_name = *table_entry_->GetDBName();
+    const String &table_name = *table_entry_->GetTableName();
+    SizeT row_count = 0;
+    for (const auto &data_block : data_blocks_) {
+        row_count += data_block->row_count();
+    }
+
+    u64 bulk_threshold = query_context->global_config()->insert_bulk_threshold();
+    if (bulk_threshold == 0 || row_count < bulk_threshold) {
+        for (const auto &data_block : data_blocks_) {
+            txn->Append(db_name, table_name, data_block);
+        }
+        return row_count;
+    }
+
+    ImportDataBlocks(query_context, data_blocks_);
+    return row_count;
+}
+
+void PhysicalInsert::ImportDataBlocks(QueryContext *query_context, const Vector<SharedPtr<DataBlock>> &data_blocks) {
+    auto *txn = query_context->GetTxn();
+    const String &db_name = *table_entry_->GetDBName();
+    const String &table_name = *table_entry_->GetTableName();
+    SizeT column_count = table_entry_->ColumnCount();
+
+    // Each block of at most DEFAULT_BLOCK_CAPACITY rows becomes a block entry. The segments are finished like the ones of IMPORT,
+    // so their rows are sorted by the sort key of the table.
+    SharedPtr<SegmentEntry> segment_entry = SegmentEntry::NewSegmentEntry(table_entry_, Catalog::GetNextSegmentID(table_entry_), txn);
+    for (const auto &data_block : data_blocks) {
+        SizeT block_row_count = data_block->row_count();
+        if (segment_entry->Room() < static_cast<int>(block_row_count)) {
+            segment_entry = PhysicalImport::FinishSegmentData(table_entry_, txn, std::move(segment_entry));
+            txn->Import(db_name, table_name, std::move(segment_entry));
+            query_context->CheckCanceled();
+            segment_entry = SegmentEntry::NewSegmentEntry(table_entry_, Catalog::GetNextSegmentID(table_entry_), txn);
+        }
+        UniquePtr<BlockEntry> block_entry = BlockEntry::NewBlockEntry(segment_entry.get(), segment_entry->GetNextBlockID(), 0, column_count, txn);
+        for (SizeT column_id = 0; column_id < column_count; ++column_id) {
+            block_entry->GetColumnBlockEntry(column_id)->Append(data_block->column_vectors[column_id].get(), 0, block_row_count, txn->buffer_mgr());
+        }
+        block_entry->IncreaseRowCount(block_row_count);
+        segment_entry->AppendBlockEntry(std::move(block_entry));
+    }
+    segment_entry = PhysicalImport::FinishSegmentData(table_entry_, txn, std::move(segment_entry));
+    txn->Import(db_name, table_name, std::move(segment_entry));
+}
+
+void PhysicalInsert::FillColumn(SizeT column_idx, SharedPtr<ColumnVector> &column_vector) const {
+    const SizeT row_count = value_list_.size();
+    const DataType &column_type = *column_vector->data_type();
+
+    // the constant of a cell, with the cast to the column type if any
+    auto get_constant = [&](SizeT row_idx) -> Pair<const ValueExpression *, CastExpression *> {
+        BaseExpression *expr = value_list_[row_idx][column_idx].get();
+        CastExpression *cast_expr = nullptr;
+        if (expr->type() == ExpressionType::kCast) {
+            cast_expr = static_cast<CastExpression *>(expr);
+            expr = cast_expr->arguments()[0].get();
+        }
+        if (expr->type() != ExpressionType::kValue) {
+            return {nullptr, nullptr};
+        }
+        return {static_cast<const ValueExpression *>(expr), cast_expr};
+    };
+    auto [first_value, first_cast] = get_constant(0);
+    bool all_constant = first_value != nullptr;
+    for (SizeT row_idx = 1; all_constant && row_idx < row_count; ++row_idx) {
+        auto [value_expr, cast_expr] = get_constant(row_idx);
+        all_constant = value_expr != nullptr && (cast_expr == nullptr) == (first_cast == nullptr) && value_expr->Type() == first_value->Type();
+    }
+
+    if (all_constant && first_cast == nullptr && first_value->Type() == column_type) {
+        for (SizeT row_idx = 0; row_idx < row_count; ++row_idx) {
+            column_vector->AppendValue(get_constant(row_idx).first->GetValue());
+        }
+        return;
+    }
+    if (all_constant && first_cast != nullptr) {
+        auto source_vector = MakeShared<ColumnVector>(MakeShared<DataType>(first_value->Type()));
+        source_vector->Initialize(ColumnVectorType::kFlat, row_count);
+        for (SizeT row_idx = 0; row_idx < row_count; ++row_idx) {
+            source_vector->AppendValue(get_constant(row_idx).first->GetValue());
+        }
+        CastParameters cast_parameters;
+        first_cast->func_.function(source_vector, column_vector, row_count, cast_parameters);
+        return;
+    }
+
+    // Each cell's expression of the column may differ, so each cell is evaluated instead of the column.
+    auto cell_vector = MakeShared<ColumnVector>(column_vector->data_type());
+    cell_vector->Initialize();
+    ExpressionEvaluator evaluator;
+    evaluator.Init(nullptr);
+    for (SizeT row_idx = 0; row_idx < row_count; ++row_idx) {
+        const SharedPtr<BaseExpression> &expr = value_list_[row_idx][column_idx];
+        SharedPtr<ExpressionState> expr_state = ExpressionState::CreateState(expr);
+        evaluator.Execute(expr, expr_state, cell_vector);
+        column_vector->AppendWith(*cell_vector, 0, 1);
+    }
 }
 
 } // namespace infinity
@@ -28,6 +28,8 @@ import infinity_exception;
 import table_entry;
 import internal_types;
 import data_type;
+import column_vector;
+import data_block;
 
 namespace infinity {
 
@@ -37,9 +39,10 @@ public:
                             TableEntry *table_entry,
                             u64 table_index,
                             Vector<Vector<SharedPtr<BaseExpression>>> value_list,
-                            SharedPtr<Vector<LoadMeta>> load_metas)
+                            SharedPtr<Vector<LoadMeta>> load_metas,
+                            Vector<SharedPtr<DataBlock>> data_blocks = {})
         : PhysicalOperator(PhysicalOperatorType::kInsert, nullptr, nullptr, id, load_metas), table_entry_(table_entry),
-          table_index_(table_index), value_list_(std::move(value_list)) {}
+          table_index_(table_index), value_list_(std::move(value_list)), data_blocks_(std::move(data_blocks)) {}
 
     ~PhysicalInsert() override = default;
 
@@ -51,6 +54,8 @@ public:
 
     inline const Vector<Vector<SharedPtr<BaseExpression>>> &value_list() const { return value_list_; }
 
+    inline const Vector<SharedPtr<DataBlock>> &data_blocks() const { return data_blocks_; }
+
     inline SharedPtr<Vector<String>> GetOutputNames() const final { return output_names_; }
 
     inline SharedPtr<Vector<SharedPtr<DataType>>> GetOutputTypes() const final { return output_types_; }
@@ -61,9 +66,22 @@ public:
     }
 
 private:
+    // Fill a column of the output block with the values of the column. The constants are appended column by column, through one
+    // cast of the whole column if their type isn't the one of the column, and the other expressions are evaluated cell by cell.
+    void FillColumn(SizeT column_idx, SharedPtr<ColumnVector> &column_vector) const;
+
+    void SetResultMsg(OperatorState *operator_state, UniquePtr<String> result_msg);
+
+    // Write the blocks of a columnar insert, into new segments if there are enough rows for the bulk path.
+    SizeT InsertDataBlocks(QueryContext *query_context);
+
+    // Write the blocks into new sealed segments like IMPORT, so the wal only logs their metadata.
+    void ImportDataBlocks(QueryContext *query_context, const Vector<SharedPtr<DataBlock>> &data_blocks);
+
     TableEntry *table_entry_{};
     u64 table_index_{};
     Vector<Vector<SharedPtr<BaseExpression>>> value_list_{};
+    Vector<SharedPtr<DataBlock>> data_blocks_{};
 
     SharedPtr<Vector<String>> output_names_{};
     SharedPtr<Vector<SharedPtr<DataType>>> output_types_{};
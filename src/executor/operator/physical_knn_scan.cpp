@@ -14,6 +14,8 @@
 
 module;
 
+#include <algorithm>
+#include <limits>
 #include <string>
 
 module physical_knn_scan;
@@ -44,6 +46,7 @@ import merge_knn;
 import knn_result_handler;
 import ann_ivf_flat;
 import annivfflat_index_data;
+import annivfpq_index_data;
 import buffer_handle;
 import data_block;
 import bitmask;
@@ -62,37 +65,141 @@ import create_index_info;
 import knn_expr;
 
 import block_entry;
+import block_column_entry;
 import segment_index_entry;
 import segment_entry;
 import abstract_hnsw;
+import hnsw_mem_index;
+import vector_distance;
+import internal_types;
+import storage;
+import embedding_info;
+import knn_result_cache;
+import memory_pool;
+import pool_allocator;
 
 namespace infinity {
 
 void ReadDataBlock(DataBlock *output,
                    BufferManager *buffer_mgr,
-                   const auto row_count,
+                   SizeT row_count,
                    const BlockEntry *current_block_entry,
-                   const Vector<SizeT> &column_ids) {
+                   const Vector<SizeT> &column_ids,
+                   TxnTimeStamp begin_ts,
+                   u32 row_offset) {
     auto block_id = current_block_entry->block_id();
     auto segment_id = current_block_entry->segment_id();
     for (SizeT output_column_id = 0; auto column_id : column_ids) {
         if (column_id == COLUMN_IDENTIFIER_ROW_ID) {
-            u32 segment_offset = block_id * DEFAULT_BLOCK_CAPACITY;
+            u32 segment_offset = block_id * DEFAULT_BLOCK_CAPACITY + row_offset;
             output->column_vectors[output_column_id++]->AppendWith(RowID(segment_id, segment_offset), row_count);
         } else {
-            ColumnVector column_vector = current_block_entry->GetColumnBlockEntry(column_id)->GetColumnVector(buffer_mgr);
-            output->column_vectors[output_column_id++]->AppendWith(column_vector, 0, row_count);
+            BlockColumnEntry *block_column_entry = current_block_entry->GetColumnBlockEntry(column_id);
+            ColumnVector column_vector = block_column_entry->GetColumnVector(buffer_mgr);
+            ColumnVector &output_column = *output->column_vectors[output_column_id++];
+            block_column_entry->ReadRows(output_column, column_vector, row_offset, row_count, begin_ts);
         }
     }
     output->Finalize();
 }
 
+using IndexSearchResults = Vector<Tuple<SizeT, UniquePtr<f32[]>, UniquePtr<SegmentOffset[]>>>;
+
+// A range search takes the k nearest and doubles k while a query gets k results that are all within the threshold, so it stops once
+// the search frontier has passed the threshold. The distances and the threshold follow the hnsw convention.
+template <typename SearchFunc>
+IndexSearchResults RangeSearchBatch(SearchFunc &&search, SizeT k, SizeT max_k, const Optional<f32> &threshold) {
+    IndexSearchResults results = search(k);
+    while (threshold.has_value() && k < max_k) {
+        bool widen = false;
+        for (const auto &[result_n, d_ptr, l_ptr] : results) {
+            widen = widen || (result_n == k && *std::max_element(d_ptr.get(), d_ptr.get() + result_n) <= *threshold);
+        }
+        if (!widen) {
+            break;
+        }
+        k = std::min(k * 2, max_k);
+        results = search(k);
+    }
+    return results;
+}
+
+// Rescore approximate hnsw or ivfpq results with the vectors of the index column and keep the nearest topk. The distances follow
+// the hnsw convention: squared l2, negative inner product.
+SizeT RerankKnnResult(const f32 *query,
+                       SizeT dimension,
+                       MetricType metric,
+                       const SegmentEntry *segment_entry,
+                       SizeT column_id,
+                       BufferManager *buffer_mgr,
+                       SizeT result_n,
+                       f32 *d_ptr,
+                       SegmentOffset *l_ptr,
+                       SizeT topk,
+                       MemoryPool *query_pool) {
+    using Candidate = Pair<f32, SegmentOffset>;
+    Vector<Candidate, PoolAllocator<Candidate>> candidates(result_n, PoolAllocator<Candidate>(query_pool));
+    for (SizeT i = 0; i < result_n; ++i) {
+        candidates[i] = {d_ptr[i], l_ptr[i]};
+    }
+    // read each block once
+    std::sort(candidates.begin(), candidates.end(), [](const auto &a, const auto &b) { return a.second < b.second; });
+    for (SizeT i = 0; i < result_n;) {
+        BlockID block_id = candidates[i].second / DEFAULT_BLOCK_CAPACITY;
+        SharedPtr<BlockEntry> block_entry = segment_entry->GetBlockEntryByID(block_id);
+        ColumnVector column_vector = block_entry->GetColumnBlockEntry(column_id)->GetColumnVector(buffer_mgr);
+        const auto *data = reinterpret_cast<const f32 *>(column_vector.data());
+        for (; i < result_n && candidates[i].second / DEFAULT_BLOCK_CAPACITY == block_id; ++i) {
+            const f32 *vec = data + (candidates[i].second % DEFAULT_BLOCK_CAPACITY) * dimension;
+            switch (metric) {
+                case MetricType::kMetricInnerProduct: {
+                    candidates[i].first = -IPDistance<f32>(query, vec, dimension);
+                    break;
+                }
+                case MetricType::kMetricCosine: {
+                    // the index holds the rows normalized, the column holds them as inserted
+                    candidates[i].first = -CosineDistance<f32>(query, vec, dimension);
+                    break;
+                }
+                default: {
+                    candidates[i].first = L2Distance<f32>(query, vec, dimension);
+                }
+            }
+        }
+    }
+    SizeT keep_n = std::min(result_n, topk);
+    std::partial_sort(candidates.begin(), candidates.begin() + keep_n, candidates.end());
+    for (SizeT i = 0; i < keep_n; ++i) {
+        d_ptr[i] = candidates[i].first;
+        l_ptr[i] = candidates[i].second;
+    }
+    return keep_n;
+}
+
+// Merges the knn results of a segment, one list per query, into the merge heap of the task.
+template <template <typename, typename> typename C>
+void MergeSegmentResults(MergeKnn<f32, C> *merge_heap, const KnnCacheEntry &segment_results) {
+    for (SizeT query_idx = 0; query_idx < segment_results.results_.size(); ++query_idx) {
+        const auto &results = segment_results.results_[query_idx];
+        for (SizeT begin = 0; begin < results.size(); begin += std::numeric_limits<u16>::max()) {
+            const SizeT n = std::min(results.size() - begin, SizeT(std::numeric_limits<u16>::max()));
+            Vector<f32> dists(n);
+            Vector<RowID> row_ids(n);
+            for (SizeT i = 0; i < n; ++i) {
+                dists[i] = results[begin + i].first;
+                row_ids[i] = results[begin + i].second;
+            }
+            merge_heap->Search(query_idx, dists.data(), row_ids.data(), n);
+        }
+    }
+}
+
 void MergeIntoBitmask(const VectorBuffer *input_bool_column_buffer,
                       const SharedPtr<Bitmask> &input_null_mask,
                       const SizeT count,
                       Bitmask &bitmask,
                       bool nullable,
-                      SizeT bitmask_offset = 0) {
+                      SizeT bitmask_offset) {
     if ((!nullable) || (input_null_mask->IsAllTrue())) {
         for (SizeT idx = 0; idx < count; ++idx) {
             if (!(input_bool_column_buffer->GetCompactBit(idx))) {
@@ -140,6 +247,45 @@ void MergeIntoBitmask(const VectorBuffer *input_bool_column_buffer,
 
 void PhysicalKnnScan::Init() {}
 
+void PhysicalKnnScan::FilterBlockIntoBitmask(QueryContext *query_context,
+                                             KnnScanFunctionData *knn_scan_function_data,
+                                             const BlockEntry *block_entry,
+                                             Bitmask &bitmask,
+                                             SizeT bitmask_offset) const {
+    TxnTimeStamp begin_ts = query_context->GetTxn()->BeginTS();
+    BufferManager *buffer_mgr = query_context->storage()->buffer_manager();
+    const u32 row_count = block_entry->row_count();
+    Optional<Vector<Pair<u32, u32>>> zone_row_ranges;
+    if (fast_rough_filter_evaluator_) {
+        zone_row_ranges = fast_rough_filter_evaluator_->EvaluateZones(begin_ts, *block_entry->GetFastRoughFilter(), row_count);
+    }
+    if (!zone_row_ranges.has_value()) {
+        zone_row_ranges = Vector<Pair<u32, u32>>{{0, row_count}};
+    }
+    auto *db_for_filter = knn_scan_function_data->db_for_filter_.get();
+    auto &filter_state = knn_scan_function_data->filter_state_;
+    auto &bool_column = knn_scan_function_data->bool_column_;
+    ExpressionEvaluator expr_evaluator;
+    u32 ruled_out_begin = 0;
+    for (const auto &[range_begin, range_end] : *zone_row_ranges) {
+        for (u32 i = ruled_out_begin; i < range_begin; ++i) {
+            bitmask.SetFalse(bitmask_offset + i);
+        }
+        ruled_out_begin = range_end;
+        const u32 range_row_count = range_end - range_begin;
+        db_for_filter->Reset(range_row_count);
+        ReadDataBlock(db_for_filter, buffer_mgr, range_row_count, block_entry, base_table_ref_->column_ids_, begin_ts, range_begin);
+        bool_column->Initialize(ColumnVectorType::kCompactBit, range_row_count);
+        expr_evaluator.Init(db_for_filter);
+        expr_evaluator.Execute(filter_expression_, filter_state, bool_column);
+        MergeIntoBitmask(bool_column->buffer_.get(), bool_column->nulls_ptr_, range_row_count, bitmask, true, bitmask_offset + range_begin);
+        bool_column->Reset();
+    }
+    for (u32 i = ruled_out_begin; i < row_count; ++i) {
+        bitmask.SetFalse(bitmask_offset + i);
+    }
+}
+
 bool PhysicalKnnScan::Execute(QueryContext *query_context, OperatorState *operator_state) {
     auto *knn_scan_operator_state = static_cast<KnnScanOperatorState *>(operator_state);
     auto elem_type = knn_scan_operator_state->knn_scan_function_data_->knn_scan_shared_data_->elem_type_;
@@ -153,7 +299,8 @@ bool PhysicalKnnScan::Execute(QueryContext *query_context, OperatorState *operat
                     break;
                 }
                 case KnnDistanceType::kCosine:
-                case KnnDistanceType::kInnerProduct: {
+                case KnnDistanceType::kInnerProduct:
+                case KnnDistanceType::kMaxSim: {
                     ExecuteInternal<f32, CompareMin>(query_context, knn_scan_operator_state);
                     break;
                 }
@@ -163,6 +310,34 @@ bool PhysicalKnnScan::Execute(QueryContext *query_context, OperatorState *operat
             }
             break;
         }
+        case kElemInt8: {
+            switch (dist_type) {
+                case KnnDistanceType::kL2: {
+                    ExecuteInternal<i8, CompareMax>(query_context, knn_scan_operator_state);
+                    break;
+                }
+                case KnnDistanceType::kInnerProduct: {
+                    ExecuteInternal<i8, CompareMin>(query_context, knn_scan_operator_state);
+                    break;
+                }
+                default: {
+                    RecoverableError(Status::NotSupport("Not implemented"));
+                }
+            }
+            break;
+        }
+        case kElemBit: {
+            switch (dist_type) {
+                case KnnDistanceType::kHamming: {
+                    ExecuteInternal<u8, CompareMax>(query_context, knn_scan_operator_state);
+                    break;
+                }
+                default: {
+                    RecoverableError(Status::NotSupport("Not implemented"));
+                }
+            }
+            break;
+        }
         default: {
             RecoverableError(Status::NotSupport("Not implemented"));
         }
@@ -208,9 +383,13 @@ void PhysicalKnnScan::PlanWithIndex(QueryContext *query_context) { // TODO: retu
                 // knn_column_id isn't in this table index
                 continue;
             }
+            // a maxsim search scores the rows by their tokens, the indexes hold whole rows
+            if (knn_expr->distance_type_ == KnnDistanceType::kMaxSim) {
+                continue;
+            }
             // check index type
             if (auto index_type = table_index_entry->index_base()->index_type_;
-                index_type != IndexType::kIVFFlat and index_type != IndexType::kHnsw) {
+                index_type != IndexType::kIVFFlat and index_type != IndexType::kIVFPQ and index_type != IndexType::kHnsw) {
                 LOG_TRACE(fmt::format("KnnScan: PlanWithIndex(): Skipping non-knn index."));
                 continue;
             }
@@ -221,13 +400,20 @@ void PhysicalKnnScan::PlanWithIndex(QueryContext *query_context) { // TODO: retu
     }
 
     // Generate task set: index segment and no index block
+    // the segments and blocks ruled out by their FastRoughFilter get no task, so their index or column is never loaded
     BlockIndex *block_index = base_table_ref_->block_index_.get();
     for (SegmentEntry *segment_entry : block_index->segments_) {
         if (auto iter = index_entry_map.find(segment_entry->segment_id()); iter != index_entry_map.end()) {
+            if (fast_rough_filter_evaluator_ and !fast_rough_filter_evaluator_->Evaluate(begin_ts, *segment_entry->GetFastRoughFilter())) {
+                continue;
+            }
             index_entries_->emplace_back(iter->second.get());
         } else {
             BlockEntryIter block_entry_iter(segment_entry);
             for (auto *block_entry = block_entry_iter.Next(); block_entry != nullptr; block_entry = block_entry_iter.Next()) {
+                if (fast_rough_filter_evaluator_ and !fast_rough_filter_evaluator_->Evaluate(begin_ts, *block_entry->GetFastRoughFilter())) {
+                    continue;
+                }
                 BlockColumnEntry *block_column_entry = block_entry->GetColumnBlockEntry(knn_column_id);
                 block_column_entries_->emplace_back(block_column_entry);
             }
@@ -240,14 +426,19 @@ SizeT PhysicalKnnScan::BlockEntryCount() const { return base_table_ref_->block_i
 
 template <typename DataType, template <typename, typename> typename C>
 void PhysicalKnnScan::ExecuteInternal(QueryContext *query_context, KnnScanOperatorState *operator_state) {
+    // each call scans one block or one index segment
+    query_context->CheckCanceled();
     TxnTimeStamp begin_ts = query_context->GetTxn()->BeginTS();
 
     auto knn_scan_function_data = operator_state->knn_scan_function_data_.get();
     auto knn_scan_shared_data = knn_scan_function_data->knn_scan_shared_data_;
 
     auto dist_func = static_cast<KnnDistance1<DataType> *>(knn_scan_function_data->knn_distance_.get());
-    auto merge_heap = static_cast<MergeKnn<DataType, C> *>(knn_scan_function_data->merge_knn_base_.get());
-    auto query = static_cast<const DataType *>(knn_scan_shared_data->query_embedding_);
+    auto merge_heap = static_cast<MergeKnn<f32, C> *>(knn_scan_function_data->merge_knn_base_.get());
+    auto query = static_cast<const DataType *>(knn_scan_shared_data->QueryEmbedding());
+    // distances are f32 for every element type. Indexes are only built on float columns, so the index paths read f32 queries.
+    // the row stride in elements, a bit embedding packs eight elements into a byte
+    const u32 elem_dim = EmbeddingType::EmbeddingSize(knn_scan_shared_data->elem_type_, knn_scan_shared_data->dimension_) / sizeof(DataType);
 
     SizeT index_task_n = knn_scan_shared_data->index_entries_->size();
     SizeT brute_task_n = knn_scan_shared_data->block_column_entries_->size();
@@ -272,44 +463,74 @@ void PhysicalKnnScan::ExecuteInternal(QueryContext *query_context, KnnScanOperat
                               brute_task_n));
         const auto row_count = block_entry->row_count();
         BufferManager *buffer_mgr = query_context->storage()->buffer_manager();
+        knn_scan_shared_data->PrefetchBlock(block_column_idx + 1, buffer_mgr);
 
         Bitmask bitmask;
         bitmask.Initialize(std::bit_ceil(row_count));
         if (filter_expression_) {
-            auto db_for_filter = knn_scan_function_data->db_for_filter_.get();
-            auto &filter_state_ = knn_scan_function_data->filter_state_;
-            auto &bool_column = knn_scan_function_data->bool_column_;
             // filter and build bitmask, if filter_expression_ != nullptr
-            db_for_filter->Reset(row_count);
-            ReadDataBlock(db_for_filter, buffer_mgr, row_count, block_entry, base_table_ref_->column_ids_);
-            bool_column->Initialize(ColumnVectorType::kCompactBit, row_count);
-            ExpressionEvaluator expr_evaluator;
-            expr_evaluator.Init(db_for_filter);
-            expr_evaluator.Execute(filter_expression_, filter_state_, bool_column);
-            const VectorBuffer *bool_column_buffer = bool_column->buffer_.get();
-            SharedPtr<Bitmask> &null_mask = bool_column->nulls_ptr_;
-            MergeIntoBitmask(bool_column_buffer, null_mask, row_count, bitmask, true);
-            bool_column->Reset();
+            FilterBlockIntoBitmask(query_context, knn_scan_function_data, block_entry, bitmask, 0);
         }
         block_entry->SetDeleteBitmask(begin_ts, bitmask);
 
         ColumnVector column_vector = block_column_entry->GetColumnVector(buffer_mgr);
 
         auto data = reinterpret_cast<const DataType *>(column_vector.data());
-        merge_heap->Search(query,
-                           data,
-                           knn_scan_shared_data->dimension_,
-                           dist_func->dist_func_,
-                           row_count,
-                           block_entry->segment_id(),
-                           block_entry->block_id(),
-                           bitmask);
+        const auto knn_distance_type = knn_scan_shared_data->knn_distance_type_;
+        bool gemm = false;
+        if constexpr (std::is_same_v<DataType, f32>) {
+            // one gemm per tile of queries and rows reads the block once for all the queries
+            // a cosine search always takes it, the row norms are then computed once per block
+            gemm = (knn_scan_shared_data->query_count_ >= DISTANCE_COMPUTE_BLAS_MIN_QUERY_COUNT &&
+                    (knn_distance_type == KnnDistanceType::kL2 || knn_distance_type == KnnDistanceType::kInnerProduct)) ||
+                   knn_distance_type == KnnDistanceType::kCosine || knn_distance_type == KnnDistanceType::kMaxSim;
+            if (knn_distance_type == KnnDistanceType::kMaxSim) {
+                // the rows pack more or less tokens than the query
+                const auto *embedding_info = static_cast<const EmbeddingInfo *>(block_column_entry->column_type()->type_info().get());
+                merge_heap->SearchMaxSim(query,
+                                         knn_scan_shared_data->dimension_,
+                                         data,
+                                         embedding_info->Dimension(),
+                                         knn_scan_shared_data->token_dim_,
+                                         row_count,
+                                         block_entry->segment_id(),
+                                         block_entry->block_id(),
+                                         bitmask);
+            } else if (gemm) {
+                MetricType metric = MetricType::kMetricL2;
+                if (knn_distance_type == KnnDistanceType::kInnerProduct) {
+                    metric = MetricType::kMetricInnerProduct;
+                } else if (knn_distance_type == KnnDistanceType::kCosine) {
+                    metric = MetricType::kMetricCosine;
+                }
+                merge_heap->SearchGemm(query,
+                                       data,
+                                       elem_dim,
+                                       metric,
+                                       row_count,
+                                       block_entry->segment_id(),
+                                       block_entry->block_id(),
+                                       bitmask);
+            }
+        }
+        if (!gemm) {
+            merge_heap->Search(query,
+                               data,
+                               elem_dim,
+                               dist_func->dist_func_,
+                               row_count,
+                               block_entry->segment_id(),
+                               block_entry->block_id(),
+                               bitmask);
+        }
         }
     } else if (u64 index_idx = knn_scan_shared_data->current_index_idx_++; index_idx < index_task_n) {
         LOG_TRACE(fmt::format("KnnScan: {} index {}/{}", knn_scan_function_data->task_id_, index_idx + 1, index_task_n));
         // with index
         SegmentIndexEntry *segment_index_entry = knn_scan_shared_data->index_entries_->at(index_idx);
         BufferManager *buffer_mgr = query_context->storage()->buffer_manager();
+        MemoryPool *query_pool = query_context->query_pool();
+        knn_scan_shared_data->PrefetchIndex(index_idx + 1, buffer_mgr);
 
         auto segment_id = segment_index_entry->segment_id();
         SegmentEntry *segment_entry = nullptr;
@@ -319,40 +540,60 @@ void PhysicalKnnScan::ExecuteInternal(QueryContext *query_context, KnnScanOperat
         } else {
             segment_entry = iter->second;
         }
+        // a query with the cache option reuses the results of a sealed segment that had no commit since they were computed
+        KnnResultCache *result_cache = query_context->storage()->knn_result_cache();
+        String cache_key = knn_scan_shared_data->ResultCacheKey(segment_index_entry);
+        const TxnTimeStamp segment_commit_ts = std::max(segment_entry->max_row_ts(), segment_entry->last_delete_ts());
+        if (segment_entry->status() == SegmentStatus::kUnsealed || segment_commit_ts >= begin_ts) {
+            cache_key.clear();
+        }
+        auto lookup_result_cache = [&]() -> SharedPtr<const KnnCacheEntry> {
+            if (cache_key.empty()) {
+                return nullptr;
+            }
+            SharedPtr<const KnnCacheEntry> cache_entry = result_cache->Get(cache_key);
+            if (cache_entry != nullptr && cache_entry->compute_ts_ <= segment_commit_ts) {
+                cache_entry = nullptr;
+            }
+            query_context->RecordKnnCacheLookup(cache_entry != nullptr);
+            return cache_entry;
+        };
         // check FastRoughFilter
         const auto &fast_rough_filter = *segment_entry->GetFastRoughFilter();
         if (fast_rough_filter_evaluator_ and !fast_rough_filter_evaluator_->Evaluate(begin_ts, fast_rough_filter)) [[unlikely]] {
             // skip this segment
             LOG_TRACE(
                 fmt::format("KnnScan: {} index {}/{} skipped after FastRoughFilter", knn_scan_function_data->task_id_, index_idx + 1, index_task_n));
+        } else if (auto cache_entry = lookup_result_cache(); cache_entry != nullptr) {
+            LOG_TRACE(fmt::format("KnnScan: {} index {}/{} results from the knn result cache",
+                                  knn_scan_function_data->task_id_,
+                                  index_idx + 1,
+                                  index_task_n));
+            MergeSegmentResults(merge_heap, *cache_entry);
         } else [[likely]] {
         LOG_TRACE(fmt::format("KnnScan: {} index {}/{} not skipped after FastRoughFilter",
                               knn_scan_function_data->task_id_,
                               index_idx + 1,
                               index_task_n));
+        // the results of a segment to cache are collected apart, then merged into the heap of the task
+        UniquePtr<MergeKnn<f32, C>> segment_heap;
+        if (!cache_key.empty()) {
+            segment_heap = MakeUnique<MergeKnn<f32, C>>(knn_scan_shared_data->query_count_,
+                                                        knn_scan_shared_data->topk_,
+                                                        knn_scan_shared_data->threshold_);
+            segment_heap->Begin();
+        }
+        MergeKnn<f32, C> *index_heap = segment_heap ? segment_heap.get() : merge_heap;
         auto segment_row_count = segment_entry->row_count();
         Bitmask bitmask;
         if (filter_expression_) {
             bitmask.Initialize(std::bit_ceil(segment_row_count));
             SizeT segment_row_count_real = 0;
-            auto db_for_filter = knn_scan_function_data->db_for_filter_.get();
-            auto &filter_state_ = knn_scan_function_data->filter_state_;
-            auto &bool_column = knn_scan_function_data->bool_column_;
             // filter and build bitmask, if filter_expression_ != nullptr
-            ExpressionEvaluator expr_evaluator;
             auto block_entry_iter = BlockEntryIter(segment_entry);
             for (auto *block_entry = block_entry_iter.Next(); block_entry != nullptr; block_entry = block_entry_iter.Next()) {
-                auto row_count = block_entry->row_count();
-                db_for_filter->Reset(row_count);
-                ReadDataBlock(db_for_filter, buffer_mgr, row_count, block_entry, base_table_ref_->column_ids_);
-                bool_column->Initialize(ColumnVectorType::kCompactBit, row_count);
-                expr_evaluator.Init(db_for_filter);
-                expr_evaluator.Execute(filter_expression_, filter_state_, bool_column);
-                const VectorBuffer *bool_column_buffer = bool_column->buffer_.get();
-                SharedPtr<Bitmask> &null_mask = bool_column->nulls_ptr_;
-                MergeIntoBitmask(bool_column_buffer, null_mask, row_count, bitmask, true, segment_row_count_real);
-                segment_row_count_real += row_count;
-                bool_column->Reset();
+                FilterBlockIntoBitmask(query_context, knn_scan_function_data, block_entry, bitmask, segment_row_count_real);
+                segment_row_count_real += block_entry->row_count();
             }
             if (segment_row_count_real != segment_row_count) {
                 UnrecoverableError(fmt::format("Segment_row_count mismatch: In segment {}: segment_row_count_real: {}, segment_row_count: {}",
@@ -362,38 +603,56 @@ void PhysicalKnnScan::ExecuteInternal(QueryContext *query_context, KnnScanOperat
             }
         }
         bool use_bitmask = !bitmask.IsAllTrue();
+        // the range threshold in the hnsw convention: squared l2, negative inner product
+        Optional<f32> index_threshold = knn_scan_shared_data->threshold_;
+        if (index_threshold.has_value() && (knn_scan_shared_data->knn_distance_type_ == KnnDistanceType::kInnerProduct ||
+                                            knn_scan_shared_data->knn_distance_type_ == KnnDistanceType::kCosine)) {
+            index_threshold = -*index_threshold;
+        }
+        // a range search reranks all its candidates, the merge heap keeps the ones within the threshold
+        auto rerank_keep_n = [&](SizeT result_n) { return index_threshold.has_value() ? result_n : SizeT(knn_scan_shared_data->topk_); };
 
         switch (segment_index_entry->table_index_entry()->index_base()->index_type_) {
             case IndexType::kIVFFlat: {
                 BufferHandle index_handle = segment_index_entry->GetIndex();
-                auto index = static_cast<const AnnIVFFlatIndexData<DataType> *>(index_handle.GetData());
+                auto index = static_cast<const AnnIVFFlatIndexData<f32> *>(index_handle.GetData());
                 i32 n_probes = 1;
                 auto IVFFlatScanTemplate = [&]<typename AnnIVFFlatType, typename... OptionalFilter>(OptionalFilter &&...filter) {
-                    AnnIVFFlatType ann_ivfflat_query(query,
-                                                     knn_scan_shared_data->query_count_,
-                                                     knn_scan_shared_data->topk_,
-                                                     knn_scan_shared_data->dimension_,
-                                                     knn_scan_shared_data->elem_type_);
-                    ann_ivfflat_query.Begin();
-                    ann_ivfflat_query.Search(index, segment_id, n_probes, std::forward<OptionalFilter>(filter)...);
-                    ann_ivfflat_query.EndWithoutSort();
-                    auto dists = ann_ivfflat_query.GetDistances();
-                    auto row_ids = ann_ivfflat_query.GetIDs();
-                    // TODO: now only work for one query
-                    // FIXME: cant work for multiple queries
-                    auto result_count =
-                        std::lower_bound(dists, dists + knn_scan_shared_data->topk_, AnnIVFFlatType::InvalidValue(), AnnIVFFlatType::CompareDist) -
-                        dists;
-                    merge_heap->Search(dists, row_ids, result_count);
+                    i64 ivf_k = knn_scan_shared_data->topk_;
+                    while (true) {
+                        AnnIVFFlatType ann_ivfflat_query(static_cast<const f32 *>(knn_scan_shared_data->QueryEmbedding()),
+                                                         knn_scan_shared_data->query_count_,
+                                                         ivf_k,
+                                                         knn_scan_shared_data->dimension_,
+                                                         knn_scan_shared_data->elem_type_);
+                        ann_ivfflat_query.Begin();
+                        ann_ivfflat_query.Search(index, segment_id, n_probes, filter...);
+                        ann_ivfflat_query.EndWithoutSort();
+                        auto dists = ann_ivfflat_query.GetDistances();
+                        auto row_ids = ann_ivfflat_query.GetIDs();
+                        // TODO: now only work for one query
+                        // FIXME: cant work for multiple queries
+                        auto result_count =
+                            std::lower_bound(dists, dists + ivf_k, AnnIVFFlatType::InvalidValue(), AnnIVFFlatType::CompareDist) - dists;
+                        // a range search doubles k while all the results are within the threshold
+                        const auto &threshold = knn_scan_shared_data->threshold_;
+                        if (threshold.has_value() && result_count == ivf_k && ivf_k < i64(index->data_num_) &&
+                            std::none_of(dists, dists + result_count, [&](f32 d) { return C<f32, RowID>::Compare(d, *threshold); })) {
+                            ivf_k = std::min(ivf_k * 2, i64(index->data_num_));
+                            continue;
+                        }
+                        index_heap->Search(dists, row_ids, result_count);
+                        break;
+                    }
                 };
                 auto IVFFlatScan = [&]<typename... OptionalFilter>(OptionalFilter &&...filter) {
                     switch (knn_scan_shared_data->knn_distance_type_) {
                         case KnnDistanceType::kL2: {
-                            IVFFlatScanTemplate.template operator()<AnnIVFFlatL2<DataType>>(std::forward<OptionalFilter>(filter)...);
+                            IVFFlatScanTemplate.template operator()<AnnIVFFlatL2<f32>>(std::forward<OptionalFilter>(filter)...);
                             break;
                         }
                         case KnnDistanceType::kInnerProduct: {
-                            IVFFlatScanTemplate.template operator()<AnnIVFFlatIP<DataType>>(std::forward<OptionalFilter>(filter)...);
+                            IVFFlatScanTemplate.template operator()<AnnIVFFlatIP<f32>>(std::forward<OptionalFilter>(filter)...);
                             break;
                         }
                         default: {
@@ -419,74 +678,231 @@ void PhysicalKnnScan::ExecuteInternal(QueryContext *query_context, KnnScanOperat
                 }
                 break;
             }
+            case IndexType::kIVFPQ: {
+                BufferHandle index_handle = segment_index_entry->GetIndex();
+                const auto *index = static_cast<const AnnIVFPQIndexData *>(index_handle.GetData());
+                // pq distances are approximate, search more candidates and rescore them with the column data
+                bool rerank = true;
+                u32 n_probes = IVF_PQ_NPROBE;
+                for (const auto &opt_param : knn_scan_shared_data->opt_params_) {
+                    if (opt_param.param_name_ == "nprobe") {
+                        n_probes = std::stoul(opt_param.param_value_);
+                    } else if (opt_param.param_name_ == "rerank") {
+                        rerank = opt_param.param_value_ != "false";
+                    }
+                }
+                const auto *queries = static_cast<const f32 *>(knn_scan_shared_data->QueryEmbedding());
+                const i64 topk = knn_scan_shared_data->topk_;
+                const SizeT index_k = rerank ? topk * PQ_RERANK_FACTOR : topk;
+                auto IVFPQScan = [&](const auto &filter) {
+                    for (u64 query_idx = 0; query_idx < knn_scan_shared_data->query_count_; ++query_idx) {
+                        const f32 *query_i = queries + query_idx * knn_scan_shared_data->dimension_;
+                        SizeT k = index_k;
+                        auto result = index->Search(query_i, n_probes, k, filter);
+                        // a range search doubles k while all the results are within the threshold
+                        while (index_threshold.has_value() && result.size() == k && k < index->data_num_ &&
+                               result.back().first <= *index_threshold) {
+                            k = std::min<SizeT>(k * 2, index->data_num_);
+                            result = index->Search(query_i, n_probes, k, filter);
+                        }
+                        SizeT result_n = result.size();
+                        auto d_ptr = MakeUniqueForOverwrite<f32[]>(result_n);
+                        auto l_ptr = MakeUniqueForOverwrite<SegmentOffset[]>(result_n);
+                        for (SizeT i = 0; i < result_n; ++i) {
+                            d_ptr[i] = result[i].first;
+                            l_ptr[i] = result[i].second;
+                        }
+                        if (rerank) {
+                            result_n = RerankKnnResult(query_i,
+                                                       knn_scan_shared_data->dimension_,
+                                                       index->metric_,
+                                                       segment_entry,
+                                                       segment_index_entry->table_index_entry()->column_def()->id(),
+                                                       buffer_mgr,
+                                                       result_n,
+                                                       d_ptr.get(),
+                                                       l_ptr.get(),
+                                                       rerank_keep_n(result_n),
+                                                       query_pool);
+                        }
+                        auto *row_ids = static_cast<RowID *>(query_pool->Allocate(sizeof(RowID) * result_n));
+                        for (SizeT i = 0; i < result_n; ++i) {
+                            if (knn_scan_shared_data->knn_distance_type_ == KnnDistanceType::kInnerProduct) {
+                                d_ptr[i] = -d_ptr[i];
+                            }
+                            row_ids[i] = RowID{segment_id, l_ptr[i]};
+                        }
+                        index_heap->Search(query_idx, d_ptr.get(), row_ids, result_n);
+                    }
+                };
+                if (use_bitmask) {
+                    if (segment_entry->CheckAnyDelete(begin_ts)) {
+                        IVFPQScan(DeleteWithBitmaskFilter(bitmask, segment_entry, begin_ts));
+                    } else {
+                        IVFPQScan(BitmaskFilter<SegmentOffset>(bitmask));
+                    }
+                } else {
+                    if (segment_entry->CheckAnyDelete(begin_ts)) {
+                        IVFPQScan(DeleteFilter(segment_entry, begin_ts));
+                    } else {
+                        IVFPQScan([](SegmentOffset) { return true; });
+                    }
+                }
+                break;
+            }
             case IndexType::kHnsw: {
+                    // share of the segment rows passing the filter, the bitmask is padded with set bits up to a power of two
+                    f64 selectivity = 1.0;
+                    if (use_bitmask) {
+                        SizeT pass_n = bitmask.CountTrue() - (bitmask.count() - segment_row_count);
+                        selectivity = static_cast<f64>(pass_n) / segment_row_count;
+                    }
+                    if (selectivity < HNSW_FILTER_BRUTE_FORCE_SELECTIVITY) {
+                        // the graph walk would discard almost every vertex it visits, scan the passing rows instead
+                        SizeT column_id = segment_index_entry->table_index_entry()->column_def()->id();
+                        auto block_entry_iter = BlockEntryIter(segment_entry);
+                        for (auto *block_entry = block_entry_iter.Next(); block_entry != nullptr; block_entry = block_entry_iter.Next()) {
+                            const auto row_count = block_entry->row_count();
+                            const SegmentOffset block_offset = block_entry->block_id() * DEFAULT_BLOCK_CAPACITY;
+                            Bitmask block_bitmask;
+                            block_bitmask.Initialize(std::bit_ceil(row_count));
+                            for (SizeT i = 0; i < row_count; ++i) {
+                                if (!bitmask.IsTrue(block_offset + i)) {
+                                    block_bitmask.SetFalse(i);
+                                }
+                            }
+                            block_entry->SetDeleteBitmask(begin_ts, block_bitmask);
+                            if (block_bitmask.CountTrue() == block_bitmask.count() - row_count) {
+                                continue;
+                            }
+                            ColumnVector column_vector = block_entry->GetColumnBlockEntry(column_id)->GetColumnVector(buffer_mgr);
+                            auto data = reinterpret_cast<const DataType *>(column_vector.data());
+                            index_heap->Search(query,
+                                               data,
+                                               elem_dim,
+                                               dist_func->dist_func_,
+                                               row_count,
+                                               block_entry->segment_id(),
+                                               block_entry->block_id(),
+                                               block_bitmask);
+                        }
+                        break;
+                    }
+
                     BufferHandle index_handle = segment_index_entry->GetIndex();
                     const auto *index_hnsw = static_cast<const IndexHnsw *>(segment_index_entry->table_index_entry()->index_base());
                     AbstractHnsw<f32, SegmentOffset> abstract_hnsw(index_handle.GetDataMut(), index_hnsw);
 
+                    // pq distances are approximate, search more candidates and rescore them with the column data
+                    bool rerank = index_hnsw->encode_type_ == HnswEncodeType::kPQ;
                     for (const auto &opt_param : knn_scan_shared_data->opt_params_) {
                         if (opt_param.param_name_ == "ef") {
                             u64 ef = std::stoull(opt_param.param_value_);
                             abstract_hnsw.SetEf(ef);
+                        } else if (opt_param.param_name_ == "rerank") {
+                            rerank = rerank && opt_param.param_value_ != "false";
                         }
                     }
 
-                    i64 result_n = -1;
-                    for (u64 query_idx = 0; query_idx < knn_scan_shared_data->query_count_; ++query_idx) {
-                        const DataType *query =
-                            static_cast<const DataType *>(knn_scan_shared_data->query_embedding_) + query_idx * knn_scan_shared_data->dimension_;
-
-                        SizeT result_n1 = 0;
-                        UniquePtr<DataType[]> d_ptr = nullptr;
-                        UniquePtr<SegmentOffset[]> l_ptr = nullptr;
-                        if (use_bitmask) {
-                            if (segment_entry->CheckAnyDelete(begin_ts)) {
-                                DeleteWithBitmaskFilter filter(bitmask, segment_entry, begin_ts);
-                                std::tie(result_n1, d_ptr, l_ptr) =
-                                    abstract_hnsw.template KnnSearch<false>(query, knn_scan_shared_data->topk_, filter);
-                            } else {
-                                BitmaskFilter<SegmentOffset> filter(bitmask);
-                                std::tie(result_n1, d_ptr, l_ptr) =
-                                    abstract_hnsw.template KnnSearch<false>(query, knn_scan_shared_data->topk_, filter);
+                    const auto *queries = static_cast<const f32 *>(knn_scan_shared_data->QueryEmbedding());
+                    const u64 query_count = knn_scan_shared_data->query_count_;
+                    const i64 topk = knn_scan_shared_data->topk_;
+                    i64 search_k = topk;
+                    if (selectivity < HNSW_FILTER_WIDEN_EF_SELECTIVITY) {
+                        // few visited vertices are kept, widen the frontier so the passing rows it holds still reach topk.
+                        // the search frontier is max(k, ef), so widen k and leave the ef of the shared index alone
+                        SizeT ef = abstract_hnsw.GetEf();
+                        SizeT widened_ef = std::min(static_cast<SizeT>(ef / selectivity), ef * HNSW_FILTER_MAX_EF_FACTOR);
+                        search_k = std::max(search_k, static_cast<i64>(widened_ef));
+                    }
+                    const i64 index_k = rerank ? std::max(search_k, topk * static_cast<i64>(PQ_RERANK_FACTOR)) : search_k;
+
+                    auto merge_results = [&](Vector<Tuple<SizeT, UniquePtr<f32[]>, UniquePtr<SegmentOffset[]>>> &results, bool rerank_results) {
+                        for (u64 query_idx = 0; query_idx < query_count; ++query_idx) {
+                            auto &[result_n, d_ptr, l_ptr] = results[query_idx];
+                            if (rerank_results) {
+                                result_n = RerankKnnResult(queries + query_idx * knn_scan_shared_data->dimension_,
+                                                            knn_scan_shared_data->dimension_,
+                                                            index_hnsw->metric_type_,
+                                                            segment_entry,
+                                                            segment_index_entry->table_index_entry()->column_def()->id(),
+                                                            buffer_mgr,
+                                                            result_n,
+                                                            d_ptr.get(),
+                                                            l_ptr.get(),
+                                                            rerank_keep_n(result_n),
+                                                            query_pool);
                             }
-                        } else {
-                            if (segment_entry->CheckAnyDelete(begin_ts)) {
-                                DeleteFilter filter(segment_entry, begin_ts);
-                                std::tie(result_n1, d_ptr, l_ptr) =
-                                    abstract_hnsw.template KnnSearch<false>(query, knn_scan_shared_data->topk_, filter);
-                            } else {
-                                std::tie(result_n1, d_ptr, l_ptr) = abstract_hnsw.template KnnSearch<false>(query, knn_scan_shared_data->topk_);
+                            switch (knn_scan_shared_data->knn_distance_type_) {
+                                case KnnDistanceType::kInvalid: {
+                                    UnrecoverableError("Invalid distance type");
+                                }
+                                case KnnDistanceType::kL2:
+                                case KnnDistanceType::kHamming: {
+                                    break;
+                                }
+                                case KnnDistanceType::kCosine:
+                                case KnnDistanceType::kInnerProduct:
+                                case KnnDistanceType::kMaxSim: {
+                                    for (SizeT i = 0; i < result_n; ++i) {
+                                        d_ptr[i] = -d_ptr[i];
+                                    }
+                                    break;
+                                }
                             }
-                        }
 
-                        if (result_n < 0) {
-                            result_n = result_n1;
-                        } else if (result_n != (i64)result_n1) {
-                            UnrecoverableError("KnnScan: result_n mismatch");
-                        }
-
-                        switch (knn_scan_shared_data->knn_distance_type_) {
-                            case KnnDistanceType::kInvalid: {
-                                UnrecoverableError("Invalid distance type");
-                            }
-                            case KnnDistanceType::kL2:
-                            case KnnDistanceType::kHamming: {
-                                break;
+                            auto *row_ids = static_cast<RowID *>(query_pool->Allocate(sizeof(RowID) * result_n));
+                            for (SizeT i = 0; i < result_n; ++i) {
+                                row_ids[i] = RowID{segment_entry->segment_id(), l_ptr[i]};
                             }
-                            case KnnDistanceType::kCosine:
-                            case KnnDistanceType::kInnerProduct: {
-                                for (i64 i = 0; i < result_n; ++i) {
-                                    d_ptr[i] = -d_ptr[i];
+                            index_heap->Search(query_idx, d_ptr.get(), row_ids, result_n);
+                        }
+                    };
+
+                    // the index of a segment created by appends holds no rows, they are all in the hnsw chunks. A rebuilt chunk holds
+                    // the rows of the index once deleted rows are dropped from it.
+                    if (abstract_hnsw.GetVertexNum() > 0 && !segment_index_entry->HnswIndexReplaced()) {
+                        auto search_graph = [&](SizeT k) {
+                            IndexSearchResults results;
+                            if (use_bitmask) {
+                                if (segment_entry->CheckAnyDelete(begin_ts)) {
+                                    DeleteWithBitmaskFilter filter(bitmask, segment_entry, begin_ts);
+                                    results = abstract_hnsw.template KnnSearchBatch<false>(queries, query_count, k, filter);
+                                } else {
+                                    BitmaskFilter<SegmentOffset> filter(bitmask);
+                                    results = abstract_hnsw.template KnnSearchBatch<false>(queries, query_count, k, filter);
+                                }
+                            } else {
+                                if (segment_entry->CheckAnyDelete(begin_ts)) {
+                                    DeleteFilter filter(segment_entry, begin_ts);
+                                    results = abstract_hnsw.template KnnSearchBatch<false>(queries, query_count, k, filter);
+                                } else {
+                                    results = abstract_hnsw.template KnnSearchBatch<false>(queries, query_count, k);
                                 }
-                                break;
                             }
-                        }
+                            return results;
+                        };
+                        auto results = RangeSearchBatch(search_graph, index_k, abstract_hnsw.GetVertexNum(), index_threshold);
+                        merge_results(results, rerank);
+                    }
 
-                        auto row_ids = MakeUniqueForOverwrite<RowID[]>(result_n);
-                        for (i64 i = 0; i < result_n; ++i) {
-                            row_ids[i] = RowID{segment_entry->segment_id(), l_ptr[i]};
-                        }
-                        merge_heap->Search(0, d_ptr.get(), row_ids.get(), result_n);
+                    // The rows appended after the index was built. A chunk takes rows at commit time, so it may hold rows newer than the
+                    // query, and rows past the bitmask.
+                    for (const auto &hnsw_chunk : segment_index_entry->GetHnswChunks()) {
+                        bool rerank_chunk = rerank && hnsw_chunk->encode_type() == HnswEncodeType::kPQ;
+                        i64 chunk_k = rerank_chunk ? index_k : search_k;
+                        auto search_chunk = [&](SizeT k) {
+                            if (use_bitmask) {
+                                DeleteWithBitmaskFilter filter(bitmask, segment_entry, begin_ts);
+                                RowCountFilter chunk_filter(segment_row_count, filter);
+                                return hnsw_chunk->KnnSearchBatch(queries, query_count, k, chunk_filter);
+                            }
+                            DeleteFilter filter(segment_entry, begin_ts);
+                            RowCountFilter chunk_filter(segment_row_count, filter);
+                            return hnsw_chunk->KnnSearchBatch(queries, query_count, k, chunk_filter);
+                        };
+                        auto results = RangeSearchBatch(search_chunk, chunk_k, hnsw_chunk->row_count(), index_threshold);
+                        merge_results(results, rerank_chunk);
                     }
                     break;
                 }
@@ -494,6 +910,24 @@ void PhysicalKnnScan::ExecuteInternal(QueryContext *query_context, KnnScanOperat
                     RecoverableError(Status::NotSupport("Not implemented"));
                 }
             }
+            if (segment_heap) {
+                segment_heap->End();
+                auto segment_results = MakeShared<KnnCacheEntry>();
+                segment_results->compute_ts_ = begin_ts;
+                segment_results->results_.resize(knn_scan_shared_data->query_count_);
+                for (u64 query_idx = 0; query_idx < knn_scan_shared_data->query_count_; ++query_idx) {
+                    const f32 *dists = segment_heap->GetDistancesByIdx(query_idx);
+                    const RowID *row_ids = segment_heap->GetIDsByIdx(query_idx);
+                    const i64 result_n = segment_heap->ResultCount(query_idx);
+                    auto &results = segment_results->results_[query_idx];
+                    results.reserve(result_n);
+                    for (i64 i = 0; i < result_n; ++i) {
+                        results.emplace_back(dists[i], row_ids[i]);
+                    }
+                }
+                MergeSegmentResults(merge_heap, *segment_results);
+                result_cache->Put(cache_key, std::move(segment_results));
+            }
         }
     }
     if (knn_scan_shared_data->current_index_idx_ >= index_task_n && knn_scan_shared_data->current_block_idx_ >= brute_task_n) {
@@ -502,13 +936,15 @@ void PhysicalKnnScan::ExecuteInternal(QueryContext *query_context, KnnScanOperat
         BlockIndex *block_index = knn_scan_shared_data->table_ref_->block_index_.get();
 
         merge_heap->End();
-        i64 result_n = std::min(knn_scan_shared_data->topk_, merge_heap->total_count());
 
         if (!operator_state->data_block_array_.empty()) {
             UnrecoverableError("In physical_knn_scan : operator_state->data_block_array_ is not empty.");
         }
         {
-            SizeT total_data_row_count = knn_scan_shared_data->query_count_ * result_n;
+            SizeT total_data_row_count = 0;
+            for (u64 query_idx = 0; query_idx < knn_scan_shared_data->query_count_; ++query_idx) {
+                total_data_row_count += merge_heap->ResultCount(query_idx);
+            }
             SizeT row_idx = 0;
             do {
                 auto data_block = DataBlock::MakeUniquePtr();
@@ -522,12 +958,11 @@ void PhysicalKnnScan::ExecuteInternal(QueryContext *query_context, KnnScanOperat
         SizeT output_block_idx = 0;
         DataBlock *output_block_ptr = operator_state->data_block_array_[output_block_idx].get();
         for (u64 query_idx = 0; query_idx < knn_scan_shared_data->query_count_; ++query_idx) {
-            DataType *result_dists = merge_heap->GetDistancesByIdx(query_idx);
+            f32 *result_dists = merge_heap->GetDistancesByIdx(query_idx);
             RowID *row_ids = merge_heap->GetIDsByIdx(query_idx);
+            const i64 result_n = merge_heap->ResultCount(query_idx);
 
             for (i64 top_idx = 0; top_idx < result_n; ++top_idx) {
-                SizeT id = query_idx * knn_scan_shared_data->query_count_ + top_idx;
-
                 SegmentID segment_id = row_ids[top_idx].segment_id_;
                 SegmentOffset segment_offset = row_ids[top_idx].segment_offset_;
                 BlockID block_id = segment_offset / DEFAULT_BLOCK_CAPACITY;
@@ -551,10 +986,11 @@ void PhysicalKnnScan::ExecuteInternal(QueryContext *query_context, KnnScanOperat
                     auto *block_column_entry = block_entry->GetColumnBlockEntry(column_id);
                     ColumnVector &&column_vector = block_column_entry->GetColumnVector(query_context->storage()->buffer_manager());
 
-                    output_block_ptr->column_vectors[i]->AppendWith(column_vector, block_offset, 1);
+                    ColumnVector &output_column = *output_block_ptr->column_vectors[i];
+                    block_column_entry->ReadRows(output_column, column_vector, block_offset, 1, query_context->GetTxn()->BeginTS());
                 }
-                output_block_ptr->AppendValueByPtr(column_n, (ptr_t)&result_dists[id]);
-                output_block_ptr->AppendValueByPtr(column_n + 1, (ptr_t)&row_ids[id]);
+                output_block_ptr->AppendValueByPtr(column_n, (ptr_t)&result_dists[top_idx]);
+                output_block_ptr->AppendValueByPtr(column_n + 1, (ptr_t)&row_ids[top_idx]);
 
                 ++output_block_row_id;
             }
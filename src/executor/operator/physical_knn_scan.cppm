@@ -35,16 +35,39 @@ import infinity_exception;
 import internal_types;
 import data_type;
 import fast_rough_filter;
+import data_block;
+import buffer_manager;
+import block_entry;
+import vector_buffer;
+import bitmask;
+import knn_scan_data;
 
 namespace infinity {
 
+// read the columns of row_count rows of a block from row_offset into output, to evaluate a filter on them
+export void ReadDataBlock(DataBlock *output,
+                          BufferManager *buffer_mgr,
+                          SizeT row_count,
+                          const BlockEntry *current_block_entry,
+                          const Vector<SizeT> &column_ids,
+                          TxnTimeStamp begin_ts,
+                          u32 row_offset = 0);
+
+// clear the bits of bitmask from bitmask_offset where the boolean result of a filter is false or null
+export void MergeIntoBitmask(const VectorBuffer *input_bool_column_buffer,
+                             const SharedPtr<Bitmask> &input_null_mask,
+                             SizeT count,
+                             Bitmask &bitmask,
+                             bool nullable,
+                             SizeT bitmask_offset = 0);
+
 export class PhysicalKnnScan final : public PhysicalOperator {
 public:
     explicit PhysicalKnnScan(u64 id,
                              SharedPtr<BaseTableRef> base_table_ref,
                              SharedPtr<KnnExpression> knn_expression,
                              SharedPtr<BaseExpression> filter_expression,
-                             UniquePtr<FastRoughFilterEvaluator> &&fast_rough_filter_evaluator,
+                             SharedPtr<FastRoughFilterEvaluator> fast_rough_filter_evaluator,
                              SharedPtr<Vector<String>> output_names,
                              SharedPtr<Vector<SharedPtr<DataType>>> output_types,
                              u64 knn_table_index,
@@ -78,6 +101,10 @@ public:
 
     inline SizeT TaskCount() const { return block_column_entries_->size() + index_entries_->size(); }
 
+    inline SizeT BruteForceBlockCount() const { return block_column_entries_->size(); }
+
+    inline SizeT IndexEntryCount() const { return index_entries_->size(); }
+
     SizeT TaskletCount() override { return block_column_entries_->size() + index_entries_->size(); }
 
     void FillingTableRefs(HashMap<SizeT, SharedPtr<BaseTableRef>> &table_refs) override {
@@ -91,7 +118,7 @@ public:
 
     SharedPtr<BaseExpression> filter_expression_{};
 
-    UniquePtr<FastRoughFilterEvaluator> fast_rough_filter_evaluator_{};
+    SharedPtr<FastRoughFilterEvaluator> fast_rough_filter_evaluator_{};
 
     SharedPtr<Vector<String>> output_names_{};
     SharedPtr<Vector<SharedPtr<DataType>>> output_types_{};
@@ -103,6 +130,14 @@ public:
 private:
     template <typename DataType, template <typename, typename> typename C>
     void ExecuteInternal(QueryContext *query_context, KnnScanOperatorState *operator_state);
+
+    // evaluate filter_expression_ on the rows of a block into bitmask from bitmask_offset, the rows of the zones ruled out by the
+    // zone map of the block are set false without being read
+    void FilterBlockIntoBitmask(QueryContext *query_context,
+                                KnnScanFunctionData *knn_scan_function_data,
+                                const BlockEntry *block_entry,
+                                Bitmask &bitmask,
+                                SizeT bitmask_offset) const;
 };
 
 } // namespace infinity
@@ -14,8 +14,10 @@
 
 module;
 
+#include <algorithm>
 #include <cassert>
 #include <chrono>
+#include <cstdlib>
 #include <iostream>
 #include <memory>
 #include <string>
@@ -55,9 +57,19 @@ import doc_iterator;
 import logger;
 import analyzer_pool;
 import analyzer;
+import highlighter;
 import term;
 import early_terminate_iterator;
 import fulltext_score_result_heap;
+import match_scan_data;
+import block_index;
+import segment_entry;
+import segment_iter;
+import fast_rough_filter;
+import physical_knn_scan;
+import bitmask;
+import data_type;
+import buffer_manager;
 
 namespace infinity {
 
@@ -71,22 +83,136 @@ void ASSERT_FLOAT_EQ6(u32 i, float a, float b) {
 }
 
 void AnalyzeFunc(const String &analyzer_name, String &&text, TermList &output_terms) {
-    UniquePtr<Analyzer> analyzer = AnalyzerPool::instance().Get(analyzer_name);
+    ScopedAnalyzer analyzer(analyzer_name);
     Term input_term;
     input_term.text_ = std::move(text);
     analyzer->Analyze(input_term, output_terms);
 }
 
+u32 GetTopN(SearchOptions &search_ops) {
+    if (auto iter_n_option = search_ops.options_.find("topn"); iter_n_option != search_ops.options_.end()) {
+        int top_n_option = std::stoi(iter_n_option->second);
+        if (top_n_option <= 0) {
+            RecoverableError(Status::SyntaxError("topn must be a positive integer"));
+        }
+        return top_n_option;
+    }
+    return DEFAULT_FULL_TEXT_OPTION_TOP_N;
+}
+
+// The WHERE conditions of a SEARCH pushed down into MATCH.
+// The segments and blocks ruled out by their FastRoughFilter are skipped, a segment gets the bitmask of its rows passing the filter
+// when the search first reaches it, so the rows failing the filter never take a place in the top n.
+class MatchFilter {
+public:
+    MatchFilter(QueryContext *query_context,
+                BaseTableRef *base_table_ref,
+                SharedPtr<BaseExpression> filter_expression,
+                const FastRoughFilterEvaluator *fast_rough_filter_evaluator)
+        : buffer_mgr_(query_context->storage()->buffer_manager()), begin_ts_(query_context->GetTxn()->BeginTS()), base_table_ref_(base_table_ref),
+          filter_expression_(std::move(filter_expression)), fast_rough_filter_evaluator_(fast_rough_filter_evaluator) {
+        filter_state_ = ExpressionState::CreateState(filter_expression_);
+        db_for_filter_ = MakeUnique<DataBlock>();
+        db_for_filter_->Init(*(base_table_ref_->column_types_));                          // default capacity
+        bool_column_ = ColumnVector::Make(MakeShared<DataType>(LogicalType::kBoolean)); // default capacity
+    }
+
+    // The sorted segments among segment_ids, or among all segments if it is null, not ruled out by their FastRoughFilter
+    SharedPtr<Vector<SegmentID>> PruneSegments(const SharedPtr<Vector<SegmentID>> &segment_ids) const {
+        auto result = MakeShared<Vector<SegmentID>>();
+        const BlockIndex *block_index = base_table_ref_->block_index_.get();
+        auto prune = [&](const SegmentEntry *segment_entry) {
+            // the blocks of a segment with few blocks are checked by BuildBitmask() alone
+            if (!fast_rough_filter_evaluator_ or
+                fast_rough_filter_evaluator_->EvaluateSegment(begin_ts_,
+                                                              *segment_entry->GetFastRoughFilter(),
+                                                              block_index->SegmentBlockCount(segment_entry->segment_id()))) {
+                result->push_back(segment_entry->segment_id());
+            } else {
+                LOG_TRACE(fmt::format("Match: segment {} skipped after FastRoughFilter", segment_entry->segment_id()));
+            }
+        };
+        if (segment_ids) {
+            for (SegmentID segment_id : *segment_ids) {
+                prune(block_index->segment_index_.at(segment_id));
+            }
+        } else {
+            for (const SegmentEntry *segment_entry : block_index->segments_) {
+                prune(segment_entry);
+            }
+            std::sort(result->begin(), result->end());
+        }
+        return result;
+    }
+
+    bool Pass(RowID row_id) {
+        if (row_id.segment_id_ != segment_id_) {
+            BuildBitmask(row_id.segment_id_);
+        }
+        return row_id.segment_offset_ < bitmask_->count() and bitmask_->IsTrue(row_id.segment_offset_);
+    }
+
+private:
+    void BuildBitmask(SegmentID segment_id) {
+        segment_id_ = segment_id;
+        const SegmentEntry *segment_entry = base_table_ref_->block_index_->segment_index_.at(segment_id);
+        bitmask_ = Bitmask::Make(std::bit_ceil(segment_entry->row_count()));
+        ExpressionEvaluator expr_evaluator;
+        auto block_entry_iter = BlockEntryIter(segment_entry);
+        for (auto *block_entry = block_entry_iter.Next(); block_entry != nullptr; block_entry = block_entry_iter.Next()) {
+            const SizeT row_count = block_entry->row_count();
+            const SizeT block_offset = block_entry->block_id() * DEFAULT_BLOCK_CAPACITY;
+            if (fast_rough_filter_evaluator_ and !fast_rough_filter_evaluator_->Evaluate(begin_ts_, *block_entry->GetFastRoughFilter())) {
+                for (SizeT i = 0; i < row_count; ++i) {
+                    bitmask_->SetFalse(block_offset + i);
+                }
+                continue;
+            }
+            db_for_filter_->Reset(row_count);
+            ReadDataBlock(db_for_filter_.get(), buffer_mgr_, row_count, block_entry, base_table_ref_->column_ids_, begin_ts_);
+            bool_column_->Initialize(ColumnVectorType::kCompactBit, row_count);
+            expr_evaluator.Init(db_for_filter_.get());
+            expr_evaluator.Execute(filter_expression_, filter_state_, bool_column_);
+            MergeIntoBitmask(bool_column_->buffer_.get(), bool_column_->nulls_ptr_, row_count, *bitmask_, true, block_offset);
+            bool_column_->Reset();
+        }
+    }
+
+    BufferManager *buffer_mgr_{};
+    TxnTimeStamp begin_ts_{};
+    BaseTableRef *base_table_ref_{};
+    SharedPtr<BaseExpression> filter_expression_{};
+    const FastRoughFilterEvaluator *fast_rough_filter_evaluator_{};
+    SharedPtr<ExpressionState> filter_state_{};
+    UniquePtr<DataBlock> db_for_filter_{};
+    SharedPtr<ColumnVector> bool_column_{};
+    // bitmask of the segment being searched
+    SegmentID segment_id_{INVALID_SEGMENT_ID};
+    SharedPtr<Bitmask> bitmask_{};
+};
+
 bool ExecuteInnerHomebrewed(QueryContext *query_context,
-                            OperatorState *operator_state,
+                            MatchOperatorState *operator_state,
                             SharedPtr<BaseTableRef> &base_table_ref_,
                             SharedPtr<MatchExpression> &match_expr_,
+                            const SharedPtr<BaseExpression> &filter_expression_,
+                            const FastRoughFilterEvaluator *fast_rough_filter_evaluator_,
+                            u32 top_n,
                             Vector<SharedPtr<DataType>> OutputTypes) {
     // 1. build QueryNode tree
     // 1.1 populate column2analyzer
     TransactionID txn_id = query_context->GetTxn()->TxnID();
     TxnTimeStamp begin_ts = query_context->GetTxn()->BeginTS();
-    QueryBuilder query_builder(txn_id, begin_ts, base_table_ref_);
+    QueryBuilder query_builder(txn_id, begin_ts, base_table_ref_, query_context->query_pool());
+    UniquePtr<MatchFilter> match_filter;
+    if (filter_expression_) {
+        // the segments of the task, or all segments, except the ones ruled out by FastRoughFilter
+        match_filter = MakeUnique<MatchFilter>(query_context, base_table_ref_.get(), filter_expression_, fast_rough_filter_evaluator_);
+        query_builder.SetSegmentIDs(match_filter->PruneSegments(operator_state->segment_ids_));
+    } else if (operator_state->segment_ids_) {
+        // a task of parallel match
+        query_builder.SetSegmentIDs(operator_state->segment_ids_);
+    }
     const Map<String, String> &column2analyzer = query_builder.GetColumn2Analyzer();
     // 1.2 parse options into map, populate default_field
     SearchOptions search_ops(match_expr_->options_text_);
@@ -94,23 +220,73 @@ bool ExecuteInnerHomebrewed(QueryContext *query_context,
     const String &block_max_option = search_ops.options_["block_max"];
     bool use_ordinary_iter = false;
     bool use_block_max_iter = false;
+    // by default the iterator is chosen by the shape of the query and the doc frequencies of its terms
+    bool choose_iter_automatically = false;
     if (block_max_option == "true") {
         use_block_max_iter = true;
-    } else if (block_max_option == "false" or block_max_option.empty()) {
+    } else if (block_max_option == "false") {
         use_ordinary_iter = true;
     } else if (block_max_option == "compare") {
         use_ordinary_iter = true;
         use_block_max_iter = true;
+    } else if (block_max_option == "auto" or block_max_option.empty()) {
+        choose_iter_automatically = true;
     } else {
-        RecoverableError(Status::SyntaxError("block_max option must be empty, true, false or compare"));
+        RecoverableError(Status::SyntaxError("block_max option must be empty, auto, true, false or compare"));
     }
     // 1.3 build filter
     SearchDriver driver(column2analyzer, default_field);
     driver.analyze_func_ = reinterpret_cast<void (*)()>(&AnalyzeFunc);
+    if (const String &slop_option = search_ops.options_["slop"]; !slop_option.empty()) {
+        char *end = nullptr;
+        const long slop = std::strtol(slop_option.c_str(), &end, 10);
+        if (*end != '\0' or slop < 0) {
+            RecoverableError(Status::SyntaxError("slop option must be a non-negative integer"));
+        }
+        driver.phrase_slop_ = slop;
+    }
+    driver.prefix_max_expansion_ = DEFAULT_FULL_TEXT_PREFIX_MAX_EXPANSION;
+    if (const String &max_expansion_option = search_ops.options_["max_expansion"]; !max_expansion_option.empty()) {
+        char *end = nullptr;
+        const long max_expansion = std::strtol(max_expansion_option.c_str(), &end, 10);
+        if (*end != '\0' or max_expansion <= 0) {
+            RecoverableError(Status::SyntaxError("max_expansion option must be a positive integer"));
+        }
+        driver.prefix_max_expansion_ = max_expansion;
+    }
     UniquePtr<QueryNode> query_tree = driver.ParseSingleWithFields(match_expr_->fields_, match_expr_->matching_text_);
     if (!query_tree) {
         RecoverableError(Status::ParseMatchExprFailed(match_expr_->fields_, match_expr_->matching_text_));
     }
+    // 1.4 highlight the query terms in the text columns of the results
+    Vector<UniquePtr<Highlighter>> highlighters(base_table_ref_->column_ids_.size());
+    {
+        const String &highlight_option = search_ops.options_["highlight"];
+        const String &snippet_option = search_ops.options_["highlight_snippet"];
+        SizeT snippet_size = 0;
+        if (!snippet_option.empty()) {
+            char *end = nullptr;
+            const long snippet = std::strtol(snippet_option.c_str(), &end, 10);
+            if (*end != '\0' or snippet <= 0) {
+                RecoverableError(Status::SyntaxError("highlight_snippet option must be a positive integer"));
+            }
+            snippet_size = snippet;
+        }
+        if (highlight_option != "true" and highlight_option != "false" and !highlight_option.empty()) {
+            RecoverableError(Status::SyntaxError("highlight option must be empty, true or false"));
+        }
+        if (highlight_option == "true" or (highlight_option.empty() and snippet_size > 0)) {
+            std::map<std::string, std::vector<std::string>> column_terms;
+            query_tree->GetHighlightTerms(column_terms);
+            const Vector<String> &column_names = *base_table_ref_->column_names_;
+            const Vector<SharedPtr<DataType>> &column_types = *base_table_ref_->column_types_;
+            for (SizeT i = 0; i < highlighters.size(); ++i) {
+                if (auto iter = column_terms.find(column_names[i]); iter != column_terms.end() and column_types[i]->type() == LogicalType::kVarchar) {
+                    highlighters[i] = MakeUnique<Highlighter>(iter->second, snippet_size);
+                }
+            }
+        }
+    }
 #ifdef INFINITY_DEBUG
     {
         OStringStream oss;
@@ -141,6 +317,18 @@ bool ExecuteInnerHomebrewed(QueryContext *query_context,
     TimeDurationType blockmax_duration = 0;
     FullTextQueryContext full_text_query_context;
     full_text_query_context.query_tree_ = std::move(query_tree);
+    if (choose_iter_automatically) {
+        // early termination pays off for queries of many terms, or when far more docs match than top_n results are kept,
+        // otherwise the plain iterators do less work per doc
+        et_iter = query_builder.CreateEarlyTerminateSearch(full_text_query_context);
+        if (full_text_query_context.query_tree_->GetTermCount() >= FULL_TEXT_EARLY_TERMINATE_MIN_TERMS or
+            (et_iter and et_iter->DocFreq() > u64(top_n) * FULL_TEXT_EARLY_TERMINATE_DOCS_PER_RESULT)) {
+            use_block_max_iter = true;
+        } else {
+            et_iter.reset();
+            use_ordinary_iter = true;
+        }
+    }
     if (use_ordinary_iter) {
         doc_iterator = query_builder.CreateSearch(full_text_query_context);
 #ifdef INFINITY_DEBUG
@@ -152,7 +340,7 @@ bool ExecuteInnerHomebrewed(QueryContext *query_context,
         }
 #endif
     }
-    if (use_block_max_iter) {
+    if (use_block_max_iter and !choose_iter_automatically) {
         et_iter = query_builder.CreateEarlyTerminateSearch(full_text_query_context);
 #ifdef INFINITY_DEBUG
         if (et_iter.get() != nullptr) {
@@ -165,16 +353,8 @@ bool ExecuteInnerHomebrewed(QueryContext *query_context,
     }
 
     // 3 full text search
-    u32 top_n = 0;
-    if (auto iter_n_option = search_ops.options_.find("topn"); iter_n_option != search_ops.options_.end()) {
-        int top_n_option = std::stoi(iter_n_option->second);
-        if (top_n_option <= 0) {
-            RecoverableError(Status::SyntaxError("topn must be a positive integer"));
-        }
-        top_n = top_n_option;
-    } else {
-        top_n = DEFAULT_FULL_TEXT_OPTION_TOP_N;
-    }
+    // the other tasks of a parallel match raise the threshold too, not used when comparing with the ordinary results
+    MatchSharedData *match_shared_data = use_ordinary_iter ? nullptr : operator_state->match_shared_data_;
     if (use_ordinary_iter) {
         RowID iter_row_id = doc_iterator.get() == nullptr ? INVALID_ROWID : (doc_iterator->PrepareFirstDoc(), doc_iterator->Doc());
         if (iter_row_id != INVALID_ROWID) [[likely]] {
@@ -185,10 +365,14 @@ bool ExecuteInnerHomebrewed(QueryContext *query_context,
             auto ordinary_begin_ts = std::chrono::high_resolution_clock::now();
 #endif
             do {
-                ++ordinary_loop_cnt;
-                // call scorer
-                float score = query_builder.Score(iter_row_id);
-                result_heap.AddResult(score, iter_row_id);
+                if ((++ordinary_loop_cnt % QUERY_CANCEL_CHECK_INTERVAL) == 0) [[unlikely]] {
+                    query_context->CheckCanceled();
+                }
+                if (!match_filter or match_filter->Pass(iter_row_id)) {
+                    // call scorer
+                    float score = query_builder.Score(iter_row_id);
+                    result_heap.AddResult(score, iter_row_id);
+                }
                 // get next row_id
                 iter_row_id = doc_iterator->Next();
             } while (iter_row_id != INVALID_ROWID);
@@ -209,14 +393,27 @@ bool ExecuteInnerHomebrewed(QueryContext *query_context,
 #endif
         if (et_iter) {
             while (true) {
-                ++blockmax_loop_cnt;
-                auto [id, et_score] = et_iter->BlockNextWithThreshold(result_heap.GetScoreThreshold());
+                if ((++blockmax_loop_cnt % QUERY_CANCEL_CHECK_INTERVAL) == 0) [[unlikely]] {
+                    query_context->CheckCanceled();
+                }
+                float threshold = result_heap.GetScoreThreshold();
+                if (match_shared_data) {
+                    threshold = std::max(threshold, match_shared_data->ScoreThreshold());
+                }
+                auto [id, et_score] = et_iter->BlockNextWithThreshold(threshold);
                 if (id == INVALID_ROWID) [[unlikely]] {
                     break;
                 }
+                if (match_filter and !match_filter->Pass(id)) {
+                    continue;
+                }
                 if (result_heap.AddResult(et_score, id)) {
                     // update threshold
-                    et_iter->UpdateScoreThreshold(result_heap.GetScoreThreshold());
+                    threshold = result_heap.GetScoreThreshold();
+                    if (match_shared_data) {
+                        threshold = match_shared_data->UpdateScoreThreshold(threshold);
+                    }
+                    et_iter->UpdateScoreThreshold(threshold);
                 }
             }
         }
@@ -293,7 +490,13 @@ bool ExecuteInnerHomebrewed(QueryContext *query_context,
             for (; column_id < column_n; ++column_id) {
                 BlockColumnEntry *block_column_ptr = block_entry->GetColumnBlockEntry(column_ids[column_id]);
                 ColumnVector column_vector = block_column_ptr->GetColumnVector(query_context->storage()->buffer_manager());
-                output_block_ptr->column_vectors[column_id]->AppendWith(column_vector, block_offset, 1);
+                if (highlighters[column_id]) {
+                    const Value text = column_vector.GetValue(block_offset);
+                    output_block_ptr->column_vectors[column_id]->AppendValue(Value::MakeVarchar(highlighters[column_id]->Highlight(text.GetVarchar())));
+                    continue;
+                }
+                ColumnVector &output_column = *output_block_ptr->column_vectors[column_id];
+                block_column_ptr->ReadRows(output_column, column_vector, block_offset, 1, begin_ts);
             }
             Value v = Value::MakeFloat(score_result[output_id]);
             output_block_ptr->column_vectors[column_id++]->AppendValue(v);
@@ -310,17 +513,60 @@ bool ExecuteInnerHomebrewed(QueryContext *query_context,
 PhysicalMatch::PhysicalMatch(u64 id,
                              SharedPtr<BaseTableRef> base_table_ref,
                              SharedPtr<MatchExpression> match_expr,
+                             SharedPtr<BaseExpression> filter_expression,
+                             SharedPtr<FastRoughFilterEvaluator> fast_rough_filter_evaluator,
                              u64 match_table_index,
                              SharedPtr<Vector<LoadMeta>> load_metas)
     : PhysicalOperator(PhysicalOperatorType::kMatch, nullptr, nullptr, id, load_metas), table_index_(match_table_index),
-      base_table_ref_(std::move(base_table_ref)), match_expr_(std::move(match_expr)) {}
+      base_table_ref_(std::move(base_table_ref)), match_expr_(std::move(match_expr)), filter_expression_(std::move(filter_expression)),
+      fast_rough_filter_evaluator_(std::move(fast_rough_filter_evaluator)) {}
 
 PhysicalMatch::~PhysicalMatch() = default;
 
 void PhysicalMatch::Init() {}
 
 bool PhysicalMatch::Execute(QueryContext *query_context, OperatorState *operator_state) {
-    return ExecuteInnerHomebrewed(query_context, operator_state, base_table_ref_, match_expr_, std::move(*GetOutputTypes()));
+    auto *match_operator_state = static_cast<MatchOperatorState *>(operator_state);
+    return ExecuteInnerHomebrewed(query_context,
+                                  match_operator_state,
+                                  base_table_ref_,
+                                  match_expr_,
+                                  filter_expression_,
+                                  fast_rough_filter_evaluator_.get(),
+                                  TopN(),
+                                  std::move(*GetOutputTypes()));
+}
+
+SizeT PhysicalMatch::TaskletCount() { return base_table_ref_->block_index_->SegmentCount(); }
+
+Vector<SharedPtr<Vector<SegmentID>>> PhysicalMatch::PlanSegments(SizeT task_count, TxnTimeStamp begin_ts) const {
+    Vector<SharedPtr<Vector<SegmentID>>> result(task_count);
+    for (auto &segment_ids : result) {
+        segment_ids = MakeShared<Vector<SegmentID>>();
+    }
+    // the old segments are larger, deal them out in turn
+    const BlockIndex *block_index = base_table_ref_->block_index_.get();
+    SizeT dealt_count = 0;
+    for (const SegmentEntry *segment_entry : block_index->segments_) {
+        const SegmentID segment_id = segment_entry->segment_id();
+        const u32 block_count = block_index->SegmentBlockCount(segment_id);
+        const FastRoughFilter &segment_filter = *segment_entry->GetFastRoughFilter();
+        if (fast_rough_filter_evaluator_ and !fast_rough_filter_evaluator_->EvaluateSegment(begin_ts, segment_filter, block_count)) {
+            LOG_TRACE(fmt::format("Match: segment {} not planned after FastRoughFilter", segment_id));
+            continue;
+        }
+        result[dealt_count++ % task_count]->push_back(segment_id);
+    }
+    for (auto &segment_ids : result) {
+        std::sort(segment_ids->begin(), segment_ids->end());
+    }
+    return result;
+}
+
+u32 PhysicalMatch::TopN() const {
+    SearchOptions search_ops(match_expr_->options_text_);
+    u32 top_n = GetTopN(search_ops);
+    return limit_top_n_.has_value() ? std::min(top_n, *limit_top_n_) : top_n;
 }
 
 SharedPtr<Vector<String>> PhysicalMatch::GetOutputNames() const {
@@ -26,10 +26,12 @@ import table_entry;
 import base_expression;
 import match_expression;
 import base_table_ref;
+import block_index;
 import load_meta;
 import infinity_exception;
 import internal_types;
 import data_type;
+import fast_rough_filter;
 
 namespace infinity {
 
@@ -38,6 +40,8 @@ public:
     explicit PhysicalMatch(u64 id,
                            SharedPtr<BaseTableRef> base_table_ref,
                            SharedPtr<MatchExpression> match_expr,
+                           SharedPtr<BaseExpression> filter_expression,
+                           SharedPtr<FastRoughFilterEvaluator> fast_rough_filter_evaluator,
                            u64 match_table_index,
                            SharedPtr<Vector<LoadMeta>> load_metas);
 
@@ -51,10 +55,19 @@ public:
 
     SharedPtr<Vector<SharedPtr<DataType>>> GetOutputTypes() const final;
 
-    SizeT TaskletCount() override {
-        UnrecoverableError("Not implement: TaskletCount not Implement");
-        return 0;
-    }
+    // One tasklet for each segment, the segments are searched by the tasks of a parallel match.
+    SizeT TaskletCount() override;
+
+    // Sorted segments of each task, the segments ruled out by their FastRoughFilter are not given to any task
+    Vector<SharedPtr<Vector<SegmentID>>> PlanSegments(SizeT task_count, TxnTimeStamp begin_ts) const;
+
+    BlockIndex *GetBlockIndex() const { return base_table_ref_->block_index_.get(); }
+
+    // Number of the results, the "topn" option
+    // the topn option of the match, or the rows of the LIMIT above it if fewer
+    u32 TopN() const;
+
+    void SetLimitTopN(u32 limit_top_n) { limit_top_n_ = limit_top_n; }
 
     void FillingTableRefs(HashMap<SizeT, SharedPtr<BaseTableRef>> &table_refs) override {
         table_refs.insert({base_table_ref_->table_index_, base_table_ref_});
@@ -69,10 +82,15 @@ public:
     [[nodiscard]] inline u64 table_index() const { return table_index_; }
 
     [[nodiscard]] inline MatchExpression* match_expr() const { return match_expr_.get(); }
+
+    [[nodiscard]] inline BaseExpression *filter_expression() const { return filter_expression_.get(); }
 private:
     u64 table_index_{};
     SharedPtr<BaseTableRef> base_table_ref_{};
     SharedPtr<MatchExpression> match_expr_{};
+    SharedPtr<BaseExpression> filter_expression_{};
+    SharedPtr<FastRoughFilterEvaluator> fast_rough_filter_evaluator_{};
+    Optional<u32> limit_top_n_{};
 
     bool ExecuteInner(QueryContext *query_context, OperatorState *operator_state);
 };
@@ -26,6 +26,8 @@ import data_block;
 
 import physical_aggregate;
 import aggregate_expression;
+import aggregate_function;
+import column_vector;
 
 import infinity_exception;
 
@@ -47,6 +49,7 @@ bool PhysicalMergeAggregate::Execute(QueryContext *query_context, OperatorState
     if (merge_aggregate_op_state->input_complete_) {
 
         LOG_TRACE("PhysicalMergeAggregate::Input is complete");
+        FinalizeSketches(merge_aggregate_op_state);
         for (auto &output_block : merge_aggregate_op_state->data_block_array_) {
             output_block->Finalize();
         }
@@ -59,6 +62,7 @@ bool PhysicalMergeAggregate::Execute(QueryContext *query_context, OperatorState
 }
 
 void PhysicalMergeAggregate::SimpleMergeAggregateExecute(MergeAggregateOperatorState *op_state) {
+    MergeSketches(op_state);
     if (op_state->data_block_array_.empty()) {
         op_state->data_block_array_.emplace_back(std::move(op_state->input_data_block_));
         LOG_TRACE("Physical MergeAggregate execute first block");
@@ -68,6 +72,10 @@ void PhysicalMergeAggregate::SimpleMergeAggregateExecute(MergeAggregateOperatorS
         for (SizeT col_idx = 0; col_idx < aggs_size; ++col_idx) {
             auto agg_expression = static_cast<AggregateExpression *>(agg_op->aggregates_[col_idx].get());
 
+            if (agg_expression->aggregate_function_.IsSketch()) {
+                continue;
+            }
+
             auto function_name = agg_expression->aggregate_function_.GetFuncName();
 
             auto func_return_type = agg_expression->aggregate_function_.return_type_;
@@ -105,6 +113,46 @@ void PhysicalMergeAggregate::SimpleMergeAggregateExecute(MergeAggregateOperatorS
     }
 }
 
+void PhysicalMergeAggregate::MergeSketches(MergeAggregateOperatorState *op_state) {
+    auto agg_op = dynamic_cast<PhysicalAggregate *>(this->left());
+    SizeT aggs_size = agg_op->aggregates_.size();
+    op_state->sketch_states_.resize(aggs_size);
+    for (SizeT col_idx = 0; col_idx < aggs_size; ++col_idx) {
+        auto agg_expression = static_cast<AggregateExpression *>(agg_op->aggregates_[col_idx].get());
+        if (!agg_expression->aggregate_function_.IsSketch()) {
+            continue;
+        }
+        const AggregateFunction &merge_function = *agg_expression->aggregate_function_.merge_function_;
+        UniquePtr<char[]> &state = op_state->sketch_states_[col_idx];
+        if (state.get() == nullptr) {
+            state = merge_function.InitState();
+            merge_function.init_func_(state.get());
+        }
+        merge_function.update_func_(state.get(), op_state->input_data_block_->column_vectors[col_idx]);
+    }
+}
+
+void PhysicalMergeAggregate::FinalizeSketches(MergeAggregateOperatorState *op_state) {
+    if (op_state->data_block_array_.empty()) {
+        return;
+    }
+    // The merged states replace the partial results in the output block.
+    auto agg_op = dynamic_cast<PhysicalAggregate *>(this->left());
+    DataBlock *output_block = op_state->data_block_array_[0].get();
+    for (SizeT col_idx = 0; col_idx < op_state->sketch_states_.size(); ++col_idx) {
+        const UniquePtr<char[]> &state = op_state->sketch_states_[col_idx];
+        if (state.get() == nullptr) {
+            continue;
+        }
+        auto agg_expression = static_cast<AggregateExpression *>(agg_op->aggregates_[col_idx].get());
+        const AggregateFunction &merge_function = *agg_expression->aggregate_function_.merge_function_;
+        SharedPtr<ColumnVector> result_column = ColumnVector::Make(MakeShared<DataType>(merge_function.return_type()));
+        result_column->Initialize();
+        result_column->AppendByPtr(merge_function.finalize_func_(state.get()));
+        output_block->column_vectors[col_idx] = std::move(result_column);
+    }
+}
+
 template <typename T>
 void PhysicalMergeAggregate::HandleAggregateFunction(const String &function_name, MergeAggregateOperatorState *op_state, SizeT col_idx) {
     LOG_TRACE(function_name);
@@ -70,6 +70,11 @@ public:
 
     void SimpleMergeAggregateExecute(MergeAggregateOperatorState *merge_aggregate_op_state);
 
+    // The partial results of a sketch aggregate are its states, merged by its merge function.
+    void MergeSketches(MergeAggregateOperatorState *op_state);
+
+    void FinalizeSketches(MergeAggregateOperatorState *op_state);
+
     template <typename T>
     void UpdateData(MergeAggregateOperatorState *op_state, MathOperation<T> operation, SizeT col_idx);
 
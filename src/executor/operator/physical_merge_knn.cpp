@@ -18,10 +18,12 @@ module physical_merge_knn;
 
 import stl;
 import txn;
+import block_column_entry;
 import query_context;
 
 import physical_operator_type;
 import operator_state;
+import query_memory_tracker;
 import logger;
 import status;
 import infinity_exception;
@@ -58,6 +60,9 @@ bool PhysicalMergeKnn::Execute(QueryContext *query_context, OperatorState *opera
         case kElemInvalid: {
             UnrecoverableError("Invalid elem type");
         }
+        // the distances of every element type are f32
+        case kElemInt8:
+        case kElemBit:
         case kElemFloat: {
             switch (merge_knn_data.heap_type_) {
                 case MergeKnnHeapType::kInvalid: {
@@ -91,7 +96,11 @@ void PhysicalMergeKnn::ExecuteInner(QueryContext *query_context, MergeKnnOperato
     }
 
     auto merge_knn = static_cast<MergeKnn<DataType, C> *>(merge_knn_data.merge_knn_base_.get());
+    merge_knn_state->memory_reservation_.Init(query_context->memory_tracker());
+    merge_knn_state->memory_reservation_.ResizeOrFail(merge_knn_data.query_count_ * merge_knn_data.topk_ * (sizeof(DataType) + sizeof(RowID)),
+                                                      "Merge KNN heap");
 
+    TxnTimeStamp begin_ts = query_context->GetTxn()->BeginTS();
     int column_n = input_data.column_count() - 2;
     if (column_n < 0) {
         UnrecoverableError("Input data block is invalid");
@@ -111,8 +120,8 @@ void PhysicalMergeKnn::ExecuteInner(QueryContext *query_context, MergeKnnOperato
         BlockIndex *block_index = merge_knn_data.table_ref_->block_index_.get();
 
         u64 output_row_count{0};
-        i64 result_n = std::min(merge_knn_data.topk_, merge_knn->total_count());
         for (i64 query_idx = 0; query_idx < merge_knn_data.query_count_; ++query_idx) {
+            i64 result_n = merge_knn->ResultCount(query_idx);
             DataType *result_dists = merge_knn->GetDistancesByIdx(query_idx);
             RowID *result_row_ids = merge_knn->GetIDsByIdx(query_idx);
             for (i64 top_idx = 0; top_idx < result_n; ++top_idx) {
@@ -139,8 +148,10 @@ void PhysicalMergeKnn::ExecuteInner(QueryContext *query_context, MergeKnnOperato
                 SizeT column_n = table_ref_->column_ids_.size();
                 for (SizeT i = 0; i < column_n; ++i) {
                     SizeT column_id = table_ref_->column_ids_[i];
-                    ColumnVector &&column_vector = block_entry->GetColumnBlockEntry(column_id)->GetColumnVector(buffer_mgr);
-                    output_data_block->column_vectors[i]->AppendWith(column_vector, block_offset, 1);
+                    BlockColumnEntry *block_column_entry = block_entry->GetColumnBlockEntry(column_id);
+                    ColumnVector &&column_vector = block_column_entry->GetColumnVector(buffer_mgr);
+                    ColumnVector &output_column = *output_data_block->column_vectors[i];
+                    block_column_entry->ReadRows(output_column, column_vector, block_offset, 1, begin_ts);
                 }
                 output_data_block->AppendValueByPtr(column_n, (ptr_t)&result_dists[top_idx]);
                 output_data_block->AppendValueByPtr(column_n + 1, (ptr_t)&result_row_ids[top_idx]);
@@ -152,6 +163,7 @@ void PhysicalMergeKnn::ExecuteInner(QueryContext *query_context, MergeKnnOperato
         }
 
         merge_knn_state->data_block_array_.back()->Finalize();
+        merge_knn_state->memory_reservation_.Resize(0);
         merge_knn_state->SetComplete();
     }
 }
@@ -0,0 +1,123 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+module physical_merge_match;
+
+import stl;
+import query_context;
+import physical_operator_type;
+import operator_state;
+import fulltext_score_result_heap;
+import block_index;
+import block_entry;
+import block_column_entry;
+import txn;
+import buffer_manager;
+import column_vector;
+import data_block;
+import default_values;
+import infinity_exception;
+import logger;
+import third_party;
+import value;
+
+namespace infinity {
+
+void PhysicalMergeMatch::Init() {}
+
+bool PhysicalMergeMatch::Execute(QueryContext *query_context, OperatorState *operator_state) {
+    auto *merge_match_state = static_cast<MergeMatchOperatorState *>(operator_state);
+    if (!merge_match_state->result_heap_) {
+        merge_match_state->score_result_ = MakeUniqueForOverwrite<float[]>(top_n_);
+        merge_match_state->row_id_result_ = MakeUniqueForOverwrite<RowID[]>(top_n_);
+        merge_match_state->result_heap_ =
+            MakeUnique<FullTextScoreResultHeap>(top_n_, merge_match_state->score_result_.get(), merge_match_state->row_id_result_.get());
+    }
+    FullTextScoreResultHeap &result_heap = *merge_match_state->result_heap_;
+
+    // the score and the row id are the last two columns of the match output
+    if (DataBlock *input_data = merge_match_state->input_data_block_.get(); input_data != nullptr) {
+        if (!input_data->Finalized()) {
+            UnrecoverableError("Input data block is not finalized");
+        }
+        i64 column_n = (i64)input_data->column_count() - 2;
+        if (column_n < 0) {
+            UnrecoverableError("Input data block is invalid");
+        }
+        auto scores = reinterpret_cast<const float *>(input_data->column_vectors[column_n]->data());
+        auto row_ids = reinterpret_cast<const RowID *>(input_data->column_vectors[column_n + 1]->data());
+        SizeT row_n = input_data->row_count();
+        for (SizeT i = 0; i < row_n; ++i) {
+            result_heap.AddResult(scores[i], row_ids[i]);
+        }
+        merge_match_state->input_data_block_.reset();
+    }
+    if (!merge_match_state->input_complete_) {
+        return true;
+    }
+
+    result_heap.Sort();
+    u32 result_count = result_heap.GetResultSize();
+    LOG_TRACE(fmt::format("Merged full text search result count: {}", result_count));
+    const float *score_result = merge_match_state->score_result_.get();
+    const RowID *row_id_result = merge_match_state->row_id_result_.get();
+
+    auto &output_data_blocks = merge_match_state->data_block_array_;
+    auto append_data_block = [&]() {
+        auto data_block = DataBlock::MakeUniquePtr();
+        data_block->Init(*GetOutputTypes());
+        output_data_blocks.emplace_back(std::move(data_block));
+    };
+    append_data_block();
+    BufferManager *buffer_mgr = query_context->storage()->buffer_manager();
+    TxnTimeStamp begin_ts = query_context->GetTxn()->BeginTS();
+    const Vector<SizeT> &column_ids = base_table_ref_->column_ids_;
+    SizeT column_n = column_ids.size();
+    u32 output_block_row_id = 0;
+    DataBlock *output_block_ptr = output_data_blocks.back().get();
+    for (u32 output_id = 0; output_id < result_count; ++output_id) {
+        if (output_block_row_id == DEFAULT_BLOCK_CAPACITY) {
+            output_block_ptr->Finalize();
+            append_data_block();
+            output_block_ptr = output_data_blocks.back().get();
+            output_block_row_id = 0;
+        }
+        const RowID &row_id = row_id_result[output_id];
+        u16 block_id = row_id.segment_offset_ / DEFAULT_BLOCK_CAPACITY;
+        u16 block_offset = row_id.segment_offset_ % DEFAULT_BLOCK_CAPACITY;
+        const BlockEntry *block_entry = base_table_ref_->block_index_->GetBlockEntry(row_id.segment_id_, block_id);
+        if (block_entry == nullptr) {
+            UnrecoverableError(fmt::format("Cannot find block segment id: {}, block id: {}", row_id.segment_id_, block_id));
+        }
+        SizeT column_id = 0;
+        for (; column_id < column_n; ++column_id) {
+            BlockColumnEntry *block_column_ptr = block_entry->GetColumnBlockEntry(column_ids[column_id]);
+            ColumnVector column_vector = block_column_ptr->GetColumnVector(buffer_mgr);
+            ColumnVector &output_column = *output_block_ptr->column_vectors[column_id];
+            block_column_ptr->ReadRows(output_column, column_vector, block_offset, 1, begin_ts);
+        }
+        Value v = Value::MakeFloat(score_result[output_id]);
+        output_block_ptr->column_vectors[column_id++]->AppendValue(v);
+        output_block_ptr->column_vectors[column_id]->AppendWith(row_id, 1);
+        ++output_block_row_id;
+    }
+    output_block_ptr->Finalize();
+
+    merge_match_state->SetComplete();
+    return true;
+}
+
+} // namespace infinity
@@ -0,0 +1,78 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module physical_merge_match;
+
+import stl;
+
+import query_context;
+import operator_state;
+import physical_operator;
+import physical_operator_type;
+import base_table_ref;
+import load_meta;
+import infinity_exception;
+import internal_types;
+import data_type;
+
+namespace infinity {
+
+// Merges the top n of the tasks of a parallel match into the top n of the table.
+export class PhysicalMergeMatch final : public PhysicalOperator {
+public:
+    explicit PhysicalMergeMatch(u64 id,
+                                SharedPtr<BaseTableRef> base_table_ref,
+                                UniquePtr<PhysicalOperator> left,
+                                SharedPtr<Vector<String>> output_names,
+                                SharedPtr<Vector<SharedPtr<DataType>>> output_types,
+                                u32 top_n,
+                                u64 match_table_index,
+                                SharedPtr<Vector<LoadMeta>> load_metas)
+        : PhysicalOperator(PhysicalOperatorType::kMergeMatch, std::move(left), nullptr, id, load_metas), output_names_(std::move(output_names)),
+          output_types_(std::move(output_types)), top_n_(top_n), table_index_(match_table_index), base_table_ref_(std::move(base_table_ref)) {}
+
+    ~PhysicalMergeMatch() override = default;
+
+    void Init() override;
+
+    bool Execute(QueryContext *query_context, OperatorState *operator_state) final;
+
+    inline SharedPtr<Vector<String>> GetOutputNames() const final { return output_names_; }
+
+    inline SharedPtr<Vector<SharedPtr<DataType>>> GetOutputTypes() const final { return output_types_; }
+
+    SizeT TaskletCount() override {
+        UnrecoverableError("Not implement: TaskletCount not Implement");
+        return 0;
+    }
+
+    void FillingTableRefs(HashMap<SizeT, SharedPtr<BaseTableRef>> &table_refs) override {
+        table_refs.insert({base_table_ref_->table_index_, base_table_ref_});
+    }
+
+    [[nodiscard]] inline u32 top_n() const { return top_n_; }
+
+    [[nodiscard]] inline u64 table_index() const { return table_index_; }
+
+private:
+    SharedPtr<Vector<String>> output_names_{};
+    SharedPtr<Vector<SharedPtr<DataType>>> output_types_{};
+    u32 top_n_{};
+    u64 table_index_{};
+    SharedPtr<BaseTableRef> base_table_ref_{};
+};
+
+} // namespace infinity
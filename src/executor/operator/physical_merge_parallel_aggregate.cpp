@@ -14,15 +14,48 @@
 
 module;
 
+module physical_merge_parallel_aggregate;
+
+import stl;
 import query_context;
 import operator_state;
-
-module physical_merge_parallel_aggregate;
+import aggregate_hash_table;
+import query_memory_tracker;
+import data_block;
+import internal_types;
+import data_type;
 
 namespace infinity {
 
 void PhysicalMergeParallelAggregate::Init() {}
 
-bool PhysicalMergeParallelAggregate::Execute(QueryContext *, OperatorState *) { return true; }
+bool PhysicalMergeParallelAggregate::Execute(QueryContext *query_context, OperatorState *operator_state) {
+    auto *merge_aggregate_state = static_cast<MergeParallelAggregateOperatorState *>(operator_state);
+    if (merge_aggregate_state->hash_table_.get() == nullptr) {
+        merge_aggregate_state->hash_table_ = MakeUnique<AggregateHashTable>(groups_, aggregates_);
+    }
+
+    for (const auto &input_block : merge_aggregate_state->input_data_blocks_) {
+        merge_aggregate_state->hash_table_->Update(input_block.get());
+    }
+    merge_aggregate_state->input_data_blocks_.clear();
+    merge_aggregate_state->memory_reservation_.Init(query_context->memory_tracker());
+    merge_aggregate_state->memory_reservation_.ResizeOrFail(merge_aggregate_state->hash_table_->MemoryUsage(), "Merge aggregate hash table");
+    if (!merge_aggregate_state->input_complete_) {
+        return false;
+    }
+
+    merge_aggregate_state->hash_table_->Finalize(*output_types_, merge_aggregate_state->data_block_array_);
+    if (merge_aggregate_state->data_block_array_.empty()) {
+        // The operators after aggregate always expect one block at least.
+        merge_aggregate_state->data_block_array_.emplace_back(DataBlock::MakeUniquePtr());
+        merge_aggregate_state->data_block_array_.back()->Init(*output_types_);
+        merge_aggregate_state->data_block_array_.back()->Finalize();
+    }
+    merge_aggregate_state->hash_table_.reset();
+    merge_aggregate_state->memory_reservation_.Resize(0);
+    merge_aggregate_state->SetComplete();
+    return true;
+}
 
 } // namespace infinity
@@ -22,6 +22,7 @@ import query_context;
 import operator_state;
 import physical_operator;
 import physical_operator_type;
+import base_expression;
 import load_meta;
 import infinity_exception;
 import internal_types;
@@ -29,14 +30,23 @@ import data_type;
 
 namespace infinity {
 
+// Second phase of the two-phase group by aggregate.
+// Task i gets the partition i of the partial results of all PhysicalParallelAggregate tasks. A group is only in one partition,
+// so each task merges the partial results of its partition independently. groups_ refer to the group by key columns of
+// the partial results, aggregates_ merge the partial result columns, e.g. SUM on the partial COUNT.
 export class PhysicalMergeParallelAggregate final : public PhysicalOperator {
 public:
-    explicit PhysicalMergeParallelAggregate(SharedPtr<Vector<String>> output_names,
+    explicit PhysicalMergeParallelAggregate(u64 id,
+                                            UniquePtr<PhysicalOperator> left,
+                                            Vector<SharedPtr<BaseExpression>> groups,
+                                            Vector<SharedPtr<BaseExpression>> aggregates,
+                                            SharedPtr<Vector<String>> output_names,
                                             SharedPtr<Vector<SharedPtr<DataType>>> output_types,
-                                            u64 id,
+                                            SizeT partition_count,
                                             SharedPtr<Vector<LoadMeta>> load_metas)
-        : PhysicalOperator(PhysicalOperatorType::kMergeParallelAggregate, nullptr, nullptr, id, load_metas), output_names_(std::move(output_names)),
-          output_types_(std::move(output_types)) {}
+        : PhysicalOperator(PhysicalOperatorType::kMergeParallelAggregate, std::move(left), nullptr, id, load_metas), groups_(std::move(groups)),
+          aggregates_(std::move(aggregates)), output_names_(std::move(output_names)), output_types_(std::move(output_types)),
+          partition_count_(partition_count) {}
 
     ~PhysicalMergeParallelAggregate() override = default;
 
@@ -48,14 +58,17 @@ public:
 
     inline SharedPtr<Vector<SharedPtr<DataType>>> GetOutputTypes() const final { return output_types_; }
 
-    SizeT TaskletCount() override {
-        UnrecoverableError("Not implement: TaskletCount not Implement");
-        return 0;
-    }
+    SizeT TaskletCount() override { return partition_count_; }
+
+    inline SizeT PartitionCount() const { return partition_count_; }
+
+    Vector<SharedPtr<BaseExpression>> groups_{};
+    Vector<SharedPtr<BaseExpression>> aggregates_{};
 
 private:
     SharedPtr<Vector<String>> output_names_{};
     SharedPtr<Vector<SharedPtr<DataType>>> output_types_{};
+    SizeT partition_count_{};
 };
 
 } // namespace infinity
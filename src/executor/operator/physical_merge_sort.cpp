@@ -14,15 +14,351 @@
 
 module;
 
-import query_context;
-import operator_state;
+#include <cstring>
+#include <algorithm>
 
 module physical_merge_sort;
 
+import stl;
+import query_context;
+import operator_state;
+import query_memory_tracker;
+import physical_top;
+import data_block;
+import default_values;
+import sort_key;
+import data_type;
+import storage;
+import buffer_manager;
+import local_file_system;
+import file_system;
+import file_system_type;
+import random;
+import io_counter;
+import external_sort_merger;
+import infinity_exception;
+import third_party;
+import logger;
+
 namespace infinity {
 
-void PhysicalMergeSort::Init() {}
+namespace {
+
+constexpr SizeT SPILL_IO_BUFFER_SIZE = 1024 * 1024;
+// Memory of the external sort merger, the query memory limit clamped into this range.
+constexpr u64 SORT_MERGE_MIN_BUFFER_SIZE = 16 * 1024 * 1024;
+constexpr u64 SORT_MERGE_MAX_BUFFER_SIZE = 512 * 1024 * 1024;
+
+String SpillRunPath(const String &spill_dir, SizeT run_idx) { return fmt::format("{}/run_{}", spill_dir, run_idx); }
+
+String SpillKeyPath(const String &spill_dir, SizeT run_idx) { return fmt::format("{}/key_{}", spill_dir, run_idx); }
+
+void AppendSpillFile(const String &file_path, const char *data, SizeT size) {
+    LocalFileSystem fs;
+    u8 flags = FileFlags::WRITE_FLAG | FileFlags::CREATE_FLAG | FileFlags::APPEND_FLAG;
+    UniquePtr<FileHandler> file_handler = fs.OpenFile(file_path, flags, FileLockType::kWriteLock);
+    fs.Write(*file_handler, data, size);
+    fs.Close(*file_handler);
+    ThreadIOCounter().spilled_bytes_ += size;
+}
+
+// Each block is written as its size followed by the serialized block, like the spill files of hash join.
+void AppendSpillBlocks(const String &file_path, const Vector<UniquePtr<DataBlock>> &data_blocks) {
+    Vector<char> buffer;
+    for (const auto &data_block : data_blocks) {
+        i32 block_size = data_block->GetSizeInBytes();
+        SizeT offset = buffer.size();
+        buffer.resize(offset + sizeof(block_size) + block_size);
+        std::memcpy(buffer.data() + offset, &block_size, sizeof(block_size));
+        char *ptr = buffer.data() + offset + sizeof(block_size);
+        data_block->WriteAdv(ptr);
+    }
+    AppendSpillFile(file_path, buffer.data(), buffer.size());
+}
+
+inline void AppendBigEndian(Vector<char> &buffer, u32 value) {
+    for (i32 shift = 24; shift >= 0; shift -= 8) {
+        buffer.emplace_back(static_cast<char>((value >> shift) & 0xFF));
+    }
+}
+
+inline u32 ReadBigEndian(const char *data) {
+    u32 value = 0;
+    for (SizeT idx = 0; idx < sizeof(u32); ++idx) {
+        value = (value << 8) | static_cast<u8>(data[idx]);
+    }
+    return value;
+}
+
+// Sequential reader of a spill file.
+class SpillFileReader {
+public:
+    explicit SpillFileReader(const String &file_path)
+        : file_path_(file_path), file_handler_(fs_.OpenFile(file_path, FileFlags::READ_FLAG, FileLockType::kReadLock)), buffer_(SPILL_IO_BUFFER_SIZE) {}
+
+    ~SpillFileReader() { fs_.Close(*file_handler_); }
+
+    void Read(char *data, SizeT size) {
+        while (size > 0) {
+            if (buffer_pos_ == buffer_size_) {
+                i64 read_size = fs_.Read(*file_handler_, buffer_.data(), buffer_.size());
+                if (read_size <= 0) {
+                    UnrecoverableError(fmt::format("Unexpected end of sort spill file: {}", file_path_));
+                }
+                buffer_size_ = read_size;
+                buffer_pos_ = 0;
+            }
+            SizeT copy_size = std::min(size, buffer_size_ - buffer_pos_);
+            std::memcpy(data, buffer_.data() + buffer_pos_, copy_size);
+            buffer_pos_ += copy_size;
+            data += copy_size;
+            size -= copy_size;
+        }
+    }
+
+private:
+    LocalFileSystem fs_{};
+    String file_path_{};
+    UniquePtr<FileHandler> file_handler_{};
+    Vector<char> buffer_{};
+    SizeT buffer_pos_{};
+    SizeT buffer_size_{};
+};
+
+// The rows of a spilled run are visited in increasing order, so only one block of the run is loaded at a time.
+class SpillRunReader {
+public:
+    explicit SpillRunReader(const String &file_path) : file_reader_(file_path) {}
+
+    inline bool Contains(SizeT row) const { return block_.get() != nullptr && row >= block_start_ && row < block_start_ + block_->row_count(); }
+
+    // Load the block containing the row, the blocks before it are skipped.
+    void Load(SizeT row) {
+        while (!Contains(row)) {
+            if (block_.get() != nullptr) {
+                block_start_ += block_->row_count();
+            }
+            i32 block_size{};
+            file_reader_.Read(reinterpret_cast<char *>(&block_size), sizeof(block_size));
+            Vector<char> buffer(block_size);
+            file_reader_.Read(buffer.data(), block_size);
+            char *ptr = buffer.data();
+            block_ = DataBlock::ReadAdv(ptr, block_size);
+        }
+    }
+
+    inline const DataBlock *block() const { return block_.get(); }
+
+    inline SizeT block_start() const { return block_start_; }
+
+private:
+    SpillFileReader file_reader_;
+    SharedPtr<DataBlock> block_{};
+    // Row index in the run of the first row of the block.
+    SizeT block_start_{};
+};
+
+} // namespace
+
+void PhysicalMergeSort::Init() {
+    left()->Init();
+    if (order_by_types_.size() != sort_expressions_.size()) {
+        UnrecoverableError("order_by_types_.size() != sort_expressions_.size()");
+    }
+    Vector<SharedPtr<DataType>> sort_key_types;
+    sort_key_types.reserve(sort_expressions_.size());
+    for (const auto &expression : sort_expressions_) {
+        sort_key_types.emplace_back(MakeShared<DataType>(expression->Type()));
+    }
+    sort_key_encoder_ = MakeUnique<SortKeyEncoder>(std::move(sort_key_types), order_by_types_);
+}
+
+bool PhysicalMergeSort::Execute(QueryContext *query_context, OperatorState *operator_state) {
+    auto *merge_sort_state = static_cast<MergeSortOperatorState *>(operator_state);
+    u64 memory_limit = query_context->memory_size_limit();
+    MemoryReservation &memory_reservation = merge_sort_state->memory_reservation_;
+    memory_reservation.Init(query_context->memory_tracker());
+    // The cached runs are over the memory of the operator or the query takes more than the query memory limit.
+    bool within_query_limit = memory_reservation.Resize(merge_sort_state->buffered_bytes_);
+    bool over_limit = !within_query_limit || (memory_limit > 0 && merge_sort_state->buffered_bytes_ > memory_limit);
+    if (!merge_sort_state->input_complete_) {
+        if (over_limit) {
+            SpillRuns(query_context, merge_sort_state);
+            memory_reservation.Resize(0);
+        }
+        return false;
+    }
+
+    if (merge_sort_state->spill_dir_.get() == nullptr && !over_limit) {
+        Vector<SortKeys> run_keys;
+        run_keys.reserve(merge_sort_state->input_runs_.size());
+        for (const auto &run : merge_sort_state->input_runs_) {
+            run_keys.emplace_back(EncodeRunKeys(merge_sort_state, run));
+        }
+        MergeSortedRuns(merge_sort_state->input_runs_, run_keys, merge_sort_state->data_block_array_);
+    } else {
+        SpillRuns(query_context, merge_sort_state);
+        MergeSpilledRuns(query_context, merge_sort_state);
+        LocalFileSystem fs;
+        fs.DeleteDirectory(*merge_sort_state->spill_dir_);
+        merge_sort_state->spill_dir_.reset();
+    }
+    merge_sort_state->input_runs_.clear();
+    merge_sort_state->buffered_bytes_ = 0;
+    memory_reservation.Resize(0);
+
+    if (merge_sort_state->data_block_array_.empty()) {
+        // The operators after merge sort always expect one block at least.
+        UniquePtr<DataBlock> output_block = DataBlock::MakeUniquePtr();
+        output_block->Init(*GetOutputTypes());
+        output_block->Finalize();
+        merge_sort_state->data_block_array_.emplace_back(std::move(output_block));
+    }
+    merge_sort_state->SetComplete();
+    return true;
+}
+
+SortKeys PhysicalMergeSort::EncodeRunKeys(MergeSortOperatorState *merge_sort_state, const Vector<UniquePtr<DataBlock>> &run) const {
+    SortKeys keys;
+    if (run.empty()) {
+        return keys;
+    }
+    auto eval_columns = PhysicalTop::GetEvalColumns(sort_expressions_, merge_sort_state->expr_states_, run);
+    for (SizeT block_idx = 0; block_idx < run.size(); ++block_idx) {
+        sort_key_encoder_->Encode(eval_columns[block_idx], run[block_idx]->row_count(), keys);
+    }
+    return keys;
+}
+
+void PhysicalMergeSort::SpillRuns(QueryContext *query_context, MergeSortOperatorState *merge_sort_state) const {
+    if (merge_sort_state->spill_dir_.get() == nullptr) {
+        String temp_dir = *query_context->storage()->buffer_manager()->GetTempDir();
+        LocalFileSystem fs;
+        if (!fs.Exists(temp_dir)) {
+            fs.CreateDirectory(temp_dir);
+        }
+        merge_sort_state->spill_dir_ = DetermineRandomString(temp_dir, fmt::format("merge_sort_{}", node_id()));
+        LOG_TRACE(fmt::format("Merge sort {} spills sorted runs into {}", node_id(), *merge_sort_state->spill_dir_));
+    }
+
+    const String &spill_dir = *merge_sort_state->spill_dir_;
+    Vector<Vector<UniquePtr<DataBlock>>> &input_runs = merge_sort_state->input_runs_;
+    Vector<SizeT> &spilled_row_counts = merge_sort_state->spilled_row_counts_;
+    if (spilled_row_counts.size() < input_runs.size()) {
+        spilled_row_counts.resize(input_runs.size(), 0);
+    }
+    for (SizeT run_idx = 0; run_idx < input_runs.size(); ++run_idx) {
+        Vector<UniquePtr<DataBlock>> &run = input_runs[run_idx];
+        if (run.empty()) {
+            continue;
+        }
+        SortKeys keys = EncodeRunKeys(merge_sort_state, run);
+        if (spilled_row_counts[run_idx] + keys.Count() >= std::numeric_limits<u32>::max()) {
+            UnrecoverableError("Too many rows in a sorted run of merge sort.");
+        }
+
+        // Each record is its size, the sort key, then the run index and the row index in big endian,
+        // so the records of equal keys are merged in the order of runs and rows.
+        Vector<char> records;
+        for (SizeT row_idx = 0; row_idx < keys.Count(); ++row_idx) {
+            std::string_view key = keys.Key(row_idx);
+            u32 record_size = key.size() + sizeof(u32) * 2;
+            records.insert(records.end(), reinterpret_cast<const char *>(&record_size), reinterpret_cast<const char *>(&record_size) + sizeof(record_size));
+            records.insert(records.end(), key.begin(), key.end());
+            AppendBigEndian(records, run_idx);
+            AppendBigEndian(records, spilled_row_counts[run_idx] + row_idx);
+            merge_sort_state->max_spilled_record_size_ = std::max(merge_sort_state->max_spilled_record_size_, sizeof(u32) + record_size);
+        }
+        AppendSpillFile(SpillKeyPath(spill_dir, run_idx), records.data(), records.size());
+        AppendSpillBlocks(SpillRunPath(spill_dir, run_idx), run);
+        spilled_row_counts[run_idx] += keys.Count();
+        run.clear();
+    }
+    merge_sort_state->buffered_bytes_ = 0;
+}
+
+void PhysicalMergeSort::MergeSpilledRuns(QueryContext *query_context, MergeSortOperatorState *merge_sort_state) const {
+    const String &spill_dir = *merge_sort_state->spill_dir_;
+    const Vector<SizeT> &spilled_row_counts = merge_sort_state->spilled_row_counts_;
+    Vector<SizeT> spilled_runs;
+    u64 record_count = 0;
+    for (SizeT run_idx = 0; run_idx < spilled_row_counts.size(); ++run_idx) {
+        if (spilled_row_counts[run_idx] > 0) {
+            spilled_runs.emplace_back(run_idx);
+            record_count += spilled_row_counts[run_idx];
+        }
+    }
+    if (spilled_runs.empty()) {
+        return;
+    }
+
+    // 1. The input of the external sort merger is the record count, then each run is its size, its record count and
+    //    the position of the next run, followed by the records of the run.
+    String merge_file_path = fmt::format("{}/merge", spill_dir);
+    {
+        LocalFileSystem fs;
+        UniquePtr<FileHandler> merge_file = fs.OpenFile(merge_file_path, FileFlags::WRITE_FLAG | FileFlags::CREATE_FLAG, FileLockType::kWriteLock);
+        fs.Write(*merge_file, &record_count, sizeof(record_count));
+        u64 run_pos = sizeof(record_count);
+        Vector<char> buffer(SPILL_IO_BUFFER_SIZE);
+        for (SizeT run_idx : spilled_runs) {
+            UniquePtr<FileHandler> key_file = fs.OpenFile(SpillKeyPath(spill_dir, run_idx), FileFlags::READ_FLAG, FileLockType::kReadLock);
+            SizeT key_file_size = fs.GetFileSize(*key_file);
+            if (key_file_size >= std::numeric_limits<u32>::max()) {
+                UnrecoverableError("Sort keys of a sorted run of merge sort are too large.");
+            }
+            u32 run_size = key_file_size;
+            u32 run_record_count = spilled_row_counts[run_idx];
+            u64 next_run_pos = run_pos + sizeof(run_size) + sizeof(run_record_count) + sizeof(next_run_pos) + run_size;
+            fs.Write(*merge_file, &run_size, sizeof(run_size));
+            fs.Write(*merge_file, &run_record_count, sizeof(run_record_count));
+            fs.Write(*merge_file, &next_run_pos, sizeof(next_run_pos));
+            for (SizeT copied_size = 0; copied_size < key_file_size;) {
+                i64 read_size = fs.Read(*key_file, buffer.data(), std::min(buffer.size(), key_file_size - copied_size));
+                if (read_size <= 0) {
+                    UnrecoverableError(fmt::format("Fail to read merge sort spill file of run {}", run_idx));
+                }
+                fs.Write(*merge_file, buffer.data(), read_size);
+                copied_size += read_size;
+            }
+            fs.Close(*key_file);
+            run_pos = next_run_pos;
+        }
+        fs.Close(*merge_file);
+    }
+
+    // 2. Merge the records of all runs, the merged records replace the input file.
+    u32 merge_buffer_size = std::clamp(query_context->memory_size_limit(), SORT_MERGE_MIN_BUFFER_SIZE, SORT_MERGE_MAX_BUFFER_SIZE);
+    SortMerger<std::string_view, u32> sort_merger(merge_file_path.c_str(), spilled_runs.size(), merge_buffer_size, 2);
+    sort_merger.SetParams(merge_sort_state->max_spilled_record_size_);
+    sort_merger.Run();
 
-bool PhysicalMergeSort::Execute(QueryContext *query_context, OperatorState *operator_state) { return true; }
+    // 3. Gather the rows in the merged order from the spilled blocks of the runs.
+    Vector<UniquePtr<SpillRunReader>> run_readers(spilled_row_counts.size());
+    for (SizeT run_idx : spilled_runs) {
+        run_readers[run_idx] = MakeUnique<SpillRunReader>(SpillRunPath(spill_dir, run_idx));
+    }
+    SpillFileReader merged_reader(merge_file_path);
+    u64 merged_count{};
+    merged_reader.Read(reinterpret_cast<char *>(&merged_count), sizeof(merged_count));
+    SortedRowAppender appender(merge_sort_state->data_block_array_);
+    Vector<char> record;
+    for (u64 record_idx = 0; record_idx < merged_count; ++record_idx) {
+        u32 record_size{};
+        merged_reader.Read(reinterpret_cast<char *>(&record_size), sizeof(record_size));
+        record.resize(record_size);
+        merged_reader.Read(record.data(), record_size);
+        u32 run_idx = ReadBigEndian(record.data() + record_size - sizeof(u32) * 2);
+        u32 row_idx = ReadBigEndian(record.data() + record_size - sizeof(u32));
+        SpillRunReader *run_reader = run_readers[run_idx].get();
+        if (!run_reader->Contains(row_idx)) {
+            // The pending rows may be in the block to be released.
+            appender.Flush();
+            run_reader->Load(row_idx);
+        }
+        appender.Append(run_reader->block(), row_idx - run_reader->block_start());
+    }
+    appender.Finish();
+}
 
 } // namespace infinity
@@ -22,21 +22,30 @@ import query_context;
 import operator_state;
 import physical_operator;
 import physical_operator_type;
+import base_expression;
+import base_table_ref;
 import load_meta;
 import infinity_exception;
 import internal_types;
+import select_statement;
 import data_type;
+import sort_key;
+import data_block;
 
 namespace infinity {
 
+// Merge the sorted runs of the parallel sort tasks with a k-way merge on the binary sort keys.
+// The runs are spilled when the cached runs exceed the query memory limit, and the spilled runs are merged by the external sort merger.
 export class PhysicalMergeSort final : public PhysicalOperator {
 public:
-    explicit PhysicalMergeSort(SharedPtr<Vector<String>> output_names,
-                               SharedPtr<Vector<SharedPtr<DataType>>> output_types,
-                               u64 id,
+    explicit PhysicalMergeSort(u64 id,
+                               SharedPtr<BaseTableRef> base_table_ref,
+                               UniquePtr<PhysicalOperator> left,
+                               Vector<SharedPtr<BaseExpression>> sort_expressions,
+                               Vector<OrderType> order_by_types,
                                SharedPtr<Vector<LoadMeta>> load_metas)
-        : PhysicalOperator(PhysicalOperatorType::kMergeSort, nullptr, nullptr, id, load_metas), output_names_(std::move(output_names)),
-          output_types_(std::move(output_types)) {}
+        : PhysicalOperator(PhysicalOperatorType::kMergeSort, std::move(left), nullptr, id, load_metas), base_table_ref_(std::move(base_table_ref)),
+          order_by_types_(std::move(order_by_types)), sort_expressions_(std::move(sort_expressions)) {}
 
     ~PhysicalMergeSort() override = default;
 
@@ -44,18 +53,36 @@ public:
 
     bool Execute(QueryContext *query_context, OperatorState *operator_state) final;
 
-    inline SharedPtr<Vector<String>> GetOutputNames() const final { return output_names_; }
+    inline SharedPtr<Vector<String>> GetOutputNames() const final { return PhysicalCommonFunctionUsingLoadMeta::GetOutputNames(*this); }
 
-    inline SharedPtr<Vector<SharedPtr<DataType>>> GetOutputTypes() const final { return output_types_; }
+    inline SharedPtr<Vector<SharedPtr<DataType>>> GetOutputTypes() const final { return PhysicalCommonFunctionUsingLoadMeta::GetOutputTypes(*this); }
 
-    SizeT TaskletCount() override {
-        UnrecoverableError("Not implement: TaskletCount not Implement");
-        return 0;
+    SizeT TaskletCount() override { return left_->TaskletCount(); }
+
+    // for OperatorState and Explain
+    inline auto const &GetSortExpressions() const { return sort_expressions_; }
+
+    // for Explain
+    inline auto const &GetOrderbyTypes() const { return order_by_types_; }
+
+    // for InputLoad
+    // necessary because MergeSort may be the first operator in a pipeline
+    void FillingTableRefs(HashMap<SizeT, SharedPtr<BaseTableRef>> &table_refs) override {
+        table_refs.insert({base_table_ref_->table_index_, base_table_ref_});
     }
 
 private:
-    SharedPtr<Vector<String>> output_names_{};
-    SharedPtr<Vector<SharedPtr<DataType>>> output_types_{};
+    // Keys of the rows of each block in the run, one SortKeys for the whole run.
+    SortKeys EncodeRunKeys(MergeSortOperatorState *merge_sort_state, const Vector<UniquePtr<DataBlock>> &run) const;
+
+    void SpillRuns(QueryContext *query_context, MergeSortOperatorState *merge_sort_state) const;
+
+    void MergeSpilledRuns(QueryContext *query_context, MergeSortOperatorState *merge_sort_state) const;
+
+    SharedPtr<BaseTableRef> base_table_ref_;             // necessary for InputLoad
+    Vector<OrderType> order_by_types_;                   // ASC or DESC
+    Vector<SharedPtr<BaseExpression>> sort_expressions_; // expressions to sort
+    UniquePtr<SortKeyEncoder> sort_key_encoder_{};
 };
 
 } // namespace infinity
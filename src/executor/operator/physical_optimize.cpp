@@ -31,12 +31,14 @@ import logger;
 import base_table_ref;
 import table_index_meta;
 import table_entry;
+import io_stats;
 
 namespace infinity {
 
 void PhysicalOptimize::Init() {}
 
 bool PhysicalOptimize::Execute(QueryContext *query_context, OperatorState *operator_state) {
+    IOPurposeScope io_purpose_scope(IOPurpose::kIndexBuild);
     OptimizeIndex(query_context, operator_state);
     operator_state->SetComplete();
     return true;
@@ -14,15 +14,73 @@
 
 module;
 
+module physical_parallel_aggregate;
+
+import stl;
 import query_context;
 import operator_state;
-
-module physical_parallel_aggregate;
+import aggregate_hash_table;
+import query_memory_tracker;
+import base_expression;
+import data_block;
+import internal_types;
+import data_type;
 
 namespace infinity {
 
 void PhysicalParallelAggregate::Init() {}
 
-bool PhysicalParallelAggregate::Execute(QueryContext *, OperatorState *) { return true; }
+bool PhysicalParallelAggregate::Execute(QueryContext *query_context, OperatorState *operator_state) {
+    auto *parallel_aggregate_state = static_cast<ParallelAggregateOperatorState *>(operator_state);
+    if (parallel_aggregate_state->hash_table_.get() == nullptr) {
+        parallel_aggregate_state->hash_table_ = MakeUnique<AggregateHashTable>(groups_, aggregates_);
+    }
+
+    OperatorState *prev_op_state = operator_state->prev_op_state_;
+    for (const auto &input_block : prev_op_state->data_block_array_) {
+        parallel_aggregate_state->hash_table_->Update(input_block.get());
+    }
+    prev_op_state->data_block_array_.clear();
+    parallel_aggregate_state->memory_reservation_.Init(query_context->memory_tracker());
+    parallel_aggregate_state->memory_reservation_.ResizeOrFail(parallel_aggregate_state->hash_table_->MemoryUsage(),
+                                                               "Parallel aggregate hash table");
+    if (!prev_op_state->Complete()) {
+        return false;
+    }
+
+    // All input of this task is aggregated, output the partial results by partition.
+    parallel_aggregate_state->hash_table_->FinalizePartitions(*GetOutputTypes(),
+                                                              partition_count_,
+                                                              parallel_aggregate_state->data_block_array_,
+                                                              parallel_aggregate_state->partition_ids_);
+    parallel_aggregate_state->hash_table_.reset();
+    parallel_aggregate_state->memory_reservation_.Resize(0);
+    parallel_aggregate_state->SetComplete();
+    return true;
+}
+
+SharedPtr<Vector<String>> PhysicalParallelAggregate::GetOutputNames() const {
+    SharedPtr<Vector<String>> result = MakeShared<Vector<String>>();
+    result->reserve(groups_.size() + aggregates_.size());
+    for (const auto &group : groups_) {
+        result->emplace_back(group->Name());
+    }
+    for (const auto &aggregate : aggregates_) {
+        result->emplace_back(aggregate->Name());
+    }
+    return result;
+}
+
+SharedPtr<Vector<SharedPtr<DataType>>> PhysicalParallelAggregate::GetOutputTypes() const {
+    SharedPtr<Vector<SharedPtr<DataType>>> result = MakeShared<Vector<SharedPtr<DataType>>>();
+    result->reserve(groups_.size() + aggregates_.size());
+    for (const auto &group : groups_) {
+        result->emplace_back(MakeShared<DataType>(group->Type()));
+    }
+    for (const auto &aggregate : aggregates_) {
+        result->emplace_back(MakeShared<DataType>(aggregate->Type()));
+    }
+    return result;
+}
 
 } // namespace infinity
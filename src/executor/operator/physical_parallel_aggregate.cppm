@@ -30,14 +30,22 @@ import data_type;
 
 namespace infinity {
 
+// First phase of the two-phase group by aggregate.
+// Each task aggregates its own input into a thread local hash table. When the input of the task is done, the partial results
+// are partitioned by the hash of the group by keys, partition i is merged by the task i of PhysicalMergeParallelAggregate.
+// The output is the group by keys followed by the partial result of each aggregate.
 export class PhysicalParallelAggregate final : public PhysicalOperator {
 public:
-    explicit PhysicalParallelAggregate(SharedPtr<Vector<String>> output_names,
-                                       SharedPtr<Vector<SharedPtr<DataType>>> output_types,
-                                       u64 id,
+    explicit PhysicalParallelAggregate(u64 id,
+                                       UniquePtr<PhysicalOperator> left,
+                                       Vector<SharedPtr<BaseExpression>> groups,
+                                       u64 groupby_index,
+                                       Vector<SharedPtr<BaseExpression>> aggregates,
+                                       u64 aggregate_index,
+                                       SizeT partition_count,
                                        SharedPtr<Vector<LoadMeta>> load_metas)
-        : PhysicalOperator(PhysicalOperatorType::kParallelAggregate, nullptr, nullptr, id, load_metas), output_names_(std::move(output_names)),
-          output_types_(std::move(output_types)) {}
+        : PhysicalOperator(PhysicalOperatorType::kParallelAggregate, std::move(left), nullptr, id, load_metas), groups_(std::move(groups)),
+          aggregates_(std::move(aggregates)), groupby_index_(groupby_index), aggregate_index_(aggregate_index), partition_count_(partition_count) {}
 
     ~PhysicalParallelAggregate() override = default;
 
@@ -45,18 +53,25 @@ public:
 
     bool Execute(QueryContext *query_context, OperatorState *operator_state) final;
 
-    inline SharedPtr<Vector<String>> GetOutputNames() const final { return output_names_; }
+    SharedPtr<Vector<String>> GetOutputNames() const final;
 
-    inline SharedPtr<Vector<SharedPtr<DataType>>> GetOutputTypes() const final { return output_types_; }
+    SharedPtr<Vector<SharedPtr<DataType>>> GetOutputTypes() const final;
 
-    SizeT TaskletCount() override {
-        UnrecoverableError("Not implement: TaskletCount not Implement");
-        return 0;
-    }
+    SizeT TaskletCount() override { return left_->TaskletCount(); }
+
+    inline u64 GroupTableIndex() const { return groupby_index_; }
+
+    inline u64 AggregateTableIndex() const { return aggregate_index_; }
+
+    inline SizeT PartitionCount() const { return partition_count_; }
+
+    Vector<SharedPtr<BaseExpression>> groups_{};
+    Vector<SharedPtr<BaseExpression>> aggregates_{};
 
 private:
-    SharedPtr<Vector<String>> output_names_{};
-    SharedPtr<Vector<SharedPtr<DataType>>> output_types_{};
+    u64 groupby_index_{};
+    u64 aggregate_index_{};
+    SizeT partition_count_{};
 };
 
 } // namespace infinity
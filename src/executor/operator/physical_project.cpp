@@ -23,8 +23,15 @@ import data_table;
 import operator_state;
 import expression_evaluator;
 import expression_state;
+import fused_expression;
 import data_block;
 import column_vector;
+import base_expression;
+import reference_expression;
+import expression_type;
+import data_type;
+import logical_type;
+import default_values;
 
 import infinity_exception;
 
@@ -57,15 +64,7 @@ bool PhysicalProject::Execute(QueryContext *, OperatorState *operator_state) {
         evaluator.Init(nullptr);
 
         SizeT expression_count = expressions_.size();
-
-        // Prepare the expression states
-        Vector<SharedPtr<ExpressionState>> expr_states;
-        expr_states.reserve(expression_count);
-
-        for (const auto &expr : expressions_) {
-            // expression state
-            expr_states.emplace_back(ExpressionState::CreateState(expr));
-        }
+        Vector<SharedPtr<ExpressionState>> &expr_states = project_operator_state->expr_states_;
 
         for (SizeT expr_idx = 0; expr_idx < expression_count; ++expr_idx) {
             //        Vector<SharedPtr<ColumnVector>> blocks_column;
@@ -77,34 +76,64 @@ bool PhysicalProject::Execute(QueryContext *, OperatorState *operator_state) {
     } else {
         OperatorState* prev_op_state = operator_state->prev_op_state_;
 
+        bool reference_only = true;
+        for (const auto &expr : expressions_) {
+            reference_only = reference_only && expr->type() == ExpressionType::kReference;
+        }
+
         SizeT input_block_count = prev_op_state->data_block_array_.size();
         for(SizeT block_idx = 0; block_idx < input_block_count; ++ block_idx) {
             DataBlock* input_data_block = prev_op_state->data_block_array_[block_idx].get();
 
             project_operator_state->data_block_array_.emplace_back(DataBlock::MakeUniquePtr());
             DataBlock* output_data_block = project_operator_state->data_block_array_.back().get();
-            output_data_block->Init(*GetOutputTypes());
+
+            if (input_data_block->HasSelection() && reference_only && project_operator_state->keep_selection_) {
+                // Only pick the columns, the selection is passed to the next operator without copying any row.
+                Vector<SharedPtr<ColumnVector>> column_vectors;
+                column_vectors.reserve(expressions_.size());
+                for (const auto &expr : expressions_) {
+                    column_vectors.emplace_back(input_data_block->column_vectors[static_cast<ReferenceExpression *>(expr.get())->column_index()]);
+                }
+                output_data_block->InitWithSelection(column_vectors, input_data_block->selection());
+                continue;
+            }
 
             ExpressionEvaluator evaluator;
             evaluator.Init(input_data_block);
 
             SizeT expression_count = expressions_.size();
-
-            // Prepare the expression states
-            Vector<SharedPtr<ExpressionState>> expr_states;
-            expr_states.reserve(expression_count);
-
-            for (const auto &expr : expressions_) {
-                // expression state
-                expr_states.emplace_back(ExpressionState::CreateState(expr));
+            Vector<SharedPtr<ExpressionState>> &expr_states = project_operator_state->expr_states_;
+            // The intermediate outputs of the last block are emptied, not allocated again
+            for (auto &expr_state : expr_states) {
+                expr_state->ResetOutputs();
+            }
+            Vector<SharedPtr<FusedExpression>> &fused_expressions = project_operator_state->fused_expressions_;
+            if (project_operator_state->evaluated_block_count_++ == FUSED_EXPRESSION_MIN_BLOCKS) {
+                fused_expressions.reserve(expression_count);
+                for (const auto &expr : expressions_) {
+                    fused_expressions.emplace_back(FusedExpression::Get(expr));
+                }
             }
 
+            // A column reference takes the input column itself, only the computed columns are allocated
+            Vector<SharedPtr<ColumnVector>> column_vectors(expression_count);
             for (SizeT expr_idx = 0; expr_idx < expression_count; ++expr_idx) {
-                //        Vector<SharedPtr<ColumnVector>> blocks_column;
-                //        blocks_column.emplace_back(output_data_block->column_vectors[expr_idx]);
-                evaluator.Execute(expressions_[expr_idx], expr_states[expr_idx], output_data_block->column_vectors[expr_idx]);
+                const SharedPtr<BaseExpression> &expr = expressions_[expr_idx];
+                if (expr->type() != ExpressionType::kReference) {
+                    column_vectors[expr_idx] = MakeShared<ColumnVector>(MakeShared<DataType>(expr->Type()));
+                    auto column_vector_type =
+                        (expr->Type().type() == LogicalType::kBoolean) ? ColumnVectorType::kCompactBit : ColumnVectorType::kFlat;
+                    column_vectors[expr_idx]->Initialize(column_vector_type, DEFAULT_VECTOR_SIZE);
+                    // the interpreter takes the blocks with a null or an overflow
+                    if (!fused_expressions.empty() && fused_expressions[expr_idx].get() != nullptr &&
+                        fused_expressions[expr_idx]->Execute(*input_data_block, *column_vectors[expr_idx])) {
+                        continue;
+                    }
+                }
+                evaluator.Execute(expr, expr_states[expr_idx], column_vectors[expr_idx]);
             }
-            output_data_block->Finalize();
+            output_data_block->Init(column_vectors);
         }
 
 
@@ -51,12 +51,17 @@ import local_file_system;
 import utility;
 import buffer_manager;
 import session_manager;
+import query_progress;
+import physical_operator_type;
 import compilation_config;
 import logical_type;
 import create_index_info;
 import segment_index_entry;
 import segment_iter;
 import segment_entry;
+import index_build_progress;
+import io_stats;
+import background_process;
 
 namespace infinity {
 
@@ -206,6 +211,49 @@ void PhysicalShow::Init() {
             output_types_->emplace_back(varchar_type);
             break;
         }
+        case ShowType::kShowSlowQueries: {
+            output_names_->reserve(14);
+            output_types_->reserve(14);
+
+            output_names_->emplace_back("record_no");
+            output_names_->emplace_back("session_id");
+            output_names_->emplace_back("reason");
+            output_names_->emplace_back("query");
+            output_names_->emplace_back("command parsing");
+            output_names_->emplace_back("logical plan building");
+            output_names_->emplace_back("plan optimizing");
+            output_names_->emplace_back("physical plan building");
+            output_names_->emplace_back("pipeline building");
+            output_names_->emplace_back("task building");
+            output_names_->emplace_back("execution");
+            output_names_->emplace_back("commit");
+            output_names_->emplace_back("rollback");
+            output_names_->emplace_back("total_cost");
+
+            for (SizeT i = 0; i < 14; ++i) {
+                output_types_->emplace_back(varchar_type);
+            }
+            break;
+        }
+        case ShowType::kShowQueries: {
+            output_names_->reserve(9);
+            output_types_->reserve(9);
+
+            output_names_->emplace_back("query_id");
+            output_names_->emplace_back("session_id");
+            output_names_->emplace_back("elapsed");
+            output_names_->emplace_back("fragments");
+            output_names_->emplace_back("tasks");
+            output_names_->emplace_back("rows_scanned");
+            output_names_->emplace_back("memory");
+            output_names_->emplace_back("operator");
+            output_names_->emplace_back("query");
+
+            for (SizeT i = 0; i < 9; ++i) {
+                output_types_->emplace_back(varchar_type);
+            }
+            break;
+        }
         case ShowType::kShowSegments: {
             output_names_->reserve(3);
             output_types_->reserve(3);
@@ -361,6 +409,14 @@ bool PhysicalShow::Execute(QueryContext *query_context, OperatorState *operator_
             ExecuteShowProfiles(query_context, show_operator_state);
             break;
         }
+        case ShowType::kShowSlowQueries: {
+            ExecuteShowSlowQueries(query_context, show_operator_state);
+            break;
+        }
+        case ShowType::kShowQueries: {
+            ExecuteShowQueries(query_context, show_operator_state);
+            break;
+        }
         case ShowType::kShowSegments: {
             ExecuteShowSegments(query_context, show_operator_state);
             break;
@@ -595,6 +651,34 @@ void PhysicalShow::ExecuteShowTable(QueryContext *query_context, ShowOperatorSta
         }
     }
 
+    // the io of the files of the table and its indexes since the start, by all purposes
+    auto average_latency = [](const IOStatsInfo &io_info) {
+        return fmt::format("{}us", io_info.ops_ == 0 ? 0 : io_info.duration_us_ / io_info.ops_);
+    };
+    Vector<Pair<String, String>> io_rows = {
+        {"io_read_bytes", Utility::FormatByteSize(table_info->io_read_.bytes_)},
+        {"io_read_ops", std::to_string(table_info->io_read_.ops_)},
+        {"io_read_avg_latency", average_latency(table_info->io_read_)},
+        {"io_write_bytes", Utility::FormatByteSize(table_info->io_write_.bytes_)},
+        {"io_write_ops", std::to_string(table_info->io_write_.ops_)},
+        {"io_write_avg_latency", average_latency(table_info->io_write_)},
+    };
+    for (const auto &[name, io_value] : io_rows) {
+        SizeT column_id = 0;
+        {
+            Value value = Value::MakeVarchar(name);
+            ValueExpression value_expr(value);
+            value_expr.AppendToChunk(output_block_ptr->column_vectors[column_id]);
+        }
+
+        ++column_id;
+        {
+            Value value = Value::MakeVarchar(io_value);
+            ValueExpression value_expr(value);
+            value_expr.AppendToChunk(output_block_ptr->column_vectors[column_id]);
+        }
+    }
+
     output_block_ptr->Finalize();
     show_operator_state->output_.emplace_back(std::move(output_block_ptr));
 }
@@ -607,11 +691,7 @@ void PhysicalShow::ExecuteShowIndex(QueryContext *query_context, ShowOperatorSta
     Txn *txn = query_context->GetTxn();
 
     auto [table_index_info, status] = txn->GetTableIndexInfo(db_name_, object_name_, index_name_.value());
-
-    if (!status.ok()) {
-        RecoverableError(status);
-        return;
-    }
+    Vector<IndexBuildProgressInfo> builds = IndexBuildRegistry::instance().Builds(db_name_, object_name_, index_name_.value());
 
     // Prepare the output data block
     UniquePtr<DataBlock> output_block_ptr = DataBlock::MakeUniquePtr();
@@ -619,6 +699,52 @@ void PhysicalShow::ExecuteShowIndex(QueryContext *query_context, ShowOperatorSta
 
     output_block_ptr->Init(column_types);
 
+    auto append_rows = [&](const Vector<Pair<String, String>> &rows) {
+        for (const auto &[name, row_value] : rows) {
+            SizeT column_id = 0;
+            {
+                Value value = Value::MakeVarchar(name);
+                ValueExpression value_expr(value);
+                value_expr.AppendToChunk(output_block_ptr->column_vectors[column_id]);
+            }
+
+            ++column_id;
+            {
+                Value value = Value::MakeVarchar(row_value);
+                ValueExpression value_expr(value);
+                value_expr.AppendToChunk(output_block_ptr->column_vectors[column_id]);
+            }
+        }
+    };
+    // The progress of CREATE INDEX or OPTIMIZE on the index, ETA is the remaining rows at the rate so far
+    auto append_build_rows = [&]() {
+        for (const IndexBuildProgressInfo &build : builds) {
+            f64 percent = build.rows_total_ == 0 ? 100 : 100.0 * build.rows_done_ / build.rows_total_;
+            append_rows({
+                {"build_phase", IndexBuildPhaseToString(build.phase_)},
+                {"build_rows", fmt::format("{}/{} ({:.1f}%)", build.rows_done_, build.rows_total_, percent)},
+                {"build_segments", fmt::format("{}/{}", build.segments_done_, build.segments_total_)},
+                {"build_current_segment", build.current_segment_ < 0 ? "" : std::to_string(build.current_segment_)},
+                {"build_elapsed", BaseProfiler::ElapsedToString(NanoSeconds(build.elapsed_ns_))},
+                {"build_rows_per_second", fmt::format("{:.0f}", build.rows_per_second_)},
+                {"build_eta", build.eta_ns_ < 0 ? "unknown" : BaseProfiler::ElapsedToString(NanoSeconds(build.eta_ns_))},
+            });
+        }
+    };
+
+    if (!status.ok()) {
+        // The index being created is not visible to the other txns until it's committed, only its build progress is.
+        if (builds.empty()) {
+            RecoverableError(status);
+            return;
+        }
+        append_rows({{"database_name", db_name_}, {"table_name", object_name_}, {"index_name", index_name_.value()}});
+        append_build_rows();
+        output_block_ptr->Finalize();
+        show_operator_state->output_.emplace_back(std::move(output_block_ptr));
+        return;
+    }
+
     {
         SizeT column_id = 0;
         {
@@ -763,6 +889,21 @@ void PhysicalShow::ExecuteShowIndex(QueryContext *query_context, ShowOperatorSta
         }
     }
 
+    if (*table_index_info->index_type_ == IndexInfo::IndexTypeToString(IndexType::kSecondary)) {
+        // the error bounds of the PGM indexes are chosen per segment, a lookup searches pgm_levels levels of segments, then up to
+        // 2 * epsilon + 2 keys
+        const u32 min_epsilon = table_index_info->pgm_min_epsilon_;
+        const u32 max_epsilon = table_index_info->pgm_max_epsilon_;
+        Vector<Pair<String, String>> pgm_rows = {
+            {"pgm_epsilon", min_epsilon == max_epsilon ? std::to_string(max_epsilon) : fmt::format("{}~{}", min_epsilon, max_epsilon)},
+            {"pgm_levels", std::to_string(table_index_info->pgm_height_)},
+            {"pgm_lookup_keys", std::to_string(max_epsilon == 0 ? 0 : 2 * max_epsilon + 2)},
+            {"pgm_size", Utility::FormatByteSize(table_index_info->pgm_size_)},
+        };
+        append_rows(pgm_rows);
+    }
+    append_build_rows();
+
     output_block_ptr->Finalize();
     show_operator_state->output_.emplace_back(std::move(output_block_ptr));
 }
@@ -1067,6 +1208,73 @@ void PhysicalShow::ExecuteShowProfiles(QueryContext *query_context, ShowOperator
     show_operator_state->output_.emplace_back(std::move(output_block_ptr));
 }
 
+void PhysicalShow::ExecuteShowSlowQueries(QueryContext *query_context, ShowOperatorState *show_operator_state) {
+    auto varchar_type = MakeShared<DataType>(LogicalType::kVarchar);
+
+    UniquePtr<DataBlock> output_block_ptr = DataBlock::MakeUniquePtr();
+    Vector<SharedPtr<DataType>> column_types(output_types_->size(), varchar_type);
+    output_block_ptr->Init(column_types);
+
+    Vector<SlowQueryRecord> records = query_context->session_manager()->slow_query_log().GetRecords();
+    for (SizeT i = 0; i < records.size(); ++i) {
+        const SlowQueryRecord &record = records[i];
+        SizeT column_id = 0;
+
+        ValueExpression record_no_expr(Value::MakeVarchar(fmt::format("{}", i)));
+        record_no_expr.AppendToChunk(output_block_ptr->column_vectors[column_id++]);
+
+        ValueExpression session_id_expr(Value::MakeVarchar(fmt::format("{}", record.session_id_)));
+        session_id_expr.AppendToChunk(output_block_ptr->column_vectors[column_id++]);
+
+        ValueExpression reason_expr(Value::MakeVarchar(String(record.slow_ ? "slow" : "sampled")));
+        reason_expr.AppendToChunk(output_block_ptr->column_vectors[column_id++]);
+
+        ValueExpression query_expr(Value::MakeVarchar(record.query_text_));
+        query_expr.AppendToChunk(output_block_ptr->column_vectors[column_id++]);
+
+        for (SizeT phase_idx = 0; phase_idx < QUERY_PHASE_COUNT; ++phase_idx) {
+            NanoSeconds duration(record.phase_ns_[phase_idx]);
+            ValueExpression phase_cost_expr(Value::MakeVarchar(BaseProfiler::ElapsedToString(duration)));
+            phase_cost_expr.AppendToChunk(output_block_ptr->column_vectors[column_id++]);
+        }
+
+        NanoSeconds total_duration(record.duration_ns_);
+        ValueExpression total_cost_expr(Value::MakeVarchar(BaseProfiler::ElapsedToString(total_duration)));
+        total_cost_expr.AppendToChunk(output_block_ptr->column_vectors[column_id++]);
+    }
+    output_block_ptr->Finalize();
+    show_operator_state->output_.emplace_back(std::move(output_block_ptr));
+}
+
+void PhysicalShow::ExecuteShowQueries(QueryContext *query_context, ShowOperatorState *show_operator_state) {
+    auto varchar_type = MakeShared<DataType>(LogicalType::kVarchar);
+
+    UniquePtr<DataBlock> output_block_ptr = DataBlock::MakeUniquePtr();
+    Vector<SharedPtr<DataType>> column_types(output_types_->size(), varchar_type);
+    output_block_ptr->Init(column_types);
+
+    Vector<QueryProgressInfo> queries = query_context->session_manager()->RunningQueries();
+    for (const QueryProgressInfo &query : queries) {
+        Vector<String> values{
+            fmt::format("{}", query.query_id_),
+            fmt::format("{}", query.session_id_),
+            BaseProfiler::ElapsedToString(NanoSeconds(query.elapsed_ns_)),
+            fmt::format("{}/{}", query.fragments_done_, query.fragments_total_),
+            fmt::format("{}/{}", query.tasks_done_, query.tasks_total_),
+            fmt::format("{}", query.rows_scanned_),
+            Utility::FormatByteSize(std::max(query.memory_bytes_, i64(0))),
+            query.current_operator_ == PhysicalOperatorType::kInvalid ? String() : PhysicalOperatorToString(query.current_operator_),
+            query.query_text_,
+        };
+        for (SizeT column_id = 0; column_id < values.size(); ++column_id) {
+            ValueExpression value_expr(Value::MakeVarchar(values[column_id]));
+            value_expr.AppendToChunk(output_block_ptr->column_vectors[column_id]);
+        }
+    }
+    output_block_ptr->Finalize();
+    show_operator_state->output_.emplace_back(std::move(output_block_ptr));
+}
+
 /**
  * @brief Execute Show table details statement (i.e. show t1)
  * @param query_context
@@ -2380,6 +2588,18 @@ void PhysicalShow::ExecuteShowVar(QueryContext *query_context, ShowOperatorState
                     UnrecoverableError("Invalid log flush policy: {}");
                 }
             }
+            break;
+        }
+        case SysVar::kBackgroundTaskQueue: {
+            // The waiting tasks of each lane, e.g. "checkpoint: 0, compaction: 2, index build: 0, cleanup: 0".
+            String queue_lengths;
+            for (const auto &[lane, queue_length] : query_context->storage()->bg_processor()->QueueLengths()) {
+                queue_lengths += fmt::format("{}{}: {}", queue_lengths.empty() ? "" : ", ", BGTaskLaneToString(lane), queue_length);
+            }
+            Value value = Value::MakeVarchar(queue_lengths);
+            ValueExpression value_expr(value);
+            value_expr.AppendToChunk(output_block_ptr->column_vectors[0]);
+            break;
         }
         default: {
             RecoverableError(Status::NoSysVar(object_name_));
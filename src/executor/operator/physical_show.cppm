@@ -98,6 +98,10 @@ private:
 
     void ExecuteShowProfiles(QueryContext *query_context, ShowOperatorState *operator_state);
 
+    void ExecuteShowSlowQueries(QueryContext *query_context, ShowOperatorState *operator_state);
+
+    void ExecuteShowQueries(QueryContext *query_context, ShowOperatorState *operator_state);
+
     void ExecuteShowConfigs(QueryContext *query_context, ShowOperatorState *operator_state);
 
     void ExecuteShowSessionStatus(QueryContext *query_context, ShowOperatorState *operator_state);
@@ -32,6 +32,7 @@ import infinity_exception;
 import logger;
 import logical_type;
 import column_def;
+import join_runtime_filter;
 
 namespace infinity {
 
@@ -40,6 +41,14 @@ void PhysicalSink::Init() {}
 bool PhysicalSink::Execute(QueryContext *, OperatorState *) { return true; }
 
 bool PhysicalSink::Execute(QueryContext *, FragmentContext *fragment_context, SinkState *sink_state) {
+    if (sink_state->prev_op_state_ != nullptr) {
+        // Blocks with a selection are only passed inside the fragment, the sink copies the selected rows.
+        for (auto &data_block : sink_state->prev_op_state_->data_block_array_) {
+            if (data_block.get() != nullptr) {
+                data_block->Materialize();
+            }
+        }
+    }
     switch (sink_state->state_type_) {
         case SinkStateType::kInvalid: {
             UnrecoverableError("Invalid sinker type");
@@ -163,6 +172,22 @@ void PhysicalSink::FillSinkStateFromLastOperatorState(MaterializeSinkState *mate
             }
             break;
         }
+        case PhysicalOperatorType::kUnionAll: {
+            auto *union_all_output_state = static_cast<UnionAllOperatorState *>(task_op_state);
+            for (auto &data_block : union_all_output_state->data_block_array_) {
+                materialize_sink_state->data_block_array_.emplace_back(std::move(data_block));
+            }
+            union_all_output_state->data_block_array_.clear();
+            break;
+        }
+        case PhysicalOperatorType::kMergeParallelAggregate: {
+            auto *merge_agg_output_state = static_cast<MergeParallelAggregateOperatorState *>(task_op_state);
+            for (auto &data_block : merge_agg_output_state->data_block_array_) {
+                materialize_sink_state->data_block_array_.emplace_back(std::move(data_block));
+            }
+            merge_agg_output_state->data_block_array_.clear();
+            break;
+        }
         default: {
             RecoverableError(Status::NotSupport(fmt::format("{} isn't supported here.", PhysicalOperatorToString(task_op_state->operator_type_))));
         }
@@ -360,6 +385,14 @@ void PhysicalSink::FillSinkStateFromLastOperatorState(MessageSinkState *message_
             message_sink_state->message_ = std::move(insert_output_state->result_msg_);
             break;
         }
+        case PhysicalOperatorType::kExport: {
+            // Only the last task of the export has the message, the sink may be called before it's set.
+            auto *export_output_state = static_cast<ExportOperatorState *>(task_operator_state);
+            if (export_output_state->result_msg_.get() != nullptr) {
+                message_sink_state->message_ = std::move(export_output_state->result_msg_);
+            }
+            break;
+        }
         case PhysicalOperatorType::kCreateIndexPrepare: {
             auto *create_index_prepare_output_state = static_cast<CreateIndexPrepareOperatorState *>(task_operator_state);
             message_sink_state->message_ = std::move(create_index_prepare_output_state->result_msg_);
@@ -396,15 +429,38 @@ void PhysicalSink::FillSinkStateFromLastOperatorState(FragmentContext *fragment_
         LOG_TRACE("Task not completed");
         return;
     }
+    if (task_operator_state->operator_type_ == PhysicalOperatorType::kParallelAggregate) {
+        FillPartitionedQueues(queue_sink_state, static_cast<ParallelAggregateOperatorState *>(task_operator_state));
+        return;
+    }
     SizeT output_data_block_count = task_operator_state->data_block_array_.size();
+    if (output_data_block_count == 0) {
+        if (task_operator_state->Complete()) {
+            // The last execution of a stream task or a materialized task on empty input may output nothing,
+            // still tell next fragment this task is completed.
+            auto fragment_none = MakeShared<FragmentNone>(queue_sink_state->fragment_id_);
+            for (const auto &next_fragment_queue : queue_sink_state->fragment_data_queues_) {
+                next_fragment_queue->Enqueue(fragment_none);
+            }
+        }
+        return;
+    }
     for (SizeT idx = 0; idx < output_data_block_count; ++idx) {
+        if (runtime_filter_.get() != nullptr) {
+            runtime_filter_->AddBuildBlock(*task_operator_state->data_block_array_[idx]);
+        }
         auto fragment_data = MakeShared<FragmentData>(queue_sink_state->fragment_id_,
                                                       std::move(task_operator_state->data_block_array_[idx]),
                                                       queue_sink_state->task_id_,
                                                       idx,
                                                       output_data_block_count);
-        if (task_operator_state->Complete() && !fragment_context->IsMaterialize()) {
-            fragment_data->data_idx_ = None;
+        if (!fragment_context->IsMaterialize()) {
+            // Stream task outputs data batch by batch, only the last block of the last batch completes the task.
+            if (!task_operator_state->Complete()) {
+                fragment_data->data_count_ = std::numeric_limits<SizeT>::max();
+            } else if (idx + 1 == output_data_block_count) {
+                fragment_data->data_idx_ = None;
+            }
         }
 
         for (const auto &next_fragment_queue : queue_sink_state->fragment_data_queues_) {
@@ -419,4 +475,34 @@ void PhysicalSink::FillSinkStateFromLastOperatorState(FragmentContext *fragment_
     task_operator_state->data_block_array_.clear();
 }
 
+void PhysicalSink::FillPartitionedQueues(QueueSinkState *queue_sink_state, ParallelAggregateOperatorState *parallel_aggregate_state) {
+    if (!parallel_aggregate_state->Complete()) {
+        return;
+    }
+    // The partial results are only sent once when the task is completed. Partition i goes to the task (i % task count) of
+    // the merge fragment, every merge task gets one completed message from each parallel aggregate task.
+    SizeT queue_count = queue_sink_state->fragment_data_queues_.size();
+    Vector<Vector<SizeT>> queue_blocks(queue_count);
+    for (SizeT block_idx = 0; block_idx < parallel_aggregate_state->data_block_array_.size(); ++block_idx) {
+        queue_blocks[parallel_aggregate_state->partition_ids_[block_idx] % queue_count].emplace_back(block_idx);
+    }
+    for (SizeT queue_idx = 0; queue_idx < queue_count; ++queue_idx) {
+        auto *next_fragment_queue = queue_sink_state->fragment_data_queues_[queue_idx];
+        const Vector<SizeT> &block_indexes = queue_blocks[queue_idx];
+        if (block_indexes.empty()) {
+            next_fragment_queue->Enqueue(MakeShared<FragmentNone>(queue_sink_state->fragment_id_));
+            continue;
+        }
+        for (SizeT idx = 0; idx < block_indexes.size(); ++idx) {
+            next_fragment_queue->Enqueue(MakeShared<FragmentData>(queue_sink_state->fragment_id_,
+                                                                  std::move(parallel_aggregate_state->data_block_array_[block_indexes[idx]]),
+                                                                  queue_sink_state->task_id_,
+                                                                  idx,
+                                                                  block_indexes.size()));
+        }
+    }
+    parallel_aggregate_state->data_block_array_.clear();
+    parallel_aggregate_state->partition_ids_.clear();
+}
+
 } // namespace infinity
@@ -26,6 +26,7 @@ import load_meta;
 import infinity_exception;
 import internal_types;
 import data_type;
+import join_runtime_filter;
 
 namespace infinity {
 
@@ -63,6 +64,9 @@ public:
 
     inline SinkType sink_type() const { return type_; }
 
+    // the sink of the build fragment of a hash join adds the output blocks to the runtime filter of the join
+    inline void SetRuntimeFilter(SharedPtr<JoinRuntimeFilter> runtime_filter) { runtime_filter_ = std::move(runtime_filter); }
+
 private:
     void FillSinkStateFromLastOperatorState(MaterializeSinkState *materialize_sink_state, OperatorState *task_operator_state);
 
@@ -74,10 +78,14 @@ private:
 
     void FillSinkStateFromLastOperatorState(FragmentContext *fragment_context, QueueSinkState *queue_sink_state, OperatorState *task_operator_state);
 
+    // Send each partition of the partial aggregate results only to the merge task of the partition.
+    static void FillPartitionedQueues(QueueSinkState *queue_sink_state, ParallelAggregateOperatorState *parallel_aggregate_state);
+
 private:
     SharedPtr<Vector<String>> output_names_{};
     SharedPtr<Vector<SharedPtr<DataType>>> output_types_{};
     SinkType type_{SinkType::kInvalid};
+    SharedPtr<JoinRuntimeFilter> runtime_filter_{};
 };
 
 } // namespace infinity
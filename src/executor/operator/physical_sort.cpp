@@ -14,6 +14,7 @@
 
 module;
 
+#include <numeric>
 #include <string>
 
 module physical_sort;
@@ -37,6 +38,9 @@ import infinity_exception;
 import third_party;
 import status;
 import physical_top;
+import sort_key;
+import query_memory_tracker;
+import data_type;
 
 namespace infinity {
 
@@ -160,12 +164,42 @@ void PhysicalSort::Init() {
         sort_functions.emplace_back(PhysicalTop::GenerateSortFunction(order_by_types_[i], expressions_[i]));
     }
     prefer_left_function_ = CompareTwoRowAndPreferLeft(std::move(sort_functions));
+
+    Vector<SharedPtr<DataType>> sort_key_types;
+    sort_key_types.reserve(sort_expr_count);
+    for (const auto &expression : expressions_) {
+        if (!SortKeyEncoder::Supported(expression->Type())) {
+            return;
+        }
+        sort_key_types.emplace_back(MakeShared<DataType>(expression->Type()));
+    }
+    sort_key_encoder_ = MakeUnique<SortKeyEncoder>(std::move(sort_key_types), order_by_types_);
 }
 
-bool PhysicalSort::Execute(QueryContext *, OperatorState *operator_state) {
+bool PhysicalSort::Execute(QueryContext *query_context, OperatorState *operator_state) {
     auto *prev_op_state = operator_state->prev_op_state_;
     auto *sort_operator_state = static_cast<SortOperatorState *>(operator_state);
 
+    // The sorted blocks are cached until the input is complete, sort doesn't spill so the query fails over the memory limit.
+    for (const auto &input_block : prev_op_state->data_block_array_) {
+        sort_operator_state->sorted_runs_bytes_ += input_block->GetSizeInBytes();
+    }
+    sort_operator_state->memory_reservation_.Init(query_context->memory_tracker());
+    sort_operator_state->memory_reservation_.ResizeOrFail(sort_operator_state->sorted_runs_bytes_, "Sort");
+
+    if (sort_key_encoder_.get() != nullptr) {
+        SortBatchByKeys(sort_operator_state);
+        if (!prev_op_state->Complete()) {
+            return false;
+        }
+        MergeSortedRuns(sort_operator_state->sorted_runs_, sort_operator_state->run_keys_, sort_operator_state->data_block_array_);
+        sort_operator_state->sorted_runs_.clear();
+        sort_operator_state->run_keys_.clear();
+        sort_operator_state->memory_reservation_.Resize(0);
+        sort_operator_state->SetComplete();
+        return true;
+    }
+
     // Generate block indexes
     Vector<BlockRawIndex> block_indexes;
     auto pre_op_state = operator_state->prev_op_state_;
@@ -214,8 +248,40 @@ bool PhysicalSort::Execute(QueryContext *, OperatorState *operator_state) {
 
     CopyWithIndexes(sort_operator_state->unmerge_sorted_blocks_, sort_operator_state->data_block_array_, merge_indexes);
     sort_operator_state->unmerge_sorted_blocks_.clear();
+    sort_operator_state->memory_reservation_.Resize(0);
     sort_operator_state->SetComplete();
     return true;
 }
 
+void PhysicalSort::SortBatchByKeys(SortOperatorState *sort_operator_state) {
+    Vector<UniquePtr<DataBlock>> &input_blocks = sort_operator_state->prev_op_state_->data_block_array_;
+    if (input_blocks.empty()) {
+        return;
+    }
+    auto eval_columns = PhysicalTop::GetEvalColumns(expressions_, sort_operator_state->expr_states_, input_blocks);
+    SortKeys keys;
+    Vector<BlockRawIndex> block_indexes;
+    for (u32 block_id = 0; block_id < input_blocks.size(); ++block_id) {
+        u32 row_count = input_blocks[block_id]->row_count();
+        sort_key_encoder_->Encode(eval_columns[block_id], row_count, keys);
+        for (u32 offset = 0; offset < row_count; ++offset) {
+            block_indexes.emplace_back(block_id, offset);
+        }
+    }
+
+    // Sort the rows of the batch into a run, stable so that the equal rows keep the input order.
+    Vector<u32> sorted_rows(block_indexes.size());
+    std::iota(sorted_rows.begin(), sorted_rows.end(), 0);
+    std::stable_sort(sorted_rows.begin(), sorted_rows.end(), [&keys](u32 x, u32 y) { return keys.Key(x) < keys.Key(y); });
+    Vector<BlockRawIndex> sorted_indexes;
+    sorted_indexes.reserve(sorted_rows.size());
+    SortKeys &run_keys = sort_operator_state->run_keys_.emplace_back();
+    for (u32 row : sorted_rows) {
+        sorted_indexes.emplace_back(block_indexes[row]);
+        run_keys.AppendKey(keys.Key(row));
+    }
+    CopyWithIndexes(input_blocks, sort_operator_state->sorted_runs_.emplace_back(), sorted_indexes);
+    input_blocks.clear();
+}
+
 } // namespace infinity
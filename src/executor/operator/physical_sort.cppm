@@ -32,6 +32,7 @@ import physical_top;
 import internal_types;
 import select_statement;
 import data_type;
+import sort_key;
 
 namespace infinity {
 
@@ -60,12 +61,18 @@ public:
     // for OperatorState
     inline auto const &GetSortExpressions() const { return expressions_; }
 
+    inline auto const &GetOrderbyTypes() const { return order_by_types_; }
+
     Vector<SharedPtr<BaseExpression>> expressions_;
     Vector<OrderType> order_by_types_{};
 
 private:
+    void SortBatchByKeys(SortOperatorState *sort_operator_state);
+
     u64 input_table_index_{};
     CompareTwoRowAndPreferLeft prefer_left_function_; // compare function
+    // Rows are compared by the binary sort keys if all sort expressions can be encoded, otherwise by the compare function.
+    UniquePtr<SortKeyEncoder> sort_key_encoder_{};
 };
 
 } // namespace infinity
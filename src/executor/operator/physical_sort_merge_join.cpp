@@ -12,17 +12,400 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+
 module;
 
-import query_context;
-import operator_state;
+#include <algorithm>
+#include <numeric>
 
 module physical_sort_merge_join;
 
+import stl;
+import query_context;
+import operator_state;
+import physical_operator;
+import physical_operator_type;
+import physical_hash_join;
+import physical_sort;
+import physical_merge_sort;
+import physical_project;
+import base_expression;
+import expression_type;
+import reference_expression;
+import data_block;
+import column_vector;
+import selection;
+import sort_key;
+import default_values;
+import internal_types;
+import data_type;
+import join_reference;
+import select_statement;
+import hash_table;
+import infinity_exception;
+import third_party;
+
 namespace infinity {
 
-void PhysicalSortMergeJoin::Init() {}
+namespace {
+
+constexpr u32 INVALID_ROW = std::numeric_limits<u32>::max();
+
+// Rows with non NULL join keys of an input in the order of keys.
+struct MergeJoinInput {
+    void Build(const Vector<Vector<UniquePtr<DataBlock>>> &task_blocks, const Vector<SizeT> &key_ids, const SortKeyEncoder &key_encoder) {
+        SortKeys block_keys;
+        Vector<bool> has_null;
+        for (const auto &data_blocks : task_blocks) {
+            for (const auto &data_block : data_blocks) {
+                u32 block_idx = blocks_.size();
+                blocks_.emplace_back(data_block.get());
+                SizeT row_count = data_block->row_count();
+                Vector<SharedPtr<ColumnVector>> key_columns;
+                key_columns.reserve(key_ids.size());
+                for (SizeT key_id : key_ids) {
+                    key_columns.emplace_back(data_block->column_vectors[key_id]);
+                }
+                HashTable::HasNull(key_columns, row_count, has_null);
+                block_keys.Clear();
+                key_encoder.Encode(key_columns, row_count, block_keys);
+                for (SizeT row_idx = 0; row_idx < row_count; ++row_idx) {
+                    if (has_null[row_idx]) {
+                        // NULL equals nothing, the row is kept to be output as an unmatched row of outer join.
+                        null_rows_.emplace_back(block_idx, row_idx);
+                        continue;
+                    }
+                    if (rows_.size() >= INVALID_ROW) {
+                        UnrecoverableError("Too many rows in the input of sort merge join.");
+                    }
+                    rows_.emplace_back(block_idx, row_idx);
+                    keys_.AppendKey(block_keys.Key(row_idx));
+                }
+            }
+        }
+        matched_.assign(rows_.size(), false);
+
+        order_.resize(rows_.size());
+        std::iota(order_.begin(), order_.end(), 0);
+        bool ordered = true;
+        for (SizeT idx = 1; idx < rows_.size(); ++idx) {
+            if (keys_.Key(idx) < keys_.Key(idx - 1)) {
+                ordered = false;
+                break;
+            }
+        }
+        if (!ordered) {
+            std::stable_sort(order_.begin(), order_.end(), [&](u32 lhs, u32 rhs) { return keys_.Key(lhs) < keys_.Key(rhs); });
+        }
+    }
+
+    inline SizeT Count() const { return order_.size(); }
+
+    // Key of the idx-th row in the order of keys
+    inline std::string_view KeyAt(SizeT idx) const { return keys_.Key(order_[idx]); }
+
+    // End of the rows with the same key as the row at begin
+    SizeT GroupEnd(SizeT begin) const {
+        SizeT end = begin + 1;
+        while (end < order_.size() && KeyAt(end) == KeyAt(begin)) {
+            ++end;
+        }
+        return end;
+    }
+
+    Vector<DataBlock *> blocks_{};
+    // (block index, row index) of each row with non NULL keys
+    Vector<Pair<u32, u32>> rows_{};
+    SortKeys keys_{};
+    Vector<u32> order_{};
+    Vector<bool> matched_{};
+    Vector<Pair<u32, u32>> null_rows_{};
+};
+
+} // namespace
+
+void PhysicalSortMergeJoin::Init() {
+    SharedPtr<Vector<SharedPtr<DataType>>> left_types = left_->GetOutputTypes();
+    left_column_count_ = left_types->size();
+    SplitConditions(conditions_, *left_types, left_key_ids_, right_key_ids_, residual_conditions_);
+    if (left_key_ids_.empty()) {
+        UnrecoverableError("Sort merge join requires at least one equal condition between left and right input.");
+    }
+    Vector<SharedPtr<DataType>> key_types;
+    for (SizeT left_key_id : left_key_ids_) {
+        key_types.emplace_back((*left_types)[left_key_id]);
+    }
+    key_encoder_ = MakeUnique<SortKeyEncoder>(std::move(key_types), Vector<OrderType>(left_key_ids_.size(), OrderType::kAsc));
+
+    output_types_ = GetOutputTypes();
+    SizeT max_type_size = 0;
+    for (const auto &output_type : *output_types_) {
+        max_type_size = std::max(max_type_size, output_type->Size());
+    }
+    padding_buffer_.assign(max_type_size, 0);
+}
+
+void PhysicalSortMergeJoin::SplitConditions(const Vector<SharedPtr<BaseExpression>> &conditions,
+                                            const Vector<SharedPtr<DataType>> &left_types,
+                                            Vector<SizeT> &left_key_ids,
+                                            Vector<SizeT> &right_key_ids,
+                                            Vector<SharedPtr<BaseExpression>> &residual_conditions) {
+    for (const auto &condition : conditions) {
+        SizeT left_idx{};
+        SizeT right_idx{};
+        if (PhysicalHashJoin::IsEquiCondition(condition, left_types.size(), left_idx, right_idx) && SortKeyEncoder::Supported(*left_types[left_idx])) {
+            left_key_ids.emplace_back(left_idx);
+            right_key_ids.emplace_back(right_idx);
+        } else {
+            residual_conditions.emplace_back(condition);
+        }
+    }
+}
+
+namespace {
+
+bool SortedOnColumns(const Vector<SharedPtr<BaseExpression>> &sort_expressions, const Vector<OrderType> &order_by_types, const Vector<SizeT> &column_ids) {
+    if (sort_expressions.size() < column_ids.size()) {
+        return false;
+    }
+    for (SizeT idx = 0; idx < column_ids.size(); ++idx) {
+        const auto &sort_expression = sort_expressions[idx];
+        if (sort_expression->type() != ExpressionType::kReference || order_by_types[idx] != OrderType::kAsc) {
+            return false;
+        }
+        if (static_cast<ReferenceExpression *>(sort_expression.get())->column_index() != column_ids[idx]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+bool PhysicalSortMergeJoin::IsOrderedOn(PhysicalOperator *physical_operator, const Vector<SizeT> &column_ids) {
+    switch (physical_operator->operator_type()) {
+        case PhysicalOperatorType::kFilter: {
+            return IsOrderedOn(physical_operator->left(), column_ids);
+        }
+        case PhysicalOperatorType::kProjection: {
+            // The order is kept if the columns are projected from the input columns as they are.
+            auto *project_operator = static_cast<PhysicalProject *>(physical_operator);
+            Vector<SizeT> input_column_ids;
+            input_column_ids.reserve(column_ids.size());
+            for (SizeT column_id : column_ids) {
+                const auto &expression = project_operator->expressions_[column_id];
+                if (expression->type() != ExpressionType::kReference) {
+                    return false;
+                }
+                input_column_ids.emplace_back(static_cast<ReferenceExpression *>(expression.get())->column_index());
+            }
+            return IsOrderedOn(project_operator->left(), input_column_ids);
+        }
+        case PhysicalOperatorType::kSort: {
+            auto *sort_operator = static_cast<PhysicalSort *>(physical_operator);
+            return SortedOnColumns(sort_operator->GetSortExpressions(), sort_operator->GetOrderbyTypes(), column_ids);
+        }
+        case PhysicalOperatorType::kMergeSort: {
+            auto *merge_sort_operator = static_cast<PhysicalMergeSort *>(physical_operator);
+            return SortedOnColumns(merge_sort_operator->GetSortExpressions(), merge_sort_operator->GetOrderbyTypes(), column_ids);
+        }
+        default: {
+            return false;
+        }
+    }
+}
+
+bool PhysicalSortMergeJoin::CanUseSortMergeJoin(JoinType join_type,
+                                                const Vector<SharedPtr<BaseExpression>> &conditions,
+                                                PhysicalOperator *left,
+                                                PhysicalOperator *right) {
+    switch (join_type) {
+        case JoinType::kInner:
+        case JoinType::kLeft:
+        case JoinType::kRight:
+        case JoinType::kFull: {
+            break;
+        }
+        default: {
+            return false;
+        }
+    }
+    Vector<SizeT> left_key_ids;
+    Vector<SizeT> right_key_ids;
+    Vector<SharedPtr<BaseExpression>> residual_conditions;
+    SplitConditions(conditions, *left->GetOutputTypes(), left_key_ids, right_key_ids, residual_conditions);
+    if (left_key_ids.empty()) {
+        return false;
+    }
+    return IsOrderedOn(left, left_key_ids) && IsOrderedOn(right, right_key_ids);
+}
+
+bool PhysicalSortMergeJoin::Execute(QueryContext *, OperatorState *operator_state) {
+    auto *join_state = static_cast<MergeJoinOperatorState *>(operator_state);
+    if (!join_state->input_complete_) {
+        return false;
+    }
+
+    bool output_left_unmatched = join_type_ == JoinType::kLeft || join_type_ == JoinType::kFull;
+    bool output_right_unmatched = join_type_ == JoinType::kRight || join_type_ == JoinType::kFull;
+
+    MergeJoinInput left_input;
+    left_input.Build(join_state->left_task_blocks_, left_key_ids_, *key_encoder_);
+    MergeJoinInput right_input;
+    right_input.Build(join_state->right_task_blocks_, right_key_ids_, *key_encoder_);
+
+    SizeT output_column_count = output_types_->size();
+    // (left row, right row) pairs with equal keys, materialized into one block each time it is full.
+    Vector<Pair<u32, u32>> candidates;
+    candidates.reserve(DEFAULT_BLOCK_CAPACITY);
+    auto flush_candidates = [&]() {
+        if (candidates.empty()) {
+            return;
+        }
+        UniquePtr<DataBlock> candidate_block = DataBlock::MakeUniquePtr();
+        candidate_block->Init(*output_types_);
+        for (SizeT column_idx = 0; column_idx < output_column_count; ++column_idx) {
+            ColumnVector &output_column = *candidate_block->column_vectors[column_idx];
+            if (column_idx < left_column_count_) {
+                for (const auto &candidate : candidates) {
+                    const auto &left_row = left_input.rows_[candidate.first];
+                    output_column.AppendWith(*left_input.blocks_[left_row.first]->column_vectors[column_idx], left_row.second, 1);
+                }
+            } else {
+                SizeT right_column_idx = column_idx - left_column_count_;
+                for (const auto &candidate : candidates) {
+                    const auto &right_row = right_input.rows_[candidate.second];
+                    output_column.AppendWith(*right_input.blocks_[right_row.first]->column_vectors[right_column_idx], right_row.second, 1);
+                }
+            }
+        }
+        candidate_block->Finalize();
+
+        if (residual_conditions_.empty()) {
+            for (const auto &candidate : candidates) {
+                left_input.matched_[candidate.first] = true;
+                right_input.matched_[candidate.second] = true;
+            }
+            join_state->data_block_array_.emplace_back(std::move(candidate_block));
+        } else {
+            Vector<bool> keep = PhysicalHashJoin::EvaluateConditions(residual_conditions_, candidate_block.get());
+            SharedPtr<Selection> selection = MakeShared<Selection>();
+            selection->Initialize(candidates.size());
+            for (SizeT idx = 0; idx < candidates.size(); ++idx) {
+                if (keep[idx]) {
+                    left_input.matched_[candidates[idx].first] = true;
+                    right_input.matched_[candidates[idx].second] = true;
+                    selection->Append(idx);
+                }
+            }
+            if (selection->Size() > 0) {
+                UniquePtr<DataBlock> output_block = DataBlock::MakeUniquePtr();
+                output_block->Init(candidate_block.get(), selection);
+                join_state->data_block_array_.emplace_back(std::move(output_block));
+            }
+        }
+        candidates.clear();
+    };
+
+    // Both inputs are in the order of keys, each group of equal keys on one side joins the group of the same key on the other side.
+    SizeT left_pos = 0;
+    SizeT right_pos = 0;
+    while (left_pos < left_input.Count() && right_pos < right_input.Count()) {
+        std::string_view left_key = left_input.KeyAt(left_pos);
+        std::string_view right_key = right_input.KeyAt(right_pos);
+        if (left_key < right_key) {
+            ++left_pos;
+            continue;
+        }
+        if (right_key < left_key) {
+            ++right_pos;
+            continue;
+        }
+        SizeT left_end = left_input.GroupEnd(left_pos);
+        SizeT right_end = right_input.GroupEnd(right_pos);
+        for (SizeT left_idx = left_pos; left_idx < left_end; ++left_idx) {
+            for (SizeT right_idx = right_pos; right_idx < right_end; ++right_idx) {
+                candidates.emplace_back(left_input.order_[left_idx], right_input.order_[right_idx]);
+                if (candidates.size() == (SizeT)DEFAULT_BLOCK_CAPACITY) {
+                    flush_candidates();
+                }
+            }
+        }
+        left_pos = left_end;
+        right_pos = right_end;
+    }
+    flush_candidates();
+
+    auto append_unmatched = [&](const MergeJoinInput &input, SizeT input_begin) {
+        for (SizeT idx = 0; idx < input.Count(); ++idx) {
+            u32 row = input.order_[idx];
+            if (!input.matched_[row]) {
+                const auto &unmatched_row = input.rows_[row];
+                DataBlock *output_block = PhysicalHashJoin::OutputBlock(*output_types_, join_state->data_block_array_);
+                PhysicalHashJoin::AppendPaddedRow(output_block, input.blocks_[unmatched_row.first], unmatched_row.second, input_begin, padding_buffer_);
+            }
+        }
+        for (const auto &null_row : input.null_rows_) {
+            DataBlock *output_block = PhysicalHashJoin::OutputBlock(*output_types_, join_state->data_block_array_);
+            PhysicalHashJoin::AppendPaddedRow(output_block, input.blocks_[null_row.first], null_row.second, input_begin, padding_buffer_);
+        }
+    };
+    if (output_left_unmatched) {
+        append_unmatched(left_input, 0);
+    }
+    if (output_right_unmatched) {
+        append_unmatched(right_input, left_column_count_);
+    }
+
+    join_state->left_task_blocks_.clear();
+    join_state->right_task_blocks_.clear();
+
+    for (auto &output_block : join_state->data_block_array_) {
+        output_block->Finalize();
+    }
+    if (join_state->data_block_array_.empty()) {
+        // The operators after join always expect one block at least.
+        UniquePtr<DataBlock> output_block = DataBlock::MakeUniquePtr();
+        output_block->Init(*output_types_);
+        output_block->Finalize();
+        join_state->data_block_array_.emplace_back(std::move(output_block));
+    }
+    join_state->SetComplete();
+    return true;
+}
+
+SharedPtr<Vector<String>> PhysicalSortMergeJoin::GetOutputNames() const {
+    SharedPtr<Vector<String>> result = MakeShared<Vector<String>>();
+    SharedPtr<Vector<String>> left_output_names = left_->GetOutputNames();
+    SharedPtr<Vector<String>> right_output_names = right_->GetOutputNames();
+
+    result->reserve(left_output_names->size() + right_output_names->size());
+    for (auto &name_str : *left_output_names) {
+        result->emplace_back(name_str);
+    }
+
+    for (auto &name_str : *right_output_names) {
+        result->emplace_back(name_str);
+    }
+
+    return result;
+}
+
+SharedPtr<Vector<SharedPtr<DataType>>> PhysicalSortMergeJoin::GetOutputTypes() const {
+    SharedPtr<Vector<SharedPtr<DataType>>> result = MakeShared<Vector<SharedPtr<DataType>>>();
+    SharedPtr<Vector<SharedPtr<DataType>>> left_output_types = left_->GetOutputTypes();
+    SharedPtr<Vector<SharedPtr<DataType>>> right_output_types = right_->GetOutputTypes();
+
+    result->reserve(left_output_types->size() + right_output_types->size());
+    for (auto &left_type : *left_output_types) {
+        result->emplace_back(left_type);
+    }
+
+    for (auto &right_type : *right_output_types) {
+        result->emplace_back(right_type);
+    }
 
-bool PhysicalSortMergeJoin::Execute(QueryContext *, OperatorState *) { return true; }
+    return result;
+}
 
 } // namespace infinity
@@ -12,6 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+
 module;
 
 export module physical_sort_merge_join;
@@ -22,17 +23,29 @@ import query_context;
 import operator_state;
 import physical_operator;
 import physical_operator_type;
+import base_expression;
+import data_block;
 import load_meta;
 import infinity_exception;
 import internal_types;
+import join_reference;
 import data_type;
+import sort_key;
 
 namespace infinity {
 
+// Equi join by merging both inputs in the order of the join keys, without building a hash table.
+// It is chosen when both inputs are already sorted on the join keys, an input is only sorted again if its rows turn out unordered.
 export class PhysicalSortMergeJoin : public PhysicalOperator {
 public:
-    explicit PhysicalSortMergeJoin(u64 id, SharedPtr<Vector<LoadMeta>> load_metas)
-        : PhysicalOperator(PhysicalOperatorType::kJoinMerge, nullptr, nullptr, id, load_metas) {}
+    explicit PhysicalSortMergeJoin(u64 id,
+                                   JoinType join_type,
+                                   Vector<SharedPtr<BaseExpression>> conditions,
+                                   UniquePtr<PhysicalOperator> left,
+                                   UniquePtr<PhysicalOperator> right,
+                                   SharedPtr<Vector<LoadMeta>> load_metas)
+        : PhysicalOperator(PhysicalOperatorType::kJoinMerge, std::move(left), std::move(right), id, load_metas), join_type_(join_type),
+          conditions_(std::move(conditions)) {}
 
     ~PhysicalSortMergeJoin() override = default;
 
@@ -40,18 +53,45 @@ public:
 
     bool Execute(QueryContext *query_context, OperatorState *operator_state) final;
 
-    inline SharedPtr<Vector<String>> GetOutputNames() const final { return output_names_; }
+    SharedPtr<Vector<String>> GetOutputNames() const final;
+
+    SharedPtr<Vector<SharedPtr<DataType>>> GetOutputTypes() const final;
+
+    // The child fragments are scheduled in parallel, the merge runs in the single task of the join fragment.
+    SizeT TaskletCount() override { return 1; }
+
+    // Sort merge join needs the equi conditions of hash join on keys which can be encoded into binary sort keys,
+    // and both inputs ordered on the keys.
+    static bool CanUseSortMergeJoin(JoinType join_type, const Vector<SharedPtr<BaseExpression>> &conditions, PhysicalOperator *left, PhysicalOperator *right);
 
-    inline SharedPtr<Vector<SharedPtr<DataType>>> GetOutputTypes() const final { return output_types_; }
+    // Whether the output rows of the operator are in the ascending order of the columns.
+    static bool IsOrderedOn(PhysicalOperator *physical_operator, const Vector<SizeT> &column_ids);
 
-    SizeT TaskletCount() override {
-        UnrecoverableError("Not implement: TaskletCount not Implement");
-        return 0;
-    }
+    inline JoinType join_type() const { return join_type_; }
+
+    inline const Vector<SharedPtr<BaseExpression>> &conditions() const { return conditions_; }
 
 private:
-    SharedPtr<Vector<String>> output_names_{};
+    // Split the conditions into the key pairs of the merge and the residual conditions.
+    static void SplitConditions(const Vector<SharedPtr<BaseExpression>> &conditions,
+                                const Vector<SharedPtr<DataType>> &left_types,
+                                Vector<SizeT> &left_key_ids,
+                                Vector<SizeT> &right_key_ids,
+                                Vector<SharedPtr<BaseExpression>> &residual_conditions);
+
+    JoinType join_type_{JoinType::kInner};
+    Vector<SharedPtr<BaseExpression>> conditions_{};
+
+    SizeT left_column_count_{};
+    Vector<SizeT> left_key_ids_{};
+    Vector<SizeT> right_key_ids_{};
+    Vector<SharedPtr<BaseExpression>> residual_conditions_{};
+    // The keys of an equi condition have the same type, so both inputs share the encoder.
+    UniquePtr<SortKeyEncoder> key_encoder_{};
+
     SharedPtr<Vector<SharedPtr<DataType>>> output_types_{};
+    // Zero filled buffer used as the value of the padded NULL columns of outer join.
+    Vector<char> padding_buffer_{};
 };
 
 } // namespace infinity
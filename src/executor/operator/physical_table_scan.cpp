@@ -21,6 +21,7 @@ module physical_table_scan;
 import stl;
 import txn;
 import query_context;
+import query_progress;
 import table_def;
 import data_table;
 
@@ -42,9 +43,56 @@ import infinity_exception;
 import logical_type;
 
 import block_entry;
+import segment_entry;
+import block_column_entry;
+import buffer_manager;
+import buffer_obj;
+import fast_rough_filter;
+import join_runtime_filter;
+import statistics_aggregate;
+import value;
 
 namespace infinity {
 
+namespace {
+
+template <typename T>
+Value PickMinMax(const Value &left, const Value &right, bool pick_min) {
+    T left_value = left.GetValue<T>();
+    T right_value = right.GetValue<T>();
+    return (pick_min ? right_value < left_value : right_value > left_value) ? right : left;
+}
+
+// The smaller or the larger of two values of the same numeric type
+Value PickMinMax(const Value &left, const Value &right, bool pick_min) {
+    switch (left.type().type()) {
+        case LogicalType::kTinyInt: {
+            return PickMinMax<TinyIntT>(left, right, pick_min);
+        }
+        case LogicalType::kSmallInt: {
+            return PickMinMax<SmallIntT>(left, right, pick_min);
+        }
+        case LogicalType::kInteger: {
+            return PickMinMax<IntegerT>(left, right, pick_min);
+        }
+        case LogicalType::kBigInt: {
+            return PickMinMax<BigIntT>(left, right, pick_min);
+        }
+        case LogicalType::kFloat: {
+            return PickMinMax<FloatT>(left, right, pick_min);
+        }
+        case LogicalType::kDouble: {
+            return PickMinMax<DoubleT>(left, right, pick_min);
+        }
+        default: {
+            UnrecoverableError(fmt::format("Min and max of {} aren't answered from the block statistics", left.type().ToString()));
+            return left;
+        }
+    }
+}
+
+} // namespace
+
 void PhysicalTableScan::Init() {}
 
 bool PhysicalTableScan::Execute(QueryContext *query_context, OperatorState *operator_state) {
@@ -97,25 +145,100 @@ Vector<SizeT> &PhysicalTableScan::ColumnIDs() const {
     return column_ids_;
 }
 
-Vector<SharedPtr<Vector<GlobalBlockID>>> PhysicalTableScan::PlanBlockEntries(i64 parallel_count) const {
+SharedPtr<TableScanSharedData> PhysicalTableScan::MakeSharedData() const {
     BlockIndex *block_index = base_table_ref_->block_index_.get();
+    auto block_ids = MakeShared<Vector<GlobalBlockID>>(block_index->global_blocks_);
+    return MakeShared<TableScanSharedData>(std::move(block_ids), TABLE_SCAN_MORSEL_BLOCK_COUNT);
+}
 
-    u64 all_block_count = block_index->BlockCount();
-    u64 block_per_task = all_block_count / parallel_count;
-    u64 residual = all_block_count % parallel_count;
+bool PhysicalTableScan::JoinRuntimeFiltersMayPass(TxnTimeStamp begin_ts, const FastRoughFilter &fast_rough_filter) const {
+    for (const auto &runtime_filter : join_runtime_filters_) {
+        const FastRoughFilterEvaluator *evaluator = runtime_filter->Get();
+        if (evaluator != nullptr && !evaluator->Evaluate(begin_ts, fast_rough_filter)) {
+            return false;
+        }
+    }
+    return true;
+}
 
-    Vector<SharedPtr<Vector<GlobalBlockID>>> result(parallel_count, nullptr);
-    for (SizeT task_id = 0, global_block_id = 0, residual_idx = 0; (i64)task_id < parallel_count; ++task_id) {
-        result[task_id] = MakeShared<Vector<GlobalBlockID>>();
-        for (u64 block_id_in_task = 0; block_id_in_task < block_per_task; ++block_id_in_task) {
-            result[task_id]->emplace_back(block_index->global_blocks_[global_block_id++]);
+bool PhysicalTableScan::AggregateFromStatistics(TxnTimeStamp begin_ts,
+                                                const BlockEntry &block_entry,
+                                                TableScanOperatorState *table_scan_operator_state) const {
+    // every row of the block is visible to the txn
+    SizeT row_count = block_entry.row_count();
+    auto [row_begin, row_end] = block_entry.GetVisibleRange(begin_ts);
+    if (row_count == 0 || row_begin != 0 || row_end != row_count) {
+        return false;
+    }
+    const FastRoughFilter &fast_rough_filter = *block_entry.GetFastRoughFilter();
+    TxnTimeStamp data_ts = block_entry.max_row_ts();
+    if (fast_rough_filter_evaluator_ and !fast_rough_filter_evaluator_->EvaluateAllPass(begin_ts, fast_rough_filter, data_ts)) {
+        return false;
+    }
+    Vector<Value> block_result;
+    block_result.reserve(statistics_aggregates_.size());
+    for (const StatisticsAggregate &aggregate : statistics_aggregates_) {
+        if (aggregate.type_ == StatisticsAggregateType::kCount) {
+            block_result.push_back(Value::MakeBigInt(row_count));
+            continue;
+        }
+        Optional<Pair<Value, Value>> min_max = fast_rough_filter.GetExactMinMax(begin_ts, data_ts, aggregate.column_id_);
+        if (!min_max.has_value()) {
+            return false;
+        }
+        block_result.push_back(aggregate.type_ == StatisticsAggregateType::kMin ? std::move(min_max->first) : std::move(min_max->second));
+    }
+
+    Vector<Value> &partial = table_scan_operator_state->statistics_partial_;
+    if (partial.empty()) {
+        partial = std::move(block_result);
+        return true;
+    }
+    for (SizeT i = 0; i < partial.size(); ++i) {
+        switch (statistics_aggregates_[i].type_) {
+            case StatisticsAggregateType::kCount: {
+                partial[i] = Value::MakeBigInt(partial[i].GetValue<BigIntT>() + block_result[i].GetValue<BigIntT>());
+                break;
+            }
+            case StatisticsAggregateType::kMin: {
+                partial[i] = PickMinMax(partial[i], block_result[i], true);
+                break;
+            }
+            case StatisticsAggregateType::kMax: {
+                partial[i] = PickMinMax(partial[i], block_result[i], false);
+                break;
+            }
+        }
+    }
+    return true;
+}
+
+void PhysicalTableScan::PrefetchBlock(QueryContext *query_context,
+                                      TableScanFunctionData *table_scan_function_data_ptr,
+                                      u64 block_ids_idx,
+                                      TxnTimeStamp begin_ts) {
+    if (block_ids_idx >= table_scan_function_data_ptr->morsel_end_) {
+        return;
+    }
+    TableScanSharedData *shared_data = table_scan_function_data_ptr->shared_data_;
+    const GlobalBlockID &global_block_id = shared_data->global_block_ids_->at(block_ids_idx);
+    BlockEntry *block_entry = table_scan_function_data_ptr->block_index_->GetBlockEntry(global_block_id.segment_id_, global_block_id.block_id_);
+    if (fast_rough_filter_evaluator_ and !fast_rough_filter_evaluator_->Evaluate(begin_ts, *block_entry->GetFastRoughFilter())) {
+        return;
+    }
+    if (!JoinRuntimeFiltersMayPass(begin_ts, *block_entry->GetFastRoughFilter())) {
+        return;
+    }
+    BufferManager *buffer_mgr = query_context->storage()->buffer_manager();
+    for (auto column_id : table_scan_function_data_ptr->column_ids_) {
+        if (column_id == COLUMN_IDENTIFIER_ROW_ID) {
+            continue;
         }
-        if (residual_idx < residual) {
-            result[task_id]->emplace_back(block_index->global_blocks_[global_block_id++]);
-            ++residual_idx;
+        BufferObj *buffer_obj = block_entry->GetColumnBlockEntry(column_id)->buffer();
+        if (buffer_obj != nullptr) {
+            shared_data->AddPrefetch(buffer_mgr->Prefetch(buffer_obj));
         }
     }
-    return result;
 }
 
 void PhysicalTableScan::ExecuteInternal(QueryContext *query_context, TableScanOperatorState *table_scan_operator_state) {
@@ -129,48 +252,95 @@ void PhysicalTableScan::ExecuteInternal(QueryContext *query_context, TableScanOp
 
     TableScanFunctionData *table_scan_function_data_ptr = table_scan_operator_state->table_scan_function_data_.get();
     const BlockIndex *block_index = table_scan_function_data_ptr->block_index_;
-    Vector<GlobalBlockID> *block_ids = table_scan_function_data_ptr->global_block_ids_.get();
+    TableScanSharedData *shared_data = table_scan_function_data_ptr->shared_data_;
+    const Vector<GlobalBlockID> *block_ids = shared_data->global_block_ids_.get();
     const Vector<SizeT> &column_ids = table_scan_function_data_ptr->column_ids_;
     u64 &block_ids_idx = table_scan_function_data_ptr->current_block_ids_idx_;
-    if (block_ids_idx >= block_ids->size()) {
-        // No data or all data is read
-        table_scan_operator_state->SetComplete();
-        return;
-    }
-
-    TxnTimeStamp begin_ts = query_context->GetTxn()->BeginTS();
+    u64 &morsel_end = table_scan_function_data_ptr->morsel_end_;
     SizeT &read_offset = table_scan_function_data_ptr->current_read_offset_;
-
-    {
-        String out;
-        for (auto &global_block_id : *block_ids) {
-            out += fmt::format("({},{}) ", global_block_id.segment_id_, global_block_id.block_id_);
+    Optional<Vector<Pair<u32, u32>>> &zone_row_ranges = table_scan_function_data_ptr->zone_row_ranges_;
+    if (block_ids_idx >= morsel_end) {
+        if (!shared_data->NextMorsel(block_ids_idx, morsel_end)) {
+            // No data or all data is read
+            table_scan_operator_state->SetComplete();
+            return;
         }
-        LOG_TRACE(fmt::format("TableScan: block_ids: {}", out));
+        read_offset = 0;
+        LOG_TRACE(fmt::format("TableScan: claim blocks [{}, {}) of {}", block_ids_idx, morsel_end, block_ids->size()));
     }
 
+    TxnTimeStamp begin_ts = query_context->GetTxn()->BeginTS();
+
     // Here we assume output is a fresh data block, we have never written anything into it.
     auto write_capacity = output_ptr->available_capacity();
-    while (block_ids_idx < block_ids->size()) {
+    while (true) {
+        if (block_ids_idx >= morsel_end) {
+            // current morsel is exhausted, claim the next one
+            if (!shared_data->NextMorsel(block_ids_idx, morsel_end)) {
+                break;
+            }
+            read_offset = 0;
+        }
         u32 segment_id = block_ids->at(block_ids_idx).segment_id_;
         u16 block_id = block_ids->at(block_ids_idx).block_id_;
 
         BlockEntry *current_block_entry = block_index->GetBlockEntry(segment_id, block_id);
+        if (read_offset == 0 && fast_rough_filter_evaluator_) {
+            // new segment, check its FastRoughFilter once instead of the filter of each of its blocks
+            if (segment_id != table_scan_function_data_ptr->checked_segment_id_) {
+                table_scan_function_data_ptr->checked_segment_id_ = segment_id;
+                table_scan_function_data_ptr->checked_segment_may_pass_ =
+                    fast_rough_filter_evaluator_->EvaluateSegment(begin_ts,
+                                                                  *block_index->segment_index_.at(segment_id)->GetFastRoughFilter(),
+                                                                  block_index->SegmentBlockCount(segment_id));
+            }
+            if (!table_scan_function_data_ptr->checked_segment_may_pass_) {
+                LOG_TRACE(fmt::format("TableScan: block_ids_idx: {}, morsel_end: {}, skipped after apply segment FastRoughFilter",
+                                      block_ids_idx,
+                                      morsel_end));
+                ++block_ids_idx;
+                continue;
+            }
+        }
         if (read_offset == 0) {
             // new block, check FastRoughFilter
             const auto &fast_rough_filter = *current_block_entry->GetFastRoughFilter();
             if (fast_rough_filter_evaluator_ and !fast_rough_filter_evaluator_->Evaluate(begin_ts, fast_rough_filter)) {
                 // skip this block
-                LOG_TRACE(fmt::format("TableScan: block_ids_idx: {}, block_ids.size(): {}, skipped after apply FastRoughFilter",
+                LOG_TRACE(fmt::format("TableScan: block_ids_idx: {}, morsel_end: {}, skipped after apply FastRoughFilter",
                                       block_ids_idx,
-                                      block_ids->size()));
+                                      morsel_end));
                 ++block_ids_idx;
                 continue;
             } else {
-                LOG_TRACE(fmt::format("TableScan: block_ids_idx: {}, block_ids.size(): {}, not skipped after apply FastRoughFilter",
+                LOG_TRACE(fmt::format("TableScan: block_ids_idx: {}, morsel_end: {}, not skipped after apply FastRoughFilter",
+                                      block_ids_idx,
+                                      morsel_end));
+            }
+            if (!JoinRuntimeFiltersMayPass(begin_ts, fast_rough_filter)) {
+                // none of the keys of the build side of the join is in this block
+                LOG_TRACE(fmt::format("TableScan: block_ids_idx: {}, morsel_end: {}, skipped after apply join runtime filter",
                                       block_ids_idx,
-                                      block_ids->size()));
+                                      morsel_end));
+                ++block_ids_idx;
+                continue;
+            }
+            if (!statistics_aggregates_.empty() && AggregateFromStatistics(begin_ts, *current_block_entry, table_scan_operator_state)) {
+                LOG_TRACE(fmt::format("TableScan: block_ids_idx: {}, morsel_end: {}, aggregated from its statistics", block_ids_idx, morsel_end));
+                ++block_ids_idx;
+                continue;
+            }
+            zone_row_ranges = None;
+            if (fast_rough_filter_evaluator_) {
+                zone_row_ranges = fast_rough_filter_evaluator_->EvaluateZones(begin_ts, fast_rough_filter, current_block_entry->row_count());
+                if (zone_row_ranges.has_value() && zone_row_ranges->empty()) {
+                    LOG_TRACE(fmt::format("TableScan: block_ids_idx: {}, morsel_end: {}, skipped after apply zone map", block_ids_idx, morsel_end));
+                    ++block_ids_idx;
+                    continue;
+                }
             }
+            // start reading the next block of the morsel while this one is copied
+            PrefetchBlock(query_context, table_scan_function_data_ptr, block_ids_idx + 1, begin_ts);
         }
         auto [row_begin, row_end] = current_block_entry->GetVisibleRange(begin_ts, read_offset);
         if (row_begin == row_end) {
@@ -179,6 +349,23 @@ void PhysicalTableScan::ExecuteInternal(QueryContext *query_context, TableScanOp
             read_offset = 0;
             continue;
         }
+        if (zone_row_ranges.has_value()) {
+            // skip to the next zone not ruled out, and stop the read at its end
+            auto range_iter = zone_row_ranges->begin();
+            while (range_iter != zone_row_ranges->end() && range_iter->second <= row_begin) {
+                ++range_iter;
+            }
+            if (range_iter == zone_row_ranges->end()) {
+                ++block_ids_idx;
+                read_offset = 0;
+                continue;
+            }
+            if (range_iter->first > row_begin) {
+                read_offset = range_iter->first;
+                continue;
+            }
+            row_end = std::min<BlockOffset>(row_end, range_iter->second);
+        }
         if (write_capacity == 0) {
             // output is full
             break;
@@ -192,9 +379,10 @@ void PhysicalTableScan::ExecuteInternal(QueryContext *query_context, TableScanOp
                 u32 segment_offset = block_id * DEFAULT_BLOCK_CAPACITY + read_offset;
                 output_ptr->column_vectors[output_column_id++]->AppendWith(RowID(segment_id, segment_offset), write_size);
             } else {
-                ColumnVector column_vector =
-                    current_block_entry->GetColumnBlockEntry(column_id)->GetColumnVector(query_context->storage()->buffer_manager());
-                output_ptr->column_vectors[output_column_id++]->AppendWith(column_vector, read_offset, write_size);
+                BlockColumnEntry *block_column_entry = current_block_entry->GetColumnBlockEntry(column_id);
+                ColumnVector column_vector = block_column_entry->GetColumnVector(query_context->storage()->buffer_manager());
+                ColumnVector &output_column = *output_ptr->column_vectors[output_column_id++];
+                block_column_entry->ReadRows(output_column, column_vector, read_offset, write_size, begin_ts);
             }
         }
 
@@ -203,13 +391,15 @@ void PhysicalTableScan::ExecuteInternal(QueryContext *query_context, TableScanOp
         read_offset += write_size;
     }
 
-    LOG_TRACE(fmt::format("TableScan: block_ids_idx: {}, block_ids.size(): {}", block_ids_idx, block_ids->size()));
+    LOG_TRACE(fmt::format("TableScan: block_ids_idx: {}, morsel_end: {}", block_ids_idx, morsel_end));
 
-    if (block_ids_idx >= block_ids->size()) {
+    if (block_ids_idx >= morsel_end) {
+        // the loop only leaves a morsel unfinished when the output is full
         table_scan_operator_state->SetComplete();
     }
 
     output_ptr->Finalize();
+    query_context->progress()->AddRowsScanned(output_ptr->row_count());
 }
 
 } // namespace infinity
@@ -31,6 +31,10 @@ import load_meta;
 import internal_types;
 import data_type;
 import fast_rough_filter;
+import table_scan_function_data;
+import join_runtime_filter;
+import statistics_aggregate;
+import block_entry;
 
 namespace infinity {
 
@@ -38,7 +42,7 @@ export class PhysicalTableScan : public PhysicalOperator {
 public:
     explicit PhysicalTableScan(u64 id,
                                SharedPtr<BaseTableRef> base_table_ref,
-                               UniquePtr<FastRoughFilterEvaluator> &&fast_rough_filter_evaluator,
+                               SharedPtr<FastRoughFilterEvaluator> fast_rough_filter_evaluator,
                                SharedPtr<Vector<LoadMeta>> load_metas,
                                bool add_row_id = false)
         : PhysicalOperator(PhysicalOperatorType::kTableScan, nullptr, nullptr, id, load_metas), base_table_ref_(std::move(base_table_ref)),
@@ -56,7 +60,7 @@ public:
 
     SharedPtr<Vector<SharedPtr<DataType>>> GetOutputTypes() const final;
 
-    Vector<SharedPtr<Vector<GlobalBlockID>>> PlanBlockEntries(i64 parallel_count) const;
+    SharedPtr<TableScanSharedData> MakeSharedData() const;
 
     String table_alias() const;
 
@@ -70,6 +74,12 @@ public:
 
     Vector<SizeT> &ColumnIDs() const;
 
+    // the keys of the build side of a hash join which this scan is the probe of, checked once published
+    void AddJoinRuntimeFilter(SharedPtr<JoinRuntimeFilter> runtime_filter) { join_runtime_filters_.emplace_back(std::move(runtime_filter)); }
+
+    // the aggregates without group by above the scan, it answers them from the metadata of the blocks it can instead of reading them
+    void SetStatisticsAggregates(Vector<StatisticsAggregate> statistics_aggregates) { statistics_aggregates_ = std::move(statistics_aggregates); }
+
     bool ParallelExchange() const override { return true; }
 
     bool IsExchange() const override { return true; }
@@ -81,10 +91,24 @@ public:
 private:
     void ExecuteInternal(QueryContext *query_context, TableScanOperatorState *table_scan_operator_state);
 
+    // Start loading the columns of the block a task reads next, unless the FastRoughFilter skips it.
+    void PrefetchBlock(QueryContext *query_context, TableScanFunctionData *table_scan_function_data_ptr, u64 block_ids_idx, TxnTimeStamp begin_ts);
+
+    // false if a published join runtime filter rules out the block
+    bool JoinRuntimeFiltersMayPass(TxnTimeStamp begin_ts, const FastRoughFilter &fast_rough_filter) const;
+
+    // false if the statistics aggregates can't be answered for the block, which is read then, otherwise they are merged into the
+    // partial result of the task
+    bool AggregateFromStatistics(TxnTimeStamp begin_ts, const BlockEntry &block_entry, TableScanOperatorState *table_scan_operator_state) const;
+
 private:
     SharedPtr<BaseTableRef> base_table_ref_{};
 
-    UniquePtr<FastRoughFilterEvaluator> fast_rough_filter_evaluator_{};
+    SharedPtr<FastRoughFilterEvaluator> fast_rough_filter_evaluator_{};
+
+    Vector<SharedPtr<JoinRuntimeFilter>> join_runtime_filters_{};
+
+    Vector<StatisticsAggregate> statistics_aggregates_{};
 
     bool add_row_id_;
     mutable Vector<SizeT> column_ids_;
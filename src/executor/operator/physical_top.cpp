@@ -16,7 +16,6 @@ module;
 
 #include <compare>
 #include <memory>
-#include <numeric>
 
 module physical_top;
 
@@ -37,6 +36,7 @@ import third_party;
 import status;
 import logical_type;
 import internal_types;
+import sort_key;
 
 namespace infinity {
 
@@ -175,6 +175,122 @@ private:
     }
 };
 
+// Top k rows by a key which compares with operator<, kept in a bounded heap with the worst row on the top.
+// Equal keys are ordered by the position of the row, so the earlier row is kept like CompareTwoRowAndPreferLeft does.
+template <typename KeyT>
+class TopKeySolver {
+public:
+    explicit TopKeySolver(u32 limit) : limit_(limit) { heap_.reserve(limit); }
+
+    // Add the rows of the next input block, keys[i] is the key of row i.
+    void AddBlock(u32 block_id, const Vector<KeyT> &keys) {
+        if (limit_ == 0 || keys.empty()) {
+            return;
+        }
+        if (heap_.size() == limit_) {
+            // None of the rows can replace a row of the full heap when the smallest key of the block is not below the bound.
+            const KeyT *min_key = &keys[0];
+            for (const KeyT &key : keys) {
+                if (key < *min_key) {
+                    min_key = &key;
+                }
+            }
+            if (!(*min_key < heap_[0].key_)) {
+                return;
+            }
+        }
+        for (u32 row_id = 0; row_id < keys.size(); ++row_id) {
+            AddCandidate(Entry{keys[row_id], block_id, row_id});
+        }
+    }
+
+    // (block, row) of the top rows in the output order.
+    Vector<Pair<u32, u32>> SortedRows() {
+        std::sort(heap_.begin(), heap_.end(), Better);
+        Vector<Pair<u32, u32>> rows;
+        rows.reserve(heap_.size());
+        for (const Entry &entry : heap_) {
+            rows.emplace_back(entry.block_id_, entry.row_id_);
+        }
+        return rows;
+    }
+
+private:
+    struct Entry {
+        KeyT key_;
+        u32 block_id_;
+        u32 row_id_;
+    };
+
+    static bool Better(const Entry &x, const Entry &y) {
+        if (x.key_ < y.key_) {
+            return true;
+        }
+        if (y.key_ < x.key_) {
+            return false;
+        }
+        return x.block_id_ < y.block_id_ || (x.block_id_ == y.block_id_ && x.row_id_ < y.row_id_);
+    }
+
+    void AddCandidate(const Entry &entry) {
+        if (heap_.size() < limit_) {
+            heap_.push_back(entry);
+            SiftUp(heap_.size() - 1);
+        } else if (Better(entry, heap_[0])) {
+            heap_[0] = entry;
+            SiftDown(0);
+        }
+    }
+
+    void SiftUp(SizeT index) {
+        while (index > 0) {
+            SizeT parent = (index - 1) / 2;
+            if (!Better(heap_[parent], heap_[index])) {
+                break;
+            }
+            std::swap(heap_[parent], heap_[index]);
+            index = parent;
+        }
+    }
+
+    void SiftDown(SizeT index) {
+        const SizeT size = heap_.size();
+        for (SizeT child; (child = index * 2 + 1) < size; index = child) {
+            if (child + 1 < size && Better(heap_[child], heap_[child + 1])) {
+                ++child;
+            }
+            if (!Better(heap_[index], heap_[child])) {
+                break;
+            }
+            std::swap(heap_[index], heap_[child]);
+        }
+    }
+
+    u32 limit_{};
+    Vector<Entry> heap_;
+};
+
+template <typename KeyT, typename MakeKeys>
+u32 SolveTopByKey(u32 limit,
+                  const Vector<UniquePtr<DataBlock>> &input_data_block_array,
+                  MakeKeys &&make_keys,
+                  Vector<UniquePtr<DataBlock>> &output_data_block_array) {
+    TopKeySolver<KeyT> solver(limit);
+    Vector<KeyT> keys;
+    for (u32 block_id = 0; block_id < input_data_block_array.size(); ++block_id) {
+        keys.clear();
+        make_keys(block_id, input_data_block_array[block_id]->row_count(), keys);
+        solver.AddBlock(block_id, keys);
+    }
+    Vector<Pair<u32, u32>> rows = solver.SortedRows();
+    SortedRowAppender appender(output_data_block_array);
+    for (const auto &[block_id, row_id] : rows) {
+        appender.Append(input_data_block_array[block_id].get(), row_id);
+    }
+    appender.Finish();
+    return rows.size();
+}
+
 std::function<std::strong_ordering(const SharedPtr<ColumnVector> &, u32, const SharedPtr<ColumnVector> &, u32)>
 InvalidPhysicalTopCompareType(const DataType &type_) {
     return [type_name = type_.ToString()](const SharedPtr<ColumnVector> &, u32, const SharedPtr<ColumnVector> &, u32) -> std::strong_ordering {
@@ -320,36 +436,108 @@ void PhysicalTop::Init() {
         sort_functions.emplace_back(GenerateSortFunction(order_by_types_[i], sort_expressions_[i]));
     }
     prefer_left_function_ = CompareTwoRowAndPreferLeft(std::move(sort_functions));
+
+    bool fixed_width = true;
+    bool supported = true;
+    Vector<SharedPtr<DataType>> key_types;
+    for (const auto &sort_expression : sort_expressions_) {
+        auto key_type = MakeShared<DataType>(sort_expression->Type());
+        fixed_width = fixed_width && SortKeyEncoder::FixedWidth(*key_type);
+        supported = supported && SortKeyEncoder::Supported(*key_type);
+        key_types.emplace_back(std::move(key_type));
+    }
+    if (fixed_width && sort_expr_count_ == 1) {
+        key_kind_ = TopKeyKind::kOneFixed;
+    } else if (fixed_width && sort_expr_count_ == 2) {
+        key_kind_ = TopKeyKind::kTwoFixed;
+    } else if (supported) {
+        key_kind_ = TopKeyKind::kBinary;
+        key_encoder_ = MakeUnique<SortKeyEncoder>(std::move(key_types), order_by_types_);
+    } else {
+        key_kind_ = TopKeyKind::kCompare;
+    }
 }
 
-// Behavior now: always sort the output results
+u32 PhysicalTop::SolveTop(const Vector<Vector<SharedPtr<ColumnVector>>> &eval_columns,
+                          const Vector<UniquePtr<DataBlock>> &input_data_block_array,
+                          Vector<UniquePtr<DataBlock>> &output_data_block_array) const {
+    switch (key_kind_) {
+        case TopKeyKind::kOneFixed: {
+            const DataType key_type = sort_expressions_[0]->Type();
+            auto make_keys = [&](u32 block_id, SizeT row_count, Vector<u64> &keys) {
+                const ColumnVector &column = *eval_columns[block_id][0];
+                for (SizeT row_id = 0; row_id < row_count; ++row_id) {
+                    keys.emplace_back(SortKeyEncoder::EncodeFixed(column, key_type, order_by_types_[0], row_id));
+                }
+            };
+            return SolveTopByKey<u64>(limit_, input_data_block_array, make_keys, output_data_block_array);
+        }
+        case TopKeyKind::kTwoFixed: {
+            const DataType first_type = sort_expressions_[0]->Type();
+            const DataType second_type = sort_expressions_[1]->Type();
+            auto make_keys = [&](u32 block_id, SizeT row_count, Vector<Pair<u64, u64>> &keys) {
+                const ColumnVector &first = *eval_columns[block_id][0];
+                const ColumnVector &second = *eval_columns[block_id][1];
+                for (SizeT row_id = 0; row_id < row_count; ++row_id) {
+                    keys.emplace_back(SortKeyEncoder::EncodeFixed(first, first_type, order_by_types_[0], row_id),
+                                      SortKeyEncoder::EncodeFixed(second, second_type, order_by_types_[1], row_id));
+                }
+            };
+            return SolveTopByKey<Pair<u64, u64>>(limit_, input_data_block_array, make_keys, output_data_block_array);
+        }
+        case TopKeyKind::kBinary: {
+            // The keys refer to the encoded bytes, which live until the output is written.
+            Vector<SortKeys> block_keys(input_data_block_array.size());
+            auto make_keys = [&](u32 block_id, SizeT row_count, Vector<std::string_view> &keys) {
+                SortKeys &sort_keys = block_keys[block_id];
+                key_encoder_->Encode(eval_columns[block_id], row_count, sort_keys);
+                for (SizeT row_id = 0; row_id < row_count; ++row_id) {
+                    keys.emplace_back(sort_keys.Key(row_id));
+                }
+            };
+            return SolveTopByKey<std::string_view>(limit_, input_data_block_array, make_keys, output_data_block_array);
+        }
+        case TopKeyKind::kCompare: {
+            TopSolver solve_top(limit_, prefer_left_function_);
+            return solve_top.WriteTopResultsToOutput(eval_columns, input_data_block_array, output_data_block_array);
+        }
+    }
+    return 0;
+}
+
+// The top rows are kept in the operator state across the executions, the input blocks of each execution are merged
+// into them, and the sorted result is output when the input is complete.
 bool PhysicalTop::Execute(QueryContext *, OperatorState *operator_state) {
+    auto *top_operator_state = static_cast<TopOperatorState *>(operator_state);
     auto prev_op_state = operator_state->prev_op_state_;
-    if ((offset_ != 0) and !(prev_op_state->Complete())) {
-        UnrecoverableError("Only 1 PhysicalTop job but !(prev_op_state->Complete())");
-    }
     auto &input_data_block_array = prev_op_state->data_block_array_;
     auto &output_data_block_array = operator_state->data_block_array_;
-    // sometimes the input_data_block_array is empty, but the operator is not complete
-    if (std::accumulate(input_data_block_array.begin(), input_data_block_array.end(), 0, [](u32 x, const auto &y) -> u32 {
-            return x + y->row_count();
-        }) == 0) {
-        if (prev_op_state->Complete()) {
-            operator_state->SetComplete();
-        }
-        return true;
-    }
     if (!output_data_block_array.empty()) {
         UnrecoverableError("output data_block_array_ is not empty");
     }
-    auto eval_columns = GetEvalColumns(sort_expressions_, (static_cast<TopOperatorState *>(operator_state))->expr_states_, input_data_block_array);
-    TopSolver solve_top(limit_, prefer_left_function_);
-    auto output_row_cnt = solve_top.WriteTopResultsToOutput(eval_columns, input_data_block_array, output_data_block_array);
+    // The kept top rows go first, they are before the rows of this execution.
+    Vector<UniquePtr<DataBlock>> candidate_blocks = std::move(top_operator_state->top_blocks_);
+    top_operator_state->top_blocks_.clear();
+    for (auto &input_data_block : input_data_block_array) {
+        if (input_data_block.get() != nullptr && input_data_block->row_count() > 0) {
+            candidate_blocks.emplace_back(std::move(input_data_block));
+        }
+    }
     input_data_block_array.clear();
-    HandleOutputOffset(output_row_cnt, offset_, output_data_block_array);
-    if (prev_op_state->Complete()) {
-        operator_state->SetComplete();
+
+    Vector<UniquePtr<DataBlock>> top_blocks;
+    u32 output_row_cnt = 0;
+    if (!candidate_blocks.empty()) {
+        auto eval_columns = GetEvalColumns(sort_expressions_, top_operator_state->expr_states_, candidate_blocks);
+        output_row_cnt = SolveTop(eval_columns, candidate_blocks, top_blocks);
+    }
+    if (!prev_op_state->Complete()) {
+        top_operator_state->top_blocks_ = std::move(top_blocks);
+        return true;
     }
+    output_data_block_array = std::move(top_blocks);
+    HandleOutputOffset(output_row_cnt, offset_, output_data_block_array);
+    operator_state->SetComplete();
     return true;
 }
 
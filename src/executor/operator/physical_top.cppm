@@ -35,6 +35,7 @@ import physical_limit;
 import internal_types;
 import select_statement;
 import data_type;
+import sort_key;
 
 namespace infinity {
 
@@ -64,6 +65,15 @@ private:
         sort_functions_; // sort functions
 };
 
+// How PhysicalTop compares the rows: one or two fixed width sort keys are normalized into integers, the other supported
+// types into binary keys, and the types without a sort key encoding are compared with CompareTwoRowAndPreferLeft.
+export enum class TopKeyKind {
+    kOneFixed,
+    kTwoFixed,
+    kBinary,
+    kCompare,
+};
+
 export class PhysicalTop : public PhysicalOperator {
 public:
     explicit PhysicalTop(u64 id,
@@ -116,12 +126,18 @@ public:
     GenerateSortFunction(OrderType compare_order, SharedPtr<BaseExpression> &sort_expression);
 
 private:
+    u32 SolveTop(const Vector<Vector<SharedPtr<ColumnVector>>> &eval_columns,
+                 const Vector<UniquePtr<DataBlock>> &input_data_block_array,
+                 Vector<UniquePtr<DataBlock>> &output_data_block_array) const;
+
     u32 limit_{};                                        // limit value
     u32 offset_{};                                       // offset value
     u32 sort_expr_count_{};                              // number of expressions to sort
     Vector<OrderType> order_by_types_;                   // ASC or DESC
     Vector<SharedPtr<BaseExpression>> sort_expressions_; // expressions to sort
     CompareTwoRowAndPreferLeft prefer_left_function_;    // compare function
+    TopKeyKind key_kind_{TopKeyKind::kCompare};          // key used by the heap
+    UniquePtr<SortKeyEncoder> key_encoder_;              // for TopKeyKind::kBinary
     // TODO: save a common threshold value for all tasks
 };
 
@@ -14,6 +14,7 @@
 
 module;
 
+import stl;
 import query_context;
 import operator_state;
 
@@ -23,6 +24,19 @@ namespace infinity {
 
 void PhysicalUnionAll::Init() {}
 
-bool PhysicalUnionAll::Execute(QueryContext *, OperatorState *) { return true; }
+bool PhysicalUnionAll::Execute(QueryContext *, OperatorState *operator_state) {
+    auto *union_all_operator_state = static_cast<UnionAllOperatorState *>(operator_state);
+
+    // Each execution outputs the blocks received since the last execution, the order of the rows across inputs is unspecified.
+    for (auto &input_data_block : union_all_operator_state->input_data_blocks_) {
+        union_all_operator_state->data_block_array_.emplace_back(std::move(input_data_block));
+    }
+    union_all_operator_state->input_data_blocks_.clear();
+
+    if (union_all_operator_state->input_complete_) {
+        union_all_operator_state->SetComplete();
+    }
+    return true;
+}
 
 } // namespace infinity
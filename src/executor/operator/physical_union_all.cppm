@@ -31,10 +31,18 @@ import data_type;
 
 namespace infinity {
 
+// UNION ALL of the outputs of the inputs. Each input runs in its own child fragment, the blocks of the inputs are passed
+// through to the output as they arrive, without being copied.
 export class PhysicalUnionAll : public PhysicalOperator {
 public:
-    explicit PhysicalUnionAll(u64 id, SharedPtr<Vector<LoadMeta>> load_metas)
-        : PhysicalOperator(PhysicalOperatorType::kUnionAll, nullptr, nullptr, id, load_metas) {}
+    explicit PhysicalUnionAll(u64 id,
+                              UniquePtr<PhysicalOperator> left,
+                              UniquePtr<PhysicalOperator> right,
+                              SharedPtr<Vector<String>> output_names,
+                              SharedPtr<Vector<SharedPtr<DataType>>> output_types,
+                              SharedPtr<Vector<LoadMeta>> load_metas)
+        : PhysicalOperator(PhysicalOperatorType::kUnionAll, std::move(left), std::move(right), id, load_metas),
+          output_names_(std::move(output_names)), output_types_(std::move(output_types)) {}
 
     ~PhysicalUnionAll() override = default;
 
@@ -35,11 +35,34 @@ import expression_type;
 import base_expression;
 import logical_type;
 import internal_types;
+import txn;
+import txn_store;
+import table_entry;
+import block_column_entry;
+import column_def;
 
 namespace infinity {
 
 void PhysicalUpdate::Init() {}
 
+bool PhysicalUpdate::UpdateInPlace(QueryContext *query_context) {
+    if (!update_in_place_.has_value()) {
+        Txn *txn = query_context->GetTxn();
+        bool in_place = true;
+        for (const auto &[column_idx, _] : update_columns_) {
+            const ColumnDef *column_def = table_entry_ptr_->GetColumnDefByID(column_idx);
+            // The indexes are built on the appended rows, an indexed column is updated by delete and append.
+            if (!BlockColumnEntry::InPlaceUpdatable(*column_def->type()) ||
+                table_entry_ptr_->ColumnIndexed(txn->TxnID(), txn->BeginTS(), column_def->name())) {
+                in_place = false;
+                break;
+            }
+        }
+        update_in_place_ = in_place;
+    }
+    return update_in_place_.value();
+}
+
 bool PhysicalUpdate::Execute(QueryContext *query_context, OperatorState *operator_state) {
     OperatorState* prev_op_state = operator_state->prev_op_state_;
     SizeT input_data_block_count = prev_op_state->data_block_array_.size();
@@ -74,10 +97,26 @@ bool PhysicalUpdate::Execute(QueryContext *query_context, OperatorState *operato
                 column_vectors[column_idx] = output_column;
             }
 
-            SharedPtr<DataBlock> output_data_block = DataBlock::Make();
-            output_data_block->Init(column_vectors);
-            txn->Append(db_name, *table_name, output_data_block);
-            txn->Delete(db_name, *table_name, row_ids);
+            Vector<ColumnID> updated_column_ids;
+            for (const auto &[column_idx, _] : update_columns_) {
+                updated_column_ids.push_back(column_idx);
+            }
+            if (UpdateInPlace(query_context)) {
+                // Only the updated columns are written, the other columns and the row ids stay.
+                Vector<SharedPtr<ColumnVector>> updated_column_vectors;
+                for (ColumnID column_id : updated_column_ids) {
+                    updated_column_vectors.push_back(column_vectors[column_id]);
+                }
+                SharedPtr<DataBlock> updated_data_block = DataBlock::Make();
+                updated_data_block->Init(updated_column_vectors);
+                txn->Update(db_name, *table_name, row_ids, updated_column_ids, updated_data_block);
+            } else {
+                SharedPtr<DataBlock> output_data_block = DataBlock::Make();
+                output_data_block->Init(column_vectors);
+                txn->Append(db_name, *table_name, output_data_block);
+                txn->Delete(db_name, *table_name, row_ids);
+                txn->GetTxnTableStore(table_entry_ptr_)->AddUpdatedColumns(updated_column_ids);
+            }
 
             UpdateOperatorState* update_operator_state = static_cast<UpdateOperatorState*>(operator_state);
             ++ update_operator_state->count_;
@@ -60,8 +60,12 @@ public:
     const Vector<Pair<SizeT, SharedPtr<BaseExpression>>> &update_columns_;
 
 private:
+    // Whether all updated columns are fixed-width and not indexed, so the rows are updated in place instead of appended again.
+    bool UpdateInPlace(QueryContext *query_context);
+
     SharedPtr<Vector<String>> output_names_{};
     SharedPtr<Vector<SharedPtr<DataType>>> output_types_{};
+    Optional<bool> update_in_place_{};
 };
 
 } // namespace infinity
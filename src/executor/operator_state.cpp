@@ -90,13 +90,114 @@ bool QueueSourceState::GetData() {
             merge_knn_op_state->input_complete_ = completed;
             break;
         }
+        case PhysicalOperatorType::kMergeMatch: {
+            auto *merge_match_op_state = (MergeMatchOperatorState *)next_op_state;
+            if (fragment_data_base->type_ == FragmentDataType::kData) {
+                auto *fragment_data = static_cast<FragmentData *>(fragment_data_base.get());
+                merge_match_op_state->input_data_block_ = std::move(fragment_data->data_block_);
+            }
+            merge_match_op_state->input_complete_ = completed;
+            break;
+        }
         case PhysicalOperatorType::kFusion: {
-            auto *fragment_data = static_cast<FragmentData *>(fragment_data_base.get());
             FusionOperatorState *fusion_op_state = (FusionOperatorState *)next_op_state;
-            fusion_op_state->input_data_blocks_[fragment_data->fragment_id_].push_back(std::move(fragment_data->data_block_));
+            // An input without rows still gets its entry, so the entries stay in the order of the inputs
+            auto &input_blocks = fusion_op_state->input_data_blocks_[fragment_data_base->fragment_id_];
+            if (fragment_data_base->type_ == FragmentDataType::kData) {
+                auto *fragment_data = static_cast<FragmentData *>(fragment_data_base.get());
+                input_blocks.push_back(std::move(fragment_data->data_block_));
+            }
             fusion_op_state->input_complete_ = completed;
             break;
         }
+        case PhysicalOperatorType::kAggregate: {
+            auto *aggregate_op_state = (AggregateOperatorState *)next_op_state;
+            if (fragment_data_base->type_ == FragmentDataType::kData) {
+                auto *fragment_data = static_cast<FragmentData *>(fragment_data_base.get());
+                UniquePtr<DataBlock> &data_block = fragment_data->data_block_;
+                if (data_block.get() != nullptr && data_block->row_count() > 0) {
+                    aggregate_op_state->input_data_blocks_.push_back(std::move(data_block));
+                }
+            }
+            aggregate_op_state->input_complete_ = completed;
+            break;
+        }
+        case PhysicalOperatorType::kMergeParallelAggregate: {
+            auto *merge_aggregate_op_state = (MergeParallelAggregateOperatorState *)next_op_state;
+            if (fragment_data_base->type_ == FragmentDataType::kData) {
+                auto *fragment_data = static_cast<FragmentData *>(fragment_data_base.get());
+                UniquePtr<DataBlock> &data_block = fragment_data->data_block_;
+                if (data_block.get() != nullptr && data_block->row_count() > 0) {
+                    merge_aggregate_op_state->input_data_blocks_.push_back(std::move(data_block));
+                }
+            }
+            merge_aggregate_op_state->input_complete_ = completed;
+            break;
+        }
+        case PhysicalOperatorType::kMergeSort: {
+            auto *merge_sort_op_state = (MergeSortOperatorState *)next_op_state;
+            if (fragment_data_base->type_ == FragmentDataType::kData) {
+                auto *fragment_data = static_cast<FragmentData *>(fragment_data_base.get());
+                UniquePtr<DataBlock> &data_block = fragment_data->data_block_;
+                if (data_block.get() != nullptr && data_block->row_count() > 0) {
+                    SizeT run_idx = fragment_data->task_id_;
+                    if (run_idx >= merge_sort_op_state->input_runs_.size()) {
+                        merge_sort_op_state->input_runs_.resize(run_idx + 1);
+                    }
+                    merge_sort_op_state->buffered_bytes_ += data_block->GetSizeInBytes();
+                    merge_sort_op_state->input_runs_[run_idx].push_back(std::move(data_block));
+                }
+            }
+            merge_sort_op_state->input_complete_ = completed;
+            break;
+        }
+        case PhysicalOperatorType::kJoinHash: {
+            auto *hash_join_op_state = (HashJoinOperatorState *)next_op_state;
+            if (fragment_data_base->type_ == FragmentDataType::kData) {
+                auto *fragment_data = static_cast<FragmentData *>(fragment_data_base.get());
+                UniquePtr<DataBlock> &data_block = fragment_data->data_block_;
+                if (data_block.get() != nullptr && data_block->row_count() > 0) {
+                    hash_join_op_state->buffered_bytes_ += data_block->GetSizeInBytes();
+                    if (fragment_data->fragment_id_ == hash_join_op_state->left_fragment_id_) {
+                        hash_join_op_state->probe_data_blocks_.push_back(std::move(data_block));
+                    } else {
+                        hash_join_op_state->build_data_blocks_.push_back(std::move(data_block));
+                    }
+                }
+            }
+            hash_join_op_state->input_complete_ = completed;
+            break;
+        }
+        case PhysicalOperatorType::kJoinMerge: {
+            auto *merge_join_op_state = (MergeJoinOperatorState *)next_op_state;
+            if (fragment_data_base->type_ == FragmentDataType::kData) {
+                auto *fragment_data = static_cast<FragmentData *>(fragment_data_base.get());
+                UniquePtr<DataBlock> &data_block = fragment_data->data_block_;
+                if (data_block.get() != nullptr && data_block->row_count() > 0) {
+                    auto &task_blocks = fragment_data->fragment_id_ == merge_join_op_state->left_fragment_id_ ? merge_join_op_state->left_task_blocks_
+                                                                                                             : merge_join_op_state->right_task_blocks_;
+                    SizeT task_id = fragment_data->task_id_;
+                    if (task_id >= task_blocks.size()) {
+                        task_blocks.resize(task_id + 1);
+                    }
+                    task_blocks[task_id].push_back(std::move(data_block));
+                }
+            }
+            merge_join_op_state->input_complete_ = completed;
+            break;
+        }
+        case PhysicalOperatorType::kUnionAll: {
+            auto *union_all_op_state = (UnionAllOperatorState *)next_op_state;
+            if (fragment_data_base->type_ == FragmentDataType::kData) {
+                auto *fragment_data = static_cast<FragmentData *>(fragment_data_base.get());
+                UniquePtr<DataBlock> &data_block = fragment_data->data_block_;
+                if (data_block.get() != nullptr && data_block->row_count() > 0) {
+                    union_all_op_state->input_data_blocks_.push_back(std::move(data_block));
+                }
+            }
+            union_all_op_state->input_complete_ = completed;
+            break;
+        }
         case PhysicalOperatorType::kMergeLimit: {
             auto *fragment_data = static_cast<FragmentData *>(fragment_data_base.get());
             MergeLimitOperatorState *limit_op_state = (MergeLimitOperatorState *)next_op_state;
@@ -27,12 +27,20 @@ import table_def;
 
 import merge_knn_data;
 import create_index_data;
+import export_data;
+import match_scan_data;
+import fulltext_score_result_heap;
 import blocking_queue;
 import expression_state;
+import fused_expression;
 import status;
 import internal_types;
 import column_def;
 import data_type;
+import value;
+import aggregate_hash_table;
+import sort_key;
+import query_memory_tracker;
 
 namespace infinity {
 
@@ -67,6 +75,15 @@ export struct AggregateOperatorState : public OperatorState {
         : OperatorState(PhysicalOperatorType::kAggregate), states_(std::move(states)) {}
 
     Vector<UniquePtr<char[]>> states_;
+
+    // Group by aggregate is the first op, the input data comes from the child fragments.
+    Vector<UniquePtr<DataBlock>> input_data_blocks_{};
+    bool input_complete_{false};
+
+    // Aggregate states of each group.
+    UniquePtr<AggregateHashTable> hash_table_{};
+    // The hash table charged to the query memory tracker.
+    MemoryReservation memory_reservation_{};
 };
 
 // Merge Aggregate
@@ -77,21 +94,42 @@ export struct MergeAggregateOperatorState : public OperatorState {
     // Vector<UniquePtr<DataBlock>> input_data_blocks_{nullptr};
     UniquePtr<DataBlock> input_data_block_{nullptr};
     bool input_complete_{false};
+    // The merged state of each sketch aggregate, null for the other aggregates.
+    Vector<UniquePtr<char[]>> sketch_states_{};
 };
 
 // Merge Parallel Aggregate
 export struct MergeParallelAggregateOperatorState : public OperatorState {
     inline explicit MergeParallelAggregateOperatorState() : OperatorState(PhysicalOperatorType::kMergeParallelAggregate) {}
+
+    // Partial results of one partition, sent by every task of the parallel aggregate.
+    Vector<UniquePtr<DataBlock>> input_data_blocks_{};
+    bool input_complete_{false};
+
+    UniquePtr<AggregateHashTable> hash_table_{};
+    // The hash table charged to the query memory tracker.
+    MemoryReservation memory_reservation_{};
 };
 
 // Parallel Aggregate
 export struct ParallelAggregateOperatorState : public OperatorState {
     inline explicit ParallelAggregateOperatorState() : OperatorState(PhysicalOperatorType::kParallelAggregate) {}
+
+    // Partial aggregate states of the input of this task.
+    UniquePtr<AggregateHashTable> hash_table_{};
+    // Partition of each output block, the block is only sent to the merge task of the partition.
+    Vector<SizeT> partition_ids_{};
+    // The hash table charged to the query memory tracker.
+    MemoryReservation memory_reservation_{};
 };
 
 // UnionAll
 export struct UnionAllOperatorState : public OperatorState {
     inline explicit UnionAllOperatorState() : OperatorState(PhysicalOperatorType::kUnionAll) {}
+
+    // Blocks of all inputs received since the last execution.
+    Vector<UniquePtr<DataBlock>> input_data_blocks_{};
+    bool input_complete_{false};
 };
 
 // TableScan
@@ -99,6 +137,10 @@ export struct TableScanOperatorState : public OperatorState {
     inline explicit TableScanOperatorState() : OperatorState(PhysicalOperatorType::kTableScan) {}
 
     UniquePtr<TableScanFunctionData> table_scan_function_data_{};
+
+    // The partial result of the statistics aggregates of the scan over the blocks answered from their metadata, one value for each
+    // aggregate, empty if no block was answered. The aggregate of the task outputs it once the scan is complete.
+    Vector<Value> statistics_partial_{};
 };
 
 // KnnScan
@@ -116,11 +158,21 @@ export struct MergeKnnOperatorState : public OperatorState {
     UniquePtr<DataBlock> input_data_block_{nullptr}; // Since merge knn is the first op, no previous operator state. This ptr is to get input data.
     bool input_complete_{false};
     SharedPtr<MergeKnnFunctionData> merge_knn_function_data_{};
+    // The merge heap charged to the query memory tracker.
+    MemoryReservation memory_reservation_{};
 };
 
 // Filter
 export struct FilterOperatorState : public OperatorState {
     inline explicit FilterOperatorState() : OperatorState(PhysicalOperatorType::kFilter) {}
+
+    // Output blocks share the input columns with a selection, when the next operator accepts such blocks.
+    bool keep_selection_{false};
+    // The state of the condition, its intermediate outputs are reused for each input block
+    SharedPtr<ExpressionState> condition_state_{};
+    // Input blocks evaluated so far, the condition is run by a fused program once the filter is hot
+    SizeT evaluated_block_count_{};
+    SharedPtr<FusedExpression> fused_condition_{};
 };
 
 // IndexScan
@@ -129,6 +181,7 @@ export struct IndexScanOperatorState : public OperatorState {
         : OperatorState(PhysicalOperatorType::kIndexScan), segment_ids_(std::move(segment_ids)) {}
     UniquePtr<Vector<SegmentID>> segment_ids_; // moved from IndexScanSourceState
     u32 next_idx_{};
+    SizeT output_row_count_{}; // rows output by the task, it stops at the row limit of the scan
 };
 
 // Hash
@@ -144,6 +197,20 @@ export struct MergeHashOperatorState : public OperatorState {
 // Hash Join
 export struct HashJoinOperatorState : public OperatorState {
     inline explicit HashJoinOperatorState() : OperatorState(PhysicalOperatorType::kJoinHash) {}
+
+    // Hash join is the first op, no previous operator state.
+    // This is to tell op that both inputs are drained.
+    bool input_complete_{false};
+    // Data from this fragment is the left input (probe side), others are the right input (build side).
+    u64 left_fragment_id_{};
+    // This is to cache the input data before being partitioned into the spill files.
+    Vector<UniquePtr<DataBlock>> probe_data_blocks_{};
+    Vector<UniquePtr<DataBlock>> build_data_blocks_{};
+    SizeT buffered_bytes_{};
+    // The cached input charged to the query memory tracker.
+    MemoryReservation memory_reservation_{};
+    // Directory of the spill files, set when the cached input exceeds the query memory limit.
+    SharedPtr<String> spill_dir_{};
 };
 
 // Nested Loop
@@ -154,6 +221,16 @@ export struct NestedLoopOperatorState : public OperatorState {
 // Merge Join
 export struct MergeJoinOperatorState : public OperatorState {
     inline explicit MergeJoinOperatorState() : OperatorState(PhysicalOperatorType::kJoinMerge) {}
+
+    // Sort merge join is the first op, no previous operator state.
+    // This is to tell op that both inputs are drained.
+    bool input_complete_{false};
+    // Data from this fragment is the left input, others are the right input.
+    u64 left_fragment_id_{};
+    // Input blocks of each task of the child fragments, indexed by task id.
+    // The blocks of a task keep the order of the task output, so the input order is kept by concatenating the tasks.
+    Vector<Vector<UniquePtr<DataBlock>>> left_task_blocks_{};
+    Vector<Vector<UniquePtr<DataBlock>>> right_task_blocks_{};
 };
 
 // Index Join
@@ -193,11 +270,21 @@ export struct MergeTopOperatorState : public OperatorState {
 export struct TopOperatorState : public OperatorState {
     inline explicit TopOperatorState() : OperatorState(PhysicalOperatorType::kTop) {}
     Vector<SharedPtr<ExpressionState>> expr_states_; // expression states
+    Vector<UniquePtr<DataBlock>> top_blocks_;        // top rows of the input so far, sorted
 };
 
 // Projection
 export struct ProjectionOperatorState : public OperatorState {
     inline explicit ProjectionOperatorState() : OperatorState(PhysicalOperatorType::kProjection) {}
+
+    // Column references of an input with a selection are passed without copying, when the next operator accepts such blocks.
+    bool keep_selection_{false};
+    // The states of the expressions, their intermediate outputs are reused for each input block
+    Vector<SharedPtr<ExpressionState>> expr_states_{};
+    // Input blocks evaluated so far, the expressions are run by fused programs once the projection is hot
+    SizeT evaluated_block_count_{};
+    // The program of each expression, null if it has none
+    Vector<SharedPtr<FusedExpression>> fused_expressions_{};
 };
 
 // Sort
@@ -205,11 +292,29 @@ export struct SortOperatorState : public OperatorState {
     inline explicit SortOperatorState() : OperatorState(PhysicalOperatorType::kSort) {}
     Vector<SharedPtr<ExpressionState>> expr_states_; // expression states
     Vector<UniquePtr<DataBlock>> unmerge_sorted_blocks_{};
+    // Each input batch is sorted into a run by the sort keys, the runs are merged when the input is complete.
+    Vector<Vector<UniquePtr<DataBlock>>> sorted_runs_{};
+    Vector<SortKeys> run_keys_{};
+    SizeT sorted_runs_bytes_{};
+    // The sorted runs charged to the query memory tracker.
+    MemoryReservation memory_reservation_{};
 };
 
 // Merge Sort
 export struct MergeSortOperatorState : public OperatorState {
     inline explicit MergeSortOperatorState() : OperatorState(PhysicalOperatorType::kMergeSort) {}
+    Vector<SharedPtr<ExpressionState>> expr_states_; // expression states
+    // The sorted run of each sort task, indexed by the task id. The blocks of a run are received in order.
+    Vector<Vector<UniquePtr<DataBlock>>> input_runs_{};
+    bool input_complete_{false};
+    SizeT buffered_bytes_{};
+    // The cached runs charged to the query memory tracker.
+    MemoryReservation memory_reservation_{};
+    // Directory of the spill files, set when the cached runs exceed the query memory limit.
+    SharedPtr<String> spill_dir_{};
+    // Rows of each run written to the spill files.
+    Vector<SizeT> spilled_row_counts_{};
+    SizeT max_spilled_record_size_{};
 };
 
 // Delete
@@ -247,6 +352,13 @@ export struct ImportOperatorState : public OperatorState {
 // Export
 export struct ExportOperatorState : public OperatorState {
     inline explicit ExportOperatorState() : OperatorState(PhysicalOperatorType::kExport) {}
+
+    // Blocks of the segments exported by this task, in the order of segment.
+    Vector<GlobalBlockID> block_ids_{};
+    SizeT block_ids_idx_{0};
+
+    ExportSharedData *export_shared_data_{nullptr};
+    UniquePtr<String> result_msg_{};
 };
 
 // Alter
@@ -347,6 +459,23 @@ export struct OptimizeOperatorState : public OperatorState {
 // Match
 export struct MatchOperatorState : public OperatorState {
     inline explicit MatchOperatorState() : OperatorState(PhysicalOperatorType::kMatch) {}
+
+    // Sorted segments searched by this task of a parallel match, null when the match runs in one task.
+    SharedPtr<Vector<SegmentID>> segment_ids_{};
+    MatchSharedData *match_shared_data_{nullptr};
+};
+
+// Merge Match
+export struct MergeMatchOperatorState : public OperatorState {
+    inline explicit MergeMatchOperatorState() : OperatorState(PhysicalOperatorType::kMergeMatch) {}
+
+    UniquePtr<DataBlock> input_data_block_{};
+    bool input_complete_{false};
+
+    // Top n of the results of all match tasks
+    UniquePtr<float[]> score_result_{};
+    UniquePtr<RowID[]> row_id_result_{};
+    UniquePtr<FullTextScoreResultHeap> result_heap_{};
 };
 
 // Fusion
@@ -407,10 +536,10 @@ export struct AggregateSourceState : public SourceState {
 };
 
 export struct TableScanSourceState : public SourceState {
-    explicit TableScanSourceState(SharedPtr<Vector<GlobalBlockID>> global_ids)
-        : SourceState(SourceStateType::kTableScan), global_ids_(std::move(global_ids)) {}
+    explicit TableScanSourceState(SharedPtr<TableScanSharedData> shared_data)
+        : SourceState(SourceStateType::kTableScan), shared_data_(std::move(shared_data)) {}
 
-    SharedPtr<Vector<GlobalBlockID>> global_ids_;
+    SharedPtr<TableScanSharedData> shared_data_; // shared by all tasks of the scan
 };
 
 export struct IndexScanSourceState : public SourceState {
@@ -31,6 +31,9 @@ import block_entry;
 import block_column_entry;
 import logical_type;
 import internal_types;
+import buffer_manager;
+import load_meta;
+import txn;
 
 namespace infinity {
 
@@ -40,21 +43,52 @@ void PhysicalOperator::InputLoad(QueryContext *query_context, OperatorState *ope
     if (load_metas_.get() == nullptr || load_metas_->empty()) {
         return;
     }
-//    TxnTimeStamp begin_ts = query_context->GetTxn()->BeginTS();
+    TxnTimeStamp begin_ts = query_context->GetTxn()->BeginTS();
 
-    auto load_metas = *load_metas_.get();
+    const Vector<LoadMeta> &load_metas = *load_metas_;
     // FIXME: After columnar reading is supported, use a different table_ref for each LoadMetas
     auto table_ref = table_refs[load_metas[0].binding_.table_idx];
     if (table_ref.get() == nullptr) {
         UnrecoverableError("TableRef not found!");
     }
+    BufferManager *buffer_manager = query_context->storage()->buffer_manager();
+    SizeT load_column_count = load_metas.size();
+
+    // The loaded columns of a storage block, the rows of an input block often come from a few blocks.
+    struct LoadedBlock {
+        Vector<const BlockColumnEntry *> entries_;
+        Vector<ColumnVector> columns_;
+    };
+    HashMap<u64, LoadedBlock> block_columns;
+    auto get_block_columns = [&](SegmentID segment_id, BlockID block_id) -> const LoadedBlock & {
+        u64 block_key = (u64(segment_id) << 32) | block_id;
+        auto iter = block_columns.find(block_key);
+        if (iter != block_columns.end()) {
+            return iter->second;
+        }
+        const BlockEntry *block_entry = table_ref->block_index_->GetBlockEntry(segment_id, block_id);
+        if (block_entry == nullptr) {
+            UnrecoverableError(fmt::format("Cannot find block segment id: {}, block id: {}", segment_id, block_id));
+        }
+        LoadedBlock loaded_block;
+        loaded_block.entries_.reserve(load_column_count);
+        loaded_block.columns_.reserve(load_column_count);
+        for (SizeT k = 0; k < load_column_count; ++k) {
+            BlockColumnEntry *block_column_ptr = block_entry->GetColumnBlockEntry(load_metas[k].binding_.column_idx);
+            loaded_block.entries_.push_back(block_column_ptr);
+            loaded_block.columns_.emplace_back(block_column_ptr->GetColumnVector(buffer_manager));
+        }
+        return block_columns.emplace(block_key, std::move(loaded_block)).first->second;
+    };
 
     for (SizeT i = 0; i < operator_state->prev_op_state_->data_block_array_.size(); ++i) {
         auto input_block = operator_state->prev_op_state_->data_block_array_[i].get();
-        SizeT load_column_count = load_metas_->size();
 
         u16 row_count = input_block->row_count();
         SizeT capacity = input_block->capacity();
+        // The row id is the last input column, the loaded columns are inserted after it.
+        auto row_column_id = input_block->column_count() - 1;
+        const RowID *row_ids = reinterpret_cast<const RowID *>(input_block->column_vectors[row_column_id]->data());
 
         // Filling ColumnVector
         for (SizeT j = 0; j < load_column_count; ++j) {
@@ -66,24 +100,26 @@ void PhysicalOperator::InputLoad(QueryContext *query_context, OperatorState *ope
             input_block->InsertVector(column_vector, load_metas[j].index_);
         }
 
-        auto row_column_id = input_block->column_count() - 1;
-
-        for (SizeT j = 0; j < row_count; ++j) {
+        // Consecutive rows of the same storage block are copied in one batch.
+        for (SizeT j = 0; j < row_count;) {
             // If late materialization needs to be optional, then this needs to be modified
-            RowID row_id = input_block->GetValue(row_column_id, j).value_.row;
-            u32 segment_id = row_id.segment_id_;
-            u32 segment_offset = row_id.segment_offset_;
+            u32 segment_id = row_ids[j].segment_id_;
+            u32 segment_offset = row_ids[j].segment_offset_;
+            SizeT run_end = j + 1;
+            while (run_end < row_count && row_ids[run_end].segment_id_ == segment_id &&
+                   row_ids[run_end].segment_offset_ == segment_offset + (run_end - j) &&
+                   (segment_offset + (run_end - j)) % DEFAULT_BLOCK_CAPACITY != 0) {
+                ++run_end;
+            }
             u16 block_id = segment_offset / DEFAULT_BLOCK_CAPACITY;
             u16 block_offset = segment_offset % DEFAULT_BLOCK_CAPACITY;
 
-            const BlockEntry *block_entry = table_ref->block_index_->GetBlockEntry(segment_id, block_id);
+            const LoadedBlock &loaded_block = get_block_columns(segment_id, block_id);
             for (SizeT k = 0; k < load_column_count; ++k) {
-                auto binding = load_metas[k].binding_;
-                BlockColumnEntry *block_column_ptr = block_entry->GetColumnBlockEntry(binding.column_idx);
-
-                ColumnVector column_vector = block_column_ptr->GetColumnVector(query_context->storage()->buffer_manager());
-                input_block->column_vectors[load_metas[k].index_]->AppendWith(column_vector, block_offset, 1);
+                ColumnVector &output_column = *input_block->column_vectors[load_metas[k].index_];
+                loaded_block.entries_[k]->ReadRows(output_column, loaded_block.columns_[k], block_offset, run_end - j, begin_ts);
             }
+            j = run_end;
         }
     }
 }
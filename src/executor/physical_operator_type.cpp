@@ -126,6 +126,8 @@ String PhysicalOperatorToString(PhysicalOperatorType type) {
             return "Command";
         case PhysicalOperatorType::kMatch:
             return "Match";
+        case PhysicalOperatorType::kMergeMatch:
+            return "MergeMatch";
         case PhysicalOperatorType::kFusion:
             return "Fusion";
         case PhysicalOperatorType::kMergeAggregate:
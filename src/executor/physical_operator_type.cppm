@@ -40,6 +40,7 @@ export enum class PhysicalOperatorType : i8 {
     kKnnScan,
     kMergeKnn,
     kMatch,
+    kMergeMatch,
     kFusion,
 
     kHash,
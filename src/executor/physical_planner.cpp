@@ -41,6 +41,7 @@ import physical_flush;
 import physical_optimize;
 import physical_hash;
 import physical_hash_join;
+import physical_sort_merge_join;
 import physical_index_join;
 import physical_import;
 import physical_index_scan;
@@ -72,6 +73,7 @@ import physical_update;
 import physical_drop_index;
 import physical_command;
 import physical_match;
+import physical_merge_match;
 import physical_fusion;
 import physical_create_index_prepare;
 import physical_create_index_do;
@@ -124,6 +126,23 @@ import create_index_info;
 import command_statement;
 import explain_statement;
 import load_meta;
+import catalog;
+import storage;
+import aggregate_function;
+import aggregate_function_set;
+import aggregate_expression;
+import reference_expression;
+import base_expression;
+import data_type;
+import sort_key;
+import expression_type;
+import table_entry;
+import txn;
+import column_statistics;
+import default_values;
+import knn_expression;
+import knn_expr;
+import internal_types;
 
 namespace infinity {
 
@@ -310,14 +329,16 @@ UniquePtr<PhysicalOperator> PhysicalPlanner::BuildPhysicalOperator(const SharedP
 
 UniquePtr<PhysicalOperator> PhysicalPlanner::BuildCreateTable(const SharedPtr<LogicalNode> &logical_operator) const {
     SharedPtr<LogicalCreateTable> logical_create_table = static_pointer_cast<LogicalCreateTable>(logical_operator);
-    return MakeUnique<PhysicalCreateTable>(logical_create_table->schema_name(),
-                                           logical_create_table->table_definitions(),
-                                           logical_create_table->GetOutputNames(),
-                                           logical_create_table->GetOutputTypes(),
-                                           logical_create_table->conflict_type(),
-                                           logical_create_table->table_index(),
-                                           logical_operator->node_id(),
-                                           logical_operator->load_metas());
+    auto create_table_op = MakeUnique<PhysicalCreateTable>(logical_create_table->schema_name(),
+                                                           logical_create_table->table_definitions(),
+                                                           logical_create_table->GetOutputNames(),
+                                                           logical_create_table->GetOutputTypes(),
+                                                           logical_create_table->conflict_type(),
+                                                           logical_create_table->table_index(),
+                                                           logical_operator->node_id(),
+                                                           logical_operator->load_metas());
+    create_table_op->set_clone_table_name(logical_create_table->clone_table_name());
+    return create_table_op;
 }
 
 UniquePtr<PhysicalOperator> PhysicalPlanner::BuildCreateIndex(const SharedPtr<LogicalNode> &logical_operator) const {
@@ -460,7 +481,8 @@ UniquePtr<PhysicalOperator> PhysicalPlanner::BuildInsert(const SharedPtr<Logical
                                       logical_insert_ptr->table_entry(),
                                       logical_insert_ptr->table_index(),
                                       logical_insert_ptr->value_list(),
-                                      logical_operator->load_metas());
+                                      logical_operator->load_metas(),
+                                      logical_insert_ptr->data_blocks());
 }
 
 UniquePtr<PhysicalOperator> PhysicalPlanner::BuildDelete(const SharedPtr<LogicalNode> &logical_operator) const {
@@ -512,6 +534,8 @@ UniquePtr<PhysicalOperator> PhysicalPlanner::BuildImport(const SharedPtr<Logical
 UniquePtr<PhysicalOperator> PhysicalPlanner::BuildExport(const SharedPtr<LogicalNode> &logical_operator) const {
     LogicalExport *logical_export = (LogicalExport *)(logical_operator.get());
     return MakeUnique<PhysicalExport>(logical_export->node_id(),
+                                      logical_export->table_entry(),
+                                      logical_export->block_index(),
                                       logical_export->schema_name(),
                                       logical_export->table_name(),
                                       logical_export->file_path(),
@@ -541,15 +565,40 @@ UniquePtr<PhysicalOperator> PhysicalPlanner::BuildAggregate(const SharedPtr<Logi
 
     SizeT tasklet_count = input_physical_operator->TaskletCount();
 
+    bool statistics_partial = false;
+    if (!logical_aggregate->statistics_aggregates_.empty()) {
+        PhysicalOperator *scan_operator = input_physical_operator.get();
+        while (scan_operator->operator_type() == PhysicalOperatorType::kFilter) {
+            scan_operator = scan_operator->left();
+        }
+        if (scan_operator->operator_type() == PhysicalOperatorType::kTableScan) {
+            static_cast<PhysicalTableScan *>(scan_operator)->SetStatisticsAggregates(logical_aggregate->statistics_aggregates_);
+            statistics_partial = true;
+        }
+    }
+
+    if (tasklet_count > 1 && !logical_aggregate->groups_.empty()) {
+        // Group by aggregate on the input of multiple tasks is aggregated in two phases.
+        UniquePtr<PhysicalOperator> parallel_agg_op = BuildParallelAggregate(logical_operator, input_physical_operator);
+        if (parallel_agg_op.get() != nullptr) {
+            return parallel_agg_op;
+        }
+    }
+
+    // The results of the aggregate without group by of multiple tasks are merged by the merge aggregate.
+    bool merge_results = logical_aggregate->groups_.empty() && (tasklet_count != 1 || statistics_partial);
     auto physical_agg_op = MakeUnique<PhysicalAggregate>(logical_aggregate->node_id(),
                                                          std::move(input_physical_operator),
                                                          logical_aggregate->groups_,
                                                          logical_aggregate->groupby_index_,
-                                                         logical_aggregate->aggregates_,
+                                                         merge_results ? PartialAggregates(logical_aggregate->aggregates_)
+                                                                       : logical_aggregate->aggregates_,
                                                          logical_aggregate->aggregate_index_,
                                                          logical_operator->load_metas());
 
-    if (tasklet_count == 1) {
+    if (!merge_results) {
+        // Group by aggregate runs in one task on all input. The partial result of the blocks answered from their metadata is
+        // merged with the one of the rows read, even for one task.
         return physical_agg_op;
     } else {
         return MakeUnique<PhysicalMergeAggregate>(query_context_ptr_->GetNextNodeID(),
@@ -562,6 +611,139 @@ UniquePtr<PhysicalOperator> PhysicalPlanner::BuildAggregate(const SharedPtr<Logi
     }
 }
 
+UniquePtr<PhysicalOperator> PhysicalPlanner::BuildParallelAggregate(const SharedPtr<LogicalNode> &logical_operator,
+                                                                    UniquePtr<PhysicalOperator> &input_physical_operator) const {
+    // The partial aggregate runs in the tasks of the scan, the rows of a scan task are only aggregated by the task.
+    PhysicalOperator *scan_operator = input_physical_operator.get();
+    while (scan_operator->operator_type() == PhysicalOperatorType::kFilter) {
+        scan_operator = scan_operator->left();
+    }
+    if (scan_operator->operator_type() != PhysicalOperatorType::kTableScan && scan_operator->operator_type() != PhysicalOperatorType::kIndexScan) {
+        return nullptr;
+    }
+
+    SharedPtr<LogicalAggregate> logical_aggregate = static_pointer_cast<LogicalAggregate>(logical_operator);
+    const Vector<SharedPtr<BaseExpression>> &groups = logical_aggregate->groups_;
+    const Vector<SharedPtr<BaseExpression>> &aggregates = logical_aggregate->aggregates_;
+
+    // The partial results are the group by keys followed by the partial result of each aggregate.
+    // The merge groups them by the keys again, and merges the partial results with another aggregate, e.g. SUM on the partial COUNT.
+    Vector<SharedPtr<BaseExpression>> merge_groups;
+    merge_groups.reserve(groups.size());
+    for (SizeT group_idx = 0; group_idx < groups.size(); ++group_idx) {
+        merge_groups.emplace_back(ReferenceExpression::Make(groups[group_idx]->Type(), String(), groups[group_idx]->Name(), String(), group_idx));
+    }
+    Catalog *catalog = query_context_ptr_->storage()->catalog();
+    Vector<SharedPtr<BaseExpression>> partial_aggregates = PartialAggregates(aggregates);
+    Vector<SharedPtr<BaseExpression>> merge_aggregates;
+    merge_aggregates.reserve(aggregates.size());
+    for (SizeT aggregate_idx = 0; aggregate_idx < aggregates.size(); ++aggregate_idx) {
+        auto *aggregate_expression = static_cast<AggregateExpression *>(aggregates[aggregate_idx].get());
+        SharedPtr<BaseExpression> partial_result = ReferenceExpression::Make(partial_aggregates[aggregate_idx]->Type(),
+                                                                             String(),
+                                                                             aggregate_expression->Name(),
+                                                                             String(),
+                                                                             groups.size() + aggregate_idx);
+        if (aggregate_expression->aggregate_function_.IsSketch()) {
+            // The states of the tasks are merged into the result.
+            AggregateFunction merge_function = *aggregate_expression->aggregate_function_.merge_function_;
+            merge_aggregates.emplace_back(MakeShared<AggregateExpression>(merge_function, Vector<SharedPtr<BaseExpression>>{partial_result}));
+            continue;
+        }
+
+        String function_name = aggregate_expression->aggregate_function_.GetFuncName();
+        String merge_function_name;
+        if (function_name == "COUNT" || function_name == "SUM") {
+            merge_function_name = "SUM";
+        } else if (function_name == "MIN" || function_name == "MAX" || function_name == "FIRST") {
+            merge_function_name = function_name;
+        } else {
+            return nullptr;
+        }
+        auto merge_function_set = static_pointer_cast<AggregateFunctionSet>(Catalog::GetFunctionSetByName(catalog, merge_function_name));
+        AggregateFunction merge_function = merge_function_set->GetMostMatchFunction(partial_result);
+        if (merge_function.argument_type_ != partial_result->Type() || merge_function.return_type() != aggregate_expression->Type()) {
+            return nullptr;
+        }
+        merge_aggregates.emplace_back(MakeShared<AggregateExpression>(merge_function, Vector<SharedPtr<BaseExpression>>{partial_result}));
+    }
+
+    // Few groups are merged by few tasks, the partial results of each task are then small.
+    SizeT partition_count = query_context_ptr_->cpu_number_limit();
+    if (Optional<SizeT> group_count = EstimateGroupCount(scan_operator, groups); group_count.has_value()) {
+        SizeT needed_partitions = (*group_count + AGGREGATE_PARTITION_MIN_GROUPS - 1) / AGGREGATE_PARTITION_MIN_GROUPS;
+        partition_count = std::clamp<SizeT>(needed_partitions, 1, partition_count);
+    }
+    auto parallel_agg_op = MakeUnique<PhysicalParallelAggregate>(logical_aggregate->node_id(),
+                                                                 std::move(input_physical_operator),
+                                                                 groups,
+                                                                 logical_aggregate->groupby_index_,
+                                                                 std::move(partial_aggregates),
+                                                                 logical_aggregate->aggregate_index_,
+                                                                 partition_count,
+                                                                 logical_operator->load_metas());
+    SharedPtr<Vector<String>> output_names = parallel_agg_op->GetOutputNames();
+    SharedPtr<Vector<SharedPtr<DataType>>> output_types = parallel_agg_op->GetOutputTypes();
+    for (SizeT aggregate_idx = 0; aggregate_idx < aggregates.size(); ++aggregate_idx) {
+        (*output_types)[groups.size() + aggregate_idx] = MakeShared<DataType>(aggregates[aggregate_idx]->Type());
+    }
+    return MakeUnique<PhysicalMergeParallelAggregate>(query_context_ptr_->GetNextNodeID(),
+                                                      std::move(parallel_agg_op),
+                                                      std::move(merge_groups),
+                                                      std::move(merge_aggregates),
+                                                      std::move(output_names),
+                                                      std::move(output_types),
+                                                      partition_count,
+                                                      logical_operator->load_metas());
+}
+
+Vector<SharedPtr<BaseExpression>> PhysicalPlanner::PartialAggregates(const Vector<SharedPtr<BaseExpression>> &aggregates) {
+    Vector<SharedPtr<BaseExpression>> partial_aggregates;
+    partial_aggregates.reserve(aggregates.size());
+    for (const auto &aggregate : aggregates) {
+        auto *aggregate_expression = static_cast<AggregateExpression *>(aggregate.get());
+        if (!aggregate_expression->aggregate_function_.IsSketch()) {
+            partial_aggregates.emplace_back(aggregate);
+            continue;
+        }
+        auto partial_aggregate = MakeShared<AggregateExpression>(aggregate_expression->aggregate_function_.PartialFunction(),
+                                                                 aggregate_expression->arguments());
+        partial_aggregate->alias_ = aggregate_expression->alias_;
+        partial_aggregates.emplace_back(std::move(partial_aggregate));
+    }
+    return partial_aggregates;
+}
+
+Optional<SizeT> PhysicalPlanner::EstimateGroupCount(PhysicalOperator *scan_operator, const Vector<SharedPtr<BaseExpression>> &groups) const {
+    if (scan_operator->operator_type() != PhysicalOperatorType::kTableScan) {
+        return None;
+    }
+    auto *table_scan = static_cast<PhysicalTableScan *>(scan_operator);
+    TableEntry *table_entry = table_scan->TableEntry();
+    const Vector<SizeT> &column_ids = table_scan->ColumnIDs();
+    const TxnTimeStamp begin_ts = query_context_ptr_->GetTxn()->BeginTS();
+    const SizeT table_row_count = table_entry->row_count();
+    SizeT group_count = 1;
+    for (const auto &group : groups) {
+        if (group->type() != ExpressionType::kReference) {
+            return None;
+        }
+        SizeT column_idx = static_cast<const ReferenceExpression *>(group.get())->column_index();
+        if (column_idx >= column_ids.size()) {
+            return None;
+        }
+        Optional<ColumnStatistics> statistics = table_entry->GetColumnStatistics(column_ids[column_idx], begin_ts);
+        if (!statistics.has_value()) {
+            return None;
+        }
+        // the rows without statistics may all be other values, NULL is a group too
+        SizeT uncovered_rows = table_row_count > statistics->row_count_ ? table_row_count - statistics->row_count_ : 0;
+        SizeT distinct_count = statistics->DistinctCount() + (statistics->null_count_ > 0 ? 1 : 0) + uncovered_rows;
+        group_count = std::min(group_count * distinct_count, std::max<SizeT>(table_row_count, 1));
+    }
+    return group_count;
+}
+
 UniquePtr<PhysicalOperator> PhysicalPlanner::BuildJoin(const SharedPtr<LogicalNode> &logical_operator) const {
 
     auto left_node = logical_operator->left_node();
@@ -582,6 +764,31 @@ UniquePtr<PhysicalOperator> PhysicalPlanner::BuildJoin(const SharedPtr<LogicalNo
     left_physical_operator = BuildPhysicalOperator(left_node);
     right_physical_operator = BuildPhysicalOperator(right_node);
 
+    // Both inputs are already in the order of join keys, merge them instead of building a hash table.
+    if (PhysicalSortMergeJoin::CanUseSortMergeJoin(logical_join->join_type_,
+                                                   logical_join->conditions_,
+                                                   left_physical_operator.get(),
+                                                   right_physical_operator.get())) {
+        return MakeUnique<PhysicalSortMergeJoin>(logical_operator->node_id(),
+                                                 logical_join->join_type_,
+                                                 logical_join->conditions_,
+                                                 std::move(left_physical_operator),
+                                                 std::move(right_physical_operator),
+                                                 logical_operator->load_metas());
+    }
+
+    SizeT left_column_count = left_physical_operator->GetOutputTypes()->size();
+    if (PhysicalHashJoin::CanUseHashJoin(logical_join->join_type_, logical_join->conditions_, left_column_count)) {
+        auto hash_join = MakeUnique<PhysicalHashJoin>(logical_operator->node_id(),
+                                                      logical_join->join_type_,
+                                                      logical_join->conditions_,
+                                                      std::move(left_physical_operator),
+                                                      std::move(right_physical_operator),
+                                                      logical_operator->load_metas());
+        hash_join->PlanRuntimeFilter();
+        return hash_join;
+    }
+
     return MakeUnique<PhysicalNestedLoopJoin>(logical_operator->node_id(),
                                               logical_join->join_type_,
                                               logical_join->conditions_,
@@ -630,11 +837,41 @@ UniquePtr<PhysicalOperator> PhysicalPlanner::BuildSort(const SharedPtr<LogicalNo
 
     SharedPtr<LogicalSort> logical_sort = static_pointer_cast<LogicalSort>(logical_operator);
 
-    return MakeUnique<PhysicalSort>(logical_operator->node_id(),
-                                    std::move(input_physical_operator),
-                                    logical_sort->expressions_,
-                                    logical_sort->order_by_types_,
-                                    logical_operator->load_metas());
+    // Each scan task sorts its rows into a sorted run, and the runs are merged on the binary sort keys.
+    bool parallel_sort = true;
+    PhysicalOperator *scan_operator = input_physical_operator.get();
+    while (scan_operator->operator_type() == PhysicalOperatorType::kFilter) {
+        scan_operator = scan_operator->left();
+    }
+    if (scan_operator->operator_type() != PhysicalOperatorType::kTableScan && scan_operator->operator_type() != PhysicalOperatorType::kIndexScan) {
+        parallel_sort = false;
+    } else if (scan_operator->TaskletCount() <= 1) {
+        parallel_sort = false;
+    }
+    for (const auto &expression : logical_sort->expressions_) {
+        if (!SortKeyEncoder::Supported(expression->Type())) {
+            parallel_sort = false;
+        }
+    }
+
+    if (!parallel_sort) {
+        return MakeUnique<PhysicalSort>(logical_operator->node_id(),
+                                        std::move(input_physical_operator),
+                                        logical_sort->expressions_,
+                                        logical_sort->order_by_types_,
+                                        logical_operator->load_metas());
+    }
+    auto child_sort_op = MakeUnique<PhysicalSort>(logical_operator->node_id(),
+                                                  std::move(input_physical_operator),
+                                                  logical_sort->expressions_,
+                                                  logical_sort->order_by_types_,
+                                                  logical_operator->load_metas());
+    return MakeUnique<PhysicalMergeSort>(query_context_ptr_->GetNextNodeID(),
+                                         logical_sort->base_table_ref_,
+                                         std::move(child_sort_op),
+                                         logical_sort->expressions_,
+                                         logical_sort->order_by_types_,
+                                         MakeShared<Vector<LoadMeta>>());
 }
 
 UniquePtr<PhysicalOperator> PhysicalPlanner::BuildLimit(const SharedPtr<LogicalNode> &logical_operator) const {
@@ -765,15 +1002,28 @@ UniquePtr<PhysicalOperator> PhysicalPlanner::BuildFilter(const SharedPtr<Logical
 }
 
 UniquePtr<PhysicalOperator> PhysicalPlanner::BuildIntersect(const SharedPtr<LogicalNode> &logical_operator) const {
-    return MakeUnique<PhysicalHashJoin>(logical_operator->node_id(), logical_operator->load_metas());
+    return MakeUnique<PhysicalIntersect>(logical_operator->GetOutputNames(),
+                                         logical_operator->GetOutputTypes(),
+                                         logical_operator->node_id(),
+                                         logical_operator->load_metas());
 }
 
 UniquePtr<PhysicalOperator> PhysicalPlanner::BuildUnion(const SharedPtr<LogicalNode> &logical_operator) const {
-    return MakeUnique<PhysicalUnionAll>(logical_operator->node_id(), logical_operator->load_metas());
+    auto left_physical_operator = BuildPhysicalOperator(logical_operator->left_node());
+    auto right_physical_operator = BuildPhysicalOperator(logical_operator->right_node());
+    return MakeUnique<PhysicalUnionAll>(logical_operator->node_id(),
+                                        std::move(left_physical_operator),
+                                        std::move(right_physical_operator),
+                                        logical_operator->GetOutputNames(),
+                                        logical_operator->GetOutputTypes(),
+                                        logical_operator->load_metas());
 }
 
 UniquePtr<PhysicalOperator> PhysicalPlanner::BuildExcept(const SharedPtr<LogicalNode> &logical_operator) const {
-    return MakeUnique<PhysicalHashJoin>(logical_operator->node_id(), logical_operator->load_metas());
+    return MakeUnique<PhysicalExcept>(logical_operator->GetOutputNames(),
+                                      logical_operator->GetOutputTypes(),
+                                      logical_operator->node_id(),
+                                      logical_operator->load_metas());
 }
 
 UniquePtr<PhysicalOperator> PhysicalPlanner::BuildShow(const SharedPtr<LogicalNode> &logical_operator) const {
@@ -793,21 +1043,26 @@ UniquePtr<PhysicalOperator> PhysicalPlanner::BuildTableScan(const SharedPtr<Logi
     SharedPtr<LogicalTableScan> logical_table_scan = static_pointer_cast<LogicalTableScan>(logical_operator);
     return MakeUnique<PhysicalTableScan>(logical_operator->node_id(),
                                          logical_table_scan->base_table_ref_,
-                                         std::move(logical_table_scan->fast_rough_filter_evaluator_),
+                                         logical_table_scan->fast_rough_filter_evaluator_,
                                          logical_operator->load_metas(),
                                          logical_table_scan->add_row_id_);
 }
 
 UniquePtr<PhysicalOperator> PhysicalPlanner::BuildIndexScan(const SharedPtr<LogicalNode> &logical_operator) const {
     SharedPtr<LogicalIndexScan> logical_index_scan = static_pointer_cast<LogicalIndexScan>(logical_operator);
-    return MakeUnique<PhysicalIndexScan>(logical_operator->node_id(),
-                                         logical_index_scan->base_table_ref_,
-                                         logical_index_scan->index_filter_qualified_,
-                                         std::move(logical_index_scan->column_index_map_),
-                                         std::move(logical_index_scan->filter_execute_command_),
-                                         std::move(logical_index_scan->fast_rough_filter_evaluator_),
-                                         logical_operator->load_metas(),
-                                         logical_index_scan->add_row_id_);
+    auto index_scan = MakeUnique<PhysicalIndexScan>(logical_operator->node_id(),
+                                                    logical_index_scan->base_table_ref_,
+                                                    logical_index_scan->index_filter_qualified_,
+                                                    logical_index_scan->column_index_map_,
+                                                    logical_index_scan->filter_execute_command_,
+                                                    logical_index_scan->fast_rough_filter_evaluator_,
+                                                    logical_index_scan->covered_column_id_,
+                                                    logical_operator->load_metas(),
+                                                    logical_index_scan->add_row_id_);
+    if (logical_index_scan->row_limit_.has_value()) {
+        index_scan->SetRowLimit(*logical_index_scan->row_limit_);
+    }
+    return index_scan;
 }
 
 UniquePtr<PhysicalOperator> PhysicalPlanner::BuildViewScan(const SharedPtr<LogicalNode> &logical_operator) const {
@@ -835,11 +1090,31 @@ UniquePtr<PhysicalOperator> PhysicalPlanner::BuildOptimize(const SharedPtr<Logic
 
 UniquePtr<PhysicalOperator> PhysicalPlanner::BuildMatch(const SharedPtr<LogicalNode> &logical_operator) const {
     SharedPtr<LogicalMatch> logical_match = static_pointer_cast<LogicalMatch>(logical_operator);
-    return MakeUnique<PhysicalMatch>(logical_match->node_id(),
-                                     logical_match->base_table_ref_,
-                                     logical_match->match_expr_,
-                                     logical_match->TableIndex(),
-                                     logical_operator->load_metas());
+    UniquePtr<PhysicalMatch> match_op = MakeUnique<PhysicalMatch>(logical_match->node_id(),
+                                                                  logical_match->base_table_ref_,
+                                                                  logical_match->match_expr_,
+                                                                  logical_match->filter_expression_,
+                                                                  logical_match->fast_rough_filter_evaluator_,
+                                                                  logical_match->TableIndex(),
+                                                                  logical_operator->load_metas());
+    if (logical_match->limit_top_n_.has_value()) {
+        match_op->SetLimitTopN(*logical_match->limit_top_n_);
+    }
+    if (match_op->TaskletCount() <= 1) {
+        return match_op;
+    }
+    // Segments are searched by parallel tasks, each task keeps its own top n
+    u32 top_n = match_op->TopN();
+    auto output_names = match_op->GetOutputNames();
+    auto output_types = match_op->GetOutputTypes();
+    return MakeUnique<PhysicalMergeMatch>(query_context_ptr_->GetNextNodeID(),
+                                          logical_match->base_table_ref_,
+                                          std::move(match_op),
+                                          std::move(output_names),
+                                          std::move(output_types),
+                                          top_n,
+                                          logical_match->TableIndex(),
+                                          MakeShared<Vector<LoadMeta>>());
 }
 
 UniquePtr<PhysicalOperator> PhysicalPlanner::BuildFusion(const SharedPtr<LogicalNode> &logical_operator) const {
@@ -857,17 +1132,22 @@ UniquePtr<PhysicalOperator> PhysicalPlanner::BuildFusion(const SharedPtr<Logical
                                       std::move(left_phy),
                                       std::move(right_phy),
                                       logical_fusion->fusion_expr_,
+                                      logical_fusion->base_table_ref_,
                                       logical_operator->load_metas());
 }
 
 UniquePtr<PhysicalOperator> PhysicalPlanner::BuildKnn(const SharedPtr<LogicalNode> &logical_operator) const {
     auto *logical_knn_scan = (LogicalKnnScan *)(logical_operator.get());
-    //    logical_knn_scan->
+    SharedPtr<KnnExpression> knn_expression = logical_knn_scan->knn_expression_;
+    if (knn_query_ != nullptr) {
+        EmbeddingT query_embedding((ptr_t)knn_query_->embedding_data_ptr_, false);
+        knn_expression = MakeShared<KnnExpression>(*knn_expression, std::move(query_embedding));
+    }
     UniquePtr<PhysicalKnnScan> knn_scan_op = MakeUnique<PhysicalKnnScan>(logical_knn_scan->node_id(),
                                                                          logical_knn_scan->base_table_ref_,
-                                                                         logical_knn_scan->knn_expression_,
+                                                                         knn_expression,
                                                                          logical_knn_scan->filter_expression_,
-                                                                         std::move(logical_knn_scan->fast_rough_filter_evaluator_),
+                                                                         logical_knn_scan->fast_rough_filter_evaluator_,
                                                                          logical_knn_scan->GetOutputNames(),
                                                                          logical_knn_scan->GetOutputTypes(),
                                                                          logical_knn_scan->knn_table_index_,
@@ -882,7 +1162,7 @@ UniquePtr<PhysicalOperator> PhysicalPlanner::BuildKnn(const SharedPtr<LogicalNod
                                             std::move(knn_scan_op),
                                             logical_knn_scan->GetOutputNames(),
                                             logical_knn_scan->GetOutputTypes(),
-                                            logical_knn_scan->knn_expression_,
+                                            knn_expression,
                                             logical_knn_scan->knn_table_index_,
                                             MakeShared<Vector<LoadMeta>>());
     }
@@ -896,7 +1176,7 @@ UniquePtr<PhysicalOperator> PhysicalPlanner::BuildCommand(const SharedPtr<Logica
                                            logical_command->GetOutputNames(),
                                            logical_command->GetOutputTypes(),
                                            logical_operator->load_metas());
-    if (command_info->type() == CommandType::kCompactTable) {
+    if (command_info->type() == CommandType::kCompactTable || command_info->type() == CommandType::kWarmup) {
         ret->table_entry_ = logical_command->table_entry_;
     }
     return ret;
@@ -914,10 +1194,6 @@ UniquePtr<PhysicalOperator> PhysicalPlanner::BuildExplain(const SharedPtr<Logica
 
     UniquePtr<PhysicalExplain> explain_node{nullptr};
     switch (logical_explain->explain_type()) {
-        case ExplainType::kAnalyze: {
-            RecoverableError(Status::NotSupport("Not implement: Explain analyze"));
-            break;
-        }
         case ExplainType::kAst:
         case ExplainType::kUnOpt:
         case ExplainType::kOpt: {
@@ -938,6 +1214,7 @@ UniquePtr<PhysicalOperator> PhysicalPlanner::BuildExplain(const SharedPtr<Logica
                                                        logical_operator->load_metas());
             break;
         }
+        case ExplainType::kAnalyze:
         case ExplainType::kFragment:
         case ExplainType::kPipeline: {
             explain_node = MakeUnique<PhysicalExplain>(logical_explain->node_id(),
@@ -17,7 +17,9 @@ module;
 import stl;
 import physical_operator;
 import logical_node;
+import base_expression;
 import query_context;
+import knn_expr;
 
 export module physical_planner;
 namespace infinity {
@@ -28,8 +30,13 @@ public:
 
     [[nodiscard]] UniquePtr<PhysicalOperator> BuildPhysicalOperator(const SharedPtr<LogicalNode> &logical_operator) const;
 
+    // Set when the logical plan comes from the plan cache, the knn scan searches the embedding of this expression instead of
+    // the one bound in the plan.
+    inline void set_knn_query(const KnnExpr *knn_query) { knn_query_ = knn_query; }
+
 private:
     QueryContext *query_context_ptr_;
+    const KnnExpr *knn_query_{};
 
     // Create operator
     [[nodiscard]] UniquePtr<PhysicalOperator> BuildCreateTable(const SharedPtr<LogicalNode> &logical_operator) const;
@@ -76,6 +83,16 @@ private:
     // Select operator
     [[nodiscard]] UniquePtr<PhysicalOperator> BuildAggregate(const SharedPtr<LogicalNode> &logical_operator) const;
 
+    // Two-phase group by aggregate, nullptr if the input or some aggregate can't be aggregated in parallel.
+    [[nodiscard]] UniquePtr<PhysicalOperator> BuildParallelAggregate(const SharedPtr<LogicalNode> &logical_operator,
+                                                                     UniquePtr<PhysicalOperator> &input_physical_operator) const;
+
+    // The groups of a group by on the columns of a table scan estimated by the column statistics, None without statistics.
+    [[nodiscard]] Optional<SizeT> EstimateGroupCount(PhysicalOperator *scan_operator, const Vector<SharedPtr<BaseExpression>> &groups) const;
+
+    // The aggregates outputting the partial results to merge, a sketch aggregate outputs its state.
+    [[nodiscard]] static Vector<SharedPtr<BaseExpression>> PartialAggregates(const Vector<SharedPtr<BaseExpression>> &aggregates);
+
     // Operator
     [[nodiscard]] UniquePtr<PhysicalOperator> BuildJoin(const SharedPtr<LogicalNode> &logical_operator) const;
 
@@ -0,0 +1,420 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <algorithm>
+#include <cstring>
+
+module sort_key;
+
+import stl;
+import data_block;
+import column_vector;
+import default_values;
+import logical_type;
+import internal_types;
+import data_type;
+import select_statement;
+import infinity_exception;
+import third_party;
+
+namespace infinity {
+
+namespace {
+
+// Unsigned integers are compared by memcmp in big endian.
+template <typename T>
+inline void AppendUnsigned(Vector<char> &buffer, T value) {
+    for (i32 shift = sizeof(T) * 8 - 8; shift >= 0; shift -= 8) {
+        buffer.emplace_back(static_cast<char>((value >> shift) & 0xFF));
+    }
+}
+
+// Flipping the sign bit orders the negative values before the positive ones.
+template <typename T>
+inline void AppendSigned(Vector<char> &buffer, T value) {
+    using UnsignedT = std::make_unsigned_t<T>;
+    AppendUnsigned<UnsignedT>(buffer, static_cast<UnsignedT>(value) ^ (UnsignedT(1) << (sizeof(T) * 8 - 1)));
+}
+
+// Positive values only flip the sign bit, negative values flip all bits so that the larger magnitude goes first.
+template <typename FloatType, typename BitsType>
+inline void AppendFloat(Vector<char> &buffer, FloatType value) {
+    static_assert(sizeof(FloatType) == sizeof(BitsType));
+    BitsType bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    constexpr BitsType sign_bit = BitsType(1) << (sizeof(BitsType) * 8 - 1);
+    bits = (bits & sign_bit) ? ~bits : (bits | sign_bit);
+    AppendUnsigned<BitsType>(buffer, bits);
+}
+
+// Chars are compared as signed char like the varchar comparison of ColumnValueReader, so 0x80 is flipped into the lowest byte.
+// The string ends with two zero bytes and a zero byte in the string is escaped as 0x00 0xFF, then a string is ordered before
+// the longer strings it is a prefix of, and no key is a prefix of another key.
+inline void AppendVarchar(Vector<char> &buffer, const char *data, SizeT length) {
+    for (SizeT idx = 0; idx < length; ++idx) {
+        u8 byte = static_cast<u8>(data[idx]) ^ 0x80;
+        buffer.emplace_back(static_cast<char>(byte));
+        if (byte == 0) {
+            buffer.emplace_back(static_cast<char>(0xFF));
+        }
+    }
+    buffer.emplace_back(0);
+    buffer.emplace_back(0);
+}
+
+// Same order as AppendSigned, as an integer.
+template <typename T>
+inline u64 FixedSigned(T value) {
+    using UnsignedT = std::make_unsigned_t<T>;
+    return static_cast<u64>(static_cast<UnsignedT>(value) ^ (UnsignedT(1) << (sizeof(T) * 8 - 1)));
+}
+
+// Same order as AppendFloat, as an integer.
+template <typename FloatType, typename BitsType>
+inline u64 FixedFloat(FloatType value) {
+    BitsType bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    constexpr BitsType sign_bit = BitsType(1) << (sizeof(BitsType) * 8 - 1);
+    return static_cast<u64>((bits & sign_bit) ? ~bits : (bits | sign_bit));
+}
+
+} // namespace
+
+SortKeyEncoder::SortKeyEncoder(Vector<SharedPtr<DataType>> types, Vector<OrderType> order_types)
+    : types_(std::move(types)), order_types_(std::move(order_types)) {
+    if (types_.size() != order_types_.size()) {
+        UnrecoverableError("Sort key types and order types mismatch");
+    }
+    for (const auto &type : types_) {
+        if (!Supported(*type)) {
+            UnrecoverableError(fmt::format("Sort key of {} is not supported", type->ToString()));
+        }
+    }
+}
+
+bool SortKeyEncoder::Supported(const DataType &type) {
+    switch (type.type()) {
+        case LogicalType::kBoolean:
+        case LogicalType::kTinyInt:
+        case LogicalType::kSmallInt:
+        case LogicalType::kInteger:
+        case LogicalType::kBigInt:
+        case LogicalType::kFloat:
+        case LogicalType::kDouble:
+        case LogicalType::kVarchar:
+        case LogicalType::kDate:
+        case LogicalType::kTime:
+        case LogicalType::kDateTime:
+        case LogicalType::kTimestamp: {
+            return true;
+        }
+        default: {
+            return false;
+        }
+    }
+}
+
+bool SortKeyEncoder::FixedWidth(const DataType &type) { return type.type() != LogicalType::kVarchar && Supported(type); }
+
+u64 SortKeyEncoder::EncodeFixed(const ColumnVector &column, const DataType &type, OrderType order_type, SizeT row_idx) {
+    if (column.vector_type() == ColumnVectorType::kConstant) {
+        row_idx = 0;
+    }
+    u64 key = 0;
+    switch (type.type()) {
+        case LogicalType::kBoolean: {
+            key = column.buffer_->GetCompactBit(row_idx) ? 1 : 0;
+            break;
+        }
+        case LogicalType::kTinyInt: {
+            key = FixedSigned<TinyIntT>(reinterpret_cast<const TinyIntT *>(column.data())[row_idx]);
+            break;
+        }
+        case LogicalType::kSmallInt: {
+            key = FixedSigned<SmallIntT>(reinterpret_cast<const SmallIntT *>(column.data())[row_idx]);
+            break;
+        }
+        case LogicalType::kInteger: {
+            key = FixedSigned<IntegerT>(reinterpret_cast<const IntegerT *>(column.data())[row_idx]);
+            break;
+        }
+        case LogicalType::kBigInt: {
+            key = FixedSigned<BigIntT>(reinterpret_cast<const BigIntT *>(column.data())[row_idx]);
+            break;
+        }
+        case LogicalType::kFloat: {
+            key = FixedFloat<FloatT, u32>(reinterpret_cast<const FloatT *>(column.data())[row_idx]);
+            break;
+        }
+        case LogicalType::kDouble: {
+            key = FixedFloat<DoubleT, u64>(reinterpret_cast<const DoubleT *>(column.data())[row_idx]);
+            break;
+        }
+        case LogicalType::kDate: {
+            key = FixedSigned<i32>(reinterpret_cast<const DateT *>(column.data())[row_idx].value);
+            break;
+        }
+        case LogicalType::kTime: {
+            key = FixedSigned<i32>(reinterpret_cast<const TimeT *>(column.data())[row_idx].value);
+            break;
+        }
+        case LogicalType::kDateTime: {
+            const DateTimeT &datetime = reinterpret_cast<const DateTimeT *>(column.data())[row_idx];
+            key = (FixedSigned<i32>(datetime.date.value) << 32) | FixedSigned<i32>(datetime.time.value);
+            break;
+        }
+        case LogicalType::kTimestamp: {
+            const TimestampT &timestamp = reinterpret_cast<const TimestampT *>(column.data())[row_idx];
+            key = (FixedSigned<i32>(timestamp.date.value) << 32) | FixedSigned<i32>(timestamp.time.value);
+            break;
+        }
+        default: {
+            UnrecoverableError(fmt::format("Fixed width sort key of {} is not supported", type.ToString()));
+        }
+    }
+    return order_type == OrderType::kDesc ? ~key : key;
+}
+
+void SortKeyEncoder::Encode(const Vector<SharedPtr<ColumnVector>> &columns, SizeT row_count, SortKeys &keys) const {
+    if (columns.size() != types_.size()) {
+        UnrecoverableError("Sort key column count mismatch");
+    }
+    Vector<char> &buffer = keys.data_;
+    for (SizeT row_idx = 0; row_idx < row_count; ++row_idx) {
+        for (SizeT column_idx = 0; column_idx < columns.size(); ++column_idx) {
+            const ColumnVector &column = *columns[column_idx];
+            SizeT value_idx = column.vector_type() == ColumnVectorType::kConstant ? 0 : row_idx;
+            SizeT start = buffer.size();
+            EncodeValue(column, *types_[column_idx], value_idx, buffer);
+            if (order_types_[column_idx] == OrderType::kDesc) {
+                for (SizeT idx = start; idx < buffer.size(); ++idx) {
+                    buffer[idx] = ~buffer[idx];
+                }
+            }
+        }
+        keys.offsets_.emplace_back(buffer.size());
+    }
+}
+
+void SortKeyEncoder::EncodeValue(const ColumnVector &column, const DataType &type, SizeT row_idx, Vector<char> &buffer) const {
+    switch (type.type()) {
+        case LogicalType::kBoolean: {
+            buffer.emplace_back(column.buffer_->GetCompactBit(row_idx) ? 1 : 0);
+            break;
+        }
+        case LogicalType::kTinyInt: {
+            AppendSigned<TinyIntT>(buffer, reinterpret_cast<const TinyIntT *>(column.data())[row_idx]);
+            break;
+        }
+        case LogicalType::kSmallInt: {
+            AppendSigned<SmallIntT>(buffer, reinterpret_cast<const SmallIntT *>(column.data())[row_idx]);
+            break;
+        }
+        case LogicalType::kInteger: {
+            AppendSigned<IntegerT>(buffer, reinterpret_cast<const IntegerT *>(column.data())[row_idx]);
+            break;
+        }
+        case LogicalType::kBigInt: {
+            AppendSigned<BigIntT>(buffer, reinterpret_cast<const BigIntT *>(column.data())[row_idx]);
+            break;
+        }
+        case LogicalType::kFloat: {
+            AppendFloat<FloatT, u32>(buffer, reinterpret_cast<const FloatT *>(column.data())[row_idx]);
+            break;
+        }
+        case LogicalType::kDouble: {
+            AppendFloat<DoubleT, u64>(buffer, reinterpret_cast<const DoubleT *>(column.data())[row_idx]);
+            break;
+        }
+        case LogicalType::kVarchar: {
+            const VarcharT &varchar = reinterpret_cast<const VarcharT *>(column.data())[row_idx];
+            if (varchar.IsInlined()) {
+                AppendVarchar(buffer, varchar.short_.data_, varchar.length_);
+            } else {
+                Vector<char> chars(varchar.length_);
+                column.buffer_->fix_heap_mgr_->ReadFromHeap(chars.data(), varchar.vector_.chunk_id_, varchar.vector_.chunk_offset_, varchar.length_);
+                AppendVarchar(buffer, chars.data(), chars.size());
+            }
+            break;
+        }
+        case LogicalType::kDate: {
+            AppendSigned<i32>(buffer, reinterpret_cast<const DateT *>(column.data())[row_idx].value);
+            break;
+        }
+        case LogicalType::kTime: {
+            AppendSigned<i32>(buffer, reinterpret_cast<const TimeT *>(column.data())[row_idx].value);
+            break;
+        }
+        case LogicalType::kDateTime: {
+            const DateTimeT &datetime = reinterpret_cast<const DateTimeT *>(column.data())[row_idx];
+            AppendSigned<i32>(buffer, datetime.date.value);
+            AppendSigned<i32>(buffer, datetime.time.value);
+            break;
+        }
+        case LogicalType::kTimestamp: {
+            const TimestampT &timestamp = reinterpret_cast<const TimestampT *>(column.data())[row_idx];
+            AppendSigned<i32>(buffer, timestamp.date.value);
+            AppendSigned<i32>(buffer, timestamp.time.value);
+            break;
+        }
+        default: {
+            UnrecoverableError(fmt::format("Sort key of {} is not supported", type.ToString()));
+        }
+    }
+}
+
+SortKeyLoserTree::SortKeyLoserTree(Vector<Optional<std::string_view>> keys) : keys_(std::move(keys)) {
+    SizeT run_count = keys_.size();
+    // Index run_count is a virtual run winning all matches, it is knocked out of the tree by the real runs.
+    losers_.assign(run_count, run_count);
+    for (SizeT run = run_count; run > 0; --run) {
+        Replay(run - 1);
+    }
+}
+
+void SortKeyLoserTree::ReplaceWinner(Optional<std::string_view> key) {
+    keys_[winner_] = key;
+    Replay(winner_);
+}
+
+bool SortKeyLoserTree::Less(SizeT left_run, SizeT right_run) const {
+    SizeT run_count = keys_.size();
+    if (left_run == run_count || right_run == run_count) {
+        return left_run == run_count && right_run != run_count;
+    }
+    const Optional<std::string_view> &left_key = keys_[left_run];
+    const Optional<std::string_view> &right_key = keys_[right_run];
+    if (!left_key.has_value() || !right_key.has_value()) {
+        // The exhausted runs lose to all other runs.
+        if (left_key.has_value() != right_key.has_value()) {
+            return left_key.has_value();
+        }
+        return left_run < right_run;
+    }
+    int compare = left_key->compare(*right_key);
+    return compare < 0 || (compare == 0 && left_run < right_run);
+}
+
+void SortKeyLoserTree::Replay(SizeT run) {
+    SizeT run_count = keys_.size();
+    for (SizeT node = (run + run_count) / 2; node > 0; node /= 2) {
+        if (Less(losers_[node], run)) {
+            std::swap(losers_[node], run);
+        }
+    }
+    winner_ = run;
+}
+
+void SortedRowAppender::Append(const DataBlock *input_block, SizeT row_idx) {
+    if (input_block == pending_block_ && row_idx == pending_start_ + pending_count_ &&
+        output_row_count_ + pending_count_ < (SizeT)DEFAULT_BLOCK_CAPACITY) {
+        ++pending_count_;
+        return;
+    }
+    Flush();
+    pending_block_ = input_block;
+    pending_start_ = row_idx;
+    pending_count_ = 1;
+}
+
+void SortedRowAppender::Flush() {
+    if (pending_count_ == 0) {
+        return;
+    }
+    if (output_block_ == nullptr) {
+        output_blocks_.emplace_back(DataBlock::MakeUniquePtr());
+        output_block_ = output_blocks_.back().get();
+        output_block_->Init(pending_block_->types());
+    }
+    output_block_->AppendWith(pending_block_, pending_start_, pending_count_);
+    output_row_count_ += pending_count_;
+    pending_count_ = 0;
+    if (output_row_count_ == (SizeT)DEFAULT_BLOCK_CAPACITY) {
+        output_block_->Finalize();
+        output_block_ = nullptr;
+        output_row_count_ = 0;
+    }
+}
+
+void SortedRowAppender::Finish() {
+    Flush();
+    if (output_block_ != nullptr) {
+        output_block_->Finalize();
+        output_block_ = nullptr;
+    }
+}
+
+void MergeSortedRuns(const Vector<Vector<UniquePtr<DataBlock>>> &runs, const Vector<SortKeys> &run_keys, Vector<UniquePtr<DataBlock>> &output_blocks) {
+    SizeT run_count = runs.size();
+    if (run_keys.size() != run_count) {
+        UnrecoverableError("Sort keys of the runs mismatch");
+    }
+
+    // Cursor of each run: the block, the row in the block, and the row in the run.
+    Vector<SizeT> block_ids(run_count, 0);
+    Vector<SizeT> block_rows(run_count, 0);
+    Vector<SizeT> run_rows(run_count, 0);
+    auto skip_empty_blocks = [&](SizeT run) {
+        while (block_ids[run] < runs[run].size() && block_rows[run] == runs[run][block_ids[run]]->row_count()) {
+            ++block_ids[run];
+            block_rows[run] = 0;
+        }
+    };
+    auto current_key = [&](SizeT run) -> Optional<std::string_view> {
+        if (run_rows[run] == run_keys[run].Count()) {
+            return None;
+        }
+        return run_keys[run].Key(run_rows[run]);
+    };
+
+    Vector<Optional<std::string_view>> first_keys;
+    first_keys.reserve(run_count);
+    for (SizeT run = 0; run < run_count; ++run) {
+        skip_empty_blocks(run);
+        first_keys.emplace_back(current_key(run));
+    }
+
+    SortKeyLoserTree loser_tree(std::move(first_keys));
+    SortedRowAppender appender(output_blocks);
+    while (!loser_tree.Empty()) {
+        SizeT run = loser_tree.Winner();
+        if (block_ids[run] == runs[run].size()) {
+            UnrecoverableError("Sort keys are more than the rows of the run");
+        }
+        appender.Append(runs[run][block_ids[run]].get(), block_rows[run]);
+        ++block_rows[run];
+        ++run_rows[run];
+        skip_empty_blocks(run);
+        loser_tree.ReplaceWinner(current_key(run));
+    }
+    appender.Finish();
+}
+
+Vector<u32> OrderByFixedKeys(const Vector<u64> &keys) {
+    // the row index breaks the ties, so an unstable sort of the pairs keeps the order of equal keys
+    Vector<Pair<u64, u32>> keyed_rows(keys.size());
+    for (u32 row = 0; row < keys.size(); ++row) {
+        keyed_rows[row] = {keys[row], row};
+    }
+    std::sort(keyed_rows.begin(), keyed_rows.end());
+    Vector<u32> order(keys.size());
+    for (u32 i = 0; i < keys.size(); ++i) {
+        order[i] = keyed_rows[i].second;
+    }
+    return order;
+}
+
+} // namespace infinity
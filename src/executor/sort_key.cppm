@@ -0,0 +1,131 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module sort_key;
+
+import stl;
+import data_block;
+import column_vector;
+import internal_types;
+import data_type;
+import select_statement;
+
+namespace infinity {
+
+// Binary sort keys of rows. The ORDER BY values of a row are encoded into bytes, so that comparing two keys with memcmp
+// gives the same order as comparing the values one by one with the order types.
+export struct SortKeys {
+    inline SizeT Count() const { return offsets_.size() - 1; }
+
+    inline std::string_view Key(SizeT row_idx) const {
+        return std::string_view(data_.data() + offsets_[row_idx], offsets_[row_idx + 1] - offsets_[row_idx]);
+    }
+
+    inline void AppendKey(std::string_view key) {
+        data_.insert(data_.end(), key.begin(), key.end());
+        offsets_.emplace_back(data_.size());
+    }
+
+    inline void Clear() {
+        data_.clear();
+        offsets_.assign(1, 0);
+    }
+
+    Vector<char> data_{};
+    // The key of row i is [offsets_[i], offsets_[i + 1]) of data_.
+    Vector<SizeT> offsets_{0};
+};
+
+export class SortKeyEncoder {
+public:
+    SortKeyEncoder(Vector<SharedPtr<DataType>> types, Vector<OrderType> order_types);
+
+    // Whether the values of the type can be encoded into sort keys.
+    static bool Supported(const DataType &type);
+
+    // Whether the sort key of the type fits in 8 bytes, then EncodeFixed gives the key as an integer.
+    static bool FixedWidth(const DataType &type);
+
+    // Comparing the integer keys of two values gives the same order as comparing the values with the order type.
+    static u64 EncodeFixed(const ColumnVector &column, const DataType &type, OrderType order_type, SizeT row_idx);
+
+    // Append the sort key of each row, columns are the evaluated sort expressions.
+    void Encode(const Vector<SharedPtr<ColumnVector>> &columns, SizeT row_count, SortKeys &keys) const;
+
+private:
+    void EncodeValue(const ColumnVector &column, const DataType &type, SizeT row_idx, Vector<char> &buffer) const;
+
+    Vector<SharedPtr<DataType>> types_{};
+    Vector<OrderType> order_types_{};
+};
+
+// Tree of losers for the k-way merge of sorted runs. Each inner node keeps the loser of the match between its subtrees,
+// so replacing the key of the winner only replays the log(k) matches on the path from its leaf to the root.
+// Equal keys are won by the run with the smaller index.
+export class SortKeyLoserTree {
+public:
+    // The first key of each run, None for an empty run.
+    explicit SortKeyLoserTree(Vector<Optional<std::string_view>> keys);
+
+    inline bool Empty() const { return keys_.empty() || !keys_[winner_].has_value(); }
+
+    inline SizeT Winner() const { return winner_; }
+
+    inline std::string_view WinnerKey() const { return keys_[winner_].value(); }
+
+    // Replace the key of the winner with the next key of its run, None when the run is exhausted.
+    void ReplaceWinner(Optional<std::string_view> key);
+
+private:
+    bool Less(SizeT left_run, SizeT right_run) const;
+
+    void Replay(SizeT run);
+
+    Vector<Optional<std::string_view>> keys_{};
+    Vector<SizeT> losers_{};
+    SizeT winner_{};
+};
+
+// Append rows to blocks of DEFAULT_BLOCK_CAPACITY rows, consecutive rows of an input block are copied in one batch.
+// The pending rows refer to the input block, Flush before the input block is released.
+export class SortedRowAppender {
+public:
+    explicit SortedRowAppender(Vector<UniquePtr<DataBlock>> &output_blocks) : output_blocks_(output_blocks) {}
+
+    void Append(const DataBlock *input_block, SizeT row_idx);
+
+    void Flush();
+
+    // Flush and finalize the last output block.
+    void Finish();
+
+private:
+    Vector<UniquePtr<DataBlock>> &output_blocks_;
+    DataBlock *output_block_{nullptr};
+    SizeT output_row_count_{};
+
+    const DataBlock *pending_block_{nullptr};
+    SizeT pending_start_{};
+    SizeT pending_count_{};
+};
+
+// Merge the sorted runs into blocks of DEFAULT_BLOCK_CAPACITY rows, run_keys[i] are the keys of the rows of runs[i] in order.
+export void MergeSortedRuns(const Vector<Vector<UniquePtr<DataBlock>>> &runs, const Vector<SortKeys> &run_keys, Vector<UniquePtr<DataBlock>> &output_blocks);
+
+// The order of the rows by their EncodeFixed keys, the rows with equal keys keep their order.
+export Vector<u32> OrderByFixedKeys(const Vector<u64> &keys);
+
+} // namespace infinity
@@ -25,6 +25,7 @@ import scalar_function;
 import search_options;
 import infinity_exception;
 import third_party;
+import knn_expression;
 
 namespace infinity {
 
@@ -36,6 +37,9 @@ String FusionExpression::ToString() const {
         return alias_;
     }
     String expr_str = fmt::format("FUSION('{}', '{}')", method_, options_ ? options_->ToString() : "");
+    if (rerank_expr_.get() != nullptr) {
+        expr_str += fmt::format(", RERANK {}", rerank_expr_->ToString());
+    }
     return expr_str;
 }
 
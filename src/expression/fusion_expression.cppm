@@ -22,6 +22,7 @@ import data_type;
 import logical_type;
 import internal_types;
 import search_options;
+import knn_expression;
 
 namespace infinity {
 
@@ -36,6 +37,8 @@ public:
 public:
     String method_{};
     SharedPtr<SearchOptions> options_{};
+    // Reranks the fused rows, its topn rows are output
+    SharedPtr<KnnExpression> rerank_expr_{};
 };
 
 } // namespace infinity
\ No newline at end of file
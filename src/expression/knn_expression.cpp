@@ -14,7 +14,9 @@
 
 module;
 
+#include <cstring>
 #include <sstream>
+#include <string>
 import stl;
 import expression_type;
 
@@ -45,6 +47,9 @@ String KnnExpression::KnnDistanceType2Str(KnnDistanceType type) {
         case KnnDistanceType::kHamming: {
             return "Hamming";
         }
+        case KnnDistanceType::kMaxSim: {
+            return "MaxSim";
+        }
     }
 }
 
@@ -62,10 +67,28 @@ KnnExpression::KnnExpression(EmbeddingDataType embedding_data_type,
     if (opt_params) {
         for (auto &param : *opt_params) {
             opt_params_.emplace_back(*param);
+            if (param->param_name_ == "threshold") {
+                threshold_ = std::stof(param->param_value_);
+            }
         }
     }
 }
 
+KnnExpression::KnnExpression(const KnnExpression &other, EmbeddingT query_embedding)
+    : BaseExpression(ExpressionType::kKnn, other.arguments_, other.alias_), dimension_(other.dimension_),
+      embedding_data_type_(other.embedding_data_type_), distance_type_(other.distance_type_), query_embedding_(std::move(query_embedding)),
+      topn_(other.topn_), opt_params_(other.opt_params_), threshold_(other.threshold_) {
+    source_position_ = other.source_position_;
+}
+
+KnnExpression::KnnExpression(const KnnExpression &other, i64 topn)
+    : BaseExpression(ExpressionType::kKnn, other.arguments_, other.alias_), dimension_(other.dimension_),
+      embedding_data_type_(other.embedding_data_type_), distance_type_(other.distance_type_),
+      query_embedding_(other.embedding_data_type_, other.dimension_), topn_(topn), opt_params_(other.opt_params_), threshold_(other.threshold_) {
+    std::memcpy(query_embedding_.ptr, other.query_embedding_.ptr, EmbeddingT::EmbeddingSize(embedding_data_type_, dimension_));
+    source_position_ = other.source_position_;
+}
+
 String KnnExpression::ToString() const {
     if (!alias_.empty()) {
         return alias_;
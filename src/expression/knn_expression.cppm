@@ -39,6 +39,12 @@ public:
                   i64 topn,
                   Vector<InitParameter *> *opt_params);
 
+    // The same search with another query embedding of the same type and dimension
+    KnnExpression(const KnnExpression &other, EmbeddingT query_embedding);
+
+    // The same search keeping fewer results, the query embedding is copied
+    KnnExpression(const KnnExpression &other, i64 topn);
+
     inline DataType Type() const override { return DataType(LogicalType::kFloat); }
 
     String ToString() const override;
@@ -50,6 +56,8 @@ public:
     const EmbeddingT query_embedding_;
     const i64 topn_;
     Vector<InitParameter> opt_params_;
+    // set by the threshold option, a range search returns every row within it instead of the topn nearest
+    Optional<f32> threshold_{};
 };
 
 } // namespace infinity
\ No newline at end of file
@@ -0,0 +1,241 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <bit>
+#include <cmath>
+#include <cstring>
+#include <type_traits>
+
+module approx_count_distinct;
+
+import stl;
+import catalog;
+import logical_type;
+import infinity_exception;
+import aggregate_function;
+import aggregate_function_set;
+import column_vector;
+
+import third_party;
+import internal_types;
+import data_type;
+
+namespace infinity {
+
+namespace {
+
+// 2^12 registers, the standard error of the estimate is 1.04 / sqrt(4096), about 1.6%.
+constexpr u32 HLL_PRECISION = 12;
+constexpr u32 HLL_REGISTER_COUNT = 1u << HLL_PRECISION;
+// Below the threshold of the precision, linear counting on the empty registers is more accurate than the raw estimate (HLL++).
+constexpr f64 HLL_LINEAR_COUNTING_THRESHOLD = 3100;
+
+inline u64 MixHash(u64 h) {
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+    return h;
+}
+
+inline u64 HashBytes(const char *data, SizeT length) {
+    u64 h = MixHash(length);
+    while (length >= sizeof(u64)) {
+        u64 value{};
+        std::memcpy(&value, data, sizeof(u64));
+        h = MixHash(h ^ value);
+        data += sizeof(u64);
+        length -= sizeof(u64);
+    }
+    if (length > 0) {
+        u64 value{};
+        std::memcpy(&value, data, length);
+        h = MixHash(h ^ value);
+    }
+    return h;
+}
+
+struct HyperLogLogState {
+public:
+    u8 registers_[HLL_REGISTER_COUNT];
+    // The registers as a varchar, the partial result of a two phase aggregate.
+    char sketch_[sizeof(VarcharT)];
+    BigIntT result_;
+
+    inline void Initialize() { std::memset(registers_, 0, HLL_REGISTER_COUNT); }
+
+    inline void AddHash(u64 hash) {
+        // The high bits select the register, the register keeps the max rank of the first 1 bit in the other bits.
+        u32 register_idx = hash >> (64 - HLL_PRECISION);
+        u64 remaining = (hash << HLL_PRECISION) | (1ULL << (HLL_PRECISION - 1));
+        u8 rank = static_cast<u8>(std::countl_zero(remaining) + 1);
+        registers_[register_idx] = std::max(registers_[register_idx], rank);
+    }
+
+    template <typename ValueType>
+    inline void Update(const ValueType *__restrict input, SizeT idx) {
+        AddHash(HashBytes(reinterpret_cast<const char *>(input + idx), sizeof(ValueType)));
+    }
+
+    template <typename ValueType>
+    inline void ConstantUpdate(const ValueType *__restrict input, SizeT idx, SizeT) {
+        Update(input, idx);
+    }
+
+    inline void Merge(const u8 *registers) {
+        for (u32 register_idx = 0; register_idx < HLL_REGISTER_COUNT; ++register_idx) {
+            registers_[register_idx] = std::max(registers_[register_idx], registers[register_idx]);
+        }
+    }
+
+    inline ptr_t Finalize() {
+        constexpr f64 register_count = HLL_REGISTER_COUNT;
+        f64 sum = 0;
+        u32 empty_count = 0;
+        for (u32 register_idx = 0; register_idx < HLL_REGISTER_COUNT; ++register_idx) {
+            sum += std::ldexp(1.0, -registers_[register_idx]);
+            empty_count += registers_[register_idx] == 0;
+        }
+        f64 estimate = 0.7213 / (1.0 + 1.079 / register_count) * register_count * register_count / sum;
+        if (empty_count > 0) {
+            f64 linear_estimate = register_count * std::log(register_count / empty_count);
+            if (linear_estimate <= HLL_LINEAR_COUNTING_THRESHOLD) {
+                estimate = linear_estimate;
+            }
+        }
+        result_ = std::llround(estimate);
+        return (ptr_t)&result_;
+    }
+
+    inline ptr_t FinalizeSketch() {
+        auto *sketch = reinterpret_cast<VarcharT *>(sketch_);
+        sketch->is_value_ = true;
+        sketch->length_ = HLL_REGISTER_COUNT;
+        std::memcpy(sketch->value_.prefix_, registers_, VARCHAR_PREFIX_LEN);
+        sketch->value_.ptr_ = reinterpret_cast<char *>(registers_);
+        return (ptr_t)sketch;
+    }
+
+    inline static SizeT Size(const DataType &) { return sizeof(HyperLogLogState); }
+};
+
+void UpdateVarcharState(ptr_t state, const SharedPtr<ColumnVector> &input_column_vector) {
+    auto *hll_state = (HyperLogLogState *)state;
+    String value;
+    auto hash_value = [&](ColumnValueReader<VarcharT> &reader, SizeT idx) {
+        reader[idx].GetString(value);
+        return HashBytes(value.data(), value.size());
+    };
+    switch (input_column_vector->vector_type()) {
+        case ColumnVectorType::kFlat: {
+            ColumnValueReader<VarcharT> reader(input_column_vector);
+            SizeT row_count = input_column_vector->Size();
+            for (SizeT idx = 0; idx < row_count; ++idx) {
+                hll_state->AddHash(hash_value(reader, idx));
+            }
+            break;
+        }
+        case ColumnVectorType::kConstant: {
+            ColumnValueReader<VarcharT> reader(input_column_vector);
+            hll_state->AddHash(hash_value(reader, 0));
+            break;
+        }
+        case ColumnVectorType::kDictionary: {
+            // Each value of the dictionary is hashed once.
+            const SharedPtr<ColumnVector> &dictionary = input_column_vector->dictionary();
+            ColumnValueReader<VarcharT> reader(dictionary);
+            Vector<u64> dictionary_hashes(dictionary->Size());
+            for (SizeT idx = 0; idx < dictionary_hashes.size(); ++idx) {
+                dictionary_hashes[idx] = hash_value(reader, idx);
+            }
+            SizeT row_count = input_column_vector->Size();
+            const u32 *codes = input_column_vector->dictionary_codes();
+            for (SizeT idx = 0; idx < row_count; ++idx) {
+                hll_state->AddHash(dictionary_hashes[codes[idx]]);
+            }
+            break;
+        }
+        default: {
+            UnrecoverableError("Not implement: approximate count distinct on other type of column vector");
+        }
+    }
+}
+
+void MergeSketches(ptr_t state, const SharedPtr<ColumnVector> &input_column_vector) {
+    if (input_column_vector->vector_type() != ColumnVectorType::kFlat) {
+        UnrecoverableError("The partial results of approximate count distinct should be flat.");
+    }
+    auto *hll_state = (HyperLogLogState *)state;
+    ColumnValueReader<VarcharT> reader(input_column_vector);
+    String sketch;
+    SizeT row_count = input_column_vector->Size();
+    for (SizeT idx = 0; idx < row_count; ++idx) {
+        reader[idx].GetString(sketch);
+        if (sketch.size() != HLL_REGISTER_COUNT) {
+            UnrecoverableError(fmt::format("Invalid approximate count distinct sketch of {} bytes", sketch.size()));
+        }
+        hll_state->Merge(reinterpret_cast<const u8 *>(sketch.data()));
+    }
+}
+
+template <typename InputType>
+void AddApproxCountDistinctFunction(SharedPtr<AggregateFunctionSet> &function_set_ptr,
+                                    LogicalType input_type,
+                                    const AggregateFunction &merge_function) {
+    AggregateFunction function =
+        UnaryAggregate<HyperLogLogState, InputType, BigIntT>(function_set_ptr->name(), DataType(input_type), DataType(LogicalType::kBigInt));
+    if constexpr (std::is_same_v<InputType, VarcharT>) {
+        function.update_func_ = UpdateVarcharState;
+    }
+    function.sketch_func_ = [](ptr_t state) { return ((HyperLogLogState *)state)->FinalizeSketch(); };
+    function.merge_function_ = MakeShared<AggregateFunction>(merge_function);
+    function_set_ptr->AddFunction(function);
+}
+
+} // namespace
+
+void RegisterApproxCountDistinctFunction(const UniquePtr<Catalog> &catalog_ptr) {
+    String func_name = "APPROX_COUNT_DISTINCT";
+
+    SharedPtr<AggregateFunctionSet> function_set_ptr = MakeShared<AggregateFunctionSet>(func_name);
+
+    AggregateFunction merge_function(func_name,
+                                     DataType(LogicalType::kVarchar),
+                                     DataType(LogicalType::kBigInt),
+                                     sizeof(HyperLogLogState),
+                                     AggregateOperation::StateInitialize<HyperLogLogState>,
+                                     MergeSketches,
+                                     AggregateOperation::StateFinalize<HyperLogLogState, BigIntT>);
+
+    AddApproxCountDistinctFunction<BooleanT>(function_set_ptr, LogicalType::kBoolean, merge_function);
+    AddApproxCountDistinctFunction<TinyIntT>(function_set_ptr, LogicalType::kTinyInt, merge_function);
+    AddApproxCountDistinctFunction<SmallIntT>(function_set_ptr, LogicalType::kSmallInt, merge_function);
+    AddApproxCountDistinctFunction<IntegerT>(function_set_ptr, LogicalType::kInteger, merge_function);
+    AddApproxCountDistinctFunction<BigIntT>(function_set_ptr, LogicalType::kBigInt, merge_function);
+    AddApproxCountDistinctFunction<HugeIntT>(function_set_ptr, LogicalType::kHugeInt, merge_function);
+    AddApproxCountDistinctFunction<FloatT>(function_set_ptr, LogicalType::kFloat, merge_function);
+    AddApproxCountDistinctFunction<DoubleT>(function_set_ptr, LogicalType::kDouble, merge_function);
+    AddApproxCountDistinctFunction<VarcharT>(function_set_ptr, LogicalType::kVarchar, merge_function);
+    AddApproxCountDistinctFunction<DateT>(function_set_ptr, LogicalType::kDate, merge_function);
+    AddApproxCountDistinctFunction<TimeT>(function_set_ptr, LogicalType::kTime, merge_function);
+    AddApproxCountDistinctFunction<DateTimeT>(function_set_ptr, LogicalType::kDateTime, merge_function);
+    AddApproxCountDistinctFunction<TimestampT>(function_set_ptr, LogicalType::kTimestamp, merge_function);
+
+    Catalog::AddFunctionSet(catalog_ptr.get(), function_set_ptr);
+}
+
+} // namespace infinity
@@ -0,0 +1,311 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <cmath>
+#include <cstring>
+#include <numbers>
+
+module approx_percentile;
+
+import stl;
+import catalog;
+import status;
+import logical_type;
+import infinity_exception;
+import aggregate_function;
+import aggregate_function_set;
+import base_expression;
+import value_expression;
+import expression_type;
+import column_vector;
+import value;
+
+import third_party;
+import internal_types;
+import data_type;
+
+namespace infinity {
+
+namespace {
+
+// The compression of t-digest, a centroid spans at most 1 / compression of the scale function k(q) = compression / (2 * pi) * asin(2q - 1),
+// so that the centroids at the tails are small and the percentiles there are accurate.
+constexpr f64 TDIGEST_COMPRESSION = 100;
+// The compression leaves at most compression + 1 centroids, the values added after it are buffered until the capacity.
+constexpr SizeT TDIGEST_BUFFER_SIZE = 128;
+constexpr SizeT TDIGEST_CAPACITY = static_cast<SizeT>(TDIGEST_COMPRESSION) + 1 + TDIGEST_BUFFER_SIZE;
+
+struct Centroid {
+    f64 mean_;
+    f64 weight_;
+};
+
+// The header and the centroids after it are the sketch of the digest.
+struct TDigestHeader {
+    f64 fraction_;
+    f64 total_weight_;
+    f64 min_;
+    f64 max_;
+    u64 centroid_count_;
+};
+
+static_assert(sizeof(TDigestHeader) % alignof(Centroid) == 0);
+
+// The largest quantile reached by a centroid which starts at the quantile.
+inline f64 QuantileLimit(f64 quantile) {
+    f64 k = TDIGEST_COMPRESSION / (2 * std::numbers::pi) * std::asin(std::clamp(2 * quantile - 1, -1.0, 1.0)) + 1;
+    if (k >= TDIGEST_COMPRESSION / 4) {
+        return 1;
+    }
+    return (std::sin(k * 2 * std::numbers::pi / TDIGEST_COMPRESSION) + 1) / 2;
+}
+
+struct TDigestState {
+public:
+    TDigestHeader header_;
+    Centroid centroids_[TDIGEST_CAPACITY];
+    // The header and the centroids as a varchar, the partial result of a two phase aggregate.
+    char sketch_[sizeof(VarcharT)];
+    DoubleT result_;
+
+    inline void Initialize(f64 fraction) {
+        header_.fraction_ = fraction;
+        header_.total_weight_ = 0;
+        header_.min_ = std::numeric_limits<f64>::infinity();
+        header_.max_ = -std::numeric_limits<f64>::infinity();
+        header_.centroid_count_ = 0;
+    }
+
+    inline void Initialize() { Initialize(0.5); }
+
+    inline void Add(f64 mean, f64 weight) {
+        if (header_.centroid_count_ == TDIGEST_CAPACITY) {
+            Compress();
+        }
+        centroids_[header_.centroid_count_++] = {mean, weight};
+        header_.total_weight_ += weight;
+    }
+
+    template <typename ValueType>
+    inline void Update(const ValueType *__restrict input, SizeT idx) {
+        f64 value = static_cast<f64>(input[idx]);
+        if (std::isnan(value)) {
+            return;
+        }
+        header_.min_ = std::min(header_.min_, value);
+        header_.max_ = std::max(header_.max_, value);
+        Add(value, 1);
+    }
+
+    template <typename ValueType>
+    inline void ConstantUpdate(const ValueType *__restrict input, SizeT idx, SizeT count) {
+        f64 value = static_cast<f64>(input[idx]);
+        if (std::isnan(value)) {
+            return;
+        }
+        header_.min_ = std::min(header_.min_, value);
+        header_.max_ = std::max(header_.max_, value);
+        Add(value, count);
+    }
+
+    inline void Merge(const TDigestHeader &header, const char *centroids) {
+        header_.fraction_ = header.fraction_;
+        header_.min_ = std::min(header_.min_, header.min_);
+        header_.max_ = std::max(header_.max_, header.max_);
+        for (u64 centroid_idx = 0; centroid_idx < header.centroid_count_; ++centroid_idx) {
+            Centroid centroid;
+            std::memcpy(&centroid, centroids + centroid_idx * sizeof(Centroid), sizeof(Centroid));
+            Add(centroid.mean_, centroid.weight_);
+        }
+    }
+
+    // Merge the neighbor centroids in the order of mean, as long as the merged one doesn't exceed the quantile limit of its start.
+    inline void Compress() {
+        if (header_.centroid_count_ <= 1) {
+            return;
+        }
+        std::sort(centroids_, centroids_ + header_.centroid_count_, [](const Centroid &left, const Centroid &right) {
+            return left.mean_ < right.mean_;
+        });
+        f64 total_weight = header_.total_weight_;
+        f64 weight_before = 0;
+        f64 weight_limit = total_weight * QuantileLimit(0);
+        SizeT last_idx = 0;
+        for (SizeT centroid_idx = 1; centroid_idx < header_.centroid_count_; ++centroid_idx) {
+            Centroid &last = centroids_[last_idx];
+            const Centroid &next = centroids_[centroid_idx];
+            if (weight_before + last.weight_ + next.weight_ <= weight_limit) {
+                last.weight_ += next.weight_;
+                last.mean_ += (next.mean_ - last.mean_) * next.weight_ / last.weight_;
+            } else {
+                weight_before += last.weight_;
+                weight_limit = total_weight * QuantileLimit(weight_before / total_weight);
+                centroids_[++last_idx] = next;
+            }
+        }
+        header_.centroid_count_ = last_idx + 1;
+    }
+
+    // Interpolate between the means of the centroids, a centroid is taken as its weight spread evenly around its mean.
+    inline f64 Quantile(f64 fraction) {
+        Compress();
+        SizeT centroid_count = header_.centroid_count_;
+        if (centroid_count == 0) {
+            return std::numeric_limits<f64>::quiet_NaN();
+        }
+        if (centroid_count == 1) {
+            return centroids_[0].mean_;
+        }
+        f64 total_weight = header_.total_weight_;
+        f64 index = fraction * total_weight;
+        const Centroid &first = centroids_[0];
+        const Centroid &last = centroids_[centroid_count - 1];
+        if (index < first.weight_ / 2) {
+            return header_.min_ + (first.mean_ - header_.min_) * index / (first.weight_ / 2);
+        }
+        if (index > total_weight - last.weight_ / 2) {
+            return last.mean_ + (header_.max_ - last.mean_) * (index - (total_weight - last.weight_ / 2)) / (last.weight_ / 2);
+        }
+        f64 weight_so_far = first.weight_ / 2;
+        for (SizeT centroid_idx = 0; centroid_idx + 1 < centroid_count; ++centroid_idx) {
+            const Centroid &left = centroids_[centroid_idx];
+            const Centroid &right = centroids_[centroid_idx + 1];
+            f64 delta = (left.weight_ + right.weight_) / 2;
+            if (weight_so_far + delta >= index) {
+                return left.mean_ + (right.mean_ - left.mean_) * (index - weight_so_far) / delta;
+            }
+            weight_so_far += delta;
+        }
+        return last.mean_;
+    }
+
+    inline ptr_t Finalize() {
+        result_ = Quantile(header_.fraction_);
+        return (ptr_t)&result_;
+    }
+
+    inline ptr_t FinalizeSketch() {
+        Compress();
+        auto *sketch = reinterpret_cast<VarcharT *>(sketch_);
+        sketch->is_value_ = true;
+        sketch->length_ = sizeof(TDigestHeader) + header_.centroid_count_ * sizeof(Centroid);
+        std::memcpy(sketch->value_.prefix_, &header_, VARCHAR_PREFIX_LEN);
+        sketch->value_.ptr_ = reinterpret_cast<char *>(&header_);
+        return (ptr_t)sketch;
+    }
+
+    inline static SizeT Size(const DataType &) { return sizeof(TDigestState); }
+};
+
+void MergeSketches(ptr_t state, const SharedPtr<ColumnVector> &input_column_vector) {
+    if (input_column_vector->vector_type() != ColumnVectorType::kFlat) {
+        UnrecoverableError("The partial results of approximate percentile should be flat.");
+    }
+    auto *digest_state = (TDigestState *)state;
+    ColumnValueReader<VarcharT> reader(input_column_vector);
+    String sketch;
+    SizeT row_count = input_column_vector->Size();
+    for (SizeT idx = 0; idx < row_count; ++idx) {
+        reader[idx].GetString(sketch);
+        TDigestHeader header;
+        if (sketch.size() < sizeof(TDigestHeader)) {
+            UnrecoverableError(fmt::format("Invalid approximate percentile sketch of {} bytes", sketch.size()));
+        }
+        std::memcpy(&header, sketch.data(), sizeof(TDigestHeader));
+        if (sketch.size() != sizeof(TDigestHeader) + header.centroid_count_ * sizeof(Centroid)) {
+            UnrecoverableError(fmt::format("Invalid approximate percentile sketch of {} bytes", sketch.size()));
+        }
+        digest_state->Merge(header, sketch.data() + sizeof(TDigestHeader));
+    }
+}
+
+template <typename InputType>
+void AddApproxPercentileFunction(SharedPtr<AggregateFunctionSet> &function_set_ptr, LogicalType input_type, const AggregateFunction &merge_function) {
+    AggregateFunction function =
+        UnaryAggregate<TDigestState, InputType, DoubleT>(function_set_ptr->name(), DataType(input_type), DataType(LogicalType::kDouble));
+    function.sketch_func_ = [](ptr_t state) { return ((TDigestState *)state)->FinalizeSketch(); };
+    function.merge_function_ = MakeShared<AggregateFunction>(merge_function);
+    function_set_ptr->AddFunction(function);
+}
+
+} // namespace
+
+void RegisterApproxPercentileFunction(const UniquePtr<Catalog> &catalog_ptr) {
+    String func_name = "APPROX_PERCENTILE";
+
+    SharedPtr<AggregateFunctionSet> function_set_ptr = MakeShared<AggregateFunctionSet>(func_name);
+
+    // The fraction is taken from the sketches.
+    AggregateFunction merge_function(func_name,
+                                     DataType(LogicalType::kVarchar),
+                                     DataType(LogicalType::kDouble),
+                                     sizeof(TDigestState),
+                                     AggregateOperation::StateInitialize<TDigestState>,
+                                     MergeSketches,
+                                     AggregateOperation::StateFinalize<TDigestState, DoubleT>);
+
+    AddApproxPercentileFunction<TinyIntT>(function_set_ptr, LogicalType::kTinyInt, merge_function);
+    AddApproxPercentileFunction<SmallIntT>(function_set_ptr, LogicalType::kSmallInt, merge_function);
+    AddApproxPercentileFunction<IntegerT>(function_set_ptr, LogicalType::kInteger, merge_function);
+    AddApproxPercentileFunction<BigIntT>(function_set_ptr, LogicalType::kBigInt, merge_function);
+    AddApproxPercentileFunction<FloatT>(function_set_ptr, LogicalType::kFloat, merge_function);
+    AddApproxPercentileFunction<DoubleT>(function_set_ptr, LogicalType::kDouble, merge_function);
+
+    Catalog::AddFunctionSet(catalog_ptr.get(), function_set_ptr);
+}
+
+void BindApproxPercentileFraction(AggregateFunction &function, const Vector<SharedPtr<BaseExpression>> &arguments) {
+    if (arguments.size() != 2 || arguments[1]->type() != ExpressionType::kValue) {
+        RecoverableError(Status::FunctionArgsError("APPROX_PERCENTILE(column, constant fraction)"));
+    }
+    const Value &value = static_cast<const ValueExpression *>(arguments[1].get())->GetValue();
+    f64 fraction = 0;
+    switch (value.type().type()) {
+        case LogicalType::kTinyInt: {
+            fraction = value.GetValue<TinyIntT>();
+            break;
+        }
+        case LogicalType::kSmallInt: {
+            fraction = value.GetValue<SmallIntT>();
+            break;
+        }
+        case LogicalType::kInteger: {
+            fraction = value.GetValue<IntegerT>();
+            break;
+        }
+        case LogicalType::kBigInt: {
+            fraction = value.GetValue<BigIntT>();
+            break;
+        }
+        case LogicalType::kFloat: {
+            fraction = value.GetValue<FloatT>();
+            break;
+        }
+        case LogicalType::kDouble: {
+            fraction = value.GetValue<DoubleT>();
+            break;
+        }
+        default: {
+            RecoverableError(Status::FunctionArgsError("APPROX_PERCENTILE(column, constant fraction)"));
+        }
+    }
+    if (!(fraction >= 0 && fraction <= 1)) {
+        RecoverableError(Status::InvalidParameterValue("APPROX_PERCENTILE fraction", std::to_string(fraction), "a number between 0 and 1"));
+    }
+    function.init_func_ = [fraction](ptr_t state) { ((TDigestState *)state)->Initialize(fraction); };
+}
+
+} // namespace infinity
@@ -0,0 +1,32 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+import stl;
+import aggregate_function;
+import base_expression;
+
+export module approx_percentile;
+
+namespace infinity {
+
+class Catalog;
+
+export void RegisterApproxPercentileFunction(const UniquePtr<Catalog> &catalog_ptr);
+
+// The second argument of APPROX_PERCENTILE is the constant fraction of the percentile, kept in the state by the initialize function.
+export void BindApproxPercentileFraction(AggregateFunction &function, const Vector<SharedPtr<BaseExpression>> &arguments);
+
+} // namespace infinity
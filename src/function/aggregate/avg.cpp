@@ -66,6 +66,14 @@ public:
         value_ += input[idx];
     }
 
+    inline void UpdateBlock(const TinyIntT *__restrict input, SizeT count) {
+        if (count_ > std::numeric_limits<i64>::max() - static_cast<i64>(count)) {
+            UnrecoverableError(fmt::format("Data count exceeds: {}", count_));
+        }
+        this->count_ += count;
+        value_ += SumBlock<double>(input, count);
+    }
+
     inline void ConstantUpdate(const TinyIntT *__restrict input, SizeT idx, SizeT count) {
         this->count_ += count;
         value_ += (input[idx] * count);
@@ -99,6 +107,14 @@ public:
         value_ += input[idx];
     }
 
+    inline void UpdateBlock(const SmallIntT *__restrict input, SizeT count) {
+        if (count_ > std::numeric_limits<i64>::max() - static_cast<i64>(count)) {
+            UnrecoverableError(fmt::format("Data count exceeds: {}", count_));
+        }
+        this->count_ += count;
+        value_ += SumBlock<double>(input, count);
+    }
+
     inline void ConstantUpdate(const SmallIntT *__restrict input, SizeT idx, SizeT count) {
         // TODO: Need to check overflow.
         this->count_ += count;
@@ -133,6 +149,14 @@ public:
         value_ += input[idx];
     }
 
+    inline void UpdateBlock(const IntegerT *__restrict input, SizeT count) {
+        if (count_ > std::numeric_limits<i64>::max() - static_cast<i64>(count)) {
+            UnrecoverableError(fmt::format("Data count exceeds: {}", count_));
+        }
+        this->count_ += count;
+        value_ += SumBlock<double>(input, count);
+    }
+
     inline void ConstantUpdate(const IntegerT *__restrict input, SizeT idx, SizeT count) {
         // TODO: Need to check overflow.
         this->count_ += count;
@@ -167,6 +191,14 @@ public:
         value_ += input[idx];
     }
 
+    inline void UpdateBlock(const BigIntT *__restrict input, SizeT count) {
+        if (count_ > std::numeric_limits<i64>::max() - static_cast<i64>(count)) {
+            UnrecoverableError(fmt::format("Data count exceeds: {}", count_));
+        }
+        this->count_ += count;
+        value_ += SumBlock<double>(input, count);
+    }
+
     inline void ConstantUpdate(const BigIntT *__restrict input, SizeT idx, SizeT count) {
         // TODO: Need to check overflow.
         this->count_ += count;
@@ -201,6 +233,14 @@ public:
         value_ += input[idx];
     }
 
+    inline void UpdateBlock(const FloatT *__restrict input, SizeT count) {
+        if (count_ > std::numeric_limits<i64>::max() - static_cast<i64>(count)) {
+            UnrecoverableError(fmt::format("Data count exceeds: {}", count_));
+        }
+        this->count_ += count;
+        value_ += SumBlock<double>(input, count);
+    }
+
     inline void ConstantUpdate(const FloatT *__restrict input, SizeT idx, SizeT count) {
         // TODO: Need to check overflow.
         this->count_ += count;
@@ -235,6 +275,14 @@ public:
         value_ += input[idx];
     }
 
+    inline void UpdateBlock(const DoubleT *__restrict input, SizeT count) {
+        if (count_ > std::numeric_limits<i64>::max() - static_cast<i64>(count)) {
+            UnrecoverableError(fmt::format("Data count exceeds: {}", count_));
+        }
+        this->count_ += count;
+        value_ += SumBlock<double>(input, count);
+    }
+
     inline void ConstantUpdate(const DoubleT *__restrict input, SizeT idx, SizeT count) {
         // TODO: Need to check overflow.
         this->count_ += count;
@@ -71,6 +71,8 @@ public:
 
     void Update(const TinyIntT *__restrict input, SizeT idx) { value_ = input[idx] < value_ ? input[idx] : value_; }
 
+    void UpdateBlock(const TinyIntT *__restrict input, SizeT count) { value_ = MinBlock(input, count, value_); }
+
     inline void ConstantUpdate(const TinyIntT *__restrict input, SizeT idx, SizeT) { value_ = input[idx] < value_ ? input[idx] : value_; }
 
     inline ptr_t Finalize() { return (ptr_t)&value_; }
@@ -87,6 +89,8 @@ public:
 
     void Update(const SmallIntT *__restrict input, SizeT idx) { value_ = input[idx] < value_ ? input[idx] : value_; }
 
+    void UpdateBlock(const SmallIntT *__restrict input, SizeT count) { value_ = MinBlock(input, count, value_); }
+
     inline void ConstantUpdate(const SmallIntT *__restrict input, SizeT idx, SizeT ) { value_ = input[idx] < value_ ? input[idx] : value_; }
 
     inline ptr_t Finalize() { return (ptr_t)&value_; }
@@ -103,6 +107,8 @@ public:
 
     void Update(const IntegerT *__restrict input, SizeT idx) { value_ = input[idx] < value_ ? input[idx] : value_; }
 
+    void UpdateBlock(const IntegerT *__restrict input, SizeT count) { value_ = MinBlock(input, count, value_); }
+
     inline void ConstantUpdate(const IntegerT *__restrict input, SizeT idx, SizeT) { value_ = input[idx] < value_ ? input[idx] : value_; }
 
     inline ptr_t Finalize() { return (ptr_t)&value_; }
@@ -119,6 +125,8 @@ public:
 
     void Update(const BigIntT *__restrict input, SizeT idx) { value_ = input[idx] < value_ ? input[idx] : value_; }
 
+    void UpdateBlock(const BigIntT *__restrict input, SizeT count) { value_ = MinBlock(input, count, value_); }
+
     inline void ConstantUpdate(const BigIntT *__restrict input, SizeT idx, SizeT) { value_ = input[idx] < value_ ? input[idx] : value_; }
 
     inline ptr_t Finalize() { return (ptr_t)&value_; }
@@ -154,6 +162,8 @@ public:
 
     void Update(const FloatT *__restrict input, SizeT idx) { value_ = input[idx] < value_ ? input[idx] : value_; }
 
+    void UpdateBlock(const FloatT *__restrict input, SizeT count) { value_ = MinBlock(input, count, value_); }
+
     inline void ConstantUpdate(const FloatT *__restrict input, SizeT idx, SizeT) { value_ = input[idx] < value_ ? input[idx] : value_; }
 
     inline ptr_t Finalize() { return (ptr_t)&value_; }
@@ -170,6 +180,8 @@ public:
 
     void Update(const DoubleT *__restrict input, SizeT idx) { value_ = input[idx] < value_ ? input[idx] : value_; }
 
+    void UpdateBlock(const DoubleT *__restrict input, SizeT count) { value_ = MinBlock(input, count, value_); }
+
     inline void ConstantUpdate(const DoubleT *__restrict input, SizeT idx, SizeT) { value_ = input[idx] < value_ ? input[idx] : value_; }
 
     inline ptr_t Finalize() { return (ptr_t)&value_; }
@@ -53,6 +53,8 @@ public:
 
     inline void Update(const TinyIntT *__restrict input, SizeT idx) { sum_ += input[idx]; }
 
+    inline void UpdateBlock(const TinyIntT *__restrict input, SizeT count) { sum_ += SumBlock<i64>(input, count); }
+
     inline void ConstantUpdate(const TinyIntT *__restrict input, SizeT idx, SizeT count) { sum_ += input[idx] * count; }
 
     inline ptr_t Finalize() { return (ptr_t)&sum_; }
@@ -69,6 +71,8 @@ public:
 
     inline void Update(const SmallIntT *__restrict input, SizeT idx) { sum_ += input[idx]; }
 
+    inline void UpdateBlock(const SmallIntT *__restrict input, SizeT count) { sum_ += SumBlock<i64>(input, count); }
+
     inline void ConstantUpdate(const SmallIntT *__restrict input, SizeT idx, SizeT count) { sum_ += input[idx] * count; }
 
     inline ptr_t Finalize() { return (ptr_t)&sum_; }
@@ -85,6 +89,8 @@ public:
 
     inline void Update(const IntegerT *__restrict input, SizeT idx) { sum_ += input[idx]; }
 
+    inline void UpdateBlock(const IntegerT *__restrict input, SizeT count) { sum_ += SumBlock<i64>(input, count); }
+
     inline void ConstantUpdate(const IntegerT *__restrict input, SizeT idx, SizeT count) { sum_ += input[idx] * count; }
 
     inline ptr_t Finalize() { return (ptr_t)&sum_; }
@@ -101,6 +107,8 @@ public:
 
     inline void Update(const BigIntT *__restrict input, SizeT idx) { sum_ += input[idx]; }
 
+    inline void UpdateBlock(const BigIntT *__restrict input, SizeT count) { sum_ += SumBlock<i64>(input, count); }
+
     inline void ConstantUpdate(const BigIntT *__restrict input, SizeT idx, SizeT count) { sum_ += input[idx] * count; }
 
     inline ptr_t Finalize() { return (ptr_t)&sum_; }
@@ -117,6 +125,8 @@ public:
 
     inline void Update(const FloatT *__restrict input, SizeT idx) { sum_ += input[idx]; }
 
+    inline void UpdateBlock(const FloatT *__restrict input, SizeT count) { sum_ += SumBlock<DoubleT>(input, count); }
+
     inline void ConstantUpdate(const FloatT *__restrict input, SizeT idx, SizeT count) { sum_ += input[idx] * count; }
 
     inline ptr_t Finalize() { return (ptr_t)&sum_; }
@@ -133,6 +143,8 @@ public:
 
     inline void Update(const DoubleT *__restrict input, SizeT idx) { sum_ += input[idx]; }
 
+    inline void UpdateBlock(const DoubleT *__restrict input, SizeT count) { sum_ += SumBlock<DoubleT>(input, count); }
+
     inline void ConstantUpdate(const DoubleT *__restrict input, SizeT idx, SizeT count) { sum_ += input[idx] * count; }
 
     inline ptr_t Finalize() { return (ptr_t)&sum_; }
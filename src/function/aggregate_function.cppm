@@ -14,6 +14,7 @@
 
 module;
 
+#include <bit>
 #include <type_traits>
 
 export module aggregate_function;
@@ -22,6 +23,8 @@ import stl;
 import function;
 import function_data;
 import column_vector;
+import bitmask;
+import bitmask_buffer;
 import vector_buffer;
 import infinity_exception;
 import base_expression;
@@ -35,7 +38,67 @@ using AggregateInitializeFuncType = std::function<void(ptr_t)>;
 using AggregateUpdateFuncType = std::function<void(ptr_t, const SharedPtr<ColumnVector> &)>;
 using AggregateFinalizeFuncType = std::function<ptr_t(ptr_t)>;
 
-class AggregateOperation {
+// The block kernels reduce into independent lanes, so that the loop is vectorized without reordering one accumulator.
+constexpr SizeT AGGREGATE_BLOCK_LANES = 8;
+
+export template <typename ResultType, typename InputType>
+inline ResultType SumBlock(const InputType *__restrict input, SizeT count) {
+    ResultType lanes[AGGREGATE_BLOCK_LANES]{};
+    SizeT idx = 0;
+    for (; idx + AGGREGATE_BLOCK_LANES <= count; idx += AGGREGATE_BLOCK_LANES) {
+        for (SizeT lane = 0; lane < AGGREGATE_BLOCK_LANES; ++lane) {
+            lanes[lane] += input[idx + lane];
+        }
+    }
+    ResultType sum{};
+    for (SizeT lane = 0; lane < AGGREGATE_BLOCK_LANES; ++lane) {
+        sum += lanes[lane];
+    }
+    for (; idx < count; ++idx) {
+        sum += input[idx];
+    }
+    return sum;
+}
+
+export template <typename ValueType>
+inline ValueType MinBlock(const ValueType *__restrict input, SizeT count, ValueType value) {
+    ValueType lanes[AGGREGATE_BLOCK_LANES];
+    std::fill_n(lanes, AGGREGATE_BLOCK_LANES, value);
+    SizeT idx = 0;
+    for (; idx + AGGREGATE_BLOCK_LANES <= count; idx += AGGREGATE_BLOCK_LANES) {
+        for (SizeT lane = 0; lane < AGGREGATE_BLOCK_LANES; ++lane) {
+            lanes[lane] = input[idx + lane] < lanes[lane] ? input[idx + lane] : lanes[lane];
+        }
+    }
+    for (; idx < count; ++idx) {
+        value = input[idx] < value ? input[idx] : value;
+    }
+    for (SizeT lane = 0; lane < AGGREGATE_BLOCK_LANES; ++lane) {
+        value = lanes[lane] < value ? lanes[lane] : value;
+    }
+    return value;
+}
+
+export template <typename ValueType>
+inline ValueType MaxBlock(const ValueType *__restrict input, SizeT count, ValueType value) {
+    ValueType lanes[AGGREGATE_BLOCK_LANES];
+    std::fill_n(lanes, AGGREGATE_BLOCK_LANES, value);
+    SizeT idx = 0;
+    for (; idx + AGGREGATE_BLOCK_LANES <= count; idx += AGGREGATE_BLOCK_LANES) {
+        for (SizeT lane = 0; lane < AGGREGATE_BLOCK_LANES; ++lane) {
+            lanes[lane] = input[idx + lane] > lanes[lane] ? input[idx + lane] : lanes[lane];
+        }
+    }
+    for (; idx < count; ++idx) {
+        value = input[idx] > value ? input[idx] : value;
+    }
+    for (SizeT lane = 0; lane < AGGREGATE_BLOCK_LANES; ++lane) {
+        value = lanes[lane] > value ? lanes[lane] : value;
+    }
+    return value;
+}
+
+export class AggregateOperation {
 public:
     template <typename AggregateState>
     static inline void StateInitialize(const ptr_t state) {
@@ -65,8 +128,32 @@ public:
             case ColumnVectorType::kFlat: {
                 SizeT row_count = input_column_vector->Size();
                 auto *input_ptr = (InputType *)(input_column_vector->data());
-                for (SizeT idx = 0; idx < row_count; ++idx) {
-                    ((AggregateState *)state)->Update(input_ptr, idx);
+                if constexpr (requires(AggregateState *block_state) { block_state->UpdateBlock(input_ptr, row_count); }) {
+                    // The state reduces a range of rows at once, the null rows are skipped by the units of the null mask.
+                    const Bitmask &nulls = *input_column_vector->nulls_ptr_;
+                    if (nulls.IsAllTrue()) {
+                        ((AggregateState *)state)->UpdateBlock(input_ptr, row_count);
+                        break;
+                    }
+                    const u64 *null_units = nulls.GetData();
+                    for (SizeT unit_start = 0; unit_start < row_count; unit_start += BitmaskBuffer::UNIT_BITS) {
+                        SizeT unit_rows = std::min<SizeT>(BitmaskBuffer::UNIT_BITS, row_count - unit_start);
+                        u64 unit = null_units[unit_start / BitmaskBuffer::UNIT_BITS];
+                        if (unit == BitmaskBuffer::UNIT_MAX) {
+                            ((AggregateState *)state)->UpdateBlock(input_ptr + unit_start, unit_rows);
+                            continue;
+                        }
+                        if (unit_rows < BitmaskBuffer::UNIT_BITS) {
+                            unit &= (u64(1) << unit_rows) - 1;
+                        }
+                        for (; unit != 0; unit &= unit - 1) {
+                            ((AggregateState *)state)->Update(input_ptr, unit_start + std::countr_zero(unit));
+                        }
+                    }
+                } else {
+                    for (SizeT idx = 0; idx < row_count; ++idx) {
+                        ((AggregateState *)state)->Update(input_ptr, idx);
+                    }
                 }
                 break;
             }
@@ -84,6 +171,16 @@ public:
                 ((AggregateState *)state)->Update(input_ptr, 0);
                 break;
             }
+            case ColumnVectorType::kDictionary: {
+                // the state is updated with the dictionary value of each code
+                SizeT row_count = input_column_vector->Size();
+                auto *dictionary_ptr = (InputType *)(input_column_vector->dictionary()->data());
+                const u32 *codes = input_column_vector->dictionary_codes();
+                for (SizeT idx = 0; idx < row_count; ++idx) {
+                    ((AggregateState *)state)->Update(dictionary_ptr, codes[idx]);
+                }
+                break;
+            }
             case ColumnVectorType::kHeterogeneous: {
                 UnrecoverableError("Not implement: Heterogeneous type");
             }
@@ -124,6 +221,17 @@ public:
 
     [[nodiscard]] String GetFuncName() const { return name_; }
 
+    // The state of a sketch aggregate is merged instead of its result: the partial function outputs the state as a varchar,
+    // and the merge function combines the states of the partial results into the result.
+    [[nodiscard]] bool IsSketch() const { return merge_function_.get() != nullptr; }
+
+    [[nodiscard]] AggregateFunction PartialFunction() const {
+        AggregateFunction partial_function = *this;
+        partial_function.finalize_func_ = sketch_func_;
+        partial_function.return_type_ = DataType(LogicalType::kVarchar);
+        return partial_function;
+    }
+
 public:
     AggregateInitializeFuncType init_func_;
     AggregateUpdateFuncType update_func_;
@@ -133,6 +241,9 @@ public:
     DataType return_type_;
 
     SizeT state_size_{};
+
+    AggregateFinalizeFuncType sketch_func_{};
+    SharedPtr<AggregateFunction> merge_function_{};
 };
 
 export template <typename AggregateState, typename InputType, typename ResultType>
@@ -18,6 +18,8 @@ module builtin_functions;
 
 import stl;
 import catalog;
+import approx_count_distinct;
+import approx_percentile;
 import avg;
 import count;
 import first;
@@ -65,6 +67,8 @@ void BuiltinFunctions::Init() {
 }
 
 void BuiltinFunctions::RegisterAggregateFunction() {
+    RegisterApproxCountDistinctFunction(catalog_ptr_);
+    RegisterApproxPercentileFunction(catalog_ptr_);
     RegisterAvgFunction(catalog_ptr_);
     RegisterCountFunction(catalog_ptr_);
     RegisterFirstFunction(catalog_ptr_);
@@ -28,14 +28,32 @@ import vector_buffer;
 import internal_types;
 import data_type;
 import status;
+import embedding_info;
+import number_parser;
+import bitmask;
 
 namespace infinity {
 
 export struct TryCastVarchar;
 export struct TryCastVarcharVector;
+template <typename T>
+bool TryCastVarcharToEmbedding(const SharedPtr<ColumnVector> &source, SharedPtr<ColumnVector> &target, SizeT count, CastParameters &);
 export struct TryCastVarcharToChar;
 export struct TryCastVarcharToVarchar;
 
+// The characters of a varchar of the vector, a varchar in the heap of the vector is read into buffer.
+inline std::string_view VarcharView(const VarcharT &source, ColumnVector *source_vector, String &buffer) {
+    if (source.IsInlined()) {
+        return std::string_view(source.short_.data_, source.length_);
+    }
+    if (source.IsValue()) {
+        return std::string_view(source.value_.ptr_, source.length_);
+    }
+    buffer.resize(source.length_);
+    source_vector->buffer_->fix_heap_mgr_->ReadFromHeap(buffer.data(), source.vector_.chunk_id_, source.vector_.chunk_offset_, source.length_);
+    return buffer;
+}
+
 export inline BoundCastFunc BindVarcharCast(const DataType &source, const DataType &target) {
     if (source.type() != LogicalType::kVarchar) {
         UnrecoverableError(fmt::format("Expect Varchar type, but it is {}", source.ToString()));
@@ -45,13 +63,13 @@ export inline BoundCastFunc BindVarcharCast(const DataType &source, const DataTy
             return BoundCastFunc(&ColumnVectorCast::TryCastColumnVector<VarcharT, BooleanT, TryCastVarchar>);
         }
         case kTinyInt: {
-            return BoundCastFunc(&ColumnVectorCast::TryCastColumnVector<VarcharT, TinyIntT, TryCastVarchar>);
+            return BoundCastFunc(&ColumnVectorCast::TryCastVarlenColumnVector<VarcharT, TinyIntT, TryCastVarcharVector>);
         }
         case kSmallInt: {
-            return BoundCastFunc(&ColumnVectorCast::TryCastColumnVector<VarcharT, SmallIntT, TryCastVarchar>);
+            return BoundCastFunc(&ColumnVectorCast::TryCastVarlenColumnVector<VarcharT, SmallIntT, TryCastVarcharVector>);
         }
         case kInteger: {
-            return BoundCastFunc(&ColumnVectorCast::TryCastColumnVector<VarcharT, IntegerT, TryCastVarchar>);
+            return BoundCastFunc(&ColumnVectorCast::TryCastVarlenColumnVector<VarcharT, IntegerT, TryCastVarcharVector>);
         }
         case kBigInt: {
             return BoundCastFunc(&ColumnVectorCast::TryCastVarlenColumnVector<VarcharT, BigIntT, TryCastVarcharVector>);
@@ -123,7 +141,30 @@ export inline BoundCastFunc BindVarcharCast(const DataType &source, const DataTy
             //            UnrecoverableError("Cast from varchar to blob");
             //        }
         case kEmbedding: {
-            RecoverableError(Status::NotSupport(fmt::format("Attempt to cast from {} to {}", source.ToString(), target.ToString())));
+            switch (static_cast<const EmbeddingInfo *>(target.type_info().get())->Type()) {
+                case kElemInt8: {
+                    return BoundCastFunc(&TryCastVarcharToEmbedding<TinyIntT>);
+                }
+                case kElemInt16: {
+                    return BoundCastFunc(&TryCastVarcharToEmbedding<SmallIntT>);
+                }
+                case kElemInt32: {
+                    return BoundCastFunc(&TryCastVarcharToEmbedding<IntegerT>);
+                }
+                case kElemInt64: {
+                    return BoundCastFunc(&TryCastVarcharToEmbedding<BigIntT>);
+                }
+                case kElemFloat: {
+                    return BoundCastFunc(&TryCastVarcharToEmbedding<FloatT>);
+                }
+                case kElemDouble: {
+                    return BoundCastFunc(&TryCastVarcharToEmbedding<DoubleT>);
+                }
+                default: {
+                    RecoverableError(Status::NotSupport(fmt::format("Attempt to cast from {} to {}", source.ToString(), target.ToString())));
+                }
+            }
+            break;
         }
         case kRowID: {
             return BoundCastFunc(&ColumnVectorCast::TryCastColumnVector<VarcharT, RowID, TryCastVarchar>);
@@ -264,107 +305,62 @@ inline bool TryCastVarchar::Run(const VarcharT &, IntervalT &) {
 
 struct TryCastVarcharVector {
     template <typename SourceType, typename TargetType>
-    static inline bool Run(const SourceType &, ColumnVector* source_vector, TargetType &) {
-        UnrecoverableError(
-            fmt::format("No implementation to cast from {} to {}", DataType::TypeToString<SourceType>(), DataType::TypeToString<TargetType>()));
-        return false;
-    }
-};
-
-// Cast VarcharT to BigIntT type
-template <>
-inline bool TryCastVarcharVector::Run(const VarcharT &source, ColumnVector* source_vector, i64 &target) {
-    if (source.IsInlined()) {
-        auto [ptr, ec] = std::from_chars(source.short_.data_, source.short_.data_ + source.length_, target);
-        if (ec != std::errc()) {
-            return false;
-        }
-    } else {
-        if(source.IsValue()) {
-            auto [ptr, ec] = std::from_chars(source.value_.ptr_, source.value_.ptr_ + source.length_, target);
-            if (ec != std::errc()) {
-                return false;
-            }
+    static inline bool Run(const SourceType &source, ColumnVector *source_vector, TargetType &target) {
+        if constexpr (std::is_same_v<SourceType, VarcharT> && std::is_arithmetic_v<TargetType> && !std::is_same_v<TargetType, BooleanT>) {
+            thread_local String buffer;
+            return ParseNumber(VarcharView(source, source_vector, buffer), target);
         } else {
-            // varchar is vector
-            SizeT varchar_len = source.length_;
-            u32 chunk_id = source.vector_.chunk_id_;
-            u32 chunk_offset = source.vector_.chunk_offset_;
-            auto varchar_ptr = MakeUniqueForOverwrite<char[]>(varchar_len + 1);
-            varchar_ptr[varchar_len] = '\0';
-            source_vector->buffer_->fix_heap_mgr_->ReadFromHeap(varchar_ptr.get(), chunk_id, chunk_offset, varchar_len);
-
-            auto [ptr, ec] = std::from_chars(varchar_ptr.get(), varchar_ptr.get() + varchar_len, target);
-            if (ec != std::errc()) {
-                return false;
-            }
-        }
-    }
-    return true;
-}
-
-// Cast VarcharT to FloatT type
-template <>
-inline bool TryCastVarcharVector::Run(const VarcharT &source, ColumnVector* source_vector, FloatT &target) {
-    if (source.IsInlined()) {
-        auto [ptr, ec] = std::from_chars(source.short_.data_, source.short_.data_ + source.length_, target);
-        if (ec != std::errc()) {
+            UnrecoverableError(
+                fmt::format("No implementation to cast from {} to {}", DataType::TypeToString<SourceType>(), DataType::TypeToString<TargetType>()));
             return false;
         }
-    } else {
-        if(source.IsValue()) {
-            auto [ptr, ec] = std::from_chars(source.value_.ptr_, source.value_.ptr_ + source.length_, target);
-            if (ec != std::errc()) {
-                return false;
-            }
-        } else {
-            // varchar is vector
-            SizeT varchar_len = source.length_;
-            u32 chunk_id = source.vector_.chunk_id_;
-            u32 chunk_offset = source.vector_.chunk_offset_;
-            auto varchar_ptr = MakeUniqueForOverwrite<char[]>(varchar_len + 1);
-            varchar_ptr[varchar_len] = '\0';
-            source_vector->buffer_->fix_heap_mgr_->ReadFromHeap(varchar_ptr.get(), chunk_id, chunk_offset, varchar_len);
-
-            auto [ptr, ec] = std::from_chars(varchar_ptr.get(), varchar_ptr.get() + varchar_len, target);
-            if (ec != std::errc()) {
-                return false;
-            }
-        }
     }
-    return true;
-}
+};
 
-// Cast VarcharT to DoubleT type
-template <>
-inline bool TryCastVarcharVector::Run(const VarcharT &source, ColumnVector* source_vector, DoubleT &target) {
-    if (source.IsInlined()) {
-        auto [ptr, ec] = std::from_chars(source.short_.data_, source.short_.data_ + source.length_, target);
-        if (ec != std::errc()) {
-            return false;
+// Casts the varchars of a whole vector like [0.1,0.2,...] to embeddings, each string is parsed straight into the row of the
+// target. A varchar that isn't an embedding of the dimension of the target is cast to null.
+template <typename T>
+bool TryCastVarcharToEmbedding(const SharedPtr<ColumnVector> &source, SharedPtr<ColumnVector> &target, SizeT count, CastParameters &) {
+    SizeT dimension = static_cast<const EmbeddingInfo *>(target->data_type()->type_info().get())->Dimension();
+    ColumnVector *heap_vector = source.get();
+    const u32 *codes = nullptr;
+    switch (source->vector_type()) {
+        case ColumnVectorType::kFlat: {
+            break;
+        }
+        case ColumnVectorType::kConstant: {
+            count = 1;
+            break;
+        }
+        case ColumnVectorType::kDictionary: {
+            codes = source->dictionary_codes();
+            heap_vector = source->dictionary().get();
+            break;
         }
-    } else {
-        if(source.IsValue()) {
-            auto [ptr, ec] = std::from_chars(source.value_.ptr_, source.value_.ptr_ + source.length_, target);
-            if (ec != std::errc()) {
-                return false;
-            }
-        } else {
-            // varchar is vector
-            SizeT varchar_len = source.length_;
-            u32 chunk_id = source.vector_.chunk_id_;
-            u32 chunk_offset = source.vector_.chunk_offset_;
-            auto varchar_ptr = MakeUniqueForOverwrite<char[]>(varchar_len + 1);
-            varchar_ptr[varchar_len] = '\0';
-            source_vector->buffer_->fix_heap_mgr_->ReadFromHeap(varchar_ptr.get(), chunk_id, chunk_offset, varchar_len);
-
-            auto [ptr, ec] = std::from_chars(varchar_ptr.get(), varchar_ptr.get() + varchar_len, target);
-            if (ec != std::errc()) {
-                return false;
-            }
+        default: {
+            UnrecoverableError("Unexpected varchar column vector type.");
         }
     }
-    return true;
+    const auto *varchars = reinterpret_cast<const VarcharT *>(heap_vector->data());
+    T *dst = reinterpret_cast<T *>(target->data());
+    String buffer;
+    bool all_converted = true;
+    target->nulls_ptr_->SetAllTrue();
+    for (SizeT idx = 0; idx < count; ++idx, dst += dimension) {
+        i64 element_count = -1;
+        if (source->nulls_ptr_->IsTrue(idx)) {
+            const VarcharT &varchar = varchars[codes == nullptr ? idx : codes[idx]];
+            element_count = ParseEmbedding(VarcharView(varchar, heap_vector, buffer), ',', dst, dimension);
+            all_converted = all_converted && element_count >= 0;
+        }
+        if (element_count < 0) {
+            target->nulls_ptr_->SetFalse(idx);
+            element_count = 0;
+        }
+        std::fill(dst + element_count, dst + dimension, T{});
+    }
+    target->Finalize(count);
+    return all_converted;
 }
 
 } // namespace infinity
@@ -14,6 +14,8 @@
 
 module;
 
+#include <cstring>
+
 module like;
 
 import stl;
@@ -26,91 +28,248 @@ import scalar_function_set;
 import third_party;
 import internal_types;
 import data_type;
+import column_vector;
+import data_block;
+import bitmask;
 
 namespace infinity {
 
-bool LikeOperator(const ptr_t left_ptr, SizeT left_len, const ptr_t right_ptr, SizeT right_len) {
-    SizeT left_idx{0}, right_idx{0};
-
-    while (right_idx < right_len) {
-        char left_char = left_ptr[left_idx];
-        char right_char = right_ptr[right_idx];
-        if (right_char == '_' or (left_char == right_char)) {
-            ++left_idx;
-            ++right_idx;
-        } else if (right_char == '%') {
-            ++right_idx;
-
-            // If there are more than one %
-            while (right_idx < right_len && right_ptr[right_idx] == '%') {
-                ++right_idx;
+namespace {
+
+// A LIKE pattern compiled into the shape it has. Patterns like 'foo', 'foo%', '%foo' and '%foo%' are matched by one
+// compare or one memmem of the literal, other patterns by their segments between the '%'s.
+class LikeMatcher {
+public:
+    explicit LikeMatcher(String pattern) : pattern_(std::move(pattern)) {
+        SizeT begin = 0;
+        while (true) {
+            SizeT end = pattern_.find('%', begin);
+            segments_.emplace_back(pattern_.data() + begin, (end == String::npos ? pattern_.size() : end) - begin);
+            if (end == String::npos) {
+                break;
+            }
+            begin = end + 1;
+        }
+        // the empty segments between '%'s don't constrain the match, except the first and the last
+        Vector<std::string_view> segments{segments_.front()};
+        for (SizeT i = 1; i + 1 < segments_.size(); ++i) {
+            if (!segments_[i].empty()) {
+                segments.push_back(segments_[i]);
             }
+        }
+        if (segments_.size() > 1) {
+            segments.push_back(segments_.back());
+        }
+        segments_ = std::move(segments);
+
+        bool has_underscore = pattern_.find('_') != String::npos;
+        if (has_underscore || segments_.size() > 3 || (segments_.size() == 3 && (!segments_[0].empty() || !segments_[2].empty()))) {
+            shape_ = Shape::kSegments;
+        } else if (segments_.size() == 1) {
+            shape_ = Shape::kExact;
+            literal_ = segments_[0];
+        } else if (segments_.size() == 3) {
+            shape_ = Shape::kContains;
+            literal_ = segments_[1];
+        } else if (segments_[1].empty()) {
+            shape_ = Shape::kPrefix;
+            literal_ = segments_[0];
+        } else if (segments_[0].empty()) {
+            shape_ = Shape::kSuffix;
+            literal_ = segments_[1];
+        } else {
+            shape_ = Shape::kSegments;
+        }
+    }
 
-            // % is the last character
-            if (right_idx == right_len) {
+    // The chars kept in the VarcharT reject most values of the wrong length or prefix before the heap is read, and a
+    // prefix no longer than the inline chars is matched without the heap.
+    bool Match(const ColumnValueReader<VarcharT> &value, String &buffer) const {
+        SizeT length = value.GetLength();
+        if (length < MinLength()) {
+            return false;
+        }
+        if (shape_ == Shape::kExact && length != literal_.size()) {
+            return false;
+        }
+        std::string_view inline_view = value.GetInlineView();
+        if (shape_ == Shape::kPrefix || shape_ == Shape::kExact || shape_ == Shape::kSegments) {
+            std::string_view prefix = shape_ == Shape::kSegments ? segments_.front() : literal_;
+            SizeT check_len = std::min(prefix.size(), inline_view.size());
+            if (!SegmentMatch(inline_view.data(), prefix.substr(0, check_len))) {
+                return false;
+            }
+            if (shape_ == Shape::kPrefix && check_len == prefix.size()) {
                 return true;
             }
+        }
+        if (inline_view.size() == length) {
+            return Match(inline_view);
+        }
+        value.GetString(buffer);
+        return Match(buffer);
+    }
 
-            // Check any left part is matched with rest of right part.
-            while (left_idx < left_len) {
-                if (LikeOperator(&left_ptr[left_idx], left_len - left_idx, &right_ptr[right_idx], right_len - right_idx)) {
-                    return true;
-                }
-                ++left_idx;
+    bool Match(std::string_view value) const {
+        switch (shape_) {
+            case Shape::kExact: {
+                return value == literal_;
+            }
+            case Shape::kPrefix: {
+                return value.starts_with(literal_);
+            }
+            case Shape::kSuffix: {
+                return value.ends_with(literal_);
+            }
+            case Shape::kContains: {
+                return literal_.empty() || memmem(value.data(), value.size(), literal_.data(), literal_.size()) != nullptr;
             }
+            case Shape::kSegments: {
+                return SegmentsMatch(value);
+            }
+        }
+        return false;
+    }
+
+private:
+    enum class Shape { kExact, kPrefix, kSuffix, kContains, kSegments };
+
+    SizeT MinLength() const {
+        SizeT min_length = 0;
+        for (std::string_view segment : segments_) {
+            min_length += segment.size();
+        }
+        return min_length;
+    }
 
-            // Not matched
+    // A segment matches the chars at value, '_' matches any char.
+    static bool SegmentMatch(const char *value, std::string_view segment) {
+        for (SizeT i = 0; i < segment.size(); ++i) {
+            if (segment[i] != '_' && segment[i] != value[i]) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // The first segment is matched at the start and the last at the end. Each segment in between is matched at its first
+    // position after the previous one, the leftmost match leaves the most room for the next segments.
+    bool SegmentsMatch(std::string_view value) const {
+        std::string_view first = segments_.front();
+        if (segments_.size() == 1) {
+            return value.size() == first.size() && SegmentMatch(value.data(), first);
+        }
+        if (value.size() < first.size() || !SegmentMatch(value.data(), first)) {
             return false;
-        } else {
+        }
+        std::string_view last = segments_.back();
+        if (value.size() < first.size() + last.size()) {
             return false;
         }
+        SizeT begin = first.size();
+        SizeT end = value.size() - last.size();
+        if (!SegmentMatch(value.data() + end, last)) {
+            return false;
+        }
+        for (SizeT i = 1; i + 1 < segments_.size(); ++i) {
+            std::string_view segment = segments_[i];
+            while (begin + segment.size() <= end && !SegmentMatch(value.data() + begin, segment)) {
+                ++begin;
+            }
+            if (begin + segment.size() > end) {
+                return false;
+            }
+            begin += segment.size();
+        }
+        return true;
     }
 
-    while (right_idx < right_len && right_ptr[right_idx] == '%') {
-        ++right_idx;
-    }
+    String pattern_;
+    Vector<std::string_view> segments_;
+    Shape shape_{Shape::kSegments};
+    std::string_view literal_;
+};
 
-    return left_idx == left_len && right_idx == right_len;
+bool ReaderValueLike(const ColumnValueReader<VarcharT> &left, const ColumnValueReader<VarcharT> &right) {
+    String pattern;
+    right.GetString(pattern);
+    String buffer;
+    return LikeMatcher(std::move(pattern)).Match(left, buffer);
 }
 
 struct LikeFunction {
     template <typename TA, typename TB, typename TC>
-    static inline void Run(TA, TB, TC &) {
-        UnrecoverableError("Not implement: LikeFunction");
+    static inline void Run(TA &left, TB &right, TC &result) {
+        result.SetValue(ReaderValueLike(left, right));
     }
 };
 
-template <>
-inline void LikeFunction::Run(VarcharT &, VarcharT &, bool &) {
-    UnrecoverableError("Not implement: varchar like varchar");
-
-//    ptr_t left_ptr = left.GetDataPtr();
-//    SizeT left_len = left.GetDataLen();
-//    ptr_t right_ptr = right.GetDataPtr();
-//    SizeT right_len = right.GetDataLen();
-
-//    result = LikeOperator(left_ptr, left_len, right_ptr, right_len);
-}
-
 struct NotLikeFunction {
     template <typename TA, typename TB, typename TC>
-    static inline void Run(TA, TB, TC &) {
-        UnrecoverableError("Not implement: not like function");
+    static inline void Run(TA &left, TB &right, TC &result) {
+        result.SetValue(!ReaderValueLike(left, right));
     }
 };
 
-template <>
-inline void NotLikeFunction::Run(VarcharT &, VarcharT &, bool &) {
-    UnrecoverableError("Not implement: varchar not like varchar");
+// A constant pattern is compiled once for the block and the values of a dictionary are matched once each. Other inputs
+// take the generic path of the binary function.
+template <bool Negate>
+void LikeBlock(const DataBlock &input, SharedPtr<ColumnVector> &output) {
+    const SharedPtr<ColumnVector> &left = input.column_vectors[0];
+    const SharedPtr<ColumnVector> &right = input.column_vectors[1];
+    ColumnVectorType left_type = left->vector_type();
+    if (right->vector_type() != ColumnVectorType::kConstant ||
+        (left_type != ColumnVectorType::kFlat && left_type != ColumnVectorType::kDictionary)) {
+        using Function = std::conditional_t<Negate, NotLikeFunction, LikeFunction>;
+        return ScalarFunction::BinaryFunction<VarcharT, VarcharT, BooleanT, Function>(input, output);
+    }
 
-//    ptr_t left_ptr = left.GetDataPtr();
-//    SizeT left_len = left.GetDataLen();
-//    ptr_t right_ptr = right.GetDataPtr();
-//    SizeT right_len = right.GetDataLen();
+    SizeT count = input.row_count();
+    SharedPtr<Bitmask> &result_null = output->nulls_ptr_;
+    if (!right->nulls_ptr_->IsAllTrue()) {
+        result_null->SetAllFalse();
+        output->Finalize(count);
+        return;
+    }
+    String pattern;
+    ColumnValueReader<VarcharT>(right)[0].GetString(pattern);
+    LikeMatcher matcher(std::move(pattern));
+    String buffer;
+    BooleanColumnWriter result_writer(output);
 
-//    result = !LikeOperator(left_ptr, left_len, right_ptr, right_len);
+    const SharedPtr<Bitmask> &left_null = left->nulls_ptr_;
+    result_null->SetAllTrue();
+    if (left_type == ColumnVectorType::kDictionary) {
+        const SharedPtr<ColumnVector> &dictionary = left->dictionary();
+        ColumnValueReader<VarcharT> values(dictionary);
+        Vector<u8> dictionary_results(dictionary->Size());
+        for (SizeT code = 0; code < dictionary_results.size(); ++code) {
+            dictionary_results[code] = matcher.Match(values[code], buffer) != Negate;
+        }
+        const u32 *codes = left->dictionary_codes();
+        for (SizeT idx = 0; idx < count; ++idx) {
+            if (!left_null->IsTrue(idx)) {
+                result_null->SetFalse(idx);
+                continue;
+            }
+            result_writer[idx].SetValue(dictionary_results[codes[idx]]);
+        }
+    } else {
+        ColumnValueReader<VarcharT> values(left);
+        bool all_valid = left_null->IsAllTrue();
+        for (SizeT idx = 0; idx < count; ++idx) {
+            if (!all_valid && !left_null->IsTrue(idx)) {
+                result_null->SetFalse(idx);
+                continue;
+            }
+            result_writer[idx].SetValue(matcher.Match(values[idx], buffer) != Negate);
+        }
+    }
+    output->Finalize(count);
 }
 
+} // namespace
+
 void RegisterLikeFunction(const UniquePtr<Catalog> &catalog_ptr) {
     String func_name = "like";
 
@@ -119,7 +278,7 @@ void RegisterLikeFunction(const UniquePtr<Catalog> &catalog_ptr) {
     ScalarFunction varchar_like_function(func_name,
                                          {DataType(LogicalType::kVarchar), DataType(LogicalType::kVarchar)},
                                          DataType(kBoolean),
-                                         &ScalarFunction::BinaryFunction<VarcharT, VarcharT, BooleanT, LikeFunction>);
+                                         &LikeBlock<false>);
     function_set_ptr->AddFunction(varchar_like_function);
 
     Catalog::AddFunctionSet(catalog_ptr.get(), function_set_ptr);
@@ -133,7 +292,7 @@ void RegisterNotLikeFunction(const UniquePtr<Catalog> &catalog_ptr) {
     ScalarFunction varchar_not_like_function(func_name,
                                              {DataType(LogicalType::kVarchar), DataType(LogicalType::kVarchar)},
                                              DataType(kBoolean),
-                                             &ScalarFunction::BinaryFunction<VarcharT, VarcharT, BooleanT, NotLikeFunction>);
+                                             &LikeBlock<true>);
     function_set_ptr->AddFunction(varchar_not_like_function);
 
     Catalog::AddFunctionSet(catalog_ptr.get(), function_set_ptr);
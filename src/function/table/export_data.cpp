@@ -0,0 +1,71 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+module export_data;
+
+import stl;
+import local_file_system;
+import file_system;
+import file_system_type;
+import infinity_exception;
+import third_party;
+
+namespace infinity {
+
+ExportSharedData::ExportSharedData(const String &file_path, SizeT task_count) : unfinished_task_n_(task_count) {
+    file_handler_ = fs_.OpenFile(file_path, FileFlags::WRITE_FLAG | FileFlags::TRUNCATE_CREATE, FileLockType::kWriteLock);
+}
+
+ExportSharedData::~ExportSharedData() {
+    if (file_handler_.get() != nullptr) {
+        fs_.Close(*file_handler_);
+    }
+}
+
+void ExportSharedData::AppendRows(std::string_view rows, SizeT row_count, std::string_view separator) {
+    std::unique_lock lock(mutex_);
+    if (row_count_ > 0 && !separator.empty()) {
+        WriteAll(separator);
+    }
+    WriteAll(rows);
+    row_count_ += row_count;
+}
+
+void ExportSharedData::AppendRaw(std::string_view bytes) {
+    std::unique_lock lock(mutex_);
+    WriteAll(bytes);
+}
+
+bool ExportSharedData::FinishTask() { return --unfinished_task_n_ == 0; }
+
+void ExportSharedData::Close() {
+    std::unique_lock lock(mutex_);
+    fs_.Close(*file_handler_);
+    file_handler_.reset();
+}
+
+void ExportSharedData::WriteAll(std::string_view bytes) {
+    SizeT written = 0;
+    while (written < bytes.size()) {
+        i64 write_count = fs_.Write(*file_handler_, bytes.data() + written, bytes.size() - written);
+        if (write_count <= 0) {
+            UnrecoverableError(fmt::format("Can't write export file: {}", file_handler_->path_.string()));
+        }
+        written += write_count;
+    }
+}
+
+} // namespace infinity
@@ -0,0 +1,58 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module export_data;
+
+import stl;
+import local_file_system;
+import file_system;
+
+namespace infinity {
+
+// The output file shared by the tasks of a parallel export. Each task formats the rows of its segments into its own buffer,
+// a full buffer is written in one call, so the rows of different tasks never interleave inside a write.
+export struct ExportSharedData {
+    ExportSharedData(const String &file_path, SizeT task_count);
+
+    // Close the file when a task failed before the last task finished.
+    ~ExportSharedData();
+
+    // Write the buffer holding the rows, separator is written before it when some rows are already in the file.
+    void AppendRows(std::string_view rows, SizeT row_count, std::string_view separator = {});
+
+    // Write the bytes without counting any row, for the header and the footer of the file.
+    void AppendRaw(std::string_view bytes);
+
+    // Return true for the last task of the export.
+    bool FinishTask();
+
+    void Close();
+
+    inline u64 RowCount() const { return row_count_; }
+
+private:
+    void WriteAll(std::string_view bytes);
+
+    LocalFileSystem fs_{};
+    UniquePtr<FileHandler> file_handler_{};
+
+    mutex mutex_{};
+    u64 row_count_{0};
+
+    atomic_u64 unfinished_task_n_{0};
+};
+
+} // namespace infinity
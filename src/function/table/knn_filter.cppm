@@ -59,4 +59,17 @@ private:
     DeleteFilter delete_filter_;
 };
 
+// Keeps the rows of `filter` below `row_count`, for an index that takes rows appended after the filter was made.
+export template <typename Filter>
+class RowCountFilter final : public FilterBase<SegmentOffset> {
+public:
+    RowCountFilter(SegmentOffset row_count, const Filter &filter) : row_count_(row_count), filter_(filter) {}
+
+    bool operator()(const SegmentOffset &segment_offset) const final { return segment_offset < row_count_ && filter_(segment_offset); }
+
+private:
+    const SegmentOffset row_count_;
+    const Filter &filter_;
+};
+
 } // namespace infinity
@@ -14,6 +14,8 @@
 
 module;
 
+#include <cstdlib>
+
 module knn_scan_data;
 
 import stl;
@@ -41,9 +43,105 @@ import expression_state;
 import internal_types;
 import data_type;
 import status;
+import block_column_entry;
+import segment_index_entry;
+import buffer_manager;
+import table_entry;
+import table_index_entry;
+import index_base;
+import embedding_info;
 
 namespace infinity {
 
+KnnScanSharedData::~KnnScanSharedData() {
+    // The prefetched buffers belong to the table entries of this query, don't let a read outlive it.
+    for (auto &prefetch : prefetches_) {
+        prefetch.wait();
+    }
+}
+
+void KnnScanSharedData::PrefetchBlock(u64 block_column_idx, BufferManager *buffer_mgr) {
+    if (block_column_idx >= block_column_entries_->size()) {
+        return;
+    }
+    auto prefetch = buffer_mgr->Prefetch(block_column_entries_->at(block_column_idx)->buffer());
+    std::unique_lock lock(prefetch_mutex_);
+    prefetches_.push_back(std::move(prefetch));
+}
+
+void KnnScanSharedData::PrefetchIndex(u64 index_idx, BufferManager *buffer_mgr) {
+    if (index_idx >= index_entries_->size()) {
+        return;
+    }
+    auto prefetch = buffer_mgr->Prefetch(index_entries_->at(index_idx)->GetIndexBufferObj());
+    std::unique_lock lock(prefetch_mutex_);
+    prefetches_.push_back(std::move(prefetch));
+}
+
+void KnnScanSharedData::InitUnitQuery() {
+    if (knn_distance_type_ != KnnDistanceType::kCosine || elem_type_ != EmbeddingDataType::kElemFloat) {
+        return;
+    }
+    unit_query_ = MakeUniqueForOverwrite<f32[]>(query_count_ * dimension_);
+    const auto *query = static_cast<const f32 *>(query_embedding_);
+    for (u64 i = 0; i < query_count_; ++i) {
+        L2Normalize(unit_query_.get() + i * dimension_, query + i * dimension_, dimension_);
+    }
+}
+
+void KnnScanSharedData::InitTokenDim() {
+    if (knn_distance_type_ != KnnDistanceType::kMaxSim) {
+        return;
+    }
+    // checked by the binder
+    for (const auto &opt_param : opt_params_) {
+        if (opt_param.param_name_ == "token_dim") {
+            token_dim_ = std::strtoul(opt_param.param_value_.c_str(), nullptr, 10);
+        }
+    }
+}
+
+void KnnScanSharedData::InitResultCacheKey() {
+    bool use_cache = false;
+    for (const auto &opt_param : opt_params_) {
+        use_cache = use_cache || (opt_param.param_name_ == "cache" && opt_param.param_value_ == "true");
+    }
+    if (!use_cache) {
+        return;
+    }
+    result_cache_key_ = fmt::format("{}.{}|{}|{}|{}|{}|{}|",
+                                    *table_ref_->schema_name(),
+                                    *table_ref_->table_name(),
+                                    i32(elem_type_),
+                                    i32(knn_distance_type_),
+                                    topk_,
+                                    dimension_,
+                                    query_count_);
+    for (const auto &opt_param : opt_params_) {
+        result_cache_key_ += fmt::format("{}={};", opt_param.param_name_, opt_param.param_value_);
+    }
+    if (filter_expression_) {
+        result_cache_key_ += filter_expression_->ToString();
+    }
+    result_cache_key_ += '|';
+    const SizeT query_bytes = EmbeddingType::EmbeddingSize(elem_type_, dimension_) * query_count_;
+    result_cache_key_.append(static_cast<const char *>(query_embedding_), query_bytes);
+}
+
+String KnnScanSharedData::ResultCacheKey(const SegmentIndexEntry *segment_index_entry) const {
+    if (result_cache_key_.empty()) {
+        return {};
+    }
+    // a new version of the index, a rebuilt graph or more hnsw chunks, gets new entries
+    auto *segment_index = const_cast<SegmentIndexEntry *>(segment_index_entry);
+    return fmt::format("{}|{}|{}|{}|{}",
+                       result_cache_key_,
+                       *segment_index->table_index_entry()->index_base()->index_name_,
+                       segment_index->segment_id(),
+                       segment_index->max_ts(),
+                       segment_index->GetHnswChunks().size());
+}
+
 template <>
 KnnDistance1<f32>::KnnDistance1(KnnDistanceType dist_type) {
     switch (dist_type) {
@@ -55,6 +153,45 @@ KnnDistance1<f32>::KnnDistance1(KnnDistanceType dist_type) {
             dist_func_ = IPDistance<f32, f32, f32, SizeT>;
             break;
         }
+        case KnnDistanceType::kCosine: {
+            // the queries are normalized by KnnScanSharedData
+            dist_func_ = CosineDistance<f32, f32, f32, SizeT>;
+            break;
+        }
+        case KnnDistanceType::kMaxSim: {
+            // the rows are scored by MergeKnn::SearchMaxSim
+            break;
+        }
+        default: {
+            RecoverableError(Status::NotSupport(fmt::format("KnnDistanceType: {} is not support.", (i32)dist_type)));
+        }
+    }
+}
+
+template <>
+KnnDistance1<i8>::KnnDistance1(KnnDistanceType dist_type) {
+    switch (dist_type) {
+        case KnnDistanceType::kL2: {
+            dist_func_ = L2Distance<f32, i8, i8, SizeT>;
+            break;
+        }
+        case KnnDistanceType::kInnerProduct: {
+            dist_func_ = IPDistance<f32, i8, i8, SizeT>;
+            break;
+        }
+        default: {
+            RecoverableError(Status::NotSupport(fmt::format("KnnDistanceType: {} is not support.", (i32)dist_type)));
+        }
+    }
+}
+
+template <>
+KnnDistance1<u8>::KnnDistance1(KnnDistanceType dist_type) {
+    switch (dist_type) {
+        case KnnDistanceType::kHamming: {
+            dist_func_ = HammingDistance<f32, SizeT>;
+            break;
+        }
         default: {
             RecoverableError(Status::NotSupport(fmt::format("KnnDistanceType: {} is not support.", (i32)dist_type)));
         }
@@ -70,6 +207,14 @@ KnnScanFunctionData::KnnScanFunctionData(KnnScanSharedData *shared_data, u32 cur
             Init<f32>();
             break;
         }
+        case EmbeddingDataType::kElemInt8: {
+            Init<i8>();
+            break;
+        }
+        case EmbeddingDataType::kElemBit: {
+            Init<u8>();
+            break;
+        }
         default: {
             RecoverableError(Status::NotSupport(fmt::format("EmbeddingDataType: {} is not support.", EmbeddingType::EmbeddingDataType2String(knn_scan_shared_data_->elem_type_))));
         }
@@ -84,14 +229,19 @@ void KnnScanFunctionData::Init() {
         }
         case KnnDistanceType::kL2:
         case KnnDistanceType::kHamming: {
-            auto merge_knn_max = MakeUnique<MergeKnn<DataType, CompareMax>>(knn_scan_shared_data_->query_count_, knn_scan_shared_data_->topk_);
+            auto merge_knn_max = MakeUnique<MergeKnn<f32, CompareMax>>(knn_scan_shared_data_->query_count_,
+                                                                       knn_scan_shared_data_->topk_,
+                                                                       knn_scan_shared_data_->threshold_);
             merge_knn_max->Begin();
             merge_knn_base_ = std::move(merge_knn_max);
             break;
         }
         case KnnDistanceType::kCosine:
-        case KnnDistanceType::kInnerProduct: {
-            auto merge_knn_min = MakeUnique<MergeKnn<DataType, CompareMin>>(knn_scan_shared_data_->query_count_, knn_scan_shared_data_->topk_);
+        case KnnDistanceType::kInnerProduct:
+        case KnnDistanceType::kMaxSim: {
+            auto merge_knn_min = MakeUnique<MergeKnn<f32, CompareMin>>(knn_scan_shared_data_->query_count_,
+                                                                       knn_scan_shared_data_->topk_,
+                                                                       knn_scan_shared_data_->threshold_);
             merge_knn_min->Begin();
             merge_knn_base_ = std::move(merge_knn_min);
             break;
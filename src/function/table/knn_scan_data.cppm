@@ -33,6 +33,7 @@ import expression_state;
 import knn_expr;
 import statement_common;
 import base_table_ref;
+import buffer_manager;
 
 namespace infinity {
 
@@ -48,10 +49,36 @@ public:
                       i64 query_embedding_count,
                       void *query_embedding,
                       EmbeddingDataType elem_type,
-                      KnnDistanceType knn_distance_type)
+                      KnnDistanceType knn_distance_type,
+                      Optional<f32> threshold)
         : table_ref_(table_ref), filter_expression_(filter_expression), block_column_entries_(std::move(block_column_entries)),
           index_entries_(std::move(index_entries)), opt_params_(std::move(opt_params)), topk_(topk), dimension_(dimension),
-          query_count_(query_embedding_count), query_embedding_(query_embedding), elem_type_(elem_type), knn_distance_type_(knn_distance_type) {}
+          query_count_(query_embedding_count), query_embedding_(query_embedding), elem_type_(elem_type), knn_distance_type_(knn_distance_type),
+          threshold_(threshold) {
+        InitUnitQuery();
+        InitTokenDim();
+        InitResultCacheKey();
+    }
+
+    ~KnnScanSharedData();
+
+    // Start reading the block or the index a task will claim next, while the current one is searched.
+    void PrefetchBlock(u64 block_column_idx, BufferManager *buffer_mgr);
+
+    void PrefetchIndex(u64 index_idx, BufferManager *buffer_mgr);
+
+    // The key of the results of a segment index in the knn result cache, empty if the query doesn't use the cache.
+    String ResultCacheKey(const SegmentIndexEntry *segment_index_entry) const;
+
+    // The queries to search with, a cosine search on float embeddings uses them scaled to unit length.
+    const void *QueryEmbedding() const { return unit_query_ ? unit_query_.get() : query_embedding_; }
+
+private:
+    void InitUnitQuery();
+
+    void InitTokenDim();
+
+    void InitResultCacheKey();
 
 public:
     const SharedPtr<BaseTableRef> table_ref_{};
@@ -68,9 +95,24 @@ public:
     void *const query_embedding_;
     const EmbeddingDataType elem_type_{EmbeddingDataType::kElemInvalid};
     const KnnDistanceType knn_distance_type_{KnnDistanceType::kInvalid};
+    // a range search keeps every row within the threshold, the index searches widen until they pass it
+    const Optional<f32> threshold_{};
+
+    // the queries normalized once, cosine is then the inner product with a row divided by the row norm
+    UniquePtr<f32[]> unit_query_{};
+
+    // the dimension of a token of a maxsim search, the query and the rows pack tokens
+    u32 token_dim_{};
+
+    // the query, its options and its filter, set when the query is run with the cache option
+    String result_cache_key_{};
 
     atomic_u64 current_block_idx_{0};
     atomic_u64 current_index_idx_{0};
+
+private:
+    std::mutex prefetch_mutex_{};
+    Vector<Future<void>> prefetches_{};
 };
 
 //-------------------------------------------------------------------
@@ -82,16 +124,16 @@ class KnnDistance1 : public KnnDistanceBase1 {
 public:
     KnnDistance1(KnnDistanceType dist_type);
 
-    Vector<DataType> Calculate(const DataType *datas, SizeT data_count, const DataType *query, SizeT dim) {
-        Vector<DataType> res(data_count);
+    Vector<f32> Calculate(const DataType *datas, SizeT data_count, const DataType *query, SizeT dim) {
+        Vector<f32> res(data_count);
         for (SizeT i = 0; i < data_count; ++i) {
             res[i] = dist_func_(query, datas + i * dim, dim);
         }
         return res;
     }
 
-    Vector<DataType> Calculate(const DataType *datas, SizeT data_count, const DataType *query, SizeT dim, Bitmask &bitmask) {
-        Vector<DataType> res(data_count);
+    Vector<f32> Calculate(const DataType *datas, SizeT data_count, const DataType *query, SizeT dim, Bitmask &bitmask) {
+        Vector<f32> res(data_count);
         for (SizeT i = 0; i < data_count; ++i) {
             if (bitmask.IsTrue(i)) {
                 res[i] = dist_func_(query, datas + i * dim, dim);
@@ -101,7 +143,8 @@ public:
     }
 
 public:
-    using DistFunc = DataType (*)(const DataType *, const DataType *, SizeT);
+    // distances are f32 whatever the element type
+    using DistFunc = f32 (*)(const DataType *, const DataType *, SizeT);
 
     DistFunc dist_func_{};
 };
@@ -109,6 +152,13 @@ public:
 template <>
 KnnDistance1<f32>::KnnDistance1(KnnDistanceType dist_type);
 
+template <>
+KnnDistance1<i8>::KnnDistance1(KnnDistanceType dist_type);
+
+// the elements of a bit embedding are packed eight to a byte
+template <>
+KnnDistance1<u8>::KnnDistance1(KnnDistanceType dist_type);
+
 //-------------------------------------------------------------------
 
 export class KnnScanFunctionData final : public TableFunctionData {
@@ -0,0 +1,40 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module match_scan_data;
+
+import stl;
+
+namespace infinity {
+
+// The score threshold shared by the tasks of a parallel full text match. Each task keeps the top n of its own segments,
+// the n-th score of any task is a lower bound of the n-th score of the whole table, so every task may skip the rows below it.
+export struct MatchSharedData {
+    inline float ScoreThreshold() const { return score_threshold_.load(memory_order_relaxed); }
+
+    // Raise the shared threshold to threshold, return the shared threshold after the update.
+    float UpdateScoreThreshold(float threshold) {
+        float current = score_threshold_.load(memory_order_relaxed);
+        while (current < threshold && !score_threshold_.compare_exchange_weak(current, threshold, memory_order_relaxed)) {
+        }
+        return std::max(current, threshold);
+    }
+
+private:
+    Atomic<float> score_threshold_{0.0F};
+};
+
+} // namespace infinity
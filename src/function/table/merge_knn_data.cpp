@@ -31,12 +31,16 @@ MergeKnnFunctionData::MergeKnnFunctionData(i64 query_count,
                                            i64 topk,
                                            EmbeddingDataType elem_type,
                                            KnnDistanceType knn_distance_type,
+                                           Optional<f32> threshold,
                                            SharedPtr<BaseTableRef> table_ref)
-    : query_count_(query_count), topk_(topk), elem_type_(elem_type), table_ref_(table_ref) {
+    : query_count_(query_count), topk_(topk), threshold_(threshold), elem_type_(elem_type), table_ref_(table_ref) {
     switch (elem_type) {
         case kElemInvalid: {
             UnrecoverableError("Invalid element type");
         }
+        // the distances of every element type are f32
+        case kElemInt8:
+        case kElemBit:
         case kElemFloat: {
             MergeKnnFunctionData::InitMergeKnn<f32>(knn_distance_type);
             break;
@@ -55,15 +59,16 @@ void MergeKnnFunctionData::InitMergeKnn(KnnDistanceType knn_distance_type) {
         }
         case KnnDistanceType::kL2:
         case KnnDistanceType::kHamming: {
-            auto merge_knn_max = MakeShared<MergeKnn<DataType, CompareMax>>(query_count_, topk_);
+            auto merge_knn_max = MakeShared<MergeKnn<DataType, CompareMax>>(query_count_, topk_, threshold_);
             merge_knn_max->Begin();
             merge_knn_base_ = std::move(merge_knn_max);
             heap_type_ = MergeKnnHeapType::kMaxHeap;
             break;
         }
         case KnnDistanceType::kCosine:
-        case KnnDistanceType::kInnerProduct: {
-            auto merge_knn_min = MakeShared<MergeKnn<DataType, CompareMin>>(query_count_, topk_);
+        case KnnDistanceType::kInnerProduct:
+        case KnnDistanceType::kMaxSim: {
+            auto merge_knn_min = MakeShared<MergeKnn<DataType, CompareMin>>(query_count_, topk_, threshold_);
             merge_knn_min->Begin();
             merge_knn_base_ = std::move(merge_knn_min);
             heap_type_ = MergeKnnHeapType::kMinHeap;
@@ -38,6 +38,7 @@ public:
                                   i64 topk,
                                   EmbeddingDataType elem_type,
                                   KnnDistanceType knn_distance_type,
+                                  Optional<f32> threshold,
                                   SharedPtr<BaseTableRef> table_ref);
 
 private:
@@ -47,6 +48,7 @@ private:
 public:
     i64 query_count_{};
     i64 topk_{};
+    Optional<f32> threshold_{};
     EmbeddingDataType elem_type_{EmbeddingDataType::kElemInvalid};
     MergeKnnHeapType heap_type_{MergeKnnHeapType::kInvalid};
     SharedPtr<BaseTableRef> table_ref_{};
@@ -19,22 +19,73 @@ import function_data;
 import table_function;
 import global_block_id;
 import block_index;
+import default_values;
 
 export module table_scan_function_data;
 
 namespace infinity {
 
+// Block cursor shared by all tasks of one table scan. Each task claims the next `morsel_size_` blocks when it has
+// read its current ones, so a task that finishes early keeps taking work instead of idling.
+export class TableScanSharedData {
+public:
+    TableScanSharedData(SharedPtr<Vector<GlobalBlockID>> global_block_ids, SizeT morsel_size)
+        : global_block_ids_(std::move(global_block_ids)), morsel_size_(morsel_size) {}
+
+    ~TableScanSharedData() {
+        // The prefetched buffers belong to the table entries of this query, don't let a read outlive it.
+        for (auto &prefetch : prefetches_) {
+            prefetch.wait();
+        }
+    }
+
+    // Claim the block range [begin, end) of global_block_ids_. Return false when all blocks are claimed.
+    bool NextMorsel(u64 &begin, u64 &end) {
+        u64 block_count = global_block_ids_->size();
+        if (next_block_idx_.load() >= block_count) {
+            return false;
+        }
+        begin = next_block_idx_.fetch_add(morsel_size_);
+        if (begin >= block_count) {
+            return false;
+        }
+        end = std::min(begin + morsel_size_, block_count);
+        return true;
+    }
+
+    void AddPrefetch(Future<void> prefetch) {
+        std::unique_lock lock(prefetch_mutex_);
+        prefetches_.push_back(std::move(prefetch));
+    }
+
+    const SharedPtr<Vector<GlobalBlockID>> global_block_ids_{};
+    const u64 morsel_size_{};
+
+private:
+    atomic_u64 next_block_idx_{0};
+
+    std::mutex prefetch_mutex_{};
+    Vector<Future<void>> prefetches_{};
+};
+
 export class TableScanFunctionData : public TableFunctionData {
 public:
-    TableScanFunctionData(const BlockIndex *block_index, const SharedPtr<Vector<GlobalBlockID>> &global_block_ids, const Vector<SizeT> &column_ids)
-        : block_index_(block_index), global_block_ids_(global_block_ids), column_ids_(column_ids) {}
+    TableScanFunctionData(const BlockIndex *block_index, TableScanSharedData *shared_data, const Vector<SizeT> &column_ids)
+        : block_index_(block_index), shared_data_(shared_data), column_ids_(column_ids) {}
 
     const BlockIndex *block_index_{};
-    const SharedPtr<Vector<GlobalBlockID>> &global_block_ids_{};
+    TableScanSharedData *const shared_data_{};
     const Vector<SizeT> &column_ids_{};
 
+    // current morsel is [current_block_ids_idx_, morsel_end_)
     u64 current_block_ids_idx_{0};
+    u64 morsel_end_{0};
     SizeT current_read_offset_{0};
+    // the row ranges of the current block not ruled out by its zone map, None to read the whole block
+    Optional<Vector<Pair<u32, u32>>> zone_row_ranges_{};
+    // the last segment whose FastRoughFilter is checked, and whether it may have matching rows
+    u32 checked_segment_id_{INVALID_SEGMENT_ID};
+    bool checked_segment_may_pass_{true};
 };
 
 } // namespace infinity
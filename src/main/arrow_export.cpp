@@ -0,0 +1,357 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <cerrno>
+
+module arrow_export;
+
+import stl;
+import status;
+import query_result;
+import data_table;
+import data_block;
+import column_vector;
+import bitmask;
+import value;
+import data_type;
+import logical_type;
+import type_info;
+import embedding_info;
+import internal_types;
+import default_values;
+import third_party;
+
+namespace infinity {
+
+namespace {
+
+struct SchemaPrivate {
+    String format_;
+    String name_;
+    Vector<ArrowSchema> child_storage_;
+    Vector<ArrowSchema *> children_;
+};
+
+struct ArrayPrivate {
+    // The column the buffers belong to, it outlives the query result while the consumer holds the array.
+    SharedPtr<ColumnVector> column_;
+    Vector<const void *> buffers_;
+    // A varchar column is copied into arrow offsets and chars.
+    Vector<i32> offsets_;
+    String chars_;
+    Vector<ArrowArray> child_storage_;
+    Vector<ArrowArray *> children_;
+};
+
+struct StreamPrivate {
+    SharedPtr<DataTable> table_;
+    SizeT next_block_{0};
+    String last_error_;
+};
+
+void ReleaseSchema(ArrowSchema *schema) {
+    auto *schema_private = static_cast<SchemaPrivate *>(schema->private_data);
+    for (ArrowSchema *child : schema_private->children_) {
+        // The consumer may have moved a child out, which marks it released.
+        if (child->release != nullptr) {
+            child->release(child);
+        }
+    }
+    delete schema_private;
+    schema->release = nullptr;
+}
+
+void ReleaseArray(ArrowArray *array) {
+    auto *array_private = static_cast<ArrayPrivate *>(array->private_data);
+    for (ArrowArray *child : array_private->children_) {
+        if (child->release != nullptr) {
+            child->release(child);
+        }
+    }
+    delete array_private;
+    array->release = nullptr;
+}
+
+SchemaPrivate *InitSchema(ArrowSchema *schema, String format, const String &name, i64 flags, SizeT child_count) {
+    auto *schema_private = new SchemaPrivate();
+    schema_private->format_ = std::move(format);
+    schema_private->name_ = name;
+    schema_private->child_storage_.resize(child_count);
+    for (ArrowSchema &child : schema_private->child_storage_) {
+        schema_private->children_.push_back(&child);
+    }
+    *schema = ArrowSchema{schema_private->format_.c_str(),
+                          schema_private->name_.c_str(),
+                          nullptr,
+                          flags,
+                          static_cast<i64>(child_count),
+                          schema_private->children_.data(),
+                          nullptr,
+                          ReleaseSchema,
+                          schema_private};
+    return schema_private;
+}
+
+ArrayPrivate *InitArray(ArrowArray *array, SizeT length, SizeT buffer_count, SizeT child_count) {
+    auto *array_private = new ArrayPrivate();
+    array_private->buffers_.resize(buffer_count, nullptr);
+    array_private->child_storage_.resize(child_count);
+    for (ArrowArray &child : array_private->child_storage_) {
+        array_private->children_.push_back(&child);
+    }
+    *array = ArrowArray{static_cast<i64>(length),
+                        0,
+                        0,
+                        static_cast<i64>(buffer_count),
+                        static_cast<i64>(child_count),
+                        array_private->buffers_.data(),
+                        array_private->children_.data(),
+                        nullptr,
+                        ReleaseArray,
+                        array_private};
+    return array_private;
+}
+
+const char *EmbeddingElementFormat(EmbeddingDataType element_type) {
+    switch (element_type) {
+        case kElemInt8:
+            return "c";
+        case kElemInt16:
+            return "s";
+        case kElemInt32:
+            return "i";
+        case kElemInt64:
+            return "l";
+        case kElemFloat:
+            return "f";
+        case kElemDouble:
+            return "g";
+        default:
+            return nullptr;
+    }
+}
+
+// An embedding is a fixed size list of its elements, a bit embedding is a fixed size binary.
+Status ColumnFormat(const DataType &data_type, String &format) {
+    switch (data_type.type()) {
+        case LogicalType::kBoolean: {
+            format = "b";
+            break;
+        }
+        case LogicalType::kTinyInt: {
+            format = "c";
+            break;
+        }
+        case LogicalType::kSmallInt: {
+            format = "s";
+            break;
+        }
+        case LogicalType::kInteger: {
+            format = "i";
+            break;
+        }
+        case LogicalType::kBigInt: {
+            format = "l";
+            break;
+        }
+        case LogicalType::kFloat: {
+            format = "f";
+            break;
+        }
+        case LogicalType::kDouble: {
+            format = "g";
+            break;
+        }
+        case LogicalType::kDate: {
+            format = "tdD";
+            break;
+        }
+        case LogicalType::kVarchar: {
+            format = "u";
+            break;
+        }
+        case LogicalType::kEmbedding: {
+            auto *embedding_info = static_cast<EmbeddingInfo *>(data_type.type_info().get());
+            if (embedding_info->Type() == kElemBit) {
+                format = fmt::format("w:{}", embedding_info->Size());
+            } else if (EmbeddingElementFormat(embedding_info->Type()) != nullptr) {
+                format = fmt::format("+w:{}", embedding_info->Dimension());
+            } else {
+                return Status::NotSupport(fmt::format("Export {} column to arrow", data_type.ToString()));
+            }
+            break;
+        }
+        default: {
+            return Status::NotSupport(fmt::format("Export {} column to arrow", data_type.ToString()));
+        }
+    }
+    return Status::OK();
+}
+
+Status ExportSchema(const DataTable &table, ArrowSchema *schema) {
+    SizeT column_count = table.ColumnCount();
+    SchemaPrivate *schema_private = InitSchema(schema, "+s", "", 0, column_count);
+    for (SizeT column_idx = 0; column_idx < column_count; ++column_idx) {
+        SharedPtr<DataType> data_type = table.GetColumnTypeById(column_idx);
+        String format;
+        Status status = ColumnFormat(*data_type, format);
+        if (!status.ok()) {
+            schema->release(schema);
+            return status;
+        }
+        bool is_list = format.starts_with('+');
+        ArrowSchema *column_schema = schema_private->children_[column_idx];
+        SchemaPrivate *column_private =
+            InitSchema(column_schema, std::move(format), table.GetColumnNameById(column_idx), ARROW_FLAG_NULLABLE, is_list ? 1 : 0);
+        if (is_list) {
+            auto *embedding_info = static_cast<EmbeddingInfo *>(data_type->type_info().get());
+            InitSchema(column_private->children_[0], EmbeddingElementFormat(embedding_info->Type()), "item", 0, 0);
+        }
+    }
+    return Status::OK();
+}
+
+void ExportColumn(SharedPtr<ColumnVector> column, SizeT row_count, ArrowArray *array) {
+    switch (column->vector_type()) {
+        case ColumnVectorType::kDictionary: {
+            column = column->Flatten();
+            break;
+        }
+        case ColumnVectorType::kConstant: {
+            // A constant column keeps its value once, it is repeated for every row.
+            auto flat = MakeShared<ColumnVector>(column->data_type());
+            flat->Initialize(ColumnVectorType::kFlat, std::max(row_count, static_cast<SizeT>(DEFAULT_VECTOR_SIZE)));
+            Value value = column->GetValue(0);
+            for (SizeT row_idx = 0; row_idx < row_count; ++row_idx) {
+                flat->AppendValue(value);
+            }
+            column = std::move(flat);
+            break;
+        }
+        default: {
+            break;
+        }
+    }
+
+    // The null bitmask is bit per row from the low bit of each word, which is the arrow validity bitmap on little endian.
+    const Bitmask *nulls = column->nulls_ptr_.get();
+    const void *validity = nullptr;
+    i64 null_count = 0;
+    if (nulls != nullptr && nulls->GetData() != nullptr) {
+        for (SizeT row_idx = 0; row_idx < row_count; ++row_idx) {
+            null_count += !nulls->IsTrue(row_idx);
+        }
+        if (null_count > 0) {
+            validity = nulls->GetData();
+        }
+    }
+
+    const DataType &data_type = *column->data_type();
+    if (data_type.type() == LogicalType::kVarchar) {
+        ArrayPrivate *array_private = InitArray(array, row_count, 3, 0);
+        array_private->offsets_.reserve(row_count + 1);
+        array_private->offsets_.push_back(0);
+        ColumnValueReader<VarcharT> reader(column);
+        String value;
+        for (SizeT row_idx = 0; row_idx < row_count; ++row_idx) {
+            if (validity == nullptr || nulls->IsTrue(row_idx)) {
+                reader[row_idx].GetString(value);
+                array_private->chars_ += value;
+            }
+            array_private->offsets_.push_back(static_cast<i32>(array_private->chars_.size()));
+        }
+        array_private->buffers_[0] = validity;
+        array_private->buffers_[1] = array_private->offsets_.data();
+        array_private->buffers_[2] = array_private->chars_.data();
+    } else if (data_type.type() == LogicalType::kEmbedding && static_cast<EmbeddingInfo *>(data_type.type_info().get())->Type() != kElemBit) {
+        SizeT dimension = static_cast<EmbeddingInfo *>(data_type.type_info().get())->Dimension();
+        ArrayPrivate *array_private = InitArray(array, row_count, 1, 1);
+        array_private->buffers_[0] = validity;
+        ArrayPrivate *element_private = InitArray(array_private->children_[0], row_count * dimension, 2, 0);
+        element_private->column_ = column;
+        element_private->buffers_[1] = column->data();
+    } else {
+        ArrayPrivate *array_private = InitArray(array, row_count, 2, 0);
+        array_private->column_ = column;
+        array_private->buffers_[0] = validity;
+        array_private->buffers_[1] = column->data();
+    }
+    if (validity != nullptr) {
+        // The validity bitmap is owned by the column as well.
+        static_cast<ArrayPrivate *>(array->private_data)->column_ = column;
+    }
+    array->null_count = null_count;
+}
+
+int StreamGetSchema(ArrowArrayStream *stream, ArrowSchema *out) {
+    auto *stream_private = static_cast<StreamPrivate *>(stream->private_data);
+    Status status = ExportSchema(*stream_private->table_, out);
+    if (!status.ok()) {
+        stream_private->last_error_ = status.message();
+        return EINVAL;
+    }
+    return 0;
+}
+
+int StreamGetNext(ArrowArrayStream *stream, ArrowArray *out) {
+    auto *stream_private = static_cast<StreamPrivate *>(stream->private_data);
+    DataTable &table = *stream_private->table_;
+    if (stream_private->next_block_ == table.DataBlockCount()) {
+        // A released array marks the end of the stream.
+        out->release = nullptr;
+        return 0;
+    }
+    DataBlock *data_block = table.GetDataBlockById(stream_private->next_block_++).get();
+    SizeT row_count = data_block->row_count();
+    SizeT column_count = data_block->column_vectors.size();
+    ArrayPrivate *block_private = InitArray(out, row_count, 1, column_count);
+    for (SizeT column_idx = 0; column_idx < column_count; ++column_idx) {
+        ExportColumn(data_block->column_vectors[column_idx], row_count, block_private->children_[column_idx]);
+    }
+    return 0;
+}
+
+const char *StreamGetLastError(ArrowArrayStream *stream) { return static_cast<StreamPrivate *>(stream->private_data)->last_error_.c_str(); }
+
+void ReleaseStream(ArrowArrayStream *stream) {
+    delete static_cast<StreamPrivate *>(stream->private_data);
+    stream->release = nullptr;
+}
+
+} // namespace
+
+Status ArrowExport::ExportResult(const QueryResult &result, ArrowArrayStream *out) {
+    if (!result.IsOk()) {
+        return Status(result.status_.code(), MakeUnique<String>(result.ErrorMsg()));
+    }
+    if (result.result_table_.get() == nullptr) {
+        return Status::NotSupport("Export a result without a table to arrow");
+    }
+    // A column type arrow can't take fails the export, not the first get_schema of the consumer.
+    ArrowSchema schema{};
+    Status status = ExportSchema(*result.result_table_, &schema);
+    if (!status.ok()) {
+        return status;
+    }
+    schema.release(&schema);
+
+    auto *stream_private = new StreamPrivate();
+    stream_private->table_ = result.result_table_;
+    *out = ArrowArrayStream{StreamGetSchema, StreamGetNext, StreamGetLastError, ReleaseStream, stream_private};
+    return Status::OK();
+}
+
+} // namespace infinity
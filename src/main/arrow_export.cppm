@@ -0,0 +1,69 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+export module arrow_export;
+
+import stl;
+import status;
+import query_result;
+
+namespace infinity {
+
+// The structs of the Arrow C data interface, https://arrow.apache.org/docs/format/CDataInterface.html.
+// numpy and pyarrow import them by address without copying the buffers, e.g. pyarrow.RecordBatchReader._import_from_c.
+
+export constexpr i64 ARROW_FLAG_NULLABLE = 2;
+
+export struct ArrowSchema {
+    const char *format;
+    const char *name;
+    const char *metadata;
+    i64 flags;
+    i64 n_children;
+    ArrowSchema **children;
+    ArrowSchema *dictionary;
+    void (*release)(ArrowSchema *);
+    void *private_data;
+};
+
+export struct ArrowArray {
+    i64 length;
+    i64 null_count;
+    i64 offset;
+    i64 n_buffers;
+    i64 n_children;
+    const void **buffers;
+    ArrowArray **children;
+    ArrowArray *dictionary;
+    void (*release)(ArrowArray *);
+    void *private_data;
+};
+
+export struct ArrowArrayStream {
+    int (*get_schema)(ArrowArrayStream *, ArrowSchema *out);
+    int (*get_next)(ArrowArrayStream *, ArrowArray *out);
+    const char *(*get_last_error)(ArrowArrayStream *);
+    void (*release)(ArrowArrayStream *);
+    void *private_data;
+};
+
+export class ArrowExport {
+public:
+    // Exports the result of an embedded query as a stream of struct arrays, one for each data block.
+    // The arrays point at the buffers of the column vectors and keep them alive until they are released,
+    // only varchar columns and constant columns are copied.
+    static Status ExportResult(const QueryResult &result, ArrowArrayStream *out);
+};
+
+} // namespace infinity
@@ -30,6 +30,7 @@ import local_file_system;
 import utility;
 import status;
 import options;
+import huge_page_allocator;
 
 namespace infinity {
 
@@ -82,7 +83,7 @@ Status Config::ParseTimeInfo(const String &time_info, u64 &time_seconds) {
     u64 time_number = 0;
     for (SizeT i = 0; i < info_size - 1; ++i) {
         if (std::isdigit(time_info[i])) {
-            time_number += time_number * 10 + (time_info[i] - '0');
+            time_number = time_number * 10 + (time_info[i] - '0');
         } else {
             return Status::InvalidTimeInfo(time_info);
         }
@@ -131,16 +132,22 @@ Status Config::Init(const SharedPtr<String> &config_path) {
     u64 default_total_memory_size = GetAvailableMem();
     u64 default_query_cpu_limit = default_total_cpu_number;
     u64 default_query_memory_limit = default_total_memory_size;
+    u64 default_query_concurrency_limit = 2 * default_total_cpu_number;
 
     // Default profiler config
     bool default_enable_profiler = false;
     u64 default_profile_record_capacity = 100;
+    u64 default_slow_query_threshold_ms = 1000;
+    u64 default_query_sample_interval = 1000;
+    u64 default_slow_query_log_capacity = 100;
+    bool default_profile_hardware_counters = false;
 
     // Default network config
     String default_listen_address = "0.0.0.0";
     u32 default_pg_port = 5432;
     u32 default_http_port = 23820;
     u32 default_sdk_port = 23817;
+    u32 default_mux_sdk_port = 23818;
     i32 default_connection_limit = 128;
 
     // Default log config
@@ -159,6 +166,10 @@ Status Config::Init(const SharedPtr<String> &config_path) {
     u64 default_storage_capacity = 64 * 1024lu * 1024lu * 1024lu; // 64Gib
     u64 default_garbage_collection_interval = 0;                  // real-time
     double default_garbage_collection_storage_ratio = 0;          // disable the function
+    u64 default_zone_map_row_count = DEFAULT_ZONE_MAP_ROW_COUNT;
+
+    // Default cold storage config
+    u64 default_cold_data_cache_size = 64 * 1024lu * 1024lu * 1024lu; // 64Gib
 
     // Default buffer config
     u64 default_buffer_pool_size = 4 * 1024lu * 1024lu * 1024lu; // 4Gib
@@ -173,11 +184,25 @@ Status Config::Init(const SharedPtr<String> &config_path) {
     u64 delta_checkpoint_interval_wal_bytes = DELTA_CHECKPOINT_INTERVAL_WAL_BYTES;
     SharedPtr<String> default_wal_dir = MakeShared<String>("/tmp/infinity/wal");
     FlushOption default_flush_at_commit = FlushOption::kOnlyWrite;
+    u64 default_wal_group_commit_max_entries = DEFAULT_WAL_GROUP_COMMIT_MAX_ENTRIES;
+    u64 default_wal_group_commit_latency_us = DEFAULT_WAL_GROUP_COMMIT_LATENCY_US;
+    u64 default_wal_compress_threshold = DEFAULT_WAL_COMPRESS_THRESHOLD;
+    u64 default_insert_bulk_threshold = DEFAULT_INSERT_BULK_THRESHOLD;
+    u64 default_checkpoint_flush_rate_limit = DEFAULT_CHECKPOINT_FLUSH_RATE_LIMIT;
 
     // Default resource config
     String default_resource_dict_path = String("/tmp/infinity/resource");
     u64 default_cleanup_interval_sec = DEFAULT_CLEANUP_INTERVAL_SEC;
+    u64 default_ttl_interval_sec = DEFAULT_TTL_INTERVAL_SEC;
     bool default_enable_compaction = DEFAULT_ENABLE_COMPACTION;
+    u64 default_fulltext_merge_rate_limit = DEFAULT_FULLTEXT_MERGE_RATE_LIMIT;
+
+    // Default replication config
+    u64 default_replication_poll_interval_ms = DEFAULT_REPLICATION_POLL_INTERVAL_MS;
+    u64 default_replication_max_staleness_ms = DEFAULT_REPLICATION_MAX_STALENESS_MS;
+
+    // Default sharding config
+    u64 default_shard_timeout_ms = DEFAULT_SHARD_TIMEOUT_MS;
 
     LocalFileSystem fs;
     if (config_path.get() == nullptr || !fs.Exists(*config_path)) {
@@ -202,12 +227,19 @@ Status Config::Init(const SharedPtr<String> &config_path) {
             system_option_.total_memory_size = default_total_memory_size;
             system_option_.query_cpu_limit = default_query_cpu_limit;
             system_option_.query_memory_limit = default_query_memory_limit;
+            system_option_.query_concurrency_limit = default_query_concurrency_limit;
+            system_option_.numa_aware = false;
+            system_option_.huge_page = HugePageMode::kOff;
         }
 
         // Profiler
         {
             system_option_.enable_profiler = default_enable_profiler;
             system_option_.profile_record_capacity = default_profile_record_capacity;
+            system_option_.slow_query_threshold_ms = default_slow_query_threshold_ms;
+            system_option_.query_sample_interval = default_query_sample_interval;
+            system_option_.slow_query_log_capacity = default_slow_query_log_capacity;
+            system_option_.profile_hardware_counters = default_profile_hardware_counters;
         }
 
         // Network
@@ -216,6 +248,7 @@ Status Config::Init(const SharedPtr<String> &config_path) {
             system_option_.pg_port = default_pg_port;
             system_option_.http_port = default_http_port;
             system_option_.sdk_port = default_sdk_port;
+            system_option_.mux_sdk_port = default_mux_sdk_port;
             system_option_.connection_limit_ = default_connection_limit;
         }
 
@@ -237,6 +270,8 @@ Status Config::Init(const SharedPtr<String> &config_path) {
             system_option_.storage_capacity_ = default_storage_capacity;
             system_option_.garbage_collection_interval_ = default_garbage_collection_interval;
             system_option_.garbage_collection_storage_ratio_ = default_garbage_collection_storage_ratio;
+            system_option_.cold_data_cache_size_ = default_cold_data_cache_size;
+            system_option_.zone_map_row_count_ = default_zone_map_row_count;
         }
 
         // Buffer
@@ -253,13 +288,32 @@ Status Config::Init(const SharedPtr<String> &config_path) {
             system_option_.delta_checkpoint_interval_sec_ = delta_checkpoint_interval_sec;
             system_option_.delta_checkpoint_interval_wal_bytes_ = delta_checkpoint_interval_wal_bytes;
             system_option_.flush_at_commit_ = default_flush_at_commit;
+            system_option_.wal_group_commit_max_entries_ = default_wal_group_commit_max_entries;
+            system_option_.wal_group_commit_latency_us_ = default_wal_group_commit_latency_us;
+            system_option_.wal_compress_threshold_ = default_wal_compress_threshold;
+            system_option_.insert_bulk_threshold_ = default_insert_bulk_threshold;
+            system_option_.checkpoint_flush_rate_limit_ = default_checkpoint_flush_rate_limit;
         }
 
         // Resource
         {
             system_option_.resource_dict_path_ = default_resource_dict_path;
             system_option_.cleanup_interval_ = std::chrono::seconds(default_cleanup_interval_sec);
+            system_option_.ttl_interval_ = std::chrono::seconds(default_ttl_interval_sec);
             system_option_.enable_compaction_ = default_enable_compaction;
+            system_option_.fulltext_merge_rate_limit_ = default_fulltext_merge_rate_limit;
+        }
+
+        // Replication
+        {
+            system_option_.replication_role_ = ReplicationRole::kStandalone;
+            system_option_.replication_poll_interval_ms_ = default_replication_poll_interval_ms;
+            system_option_.replication_max_staleness_ms_ = default_replication_max_staleness_ms;
+        }
+
+        // Sharding
+        {
+            system_option_.shard_timeout_ms_ = default_shard_timeout_ms;
         }
     } else {
         fmt::print("Read config from: {}\n", *config_path);
@@ -341,6 +395,24 @@ Status Config::Init(const SharedPtr<String> &config_path) {
             if (system_option_.query_memory_limit > default_query_memory_limit) {
                 system_option_.query_memory_limit = default_query_memory_limit;
             }
+
+            system_option_.query_concurrency_limit = system_config["query_concurrency_limit"].value_or(2 * system_option_.worker_cpu_limit);
+            if (system_option_.query_concurrency_limit == 0) {
+                system_option_.query_concurrency_limit = 2 * system_option_.worker_cpu_limit;
+            }
+
+            system_option_.numa_aware = system_config["numa_aware"].value_or(false);
+
+            String huge_page_str = system_config["huge_page"].value_or("off");
+            if (IsEqual(huge_page_str, "transparent")) {
+                system_option_.huge_page = HugePageMode::kTransparent;
+            } else if (IsEqual(huge_page_str, "explicit")) {
+                system_option_.huge_page = HugePageMode::kExplicit;
+            } else if (IsEqual(huge_page_str, "off")) {
+                system_option_.huge_page = HugePageMode::kOff;
+            } else {
+                return Status::InvalidParameterValue("huge_page", huge_page_str, "off, transparent or explicit");
+            }
         }
 
         // Profiler
@@ -348,6 +420,17 @@ Status Config::Init(const SharedPtr<String> &config_path) {
             auto profiler_config = config["profiler"];
             system_option_.enable_profiler = profiler_config["enable"].value_or(default_enable_profiler);
             system_option_.profile_record_capacity = profiler_config["profile_record_capacity"].value_or(default_profile_record_capacity);
+            system_option_.query_sample_interval = profiler_config["query_sample_interval"].value_or(default_query_sample_interval);
+            system_option_.slow_query_log_capacity = profiler_config["slow_query_log_capacity"].value_or(default_slow_query_log_capacity);
+            system_option_.profile_hardware_counters = profiler_config["hardware_counters"].value_or(default_profile_hardware_counters);
+
+            String slow_query_threshold_str = profiler_config["slow_query_threshold"].value_or("1s");
+            u64 slow_query_threshold_seconds = 0;
+            Status parse_status = ParseTimeInfo(slow_query_threshold_str, slow_query_threshold_seconds);
+            if (!parse_status.ok()) {
+                return parse_status;
+            }
+            system_option_.slow_query_threshold_ms = slow_query_threshold_seconds * 1000;
         }
 
         // Network
@@ -365,6 +448,7 @@ Status Config::Init(const SharedPtr<String> &config_path) {
             system_option_.pg_port = network_config["pg_port"].value_or(default_pg_port);
             system_option_.http_port = network_config["http_port"].value_or(default_http_port);
             system_option_.sdk_port = network_config["sdk_port"].value_or(default_sdk_port);
+            system_option_.mux_sdk_port = network_config["mux_sdk_port"].value_or(default_mux_sdk_port);
             system_option_.connection_limit_ = network_config["connection_limit"].value_or(default_connection_limit);
         }
 
@@ -423,6 +507,25 @@ Status Config::Init(const SharedPtr<String> &config_path) {
 
             system_option_.garbage_collection_storage_ratio_ =
                 storage_config["garbage_collection_storage_ratio"].value_or(default_garbage_collection_storage_ratio);
+
+            system_option_.cold_data_dir_ = storage_config["cold_data_dir"].value_or("");
+            String cold_data_cache_size_str = storage_config["cold_data_cache_size"].value_or("64GB");
+            Status cold_status = ParseByteSize(cold_data_cache_size_str, system_option_.cold_data_cache_size_);
+            if (!cold_status.ok()) {
+                return cold_status;
+            }
+
+            system_option_.lazy_catalog_load_ = storage_config["lazy_catalog_load"].value_or(false);
+
+            // a zone is a whole number of bitmask units and the blocks are split into whole zones
+            system_option_.zone_map_row_count_ = storage_config["zone_map_row_count"].value_or(default_zone_map_row_count);
+            u64 zone_map_row_count = system_option_.zone_map_row_count_;
+            if (zone_map_row_count != 0 &&
+                (zone_map_row_count % 64 != 0 || zone_map_row_count >= DEFAULT_BLOCK_CAPACITY || DEFAULT_BLOCK_CAPACITY % zone_map_row_count != 0)) {
+                return Status::ConfigurationLimitExceed("zone_map_row_count",
+                                                        std::to_string(zone_map_row_count),
+                                                        fmt::format("0 or a multiple of 64 dividing {}", DEFAULT_BLOCK_CAPACITY));
+            }
         }
 
         // Buffer
@@ -461,6 +564,35 @@ Status Config::Init(const SharedPtr<String> &config_path) {
             if (IsEqual(flush_log_str, "flush_per_second")) {
                 system_option_.flush_at_commit_ = FlushOption::kFlushPerSecond;
             }
+            system_option_.wal_group_commit_max_entries_ =
+                wal_config["group_commit_max_entries"].value_or(default_wal_group_commit_max_entries);
+            system_option_.wal_group_commit_latency_us_ = wal_config["group_commit_latency_us"].value_or(default_wal_group_commit_latency_us);
+            // a batch holds at least one entry, and a commit never waits a second for the batch to fill
+            if (system_option_.wal_group_commit_max_entries_ == 0) {
+                return Status::ConfigurationLimitExceed("group_commit_max_entries", "0", "at least 1");
+            }
+            if (system_option_.wal_group_commit_latency_us_ >= 1000000) {
+                return Status::ConfigurationLimitExceed("group_commit_latency_us",
+                                                        std::to_string(system_option_.wal_group_commit_latency_us_),
+                                                        "less than 1000000");
+            }
+            // "0KB" to disable
+            auto wal_compress_threshold_str = wal_config["compress_threshold"].value_or("64KB");
+            status = ParseByteSize(wal_compress_threshold_str, system_option_.wal_compress_threshold_);
+            if (!status.ok()) {
+                return status;
+            }
+            system_option_.insert_bulk_threshold_ = wal_config["insert_bulk_threshold"].value_or(default_insert_bulk_threshold);
+
+            // bytes per second, e.g. "100MB", no limit if not given
+            system_option_.checkpoint_flush_rate_limit_ = default_checkpoint_flush_rate_limit;
+            String checkpoint_flush_rate_limit_str = wal_config["checkpoint_flush_rate_limit"].value_or("");
+            if (!checkpoint_flush_rate_limit_str.empty()) {
+                status = ParseByteSize(checkpoint_flush_rate_limit_str, system_option_.checkpoint_flush_rate_limit_);
+                if (!status.ok()) {
+                    return status;
+                }
+            }
         }
 
         // Resource
@@ -469,6 +601,70 @@ Status Config::Init(const SharedPtr<String> &config_path) {
             system_option_.resource_dict_path_ = resource_config["dictionary_dir"].value_or(default_resource_dict_path);
             system_option_.cleanup_interval_ = std::chrono::seconds(resource_config["cleanup_interval"].value_or(default_cleanup_interval_sec));
             system_option_.enable_compaction_  = resource_config["enable_compaction"].value_or(default_enable_compaction);
+
+            // a duration like "60s", "0s" to never drop the expired rows
+            String ttl_interval_str = resource_config["ttl_interval"].value_or(fmt::format("{}s", default_ttl_interval_sec));
+            u64 ttl_interval_sec = 0;
+            if (!ParseTimeInfo(ttl_interval_str, ttl_interval_sec).ok()) {
+                return Status::InvalidParameterValue("ttl_interval", ttl_interval_str, "a duration like 60s, 10m or 1h");
+            }
+            system_option_.ttl_interval_ = std::chrono::seconds(ttl_interval_sec);
+
+            // bytes per second, e.g. "64MB", no limit if not given
+            system_option_.fulltext_merge_rate_limit_ = default_fulltext_merge_rate_limit;
+            String fulltext_merge_rate_limit_str = resource_config["fulltext_merge_rate_limit"].value_or("");
+            if (!fulltext_merge_rate_limit_str.empty()) {
+                Status status = ParseByteSize(fulltext_merge_rate_limit_str, system_option_.fulltext_merge_rate_limit_);
+                if (!status.ok()) {
+                    return status;
+                }
+            }
+        }
+
+        // Replication
+        {
+            auto replication_config = config["replication"];
+            String role_str = replication_config["role"].value_or("standalone");
+            if (IsEqual(role_str, "standalone")) {
+                system_option_.replication_role_ = ReplicationRole::kStandalone;
+            } else if (IsEqual(role_str, "leader")) {
+                system_option_.replication_role_ = ReplicationRole::kLeader;
+            } else if (IsEqual(role_str, "follower")) {
+                system_option_.replication_role_ = ReplicationRole::kFollower;
+            } else {
+                return Status::InvalidParameterValue("replication role", role_str, "standalone, leader or follower");
+            }
+            system_option_.replication_leader_address_ = replication_config["leader_address"].value_or("");
+            if (system_option_.replication_role_ == ReplicationRole::kFollower && system_option_.replication_leader_address_.empty()) {
+                return Status::EmptyConfigParameter();
+            }
+            system_option_.replication_poll_interval_ms_ = replication_config["poll_interval_ms"].value_or(default_replication_poll_interval_ms);
+            system_option_.replication_max_staleness_ms_ = replication_config["max_staleness_ms"].value_or(default_replication_max_staleness_ms);
+        }
+
+        // Sharding
+        {
+            auto sharding_config = config["sharding"];
+            // comma separated, e.g. "10.0.0.1:23820,10.0.0.2:23820"
+            String shards_str = sharding_config["shards"].value_or("");
+            SizeT begin = 0;
+            while (begin < shards_str.size()) {
+                SizeT end = shards_str.find(',', begin);
+                if (end == String::npos) {
+                    end = shards_str.size();
+                }
+                String address = shards_str.substr(begin, end - begin);
+                std::erase(address, ' ');
+                if (!address.empty()) {
+                    system_option_.shard_addresses_.push_back(std::move(address));
+                }
+                begin = end + 1;
+            }
+            system_option_.shard_key_ = sharding_config["shard_key"].value_or("");
+            if (!system_option_.shard_addresses_.empty() && system_option_.shard_key_.empty()) {
+                return Status::EmptyConfigParameter();
+            }
+            system_option_.shard_timeout_ms_ = sharding_config["shard_timeout_ms"].value_or(default_shard_timeout_ms);
         }
     }
 
@@ -487,16 +683,37 @@ void Config::PrintAll() const {
     fmt::print(" - total_memory_size: {}\n", Utility::FormatByteSize(system_option_.total_memory_size));
     fmt::print(" - query_cpu_limit: {}\n", system_option_.query_cpu_limit);
     fmt::print(" - query_memory_limit: {}\n", Utility::FormatByteSize(system_option_.query_memory_limit));
+    fmt::print(" - query_concurrency_limit: {}\n", system_option_.query_concurrency_limit);
+    fmt::print(" - numa_aware: {}\n", system_option_.numa_aware);
+    switch (system_option_.huge_page) {
+        case HugePageMode::kOff: {
+            fmt::print(" - huge_page: off\n");
+            break;
+        }
+        case HugePageMode::kTransparent: {
+            fmt::print(" - huge_page: transparent\n");
+            break;
+        }
+        case HugePageMode::kExplicit: {
+            fmt::print(" - huge_page: explicit\n");
+            break;
+        }
+    }
 
     // Profiler
     fmt::print(" - enable_profiler: {}\n", system_option_.enable_profiler);
     fmt::print(" - profile_record_capacity: {}\n", system_option_.profile_record_capacity);
+    fmt::print(" - slow_query_threshold: {}ms\n", system_option_.slow_query_threshold_ms);
+    fmt::print(" - query_sample_interval: {}\n", system_option_.query_sample_interval);
+    fmt::print(" - slow_query_log_capacity: {}\n", system_option_.slow_query_log_capacity);
+    fmt::print(" - profile hardware counters: {}\n", system_option_.profile_hardware_counters);
 
     // Network
     fmt::print(" - listen address: {}\n", system_option_.listen_address);
     fmt::print(" - postgres port: {}\n", system_option_.pg_port);
     fmt::print(" - http port: {}\n", system_option_.http_port);
     fmt::print(" - sdk port: {}\n", system_option_.sdk_port);
+    fmt::print(" - multiplexed sdk port: {}\n", system_option_.mux_sdk_port);
     fmt::print(" - connection limit: {}\n", system_option_.connection_limit_);
 
     // Log
@@ -512,6 +729,12 @@ void Config::PrintAll() const {
     fmt::print(" - storage_capacity: {}\n", Utility::FormatByteSize(system_option_.storage_capacity_));
     fmt::print(" - garbage_collection_interval: {}\n", Utility::FormatTimeInfo(system_option_.garbage_collection_interval_));
     fmt::print(" - garbage_collection_storage_ratio: {}\n", system_option_.garbage_collection_storage_ratio_);
+    if (!system_option_.cold_data_dir_.empty()) {
+        fmt::print(" - cold_data_dir: {}\n", system_option_.cold_data_dir_);
+        fmt::print(" - cold_data_cache_size: {}\n", Utility::FormatByteSize(system_option_.cold_data_cache_size_));
+    }
+    fmt::print(" - lazy_catalog_load: {}\n", system_option_.lazy_catalog_load_);
+    fmt::print(" - zone_map_row_count: {}\n", system_option_.zone_map_row_count_);
 
     // Buffer
     fmt::print(" - buffer_pool_size: {}\n", Utility::FormatByteSize(system_option_.buffer_pool_size));
@@ -541,9 +764,35 @@ void Config::PrintAll() const {
         }
     }
     fmt::print(" - flush_at_commit: {}\n", flush_str);
+    fmt::print(" - group_commit_max_entries: {}\n", system_option_.wal_group_commit_max_entries_);
+    fmt::print(" - group_commit_latency_us: {}\n", system_option_.wal_group_commit_latency_us_);
+    fmt::print(" - compress_threshold: {}\n", Utility::FormatByteSize(system_option_.wal_compress_threshold_));
+    fmt::print(" - insert_bulk_threshold: {}\n", system_option_.insert_bulk_threshold_);
+    fmt::print(" - checkpoint_flush_rate_limit: {}/s\n", Utility::FormatByteSize(system_option_.checkpoint_flush_rate_limit_));
 
     // Resource
     fmt::print(" - dictionary_dir: {}\n", system_option_.resource_dict_path_.c_str());
+    fmt::print(" - ttl_interval: {}s\n", system_option_.ttl_interval_.count());
+    fmt::print(" - fulltext_merge_rate_limit: {}/s\n", Utility::FormatByteSize(system_option_.fulltext_merge_rate_limit_));
+
+    // Replication
+    fmt::print(" - replication_role: {}\n", ReplicationRoleToString(system_option_.replication_role_));
+    if (system_option_.replication_role_ == ReplicationRole::kFollower) {
+        fmt::print(" - replication_leader_address: {}\n", system_option_.replication_leader_address_);
+        fmt::print(" - replication_poll_interval_ms: {}\n", system_option_.replication_poll_interval_ms_);
+        fmt::print(" - replication_max_staleness_ms: {}\n", system_option_.replication_max_staleness_ms_);
+    }
+
+    // Sharding
+    if (!system_option_.shard_addresses_.empty()) {
+        String shards_str;
+        for (const auto &address : system_option_.shard_addresses_) {
+            shards_str += shards_str.empty() ? address : "," + address;
+        }
+        fmt::print(" - shards: {}\n", shards_str);
+        fmt::print(" - shard_key: {}\n", system_option_.shard_key_);
+        fmt::print(" - shard_timeout_ms: {}\n", system_option_.shard_timeout_ms_);
+    }
 }
 
 void SystemVariables::InitVariablesMap() {
@@ -562,6 +811,7 @@ void SystemVariables::InitVariablesMap() {
     map_["data_url"] = SysVar::kDataURL;
     map_["time_zone"] = SysVar::kTimezone;
     map_["flush_at_commit"] = SysVar::kLogFlushPolicy;
+    map_["background_task_queue"] = SysVar::kBackgroundTaskQueue;
 }
 
 HashMap<String, SysVar> SystemVariables::map_;
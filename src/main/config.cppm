@@ -19,6 +19,7 @@ import stl;
 import third_party;
 import options;
 import status;
+import huge_page_allocator;
 
 namespace infinity {
 
@@ -26,6 +27,8 @@ export constexpr std::string_view profile_history_capacity_name = "profile_histo
 export constexpr std::string_view enable_profiling_name = "enable_profile";
 export constexpr std::string_view worker_cpu_limit = "cpu_count";
 export constexpr std::string_view log_level = "log_level";
+export constexpr std::string_view query_priority_name = "query_priority";
+export constexpr std::string_view query_timeout_name = "query_timeout";
 
 export struct Config {
 public:
@@ -50,6 +53,12 @@ public:
 
     [[nodiscard]] inline u64 query_memory_limit() const { return system_option_.query_memory_limit; }
 
+    [[nodiscard]] inline u64 query_concurrency_limit() const { return system_option_.query_concurrency_limit; }
+
+    [[nodiscard]] inline bool numa_aware() const { return system_option_.numa_aware; }
+
+    [[nodiscard]] inline HugePageMode huge_page() const { return system_option_.huge_page; }
+
     // Network
     [[nodiscard]] inline String listen_address() const { return system_option_.listen_address; }
 
@@ -59,6 +68,9 @@ public:
 
     [[nodiscard]] inline u32 sdk_port() const { return system_option_.sdk_port; }
 
+    // many requests in flight on one connection, see MultiplexedThriftServer
+    [[nodiscard]] inline u32 mux_sdk_port() const { return system_option_.mux_sdk_port; }
+
     [[nodiscard]] inline i32 connection_limit() const { return system_option_.connection_limit_; }
 
     // Profiler
@@ -66,6 +78,14 @@ public:
 
     [[nodiscard]] inline SizeT profile_record_capacity() const { return system_option_.profile_record_capacity; }
 
+    [[nodiscard]] inline u64 slow_query_threshold_ms() const { return system_option_.slow_query_threshold_ms; }
+
+    [[nodiscard]] inline u64 query_sample_interval() const { return system_option_.query_sample_interval; }
+
+    [[nodiscard]] inline SizeT slow_query_log_capacity() const { return system_option_.slow_query_log_capacity; }
+
+    [[nodiscard]] inline bool profile_hardware_counters() const { return system_option_.profile_hardware_counters; }
+
     // Log
     [[nodiscard]] inline SharedPtr<String> log_filename() const { return system_option_.log_filename; }
 
@@ -92,6 +112,14 @@ public:
 
     [[nodiscard]] inline double garbage_collection_storage_ratio() const { return system_option_.garbage_collection_storage_ratio_; }
 
+    [[nodiscard]] inline const String &cold_data_dir() const { return system_option_.cold_data_dir_; }
+
+    [[nodiscard]] inline u64 cold_data_cache_size() const { return system_option_.cold_data_cache_size_; }
+
+    [[nodiscard]] inline bool lazy_catalog_load() const { return system_option_.lazy_catalog_load_; }
+
+    [[nodiscard]] inline u64 zone_map_row_count() const { return system_option_.zone_map_row_count_; }
+
     // Buffer
     [[nodiscard]] inline u64 buffer_pool_size() const { return system_option_.buffer_pool_size; }
 
@@ -112,13 +140,43 @@ public:
 
     [[nodiscard]] inline FlushOption flush_at_commit() const { return system_option_.flush_at_commit_; }
 
+    [[nodiscard]] inline u64 wal_group_commit_max_entries() const { return system_option_.wal_group_commit_max_entries_; }
+
+    [[nodiscard]] inline u64 wal_group_commit_latency_us() const { return system_option_.wal_group_commit_latency_us_; }
+
+    [[nodiscard]] inline u64 wal_compress_threshold() const { return system_option_.wal_compress_threshold_; }
+
+    [[nodiscard]] inline u64 insert_bulk_threshold() const { return system_option_.insert_bulk_threshold_; }
+
+    [[nodiscard]] inline u64 checkpoint_flush_rate_limit() const { return system_option_.checkpoint_flush_rate_limit_; }
+
     // Resource
     [[nodiscard]] inline String resource_dict_path() const { return system_option_.resource_dict_path_; }
 
     [[nodiscard]] inline std::chrono::seconds cleanup_interval() const { return system_option_.cleanup_interval_; }
 
+    [[nodiscard]] inline std::chrono::seconds ttl_interval() const { return system_option_.ttl_interval_; }
+
     [[nodiscard]] inline bool enable_compaction() const { return system_option_.enable_compaction_; }
 
+    [[nodiscard]] inline u64 fulltext_merge_rate_limit() const { return system_option_.fulltext_merge_rate_limit_; }
+
+    // Replication
+    [[nodiscard]] inline ReplicationRole replication_role() const { return system_option_.replication_role_; }
+
+    [[nodiscard]] inline const String &replication_leader_address() const { return system_option_.replication_leader_address_; }
+
+    [[nodiscard]] inline u64 replication_poll_interval_ms() const { return system_option_.replication_poll_interval_ms_; }
+
+    [[nodiscard]] inline u64 replication_max_staleness_ms() const { return system_option_.replication_max_staleness_ms_; }
+
+    // Sharding
+    [[nodiscard]] inline const Vector<String> &shard_addresses() const { return system_option_.shard_addresses_; }
+
+    [[nodiscard]] inline const String &shard_key() const { return system_option_.shard_key_; }
+
+    [[nodiscard]] inline u64 shard_timeout_ms() const { return system_option_.shard_timeout_ms_; }
+
 private:
     static void ParseTimeZoneStr(const String &time_zone_str, String &parsed_time_zone, i32 &parsed_time_zone_bias);
 
@@ -149,6 +207,7 @@ export enum class SysVar {
     kDataURL,
     kTimezone,
     kLogFlushPolicy,
+    kBackgroundTaskQueue,
     kInvalid,
 };
 
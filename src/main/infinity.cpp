@@ -41,6 +41,7 @@ import show_statement;
 import drop_statement;
 import command_statement;
 import select_statement;
+import base_statement;
 import flush_statement;
 import table_reference;
 import insert_statement;
@@ -183,6 +184,8 @@ QueryResult Infinity::Query(const String &query_text) {
     return result;
 }
 
+void Infinity::CancelQuery() { session_->CancelQuery(); }
+
 QueryResult Infinity::Flush() {
     UniquePtr<QueryContext> query_context_ptr = MakeUnique<QueryContext>(session_.get());
     query_context_ptr->Init(InfinityContext::instance().config(),
@@ -488,6 +491,25 @@ QueryResult Infinity::Insert(const String &db_name, const String &table_name, Ve
     return result;
 }
 
+QueryResult
+Infinity::InsertColumnar(const String &db_name, const String &table_name, Vector<String> *columns, Vector<Vector<std::string_view>> column_data) {
+    UniquePtr<QueryContext> query_context_ptr = MakeUnique<QueryContext>(session_.get());
+    query_context_ptr->Init(InfinityContext::instance().config(),
+                            InfinityContext::instance().task_scheduler(),
+                            InfinityContext::instance().storage(),
+                            InfinityContext::instance().resource_manager(),
+                            InfinityContext::instance().session_manager());
+    UniquePtr<InsertStatement> insert_statement = MakeUnique<InsertStatement>();
+
+    insert_statement->schema_name_ = db_name;
+    insert_statement->table_name_ = table_name;
+    insert_statement->columns_ = columns;
+    insert_statement->column_data_ = std::move(column_data);
+
+    QueryResult result = query_context_ptr->QueryStatement(insert_statement.get());
+    return result;
+}
+
 QueryResult Infinity::Import(const String &db_name, const String &table_name, const String &path, ImportOptions import_options) {
     UniquePtr<QueryContext> query_context_ptr = MakeUnique<QueryContext>(session_.get());
     query_context_ptr->Init(InfinityContext::instance().config(),
@@ -595,6 +617,35 @@ Infinity::Search(const String &db_name, const String &table_name, SearchExpr *se
     return result;
 }
 
+Vector<QueryResult> Infinity::BatchSearch(Vector<SearchQuery> queries) {
+    UniquePtr<QueryContext> query_context_ptr = MakeUnique<QueryContext>(session_.get());
+    query_context_ptr->Init(InfinityContext::instance().config(),
+                            InfinityContext::instance().task_scheduler(),
+                            InfinityContext::instance().storage(),
+                            InfinityContext::instance().resource_manager(),
+                            InfinityContext::instance().session_manager());
+    Vector<UniquePtr<SelectStatement>> select_statements;
+    Vector<const BaseStatement *> statements;
+    select_statements.reserve(queries.size());
+    statements.reserve(queries.size());
+    for (auto &query : queries) {
+        UniquePtr<SelectStatement> select_statement = MakeUnique<SelectStatement>();
+
+        auto *table_ref = new TableReference();
+        table_ref->db_name_ = query.db_name_;
+        table_ref->table_name_ = query.table_name_;
+        select_statement->table_ref_ = table_ref;
+        select_statement->select_list_ = query.output_columns_;
+        select_statement->where_expr_ = query.filter_;
+        select_statement->search_expr_ = query.search_expr_;
+
+        statements.emplace_back(select_statement.get());
+        select_statements.emplace_back(std::move(select_statement));
+    }
+
+    return query_context_ptr->QueryStatements(statements);
+}
+
 QueryResult
 Infinity::Optimize(const String &db_name, const String &table_name) {
     UniquePtr<QueryContext> optimize_context_ptr = MakeUnique<QueryContext>(session_.get());
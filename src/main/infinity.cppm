@@ -34,6 +34,15 @@ import explain_statement;
 
 namespace infinity {
 
+// One search of a BatchSearch, as the arguments of Search.
+export struct SearchQuery {
+    String db_name_{};
+    String table_name_{};
+    SearchExpr *search_expr_{};
+    ParsedExpr *filter_{};
+    Vector<ParsedExpr *> *output_columns_{};
+};
+
 export class Infinity {
 public:
     Infinity() = default;
@@ -73,6 +82,9 @@ public:
     // For embedded sqllogictest
     QueryResult Query(const String &query_text);
 
+    // Cancel the query running in this connection from another thread, the query returns kQueryCancelled.
+    void CancelQuery();
+
     // Database related functions
     QueryResult CreateTable(const String &db_name,
                             const String &table_name,
@@ -115,6 +127,9 @@ public:
 
     QueryResult Insert(const String &db_name, const String &table_name, Vector<String> *columns, Vector<Vector<ParsedExpr *> *> *values);
 
+    // column_data[i] is the binary data of the column columns[i], in chunks of whole rows which must outlive the call
+    QueryResult InsertColumnar(const String &db_name, const String &table_name, Vector<String> *columns, Vector<Vector<std::string_view>> column_data);
+
     QueryResult Import(const String &db_name, const String &table_name, const String &path, ImportOptions import_options);
 
     QueryResult Delete(const String &db_name, const String &table_name, ParsedExpr *filter);
@@ -131,6 +146,10 @@ public:
     QueryResult
     Search(const String &db_name, const String &table_name, SearchExpr *search_expr, ParsedExpr *filter, Vector<ParsedExpr *> *output_columns);
 
+    // The searches run one after the other in one txn, so all of them see the same snapshot, and those of the same shape share the
+    // plan. A failed search doesn't stop the others. Takes the expressions of the queries like Search, the results are in their order.
+    Vector<QueryResult> BatchSearch(Vector<SearchQuery> queries);
+
     QueryResult Optimize(const String &db_name, const String &table_name);
 private:
     SharedPtr<BaseSession> session_{};
@@ -40,7 +40,7 @@ void InfinityContext::Init(const SharedPtr<String> &config_path) {
 
         task_scheduler_ = MakeUnique<TaskScheduler>(config_.get());
 
-        session_mgr_ = MakeUnique<SessionManager>();
+        session_mgr_ = MakeUnique<SessionManager>(config_->slow_query_log_capacity());
 
         storage_ = MakeUnique<Storage>(config_.get());
         storage_->Init();
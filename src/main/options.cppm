@@ -18,6 +18,7 @@ export module options;
 
 import stl;
 import third_party;
+import huge_page_allocator;
 
 namespace infinity {
 
@@ -27,12 +28,54 @@ export enum class FlushOption {
     kFlushPerSecond,
 };
 
+// Scheduler lane of the tasks of a query, the lanes with a higher priority get a larger share of the workers.
+export enum class QueryPriority {
+    kInteractive,
+    kBatch,
+    kBackground,
+};
+
+export constexpr SizeT QUERY_PRIORITY_COUNT = 3;
+
+export inline String QueryPriorityToString(QueryPriority priority) {
+    switch (priority) {
+        case QueryPriority::kInteractive:
+            return "interactive";
+        case QueryPriority::kBatch:
+            return "batch";
+        case QueryPriority::kBackground:
+            return "background";
+    }
+    return "invalid";
+}
+
+// A follower tails the wal of its leader and serves read-only queries, a leader serves its wal and files to the followers.
+export enum class ReplicationRole {
+    kStandalone,
+    kLeader,
+    kFollower,
+};
+
+export inline String ReplicationRoleToString(ReplicationRole role) {
+    switch (role) {
+        case ReplicationRole::kStandalone:
+            return "standalone";
+        case ReplicationRole::kLeader:
+            return "leader";
+        case ReplicationRole::kFollower:
+            return "follower";
+    }
+    return "invalid";
+}
+
 export struct SessionOptions {
     inline bool enable_profiling() const { return enable_profiling_; }
     inline u64 profile_history_capacity() const { return profile_history_capacity_; }
 
     bool enable_profiling_{false};      // enable_profile
     u64 profile_history_capacity_{128}; // profile_history_capacity
+    QueryPriority query_priority_{QueryPriority::kInteractive}; // query_priority
+    u64 query_timeout_ms_{0};                                    // query_timeout, 0 means no deadline
 };
 
 export struct SystemOptions {
@@ -46,16 +89,24 @@ export struct SystemOptions {
     u64 total_memory_size{};
     u64 query_cpu_limit{};
     u64 query_memory_limit{};
+    u64 query_concurrency_limit{}; // queries running on the workers at the same time
+    bool numa_aware{};             // schedule the tasks of a segment on the workers of one NUMA node
+    HugePageMode huge_page{HugePageMode::kOff}; // huge pages of the HNSW graphs, the vector stores and the column buffers
 
     // profiler
     bool enable_profiler{};
     u64 profile_record_capacity{};
+    u64 slow_query_threshold_ms{};
+    u64 query_sample_interval{};
+    u64 slow_query_log_capacity{};
+    bool profile_hardware_counters{};
 
     // Network
     String listen_address{};
     u16 pg_port{};
     u32 http_port{};
     u32 sdk_port{};
+    u32 mux_sdk_port{};
     i32 connection_limit_{};
 
     // Log
@@ -74,6 +125,10 @@ export struct SystemOptions {
     u64 storage_capacity_{};
     u64 garbage_collection_interval_{}; // unit: seconds, 0 means real-time
     double garbage_collection_storage_ratio_{}; // 0~1.0, 0 means disable the function
+    String cold_data_dir_{};                    // empty means no cold storage
+    u64 cold_data_cache_size_{};
+    bool lazy_catalog_load_{}; // load the segments and indexes of a table on its first access instead of on boot
+    u64 zone_map_row_count_{}; // 0 means no zone map inside the blocks
 
     // Buffer
     u64 buffer_pool_size{};
@@ -87,11 +142,29 @@ export struct SystemOptions {
     u64 delta_checkpoint_interval_sec_{};
     u64 delta_checkpoint_interval_wal_bytes_{};
     FlushOption flush_at_commit_{FlushOption::kOnlyWrite}; // 0: flush_at_once, 1: only_write, 2: flush_per_second
+    u64 wal_group_commit_max_entries_{};                  // the max entries written and synced as one batch
+    u64 wal_group_commit_latency_us_{};                   // how long a batch smaller than the max waits for more entries
+    u64 wal_compress_threshold_{};                        // min bytes of an appended block to compress in the wal, 0 to disable
+    u64 insert_bulk_threshold_{};                         // min rows of an insert written as an imported segment, 0 to disable
+    u64 checkpoint_flush_rate_limit_{};                   // bytes per second of block data written by a checkpoint, 0 for no limit
 
     // Resource
     String resource_dict_path_{};
     std::chrono::seconds cleanup_interval_{};
+    std::chrono::seconds ttl_interval_{};
     bool enable_compaction_{};
+    u64 fulltext_merge_rate_limit_{}; // bytes per second, 0 for no limit
+
+    // Replication
+    ReplicationRole replication_role_{ReplicationRole::kStandalone};
+    String replication_leader_address_{}; // host:http_port of the leader
+    u64 replication_poll_interval_ms_{};  // how long a follower waits before it polls again when it has caught up
+    u64 replication_max_staleness_ms_{};  // a follower rejects queries when it is behind the leader longer than this, 0 for no bound
+
+    // Sharding
+    Vector<String> shard_addresses_{}; // host:http_port of each shard, a node with shards is a coordinator
+    String shard_key_{};               // the column whose hash places an inserted row on a shard
+    u64 shard_timeout_ms_{};           // the deadline of a request to a shard
 };
 
 } // namespace infinity
@@ -14,6 +14,12 @@
 module;
 
 #include "magic_enum.hpp"
+#include <chrono>
+#include <ctime>
+
+#if defined(__x86_64__)
+#include <x86intrin.h>
+#endif
 
 import stl;
 import third_party;
@@ -21,6 +27,8 @@ import physical_operator;
 import plan_fragment;
 import operator_state;
 import data_block;
+import io_counter;
+import hardware_counter;
 
 import infinity_exception;
 
@@ -28,6 +36,72 @@ module profiler;
 
 namespace infinity {
 
+namespace {
+
+// The cpu time of the calling thread, which doesn't count the time the worker waits or is preempted.
+i64 ThreadCpuTime() {
+    timespec ts{};
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return static_cast<i64>(ts.tv_sec) * 1000 * 1000 * 1000 + ts.tv_nsec;
+}
+
+// Nanoseconds per tick of the time stamp counter, from the ticks over a short wait of the steady clock.
+f64 TscNanoSecondsPerTick() {
+#if defined(__x86_64__)
+    static const f64 nanoseconds_per_tick = [] {
+        auto clock_begin = std::chrono::steady_clock::now();
+        u64 tick_begin = __rdtsc();
+        auto clock_end = clock_begin;
+        while (clock_end - clock_begin < MilliSeconds(10)) {
+            clock_end = std::chrono::steady_clock::now();
+        }
+        u64 ticks = __rdtsc() - tick_begin;
+        f64 nanoseconds = ChronoCast<NanoSeconds>(clock_end - clock_begin).count();
+        return ticks == 0 ? 1.0 : nanoseconds / ticks;
+    }();
+    return nanoseconds_per_tick;
+#else
+    return 1.0;
+#endif
+}
+
+} // namespace
+
+u64 TscClock::Now() {
+#if defined(__x86_64__)
+    return __rdtsc();
+#else
+    return ChronoCast<NanoSeconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+u64 TscClock::ToNanoSeconds(u64 ticks) { return static_cast<u64>(ticks * TscNanoSecondsPerTick()); }
+
+void SlowQueryLog::Append(SlowQueryRecord record) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (capacity_ == 0) {
+        return;
+    }
+    if (records_.size() < capacity_) {
+        records_.push_back(std::move(record));
+    } else {
+        records_[next_idx_] = std::move(record);
+    }
+    next_idx_ = (next_idx_ + 1) % capacity_;
+}
+
+Vector<SlowQueryRecord> SlowQueryLog::GetRecords() const {
+    std::unique_lock<std::mutex> lock(mutex_);
+    Vector<SlowQueryRecord> records;
+    records.reserve(records_.size());
+    // once the log is full, next_idx_ is the oldest record
+    SizeT begin_idx = records_.size() < capacity_ ? 0 : next_idx_;
+    for (SizeT i = 0; i < records_.size(); ++i) {
+        records.push_back(records_[(begin_idx + i) % records_.size()]);
+    }
+    return records;
+}
+
 void BaseProfiler::Begin() {
     finished_ = false;
     begin_ts_ = Now();
@@ -91,6 +165,11 @@ void TaskProfiler::StartOperator(const PhysicalOperator *op) {
         UnrecoverableError("Attempting to call StartOperator while another operator is active.");
     }
     active_operator_ = op;
+    io_begin_ = ThreadIOCounter();
+    if (hardware_counters_) {
+        hardware_begin_valid_ = ReadThreadHardwareCounter(hardware_begin_);
+    }
+    cpu_begin_ = ThreadCpuTime();
     profiler_.Begin();
 }
 void TaskProfiler::StopOperator(const OperatorState *operator_state) {
@@ -101,6 +180,10 @@ void TaskProfiler::StopOperator(const OperatorState *operator_state) {
         UnrecoverableError("Attempting to call StopOperator while another operator is active.");
     }
     profiler_.End();
+    i64 cpu_end = ThreadCpuTime();
+    HardwareCounter hardware_end;
+    bool hardware_end_valid = hardware_begin_valid_ && ReadThreadHardwareCounter(hardware_end);
+    IOCounter io_end = ThreadIOCounter();
 
     uint64_t input_rows{};
     if(operator_state->prev_op_state_ != nullptr) {
@@ -120,7 +203,24 @@ void TaskProfiler::StopOperator(const OperatorState *operator_state) {
         output_rows += output_data_block->Finalized() ? output_data_block->row_count() : 0;
     }
 
-    OperatorInformation info(active_operator_->GetName(), profiler_.GetBegin(), profiler_.GetEnd(), profiler_.Elapsed(), input_rows, output_data_size, output_rows);
+    OperatorInformation info;
+    info.name_ = active_operator_->GetName();
+    info.operator_id_ = active_operator_->node_id();
+    info.start_ = profiler_.GetBegin();
+    info.end_ = profiler_.GetEnd();
+    info.elapsed_ = profiler_.Elapsed();
+    info.cpu_time_ = cpu_end - cpu_begin_;
+    info.input_rows_ = input_rows;
+    info.output_data_size_ = output_data_size;
+    info.output_rows_ = output_rows;
+    info.buffer_hits_ = io_end.buffer_hits_ - io_begin_.buffer_hits_;
+    info.buffer_misses_ = io_end.buffer_misses_ - io_begin_.buffer_misses_;
+    info.spilled_bytes_ = io_end.spilled_bytes_ - io_begin_.spilled_bytes_;
+    if (hardware_end_valid) {
+        info.cycles_ = hardware_end.cycles_ - hardware_begin_.cycles_;
+        info.instructions_ = hardware_end.instructions_ - hardware_begin_.instructions_;
+        info.llc_misses_ = hardware_end.llc_misses_ - hardware_begin_.llc_misses_;
+    }
 
     timings_.push_back(std::move(info));
     active_operator_ = nullptr;
@@ -211,6 +311,31 @@ void QueryProfiler::Flush(TaskProfiler &&profiler) {
     records_[profiler.binding_.fragment_id_][profiler.binding_.task_id_].push_back(profiler);
 }
 
+HashMap<u64, OperatorStatistics> QueryProfiler::OperatorStatisticsByID() const {
+    HashMap<u64, OperatorStatistics> statistics;
+    for (const auto &fragment : records_) {
+        for (const auto &task : fragment.second) {
+            for (const auto &task_profiler : task.second) {
+                for (const auto &op : task_profiler.timings_) {
+                    OperatorStatistics &op_statistics = statistics[op.operator_id_];
+                    ++op_statistics.executions_;
+                    op_statistics.input_rows_ += op.input_rows_;
+                    op_statistics.output_rows_ += op.output_rows_;
+                    op_statistics.elapsed_ += op.elapsed_;
+                    op_statistics.cpu_time_ += op.cpu_time_;
+                    op_statistics.buffer_hits_ += op.buffer_hits_;
+                    op_statistics.buffer_misses_ += op.buffer_misses_;
+                    op_statistics.spilled_bytes_ += op.spilled_bytes_;
+                    op_statistics.cycles_ += op.cycles_;
+                    op_statistics.instructions_ += op.instructions_;
+                    op_statistics.llc_misses_ += op.llc_misses_;
+                }
+            }
+        }
+    }
+    return statistics;
+}
+
 void QueryProfiler::ExecuteRender(std::stringstream &ss) const {
     for (const auto &fragment : records_) {
         ss << "Fragment #" << fragment.first << std::endl;
@@ -224,10 +349,16 @@ void QueryProfiler::ExecuteRender(std::stringstream &ss) const {
                        << ": BeginTime: " << op.start_
                        << ": EndTime: " << op.end_
                        << ": ElapsedTime: " << op.elapsed_
+                       << ", CpuTime: " << op.cpu_time_
                        << ", InputRows: " << op.input_rows_
                        << ", OutputRows: " << op.output_rows_
-                       << ", OutputDataSize: " << op.output_data_size_
-                       << std::endl;
+                       << ", OutputDataSize: " << op.output_data_size_;
+                    if (op.cycles_ != 0) {
+                        ss << ", Cycles: " << op.cycles_
+                           << ", Instructions: " << op.instructions_
+                           << ", LLCMisses: " << op.llc_misses_;
+                    }
+                    ss << std::endl;
                 }
                 times ++;
             }
@@ -259,6 +390,11 @@ String QueryProfiler::ToString() const {
             ExecuteRender(ss);
         }
     }
+    if (u64 lookups = knn_cache_lookups_; lookups > 0) {
+        u64 hits = knn_cache_hits_;
+        ss << "KnnResultCache: Hits: " << hits << ", Lookups: " << lookups << ", HitRatio: " << static_cast<double>(hits * 100) / lookups
+           << "%" << std::endl;
+    }
     return ss.str();
 }
 
@@ -292,9 +428,15 @@ nlohmann::json QueryProfiler::Serialize(const QueryProfiler *profiler) {
                     json_info["start"] = op.start_;
                     json_info["end"] = op.end_;
                     json_info["elapsed"] = op.elapsed_;
+                    json_info["cpu_time"] = op.cpu_time_;
                     json_info["input_rows"] = op.input_rows_;
                     json_info["output_rows"] = op.output_rows_;
                     json_info["output_data_size"] = op.output_data_size_;
+                    if (op.cycles_ != 0) {
+                        json_info["cycles"] = op.cycles_;
+                        json_info["instructions"] = op.instructions_;
+                        json_info["llc_misses"] = op.llc_misses_;
+                    }
                     json_operators["infos"].push_back(json_info);
                 }
                 times ++;
@@ -322,6 +464,12 @@ nlohmann::json QueryProfiler::Serialize(const QueryProfiler *profiler) {
     }
     json["total"] = end - start;
     json["time_unit"] = "ns";
+    if (u64 lookups = profiler->knn_cache_lookups_; lookups > 0) {
+        u64 hits = profiler->knn_cache_hits_;
+        json["knn_result_cache"]["hits"] = hits;
+        json["knn_result_cache"]["lookups"] = lookups;
+        json["knn_result_cache"]["hit_ratio"] = static_cast<double>(hits) / lookups;
+    }
 
     return json;
 }
@@ -19,6 +19,8 @@ export module profiler;
 
 import stl;
 import third_party;
+import io_counter;
+import hardware_counter;
 
 namespace infinity {
 
@@ -81,44 +83,38 @@ export enum class QueryPhase : i8 {
 };
 
 struct OperatorInformation {
-    OperatorInformation() = default;
-
-    OperatorInformation(const OperatorInformation& other)
-        : name_(other.name_), start_(other.start_), end_(other.end_), elapsed_(other.elapsed_), input_rows_(other.input_rows_),
-          output_data_size_(other.output_data_size_), output_rows_(other.output_rows_) {
-
-    }
-
-    OperatorInformation(OperatorInformation&& other)
-        : name_(std::move(other.name_)), start_(other.start_), end_(other.end_), elapsed_(other.elapsed_), input_rows_(other.input_rows_),
-          output_data_size_(other.output_data_size_), output_rows_(other.output_rows_) {
-    }
-
-    OperatorInformation(String name, i64 start, i64 end, i64 elapsed, u16 input_rows, i32 output_data_size, u16 output_rows)
-        : name_(std::move(name)), start_(start), end_(end), elapsed_(elapsed), input_rows_(input_rows), output_data_size_(output_data_size), output_rows_(output_rows) {
-    }
-
-    OperatorInformation& operator=(OperatorInformation&& other) {
-        if (this != &other) {
-            name_ = std::move(other.name_);
-            start_ = std::move(other.start_);
-            end_ = std::move(other.end_);
-            elapsed_ = other.elapsed_;
-            input_rows_ = other.input_rows_;
-            output_rows_ = other.output_rows_;
-            output_data_size_ = other.output_data_size_;
-        }
-        return *this;
-    }
-
     String name_ {};
+    u64 operator_id_ {};
 
     i64 start_ {};
     i64 end_ {};
     i64 elapsed_{};
-    u16 input_rows_ {};
+    i64 cpu_time_{};
+    u64 input_rows_ {};
     i32 output_data_size_ {};
-    u16 output_rows_ {};
+    u64 output_rows_ {};
+    u64 buffer_hits_ {};
+    u64 buffer_misses_ {};
+    u64 spilled_bytes_ {};
+    // zero if the hardware counters are off or unavailable
+    u64 cycles_ {};
+    u64 instructions_ {};
+    u64 llc_misses_ {};
+};
+
+// The runs of one physical operator summed across the tasks of the query, reported by EXPLAIN ANALYZE.
+export struct OperatorStatistics {
+    u64 executions_ {};
+    u64 input_rows_ {};
+    u64 output_rows_ {};
+    i64 elapsed_ {};
+    i64 cpu_time_ {};
+    u64 buffer_hits_ {};
+    u64 buffer_misses_ {};
+    u64 spilled_bytes_ {};
+    u64 cycles_ {};
+    u64 instructions_ {};
+    u64 llc_misses_ {};
 };
 
 export struct TaskBinding {
@@ -144,8 +140,8 @@ class OperatorState;
 
 export class TaskProfiler {
 public:
-    TaskProfiler(TaskBinding binding, bool enable, SizeT operators_len)
-        : binding_(binding), enable_(enable){
+    TaskProfiler(TaskBinding binding, bool enable, SizeT operators_len, bool hardware_counters = false)
+        : binding_(binding), enable_(enable), hardware_counters_(enable && hardware_counters) {
         if(!enable_) {
             return;
         }
@@ -174,8 +170,13 @@ public:
     BaseProfiler task_profiler_;
 private:
     bool enable_ {};
+    bool hardware_counters_ {};
 
     BaseProfiler profiler_;
+    i64 cpu_begin_{};
+    IOCounter io_begin_{};
+    HardwareCounter hardware_begin_{};
+    bool hardware_begin_valid_{};
     const PhysicalOperator *active_operator_ = nullptr;
 };
 
@@ -199,8 +200,17 @@ public:
 
     OptimizerProfiler &optimizer() { return optimizer_; }
 
+    // a knn scan looked up the results of a segment in the knn result cache
+    void RecordKnnCacheLookup(bool hit) {
+        ++knn_cache_lookups_;
+        knn_cache_hits_ += hit;
+    }
+
     [[nodiscard]] String ToString() const;
 
+    // The statistics of the flushed tasks by the node id of the operator
+    [[nodiscard]] HashMap<u64, OperatorStatistics> OperatorStatisticsByID() const;
+
     static String QueryPhaseToString(QueryPhase phase);
 
     static nlohmann::json Serialize(const QueryProfiler *profiler);
@@ -213,8 +223,90 @@ private:
     Vector<BaseProfiler> profilers_{static_cast<magic_enum::underlying_type_t<QueryPhase>>(QueryPhase::kInvalid)};
     OptimizerProfiler optimizer_;
     QueryPhase current_phase_{QueryPhase::kInvalid};
+    atomic_u64 knn_cache_lookups_{0};
+    atomic_u64 knn_cache_hits_{0};
 
     void ExecuteRender(std::stringstream &ss) const;
 };
 
+// Ticks of the time stamp counter, a read costs a few nanoseconds and builds no string. The ticks are converted to
+// nanoseconds with a rate calibrated against the steady clock at the first use.
+export class TscClock {
+public:
+    static u64 Now();
+
+    static u64 ToNanoSeconds(u64 ticks);
+};
+
+export constexpr SizeT QUERY_PHASE_COUNT = static_cast<SizeT>(QueryPhase::kInvalid);
+
+// Times the phases of every query with TscClock, whether the query is profiled or not, so that a slow query is known
+// with its phases after it ends.
+export class QueryPhaseTimer {
+public:
+    void Begin() {
+        begin_ticks_ = TscClock::Now();
+        phase_ticks_.fill(0);
+        current_phase_ = QueryPhase::kInvalid;
+        started_ = true;
+    }
+
+    void StartPhase(QueryPhase phase) {
+        current_phase_ = phase;
+        phase_begin_ticks_ = TscClock::Now();
+    }
+
+    void StopPhase() {
+        if (current_phase_ == QueryPhase::kInvalid) {
+            return;
+        }
+        phase_ticks_[static_cast<SizeT>(current_phase_)] += TscClock::Now() - phase_begin_ticks_;
+        current_phase_ = QueryPhase::kInvalid;
+    }
+
+    // Ends the query, returns its duration in nanoseconds.
+    u64 End() {
+        StopPhase();
+        started_ = false;
+        return TscClock::ToNanoSeconds(TscClock::Now() - begin_ticks_);
+    }
+
+    bool started() const { return started_; }
+
+    u64 PhaseNanoSeconds(QueryPhase phase) const { return TscClock::ToNanoSeconds(phase_ticks_[static_cast<SizeT>(phase)]); }
+
+private:
+    bool started_{false};
+    QueryPhase current_phase_{QueryPhase::kInvalid};
+    u64 begin_ticks_{};
+    u64 phase_begin_ticks_{};
+    Array<u64, QUERY_PHASE_COUNT> phase_ticks_{};
+};
+
+export struct SlowQueryRecord {
+    u64 session_id_{};
+    // over the slow query threshold, otherwise the query was sampled
+    bool slow_{};
+    String query_text_{};
+    u64 duration_ns_{};
+    Array<u64, QUERY_PHASE_COUNT> phase_ns_{};
+};
+
+// The latest slow and sampled queries, the oldest record is dropped when the log is full.
+export class SlowQueryLog {
+public:
+    explicit SlowQueryLog(SizeT capacity) : capacity_(capacity) {}
+
+    void Append(SlowQueryRecord record);
+
+    // From the oldest to the latest
+    Vector<SlowQueryRecord> GetRecords() const;
+
+private:
+    mutable std::mutex mutex_{};
+    SizeT capacity_{};
+    SizeT next_idx_{};
+    Vector<SlowQueryRecord> records_{};
+};
+
 } // namespace infinity
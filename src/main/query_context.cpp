@@ -39,9 +39,16 @@ import physical_planner;
 import fragment_builder;
 import fragment_task;
 import fragment_context;
+import plan_cache;
+import txn_manager;
+import knn_expr;
 import bind_context;
 import logical_node;
 import physical_operator;
+import physical_operator_type;
+import physical_explain;
+import explain_physical_plan;
+import explain_statement;
 import third_party;
 import logger;
 import query_result;
@@ -50,9 +57,45 @@ import session_manager;
 import base_statement;
 import parser_result;
 import parser_assert;
+import options;
+import defer_op;
+import create_statement;
+import extra_ddl_info;
+import engine_metrics;
+import copy_statement;
+import command_statement;
+import replica_manager;
 
 namespace infinity {
 
+namespace {
+
+// The statements a read replica refuses, its data only changes by the wal of the leader
+bool IsWriteStatement(const BaseStatement *statement) {
+    switch (statement->type_) {
+        case StatementType::kInsert:
+        case StatementType::kUpdate:
+        case StatementType::kDelete:
+        case StatementType::kCreate:
+        case StatementType::kDrop:
+        case StatementType::kAlter:
+        case StatementType::kOptimize: {
+            return true;
+        }
+        case StatementType::kCopy: {
+            return static_cast<const CopyStatement *>(statement)->copy_from_;
+        }
+        case StatementType::kCommand: {
+            return static_cast<const CommandStatement *>(statement)->command_info_->type() == CommandType::kCompactTable;
+        }
+        default: {
+            return false;
+        }
+    }
+}
+
+} // namespace
+
 QueryContext::QueryContext(BaseSession *session) : session_ptr_(session){};
 
 QueryContext::~QueryContext() { UnInit(); }
@@ -81,6 +124,8 @@ void QueryContext::Init(Config *global_config_ptr,
 
 QueryResult QueryContext::Query(const String &query) {
     CreateQueryProfiler();
+    phase_timer_.Begin();
+    query_text_ = &query;
 
     StartProfile(QueryPhase::kParser);
     UniquePtr<ParserResult> parsed_result = MakeUnique<ParserResult>();
@@ -104,59 +149,28 @@ QueryResult QueryContext::Query(const String &query) {
     return QueryResult::UnusedResult();
 }
 
+QueryResult QueryContext::QueryParsed(const BaseStatement *statement) {
+    CreateQueryProfiler();
+    return QueryStatement(statement);
+}
+
 QueryResult QueryContext::QueryStatement(const BaseStatement *statement) {
     QueryResult query_result;
+    if (!phase_timer_.started()) {
+        phase_timer_.Begin();
+    }
 //    ProfilerStart("Query");
 //    BaseProfiler profiler;
 //    profiler.Begin();
     try {
-        this->BeginTxn();
-//        LOG_INFO(fmt::format("created transaction, txn_id: {}, begin_ts: {}, statement: {}",
-//                        session_ptr_->GetTxn()->TxnID(),
-//                        session_ptr_->GetTxn()->BeginTS(),
-//                        statement->ToString()));
-        RecordQueryProfiler(statement->type_);
-
-        // Build unoptimized logical plan for each SQL statement.
-        StartProfile(QueryPhase::kLogicalPlan);
-        SharedPtr<BindContext> bind_context;
-        auto status = logical_planner_->Build(statement, bind_context);
-        // FIXME
-        if (!status.ok()) {
-            RecoverableError(status);
-        }
-
-        current_max_node_id_ = bind_context->GetNewLogicalNodeId();
-        SharedPtr<LogicalNode> logical_plan = logical_planner_->LogicalPlan();
-        StopProfile(QueryPhase::kLogicalPlan);
-//        LOG_WARN(fmt::format("Before optimizer cost: {}", profiler.ElapsedToString()));
-        // Apply optimized rule to the logical plan
-        StartProfile(QueryPhase::kOptimizer);
-        optimizer_->optimize(logical_plan, statement->type_);
-        StopProfile(QueryPhase::kOptimizer);
+        // A plan built by this txn can be cached if no write is committing before it begins. The version is read before the txn
+        // begins, so the snapshot of the txn is never older than it.
+        TxnManager *txn_mgr = storage_->txn_manager();
+        u64 write_version = txn_mgr->write_version();
+        bool plan_cacheable = !txn_mgr->HasCommittingWrite();
 
-        // Build physical plan
-        StartProfile(QueryPhase::kPhysicalPlan);
-        UniquePtr<PhysicalOperator> physical_plan = physical_planner_->BuildPhysicalOperator(logical_plan);
-        StopProfile(QueryPhase::kPhysicalPlan);
-//        LOG_WARN(fmt::format("Before pipeline cost: {}", profiler.ElapsedToString()));
-        StartProfile(QueryPhase::kPipelineBuild);
-        // Fragment Builder, only for test now.
-        // SharedPtr<PlanFragment> plan_fragment = fragment_builder.Build(physical_plan);
-        auto plan_fragment = fragment_builder_->BuildFragment(physical_plan.get());
-        StopProfile(QueryPhase::kPipelineBuild);
-
-        auto notifier = MakeUnique<Notifier>();
-
-        StartProfile(QueryPhase::kTaskBuild);
-        FragmentContext::BuildTask(this, nullptr, plan_fragment.get(), notifier.get());
-        StopProfile(QueryPhase::kTaskBuild);
-//        LOG_WARN(fmt::format("Before execution cost: {}", profiler.ElapsedToString()));
-        StartProfile(QueryPhase::kExecution);
-        scheduler_->Schedule(plan_fragment.get(), statement);
-        query_result.result_table_ = plan_fragment->GetResult();
-        query_result.root_operator_type_ = logical_plan->operator_type();
-        StopProfile(QueryPhase::kExecution);
+        this->BeginTxn();
+        ExecuteStatement(statement, write_version, plan_cacheable, query_result);
 //        LOG_WARN(fmt::format("Before commit cost: {}", profiler.ElapsedToString()));
         StartProfile(QueryPhase::kCommit);
         this->CommitTxn();
@@ -185,11 +199,233 @@ QueryResult QueryContext::QueryStatement(const BaseStatement *statement) {
 
 //    ProfilerStop();
     session_ptr_->IncreaseQueryCount();
+    u64 duration_ns = phase_timer_.End();
+    EngineMetrics::instance().ObserveQuery(statement->Type(), duration_ns / 1000);
+    RecordSlowQuery(statement, duration_ns);
 //    profiler.End();
 //    LOG_WARN(fmt::format("Query cost: {}", profiler.ElapsedToString()));
     return query_result;
 }
 
+void QueryContext::RecordSlowQuery(const BaseStatement *statement, u64 duration_ns) {
+    u64 slow_query_threshold_ms = global_config_->slow_query_threshold_ms();
+    bool slow = slow_query_threshold_ms != 0 && duration_ns >= slow_query_threshold_ms * 1'000'000;
+    u64 sample_interval = global_config_->query_sample_interval();
+    bool sampled = sample_interval != 0 && session_manager_->NextQuerySequence() % sample_interval == 0;
+    if (!slow && !sampled) {
+        return;
+    }
+
+    SlowQueryRecord record;
+    record.session_id_ = session_ptr_ != nullptr ? session_ptr_->session_id() : 0;
+    record.slow_ = slow;
+    record.query_text_ = query_text_ != nullptr ? *query_text_ : statement->ToString();
+    record.duration_ns_ = duration_ns;
+    for (SizeT phase_idx = 0; phase_idx < QUERY_PHASE_COUNT; ++phase_idx) {
+        record.phase_ns_[phase_idx] = phase_timer_.PhaseNanoSeconds(static_cast<QueryPhase>(phase_idx));
+    }
+    session_manager_->slow_query_log().Append(std::move(record));
+}
+
+Vector<QueryResult> QueryContext::QueryStatements(const Vector<const BaseStatement *> &statements) {
+    Vector<QueryResult> query_results(statements.size());
+    try {
+        TxnManager *txn_mgr = storage_->txn_manager();
+        u64 write_version = txn_mgr->write_version();
+        bool plan_cacheable = !txn_mgr->HasCommittingWrite();
+
+        this->BeginTxn();
+        for (SizeT i = 0; i < statements.size(); ++i) {
+            // The statements are reads, the failure of one leaves the txn usable by the next
+            try {
+                ExecuteStatement(statements[i], write_version, plan_cacheable, query_results[i]);
+            } catch (RecoverableException &e) {
+                StopProfile();
+                query_results[i].result_table_ = nullptr;
+                query_results[i].status_.Init(e.ErrorCode(), e.what());
+            } catch (ParserException &e) {
+                query_results[i].result_table_ = nullptr;
+                query_results[i].status_.Init(ErrorCode::kParserError, e.what());
+            }
+            session_ptr_->IncreaseQueryCount();
+        }
+        StartProfile(QueryPhase::kCommit);
+        this->CommitTxn();
+        StopProfile(QueryPhase::kCommit);
+
+    } catch (RecoverableException &e) {
+
+        StopProfile();
+        StartProfile(QueryPhase::kRollback);
+        this->RollbackTxn();
+        StopProfile(QueryPhase::kRollback);
+        for (auto &query_result : query_results) {
+            query_result.result_table_ = nullptr;
+            query_result.status_.Init(e.ErrorCode(), e.what());
+        }
+
+    } catch (UnrecoverableException &e) {
+
+        LOG_CRITICAL(e.what());
+        raise(SIGUSR1);
+    }
+    return query_results;
+}
+
+void QueryContext::ExecuteStatement(const BaseStatement *statement, u64 write_version, bool plan_cacheable, QueryResult &query_result) {
+    TxnManager *txn_mgr = storage_->txn_manager();
+    if (ReplicaManager *replica_mgr = storage_->replica_manager(); replica_mgr != nullptr) {
+        if (IsWriteStatement(statement)) {
+            RecoverableError(Status::ReadOnlyReplica(query_text_ != nullptr ? *query_text_ : statement->ToString()));
+        }
+        u64 max_staleness_ms = global_config_->replication_max_staleness_ms();
+        u64 staleness_ms = replica_mgr->StalenessMs();
+        if (max_staleness_ms > 0 && staleness_ms > max_staleness_ms) {
+            RecoverableError(Status::ReplicaTooStale(staleness_ms, max_staleness_ms));
+        }
+    }
+    running_statement_ = statement;
+    session_ptr_->ResetQueryCanceled();
+    u64 query_timeout_ms = session_ptr_->options()->query_timeout_ms_;
+    has_deadline_ = query_timeout_ms > 0;
+    if (has_deadline_) {
+        deadline_ = Clock::now() + MilliSeconds(query_timeout_ms);
+    }
+    memory_tracker_.SetLimit(global_config_->query_memory_limit());
+    query_pool_.Reset();
+    query_id_ = session_manager_->NextQueryID();
+    progress_.Begin(query_id_, session_ptr_->session_id(), query_text_ != nullptr ? *query_text_ : statement->ToString(), &memory_tracker_);
+    session_manager_->RegisterQuery(&progress_);
+    DeferFn unregister_query([&]() { session_manager_->UnregisterQuery(query_id_); });
+    query_priority_ = session_ptr_->options()->query_priority_;
+    if (statement->type_ == StatementType::kCreate &&
+        static_cast<const CreateStatement *>(statement)->create_info_->type_ == DDLType::kIndex) {
+        // Index building doesn't compete with the queries of the session.
+        query_priority_ = QueryPriority::kBackground;
+    }
+//        LOG_INFO(fmt::format("created transaction, txn_id: {}, begin_ts: {}, statement: {}",
+//                        session_ptr_->GetTxn()->TxnID(),
+//                        session_ptr_->GetTxn()->BeginTS(),
+//                        statement->ToString()));
+    RecordQueryProfiler(statement->type_);
+
+    // The selects of the same shape reuse the optimized plan, as long as nothing was written since it was built.
+    PlanCache *plan_cache = storage_->plan_cache();
+    String plan_key;
+    const KnnExpr *knn_expr = nullptr;
+    bool use_plan_cache = PlanCache::MakeKey(statement, schema_name(), plan_key, knn_expr);
+    SharedPtr<const CachedPlan> cached_plan;
+    if (use_plan_cache) {
+        cached_plan = plan_cache->Get(plan_key);
+        // the plan of another snapshot isn't used, even if it is the latest one
+        if (cached_plan.get() != nullptr && !cached_plan->UsableBy(write_version, txn_mgr->write_version())) {
+            cached_plan = nullptr;
+        }
+    }
+
+    SharedPtr<LogicalNode> logical_plan;
+    if (cached_plan.get() != nullptr) {
+        logical_plan = cached_plan->logical_plan_;
+        current_max_node_id_ = cached_plan->max_node_id_;
+        physical_planner_->set_knn_query(knn_expr);
+    } else {
+        physical_planner_->set_knn_query(nullptr);
+        // Build unoptimized logical plan for each SQL statement.
+        StartProfile(QueryPhase::kLogicalPlan);
+        SharedPtr<BindContext> bind_context;
+        auto status = logical_planner_->Build(statement, bind_context);
+        // FIXME
+        if (!status.ok()) {
+            RecoverableError(status);
+        }
+
+        current_max_node_id_ = bind_context->GetNewLogicalNodeId();
+        logical_plan = logical_planner_->LogicalPlan();
+        StopProfile(QueryPhase::kLogicalPlan);
+//        LOG_WARN(fmt::format("Before optimizer cost: {}", profiler.ElapsedToString()));
+        // Apply optimized rule to the logical plan
+        StartProfile(QueryPhase::kOptimizer);
+        optimizer_->optimize(logical_plan, statement->type_);
+        StopProfile(QueryPhase::kOptimizer);
+
+        if (use_plan_cache && plan_cacheable) {
+            auto new_plan = MakeShared<CachedPlan>();
+            new_plan->logical_plan_ = logical_plan;
+            new_plan->max_node_id_ = current_max_node_id_;
+            new_plan->write_version_ = write_version;
+            plan_cache->Put(plan_key, std::move(new_plan));
+        }
+    }
+
+    // Build physical plan
+    StartProfile(QueryPhase::kPhysicalPlan);
+    UniquePtr<PhysicalOperator> physical_plan = physical_planner_->BuildPhysicalOperator(logical_plan);
+    StopProfile(QueryPhase::kPhysicalPlan);
+
+    if (physical_plan->operator_type() == PhysicalOperatorType::kExplain) {
+        auto *explain_op = static_cast<PhysicalExplain *>(physical_plan.get());
+        if (explain_op->explain_type() == ExplainType::kAnalyze) {
+            // The plan under the explain runs to the end first, its result is dropped and the explain outputs the plan with
+            // the statistics the tasks flushed.
+            analyze_profiler_ = MakeShared<QueryProfiler>(true);
+            DeferFn reset_analyze([&]() { analyze_profiler_.reset(); });
+            ExecutePhysicalPlan(explain_op->left(), statement);
+
+            SharedPtr<Vector<SharedPtr<String>>> texts_ptr = MakeShared<Vector<SharedPtr<String>>>();
+            ExplainPhysicalPlan::Explain(explain_op->left(), analyze_profiler_->OperatorStatisticsByID(), texts_ptr);
+            explain_op->SetExplainText(texts_ptr);
+        }
+    }
+
+    query_result.result_table_ = ExecutePhysicalPlan(physical_plan.get(), statement);
+    query_result.root_operator_type_ = logical_plan->operator_type();
+}
+
+SharedPtr<DataTable> QueryContext::ExecutePhysicalPlan(PhysicalOperator *physical_plan, const BaseStatement *statement) {
+//        LOG_WARN(fmt::format("Before pipeline cost: {}", profiler.ElapsedToString()));
+    StartProfile(QueryPhase::kPipelineBuild);
+    // Fragment Builder, only for test now.
+    // SharedPtr<PlanFragment> plan_fragment = fragment_builder.Build(physical_plan);
+    auto plan_fragment = fragment_builder_->BuildFragment(physical_plan);
+    StopProfile(QueryPhase::kPipelineBuild);
+
+    auto notifier = MakeUnique<Notifier>();
+
+    StartProfile(QueryPhase::kTaskBuild);
+    FragmentContext::BuildTask(this, nullptr, plan_fragment.get(), notifier.get());
+    StopProfile(QueryPhase::kTaskBuild);
+//        LOG_WARN(fmt::format("Before execution cost: {}", profiler.ElapsedToString()));
+    StartProfile(QueryPhase::kExecution);
+    SharedPtr<DataTable> result_table;
+    {
+        // Queries beyond the concurrency limit wait here instead of oversubscribing the workers. An inline plan doesn't
+        // take a worker, so it isn't counted.
+        bool admitted = !TaskScheduler::RunInline(plan_fragment.get()) && scheduler_->AdmitQuery(statement, query_priority_);
+        DeferFn release_query([&]() {
+            if (admitted) {
+                scheduler_->ReleaseQuery();
+            }
+        });
+        scheduler_->Schedule(plan_fragment.get(), statement);
+        result_table = plan_fragment->GetResult();
+    }
+    StopProfile(QueryPhase::kExecution);
+    return result_table;
+}
+
+bool QueryContext::IsCanceled() const {
+    if (session_ptr_->query_canceled()) {
+        return true;
+    }
+    return has_deadline_ && Clock::now() >= deadline_;
+}
+
+void QueryContext::CheckCanceled() const {
+    if (IsCanceled()) {
+        RecoverableError(Status::QueryCancelled(running_statement_ == nullptr ? String() : running_statement_->ToString()));
+    }
+}
+
 void QueryContext::BeginTxn() {
     if (session_ptr_->GetTxn() == nullptr) {
         Txn* new_txn = storage_->txn_manager()->BeginTxn();
@@ -29,6 +29,11 @@ import optimizer;
 import status;
 import query_result;
 import base_statement;
+import options;
+import query_memory_tracker;
+import query_progress;
+import memory_pool;
+import default_values;
 
 export module query_context;
 
@@ -38,6 +43,7 @@ class LogicalPlanner;
 class PhysicalPlanner;
 class FragmentBuilder;
 class TaskScheduler;
+class PhysicalOperator;
 
 export class QueryContext {
 
@@ -65,6 +71,12 @@ public:
 
     QueryResult QueryStatement(const BaseStatement *statement);
 
+    // A statement parsed beforehand, as a prepared statement of the PG extended query protocol
+    QueryResult QueryParsed(const BaseStatement *statement);
+
+    // Reads run in one txn, one result per statement in their order.
+    Vector<QueryResult> QueryStatements(const Vector<const BaseStatement *> &statements);
+
     inline void set_current_schema(const String &current_schema) { session_ptr_->set_current_schema(current_schema); }
 
     [[nodiscard]] inline const String &schema_name() const { return session_ptr_->current_database(); }
@@ -75,8 +87,29 @@ public:
 
     [[nodiscard]] inline u64 memory_size_limit() const { return memory_size_limit_; }
 
+    // Memory held by the operators of the query, bounded by the query_memory_limit config.
+    [[nodiscard]] inline QueryMemoryTracker *memory_tracker() { return &memory_tracker_; }
+
+    // Scratch memory of the operators, which is not freed one by one but reset in bulk when the next statement begins and released
+    // with the query context. Nothing allocated from it may outlive the statement, so the output data blocks don't use it.
+    [[nodiscard]] inline MemoryPool *query_pool() { return &query_pool_; }
+
+    // The scheduler lane of the current query, it starts from the session option and can be changed before the query is scheduled.
+    [[nodiscard]] inline QueryPriority query_priority() const { return query_priority_; }
+
+    inline void set_query_priority(QueryPriority query_priority) { query_priority_ = query_priority; }
+
     [[nodiscard]] inline u64 query_id() const { return query_id_; }
 
+    // Read by SHOW QUERIES while the statement runs
+    [[nodiscard]] inline QueryProgress *progress() { return &progress_; }
+
+    // True once the session cancelled the query or the query passed its deadline. Long running operators call
+    // CheckCanceled() between blocks, which throws kQueryCancelled.
+    [[nodiscard]] bool IsCanceled() const;
+
+    void CheckCanceled() const;
+
     [[nodiscard]] inline u64 max_node_id() const { return current_max_node_id_; }
 
     inline void set_max_node_id(u64 node_id) { current_max_node_id_ = node_id; }
@@ -111,13 +144,32 @@ public:
 
     [[nodiscard]] BaseSession* current_session() const { return session_ptr_; }
 
+    // True while EXPLAIN ANALYZE runs its plan, the tasks profile their operators even if the session doesn't.
+    [[nodiscard]] inline bool is_analyzing() const { return analyze_profiler_.get() != nullptr; }
+
     void FlushProfiler(TaskProfiler &&profiler) {
+        if (analyze_profiler_) {
+            analyze_profiler_->Flush(TaskProfiler(profiler));
+        }
         if(query_profiler_) {
             query_profiler_->Flush(std::move(profiler));
         }
     }
 
+    void RecordKnnCacheLookup(bool hit) {
+        if(query_profiler_) {
+            query_profiler_->RecordKnnCacheLookup(hit);
+        }
+    }
+
 private:
+    // Plans and runs the statement in the current txn, the txn is left open. write_version and plan_cacheable are those of
+    // the TxnManager before the txn began.
+    void ExecuteStatement(const BaseStatement *statement, u64 write_version, bool plan_cacheable, QueryResult &query_result);
+
+    // Builds the fragments of the plan, schedules the tasks and waits for the result.
+    SharedPtr<DataTable> ExecutePhysicalPlan(PhysicalOperator *physical_plan, const BaseStatement *statement);
+
     inline void CreateQueryProfiler() {
         if (is_enable_profiling()) {
             query_profiler_ = MakeShared<QueryProfiler>(true);
@@ -131,22 +183,28 @@ private:
     }
 
     inline void StartProfile(QueryPhase phase) {
+        phase_timer_.StartPhase(phase);
         if(query_profiler_) {
             query_profiler_->StartPhase(phase);
         }
     }
     inline void StopProfile(QueryPhase phase) {
+        phase_timer_.StopPhase();
         if(query_profiler_) {
             query_profiler_->StopPhase(phase);
         }
     }
 
     inline void StopProfile() {
+        phase_timer_.StopPhase();
         if(query_profiler_) {
             query_profiler_->Stop();
         }
     }
 
+    // Appends the query to the slow query log of the session manager if it is over the slow query threshold or sampled.
+    void RecordSlowQuery(const BaseStatement *statement, u64 duration_ns);
+
 private:
     // Parser
     UniquePtr<SQLParser> parser_{};
@@ -156,6 +214,10 @@ private:
     UniquePtr<FragmentBuilder> fragment_builder_{};
 
     SharedPtr<QueryProfiler> query_profiler_{};
+    SharedPtr<QueryProfiler> analyze_profiler_{};
+    // Always on, unlike the query profiler of the session
+    QueryPhaseTimer phase_timer_{};
+    const String *query_text_{};
 
     Config *global_config_{};
     TaskScheduler *scheduler_{};
@@ -177,6 +239,13 @@ private:
 
     u64 cpu_number_limit_{};
     u64 memory_size_limit_{};
+    QueryMemoryTracker memory_tracker_{};
+    MemoryPool query_pool_{DEFAULT_QUERY_POOL_CHUNK_SIZE};
+    QueryProgress progress_{};
+    QueryPriority query_priority_{QueryPriority::kInteractive};
+    const BaseStatement *running_statement_{};
+    bool has_deadline_{false};
+    TimePoint<Clock> deadline_{};
 
     bool initialized_{false};
 
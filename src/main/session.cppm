@@ -50,6 +50,14 @@ public:
 
     [[nodiscard]] u64 query_count() const { return query_count_; }
 
+    // Ask the running query of the session to stop. It can be called from any thread, the tasks of the query notice it
+    // between blocks and the query fails with kQueryCancelled.
+    inline void CancelQuery() { query_canceled_ = true; }
+
+    inline void ResetQueryCanceled() { query_canceled_ = false; }
+
+    [[nodiscard]] inline bool query_canceled() const { return query_canceled_; }
+
 protected:
     // Current schema
     String current_database_{};
@@ -64,6 +72,8 @@ protected:
     u64 session_id_{0};
 
     u64 query_count_{0};
+
+    atomic_bool query_canceled_{false};
 };
 
 export class LocalSession : public BaseSession {
@@ -17,13 +17,15 @@ export module session_manager;
 
 import stl;
 import session;
+import profiler;
+import query_progress;
 
 namespace infinity {
 
 export class SessionManager {
 
 public:
-    SessionManager() = default;
+    explicit SessionManager(SizeT slow_query_log_capacity = 100) : slow_query_log_(slow_query_log_capacity) {}
 
     SharedPtr<RemoteSession> CreateRemoteSession() {
         u64 session_id = ++ session_id_generator_;
@@ -55,6 +57,17 @@ public:
         }
     }
 
+    // Cancel the running query of the session, return false if there is no such session.
+    bool CancelQueryBySessionID(u64 session_id) {
+        std::shared_lock<std::shared_mutex> r_locker(rw_locker_);
+        auto iter = sessions_.find(session_id);
+        if (iter == sessions_.end()) {
+            return false;
+        }
+        iter->second->CancelQuery();
+        return true;
+    }
+
     void RemoveSessionByID(u64 session_id) {
         std::unique_lock<std::shared_mutex> w_locker(rw_locker_);
         sessions_.erase(session_id);
@@ -65,12 +78,61 @@ public:
         return sessions_.size();
     }
 
+    SlowQueryLog &slow_query_log() { return slow_query_log_; }
+
+    u64 NextQueryID() { return ++query_id_generator_; }
+
+    // A query is listed by SHOW QUERIES while it is registered, the progress must outlive its registration.
+    void RegisterQuery(const QueryProgress *query_progress) {
+        std::unique_lock<std::mutex> lock(running_queries_mutex_);
+        running_queries_.emplace(query_progress->query_id(), query_progress);
+    }
+
+    void UnregisterQuery(u64 query_id) {
+        std::unique_lock<std::mutex> lock(running_queries_mutex_);
+        running_queries_.erase(query_id);
+    }
+
+    Vector<QueryProgressInfo> RunningQueries() {
+        Vector<QueryProgressInfo> queries;
+        {
+            std::unique_lock<std::mutex> lock(running_queries_mutex_);
+            queries.reserve(running_queries_.size());
+            for (const auto &[query_id, query_progress] : running_queries_) {
+                queries.emplace_back(query_progress->Snapshot());
+            }
+        }
+        std::sort(queries.begin(), queries.end(), [](const auto &lhs, const auto &rhs) { return lhs.query_id_ < rhs.query_id_; });
+        return queries;
+    }
+
+    // Cancel a running query by the id of SHOW QUERIES, return false if it is not running.
+    bool CancelQuery(u64 query_id) {
+        std::unique_lock<std::mutex> lock(running_queries_mutex_);
+        auto iter = running_queries_.find(query_id);
+        if (iter == running_queries_.end()) {
+            return false;
+        }
+        return CancelQueryBySessionID(iter->second->session_id());
+    }
+
+    // Sequence number of the finished queries of all sessions, used to sample every Nth query.
+    u64 NextQuerySequence() { return query_sequence_.fetch_add(1, std::memory_order_relaxed) + 1; }
+
 private:
     std::shared_mutex rw_locker_{};
     HashMap<u64, BaseSession*> sessions_;
 
     // First session is ONE;
     atomic_u64 session_id_generator_{};
+
+    atomic_u64 query_sequence_{};
+    atomic_u64 query_id_generator_{};
+
+    // The running_queries_mutex_ is taken before the rw_locker_
+    std::mutex running_queries_mutex_{};
+    HashMap<u64, const QueryProgress *> running_queries_{};
+    SlowQueryLog slow_query_log_;
 };
 
 }
\ No newline at end of file
@@ -0,0 +1,188 @@
+// Copyright(C) 2024 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+module engine_metrics;
+
+import stl;
+import base_statement;
+import third_party;
+import infinity_exception;
+
+namespace infinity {
+
+namespace {
+
+// 100us to 10s
+const Vector<u64> LATENCY_BOUNDS_US = {100, 250, 500, 1'000, 2'500, 5'000, 10'000, 25'000, 50'000, 100'000, 250'000, 500'000,
+                                       1'000'000, 2'500'000, 5'000'000, 10'000'000};
+
+// 10ms to 30min, for the background tasks
+const Vector<u64> TASK_DURATION_BOUNDS_US = {10'000, 50'000, 100'000, 500'000, 1'000'000, 5'000'000, 10'000'000, 30'000'000, 60'000'000,
+                                             300'000'000, 1'800'000'000};
+
+const Vector<u64> BATCH_SIZE_BOUNDS = {1, 2, 4, 8, 16, 32, 64, 128, 256, 512, 1024, 2048, 4096, 8192};
+
+constexpr f64 MICROSECONDS_TO_SECONDS = 1e-6;
+
+const char *StatementTypeName(StatementType statement_type) {
+    switch (statement_type) {
+        case StatementType::kInvalidStmt:
+            return "invalid";
+        case StatementType::kSelect:
+            return "select";
+        case StatementType::kCopy:
+            return "copy";
+        case StatementType::kInsert:
+            return "insert";
+        case StatementType::kUpdate:
+            return "update";
+        case StatementType::kDelete:
+            return "delete";
+        case StatementType::kCreate:
+            return "create";
+        case StatementType::kDrop:
+            return "drop";
+        case StatementType::kPrepare:
+            return "prepare";
+        case StatementType::kExecute:
+            return "execute";
+        case StatementType::kAlter:
+            return "alter";
+        case StatementType::kShow:
+            return "show";
+        case StatementType::kExplain:
+            return "explain";
+        case StatementType::kFlush:
+            return "flush";
+        case StatementType::kOptimize:
+            return "optimize";
+        case StatementType::kCommand:
+            return "command";
+    }
+    return "invalid";
+}
+
+} // namespace
+
+SizeT MetricShardIndex() {
+    static Atomic<SizeT> next_shard_index{0};
+    thread_local SizeT shard_index = next_shard_index.fetch_add(1, std::memory_order_relaxed) % METRIC_SHARD_COUNT;
+    return shard_index;
+}
+
+u64 MetricCounter::Value() const {
+    u64 value = 0;
+    for (const Shard &shard : shards_) {
+        value += shard.value_.load(std::memory_order_relaxed);
+    }
+    return value;
+}
+
+MetricHistogram::MetricHistogram(Vector<u64> bounds) : bounds_(std::move(bounds)) {
+    if (bounds_.size() > MAX_BOUND_COUNT) {
+        UnrecoverableError(fmt::format("A histogram has at most {} bounds", MAX_BOUND_COUNT));
+    }
+}
+
+void MetricHistogram::Observe(u64 value) {
+    SizeT bucket_idx = std::lower_bound(bounds_.begin(), bounds_.end(), value) - bounds_.begin();
+    Shard &shard = shards_[MetricShardIndex()];
+    shard.buckets_[bucket_idx].fetch_add(1, std::memory_order_relaxed);
+    shard.sum_.fetch_add(value, std::memory_order_relaxed);
+}
+
+void MetricHistogram::Collect(Vector<u64> &bucket_counts, u64 &sum) const {
+    bucket_counts.assign(bounds_.size() + 1, 0);
+    sum = 0;
+    for (const Shard &shard : shards_) {
+        for (SizeT bucket_idx = 0; bucket_idx < bucket_counts.size(); ++bucket_idx) {
+            bucket_counts[bucket_idx] += shard.buckets_[bucket_idx].load(std::memory_order_relaxed);
+        }
+        sum += shard.sum_.load(std::memory_order_relaxed);
+    }
+    for (SizeT bucket_idx = 1; bucket_idx < bucket_counts.size(); ++bucket_idx) {
+        bucket_counts[bucket_idx] += bucket_counts[bucket_idx - 1];
+    }
+}
+
+void MetricsWriter::WriteHeader(const String &name, const String &type, const String &help) {
+    text_ += fmt::format("# HELP {} {}\n# TYPE {} {}\n", name, help, name, type);
+}
+
+void MetricsWriter::WriteSample(const String &name, const String &labels, f64 value) {
+    if (labels.empty()) {
+        text_ += fmt::format("{} {}\n", name, value);
+    } else {
+        text_ += fmt::format("{}{{{}}} {}\n", name, labels, value);
+    }
+}
+
+void MetricsWriter::WriteHistogram(const String &name, const String &labels, const MetricHistogram &histogram, f64 scale) {
+    Vector<u64> bucket_counts;
+    u64 sum = 0;
+    histogram.Collect(bucket_counts, sum);
+    const String label_prefix = labels.empty() ? String() : labels + ",";
+    const Vector<u64> &bounds = histogram.bounds();
+    for (SizeT bucket_idx = 0; bucket_idx < bucket_counts.size(); ++bucket_idx) {
+        String bound = bucket_idx < bounds.size() ? fmt::format("{}", bounds[bucket_idx] * scale) : String("+Inf");
+        WriteSample(name + "_bucket", fmt::format("{}le=\"{}\"", label_prefix, bound), bucket_counts[bucket_idx]);
+    }
+    WriteSample(name + "_sum", labels, sum * scale);
+    WriteSample(name + "_count", labels, bucket_counts.back());
+}
+
+EngineMetrics &EngineMetrics::instance() {
+    static EngineMetrics instance;
+    return instance;
+}
+
+EngineMetrics::EngineMetrics()
+    : wal_flush_duration_us_(LATENCY_BOUNDS_US), wal_batch_size_(BATCH_SIZE_BOUNDS), checkpoint_duration_us_(TASK_DURATION_BOUNDS_US),
+      compaction_duration_us_(TASK_DURATION_BOUNDS_US) {
+    query_duration_us_.reserve(STATEMENT_TYPE_COUNT);
+    for (SizeT type_idx = 0; type_idx < STATEMENT_TYPE_COUNT; ++type_idx) {
+        query_duration_us_.emplace_back(MakeUnique<MetricHistogram>(LATENCY_BOUNDS_US));
+    }
+}
+
+void EngineMetrics::Write(MetricsWriter &writer) const {
+    writer.WriteHeader("infinity_buffer_hits_total", "counter", "Loads of buffers which were in memory.");
+    writer.WriteSample("infinity_buffer_hits_total", "", buffer_hits_.Value());
+    writer.WriteHeader("infinity_buffer_misses_total", "counter", "Loads of buffers which were read from disk.");
+    writer.WriteSample("infinity_buffer_misses_total", "", buffer_misses_.Value());
+    writer.WriteHeader("infinity_buffer_evictions_total", "counter", "Buffers freed to make room for other buffers.");
+    writer.WriteSample("infinity_buffer_evictions_total", "", buffer_evictions_.Value());
+    writer.WriteHeader("infinity_index_build_rows_total", "counter", "Rows built into the indexes by CREATE INDEX and OPTIMIZE.");
+    writer.WriteSample("infinity_index_build_rows_total", "", index_build_rows_.Value());
+
+    writer.WriteHeader("infinity_wal_flush_duration_seconds", "histogram", "Time to write and sync a batch of wal entries.");
+    writer.WriteHistogram("infinity_wal_flush_duration_seconds", "", wal_flush_duration_us_, MICROSECONDS_TO_SECONDS);
+    writer.WriteHeader("infinity_wal_batch_size", "histogram", "Wal entries written and synced together.");
+    writer.WriteHistogram("infinity_wal_batch_size", "", wal_batch_size_, 1);
+
+    writer.WriteHeader("infinity_checkpoint_duration_seconds", "histogram", "Time of the checkpoints.");
+    writer.WriteHistogram("infinity_checkpoint_duration_seconds", "", checkpoint_duration_us_, MICROSECONDS_TO_SECONDS);
+    writer.WriteHeader("infinity_compaction_duration_seconds", "histogram", "Time of the segment compactions.");
+    writer.WriteHistogram("infinity_compaction_duration_seconds", "", compaction_duration_us_, MICROSECONDS_TO_SECONDS);
+
+    writer.WriteHeader("infinity_query_duration_seconds", "histogram", "Time of the statements by statement type.");
+    for (SizeT type_idx = 1; type_idx < STATEMENT_TYPE_COUNT; ++type_idx) {
+        String labels = fmt::format("statement=\"{}\"", StatementTypeName(static_cast<StatementType>(type_idx)));
+        writer.WriteHistogram("infinity_query_duration_seconds", labels, *query_duration_us_[type_idx], MICROSECONDS_TO_SECONDS);
+    }
+}
+
+} // namespace infinity
@@ -0,0 +1,120 @@
+// Copyright(C) 2024 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module engine_metrics;
+
+import stl;
+import base_statement;
+
+namespace infinity {
+
+// The counters and histograms are updated on hot paths without a lock: each thread adds to its own shard on its own cache
+// line, and a scrape sums the shards.
+export constexpr SizeT METRIC_SHARD_COUNT = 64;
+
+// The shard of the calling thread, the threads are assigned to the shards in turn.
+export SizeT MetricShardIndex();
+
+export class MetricCounter {
+public:
+    void Add(u64 value = 1) { shards_[MetricShardIndex()].value_.fetch_add(value, std::memory_order_relaxed); }
+
+    u64 Value() const;
+
+private:
+    struct alignas(64) Shard {
+        Atomic<u64> value_{0};
+    };
+
+    Array<Shard, METRIC_SHARD_COUNT> shards_{};
+};
+
+// A value is counted in the bucket of the first bound not less than it, a value above the last bound in the +Inf bucket.
+export class MetricHistogram {
+public:
+    static constexpr SizeT MAX_BOUND_COUNT = 23;
+
+    explicit MetricHistogram(Vector<u64> bounds);
+
+    void Observe(u64 value);
+
+    // Sums the shards. The bucket counts are cumulative as in the Prometheus text format, the last one is the +Inf bucket.
+    void Collect(Vector<u64> &bucket_counts, u64 &sum) const;
+
+    const Vector<u64> &bounds() const { return bounds_; }
+
+private:
+    struct alignas(64) Shard {
+        Array<Atomic<u64>, MAX_BOUND_COUNT + 1> buckets_{};
+        Atomic<u64> sum_{0};
+    };
+
+    Vector<u64> bounds_{};
+    Array<Shard, METRIC_SHARD_COUNT> shards_{};
+};
+
+// Writes the series in the Prometheus text exposition format.
+export class MetricsWriter {
+public:
+    void WriteHeader(const String &name, const String &type, const String &help);
+
+    // labels is the list inside the braces, e.g. worker="0", empty for none
+    void WriteSample(const String &name, const String &labels, f64 value);
+
+    // The values and the bounds are multiplied by scale, e.g. to write the microseconds as seconds.
+    void WriteHistogram(const String &name, const String &labels, const MetricHistogram &histogram, f64 scale);
+
+    const String &text() const { return text_; }
+
+private:
+    String text_{};
+};
+
+export constexpr SizeT STATEMENT_TYPE_COUNT = static_cast<SizeT>(StatementType::kCommand) + 1;
+
+// The metrics pushed by the engine. The gauges, e.g. the queue depth of the workers and the buffer memory, are read from
+// their owners at a scrape.
+export class EngineMetrics {
+public:
+    static EngineMetrics &instance();
+
+    void ObserveQuery(StatementType statement_type, u64 duration_us) {
+        query_duration_us_[static_cast<SizeT>(statement_type)]->Observe(duration_us);
+    }
+
+    void Write(MetricsWriter &writer) const;
+
+    MetricCounter buffer_hits_{};
+    MetricCounter buffer_misses_{};
+    MetricCounter buffer_evictions_{};
+
+    // rows built into the indexes by CREATE INDEX and OPTIMIZE
+    MetricCounter index_build_rows_{};
+
+    MetricHistogram wal_flush_duration_us_;
+    // wal entries, i.e. transactions, written and synced together
+    MetricHistogram wal_batch_size_;
+
+    MetricHistogram checkpoint_duration_us_;
+    MetricHistogram compaction_duration_us_;
+
+private:
+    EngineMetrics();
+
+    Vector<UniquePtr<MetricHistogram>> query_duration_us_{};
+};
+
+} // namespace infinity
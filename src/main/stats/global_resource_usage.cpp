@@ -31,4 +31,10 @@ std::mutex GlobalResourceUsage::object_mutex_{};
 
 std::mutex GlobalResourceUsage::raw_memory_mutex_{};
 
+Atomic<i64> GlobalResourceUsage::query_memory_usage_{0};
+Atomic<i64> GlobalResourceUsage::query_memory_peak_{0};
+
+std::mutex GlobalResourceUsage::numa_node_mutex_{};
+HashMap<i64, i64> GlobalResourceUsage::numa_node_busy_time_map_;
+
 } // namespace infinity
@@ -83,6 +83,34 @@ public:
         return raw_memory_map_[key];
     }
 
+    // Busy time of the workers of a NUMA node in nanoseconds, recorded by the scheduler in NUMA aware mode.
+    static void AddNumaNodeBusyTime(i64 numa_node, i64 busy_ns) {
+        std::unique_lock<std::mutex> unique_locker(numa_node_mutex_);
+        numa_node_busy_time_map_[numa_node] += busy_ns;
+    }
+
+    static i64 GetNumaNodeBusyTime(i64 numa_node) {
+        std::unique_lock<std::mutex> unique_locker(numa_node_mutex_);
+        return numa_node_busy_time_map_[numa_node];
+    }
+
+    static HashMap<i64, i64> GetNumaNodeBusyTimes() {
+        std::unique_lock<std::mutex> unique_locker(numa_node_mutex_);
+        return numa_node_busy_time_map_;
+    }
+
+    // Bytes charged to the memory trackers of all running queries, and the highest value seen.
+    static void AddQueryMemory(i64 bytes) {
+        i64 usage = query_memory_usage_.fetch_add(bytes) + bytes;
+        i64 peak = query_memory_peak_.load();
+        while (usage > peak && !query_memory_peak_.compare_exchange_weak(peak, usage)) {
+        }
+    }
+
+    static i64 GetQueryMemoryUsage() { return query_memory_usage_.load(); }
+
+    static i64 GetQueryMemoryPeak() { return query_memory_peak_.load(); }
+
 private:
     static atomic_bool initialized_;
 
@@ -93,6 +121,12 @@ private:
     static std::mutex raw_memory_mutex_;
     static i64 raw_memory_count_;
     static HashMap<String, i64> raw_memory_map_;
+
+    static Atomic<i64> query_memory_usage_;
+    static Atomic<i64> query_memory_peak_;
+
+    static std::mutex numa_node_mutex_;
+    static HashMap<i64, i64> numa_node_busy_time_map_;
 };
 
 } // namespace infinity
@@ -0,0 +1,108 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <algorithm>
+#include <tuple>
+
+module index_build_progress;
+
+import stl;
+import engine_metrics;
+
+namespace infinity {
+
+String IndexBuildPhaseToString(IndexBuildPhase phase) {
+    switch (phase) {
+        case IndexBuildPhase::kCreate:
+            return "create";
+        case IndexBuildPhase::kOptimize:
+            return "optimize";
+    }
+    return "invalid";
+}
+
+void IndexBuildProgress::AddRowsDone(u64 row_count) {
+    rows_done_.fetch_add(row_count, std::memory_order_relaxed);
+    EngineMetrics::instance().index_build_rows_.Add(row_count);
+}
+
+IndexBuildProgressInfo IndexBuildProgress::Snapshot() const {
+    IndexBuildProgressInfo info;
+    info.db_name_ = db_name_;
+    info.table_name_ = table_name_;
+    info.index_name_ = index_name_;
+    info.phase_ = phase_;
+    info.rows_done_ = rows_done_.load(std::memory_order_relaxed);
+    info.rows_total_ = rows_total_.load(std::memory_order_relaxed);
+    info.segments_done_ = segments_done_.load(std::memory_order_relaxed);
+    info.segments_total_ = segments_total_.load(std::memory_order_relaxed);
+    info.current_segment_ = current_segment_.load(std::memory_order_relaxed);
+    info.elapsed_ns_ = ElapsedFromStart(Clock::now(), begin_time_).count();
+    if (info.rows_done_ > 0 && info.elapsed_ns_ > 0) {
+        info.rows_per_second_ = info.rows_done_ * 1e9 / info.elapsed_ns_;
+        u64 rows_left = info.rows_total_ > info.rows_done_ ? info.rows_total_ - info.rows_done_ : 0;
+        info.eta_ns_ = static_cast<i64>(rows_left * 1e9 / info.rows_per_second_);
+    }
+    return info;
+}
+
+IndexBuildRegistry &IndexBuildRegistry::instance() {
+    static IndexBuildRegistry registry;
+    return registry;
+}
+
+SharedPtr<IndexBuildProgress> IndexBuildRegistry::Begin(String db_name, String table_name, String index_name, IndexBuildPhase phase) {
+    auto progress = MakeShared<IndexBuildProgress>(std::move(db_name), std::move(table_name), std::move(index_name), phase);
+    std::unique_lock<std::mutex> lock(mutex_);
+    builds_.push_back(progress);
+    return progress;
+}
+
+void IndexBuildRegistry::End(const IndexBuildProgress *progress) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    auto iter = std::find_if(builds_.begin(), builds_.end(), [&](const auto &build) { return build.get() == progress; });
+    if (iter != builds_.end()) {
+        builds_.erase(iter);
+    }
+}
+
+Vector<IndexBuildProgressInfo> IndexBuildRegistry::Builds() const {
+    Vector<IndexBuildProgressInfo> builds;
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        builds.reserve(builds_.size());
+        for (const auto &build : builds_) {
+            builds.push_back(build->Snapshot());
+        }
+    }
+    std::sort(builds.begin(), builds.end(), [](const auto &lhs, const auto &rhs) {
+        return std::tie(lhs.db_name_, lhs.table_name_, lhs.index_name_) < std::tie(rhs.db_name_, rhs.table_name_, rhs.index_name_);
+    });
+    return builds;
+}
+
+Vector<IndexBuildProgressInfo> IndexBuildRegistry::Builds(const String &db_name, const String &table_name, const String &index_name) const {
+    Vector<IndexBuildProgressInfo> builds;
+    std::unique_lock<std::mutex> lock(mutex_);
+    for (const auto &build : builds_) {
+        if (build->db_name() == db_name && build->table_name() == table_name && build->index_name() == index_name) {
+            builds.push_back(build->Snapshot());
+        }
+    }
+    return builds;
+}
+
+} // namespace infinity
@@ -0,0 +1,109 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module index_build_progress;
+
+import stl;
+
+namespace infinity {
+
+export enum class IndexBuildPhase {
+    kCreate,
+    kOptimize,
+};
+
+export String IndexBuildPhaseToString(IndexBuildPhase phase);
+
+// One index build in progress, as shown by SHOW INDEX and the metrics
+export struct IndexBuildProgressInfo {
+    String db_name_{};
+    String table_name_{};
+    String index_name_{};
+    IndexBuildPhase phase_{IndexBuildPhase::kCreate};
+    u64 rows_done_{0};
+    u64 rows_total_{0};
+    u64 segments_done_{0};
+    u64 segments_total_{0};
+    // the segment a task of the build worked on last, -1 before the first one
+    i64 current_segment_{-1};
+    u64 elapsed_ns_{0};
+    f64 rows_per_second_{0};
+    // -1 before any row is done
+    i64 eta_ns_{-1};
+};
+
+// The counters of a CREATE INDEX or an OPTIMIZE. The segments are added before they are built, so the totals are known
+// early and the ETA is the remaining rows at the rate so far. The build tasks update the counters, SHOW INDEX of other
+// sessions reads them while the build is registered in the IndexBuildRegistry.
+export class IndexBuildProgress {
+public:
+    IndexBuildProgress(String db_name, String table_name, String index_name, IndexBuildPhase phase)
+        : db_name_(std::move(db_name)), table_name_(std::move(table_name)), index_name_(std::move(index_name)), phase_(phase),
+          begin_time_(Clock::now()) {}
+
+    inline void AddSegment(u64 row_count) {
+        segments_total_.fetch_add(1, std::memory_order_relaxed);
+        rows_total_.fetch_add(row_count, std::memory_order_relaxed);
+    }
+
+    inline void BeginSegment(u32 segment_id) { current_segment_.store(segment_id, std::memory_order_relaxed); }
+
+    void AddRowsDone(u64 row_count);
+
+    inline void FinishSegment() { segments_done_.fetch_add(1, std::memory_order_relaxed); }
+
+    [[nodiscard]] inline const String &db_name() const { return db_name_; }
+
+    [[nodiscard]] inline const String &table_name() const { return table_name_; }
+
+    [[nodiscard]] inline const String &index_name() const { return index_name_; }
+
+    [[nodiscard]] IndexBuildProgressInfo Snapshot() const;
+
+private:
+    const String db_name_;
+    const String table_name_;
+    const String index_name_;
+    const IndexBuildPhase phase_;
+    const TimePoint<Clock> begin_time_;
+
+    atomic_u64 rows_done_{0};
+    atomic_u64 rows_total_{0};
+    atomic_u64 segments_done_{0};
+    atomic_u64 segments_total_{0};
+    Atomic<i64> current_segment_{-1};
+};
+
+// The index builds in progress of all sessions
+export class IndexBuildRegistry {
+public:
+    static IndexBuildRegistry &instance();
+
+    SharedPtr<IndexBuildProgress> Begin(String db_name, String table_name, String index_name, IndexBuildPhase phase);
+
+    void End(const IndexBuildProgress *progress);
+
+    // Sorted by db, table and index name
+    Vector<IndexBuildProgressInfo> Builds() const;
+
+    Vector<IndexBuildProgressInfo> Builds(const String &db_name, const String &table_name, const String &index_name) const;
+
+private:
+    mutable std::mutex mutex_{};
+    Vector<SharedPtr<IndexBuildProgress>> builds_{};
+};
+
+} // namespace infinity
@@ -0,0 +1,104 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module query_memory_tracker;
+
+import stl;
+import global_resource_usage;
+import infinity_exception;
+import status;
+import third_party;
+
+namespace infinity {
+
+// Bytes held by the operators of one query. Operators charge what they keep across calls through a MemoryReservation,
+// the operators which can spill spill when the query is over the limit, the others fail the query.
+export class QueryMemoryTracker {
+public:
+    QueryMemoryTracker() = default;
+
+    ~QueryMemoryTracker() { GlobalResourceUsage::AddQueryMemory(-used_.load()); }
+
+    QueryMemoryTracker(const QueryMemoryTracker &) = delete;
+    QueryMemoryTracker &operator=(const QueryMemoryTracker &) = delete;
+
+    // 0 means no limit.
+    inline void SetLimit(u64 limit) { limit_ = limit; }
+
+    inline void Charge(i64 bytes) {
+        i64 used = used_.fetch_add(bytes) + bytes;
+        i64 peak = peak_.load();
+        while (used > peak && !peak_.compare_exchange_weak(peak, used)) {
+        }
+        GlobalResourceUsage::AddQueryMemory(bytes);
+    }
+
+    [[nodiscard]] inline bool OverLimit() const { return limit_ > 0 && used_.load() > (i64)limit_; }
+
+    [[nodiscard]] inline u64 limit() const { return limit_; }
+
+    [[nodiscard]] inline i64 used() const { return used_.load(); }
+
+    [[nodiscard]] inline i64 peak() const { return peak_.load(); }
+
+private:
+    u64 limit_{0};
+    Atomic<i64> used_{0};
+    Atomic<i64> peak_{0};
+};
+
+// The bytes an operator state holds on the query tracker, released when the state is destroyed.
+export class MemoryReservation {
+public:
+    MemoryReservation() = default;
+
+    ~MemoryReservation() { Resize(0); }
+
+    MemoryReservation(const MemoryReservation &) = delete;
+    MemoryReservation &operator=(const MemoryReservation &) = delete;
+
+    inline void Init(QueryMemoryTracker *tracker) {
+        if (tracker_ == nullptr) {
+            tracker_ = tracker;
+        }
+    }
+
+    // Set the reserved bytes, return false if the query is over its memory limit afterwards.
+    inline bool Resize(SizeT bytes) {
+        if (tracker_ == nullptr) {
+            return true;
+        }
+        tracker_->Charge((i64)bytes - (i64)bytes_);
+        bytes_ = bytes;
+        return !tracker_->OverLimit();
+    }
+
+    // For the operators which can't spill, the query fails when it is over the memory limit.
+    inline void ResizeOrFail(SizeT bytes, const char *operator_name) {
+        if (!Resize(bytes)) {
+            RecoverableError(Status::OutOfMemory(
+                fmt::format("{} needs {} bytes, the query is over its memory limit of {} bytes", operator_name, bytes, tracker_->limit())));
+        }
+    }
+
+    [[nodiscard]] inline SizeT size() const { return bytes_; }
+
+private:
+    QueryMemoryTracker *tracker_{};
+    SizeT bytes_{0};
+};
+
+} // namespace infinity
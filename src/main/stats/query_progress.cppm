@@ -0,0 +1,108 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module query_progress;
+
+import stl;
+import physical_operator_type;
+import query_memory_tracker;
+
+namespace infinity {
+
+// One row of SHOW QUERIES
+export struct QueryProgressInfo {
+    u64 query_id_{0};
+    u64 session_id_{0};
+    String query_text_{};
+    u64 elapsed_ns_{0};
+    u64 fragments_done_{0};
+    u64 fragments_total_{0};
+    u64 tasks_done_{0};
+    u64 tasks_total_{0};
+    u64 rows_scanned_{0};
+    i64 memory_bytes_{0};
+    PhysicalOperatorType current_operator_{PhysicalOperatorType::kInvalid};
+};
+
+// What a running query is doing. The tasks of the query update the counters, SHOW QUERIES of other sessions reads them
+// while the query is registered in the session manager.
+export class QueryProgress {
+public:
+    void Begin(u64 query_id, u64 session_id, String query_text, const QueryMemoryTracker *memory_tracker) {
+        query_id_ = query_id;
+        session_id_ = session_id;
+        query_text_ = std::move(query_text);
+        memory_tracker_ = memory_tracker;
+        begin_time_ = Clock::now();
+        fragments_done_.store(0, std::memory_order_relaxed);
+        fragments_total_.store(0, std::memory_order_relaxed);
+        tasks_done_.store(0, std::memory_order_relaxed);
+        tasks_total_.store(0, std::memory_order_relaxed);
+        rows_scanned_.store(0, std::memory_order_relaxed);
+        current_operator_.store(PhysicalOperatorType::kInvalid, std::memory_order_relaxed);
+    }
+
+    inline void AddFragment(u64 task_count) {
+        fragments_total_.fetch_add(1, std::memory_order_relaxed);
+        tasks_total_.fetch_add(task_count, std::memory_order_relaxed);
+    }
+
+    inline void FinishTask() { tasks_done_.fetch_add(1, std::memory_order_relaxed); }
+
+    inline void FinishFragment() { fragments_done_.fetch_add(1, std::memory_order_relaxed); }
+
+    inline void AddRowsScanned(u64 row_count) { rows_scanned_.fetch_add(row_count, std::memory_order_relaxed); }
+
+    // The operator a task of the query started last, the query runs several of them at once if it has several tasks.
+    inline void SetCurrentOperator(PhysicalOperatorType operator_type) { current_operator_.store(operator_type, std::memory_order_relaxed); }
+
+    [[nodiscard]] inline u64 query_id() const { return query_id_; }
+
+    [[nodiscard]] inline u64 session_id() const { return session_id_; }
+
+    [[nodiscard]] QueryProgressInfo Snapshot() const {
+        QueryProgressInfo info;
+        info.query_id_ = query_id_;
+        info.session_id_ = session_id_;
+        info.query_text_ = query_text_;
+        info.elapsed_ns_ = ElapsedFromStart(Clock::now(), begin_time_).count();
+        info.fragments_done_ = fragments_done_.load(std::memory_order_relaxed);
+        info.fragments_total_ = fragments_total_.load(std::memory_order_relaxed);
+        info.tasks_done_ = tasks_done_.load(std::memory_order_relaxed);
+        info.tasks_total_ = tasks_total_.load(std::memory_order_relaxed);
+        info.rows_scanned_ = rows_scanned_.load(std::memory_order_relaxed);
+        info.memory_bytes_ = memory_tracker_ != nullptr ? memory_tracker_->used() : 0;
+        info.current_operator_ = current_operator_.load(std::memory_order_relaxed);
+        return info;
+    }
+
+private:
+    // Set before the query is registered, not changed while it runs
+    u64 query_id_{0};
+    u64 session_id_{0};
+    String query_text_{};
+    const QueryMemoryTracker *memory_tracker_{};
+    TimePoint<Clock> begin_time_{};
+
+    atomic_u64 fragments_done_{0};
+    atomic_u64 fragments_total_{0};
+    atomic_u64 tasks_done_{0};
+    atomic_u64 tasks_total_{0};
+    atomic_u64 rows_scanned_{0};
+    Atomic<PhysicalOperatorType> current_operator_{PhysicalOperatorType::kInvalid};
+};
+
+} // namespace infinity
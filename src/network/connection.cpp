@@ -15,6 +15,10 @@
 module;
 
 #include <boost/asio/ip/tcp.hpp>
+#include <cctype>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
 
 module connection;
 
@@ -38,9 +42,168 @@ import type_info;
 import logical_type;
 import embedding_info;
 import data_type;
+import sql_parser;
+import parser_result;
+import constant_expr;
 
 namespace infinity {
 
+namespace {
+
+// $n of a query of the extended query protocol to ?n, as the lexer has no token for $.
+String RewriteParameterMarkers(const String &query) {
+    String result;
+    result.reserve(query.size());
+    char quote = 0;
+    for (SizeT idx = 0; idx < query.size(); ++idx) {
+        char c = query[idx];
+        if (quote != 0) {
+            if (c == quote) {
+                quote = 0;
+            }
+        } else if (c == '\'' || c == '"') {
+            quote = c;
+        } else if (c == '$' && idx + 1 < query.size() && std::isdigit(static_cast<unsigned char>(query[idx + 1]))) {
+            c = '?';
+        }
+        result.push_back(c);
+    }
+    return result;
+}
+
+bool ParseInteger(const String &text, i64 &value) {
+    char *end = nullptr;
+    errno = 0;
+    value = std::strtoll(text.c_str(), &end, 10);
+    return !text.empty() && errno == 0 && *end == '\0';
+}
+
+bool ParseDouble(const String &text, double &value) {
+    char *end = nullptr;
+    errno = 0;
+    value = std::strtod(text.c_str(), &end);
+    return !text.empty() && errno == 0 && *end == '\0';
+}
+
+// An array as [1, 2] or {0.5, 1.5}, into the integer or double array of the constant.
+bool ParseArray(const String &text, ConstantExpr *constant) {
+    if (text.size() < 3 || !((text.front() == '[' && text.back() == ']') || (text.front() == '{' && text.back() == '}'))) {
+        return false;
+    }
+    Vector<String> elements;
+    SizeT begin = 1;
+    while (begin < text.size()) {
+        SizeT end = text.find(',', begin);
+        if (end == String::npos) {
+            end = text.size() - 1;
+        }
+        String element = text.substr(begin, end - begin);
+        element.erase(0, element.find_first_not_of(' '));
+        element.erase(element.find_last_not_of(' ') + 1);
+        elements.emplace_back(std::move(element));
+        begin = end + 1;
+    }
+
+    bool all_integer = true;
+    for (const String &element : elements) {
+        i64 integer_value{};
+        double double_value{};
+        if (ParseInteger(element, integer_value)) {
+            constant->long_array_.emplace_back(integer_value);
+            constant->double_array_.emplace_back(integer_value);
+        } else if (ParseDouble(element, double_value)) {
+            all_integer = false;
+            constant->double_array_.emplace_back(double_value);
+        } else {
+            constant->long_array_.clear();
+            constant->double_array_.clear();
+            return false;
+        }
+    }
+    if (all_integer) {
+        constant->literal_type_ = LiteralType::kIntegerArray;
+        constant->double_array_.clear();
+    } else {
+        constant->literal_type_ = LiteralType::kDoubleArray;
+        constant->long_array_.clear();
+    }
+    return true;
+}
+
+// Set the text value of a parameter into its constant. The literal type follows the type oid given by Parse, or is
+// guessed from the text if the type is unspecified.
+void BindParameter(ConstantExpr *constant, const Optional<String> &value, u32 type_oid) {
+    // The value of the last execution
+    switch (constant->literal_type_) {
+        case LiteralType::kString: {
+            free(constant->str_value_);
+            constant->str_value_ = nullptr;
+            break;
+        }
+        case LiteralType::kDate:
+        case LiteralType::kTime:
+        case LiteralType::kDateTime:
+        case LiteralType::kTimestamp: {
+            free(constant->date_value_);
+            constant->date_value_ = nullptr;
+            break;
+        }
+        default: {
+            break;
+        }
+    }
+    constant->long_array_.clear();
+    constant->double_array_.clear();
+
+    if (!value.has_value()) {
+        constant->literal_type_ = LiteralType::kNull;
+        return;
+    }
+    const String &text = value.value();
+    switch (type_oid) {
+        case 16: {
+            constant->literal_type_ = LiteralType::kBoolean;
+            constant->bool_value_ = text == "t" || text == "true" || text == "1";
+            return;
+        }
+        case 25:
+        case 1043: {
+            constant->literal_type_ = LiteralType::kString;
+            constant->str_value_ = strdup(text.c_str());
+            return;
+        }
+        case 1082: {
+            constant->literal_type_ = LiteralType::kDate;
+            constant->date_value_ = strdup(text.c_str());
+            return;
+        }
+        case 1083: {
+            constant->literal_type_ = LiteralType::kTime;
+            constant->date_value_ = strdup(text.c_str());
+            return;
+        }
+        case 1114: {
+            constant->literal_type_ = LiteralType::kTimestamp;
+            constant->date_value_ = strdup(text.c_str());
+            return;
+        }
+        default: {
+            break;
+        }
+    }
+
+    if (ParseInteger(text, constant->integer_value_)) {
+        constant->literal_type_ = LiteralType::kInteger;
+    } else if (ParseDouble(text, constant->double_value_)) {
+        constant->literal_type_ = LiteralType::kDouble;
+    } else if (!ParseArray(text, constant)) {
+        constant->literal_type_ = LiteralType::kString;
+        constant->str_value_ = strdup(text.c_str());
+    }
+}
+
+} // namespace
+
 Connection::Connection(boost::asio::io_service &io_service)
     : socket_(MakeShared<boost::asio::ip::tcp::socket>(io_service)), pg_handler_(MakeShared<PGProtocolHandler>(socket())) {}
 
@@ -53,37 +216,34 @@ Connection::~Connection() {
     session_mgr->RemoveSessionByID(session_->session_id());
 }
 
-void Connection::Run() {
+void Connection::Init() {
     // Disable Nagle's algorithm to reduce TCP latency, but will reduce the throughput.
     socket_->set_option(boost::asio::ip::tcp::no_delay(true));
 
     SessionManager *session_manager = InfinityContext::instance().session_manager();
     session_ = session_manager->CreateRemoteSession();
+}
 
-    HandleConnection();
-
-    session_->SetClientInfo(socket_->remote_endpoint().address().to_string(), socket_->remote_endpoint().port());
-
-    while (!terminate_connection_) {
-        try {
+bool Connection::HandleMessage() {
+    try {
+        if (!started_) {
+            HandleConnection();
+            session_->SetClientInfo(socket_->remote_endpoint().address().to_string(), socket_->remote_endpoint().port());
+            started_ = true;
+        } else {
             HandleRequest();
-        } catch (const infinity::RecoverableException &e) {
-            LOG_TRACE(fmt::format("Recoverable exception: {}", e.what()));
-            return ;
-        } catch (const infinity::UnrecoverableException& e) {
-            HashMap<PGMessageType, String> error_message_map;
-            error_message_map[PGMessageType::kHumanReadableError] = e.what();
-            LOG_ERROR(e.what());
-            pg_handler_->send_error_response(error_message_map);
-            pg_handler_->send_ready_for_query();
-        } catch (const std::exception &e) {
-            HashMap<PGMessageType, String> error_message_map;
-            error_message_map[PGMessageType::kHumanReadableError] = e.what();
-            LOG_ERROR(e.what());
-            pg_handler_->send_error_response(error_message_map);
-            pg_handler_->send_ready_for_query();
         }
+    } catch (const infinity::RecoverableException &e) {
+        LOG_TRACE(fmt::format("Recoverable exception: {}", e.what()));
+        return false;
+    } catch (const infinity::UnrecoverableException &e) {
+        LOG_ERROR(e.what());
+        SendError(e.what());
+    } catch (const std::exception &e) {
+        LOG_ERROR(e.what());
+        SendError(e.what());
     }
+    return !terminate_connection_;
 }
 
 void Connection::HandleConnection() {
@@ -100,6 +260,11 @@ void Connection::HandleConnection() {
 
 void Connection::HandleRequest() {
     const auto cmd_type = pg_handler_->read_command_type();
+    if (skip_till_sync_ && cmd_type != PGMessageType::kSyncCommand && cmd_type != PGMessageType::kTerminateCommand) {
+        pg_handler_->skip_command_body();
+        return;
+    }
+    extended_query_ = cmd_type != PGMessageType::kSimpleQueryCommand;
 
     // FIXME
     UniquePtr<QueryContext> query_context_ptr = MakeUnique<QueryContext>(session_.get());
@@ -112,18 +277,27 @@ void Connection::HandleRequest() {
     switch (cmd_type) {
         case PGMessageType::kBindCommand: {
             LOG_TRACE("BindCommand");
+            HandleBind();
             break;
         }
         case PGMessageType::kDescribeCommand: {
             LOG_TRACE("DescribeCommand");
+            HandleDescribe(query_context_ptr.get());
             break;
         }
         case PGMessageType::kExecuteCommand: {
             LOG_TRACE("ExecuteCommand");
+            HandleExecute(query_context_ptr.get());
             break;
         }
         case PGMessageType::kParseCommand: {
             LOG_TRACE("ParseCommand");
+            HandleParse();
+            break;
+        }
+        case PGMessageType::kCloseCommand: {
+            LOG_TRACE("CloseCommand");
+            HandleClose();
             break;
         }
         case PGMessageType::kSimpleQueryCommand: {
@@ -132,6 +306,15 @@ void Connection::HandleRequest() {
         }
         case PGMessageType::kSyncCommand: {
             LOG_TRACE("SyncCommand");
+            pg_handler_->skip_command_body();
+            skip_till_sync_ = false;
+            pg_handler_->send_ready_for_query();
+            break;
+        }
+        case PGMessageType::kFlushCommand: {
+            LOG_TRACE("FlushCommand");
+            pg_handler_->skip_command_body();
+            pg_handler_->flush();
             break;
         }
         case PGMessageType::kTerminateCommand: {
@@ -165,7 +348,146 @@ void Connection::HandlerSimpleQuery(QueryContext *query_context) {
     pg_handler_->send_ready_for_query();
 }
 
-void Connection::SendTableDescription(const SharedPtr<DataTable> &result_table) {
+void Connection::HandleParse() {
+    PGParseMessage message = pg_handler_->read_parse_body();
+    LOG_TRACE(fmt::format("Parse: {}", message.query_));
+
+    auto statement = MakeShared<PGPreparedStatement>();
+    statement->parsed_result_ = MakeUnique<ParserResult>();
+    SQLParser parser;
+    parser.Parse(RewriteParameterMarkers(message.query_), statement->parsed_result_.get());
+    if (statement->parsed_result_->IsError()) {
+        SendError(statement->parsed_result_->error_message_);
+        return;
+    }
+    if (statement->parsed_result_->statements_ptr_->size() != 1) {
+        SendError("Only support single statement.");
+        return;
+    }
+
+    for (ConstantExpr *parameter : statement->parsed_result_->parameter_exprs_) {
+        i64 parameter_idx = parameter->integer_value_;
+        if (parameter_idx < 1) {
+            SendError(fmt::format("Invalid parameter ${}", parameter_idx));
+            return;
+        }
+        statement->parameters_.emplace_back(parameter, parameter_idx);
+        statement->parameter_count_ = std::max<SizeT>(statement->parameter_count_, parameter_idx);
+    }
+    statement->parameter_types_ = std::move(message.parameter_types_);
+    statement->parameter_count_ = std::max(statement->parameter_count_, statement->parameter_types_.size());
+    statement->parameter_types_.resize(statement->parameter_count_, 0);
+
+    prepared_statements_[message.statement_name_] = std::move(statement);
+    pg_handler_->send_message(PGMessageType::kParseComplete);
+}
+
+void Connection::HandleBind() {
+    PGBindMessage message = pg_handler_->read_bind_body();
+    auto iter = prepared_statements_.find(message.statement_name_);
+    if (iter == prepared_statements_.end()) {
+        SendError(fmt::format("Prepared statement \"{}\" doesn't exist", message.statement_name_));
+        return;
+    }
+    if (message.parameter_values_.size() != iter->second->parameter_count_) {
+        SendError(fmt::format("Bind message supplies {} parameters, but prepared statement \"{}\" requires {}",
+                              message.parameter_values_.size(),
+                              message.statement_name_,
+                              iter->second->parameter_count_));
+        return;
+    }
+
+    PGPortal portal;
+    portal.statement_ = iter->second;
+    portal.parameter_values_ = std::move(message.parameter_values_);
+    portals_[message.portal_name_] = std::move(portal);
+    pg_handler_->send_message(PGMessageType::kBindComplete);
+}
+
+void Connection::HandleDescribe(QueryContext *query_context) {
+    auto [describe_type, name] = pg_handler_->read_describe_body();
+    if (describe_type == PGDescribeType::kStatement) {
+        auto iter = prepared_statements_.find(name);
+        if (iter == prepared_statements_.end()) {
+            SendError(fmt::format("Prepared statement \"{}\" doesn't exist", name));
+            return;
+        }
+        pg_handler_->send_parameter_description(iter->second->parameter_types_);
+        // The columns are known once the statement is planned with the values of its parameters.
+        pg_handler_->send_message(PGMessageType::kNoData);
+        return;
+    }
+
+    auto iter = portals_.find(name);
+    if (iter == portals_.end()) {
+        SendError(fmt::format("Portal \"{}\" doesn't exist", name));
+        return;
+    }
+    PGPortal &portal = iter->second;
+    auto result = MakeUnique<QueryResult>();
+    *result = RunPortal(portal, query_context);
+    if (result->result_table_.get() == nullptr) {
+        SendError(result->status_.message());
+        return;
+    }
+    if (!SendTableDescription(result->result_table_)) {
+        pg_handler_->send_message(PGMessageType::kNoData);
+    }
+    portal.result_ = std::move(result);
+}
+
+void Connection::HandleExecute(QueryContext *query_context) {
+    const String portal_name = pg_handler_->read_execute_body();
+    auto iter = portals_.find(portal_name);
+    if (iter == portals_.end()) {
+        SendError(fmt::format("Portal \"{}\" doesn't exist", portal_name));
+        return;
+    }
+    PGPortal &portal = iter->second;
+    UniquePtr<QueryResult> result = std::move(portal.result_);
+    if (result.get() == nullptr) {
+        result = MakeUnique<QueryResult>();
+        *result = RunPortal(portal, query_context);
+    }
+    if (result->result_table_.get() == nullptr) {
+        SendError(result->status_.message());
+        return;
+    }
+    SendQueryResponse(*result);
+}
+
+void Connection::HandleClose() {
+    auto [describe_type, name] = pg_handler_->read_describe_body();
+    if (describe_type == PGDescribeType::kStatement) {
+        prepared_statements_.erase(name);
+    } else {
+        portals_.erase(name);
+    }
+    pg_handler_->send_message(PGMessageType::kCloseComplete);
+}
+
+QueryResult Connection::RunPortal(PGPortal &portal, QueryContext *query_context) {
+    // Parsed once by Parse, only bound, optimized and planned again, since the plan holds the blocks visible to the
+    // transaction of the query.
+    PGPreparedStatement &statement = *portal.statement_;
+    for (auto &[parameter, parameter_idx] : statement.parameters_) {
+        BindParameter(parameter, portal.parameter_values_[parameter_idx - 1], statement.parameter_types_[parameter_idx - 1]);
+    }
+    return query_context->QueryParsed(statement.parsed_result_->statements_ptr_->at(0));
+}
+
+void Connection::SendError(const String &message) {
+    HashMap<PGMessageType, String> error_message_map;
+    error_message_map[PGMessageType::kHumanReadableError] = message;
+    pg_handler_->send_error_response(error_message_map);
+    if (extended_query_) {
+        skip_till_sync_ = true;
+    } else {
+        pg_handler_->send_ready_for_query();
+    }
+}
+
+bool Connection::SendTableDescription(const SharedPtr<DataTable> &result_table) {
     u32 column_name_length_sum = 0;
     SizeT column_count = result_table->ColumnCount();
     for (SizeT idx = 0; idx < column_count; ++idx) {
@@ -174,7 +496,7 @@ void Connection::SendTableDescription(const SharedPtr<DataTable> &result_table)
 
     // No output columns, no need to send table description, just return.
     if (column_name_length_sum == 0)
-        return;
+        return false;
 
     pg_handler_->SendDescriptionHeader(column_name_length_sum, column_count);
 
@@ -306,6 +628,7 @@ void Connection::SendTableDescription(const SharedPtr<DataTable> &result_table)
 
         pg_handler_->SendDescription(result_table->GetColumnNameById(idx), object_id, object_width);
     }
+    return true;
 }
 
 void Connection::SendQueryResponse(const QueryResult &query_result) {
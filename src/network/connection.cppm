@@ -23,16 +23,40 @@ import pg_protocol_handler;
 import query_context;
 import data_table;
 import query_result;
+import parser_result;
+import constant_expr;
 
 namespace infinity {
 
+// A statement of the extended query protocol, parsed once by its Parse and run by each Execute of its portals.
+struct PGPreparedStatement {
+    UniquePtr<ParserResult> parsed_result_{};
+    // Each $n of the query and its n, the value of the portal is set into the constant before running it.
+    Vector<Pair<ConstantExpr *, SizeT>> parameters_{};
+    SizeT parameter_count_{0};
+    Vector<u32> parameter_types_{};
+};
+
+struct PGPortal {
+    SharedPtr<PGPreparedStatement> statement_{};
+    Vector<Optional<String>> parameter_values_{};
+    // A Describe of the portal runs it to know its columns, the result is sent by the next Execute.
+    UniquePtr<QueryResult> result_{};
+};
+
 export class Connection {
 public:
     explicit Connection(boost::asio::io_service &io_service);
 
     ~Connection();
 
-    void Run();
+    void Init();
+
+    // Handle the startup message or one request, called when the socket is readable. Returns false once the connection
+    // is to be closed.
+    bool HandleMessage();
+
+    inline bool HasBufferedMessage() const { return pg_handler_->has_buffered_data(); }
 
     inline SharedPtr<boost::asio::ip::tcp::socket> socket() { return socket_; }
 
@@ -43,7 +67,23 @@ private:
 
     void HandlerSimpleQuery(QueryContext *query_context);
 
-    void SendTableDescription(const SharedPtr<DataTable> &result_table);
+    void HandleParse();
+
+    void HandleBind();
+
+    void HandleDescribe(QueryContext *query_context);
+
+    void HandleExecute(QueryContext *query_context);
+
+    void HandleClose();
+
+    QueryResult RunPortal(PGPortal &portal, QueryContext *query_context);
+
+    // Send the error, then ReadyForQuery for a simple query, or skip the messages until Sync for the extended protocol.
+    void SendError(const String &message);
+
+    // Returns false if the result has no columns to describe.
+    bool SendTableDescription(const SharedPtr<DataTable> &result_table);
 
     void SendQueryResponse(const QueryResult &query_result);
 
@@ -54,6 +94,18 @@ private:
 
     bool terminate_connection_ = false;
 
+    bool started_ = false;
+
+    // The message being handled is one of the extended query protocol.
+    bool extended_query_ = false;
+
+    // After an error of the extended query protocol, the messages until Sync are discarded.
+    bool skip_till_sync_ = false;
+
+    // Named and unnamed ("") statements and portals of the session
+    HashMap<String, SharedPtr<PGPreparedStatement>> prepared_statements_{};
+    HashMap<String, PGPortal> portals_{};
+
     SharedPtr<RemoteSession> session_{};
 };
 
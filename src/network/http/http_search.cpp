@@ -41,198 +41,341 @@ void HTTPSearch::Process(Infinity *infinity_ptr,
                          const String &table_name,
                          const String &input_json_str,
                          HTTPStatus &http_status,
-                         nlohmann::json &response) {
+                         String &response_body) {
     http_status = HTTPStatus::CODE_500;
+    nlohmann::json response;
     try {
         nlohmann::json input_json = nlohmann::json::parse(input_json_str);
         if (!input_json.is_object()) {
             response["error_code"] = ErrorCode::kInvalidJsonFormat;
             response["error_message"] = "HTTP Body isn't json object";
+            response_body = response.dump();
+            return;
         }
 
-        Vector<ParsedExpr *> *output_columns{nullptr};
-        ParsedExpr *filter{nullptr};
-        FusionExpr *fusion_expr{nullptr};
-        KnnExpr *knn_expr{nullptr};
-        MatchExpr *match_expr{nullptr};
-        SearchExpr *search_expr = new SearchExpr();
-        DeferFn defer_fn([&]() {
-            if (output_columns != nullptr) {
-                for (auto &expr : *output_columns) {
+        SearchQuery query;
+        if (!ParseSearch(input_json, query, http_status, response)) {
+            response_body = response.dump();
+            return;
+        }
+        const QueryResult result = infinity_ptr->Search(db_name, table_name, query.search_expr_, query.filter_, query.output_columns_);
+        AppendResult(result, http_status, response_body);
+        return;
+    } catch (nlohmann::json::exception &e) {
+        response["error_code"] = ErrorCode::kInvalidJsonFormat;
+        response["error_message"] = e.what();
+    }
+    response_body = response.dump();
+}
+
+void HTTPSearch::ProcessBatch(Infinity *infinity_ptr,
+                              const String &db_name,
+                              const String &table_name,
+                              const String &input_json_str,
+                              HTTPStatus &http_status,
+                              String &response_body) {
+    http_status = HTTPStatus::CODE_500;
+    nlohmann::json response;
+    Vector<SearchQuery> queries;
+    DeferFn defer_fn([&]() {
+        for (auto &query : queries) {
+            if (query.output_columns_ != nullptr) {
+                for (auto &expr : *query.output_columns_) {
                     delete expr;
                 }
-                delete output_columns;
-                output_columns = nullptr;
-            }
-            if (filter != nullptr) {
-                delete filter;
-                filter = nullptr;
+                delete query.output_columns_;
             }
-            if (fusion_expr != nullptr) {
-                delete fusion_expr;
-                fusion_expr = nullptr;
+            delete query.filter_;
+            delete query.search_expr_;
+        }
+    });
+    try {
+        nlohmann::json input_json = nlohmann::json::parse(input_json_str);
+        if (!input_json.is_object() || !input_json.contains("searches") || !input_json["searches"].is_array()) {
+            response["error_code"] = ErrorCode::kInvalidJsonFormat;
+            response["error_message"] = "HTTP Body should be a json object with a searches array";
+            response_body = response.dump();
+            return;
+        }
+
+        auto &searches_json = input_json["searches"];
+        queries.reserve(searches_json.size());
+        for (auto &search_json : searches_json) {
+            if (!search_json.is_object()) {
+                response["error_code"] = ErrorCode::kInvalidJsonFormat;
+                response["error_message"] = "Each search should be a json object";
+                response_body = response.dump();
+                return;
             }
-            if (knn_expr != nullptr) {
-                delete knn_expr;
-                knn_expr = nullptr;
+            SearchQuery query;
+            query.db_name_ = db_name;
+            query.table_name_ = table_name;
+            if (!ParseSearch(search_json, query, http_status, response)) {
+                response_body = response.dump();
+                return;
             }
-            if (match_expr != nullptr) {
-                delete match_expr;
-                match_expr = nullptr;
+            queries.emplace_back(std::move(query));
+        }
+
+        // The searches run under one snapshot, each has a result of its own
+        Vector<QueryResult> results = infinity_ptr->BatchSearch(std::move(queries));
+        queries.clear();
+        response_body = R"({"error_code":0,"results":[)";
+        for (SizeT i = 0; i < results.size(); ++i) {
+            if (i > 0) {
+                response_body += ',';
             }
-            if (search_expr != nullptr) {
-                delete search_expr;
-                search_expr = nullptr;
+            HTTPStatus result_status;
+            AppendResult(results[i], result_status, response_body);
+        }
+        response_body += "]}";
+        http_status = HTTPStatus::CODE_200;
+        return;
+    } catch (nlohmann::json::exception &e) {
+        response["error_code"] = ErrorCode::kInvalidJsonFormat;
+        response["error_message"] = e.what();
+    }
+    response_body = response.dump();
+}
+
+bool HTTPSearch::ParseSearch(nlohmann::json &input_json, SearchQuery &query, HTTPStatus &http_status, nlohmann::json &response) {
+    Vector<ParsedExpr *> *output_columns{nullptr};
+    ParsedExpr *filter{nullptr};
+    FusionExpr *fusion_expr{nullptr};
+    KnnExpr *knn_expr{nullptr};
+    MatchExpr *match_expr{nullptr};
+    SearchExpr *search_expr = new SearchExpr();
+    DeferFn defer_fn([&]() {
+        if (output_columns != nullptr) {
+            for (auto &expr : *output_columns) {
+                delete expr;
             }
-        });
+            delete output_columns;
+            output_columns = nullptr;
+        }
+        if (filter != nullptr) {
+            delete filter;
+            filter = nullptr;
+        }
+        if (fusion_expr != nullptr) {
+            delete fusion_expr;
+            fusion_expr = nullptr;
+        }
+        if (knn_expr != nullptr) {
+            delete knn_expr;
+            knn_expr = nullptr;
+        }
+        if (match_expr != nullptr) {
+            delete match_expr;
+            match_expr = nullptr;
+        }
+        if (search_expr != nullptr) {
+            delete search_expr;
+            search_expr = nullptr;
+        }
+    });
 
-        for (const auto &elem : input_json.items()) {
-            String key = elem.key();
-            ToLower(key);
-            if (IsEqual(key, "output")) {
-                if (output_columns != nullptr) {
-                    response["error_code"] = ErrorCode::kInvalidExpression;
-                    response["error_message"] = "More than one output field.";
-                    return;
-                }
-                auto &output_list = elem.value();
-                if (!output_list.is_array()) {
-                    response["error_code"] = ErrorCode::kInvalidExpression;
-                    response["error_message"] = "Output field should be array";
-                    return;
-                }
+    for (const auto &elem : input_json.items()) {
+        String key = elem.key();
+        ToLower(key);
+        if (IsEqual(key, "output")) {
+            if (output_columns != nullptr) {
+                response["error_code"] = ErrorCode::kInvalidExpression;
+                response["error_message"] = "More than one output field.";
+                return false;
+            }
+            auto &output_list = elem.value();
+            if (!output_list.is_array()) {
+                response["error_code"] = ErrorCode::kInvalidExpression;
+                response["error_message"] = "Output field should be array";
+                return false;
+            }
 
-                output_columns = ParseOutput(output_list, http_status, response);
-            } else if (IsEqual(key, "filter")) {
+            output_columns = ParseOutput(output_list, http_status, response);
+        } else if (IsEqual(key, "filter")) {
 
-                if (filter != nullptr) {
-                    response["error_code"] = ErrorCode::kInvalidExpression;
-                    response["error_message"] = "More than one output field.";
-                    return;
-                }
+            if (filter != nullptr) {
+                response["error_code"] = ErrorCode::kInvalidExpression;
+                response["error_message"] = "More than one output field.";
+                return false;
+            }
 
-                auto &filter_json = elem.value();
-                if (!filter_json.is_string()) {
-                    response["error_code"] = ErrorCode::kInvalidExpression;
-                    response["error_message"] = "Filter field should be string";
-                    return;
-                }
+            auto &filter_json = elem.value();
+            if (!filter_json.is_string()) {
+                response["error_code"] = ErrorCode::kInvalidExpression;
+                response["error_message"] = "Filter field should be string";
+                return false;
+            }
 
-                filter = ParseFilter(filter_json, http_status, response);
-            } else if (IsEqual(key, "fusion")) {
-                if (fusion_expr != nullptr or knn_expr != nullptr or match_expr != nullptr) {
-                    response["error_code"] = ErrorCode::kInvalidExpression;
-                    response["error_message"] =
-                        "There are more than one fusion expressions, Or fusion expression coexists with knn / match expression ";
-                    return;
-                }
-                auto &fusion_children = elem.value();
-                for (const auto &expression : fusion_children.items()) {
-                    String key = expression.key();
-                    ToLower(key);
-
-                    if (IsEqual(key, "knn")) {
-                        auto &knn_json = expression.value();
-                        if (!knn_json.is_object()) {
-                            response["error_code"] = ErrorCode::kInvalidExpression;
-                            response["error_message"] = "KNN field should be object";
-                            return;
-                        }
-                        knn_expr = ParseKnn(knn_json, http_status, response);
-                        search_expr->AddExpr(knn_expr);
-                        knn_expr = nullptr;
-                    } else if (IsEqual(key, "match")) {
-                        auto &match_json = expression.value();
-                        match_expr = ParseMatch(match_json, http_status, response);
-                        search_expr->AddExpr(match_expr);
-                        match_expr = nullptr;
-                    } else if (IsEqual(key, "method")) {
-                        if (fusion_expr != nullptr && !fusion_expr->method_.empty()) {
-                            response["error_code"] = ErrorCode::kInvalidExpression;
-                            response["error_message"] = "Method is already given";
-                            return;
-                        }
-                        fusion_expr = new FusionExpr();
-                        fusion_expr->method_ = expression.value();
-                        search_expr->AddExpr(fusion_expr);
-                        fusion_expr = nullptr;
-                    } else {
+            filter = ParseFilter(filter_json, http_status, response);
+        } else if (IsEqual(key, "fusion")) {
+            if (fusion_expr != nullptr or knn_expr != nullptr or match_expr != nullptr) {
+                response["error_code"] = ErrorCode::kInvalidExpression;
+                response["error_message"] =
+                    "There are more than one fusion expressions, Or fusion expression coexists with knn / match expression ";
+                return false;
+            }
+            auto &fusion_children = elem.value();
+            for (const auto &expression : fusion_children.items()) {
+                String key = expression.key();
+                ToLower(key);
+
+                if (IsEqual(key, "knn")) {
+                    auto &knn_json = expression.value();
+                    if (!knn_json.is_object()) {
                         response["error_code"] = ErrorCode::kInvalidExpression;
-                        response["error_message"] = "Error fusion clause";
-                        return;
+                        response["error_message"] = "KNN field should be object";
+                        return false;
                     }
-                }
-                search_expr->Validate();
-            } else if (IsEqual(key, "knn")) {
-                if (fusion_expr != nullptr or knn_expr != nullptr or match_expr != nullptr) {
-                    response["error_code"] = ErrorCode::kInvalidExpression;
-                    response["error_message"] =
-                        "There are more than one fusion expressions, Or fusion expression coexists with knn / match expression ";
-                    return;
-                }
-                auto &knn_json = elem.value();
-                if (!knn_json.is_object()) {
-                    response["error_code"] = ErrorCode::kInvalidExpression;
-                    response["error_message"] = "KNN field should be object";
-                    return;
-                }
-                knn_expr = ParseKnn(knn_json, http_status, response);
-                search_expr->AddExpr(knn_expr);
-                knn_expr = nullptr;
-            } else if (IsEqual(key, "match")) {
-                if (fusion_expr != nullptr or knn_expr != nullptr or match_expr != nullptr) {
+                    knn_expr = ParseKnn(knn_json, http_status, response);
+                    search_expr->AddExpr(knn_expr);
+                    knn_expr = nullptr;
+                } else if (IsEqual(key, "match")) {
+                    auto &match_json = expression.value();
+                    match_expr = ParseMatch(match_json, http_status, response);
+                    search_expr->AddExpr(match_expr);
+                    match_expr = nullptr;
+                } else if (IsEqual(key, "method")) {
+                    if (fusion_expr != nullptr && !fusion_expr->method_.empty()) {
+                        response["error_code"] = ErrorCode::kInvalidExpression;
+                        response["error_message"] = "Method is already given";
+                        return false;
+                    }
+                    fusion_expr = new FusionExpr();
+                    fusion_expr->method_ = expression.value();
+                    search_expr->AddExpr(fusion_expr);
+                    fusion_expr = nullptr;
+                } else {
                     response["error_code"] = ErrorCode::kInvalidExpression;
-                    response["error_message"] =
-                        "There are more than one fusion expressions, Or fusion expression coexists with knn / match expression ";
-                    return;
+                    response["error_message"] = "Error fusion clause";
+                    return false;
                 }
-                auto &match_json = elem.value();
-                match_expr = ParseMatch(match_json, http_status, response);
-                search_expr->AddExpr(match_expr);
-                match_expr = nullptr;
-            } else {
+            }
+            search_expr->Validate();
+        } else if (IsEqual(key, "knn")) {
+            if (fusion_expr != nullptr or knn_expr != nullptr or match_expr != nullptr) {
                 response["error_code"] = ErrorCode::kInvalidExpression;
-                response["error_message"] = "Unknown expression: " + key;
-                return;
+                response["error_message"] =
+                    "There are more than one fusion expressions, Or fusion expression coexists with knn / match expression ";
+                return false;
+            }
+            auto &knn_json = elem.value();
+            if (!knn_json.is_object()) {
+                response["error_code"] = ErrorCode::kInvalidExpression;
+                response["error_message"] = "KNN field should be object";
+                return false;
+            }
+            knn_expr = ParseKnn(knn_json, http_status, response);
+            search_expr->AddExpr(knn_expr);
+            knn_expr = nullptr;
+        } else if (IsEqual(key, "match")) {
+            if (fusion_expr != nullptr or knn_expr != nullptr or match_expr != nullptr) {
+                response["error_code"] = ErrorCode::kInvalidExpression;
+                response["error_message"] =
+                    "There are more than one fusion expressions, Or fusion expression coexists with knn / match expression ";
+                return false;
             }
+            auto &match_json = elem.value();
+            match_expr = ParseMatch(match_json, http_status, response);
+            search_expr->AddExpr(match_expr);
+            match_expr = nullptr;
+        } else {
+            response["error_code"] = ErrorCode::kInvalidExpression;
+            response["error_message"] = "Unknown expression: " + key;
+            return false;
         }
+    }
 
-        const QueryResult result = infinity_ptr->Search(db_name, table_name, search_expr, filter, output_columns);
-
-        output_columns = nullptr;
-        filter = nullptr;
-        search_expr = nullptr;
-        if (result.IsOk()) {
-            SizeT block_rows = result.result_table_->DataBlockCount();
-            for (SizeT block_id = 0; block_id < block_rows; ++block_id) {
-                DataBlock *data_block = result.result_table_->GetDataBlockById(block_id).get();
-                auto row_count = data_block->row_count();
-                auto column_cnt = result.result_table_->ColumnCount();
-
-                for (int row = 0; row < row_count; ++row) {
-                    nlohmann::json json_result_row;
-                    for (SizeT col = 0; col < column_cnt; ++col) {
-                        Value value = data_block->GetValue(col, row);
-                        const String &column_name = result.result_table_->GetColumnNameById(col);
-                        const String &column_value = value.ToString();
-                        json_result_row[column_name] = column_value;
-                    }
-                    response["output"].push_back(json_result_row);
+    query.search_expr_ = search_expr;
+    query.filter_ = filter;
+    query.output_columns_ = output_columns;
+    search_expr = nullptr;
+    filter = nullptr;
+    output_columns = nullptr;
+    return true;
+}
+
+void HTTPSearch::AppendResult(const QueryResult &result, HTTPStatus &http_status, String &response_body) {
+    if (!result.IsOk()) {
+        nlohmann::json response;
+        response["error_code"] = result.ErrorCode();
+        response["error_message"] = result.ErrorMsg();
+        response_body += response.dump();
+        http_status = HTTPStatus::CODE_500;
+        return;
+    }
+
+    // The rows are written straight into the body, a DOM of the whole result costs several times the query itself
+    SizeT column_cnt = result.result_table_->ColumnCount();
+    Vector<String> column_keys(column_cnt);
+    for (SizeT col = 0; col < column_cnt; ++col) {
+        AppendJsonString(column_keys[col], result.result_table_->GetColumnNameById(col));
+        column_keys[col] += ':';
+    }
+
+    response_body += R"({"error_code":0,"output":[)";
+    bool first_row = true;
+    SizeT block_rows = result.result_table_->DataBlockCount();
+    for (SizeT block_id = 0; block_id < block_rows; ++block_id) {
+        DataBlock *data_block = result.result_table_->GetDataBlockById(block_id).get();
+        auto row_count = data_block->row_count();
+        for (int row = 0; row < row_count; ++row) {
+            response_body += first_row ? "{" : ",{";
+            first_row = false;
+            for (SizeT col = 0; col < column_cnt; ++col) {
+                if (col > 0) {
+                    response_body += ',';
                 }
+                response_body += column_keys[col];
+                Value value = data_block->GetValue(col, row);
+                AppendJsonString(response_body, value.ToString());
             }
+            response_body += '}';
+        }
+    }
+    response_body += "]}";
+    http_status = HTTPStatus::CODE_200;
+}
 
-            response["error_code"] = 0;
-            http_status = HTTPStatus::CODE_200;
-        } else {
-            response["error_code"] = result.ErrorCode();
-            response["error_message"] = result.ErrorMsg();
-            http_status = HTTPStatus::CODE_500;
+void HTTPSearch::AppendJsonString(String &out, const String &str) {
+    static constexpr char hex_digits[] = "0123456789abcdef";
+    out.reserve(out.size() + str.size() + 2);
+    out += '"';
+    for (char c : str) {
+        switch (c) {
+            case '"': {
+                out += R"(\")";
+                break;
+            }
+            case '\\': {
+                out += R"(\\)";
+                break;
+            }
+            case '\n': {
+                out += R"(\n)";
+                break;
+            }
+            case '\r': {
+                out += R"(\r)";
+                break;
+            }
+            case '\t': {
+                out += R"(\t)";
+                break;
+            }
+            default: {
+                auto byte = static_cast<unsigned char>(c);
+                if (byte < 0x20) {
+                    out += R"(\u00)";
+                    out += hex_digits[byte >> 4];
+                    out += hex_digits[byte & 0xf];
+                } else {
+                    out += c;
+                }
+            }
         }
-    } catch (nlohmann::json::exception &e) {
-        response["error_code"] = ErrorCode::kInvalidJsonFormat;
-        response["error_message"] = e.what();
     }
-    return;
+    out += '"';
 }
 
 ParsedExpr *HTTPSearch::ParseFilter(const nlohmann::json &json_object, HTTPStatus &http_status, nlohmann::json &response) {
@@ -345,6 +488,8 @@ KnnExpr *HTTPSearch::ParseKnn(nlohmann::json &knn_json_object, HTTPStatus &http_
                 knn_expr->distance_type_ = KnnDistanceType::kCosine;
             } else if (IsEqual(metric_type, "hamming")) {
                 knn_expr->distance_type_ = KnnDistanceType::kHamming;
+            } else if (IsEqual(metric_type, "maxsim")) {
+                knn_expr->distance_type_ = KnnDistanceType::kMaxSim;
             } else {
                 response["error_code"] = ErrorCode::kInvalidExpression;
                 response["error_message"] = fmt::format("Unknown knn distance: {}", metric_type);
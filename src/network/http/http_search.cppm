@@ -23,6 +23,7 @@ import parsed_expr;
 import knn_expr;
 import match_expr;
 import infinity;
+import query_result;
 
 namespace infinity {
 
@@ -33,7 +34,20 @@ public:
                         const String &table_name,
                         const String &input_json,
                         HTTPStatus &http_status,
-                        nlohmann::json &response);
+                        String &response_body);
+
+    // The body is {"searches": [...]}, each search as the body of Process. The results are in the same order.
+    static void ProcessBatch(Infinity *infinity_ptr,
+                             const String &db_name,
+                             const String &table_name,
+                             const String &input_json,
+                             HTTPStatus &http_status,
+                             String &response_body);
+
+    static bool ParseSearch(nlohmann::json &input_json, SearchQuery &query, HTTPStatus &http_status, nlohmann::json &response);
+    // Appends the result to the body as a json object, written row by row without a DOM of the result
+    static void AppendResult(const QueryResult &result, HTTPStatus &http_status, String &response_body);
+    static void AppendJsonString(String &out, const String &str);
 
     static ParsedExpr *ParseFilter(const nlohmann::json &json_object, HTTPStatus &http_status, nlohmann::json &response);
     static Vector<ParsedExpr *> *ParseOutput(const nlohmann::json &json_object, HTTPStatus &http_status, nlohmann::json &response);
@@ -0,0 +1,334 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <cstdlib>
+#include <string>
+
+module http_shard;
+
+import stl;
+import status;
+import third_party;
+import config;
+import infinity_context;
+import http_client;
+import merge_knn;
+import knn_result_handler;
+import internal_types;
+
+namespace infinity {
+
+namespace {
+
+struct ShardRequest {
+    SizeT shard_idx_{};
+    String method_{};
+    String path_{};
+    String body_{};
+};
+
+struct ShardResponse {
+    Status status_{};
+    u32 status_code_{};
+    String body_{};
+};
+
+// The requests go out at once, each on its own connection with the shard timeout as its deadline.
+Vector<ShardResponse> SendToShards(const Vector<ShardRequest> &requests) {
+    const Config *config = InfinityContext::instance().config();
+    Vector<ShardResponse> responses(requests.size());
+    Vector<Thread> threads;
+    threads.reserve(requests.size());
+    for (SizeT i = 0; i < requests.size(); ++i) {
+        threads.emplace_back([&, i] {
+            const ShardRequest &request = requests[i];
+            ShardResponse &response = responses[i];
+            HttpClient client(config->shard_addresses()[request.shard_idx_]);
+            response.status_ =
+                client.Send(request.method_, request.path_, request.body_, config->shard_timeout_ms(), response.status_code_, response.body_);
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    return responses;
+}
+
+// The first failed response as the response of the coordinator, returns false if there is one.
+bool CheckShardResponses(const Vector<ShardRequest> &requests, const Vector<ShardResponse> &responses, String &response_body) {
+    const Config *config = InfinityContext::instance().config();
+    for (SizeT i = 0; i < responses.size(); ++i) {
+        const String &address = config->shard_addresses()[requests[i].shard_idx_];
+        if (!responses[i].status_.ok()) {
+            nlohmann::json response;
+            response["error_code"] = responses[i].status_.code();
+            response["error_message"] = fmt::format("Shard {}: {}", address, responses[i].status_.message());
+            response_body = response.dump();
+            return false;
+        }
+        if (responses[i].status_code_ != 200) {
+            nlohmann::json response = nlohmann::json::parse(responses[i].body_, nullptr, false);
+            if (response.is_discarded() || !response.is_object()) {
+                response = nlohmann::json::object();
+                response["error_code"] = ErrorCode::kUnexpectedError;
+                response["error_message"] = responses[i].body_;
+            }
+            response["error_message"] = fmt::format("Shard {}: {}", address, response.value("error_message", String()));
+            response_body = response.dump();
+            return false;
+        }
+    }
+    return true;
+}
+
+bool CheckShards(HTTPStatus &http_status, String &response_body) {
+    if (!InfinityContext::instance().config()->shard_addresses().empty()) {
+        return true;
+    }
+    Status status = Status::NotSupport("A sharded request to a node without shards");
+    nlohmann::json response;
+    response["error_code"] = status.code();
+    response["error_message"] = status.message();
+    response_body = response.dump();
+    http_status = HTTPStatus::CODE_500;
+    return false;
+}
+
+// The top rows of all shards, the id of a row is the shard as the segment and the index in the results of the shard as the offset.
+template <template <typename, typename> typename C>
+Vector<RowID> MergeTopRows(const Vector<Vector<f32>> &shard_scores, SizeT topk) {
+    MergeKnn<f32, C> merge_knn(1, topk);
+    merge_knn.Begin();
+    for (SizeT shard_idx = 0; shard_idx < shard_scores.size(); ++shard_idx) {
+        const Vector<f32> &scores = shard_scores[shard_idx];
+        Vector<RowID> row_ids;
+        row_ids.reserve(scores.size());
+        for (SizeT i = 0; i < scores.size(); ++i) {
+            row_ids.emplace_back(shard_idx, i);
+        }
+        merge_knn.Search(0, scores.data(), row_ids.data(), scores.size());
+    }
+    merge_knn.End();
+    const RowID *ids = merge_knn.GetIDsByIdx(0);
+    return Vector<RowID>(ids, ids + merge_knn.ResultCount(0));
+}
+
+} // namespace
+
+SizeT HTTPShard::ShardOf(const nlohmann::json &key_value, SizeT shard_count) {
+    // FNV-1a of the json text of the key, the same on every coordinator
+    String key_str = key_value.dump();
+    u64 hash = 14695981039346656037ULL;
+    for (unsigned char c : key_str) {
+        hash ^= c;
+        hash *= 1099511628211ULL;
+    }
+    return hash % shard_count;
+}
+
+void HTTPShard::Insert(const String &db_name, const String &table_name, const String &input_json, HTTPStatus &http_status, String &response_body) {
+    if (!CheckShards(http_status, response_body)) {
+        return;
+    }
+    http_status = HTTPStatus::CODE_500;
+    nlohmann::json response;
+    const Config *config = InfinityContext::instance().config();
+    nlohmann::json rows = nlohmann::json::parse(input_json, nullptr, false);
+    if (rows.is_discarded() || !rows.is_array() || rows.empty()) {
+        response["error_code"] = ErrorCode::kInvalidJsonFormat;
+        response["error_message"] = "HTTP Body should be a json array of the rows";
+        response_body = response.dump();
+        return;
+    }
+
+    SizeT shard_count = config->shard_addresses().size();
+    Vector<nlohmann::json> shard_rows(shard_count, nlohmann::json::array());
+    for (auto &row : rows) {
+        if (!row.is_object() || !row.contains(config->shard_key())) {
+            response["error_code"] = ErrorCode::kInvalidJsonFormat;
+            response["error_message"] = fmt::format("Each row should have the shard key {}", config->shard_key());
+            response_body = response.dump();
+            return;
+        }
+        shard_rows[ShardOf(row[config->shard_key()], shard_count)].push_back(std::move(row));
+    }
+
+    Vector<ShardRequest> requests;
+    for (SizeT shard_idx = 0; shard_idx < shard_count; ++shard_idx) {
+        if (!shard_rows[shard_idx].empty()) {
+            requests.push_back({shard_idx, "POST", fmt::format("/databases/{}/tables/{}/docs", db_name, table_name), shard_rows[shard_idx].dump()});
+        }
+    }
+    Vector<ShardResponse> responses = SendToShards(requests);
+    if (!CheckShardResponses(requests, responses, response_body)) {
+        return;
+    }
+    response["error_code"] = 0;
+    response_body = response.dump();
+    http_status = HTTPStatus::CODE_200;
+}
+
+void HTTPShard::Search(const String &db_name, const String &table_name, const String &input_json, HTTPStatus &http_status, String &response_body) {
+    if (!CheckShards(http_status, response_body)) {
+        return;
+    }
+    http_status = HTTPStatus::CODE_500;
+    nlohmann::json response;
+    const Config *config = InfinityContext::instance().config();
+    nlohmann::json input = nlohmann::json::parse(input_json, nullptr, false);
+    if (input.is_discarded() || !input.is_object()) {
+        response["error_code"] = ErrorCode::kInvalidJsonFormat;
+        response["error_message"] = "HTTP Body isn't json object";
+        response_body = response.dump();
+        return;
+    }
+
+    // The rows are merged by the distance of a knn, or by the score of a match or a fusion. Either is added to the output if
+    // it isn't there, and removed from the merged rows.
+    String order_expr;
+    bool lower_is_better = false;
+    String output_key;
+    for (const auto &elem : input.items()) {
+        String key = elem.key();
+        ToLower(key);
+        if (IsEqual(key, "knn")) {
+            order_expr = "distance()";
+            for (const auto &knn_elem : elem.value().items()) {
+                String knn_key = knn_elem.key();
+                ToLower(knn_key);
+                if (IsEqual(knn_key, "metric_type") && knn_elem.value().is_string()) {
+                    String metric_type = knn_elem.value();
+                    ToLower(metric_type);
+                    lower_is_better = IsEqual(metric_type, "l2") || IsEqual(metric_type, "hamming");
+                }
+            }
+        } else if (IsEqual(key, "match") || IsEqual(key, "fusion")) {
+            order_expr = "score()";
+        } else if (IsEqual(key, "output")) {
+            output_key = elem.key();
+        }
+    }
+    if (output_key.empty() || !input[output_key].is_array()) {
+        response["error_code"] = ErrorCode::kInvalidExpression;
+        response["error_message"] = "Output field should be array";
+        response_body = response.dump();
+        return;
+    }
+    bool order_added = false;
+    if (!order_expr.empty()) {
+        order_added = true;
+        for (const auto &output_expr : input[output_key]) {
+            String output_str = output_expr.is_string() ? output_expr.get<String>() : "";
+            ToLower(output_str);
+            order_added = order_added && !IsEqual(output_str, order_expr);
+        }
+        if (order_added) {
+            input[output_key].push_back(order_expr);
+        }
+    }
+
+    String shard_body = input.dump();
+    Vector<ShardRequest> requests;
+    for (SizeT shard_idx = 0; shard_idx < config->shard_addresses().size(); ++shard_idx) {
+        requests.push_back({shard_idx, "GET", fmt::format("/databases/{}/tables/{}/docs", db_name, table_name), shard_body});
+    }
+    Vector<ShardResponse> responses = SendToShards(requests);
+    if (!CheckShardResponses(requests, responses, response_body)) {
+        return;
+    }
+
+    // Each shard returns at most the top n rows of the search, so do the merged rows
+    Vector<nlohmann::json> shard_rows(responses.size());
+    for (SizeT shard_idx = 0; shard_idx < responses.size(); ++shard_idx) {
+        nlohmann::json shard_response = nlohmann::json::parse(responses[shard_idx].body_, nullptr, false);
+        if (shard_response.is_discarded() || !shard_response.contains("output") || !shard_response["output"].is_array()) {
+            response["error_code"] = ErrorCode::kUnexpectedError;
+            response["error_message"] = fmt::format("Invalid search result of shard {}", config->shard_addresses()[shard_idx]);
+            response_body = response.dump();
+            return;
+        }
+        shard_rows[shard_idx] = std::move(shard_response["output"]);
+    }
+
+    nlohmann::json output = nlohmann::json::array();
+    if (order_expr.empty()) {
+        for (auto &rows : shard_rows) {
+            for (auto &row : rows) {
+                output.push_back(std::move(row));
+            }
+        }
+    } else {
+        SizeT topk = 0;
+        Vector<Vector<f32>> shard_scores(shard_rows.size());
+        Vector<Vector<String>> shard_order_keys(shard_rows.size());
+        for (SizeT shard_idx = 0; shard_idx < shard_rows.size(); ++shard_idx) {
+            topk = std::max(topk, shard_rows[shard_idx].size());
+            for (const auto &row : shard_rows[shard_idx]) {
+                // The column of the order, its name is the expression in whatever case
+                String order_key;
+                for (const auto &row_elem : row.items()) {
+                    String key = row_elem.key();
+                    ToLower(key);
+                    if (IsEqual(key, order_expr) || IsEqual(key + "()", order_expr)) {
+                        order_key = row_elem.key();
+                    }
+                }
+                const auto &score_json = order_key.empty() ? nlohmann::json() : row[order_key];
+                f32 score = score_json.is_string() ? std::strtof(score_json.get<String>().c_str(), nullptr)
+                                                   : score_json.is_number() ? score_json.get<f32>() : 0;
+                shard_scores[shard_idx].push_back(score);
+                shard_order_keys[shard_idx].push_back(std::move(order_key));
+            }
+        }
+        Vector<RowID> merged_ids;
+        if (topk > 0) {
+            merged_ids = lower_is_better ? MergeTopRows<CompareMax>(shard_scores, topk) : MergeTopRows<CompareMin>(shard_scores, topk);
+        }
+        for (const RowID &row_id : merged_ids) {
+            nlohmann::json &row = shard_rows[row_id.segment_id_][row_id.segment_offset_];
+            const String &order_key = shard_order_keys[row_id.segment_id_][row_id.segment_offset_];
+            if (order_added && !order_key.empty()) {
+                row.erase(order_key);
+            }
+            output.push_back(std::move(row));
+        }
+    }
+    response["error_code"] = 0;
+    response["output"] = std::move(output);
+    response_body = response.dump();
+    http_status = HTTPStatus::CODE_200;
+}
+
+void HTTPShard::Broadcast(const String &method, const String &path, const String &body, HTTPStatus &http_status, String &response_body) {
+    if (!CheckShards(http_status, response_body)) {
+        return;
+    }
+    http_status = HTTPStatus::CODE_500;
+    Vector<ShardRequest> requests;
+    for (SizeT shard_idx = 0; shard_idx < InfinityContext::instance().config()->shard_addresses().size(); ++shard_idx) {
+        requests.push_back({shard_idx, method, path, body});
+    }
+    Vector<ShardResponse> responses = SendToShards(requests);
+    if (!CheckShardResponses(requests, responses, response_body)) {
+        return;
+    }
+    nlohmann::json response;
+    response["error_code"] = 0;
+    response_body = response.dump();
+    http_status = HTTPStatus::CODE_200;
+}
+
+} // namespace infinity
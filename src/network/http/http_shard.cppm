@@ -0,0 +1,42 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module http_shard;
+
+import stl;
+import status;
+import third_party;
+
+namespace infinity {
+
+// The http api of a coordinator under /sharded. The rows of a table are spread over the shards by the hash of the shard key, a
+// search runs on all shards at once and their top rows are merged.
+export class HTTPShard {
+public:
+    // The body is the rows as for an insert into one node
+    static void Insert(const String &db_name, const String &table_name, const String &input_json, HTTPStatus &http_status, String &response_body);
+
+    // The body is the search as for one node. A knn, match or fusion search is merged by its distance or score.
+    static void Search(const String &db_name, const String &table_name, const String &input_json, HTTPStatus &http_status, String &response_body);
+
+    // Sends the request to all shards, e.g. to create a table or an index, or to delete or update rows
+    static void Broadcast(const String &method, const String &path, const String &body, HTTPStatus &http_status, String &response_body);
+
+    // The shard of a row by its shard key
+    static SizeT ShardOf(const nlohmann::json &key_value, SizeT shard_count);
+};
+
+} // namespace infinity
@@ -0,0 +1,151 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <boost/asio/connect.hpp>
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/read.hpp>
+#include <boost/asio/steady_timer.hpp>
+#include <boost/asio/write.hpp>
+#include <cctype>
+#include <cstdlib>
+#include <functional>
+
+module http_client;
+
+import stl;
+import status;
+import third_party;
+
+namespace infinity {
+
+HttpClient::HttpClient(String address) {
+    SizeT colon = address.rfind(':');
+    if (colon == String::npos) {
+        host_ = std::move(address);
+        port_ = "80";
+    } else {
+        host_ = address.substr(0, colon);
+        port_ = address.substr(colon + 1);
+    }
+}
+
+Status HttpClient::Send(const String &method, const String &path, const String &body, u64 timeout_ms, u32 &status_code, String &response) {
+    boost::asio::io_service io_service;
+    boost::asio::ip::tcp::resolver resolver(io_service);
+    boost::asio::ip::tcp::socket socket(io_service);
+    boost::system::error_code error;
+
+    auto endpoints = resolver.resolve(host_, port_, error);
+    if (error) {
+        return Status::IOError(fmt::format("Can't resolve {}:{}, {}", host_, port_, error.message()));
+    }
+
+    String request = fmt::format("{} {} HTTP/1.1\r\n"
+                                 "Host: {}:{}\r\n"
+                                 "Accept: */*\r\n"
+                                 "Content-Type: application/json\r\n"
+                                 "Content-Length: {}\r\n"
+                                 "Connection: close\r\n\r\n",
+                                 method,
+                                 path,
+                                 host_,
+                                 port_,
+                                 body.size());
+    request += body;
+
+    // Connect, write and read as one chain of async operations, the timer closes the socket at the deadline to end it.
+    bool timed_out = false;
+    boost::asio::steady_timer timer(io_service);
+    if (timeout_ms > 0) {
+        timer.expires_after(std::chrono::milliseconds(timeout_ms));
+        timer.async_wait([&](const boost::system::error_code &timer_error) {
+            if (!timer_error) {
+                timed_out = true;
+                socket.close();
+            }
+        });
+    }
+    // The server closes the connection after the response.
+    String raw_response;
+    char buffer[64 * 1024];
+    std::function<void(const boost::system::error_code &, SizeT)> on_read = [&](const boost::system::error_code &read_error, SizeT read_size) {
+        raw_response.append(buffer, read_size);
+        if (read_error) {
+            error = read_error == boost::asio::error::eof ? boost::system::error_code() : read_error;
+            timer.cancel();
+            return;
+        }
+        socket.async_read_some(boost::asio::buffer(buffer), on_read);
+    };
+    boost::asio::async_connect(socket, endpoints, [&](const boost::system::error_code &connect_error, const boost::asio::ip::tcp::endpoint &) {
+        if (connect_error) {
+            error = connect_error;
+            timer.cancel();
+            return;
+        }
+        boost::asio::async_write(socket, boost::asio::buffer(request), [&](const boost::system::error_code &write_error, SizeT) {
+            if (write_error) {
+                error = write_error;
+                timer.cancel();
+                return;
+            }
+            socket.async_read_some(boost::asio::buffer(buffer), on_read);
+        });
+    });
+    io_service.run();
+
+    if (timed_out) {
+        return Status::IOError(fmt::format("{} {} of {}:{} timed out after {}ms", method, path, host_, port_, timeout_ms));
+    }
+    if (error) {
+        return Status::IOError(fmt::format("{} {} of {}:{} failed, {}", method, path, host_, port_, error.message()));
+    }
+
+    SizeT header_end = raw_response.find("\r\n\r\n");
+    SizeT status_begin = raw_response.find(' ');
+    if (header_end == String::npos || status_begin == String::npos || status_begin > header_end) {
+        return Status::IOError(fmt::format("Invalid http response of {}", path));
+    }
+    status_code = std::strtoul(raw_response.c_str() + status_begin + 1, nullptr, 10);
+
+    String headers = raw_response.substr(0, header_end);
+    std::transform(headers.begin(), headers.end(), headers.begin(), [](unsigned char c) { return std::tolower(c); });
+    response = raw_response.substr(header_end + 4);
+    if (headers.find("transfer-encoding: chunked") != String::npos) {
+        // Each chunk is the size in hex, the data, then a CRLF, a chunk of size 0 is the end.
+        String chunked = std::move(response);
+        response.clear();
+        SizeT pos = 0;
+        while (true) {
+            SizeT line_end = chunked.find("\r\n", pos);
+            if (line_end == String::npos) {
+                return Status::IOError(fmt::format("Invalid chunked http response of {}", path));
+            }
+            SizeT chunk_size = std::strtoul(chunked.c_str() + pos, nullptr, 16);
+            if (chunk_size == 0) {
+                break;
+            }
+            if (line_end + 2 + chunk_size > chunked.size()) {
+                return Status::IOError(fmt::format("Truncated http response of {}", path));
+            }
+            response.append(chunked, line_end + 2, chunk_size);
+            pos = line_end + 2 + chunk_size + 2;
+        }
+    }
+    return Status::OK();
+}
+
+} // namespace infinity
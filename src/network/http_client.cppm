@@ -0,0 +1,46 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module http_client;
+
+import stl;
+import status;
+
+namespace infinity {
+
+// A blocking client for the requests of a node to the http server of another, a follower to its leader or a coordinator to its
+// shards. One connection per request.
+export class HttpClient {
+public:
+    // address is "<host>:<port>" of the http server
+    explicit HttpClient(String address);
+
+    // Sends the body as json, the response body is returned in response whatever the status code is. The request fails once
+    // it takes longer than timeout_ms, 0 for no deadline.
+    Status Send(const String &method, const String &path, const String &body, u64 timeout_ms, u32 &status_code, String &response);
+
+    Status Get(const String &path, const String &body, u32 &status_code, String &response) {
+        return Send("GET", path, body, 0, status_code, response);
+    }
+
+    const String &host() const { return host_; }
+
+private:
+    String host_{};
+    String port_{};
+};
+
+} // namespace infinity
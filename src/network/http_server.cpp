@@ -45,6 +45,23 @@ import statement_common;
 import extra_ddl_info;
 import update_statement;
 import http_search;
+import http_shard;
+import engine_metrics;
+import task_scheduler;
+import storage;
+import buffer_manager;
+import buffer_obj;
+import session_manager;
+import query_progress;
+import index_build_progress;
+import io_stats;
+import trace_span;
+import physical_operator_type;
+import options;
+import config;
+import wal_manager;
+import replication_source;
+import replica_manager;
 
 namespace {
 
@@ -1124,12 +1141,74 @@ public:
         auto table_name = request->getPathVariable("table_name");
         String data_body = request->readBodyToString();
 
-        nlohmann::json json_response;
+        String response_body;
         HTTPStatus http_status;
 
-        HTTPSearch::Process(infinity.get(), database_name, table_name, data_body, http_status, json_response);
+        HTTPSearch::Process(infinity.get(), database_name, table_name, data_body, http_status, response_body);
 
-        return ResponseFactory::createResponse(http_status, json_response.dump());
+        return ResponseFactory::createResponse(http_status, std::move(response_body));
+    }
+};
+
+class BatchSearchHandler final : public HttpRequestHandler {
+public:
+    SharedPtr<OutgoingResponse> handle(const SharedPtr<IncomingRequest> &request) final {
+        auto infinity = Infinity::RemoteConnect();
+        DeferFn defer_fn([&]() { infinity->RemoteDisconnect(); });
+
+        auto database_name = request->getPathVariable("database_name");
+        auto table_name = request->getPathVariable("table_name");
+        String data_body = request->readBodyToString();
+
+        String response_body;
+        HTTPStatus http_status;
+
+        HTTPSearch::ProcessBatch(infinity.get(), database_name, table_name, data_body, http_status, response_body);
+
+        return ResponseFactory::createResponse(http_status, std::move(response_body));
+    }
+};
+
+// The api of a coordinator, the same as of a node under /sharded
+class ShardedInsertHandler final : public HttpRequestHandler {
+public:
+    SharedPtr<OutgoingResponse> handle(const SharedPtr<IncomingRequest> &request) final {
+        auto database_name = request->getPathVariable("database_name");
+        auto table_name = request->getPathVariable("table_name");
+        String data_body = request->readBodyToString();
+
+        String response_body;
+        HTTPStatus http_status;
+        HTTPShard::Insert(database_name, table_name, data_body, http_status, response_body);
+        return ResponseFactory::createResponse(http_status, std::move(response_body));
+    }
+};
+
+class ShardedSearchHandler final : public HttpRequestHandler {
+public:
+    SharedPtr<OutgoingResponse> handle(const SharedPtr<IncomingRequest> &request) final {
+        auto database_name = request->getPathVariable("database_name");
+        auto table_name = request->getPathVariable("table_name");
+        String data_body = request->readBodyToString();
+
+        String response_body;
+        HTTPStatus http_status;
+        HTTPShard::Search(database_name, table_name, data_body, http_status, response_body);
+        return ResponseFactory::createResponse(http_status, std::move(response_body));
+    }
+};
+
+class ShardedBroadcastHandler final : public HttpRequestHandler {
+public:
+    SharedPtr<OutgoingResponse> handle(const SharedPtr<IncomingRequest> &request) final {
+        String method = request->getStartingLine().method.toString();
+        String path = "/" + request->getPathTail();
+        String data_body = request->readBodyToString();
+
+        String response_body;
+        HTTPStatus http_status;
+        HTTPShard::Broadcast(method, path, data_body, http_status, response_body);
+        return ResponseFactory::createResponse(http_status, std::move(response_body));
     }
 };
 
@@ -1221,6 +1300,239 @@ public:
     }
 };
 
+// The metrics in the Prometheus text format. The gauges are read from the scheduler, the buffer manager and the index builds at the scrape.
+class MetricsHandler final : public HttpRequestHandler {
+public:
+    SharedPtr<OutgoingResponse> handle(const SharedPtr<IncomingRequest> &request) final {
+        MetricsWriter writer;
+
+        TaskScheduler *task_scheduler = InfinityContext::instance().task_scheduler();
+        u64 worker_count = task_scheduler->WorkerCount();
+        writer.WriteHeader("infinity_worker_queue_depth", "gauge", "Queued and running tasks of a worker.");
+        for (u64 worker_id = 0; worker_id < worker_count; ++worker_id) {
+            writer.WriteSample("infinity_worker_queue_depth", fmt::format("worker=\"{}\"", worker_id), task_scheduler->WorkerQueueDepth(worker_id));
+        }
+        writer.WriteHeader("infinity_worker_busy_seconds_total", "counter", "Time a worker spent in running tasks.");
+        for (u64 worker_id = 0; worker_id < worker_count; ++worker_id) {
+            writer.WriteSample("infinity_worker_busy_seconds_total",
+                               fmt::format("worker=\"{}\"", worker_id),
+                               task_scheduler->WorkerBusyTime(worker_id) * 1e-9);
+        }
+
+        BufferManager *buffer_manager = InfinityContext::instance().storage()->buffer_manager();
+        Vector<u64> memory_usage = buffer_manager->MemoryUsageByType();
+        writer.WriteHeader("infinity_buffer_memory_bytes", "gauge", "Memory of the buffers in memory by buffer type.");
+        writer.WriteSample("infinity_buffer_memory_bytes", "type=\"persistent\"", memory_usage[static_cast<SizeT>(BufferType::kPersistent)]);
+        writer.WriteSample("infinity_buffer_memory_bytes", "type=\"ephemeral\"", memory_usage[static_cast<SizeT>(BufferType::kEphemeral)]);
+        writer.WriteSample("infinity_buffer_memory_bytes", "type=\"temp\"", memory_usage[static_cast<SizeT>(BufferType::kTemp)]);
+        writer.WriteHeader("infinity_buffer_memory_limit_bytes", "gauge", "Memory limit of the buffer manager.");
+        writer.WriteSample("infinity_buffer_memory_limit_bytes", "", buffer_manager->memory_limit());
+
+        Vector<IndexBuildProgressInfo> index_builds = IndexBuildRegistry::instance().Builds();
+        writer.WriteHeader("infinity_index_build_rows", "gauge", "Rows done and in total of the CREATE INDEX and OPTIMIZE in progress.");
+        for (const IndexBuildProgressInfo &build : index_builds) {
+            String labels = fmt::format("db=\"{}\",table=\"{}\",index=\"{}\",phase=\"{}\"",
+                                        build.db_name_,
+                                        build.table_name_,
+                                        build.index_name_,
+                                        IndexBuildPhaseToString(build.phase_));
+            writer.WriteSample("infinity_index_build_rows", labels + ",state=\"done\"", build.rows_done_);
+            writer.WriteSample("infinity_index_build_rows", labels + ",state=\"total\"", build.rows_total_);
+        }
+        writer.WriteHeader("infinity_index_build_rows_per_second", "gauge", "Build rate of the CREATE INDEX and OPTIMIZE in progress.");
+        for (const IndexBuildProgressInfo &build : index_builds) {
+            String labels = fmt::format("db=\"{}\",table=\"{}\",index=\"{}\"", build.db_name_, build.table_name_, build.index_name_);
+            writer.WriteSample("infinity_index_build_rows_per_second", labels, build.rows_per_second_);
+        }
+
+        EngineMetrics::instance().Write(writer);
+        IOStatsRegistry::instance().Write(writer);
+
+        auto response = ResponseFactory::createResponse(HTTPStatus::CODE_200, writer.text());
+        response->putHeader("Content-Type", "text/plain; version=0.0.4");
+        return response;
+    }
+};
+
+// The running queries of all sessions, as SHOW QUERIES
+class ListQueriesHandler final : public HttpRequestHandler {
+public:
+    SharedPtr<OutgoingResponse> handle(const SharedPtr<IncomingRequest> &request) final {
+        Vector<QueryProgressInfo> queries = InfinityContext::instance().session_manager()->RunningQueries();
+
+        nlohmann::json json_response;
+        json_response["error_code"] = 0;
+        json_response["queries"] = nlohmann::json::array();
+        for (const QueryProgressInfo &query : queries) {
+            nlohmann::json json_query;
+            json_query["query_id"] = query.query_id_;
+            json_query["session_id"] = query.session_id_;
+            json_query["elapsed_ms"] = query.elapsed_ns_ / 1'000'000;
+            json_query["fragments_done"] = query.fragments_done_;
+            json_query["fragments_total"] = query.fragments_total_;
+            json_query["tasks_done"] = query.tasks_done_;
+            json_query["tasks_total"] = query.tasks_total_;
+            json_query["rows_scanned"] = query.rows_scanned_;
+            json_query["memory_bytes"] = query.memory_bytes_;
+            json_query["operator"] =
+                query.current_operator_ == PhysicalOperatorType::kInvalid ? String() : PhysicalOperatorToString(query.current_operator_);
+            json_query["query"] = query.query_text_;
+            json_response["queries"].push_back(std::move(json_query));
+        }
+        return ResponseFactory::createResponse(HTTPStatus::CODE_200, json_response.dump());
+    }
+};
+
+class KillQueryHandler final : public HttpRequestHandler {
+public:
+    SharedPtr<OutgoingResponse> handle(const SharedPtr<IncomingRequest> &request) final {
+        String query_id_str = request->getPathVariable("query_id");
+
+        nlohmann::json json_response;
+        HTTPStatus http_status;
+        u64 query_id = 0;
+        auto [ptr, ec] = std::from_chars(query_id_str.data(), query_id_str.data() + query_id_str.size(), query_id);
+        Status status;
+        if (ec != std::errc() || ptr != query_id_str.data() + query_id_str.size()) {
+            status = Status::InvalidParameterValue("query_id", query_id_str, "a query id of SHOW QUERIES");
+        } else if (!InfinityContext::instance().session_manager()->CancelQuery(query_id)) {
+            status = Status::QueryNotFound(query_id);
+        }
+        if (status.ok()) {
+            json_response["error_code"] = 0;
+            http_status = HTTPStatus::CODE_200;
+        } else {
+            json_response["error_code"] = status.code();
+            json_response["error_message"] = status.message();
+            http_status = HTTPStatus::CODE_500;
+        }
+        return ResponseFactory::createResponse(http_status, json_response.dump());
+    }
+};
+
+// Trace spans, GET returns the spans since POST in the Chrome trace event format for chrome://tracing or the Perfetto UI
+class StartTraceHandler final : public HttpRequestHandler {
+public:
+    SharedPtr<OutgoingResponse> handle(const SharedPtr<IncomingRequest> &request) final {
+        TraceRecorder::Start();
+        nlohmann::json json_response;
+        json_response["error_code"] = 0;
+        return ResponseFactory::createResponse(HTTPStatus::CODE_200, json_response.dump());
+    }
+};
+
+class StopTraceHandler final : public HttpRequestHandler {
+public:
+    SharedPtr<OutgoingResponse> handle(const SharedPtr<IncomingRequest> &request) final {
+        TraceRecorder::Stop();
+        nlohmann::json json_response;
+        json_response["error_code"] = 0;
+        return ResponseFactory::createResponse(HTTPStatus::CODE_200, json_response.dump());
+    }
+};
+
+class DumpTraceHandler final : public HttpRequestHandler {
+public:
+    SharedPtr<OutgoingResponse> handle(const SharedPtr<IncomingRequest> &request) final {
+        auto response = ResponseFactory::createResponse(HTTPStatus::CODE_200, TraceRecorder::DumpChromeTrace());
+        response->putHeader("Content-Type", "application/json");
+        return response;
+    }
+};
+
+// Replication, a follower copies the files of its leader at a checkpoint and then tails the wal of the leader
+SharedPtr<OutgoingResponse> ReplicationErrorResponse(HTTPStatus http_status, const Status &status) {
+    nlohmann::json json_response;
+    json_response["error_code"] = status.code();
+    json_response["error_message"] = status.message();
+    return ResponseFactory::createResponse(http_status, json_response.dump());
+}
+
+ReplicationSource *GetReplicationSource() { return InfinityContext::instance().storage()->replication_source(); }
+
+class ReplicationManifestHandler final : public HttpRequestHandler {
+public:
+    SharedPtr<OutgoingResponse> handle(const SharedPtr<IncomingRequest> &request) final {
+        ReplicationSource *replication_source = GetReplicationSource();
+        if (replication_source == nullptr) {
+            return ReplicationErrorResponse(HTTPStatus::CODE_403, Status::NotSupport("Replication from a node that isn't a leader"));
+        }
+        String body_info = request->readBodyToString();
+        nlohmann::json body_json = nlohmann::json::parse(body_info.empty() ? "{}" : body_info, nullptr, false);
+        if (body_json.is_discarded()) {
+            return ReplicationErrorResponse(HTTPStatus::CODE_400, Status::InvalidJsonFormat(body_info));
+        }
+        nlohmann::json manifest;
+        Status status = body_json.contains("dir") ? replication_source->ListDir(body_json["dir"], manifest)
+                                                  : replication_source->Manifest(manifest);
+        if (!status.ok()) {
+            return ReplicationErrorResponse(HTTPStatus::CODE_500, status);
+        }
+        return ResponseFactory::createResponse(HTTPStatus::CODE_200, manifest.dump());
+    }
+};
+
+class ReplicationFileHandler final : public HttpRequestHandler {
+public:
+    SharedPtr<OutgoingResponse> handle(const SharedPtr<IncomingRequest> &request) final {
+        ReplicationSource *replication_source = GetReplicationSource();
+        if (replication_source == nullptr) {
+            return ReplicationErrorResponse(HTTPStatus::CODE_403, Status::NotSupport("Replication from a node that isn't a leader"));
+        }
+        String body_info = request->readBodyToString();
+        nlohmann::json body_json = nlohmann::json::parse(body_info, nullptr, false);
+        if (body_json.is_discarded() || !body_json.contains("path") || !body_json.contains("offset") || !body_json.contains("length")) {
+            return ReplicationErrorResponse(HTTPStatus::CODE_400, Status::InvalidJsonFormat(body_info));
+        }
+        String data;
+        Status status = replication_source->ReadFile(body_json["path"], body_json["offset"], body_json["length"], data);
+        if (!status.ok()) {
+            return ReplicationErrorResponse(HTTPStatus::CODE_500, status);
+        }
+        auto response = ResponseFactory::createResponse(HTTPStatus::CODE_200, data);
+        response->putHeader("Content-Type", "application/octet-stream");
+        return response;
+    }
+};
+
+class ReplicationWalHandler final : public HttpRequestHandler {
+public:
+    SharedPtr<OutgoingResponse> handle(const SharedPtr<IncomingRequest> &request) final {
+        ReplicationSource *replication_source = GetReplicationSource();
+        if (replication_source == nullptr) {
+            return ReplicationErrorResponse(HTTPStatus::CODE_403, Status::NotSupport("Replication from a node that isn't a leader"));
+        }
+        String body_info = request->readBodyToString();
+        nlohmann::json body_json = nlohmann::json::parse(body_info, nullptr, false);
+        if (body_json.is_discarded() || !body_json.contains("from_ts") || !body_json.contains("max_bytes")) {
+            return ReplicationErrorResponse(HTTPStatus::CODE_400, Status::InvalidJsonFormat(body_info));
+        }
+        String data;
+        if (!replication_source->ReadWal(body_json["from_ts"], body_json["max_bytes"], data)) {
+            return ReplicationErrorResponse(HTTPStatus::CODE_410, Status::UnexpectedError("The wal from the ts is recycled"));
+        }
+        auto response = ResponseFactory::createResponse(HTTPStatus::CODE_200, data);
+        response->putHeader("Content-Type", "application/octet-stream");
+        return response;
+    }
+};
+
+class ReplicationStatusHandler final : public HttpRequestHandler {
+public:
+    SharedPtr<OutgoingResponse> handle(const SharedPtr<IncomingRequest> &request) final {
+        Storage *storage = InfinityContext::instance().storage();
+        nlohmann::json json_response;
+        json_response["error_code"] = 0;
+        json_response["role"] = ReplicationRoleToString(InfinityContext::instance().config()->replication_role());
+        if (ReplicaManager *replica_mgr = storage->replica_manager(); replica_mgr != nullptr) {
+            json_response.update(replica_mgr->ToJson());
+        } else {
+            json_response["durable_ts"] = storage->wal_manager()->DurableCommitTS();
+        }
+        return ResponseFactory::createResponse(HTTPStatus::CODE_200, json_response.dump());
+    }
+};
+
 class ShowTableIndexDetailHandler final : public HttpRequestHandler {
 public:
     SharedPtr<OutgoingResponse> handle(const SharedPtr<IncomingRequest> &request) final {
@@ -1522,6 +1834,58 @@ public:
     }
 };
 
+// The connections are served on a fixed pool of workers rather than a thread of their own each, as the thrift and PG servers do.
+// A worker serves the requests of its connection as long as the client keeps it alive, the HTTP/1.1 default, so the requests of
+// a client don't pay for a new connection each. The connections beyond the pool wait for a free worker.
+class HTTPConnectionHandler final : public WebConnectionHandler, public HttpProcessor::TaskProcessingListener {
+public:
+    HTTPConnectionHandler(const SharedPtr<HttpRouter> &router, SizeT worker_count)
+        : components_(MakeShared<HttpProcessor::Components>(router)), worker_pool_(worker_count) {}
+
+    void handleConnection(const WebResourceHandle<WebIOStream> &connection, const SharedPtr<const ParameterMap> &) final {
+        if (stopped_) {
+            return;
+        }
+        connection.object->setOutputStreamIOMode(WebIOMode::BLOCKING);
+        connection.object->setInputStreamIOMode(WebIOMode::BLOCKING);
+        // The pool takes copyable tasks only
+        auto task = MakeShared<HttpProcessor::Task>(components_, connection, this);
+        worker_pool_.push([task = std::move(task)](int) { task->run(); });
+    }
+
+    void stop() final {
+        {
+            std::unique_lock lock(mutex_);
+            stopped_ = true;
+            for (auto &[_, connection] : connections_) {
+                connection.invalidator->invalidate(connection.object);
+            }
+        }
+        // The waiting connections are invalidated as soon as their task starts
+        worker_pool_.stop(true);
+    }
+
+    void onTaskStart(const WebResourceHandle<WebIOStream> &connection) final {
+        std::unique_lock lock(mutex_);
+        connections_.emplace(connection.object.get(), connection);
+        if (stopped_) {
+            connection.invalidator->invalidate(connection.object);
+        }
+    }
+
+    void onTaskEnd(const WebResourceHandle<WebIOStream> &connection) final {
+        std::unique_lock lock(mutex_);
+        connections_.erase(connection.object.get());
+    }
+
+private:
+    SharedPtr<HttpProcessor::Components> components_{};
+    ThreadPool worker_pool_;
+    std::mutex mutex_{};
+    atomic_bool stopped_{false};
+    HashMap<WebIOStream *, WebResourceHandle<WebIOStream>> connections_{};
+};
+
 } // namespace
 
 namespace infinity {
@@ -1552,6 +1916,7 @@ void HTTPServer::Start(u16 port) {
 
     // DQL
     router->route("GET", "/databases/{database_name}/tables/{table_name}/docs", MakeShared<SelectHandler>());
+    router->route("POST", "/databases/{database_name}/tables/{table_name}/docs/search", MakeShared<BatchSearchHandler>());
 
     // index
     router->route("GET", "/databases/{database_name}/tables/{table_name}/indexes", MakeShared<ListTableIndexesHandler>());
@@ -1570,10 +1935,39 @@ void HTTPServer::Start(u16 port) {
     // variable
     router->route("GET", "/variables/{variable_name}", MakeShared<ShowVariableHandler>());
 
-    SharedPtr<HttpConnectionProvider> connection_provider = HttpConnectionProvider::createShared({"localhost", port, WebAddress::IP_4});
-    SharedPtr<HttpConnectionHandler> connection_handler = HttpConnectionHandler::createShared(router);
+    // metrics
+    router->route("GET", "/metrics", MakeShared<MetricsHandler>());
+
+    // running queries
+    router->route("GET", "/queries", MakeShared<ListQueriesHandler>());
+    router->route("DELETE", "/queries/{query_id}", MakeShared<KillQueryHandler>());
+
+    // trace spans
+    router->route("POST", "/trace", MakeShared<StartTraceHandler>());
+    router->route("DELETE", "/trace", MakeShared<StopTraceHandler>());
+    router->route("GET", "/trace", MakeShared<DumpTraceHandler>());
+
+    // sharding, the searches and inserts are spread over the shards, the other writes go to all of them
+    router->route("GET", "/sharded/databases/{database_name}/tables/{table_name}/docs", MakeShared<ShardedSearchHandler>());
+    router->route("POST", "/sharded/databases/{database_name}/tables/{table_name}/docs", MakeShared<ShardedInsertHandler>());
+    router->route("POST", "/sharded/*", MakeShared<ShardedBroadcastHandler>());
+    router->route("PUT", "/sharded/*", MakeShared<ShardedBroadcastHandler>());
+    router->route("DELETE", "/sharded/*", MakeShared<ShardedBroadcastHandler>());
+
+    // replication
+    router->route("GET", "/replication", MakeShared<ReplicationStatusHandler>());
+    router->route("GET", "/replication/manifest", MakeShared<ReplicationManifestHandler>());
+    router->route("GET", "/replication/file", MakeShared<ReplicationFileHandler>());
+    router->route("GET", "/replication/wal", MakeShared<ReplicationWalHandler>());
+
+    // On the listen address as the thrift and PG servers, the followers of a leader and the coordinator of a shard are on the
+    // other hosts
+    String http_host = InfinityContext::instance().config()->listen_address();
+    SharedPtr<HttpConnectionProvider> connection_provider = HttpConnectionProvider::createShared({http_host, port, WebAddress::IP_4});
+    // At most so many requests run at the same time, as for the thrift and PG servers
+    connection_handler_ = MakeShared<HTTPConnectionHandler>(router, InfinityContext::instance().config()->connection_limit());
 
-    server_ = MakeShared<WebServer>(connection_provider, connection_handler);
+    server_ = MakeShared<WebServer>(connection_provider, connection_handler_);
 
     fmt::print("HTTP server listen on port: {}\n", port);
 
@@ -1583,6 +1977,7 @@ void HTTPServer::Start(u16 port) {
 void HTTPServer::Shutdown() {
 
     server_->stop();
+    connection_handler_->stop();
     WebEnvironment::destroy();
 }
 
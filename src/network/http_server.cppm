@@ -27,6 +27,7 @@ public:
     void Shutdown();
 private:
     SharedPtr<HttpRouter> router_{};
+    SharedPtr<WebConnectionHandler> connection_handler_{};
     SharedPtr<WebServer> server_{};
 };
 
@@ -1484,11 +1484,11 @@ uint32_t InfinityService_Import_presult::read(::apache::thrift::protocol::TProto
 }
 
 
-InfinityService_Select_args::~InfinityService_Select_args() noexcept {
+InfinityService_InsertColumnar_args::~InfinityService_InsertColumnar_args() noexcept {
 }
 
 
-uint32_t InfinityService_Select_args::read(::apache::thrift::protocol::TProtocol* iprot) {
+uint32_t InfinityService_InsertColumnar_args::read(::apache::thrift::protocol::TProtocol* iprot) {
 
   ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
   uint32_t xfer = 0;
@@ -1529,10 +1529,10 @@ uint32_t InfinityService_Select_args::read(::apache::thrift::protocol::TProtocol
   return xfer;
 }
 
-uint32_t InfinityService_Select_args::write(::apache::thrift::protocol::TProtocol* oprot) const {
+uint32_t InfinityService_InsertColumnar_args::write(::apache::thrift::protocol::TProtocol* oprot) const {
   uint32_t xfer = 0;
   ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
-  xfer += oprot->writeStructBegin("InfinityService_Select_args");
+  xfer += oprot->writeStructBegin("InfinityService_InsertColumnar_args");
 
   xfer += oprot->writeFieldBegin("request", ::apache::thrift::protocol::T_STRUCT, 1);
   xfer += this->request.write(oprot);
@@ -1544,14 +1544,14 @@ uint32_t InfinityService_Select_args::write(::apache::thrift::protocol::TProtoco
 }
 
 
-InfinityService_Select_pargs::~InfinityService_Select_pargs() noexcept {
+InfinityService_InsertColumnar_pargs::~InfinityService_InsertColumnar_pargs() noexcept {
 }
 
 
-uint32_t InfinityService_Select_pargs::write(::apache::thrift::protocol::TProtocol* oprot) const {
+uint32_t InfinityService_InsertColumnar_pargs::write(::apache::thrift::protocol::TProtocol* oprot) const {
   uint32_t xfer = 0;
   ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
-  xfer += oprot->writeStructBegin("InfinityService_Select_pargs");
+  xfer += oprot->writeStructBegin("InfinityService_InsertColumnar_pargs");
 
   xfer += oprot->writeFieldBegin("request", ::apache::thrift::protocol::T_STRUCT, 1);
   xfer += (*(this->request)).write(oprot);
@@ -1563,11 +1563,11 @@ uint32_t InfinityService_Select_pargs::write(::apache::thrift::protocol::TProtoc
 }
 
 
-InfinityService_Select_result::~InfinityService_Select_result() noexcept {
+InfinityService_InsertColumnar_result::~InfinityService_InsertColumnar_result() noexcept {
 }
 
 
-uint32_t InfinityService_Select_result::read(::apache::thrift::protocol::TProtocol* iprot) {
+uint32_t InfinityService_InsertColumnar_result::read(::apache::thrift::protocol::TProtocol* iprot) {
 
   ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
   uint32_t xfer = 0;
@@ -1608,11 +1608,11 @@ uint32_t InfinityService_Select_result::read(::apache::thrift::protocol::TProtoc
   return xfer;
 }
 
-uint32_t InfinityService_Select_result::write(::apache::thrift::protocol::TProtocol* oprot) const {
+uint32_t InfinityService_InsertColumnar_result::write(::apache::thrift::protocol::TProtocol* oprot) const {
 
   uint32_t xfer = 0;
 
-  xfer += oprot->writeStructBegin("InfinityService_Select_result");
+  xfer += oprot->writeStructBegin("InfinityService_InsertColumnar_result");
 
   if (this->__isset.success) {
     xfer += oprot->writeFieldBegin("success", ::apache::thrift::protocol::T_STRUCT, 0);
@@ -1625,11 +1625,11 @@ uint32_t InfinityService_Select_result::write(::apache::thrift::protocol::TProto
 }
 
 
-InfinityService_Select_presult::~InfinityService_Select_presult() noexcept {
+InfinityService_InsertColumnar_presult::~InfinityService_InsertColumnar_presult() noexcept {
 }
 
 
-uint32_t InfinityService_Select_presult::read(::apache::thrift::protocol::TProtocol* iprot) {
+uint32_t InfinityService_InsertColumnar_presult::read(::apache::thrift::protocol::TProtocol* iprot) {
 
   ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
   uint32_t xfer = 0;
@@ -1671,11 +1671,11 @@ uint32_t InfinityService_Select_presult::read(::apache::thrift::protocol::TProto
 }
 
 
-InfinityService_Explain_args::~InfinityService_Explain_args() noexcept {
+InfinityService_Select_args::~InfinityService_Select_args() noexcept {
 }
 
 
-uint32_t InfinityService_Explain_args::read(::apache::thrift::protocol::TProtocol* iprot) {
+uint32_t InfinityService_Select_args::read(::apache::thrift::protocol::TProtocol* iprot) {
 
   ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
   uint32_t xfer = 0;
@@ -1716,10 +1716,10 @@ uint32_t InfinityService_Explain_args::read(::apache::thrift::protocol::TProtoco
   return xfer;
 }
 
-uint32_t InfinityService_Explain_args::write(::apache::thrift::protocol::TProtocol* oprot) const {
+uint32_t InfinityService_Select_args::write(::apache::thrift::protocol::TProtocol* oprot) const {
   uint32_t xfer = 0;
   ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
-  xfer += oprot->writeStructBegin("InfinityService_Explain_args");
+  xfer += oprot->writeStructBegin("InfinityService_Select_args");
 
   xfer += oprot->writeFieldBegin("request", ::apache::thrift::protocol::T_STRUCT, 1);
   xfer += this->request.write(oprot);
@@ -1731,14 +1731,14 @@ uint32_t InfinityService_Explain_args::write(::apache::thrift::protocol::TProtoc
 }
 
 
-InfinityService_Explain_pargs::~InfinityService_Explain_pargs() noexcept {
+InfinityService_Select_pargs::~InfinityService_Select_pargs() noexcept {
 }
 
 
-uint32_t InfinityService_Explain_pargs::write(::apache::thrift::protocol::TProtocol* oprot) const {
+uint32_t InfinityService_Select_pargs::write(::apache::thrift::protocol::TProtocol* oprot) const {
   uint32_t xfer = 0;
   ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
-  xfer += oprot->writeStructBegin("InfinityService_Explain_pargs");
+  xfer += oprot->writeStructBegin("InfinityService_Select_pargs");
 
   xfer += oprot->writeFieldBegin("request", ::apache::thrift::protocol::T_STRUCT, 1);
   xfer += (*(this->request)).write(oprot);
@@ -1750,11 +1750,11 @@ uint32_t InfinityService_Explain_pargs::write(::apache::thrift::protocol::TProto
 }
 
 
-InfinityService_Explain_result::~InfinityService_Explain_result() noexcept {
+InfinityService_Select_result::~InfinityService_Select_result() noexcept {
 }
 
 
-uint32_t InfinityService_Explain_result::read(::apache::thrift::protocol::TProtocol* iprot) {
+uint32_t InfinityService_Select_result::read(::apache::thrift::protocol::TProtocol* iprot) {
 
   ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
   uint32_t xfer = 0;
@@ -1795,11 +1795,11 @@ uint32_t InfinityService_Explain_result::read(::apache::thrift::protocol::TProto
   return xfer;
 }
 
-uint32_t InfinityService_Explain_result::write(::apache::thrift::protocol::TProtocol* oprot) const {
+uint32_t InfinityService_Select_result::write(::apache::thrift::protocol::TProtocol* oprot) const {
 
   uint32_t xfer = 0;
 
-  xfer += oprot->writeStructBegin("InfinityService_Explain_result");
+  xfer += oprot->writeStructBegin("InfinityService_Select_result");
 
   if (this->__isset.success) {
     xfer += oprot->writeFieldBegin("success", ::apache::thrift::protocol::T_STRUCT, 0);
@@ -1812,11 +1812,11 @@ uint32_t InfinityService_Explain_result::write(::apache::thrift::protocol::TProt
 }
 
 
-InfinityService_Explain_presult::~InfinityService_Explain_presult() noexcept {
+InfinityService_Select_presult::~InfinityService_Select_presult() noexcept {
 }
 
 
-uint32_t InfinityService_Explain_presult::read(::apache::thrift::protocol::TProtocol* iprot) {
+uint32_t InfinityService_Select_presult::read(::apache::thrift::protocol::TProtocol* iprot) {
 
   ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
   uint32_t xfer = 0;
@@ -1858,11 +1858,11 @@ uint32_t InfinityService_Explain_presult::read(::apache::thrift::protocol::TProt
 }
 
 
-InfinityService_Delete_args::~InfinityService_Delete_args() noexcept {
+InfinityService_BatchSelect_args::~InfinityService_BatchSelect_args() noexcept {
 }
 
 
-uint32_t InfinityService_Delete_args::read(::apache::thrift::protocol::TProtocol* iprot) {
+uint32_t InfinityService_BatchSelect_args::read(::apache::thrift::protocol::TProtocol* iprot) {
 
   ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
   uint32_t xfer = 0;
@@ -1903,10 +1903,10 @@ uint32_t InfinityService_Delete_args::read(::apache::thrift::protocol::TProtocol
   return xfer;
 }
 
-uint32_t InfinityService_Delete_args::write(::apache::thrift::protocol::TProtocol* oprot) const {
+uint32_t InfinityService_BatchSelect_args::write(::apache::thrift::protocol::TProtocol* oprot) const {
   uint32_t xfer = 0;
   ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
-  xfer += oprot->writeStructBegin("InfinityService_Delete_args");
+  xfer += oprot->writeStructBegin("InfinityService_BatchSelect_args");
 
   xfer += oprot->writeFieldBegin("request", ::apache::thrift::protocol::T_STRUCT, 1);
   xfer += this->request.write(oprot);
@@ -1918,14 +1918,14 @@ uint32_t InfinityService_Delete_args::write(::apache::thrift::protocol::TProtoco
 }
 
 
-InfinityService_Delete_pargs::~InfinityService_Delete_pargs() noexcept {
+InfinityService_BatchSelect_pargs::~InfinityService_BatchSelect_pargs() noexcept {
 }
 
 
-uint32_t InfinityService_Delete_pargs::write(::apache::thrift::protocol::TProtocol* oprot) const {
+uint32_t InfinityService_BatchSelect_pargs::write(::apache::thrift::protocol::TProtocol* oprot) const {
   uint32_t xfer = 0;
   ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
-  xfer += oprot->writeStructBegin("InfinityService_Delete_pargs");
+  xfer += oprot->writeStructBegin("InfinityService_BatchSelect_pargs");
 
   xfer += oprot->writeFieldBegin("request", ::apache::thrift::protocol::T_STRUCT, 1);
   xfer += (*(this->request)).write(oprot);
@@ -1937,11 +1937,11 @@ uint32_t InfinityService_Delete_pargs::write(::apache::thrift::protocol::TProtoc
 }
 
 
-InfinityService_Delete_result::~InfinityService_Delete_result() noexcept {
+InfinityService_BatchSelect_result::~InfinityService_BatchSelect_result() noexcept {
 }
 
 
-uint32_t InfinityService_Delete_result::read(::apache::thrift::protocol::TProtocol* iprot) {
+uint32_t InfinityService_BatchSelect_result::read(::apache::thrift::protocol::TProtocol* iprot) {
 
   ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
   uint32_t xfer = 0;
@@ -1982,11 +1982,11 @@ uint32_t InfinityService_Delete_result::read(::apache::thrift::protocol::TProtoc
   return xfer;
 }
 
-uint32_t InfinityService_Delete_result::write(::apache::thrift::protocol::TProtocol* oprot) const {
+uint32_t InfinityService_BatchSelect_result::write(::apache::thrift::protocol::TProtocol* oprot) const {
 
   uint32_t xfer = 0;
 
-  xfer += oprot->writeStructBegin("InfinityService_Delete_result");
+  xfer += oprot->writeStructBegin("InfinityService_BatchSelect_result");
 
   if (this->__isset.success) {
     xfer += oprot->writeFieldBegin("success", ::apache::thrift::protocol::T_STRUCT, 0);
@@ -1999,11 +1999,11 @@ uint32_t InfinityService_Delete_result::write(::apache::thrift::protocol::TProto
 }
 
 
-InfinityService_Delete_presult::~InfinityService_Delete_presult() noexcept {
+InfinityService_BatchSelect_presult::~InfinityService_BatchSelect_presult() noexcept {
 }
 
 
-uint32_t InfinityService_Delete_presult::read(::apache::thrift::protocol::TProtocol* iprot) {
+uint32_t InfinityService_BatchSelect_presult::read(::apache::thrift::protocol::TProtocol* iprot) {
 
   ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
   uint32_t xfer = 0;
@@ -2045,11 +2045,11 @@ uint32_t InfinityService_Delete_presult::read(::apache::thrift::protocol::TProto
 }
 
 
-InfinityService_Update_args::~InfinityService_Update_args() noexcept {
+InfinityService_OpenCursor_args::~InfinityService_OpenCursor_args() noexcept {
 }
 
 
-uint32_t InfinityService_Update_args::read(::apache::thrift::protocol::TProtocol* iprot) {
+uint32_t InfinityService_OpenCursor_args::read(::apache::thrift::protocol::TProtocol* iprot) {
 
   ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
   uint32_t xfer = 0;
@@ -2090,10 +2090,10 @@ uint32_t InfinityService_Update_args::read(::apache::thrift::protocol::TProtocol
   return xfer;
 }
 
-uint32_t InfinityService_Update_args::write(::apache::thrift::protocol::TProtocol* oprot) const {
+uint32_t InfinityService_OpenCursor_args::write(::apache::thrift::protocol::TProtocol* oprot) const {
   uint32_t xfer = 0;
   ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
-  xfer += oprot->writeStructBegin("InfinityService_Update_args");
+  xfer += oprot->writeStructBegin("InfinityService_OpenCursor_args");
 
   xfer += oprot->writeFieldBegin("request", ::apache::thrift::protocol::T_STRUCT, 1);
   xfer += this->request.write(oprot);
@@ -2105,14 +2105,14 @@ uint32_t InfinityService_Update_args::write(::apache::thrift::protocol::TProtoco
 }
 
 
-InfinityService_Update_pargs::~InfinityService_Update_pargs() noexcept {
+InfinityService_OpenCursor_pargs::~InfinityService_OpenCursor_pargs() noexcept {
 }
 
 
-uint32_t InfinityService_Update_pargs::write(::apache::thrift::protocol::TProtocol* oprot) const {
+uint32_t InfinityService_OpenCursor_pargs::write(::apache::thrift::protocol::TProtocol* oprot) const {
   uint32_t xfer = 0;
   ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
-  xfer += oprot->writeStructBegin("InfinityService_Update_pargs");
+  xfer += oprot->writeStructBegin("InfinityService_OpenCursor_pargs");
 
   xfer += oprot->writeFieldBegin("request", ::apache::thrift::protocol::T_STRUCT, 1);
   xfer += (*(this->request)).write(oprot);
@@ -2124,11 +2124,11 @@ uint32_t InfinityService_Update_pargs::write(::apache::thrift::protocol::TProtoc
 }
 
 
-InfinityService_Update_result::~InfinityService_Update_result() noexcept {
+InfinityService_OpenCursor_result::~InfinityService_OpenCursor_result() noexcept {
 }
 
 
-uint32_t InfinityService_Update_result::read(::apache::thrift::protocol::TProtocol* iprot) {
+uint32_t InfinityService_OpenCursor_result::read(::apache::thrift::protocol::TProtocol* iprot) {
 
   ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
   uint32_t xfer = 0;
@@ -2169,11 +2169,11 @@ uint32_t InfinityService_Update_result::read(::apache::thrift::protocol::TProtoc
   return xfer;
 }
 
-uint32_t InfinityService_Update_result::write(::apache::thrift::protocol::TProtocol* oprot) const {
+uint32_t InfinityService_OpenCursor_result::write(::apache::thrift::protocol::TProtocol* oprot) const {
 
   uint32_t xfer = 0;
 
-  xfer += oprot->writeStructBegin("InfinityService_Update_result");
+  xfer += oprot->writeStructBegin("InfinityService_OpenCursor_result");
 
   if (this->__isset.success) {
     xfer += oprot->writeFieldBegin("success", ::apache::thrift::protocol::T_STRUCT, 0);
@@ -2186,11 +2186,11 @@ uint32_t InfinityService_Update_result::write(::apache::thrift::protocol::TProto
 }
 
 
-InfinityService_Update_presult::~InfinityService_Update_presult() noexcept {
+InfinityService_OpenCursor_presult::~InfinityService_OpenCursor_presult() noexcept {
 }
 
 
-uint32_t InfinityService_Update_presult::read(::apache::thrift::protocol::TProtocol* iprot) {
+uint32_t InfinityService_OpenCursor_presult::read(::apache::thrift::protocol::TProtocol* iprot) {
 
   ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
   uint32_t xfer = 0;
@@ -2232,11 +2232,11 @@ uint32_t InfinityService_Update_presult::read(::apache::thrift::protocol::TProto
 }
 
 
-InfinityService_UploadFileChunk_args::~InfinityService_UploadFileChunk_args() noexcept {
+InfinityService_FetchCursor_args::~InfinityService_FetchCursor_args() noexcept {
 }
 
 
-uint32_t InfinityService_UploadFileChunk_args::read(::apache::thrift::protocol::TProtocol* iprot) {
+uint32_t InfinityService_FetchCursor_args::read(::apache::thrift::protocol::TProtocol* iprot) {
 
   ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
   uint32_t xfer = 0;
@@ -2277,10 +2277,10 @@ uint32_t InfinityService_UploadFileChunk_args::read(::apache::thrift::protocol::
   return xfer;
 }
 
-uint32_t InfinityService_UploadFileChunk_args::write(::apache::thrift::protocol::TProtocol* oprot) const {
+uint32_t InfinityService_FetchCursor_args::write(::apache::thrift::protocol::TProtocol* oprot) const {
   uint32_t xfer = 0;
   ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
-  xfer += oprot->writeStructBegin("InfinityService_UploadFileChunk_args");
+  xfer += oprot->writeStructBegin("InfinityService_FetchCursor_args");
 
   xfer += oprot->writeFieldBegin("request", ::apache::thrift::protocol::T_STRUCT, 1);
   xfer += this->request.write(oprot);
@@ -2292,14 +2292,14 @@ uint32_t InfinityService_UploadFileChunk_args::write(::apache::thrift::protocol:
 }
 
 
-InfinityService_UploadFileChunk_pargs::~InfinityService_UploadFileChunk_pargs() noexcept {
+InfinityService_FetchCursor_pargs::~InfinityService_FetchCursor_pargs() noexcept {
 }
 
 
-uint32_t InfinityService_UploadFileChunk_pargs::write(::apache::thrift::protocol::TProtocol* oprot) const {
+uint32_t InfinityService_FetchCursor_pargs::write(::apache::thrift::protocol::TProtocol* oprot) const {
   uint32_t xfer = 0;
   ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
-  xfer += oprot->writeStructBegin("InfinityService_UploadFileChunk_pargs");
+  xfer += oprot->writeStructBegin("InfinityService_FetchCursor_pargs");
 
   xfer += oprot->writeFieldBegin("request", ::apache::thrift::protocol::T_STRUCT, 1);
   xfer += (*(this->request)).write(oprot);
@@ -2311,11 +2311,11 @@ uint32_t InfinityService_UploadFileChunk_pargs::write(::apache::thrift::protocol
 }
 
 
-InfinityService_UploadFileChunk_result::~InfinityService_UploadFileChunk_result() noexcept {
+InfinityService_FetchCursor_result::~InfinityService_FetchCursor_result() noexcept {
 }
 
 
-uint32_t InfinityService_UploadFileChunk_result::read(::apache::thrift::protocol::TProtocol* iprot) {
+uint32_t InfinityService_FetchCursor_result::read(::apache::thrift::protocol::TProtocol* iprot) {
 
   ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
   uint32_t xfer = 0;
@@ -2356,11 +2356,11 @@ uint32_t InfinityService_UploadFileChunk_result::read(::apache::thrift::protocol
   return xfer;
 }
 
-uint32_t InfinityService_UploadFileChunk_result::write(::apache::thrift::protocol::TProtocol* oprot) const {
+uint32_t InfinityService_FetchCursor_result::write(::apache::thrift::protocol::TProtocol* oprot) const {
 
   uint32_t xfer = 0;
 
-  xfer += oprot->writeStructBegin("InfinityService_UploadFileChunk_result");
+  xfer += oprot->writeStructBegin("InfinityService_FetchCursor_result");
 
   if (this->__isset.success) {
     xfer += oprot->writeFieldBegin("success", ::apache::thrift::protocol::T_STRUCT, 0);
@@ -2373,11 +2373,11 @@ uint32_t InfinityService_UploadFileChunk_result::write(::apache::thrift::protoco
 }
 
 
-InfinityService_UploadFileChunk_presult::~InfinityService_UploadFileChunk_presult() noexcept {
+InfinityService_FetchCursor_presult::~InfinityService_FetchCursor_presult() noexcept {
 }
 
 
-uint32_t InfinityService_UploadFileChunk_presult::read(::apache::thrift::protocol::TProtocol* iprot) {
+uint32_t InfinityService_FetchCursor_presult::read(::apache::thrift::protocol::TProtocol* iprot) {
 
   ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
   uint32_t xfer = 0;
@@ -2419,11 +2419,11 @@ uint32_t InfinityService_UploadFileChunk_presult::read(::apache::thrift::protoco
 }
 
 
-InfinityService_ListDatabase_args::~InfinityService_ListDatabase_args() noexcept {
+InfinityService_Explain_args::~InfinityService_Explain_args() noexcept {
 }
 
 
-uint32_t InfinityService_ListDatabase_args::read(::apache::thrift::protocol::TProtocol* iprot) {
+uint32_t InfinityService_Explain_args::read(::apache::thrift::protocol::TProtocol* iprot) {
 
   ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
   uint32_t xfer = 0;
@@ -2464,10 +2464,10 @@ uint32_t InfinityService_ListDatabase_args::read(::apache::thrift::protocol::TPr
   return xfer;
 }
 
-uint32_t InfinityService_ListDatabase_args::write(::apache::thrift::protocol::TProtocol* oprot) const {
+uint32_t InfinityService_Explain_args::write(::apache::thrift::protocol::TProtocol* oprot) const {
   uint32_t xfer = 0;
   ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
-  xfer += oprot->writeStructBegin("InfinityService_ListDatabase_args");
+  xfer += oprot->writeStructBegin("InfinityService_Explain_args");
 
   xfer += oprot->writeFieldBegin("request", ::apache::thrift::protocol::T_STRUCT, 1);
   xfer += this->request.write(oprot);
@@ -2479,14 +2479,14 @@ uint32_t InfinityService_ListDatabase_args::write(::apache::thrift::protocol::TP
 }
 
 
-InfinityService_ListDatabase_pargs::~InfinityService_ListDatabase_pargs() noexcept {
+InfinityService_Explain_pargs::~InfinityService_Explain_pargs() noexcept {
 }
 
 
-uint32_t InfinityService_ListDatabase_pargs::write(::apache::thrift::protocol::TProtocol* oprot) const {
+uint32_t InfinityService_Explain_pargs::write(::apache::thrift::protocol::TProtocol* oprot) const {
   uint32_t xfer = 0;
   ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
-  xfer += oprot->writeStructBegin("InfinityService_ListDatabase_pargs");
+  xfer += oprot->writeStructBegin("InfinityService_Explain_pargs");
 
   xfer += oprot->writeFieldBegin("request", ::apache::thrift::protocol::T_STRUCT, 1);
   xfer += (*(this->request)).write(oprot);
@@ -2498,11 +2498,11 @@ uint32_t InfinityService_ListDatabase_pargs::write(::apache::thrift::protocol::T
 }
 
 
-InfinityService_ListDatabase_result::~InfinityService_ListDatabase_result() noexcept {
+InfinityService_Explain_result::~InfinityService_Explain_result() noexcept {
 }
 
 
-uint32_t InfinityService_ListDatabase_result::read(::apache::thrift::protocol::TProtocol* iprot) {
+uint32_t InfinityService_Explain_result::read(::apache::thrift::protocol::TProtocol* iprot) {
 
   ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
   uint32_t xfer = 0;
@@ -2543,11 +2543,11 @@ uint32_t InfinityService_ListDatabase_result::read(::apache::thrift::protocol::T
   return xfer;
 }
 
-uint32_t InfinityService_ListDatabase_result::write(::apache::thrift::protocol::TProtocol* oprot) const {
+uint32_t InfinityService_Explain_result::write(::apache::thrift::protocol::TProtocol* oprot) const {
 
   uint32_t xfer = 0;
 
-  xfer += oprot->writeStructBegin("InfinityService_ListDatabase_result");
+  xfer += oprot->writeStructBegin("InfinityService_Explain_result");
 
   if (this->__isset.success) {
     xfer += oprot->writeFieldBegin("success", ::apache::thrift::protocol::T_STRUCT, 0);
@@ -2560,11 +2560,11 @@ uint32_t InfinityService_ListDatabase_result::write(::apache::thrift::protocol::
 }
 
 
-InfinityService_ListDatabase_presult::~InfinityService_ListDatabase_presult() noexcept {
+InfinityService_Explain_presult::~InfinityService_Explain_presult() noexcept {
 }
 
 
-uint32_t InfinityService_ListDatabase_presult::read(::apache::thrift::protocol::TProtocol* iprot) {
+uint32_t InfinityService_Explain_presult::read(::apache::thrift::protocol::TProtocol* iprot) {
 
   ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
   uint32_t xfer = 0;
@@ -2606,11 +2606,11 @@ uint32_t InfinityService_ListDatabase_presult::read(::apache::thrift::protocol::
 }
 
 
-InfinityService_ListTable_args::~InfinityService_ListTable_args() noexcept {
+InfinityService_Delete_args::~InfinityService_Delete_args() noexcept {
 }
 
 
-uint32_t InfinityService_ListTable_args::read(::apache::thrift::protocol::TProtocol* iprot) {
+uint32_t InfinityService_Delete_args::read(::apache::thrift::protocol::TProtocol* iprot) {
 
   ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
   uint32_t xfer = 0;
@@ -2651,10 +2651,10 @@ uint32_t InfinityService_ListTable_args::read(::apache::thrift::protocol::TProto
   return xfer;
 }
 
-uint32_t InfinityService_ListTable_args::write(::apache::thrift::protocol::TProtocol* oprot) const {
+uint32_t InfinityService_Delete_args::write(::apache::thrift::protocol::TProtocol* oprot) const {
   uint32_t xfer = 0;
   ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
-  xfer += oprot->writeStructBegin("InfinityService_ListTable_args");
+  xfer += oprot->writeStructBegin("InfinityService_Delete_args");
 
   xfer += oprot->writeFieldBegin("request", ::apache::thrift::protocol::T_STRUCT, 1);
   xfer += this->request.write(oprot);
@@ -2666,14 +2666,14 @@ uint32_t InfinityService_ListTable_args::write(::apache::thrift::protocol::TProt
 }
 
 
-InfinityService_ListTable_pargs::~InfinityService_ListTable_pargs() noexcept {
+InfinityService_Delete_pargs::~InfinityService_Delete_pargs() noexcept {
 }
 
 
-uint32_t InfinityService_ListTable_pargs::write(::apache::thrift::protocol::TProtocol* oprot) const {
+uint32_t InfinityService_Delete_pargs::write(::apache::thrift::protocol::TProtocol* oprot) const {
   uint32_t xfer = 0;
   ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
-  xfer += oprot->writeStructBegin("InfinityService_ListTable_pargs");
+  xfer += oprot->writeStructBegin("InfinityService_Delete_pargs");
 
   xfer += oprot->writeFieldBegin("request", ::apache::thrift::protocol::T_STRUCT, 1);
   xfer += (*(this->request)).write(oprot);
@@ -2685,11 +2685,11 @@ uint32_t InfinityService_ListTable_pargs::write(::apache::thrift::protocol::TPro
 }
 
 
-InfinityService_ListTable_result::~InfinityService_ListTable_result() noexcept {
+InfinityService_Delete_result::~InfinityService_Delete_result() noexcept {
 }
 
 
-uint32_t InfinityService_ListTable_result::read(::apache::thrift::protocol::TProtocol* iprot) {
+uint32_t InfinityService_Delete_result::read(::apache::thrift::protocol::TProtocol* iprot) {
 
   ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
   uint32_t xfer = 0;
@@ -2730,11 +2730,11 @@ uint32_t InfinityService_ListTable_result::read(::apache::thrift::protocol::TPro
   return xfer;
 }
 
-uint32_t InfinityService_ListTable_result::write(::apache::thrift::protocol::TProtocol* oprot) const {
+uint32_t InfinityService_Delete_result::write(::apache::thrift::protocol::TProtocol* oprot) const {
 
   uint32_t xfer = 0;
 
-  xfer += oprot->writeStructBegin("InfinityService_ListTable_result");
+  xfer += oprot->writeStructBegin("InfinityService_Delete_result");
 
   if (this->__isset.success) {
     xfer += oprot->writeFieldBegin("success", ::apache::thrift::protocol::T_STRUCT, 0);
@@ -2747,11 +2747,11 @@ uint32_t InfinityService_ListTable_result::write(::apache::thrift::protocol::TPr
 }
 
 
-InfinityService_ListTable_presult::~InfinityService_ListTable_presult() noexcept {
+InfinityService_Delete_presult::~InfinityService_Delete_presult() noexcept {
 }
 
 
-uint32_t InfinityService_ListTable_presult::read(::apache::thrift::protocol::TProtocol* iprot) {
+uint32_t InfinityService_Delete_presult::read(::apache::thrift::protocol::TProtocol* iprot) {
 
   ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
   uint32_t xfer = 0;
@@ -2793,11 +2793,11 @@ uint32_t InfinityService_ListTable_presult::read(::apache::thrift::protocol::TPr
 }
 
 
-InfinityService_ListIndex_args::~InfinityService_ListIndex_args() noexcept {
+InfinityService_CloseCursor_args::~InfinityService_CloseCursor_args() noexcept {
 }
 
 
-uint32_t InfinityService_ListIndex_args::read(::apache::thrift::protocol::TProtocol* iprot) {
+uint32_t InfinityService_CloseCursor_args::read(::apache::thrift::protocol::TProtocol* iprot) {
 
   ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
   uint32_t xfer = 0;
@@ -2838,10 +2838,10 @@ uint32_t InfinityService_ListIndex_args::read(::apache::thrift::protocol::TProto
   return xfer;
 }
 
-uint32_t InfinityService_ListIndex_args::write(::apache::thrift::protocol::TProtocol* oprot) const {
+uint32_t InfinityService_CloseCursor_args::write(::apache::thrift::protocol::TProtocol* oprot) const {
   uint32_t xfer = 0;
   ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
-  xfer += oprot->writeStructBegin("InfinityService_ListIndex_args");
+  xfer += oprot->writeStructBegin("InfinityService_CloseCursor_args");
 
   xfer += oprot->writeFieldBegin("request", ::apache::thrift::protocol::T_STRUCT, 1);
   xfer += this->request.write(oprot);
@@ -2853,14 +2853,14 @@ uint32_t InfinityService_ListIndex_args::write(::apache::thrift::protocol::TProt
 }
 
 
-InfinityService_ListIndex_pargs::~InfinityService_ListIndex_pargs() noexcept {
+InfinityService_CloseCursor_pargs::~InfinityService_CloseCursor_pargs() noexcept {
 }
 
 
-uint32_t InfinityService_ListIndex_pargs::write(::apache::thrift::protocol::TProtocol* oprot) const {
+uint32_t InfinityService_CloseCursor_pargs::write(::apache::thrift::protocol::TProtocol* oprot) const {
   uint32_t xfer = 0;
   ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
-  xfer += oprot->writeStructBegin("InfinityService_ListIndex_pargs");
+  xfer += oprot->writeStructBegin("InfinityService_CloseCursor_pargs");
 
   xfer += oprot->writeFieldBegin("request", ::apache::thrift::protocol::T_STRUCT, 1);
   xfer += (*(this->request)).write(oprot);
@@ -2872,11 +2872,11 @@ uint32_t InfinityService_ListIndex_pargs::write(::apache::thrift::protocol::TPro
 }
 
 
-InfinityService_ListIndex_result::~InfinityService_ListIndex_result() noexcept {
+InfinityService_CloseCursor_result::~InfinityService_CloseCursor_result() noexcept {
 }
 
 
-uint32_t InfinityService_ListIndex_result::read(::apache::thrift::protocol::TProtocol* iprot) {
+uint32_t InfinityService_CloseCursor_result::read(::apache::thrift::protocol::TProtocol* iprot) {
 
   ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
   uint32_t xfer = 0;
@@ -2917,11 +2917,11 @@ uint32_t InfinityService_ListIndex_result::read(::apache::thrift::protocol::TPro
   return xfer;
 }
 
-uint32_t InfinityService_ListIndex_result::write(::apache::thrift::protocol::TProtocol* oprot) const {
+uint32_t InfinityService_CloseCursor_result::write(::apache::thrift::protocol::TProtocol* oprot) const {
 
   uint32_t xfer = 0;
 
-  xfer += oprot->writeStructBegin("InfinityService_ListIndex_result");
+  xfer += oprot->writeStructBegin("InfinityService_CloseCursor_result");
 
   if (this->__isset.success) {
     xfer += oprot->writeFieldBegin("success", ::apache::thrift::protocol::T_STRUCT, 0);
@@ -2934,11 +2934,11 @@ uint32_t InfinityService_ListIndex_result::write(::apache::thrift::protocol::TPr
 }
 
 
-InfinityService_ListIndex_presult::~InfinityService_ListIndex_presult() noexcept {
+InfinityService_CloseCursor_presult::~InfinityService_CloseCursor_presult() noexcept {
 }
 
 
-uint32_t InfinityService_ListIndex_presult::read(::apache::thrift::protocol::TProtocol* iprot) {
+uint32_t InfinityService_CloseCursor_presult::read(::apache::thrift::protocol::TProtocol* iprot) {
 
   ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
   uint32_t xfer = 0;
@@ -2980,11 +2980,11 @@ uint32_t InfinityService_ListIndex_presult::read(::apache::thrift::protocol::TPr
 }
 
 
-InfinityService_ShowVariable_args::~InfinityService_ShowVariable_args() noexcept {
+InfinityService_Update_args::~InfinityService_Update_args() noexcept {
 }
 
 
-uint32_t InfinityService_ShowVariable_args::read(::apache::thrift::protocol::TProtocol* iprot) {
+uint32_t InfinityService_Update_args::read(::apache::thrift::protocol::TProtocol* iprot) {
 
   ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
   uint32_t xfer = 0;
@@ -3025,10 +3025,10 @@ uint32_t InfinityService_ShowVariable_args::read(::apache::thrift::protocol::TPr
   return xfer;
 }
 
-uint32_t InfinityService_ShowVariable_args::write(::apache::thrift::protocol::TProtocol* oprot) const {
+uint32_t InfinityService_Update_args::write(::apache::thrift::protocol::TProtocol* oprot) const {
   uint32_t xfer = 0;
   ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
-  xfer += oprot->writeStructBegin("InfinityService_ShowVariable_args");
+  xfer += oprot->writeStructBegin("InfinityService_Update_args");
 
   xfer += oprot->writeFieldBegin("request", ::apache::thrift::protocol::T_STRUCT, 1);
   xfer += this->request.write(oprot);
@@ -3040,14 +3040,14 @@ uint32_t InfinityService_ShowVariable_args::write(::apache::thrift::protocol::TP
 }
 
 
-InfinityService_ShowVariable_pargs::~InfinityService_ShowVariable_pargs() noexcept {
+InfinityService_Update_pargs::~InfinityService_Update_pargs() noexcept {
 }
 
 
-uint32_t InfinityService_ShowVariable_pargs::write(::apache::thrift::protocol::TProtocol* oprot) const {
+uint32_t InfinityService_Update_pargs::write(::apache::thrift::protocol::TProtocol* oprot) const {
   uint32_t xfer = 0;
   ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
-  xfer += oprot->writeStructBegin("InfinityService_ShowVariable_pargs");
+  xfer += oprot->writeStructBegin("InfinityService_Update_pargs");
 
   xfer += oprot->writeFieldBegin("request", ::apache::thrift::protocol::T_STRUCT, 1);
   xfer += (*(this->request)).write(oprot);
@@ -3059,11 +3059,11 @@ uint32_t InfinityService_ShowVariable_pargs::write(::apache::thrift::protocol::T
 }
 
 
-InfinityService_ShowVariable_result::~InfinityService_ShowVariable_result() noexcept {
+InfinityService_Update_result::~InfinityService_Update_result() noexcept {
 }
 
 
-uint32_t InfinityService_ShowVariable_result::read(::apache::thrift::protocol::TProtocol* iprot) {
+uint32_t InfinityService_Update_result::read(::apache::thrift::protocol::TProtocol* iprot) {
 
   ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
   uint32_t xfer = 0;
@@ -3104,11 +3104,11 @@ uint32_t InfinityService_ShowVariable_result::read(::apache::thrift::protocol::T
   return xfer;
 }
 
-uint32_t InfinityService_ShowVariable_result::write(::apache::thrift::protocol::TProtocol* oprot) const {
+uint32_t InfinityService_Update_result::write(::apache::thrift::protocol::TProtocol* oprot) const {
 
   uint32_t xfer = 0;
 
-  xfer += oprot->writeStructBegin("InfinityService_ShowVariable_result");
+  xfer += oprot->writeStructBegin("InfinityService_Update_result");
 
   if (this->__isset.success) {
     xfer += oprot->writeFieldBegin("success", ::apache::thrift::protocol::T_STRUCT, 0);
@@ -3121,11 +3121,11 @@ uint32_t InfinityService_ShowVariable_result::write(::apache::thrift::protocol::
 }
 
 
-InfinityService_ShowVariable_presult::~InfinityService_ShowVariable_presult() noexcept {
+InfinityService_Update_presult::~InfinityService_Update_presult() noexcept {
 }
 
 
-uint32_t InfinityService_ShowVariable_presult::read(::apache::thrift::protocol::TProtocol* iprot) {
+uint32_t InfinityService_Update_presult::read(::apache::thrift::protocol::TProtocol* iprot) {
 
   ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
   uint32_t xfer = 0;
@@ -3167,11 +3167,11 @@ uint32_t InfinityService_ShowVariable_presult::read(::apache::thrift::protocol::
 }
 
 
-InfinityService_ShowTable_args::~InfinityService_ShowTable_args() noexcept {
+InfinityService_UploadFileChunk_args::~InfinityService_UploadFileChunk_args() noexcept {
 }
 
 
-uint32_t InfinityService_ShowTable_args::read(::apache::thrift::protocol::TProtocol* iprot) {
+uint32_t InfinityService_UploadFileChunk_args::read(::apache::thrift::protocol::TProtocol* iprot) {
 
   ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
   uint32_t xfer = 0;
@@ -3212,10 +3212,10 @@ uint32_t InfinityService_ShowTable_args::read(::apache::thrift::protocol::TProto
   return xfer;
 }
 
-uint32_t InfinityService_ShowTable_args::write(::apache::thrift::protocol::TProtocol* oprot) const {
+uint32_t InfinityService_UploadFileChunk_args::write(::apache::thrift::protocol::TProtocol* oprot) const {
   uint32_t xfer = 0;
   ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
-  xfer += oprot->writeStructBegin("InfinityService_ShowTable_args");
+  xfer += oprot->writeStructBegin("InfinityService_UploadFileChunk_args");
 
   xfer += oprot->writeFieldBegin("request", ::apache::thrift::protocol::T_STRUCT, 1);
   xfer += this->request.write(oprot);
@@ -3227,14 +3227,14 @@ uint32_t InfinityService_ShowTable_args::write(::apache::thrift::protocol::TProt
 }
 
 
-InfinityService_ShowTable_pargs::~InfinityService_ShowTable_pargs() noexcept {
+InfinityService_UploadFileChunk_pargs::~InfinityService_UploadFileChunk_pargs() noexcept {
 }
 
 
-uint32_t InfinityService_ShowTable_pargs::write(::apache::thrift::protocol::TProtocol* oprot) const {
+uint32_t InfinityService_UploadFileChunk_pargs::write(::apache::thrift::protocol::TProtocol* oprot) const {
   uint32_t xfer = 0;
   ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
-  xfer += oprot->writeStructBegin("InfinityService_ShowTable_pargs");
+  xfer += oprot->writeStructBegin("InfinityService_UploadFileChunk_pargs");
 
   xfer += oprot->writeFieldBegin("request", ::apache::thrift::protocol::T_STRUCT, 1);
   xfer += (*(this->request)).write(oprot);
@@ -3246,11 +3246,11 @@ uint32_t InfinityService_ShowTable_pargs::write(::apache::thrift::protocol::TPro
 }
 
 
-InfinityService_ShowTable_result::~InfinityService_ShowTable_result() noexcept {
+InfinityService_UploadFileChunk_result::~InfinityService_UploadFileChunk_result() noexcept {
 }
 
 
-uint32_t InfinityService_ShowTable_result::read(::apache::thrift::protocol::TProtocol* iprot) {
+uint32_t InfinityService_UploadFileChunk_result::read(::apache::thrift::protocol::TProtocol* iprot) {
 
   ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
   uint32_t xfer = 0;
@@ -3291,11 +3291,11 @@ uint32_t InfinityService_ShowTable_result::read(::apache::thrift::protocol::TPro
   return xfer;
 }
 
-uint32_t InfinityService_ShowTable_result::write(::apache::thrift::protocol::TProtocol* oprot) const {
+uint32_t InfinityService_UploadFileChunk_result::write(::apache::thrift::protocol::TProtocol* oprot) const {
 
   uint32_t xfer = 0;
 
-  xfer += oprot->writeStructBegin("InfinityService_ShowTable_result");
+  xfer += oprot->writeStructBegin("InfinityService_UploadFileChunk_result");
 
   if (this->__isset.success) {
     xfer += oprot->writeFieldBegin("success", ::apache::thrift::protocol::T_STRUCT, 0);
@@ -3308,11 +3308,11 @@ uint32_t InfinityService_ShowTable_result::write(::apache::thrift::protocol::TPr
 }
 
 
-InfinityService_ShowTable_presult::~InfinityService_ShowTable_presult() noexcept {
+InfinityService_UploadFileChunk_presult::~InfinityService_UploadFileChunk_presult() noexcept {
 }
 
 
-uint32_t InfinityService_ShowTable_presult::read(::apache::thrift::protocol::TProtocol* iprot) {
+uint32_t InfinityService_UploadFileChunk_presult::read(::apache::thrift::protocol::TProtocol* iprot) {
 
   ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
   uint32_t xfer = 0;
@@ -3354,11 +3354,11 @@ uint32_t InfinityService_ShowTable_presult::read(::apache::thrift::protocol::TPr
 }
 
 
-InfinityService_ShowColumns_args::~InfinityService_ShowColumns_args() noexcept {
+InfinityService_ListDatabase_args::~InfinityService_ListDatabase_args() noexcept {
 }
 
 
-uint32_t InfinityService_ShowColumns_args::read(::apache::thrift::protocol::TProtocol* iprot) {
+uint32_t InfinityService_ListDatabase_args::read(::apache::thrift::protocol::TProtocol* iprot) {
 
   ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
   uint32_t xfer = 0;
@@ -3399,10 +3399,10 @@ uint32_t InfinityService_ShowColumns_args::read(::apache::thrift::protocol::TPro
   return xfer;
 }
 
-uint32_t InfinityService_ShowColumns_args::write(::apache::thrift::protocol::TProtocol* oprot) const {
+uint32_t InfinityService_ListDatabase_args::write(::apache::thrift::protocol::TProtocol* oprot) const {
   uint32_t xfer = 0;
   ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
-  xfer += oprot->writeStructBegin("InfinityService_ShowColumns_args");
+  xfer += oprot->writeStructBegin("InfinityService_ListDatabase_args");
 
   xfer += oprot->writeFieldBegin("request", ::apache::thrift::protocol::T_STRUCT, 1);
   xfer += this->request.write(oprot);
@@ -3414,14 +3414,14 @@ uint32_t InfinityService_ShowColumns_args::write(::apache::thrift::protocol::TPr
 }
 
 
-InfinityService_ShowColumns_pargs::~InfinityService_ShowColumns_pargs() noexcept {
+InfinityService_ListDatabase_pargs::~InfinityService_ListDatabase_pargs() noexcept {
 }
 
 
-uint32_t InfinityService_ShowColumns_pargs::write(::apache::thrift::protocol::TProtocol* oprot) const {
+uint32_t InfinityService_ListDatabase_pargs::write(::apache::thrift::protocol::TProtocol* oprot) const {
   uint32_t xfer = 0;
   ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
-  xfer += oprot->writeStructBegin("InfinityService_ShowColumns_pargs");
+  xfer += oprot->writeStructBegin("InfinityService_ListDatabase_pargs");
 
   xfer += oprot->writeFieldBegin("request", ::apache::thrift::protocol::T_STRUCT, 1);
   xfer += (*(this->request)).write(oprot);
@@ -3433,11 +3433,11 @@ uint32_t InfinityService_ShowColumns_pargs::write(::apache::thrift::protocol::TP
 }
 
 
-InfinityService_ShowColumns_result::~InfinityService_ShowColumns_result() noexcept {
+InfinityService_ListDatabase_result::~InfinityService_ListDatabase_result() noexcept {
 }
 
 
-uint32_t InfinityService_ShowColumns_result::read(::apache::thrift::protocol::TProtocol* iprot) {
+uint32_t InfinityService_ListDatabase_result::read(::apache::thrift::protocol::TProtocol* iprot) {
 
   ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
   uint32_t xfer = 0;
@@ -3478,11 +3478,11 @@ uint32_t InfinityService_ShowColumns_result::read(::apache::thrift::protocol::TP
   return xfer;
 }
 
-uint32_t InfinityService_ShowColumns_result::write(::apache::thrift::protocol::TProtocol* oprot) const {
+uint32_t InfinityService_ListDatabase_result::write(::apache::thrift::protocol::TProtocol* oprot) const {
 
   uint32_t xfer = 0;
 
-  xfer += oprot->writeStructBegin("InfinityService_ShowColumns_result");
+  xfer += oprot->writeStructBegin("InfinityService_ListDatabase_result");
 
   if (this->__isset.success) {
     xfer += oprot->writeFieldBegin("success", ::apache::thrift::protocol::T_STRUCT, 0);
@@ -3495,11 +3495,11 @@ uint32_t InfinityService_ShowColumns_result::write(::apache::thrift::protocol::T
 }
 
 
-InfinityService_ShowColumns_presult::~InfinityService_ShowColumns_presult() noexcept {
+InfinityService_ListDatabase_presult::~InfinityService_ListDatabase_presult() noexcept {
 }
 
 
-uint32_t InfinityService_ShowColumns_presult::read(::apache::thrift::protocol::TProtocol* iprot) {
+uint32_t InfinityService_ListDatabase_presult::read(::apache::thrift::protocol::TProtocol* iprot) {
 
   ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
   uint32_t xfer = 0;
@@ -3541,11 +3541,11 @@ uint32_t InfinityService_ShowColumns_presult::read(::apache::thrift::protocol::T
 }
 
 
-InfinityService_ShowDatabase_args::~InfinityService_ShowDatabase_args() noexcept {
+InfinityService_ListTable_args::~InfinityService_ListTable_args() noexcept {
 }
 
 
-uint32_t InfinityService_ShowDatabase_args::read(::apache::thrift::protocol::TProtocol* iprot) {
+uint32_t InfinityService_ListTable_args::read(::apache::thrift::protocol::TProtocol* iprot) {
 
   ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
   uint32_t xfer = 0;
@@ -3586,10 +3586,10 @@ uint32_t InfinityService_ShowDatabase_args::read(::apache::thrift::protocol::TPr
   return xfer;
 }
 
-uint32_t InfinityService_ShowDatabase_args::write(::apache::thrift::protocol::TProtocol* oprot) const {
+uint32_t InfinityService_ListTable_args::write(::apache::thrift::protocol::TProtocol* oprot) const {
   uint32_t xfer = 0;
   ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
-  xfer += oprot->writeStructBegin("InfinityService_ShowDatabase_args");
+  xfer += oprot->writeStructBegin("InfinityService_ListTable_args");
 
   xfer += oprot->writeFieldBegin("request", ::apache::thrift::protocol::T_STRUCT, 1);
   xfer += this->request.write(oprot);
@@ -3601,14 +3601,14 @@ uint32_t InfinityService_ShowDatabase_args::write(::apache::thrift::protocol::TP
 }
 
 
-InfinityService_ShowDatabase_pargs::~InfinityService_ShowDatabase_pargs() noexcept {
+InfinityService_ListTable_pargs::~InfinityService_ListTable_pargs() noexcept {
 }
 
 
-uint32_t InfinityService_ShowDatabase_pargs::write(::apache::thrift::protocol::TProtocol* oprot) const {
+uint32_t InfinityService_ListTable_pargs::write(::apache::thrift::protocol::TProtocol* oprot) const {
   uint32_t xfer = 0;
   ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
-  xfer += oprot->writeStructBegin("InfinityService_ShowDatabase_pargs");
+  xfer += oprot->writeStructBegin("InfinityService_ListTable_pargs");
 
   xfer += oprot->writeFieldBegin("request", ::apache::thrift::protocol::T_STRUCT, 1);
   xfer += (*(this->request)).write(oprot);
@@ -3620,11 +3620,11 @@ uint32_t InfinityService_ShowDatabase_pargs::write(::apache::thrift::protocol::T
 }
 
 
-InfinityService_ShowDatabase_result::~InfinityService_ShowDatabase_result() noexcept {
+InfinityService_ListTable_result::~InfinityService_ListTable_result() noexcept {
 }
 
 
-uint32_t InfinityService_ShowDatabase_result::read(::apache::thrift::protocol::TProtocol* iprot) {
+uint32_t InfinityService_ListTable_result::read(::apache::thrift::protocol::TProtocol* iprot) {
 
   ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
   uint32_t xfer = 0;
@@ -3665,11 +3665,11 @@ uint32_t InfinityService_ShowDatabase_result::read(::apache::thrift::protocol::T
   return xfer;
 }
 
-uint32_t InfinityService_ShowDatabase_result::write(::apache::thrift::protocol::TProtocol* oprot) const {
+uint32_t InfinityService_ListTable_result::write(::apache::thrift::protocol::TProtocol* oprot) const {
 
   uint32_t xfer = 0;
 
-  xfer += oprot->writeStructBegin("InfinityService_ShowDatabase_result");
+  xfer += oprot->writeStructBegin("InfinityService_ListTable_result");
 
   if (this->__isset.success) {
     xfer += oprot->writeFieldBegin("success", ::apache::thrift::protocol::T_STRUCT, 0);
@@ -3682,11 +3682,11 @@ uint32_t InfinityService_ShowDatabase_result::write(::apache::thrift::protocol::
 }
 
 
-InfinityService_ShowDatabase_presult::~InfinityService_ShowDatabase_presult() noexcept {
+InfinityService_ListTable_presult::~InfinityService_ListTable_presult() noexcept {
 }
 
 
-uint32_t InfinityService_ShowDatabase_presult::read(::apache::thrift::protocol::TProtocol* iprot) {
+uint32_t InfinityService_ListTable_presult::read(::apache::thrift::protocol::TProtocol* iprot) {
 
   ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
   uint32_t xfer = 0;
@@ -3728,11 +3728,11 @@ uint32_t InfinityService_ShowDatabase_presult::read(::apache::thrift::protocol::
 }
 
 
-InfinityService_ShowTables_args::~InfinityService_ShowTables_args() noexcept {
+InfinityService_ListIndex_args::~InfinityService_ListIndex_args() noexcept {
 }
 
 
-uint32_t InfinityService_ShowTables_args::read(::apache::thrift::protocol::TProtocol* iprot) {
+uint32_t InfinityService_ListIndex_args::read(::apache::thrift::protocol::TProtocol* iprot) {
 
   ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
   uint32_t xfer = 0;
@@ -3773,10 +3773,10 @@ uint32_t InfinityService_ShowTables_args::read(::apache::thrift::protocol::TProt
   return xfer;
 }
 
-uint32_t InfinityService_ShowTables_args::write(::apache::thrift::protocol::TProtocol* oprot) const {
+uint32_t InfinityService_ListIndex_args::write(::apache::thrift::protocol::TProtocol* oprot) const {
   uint32_t xfer = 0;
   ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
-  xfer += oprot->writeStructBegin("InfinityService_ShowTables_args");
+  xfer += oprot->writeStructBegin("InfinityService_ListIndex_args");
 
   xfer += oprot->writeFieldBegin("request", ::apache::thrift::protocol::T_STRUCT, 1);
   xfer += this->request.write(oprot);
@@ -3788,14 +3788,14 @@ uint32_t InfinityService_ShowTables_args::write(::apache::thrift::protocol::TPro
 }
 
 
-InfinityService_ShowTables_pargs::~InfinityService_ShowTables_pargs() noexcept {
+InfinityService_ListIndex_pargs::~InfinityService_ListIndex_pargs() noexcept {
 }
 
 
-uint32_t InfinityService_ShowTables_pargs::write(::apache::thrift::protocol::TProtocol* oprot) const {
+uint32_t InfinityService_ListIndex_pargs::write(::apache::thrift::protocol::TProtocol* oprot) const {
   uint32_t xfer = 0;
   ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
-  xfer += oprot->writeStructBegin("InfinityService_ShowTables_pargs");
+  xfer += oprot->writeStructBegin("InfinityService_ListIndex_pargs");
 
   xfer += oprot->writeFieldBegin("request", ::apache::thrift::protocol::T_STRUCT, 1);
   xfer += (*(this->request)).write(oprot);
@@ -3807,11 +3807,11 @@ uint32_t InfinityService_ShowTables_pargs::write(::apache::thrift::protocol::TPr
 }
 
 
-InfinityService_ShowTables_result::~InfinityService_ShowTables_result() noexcept {
+InfinityService_ListIndex_result::~InfinityService_ListIndex_result() noexcept {
 }
 
 
-uint32_t InfinityService_ShowTables_result::read(::apache::thrift::protocol::TProtocol* iprot) {
+uint32_t InfinityService_ListIndex_result::read(::apache::thrift::protocol::TProtocol* iprot) {
 
   ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
   uint32_t xfer = 0;
@@ -3852,11 +3852,11 @@ uint32_t InfinityService_ShowTables_result::read(::apache::thrift::protocol::TPr
   return xfer;
 }
 
-uint32_t InfinityService_ShowTables_result::write(::apache::thrift::protocol::TProtocol* oprot) const {
+uint32_t InfinityService_ListIndex_result::write(::apache::thrift::protocol::TProtocol* oprot) const {
 
   uint32_t xfer = 0;
 
-  xfer += oprot->writeStructBegin("InfinityService_ShowTables_result");
+  xfer += oprot->writeStructBegin("InfinityService_ListIndex_result");
 
   if (this->__isset.success) {
     xfer += oprot->writeFieldBegin("success", ::apache::thrift::protocol::T_STRUCT, 0);
@@ -3869,11 +3869,11 @@ uint32_t InfinityService_ShowTables_result::write(::apache::thrift::protocol::TP
 }
 
 
-InfinityService_ShowTables_presult::~InfinityService_ShowTables_presult() noexcept {
+InfinityService_ListIndex_presult::~InfinityService_ListIndex_presult() noexcept {
 }
 
 
-uint32_t InfinityService_ShowTables_presult::read(::apache::thrift::protocol::TProtocol* iprot) {
+uint32_t InfinityService_ListIndex_presult::read(::apache::thrift::protocol::TProtocol* iprot) {
 
   ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
   uint32_t xfer = 0;
@@ -3915,11 +3915,11 @@ uint32_t InfinityService_ShowTables_presult::read(::apache::thrift::protocol::TP
 }
 
 
-InfinityService_GetDatabase_args::~InfinityService_GetDatabase_args() noexcept {
+InfinityService_ShowVariable_args::~InfinityService_ShowVariable_args() noexcept {
 }
 
 
-uint32_t InfinityService_GetDatabase_args::read(::apache::thrift::protocol::TProtocol* iprot) {
+uint32_t InfinityService_ShowVariable_args::read(::apache::thrift::protocol::TProtocol* iprot) {
 
   ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
   uint32_t xfer = 0;
@@ -3960,10 +3960,10 @@ uint32_t InfinityService_GetDatabase_args::read(::apache::thrift::protocol::TPro
   return xfer;
 }
 
-uint32_t InfinityService_GetDatabase_args::write(::apache::thrift::protocol::TProtocol* oprot) const {
+uint32_t InfinityService_ShowVariable_args::write(::apache::thrift::protocol::TProtocol* oprot) const {
   uint32_t xfer = 0;
   ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
-  xfer += oprot->writeStructBegin("InfinityService_GetDatabase_args");
+  xfer += oprot->writeStructBegin("InfinityService_ShowVariable_args");
 
   xfer += oprot->writeFieldBegin("request", ::apache::thrift::protocol::T_STRUCT, 1);
   xfer += this->request.write(oprot);
@@ -3975,14 +3975,14 @@ uint32_t InfinityService_GetDatabase_args::write(::apache::thrift::protocol::TPr
 }
 
 
-InfinityService_GetDatabase_pargs::~InfinityService_GetDatabase_pargs() noexcept {
+InfinityService_ShowVariable_pargs::~InfinityService_ShowVariable_pargs() noexcept {
 }
 
 
-uint32_t InfinityService_GetDatabase_pargs::write(::apache::thrift::protocol::TProtocol* oprot) const {
+uint32_t InfinityService_ShowVariable_pargs::write(::apache::thrift::protocol::TProtocol* oprot) const {
   uint32_t xfer = 0;
   ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
-  xfer += oprot->writeStructBegin("InfinityService_GetDatabase_pargs");
+  xfer += oprot->writeStructBegin("InfinityService_ShowVariable_pargs");
 
   xfer += oprot->writeFieldBegin("request", ::apache::thrift::protocol::T_STRUCT, 1);
   xfer += (*(this->request)).write(oprot);
@@ -3994,11 +3994,11 @@ uint32_t InfinityService_GetDatabase_pargs::write(::apache::thrift::protocol::TP
 }
 
 
-InfinityService_GetDatabase_result::~InfinityService_GetDatabase_result() noexcept {
+InfinityService_ShowVariable_result::~InfinityService_ShowVariable_result() noexcept {
 }
 
 
-uint32_t InfinityService_GetDatabase_result::read(::apache::thrift::protocol::TProtocol* iprot) {
+uint32_t InfinityService_ShowVariable_result::read(::apache::thrift::protocol::TProtocol* iprot) {
 
   ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
   uint32_t xfer = 0;
@@ -4039,11 +4039,11 @@ uint32_t InfinityService_GetDatabase_result::read(::apache::thrift::protocol::TP
   return xfer;
 }
 
-uint32_t InfinityService_GetDatabase_result::write(::apache::thrift::protocol::TProtocol* oprot) const {
+uint32_t InfinityService_ShowVariable_result::write(::apache::thrift::protocol::TProtocol* oprot) const {
 
   uint32_t xfer = 0;
 
-  xfer += oprot->writeStructBegin("InfinityService_GetDatabase_result");
+  xfer += oprot->writeStructBegin("InfinityService_ShowVariable_result");
 
   if (this->__isset.success) {
     xfer += oprot->writeFieldBegin("success", ::apache::thrift::protocol::T_STRUCT, 0);
@@ -4056,11 +4056,11 @@ uint32_t InfinityService_GetDatabase_result::write(::apache::thrift::protocol::T
 }
 
 
-InfinityService_GetDatabase_presult::~InfinityService_GetDatabase_presult() noexcept {
+InfinityService_ShowVariable_presult::~InfinityService_ShowVariable_presult() noexcept {
 }
 
 
-uint32_t InfinityService_GetDatabase_presult::read(::apache::thrift::protocol::TProtocol* iprot) {
+uint32_t InfinityService_ShowVariable_presult::read(::apache::thrift::protocol::TProtocol* iprot) {
 
   ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
   uint32_t xfer = 0;
@@ -4102,11 +4102,11 @@ uint32_t InfinityService_GetDatabase_presult::read(::apache::thrift::protocol::T
 }
 
 
-InfinityService_GetTable_args::~InfinityService_GetTable_args() noexcept {
+InfinityService_ShowTable_args::~InfinityService_ShowTable_args() noexcept {
 }
 
 
-uint32_t InfinityService_GetTable_args::read(::apache::thrift::protocol::TProtocol* iprot) {
+uint32_t InfinityService_ShowTable_args::read(::apache::thrift::protocol::TProtocol* iprot) {
 
   ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
   uint32_t xfer = 0;
@@ -4147,10 +4147,10 @@ uint32_t InfinityService_GetTable_args::read(::apache::thrift::protocol::TProtoc
   return xfer;
 }
 
-uint32_t InfinityService_GetTable_args::write(::apache::thrift::protocol::TProtocol* oprot) const {
+uint32_t InfinityService_ShowTable_args::write(::apache::thrift::protocol::TProtocol* oprot) const {
   uint32_t xfer = 0;
   ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
-  xfer += oprot->writeStructBegin("InfinityService_GetTable_args");
+  xfer += oprot->writeStructBegin("InfinityService_ShowTable_args");
 
   xfer += oprot->writeFieldBegin("request", ::apache::thrift::protocol::T_STRUCT, 1);
   xfer += this->request.write(oprot);
@@ -4162,14 +4162,14 @@ uint32_t InfinityService_GetTable_args::write(::apache::thrift::protocol::TProto
 }
 
 
-InfinityService_GetTable_pargs::~InfinityService_GetTable_pargs() noexcept {
+InfinityService_ShowTable_pargs::~InfinityService_ShowTable_pargs() noexcept {
 }
 
 
-uint32_t InfinityService_GetTable_pargs::write(::apache::thrift::protocol::TProtocol* oprot) const {
+uint32_t InfinityService_ShowTable_pargs::write(::apache::thrift::protocol::TProtocol* oprot) const {
   uint32_t xfer = 0;
   ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
-  xfer += oprot->writeStructBegin("InfinityService_GetTable_pargs");
+  xfer += oprot->writeStructBegin("InfinityService_ShowTable_pargs");
 
   xfer += oprot->writeFieldBegin("request", ::apache::thrift::protocol::T_STRUCT, 1);
   xfer += (*(this->request)).write(oprot);
@@ -4181,11 +4181,11 @@ uint32_t InfinityService_GetTable_pargs::write(::apache::thrift::protocol::TProt
 }
 
 
-InfinityService_GetTable_result::~InfinityService_GetTable_result() noexcept {
+InfinityService_ShowTable_result::~InfinityService_ShowTable_result() noexcept {
 }
 
 
-uint32_t InfinityService_GetTable_result::read(::apache::thrift::protocol::TProtocol* iprot) {
+uint32_t InfinityService_ShowTable_result::read(::apache::thrift::protocol::TProtocol* iprot) {
 
   ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
   uint32_t xfer = 0;
@@ -4226,11 +4226,11 @@ uint32_t InfinityService_GetTable_result::read(::apache::thrift::protocol::TProt
   return xfer;
 }
 
-uint32_t InfinityService_GetTable_result::write(::apache::thrift::protocol::TProtocol* oprot) const {
+uint32_t InfinityService_ShowTable_result::write(::apache::thrift::protocol::TProtocol* oprot) const {
 
   uint32_t xfer = 0;
 
-  xfer += oprot->writeStructBegin("InfinityService_GetTable_result");
+  xfer += oprot->writeStructBegin("InfinityService_ShowTable_result");
 
   if (this->__isset.success) {
     xfer += oprot->writeFieldBegin("success", ::apache::thrift::protocol::T_STRUCT, 0);
@@ -4243,11 +4243,11 @@ uint32_t InfinityService_GetTable_result::write(::apache::thrift::protocol::TPro
 }
 
 
-InfinityService_GetTable_presult::~InfinityService_GetTable_presult() noexcept {
+InfinityService_ShowTable_presult::~InfinityService_ShowTable_presult() noexcept {
 }
 
 
-uint32_t InfinityService_GetTable_presult::read(::apache::thrift::protocol::TProtocol* iprot) {
+uint32_t InfinityService_ShowTable_presult::read(::apache::thrift::protocol::TProtocol* iprot) {
 
   ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
   uint32_t xfer = 0;
@@ -4289,11 +4289,11 @@ uint32_t InfinityService_GetTable_presult::read(::apache::thrift::protocol::TPro
 }
 
 
-InfinityService_CreateIndex_args::~InfinityService_CreateIndex_args() noexcept {
+InfinityService_ShowColumns_args::~InfinityService_ShowColumns_args() noexcept {
 }
 
 
-uint32_t InfinityService_CreateIndex_args::read(::apache::thrift::protocol::TProtocol* iprot) {
+uint32_t InfinityService_ShowColumns_args::read(::apache::thrift::protocol::TProtocol* iprot) {
 
   ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
   uint32_t xfer = 0;
@@ -4334,10 +4334,10 @@ uint32_t InfinityService_CreateIndex_args::read(::apache::thrift::protocol::TPro
   return xfer;
 }
 
-uint32_t InfinityService_CreateIndex_args::write(::apache::thrift::protocol::TProtocol* oprot) const {
+uint32_t InfinityService_ShowColumns_args::write(::apache::thrift::protocol::TProtocol* oprot) const {
   uint32_t xfer = 0;
   ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
-  xfer += oprot->writeStructBegin("InfinityService_CreateIndex_args");
+  xfer += oprot->writeStructBegin("InfinityService_ShowColumns_args");
 
   xfer += oprot->writeFieldBegin("request", ::apache::thrift::protocol::T_STRUCT, 1);
   xfer += this->request.write(oprot);
@@ -4349,14 +4349,14 @@ uint32_t InfinityService_CreateIndex_args::write(::apache::thrift::protocol::TPr
 }
 
 
-InfinityService_CreateIndex_pargs::~InfinityService_CreateIndex_pargs() noexcept {
+InfinityService_ShowColumns_pargs::~InfinityService_ShowColumns_pargs() noexcept {
 }
 
 
-uint32_t InfinityService_CreateIndex_pargs::write(::apache::thrift::protocol::TProtocol* oprot) const {
+uint32_t InfinityService_ShowColumns_pargs::write(::apache::thrift::protocol::TProtocol* oprot) const {
   uint32_t xfer = 0;
   ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
-  xfer += oprot->writeStructBegin("InfinityService_CreateIndex_pargs");
+  xfer += oprot->writeStructBegin("InfinityService_ShowColumns_pargs");
 
   xfer += oprot->writeFieldBegin("request", ::apache::thrift::protocol::T_STRUCT, 1);
   xfer += (*(this->request)).write(oprot);
@@ -4368,11 +4368,11 @@ uint32_t InfinityService_CreateIndex_pargs::write(::apache::thrift::protocol::TP
 }
 
 
-InfinityService_CreateIndex_result::~InfinityService_CreateIndex_result() noexcept {
+InfinityService_ShowColumns_result::~InfinityService_ShowColumns_result() noexcept {
 }
 
 
-uint32_t InfinityService_CreateIndex_result::read(::apache::thrift::protocol::TProtocol* iprot) {
+uint32_t InfinityService_ShowColumns_result::read(::apache::thrift::protocol::TProtocol* iprot) {
 
   ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
   uint32_t xfer = 0;
@@ -4413,11 +4413,11 @@ uint32_t InfinityService_CreateIndex_result::read(::apache::thrift::protocol::TP
   return xfer;
 }
 
-uint32_t InfinityService_CreateIndex_result::write(::apache::thrift::protocol::TProtocol* oprot) const {
+uint32_t InfinityService_ShowColumns_result::write(::apache::thrift::protocol::TProtocol* oprot) const {
 
   uint32_t xfer = 0;
 
-  xfer += oprot->writeStructBegin("InfinityService_CreateIndex_result");
+  xfer += oprot->writeStructBegin("InfinityService_ShowColumns_result");
 
   if (this->__isset.success) {
     xfer += oprot->writeFieldBegin("success", ::apache::thrift::protocol::T_STRUCT, 0);
@@ -4430,11 +4430,11 @@ uint32_t InfinityService_CreateIndex_result::write(::apache::thrift::protocol::T
 }
 
 
-InfinityService_CreateIndex_presult::~InfinityService_CreateIndex_presult() noexcept {
+InfinityService_ShowColumns_presult::~InfinityService_ShowColumns_presult() noexcept {
 }
 
 
-uint32_t InfinityService_CreateIndex_presult::read(::apache::thrift::protocol::TProtocol* iprot) {
+uint32_t InfinityService_ShowColumns_presult::read(::apache::thrift::protocol::TProtocol* iprot) {
 
   ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
   uint32_t xfer = 0;
@@ -4476,11 +4476,11 @@ uint32_t InfinityService_CreateIndex_presult::read(::apache::thrift::protocol::T
 }
 
 
-InfinityService_DropIndex_args::~InfinityService_DropIndex_args() noexcept {
+InfinityService_ShowDatabase_args::~InfinityService_ShowDatabase_args() noexcept {
 }
 
 
-uint32_t InfinityService_DropIndex_args::read(::apache::thrift::protocol::TProtocol* iprot) {
+uint32_t InfinityService_ShowDatabase_args::read(::apache::thrift::protocol::TProtocol* iprot) {
 
   ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
   uint32_t xfer = 0;
@@ -4521,10 +4521,10 @@ uint32_t InfinityService_DropIndex_args::read(::apache::thrift::protocol::TProto
   return xfer;
 }
 
-uint32_t InfinityService_DropIndex_args::write(::apache::thrift::protocol::TProtocol* oprot) const {
+uint32_t InfinityService_ShowDatabase_args::write(::apache::thrift::protocol::TProtocol* oprot) const {
   uint32_t xfer = 0;
   ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
-  xfer += oprot->writeStructBegin("InfinityService_DropIndex_args");
+  xfer += oprot->writeStructBegin("InfinityService_ShowDatabase_args");
 
   xfer += oprot->writeFieldBegin("request", ::apache::thrift::protocol::T_STRUCT, 1);
   xfer += this->request.write(oprot);
@@ -4536,14 +4536,14 @@ uint32_t InfinityService_DropIndex_args::write(::apache::thrift::protocol::TProt
 }
 
 
-InfinityService_DropIndex_pargs::~InfinityService_DropIndex_pargs() noexcept {
+InfinityService_ShowDatabase_pargs::~InfinityService_ShowDatabase_pargs() noexcept {
 }
 
 
-uint32_t InfinityService_DropIndex_pargs::write(::apache::thrift::protocol::TProtocol* oprot) const {
+uint32_t InfinityService_ShowDatabase_pargs::write(::apache::thrift::protocol::TProtocol* oprot) const {
   uint32_t xfer = 0;
   ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
-  xfer += oprot->writeStructBegin("InfinityService_DropIndex_pargs");
+  xfer += oprot->writeStructBegin("InfinityService_ShowDatabase_pargs");
 
   xfer += oprot->writeFieldBegin("request", ::apache::thrift::protocol::T_STRUCT, 1);
   xfer += (*(this->request)).write(oprot);
@@ -4555,11 +4555,11 @@ uint32_t InfinityService_DropIndex_pargs::write(::apache::thrift::protocol::TPro
 }
 
 
-InfinityService_DropIndex_result::~InfinityService_DropIndex_result() noexcept {
+InfinityService_ShowDatabase_result::~InfinityService_ShowDatabase_result() noexcept {
 }
 
 
-uint32_t InfinityService_DropIndex_result::read(::apache::thrift::protocol::TProtocol* iprot) {
+uint32_t InfinityService_ShowDatabase_result::read(::apache::thrift::protocol::TProtocol* iprot) {
 
   ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
   uint32_t xfer = 0;
@@ -4600,11 +4600,11 @@ uint32_t InfinityService_DropIndex_result::read(::apache::thrift::protocol::TPro
   return xfer;
 }
 
-uint32_t InfinityService_DropIndex_result::write(::apache::thrift::protocol::TProtocol* oprot) const {
+uint32_t InfinityService_ShowDatabase_result::write(::apache::thrift::protocol::TProtocol* oprot) const {
 
   uint32_t xfer = 0;
 
-  xfer += oprot->writeStructBegin("InfinityService_DropIndex_result");
+  xfer += oprot->writeStructBegin("InfinityService_ShowDatabase_result");
 
   if (this->__isset.success) {
     xfer += oprot->writeFieldBegin("success", ::apache::thrift::protocol::T_STRUCT, 0);
@@ -4617,11 +4617,11 @@ uint32_t InfinityService_DropIndex_result::write(::apache::thrift::protocol::TPr
 }
 
 
-InfinityService_DropIndex_presult::~InfinityService_DropIndex_presult() noexcept {
+InfinityService_ShowDatabase_presult::~InfinityService_ShowDatabase_presult() noexcept {
 }
 
 
-uint32_t InfinityService_DropIndex_presult::read(::apache::thrift::protocol::TProtocol* iprot) {
+uint32_t InfinityService_ShowDatabase_presult::read(::apache::thrift::protocol::TProtocol* iprot) {
 
   ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
   uint32_t xfer = 0;
@@ -4663,11 +4663,11 @@ uint32_t InfinityService_DropIndex_presult::read(::apache::thrift::protocol::TPr
 }
 
 
-InfinityService_ShowIndex_args::~InfinityService_ShowIndex_args() noexcept {
+InfinityService_ShowTables_args::~InfinityService_ShowTables_args() noexcept {
 }
 
 
-uint32_t InfinityService_ShowIndex_args::read(::apache::thrift::protocol::TProtocol* iprot) {
+uint32_t InfinityService_ShowTables_args::read(::apache::thrift::protocol::TProtocol* iprot) {
 
   ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
   uint32_t xfer = 0;
@@ -4708,10 +4708,10 @@ uint32_t InfinityService_ShowIndex_args::read(::apache::thrift::protocol::TProto
   return xfer;
 }
 
-uint32_t InfinityService_ShowIndex_args::write(::apache::thrift::protocol::TProtocol* oprot) const {
+uint32_t InfinityService_ShowTables_args::write(::apache::thrift::protocol::TProtocol* oprot) const {
   uint32_t xfer = 0;
   ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
-  xfer += oprot->writeStructBegin("InfinityService_ShowIndex_args");
+  xfer += oprot->writeStructBegin("InfinityService_ShowTables_args");
 
   xfer += oprot->writeFieldBegin("request", ::apache::thrift::protocol::T_STRUCT, 1);
   xfer += this->request.write(oprot);
@@ -4723,14 +4723,14 @@ uint32_t InfinityService_ShowIndex_args::write(::apache::thrift::protocol::TProt
 }
 
 
-InfinityService_ShowIndex_pargs::~InfinityService_ShowIndex_pargs() noexcept {
+InfinityService_ShowTables_pargs::~InfinityService_ShowTables_pargs() noexcept {
 }
 
 
-uint32_t InfinityService_ShowIndex_pargs::write(::apache::thrift::protocol::TProtocol* oprot) const {
+uint32_t InfinityService_ShowTables_pargs::write(::apache::thrift::protocol::TProtocol* oprot) const {
   uint32_t xfer = 0;
   ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
-  xfer += oprot->writeStructBegin("InfinityService_ShowIndex_pargs");
+  xfer += oprot->writeStructBegin("InfinityService_ShowTables_pargs");
 
   xfer += oprot->writeFieldBegin("request", ::apache::thrift::protocol::T_STRUCT, 1);
   xfer += (*(this->request)).write(oprot);
@@ -4742,11 +4742,11 @@ uint32_t InfinityService_ShowIndex_pargs::write(::apache::thrift::protocol::TPro
 }
 
 
-InfinityService_ShowIndex_result::~InfinityService_ShowIndex_result() noexcept {
+InfinityService_ShowTables_result::~InfinityService_ShowTables_result() noexcept {
 }
 
 
-uint32_t InfinityService_ShowIndex_result::read(::apache::thrift::protocol::TProtocol* iprot) {
+uint32_t InfinityService_ShowTables_result::read(::apache::thrift::protocol::TProtocol* iprot) {
 
   ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
   uint32_t xfer = 0;
@@ -4787,11 +4787,11 @@ uint32_t InfinityService_ShowIndex_result::read(::apache::thrift::protocol::TPro
   return xfer;
 }
 
-uint32_t InfinityService_ShowIndex_result::write(::apache::thrift::protocol::TProtocol* oprot) const {
+uint32_t InfinityService_ShowTables_result::write(::apache::thrift::protocol::TProtocol* oprot) const {
 
   uint32_t xfer = 0;
 
-  xfer += oprot->writeStructBegin("InfinityService_ShowIndex_result");
+  xfer += oprot->writeStructBegin("InfinityService_ShowTables_result");
 
   if (this->__isset.success) {
     xfer += oprot->writeFieldBegin("success", ::apache::thrift::protocol::T_STRUCT, 0);
@@ -4804,11 +4804,11 @@ uint32_t InfinityService_ShowIndex_result::write(::apache::thrift::protocol::TPr
 }
 
 
-InfinityService_ShowIndex_presult::~InfinityService_ShowIndex_presult() noexcept {
+InfinityService_ShowTables_presult::~InfinityService_ShowTables_presult() noexcept {
 }
 
 
-uint32_t InfinityService_ShowIndex_presult::read(::apache::thrift::protocol::TProtocol* iprot) {
+uint32_t InfinityService_ShowTables_presult::read(::apache::thrift::protocol::TProtocol* iprot) {
 
   ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
   uint32_t xfer = 0;
@@ -4849,1070 +4849,961 @@ uint32_t InfinityService_ShowIndex_presult::read(::apache::thrift::protocol::TPr
   return xfer;
 }
 
-void InfinityServiceClient::Connect(CommonResponse& _return)
-{
-  send_Connect();
-  recv_Connect(_return);
+
+InfinityService_GetDatabase_args::~InfinityService_GetDatabase_args() noexcept {
 }
 
-void InfinityServiceClient::send_Connect()
-{
-  int32_t cseqid = 0;
-  oprot_->writeMessageBegin("Connect", ::apache::thrift::protocol::T_CALL, cseqid);
 
-  InfinityService_Connect_pargs args;
-  args.write(oprot_);
+uint32_t InfinityService_GetDatabase_args::read(::apache::thrift::protocol::TProtocol* iprot) {
 
-  oprot_->writeMessageEnd();
-  oprot_->getTransport()->writeEnd();
-  oprot_->getTransport()->flush();
-}
+  ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
 
-void InfinityServiceClient::recv_Connect(CommonResponse& _return)
-{
+  xfer += iprot->readStructBegin(fname);
 
-  int32_t rseqid = 0;
-  std::string fname;
-  ::apache::thrift::protocol::TMessageType mtype;
+  using ::apache::thrift::protocol::TProtocolException;
 
-  iprot_->readMessageBegin(fname, mtype, rseqid);
-  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
-    ::apache::thrift::TApplicationException x;
-    x.read(iprot_);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
-    throw x;
-  }
-  if (mtype != ::apache::thrift::protocol::T_REPLY) {
-    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
-  }
-  if (fname.compare("Connect") != 0) {
-    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
-  }
-  InfinityService_Connect_presult result;
-  result.success = &_return;
-  result.read(iprot_);
-  iprot_->readMessageEnd();
-  iprot_->getTransport()->readEnd();
 
-  if (result.__isset.success) {
-    // _return pointer has now been filled
-    return;
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->request.read(iprot);
+          this->__isset.request = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
   }
-  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "Connect failed: unknown result");
-}
 
-void InfinityServiceClient::Disconnect(CommonResponse& _return, const CommonRequest& request)
-{
-  send_Disconnect(request);
-  recv_Disconnect(_return);
+  xfer += iprot->readStructEnd();
+
+  return xfer;
 }
 
-void InfinityServiceClient::send_Disconnect(const CommonRequest& request)
-{
-  int32_t cseqid = 0;
-  oprot_->writeMessageBegin("Disconnect", ::apache::thrift::protocol::T_CALL, cseqid);
+uint32_t InfinityService_GetDatabase_args::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+  xfer += oprot->writeStructBegin("InfinityService_GetDatabase_args");
 
-  InfinityService_Disconnect_pargs args;
-  args.request = &request;
-  args.write(oprot_);
+  xfer += oprot->writeFieldBegin("request", ::apache::thrift::protocol::T_STRUCT, 1);
+  xfer += this->request.write(oprot);
+  xfer += oprot->writeFieldEnd();
 
-  oprot_->writeMessageEnd();
-  oprot_->getTransport()->writeEnd();
-  oprot_->getTransport()->flush();
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
 }
 
-void InfinityServiceClient::recv_Disconnect(CommonResponse& _return)
-{
 
-  int32_t rseqid = 0;
-  std::string fname;
-  ::apache::thrift::protocol::TMessageType mtype;
+InfinityService_GetDatabase_pargs::~InfinityService_GetDatabase_pargs() noexcept {
+}
 
-  iprot_->readMessageBegin(fname, mtype, rseqid);
-  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
-    ::apache::thrift::TApplicationException x;
-    x.read(iprot_);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
-    throw x;
-  }
-  if (mtype != ::apache::thrift::protocol::T_REPLY) {
-    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
-  }
-  if (fname.compare("Disconnect") != 0) {
-    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
-  }
-  InfinityService_Disconnect_presult result;
-  result.success = &_return;
-  result.read(iprot_);
-  iprot_->readMessageEnd();
-  iprot_->getTransport()->readEnd();
 
-  if (result.__isset.success) {
-    // _return pointer has now been filled
-    return;
-  }
-  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "Disconnect failed: unknown result");
-}
+uint32_t InfinityService_GetDatabase_pargs::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+  xfer += oprot->writeStructBegin("InfinityService_GetDatabase_pargs");
 
-void InfinityServiceClient::CreateDatabase(CommonResponse& _return, const CreateDatabaseRequest& request)
-{
-  send_CreateDatabase(request);
-  recv_CreateDatabase(_return);
-}
+  xfer += oprot->writeFieldBegin("request", ::apache::thrift::protocol::T_STRUCT, 1);
+  xfer += (*(this->request)).write(oprot);
+  xfer += oprot->writeFieldEnd();
 
-void InfinityServiceClient::send_CreateDatabase(const CreateDatabaseRequest& request)
-{
-  int32_t cseqid = 0;
-  oprot_->writeMessageBegin("CreateDatabase", ::apache::thrift::protocol::T_CALL, cseqid);
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
 
-  InfinityService_CreateDatabase_pargs args;
-  args.request = &request;
-  args.write(oprot_);
 
-  oprot_->writeMessageEnd();
-  oprot_->getTransport()->writeEnd();
-  oprot_->getTransport()->flush();
+InfinityService_GetDatabase_result::~InfinityService_GetDatabase_result() noexcept {
 }
 
-void InfinityServiceClient::recv_CreateDatabase(CommonResponse& _return)
-{
 
-  int32_t rseqid = 0;
+uint32_t InfinityService_GetDatabase_result::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+  uint32_t xfer = 0;
   std::string fname;
-  ::apache::thrift::protocol::TMessageType mtype;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
 
-  iprot_->readMessageBegin(fname, mtype, rseqid);
-  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
-    ::apache::thrift::TApplicationException x;
-    x.read(iprot_);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
-    throw x;
-  }
-  if (mtype != ::apache::thrift::protocol::T_REPLY) {
-    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
-  }
-  if (fname.compare("CreateDatabase") != 0) {
-    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
-  }
-  InfinityService_CreateDatabase_presult result;
-  result.success = &_return;
-  result.read(iprot_);
-  iprot_->readMessageEnd();
-  iprot_->getTransport()->readEnd();
+  xfer += iprot->readStructBegin(fname);
 
-  if (result.__isset.success) {
-    // _return pointer has now been filled
-    return;
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 0:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->success.read(iprot);
+          this->__isset.success = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
   }
-  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "CreateDatabase failed: unknown result");
-}
 
-void InfinityServiceClient::DropDatabase(CommonResponse& _return, const DropDatabaseRequest& request)
-{
-  send_DropDatabase(request);
-  recv_DropDatabase(_return);
+  xfer += iprot->readStructEnd();
+
+  return xfer;
 }
 
-void InfinityServiceClient::send_DropDatabase(const DropDatabaseRequest& request)
-{
-  int32_t cseqid = 0;
-  oprot_->writeMessageBegin("DropDatabase", ::apache::thrift::protocol::T_CALL, cseqid);
+uint32_t InfinityService_GetDatabase_result::write(::apache::thrift::protocol::TProtocol* oprot) const {
 
-  InfinityService_DropDatabase_pargs args;
-  args.request = &request;
-  args.write(oprot_);
+  uint32_t xfer = 0;
 
-  oprot_->writeMessageEnd();
-  oprot_->getTransport()->writeEnd();
-  oprot_->getTransport()->flush();
+  xfer += oprot->writeStructBegin("InfinityService_GetDatabase_result");
+
+  if (this->__isset.success) {
+    xfer += oprot->writeFieldBegin("success", ::apache::thrift::protocol::T_STRUCT, 0);
+    xfer += this->success.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  }
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
 }
 
-void InfinityServiceClient::recv_DropDatabase(CommonResponse& _return)
-{
 
-  int32_t rseqid = 0;
+InfinityService_GetDatabase_presult::~InfinityService_GetDatabase_presult() noexcept {
+}
+
+
+uint32_t InfinityService_GetDatabase_presult::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+  uint32_t xfer = 0;
   std::string fname;
-  ::apache::thrift::protocol::TMessageType mtype;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
 
-  iprot_->readMessageBegin(fname, mtype, rseqid);
-  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
-    ::apache::thrift::TApplicationException x;
-    x.read(iprot_);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
-    throw x;
-  }
-  if (mtype != ::apache::thrift::protocol::T_REPLY) {
-    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
-  }
-  if (fname.compare("DropDatabase") != 0) {
-    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
-  }
-  InfinityService_DropDatabase_presult result;
-  result.success = &_return;
-  result.read(iprot_);
-  iprot_->readMessageEnd();
-  iprot_->getTransport()->readEnd();
+  xfer += iprot->readStructBegin(fname);
 
-  if (result.__isset.success) {
-    // _return pointer has now been filled
-    return;
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 0:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += (*(this->success)).read(iprot);
+          this->__isset.success = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
   }
-  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "DropDatabase failed: unknown result");
-}
 
-void InfinityServiceClient::CreateTable(CommonResponse& _return, const CreateTableRequest& request)
-{
-  send_CreateTable(request);
-  recv_CreateTable(_return);
-}
+  xfer += iprot->readStructEnd();
 
-void InfinityServiceClient::send_CreateTable(const CreateTableRequest& request)
-{
-  int32_t cseqid = 0;
-  oprot_->writeMessageBegin("CreateTable", ::apache::thrift::protocol::T_CALL, cseqid);
+  return xfer;
+}
 
-  InfinityService_CreateTable_pargs args;
-  args.request = &request;
-  args.write(oprot_);
 
-  oprot_->writeMessageEnd();
-  oprot_->getTransport()->writeEnd();
-  oprot_->getTransport()->flush();
+InfinityService_GetTable_args::~InfinityService_GetTable_args() noexcept {
 }
 
-void InfinityServiceClient::recv_CreateTable(CommonResponse& _return)
-{
 
-  int32_t rseqid = 0;
+uint32_t InfinityService_GetTable_args::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+  uint32_t xfer = 0;
   std::string fname;
-  ::apache::thrift::protocol::TMessageType mtype;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
 
-  iprot_->readMessageBegin(fname, mtype, rseqid);
-  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
-    ::apache::thrift::TApplicationException x;
-    x.read(iprot_);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
-    throw x;
-  }
-  if (mtype != ::apache::thrift::protocol::T_REPLY) {
-    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
-  }
-  if (fname.compare("CreateTable") != 0) {
-    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
-  }
-  InfinityService_CreateTable_presult result;
-  result.success = &_return;
-  result.read(iprot_);
-  iprot_->readMessageEnd();
-  iprot_->getTransport()->readEnd();
+  xfer += iprot->readStructBegin(fname);
 
-  if (result.__isset.success) {
-    // _return pointer has now been filled
-    return;
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->request.read(iprot);
+          this->__isset.request = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
   }
-  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "CreateTable failed: unknown result");
-}
 
-void InfinityServiceClient::DropTable(CommonResponse& _return, const DropTableRequest& request)
-{
-  send_DropTable(request);
-  recv_DropTable(_return);
+  xfer += iprot->readStructEnd();
+
+  return xfer;
 }
 
-void InfinityServiceClient::send_DropTable(const DropTableRequest& request)
-{
-  int32_t cseqid = 0;
-  oprot_->writeMessageBegin("DropTable", ::apache::thrift::protocol::T_CALL, cseqid);
+uint32_t InfinityService_GetTable_args::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+  xfer += oprot->writeStructBegin("InfinityService_GetTable_args");
 
-  InfinityService_DropTable_pargs args;
-  args.request = &request;
-  args.write(oprot_);
+  xfer += oprot->writeFieldBegin("request", ::apache::thrift::protocol::T_STRUCT, 1);
+  xfer += this->request.write(oprot);
+  xfer += oprot->writeFieldEnd();
 
-  oprot_->writeMessageEnd();
-  oprot_->getTransport()->writeEnd();
-  oprot_->getTransport()->flush();
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
 }
 
-void InfinityServiceClient::recv_DropTable(CommonResponse& _return)
-{
 
-  int32_t rseqid = 0;
-  std::string fname;
-  ::apache::thrift::protocol::TMessageType mtype;
+InfinityService_GetTable_pargs::~InfinityService_GetTable_pargs() noexcept {
+}
 
-  iprot_->readMessageBegin(fname, mtype, rseqid);
-  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
-    ::apache::thrift::TApplicationException x;
-    x.read(iprot_);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
-    throw x;
-  }
-  if (mtype != ::apache::thrift::protocol::T_REPLY) {
-    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
-  }
-  if (fname.compare("DropTable") != 0) {
-    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
-  }
-  InfinityService_DropTable_presult result;
-  result.success = &_return;
-  result.read(iprot_);
-  iprot_->readMessageEnd();
-  iprot_->getTransport()->readEnd();
 
-  if (result.__isset.success) {
-    // _return pointer has now been filled
-    return;
-  }
-  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "DropTable failed: unknown result");
-}
+uint32_t InfinityService_GetTable_pargs::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+  xfer += oprot->writeStructBegin("InfinityService_GetTable_pargs");
 
-void InfinityServiceClient::Insert(CommonResponse& _return, const InsertRequest& request)
-{
-  send_Insert(request);
-  recv_Insert(_return);
-}
+  xfer += oprot->writeFieldBegin("request", ::apache::thrift::protocol::T_STRUCT, 1);
+  xfer += (*(this->request)).write(oprot);
+  xfer += oprot->writeFieldEnd();
 
-void InfinityServiceClient::send_Insert(const InsertRequest& request)
-{
-  int32_t cseqid = 0;
-  oprot_->writeMessageBegin("Insert", ::apache::thrift::protocol::T_CALL, cseqid);
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
 
-  InfinityService_Insert_pargs args;
-  args.request = &request;
-  args.write(oprot_);
 
-  oprot_->writeMessageEnd();
-  oprot_->getTransport()->writeEnd();
-  oprot_->getTransport()->flush();
+InfinityService_GetTable_result::~InfinityService_GetTable_result() noexcept {
 }
 
-void InfinityServiceClient::recv_Insert(CommonResponse& _return)
-{
 
-  int32_t rseqid = 0;
+uint32_t InfinityService_GetTable_result::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+  uint32_t xfer = 0;
   std::string fname;
-  ::apache::thrift::protocol::TMessageType mtype;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
 
-  iprot_->readMessageBegin(fname, mtype, rseqid);
-  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
-    ::apache::thrift::TApplicationException x;
-    x.read(iprot_);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
-    throw x;
-  }
-  if (mtype != ::apache::thrift::protocol::T_REPLY) {
-    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
-  }
-  if (fname.compare("Insert") != 0) {
-    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
-  }
-  InfinityService_Insert_presult result;
-  result.success = &_return;
-  result.read(iprot_);
-  iprot_->readMessageEnd();
-  iprot_->getTransport()->readEnd();
+  xfer += iprot->readStructBegin(fname);
 
-  if (result.__isset.success) {
-    // _return pointer has now been filled
-    return;
-  }
-  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "Insert failed: unknown result");
-}
+  using ::apache::thrift::protocol::TProtocolException;
 
-void InfinityServiceClient::Import(CommonResponse& _return, const ImportRequest& request)
-{
-  send_Import(request);
-  recv_Import(_return);
-}
 
-void InfinityServiceClient::send_Import(const ImportRequest& request)
-{
-  int32_t cseqid = 0;
-  oprot_->writeMessageBegin("Import", ::apache::thrift::protocol::T_CALL, cseqid);
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 0:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->success.read(iprot);
+          this->__isset.success = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
 
-  InfinityService_Import_pargs args;
-  args.request = &request;
-  args.write(oprot_);
+  xfer += iprot->readStructEnd();
 
-  oprot_->writeMessageEnd();
-  oprot_->getTransport()->writeEnd();
-  oprot_->getTransport()->flush();
+  return xfer;
 }
 
-void InfinityServiceClient::recv_Import(CommonResponse& _return)
-{
+uint32_t InfinityService_GetTable_result::write(::apache::thrift::protocol::TProtocol* oprot) const {
 
-  int32_t rseqid = 0;
-  std::string fname;
-  ::apache::thrift::protocol::TMessageType mtype;
+  uint32_t xfer = 0;
 
-  iprot_->readMessageBegin(fname, mtype, rseqid);
-  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
-    ::apache::thrift::TApplicationException x;
-    x.read(iprot_);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
-    throw x;
-  }
-  if (mtype != ::apache::thrift::protocol::T_REPLY) {
-    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
-  }
-  if (fname.compare("Import") != 0) {
-    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
-  }
-  InfinityService_Import_presult result;
-  result.success = &_return;
-  result.read(iprot_);
-  iprot_->readMessageEnd();
-  iprot_->getTransport()->readEnd();
+  xfer += oprot->writeStructBegin("InfinityService_GetTable_result");
 
-  if (result.__isset.success) {
-    // _return pointer has now been filled
-    return;
+  if (this->__isset.success) {
+    xfer += oprot->writeFieldBegin("success", ::apache::thrift::protocol::T_STRUCT, 0);
+    xfer += this->success.write(oprot);
+    xfer += oprot->writeFieldEnd();
   }
-  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "Import failed: unknown result");
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
 }
 
-void InfinityServiceClient::Select(SelectResponse& _return, const SelectRequest& request)
-{
-  send_Select(request);
-  recv_Select(_return);
+
+InfinityService_GetTable_presult::~InfinityService_GetTable_presult() noexcept {
 }
 
-void InfinityServiceClient::send_Select(const SelectRequest& request)
-{
-  int32_t cseqid = 0;
-  oprot_->writeMessageBegin("Select", ::apache::thrift::protocol::T_CALL, cseqid);
 
-  InfinityService_Select_pargs args;
-  args.request = &request;
-  args.write(oprot_);
+uint32_t InfinityService_GetTable_presult::read(::apache::thrift::protocol::TProtocol* iprot) {
 
-  oprot_->writeMessageEnd();
-  oprot_->getTransport()->writeEnd();
-  oprot_->getTransport()->flush();
-}
+  ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
 
-void InfinityServiceClient::recv_Select(SelectResponse& _return)
-{
+  xfer += iprot->readStructBegin(fname);
 
-  int32_t rseqid = 0;
-  std::string fname;
-  ::apache::thrift::protocol::TMessageType mtype;
+  using ::apache::thrift::protocol::TProtocolException;
 
-  iprot_->readMessageBegin(fname, mtype, rseqid);
-  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
-    ::apache::thrift::TApplicationException x;
-    x.read(iprot_);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
-    throw x;
-  }
-  if (mtype != ::apache::thrift::protocol::T_REPLY) {
-    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
-  }
-  if (fname.compare("Select") != 0) {
-    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
-  }
-  InfinityService_Select_presult result;
-  result.success = &_return;
-  result.read(iprot_);
-  iprot_->readMessageEnd();
-  iprot_->getTransport()->readEnd();
 
-  if (result.__isset.success) {
-    // _return pointer has now been filled
-    return;
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 0:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += (*(this->success)).read(iprot);
+          this->__isset.success = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
   }
-  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "Select failed: unknown result");
-}
 
-void InfinityServiceClient::Explain(SelectResponse& _return, const ExplainRequest& request)
-{
-  send_Explain(request);
-  recv_Explain(_return);
-}
+  xfer += iprot->readStructEnd();
 
-void InfinityServiceClient::send_Explain(const ExplainRequest& request)
-{
-  int32_t cseqid = 0;
-  oprot_->writeMessageBegin("Explain", ::apache::thrift::protocol::T_CALL, cseqid);
+  return xfer;
+}
 
-  InfinityService_Explain_pargs args;
-  args.request = &request;
-  args.write(oprot_);
 
-  oprot_->writeMessageEnd();
-  oprot_->getTransport()->writeEnd();
-  oprot_->getTransport()->flush();
+InfinityService_CreateIndex_args::~InfinityService_CreateIndex_args() noexcept {
 }
 
-void InfinityServiceClient::recv_Explain(SelectResponse& _return)
-{
 
-  int32_t rseqid = 0;
+uint32_t InfinityService_CreateIndex_args::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+  uint32_t xfer = 0;
   std::string fname;
-  ::apache::thrift::protocol::TMessageType mtype;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
 
-  iprot_->readMessageBegin(fname, mtype, rseqid);
-  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
-    ::apache::thrift::TApplicationException x;
-    x.read(iprot_);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
-    throw x;
-  }
-  if (mtype != ::apache::thrift::protocol::T_REPLY) {
-    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
-  }
-  if (fname.compare("Explain") != 0) {
-    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
-  }
-  InfinityService_Explain_presult result;
-  result.success = &_return;
-  result.read(iprot_);
-  iprot_->readMessageEnd();
-  iprot_->getTransport()->readEnd();
+  xfer += iprot->readStructBegin(fname);
 
-  if (result.__isset.success) {
-    // _return pointer has now been filled
-    return;
-  }
-  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "Explain failed: unknown result");
-}
+  using ::apache::thrift::protocol::TProtocolException;
 
-void InfinityServiceClient::Delete(CommonResponse& _return, const DeleteRequest& request)
-{
-  send_Delete(request);
-  recv_Delete(_return);
-}
 
-void InfinityServiceClient::send_Delete(const DeleteRequest& request)
-{
-  int32_t cseqid = 0;
-  oprot_->writeMessageBegin("Delete", ::apache::thrift::protocol::T_CALL, cseqid);
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->request.read(iprot);
+          this->__isset.request = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
 
-  InfinityService_Delete_pargs args;
-  args.request = &request;
-  args.write(oprot_);
+  xfer += iprot->readStructEnd();
 
-  oprot_->writeMessageEnd();
-  oprot_->getTransport()->writeEnd();
-  oprot_->getTransport()->flush();
+  return xfer;
 }
 
-void InfinityServiceClient::recv_Delete(CommonResponse& _return)
-{
-
-  int32_t rseqid = 0;
-  std::string fname;
-  ::apache::thrift::protocol::TMessageType mtype;
+uint32_t InfinityService_CreateIndex_args::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+  xfer += oprot->writeStructBegin("InfinityService_CreateIndex_args");
 
-  iprot_->readMessageBegin(fname, mtype, rseqid);
-  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
-    ::apache::thrift::TApplicationException x;
-    x.read(iprot_);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
-    throw x;
-  }
-  if (mtype != ::apache::thrift::protocol::T_REPLY) {
-    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
-  }
-  if (fname.compare("Delete") != 0) {
-    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
-  }
-  InfinityService_Delete_presult result;
-  result.success = &_return;
-  result.read(iprot_);
-  iprot_->readMessageEnd();
-  iprot_->getTransport()->readEnd();
+  xfer += oprot->writeFieldBegin("request", ::apache::thrift::protocol::T_STRUCT, 1);
+  xfer += this->request.write(oprot);
+  xfer += oprot->writeFieldEnd();
 
-  if (result.__isset.success) {
-    // _return pointer has now been filled
-    return;
-  }
-  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "Delete failed: unknown result");
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
 }
 
-void InfinityServiceClient::Update(CommonResponse& _return, const UpdateRequest& request)
-{
-  send_Update(request);
-  recv_Update(_return);
+
+InfinityService_CreateIndex_pargs::~InfinityService_CreateIndex_pargs() noexcept {
 }
 
-void InfinityServiceClient::send_Update(const UpdateRequest& request)
-{
-  int32_t cseqid = 0;
-  oprot_->writeMessageBegin("Update", ::apache::thrift::protocol::T_CALL, cseqid);
 
-  InfinityService_Update_pargs args;
-  args.request = &request;
-  args.write(oprot_);
+uint32_t InfinityService_CreateIndex_pargs::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+  xfer += oprot->writeStructBegin("InfinityService_CreateIndex_pargs");
 
-  oprot_->writeMessageEnd();
-  oprot_->getTransport()->writeEnd();
-  oprot_->getTransport()->flush();
+  xfer += oprot->writeFieldBegin("request", ::apache::thrift::protocol::T_STRUCT, 1);
+  xfer += (*(this->request)).write(oprot);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
 }
 
-void InfinityServiceClient::recv_Update(CommonResponse& _return)
-{
 
-  int32_t rseqid = 0;
-  std::string fname;
-  ::apache::thrift::protocol::TMessageType mtype;
+InfinityService_CreateIndex_result::~InfinityService_CreateIndex_result() noexcept {
+}
 
-  iprot_->readMessageBegin(fname, mtype, rseqid);
-  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
-    ::apache::thrift::TApplicationException x;
-    x.read(iprot_);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
-    throw x;
-  }
-  if (mtype != ::apache::thrift::protocol::T_REPLY) {
-    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
-  }
-  if (fname.compare("Update") != 0) {
-    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
-  }
-  InfinityService_Update_presult result;
-  result.success = &_return;
-  result.read(iprot_);
-  iprot_->readMessageEnd();
-  iprot_->getTransport()->readEnd();
 
-  if (result.__isset.success) {
-    // _return pointer has now been filled
-    return;
-  }
-  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "Update failed: unknown result");
-}
+uint32_t InfinityService_CreateIndex_result::read(::apache::thrift::protocol::TProtocol* iprot) {
 
-void InfinityServiceClient::UploadFileChunk(UploadResponse& _return, const FileChunk& request)
-{
-  send_UploadFileChunk(request);
-  recv_UploadFileChunk(_return);
-}
+  ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
 
-void InfinityServiceClient::send_UploadFileChunk(const FileChunk& request)
-{
-  int32_t cseqid = 0;
-  oprot_->writeMessageBegin("UploadFileChunk", ::apache::thrift::protocol::T_CALL, cseqid);
+  xfer += iprot->readStructBegin(fname);
 
-  InfinityService_UploadFileChunk_pargs args;
-  args.request = &request;
-  args.write(oprot_);
+  using ::apache::thrift::protocol::TProtocolException;
 
-  oprot_->writeMessageEnd();
-  oprot_->getTransport()->writeEnd();
-  oprot_->getTransport()->flush();
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 0:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->success.read(iprot);
+          this->__isset.success = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
 }
 
-void InfinityServiceClient::recv_UploadFileChunk(UploadResponse& _return)
-{
+uint32_t InfinityService_CreateIndex_result::write(::apache::thrift::protocol::TProtocol* oprot) const {
 
-  int32_t rseqid = 0;
-  std::string fname;
-  ::apache::thrift::protocol::TMessageType mtype;
+  uint32_t xfer = 0;
 
-  iprot_->readMessageBegin(fname, mtype, rseqid);
-  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
-    ::apache::thrift::TApplicationException x;
-    x.read(iprot_);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
-    throw x;
-  }
-  if (mtype != ::apache::thrift::protocol::T_REPLY) {
-    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
-  }
-  if (fname.compare("UploadFileChunk") != 0) {
-    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
-  }
-  InfinityService_UploadFileChunk_presult result;
-  result.success = &_return;
-  result.read(iprot_);
-  iprot_->readMessageEnd();
-  iprot_->getTransport()->readEnd();
+  xfer += oprot->writeStructBegin("InfinityService_CreateIndex_result");
 
-  if (result.__isset.success) {
-    // _return pointer has now been filled
-    return;
+  if (this->__isset.success) {
+    xfer += oprot->writeFieldBegin("success", ::apache::thrift::protocol::T_STRUCT, 0);
+    xfer += this->success.write(oprot);
+    xfer += oprot->writeFieldEnd();
   }
-  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "UploadFileChunk failed: unknown result");
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
 }
 
-void InfinityServiceClient::ListDatabase(ListDatabaseResponse& _return, const ListDatabaseRequest& request)
-{
-  send_ListDatabase(request);
-  recv_ListDatabase(_return);
+
+InfinityService_CreateIndex_presult::~InfinityService_CreateIndex_presult() noexcept {
 }
 
-void InfinityServiceClient::send_ListDatabase(const ListDatabaseRequest& request)
-{
-  int32_t cseqid = 0;
-  oprot_->writeMessageBegin("ListDatabase", ::apache::thrift::protocol::T_CALL, cseqid);
 
-  InfinityService_ListDatabase_pargs args;
-  args.request = &request;
-  args.write(oprot_);
+uint32_t InfinityService_CreateIndex_presult::read(::apache::thrift::protocol::TProtocol* iprot) {
 
-  oprot_->writeMessageEnd();
-  oprot_->getTransport()->writeEnd();
-  oprot_->getTransport()->flush();
-}
+  ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
 
-void InfinityServiceClient::recv_ListDatabase(ListDatabaseResponse& _return)
-{
+  xfer += iprot->readStructBegin(fname);
 
-  int32_t rseqid = 0;
-  std::string fname;
-  ::apache::thrift::protocol::TMessageType mtype;
+  using ::apache::thrift::protocol::TProtocolException;
 
-  iprot_->readMessageBegin(fname, mtype, rseqid);
-  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
-    ::apache::thrift::TApplicationException x;
-    x.read(iprot_);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
-    throw x;
-  }
-  if (mtype != ::apache::thrift::protocol::T_REPLY) {
-    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
-  }
-  if (fname.compare("ListDatabase") != 0) {
-    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
-  }
-  InfinityService_ListDatabase_presult result;
-  result.success = &_return;
-  result.read(iprot_);
-  iprot_->readMessageEnd();
-  iprot_->getTransport()->readEnd();
 
-  if (result.__isset.success) {
-    // _return pointer has now been filled
-    return;
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 0:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += (*(this->success)).read(iprot);
+          this->__isset.success = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
   }
-  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "ListDatabase failed: unknown result");
-}
 
-void InfinityServiceClient::ListTable(ListTableResponse& _return, const ListTableRequest& request)
-{
-  send_ListTable(request);
-  recv_ListTable(_return);
-}
+  xfer += iprot->readStructEnd();
 
-void InfinityServiceClient::send_ListTable(const ListTableRequest& request)
-{
-  int32_t cseqid = 0;
-  oprot_->writeMessageBegin("ListTable", ::apache::thrift::protocol::T_CALL, cseqid);
+  return xfer;
+}
 
-  InfinityService_ListTable_pargs args;
-  args.request = &request;
-  args.write(oprot_);
 
-  oprot_->writeMessageEnd();
-  oprot_->getTransport()->writeEnd();
-  oprot_->getTransport()->flush();
+InfinityService_DropIndex_args::~InfinityService_DropIndex_args() noexcept {
 }
 
-void InfinityServiceClient::recv_ListTable(ListTableResponse& _return)
-{
 
-  int32_t rseqid = 0;
+uint32_t InfinityService_DropIndex_args::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+  uint32_t xfer = 0;
   std::string fname;
-  ::apache::thrift::protocol::TMessageType mtype;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
 
-  iprot_->readMessageBegin(fname, mtype, rseqid);
-  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
-    ::apache::thrift::TApplicationException x;
-    x.read(iprot_);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
-    throw x;
-  }
-  if (mtype != ::apache::thrift::protocol::T_REPLY) {
-    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
-  }
-  if (fname.compare("ListTable") != 0) {
-    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
-  }
-  InfinityService_ListTable_presult result;
-  result.success = &_return;
-  result.read(iprot_);
-  iprot_->readMessageEnd();
-  iprot_->getTransport()->readEnd();
+  xfer += iprot->readStructBegin(fname);
 
-  if (result.__isset.success) {
-    // _return pointer has now been filled
-    return;
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->request.read(iprot);
+          this->__isset.request = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
   }
-  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "ListTable failed: unknown result");
-}
 
-void InfinityServiceClient::ListIndex(ListIndexResponse& _return, const ListIndexRequest& request)
-{
-  send_ListIndex(request);
-  recv_ListIndex(_return);
+  xfer += iprot->readStructEnd();
+
+  return xfer;
 }
 
-void InfinityServiceClient::send_ListIndex(const ListIndexRequest& request)
-{
-  int32_t cseqid = 0;
-  oprot_->writeMessageBegin("ListIndex", ::apache::thrift::protocol::T_CALL, cseqid);
+uint32_t InfinityService_DropIndex_args::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+  xfer += oprot->writeStructBegin("InfinityService_DropIndex_args");
 
-  InfinityService_ListIndex_pargs args;
-  args.request = &request;
-  args.write(oprot_);
+  xfer += oprot->writeFieldBegin("request", ::apache::thrift::protocol::T_STRUCT, 1);
+  xfer += this->request.write(oprot);
+  xfer += oprot->writeFieldEnd();
 
-  oprot_->writeMessageEnd();
-  oprot_->getTransport()->writeEnd();
-  oprot_->getTransport()->flush();
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
 }
 
-void InfinityServiceClient::recv_ListIndex(ListIndexResponse& _return)
-{
 
-  int32_t rseqid = 0;
-  std::string fname;
-  ::apache::thrift::protocol::TMessageType mtype;
+InfinityService_DropIndex_pargs::~InfinityService_DropIndex_pargs() noexcept {
+}
 
-  iprot_->readMessageBegin(fname, mtype, rseqid);
-  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
-    ::apache::thrift::TApplicationException x;
-    x.read(iprot_);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
-    throw x;
-  }
-  if (mtype != ::apache::thrift::protocol::T_REPLY) {
-    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
-  }
-  if (fname.compare("ListIndex") != 0) {
-    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
-  }
-  InfinityService_ListIndex_presult result;
-  result.success = &_return;
-  result.read(iprot_);
-  iprot_->readMessageEnd();
-  iprot_->getTransport()->readEnd();
 
-  if (result.__isset.success) {
-    // _return pointer has now been filled
-    return;
-  }
-  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "ListIndex failed: unknown result");
-}
+uint32_t InfinityService_DropIndex_pargs::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+  xfer += oprot->writeStructBegin("InfinityService_DropIndex_pargs");
 
-void InfinityServiceClient::ShowVariable(SelectResponse& _return, const ShowVariableRequest& request)
-{
-  send_ShowVariable(request);
-  recv_ShowVariable(_return);
-}
+  xfer += oprot->writeFieldBegin("request", ::apache::thrift::protocol::T_STRUCT, 1);
+  xfer += (*(this->request)).write(oprot);
+  xfer += oprot->writeFieldEnd();
 
-void InfinityServiceClient::send_ShowVariable(const ShowVariableRequest& request)
-{
-  int32_t cseqid = 0;
-  oprot_->writeMessageBegin("ShowVariable", ::apache::thrift::protocol::T_CALL, cseqid);
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
 
-  InfinityService_ShowVariable_pargs args;
-  args.request = &request;
-  args.write(oprot_);
 
-  oprot_->writeMessageEnd();
-  oprot_->getTransport()->writeEnd();
-  oprot_->getTransport()->flush();
+InfinityService_DropIndex_result::~InfinityService_DropIndex_result() noexcept {
 }
 
-void InfinityServiceClient::recv_ShowVariable(SelectResponse& _return)
-{
 
-  int32_t rseqid = 0;
+uint32_t InfinityService_DropIndex_result::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+  uint32_t xfer = 0;
   std::string fname;
-  ::apache::thrift::protocol::TMessageType mtype;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
 
-  iprot_->readMessageBegin(fname, mtype, rseqid);
-  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
-    ::apache::thrift::TApplicationException x;
-    x.read(iprot_);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
-    throw x;
-  }
-  if (mtype != ::apache::thrift::protocol::T_REPLY) {
-    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
-  }
-  if (fname.compare("ShowVariable") != 0) {
-    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
-  }
-  InfinityService_ShowVariable_presult result;
-  result.success = &_return;
-  result.read(iprot_);
-  iprot_->readMessageEnd();
-  iprot_->getTransport()->readEnd();
+  xfer += iprot->readStructBegin(fname);
 
-  if (result.__isset.success) {
-    // _return pointer has now been filled
-    return;
-  }
-  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "ShowVariable failed: unknown result");
-}
+  using ::apache::thrift::protocol::TProtocolException;
 
-void InfinityServiceClient::ShowTable(ShowTableResponse& _return, const ShowTableRequest& request)
-{
-  send_ShowTable(request);
-  recv_ShowTable(_return);
-}
 
-void InfinityServiceClient::send_ShowTable(const ShowTableRequest& request)
-{
-  int32_t cseqid = 0;
-  oprot_->writeMessageBegin("ShowTable", ::apache::thrift::protocol::T_CALL, cseqid);
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 0:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->success.read(iprot);
+          this->__isset.success = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
 
-  InfinityService_ShowTable_pargs args;
-  args.request = &request;
-  args.write(oprot_);
+  xfer += iprot->readStructEnd();
 
-  oprot_->writeMessageEnd();
-  oprot_->getTransport()->writeEnd();
-  oprot_->getTransport()->flush();
+  return xfer;
 }
 
-void InfinityServiceClient::recv_ShowTable(ShowTableResponse& _return)
-{
+uint32_t InfinityService_DropIndex_result::write(::apache::thrift::protocol::TProtocol* oprot) const {
 
-  int32_t rseqid = 0;
-  std::string fname;
-  ::apache::thrift::protocol::TMessageType mtype;
+  uint32_t xfer = 0;
 
-  iprot_->readMessageBegin(fname, mtype, rseqid);
-  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
-    ::apache::thrift::TApplicationException x;
-    x.read(iprot_);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
-    throw x;
-  }
-  if (mtype != ::apache::thrift::protocol::T_REPLY) {
-    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
-  }
-  if (fname.compare("ShowTable") != 0) {
-    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
-  }
-  InfinityService_ShowTable_presult result;
-  result.success = &_return;
-  result.read(iprot_);
-  iprot_->readMessageEnd();
-  iprot_->getTransport()->readEnd();
+  xfer += oprot->writeStructBegin("InfinityService_DropIndex_result");
 
-  if (result.__isset.success) {
-    // _return pointer has now been filled
-    return;
+  if (this->__isset.success) {
+    xfer += oprot->writeFieldBegin("success", ::apache::thrift::protocol::T_STRUCT, 0);
+    xfer += this->success.write(oprot);
+    xfer += oprot->writeFieldEnd();
   }
-  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "ShowTable failed: unknown result");
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
 }
 
-void InfinityServiceClient::ShowColumns(SelectResponse& _return, const ShowColumnsRequest& request)
-{
-  send_ShowColumns(request);
-  recv_ShowColumns(_return);
+
+InfinityService_DropIndex_presult::~InfinityService_DropIndex_presult() noexcept {
 }
 
-void InfinityServiceClient::send_ShowColumns(const ShowColumnsRequest& request)
-{
-  int32_t cseqid = 0;
-  oprot_->writeMessageBegin("ShowColumns", ::apache::thrift::protocol::T_CALL, cseqid);
 
-  InfinityService_ShowColumns_pargs args;
-  args.request = &request;
-  args.write(oprot_);
+uint32_t InfinityService_DropIndex_presult::read(::apache::thrift::protocol::TProtocol* iprot) {
 
-  oprot_->writeMessageEnd();
-  oprot_->getTransport()->writeEnd();
-  oprot_->getTransport()->flush();
-}
+  ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
 
-void InfinityServiceClient::recv_ShowColumns(SelectResponse& _return)
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 0:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += (*(this->success)).read(iprot);
+          this->__isset.success = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+
+InfinityService_ShowIndex_args::~InfinityService_ShowIndex_args() noexcept {
+}
+
+
+uint32_t InfinityService_ShowIndex_args::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->request.read(iprot);
+          this->__isset.request = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t InfinityService_ShowIndex_args::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+  xfer += oprot->writeStructBegin("InfinityService_ShowIndex_args");
+
+  xfer += oprot->writeFieldBegin("request", ::apache::thrift::protocol::T_STRUCT, 1);
+  xfer += this->request.write(oprot);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+
+InfinityService_ShowIndex_pargs::~InfinityService_ShowIndex_pargs() noexcept {
+}
+
+
+uint32_t InfinityService_ShowIndex_pargs::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+  xfer += oprot->writeStructBegin("InfinityService_ShowIndex_pargs");
+
+  xfer += oprot->writeFieldBegin("request", ::apache::thrift::protocol::T_STRUCT, 1);
+  xfer += (*(this->request)).write(oprot);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+
+InfinityService_ShowIndex_result::~InfinityService_ShowIndex_result() noexcept {
+}
+
+
+uint32_t InfinityService_ShowIndex_result::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 0:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->success.read(iprot);
+          this->__isset.success = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t InfinityService_ShowIndex_result::write(::apache::thrift::protocol::TProtocol* oprot) const {
+
+  uint32_t xfer = 0;
+
+  xfer += oprot->writeStructBegin("InfinityService_ShowIndex_result");
+
+  if (this->__isset.success) {
+    xfer += oprot->writeFieldBegin("success", ::apache::thrift::protocol::T_STRUCT, 0);
+    xfer += this->success.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  }
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+
+InfinityService_ShowIndex_presult::~InfinityService_ShowIndex_presult() noexcept {
+}
+
+
+uint32_t InfinityService_ShowIndex_presult::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 0:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += (*(this->success)).read(iprot);
+          this->__isset.success = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+void InfinityServiceClient::Connect(CommonResponse& _return)
+{
+  send_Connect();
+  recv_Connect(_return);
+}
+
+void InfinityServiceClient::send_Connect()
+{
+  int32_t cseqid = 0;
+  oprot_->writeMessageBegin("Connect", ::apache::thrift::protocol::T_CALL, cseqid);
+
+  InfinityService_Connect_pargs args;
+  args.write(oprot_);
+
+  oprot_->writeMessageEnd();
+  oprot_->getTransport()->writeEnd();
+  oprot_->getTransport()->flush();
+}
+
+void InfinityServiceClient::recv_Connect(CommonResponse& _return)
 {
 
   int32_t rseqid = 0;
@@ -5932,12 +5823,12 @@ void InfinityServiceClient::recv_ShowColumns(SelectResponse& _return)
     iprot_->readMessageEnd();
     iprot_->getTransport()->readEnd();
   }
-  if (fname.compare("ShowColumns") != 0) {
+  if (fname.compare("Connect") != 0) {
     iprot_->skip(::apache::thrift::protocol::T_STRUCT);
     iprot_->readMessageEnd();
     iprot_->getTransport()->readEnd();
   }
-  InfinityService_ShowColumns_presult result;
+  InfinityService_Connect_presult result;
   result.success = &_return;
   result.read(iprot_);
   iprot_->readMessageEnd();
@@ -5947,21 +5838,21 @@ void InfinityServiceClient::recv_ShowColumns(SelectResponse& _return)
     // _return pointer has now been filled
     return;
   }
-  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "ShowColumns failed: unknown result");
+  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "Connect failed: unknown result");
 }
 
-void InfinityServiceClient::ShowDatabase(ShowDatabaseResponse& _return, const ShowDatabaseRequest& request)
+void InfinityServiceClient::Disconnect(CommonResponse& _return, const CommonRequest& request)
 {
-  send_ShowDatabase(request);
-  recv_ShowDatabase(_return);
+  send_Disconnect(request);
+  recv_Disconnect(_return);
 }
 
-void InfinityServiceClient::send_ShowDatabase(const ShowDatabaseRequest& request)
+void InfinityServiceClient::send_Disconnect(const CommonRequest& request)
 {
   int32_t cseqid = 0;
-  oprot_->writeMessageBegin("ShowDatabase", ::apache::thrift::protocol::T_CALL, cseqid);
+  oprot_->writeMessageBegin("Disconnect", ::apache::thrift::protocol::T_CALL, cseqid);
 
-  InfinityService_ShowDatabase_pargs args;
+  InfinityService_Disconnect_pargs args;
   args.request = &request;
   args.write(oprot_);
 
@@ -5970,7 +5861,7 @@ void InfinityServiceClient::send_ShowDatabase(const ShowDatabaseRequest& request
   oprot_->getTransport()->flush();
 }
 
-void InfinityServiceClient::recv_ShowDatabase(ShowDatabaseResponse& _return)
+void InfinityServiceClient::recv_Disconnect(CommonResponse& _return)
 {
 
   int32_t rseqid = 0;
@@ -5990,12 +5881,12 @@ void InfinityServiceClient::recv_ShowDatabase(ShowDatabaseResponse& _return)
     iprot_->readMessageEnd();
     iprot_->getTransport()->readEnd();
   }
-  if (fname.compare("ShowDatabase") != 0) {
+  if (fname.compare("Disconnect") != 0) {
     iprot_->skip(::apache::thrift::protocol::T_STRUCT);
     iprot_->readMessageEnd();
     iprot_->getTransport()->readEnd();
   }
-  InfinityService_ShowDatabase_presult result;
+  InfinityService_Disconnect_presult result;
   result.success = &_return;
   result.read(iprot_);
   iprot_->readMessageEnd();
@@ -6005,21 +5896,21 @@ void InfinityServiceClient::recv_ShowDatabase(ShowDatabaseResponse& _return)
     // _return pointer has now been filled
     return;
   }
-  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "ShowDatabase failed: unknown result");
+  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "Disconnect failed: unknown result");
 }
 
-void InfinityServiceClient::ShowTables(SelectResponse& _return, const ShowTablesRequest& request)
+void InfinityServiceClient::CreateDatabase(CommonResponse& _return, const CreateDatabaseRequest& request)
 {
-  send_ShowTables(request);
-  recv_ShowTables(_return);
+  send_CreateDatabase(request);
+  recv_CreateDatabase(_return);
 }
 
-void InfinityServiceClient::send_ShowTables(const ShowTablesRequest& request)
+void InfinityServiceClient::send_CreateDatabase(const CreateDatabaseRequest& request)
 {
   int32_t cseqid = 0;
-  oprot_->writeMessageBegin("ShowTables", ::apache::thrift::protocol::T_CALL, cseqid);
+  oprot_->writeMessageBegin("CreateDatabase", ::apache::thrift::protocol::T_CALL, cseqid);
 
-  InfinityService_ShowTables_pargs args;
+  InfinityService_CreateDatabase_pargs args;
   args.request = &request;
   args.write(oprot_);
 
@@ -6028,7 +5919,7 @@ void InfinityServiceClient::send_ShowTables(const ShowTablesRequest& request)
   oprot_->getTransport()->flush();
 }
 
-void InfinityServiceClient::recv_ShowTables(SelectResponse& _return)
+void InfinityServiceClient::recv_CreateDatabase(CommonResponse& _return)
 {
 
   int32_t rseqid = 0;
@@ -6048,12 +5939,12 @@ void InfinityServiceClient::recv_ShowTables(SelectResponse& _return)
     iprot_->readMessageEnd();
     iprot_->getTransport()->readEnd();
   }
-  if (fname.compare("ShowTables") != 0) {
+  if (fname.compare("CreateDatabase") != 0) {
     iprot_->skip(::apache::thrift::protocol::T_STRUCT);
     iprot_->readMessageEnd();
     iprot_->getTransport()->readEnd();
   }
-  InfinityService_ShowTables_presult result;
+  InfinityService_CreateDatabase_presult result;
   result.success = &_return;
   result.read(iprot_);
   iprot_->readMessageEnd();
@@ -6063,21 +5954,21 @@ void InfinityServiceClient::recv_ShowTables(SelectResponse& _return)
     // _return pointer has now been filled
     return;
   }
-  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "ShowTables failed: unknown result");
+  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "CreateDatabase failed: unknown result");
 }
 
-void InfinityServiceClient::GetDatabase(CommonResponse& _return, const GetDatabaseRequest& request)
+void InfinityServiceClient::DropDatabase(CommonResponse& _return, const DropDatabaseRequest& request)
 {
-  send_GetDatabase(request);
-  recv_GetDatabase(_return);
+  send_DropDatabase(request);
+  recv_DropDatabase(_return);
 }
 
-void InfinityServiceClient::send_GetDatabase(const GetDatabaseRequest& request)
+void InfinityServiceClient::send_DropDatabase(const DropDatabaseRequest& request)
 {
   int32_t cseqid = 0;
-  oprot_->writeMessageBegin("GetDatabase", ::apache::thrift::protocol::T_CALL, cseqid);
+  oprot_->writeMessageBegin("DropDatabase", ::apache::thrift::protocol::T_CALL, cseqid);
 
-  InfinityService_GetDatabase_pargs args;
+  InfinityService_DropDatabase_pargs args;
   args.request = &request;
   args.write(oprot_);
 
@@ -6086,7 +5977,7 @@ void InfinityServiceClient::send_GetDatabase(const GetDatabaseRequest& request)
   oprot_->getTransport()->flush();
 }
 
-void InfinityServiceClient::recv_GetDatabase(CommonResponse& _return)
+void InfinityServiceClient::recv_DropDatabase(CommonResponse& _return)
 {
 
   int32_t rseqid = 0;
@@ -6106,12 +5997,12 @@ void InfinityServiceClient::recv_GetDatabase(CommonResponse& _return)
     iprot_->readMessageEnd();
     iprot_->getTransport()->readEnd();
   }
-  if (fname.compare("GetDatabase") != 0) {
+  if (fname.compare("DropDatabase") != 0) {
     iprot_->skip(::apache::thrift::protocol::T_STRUCT);
     iprot_->readMessageEnd();
     iprot_->getTransport()->readEnd();
   }
-  InfinityService_GetDatabase_presult result;
+  InfinityService_DropDatabase_presult result;
   result.success = &_return;
   result.read(iprot_);
   iprot_->readMessageEnd();
@@ -6121,21 +6012,21 @@ void InfinityServiceClient::recv_GetDatabase(CommonResponse& _return)
     // _return pointer has now been filled
     return;
   }
-  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "GetDatabase failed: unknown result");
+  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "DropDatabase failed: unknown result");
 }
 
-void InfinityServiceClient::GetTable(CommonResponse& _return, const GetTableRequest& request)
+void InfinityServiceClient::CreateTable(CommonResponse& _return, const CreateTableRequest& request)
 {
-  send_GetTable(request);
-  recv_GetTable(_return);
+  send_CreateTable(request);
+  recv_CreateTable(_return);
 }
 
-void InfinityServiceClient::send_GetTable(const GetTableRequest& request)
+void InfinityServiceClient::send_CreateTable(const CreateTableRequest& request)
 {
   int32_t cseqid = 0;
-  oprot_->writeMessageBegin("GetTable", ::apache::thrift::protocol::T_CALL, cseqid);
+  oprot_->writeMessageBegin("CreateTable", ::apache::thrift::protocol::T_CALL, cseqid);
 
-  InfinityService_GetTable_pargs args;
+  InfinityService_CreateTable_pargs args;
   args.request = &request;
   args.write(oprot_);
 
@@ -6144,7 +6035,7 @@ void InfinityServiceClient::send_GetTable(const GetTableRequest& request)
   oprot_->getTransport()->flush();
 }
 
-void InfinityServiceClient::recv_GetTable(CommonResponse& _return)
+void InfinityServiceClient::recv_CreateTable(CommonResponse& _return)
 {
 
   int32_t rseqid = 0;
@@ -6164,12 +6055,12 @@ void InfinityServiceClient::recv_GetTable(CommonResponse& _return)
     iprot_->readMessageEnd();
     iprot_->getTransport()->readEnd();
   }
-  if (fname.compare("GetTable") != 0) {
+  if (fname.compare("CreateTable") != 0) {
     iprot_->skip(::apache::thrift::protocol::T_STRUCT);
     iprot_->readMessageEnd();
     iprot_->getTransport()->readEnd();
   }
-  InfinityService_GetTable_presult result;
+  InfinityService_CreateTable_presult result;
   result.success = &_return;
   result.read(iprot_);
   iprot_->readMessageEnd();
@@ -6179,21 +6070,21 @@ void InfinityServiceClient::recv_GetTable(CommonResponse& _return)
     // _return pointer has now been filled
     return;
   }
-  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "GetTable failed: unknown result");
+  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "CreateTable failed: unknown result");
 }
 
-void InfinityServiceClient::CreateIndex(CommonResponse& _return, const CreateIndexRequest& request)
+void InfinityServiceClient::DropTable(CommonResponse& _return, const DropTableRequest& request)
 {
-  send_CreateIndex(request);
-  recv_CreateIndex(_return);
+  send_DropTable(request);
+  recv_DropTable(_return);
 }
 
-void InfinityServiceClient::send_CreateIndex(const CreateIndexRequest& request)
+void InfinityServiceClient::send_DropTable(const DropTableRequest& request)
 {
   int32_t cseqid = 0;
-  oprot_->writeMessageBegin("CreateIndex", ::apache::thrift::protocol::T_CALL, cseqid);
+  oprot_->writeMessageBegin("DropTable", ::apache::thrift::protocol::T_CALL, cseqid);
 
-  InfinityService_CreateIndex_pargs args;
+  InfinityService_DropTable_pargs args;
   args.request = &request;
   args.write(oprot_);
 
@@ -6202,7 +6093,7 @@ void InfinityServiceClient::send_CreateIndex(const CreateIndexRequest& request)
   oprot_->getTransport()->flush();
 }
 
-void InfinityServiceClient::recv_CreateIndex(CommonResponse& _return)
+void InfinityServiceClient::recv_DropTable(CommonResponse& _return)
 {
 
   int32_t rseqid = 0;
@@ -6222,12 +6113,12 @@ void InfinityServiceClient::recv_CreateIndex(CommonResponse& _return)
     iprot_->readMessageEnd();
     iprot_->getTransport()->readEnd();
   }
-  if (fname.compare("CreateIndex") != 0) {
+  if (fname.compare("DropTable") != 0) {
     iprot_->skip(::apache::thrift::protocol::T_STRUCT);
     iprot_->readMessageEnd();
     iprot_->getTransport()->readEnd();
   }
-  InfinityService_CreateIndex_presult result;
+  InfinityService_DropTable_presult result;
   result.success = &_return;
   result.read(iprot_);
   iprot_->readMessageEnd();
@@ -6237,21 +6128,21 @@ void InfinityServiceClient::recv_CreateIndex(CommonResponse& _return)
     // _return pointer has now been filled
     return;
   }
-  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "CreateIndex failed: unknown result");
+  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "DropTable failed: unknown result");
 }
 
-void InfinityServiceClient::DropIndex(CommonResponse& _return, const DropIndexRequest& request)
+void InfinityServiceClient::Insert(CommonResponse& _return, const InsertRequest& request)
 {
-  send_DropIndex(request);
-  recv_DropIndex(_return);
+  send_Insert(request);
+  recv_Insert(_return);
 }
 
-void InfinityServiceClient::send_DropIndex(const DropIndexRequest& request)
+void InfinityServiceClient::send_Insert(const InsertRequest& request)
 {
   int32_t cseqid = 0;
-  oprot_->writeMessageBegin("DropIndex", ::apache::thrift::protocol::T_CALL, cseqid);
+  oprot_->writeMessageBegin("Insert", ::apache::thrift::protocol::T_CALL, cseqid);
 
-  InfinityService_DropIndex_pargs args;
+  InfinityService_Insert_pargs args;
   args.request = &request;
   args.write(oprot_);
 
@@ -6260,7 +6151,7 @@ void InfinityServiceClient::send_DropIndex(const DropIndexRequest& request)
   oprot_->getTransport()->flush();
 }
 
-void InfinityServiceClient::recv_DropIndex(CommonResponse& _return)
+void InfinityServiceClient::recv_Insert(CommonResponse& _return)
 {
 
   int32_t rseqid = 0;
@@ -6280,12 +6171,12 @@ void InfinityServiceClient::recv_DropIndex(CommonResponse& _return)
     iprot_->readMessageEnd();
     iprot_->getTransport()->readEnd();
   }
-  if (fname.compare("DropIndex") != 0) {
+  if (fname.compare("Insert") != 0) {
     iprot_->skip(::apache::thrift::protocol::T_STRUCT);
     iprot_->readMessageEnd();
     iprot_->getTransport()->readEnd();
   }
-  InfinityService_DropIndex_presult result;
+  InfinityService_Insert_presult result;
   result.success = &_return;
   result.read(iprot_);
   iprot_->readMessageEnd();
@@ -6295,21 +6186,21 @@ void InfinityServiceClient::recv_DropIndex(CommonResponse& _return)
     // _return pointer has now been filled
     return;
   }
-  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "DropIndex failed: unknown result");
+  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "Insert failed: unknown result");
 }
 
-void InfinityServiceClient::ShowIndex(ShowIndexResponse& _return, const ShowIndexRequest& request)
+void InfinityServiceClient::Import(CommonResponse& _return, const ImportRequest& request)
 {
-  send_ShowIndex(request);
-  recv_ShowIndex(_return);
+  send_Import(request);
+  recv_Import(_return);
 }
 
-void InfinityServiceClient::send_ShowIndex(const ShowIndexRequest& request)
+void InfinityServiceClient::send_Import(const ImportRequest& request)
 {
   int32_t cseqid = 0;
-  oprot_->writeMessageBegin("ShowIndex", ::apache::thrift::protocol::T_CALL, cseqid);
+  oprot_->writeMessageBegin("Import", ::apache::thrift::protocol::T_CALL, cseqid);
 
-  InfinityService_ShowIndex_pargs args;
+  InfinityService_Import_pargs args;
   args.request = &request;
   args.write(oprot_);
 
@@ -6318,7 +6209,7 @@ void InfinityServiceClient::send_ShowIndex(const ShowIndexRequest& request)
   oprot_->getTransport()->flush();
 }
 
-void InfinityServiceClient::recv_ShowIndex(ShowIndexResponse& _return)
+void InfinityServiceClient::recv_Import(CommonResponse& _return)
 {
 
   int32_t rseqid = 0;
@@ -6338,12 +6229,12 @@ void InfinityServiceClient::recv_ShowIndex(ShowIndexResponse& _return)
     iprot_->readMessageEnd();
     iprot_->getTransport()->readEnd();
   }
-  if (fname.compare("ShowIndex") != 0) {
+  if (fname.compare("Import") != 0) {
     iprot_->skip(::apache::thrift::protocol::T_STRUCT);
     iprot_->readMessageEnd();
     iprot_->getTransport()->readEnd();
   }
-  InfinityService_ShowIndex_presult result;
+  InfinityService_Import_presult result;
   result.success = &_return;
   result.read(iprot_);
   iprot_->readMessageEnd();
@@ -6353,1248 +6244,1394 @@ void InfinityServiceClient::recv_ShowIndex(ShowIndexResponse& _return)
     // _return pointer has now been filled
     return;
   }
-  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "ShowIndex failed: unknown result");
+  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "Import failed: unknown result");
 }
 
-bool InfinityServiceProcessor::dispatchCall(::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, const std::string& fname, int32_t seqid, void* callContext) {
-  ProcessMap::iterator pfn;
-  pfn = processMap_.find(fname);
-  if (pfn == processMap_.end()) {
-    iprot->skip(::apache::thrift::protocol::T_STRUCT);
-    iprot->readMessageEnd();
-    iprot->getTransport()->readEnd();
-    ::apache::thrift::TApplicationException x(::apache::thrift::TApplicationException::UNKNOWN_METHOD, "Invalid method name: '"+fname+"'");
-    oprot->writeMessageBegin(fname, ::apache::thrift::protocol::T_EXCEPTION, seqid);
-    x.write(oprot);
-    oprot->writeMessageEnd();
-    oprot->getTransport()->writeEnd();
-    oprot->getTransport()->flush();
-    return true;
-  }
-  (this->*(pfn->second))(seqid, iprot, oprot, callContext);
-  return true;
+void InfinityServiceClient::InsertColumnar(CommonResponse& _return, const InsertColumnarRequest& request)
+{
+  send_InsertColumnar(request);
+  recv_InsertColumnar(_return);
 }
 
-void InfinityServiceProcessor::process_Connect(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+void InfinityServiceClient::send_InsertColumnar(const InsertColumnarRequest& request)
 {
-  void* ctx = nullptr;
-  if (this->eventHandler_.get() != nullptr) {
-    ctx = this->eventHandler_->getContext("InfinityService.Connect", callContext);
-  }
-  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "InfinityService.Connect");
+  int32_t cseqid = 0;
+  oprot_->writeMessageBegin("InsertColumnar", ::apache::thrift::protocol::T_CALL, cseqid);
 
-  if (this->eventHandler_.get() != nullptr) {
-    this->eventHandler_->preRead(ctx, "InfinityService.Connect");
-  }
+  InfinityService_InsertColumnar_pargs args;
+  args.request = &request;
+  args.write(oprot_);
 
-  InfinityService_Connect_args args;
-  args.read(iprot);
-  iprot->readMessageEnd();
-  uint32_t bytes = iprot->getTransport()->readEnd();
+  oprot_->writeMessageEnd();
+  oprot_->getTransport()->writeEnd();
+  oprot_->getTransport()->flush();
+}
 
-  if (this->eventHandler_.get() != nullptr) {
-    this->eventHandler_->postRead(ctx, "InfinityService.Connect", bytes);
-  }
+void InfinityServiceClient::recv_InsertColumnar(CommonResponse& _return)
+{
 
-  InfinityService_Connect_result result;
-  try {
-    iface_->Connect(result.success);
-    result.__isset.success = true;
-  } catch (const std::exception& e) {
-    if (this->eventHandler_.get() != nullptr) {
-      this->eventHandler_->handlerError(ctx, "InfinityService.Connect");
-    }
+  int32_t rseqid = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TMessageType mtype;
 
-    ::apache::thrift::TApplicationException x(e.what());
-    oprot->writeMessageBegin("Connect", ::apache::thrift::protocol::T_EXCEPTION, seqid);
-    x.write(oprot);
-    oprot->writeMessageEnd();
-    oprot->getTransport()->writeEnd();
-    oprot->getTransport()->flush();
-    return;
+  iprot_->readMessageBegin(fname, mtype, rseqid);
+  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
+    ::apache::thrift::TApplicationException x;
+    x.read(iprot_);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+    throw x;
   }
-
-  if (this->eventHandler_.get() != nullptr) {
-    this->eventHandler_->preWrite(ctx, "InfinityService.Connect");
+  if (mtype != ::apache::thrift::protocol::T_REPLY) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
   }
+  if (fname.compare("InsertColumnar") != 0) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  InfinityService_InsertColumnar_presult result;
+  result.success = &_return;
+  result.read(iprot_);
+  iprot_->readMessageEnd();
+  iprot_->getTransport()->readEnd();
 
-  oprot->writeMessageBegin("Connect", ::apache::thrift::protocol::T_REPLY, seqid);
-  result.write(oprot);
-  oprot->writeMessageEnd();
-  bytes = oprot->getTransport()->writeEnd();
-  oprot->getTransport()->flush();
-
-  if (this->eventHandler_.get() != nullptr) {
-    this->eventHandler_->postWrite(ctx, "InfinityService.Connect", bytes);
+  if (result.__isset.success) {
+    // _return pointer has now been filled
+    return;
   }
+  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "InsertColumnar failed: unknown result");
 }
 
-void InfinityServiceProcessor::process_Disconnect(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+void InfinityServiceClient::Select(SelectResponse& _return, const SelectRequest& request)
 {
-  void* ctx = nullptr;
-  if (this->eventHandler_.get() != nullptr) {
-    ctx = this->eventHandler_->getContext("InfinityService.Disconnect", callContext);
-  }
-  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "InfinityService.Disconnect");
+  send_Select(request);
+  recv_Select(_return);
+}
 
-  if (this->eventHandler_.get() != nullptr) {
-    this->eventHandler_->preRead(ctx, "InfinityService.Disconnect");
-  }
+void InfinityServiceClient::send_Select(const SelectRequest& request)
+{
+  int32_t cseqid = 0;
+  oprot_->writeMessageBegin("Select", ::apache::thrift::protocol::T_CALL, cseqid);
 
-  InfinityService_Disconnect_args args;
-  args.read(iprot);
-  iprot->readMessageEnd();
-  uint32_t bytes = iprot->getTransport()->readEnd();
+  InfinityService_Select_pargs args;
+  args.request = &request;
+  args.write(oprot_);
 
-  if (this->eventHandler_.get() != nullptr) {
-    this->eventHandler_->postRead(ctx, "InfinityService.Disconnect", bytes);
-  }
+  oprot_->writeMessageEnd();
+  oprot_->getTransport()->writeEnd();
+  oprot_->getTransport()->flush();
+}
 
-  InfinityService_Disconnect_result result;
-  try {
-    iface_->Disconnect(result.success, args.request);
-    result.__isset.success = true;
-  } catch (const std::exception& e) {
-    if (this->eventHandler_.get() != nullptr) {
-      this->eventHandler_->handlerError(ctx, "InfinityService.Disconnect");
-    }
+void InfinityServiceClient::recv_Select(SelectResponse& _return)
+{
 
-    ::apache::thrift::TApplicationException x(e.what());
-    oprot->writeMessageBegin("Disconnect", ::apache::thrift::protocol::T_EXCEPTION, seqid);
-    x.write(oprot);
-    oprot->writeMessageEnd();
-    oprot->getTransport()->writeEnd();
-    oprot->getTransport()->flush();
-    return;
-  }
+  int32_t rseqid = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TMessageType mtype;
 
-  if (this->eventHandler_.get() != nullptr) {
-    this->eventHandler_->preWrite(ctx, "InfinityService.Disconnect");
+  iprot_->readMessageBegin(fname, mtype, rseqid);
+  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
+    ::apache::thrift::TApplicationException x;
+    x.read(iprot_);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+    throw x;
   }
+  if (mtype != ::apache::thrift::protocol::T_REPLY) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  if (fname.compare("Select") != 0) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  InfinityService_Select_presult result;
+  result.success = &_return;
+  result.read(iprot_);
+  iprot_->readMessageEnd();
+  iprot_->getTransport()->readEnd();
 
-  oprot->writeMessageBegin("Disconnect", ::apache::thrift::protocol::T_REPLY, seqid);
-  result.write(oprot);
-  oprot->writeMessageEnd();
-  bytes = oprot->getTransport()->writeEnd();
-  oprot->getTransport()->flush();
-
-  if (this->eventHandler_.get() != nullptr) {
-    this->eventHandler_->postWrite(ctx, "InfinityService.Disconnect", bytes);
+  if (result.__isset.success) {
+    // _return pointer has now been filled
+    return;
   }
+  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "Select failed: unknown result");
 }
 
-void InfinityServiceProcessor::process_CreateDatabase(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+void InfinityServiceClient::BatchSelect(BatchSelectResponse& _return, const BatchSelectRequest& request)
 {
-  void* ctx = nullptr;
-  if (this->eventHandler_.get() != nullptr) {
-    ctx = this->eventHandler_->getContext("InfinityService.CreateDatabase", callContext);
-  }
-  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "InfinityService.CreateDatabase");
+  send_BatchSelect(request);
+  recv_BatchSelect(_return);
+}
 
-  if (this->eventHandler_.get() != nullptr) {
-    this->eventHandler_->preRead(ctx, "InfinityService.CreateDatabase");
-  }
+void InfinityServiceClient::send_BatchSelect(const BatchSelectRequest& request)
+{
+  int32_t cseqid = 0;
+  oprot_->writeMessageBegin("BatchSelect", ::apache::thrift::protocol::T_CALL, cseqid);
 
-  InfinityService_CreateDatabase_args args;
-  args.read(iprot);
-  iprot->readMessageEnd();
-  uint32_t bytes = iprot->getTransport()->readEnd();
+  InfinityService_BatchSelect_pargs args;
+  args.request = &request;
+  args.write(oprot_);
 
-  if (this->eventHandler_.get() != nullptr) {
-    this->eventHandler_->postRead(ctx, "InfinityService.CreateDatabase", bytes);
-  }
+  oprot_->writeMessageEnd();
+  oprot_->getTransport()->writeEnd();
+  oprot_->getTransport()->flush();
+}
 
-  InfinityService_CreateDatabase_result result;
-  try {
-    iface_->CreateDatabase(result.success, args.request);
-    result.__isset.success = true;
-  } catch (const std::exception& e) {
-    if (this->eventHandler_.get() != nullptr) {
-      this->eventHandler_->handlerError(ctx, "InfinityService.CreateDatabase");
-    }
+void InfinityServiceClient::recv_BatchSelect(BatchSelectResponse& _return)
+{
 
-    ::apache::thrift::TApplicationException x(e.what());
-    oprot->writeMessageBegin("CreateDatabase", ::apache::thrift::protocol::T_EXCEPTION, seqid);
-    x.write(oprot);
-    oprot->writeMessageEnd();
-    oprot->getTransport()->writeEnd();
-    oprot->getTransport()->flush();
-    return;
-  }
+  int32_t rseqid = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TMessageType mtype;
 
-  if (this->eventHandler_.get() != nullptr) {
-    this->eventHandler_->preWrite(ctx, "InfinityService.CreateDatabase");
+  iprot_->readMessageBegin(fname, mtype, rseqid);
+  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
+    ::apache::thrift::TApplicationException x;
+    x.read(iprot_);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+    throw x;
   }
+  if (mtype != ::apache::thrift::protocol::T_REPLY) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  if (fname.compare("BatchSelect") != 0) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  InfinityService_BatchSelect_presult result;
+  result.success = &_return;
+  result.read(iprot_);
+  iprot_->readMessageEnd();
+  iprot_->getTransport()->readEnd();
 
-  oprot->writeMessageBegin("CreateDatabase", ::apache::thrift::protocol::T_REPLY, seqid);
-  result.write(oprot);
-  oprot->writeMessageEnd();
-  bytes = oprot->getTransport()->writeEnd();
-  oprot->getTransport()->flush();
-
-  if (this->eventHandler_.get() != nullptr) {
-    this->eventHandler_->postWrite(ctx, "InfinityService.CreateDatabase", bytes);
+  if (result.__isset.success) {
+    // _return pointer has now been filled
+    return;
   }
+  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "BatchSelect failed: unknown result");
 }
 
-void InfinityServiceProcessor::process_DropDatabase(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+void InfinityServiceClient::OpenCursor(SelectResponse& _return, const SelectRequest& request)
 {
-  void* ctx = nullptr;
-  if (this->eventHandler_.get() != nullptr) {
-    ctx = this->eventHandler_->getContext("InfinityService.DropDatabase", callContext);
-  }
-  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "InfinityService.DropDatabase");
+  send_OpenCursor(request);
+  recv_OpenCursor(_return);
+}
 
-  if (this->eventHandler_.get() != nullptr) {
-    this->eventHandler_->preRead(ctx, "InfinityService.DropDatabase");
-  }
+void InfinityServiceClient::send_OpenCursor(const SelectRequest& request)
+{
+  int32_t cseqid = 0;
+  oprot_->writeMessageBegin("OpenCursor", ::apache::thrift::protocol::T_CALL, cseqid);
 
-  InfinityService_DropDatabase_args args;
-  args.read(iprot);
-  iprot->readMessageEnd();
-  uint32_t bytes = iprot->getTransport()->readEnd();
+  InfinityService_OpenCursor_pargs args;
+  args.request = &request;
+  args.write(oprot_);
 
-  if (this->eventHandler_.get() != nullptr) {
-    this->eventHandler_->postRead(ctx, "InfinityService.DropDatabase", bytes);
-  }
+  oprot_->writeMessageEnd();
+  oprot_->getTransport()->writeEnd();
+  oprot_->getTransport()->flush();
+}
 
-  InfinityService_DropDatabase_result result;
-  try {
-    iface_->DropDatabase(result.success, args.request);
-    result.__isset.success = true;
-  } catch (const std::exception& e) {
-    if (this->eventHandler_.get() != nullptr) {
-      this->eventHandler_->handlerError(ctx, "InfinityService.DropDatabase");
-    }
+void InfinityServiceClient::recv_OpenCursor(SelectResponse& _return)
+{
 
-    ::apache::thrift::TApplicationException x(e.what());
-    oprot->writeMessageBegin("DropDatabase", ::apache::thrift::protocol::T_EXCEPTION, seqid);
-    x.write(oprot);
-    oprot->writeMessageEnd();
-    oprot->getTransport()->writeEnd();
-    oprot->getTransport()->flush();
-    return;
-  }
+  int32_t rseqid = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TMessageType mtype;
 
-  if (this->eventHandler_.get() != nullptr) {
-    this->eventHandler_->preWrite(ctx, "InfinityService.DropDatabase");
+  iprot_->readMessageBegin(fname, mtype, rseqid);
+  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
+    ::apache::thrift::TApplicationException x;
+    x.read(iprot_);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+    throw x;
   }
+  if (mtype != ::apache::thrift::protocol::T_REPLY) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  if (fname.compare("OpenCursor") != 0) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  InfinityService_OpenCursor_presult result;
+  result.success = &_return;
+  result.read(iprot_);
+  iprot_->readMessageEnd();
+  iprot_->getTransport()->readEnd();
 
-  oprot->writeMessageBegin("DropDatabase", ::apache::thrift::protocol::T_REPLY, seqid);
-  result.write(oprot);
-  oprot->writeMessageEnd();
-  bytes = oprot->getTransport()->writeEnd();
-  oprot->getTransport()->flush();
-
-  if (this->eventHandler_.get() != nullptr) {
-    this->eventHandler_->postWrite(ctx, "InfinityService.DropDatabase", bytes);
+  if (result.__isset.success) {
+    // _return pointer has now been filled
+    return;
   }
+  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "OpenCursor failed: unknown result");
 }
 
-void InfinityServiceProcessor::process_CreateTable(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+void InfinityServiceClient::FetchCursor(SelectResponse& _return, const CursorRequest& request)
 {
-  void* ctx = nullptr;
-  if (this->eventHandler_.get() != nullptr) {
-    ctx = this->eventHandler_->getContext("InfinityService.CreateTable", callContext);
-  }
-  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "InfinityService.CreateTable");
+  send_FetchCursor(request);
+  recv_FetchCursor(_return);
+}
 
-  if (this->eventHandler_.get() != nullptr) {
-    this->eventHandler_->preRead(ctx, "InfinityService.CreateTable");
-  }
+void InfinityServiceClient::send_FetchCursor(const CursorRequest& request)
+{
+  int32_t cseqid = 0;
+  oprot_->writeMessageBegin("FetchCursor", ::apache::thrift::protocol::T_CALL, cseqid);
 
-  InfinityService_CreateTable_args args;
-  args.read(iprot);
-  iprot->readMessageEnd();
-  uint32_t bytes = iprot->getTransport()->readEnd();
+  InfinityService_FetchCursor_pargs args;
+  args.request = &request;
+  args.write(oprot_);
 
-  if (this->eventHandler_.get() != nullptr) {
-    this->eventHandler_->postRead(ctx, "InfinityService.CreateTable", bytes);
-  }
+  oprot_->writeMessageEnd();
+  oprot_->getTransport()->writeEnd();
+  oprot_->getTransport()->flush();
+}
 
-  InfinityService_CreateTable_result result;
-  try {
-    iface_->CreateTable(result.success, args.request);
-    result.__isset.success = true;
-  } catch (const std::exception& e) {
-    if (this->eventHandler_.get() != nullptr) {
-      this->eventHandler_->handlerError(ctx, "InfinityService.CreateTable");
-    }
+void InfinityServiceClient::recv_FetchCursor(SelectResponse& _return)
+{
 
-    ::apache::thrift::TApplicationException x(e.what());
-    oprot->writeMessageBegin("CreateTable", ::apache::thrift::protocol::T_EXCEPTION, seqid);
-    x.write(oprot);
-    oprot->writeMessageEnd();
-    oprot->getTransport()->writeEnd();
-    oprot->getTransport()->flush();
-    return;
-  }
+  int32_t rseqid = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TMessageType mtype;
 
-  if (this->eventHandler_.get() != nullptr) {
-    this->eventHandler_->preWrite(ctx, "InfinityService.CreateTable");
+  iprot_->readMessageBegin(fname, mtype, rseqid);
+  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
+    ::apache::thrift::TApplicationException x;
+    x.read(iprot_);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+    throw x;
   }
+  if (mtype != ::apache::thrift::protocol::T_REPLY) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  if (fname.compare("FetchCursor") != 0) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  InfinityService_FetchCursor_presult result;
+  result.success = &_return;
+  result.read(iprot_);
+  iprot_->readMessageEnd();
+  iprot_->getTransport()->readEnd();
 
-  oprot->writeMessageBegin("CreateTable", ::apache::thrift::protocol::T_REPLY, seqid);
-  result.write(oprot);
-  oprot->writeMessageEnd();
-  bytes = oprot->getTransport()->writeEnd();
-  oprot->getTransport()->flush();
-
-  if (this->eventHandler_.get() != nullptr) {
-    this->eventHandler_->postWrite(ctx, "InfinityService.CreateTable", bytes);
+  if (result.__isset.success) {
+    // _return pointer has now been filled
+    return;
   }
+  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "FetchCursor failed: unknown result");
 }
 
-void InfinityServiceProcessor::process_DropTable(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+void InfinityServiceClient::Explain(SelectResponse& _return, const ExplainRequest& request)
 {
-  void* ctx = nullptr;
-  if (this->eventHandler_.get() != nullptr) {
-    ctx = this->eventHandler_->getContext("InfinityService.DropTable", callContext);
-  }
-  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "InfinityService.DropTable");
+  send_Explain(request);
+  recv_Explain(_return);
+}
 
-  if (this->eventHandler_.get() != nullptr) {
-    this->eventHandler_->preRead(ctx, "InfinityService.DropTable");
-  }
+void InfinityServiceClient::send_Explain(const ExplainRequest& request)
+{
+  int32_t cseqid = 0;
+  oprot_->writeMessageBegin("Explain", ::apache::thrift::protocol::T_CALL, cseqid);
 
-  InfinityService_DropTable_args args;
-  args.read(iprot);
-  iprot->readMessageEnd();
-  uint32_t bytes = iprot->getTransport()->readEnd();
+  InfinityService_Explain_pargs args;
+  args.request = &request;
+  args.write(oprot_);
 
-  if (this->eventHandler_.get() != nullptr) {
-    this->eventHandler_->postRead(ctx, "InfinityService.DropTable", bytes);
-  }
+  oprot_->writeMessageEnd();
+  oprot_->getTransport()->writeEnd();
+  oprot_->getTransport()->flush();
+}
 
-  InfinityService_DropTable_result result;
-  try {
-    iface_->DropTable(result.success, args.request);
-    result.__isset.success = true;
-  } catch (const std::exception& e) {
-    if (this->eventHandler_.get() != nullptr) {
-      this->eventHandler_->handlerError(ctx, "InfinityService.DropTable");
-    }
+void InfinityServiceClient::recv_Explain(SelectResponse& _return)
+{
 
-    ::apache::thrift::TApplicationException x(e.what());
-    oprot->writeMessageBegin("DropTable", ::apache::thrift::protocol::T_EXCEPTION, seqid);
-    x.write(oprot);
-    oprot->writeMessageEnd();
-    oprot->getTransport()->writeEnd();
-    oprot->getTransport()->flush();
-    return;
-  }
+  int32_t rseqid = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TMessageType mtype;
 
-  if (this->eventHandler_.get() != nullptr) {
-    this->eventHandler_->preWrite(ctx, "InfinityService.DropTable");
+  iprot_->readMessageBegin(fname, mtype, rseqid);
+  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
+    ::apache::thrift::TApplicationException x;
+    x.read(iprot_);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+    throw x;
   }
+  if (mtype != ::apache::thrift::protocol::T_REPLY) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  if (fname.compare("Explain") != 0) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  InfinityService_Explain_presult result;
+  result.success = &_return;
+  result.read(iprot_);
+  iprot_->readMessageEnd();
+  iprot_->getTransport()->readEnd();
 
-  oprot->writeMessageBegin("DropTable", ::apache::thrift::protocol::T_REPLY, seqid);
-  result.write(oprot);
-  oprot->writeMessageEnd();
-  bytes = oprot->getTransport()->writeEnd();
-  oprot->getTransport()->flush();
-
-  if (this->eventHandler_.get() != nullptr) {
-    this->eventHandler_->postWrite(ctx, "InfinityService.DropTable", bytes);
+  if (result.__isset.success) {
+    // _return pointer has now been filled
+    return;
   }
+  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "Explain failed: unknown result");
 }
 
-void InfinityServiceProcessor::process_Insert(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+void InfinityServiceClient::Delete(CommonResponse& _return, const DeleteRequest& request)
 {
-  void* ctx = nullptr;
-  if (this->eventHandler_.get() != nullptr) {
-    ctx = this->eventHandler_->getContext("InfinityService.Insert", callContext);
-  }
-  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "InfinityService.Insert");
+  send_Delete(request);
+  recv_Delete(_return);
+}
 
-  if (this->eventHandler_.get() != nullptr) {
-    this->eventHandler_->preRead(ctx, "InfinityService.Insert");
-  }
+void InfinityServiceClient::send_Delete(const DeleteRequest& request)
+{
+  int32_t cseqid = 0;
+  oprot_->writeMessageBegin("Delete", ::apache::thrift::protocol::T_CALL, cseqid);
 
-  InfinityService_Insert_args args;
-  args.read(iprot);
-  iprot->readMessageEnd();
-  uint32_t bytes = iprot->getTransport()->readEnd();
+  InfinityService_Delete_pargs args;
+  args.request = &request;
+  args.write(oprot_);
 
-  if (this->eventHandler_.get() != nullptr) {
-    this->eventHandler_->postRead(ctx, "InfinityService.Insert", bytes);
-  }
+  oprot_->writeMessageEnd();
+  oprot_->getTransport()->writeEnd();
+  oprot_->getTransport()->flush();
+}
 
-  InfinityService_Insert_result result;
-  try {
-    iface_->Insert(result.success, args.request);
-    result.__isset.success = true;
-  } catch (const std::exception& e) {
-    if (this->eventHandler_.get() != nullptr) {
-      this->eventHandler_->handlerError(ctx, "InfinityService.Insert");
-    }
+void InfinityServiceClient::recv_Delete(CommonResponse& _return)
+{
 
-    ::apache::thrift::TApplicationException x(e.what());
-    oprot->writeMessageBegin("Insert", ::apache::thrift::protocol::T_EXCEPTION, seqid);
-    x.write(oprot);
-    oprot->writeMessageEnd();
-    oprot->getTransport()->writeEnd();
-    oprot->getTransport()->flush();
-    return;
-  }
+  int32_t rseqid = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TMessageType mtype;
 
-  if (this->eventHandler_.get() != nullptr) {
-    this->eventHandler_->preWrite(ctx, "InfinityService.Insert");
+  iprot_->readMessageBegin(fname, mtype, rseqid);
+  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
+    ::apache::thrift::TApplicationException x;
+    x.read(iprot_);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+    throw x;
   }
+  if (mtype != ::apache::thrift::protocol::T_REPLY) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  if (fname.compare("Delete") != 0) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  InfinityService_Delete_presult result;
+  result.success = &_return;
+  result.read(iprot_);
+  iprot_->readMessageEnd();
+  iprot_->getTransport()->readEnd();
 
-  oprot->writeMessageBegin("Insert", ::apache::thrift::protocol::T_REPLY, seqid);
-  result.write(oprot);
-  oprot->writeMessageEnd();
-  bytes = oprot->getTransport()->writeEnd();
-  oprot->getTransport()->flush();
-
-  if (this->eventHandler_.get() != nullptr) {
-    this->eventHandler_->postWrite(ctx, "InfinityService.Insert", bytes);
+  if (result.__isset.success) {
+    // _return pointer has now been filled
+    return;
   }
+  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "Delete failed: unknown result");
 }
 
-void InfinityServiceProcessor::process_Import(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+void InfinityServiceClient::CloseCursor(CommonResponse& _return, const CursorRequest& request)
 {
-  void* ctx = nullptr;
-  if (this->eventHandler_.get() != nullptr) {
-    ctx = this->eventHandler_->getContext("InfinityService.Import", callContext);
-  }
-  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "InfinityService.Import");
+  send_CloseCursor(request);
+  recv_CloseCursor(_return);
+}
 
-  if (this->eventHandler_.get() != nullptr) {
-    this->eventHandler_->preRead(ctx, "InfinityService.Import");
-  }
+void InfinityServiceClient::send_CloseCursor(const CursorRequest& request)
+{
+  int32_t cseqid = 0;
+  oprot_->writeMessageBegin("CloseCursor", ::apache::thrift::protocol::T_CALL, cseqid);
 
-  InfinityService_Import_args args;
-  args.read(iprot);
-  iprot->readMessageEnd();
-  uint32_t bytes = iprot->getTransport()->readEnd();
+  InfinityService_CloseCursor_pargs args;
+  args.request = &request;
+  args.write(oprot_);
 
-  if (this->eventHandler_.get() != nullptr) {
-    this->eventHandler_->postRead(ctx, "InfinityService.Import", bytes);
-  }
+  oprot_->writeMessageEnd();
+  oprot_->getTransport()->writeEnd();
+  oprot_->getTransport()->flush();
+}
 
-  InfinityService_Import_result result;
-  try {
-    iface_->Import(result.success, args.request);
-    result.__isset.success = true;
-  } catch (const std::exception& e) {
-    if (this->eventHandler_.get() != nullptr) {
-      this->eventHandler_->handlerError(ctx, "InfinityService.Import");
-    }
+void InfinityServiceClient::recv_CloseCursor(CommonResponse& _return)
+{
 
-    ::apache::thrift::TApplicationException x(e.what());
-    oprot->writeMessageBegin("Import", ::apache::thrift::protocol::T_EXCEPTION, seqid);
-    x.write(oprot);
-    oprot->writeMessageEnd();
-    oprot->getTransport()->writeEnd();
-    oprot->getTransport()->flush();
-    return;
-  }
+  int32_t rseqid = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TMessageType mtype;
 
-  if (this->eventHandler_.get() != nullptr) {
-    this->eventHandler_->preWrite(ctx, "InfinityService.Import");
+  iprot_->readMessageBegin(fname, mtype, rseqid);
+  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
+    ::apache::thrift::TApplicationException x;
+    x.read(iprot_);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+    throw x;
   }
+  if (mtype != ::apache::thrift::protocol::T_REPLY) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  if (fname.compare("CloseCursor") != 0) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  InfinityService_CloseCursor_presult result;
+  result.success = &_return;
+  result.read(iprot_);
+  iprot_->readMessageEnd();
+  iprot_->getTransport()->readEnd();
 
-  oprot->writeMessageBegin("Import", ::apache::thrift::protocol::T_REPLY, seqid);
-  result.write(oprot);
-  oprot->writeMessageEnd();
-  bytes = oprot->getTransport()->writeEnd();
-  oprot->getTransport()->flush();
-
-  if (this->eventHandler_.get() != nullptr) {
-    this->eventHandler_->postWrite(ctx, "InfinityService.Import", bytes);
+  if (result.__isset.success) {
+    // _return pointer has now been filled
+    return;
   }
+  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "CloseCursor failed: unknown result");
 }
 
-void InfinityServiceProcessor::process_Select(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+void InfinityServiceClient::Update(CommonResponse& _return, const UpdateRequest& request)
 {
-  void* ctx = nullptr;
-  if (this->eventHandler_.get() != nullptr) {
-    ctx = this->eventHandler_->getContext("InfinityService.Select", callContext);
-  }
-  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "InfinityService.Select");
+  send_Update(request);
+  recv_Update(_return);
+}
 
-  if (this->eventHandler_.get() != nullptr) {
-    this->eventHandler_->preRead(ctx, "InfinityService.Select");
-  }
+void InfinityServiceClient::send_Update(const UpdateRequest& request)
+{
+  int32_t cseqid = 0;
+  oprot_->writeMessageBegin("Update", ::apache::thrift::protocol::T_CALL, cseqid);
 
-  InfinityService_Select_args args;
-  args.read(iprot);
-  iprot->readMessageEnd();
-  uint32_t bytes = iprot->getTransport()->readEnd();
+  InfinityService_Update_pargs args;
+  args.request = &request;
+  args.write(oprot_);
 
-  if (this->eventHandler_.get() != nullptr) {
-    this->eventHandler_->postRead(ctx, "InfinityService.Select", bytes);
-  }
+  oprot_->writeMessageEnd();
+  oprot_->getTransport()->writeEnd();
+  oprot_->getTransport()->flush();
+}
 
-  InfinityService_Select_result result;
-  try {
-    iface_->Select(result.success, args.request);
-    result.__isset.success = true;
-  } catch (const std::exception& e) {
-    if (this->eventHandler_.get() != nullptr) {
-      this->eventHandler_->handlerError(ctx, "InfinityService.Select");
-    }
+void InfinityServiceClient::recv_Update(CommonResponse& _return)
+{
 
-    ::apache::thrift::TApplicationException x(e.what());
-    oprot->writeMessageBegin("Select", ::apache::thrift::protocol::T_EXCEPTION, seqid);
-    x.write(oprot);
-    oprot->writeMessageEnd();
-    oprot->getTransport()->writeEnd();
-    oprot->getTransport()->flush();
-    return;
-  }
+  int32_t rseqid = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TMessageType mtype;
 
-  if (this->eventHandler_.get() != nullptr) {
-    this->eventHandler_->preWrite(ctx, "InfinityService.Select");
+  iprot_->readMessageBegin(fname, mtype, rseqid);
+  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
+    ::apache::thrift::TApplicationException x;
+    x.read(iprot_);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+    throw x;
   }
+  if (mtype != ::apache::thrift::protocol::T_REPLY) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  if (fname.compare("Update") != 0) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  InfinityService_Update_presult result;
+  result.success = &_return;
+  result.read(iprot_);
+  iprot_->readMessageEnd();
+  iprot_->getTransport()->readEnd();
 
-  oprot->writeMessageBegin("Select", ::apache::thrift::protocol::T_REPLY, seqid);
-  result.write(oprot);
-  oprot->writeMessageEnd();
-  bytes = oprot->getTransport()->writeEnd();
-  oprot->getTransport()->flush();
-
-  if (this->eventHandler_.get() != nullptr) {
-    this->eventHandler_->postWrite(ctx, "InfinityService.Select", bytes);
+  if (result.__isset.success) {
+    // _return pointer has now been filled
+    return;
   }
+  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "Update failed: unknown result");
 }
 
-void InfinityServiceProcessor::process_Explain(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+void InfinityServiceClient::UploadFileChunk(UploadResponse& _return, const FileChunk& request)
 {
-  void* ctx = nullptr;
-  if (this->eventHandler_.get() != nullptr) {
-    ctx = this->eventHandler_->getContext("InfinityService.Explain", callContext);
-  }
-  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "InfinityService.Explain");
+  send_UploadFileChunk(request);
+  recv_UploadFileChunk(_return);
+}
 
-  if (this->eventHandler_.get() != nullptr) {
-    this->eventHandler_->preRead(ctx, "InfinityService.Explain");
-  }
+void InfinityServiceClient::send_UploadFileChunk(const FileChunk& request)
+{
+  int32_t cseqid = 0;
+  oprot_->writeMessageBegin("UploadFileChunk", ::apache::thrift::protocol::T_CALL, cseqid);
 
-  InfinityService_Explain_args args;
-  args.read(iprot);
-  iprot->readMessageEnd();
-  uint32_t bytes = iprot->getTransport()->readEnd();
+  InfinityService_UploadFileChunk_pargs args;
+  args.request = &request;
+  args.write(oprot_);
 
-  if (this->eventHandler_.get() != nullptr) {
-    this->eventHandler_->postRead(ctx, "InfinityService.Explain", bytes);
-  }
+  oprot_->writeMessageEnd();
+  oprot_->getTransport()->writeEnd();
+  oprot_->getTransport()->flush();
+}
 
-  InfinityService_Explain_result result;
-  try {
-    iface_->Explain(result.success, args.request);
-    result.__isset.success = true;
-  } catch (const std::exception& e) {
-    if (this->eventHandler_.get() != nullptr) {
-      this->eventHandler_->handlerError(ctx, "InfinityService.Explain");
-    }
+void InfinityServiceClient::recv_UploadFileChunk(UploadResponse& _return)
+{
 
-    ::apache::thrift::TApplicationException x(e.what());
-    oprot->writeMessageBegin("Explain", ::apache::thrift::protocol::T_EXCEPTION, seqid);
-    x.write(oprot);
-    oprot->writeMessageEnd();
-    oprot->getTransport()->writeEnd();
-    oprot->getTransport()->flush();
-    return;
-  }
+  int32_t rseqid = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TMessageType mtype;
 
-  if (this->eventHandler_.get() != nullptr) {
-    this->eventHandler_->preWrite(ctx, "InfinityService.Explain");
+  iprot_->readMessageBegin(fname, mtype, rseqid);
+  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
+    ::apache::thrift::TApplicationException x;
+    x.read(iprot_);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+    throw x;
   }
+  if (mtype != ::apache::thrift::protocol::T_REPLY) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  if (fname.compare("UploadFileChunk") != 0) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  InfinityService_UploadFileChunk_presult result;
+  result.success = &_return;
+  result.read(iprot_);
+  iprot_->readMessageEnd();
+  iprot_->getTransport()->readEnd();
 
-  oprot->writeMessageBegin("Explain", ::apache::thrift::protocol::T_REPLY, seqid);
-  result.write(oprot);
-  oprot->writeMessageEnd();
-  bytes = oprot->getTransport()->writeEnd();
-  oprot->getTransport()->flush();
-
-  if (this->eventHandler_.get() != nullptr) {
-    this->eventHandler_->postWrite(ctx, "InfinityService.Explain", bytes);
+  if (result.__isset.success) {
+    // _return pointer has now been filled
+    return;
   }
+  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "UploadFileChunk failed: unknown result");
 }
 
-void InfinityServiceProcessor::process_Delete(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+void InfinityServiceClient::ListDatabase(ListDatabaseResponse& _return, const ListDatabaseRequest& request)
 {
-  void* ctx = nullptr;
-  if (this->eventHandler_.get() != nullptr) {
-    ctx = this->eventHandler_->getContext("InfinityService.Delete", callContext);
-  }
-  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "InfinityService.Delete");
+  send_ListDatabase(request);
+  recv_ListDatabase(_return);
+}
 
-  if (this->eventHandler_.get() != nullptr) {
-    this->eventHandler_->preRead(ctx, "InfinityService.Delete");
-  }
+void InfinityServiceClient::send_ListDatabase(const ListDatabaseRequest& request)
+{
+  int32_t cseqid = 0;
+  oprot_->writeMessageBegin("ListDatabase", ::apache::thrift::protocol::T_CALL, cseqid);
 
-  InfinityService_Delete_args args;
-  args.read(iprot);
-  iprot->readMessageEnd();
-  uint32_t bytes = iprot->getTransport()->readEnd();
+  InfinityService_ListDatabase_pargs args;
+  args.request = &request;
+  args.write(oprot_);
 
-  if (this->eventHandler_.get() != nullptr) {
-    this->eventHandler_->postRead(ctx, "InfinityService.Delete", bytes);
-  }
+  oprot_->writeMessageEnd();
+  oprot_->getTransport()->writeEnd();
+  oprot_->getTransport()->flush();
+}
 
-  InfinityService_Delete_result result;
-  try {
-    iface_->Delete(result.success, args.request);
-    result.__isset.success = true;
-  } catch (const std::exception& e) {
-    if (this->eventHandler_.get() != nullptr) {
-      this->eventHandler_->handlerError(ctx, "InfinityService.Delete");
-    }
+void InfinityServiceClient::recv_ListDatabase(ListDatabaseResponse& _return)
+{
 
-    ::apache::thrift::TApplicationException x(e.what());
-    oprot->writeMessageBegin("Delete", ::apache::thrift::protocol::T_EXCEPTION, seqid);
-    x.write(oprot);
-    oprot->writeMessageEnd();
-    oprot->getTransport()->writeEnd();
-    oprot->getTransport()->flush();
-    return;
-  }
+  int32_t rseqid = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TMessageType mtype;
 
-  if (this->eventHandler_.get() != nullptr) {
-    this->eventHandler_->preWrite(ctx, "InfinityService.Delete");
+  iprot_->readMessageBegin(fname, mtype, rseqid);
+  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
+    ::apache::thrift::TApplicationException x;
+    x.read(iprot_);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+    throw x;
   }
+  if (mtype != ::apache::thrift::protocol::T_REPLY) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  if (fname.compare("ListDatabase") != 0) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  InfinityService_ListDatabase_presult result;
+  result.success = &_return;
+  result.read(iprot_);
+  iprot_->readMessageEnd();
+  iprot_->getTransport()->readEnd();
 
-  oprot->writeMessageBegin("Delete", ::apache::thrift::protocol::T_REPLY, seqid);
-  result.write(oprot);
-  oprot->writeMessageEnd();
-  bytes = oprot->getTransport()->writeEnd();
-  oprot->getTransport()->flush();
-
-  if (this->eventHandler_.get() != nullptr) {
-    this->eventHandler_->postWrite(ctx, "InfinityService.Delete", bytes);
+  if (result.__isset.success) {
+    // _return pointer has now been filled
+    return;
   }
+  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "ListDatabase failed: unknown result");
 }
 
-void InfinityServiceProcessor::process_Update(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+void InfinityServiceClient::ListTable(ListTableResponse& _return, const ListTableRequest& request)
 {
-  void* ctx = nullptr;
-  if (this->eventHandler_.get() != nullptr) {
-    ctx = this->eventHandler_->getContext("InfinityService.Update", callContext);
-  }
-  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "InfinityService.Update");
+  send_ListTable(request);
+  recv_ListTable(_return);
+}
 
-  if (this->eventHandler_.get() != nullptr) {
-    this->eventHandler_->preRead(ctx, "InfinityService.Update");
-  }
+void InfinityServiceClient::send_ListTable(const ListTableRequest& request)
+{
+  int32_t cseqid = 0;
+  oprot_->writeMessageBegin("ListTable", ::apache::thrift::protocol::T_CALL, cseqid);
 
-  InfinityService_Update_args args;
-  args.read(iprot);
-  iprot->readMessageEnd();
-  uint32_t bytes = iprot->getTransport()->readEnd();
+  InfinityService_ListTable_pargs args;
+  args.request = &request;
+  args.write(oprot_);
 
-  if (this->eventHandler_.get() != nullptr) {
-    this->eventHandler_->postRead(ctx, "InfinityService.Update", bytes);
-  }
+  oprot_->writeMessageEnd();
+  oprot_->getTransport()->writeEnd();
+  oprot_->getTransport()->flush();
+}
 
-  InfinityService_Update_result result;
-  try {
-    iface_->Update(result.success, args.request);
-    result.__isset.success = true;
-  } catch (const std::exception& e) {
-    if (this->eventHandler_.get() != nullptr) {
-      this->eventHandler_->handlerError(ctx, "InfinityService.Update");
-    }
+void InfinityServiceClient::recv_ListTable(ListTableResponse& _return)
+{
 
-    ::apache::thrift::TApplicationException x(e.what());
-    oprot->writeMessageBegin("Update", ::apache::thrift::protocol::T_EXCEPTION, seqid);
-    x.write(oprot);
-    oprot->writeMessageEnd();
-    oprot->getTransport()->writeEnd();
-    oprot->getTransport()->flush();
-    return;
-  }
+  int32_t rseqid = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TMessageType mtype;
 
-  if (this->eventHandler_.get() != nullptr) {
-    this->eventHandler_->preWrite(ctx, "InfinityService.Update");
+  iprot_->readMessageBegin(fname, mtype, rseqid);
+  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
+    ::apache::thrift::TApplicationException x;
+    x.read(iprot_);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+    throw x;
   }
+  if (mtype != ::apache::thrift::protocol::T_REPLY) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  if (fname.compare("ListTable") != 0) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  InfinityService_ListTable_presult result;
+  result.success = &_return;
+  result.read(iprot_);
+  iprot_->readMessageEnd();
+  iprot_->getTransport()->readEnd();
 
-  oprot->writeMessageBegin("Update", ::apache::thrift::protocol::T_REPLY, seqid);
-  result.write(oprot);
-  oprot->writeMessageEnd();
-  bytes = oprot->getTransport()->writeEnd();
-  oprot->getTransport()->flush();
-
-  if (this->eventHandler_.get() != nullptr) {
-    this->eventHandler_->postWrite(ctx, "InfinityService.Update", bytes);
+  if (result.__isset.success) {
+    // _return pointer has now been filled
+    return;
   }
+  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "ListTable failed: unknown result");
 }
 
-void InfinityServiceProcessor::process_UploadFileChunk(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+void InfinityServiceClient::ListIndex(ListIndexResponse& _return, const ListIndexRequest& request)
 {
-  void* ctx = nullptr;
-  if (this->eventHandler_.get() != nullptr) {
-    ctx = this->eventHandler_->getContext("InfinityService.UploadFileChunk", callContext);
-  }
-  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "InfinityService.UploadFileChunk");
+  send_ListIndex(request);
+  recv_ListIndex(_return);
+}
 
-  if (this->eventHandler_.get() != nullptr) {
-    this->eventHandler_->preRead(ctx, "InfinityService.UploadFileChunk");
-  }
+void InfinityServiceClient::send_ListIndex(const ListIndexRequest& request)
+{
+  int32_t cseqid = 0;
+  oprot_->writeMessageBegin("ListIndex", ::apache::thrift::protocol::T_CALL, cseqid);
 
-  InfinityService_UploadFileChunk_args args;
-  args.read(iprot);
-  iprot->readMessageEnd();
-  uint32_t bytes = iprot->getTransport()->readEnd();
+  InfinityService_ListIndex_pargs args;
+  args.request = &request;
+  args.write(oprot_);
 
-  if (this->eventHandler_.get() != nullptr) {
-    this->eventHandler_->postRead(ctx, "InfinityService.UploadFileChunk", bytes);
-  }
+  oprot_->writeMessageEnd();
+  oprot_->getTransport()->writeEnd();
+  oprot_->getTransport()->flush();
+}
 
-  InfinityService_UploadFileChunk_result result;
-  try {
-    iface_->UploadFileChunk(result.success, args.request);
-    result.__isset.success = true;
-  } catch (const std::exception& e) {
-    if (this->eventHandler_.get() != nullptr) {
-      this->eventHandler_->handlerError(ctx, "InfinityService.UploadFileChunk");
-    }
+void InfinityServiceClient::recv_ListIndex(ListIndexResponse& _return)
+{
 
-    ::apache::thrift::TApplicationException x(e.what());
-    oprot->writeMessageBegin("UploadFileChunk", ::apache::thrift::protocol::T_EXCEPTION, seqid);
-    x.write(oprot);
-    oprot->writeMessageEnd();
-    oprot->getTransport()->writeEnd();
-    oprot->getTransport()->flush();
-    return;
-  }
+  int32_t rseqid = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TMessageType mtype;
 
-  if (this->eventHandler_.get() != nullptr) {
-    this->eventHandler_->preWrite(ctx, "InfinityService.UploadFileChunk");
+  iprot_->readMessageBegin(fname, mtype, rseqid);
+  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
+    ::apache::thrift::TApplicationException x;
+    x.read(iprot_);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+    throw x;
   }
+  if (mtype != ::apache::thrift::protocol::T_REPLY) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  if (fname.compare("ListIndex") != 0) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  InfinityService_ListIndex_presult result;
+  result.success = &_return;
+  result.read(iprot_);
+  iprot_->readMessageEnd();
+  iprot_->getTransport()->readEnd();
 
-  oprot->writeMessageBegin("UploadFileChunk", ::apache::thrift::protocol::T_REPLY, seqid);
-  result.write(oprot);
-  oprot->writeMessageEnd();
-  bytes = oprot->getTransport()->writeEnd();
-  oprot->getTransport()->flush();
-
-  if (this->eventHandler_.get() != nullptr) {
-    this->eventHandler_->postWrite(ctx, "InfinityService.UploadFileChunk", bytes);
+  if (result.__isset.success) {
+    // _return pointer has now been filled
+    return;
   }
+  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "ListIndex failed: unknown result");
 }
 
-void InfinityServiceProcessor::process_ListDatabase(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+void InfinityServiceClient::ShowVariable(SelectResponse& _return, const ShowVariableRequest& request)
 {
-  void* ctx = nullptr;
-  if (this->eventHandler_.get() != nullptr) {
-    ctx = this->eventHandler_->getContext("InfinityService.ListDatabase", callContext);
-  }
-  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "InfinityService.ListDatabase");
+  send_ShowVariable(request);
+  recv_ShowVariable(_return);
+}
 
-  if (this->eventHandler_.get() != nullptr) {
-    this->eventHandler_->preRead(ctx, "InfinityService.ListDatabase");
-  }
+void InfinityServiceClient::send_ShowVariable(const ShowVariableRequest& request)
+{
+  int32_t cseqid = 0;
+  oprot_->writeMessageBegin("ShowVariable", ::apache::thrift::protocol::T_CALL, cseqid);
 
-  InfinityService_ListDatabase_args args;
-  args.read(iprot);
-  iprot->readMessageEnd();
-  uint32_t bytes = iprot->getTransport()->readEnd();
+  InfinityService_ShowVariable_pargs args;
+  args.request = &request;
+  args.write(oprot_);
 
-  if (this->eventHandler_.get() != nullptr) {
-    this->eventHandler_->postRead(ctx, "InfinityService.ListDatabase", bytes);
-  }
+  oprot_->writeMessageEnd();
+  oprot_->getTransport()->writeEnd();
+  oprot_->getTransport()->flush();
+}
 
-  InfinityService_ListDatabase_result result;
-  try {
-    iface_->ListDatabase(result.success, args.request);
-    result.__isset.success = true;
-  } catch (const std::exception& e) {
-    if (this->eventHandler_.get() != nullptr) {
-      this->eventHandler_->handlerError(ctx, "InfinityService.ListDatabase");
-    }
+void InfinityServiceClient::recv_ShowVariable(SelectResponse& _return)
+{
 
-    ::apache::thrift::TApplicationException x(e.what());
-    oprot->writeMessageBegin("ListDatabase", ::apache::thrift::protocol::T_EXCEPTION, seqid);
-    x.write(oprot);
-    oprot->writeMessageEnd();
-    oprot->getTransport()->writeEnd();
-    oprot->getTransport()->flush();
-    return;
-  }
+  int32_t rseqid = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TMessageType mtype;
 
-  if (this->eventHandler_.get() != nullptr) {
-    this->eventHandler_->preWrite(ctx, "InfinityService.ListDatabase");
+  iprot_->readMessageBegin(fname, mtype, rseqid);
+  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
+    ::apache::thrift::TApplicationException x;
+    x.read(iprot_);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+    throw x;
   }
+  if (mtype != ::apache::thrift::protocol::T_REPLY) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  if (fname.compare("ShowVariable") != 0) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  InfinityService_ShowVariable_presult result;
+  result.success = &_return;
+  result.read(iprot_);
+  iprot_->readMessageEnd();
+  iprot_->getTransport()->readEnd();
 
-  oprot->writeMessageBegin("ListDatabase", ::apache::thrift::protocol::T_REPLY, seqid);
-  result.write(oprot);
-  oprot->writeMessageEnd();
-  bytes = oprot->getTransport()->writeEnd();
-  oprot->getTransport()->flush();
-
-  if (this->eventHandler_.get() != nullptr) {
-    this->eventHandler_->postWrite(ctx, "InfinityService.ListDatabase", bytes);
+  if (result.__isset.success) {
+    // _return pointer has now been filled
+    return;
   }
+  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "ShowVariable failed: unknown result");
 }
 
-void InfinityServiceProcessor::process_ListTable(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+void InfinityServiceClient::ShowTable(ShowTableResponse& _return, const ShowTableRequest& request)
 {
-  void* ctx = nullptr;
-  if (this->eventHandler_.get() != nullptr) {
-    ctx = this->eventHandler_->getContext("InfinityService.ListTable", callContext);
-  }
-  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "InfinityService.ListTable");
+  send_ShowTable(request);
+  recv_ShowTable(_return);
+}
 
-  if (this->eventHandler_.get() != nullptr) {
-    this->eventHandler_->preRead(ctx, "InfinityService.ListTable");
-  }
+void InfinityServiceClient::send_ShowTable(const ShowTableRequest& request)
+{
+  int32_t cseqid = 0;
+  oprot_->writeMessageBegin("ShowTable", ::apache::thrift::protocol::T_CALL, cseqid);
 
-  InfinityService_ListTable_args args;
-  args.read(iprot);
-  iprot->readMessageEnd();
-  uint32_t bytes = iprot->getTransport()->readEnd();
+  InfinityService_ShowTable_pargs args;
+  args.request = &request;
+  args.write(oprot_);
 
-  if (this->eventHandler_.get() != nullptr) {
-    this->eventHandler_->postRead(ctx, "InfinityService.ListTable", bytes);
-  }
+  oprot_->writeMessageEnd();
+  oprot_->getTransport()->writeEnd();
+  oprot_->getTransport()->flush();
+}
 
-  InfinityService_ListTable_result result;
-  try {
-    iface_->ListTable(result.success, args.request);
-    result.__isset.success = true;
-  } catch (const std::exception& e) {
-    if (this->eventHandler_.get() != nullptr) {
-      this->eventHandler_->handlerError(ctx, "InfinityService.ListTable");
-    }
+void InfinityServiceClient::recv_ShowTable(ShowTableResponse& _return)
+{
 
-    ::apache::thrift::TApplicationException x(e.what());
-    oprot->writeMessageBegin("ListTable", ::apache::thrift::protocol::T_EXCEPTION, seqid);
-    x.write(oprot);
-    oprot->writeMessageEnd();
-    oprot->getTransport()->writeEnd();
-    oprot->getTransport()->flush();
-    return;
-  }
+  int32_t rseqid = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TMessageType mtype;
 
-  if (this->eventHandler_.get() != nullptr) {
-    this->eventHandler_->preWrite(ctx, "InfinityService.ListTable");
+  iprot_->readMessageBegin(fname, mtype, rseqid);
+  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
+    ::apache::thrift::TApplicationException x;
+    x.read(iprot_);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+    throw x;
   }
+  if (mtype != ::apache::thrift::protocol::T_REPLY) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  if (fname.compare("ShowTable") != 0) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  InfinityService_ShowTable_presult result;
+  result.success = &_return;
+  result.read(iprot_);
+  iprot_->readMessageEnd();
+  iprot_->getTransport()->readEnd();
 
-  oprot->writeMessageBegin("ListTable", ::apache::thrift::protocol::T_REPLY, seqid);
-  result.write(oprot);
-  oprot->writeMessageEnd();
-  bytes = oprot->getTransport()->writeEnd();
-  oprot->getTransport()->flush();
-
-  if (this->eventHandler_.get() != nullptr) {
-    this->eventHandler_->postWrite(ctx, "InfinityService.ListTable", bytes);
+  if (result.__isset.success) {
+    // _return pointer has now been filled
+    return;
   }
+  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "ShowTable failed: unknown result");
 }
 
-void InfinityServiceProcessor::process_ListIndex(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+void InfinityServiceClient::ShowColumns(SelectResponse& _return, const ShowColumnsRequest& request)
 {
-  void* ctx = nullptr;
-  if (this->eventHandler_.get() != nullptr) {
-    ctx = this->eventHandler_->getContext("InfinityService.ListIndex", callContext);
-  }
-  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "InfinityService.ListIndex");
+  send_ShowColumns(request);
+  recv_ShowColumns(_return);
+}
 
-  if (this->eventHandler_.get() != nullptr) {
-    this->eventHandler_->preRead(ctx, "InfinityService.ListIndex");
-  }
+void InfinityServiceClient::send_ShowColumns(const ShowColumnsRequest& request)
+{
+  int32_t cseqid = 0;
+  oprot_->writeMessageBegin("ShowColumns", ::apache::thrift::protocol::T_CALL, cseqid);
 
-  InfinityService_ListIndex_args args;
-  args.read(iprot);
-  iprot->readMessageEnd();
-  uint32_t bytes = iprot->getTransport()->readEnd();
+  InfinityService_ShowColumns_pargs args;
+  args.request = &request;
+  args.write(oprot_);
 
-  if (this->eventHandler_.get() != nullptr) {
-    this->eventHandler_->postRead(ctx, "InfinityService.ListIndex", bytes);
-  }
+  oprot_->writeMessageEnd();
+  oprot_->getTransport()->writeEnd();
+  oprot_->getTransport()->flush();
+}
 
-  InfinityService_ListIndex_result result;
-  try {
-    iface_->ListIndex(result.success, args.request);
-    result.__isset.success = true;
-  } catch (const std::exception& e) {
-    if (this->eventHandler_.get() != nullptr) {
-      this->eventHandler_->handlerError(ctx, "InfinityService.ListIndex");
-    }
+void InfinityServiceClient::recv_ShowColumns(SelectResponse& _return)
+{
 
-    ::apache::thrift::TApplicationException x(e.what());
-    oprot->writeMessageBegin("ListIndex", ::apache::thrift::protocol::T_EXCEPTION, seqid);
-    x.write(oprot);
-    oprot->writeMessageEnd();
-    oprot->getTransport()->writeEnd();
-    oprot->getTransport()->flush();
-    return;
-  }
+  int32_t rseqid = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TMessageType mtype;
 
-  if (this->eventHandler_.get() != nullptr) {
-    this->eventHandler_->preWrite(ctx, "InfinityService.ListIndex");
+  iprot_->readMessageBegin(fname, mtype, rseqid);
+  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
+    ::apache::thrift::TApplicationException x;
+    x.read(iprot_);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+    throw x;
   }
+  if (mtype != ::apache::thrift::protocol::T_REPLY) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  if (fname.compare("ShowColumns") != 0) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  InfinityService_ShowColumns_presult result;
+  result.success = &_return;
+  result.read(iprot_);
+  iprot_->readMessageEnd();
+  iprot_->getTransport()->readEnd();
 
-  oprot->writeMessageBegin("ListIndex", ::apache::thrift::protocol::T_REPLY, seqid);
-  result.write(oprot);
-  oprot->writeMessageEnd();
-  bytes = oprot->getTransport()->writeEnd();
-  oprot->getTransport()->flush();
-
-  if (this->eventHandler_.get() != nullptr) {
-    this->eventHandler_->postWrite(ctx, "InfinityService.ListIndex", bytes);
+  if (result.__isset.success) {
+    // _return pointer has now been filled
+    return;
   }
+  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "ShowColumns failed: unknown result");
 }
 
-void InfinityServiceProcessor::process_ShowVariable(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+void InfinityServiceClient::ShowDatabase(ShowDatabaseResponse& _return, const ShowDatabaseRequest& request)
 {
-  void* ctx = nullptr;
-  if (this->eventHandler_.get() != nullptr) {
-    ctx = this->eventHandler_->getContext("InfinityService.ShowVariable", callContext);
-  }
-  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "InfinityService.ShowVariable");
+  send_ShowDatabase(request);
+  recv_ShowDatabase(_return);
+}
 
-  if (this->eventHandler_.get() != nullptr) {
-    this->eventHandler_->preRead(ctx, "InfinityService.ShowVariable");
-  }
+void InfinityServiceClient::send_ShowDatabase(const ShowDatabaseRequest& request)
+{
+  int32_t cseqid = 0;
+  oprot_->writeMessageBegin("ShowDatabase", ::apache::thrift::protocol::T_CALL, cseqid);
 
-  InfinityService_ShowVariable_args args;
-  args.read(iprot);
-  iprot->readMessageEnd();
-  uint32_t bytes = iprot->getTransport()->readEnd();
+  InfinityService_ShowDatabase_pargs args;
+  args.request = &request;
+  args.write(oprot_);
 
-  if (this->eventHandler_.get() != nullptr) {
-    this->eventHandler_->postRead(ctx, "InfinityService.ShowVariable", bytes);
-  }
+  oprot_->writeMessageEnd();
+  oprot_->getTransport()->writeEnd();
+  oprot_->getTransport()->flush();
+}
 
-  InfinityService_ShowVariable_result result;
-  try {
-    iface_->ShowVariable(result.success, args.request);
-    result.__isset.success = true;
-  } catch (const std::exception& e) {
-    if (this->eventHandler_.get() != nullptr) {
-      this->eventHandler_->handlerError(ctx, "InfinityService.ShowVariable");
-    }
+void InfinityServiceClient::recv_ShowDatabase(ShowDatabaseResponse& _return)
+{
 
-    ::apache::thrift::TApplicationException x(e.what());
-    oprot->writeMessageBegin("ShowVariable", ::apache::thrift::protocol::T_EXCEPTION, seqid);
-    x.write(oprot);
-    oprot->writeMessageEnd();
-    oprot->getTransport()->writeEnd();
-    oprot->getTransport()->flush();
-    return;
-  }
+  int32_t rseqid = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TMessageType mtype;
 
-  if (this->eventHandler_.get() != nullptr) {
-    this->eventHandler_->preWrite(ctx, "InfinityService.ShowVariable");
+  iprot_->readMessageBegin(fname, mtype, rseqid);
+  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
+    ::apache::thrift::TApplicationException x;
+    x.read(iprot_);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+    throw x;
   }
+  if (mtype != ::apache::thrift::protocol::T_REPLY) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  if (fname.compare("ShowDatabase") != 0) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  InfinityService_ShowDatabase_presult result;
+  result.success = &_return;
+  result.read(iprot_);
+  iprot_->readMessageEnd();
+  iprot_->getTransport()->readEnd();
 
-  oprot->writeMessageBegin("ShowVariable", ::apache::thrift::protocol::T_REPLY, seqid);
-  result.write(oprot);
-  oprot->writeMessageEnd();
-  bytes = oprot->getTransport()->writeEnd();
-  oprot->getTransport()->flush();
-
-  if (this->eventHandler_.get() != nullptr) {
-    this->eventHandler_->postWrite(ctx, "InfinityService.ShowVariable", bytes);
+  if (result.__isset.success) {
+    // _return pointer has now been filled
+    return;
   }
+  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "ShowDatabase failed: unknown result");
 }
 
-void InfinityServiceProcessor::process_ShowTable(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+void InfinityServiceClient::ShowTables(SelectResponse& _return, const ShowTablesRequest& request)
 {
-  void* ctx = nullptr;
-  if (this->eventHandler_.get() != nullptr) {
-    ctx = this->eventHandler_->getContext("InfinityService.ShowTable", callContext);
-  }
-  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "InfinityService.ShowTable");
+  send_ShowTables(request);
+  recv_ShowTables(_return);
+}
 
-  if (this->eventHandler_.get() != nullptr) {
-    this->eventHandler_->preRead(ctx, "InfinityService.ShowTable");
-  }
+void InfinityServiceClient::send_ShowTables(const ShowTablesRequest& request)
+{
+  int32_t cseqid = 0;
+  oprot_->writeMessageBegin("ShowTables", ::apache::thrift::protocol::T_CALL, cseqid);
 
-  InfinityService_ShowTable_args args;
-  args.read(iprot);
-  iprot->readMessageEnd();
-  uint32_t bytes = iprot->getTransport()->readEnd();
+  InfinityService_ShowTables_pargs args;
+  args.request = &request;
+  args.write(oprot_);
 
-  if (this->eventHandler_.get() != nullptr) {
-    this->eventHandler_->postRead(ctx, "InfinityService.ShowTable", bytes);
-  }
+  oprot_->writeMessageEnd();
+  oprot_->getTransport()->writeEnd();
+  oprot_->getTransport()->flush();
+}
 
-  InfinityService_ShowTable_result result;
-  try {
-    iface_->ShowTable(result.success, args.request);
-    result.__isset.success = true;
-  } catch (const std::exception& e) {
-    if (this->eventHandler_.get() != nullptr) {
-      this->eventHandler_->handlerError(ctx, "InfinityService.ShowTable");
-    }
+void InfinityServiceClient::recv_ShowTables(SelectResponse& _return)
+{
 
-    ::apache::thrift::TApplicationException x(e.what());
-    oprot->writeMessageBegin("ShowTable", ::apache::thrift::protocol::T_EXCEPTION, seqid);
-    x.write(oprot);
-    oprot->writeMessageEnd();
-    oprot->getTransport()->writeEnd();
-    oprot->getTransport()->flush();
-    return;
-  }
+  int32_t rseqid = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TMessageType mtype;
 
-  if (this->eventHandler_.get() != nullptr) {
-    this->eventHandler_->preWrite(ctx, "InfinityService.ShowTable");
+  iprot_->readMessageBegin(fname, mtype, rseqid);
+  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
+    ::apache::thrift::TApplicationException x;
+    x.read(iprot_);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+    throw x;
   }
+  if (mtype != ::apache::thrift::protocol::T_REPLY) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  if (fname.compare("ShowTables") != 0) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  InfinityService_ShowTables_presult result;
+  result.success = &_return;
+  result.read(iprot_);
+  iprot_->readMessageEnd();
+  iprot_->getTransport()->readEnd();
 
-  oprot->writeMessageBegin("ShowTable", ::apache::thrift::protocol::T_REPLY, seqid);
-  result.write(oprot);
-  oprot->writeMessageEnd();
-  bytes = oprot->getTransport()->writeEnd();
-  oprot->getTransport()->flush();
-
-  if (this->eventHandler_.get() != nullptr) {
-    this->eventHandler_->postWrite(ctx, "InfinityService.ShowTable", bytes);
+  if (result.__isset.success) {
+    // _return pointer has now been filled
+    return;
   }
+  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "ShowTables failed: unknown result");
 }
 
-void InfinityServiceProcessor::process_ShowColumns(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+void InfinityServiceClient::GetDatabase(CommonResponse& _return, const GetDatabaseRequest& request)
 {
-  void* ctx = nullptr;
-  if (this->eventHandler_.get() != nullptr) {
-    ctx = this->eventHandler_->getContext("InfinityService.ShowColumns", callContext);
-  }
-  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "InfinityService.ShowColumns");
+  send_GetDatabase(request);
+  recv_GetDatabase(_return);
+}
 
-  if (this->eventHandler_.get() != nullptr) {
-    this->eventHandler_->preRead(ctx, "InfinityService.ShowColumns");
-  }
+void InfinityServiceClient::send_GetDatabase(const GetDatabaseRequest& request)
+{
+  int32_t cseqid = 0;
+  oprot_->writeMessageBegin("GetDatabase", ::apache::thrift::protocol::T_CALL, cseqid);
 
-  InfinityService_ShowColumns_args args;
-  args.read(iprot);
-  iprot->readMessageEnd();
-  uint32_t bytes = iprot->getTransport()->readEnd();
+  InfinityService_GetDatabase_pargs args;
+  args.request = &request;
+  args.write(oprot_);
 
-  if (this->eventHandler_.get() != nullptr) {
-    this->eventHandler_->postRead(ctx, "InfinityService.ShowColumns", bytes);
-  }
+  oprot_->writeMessageEnd();
+  oprot_->getTransport()->writeEnd();
+  oprot_->getTransport()->flush();
+}
 
-  InfinityService_ShowColumns_result result;
-  try {
-    iface_->ShowColumns(result.success, args.request);
-    result.__isset.success = true;
-  } catch (const std::exception& e) {
-    if (this->eventHandler_.get() != nullptr) {
-      this->eventHandler_->handlerError(ctx, "InfinityService.ShowColumns");
-    }
+void InfinityServiceClient::recv_GetDatabase(CommonResponse& _return)
+{
 
-    ::apache::thrift::TApplicationException x(e.what());
-    oprot->writeMessageBegin("ShowColumns", ::apache::thrift::protocol::T_EXCEPTION, seqid);
-    x.write(oprot);
-    oprot->writeMessageEnd();
-    oprot->getTransport()->writeEnd();
-    oprot->getTransport()->flush();
-    return;
-  }
+  int32_t rseqid = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TMessageType mtype;
 
-  if (this->eventHandler_.get() != nullptr) {
-    this->eventHandler_->preWrite(ctx, "InfinityService.ShowColumns");
+  iprot_->readMessageBegin(fname, mtype, rseqid);
+  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
+    ::apache::thrift::TApplicationException x;
+    x.read(iprot_);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+    throw x;
   }
+  if (mtype != ::apache::thrift::protocol::T_REPLY) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  if (fname.compare("GetDatabase") != 0) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  InfinityService_GetDatabase_presult result;
+  result.success = &_return;
+  result.read(iprot_);
+  iprot_->readMessageEnd();
+  iprot_->getTransport()->readEnd();
 
-  oprot->writeMessageBegin("ShowColumns", ::apache::thrift::protocol::T_REPLY, seqid);
-  result.write(oprot);
-  oprot->writeMessageEnd();
-  bytes = oprot->getTransport()->writeEnd();
-  oprot->getTransport()->flush();
-
-  if (this->eventHandler_.get() != nullptr) {
-    this->eventHandler_->postWrite(ctx, "InfinityService.ShowColumns", bytes);
+  if (result.__isset.success) {
+    // _return pointer has now been filled
+    return;
   }
+  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "GetDatabase failed: unknown result");
 }
 
-void InfinityServiceProcessor::process_ShowDatabase(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+void InfinityServiceClient::GetTable(CommonResponse& _return, const GetTableRequest& request)
 {
-  void* ctx = nullptr;
-  if (this->eventHandler_.get() != nullptr) {
-    ctx = this->eventHandler_->getContext("InfinityService.ShowDatabase", callContext);
-  }
-  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "InfinityService.ShowDatabase");
+  send_GetTable(request);
+  recv_GetTable(_return);
+}
 
-  if (this->eventHandler_.get() != nullptr) {
-    this->eventHandler_->preRead(ctx, "InfinityService.ShowDatabase");
-  }
+void InfinityServiceClient::send_GetTable(const GetTableRequest& request)
+{
+  int32_t cseqid = 0;
+  oprot_->writeMessageBegin("GetTable", ::apache::thrift::protocol::T_CALL, cseqid);
 
-  InfinityService_ShowDatabase_args args;
-  args.read(iprot);
-  iprot->readMessageEnd();
-  uint32_t bytes = iprot->getTransport()->readEnd();
+  InfinityService_GetTable_pargs args;
+  args.request = &request;
+  args.write(oprot_);
 
-  if (this->eventHandler_.get() != nullptr) {
-    this->eventHandler_->postRead(ctx, "InfinityService.ShowDatabase", bytes);
-  }
+  oprot_->writeMessageEnd();
+  oprot_->getTransport()->writeEnd();
+  oprot_->getTransport()->flush();
+}
 
-  InfinityService_ShowDatabase_result result;
-  try {
-    iface_->ShowDatabase(result.success, args.request);
-    result.__isset.success = true;
-  } catch (const std::exception& e) {
-    if (this->eventHandler_.get() != nullptr) {
-      this->eventHandler_->handlerError(ctx, "InfinityService.ShowDatabase");
-    }
+void InfinityServiceClient::recv_GetTable(CommonResponse& _return)
+{
 
-    ::apache::thrift::TApplicationException x(e.what());
-    oprot->writeMessageBegin("ShowDatabase", ::apache::thrift::protocol::T_EXCEPTION, seqid);
-    x.write(oprot);
-    oprot->writeMessageEnd();
-    oprot->getTransport()->writeEnd();
-    oprot->getTransport()->flush();
-    return;
-  }
+  int32_t rseqid = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TMessageType mtype;
 
-  if (this->eventHandler_.get() != nullptr) {
-    this->eventHandler_->preWrite(ctx, "InfinityService.ShowDatabase");
+  iprot_->readMessageBegin(fname, mtype, rseqid);
+  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
+    ::apache::thrift::TApplicationException x;
+    x.read(iprot_);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+    throw x;
   }
+  if (mtype != ::apache::thrift::protocol::T_REPLY) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  if (fname.compare("GetTable") != 0) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  InfinityService_GetTable_presult result;
+  result.success = &_return;
+  result.read(iprot_);
+  iprot_->readMessageEnd();
+  iprot_->getTransport()->readEnd();
 
-  oprot->writeMessageBegin("ShowDatabase", ::apache::thrift::protocol::T_REPLY, seqid);
-  result.write(oprot);
-  oprot->writeMessageEnd();
-  bytes = oprot->getTransport()->writeEnd();
-  oprot->getTransport()->flush();
-
-  if (this->eventHandler_.get() != nullptr) {
-    this->eventHandler_->postWrite(ctx, "InfinityService.ShowDatabase", bytes);
+  if (result.__isset.success) {
+    // _return pointer has now been filled
+    return;
   }
+  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "GetTable failed: unknown result");
 }
 
-void InfinityServiceProcessor::process_ShowTables(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+void InfinityServiceClient::CreateIndex(CommonResponse& _return, const CreateIndexRequest& request)
 {
-  void* ctx = nullptr;
-  if (this->eventHandler_.get() != nullptr) {
-    ctx = this->eventHandler_->getContext("InfinityService.ShowTables", callContext);
-  }
-  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "InfinityService.ShowTables");
+  send_CreateIndex(request);
+  recv_CreateIndex(_return);
+}
 
-  if (this->eventHandler_.get() != nullptr) {
-    this->eventHandler_->preRead(ctx, "InfinityService.ShowTables");
-  }
+void InfinityServiceClient::send_CreateIndex(const CreateIndexRequest& request)
+{
+  int32_t cseqid = 0;
+  oprot_->writeMessageBegin("CreateIndex", ::apache::thrift::protocol::T_CALL, cseqid);
 
-  InfinityService_ShowTables_args args;
-  args.read(iprot);
-  iprot->readMessageEnd();
-  uint32_t bytes = iprot->getTransport()->readEnd();
+  InfinityService_CreateIndex_pargs args;
+  args.request = &request;
+  args.write(oprot_);
 
-  if (this->eventHandler_.get() != nullptr) {
-    this->eventHandler_->postRead(ctx, "InfinityService.ShowTables", bytes);
-  }
+  oprot_->writeMessageEnd();
+  oprot_->getTransport()->writeEnd();
+  oprot_->getTransport()->flush();
+}
 
-  InfinityService_ShowTables_result result;
-  try {
-    iface_->ShowTables(result.success, args.request);
-    result.__isset.success = true;
-  } catch (const std::exception& e) {
-    if (this->eventHandler_.get() != nullptr) {
-      this->eventHandler_->handlerError(ctx, "InfinityService.ShowTables");
-    }
+void InfinityServiceClient::recv_CreateIndex(CommonResponse& _return)
+{
 
-    ::apache::thrift::TApplicationException x(e.what());
-    oprot->writeMessageBegin("ShowTables", ::apache::thrift::protocol::T_EXCEPTION, seqid);
-    x.write(oprot);
-    oprot->writeMessageEnd();
-    oprot->getTransport()->writeEnd();
-    oprot->getTransport()->flush();
-    return;
-  }
+  int32_t rseqid = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TMessageType mtype;
 
-  if (this->eventHandler_.get() != nullptr) {
-    this->eventHandler_->preWrite(ctx, "InfinityService.ShowTables");
+  iprot_->readMessageBegin(fname, mtype, rseqid);
+  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
+    ::apache::thrift::TApplicationException x;
+    x.read(iprot_);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+    throw x;
   }
+  if (mtype != ::apache::thrift::protocol::T_REPLY) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  if (fname.compare("CreateIndex") != 0) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  InfinityService_CreateIndex_presult result;
+  result.success = &_return;
+  result.read(iprot_);
+  iprot_->readMessageEnd();
+  iprot_->getTransport()->readEnd();
 
-  oprot->writeMessageBegin("ShowTables", ::apache::thrift::protocol::T_REPLY, seqid);
-  result.write(oprot);
-  oprot->writeMessageEnd();
-  bytes = oprot->getTransport()->writeEnd();
-  oprot->getTransport()->flush();
-
-  if (this->eventHandler_.get() != nullptr) {
-    this->eventHandler_->postWrite(ctx, "InfinityService.ShowTables", bytes);
+  if (result.__isset.success) {
+    // _return pointer has now been filled
+    return;
   }
+  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "CreateIndex failed: unknown result");
 }
 
-void InfinityServiceProcessor::process_GetDatabase(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+void InfinityServiceClient::DropIndex(CommonResponse& _return, const DropIndexRequest& request)
 {
-  void* ctx = nullptr;
-  if (this->eventHandler_.get() != nullptr) {
-    ctx = this->eventHandler_->getContext("InfinityService.GetDatabase", callContext);
-  }
-  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "InfinityService.GetDatabase");
+  send_DropIndex(request);
+  recv_DropIndex(_return);
+}
 
-  if (this->eventHandler_.get() != nullptr) {
-    this->eventHandler_->preRead(ctx, "InfinityService.GetDatabase");
-  }
+void InfinityServiceClient::send_DropIndex(const DropIndexRequest& request)
+{
+  int32_t cseqid = 0;
+  oprot_->writeMessageBegin("DropIndex", ::apache::thrift::protocol::T_CALL, cseqid);
 
-  InfinityService_GetDatabase_args args;
-  args.read(iprot);
-  iprot->readMessageEnd();
-  uint32_t bytes = iprot->getTransport()->readEnd();
+  InfinityService_DropIndex_pargs args;
+  args.request = &request;
+  args.write(oprot_);
 
-  if (this->eventHandler_.get() != nullptr) {
-    this->eventHandler_->postRead(ctx, "InfinityService.GetDatabase", bytes);
-  }
+  oprot_->writeMessageEnd();
+  oprot_->getTransport()->writeEnd();
+  oprot_->getTransport()->flush();
+}
 
-  InfinityService_GetDatabase_result result;
-  try {
-    iface_->GetDatabase(result.success, args.request);
-    result.__isset.success = true;
-  } catch (const std::exception& e) {
-    if (this->eventHandler_.get() != nullptr) {
-      this->eventHandler_->handlerError(ctx, "InfinityService.GetDatabase");
-    }
+void InfinityServiceClient::recv_DropIndex(CommonResponse& _return)
+{
 
-    ::apache::thrift::TApplicationException x(e.what());
-    oprot->writeMessageBegin("GetDatabase", ::apache::thrift::protocol::T_EXCEPTION, seqid);
-    x.write(oprot);
-    oprot->writeMessageEnd();
-    oprot->getTransport()->writeEnd();
-    oprot->getTransport()->flush();
-    return;
-  }
+  int32_t rseqid = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TMessageType mtype;
 
-  if (this->eventHandler_.get() != nullptr) {
-    this->eventHandler_->preWrite(ctx, "InfinityService.GetDatabase");
+  iprot_->readMessageBegin(fname, mtype, rseqid);
+  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
+    ::apache::thrift::TApplicationException x;
+    x.read(iprot_);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+    throw x;
   }
+  if (mtype != ::apache::thrift::protocol::T_REPLY) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  if (fname.compare("DropIndex") != 0) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  InfinityService_DropIndex_presult result;
+  result.success = &_return;
+  result.read(iprot_);
+  iprot_->readMessageEnd();
+  iprot_->getTransport()->readEnd();
 
-  oprot->writeMessageBegin("GetDatabase", ::apache::thrift::protocol::T_REPLY, seqid);
-  result.write(oprot);
-  oprot->writeMessageEnd();
-  bytes = oprot->getTransport()->writeEnd();
-  oprot->getTransport()->flush();
-
-  if (this->eventHandler_.get() != nullptr) {
-    this->eventHandler_->postWrite(ctx, "InfinityService.GetDatabase", bytes);
+  if (result.__isset.success) {
+    // _return pointer has now been filled
+    return;
   }
+  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "DropIndex failed: unknown result");
 }
 
-void InfinityServiceProcessor::process_GetTable(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+void InfinityServiceClient::ShowIndex(ShowIndexResponse& _return, const ShowIndexRequest& request)
 {
-  void* ctx = nullptr;
-  if (this->eventHandler_.get() != nullptr) {
-    ctx = this->eventHandler_->getContext("InfinityService.GetTable", callContext);
-  }
-  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "InfinityService.GetTable");
+  send_ShowIndex(request);
+  recv_ShowIndex(_return);
+}
 
-  if (this->eventHandler_.get() != nullptr) {
-    this->eventHandler_->preRead(ctx, "InfinityService.GetTable");
+void InfinityServiceClient::send_ShowIndex(const ShowIndexRequest& request)
+{
+  int32_t cseqid = 0;
+  oprot_->writeMessageBegin("ShowIndex", ::apache::thrift::protocol::T_CALL, cseqid);
+
+  InfinityService_ShowIndex_pargs args;
+  args.request = &request;
+  args.write(oprot_);
+
+  oprot_->writeMessageEnd();
+  oprot_->getTransport()->writeEnd();
+  oprot_->getTransport()->flush();
+}
+
+void InfinityServiceClient::recv_ShowIndex(ShowIndexResponse& _return)
+{
+
+  int32_t rseqid = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TMessageType mtype;
+
+  iprot_->readMessageBegin(fname, mtype, rseqid);
+  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
+    ::apache::thrift::TApplicationException x;
+    x.read(iprot_);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+    throw x;
+  }
+  if (mtype != ::apache::thrift::protocol::T_REPLY) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  if (fname.compare("ShowIndex") != 0) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
   }
+  InfinityService_ShowIndex_presult result;
+  result.success = &_return;
+  result.read(iprot_);
+  iprot_->readMessageEnd();
+  iprot_->getTransport()->readEnd();
 
-  InfinityService_GetTable_args args;
+  if (result.__isset.success) {
+    // _return pointer has now been filled
+    return;
+  }
+  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "ShowIndex failed: unknown result");
+}
+
+bool InfinityServiceProcessor::dispatchCall(::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, const std::string& fname, int32_t seqid, void* callContext) {
+  ProcessMap::iterator pfn;
+  pfn = processMap_.find(fname);
+  if (pfn == processMap_.end()) {
+    iprot->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot->readMessageEnd();
+    iprot->getTransport()->readEnd();
+    ::apache::thrift::TApplicationException x(::apache::thrift::TApplicationException::UNKNOWN_METHOD, "Invalid method name: '"+fname+"'");
+    oprot->writeMessageBegin(fname, ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    x.write(oprot);
+    oprot->writeMessageEnd();
+    oprot->getTransport()->writeEnd();
+    oprot->getTransport()->flush();
+    return true;
+  }
+  (this->*(pfn->second))(seqid, iprot, oprot, callContext);
+  return true;
+}
+
+void InfinityServiceProcessor::process_Connect(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+{
+  void* ctx = nullptr;
+  if (this->eventHandler_.get() != nullptr) {
+    ctx = this->eventHandler_->getContext("InfinityService.Connect", callContext);
+  }
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "InfinityService.Connect");
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->preRead(ctx, "InfinityService.Connect");
+  }
+
+  InfinityService_Connect_args args;
   args.read(iprot);
   iprot->readMessageEnd();
   uint32_t bytes = iprot->getTransport()->readEnd();
 
   if (this->eventHandler_.get() != nullptr) {
-    this->eventHandler_->postRead(ctx, "InfinityService.GetTable", bytes);
+    this->eventHandler_->postRead(ctx, "InfinityService.Connect", bytes);
   }
 
-  InfinityService_GetTable_result result;
+  InfinityService_Connect_result result;
   try {
-    iface_->GetTable(result.success, args.request);
+    iface_->Connect(result.success);
     result.__isset.success = true;
   } catch (const std::exception& e) {
     if (this->eventHandler_.get() != nullptr) {
-      this->eventHandler_->handlerError(ctx, "InfinityService.GetTable");
+      this->eventHandler_->handlerError(ctx, "InfinityService.Connect");
     }
 
     ::apache::thrift::TApplicationException x(e.what());
-    oprot->writeMessageBegin("GetTable", ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    oprot->writeMessageBegin("Connect", ::apache::thrift::protocol::T_EXCEPTION, seqid);
     x.write(oprot);
     oprot->writeMessageEnd();
     oprot->getTransport()->writeEnd();
@@ -7603,52 +7640,52 @@ void InfinityServiceProcessor::process_GetTable(int32_t seqid, ::apache::thrift:
   }
 
   if (this->eventHandler_.get() != nullptr) {
-    this->eventHandler_->preWrite(ctx, "InfinityService.GetTable");
+    this->eventHandler_->preWrite(ctx, "InfinityService.Connect");
   }
 
-  oprot->writeMessageBegin("GetTable", ::apache::thrift::protocol::T_REPLY, seqid);
+  oprot->writeMessageBegin("Connect", ::apache::thrift::protocol::T_REPLY, seqid);
   result.write(oprot);
   oprot->writeMessageEnd();
   bytes = oprot->getTransport()->writeEnd();
   oprot->getTransport()->flush();
 
   if (this->eventHandler_.get() != nullptr) {
-    this->eventHandler_->postWrite(ctx, "InfinityService.GetTable", bytes);
+    this->eventHandler_->postWrite(ctx, "InfinityService.Connect", bytes);
   }
 }
 
-void InfinityServiceProcessor::process_CreateIndex(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+void InfinityServiceProcessor::process_Disconnect(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
 {
   void* ctx = nullptr;
   if (this->eventHandler_.get() != nullptr) {
-    ctx = this->eventHandler_->getContext("InfinityService.CreateIndex", callContext);
+    ctx = this->eventHandler_->getContext("InfinityService.Disconnect", callContext);
   }
-  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "InfinityService.CreateIndex");
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "InfinityService.Disconnect");
 
   if (this->eventHandler_.get() != nullptr) {
-    this->eventHandler_->preRead(ctx, "InfinityService.CreateIndex");
+    this->eventHandler_->preRead(ctx, "InfinityService.Disconnect");
   }
 
-  InfinityService_CreateIndex_args args;
+  InfinityService_Disconnect_args args;
   args.read(iprot);
   iprot->readMessageEnd();
   uint32_t bytes = iprot->getTransport()->readEnd();
 
   if (this->eventHandler_.get() != nullptr) {
-    this->eventHandler_->postRead(ctx, "InfinityService.CreateIndex", bytes);
+    this->eventHandler_->postRead(ctx, "InfinityService.Disconnect", bytes);
   }
 
-  InfinityService_CreateIndex_result result;
+  InfinityService_Disconnect_result result;
   try {
-    iface_->CreateIndex(result.success, args.request);
+    iface_->Disconnect(result.success, args.request);
     result.__isset.success = true;
   } catch (const std::exception& e) {
     if (this->eventHandler_.get() != nullptr) {
-      this->eventHandler_->handlerError(ctx, "InfinityService.CreateIndex");
+      this->eventHandler_->handlerError(ctx, "InfinityService.Disconnect");
     }
 
     ::apache::thrift::TApplicationException x(e.what());
-    oprot->writeMessageBegin("CreateIndex", ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    oprot->writeMessageBegin("Disconnect", ::apache::thrift::protocol::T_EXCEPTION, seqid);
     x.write(oprot);
     oprot->writeMessageEnd();
     oprot->getTransport()->writeEnd();
@@ -7657,52 +7694,52 @@ void InfinityServiceProcessor::process_CreateIndex(int32_t seqid, ::apache::thri
   }
 
   if (this->eventHandler_.get() != nullptr) {
-    this->eventHandler_->preWrite(ctx, "InfinityService.CreateIndex");
+    this->eventHandler_->preWrite(ctx, "InfinityService.Disconnect");
   }
 
-  oprot->writeMessageBegin("CreateIndex", ::apache::thrift::protocol::T_REPLY, seqid);
+  oprot->writeMessageBegin("Disconnect", ::apache::thrift::protocol::T_REPLY, seqid);
   result.write(oprot);
   oprot->writeMessageEnd();
   bytes = oprot->getTransport()->writeEnd();
   oprot->getTransport()->flush();
 
   if (this->eventHandler_.get() != nullptr) {
-    this->eventHandler_->postWrite(ctx, "InfinityService.CreateIndex", bytes);
+    this->eventHandler_->postWrite(ctx, "InfinityService.Disconnect", bytes);
   }
 }
 
-void InfinityServiceProcessor::process_DropIndex(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+void InfinityServiceProcessor::process_CreateDatabase(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
 {
   void* ctx = nullptr;
   if (this->eventHandler_.get() != nullptr) {
-    ctx = this->eventHandler_->getContext("InfinityService.DropIndex", callContext);
+    ctx = this->eventHandler_->getContext("InfinityService.CreateDatabase", callContext);
   }
-  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "InfinityService.DropIndex");
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "InfinityService.CreateDatabase");
 
   if (this->eventHandler_.get() != nullptr) {
-    this->eventHandler_->preRead(ctx, "InfinityService.DropIndex");
+    this->eventHandler_->preRead(ctx, "InfinityService.CreateDatabase");
   }
 
-  InfinityService_DropIndex_args args;
+  InfinityService_CreateDatabase_args args;
   args.read(iprot);
   iprot->readMessageEnd();
   uint32_t bytes = iprot->getTransport()->readEnd();
 
   if (this->eventHandler_.get() != nullptr) {
-    this->eventHandler_->postRead(ctx, "InfinityService.DropIndex", bytes);
+    this->eventHandler_->postRead(ctx, "InfinityService.CreateDatabase", bytes);
   }
 
-  InfinityService_DropIndex_result result;
+  InfinityService_CreateDatabase_result result;
   try {
-    iface_->DropIndex(result.success, args.request);
+    iface_->CreateDatabase(result.success, args.request);
     result.__isset.success = true;
   } catch (const std::exception& e) {
     if (this->eventHandler_.get() != nullptr) {
-      this->eventHandler_->handlerError(ctx, "InfinityService.DropIndex");
+      this->eventHandler_->handlerError(ctx, "InfinityService.CreateDatabase");
     }
 
     ::apache::thrift::TApplicationException x(e.what());
-    oprot->writeMessageBegin("DropIndex", ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    oprot->writeMessageBegin("CreateDatabase", ::apache::thrift::protocol::T_EXCEPTION, seqid);
     x.write(oprot);
     oprot->writeMessageEnd();
     oprot->getTransport()->writeEnd();
@@ -7711,52 +7748,52 @@ void InfinityServiceProcessor::process_DropIndex(int32_t seqid, ::apache::thrift
   }
 
   if (this->eventHandler_.get() != nullptr) {
-    this->eventHandler_->preWrite(ctx, "InfinityService.DropIndex");
+    this->eventHandler_->preWrite(ctx, "InfinityService.CreateDatabase");
   }
 
-  oprot->writeMessageBegin("DropIndex", ::apache::thrift::protocol::T_REPLY, seqid);
+  oprot->writeMessageBegin("CreateDatabase", ::apache::thrift::protocol::T_REPLY, seqid);
   result.write(oprot);
   oprot->writeMessageEnd();
   bytes = oprot->getTransport()->writeEnd();
   oprot->getTransport()->flush();
 
   if (this->eventHandler_.get() != nullptr) {
-    this->eventHandler_->postWrite(ctx, "InfinityService.DropIndex", bytes);
+    this->eventHandler_->postWrite(ctx, "InfinityService.CreateDatabase", bytes);
   }
 }
 
-void InfinityServiceProcessor::process_ShowIndex(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+void InfinityServiceProcessor::process_DropDatabase(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
 {
   void* ctx = nullptr;
   if (this->eventHandler_.get() != nullptr) {
-    ctx = this->eventHandler_->getContext("InfinityService.ShowIndex", callContext);
+    ctx = this->eventHandler_->getContext("InfinityService.DropDatabase", callContext);
   }
-  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "InfinityService.ShowIndex");
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "InfinityService.DropDatabase");
 
   if (this->eventHandler_.get() != nullptr) {
-    this->eventHandler_->preRead(ctx, "InfinityService.ShowIndex");
+    this->eventHandler_->preRead(ctx, "InfinityService.DropDatabase");
   }
 
-  InfinityService_ShowIndex_args args;
+  InfinityService_DropDatabase_args args;
   args.read(iprot);
   iprot->readMessageEnd();
   uint32_t bytes = iprot->getTransport()->readEnd();
 
   if (this->eventHandler_.get() != nullptr) {
-    this->eventHandler_->postRead(ctx, "InfinityService.ShowIndex", bytes);
+    this->eventHandler_->postRead(ctx, "InfinityService.DropDatabase", bytes);
   }
 
-  InfinityService_ShowIndex_result result;
+  InfinityService_DropDatabase_result result;
   try {
-    iface_->ShowIndex(result.success, args.request);
+    iface_->DropDatabase(result.success, args.request);
     result.__isset.success = true;
   } catch (const std::exception& e) {
     if (this->eventHandler_.get() != nullptr) {
-      this->eventHandler_->handlerError(ctx, "InfinityService.ShowIndex");
+      this->eventHandler_->handlerError(ctx, "InfinityService.DropDatabase");
     }
 
     ::apache::thrift::TApplicationException x(e.what());
-    oprot->writeMessageBegin("ShowIndex", ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    oprot->writeMessageBegin("DropDatabase", ::apache::thrift::protocol::T_EXCEPTION, seqid);
     x.write(oprot);
     oprot->writeMessageEnd();
     oprot->getTransport()->writeEnd();
@@ -7765,40 +7802,1834 @@ void InfinityServiceProcessor::process_ShowIndex(int32_t seqid, ::apache::thrift
   }
 
   if (this->eventHandler_.get() != nullptr) {
-    this->eventHandler_->preWrite(ctx, "InfinityService.ShowIndex");
+    this->eventHandler_->preWrite(ctx, "InfinityService.DropDatabase");
+  }
+
+  oprot->writeMessageBegin("DropDatabase", ::apache::thrift::protocol::T_REPLY, seqid);
+  result.write(oprot);
+  oprot->writeMessageEnd();
+  bytes = oprot->getTransport()->writeEnd();
+  oprot->getTransport()->flush();
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->postWrite(ctx, "InfinityService.DropDatabase", bytes);
+  }
+}
+
+void InfinityServiceProcessor::process_CreateTable(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+{
+  void* ctx = nullptr;
+  if (this->eventHandler_.get() != nullptr) {
+    ctx = this->eventHandler_->getContext("InfinityService.CreateTable", callContext);
   }
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "InfinityService.CreateTable");
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->preRead(ctx, "InfinityService.CreateTable");
+  }
+
+  InfinityService_CreateTable_args args;
+  args.read(iprot);
+  iprot->readMessageEnd();
+  uint32_t bytes = iprot->getTransport()->readEnd();
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->postRead(ctx, "InfinityService.CreateTable", bytes);
+  }
+
+  InfinityService_CreateTable_result result;
+  try {
+    iface_->CreateTable(result.success, args.request);
+    result.__isset.success = true;
+  } catch (const std::exception& e) {
+    if (this->eventHandler_.get() != nullptr) {
+      this->eventHandler_->handlerError(ctx, "InfinityService.CreateTable");
+    }
+
+    ::apache::thrift::TApplicationException x(e.what());
+    oprot->writeMessageBegin("CreateTable", ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    x.write(oprot);
+    oprot->writeMessageEnd();
+    oprot->getTransport()->writeEnd();
+    oprot->getTransport()->flush();
+    return;
+  }
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->preWrite(ctx, "InfinityService.CreateTable");
+  }
+
+  oprot->writeMessageBegin("CreateTable", ::apache::thrift::protocol::T_REPLY, seqid);
+  result.write(oprot);
+  oprot->writeMessageEnd();
+  bytes = oprot->getTransport()->writeEnd();
+  oprot->getTransport()->flush();
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->postWrite(ctx, "InfinityService.CreateTable", bytes);
+  }
+}
+
+void InfinityServiceProcessor::process_DropTable(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+{
+  void* ctx = nullptr;
+  if (this->eventHandler_.get() != nullptr) {
+    ctx = this->eventHandler_->getContext("InfinityService.DropTable", callContext);
+  }
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "InfinityService.DropTable");
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->preRead(ctx, "InfinityService.DropTable");
+  }
+
+  InfinityService_DropTable_args args;
+  args.read(iprot);
+  iprot->readMessageEnd();
+  uint32_t bytes = iprot->getTransport()->readEnd();
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->postRead(ctx, "InfinityService.DropTable", bytes);
+  }
+
+  InfinityService_DropTable_result result;
+  try {
+    iface_->DropTable(result.success, args.request);
+    result.__isset.success = true;
+  } catch (const std::exception& e) {
+    if (this->eventHandler_.get() != nullptr) {
+      this->eventHandler_->handlerError(ctx, "InfinityService.DropTable");
+    }
+
+    ::apache::thrift::TApplicationException x(e.what());
+    oprot->writeMessageBegin("DropTable", ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    x.write(oprot);
+    oprot->writeMessageEnd();
+    oprot->getTransport()->writeEnd();
+    oprot->getTransport()->flush();
+    return;
+  }
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->preWrite(ctx, "InfinityService.DropTable");
+  }
+
+  oprot->writeMessageBegin("DropTable", ::apache::thrift::protocol::T_REPLY, seqid);
+  result.write(oprot);
+  oprot->writeMessageEnd();
+  bytes = oprot->getTransport()->writeEnd();
+  oprot->getTransport()->flush();
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->postWrite(ctx, "InfinityService.DropTable", bytes);
+  }
+}
+
+void InfinityServiceProcessor::process_Insert(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+{
+  void* ctx = nullptr;
+  if (this->eventHandler_.get() != nullptr) {
+    ctx = this->eventHandler_->getContext("InfinityService.Insert", callContext);
+  }
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "InfinityService.Insert");
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->preRead(ctx, "InfinityService.Insert");
+  }
+
+  InfinityService_Insert_args args;
+  args.read(iprot);
+  iprot->readMessageEnd();
+  uint32_t bytes = iprot->getTransport()->readEnd();
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->postRead(ctx, "InfinityService.Insert", bytes);
+  }
+
+  InfinityService_Insert_result result;
+  try {
+    iface_->Insert(result.success, args.request);
+    result.__isset.success = true;
+  } catch (const std::exception& e) {
+    if (this->eventHandler_.get() != nullptr) {
+      this->eventHandler_->handlerError(ctx, "InfinityService.Insert");
+    }
+
+    ::apache::thrift::TApplicationException x(e.what());
+    oprot->writeMessageBegin("Insert", ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    x.write(oprot);
+    oprot->writeMessageEnd();
+    oprot->getTransport()->writeEnd();
+    oprot->getTransport()->flush();
+    return;
+  }
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->preWrite(ctx, "InfinityService.Insert");
+  }
+
+  oprot->writeMessageBegin("Insert", ::apache::thrift::protocol::T_REPLY, seqid);
+  result.write(oprot);
+  oprot->writeMessageEnd();
+  bytes = oprot->getTransport()->writeEnd();
+  oprot->getTransport()->flush();
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->postWrite(ctx, "InfinityService.Insert", bytes);
+  }
+}
+
+void InfinityServiceProcessor::process_Import(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+{
+  void* ctx = nullptr;
+  if (this->eventHandler_.get() != nullptr) {
+    ctx = this->eventHandler_->getContext("InfinityService.Import", callContext);
+  }
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "InfinityService.Import");
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->preRead(ctx, "InfinityService.Import");
+  }
+
+  InfinityService_Import_args args;
+  args.read(iprot);
+  iprot->readMessageEnd();
+  uint32_t bytes = iprot->getTransport()->readEnd();
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->postRead(ctx, "InfinityService.Import", bytes);
+  }
+
+  InfinityService_Import_result result;
+  try {
+    iface_->Import(result.success, args.request);
+    result.__isset.success = true;
+  } catch (const std::exception& e) {
+    if (this->eventHandler_.get() != nullptr) {
+      this->eventHandler_->handlerError(ctx, "InfinityService.Import");
+    }
+
+    ::apache::thrift::TApplicationException x(e.what());
+    oprot->writeMessageBegin("Import", ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    x.write(oprot);
+    oprot->writeMessageEnd();
+    oprot->getTransport()->writeEnd();
+    oprot->getTransport()->flush();
+    return;
+  }
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->preWrite(ctx, "InfinityService.Import");
+  }
+
+  oprot->writeMessageBegin("Import", ::apache::thrift::protocol::T_REPLY, seqid);
+  result.write(oprot);
+  oprot->writeMessageEnd();
+  bytes = oprot->getTransport()->writeEnd();
+  oprot->getTransport()->flush();
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->postWrite(ctx, "InfinityService.Import", bytes);
+  }
+}
+
+void InfinityServiceProcessor::process_InsertColumnar(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+{
+  void* ctx = nullptr;
+  if (this->eventHandler_.get() != nullptr) {
+    ctx = this->eventHandler_->getContext("InfinityService.InsertColumnar", callContext);
+  }
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "InfinityService.InsertColumnar");
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->preRead(ctx, "InfinityService.InsertColumnar");
+  }
+
+  InfinityService_InsertColumnar_args args;
+  args.read(iprot);
+  iprot->readMessageEnd();
+  uint32_t bytes = iprot->getTransport()->readEnd();
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->postRead(ctx, "InfinityService.InsertColumnar", bytes);
+  }
+
+  InfinityService_InsertColumnar_result result;
+  try {
+    iface_->InsertColumnar(result.success, args.request);
+    result.__isset.success = true;
+  } catch (const std::exception& e) {
+    if (this->eventHandler_.get() != nullptr) {
+      this->eventHandler_->handlerError(ctx, "InfinityService.InsertColumnar");
+    }
+
+    ::apache::thrift::TApplicationException x(e.what());
+    oprot->writeMessageBegin("InsertColumnar", ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    x.write(oprot);
+    oprot->writeMessageEnd();
+    oprot->getTransport()->writeEnd();
+    oprot->getTransport()->flush();
+    return;
+  }
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->preWrite(ctx, "InfinityService.InsertColumnar");
+  }
+
+  oprot->writeMessageBegin("InsertColumnar", ::apache::thrift::protocol::T_REPLY, seqid);
+  result.write(oprot);
+  oprot->writeMessageEnd();
+  bytes = oprot->getTransport()->writeEnd();
+  oprot->getTransport()->flush();
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->postWrite(ctx, "InfinityService.InsertColumnar", bytes);
+  }
+}
+
+void InfinityServiceProcessor::process_Select(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+{
+  void* ctx = nullptr;
+  if (this->eventHandler_.get() != nullptr) {
+    ctx = this->eventHandler_->getContext("InfinityService.Select", callContext);
+  }
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "InfinityService.Select");
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->preRead(ctx, "InfinityService.Select");
+  }
+
+  InfinityService_Select_args args;
+  args.read(iprot);
+  iprot->readMessageEnd();
+  uint32_t bytes = iprot->getTransport()->readEnd();
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->postRead(ctx, "InfinityService.Select", bytes);
+  }
+
+  InfinityService_Select_result result;
+  try {
+    iface_->Select(result.success, args.request);
+    result.__isset.success = true;
+  } catch (const std::exception& e) {
+    if (this->eventHandler_.get() != nullptr) {
+      this->eventHandler_->handlerError(ctx, "InfinityService.Select");
+    }
+
+    ::apache::thrift::TApplicationException x(e.what());
+    oprot->writeMessageBegin("Select", ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    x.write(oprot);
+    oprot->writeMessageEnd();
+    oprot->getTransport()->writeEnd();
+    oprot->getTransport()->flush();
+    return;
+  }
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->preWrite(ctx, "InfinityService.Select");
+  }
+
+  oprot->writeMessageBegin("Select", ::apache::thrift::protocol::T_REPLY, seqid);
+  result.write(oprot);
+  oprot->writeMessageEnd();
+  bytes = oprot->getTransport()->writeEnd();
+  oprot->getTransport()->flush();
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->postWrite(ctx, "InfinityService.Select", bytes);
+  }
+}
+
+void InfinityServiceProcessor::process_BatchSelect(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+{
+  void* ctx = nullptr;
+  if (this->eventHandler_.get() != nullptr) {
+    ctx = this->eventHandler_->getContext("InfinityService.BatchSelect", callContext);
+  }
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "InfinityService.BatchSelect");
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->preRead(ctx, "InfinityService.BatchSelect");
+  }
+
+  InfinityService_BatchSelect_args args;
+  args.read(iprot);
+  iprot->readMessageEnd();
+  uint32_t bytes = iprot->getTransport()->readEnd();
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->postRead(ctx, "InfinityService.BatchSelect", bytes);
+  }
+
+  InfinityService_BatchSelect_result result;
+  try {
+    iface_->BatchSelect(result.success, args.request);
+    result.__isset.success = true;
+  } catch (const std::exception& e) {
+    if (this->eventHandler_.get() != nullptr) {
+      this->eventHandler_->handlerError(ctx, "InfinityService.BatchSelect");
+    }
+
+    ::apache::thrift::TApplicationException x(e.what());
+    oprot->writeMessageBegin("BatchSelect", ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    x.write(oprot);
+    oprot->writeMessageEnd();
+    oprot->getTransport()->writeEnd();
+    oprot->getTransport()->flush();
+    return;
+  }
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->preWrite(ctx, "InfinityService.BatchSelect");
+  }
+
+  oprot->writeMessageBegin("BatchSelect", ::apache::thrift::protocol::T_REPLY, seqid);
+  result.write(oprot);
+  oprot->writeMessageEnd();
+  bytes = oprot->getTransport()->writeEnd();
+  oprot->getTransport()->flush();
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->postWrite(ctx, "InfinityService.BatchSelect", bytes);
+  }
+}
+
+void InfinityServiceProcessor::process_OpenCursor(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+{
+  void* ctx = nullptr;
+  if (this->eventHandler_.get() != nullptr) {
+    ctx = this->eventHandler_->getContext("InfinityService.OpenCursor", callContext);
+  }
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "InfinityService.OpenCursor");
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->preRead(ctx, "InfinityService.OpenCursor");
+  }
+
+  InfinityService_OpenCursor_args args;
+  args.read(iprot);
+  iprot->readMessageEnd();
+  uint32_t bytes = iprot->getTransport()->readEnd();
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->postRead(ctx, "InfinityService.OpenCursor", bytes);
+  }
+
+  InfinityService_OpenCursor_result result;
+  try {
+    iface_->OpenCursor(result.success, args.request);
+    result.__isset.success = true;
+  } catch (const std::exception& e) {
+    if (this->eventHandler_.get() != nullptr) {
+      this->eventHandler_->handlerError(ctx, "InfinityService.OpenCursor");
+    }
+
+    ::apache::thrift::TApplicationException x(e.what());
+    oprot->writeMessageBegin("OpenCursor", ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    x.write(oprot);
+    oprot->writeMessageEnd();
+    oprot->getTransport()->writeEnd();
+    oprot->getTransport()->flush();
+    return;
+  }
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->preWrite(ctx, "InfinityService.OpenCursor");
+  }
+
+  oprot->writeMessageBegin("OpenCursor", ::apache::thrift::protocol::T_REPLY, seqid);
+  result.write(oprot);
+  oprot->writeMessageEnd();
+  bytes = oprot->getTransport()->writeEnd();
+  oprot->getTransport()->flush();
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->postWrite(ctx, "InfinityService.OpenCursor", bytes);
+  }
+}
+
+void InfinityServiceProcessor::process_FetchCursor(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+{
+  void* ctx = nullptr;
+  if (this->eventHandler_.get() != nullptr) {
+    ctx = this->eventHandler_->getContext("InfinityService.FetchCursor", callContext);
+  }
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "InfinityService.FetchCursor");
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->preRead(ctx, "InfinityService.FetchCursor");
+  }
+
+  InfinityService_FetchCursor_args args;
+  args.read(iprot);
+  iprot->readMessageEnd();
+  uint32_t bytes = iprot->getTransport()->readEnd();
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->postRead(ctx, "InfinityService.FetchCursor", bytes);
+  }
+
+  InfinityService_FetchCursor_result result;
+  try {
+    iface_->FetchCursor(result.success, args.request);
+    result.__isset.success = true;
+  } catch (const std::exception& e) {
+    if (this->eventHandler_.get() != nullptr) {
+      this->eventHandler_->handlerError(ctx, "InfinityService.FetchCursor");
+    }
+
+    ::apache::thrift::TApplicationException x(e.what());
+    oprot->writeMessageBegin("FetchCursor", ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    x.write(oprot);
+    oprot->writeMessageEnd();
+    oprot->getTransport()->writeEnd();
+    oprot->getTransport()->flush();
+    return;
+  }
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->preWrite(ctx, "InfinityService.FetchCursor");
+  }
+
+  oprot->writeMessageBegin("FetchCursor", ::apache::thrift::protocol::T_REPLY, seqid);
+  result.write(oprot);
+  oprot->writeMessageEnd();
+  bytes = oprot->getTransport()->writeEnd();
+  oprot->getTransport()->flush();
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->postWrite(ctx, "InfinityService.FetchCursor", bytes);
+  }
+}
+
+void InfinityServiceProcessor::process_Explain(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+{
+  void* ctx = nullptr;
+  if (this->eventHandler_.get() != nullptr) {
+    ctx = this->eventHandler_->getContext("InfinityService.Explain", callContext);
+  }
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "InfinityService.Explain");
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->preRead(ctx, "InfinityService.Explain");
+  }
+
+  InfinityService_Explain_args args;
+  args.read(iprot);
+  iprot->readMessageEnd();
+  uint32_t bytes = iprot->getTransport()->readEnd();
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->postRead(ctx, "InfinityService.Explain", bytes);
+  }
+
+  InfinityService_Explain_result result;
+  try {
+    iface_->Explain(result.success, args.request);
+    result.__isset.success = true;
+  } catch (const std::exception& e) {
+    if (this->eventHandler_.get() != nullptr) {
+      this->eventHandler_->handlerError(ctx, "InfinityService.Explain");
+    }
+
+    ::apache::thrift::TApplicationException x(e.what());
+    oprot->writeMessageBegin("Explain", ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    x.write(oprot);
+    oprot->writeMessageEnd();
+    oprot->getTransport()->writeEnd();
+    oprot->getTransport()->flush();
+    return;
+  }
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->preWrite(ctx, "InfinityService.Explain");
+  }
+
+  oprot->writeMessageBegin("Explain", ::apache::thrift::protocol::T_REPLY, seqid);
+  result.write(oprot);
+  oprot->writeMessageEnd();
+  bytes = oprot->getTransport()->writeEnd();
+  oprot->getTransport()->flush();
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->postWrite(ctx, "InfinityService.Explain", bytes);
+  }
+}
+
+void InfinityServiceProcessor::process_Delete(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+{
+  void* ctx = nullptr;
+  if (this->eventHandler_.get() != nullptr) {
+    ctx = this->eventHandler_->getContext("InfinityService.Delete", callContext);
+  }
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "InfinityService.Delete");
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->preRead(ctx, "InfinityService.Delete");
+  }
+
+  InfinityService_Delete_args args;
+  args.read(iprot);
+  iprot->readMessageEnd();
+  uint32_t bytes = iprot->getTransport()->readEnd();
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->postRead(ctx, "InfinityService.Delete", bytes);
+  }
+
+  InfinityService_Delete_result result;
+  try {
+    iface_->Delete(result.success, args.request);
+    result.__isset.success = true;
+  } catch (const std::exception& e) {
+    if (this->eventHandler_.get() != nullptr) {
+      this->eventHandler_->handlerError(ctx, "InfinityService.Delete");
+    }
+
+    ::apache::thrift::TApplicationException x(e.what());
+    oprot->writeMessageBegin("Delete", ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    x.write(oprot);
+    oprot->writeMessageEnd();
+    oprot->getTransport()->writeEnd();
+    oprot->getTransport()->flush();
+    return;
+  }
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->preWrite(ctx, "InfinityService.Delete");
+  }
+
+  oprot->writeMessageBegin("Delete", ::apache::thrift::protocol::T_REPLY, seqid);
+  result.write(oprot);
+  oprot->writeMessageEnd();
+  bytes = oprot->getTransport()->writeEnd();
+  oprot->getTransport()->flush();
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->postWrite(ctx, "InfinityService.Delete", bytes);
+  }
+}
+
+void InfinityServiceProcessor::process_CloseCursor(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+{
+  void* ctx = nullptr;
+  if (this->eventHandler_.get() != nullptr) {
+    ctx = this->eventHandler_->getContext("InfinityService.CloseCursor", callContext);
+  }
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "InfinityService.CloseCursor");
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->preRead(ctx, "InfinityService.CloseCursor");
+  }
+
+  InfinityService_CloseCursor_args args;
+  args.read(iprot);
+  iprot->readMessageEnd();
+  uint32_t bytes = iprot->getTransport()->readEnd();
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->postRead(ctx, "InfinityService.CloseCursor", bytes);
+  }
+
+  InfinityService_CloseCursor_result result;
+  try {
+    iface_->CloseCursor(result.success, args.request);
+    result.__isset.success = true;
+  } catch (const std::exception& e) {
+    if (this->eventHandler_.get() != nullptr) {
+      this->eventHandler_->handlerError(ctx, "InfinityService.CloseCursor");
+    }
+
+    ::apache::thrift::TApplicationException x(e.what());
+    oprot->writeMessageBegin("CloseCursor", ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    x.write(oprot);
+    oprot->writeMessageEnd();
+    oprot->getTransport()->writeEnd();
+    oprot->getTransport()->flush();
+    return;
+  }
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->preWrite(ctx, "InfinityService.CloseCursor");
+  }
+
+  oprot->writeMessageBegin("CloseCursor", ::apache::thrift::protocol::T_REPLY, seqid);
+  result.write(oprot);
+  oprot->writeMessageEnd();
+  bytes = oprot->getTransport()->writeEnd();
+  oprot->getTransport()->flush();
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->postWrite(ctx, "InfinityService.CloseCursor", bytes);
+  }
+}
+
+void InfinityServiceProcessor::process_Update(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+{
+  void* ctx = nullptr;
+  if (this->eventHandler_.get() != nullptr) {
+    ctx = this->eventHandler_->getContext("InfinityService.Update", callContext);
+  }
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "InfinityService.Update");
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->preRead(ctx, "InfinityService.Update");
+  }
+
+  InfinityService_Update_args args;
+  args.read(iprot);
+  iprot->readMessageEnd();
+  uint32_t bytes = iprot->getTransport()->readEnd();
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->postRead(ctx, "InfinityService.Update", bytes);
+  }
+
+  InfinityService_Update_result result;
+  try {
+    iface_->Update(result.success, args.request);
+    result.__isset.success = true;
+  } catch (const std::exception& e) {
+    if (this->eventHandler_.get() != nullptr) {
+      this->eventHandler_->handlerError(ctx, "InfinityService.Update");
+    }
+
+    ::apache::thrift::TApplicationException x(e.what());
+    oprot->writeMessageBegin("Update", ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    x.write(oprot);
+    oprot->writeMessageEnd();
+    oprot->getTransport()->writeEnd();
+    oprot->getTransport()->flush();
+    return;
+  }
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->preWrite(ctx, "InfinityService.Update");
+  }
+
+  oprot->writeMessageBegin("Update", ::apache::thrift::protocol::T_REPLY, seqid);
+  result.write(oprot);
+  oprot->writeMessageEnd();
+  bytes = oprot->getTransport()->writeEnd();
+  oprot->getTransport()->flush();
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->postWrite(ctx, "InfinityService.Update", bytes);
+  }
+}
+
+void InfinityServiceProcessor::process_UploadFileChunk(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+{
+  void* ctx = nullptr;
+  if (this->eventHandler_.get() != nullptr) {
+    ctx = this->eventHandler_->getContext("InfinityService.UploadFileChunk", callContext);
+  }
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "InfinityService.UploadFileChunk");
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->preRead(ctx, "InfinityService.UploadFileChunk");
+  }
+
+  InfinityService_UploadFileChunk_args args;
+  args.read(iprot);
+  iprot->readMessageEnd();
+  uint32_t bytes = iprot->getTransport()->readEnd();
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->postRead(ctx, "InfinityService.UploadFileChunk", bytes);
+  }
+
+  InfinityService_UploadFileChunk_result result;
+  try {
+    iface_->UploadFileChunk(result.success, args.request);
+    result.__isset.success = true;
+  } catch (const std::exception& e) {
+    if (this->eventHandler_.get() != nullptr) {
+      this->eventHandler_->handlerError(ctx, "InfinityService.UploadFileChunk");
+    }
+
+    ::apache::thrift::TApplicationException x(e.what());
+    oprot->writeMessageBegin("UploadFileChunk", ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    x.write(oprot);
+    oprot->writeMessageEnd();
+    oprot->getTransport()->writeEnd();
+    oprot->getTransport()->flush();
+    return;
+  }
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->preWrite(ctx, "InfinityService.UploadFileChunk");
+  }
+
+  oprot->writeMessageBegin("UploadFileChunk", ::apache::thrift::protocol::T_REPLY, seqid);
+  result.write(oprot);
+  oprot->writeMessageEnd();
+  bytes = oprot->getTransport()->writeEnd();
+  oprot->getTransport()->flush();
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->postWrite(ctx, "InfinityService.UploadFileChunk", bytes);
+  }
+}
+
+void InfinityServiceProcessor::process_ListDatabase(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+{
+  void* ctx = nullptr;
+  if (this->eventHandler_.get() != nullptr) {
+    ctx = this->eventHandler_->getContext("InfinityService.ListDatabase", callContext);
+  }
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "InfinityService.ListDatabase");
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->preRead(ctx, "InfinityService.ListDatabase");
+  }
+
+  InfinityService_ListDatabase_args args;
+  args.read(iprot);
+  iprot->readMessageEnd();
+  uint32_t bytes = iprot->getTransport()->readEnd();
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->postRead(ctx, "InfinityService.ListDatabase", bytes);
+  }
+
+  InfinityService_ListDatabase_result result;
+  try {
+    iface_->ListDatabase(result.success, args.request);
+    result.__isset.success = true;
+  } catch (const std::exception& e) {
+    if (this->eventHandler_.get() != nullptr) {
+      this->eventHandler_->handlerError(ctx, "InfinityService.ListDatabase");
+    }
+
+    ::apache::thrift::TApplicationException x(e.what());
+    oprot->writeMessageBegin("ListDatabase", ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    x.write(oprot);
+    oprot->writeMessageEnd();
+    oprot->getTransport()->writeEnd();
+    oprot->getTransport()->flush();
+    return;
+  }
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->preWrite(ctx, "InfinityService.ListDatabase");
+  }
+
+  oprot->writeMessageBegin("ListDatabase", ::apache::thrift::protocol::T_REPLY, seqid);
+  result.write(oprot);
+  oprot->writeMessageEnd();
+  bytes = oprot->getTransport()->writeEnd();
+  oprot->getTransport()->flush();
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->postWrite(ctx, "InfinityService.ListDatabase", bytes);
+  }
+}
+
+void InfinityServiceProcessor::process_ListTable(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+{
+  void* ctx = nullptr;
+  if (this->eventHandler_.get() != nullptr) {
+    ctx = this->eventHandler_->getContext("InfinityService.ListTable", callContext);
+  }
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "InfinityService.ListTable");
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->preRead(ctx, "InfinityService.ListTable");
+  }
+
+  InfinityService_ListTable_args args;
+  args.read(iprot);
+  iprot->readMessageEnd();
+  uint32_t bytes = iprot->getTransport()->readEnd();
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->postRead(ctx, "InfinityService.ListTable", bytes);
+  }
+
+  InfinityService_ListTable_result result;
+  try {
+    iface_->ListTable(result.success, args.request);
+    result.__isset.success = true;
+  } catch (const std::exception& e) {
+    if (this->eventHandler_.get() != nullptr) {
+      this->eventHandler_->handlerError(ctx, "InfinityService.ListTable");
+    }
+
+    ::apache::thrift::TApplicationException x(e.what());
+    oprot->writeMessageBegin("ListTable", ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    x.write(oprot);
+    oprot->writeMessageEnd();
+    oprot->getTransport()->writeEnd();
+    oprot->getTransport()->flush();
+    return;
+  }
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->preWrite(ctx, "InfinityService.ListTable");
+  }
+
+  oprot->writeMessageBegin("ListTable", ::apache::thrift::protocol::T_REPLY, seqid);
+  result.write(oprot);
+  oprot->writeMessageEnd();
+  bytes = oprot->getTransport()->writeEnd();
+  oprot->getTransport()->flush();
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->postWrite(ctx, "InfinityService.ListTable", bytes);
+  }
+}
+
+void InfinityServiceProcessor::process_ListIndex(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+{
+  void* ctx = nullptr;
+  if (this->eventHandler_.get() != nullptr) {
+    ctx = this->eventHandler_->getContext("InfinityService.ListIndex", callContext);
+  }
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "InfinityService.ListIndex");
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->preRead(ctx, "InfinityService.ListIndex");
+  }
+
+  InfinityService_ListIndex_args args;
+  args.read(iprot);
+  iprot->readMessageEnd();
+  uint32_t bytes = iprot->getTransport()->readEnd();
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->postRead(ctx, "InfinityService.ListIndex", bytes);
+  }
+
+  InfinityService_ListIndex_result result;
+  try {
+    iface_->ListIndex(result.success, args.request);
+    result.__isset.success = true;
+  } catch (const std::exception& e) {
+    if (this->eventHandler_.get() != nullptr) {
+      this->eventHandler_->handlerError(ctx, "InfinityService.ListIndex");
+    }
+
+    ::apache::thrift::TApplicationException x(e.what());
+    oprot->writeMessageBegin("ListIndex", ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    x.write(oprot);
+    oprot->writeMessageEnd();
+    oprot->getTransport()->writeEnd();
+    oprot->getTransport()->flush();
+    return;
+  }
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->preWrite(ctx, "InfinityService.ListIndex");
+  }
+
+  oprot->writeMessageBegin("ListIndex", ::apache::thrift::protocol::T_REPLY, seqid);
+  result.write(oprot);
+  oprot->writeMessageEnd();
+  bytes = oprot->getTransport()->writeEnd();
+  oprot->getTransport()->flush();
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->postWrite(ctx, "InfinityService.ListIndex", bytes);
+  }
+}
+
+void InfinityServiceProcessor::process_ShowVariable(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+{
+  void* ctx = nullptr;
+  if (this->eventHandler_.get() != nullptr) {
+    ctx = this->eventHandler_->getContext("InfinityService.ShowVariable", callContext);
+  }
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "InfinityService.ShowVariable");
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->preRead(ctx, "InfinityService.ShowVariable");
+  }
+
+  InfinityService_ShowVariable_args args;
+  args.read(iprot);
+  iprot->readMessageEnd();
+  uint32_t bytes = iprot->getTransport()->readEnd();
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->postRead(ctx, "InfinityService.ShowVariable", bytes);
+  }
+
+  InfinityService_ShowVariable_result result;
+  try {
+    iface_->ShowVariable(result.success, args.request);
+    result.__isset.success = true;
+  } catch (const std::exception& e) {
+    if (this->eventHandler_.get() != nullptr) {
+      this->eventHandler_->handlerError(ctx, "InfinityService.ShowVariable");
+    }
+
+    ::apache::thrift::TApplicationException x(e.what());
+    oprot->writeMessageBegin("ShowVariable", ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    x.write(oprot);
+    oprot->writeMessageEnd();
+    oprot->getTransport()->writeEnd();
+    oprot->getTransport()->flush();
+    return;
+  }
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->preWrite(ctx, "InfinityService.ShowVariable");
+  }
+
+  oprot->writeMessageBegin("ShowVariable", ::apache::thrift::protocol::T_REPLY, seqid);
+  result.write(oprot);
+  oprot->writeMessageEnd();
+  bytes = oprot->getTransport()->writeEnd();
+  oprot->getTransport()->flush();
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->postWrite(ctx, "InfinityService.ShowVariable", bytes);
+  }
+}
+
+void InfinityServiceProcessor::process_ShowTable(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+{
+  void* ctx = nullptr;
+  if (this->eventHandler_.get() != nullptr) {
+    ctx = this->eventHandler_->getContext("InfinityService.ShowTable", callContext);
+  }
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "InfinityService.ShowTable");
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->preRead(ctx, "InfinityService.ShowTable");
+  }
+
+  InfinityService_ShowTable_args args;
+  args.read(iprot);
+  iprot->readMessageEnd();
+  uint32_t bytes = iprot->getTransport()->readEnd();
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->postRead(ctx, "InfinityService.ShowTable", bytes);
+  }
+
+  InfinityService_ShowTable_result result;
+  try {
+    iface_->ShowTable(result.success, args.request);
+    result.__isset.success = true;
+  } catch (const std::exception& e) {
+    if (this->eventHandler_.get() != nullptr) {
+      this->eventHandler_->handlerError(ctx, "InfinityService.ShowTable");
+    }
+
+    ::apache::thrift::TApplicationException x(e.what());
+    oprot->writeMessageBegin("ShowTable", ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    x.write(oprot);
+    oprot->writeMessageEnd();
+    oprot->getTransport()->writeEnd();
+    oprot->getTransport()->flush();
+    return;
+  }
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->preWrite(ctx, "InfinityService.ShowTable");
+  }
+
+  oprot->writeMessageBegin("ShowTable", ::apache::thrift::protocol::T_REPLY, seqid);
+  result.write(oprot);
+  oprot->writeMessageEnd();
+  bytes = oprot->getTransport()->writeEnd();
+  oprot->getTransport()->flush();
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->postWrite(ctx, "InfinityService.ShowTable", bytes);
+  }
+}
+
+void InfinityServiceProcessor::process_ShowColumns(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+{
+  void* ctx = nullptr;
+  if (this->eventHandler_.get() != nullptr) {
+    ctx = this->eventHandler_->getContext("InfinityService.ShowColumns", callContext);
+  }
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "InfinityService.ShowColumns");
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->preRead(ctx, "InfinityService.ShowColumns");
+  }
+
+  InfinityService_ShowColumns_args args;
+  args.read(iprot);
+  iprot->readMessageEnd();
+  uint32_t bytes = iprot->getTransport()->readEnd();
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->postRead(ctx, "InfinityService.ShowColumns", bytes);
+  }
+
+  InfinityService_ShowColumns_result result;
+  try {
+    iface_->ShowColumns(result.success, args.request);
+    result.__isset.success = true;
+  } catch (const std::exception& e) {
+    if (this->eventHandler_.get() != nullptr) {
+      this->eventHandler_->handlerError(ctx, "InfinityService.ShowColumns");
+    }
+
+    ::apache::thrift::TApplicationException x(e.what());
+    oprot->writeMessageBegin("ShowColumns", ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    x.write(oprot);
+    oprot->writeMessageEnd();
+    oprot->getTransport()->writeEnd();
+    oprot->getTransport()->flush();
+    return;
+  }
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->preWrite(ctx, "InfinityService.ShowColumns");
+  }
+
+  oprot->writeMessageBegin("ShowColumns", ::apache::thrift::protocol::T_REPLY, seqid);
+  result.write(oprot);
+  oprot->writeMessageEnd();
+  bytes = oprot->getTransport()->writeEnd();
+  oprot->getTransport()->flush();
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->postWrite(ctx, "InfinityService.ShowColumns", bytes);
+  }
+}
+
+void InfinityServiceProcessor::process_ShowDatabase(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+{
+  void* ctx = nullptr;
+  if (this->eventHandler_.get() != nullptr) {
+    ctx = this->eventHandler_->getContext("InfinityService.ShowDatabase", callContext);
+  }
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "InfinityService.ShowDatabase");
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->preRead(ctx, "InfinityService.ShowDatabase");
+  }
+
+  InfinityService_ShowDatabase_args args;
+  args.read(iprot);
+  iprot->readMessageEnd();
+  uint32_t bytes = iprot->getTransport()->readEnd();
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->postRead(ctx, "InfinityService.ShowDatabase", bytes);
+  }
+
+  InfinityService_ShowDatabase_result result;
+  try {
+    iface_->ShowDatabase(result.success, args.request);
+    result.__isset.success = true;
+  } catch (const std::exception& e) {
+    if (this->eventHandler_.get() != nullptr) {
+      this->eventHandler_->handlerError(ctx, "InfinityService.ShowDatabase");
+    }
+
+    ::apache::thrift::TApplicationException x(e.what());
+    oprot->writeMessageBegin("ShowDatabase", ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    x.write(oprot);
+    oprot->writeMessageEnd();
+    oprot->getTransport()->writeEnd();
+    oprot->getTransport()->flush();
+    return;
+  }
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->preWrite(ctx, "InfinityService.ShowDatabase");
+  }
+
+  oprot->writeMessageBegin("ShowDatabase", ::apache::thrift::protocol::T_REPLY, seqid);
+  result.write(oprot);
+  oprot->writeMessageEnd();
+  bytes = oprot->getTransport()->writeEnd();
+  oprot->getTransport()->flush();
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->postWrite(ctx, "InfinityService.ShowDatabase", bytes);
+  }
+}
+
+void InfinityServiceProcessor::process_ShowTables(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+{
+  void* ctx = nullptr;
+  if (this->eventHandler_.get() != nullptr) {
+    ctx = this->eventHandler_->getContext("InfinityService.ShowTables", callContext);
+  }
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "InfinityService.ShowTables");
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->preRead(ctx, "InfinityService.ShowTables");
+  }
+
+  InfinityService_ShowTables_args args;
+  args.read(iprot);
+  iprot->readMessageEnd();
+  uint32_t bytes = iprot->getTransport()->readEnd();
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->postRead(ctx, "InfinityService.ShowTables", bytes);
+  }
+
+  InfinityService_ShowTables_result result;
+  try {
+    iface_->ShowTables(result.success, args.request);
+    result.__isset.success = true;
+  } catch (const std::exception& e) {
+    if (this->eventHandler_.get() != nullptr) {
+      this->eventHandler_->handlerError(ctx, "InfinityService.ShowTables");
+    }
+
+    ::apache::thrift::TApplicationException x(e.what());
+    oprot->writeMessageBegin("ShowTables", ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    x.write(oprot);
+    oprot->writeMessageEnd();
+    oprot->getTransport()->writeEnd();
+    oprot->getTransport()->flush();
+    return;
+  }
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->preWrite(ctx, "InfinityService.ShowTables");
+  }
+
+  oprot->writeMessageBegin("ShowTables", ::apache::thrift::protocol::T_REPLY, seqid);
+  result.write(oprot);
+  oprot->writeMessageEnd();
+  bytes = oprot->getTransport()->writeEnd();
+  oprot->getTransport()->flush();
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->postWrite(ctx, "InfinityService.ShowTables", bytes);
+  }
+}
+
+void InfinityServiceProcessor::process_GetDatabase(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+{
+  void* ctx = nullptr;
+  if (this->eventHandler_.get() != nullptr) {
+    ctx = this->eventHandler_->getContext("InfinityService.GetDatabase", callContext);
+  }
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "InfinityService.GetDatabase");
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->preRead(ctx, "InfinityService.GetDatabase");
+  }
+
+  InfinityService_GetDatabase_args args;
+  args.read(iprot);
+  iprot->readMessageEnd();
+  uint32_t bytes = iprot->getTransport()->readEnd();
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->postRead(ctx, "InfinityService.GetDatabase", bytes);
+  }
+
+  InfinityService_GetDatabase_result result;
+  try {
+    iface_->GetDatabase(result.success, args.request);
+    result.__isset.success = true;
+  } catch (const std::exception& e) {
+    if (this->eventHandler_.get() != nullptr) {
+      this->eventHandler_->handlerError(ctx, "InfinityService.GetDatabase");
+    }
+
+    ::apache::thrift::TApplicationException x(e.what());
+    oprot->writeMessageBegin("GetDatabase", ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    x.write(oprot);
+    oprot->writeMessageEnd();
+    oprot->getTransport()->writeEnd();
+    oprot->getTransport()->flush();
+    return;
+  }
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->preWrite(ctx, "InfinityService.GetDatabase");
+  }
+
+  oprot->writeMessageBegin("GetDatabase", ::apache::thrift::protocol::T_REPLY, seqid);
+  result.write(oprot);
+  oprot->writeMessageEnd();
+  bytes = oprot->getTransport()->writeEnd();
+  oprot->getTransport()->flush();
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->postWrite(ctx, "InfinityService.GetDatabase", bytes);
+  }
+}
+
+void InfinityServiceProcessor::process_GetTable(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+{
+  void* ctx = nullptr;
+  if (this->eventHandler_.get() != nullptr) {
+    ctx = this->eventHandler_->getContext("InfinityService.GetTable", callContext);
+  }
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "InfinityService.GetTable");
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->preRead(ctx, "InfinityService.GetTable");
+  }
+
+  InfinityService_GetTable_args args;
+  args.read(iprot);
+  iprot->readMessageEnd();
+  uint32_t bytes = iprot->getTransport()->readEnd();
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->postRead(ctx, "InfinityService.GetTable", bytes);
+  }
+
+  InfinityService_GetTable_result result;
+  try {
+    iface_->GetTable(result.success, args.request);
+    result.__isset.success = true;
+  } catch (const std::exception& e) {
+    if (this->eventHandler_.get() != nullptr) {
+      this->eventHandler_->handlerError(ctx, "InfinityService.GetTable");
+    }
+
+    ::apache::thrift::TApplicationException x(e.what());
+    oprot->writeMessageBegin("GetTable", ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    x.write(oprot);
+    oprot->writeMessageEnd();
+    oprot->getTransport()->writeEnd();
+    oprot->getTransport()->flush();
+    return;
+  }
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->preWrite(ctx, "InfinityService.GetTable");
+  }
+
+  oprot->writeMessageBegin("GetTable", ::apache::thrift::protocol::T_REPLY, seqid);
+  result.write(oprot);
+  oprot->writeMessageEnd();
+  bytes = oprot->getTransport()->writeEnd();
+  oprot->getTransport()->flush();
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->postWrite(ctx, "InfinityService.GetTable", bytes);
+  }
+}
+
+void InfinityServiceProcessor::process_CreateIndex(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+{
+  void* ctx = nullptr;
+  if (this->eventHandler_.get() != nullptr) {
+    ctx = this->eventHandler_->getContext("InfinityService.CreateIndex", callContext);
+  }
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "InfinityService.CreateIndex");
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->preRead(ctx, "InfinityService.CreateIndex");
+  }
+
+  InfinityService_CreateIndex_args args;
+  args.read(iprot);
+  iprot->readMessageEnd();
+  uint32_t bytes = iprot->getTransport()->readEnd();
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->postRead(ctx, "InfinityService.CreateIndex", bytes);
+  }
+
+  InfinityService_CreateIndex_result result;
+  try {
+    iface_->CreateIndex(result.success, args.request);
+    result.__isset.success = true;
+  } catch (const std::exception& e) {
+    if (this->eventHandler_.get() != nullptr) {
+      this->eventHandler_->handlerError(ctx, "InfinityService.CreateIndex");
+    }
+
+    ::apache::thrift::TApplicationException x(e.what());
+    oprot->writeMessageBegin("CreateIndex", ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    x.write(oprot);
+    oprot->writeMessageEnd();
+    oprot->getTransport()->writeEnd();
+    oprot->getTransport()->flush();
+    return;
+  }
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->preWrite(ctx, "InfinityService.CreateIndex");
+  }
+
+  oprot->writeMessageBegin("CreateIndex", ::apache::thrift::protocol::T_REPLY, seqid);
+  result.write(oprot);
+  oprot->writeMessageEnd();
+  bytes = oprot->getTransport()->writeEnd();
+  oprot->getTransport()->flush();
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->postWrite(ctx, "InfinityService.CreateIndex", bytes);
+  }
+}
+
+void InfinityServiceProcessor::process_DropIndex(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+{
+  void* ctx = nullptr;
+  if (this->eventHandler_.get() != nullptr) {
+    ctx = this->eventHandler_->getContext("InfinityService.DropIndex", callContext);
+  }
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "InfinityService.DropIndex");
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->preRead(ctx, "InfinityService.DropIndex");
+  }
+
+  InfinityService_DropIndex_args args;
+  args.read(iprot);
+  iprot->readMessageEnd();
+  uint32_t bytes = iprot->getTransport()->readEnd();
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->postRead(ctx, "InfinityService.DropIndex", bytes);
+  }
+
+  InfinityService_DropIndex_result result;
+  try {
+    iface_->DropIndex(result.success, args.request);
+    result.__isset.success = true;
+  } catch (const std::exception& e) {
+    if (this->eventHandler_.get() != nullptr) {
+      this->eventHandler_->handlerError(ctx, "InfinityService.DropIndex");
+    }
+
+    ::apache::thrift::TApplicationException x(e.what());
+    oprot->writeMessageBegin("DropIndex", ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    x.write(oprot);
+    oprot->writeMessageEnd();
+    oprot->getTransport()->writeEnd();
+    oprot->getTransport()->flush();
+    return;
+  }
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->preWrite(ctx, "InfinityService.DropIndex");
+  }
+
+  oprot->writeMessageBegin("DropIndex", ::apache::thrift::protocol::T_REPLY, seqid);
+  result.write(oprot);
+  oprot->writeMessageEnd();
+  bytes = oprot->getTransport()->writeEnd();
+  oprot->getTransport()->flush();
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->postWrite(ctx, "InfinityService.DropIndex", bytes);
+  }
+}
+
+void InfinityServiceProcessor::process_ShowIndex(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+{
+  void* ctx = nullptr;
+  if (this->eventHandler_.get() != nullptr) {
+    ctx = this->eventHandler_->getContext("InfinityService.ShowIndex", callContext);
+  }
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "InfinityService.ShowIndex");
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->preRead(ctx, "InfinityService.ShowIndex");
+  }
+
+  InfinityService_ShowIndex_args args;
+  args.read(iprot);
+  iprot->readMessageEnd();
+  uint32_t bytes = iprot->getTransport()->readEnd();
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->postRead(ctx, "InfinityService.ShowIndex", bytes);
+  }
+
+  InfinityService_ShowIndex_result result;
+  try {
+    iface_->ShowIndex(result.success, args.request);
+    result.__isset.success = true;
+  } catch (const std::exception& e) {
+    if (this->eventHandler_.get() != nullptr) {
+      this->eventHandler_->handlerError(ctx, "InfinityService.ShowIndex");
+    }
+
+    ::apache::thrift::TApplicationException x(e.what());
+    oprot->writeMessageBegin("ShowIndex", ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    x.write(oprot);
+    oprot->writeMessageEnd();
+    oprot->getTransport()->writeEnd();
+    oprot->getTransport()->flush();
+    return;
+  }
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->preWrite(ctx, "InfinityService.ShowIndex");
+  }
+
+  oprot->writeMessageBegin("ShowIndex", ::apache::thrift::protocol::T_REPLY, seqid);
+  result.write(oprot);
+  oprot->writeMessageEnd();
+  bytes = oprot->getTransport()->writeEnd();
+  oprot->getTransport()->flush();
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->postWrite(ctx, "InfinityService.ShowIndex", bytes);
+  }
+}
+
+::std::shared_ptr< ::apache::thrift::TProcessor > InfinityServiceProcessorFactory::getProcessor(const ::apache::thrift::TConnectionInfo& connInfo) {
+  ::apache::thrift::ReleaseHandler< InfinityServiceIfFactory > cleanup(handlerFactory_);
+  ::std::shared_ptr< InfinityServiceIf > handler(handlerFactory_->getHandler(connInfo), cleanup);
+  ::std::shared_ptr< ::apache::thrift::TProcessor > processor(new InfinityServiceProcessor(handler));
+  return processor;
+}
+
+void InfinityServiceConcurrentClient::Connect(CommonResponse& _return)
+{
+  int32_t seqid = send_Connect();
+  recv_Connect(_return, seqid);
+}
+
+int32_t InfinityServiceConcurrentClient::send_Connect()
+{
+  int32_t cseqid = this->sync_->generateSeqId();
+  ::apache::thrift::async::TConcurrentSendSentry sentry(this->sync_.get());
+  oprot_->writeMessageBegin("Connect", ::apache::thrift::protocol::T_CALL, cseqid);
+
+  InfinityService_Connect_pargs args;
+  args.write(oprot_);
+
+  oprot_->writeMessageEnd();
+  oprot_->getTransport()->writeEnd();
+  oprot_->getTransport()->flush();
+
+  sentry.commit();
+  return cseqid;
+}
+
+void InfinityServiceConcurrentClient::recv_Connect(CommonResponse& _return, const int32_t seqid)
+{
+
+  int32_t rseqid = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TMessageType mtype;
+
+  // the read mutex gets dropped and reacquired as part of waitForWork()
+  // The destructor of this sentry wakes up other clients
+  ::apache::thrift::async::TConcurrentRecvSentry sentry(this->sync_.get(), seqid);
+
+  while(true) {
+    if(!this->sync_->getPending(fname, mtype, rseqid)) {
+      iprot_->readMessageBegin(fname, mtype, rseqid);
+    }
+    if(seqid == rseqid) {
+      if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
+        ::apache::thrift::TApplicationException x;
+        x.read(iprot_);
+        iprot_->readMessageEnd();
+        iprot_->getTransport()->readEnd();
+        sentry.commit();
+        throw x;
+      }
+      if (mtype != ::apache::thrift::protocol::T_REPLY) {
+        iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+        iprot_->readMessageEnd();
+        iprot_->getTransport()->readEnd();
+      }
+      if (fname.compare("Connect") != 0) {
+        iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+        iprot_->readMessageEnd();
+        iprot_->getTransport()->readEnd();
+
+        // in a bad state, don't commit
+        using ::apache::thrift::protocol::TProtocolException;
+        throw TProtocolException(TProtocolException::INVALID_DATA);
+      }
+      InfinityService_Connect_presult result;
+      result.success = &_return;
+      result.read(iprot_);
+      iprot_->readMessageEnd();
+      iprot_->getTransport()->readEnd();
+
+      if (result.__isset.success) {
+        // _return pointer has now been filled
+        sentry.commit();
+        return;
+      }
+      // in a bad state, don't commit
+      throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "Connect failed: unknown result");
+    }
+    // seqid != rseqid
+    this->sync_->updatePending(fname, mtype, rseqid);
+
+    // this will temporarily unlock the readMutex, and let other clients get work done
+    this->sync_->waitForWork(seqid);
+  } // end while(true)
+}
+
+void InfinityServiceConcurrentClient::Disconnect(CommonResponse& _return, const CommonRequest& request)
+{
+  int32_t seqid = send_Disconnect(request);
+  recv_Disconnect(_return, seqid);
+}
+
+int32_t InfinityServiceConcurrentClient::send_Disconnect(const CommonRequest& request)
+{
+  int32_t cseqid = this->sync_->generateSeqId();
+  ::apache::thrift::async::TConcurrentSendSentry sentry(this->sync_.get());
+  oprot_->writeMessageBegin("Disconnect", ::apache::thrift::protocol::T_CALL, cseqid);
+
+  InfinityService_Disconnect_pargs args;
+  args.request = &request;
+  args.write(oprot_);
+
+  oprot_->writeMessageEnd();
+  oprot_->getTransport()->writeEnd();
+  oprot_->getTransport()->flush();
+
+  sentry.commit();
+  return cseqid;
+}
+
+void InfinityServiceConcurrentClient::recv_Disconnect(CommonResponse& _return, const int32_t seqid)
+{
+
+  int32_t rseqid = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TMessageType mtype;
+
+  // the read mutex gets dropped and reacquired as part of waitForWork()
+  // The destructor of this sentry wakes up other clients
+  ::apache::thrift::async::TConcurrentRecvSentry sentry(this->sync_.get(), seqid);
+
+  while(true) {
+    if(!this->sync_->getPending(fname, mtype, rseqid)) {
+      iprot_->readMessageBegin(fname, mtype, rseqid);
+    }
+    if(seqid == rseqid) {
+      if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
+        ::apache::thrift::TApplicationException x;
+        x.read(iprot_);
+        iprot_->readMessageEnd();
+        iprot_->getTransport()->readEnd();
+        sentry.commit();
+        throw x;
+      }
+      if (mtype != ::apache::thrift::protocol::T_REPLY) {
+        iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+        iprot_->readMessageEnd();
+        iprot_->getTransport()->readEnd();
+      }
+      if (fname.compare("Disconnect") != 0) {
+        iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+        iprot_->readMessageEnd();
+        iprot_->getTransport()->readEnd();
+
+        // in a bad state, don't commit
+        using ::apache::thrift::protocol::TProtocolException;
+        throw TProtocolException(TProtocolException::INVALID_DATA);
+      }
+      InfinityService_Disconnect_presult result;
+      result.success = &_return;
+      result.read(iprot_);
+      iprot_->readMessageEnd();
+      iprot_->getTransport()->readEnd();
+
+      if (result.__isset.success) {
+        // _return pointer has now been filled
+        sentry.commit();
+        return;
+      }
+      // in a bad state, don't commit
+      throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "Disconnect failed: unknown result");
+    }
+    // seqid != rseqid
+    this->sync_->updatePending(fname, mtype, rseqid);
+
+    // this will temporarily unlock the readMutex, and let other clients get work done
+    this->sync_->waitForWork(seqid);
+  } // end while(true)
+}
+
+void InfinityServiceConcurrentClient::CreateDatabase(CommonResponse& _return, const CreateDatabaseRequest& request)
+{
+  int32_t seqid = send_CreateDatabase(request);
+  recv_CreateDatabase(_return, seqid);
+}
+
+int32_t InfinityServiceConcurrentClient::send_CreateDatabase(const CreateDatabaseRequest& request)
+{
+  int32_t cseqid = this->sync_->generateSeqId();
+  ::apache::thrift::async::TConcurrentSendSentry sentry(this->sync_.get());
+  oprot_->writeMessageBegin("CreateDatabase", ::apache::thrift::protocol::T_CALL, cseqid);
+
+  InfinityService_CreateDatabase_pargs args;
+  args.request = &request;
+  args.write(oprot_);
+
+  oprot_->writeMessageEnd();
+  oprot_->getTransport()->writeEnd();
+  oprot_->getTransport()->flush();
+
+  sentry.commit();
+  return cseqid;
+}
+
+void InfinityServiceConcurrentClient::recv_CreateDatabase(CommonResponse& _return, const int32_t seqid)
+{
+
+  int32_t rseqid = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TMessageType mtype;
+
+  // the read mutex gets dropped and reacquired as part of waitForWork()
+  // The destructor of this sentry wakes up other clients
+  ::apache::thrift::async::TConcurrentRecvSentry sentry(this->sync_.get(), seqid);
+
+  while(true) {
+    if(!this->sync_->getPending(fname, mtype, rseqid)) {
+      iprot_->readMessageBegin(fname, mtype, rseqid);
+    }
+    if(seqid == rseqid) {
+      if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
+        ::apache::thrift::TApplicationException x;
+        x.read(iprot_);
+        iprot_->readMessageEnd();
+        iprot_->getTransport()->readEnd();
+        sentry.commit();
+        throw x;
+      }
+      if (mtype != ::apache::thrift::protocol::T_REPLY) {
+        iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+        iprot_->readMessageEnd();
+        iprot_->getTransport()->readEnd();
+      }
+      if (fname.compare("CreateDatabase") != 0) {
+        iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+        iprot_->readMessageEnd();
+        iprot_->getTransport()->readEnd();
+
+        // in a bad state, don't commit
+        using ::apache::thrift::protocol::TProtocolException;
+        throw TProtocolException(TProtocolException::INVALID_DATA);
+      }
+      InfinityService_CreateDatabase_presult result;
+      result.success = &_return;
+      result.read(iprot_);
+      iprot_->readMessageEnd();
+      iprot_->getTransport()->readEnd();
+
+      if (result.__isset.success) {
+        // _return pointer has now been filled
+        sentry.commit();
+        return;
+      }
+      // in a bad state, don't commit
+      throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "CreateDatabase failed: unknown result");
+    }
+    // seqid != rseqid
+    this->sync_->updatePending(fname, mtype, rseqid);
+
+    // this will temporarily unlock the readMutex, and let other clients get work done
+    this->sync_->waitForWork(seqid);
+  } // end while(true)
+}
+
+void InfinityServiceConcurrentClient::DropDatabase(CommonResponse& _return, const DropDatabaseRequest& request)
+{
+  int32_t seqid = send_DropDatabase(request);
+  recv_DropDatabase(_return, seqid);
+}
+
+int32_t InfinityServiceConcurrentClient::send_DropDatabase(const DropDatabaseRequest& request)
+{
+  int32_t cseqid = this->sync_->generateSeqId();
+  ::apache::thrift::async::TConcurrentSendSentry sentry(this->sync_.get());
+  oprot_->writeMessageBegin("DropDatabase", ::apache::thrift::protocol::T_CALL, cseqid);
+
+  InfinityService_DropDatabase_pargs args;
+  args.request = &request;
+  args.write(oprot_);
+
+  oprot_->writeMessageEnd();
+  oprot_->getTransport()->writeEnd();
+  oprot_->getTransport()->flush();
+
+  sentry.commit();
+  return cseqid;
+}
+
+void InfinityServiceConcurrentClient::recv_DropDatabase(CommonResponse& _return, const int32_t seqid)
+{
+
+  int32_t rseqid = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TMessageType mtype;
+
+  // the read mutex gets dropped and reacquired as part of waitForWork()
+  // The destructor of this sentry wakes up other clients
+  ::apache::thrift::async::TConcurrentRecvSentry sentry(this->sync_.get(), seqid);
+
+  while(true) {
+    if(!this->sync_->getPending(fname, mtype, rseqid)) {
+      iprot_->readMessageBegin(fname, mtype, rseqid);
+    }
+    if(seqid == rseqid) {
+      if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
+        ::apache::thrift::TApplicationException x;
+        x.read(iprot_);
+        iprot_->readMessageEnd();
+        iprot_->getTransport()->readEnd();
+        sentry.commit();
+        throw x;
+      }
+      if (mtype != ::apache::thrift::protocol::T_REPLY) {
+        iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+        iprot_->readMessageEnd();
+        iprot_->getTransport()->readEnd();
+      }
+      if (fname.compare("DropDatabase") != 0) {
+        iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+        iprot_->readMessageEnd();
+        iprot_->getTransport()->readEnd();
 
-  oprot->writeMessageBegin("ShowIndex", ::apache::thrift::protocol::T_REPLY, seqid);
-  result.write(oprot);
-  oprot->writeMessageEnd();
-  bytes = oprot->getTransport()->writeEnd();
-  oprot->getTransport()->flush();
+        // in a bad state, don't commit
+        using ::apache::thrift::protocol::TProtocolException;
+        throw TProtocolException(TProtocolException::INVALID_DATA);
+      }
+      InfinityService_DropDatabase_presult result;
+      result.success = &_return;
+      result.read(iprot_);
+      iprot_->readMessageEnd();
+      iprot_->getTransport()->readEnd();
 
-  if (this->eventHandler_.get() != nullptr) {
-    this->eventHandler_->postWrite(ctx, "InfinityService.ShowIndex", bytes);
-  }
-}
+      if (result.__isset.success) {
+        // _return pointer has now been filled
+        sentry.commit();
+        return;
+      }
+      // in a bad state, don't commit
+      throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "DropDatabase failed: unknown result");
+    }
+    // seqid != rseqid
+    this->sync_->updatePending(fname, mtype, rseqid);
 
-::std::shared_ptr< ::apache::thrift::TProcessor > InfinityServiceProcessorFactory::getProcessor(const ::apache::thrift::TConnectionInfo& connInfo) {
-  ::apache::thrift::ReleaseHandler< InfinityServiceIfFactory > cleanup(handlerFactory_);
-  ::std::shared_ptr< InfinityServiceIf > handler(handlerFactory_->getHandler(connInfo), cleanup);
-  ::std::shared_ptr< ::apache::thrift::TProcessor > processor(new InfinityServiceProcessor(handler));
-  return processor;
+    // this will temporarily unlock the readMutex, and let other clients get work done
+    this->sync_->waitForWork(seqid);
+  } // end while(true)
 }
 
-void InfinityServiceConcurrentClient::Connect(CommonResponse& _return)
+void InfinityServiceConcurrentClient::CreateTable(CommonResponse& _return, const CreateTableRequest& request)
 {
-  int32_t seqid = send_Connect();
-  recv_Connect(_return, seqid);
+  int32_t seqid = send_CreateTable(request);
+  recv_CreateTable(_return, seqid);
 }
 
-int32_t InfinityServiceConcurrentClient::send_Connect()
+int32_t InfinityServiceConcurrentClient::send_CreateTable(const CreateTableRequest& request)
 {
   int32_t cseqid = this->sync_->generateSeqId();
   ::apache::thrift::async::TConcurrentSendSentry sentry(this->sync_.get());
-  oprot_->writeMessageBegin("Connect", ::apache::thrift::protocol::T_CALL, cseqid);
+  oprot_->writeMessageBegin("CreateTable", ::apache::thrift::protocol::T_CALL, cseqid);
 
-  InfinityService_Connect_pargs args;
+  InfinityService_CreateTable_pargs args;
+  args.request = &request;
   args.write(oprot_);
 
   oprot_->writeMessageEnd();
@@ -7809,7 +9640,7 @@ int32_t InfinityServiceConcurrentClient::send_Connect()
   return cseqid;
 }
 
-void InfinityServiceConcurrentClient::recv_Connect(CommonResponse& _return, const int32_t seqid)
+void InfinityServiceConcurrentClient::recv_CreateTable(CommonResponse& _return, const int32_t seqid)
 {
 
   int32_t rseqid = 0;
@@ -7838,7 +9669,7 @@ void InfinityServiceConcurrentClient::recv_Connect(CommonResponse& _return, cons
         iprot_->readMessageEnd();
         iprot_->getTransport()->readEnd();
       }
-      if (fname.compare("Connect") != 0) {
+      if (fname.compare("CreateTable") != 0) {
         iprot_->skip(::apache::thrift::protocol::T_STRUCT);
         iprot_->readMessageEnd();
         iprot_->getTransport()->readEnd();
@@ -7847,7 +9678,7 @@ void InfinityServiceConcurrentClient::recv_Connect(CommonResponse& _return, cons
         using ::apache::thrift::protocol::TProtocolException;
         throw TProtocolException(TProtocolException::INVALID_DATA);
       }
-      InfinityService_Connect_presult result;
+      InfinityService_CreateTable_presult result;
       result.success = &_return;
       result.read(iprot_);
       iprot_->readMessageEnd();
@@ -7859,7 +9690,7 @@ void InfinityServiceConcurrentClient::recv_Connect(CommonResponse& _return, cons
         return;
       }
       // in a bad state, don't commit
-      throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "Connect failed: unknown result");
+      throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "CreateTable failed: unknown result");
     }
     // seqid != rseqid
     this->sync_->updatePending(fname, mtype, rseqid);
@@ -7869,19 +9700,19 @@ void InfinityServiceConcurrentClient::recv_Connect(CommonResponse& _return, cons
   } // end while(true)
 }
 
-void InfinityServiceConcurrentClient::Disconnect(CommonResponse& _return, const CommonRequest& request)
+void InfinityServiceConcurrentClient::DropTable(CommonResponse& _return, const DropTableRequest& request)
 {
-  int32_t seqid = send_Disconnect(request);
-  recv_Disconnect(_return, seqid);
+  int32_t seqid = send_DropTable(request);
+  recv_DropTable(_return, seqid);
 }
 
-int32_t InfinityServiceConcurrentClient::send_Disconnect(const CommonRequest& request)
+int32_t InfinityServiceConcurrentClient::send_DropTable(const DropTableRequest& request)
 {
   int32_t cseqid = this->sync_->generateSeqId();
   ::apache::thrift::async::TConcurrentSendSentry sentry(this->sync_.get());
-  oprot_->writeMessageBegin("Disconnect", ::apache::thrift::protocol::T_CALL, cseqid);
+  oprot_->writeMessageBegin("DropTable", ::apache::thrift::protocol::T_CALL, cseqid);
 
-  InfinityService_Disconnect_pargs args;
+  InfinityService_DropTable_pargs args;
   args.request = &request;
   args.write(oprot_);
 
@@ -7893,7 +9724,7 @@ int32_t InfinityServiceConcurrentClient::send_Disconnect(const CommonRequest& re
   return cseqid;
 }
 
-void InfinityServiceConcurrentClient::recv_Disconnect(CommonResponse& _return, const int32_t seqid)
+void InfinityServiceConcurrentClient::recv_DropTable(CommonResponse& _return, const int32_t seqid)
 {
 
   int32_t rseqid = 0;
@@ -7922,7 +9753,7 @@ void InfinityServiceConcurrentClient::recv_Disconnect(CommonResponse& _return, c
         iprot_->readMessageEnd();
         iprot_->getTransport()->readEnd();
       }
-      if (fname.compare("Disconnect") != 0) {
+      if (fname.compare("DropTable") != 0) {
         iprot_->skip(::apache::thrift::protocol::T_STRUCT);
         iprot_->readMessageEnd();
         iprot_->getTransport()->readEnd();
@@ -7931,7 +9762,7 @@ void InfinityServiceConcurrentClient::recv_Disconnect(CommonResponse& _return, c
         using ::apache::thrift::protocol::TProtocolException;
         throw TProtocolException(TProtocolException::INVALID_DATA);
       }
-      InfinityService_Disconnect_presult result;
+      InfinityService_DropTable_presult result;
       result.success = &_return;
       result.read(iprot_);
       iprot_->readMessageEnd();
@@ -7943,7 +9774,7 @@ void InfinityServiceConcurrentClient::recv_Disconnect(CommonResponse& _return, c
         return;
       }
       // in a bad state, don't commit
-      throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "Disconnect failed: unknown result");
+      throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "DropTable failed: unknown result");
     }
     // seqid != rseqid
     this->sync_->updatePending(fname, mtype, rseqid);
@@ -7953,19 +9784,19 @@ void InfinityServiceConcurrentClient::recv_Disconnect(CommonResponse& _return, c
   } // end while(true)
 }
 
-void InfinityServiceConcurrentClient::CreateDatabase(CommonResponse& _return, const CreateDatabaseRequest& request)
+void InfinityServiceConcurrentClient::Insert(CommonResponse& _return, const InsertRequest& request)
 {
-  int32_t seqid = send_CreateDatabase(request);
-  recv_CreateDatabase(_return, seqid);
+  int32_t seqid = send_Insert(request);
+  recv_Insert(_return, seqid);
 }
 
-int32_t InfinityServiceConcurrentClient::send_CreateDatabase(const CreateDatabaseRequest& request)
+int32_t InfinityServiceConcurrentClient::send_Insert(const InsertRequest& request)
 {
   int32_t cseqid = this->sync_->generateSeqId();
   ::apache::thrift::async::TConcurrentSendSentry sentry(this->sync_.get());
-  oprot_->writeMessageBegin("CreateDatabase", ::apache::thrift::protocol::T_CALL, cseqid);
+  oprot_->writeMessageBegin("Insert", ::apache::thrift::protocol::T_CALL, cseqid);
 
-  InfinityService_CreateDatabase_pargs args;
+  InfinityService_Insert_pargs args;
   args.request = &request;
   args.write(oprot_);
 
@@ -7977,7 +9808,7 @@ int32_t InfinityServiceConcurrentClient::send_CreateDatabase(const CreateDatabas
   return cseqid;
 }
 
-void InfinityServiceConcurrentClient::recv_CreateDatabase(CommonResponse& _return, const int32_t seqid)
+void InfinityServiceConcurrentClient::recv_Insert(CommonResponse& _return, const int32_t seqid)
 {
 
   int32_t rseqid = 0;
@@ -8006,7 +9837,7 @@ void InfinityServiceConcurrentClient::recv_CreateDatabase(CommonResponse& _retur
         iprot_->readMessageEnd();
         iprot_->getTransport()->readEnd();
       }
-      if (fname.compare("CreateDatabase") != 0) {
+      if (fname.compare("Insert") != 0) {
         iprot_->skip(::apache::thrift::protocol::T_STRUCT);
         iprot_->readMessageEnd();
         iprot_->getTransport()->readEnd();
@@ -8015,7 +9846,7 @@ void InfinityServiceConcurrentClient::recv_CreateDatabase(CommonResponse& _retur
         using ::apache::thrift::protocol::TProtocolException;
         throw TProtocolException(TProtocolException::INVALID_DATA);
       }
-      InfinityService_CreateDatabase_presult result;
+      InfinityService_Insert_presult result;
       result.success = &_return;
       result.read(iprot_);
       iprot_->readMessageEnd();
@@ -8027,7 +9858,7 @@ void InfinityServiceConcurrentClient::recv_CreateDatabase(CommonResponse& _retur
         return;
       }
       // in a bad state, don't commit
-      throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "CreateDatabase failed: unknown result");
+      throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "Insert failed: unknown result");
     }
     // seqid != rseqid
     this->sync_->updatePending(fname, mtype, rseqid);
@@ -8037,19 +9868,19 @@ void InfinityServiceConcurrentClient::recv_CreateDatabase(CommonResponse& _retur
   } // end while(true)
 }
 
-void InfinityServiceConcurrentClient::DropDatabase(CommonResponse& _return, const DropDatabaseRequest& request)
+void InfinityServiceConcurrentClient::Import(CommonResponse& _return, const ImportRequest& request)
 {
-  int32_t seqid = send_DropDatabase(request);
-  recv_DropDatabase(_return, seqid);
+  int32_t seqid = send_Import(request);
+  recv_Import(_return, seqid);
 }
 
-int32_t InfinityServiceConcurrentClient::send_DropDatabase(const DropDatabaseRequest& request)
+int32_t InfinityServiceConcurrentClient::send_Import(const ImportRequest& request)
 {
   int32_t cseqid = this->sync_->generateSeqId();
   ::apache::thrift::async::TConcurrentSendSentry sentry(this->sync_.get());
-  oprot_->writeMessageBegin("DropDatabase", ::apache::thrift::protocol::T_CALL, cseqid);
+  oprot_->writeMessageBegin("Import", ::apache::thrift::protocol::T_CALL, cseqid);
 
-  InfinityService_DropDatabase_pargs args;
+  InfinityService_Import_pargs args;
   args.request = &request;
   args.write(oprot_);
 
@@ -8061,7 +9892,7 @@ int32_t InfinityServiceConcurrentClient::send_DropDatabase(const DropDatabaseReq
   return cseqid;
 }
 
-void InfinityServiceConcurrentClient::recv_DropDatabase(CommonResponse& _return, const int32_t seqid)
+void InfinityServiceConcurrentClient::recv_Import(CommonResponse& _return, const int32_t seqid)
 {
 
   int32_t rseqid = 0;
@@ -8090,7 +9921,7 @@ void InfinityServiceConcurrentClient::recv_DropDatabase(CommonResponse& _return,
         iprot_->readMessageEnd();
         iprot_->getTransport()->readEnd();
       }
-      if (fname.compare("DropDatabase") != 0) {
+      if (fname.compare("Import") != 0) {
         iprot_->skip(::apache::thrift::protocol::T_STRUCT);
         iprot_->readMessageEnd();
         iprot_->getTransport()->readEnd();
@@ -8099,7 +9930,7 @@ void InfinityServiceConcurrentClient::recv_DropDatabase(CommonResponse& _return,
         using ::apache::thrift::protocol::TProtocolException;
         throw TProtocolException(TProtocolException::INVALID_DATA);
       }
-      InfinityService_DropDatabase_presult result;
+      InfinityService_Import_presult result;
       result.success = &_return;
       result.read(iprot_);
       iprot_->readMessageEnd();
@@ -8111,7 +9942,7 @@ void InfinityServiceConcurrentClient::recv_DropDatabase(CommonResponse& _return,
         return;
       }
       // in a bad state, don't commit
-      throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "DropDatabase failed: unknown result");
+      throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "Import failed: unknown result");
     }
     // seqid != rseqid
     this->sync_->updatePending(fname, mtype, rseqid);
@@ -8121,19 +9952,19 @@ void InfinityServiceConcurrentClient::recv_DropDatabase(CommonResponse& _return,
   } // end while(true)
 }
 
-void InfinityServiceConcurrentClient::CreateTable(CommonResponse& _return, const CreateTableRequest& request)
+void InfinityServiceConcurrentClient::InsertColumnar(CommonResponse& _return, const InsertColumnarRequest& request)
 {
-  int32_t seqid = send_CreateTable(request);
-  recv_CreateTable(_return, seqid);
+  int32_t seqid = send_InsertColumnar(request);
+  recv_InsertColumnar(_return, seqid);
 }
 
-int32_t InfinityServiceConcurrentClient::send_CreateTable(const CreateTableRequest& request)
+int32_t InfinityServiceConcurrentClient::send_InsertColumnar(const InsertColumnarRequest& request)
 {
   int32_t cseqid = this->sync_->generateSeqId();
   ::apache::thrift::async::TConcurrentSendSentry sentry(this->sync_.get());
-  oprot_->writeMessageBegin("CreateTable", ::apache::thrift::protocol::T_CALL, cseqid);
+  oprot_->writeMessageBegin("InsertColumnar", ::apache::thrift::protocol::T_CALL, cseqid);
 
-  InfinityService_CreateTable_pargs args;
+  InfinityService_InsertColumnar_pargs args;
   args.request = &request;
   args.write(oprot_);
 
@@ -8145,7 +9976,7 @@ int32_t InfinityServiceConcurrentClient::send_CreateTable(const CreateTableReque
   return cseqid;
 }
 
-void InfinityServiceConcurrentClient::recv_CreateTable(CommonResponse& _return, const int32_t seqid)
+void InfinityServiceConcurrentClient::recv_InsertColumnar(CommonResponse& _return, const int32_t seqid)
 {
 
   int32_t rseqid = 0;
@@ -8174,7 +10005,7 @@ void InfinityServiceConcurrentClient::recv_CreateTable(CommonResponse& _return,
         iprot_->readMessageEnd();
         iprot_->getTransport()->readEnd();
       }
-      if (fname.compare("CreateTable") != 0) {
+      if (fname.compare("InsertColumnar") != 0) {
         iprot_->skip(::apache::thrift::protocol::T_STRUCT);
         iprot_->readMessageEnd();
         iprot_->getTransport()->readEnd();
@@ -8183,7 +10014,7 @@ void InfinityServiceConcurrentClient::recv_CreateTable(CommonResponse& _return,
         using ::apache::thrift::protocol::TProtocolException;
         throw TProtocolException(TProtocolException::INVALID_DATA);
       }
-      InfinityService_CreateTable_presult result;
+      InfinityService_InsertColumnar_presult result;
       result.success = &_return;
       result.read(iprot_);
       iprot_->readMessageEnd();
@@ -8195,7 +10026,7 @@ void InfinityServiceConcurrentClient::recv_CreateTable(CommonResponse& _return,
         return;
       }
       // in a bad state, don't commit
-      throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "CreateTable failed: unknown result");
+      throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "InsertColumnar failed: unknown result");
     }
     // seqid != rseqid
     this->sync_->updatePending(fname, mtype, rseqid);
@@ -8205,19 +10036,19 @@ void InfinityServiceConcurrentClient::recv_CreateTable(CommonResponse& _return,
   } // end while(true)
 }
 
-void InfinityServiceConcurrentClient::DropTable(CommonResponse& _return, const DropTableRequest& request)
+void InfinityServiceConcurrentClient::Select(SelectResponse& _return, const SelectRequest& request)
 {
-  int32_t seqid = send_DropTable(request);
-  recv_DropTable(_return, seqid);
+  int32_t seqid = send_Select(request);
+  recv_Select(_return, seqid);
 }
 
-int32_t InfinityServiceConcurrentClient::send_DropTable(const DropTableRequest& request)
+int32_t InfinityServiceConcurrentClient::send_Select(const SelectRequest& request)
 {
   int32_t cseqid = this->sync_->generateSeqId();
   ::apache::thrift::async::TConcurrentSendSentry sentry(this->sync_.get());
-  oprot_->writeMessageBegin("DropTable", ::apache::thrift::protocol::T_CALL, cseqid);
+  oprot_->writeMessageBegin("Select", ::apache::thrift::protocol::T_CALL, cseqid);
 
-  InfinityService_DropTable_pargs args;
+  InfinityService_Select_pargs args;
   args.request = &request;
   args.write(oprot_);
 
@@ -8229,7 +10060,7 @@ int32_t InfinityServiceConcurrentClient::send_DropTable(const DropTableRequest&
   return cseqid;
 }
 
-void InfinityServiceConcurrentClient::recv_DropTable(CommonResponse& _return, const int32_t seqid)
+void InfinityServiceConcurrentClient::recv_Select(SelectResponse& _return, const int32_t seqid)
 {
 
   int32_t rseqid = 0;
@@ -8258,7 +10089,7 @@ void InfinityServiceConcurrentClient::recv_DropTable(CommonResponse& _return, co
         iprot_->readMessageEnd();
         iprot_->getTransport()->readEnd();
       }
-      if (fname.compare("DropTable") != 0) {
+      if (fname.compare("Select") != 0) {
         iprot_->skip(::apache::thrift::protocol::T_STRUCT);
         iprot_->readMessageEnd();
         iprot_->getTransport()->readEnd();
@@ -8267,7 +10098,7 @@ void InfinityServiceConcurrentClient::recv_DropTable(CommonResponse& _return, co
         using ::apache::thrift::protocol::TProtocolException;
         throw TProtocolException(TProtocolException::INVALID_DATA);
       }
-      InfinityService_DropTable_presult result;
+      InfinityService_Select_presult result;
       result.success = &_return;
       result.read(iprot_);
       iprot_->readMessageEnd();
@@ -8279,7 +10110,7 @@ void InfinityServiceConcurrentClient::recv_DropTable(CommonResponse& _return, co
         return;
       }
       // in a bad state, don't commit
-      throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "DropTable failed: unknown result");
+      throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "Select failed: unknown result");
     }
     // seqid != rseqid
     this->sync_->updatePending(fname, mtype, rseqid);
@@ -8289,19 +10120,19 @@ void InfinityServiceConcurrentClient::recv_DropTable(CommonResponse& _return, co
   } // end while(true)
 }
 
-void InfinityServiceConcurrentClient::Insert(CommonResponse& _return, const InsertRequest& request)
+void InfinityServiceConcurrentClient::BatchSelect(BatchSelectResponse& _return, const BatchSelectRequest& request)
 {
-  int32_t seqid = send_Insert(request);
-  recv_Insert(_return, seqid);
+  int32_t seqid = send_BatchSelect(request);
+  recv_BatchSelect(_return, seqid);
 }
 
-int32_t InfinityServiceConcurrentClient::send_Insert(const InsertRequest& request)
+int32_t InfinityServiceConcurrentClient::send_BatchSelect(const BatchSelectRequest& request)
 {
   int32_t cseqid = this->sync_->generateSeqId();
   ::apache::thrift::async::TConcurrentSendSentry sentry(this->sync_.get());
-  oprot_->writeMessageBegin("Insert", ::apache::thrift::protocol::T_CALL, cseqid);
+  oprot_->writeMessageBegin("BatchSelect", ::apache::thrift::protocol::T_CALL, cseqid);
 
-  InfinityService_Insert_pargs args;
+  InfinityService_BatchSelect_pargs args;
   args.request = &request;
   args.write(oprot_);
 
@@ -8313,7 +10144,7 @@ int32_t InfinityServiceConcurrentClient::send_Insert(const InsertRequest& reques
   return cseqid;
 }
 
-void InfinityServiceConcurrentClient::recv_Insert(CommonResponse& _return, const int32_t seqid)
+void InfinityServiceConcurrentClient::recv_BatchSelect(BatchSelectResponse& _return, const int32_t seqid)
 {
 
   int32_t rseqid = 0;
@@ -8342,7 +10173,7 @@ void InfinityServiceConcurrentClient::recv_Insert(CommonResponse& _return, const
         iprot_->readMessageEnd();
         iprot_->getTransport()->readEnd();
       }
-      if (fname.compare("Insert") != 0) {
+      if (fname.compare("BatchSelect") != 0) {
         iprot_->skip(::apache::thrift::protocol::T_STRUCT);
         iprot_->readMessageEnd();
         iprot_->getTransport()->readEnd();
@@ -8351,7 +10182,7 @@ void InfinityServiceConcurrentClient::recv_Insert(CommonResponse& _return, const
         using ::apache::thrift::protocol::TProtocolException;
         throw TProtocolException(TProtocolException::INVALID_DATA);
       }
-      InfinityService_Insert_presult result;
+      InfinityService_BatchSelect_presult result;
       result.success = &_return;
       result.read(iprot_);
       iprot_->readMessageEnd();
@@ -8363,7 +10194,7 @@ void InfinityServiceConcurrentClient::recv_Insert(CommonResponse& _return, const
         return;
       }
       // in a bad state, don't commit
-      throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "Insert failed: unknown result");
+      throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "BatchSelect failed: unknown result");
     }
     // seqid != rseqid
     this->sync_->updatePending(fname, mtype, rseqid);
@@ -8373,19 +10204,19 @@ void InfinityServiceConcurrentClient::recv_Insert(CommonResponse& _return, const
   } // end while(true)
 }
 
-void InfinityServiceConcurrentClient::Import(CommonResponse& _return, const ImportRequest& request)
+void InfinityServiceConcurrentClient::OpenCursor(SelectResponse& _return, const SelectRequest& request)
 {
-  int32_t seqid = send_Import(request);
-  recv_Import(_return, seqid);
+  int32_t seqid = send_OpenCursor(request);
+  recv_OpenCursor(_return, seqid);
 }
 
-int32_t InfinityServiceConcurrentClient::send_Import(const ImportRequest& request)
+int32_t InfinityServiceConcurrentClient::send_OpenCursor(const SelectRequest& request)
 {
   int32_t cseqid = this->sync_->generateSeqId();
   ::apache::thrift::async::TConcurrentSendSentry sentry(this->sync_.get());
-  oprot_->writeMessageBegin("Import", ::apache::thrift::protocol::T_CALL, cseqid);
+  oprot_->writeMessageBegin("OpenCursor", ::apache::thrift::protocol::T_CALL, cseqid);
 
-  InfinityService_Import_pargs args;
+  InfinityService_OpenCursor_pargs args;
   args.request = &request;
   args.write(oprot_);
 
@@ -8397,7 +10228,7 @@ int32_t InfinityServiceConcurrentClient::send_Import(const ImportRequest& reques
   return cseqid;
 }
 
-void InfinityServiceConcurrentClient::recv_Import(CommonResponse& _return, const int32_t seqid)
+void InfinityServiceConcurrentClient::recv_OpenCursor(SelectResponse& _return, const int32_t seqid)
 {
 
   int32_t rseqid = 0;
@@ -8426,7 +10257,7 @@ void InfinityServiceConcurrentClient::recv_Import(CommonResponse& _return, const
         iprot_->readMessageEnd();
         iprot_->getTransport()->readEnd();
       }
-      if (fname.compare("Import") != 0) {
+      if (fname.compare("OpenCursor") != 0) {
         iprot_->skip(::apache::thrift::protocol::T_STRUCT);
         iprot_->readMessageEnd();
         iprot_->getTransport()->readEnd();
@@ -8435,7 +10266,7 @@ void InfinityServiceConcurrentClient::recv_Import(CommonResponse& _return, const
         using ::apache::thrift::protocol::TProtocolException;
         throw TProtocolException(TProtocolException::INVALID_DATA);
       }
-      InfinityService_Import_presult result;
+      InfinityService_OpenCursor_presult result;
       result.success = &_return;
       result.read(iprot_);
       iprot_->readMessageEnd();
@@ -8447,7 +10278,7 @@ void InfinityServiceConcurrentClient::recv_Import(CommonResponse& _return, const
         return;
       }
       // in a bad state, don't commit
-      throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "Import failed: unknown result");
+      throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "OpenCursor failed: unknown result");
     }
     // seqid != rseqid
     this->sync_->updatePending(fname, mtype, rseqid);
@@ -8457,19 +10288,19 @@ void InfinityServiceConcurrentClient::recv_Import(CommonResponse& _return, const
   } // end while(true)
 }
 
-void InfinityServiceConcurrentClient::Select(SelectResponse& _return, const SelectRequest& request)
+void InfinityServiceConcurrentClient::FetchCursor(SelectResponse& _return, const CursorRequest& request)
 {
-  int32_t seqid = send_Select(request);
-  recv_Select(_return, seqid);
+  int32_t seqid = send_FetchCursor(request);
+  recv_FetchCursor(_return, seqid);
 }
 
-int32_t InfinityServiceConcurrentClient::send_Select(const SelectRequest& request)
+int32_t InfinityServiceConcurrentClient::send_FetchCursor(const CursorRequest& request)
 {
   int32_t cseqid = this->sync_->generateSeqId();
   ::apache::thrift::async::TConcurrentSendSentry sentry(this->sync_.get());
-  oprot_->writeMessageBegin("Select", ::apache::thrift::protocol::T_CALL, cseqid);
+  oprot_->writeMessageBegin("FetchCursor", ::apache::thrift::protocol::T_CALL, cseqid);
 
-  InfinityService_Select_pargs args;
+  InfinityService_FetchCursor_pargs args;
   args.request = &request;
   args.write(oprot_);
 
@@ -8481,7 +10312,7 @@ int32_t InfinityServiceConcurrentClient::send_Select(const SelectRequest& reques
   return cseqid;
 }
 
-void InfinityServiceConcurrentClient::recv_Select(SelectResponse& _return, const int32_t seqid)
+void InfinityServiceConcurrentClient::recv_FetchCursor(SelectResponse& _return, const int32_t seqid)
 {
 
   int32_t rseqid = 0;
@@ -8510,7 +10341,7 @@ void InfinityServiceConcurrentClient::recv_Select(SelectResponse& _return, const
         iprot_->readMessageEnd();
         iprot_->getTransport()->readEnd();
       }
-      if (fname.compare("Select") != 0) {
+      if (fname.compare("FetchCursor") != 0) {
         iprot_->skip(::apache::thrift::protocol::T_STRUCT);
         iprot_->readMessageEnd();
         iprot_->getTransport()->readEnd();
@@ -8519,7 +10350,7 @@ void InfinityServiceConcurrentClient::recv_Select(SelectResponse& _return, const
         using ::apache::thrift::protocol::TProtocolException;
         throw TProtocolException(TProtocolException::INVALID_DATA);
       }
-      InfinityService_Select_presult result;
+      InfinityService_FetchCursor_presult result;
       result.success = &_return;
       result.read(iprot_);
       iprot_->readMessageEnd();
@@ -8531,7 +10362,7 @@ void InfinityServiceConcurrentClient::recv_Select(SelectResponse& _return, const
         return;
       }
       // in a bad state, don't commit
-      throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "Select failed: unknown result");
+      throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "FetchCursor failed: unknown result");
     }
     // seqid != rseqid
     this->sync_->updatePending(fname, mtype, rseqid);
@@ -8709,6 +10540,90 @@ void InfinityServiceConcurrentClient::recv_Delete(CommonResponse& _return, const
   } // end while(true)
 }
 
+void InfinityServiceConcurrentClient::CloseCursor(CommonResponse& _return, const CursorRequest& request)
+{
+  int32_t seqid = send_CloseCursor(request);
+  recv_CloseCursor(_return, seqid);
+}
+
+int32_t InfinityServiceConcurrentClient::send_CloseCursor(const CursorRequest& request)
+{
+  int32_t cseqid = this->sync_->generateSeqId();
+  ::apache::thrift::async::TConcurrentSendSentry sentry(this->sync_.get());
+  oprot_->writeMessageBegin("CloseCursor", ::apache::thrift::protocol::T_CALL, cseqid);
+
+  InfinityService_CloseCursor_pargs args;
+  args.request = &request;
+  args.write(oprot_);
+
+  oprot_->writeMessageEnd();
+  oprot_->getTransport()->writeEnd();
+  oprot_->getTransport()->flush();
+
+  sentry.commit();
+  return cseqid;
+}
+
+void InfinityServiceConcurrentClient::recv_CloseCursor(CommonResponse& _return, const int32_t seqid)
+{
+
+  int32_t rseqid = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TMessageType mtype;
+
+  // the read mutex gets dropped and reacquired as part of waitForWork()
+  // The destructor of this sentry wakes up other clients
+  ::apache::thrift::async::TConcurrentRecvSentry sentry(this->sync_.get(), seqid);
+
+  while(true) {
+    if(!this->sync_->getPending(fname, mtype, rseqid)) {
+      iprot_->readMessageBegin(fname, mtype, rseqid);
+    }
+    if(seqid == rseqid) {
+      if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
+        ::apache::thrift::TApplicationException x;
+        x.read(iprot_);
+        iprot_->readMessageEnd();
+        iprot_->getTransport()->readEnd();
+        sentry.commit();
+        throw x;
+      }
+      if (mtype != ::apache::thrift::protocol::T_REPLY) {
+        iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+        iprot_->readMessageEnd();
+        iprot_->getTransport()->readEnd();
+      }
+      if (fname.compare("CloseCursor") != 0) {
+        iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+        iprot_->readMessageEnd();
+        iprot_->getTransport()->readEnd();
+
+        // in a bad state, don't commit
+        using ::apache::thrift::protocol::TProtocolException;
+        throw TProtocolException(TProtocolException::INVALID_DATA);
+      }
+      InfinityService_CloseCursor_presult result;
+      result.success = &_return;
+      result.read(iprot_);
+      iprot_->readMessageEnd();
+      iprot_->getTransport()->readEnd();
+
+      if (result.__isset.success) {
+        // _return pointer has now been filled
+        sentry.commit();
+        return;
+      }
+      // in a bad state, don't commit
+      throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "CloseCursor failed: unknown result");
+    }
+    // seqid != rseqid
+    this->sync_->updatePending(fname, mtype, rseqid);
+
+    // this will temporarily unlock the readMutex, and let other clients get work done
+    this->sync_->waitForWork(seqid);
+  } // end while(true)
+}
+
 void InfinityServiceConcurrentClient::Update(CommonResponse& _return, const UpdateRequest& request)
 {
   int32_t seqid = send_Update(request);
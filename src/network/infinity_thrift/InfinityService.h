@@ -30,9 +30,14 @@ class InfinityServiceIf {
   virtual void DropTable(CommonResponse& _return, const DropTableRequest& request) = 0;
   virtual void Insert(CommonResponse& _return, const InsertRequest& request) = 0;
   virtual void Import(CommonResponse& _return, const ImportRequest& request) = 0;
+  virtual void InsertColumnar(CommonResponse& _return, const InsertColumnarRequest& request) = 0;
   virtual void Select(SelectResponse& _return, const SelectRequest& request) = 0;
+  virtual void BatchSelect(BatchSelectResponse& _return, const BatchSelectRequest& request) = 0;
+  virtual void OpenCursor(SelectResponse& _return, const SelectRequest& request) = 0;
+  virtual void FetchCursor(SelectResponse& _return, const CursorRequest& request) = 0;
   virtual void Explain(SelectResponse& _return, const ExplainRequest& request) = 0;
   virtual void Delete(CommonResponse& _return, const DeleteRequest& request) = 0;
+  virtual void CloseCursor(CommonResponse& _return, const CursorRequest& request) = 0;
   virtual void Update(CommonResponse& _return, const UpdateRequest& request) = 0;
   virtual void UploadFileChunk(UploadResponse& _return, const FileChunk& request) = 0;
   virtual void ListDatabase(ListDatabaseResponse& _return, const ListDatabaseRequest& request) = 0;
@@ -101,15 +106,30 @@ class InfinityServiceNull : virtual public InfinityServiceIf {
   void Import(CommonResponse& /* _return */, const ImportRequest& /* request */) override {
     return;
   }
+  void InsertColumnar(CommonResponse& /* _return */, const InsertColumnarRequest& /* request */) override {
+    return;
+  }
   void Select(SelectResponse& /* _return */, const SelectRequest& /* request */) override {
     return;
   }
+  void BatchSelect(BatchSelectResponse& /* _return */, const BatchSelectRequest& /* request */) override {
+    return;
+  }
+  void OpenCursor(SelectResponse& /* _return */, const SelectRequest& /* request */) override {
+    return;
+  }
+  void FetchCursor(SelectResponse& /* _return */, const CursorRequest& /* request */) override {
+    return;
+  }
   void Explain(SelectResponse& /* _return */, const ExplainRequest& /* request */) override {
     return;
   }
   void Delete(CommonResponse& /* _return */, const DeleteRequest& /* request */) override {
     return;
   }
+  void CloseCursor(CommonResponse& /* _return */, const CursorRequest& /* request */) override {
+    return;
+  }
   void Update(CommonResponse& /* _return */, const UpdateRequest& /* request */) override {
     return;
   }
@@ -977,6 +997,110 @@ class InfinityService_Import_presult {
 
 };
 
+typedef struct _InfinityService_InsertColumnar_args__isset {
+  _InfinityService_InsertColumnar_args__isset() : request(false) {}
+  bool request :1;
+} _InfinityService_InsertColumnar_args__isset;
+
+class InfinityService_InsertColumnar_args {
+ public:
+
+  InfinityService_InsertColumnar_args(const InfinityService_InsertColumnar_args&);
+  InfinityService_InsertColumnar_args& operator=(const InfinityService_InsertColumnar_args&);
+  InfinityService_InsertColumnar_args() noexcept {
+  }
+
+  virtual ~InfinityService_InsertColumnar_args() noexcept;
+  InsertColumnarRequest request;
+
+  _InfinityService_InsertColumnar_args__isset __isset;
+
+  void __set_request(const InsertColumnarRequest& val);
+
+  bool operator == (const InfinityService_InsertColumnar_args & rhs) const
+  {
+    if (!(request == rhs.request))
+      return false;
+    return true;
+  }
+  bool operator != (const InfinityService_InsertColumnar_args &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const InfinityService_InsertColumnar_args & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+
+class InfinityService_InsertColumnar_pargs {
+ public:
+
+
+  virtual ~InfinityService_InsertColumnar_pargs() noexcept;
+  const InsertColumnarRequest* request;
+
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _InfinityService_InsertColumnar_result__isset {
+  _InfinityService_InsertColumnar_result__isset() : success(false) {}
+  bool success :1;
+} _InfinityService_InsertColumnar_result__isset;
+
+class InfinityService_InsertColumnar_result {
+ public:
+
+  InfinityService_InsertColumnar_result(const InfinityService_InsertColumnar_result&);
+  InfinityService_InsertColumnar_result& operator=(const InfinityService_InsertColumnar_result&);
+  InfinityService_InsertColumnar_result() noexcept {
+  }
+
+  virtual ~InfinityService_InsertColumnar_result() noexcept;
+  CommonResponse success;
+
+  _InfinityService_InsertColumnar_result__isset __isset;
+
+  void __set_success(const CommonResponse& val);
+
+  bool operator == (const InfinityService_InsertColumnar_result & rhs) const
+  {
+    if (!(success == rhs.success))
+      return false;
+    return true;
+  }
+  bool operator != (const InfinityService_InsertColumnar_result &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const InfinityService_InsertColumnar_result & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _InfinityService_InsertColumnar_presult__isset {
+  _InfinityService_InsertColumnar_presult__isset() : success(false) {}
+  bool success :1;
+} _InfinityService_InsertColumnar_presult__isset;
+
+class InfinityService_InsertColumnar_presult {
+ public:
+
+
+  virtual ~InfinityService_InsertColumnar_presult() noexcept;
+  CommonResponse* success;
+
+  _InfinityService_InsertColumnar_presult__isset __isset;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+
+};
+
 typedef struct _InfinityService_Select_args__isset {
   _InfinityService_Select_args__isset() : request(false) {}
   bool request :1;
@@ -1081,6 +1205,318 @@ class InfinityService_Select_presult {
 
 };
 
+typedef struct _InfinityService_BatchSelect_args__isset {
+  _InfinityService_BatchSelect_args__isset() : request(false) {}
+  bool request :1;
+} _InfinityService_BatchSelect_args__isset;
+
+class InfinityService_BatchSelect_args {
+ public:
+
+  InfinityService_BatchSelect_args(const InfinityService_BatchSelect_args&);
+  InfinityService_BatchSelect_args& operator=(const InfinityService_BatchSelect_args&);
+  InfinityService_BatchSelect_args() noexcept {
+  }
+
+  virtual ~InfinityService_BatchSelect_args() noexcept;
+  BatchSelectRequest request;
+
+  _InfinityService_BatchSelect_args__isset __isset;
+
+  void __set_request(const BatchSelectRequest& val);
+
+  bool operator == (const InfinityService_BatchSelect_args & rhs) const
+  {
+    if (!(request == rhs.request))
+      return false;
+    return true;
+  }
+  bool operator != (const InfinityService_BatchSelect_args &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const InfinityService_BatchSelect_args & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+
+class InfinityService_BatchSelect_pargs {
+ public:
+
+
+  virtual ~InfinityService_BatchSelect_pargs() noexcept;
+  const BatchSelectRequest* request;
+
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _InfinityService_BatchSelect_result__isset {
+  _InfinityService_BatchSelect_result__isset() : success(false) {}
+  bool success :1;
+} _InfinityService_BatchSelect_result__isset;
+
+class InfinityService_BatchSelect_result {
+ public:
+
+  InfinityService_BatchSelect_result(const InfinityService_BatchSelect_result&);
+  InfinityService_BatchSelect_result& operator=(const InfinityService_BatchSelect_result&);
+  InfinityService_BatchSelect_result() noexcept {
+  }
+
+  virtual ~InfinityService_BatchSelect_result() noexcept;
+  BatchSelectResponse success;
+
+  _InfinityService_BatchSelect_result__isset __isset;
+
+  void __set_success(const BatchSelectResponse& val);
+
+  bool operator == (const InfinityService_BatchSelect_result & rhs) const
+  {
+    if (!(success == rhs.success))
+      return false;
+    return true;
+  }
+  bool operator != (const InfinityService_BatchSelect_result &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const InfinityService_BatchSelect_result & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _InfinityService_BatchSelect_presult__isset {
+  _InfinityService_BatchSelect_presult__isset() : success(false) {}
+  bool success :1;
+} _InfinityService_BatchSelect_presult__isset;
+
+class InfinityService_BatchSelect_presult {
+ public:
+
+
+  virtual ~InfinityService_BatchSelect_presult() noexcept;
+  BatchSelectResponse* success;
+
+  _InfinityService_BatchSelect_presult__isset __isset;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+
+};
+
+typedef struct _InfinityService_OpenCursor_args__isset {
+  _InfinityService_OpenCursor_args__isset() : request(false) {}
+  bool request :1;
+} _InfinityService_OpenCursor_args__isset;
+
+class InfinityService_OpenCursor_args {
+ public:
+
+  InfinityService_OpenCursor_args(const InfinityService_OpenCursor_args&);
+  InfinityService_OpenCursor_args& operator=(const InfinityService_OpenCursor_args&);
+  InfinityService_OpenCursor_args() noexcept {
+  }
+
+  virtual ~InfinityService_OpenCursor_args() noexcept;
+  SelectRequest request;
+
+  _InfinityService_OpenCursor_args__isset __isset;
+
+  void __set_request(const SelectRequest& val);
+
+  bool operator == (const InfinityService_OpenCursor_args & rhs) const
+  {
+    if (!(request == rhs.request))
+      return false;
+    return true;
+  }
+  bool operator != (const InfinityService_OpenCursor_args &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const InfinityService_OpenCursor_args & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+
+class InfinityService_OpenCursor_pargs {
+ public:
+
+
+  virtual ~InfinityService_OpenCursor_pargs() noexcept;
+  const SelectRequest* request;
+
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _InfinityService_OpenCursor_result__isset {
+  _InfinityService_OpenCursor_result__isset() : success(false) {}
+  bool success :1;
+} _InfinityService_OpenCursor_result__isset;
+
+class InfinityService_OpenCursor_result {
+ public:
+
+  InfinityService_OpenCursor_result(const InfinityService_OpenCursor_result&);
+  InfinityService_OpenCursor_result& operator=(const InfinityService_OpenCursor_result&);
+  InfinityService_OpenCursor_result() noexcept {
+  }
+
+  virtual ~InfinityService_OpenCursor_result() noexcept;
+  SelectResponse success;
+
+  _InfinityService_OpenCursor_result__isset __isset;
+
+  void __set_success(const SelectResponse& val);
+
+  bool operator == (const InfinityService_OpenCursor_result & rhs) const
+  {
+    if (!(success == rhs.success))
+      return false;
+    return true;
+  }
+  bool operator != (const InfinityService_OpenCursor_result &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const InfinityService_OpenCursor_result & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _InfinityService_OpenCursor_presult__isset {
+  _InfinityService_OpenCursor_presult__isset() : success(false) {}
+  bool success :1;
+} _InfinityService_OpenCursor_presult__isset;
+
+class InfinityService_OpenCursor_presult {
+ public:
+
+
+  virtual ~InfinityService_OpenCursor_presult() noexcept;
+  SelectResponse* success;
+
+  _InfinityService_OpenCursor_presult__isset __isset;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+
+};
+
+typedef struct _InfinityService_FetchCursor_args__isset {
+  _InfinityService_FetchCursor_args__isset() : request(false) {}
+  bool request :1;
+} _InfinityService_FetchCursor_args__isset;
+
+class InfinityService_FetchCursor_args {
+ public:
+
+  InfinityService_FetchCursor_args(const InfinityService_FetchCursor_args&);
+  InfinityService_FetchCursor_args& operator=(const InfinityService_FetchCursor_args&);
+  InfinityService_FetchCursor_args() noexcept {
+  }
+
+  virtual ~InfinityService_FetchCursor_args() noexcept;
+  CursorRequest request;
+
+  _InfinityService_FetchCursor_args__isset __isset;
+
+  void __set_request(const CursorRequest& val);
+
+  bool operator == (const InfinityService_FetchCursor_args & rhs) const
+  {
+    if (!(request == rhs.request))
+      return false;
+    return true;
+  }
+  bool operator != (const InfinityService_FetchCursor_args &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const InfinityService_FetchCursor_args & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+
+class InfinityService_FetchCursor_pargs {
+ public:
+
+
+  virtual ~InfinityService_FetchCursor_pargs() noexcept;
+  const CursorRequest* request;
+
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _InfinityService_FetchCursor_result__isset {
+  _InfinityService_FetchCursor_result__isset() : success(false) {}
+  bool success :1;
+} _InfinityService_FetchCursor_result__isset;
+
+class InfinityService_FetchCursor_result {
+ public:
+
+  InfinityService_FetchCursor_result(const InfinityService_FetchCursor_result&);
+  InfinityService_FetchCursor_result& operator=(const InfinityService_FetchCursor_result&);
+  InfinityService_FetchCursor_result() noexcept {
+  }
+
+  virtual ~InfinityService_FetchCursor_result() noexcept;
+  SelectResponse success;
+
+  _InfinityService_FetchCursor_result__isset __isset;
+
+  void __set_success(const SelectResponse& val);
+
+  bool operator == (const InfinityService_FetchCursor_result & rhs) const
+  {
+    if (!(success == rhs.success))
+      return false;
+    return true;
+  }
+  bool operator != (const InfinityService_FetchCursor_result &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const InfinityService_FetchCursor_result & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _InfinityService_FetchCursor_presult__isset {
+  _InfinityService_FetchCursor_presult__isset() : success(false) {}
+  bool success :1;
+} _InfinityService_FetchCursor_presult__isset;
+
+class InfinityService_FetchCursor_presult {
+ public:
+
+
+  virtual ~InfinityService_FetchCursor_presult() noexcept;
+  SelectResponse* success;
+
+  _InfinityService_FetchCursor_presult__isset __isset;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+
+};
+
 typedef struct _InfinityService_Explain_args__isset {
   _InfinityService_Explain_args__isset() : request(false) {}
   bool request :1;
@@ -1289,6 +1725,110 @@ class InfinityService_Delete_presult {
 
 };
 
+typedef struct _InfinityService_CloseCursor_args__isset {
+  _InfinityService_CloseCursor_args__isset() : request(false) {}
+  bool request :1;
+} _InfinityService_CloseCursor_args__isset;
+
+class InfinityService_CloseCursor_args {
+ public:
+
+  InfinityService_CloseCursor_args(const InfinityService_CloseCursor_args&);
+  InfinityService_CloseCursor_args& operator=(const InfinityService_CloseCursor_args&);
+  InfinityService_CloseCursor_args() noexcept {
+  }
+
+  virtual ~InfinityService_CloseCursor_args() noexcept;
+  CursorRequest request;
+
+  _InfinityService_CloseCursor_args__isset __isset;
+
+  void __set_request(const CursorRequest& val);
+
+  bool operator == (const InfinityService_CloseCursor_args & rhs) const
+  {
+    if (!(request == rhs.request))
+      return false;
+    return true;
+  }
+  bool operator != (const InfinityService_CloseCursor_args &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const InfinityService_CloseCursor_args & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+
+class InfinityService_CloseCursor_pargs {
+ public:
+
+
+  virtual ~InfinityService_CloseCursor_pargs() noexcept;
+  const CursorRequest* request;
+
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _InfinityService_CloseCursor_result__isset {
+  _InfinityService_CloseCursor_result__isset() : success(false) {}
+  bool success :1;
+} _InfinityService_CloseCursor_result__isset;
+
+class InfinityService_CloseCursor_result {
+ public:
+
+  InfinityService_CloseCursor_result(const InfinityService_CloseCursor_result&);
+  InfinityService_CloseCursor_result& operator=(const InfinityService_CloseCursor_result&);
+  InfinityService_CloseCursor_result() noexcept {
+  }
+
+  virtual ~InfinityService_CloseCursor_result() noexcept;
+  CommonResponse success;
+
+  _InfinityService_CloseCursor_result__isset __isset;
+
+  void __set_success(const CommonResponse& val);
+
+  bool operator == (const InfinityService_CloseCursor_result & rhs) const
+  {
+    if (!(success == rhs.success))
+      return false;
+    return true;
+  }
+  bool operator != (const InfinityService_CloseCursor_result &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const InfinityService_CloseCursor_result & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _InfinityService_CloseCursor_presult__isset {
+  _InfinityService_CloseCursor_presult__isset() : success(false) {}
+  bool success :1;
+} _InfinityService_CloseCursor_presult__isset;
+
+class InfinityService_CloseCursor_presult {
+ public:
+
+
+  virtual ~InfinityService_CloseCursor_presult() noexcept;
+  CommonResponse* success;
+
+  _InfinityService_CloseCursor_presult__isset __isset;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+
+};
+
 typedef struct _InfinityService_Update_args__isset {
   _InfinityService_Update_args__isset() : request(false) {}
   bool request :1;
@@ -2898,15 +3438,30 @@ class InfinityServiceClient : virtual public InfinityServiceIf {
   void Import(CommonResponse& _return, const ImportRequest& request) override;
   void send_Import(const ImportRequest& request);
   void recv_Import(CommonResponse& _return);
+  void InsertColumnar(CommonResponse& _return, const InsertColumnarRequest& request) override;
+  void send_InsertColumnar(const InsertColumnarRequest& request);
+  void recv_InsertColumnar(CommonResponse& _return);
   void Select(SelectResponse& _return, const SelectRequest& request) override;
   void send_Select(const SelectRequest& request);
   void recv_Select(SelectResponse& _return);
+  void BatchSelect(BatchSelectResponse& _return, const BatchSelectRequest& request) override;
+  void send_BatchSelect(const BatchSelectRequest& request);
+  void recv_BatchSelect(BatchSelectResponse& _return);
+  void OpenCursor(SelectResponse& _return, const SelectRequest& request) override;
+  void send_OpenCursor(const SelectRequest& request);
+  void recv_OpenCursor(SelectResponse& _return);
+  void FetchCursor(SelectResponse& _return, const CursorRequest& request) override;
+  void send_FetchCursor(const CursorRequest& request);
+  void recv_FetchCursor(SelectResponse& _return);
   void Explain(SelectResponse& _return, const ExplainRequest& request) override;
   void send_Explain(const ExplainRequest& request);
   void recv_Explain(SelectResponse& _return);
   void Delete(CommonResponse& _return, const DeleteRequest& request) override;
   void send_Delete(const DeleteRequest& request);
   void recv_Delete(CommonResponse& _return);
+  void CloseCursor(CommonResponse& _return, const CursorRequest& request) override;
+  void send_CloseCursor(const CursorRequest& request);
+  void recv_CloseCursor(CommonResponse& _return);
   void Update(CommonResponse& _return, const UpdateRequest& request) override;
   void send_Update(const UpdateRequest& request);
   void recv_Update(CommonResponse& _return);
@@ -2975,9 +3530,14 @@ class InfinityServiceProcessor : public ::apache::thrift::TDispatchProcessor {
   void process_DropTable(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
   void process_Insert(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
   void process_Import(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
+  void process_InsertColumnar(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
   void process_Select(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
+  void process_BatchSelect(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
+  void process_OpenCursor(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
+  void process_FetchCursor(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
   void process_Explain(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
   void process_Delete(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
+  void process_CloseCursor(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
   void process_Update(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
   void process_UploadFileChunk(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
   void process_ListDatabase(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
@@ -3004,9 +3564,14 @@ class InfinityServiceProcessor : public ::apache::thrift::TDispatchProcessor {
     processMap_["DropTable"] = &InfinityServiceProcessor::process_DropTable;
     processMap_["Insert"] = &InfinityServiceProcessor::process_Insert;
     processMap_["Import"] = &InfinityServiceProcessor::process_Import;
+    processMap_["InsertColumnar"] = &InfinityServiceProcessor::process_InsertColumnar;
     processMap_["Select"] = &InfinityServiceProcessor::process_Select;
+    processMap_["BatchSelect"] = &InfinityServiceProcessor::process_BatchSelect;
+    processMap_["OpenCursor"] = &InfinityServiceProcessor::process_OpenCursor;
+    processMap_["FetchCursor"] = &InfinityServiceProcessor::process_FetchCursor;
     processMap_["Explain"] = &InfinityServiceProcessor::process_Explain;
     processMap_["Delete"] = &InfinityServiceProcessor::process_Delete;
+    processMap_["CloseCursor"] = &InfinityServiceProcessor::process_CloseCursor;
     processMap_["Update"] = &InfinityServiceProcessor::process_Update;
     processMap_["UploadFileChunk"] = &InfinityServiceProcessor::process_UploadFileChunk;
     processMap_["ListDatabase"] = &InfinityServiceProcessor::process_ListDatabase;
@@ -3130,6 +3695,16 @@ class InfinityServiceMultiface : virtual public InfinityServiceIf {
     return;
   }
 
+  void InsertColumnar(CommonResponse& _return, const InsertColumnarRequest& request) override {
+    size_t sz = ifaces_.size();
+    size_t i = 0;
+    for (; i < (sz - 1); ++i) {
+      ifaces_[i]->InsertColumnar(_return, request);
+    }
+    ifaces_[i]->InsertColumnar(_return, request);
+    return;
+  }
+
   void Select(SelectResponse& _return, const SelectRequest& request) override {
     size_t sz = ifaces_.size();
     size_t i = 0;
@@ -3140,6 +3715,36 @@ class InfinityServiceMultiface : virtual public InfinityServiceIf {
     return;
   }
 
+  void BatchSelect(BatchSelectResponse& _return, const BatchSelectRequest& request) override {
+    size_t sz = ifaces_.size();
+    size_t i = 0;
+    for (; i < (sz - 1); ++i) {
+      ifaces_[i]->BatchSelect(_return, request);
+    }
+    ifaces_[i]->BatchSelect(_return, request);
+    return;
+  }
+
+  void OpenCursor(SelectResponse& _return, const SelectRequest& request) override {
+    size_t sz = ifaces_.size();
+    size_t i = 0;
+    for (; i < (sz - 1); ++i) {
+      ifaces_[i]->OpenCursor(_return, request);
+    }
+    ifaces_[i]->OpenCursor(_return, request);
+    return;
+  }
+
+  void FetchCursor(SelectResponse& _return, const CursorRequest& request) override {
+    size_t sz = ifaces_.size();
+    size_t i = 0;
+    for (; i < (sz - 1); ++i) {
+      ifaces_[i]->FetchCursor(_return, request);
+    }
+    ifaces_[i]->FetchCursor(_return, request);
+    return;
+  }
+
   void Explain(SelectResponse& _return, const ExplainRequest& request) override {
     size_t sz = ifaces_.size();
     size_t i = 0;
@@ -3160,6 +3765,16 @@ class InfinityServiceMultiface : virtual public InfinityServiceIf {
     return;
   }
 
+  void CloseCursor(CommonResponse& _return, const CursorRequest& request) override {
+    size_t sz = ifaces_.size();
+    size_t i = 0;
+    for (; i < (sz - 1); ++i) {
+      ifaces_[i]->CloseCursor(_return, request);
+    }
+    ifaces_[i]->CloseCursor(_return, request);
+    return;
+  }
+
   void Update(CommonResponse& _return, const UpdateRequest& request) override {
     size_t sz = ifaces_.size();
     size_t i = 0;
@@ -3366,15 +3981,30 @@ class InfinityServiceConcurrentClient : virtual public InfinityServiceIf {
   void Import(CommonResponse& _return, const ImportRequest& request) override;
   int32_t send_Import(const ImportRequest& request);
   void recv_Import(CommonResponse& _return, const int32_t seqid);
+  void InsertColumnar(CommonResponse& _return, const InsertColumnarRequest& request) override;
+  int32_t send_InsertColumnar(const InsertColumnarRequest& request);
+  void recv_InsertColumnar(CommonResponse& _return, const int32_t seqid);
   void Select(SelectResponse& _return, const SelectRequest& request) override;
   int32_t send_Select(const SelectRequest& request);
   void recv_Select(SelectResponse& _return, const int32_t seqid);
+  void BatchSelect(BatchSelectResponse& _return, const BatchSelectRequest& request) override;
+  int32_t send_BatchSelect(const BatchSelectRequest& request);
+  void recv_BatchSelect(BatchSelectResponse& _return, const int32_t seqid);
+  void OpenCursor(SelectResponse& _return, const SelectRequest& request) override;
+  int32_t send_OpenCursor(const SelectRequest& request);
+  void recv_OpenCursor(SelectResponse& _return, const int32_t seqid);
+  void FetchCursor(SelectResponse& _return, const CursorRequest& request) override;
+  int32_t send_FetchCursor(const CursorRequest& request);
+  void recv_FetchCursor(SelectResponse& _return, const int32_t seqid);
   void Explain(SelectResponse& _return, const ExplainRequest& request) override;
   int32_t send_Explain(const ExplainRequest& request);
   void recv_Explain(SelectResponse& _return, const int32_t seqid);
   void Delete(CommonResponse& _return, const DeleteRequest& request) override;
   int32_t send_Delete(const DeleteRequest& request);
   void recv_Delete(CommonResponse& _return, const int32_t seqid);
+  void CloseCursor(CommonResponse& _return, const CursorRequest& request) override;
+  int32_t send_CloseCursor(const CursorRequest& request);
+  void recv_CloseCursor(CommonResponse& _return, const int32_t seqid);
   void Update(CommonResponse& _return, const UpdateRequest& request) override;
   int32_t send_Update(const UpdateRequest& request);
   void recv_Update(CommonResponse& _return, const int32_t seqid);
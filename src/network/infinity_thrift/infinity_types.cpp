@@ -270,15 +270,19 @@ int _kCopyFileTypeValues[] = {
   CopyFileType::CSV,
   CopyFileType::JSON,
   CopyFileType::JSONL,
-  CopyFileType::FVECS
+  CopyFileType::FVECS,
+  CopyFileType::PARQUET,
+  CopyFileType::ARROW
 };
 const char* _kCopyFileTypeNames[] = {
   "CSV",
   "JSON",
   "JSONL",
-  "FVECS"
+  "FVECS",
+  "PARQUET",
+  "ARROW"
 };
-const std::map<int, const char*> _CopyFileType_VALUES_TO_NAMES(::apache::thrift::TEnumIterator(4, _kCopyFileTypeValues, _kCopyFileTypeNames), ::apache::thrift::TEnumIterator(-1, nullptr, nullptr));
+const std::map<int, const char*> _CopyFileType_VALUES_TO_NAMES(::apache::thrift::TEnumIterator(6, _kCopyFileTypeValues, _kCopyFileTypeNames), ::apache::thrift::TEnumIterator(-1, nullptr, nullptr));
 
 std::ostream& operator<<(std::ostream& out, const CopyFileType::type& val) {
   std::map<int, const char*>::const_iterator it = _CopyFileType_VALUES_TO_NAMES.find(val);
@@ -299,6 +303,35 @@ std::string to_string(const CopyFileType::type& val) {
   }
 }
 
+int _kCompressionTypeValues[] = {
+  CompressionType::NoCompression,
+  CompressionType::LZ4
+};
+const char* _kCompressionTypeNames[] = {
+  "NoCompression",
+  "LZ4"
+};
+const std::map<int, const char*> _CompressionType_VALUES_TO_NAMES(::apache::thrift::TEnumIterator(2, _kCompressionTypeValues, _kCompressionTypeNames), ::apache::thrift::TEnumIterator(-1, nullptr, nullptr));
+
+std::ostream& operator<<(std::ostream& out, const CompressionType::type& val) {
+  std::map<int, const char*>::const_iterator it = _CompressionType_VALUES_TO_NAMES.find(val);
+  if (it != _CompressionType_VALUES_TO_NAMES.end()) {
+    out << it->second;
+  } else {
+    out << static_cast<int>(val);
+  }
+  return out;
+}
+
+std::string to_string(const CompressionType::type& val) {
+  std::map<int, const char*>::const_iterator it = _CompressionType_VALUES_TO_NAMES.find(val);
+  if (it != _CompressionType_VALUES_TO_NAMES.end()) {
+    return std::string(it->second);
+  } else {
+    return std::to_string(static_cast<int>(val));
+  }
+}
+
 int _kColumnTypeValues[] = {
   ColumnType::ColumnBool,
   ColumnType::ColumnInt8,
@@ -1786,6 +1819,7 @@ void ParsedExprType::printTo(std::ostream& out) const {
   out << ", " << "knn_expr="; (__isset.knn_expr ? (out << to_string(knn_expr)) : (out << "<null>"));
   out << ", " << "match_expr="; (__isset.match_expr ? (out << to_string(match_expr)) : (out << "<null>"));
   out << ", " << "fusion_expr="; (__isset.fusion_expr ? (out << to_string(fusion_expr)) : (out << "<null>"));
+  out << ", " << "rerank_expr="; (__isset.rerank_expr ? (out << to_string(rerank_expr)) : (out << "<null>"));
   out << ", " << "search_expr="; (__isset.search_expr ? (out << to_string(search_expr)) : (out << "<null>"));
   out << ")";
 }
@@ -2991,6 +3025,11 @@ void SearchExpr::__set_fusion_expr(const FusionExpr& val) {
   this->fusion_expr = val;
 __isset.fusion_expr = true;
 }
+
+void SearchExpr::__set_rerank_expr(const KnnExpr& val) {
+  this->rerank_expr = val;
+__isset.rerank_expr = true;
+}
 std::ostream& operator<<(std::ostream& out, const SearchExpr& obj)
 {
   obj.printTo(out);
@@ -3067,6 +3106,14 @@ uint32_t SearchExpr::read(::apache::thrift::protocol::TProtocol* iprot) {
           xfer += iprot->skip(ftype);
         }
         break;
+      case 4:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->rerank_expr.read(iprot);
+          this->__isset.rerank_expr = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -3115,6 +3162,11 @@ uint32_t SearchExpr::write(::apache::thrift::protocol::TProtocol* oprot) const {
     xfer += this->fusion_expr.write(oprot);
     xfer += oprot->writeFieldEnd();
   }
+  if (this->__isset.rerank_expr) {
+    xfer += oprot->writeFieldBegin("rerank_expr", ::apache::thrift::protocol::T_STRUCT, 4);
+    xfer += this->rerank_expr.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  }
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
   return xfer;
@@ -3125,6 +3177,7 @@ void swap(SearchExpr &a, SearchExpr &b) {
   swap(a.match_exprs, b.match_exprs);
   swap(a.knn_exprs, b.knn_exprs);
   swap(a.fusion_expr, b.fusion_expr);
+  swap(a.rerank_expr, b.rerank_expr);
   swap(a.__isset, b.__isset);
 }
 
@@ -3132,12 +3185,14 @@ SearchExpr::SearchExpr(const SearchExpr& other119) {
   match_exprs = other119.match_exprs;
   knn_exprs = other119.knn_exprs;
   fusion_expr = other119.fusion_expr;
+  rerank_expr = other119.rerank_expr;
   __isset = other119.__isset;
 }
 SearchExpr& SearchExpr::operator=(const SearchExpr& other120) {
   match_exprs = other120.match_exprs;
   knn_exprs = other120.knn_exprs;
   fusion_expr = other120.fusion_expr;
+  rerank_expr = other120.rerank_expr;
   __isset = other120.__isset;
   return *this;
 }
@@ -8287,6 +8342,218 @@ void InsertRequest::printTo(std::ostream& out) const {
 }
 
 
+InsertColumnarRequest::~InsertColumnarRequest() noexcept {
+}
+
+
+void InsertColumnarRequest::__set_db_name(const std::string& val) {
+  this->db_name = val;
+}
+
+void InsertColumnarRequest::__set_table_name(const std::string& val) {
+  this->table_name = val;
+}
+
+void InsertColumnarRequest::__set_column_names(const std::vector<std::string> & val) {
+  this->column_names = val;
+}
+
+void InsertColumnarRequest::__set_columns(const std::vector<ColumnField> & val) {
+  this->columns = val;
+}
+
+void InsertColumnarRequest::__set_session_id(const int64_t val) {
+  this->session_id = val;
+}
+std::ostream& operator<<(std::ostream& out, const InsertColumnarRequest& obj)
+{
+  obj.printTo(out);
+  return out;
+}
+
+
+uint32_t InsertColumnarRequest::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRING) {
+          xfer += iprot->readString(this->db_name);
+          this->__isset.db_name = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_STRING) {
+          xfer += iprot->readString(this->table_name);
+          this->__isset.table_name = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 3:
+        if (ftype == ::apache::thrift::protocol::T_LIST) {
+          {
+            this->column_names.clear();
+            uint32_t _size257;
+            ::apache::thrift::protocol::TType _etype260;
+            xfer += iprot->readListBegin(_etype260, _size257);
+            this->column_names.resize(_size257);
+            uint32_t _i261;
+            for (_i261 = 0; _i261 < _size257; ++_i261)
+            {
+              xfer += iprot->readString(this->column_names[_i261]);
+            }
+            xfer += iprot->readListEnd();
+          }
+          this->__isset.column_names = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 4:
+        if (ftype == ::apache::thrift::protocol::T_LIST) {
+          {
+            this->columns.clear();
+            uint32_t _size262;
+            ::apache::thrift::protocol::TType _etype265;
+            xfer += iprot->readListBegin(_etype265, _size262);
+            this->columns.resize(_size262);
+            uint32_t _i266;
+            for (_i266 = 0; _i266 < _size262; ++_i266)
+            {
+              xfer += this->columns[_i266].read(iprot);
+            }
+            xfer += iprot->readListEnd();
+          }
+          this->__isset.columns = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 5:
+        if (ftype == ::apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->session_id);
+          this->__isset.session_id = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t InsertColumnarRequest::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+  xfer += oprot->writeStructBegin("InsertColumnarRequest");
+
+  xfer += oprot->writeFieldBegin("db_name", ::apache::thrift::protocol::T_STRING, 1);
+  xfer += oprot->writeString(this->db_name);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("table_name", ::apache::thrift::protocol::T_STRING, 2);
+  xfer += oprot->writeString(this->table_name);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("column_names", ::apache::thrift::protocol::T_LIST, 3);
+  {
+    xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRING, static_cast<uint32_t>(this->column_names.size()));
+    std::vector<std::string> ::const_iterator _iter267;
+    for (_iter267 = this->column_names.begin(); _iter267 != this->column_names.end(); ++_iter267)
+    {
+      xfer += oprot->writeString((*_iter267));
+    }
+    xfer += oprot->writeListEnd();
+  }
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("columns", ::apache::thrift::protocol::T_LIST, 4);
+  {
+    xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT, static_cast<uint32_t>(this->columns.size()));
+    std::vector<ColumnField> ::const_iterator _iter268;
+    for (_iter268 = this->columns.begin(); _iter268 != this->columns.end(); ++_iter268)
+    {
+      xfer += (*_iter268).write(oprot);
+    }
+    xfer += oprot->writeListEnd();
+  }
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("session_id", ::apache::thrift::protocol::T_I64, 5);
+  xfer += oprot->writeI64(this->session_id);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+void swap(InsertColumnarRequest &a, InsertColumnarRequest &b) {
+  using ::std::swap;
+  swap(a.db_name, b.db_name);
+  swap(a.table_name, b.table_name);
+  swap(a.column_names, b.column_names);
+  swap(a.columns, b.columns);
+  swap(a.session_id, b.session_id);
+  swap(a.__isset, b.__isset);
+}
+
+InsertColumnarRequest::InsertColumnarRequest(const InsertColumnarRequest& other269) {
+  db_name = other269.db_name;
+  table_name = other269.table_name;
+  column_names = other269.column_names;
+  columns = other269.columns;
+  session_id = other269.session_id;
+  __isset = other269.__isset;
+}
+InsertColumnarRequest& InsertColumnarRequest::operator=(const InsertColumnarRequest& other270) {
+  db_name = other270.db_name;
+  table_name = other270.table_name;
+  column_names = other270.column_names;
+  columns = other270.columns;
+  session_id = other270.session_id;
+  __isset = other270.__isset;
+  return *this;
+}
+void InsertColumnarRequest::printTo(std::ostream& out) const {
+  using ::apache::thrift::to_string;
+  out << "InsertColumnarRequest(";
+  out << "db_name=" << to_string(db_name);
+  out << ", " << "table_name=" << to_string(table_name);
+  out << ", " << "column_names=" << to_string(column_names);
+  out << ", " << "columns=" << to_string(columns);
+  out << ", " << "session_id=" << to_string(session_id);
+  out << ")";
+}
+
+
 ImportRequest::~ImportRequest() noexcept {
 }
 
@@ -8514,6 +8781,10 @@ void FileChunk::__set_session_id(const int64_t val) {
 void FileChunk::__set_total_size(const int64_t val) {
   this->total_size = val;
 }
+
+void FileChunk::__set_compression(const CompressionType::type val) {
+  this->compression = val;
+}
 std::ostream& operator<<(std::ostream& out, const FileChunk& obj)
 {
   obj.printTo(out);
@@ -8606,6 +8877,16 @@ uint32_t FileChunk::read(::apache::thrift::protocol::TProtocol* iprot) {
           xfer += iprot->skip(ftype);
         }
         break;
+      case 9:
+        if (ftype == ::apache::thrift::protocol::T_I32) {
+          int32_t ecast291;
+          xfer += iprot->readI32(ecast291);
+          this->compression = static_cast<CompressionType::type>(ecast291);
+          this->__isset.compression = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -8655,6 +8936,10 @@ uint32_t FileChunk::write(::apache::thrift::protocol::TProtocol* oprot) const {
   xfer += oprot->writeI64(this->total_size);
   xfer += oprot->writeFieldEnd();
 
+  xfer += oprot->writeFieldBegin("compression", ::apache::thrift::protocol::T_I32, 9);
+  xfer += oprot->writeI32(static_cast<int32_t>(this->compression));
+  xfer += oprot->writeFieldEnd();
+
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
   return xfer;
@@ -8670,6 +8955,7 @@ void swap(FileChunk &a, FileChunk &b) {
   swap(a.is_last, b.is_last);
   swap(a.session_id, b.session_id);
   swap(a.total_size, b.total_size);
+  swap(a.compression, b.compression);
   swap(a.__isset, b.__isset);
 }
 
@@ -8682,6 +8968,7 @@ FileChunk::FileChunk(const FileChunk& other273) {
   is_last = other273.is_last;
   session_id = other273.session_id;
   total_size = other273.total_size;
+  compression = other273.compression;
   __isset = other273.__isset;
 }
 FileChunk& FileChunk::operator=(const FileChunk& other274) {
@@ -8693,6 +8980,7 @@ FileChunk& FileChunk::operator=(const FileChunk& other274) {
   is_last = other274.is_last;
   session_id = other274.session_id;
   total_size = other274.total_size;
+  compression = other274.compression;
   __isset = other274.__isset;
   return *this;
 }
@@ -8707,6 +8995,7 @@ void FileChunk::printTo(std::ostream& out) const {
   out << ", " << "is_last=" << to_string(is_last);
   out << ", " << "session_id=" << to_string(session_id);
   out << ", " << "total_size=" << to_string(total_size);
+  out << ", " << "compression=" << to_string(compression);
   out << ")";
 }
 
@@ -9345,6 +9634,14 @@ void SelectRequest::__set_order_by_list(const std::vector<OrderByExpr> & val) {
   this->order_by_list = val;
 __isset.order_by_list = true;
 }
+
+void SelectRequest::__set_arrow_layout(const bool val) {
+  this->arrow_layout = val;
+}
+
+void SelectRequest::__set_compression(const CompressionType::type val) {
+  this->compression = val;
+}
 std::ostream& operator<<(std::ostream& out, const SelectRequest& obj)
 {
   obj.printTo(out);
@@ -9497,6 +9794,24 @@ uint32_t SelectRequest::read(::apache::thrift::protocol::TProtocol* iprot) {
           xfer += iprot->skip(ftype);
         }
         break;
+      case 12:
+        if (ftype == ::apache::thrift::protocol::T_BOOL) {
+          xfer += iprot->readBool(this->arrow_layout);
+          this->__isset.arrow_layout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 13:
+        if (ftype == ::apache::thrift::protocol::T_I32) {
+          int32_t ecast292;
+          xfer += iprot->readI32(ecast292);
+          this->compression = static_cast<CompressionType::type>(ecast292);
+          this->__isset.compression = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -9589,6 +9904,14 @@ uint32_t SelectRequest::write(::apache::thrift::protocol::TProtocol* oprot) cons
     }
     xfer += oprot->writeFieldEnd();
   }
+  xfer += oprot->writeFieldBegin("arrow_layout", ::apache::thrift::protocol::T_BOOL, 12);
+  xfer += oprot->writeBool(this->arrow_layout);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("compression", ::apache::thrift::protocol::T_I32, 13);
+  xfer += oprot->writeI32(static_cast<int32_t>(this->compression));
+  xfer += oprot->writeFieldEnd();
+
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
   return xfer;
@@ -9607,6 +9930,8 @@ void swap(SelectRequest &a, SelectRequest &b) {
   swap(a.limit_expr, b.limit_expr);
   swap(a.offset_expr, b.offset_expr);
   swap(a.order_by_list, b.order_by_list);
+  swap(a.arrow_layout, b.arrow_layout);
+  swap(a.compression, b.compression);
   swap(a.__isset, b.__isset);
 }
 
@@ -9622,6 +9947,8 @@ SelectRequest::SelectRequest(const SelectRequest& other328) {
   limit_expr = other328.limit_expr;
   offset_expr = other328.offset_expr;
   order_by_list = other328.order_by_list;
+  arrow_layout = other328.arrow_layout;
+  compression = other328.compression;
   __isset = other328.__isset;
 }
 SelectRequest& SelectRequest::operator=(const SelectRequest& other329) {
@@ -9636,6 +9963,8 @@ SelectRequest& SelectRequest::operator=(const SelectRequest& other329) {
   limit_expr = other329.limit_expr;
   offset_expr = other329.offset_expr;
   order_by_list = other329.order_by_list;
+  arrow_layout = other329.arrow_layout;
+  compression = other329.compression;
   __isset = other329.__isset;
   return *this;
 }
@@ -9653,6 +9982,8 @@ void SelectRequest::printTo(std::ostream& out) const {
   out << ", " << "limit_expr="; (__isset.limit_expr ? (out << to_string(limit_expr)) : (out << "<null>"));
   out << ", " << "offset_expr="; (__isset.offset_expr ? (out << to_string(offset_expr)) : (out << "<null>"));
   out << ", " << "order_by_list="; (__isset.order_by_list ? (out << to_string(order_by_list)) : (out << "<null>"));
+  out << ", " << "arrow_layout=" << to_string(arrow_layout);
+  out << ", " << "compression=" << to_string(compression);
   out << ")";
 }
 
@@ -9676,6 +10007,14 @@ void SelectResponse::__set_column_defs(const std::vector<ColumnDef> & val) {
 void SelectResponse::__set_column_fields(const std::vector<ColumnField> & val) {
   this->column_fields = val;
 }
+
+void SelectResponse::__set_cursor_id(const int64_t val) {
+  this->cursor_id = val;
+}
+
+void SelectResponse::__set_compression(const CompressionType::type val) {
+  this->compression = val;
+}
 std::ostream& operator<<(std::ostream& out, const SelectResponse& obj)
 {
   obj.printTo(out);
@@ -9760,6 +10099,24 @@ uint32_t SelectResponse::read(::apache::thrift::protocol::TProtocol* iprot) {
           xfer += iprot->skip(ftype);
         }
         break;
+      case 5:
+        if (ftype == ::apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->cursor_id);
+          this->__isset.cursor_id = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 6:
+        if (ftype == ::apache::thrift::protocol::T_I32) {
+          int32_t ecast293;
+          xfer += iprot->readI32(ecast293);
+          this->compression = static_cast<CompressionType::type>(ecast293);
+          this->__isset.compression = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -9809,7 +10166,15 @@ uint32_t SelectResponse::write(::apache::thrift::protocol::TProtocol* oprot) con
   }
   xfer += oprot->writeFieldEnd();
 
-  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeFieldBegin("cursor_id", ::apache::thrift::protocol::T_I64, 5);
+  xfer += oprot->writeI64(this->cursor_id);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("compression", ::apache::thrift::protocol::T_I32, 6);
+  xfer += oprot->writeI32(static_cast<int32_t>(this->compression));
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
   return xfer;
 }
@@ -9820,6 +10185,8 @@ void swap(SelectResponse &a, SelectResponse &b) {
   swap(a.error_msg, b.error_msg);
   swap(a.column_defs, b.column_defs);
   swap(a.column_fields, b.column_fields);
+  swap(a.cursor_id, b.cursor_id);
+  swap(a.compression, b.compression);
   swap(a.__isset, b.__isset);
 }
 
@@ -9828,6 +10195,8 @@ SelectResponse::SelectResponse(const SelectResponse& other342) {
   error_msg = other342.error_msg;
   column_defs = other342.column_defs;
   column_fields = other342.column_fields;
+  cursor_id = other342.cursor_id;
+  compression = other342.compression;
   __isset = other342.__isset;
 }
 SelectResponse& SelectResponse::operator=(const SelectResponse& other343) {
@@ -9835,6 +10204,8 @@ SelectResponse& SelectResponse::operator=(const SelectResponse& other343) {
   error_msg = other343.error_msg;
   column_defs = other343.column_defs;
   column_fields = other343.column_fields;
+  cursor_id = other343.cursor_id;
+  compression = other343.compression;
   __isset = other343.__isset;
   return *this;
 }
@@ -9845,6 +10216,424 @@ void SelectResponse::printTo(std::ostream& out) const {
   out << ", " << "error_msg=" << to_string(error_msg);
   out << ", " << "column_defs=" << to_string(column_defs);
   out << ", " << "column_fields=" << to_string(column_fields);
+  out << ", " << "cursor_id=" << to_string(cursor_id);
+  out << ", " << "compression=" << to_string(compression);
+  out << ")";
+}
+
+
+BatchSelectRequest::~BatchSelectRequest() noexcept {
+}
+
+
+void BatchSelectRequest::__set_session_id(const int64_t val) {
+  this->session_id = val;
+}
+
+void BatchSelectRequest::__set_requests(const std::vector<SelectRequest> & val) {
+  this->requests = val;
+}
+std::ostream& operator<<(std::ostream& out, const BatchSelectRequest& obj)
+{
+  obj.printTo(out);
+  return out;
+}
+
+
+uint32_t BatchSelectRequest::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->session_id);
+          this->__isset.session_id = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_LIST) {
+          {
+            this->requests.clear();
+            uint32_t _size362;
+            ::apache::thrift::protocol::TType _etype365;
+            xfer += iprot->readListBegin(_etype365, _size362);
+            this->requests.resize(_size362);
+            uint32_t _i366;
+            for (_i366 = 0; _i366 < _size362; ++_i366)
+            {
+              xfer += this->requests[_i366].read(iprot);
+            }
+            xfer += iprot->readListEnd();
+          }
+          this->__isset.requests = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t BatchSelectRequest::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+  xfer += oprot->writeStructBegin("BatchSelectRequest");
+
+  xfer += oprot->writeFieldBegin("session_id", ::apache::thrift::protocol::T_I64, 1);
+  xfer += oprot->writeI64(this->session_id);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("requests", ::apache::thrift::protocol::T_LIST, 2);
+  {
+    xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT, static_cast<uint32_t>(this->requests.size()));
+    std::vector<SelectRequest> ::const_iterator _iter367;
+    for (_iter367 = this->requests.begin(); _iter367 != this->requests.end(); ++_iter367)
+    {
+      xfer += (*_iter367).write(oprot);
+    }
+    xfer += oprot->writeListEnd();
+  }
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+void swap(BatchSelectRequest &a, BatchSelectRequest &b) {
+  using ::std::swap;
+  swap(a.session_id, b.session_id);
+  swap(a.requests, b.requests);
+  swap(a.__isset, b.__isset);
+}
+
+BatchSelectRequest::BatchSelectRequest(const BatchSelectRequest& other360) {
+  session_id = other360.session_id;
+  requests = other360.requests;
+  __isset = other360.__isset;
+}
+BatchSelectRequest& BatchSelectRequest::operator=(const BatchSelectRequest& other361) {
+  session_id = other361.session_id;
+  requests = other361.requests;
+  __isset = other361.__isset;
+  return *this;
+}
+void BatchSelectRequest::printTo(std::ostream& out) const {
+  using ::apache::thrift::to_string;
+  out << "BatchSelectRequest(";
+  out << "session_id=" << to_string(session_id);
+  out << ", " << "requests=" << to_string(requests);
+  out << ")";
+}
+
+
+BatchSelectResponse::~BatchSelectResponse() noexcept {
+}
+
+
+void BatchSelectResponse::__set_error_code(const int64_t val) {
+  this->error_code = val;
+}
+
+void BatchSelectResponse::__set_error_msg(const std::string& val) {
+  this->error_msg = val;
+}
+
+void BatchSelectResponse::__set_responses(const std::vector<SelectResponse> & val) {
+  this->responses = val;
+}
+std::ostream& operator<<(std::ostream& out, const BatchSelectResponse& obj)
+{
+  obj.printTo(out);
+  return out;
+}
+
+
+uint32_t BatchSelectResponse::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->error_code);
+          this->__isset.error_code = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_STRING) {
+          xfer += iprot->readString(this->error_msg);
+          this->__isset.error_msg = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 3:
+        if (ftype == ::apache::thrift::protocol::T_LIST) {
+          {
+            this->responses.clear();
+            uint32_t _size368;
+            ::apache::thrift::protocol::TType _etype371;
+            xfer += iprot->readListBegin(_etype371, _size368);
+            this->responses.resize(_size368);
+            uint32_t _i372;
+            for (_i372 = 0; _i372 < _size368; ++_i372)
+            {
+              xfer += this->responses[_i372].read(iprot);
+            }
+            xfer += iprot->readListEnd();
+          }
+          this->__isset.responses = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t BatchSelectResponse::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+  xfer += oprot->writeStructBegin("BatchSelectResponse");
+
+  xfer += oprot->writeFieldBegin("error_code", ::apache::thrift::protocol::T_I64, 1);
+  xfer += oprot->writeI64(this->error_code);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("error_msg", ::apache::thrift::protocol::T_STRING, 2);
+  xfer += oprot->writeString(this->error_msg);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("responses", ::apache::thrift::protocol::T_LIST, 3);
+  {
+    xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT, static_cast<uint32_t>(this->responses.size()));
+    std::vector<SelectResponse> ::const_iterator _iter373;
+    for (_iter373 = this->responses.begin(); _iter373 != this->responses.end(); ++_iter373)
+    {
+      xfer += (*_iter373).write(oprot);
+    }
+    xfer += oprot->writeListEnd();
+  }
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+void swap(BatchSelectResponse &a, BatchSelectResponse &b) {
+  using ::std::swap;
+  swap(a.error_code, b.error_code);
+  swap(a.error_msg, b.error_msg);
+  swap(a.responses, b.responses);
+  swap(a.__isset, b.__isset);
+}
+
+BatchSelectResponse::BatchSelectResponse(const BatchSelectResponse& other362) {
+  error_code = other362.error_code;
+  error_msg = other362.error_msg;
+  responses = other362.responses;
+  __isset = other362.__isset;
+}
+BatchSelectResponse& BatchSelectResponse::operator=(const BatchSelectResponse& other363) {
+  error_code = other363.error_code;
+  error_msg = other363.error_msg;
+  responses = other363.responses;
+  __isset = other363.__isset;
+  return *this;
+}
+void BatchSelectResponse::printTo(std::ostream& out) const {
+  using ::apache::thrift::to_string;
+  out << "BatchSelectResponse(";
+  out << "error_code=" << to_string(error_code);
+  out << ", " << "error_msg=" << to_string(error_msg);
+  out << ", " << "responses=" << to_string(responses);
+  out << ")";
+}
+
+
+CursorRequest::~CursorRequest() noexcept {
+}
+
+
+void CursorRequest::__set_session_id(const int64_t val) {
+  this->session_id = val;
+}
+
+void CursorRequest::__set_cursor_id(const int64_t val) {
+  this->cursor_id = val;
+}
+
+void CursorRequest::__set_block_count(const int64_t val) {
+  this->block_count = val;
+}
+std::ostream& operator<<(std::ostream& out, const CursorRequest& obj)
+{
+  obj.printTo(out);
+  return out;
+}
+
+
+uint32_t CursorRequest::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->session_id);
+          this->__isset.session_id = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->cursor_id);
+          this->__isset.cursor_id = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 3:
+        if (ftype == ::apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->block_count);
+          this->__isset.block_count = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t CursorRequest::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+  xfer += oprot->writeStructBegin("CursorRequest");
+
+  xfer += oprot->writeFieldBegin("session_id", ::apache::thrift::protocol::T_I64, 1);
+  xfer += oprot->writeI64(this->session_id);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("cursor_id", ::apache::thrift::protocol::T_I64, 2);
+  xfer += oprot->writeI64(this->cursor_id);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("block_count", ::apache::thrift::protocol::T_I64, 3);
+  xfer += oprot->writeI64(this->block_count);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+void swap(CursorRequest &a, CursorRequest &b) {
+  using ::std::swap;
+  swap(a.session_id, b.session_id);
+  swap(a.cursor_id, b.cursor_id);
+  swap(a.block_count, b.block_count);
+  swap(a.__isset, b.__isset);
+}
+
+CursorRequest::CursorRequest(const CursorRequest& other358) {
+  session_id = other358.session_id;
+  cursor_id = other358.cursor_id;
+  block_count = other358.block_count;
+  __isset = other358.__isset;
+}
+CursorRequest& CursorRequest::operator=(const CursorRequest& other359) {
+  session_id = other359.session_id;
+  cursor_id = other359.cursor_id;
+  block_count = other359.block_count;
+  __isset = other359.__isset;
+  return *this;
+}
+void CursorRequest::printTo(std::ostream& out) const {
+  using ::apache::thrift::to_string;
+  out << "CursorRequest(";
+  out << "session_id=" << to_string(session_id);
+  out << ", " << "cursor_id=" << to_string(cursor_id);
+  out << ", " << "block_count=" << to_string(block_count);
   out << ")";
 }
 
@@ -142,7 +142,9 @@ struct CopyFileType {
     CSV = 0,
     JSON = 1,
     JSONL = 2,
-    FVECS = 3
+    FVECS = 3,
+    PARQUET = 4,
+    ARROW = 5
   };
 };
 
@@ -152,6 +154,19 @@ std::ostream& operator<<(std::ostream& out, const CopyFileType::type& val);
 
 std::string to_string(const CopyFileType::type& val);
 
+struct CompressionType {
+  enum type {
+    NoCompression = 0,
+    LZ4 = 1
+  };
+};
+
+extern const std::map<int, const char*> _CompressionType_VALUES_TO_NAMES;
+
+std::ostream& operator<<(std::ostream& out, const CompressionType::type& val);
+
+std::string to_string(const CompressionType::type& val);
+
 struct ColumnType {
   enum type {
     ColumnBool = 0,
@@ -311,6 +326,8 @@ class DropTableRequest;
 
 class InsertRequest;
 
+class InsertColumnarRequest;
+
 class ImportRequest;
 
 class FileChunk;
@@ -323,6 +340,12 @@ class SelectRequest;
 
 class SelectResponse;
 
+class BatchSelectRequest;
+
+class BatchSelectResponse;
+
+class CursorRequest;
+
 class DeleteRequest;
 
 class UpdateRequest;
@@ -1315,10 +1338,11 @@ void swap(FusionExpr &a, FusionExpr &b);
 std::ostream& operator<<(std::ostream& out, const FusionExpr& obj);
 
 typedef struct _SearchExpr__isset {
-  _SearchExpr__isset() : match_exprs(false), knn_exprs(false), fusion_expr(false) {}
+  _SearchExpr__isset() : match_exprs(false), knn_exprs(false), fusion_expr(false), rerank_expr(false) {}
   bool match_exprs :1;
   bool knn_exprs :1;
   bool fusion_expr :1;
+  bool rerank_expr :1;
 } _SearchExpr__isset;
 
 class SearchExpr : public virtual ::apache::thrift::TBase {
@@ -1333,6 +1357,7 @@ class SearchExpr : public virtual ::apache::thrift::TBase {
   std::vector<MatchExpr>  match_exprs;
   std::vector<KnnExpr>  knn_exprs;
   FusionExpr fusion_expr;
+  KnnExpr rerank_expr;
 
   _SearchExpr__isset __isset;
 
@@ -1342,6 +1367,8 @@ class SearchExpr : public virtual ::apache::thrift::TBase {
 
   void __set_fusion_expr(const FusionExpr& val);
 
+  void __set_rerank_expr(const KnnExpr& val);
+
   bool operator == (const SearchExpr & rhs) const
   {
     if (__isset.match_exprs != rhs.__isset.match_exprs)
@@ -1356,6 +1383,10 @@ class SearchExpr : public virtual ::apache::thrift::TBase {
       return false;
     else if (__isset.fusion_expr && !(fusion_expr == rhs.fusion_expr))
       return false;
+    if (__isset.rerank_expr != rhs.__isset.rerank_expr)
+      return false;
+    else if (__isset.rerank_expr && !(rerank_expr == rhs.rerank_expr))
+      return false;
     return true;
   }
   bool operator != (const SearchExpr &rhs) const {
@@ -3447,6 +3478,77 @@ void swap(InsertRequest &a, InsertRequest &b);
 
 std::ostream& operator<<(std::ostream& out, const InsertRequest& obj);
 
+typedef struct _InsertColumnarRequest__isset {
+  _InsertColumnarRequest__isset() : db_name(false), table_name(false), column_names(true), columns(true), session_id(false) {}
+  bool db_name :1;
+  bool table_name :1;
+  bool column_names :1;
+  bool columns :1;
+  bool session_id :1;
+} _InsertColumnarRequest__isset;
+
+class InsertColumnarRequest : public virtual ::apache::thrift::TBase {
+ public:
+
+  InsertColumnarRequest(const InsertColumnarRequest&);
+  InsertColumnarRequest& operator=(const InsertColumnarRequest&);
+  InsertColumnarRequest() noexcept
+                : db_name(),
+                  table_name(),
+                  session_id(0) {
+
+
+  }
+
+  virtual ~InsertColumnarRequest() noexcept;
+  std::string db_name;
+  std::string table_name;
+  std::vector<std::string>  column_names;
+  std::vector<ColumnField>  columns;
+  int64_t session_id;
+
+  _InsertColumnarRequest__isset __isset;
+
+  void __set_db_name(const std::string& val);
+
+  void __set_table_name(const std::string& val);
+
+  void __set_column_names(const std::vector<std::string> & val);
+
+  void __set_columns(const std::vector<ColumnField> & val);
+
+  void __set_session_id(const int64_t val);
+
+  bool operator == (const InsertColumnarRequest & rhs) const
+  {
+    if (!(db_name == rhs.db_name))
+      return false;
+    if (!(table_name == rhs.table_name))
+      return false;
+    if (!(column_names == rhs.column_names))
+      return false;
+    if (!(columns == rhs.columns))
+      return false;
+    if (!(session_id == rhs.session_id))
+      return false;
+    return true;
+  }
+  bool operator != (const InsertColumnarRequest &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const InsertColumnarRequest & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot) override;
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const override;
+
+  virtual void printTo(std::ostream& out) const;
+};
+
+void swap(InsertColumnarRequest &a, InsertColumnarRequest &b);
+
+std::ostream& operator<<(std::ostream& out, const InsertColumnarRequest& obj);
+
 typedef struct _ImportRequest__isset {
   _ImportRequest__isset() : db_name(false), table_name(false), file_name(false), file_content(false), import_option(false), session_id(false) {}
   bool db_name :1;
@@ -3525,7 +3627,7 @@ void swap(ImportRequest &a, ImportRequest &b);
 std::ostream& operator<<(std::ostream& out, const ImportRequest& obj);
 
 typedef struct _FileChunk__isset {
-  _FileChunk__isset() : db_name(false), table_name(false), file_name(false), data(false), index(false), is_last(false), session_id(false), total_size(false) {}
+  _FileChunk__isset() : db_name(false), table_name(false), file_name(false), data(false), index(false), is_last(false), session_id(false), total_size(false), compression(false) {}
   bool db_name :1;
   bool table_name :1;
   bool file_name :1;
@@ -3534,6 +3636,7 @@ typedef struct _FileChunk__isset {
   bool is_last :1;
   bool session_id :1;
   bool total_size :1;
+  bool compression :1;
 } _FileChunk__isset;
 
 class FileChunk : public virtual ::apache::thrift::TBase {
@@ -3549,7 +3652,8 @@ class FileChunk : public virtual ::apache::thrift::TBase {
               index(0),
               is_last(0),
               session_id(0),
-              total_size(0) {
+              total_size(0),
+              compression(static_cast<CompressionType::type>(0)) {
   }
 
   virtual ~FileChunk() noexcept;
@@ -3561,6 +3665,7 @@ class FileChunk : public virtual ::apache::thrift::TBase {
   bool is_last;
   int64_t session_id;
   int64_t total_size;
+  CompressionType::type compression;
 
   _FileChunk__isset __isset;
 
@@ -3580,6 +3685,8 @@ class FileChunk : public virtual ::apache::thrift::TBase {
 
   void __set_total_size(const int64_t val);
 
+  void __set_compression(const CompressionType::type val);
+
   bool operator == (const FileChunk & rhs) const
   {
     if (!(db_name == rhs.db_name))
@@ -3598,6 +3705,8 @@ class FileChunk : public virtual ::apache::thrift::TBase {
       return false;
     if (!(total_size == rhs.total_size))
       return false;
+    if (!(compression == rhs.compression))
+      return false;
     return true;
   }
   bool operator != (const FileChunk &rhs) const {
@@ -3814,7 +3923,7 @@ void swap(ExplainResponse &a, ExplainResponse &b);
 std::ostream& operator<<(std::ostream& out, const ExplainResponse& obj);
 
 typedef struct _SelectRequest__isset {
-  _SelectRequest__isset() : session_id(false), db_name(false), table_name(false), select_list(true), search_expr(false), where_expr(false), group_by_list(true), having_expr(false), limit_expr(false), offset_expr(false), order_by_list(true) {}
+  _SelectRequest__isset() : session_id(false), db_name(false), table_name(false), select_list(true), search_expr(false), where_expr(false), group_by_list(true), having_expr(false), limit_expr(false), offset_expr(false), order_by_list(true), arrow_layout(false), compression(false) {}
   bool session_id :1;
   bool db_name :1;
   bool table_name :1;
@@ -3826,6 +3935,8 @@ typedef struct _SelectRequest__isset {
   bool limit_expr :1;
   bool offset_expr :1;
   bool order_by_list :1;
+  bool arrow_layout :1;
+  bool compression :1;
 } _SelectRequest__isset;
 
 class SelectRequest : public virtual ::apache::thrift::TBase {
@@ -3836,7 +3947,9 @@ class SelectRequest : public virtual ::apache::thrift::TBase {
   SelectRequest() noexcept
                 : session_id(0),
                   db_name(),
-                  table_name() {
+                  table_name(),
+                  arrow_layout(false),
+                  compression(static_cast<CompressionType::type>(0)) {
 
 
 
@@ -3854,6 +3967,8 @@ class SelectRequest : public virtual ::apache::thrift::TBase {
   ParsedExpr limit_expr;
   ParsedExpr offset_expr;
   std::vector<OrderByExpr>  order_by_list;
+  bool arrow_layout;
+  CompressionType::type compression;
 
   _SelectRequest__isset __isset;
 
@@ -3879,6 +3994,10 @@ class SelectRequest : public virtual ::apache::thrift::TBase {
 
   void __set_order_by_list(const std::vector<OrderByExpr> & val);
 
+  void __set_arrow_layout(const bool val);
+
+  void __set_compression(const CompressionType::type val);
+
   bool operator == (const SelectRequest & rhs) const
   {
     if (!(session_id == rhs.session_id))
@@ -3917,6 +4036,10 @@ class SelectRequest : public virtual ::apache::thrift::TBase {
       return false;
     else if (__isset.order_by_list && !(order_by_list == rhs.order_by_list))
       return false;
+    if (!(arrow_layout == rhs.arrow_layout))
+      return false;
+    if (!(compression == rhs.compression))
+      return false;
     return true;
   }
   bool operator != (const SelectRequest &rhs) const {
@@ -3936,11 +4059,13 @@ void swap(SelectRequest &a, SelectRequest &b);
 std::ostream& operator<<(std::ostream& out, const SelectRequest& obj);
 
 typedef struct _SelectResponse__isset {
-  _SelectResponse__isset() : error_code(false), error_msg(false), column_defs(true), column_fields(true) {}
+  _SelectResponse__isset() : error_code(false), error_msg(false), column_defs(true), column_fields(true), cursor_id(false), compression(false) {}
   bool error_code :1;
   bool error_msg :1;
   bool column_defs :1;
   bool column_fields :1;
+  bool cursor_id :1;
+  bool compression :1;
 } _SelectResponse__isset;
 
 class SelectResponse : public virtual ::apache::thrift::TBase {
@@ -3950,7 +4075,9 @@ class SelectResponse : public virtual ::apache::thrift::TBase {
   SelectResponse& operator=(const SelectResponse&);
   SelectResponse() noexcept
                  : error_code(0),
-                   error_msg() {
+                   error_msg(),
+                   cursor_id(0),
+                   compression(static_cast<CompressionType::type>(0)) {
 
 
   }
@@ -3960,6 +4087,8 @@ class SelectResponse : public virtual ::apache::thrift::TBase {
   std::string error_msg;
   std::vector<ColumnDef>  column_defs;
   std::vector<ColumnField>  column_fields;
+  int64_t cursor_id;
+  CompressionType::type compression;
 
   _SelectResponse__isset __isset;
 
@@ -3971,6 +4100,10 @@ class SelectResponse : public virtual ::apache::thrift::TBase {
 
   void __set_column_fields(const std::vector<ColumnField> & val);
 
+  void __set_cursor_id(const int64_t val);
+
+  void __set_compression(const CompressionType::type val);
+
   bool operator == (const SelectResponse & rhs) const
   {
     if (!(error_code == rhs.error_code))
@@ -3981,6 +4114,10 @@ class SelectResponse : public virtual ::apache::thrift::TBase {
       return false;
     if (!(column_fields == rhs.column_fields))
       return false;
+    if (!(cursor_id == rhs.cursor_id))
+      return false;
+    if (!(compression == rhs.compression))
+      return false;
     return true;
   }
   bool operator != (const SelectResponse &rhs) const {
@@ -3999,6 +4136,168 @@ void swap(SelectResponse &a, SelectResponse &b);
 
 std::ostream& operator<<(std::ostream& out, const SelectResponse& obj);
 
+typedef struct _BatchSelectRequest__isset {
+  _BatchSelectRequest__isset() : session_id(false), requests(false) {}
+  bool session_id :1;
+  bool requests :1;
+} _BatchSelectRequest__isset;
+
+class BatchSelectRequest : public virtual ::apache::thrift::TBase {
+ public:
+
+  BatchSelectRequest(const BatchSelectRequest&);
+  BatchSelectRequest& operator=(const BatchSelectRequest&);
+  BatchSelectRequest() noexcept
+                     : session_id(0) {
+  }
+
+  virtual ~BatchSelectRequest() noexcept;
+  int64_t session_id;
+  std::vector<SelectRequest>  requests;
+
+  _BatchSelectRequest__isset __isset;
+
+  void __set_session_id(const int64_t val);
+
+  void __set_requests(const std::vector<SelectRequest> & val);
+
+  bool operator == (const BatchSelectRequest & rhs) const
+  {
+    if (!(session_id == rhs.session_id))
+      return false;
+    if (!(requests == rhs.requests))
+      return false;
+    return true;
+  }
+  bool operator != (const BatchSelectRequest &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const BatchSelectRequest & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot) override;
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const override;
+
+  virtual void printTo(std::ostream& out) const;
+};
+
+void swap(BatchSelectRequest &a, BatchSelectRequest &b);
+
+std::ostream& operator<<(std::ostream& out, const BatchSelectRequest& obj);
+
+typedef struct _BatchSelectResponse__isset {
+  _BatchSelectResponse__isset() : error_code(false), error_msg(false), responses(false) {}
+  bool error_code :1;
+  bool error_msg :1;
+  bool responses :1;
+} _BatchSelectResponse__isset;
+
+class BatchSelectResponse : public virtual ::apache::thrift::TBase {
+ public:
+
+  BatchSelectResponse(const BatchSelectResponse&);
+  BatchSelectResponse& operator=(const BatchSelectResponse&);
+  BatchSelectResponse() noexcept
+                      : error_code(0),
+                        error_msg() {
+  }
+
+  virtual ~BatchSelectResponse() noexcept;
+  int64_t error_code;
+  std::string error_msg;
+  std::vector<SelectResponse>  responses;
+
+  _BatchSelectResponse__isset __isset;
+
+  void __set_error_code(const int64_t val);
+
+  void __set_error_msg(const std::string& val);
+
+  void __set_responses(const std::vector<SelectResponse> & val);
+
+  bool operator == (const BatchSelectResponse & rhs) const
+  {
+    if (!(error_code == rhs.error_code))
+      return false;
+    if (!(error_msg == rhs.error_msg))
+      return false;
+    if (!(responses == rhs.responses))
+      return false;
+    return true;
+  }
+  bool operator != (const BatchSelectResponse &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const BatchSelectResponse & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot) override;
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const override;
+
+  virtual void printTo(std::ostream& out) const;
+};
+
+void swap(BatchSelectResponse &a, BatchSelectResponse &b);
+
+std::ostream& operator<<(std::ostream& out, const BatchSelectResponse& obj);
+
+typedef struct _CursorRequest__isset {
+  _CursorRequest__isset() : session_id(false), cursor_id(false), block_count(false) {}
+  bool session_id :1;
+  bool cursor_id :1;
+  bool block_count :1;
+} _CursorRequest__isset;
+
+class CursorRequest : public virtual ::apache::thrift::TBase {
+ public:
+
+  CursorRequest(const CursorRequest&);
+  CursorRequest& operator=(const CursorRequest&);
+  CursorRequest() noexcept
+                : session_id(0),
+                  cursor_id(0),
+                  block_count(0) {
+  }
+
+  virtual ~CursorRequest() noexcept;
+  int64_t session_id;
+  int64_t cursor_id;
+  int64_t block_count;
+
+  _CursorRequest__isset __isset;
+
+  void __set_session_id(const int64_t val);
+
+  void __set_cursor_id(const int64_t val);
+
+  void __set_block_count(const int64_t val);
+
+  bool operator == (const CursorRequest & rhs) const
+  {
+    if (!(session_id == rhs.session_id))
+      return false;
+    if (!(cursor_id == rhs.cursor_id))
+      return false;
+    if (!(block_count == rhs.block_count))
+      return false;
+    return true;
+  }
+  bool operator != (const CursorRequest &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const CursorRequest & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot) override;
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const override;
+
+  virtual void printTo(std::ostream& out) const;
+};
+
+void swap(CursorRequest &a, CursorRequest &b);
+
+std::ostream& operator<<(std::ostream& out, const CursorRequest& obj);
+
 typedef struct _DeleteRequest__isset {
   _DeleteRequest__isset() : db_name(false), table_name(false), where_expr(false), session_id(false) {}
   bool db_name :1;
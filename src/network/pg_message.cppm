@@ -40,6 +40,11 @@ enum class PGMessageType : unsigned char {
     kRowDescription = 'T',
     kData = 'D',
     kComplete = 'C',
+    kParseComplete = '1',
+    kBindComplete = '2',
+    kCloseComplete = '3',
+    kNoData = 'n',
+    kParameterDescription = 't',
 
     // Errors
     kHumanReadableError = 'M',
@@ -60,6 +65,27 @@ enum class PGMessageType : unsigned char {
     kCloseCommand = 'C',
 };
 
+// The kind of the target of a Describe or Close
+enum class PGDescribeType : unsigned char {
+    kStatement = 'S',
+    kPortal = 'P',
+};
+
+// Parse of the extended query protocol, https://www.postgresql.org/docs/14/protocol-flow.html#PROTOCOL-FLOW-EXT-QUERY
+struct PGParseMessage {
+    String statement_name_{};
+    String query_{};
+    // type oid of each parameter, 0 if unspecified
+    Vector<u32> parameter_types_{};
+};
+
+struct PGBindMessage {
+    String portal_name_{};
+    String statement_name_{};
+    // text format values, None for null
+    Vector<Optional<String>> parameter_values_{};
+};
+
 enum class TransactionStateType : unsigned char {
     kIDLE = 'I',  // Not in a transaction block
     kBlock = 'T', // In a transaction block
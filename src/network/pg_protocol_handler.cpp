@@ -14,13 +14,74 @@
 
 module;
 
+#include <arpa/inet.h>
+
 import boost;
 import stl;
 import pg_message;
+import infinity_exception;
+import third_party;
 module pg_protocol_handler;
 
 namespace infinity {
 
+namespace {
+
+// Reads the fields of a message body received as a whole.
+class MessageBodyReader {
+public:
+    explicit MessageBodyReader(const String &body) : body_(body) {}
+
+    u16 ReadU16() {
+        u16 network_value{0};
+        ReadBytes(reinterpret_cast<char *>(&network_value), sizeof(u16));
+        return ntohs(network_value);
+    }
+
+    u32 ReadU32() {
+        u32 network_value{0};
+        ReadBytes(reinterpret_cast<char *>(&network_value), sizeof(u32));
+        return ntohl(network_value);
+    }
+
+    i32 ReadI32() { return static_cast<i32>(ReadU32()); }
+
+    String ReadString() {
+        SizeT end_pos = body_.find(NULL_END, pos_);
+        if (end_pos == String::npos) {
+            UnrecoverableError("Last character isn't null.");
+        }
+        String result = body_.substr(pos_, end_pos - pos_);
+        pos_ = end_pos + 1;
+        return result;
+    }
+
+    String ReadString(SizeT length) {
+        CheckRemaining(length);
+        String result = body_.substr(pos_, length);
+        pos_ += length;
+        return result;
+    }
+
+private:
+    void ReadBytes(char *dst, SizeT length) {
+        CheckRemaining(length);
+        std::memcpy(dst, body_.data() + pos_, length);
+        pos_ += length;
+    }
+
+    void CheckRemaining(SizeT length) const {
+        if (pos_ + length > body_.size()) {
+            UnrecoverableError(fmt::format("Message body of {} bytes is too short.", body_.size()));
+        }
+    }
+
+    const String &body_;
+    SizeT pos_{0};
+};
+
+} // namespace
+
 PGProtocolHandler::PGProtocolHandler(const SharedPtr<boost::asio::ip::tcp::socket> &socket) : buffer_reader_(socket), buffer_writer_(socket) {}
 
 u32 PGProtocolHandler::read_startup_header() {
@@ -77,6 +138,86 @@ String PGProtocolHandler::read_command_body() {
     return buffer_reader_.read_string(command_length);
 }
 
+PGParseMessage PGProtocolHandler::read_parse_body() {
+    const auto body_length = buffer_reader_.read_value_u32() - LENGTH_FIELD_SIZE;
+    const String body = buffer_reader_.read_string(body_length, NullTerminator::kNo);
+    MessageBodyReader reader(body);
+
+    PGParseMessage message;
+    message.statement_name_ = reader.ReadString();
+    message.query_ = reader.ReadString();
+    u16 parameter_count = reader.ReadU16();
+    message.parameter_types_.reserve(parameter_count);
+    for (u16 idx = 0; idx < parameter_count; ++idx) {
+        message.parameter_types_.emplace_back(reader.ReadU32());
+    }
+    return message;
+}
+
+PGBindMessage PGProtocolHandler::read_bind_body() {
+    const auto body_length = buffer_reader_.read_value_u32() - LENGTH_FIELD_SIZE;
+    const String body = buffer_reader_.read_string(body_length, NullTerminator::kNo);
+    MessageBodyReader reader(body);
+
+    PGBindMessage message;
+    message.portal_name_ = reader.ReadString();
+    message.statement_name_ = reader.ReadString();
+    u16 format_count = reader.ReadU16();
+    for (u16 idx = 0; idx < format_count; ++idx) {
+        if (reader.ReadU16() != 0) {
+            UnrecoverableError("Only the text format of parameters is supported.");
+        }
+    }
+    u16 parameter_count = reader.ReadU16();
+    message.parameter_values_.reserve(parameter_count);
+    for (u16 idx = 0; idx < parameter_count; ++idx) {
+        i32 value_length = reader.ReadI32();
+        if (value_length < 0) {
+            message.parameter_values_.emplace_back(None);
+        } else {
+            message.parameter_values_.emplace_back(reader.ReadString(value_length));
+        }
+    }
+    // The formats of the result columns follow, the rows are always sent in text format.
+    return message;
+}
+
+Pair<PGDescribeType, String> PGProtocolHandler::read_describe_body() {
+    const auto body_length = buffer_reader_.read_value_u32() - LENGTH_FIELD_SIZE;
+    const String body = buffer_reader_.read_string(body_length, NullTerminator::kNo);
+    MessageBodyReader reader(body);
+
+    const String describe_type = reader.ReadString(sizeof(u8));
+    return {static_cast<PGDescribeType>(describe_type[0]), reader.ReadString()};
+}
+
+String PGProtocolHandler::read_execute_body() {
+    const auto body_length = buffer_reader_.read_value_u32() - LENGTH_FIELD_SIZE;
+    const String body = buffer_reader_.read_string(body_length, NullTerminator::kNo);
+    MessageBodyReader reader(body);
+
+    return reader.ReadString();
+}
+
+void PGProtocolHandler::skip_command_body() {
+    const auto body_length = buffer_reader_.read_value_u32() - LENGTH_FIELD_SIZE;
+    buffer_reader_.read_string(body_length, NullTerminator::kNo);
+}
+
+void PGProtocolHandler::send_message(PGMessageType message_type) {
+    buffer_writer_.send_value_u8(static_cast<u8>(message_type));
+    buffer_writer_.send_value_u32(LENGTH_FIELD_SIZE);
+}
+
+void PGProtocolHandler::send_parameter_description(const Vector<u32> &parameter_types) {
+    buffer_writer_.send_value_u8(static_cast<u8>(PGMessageType::kParameterDescription));
+    buffer_writer_.send_value_u32(LENGTH_FIELD_SIZE + sizeof(u16) + parameter_types.size() * sizeof(u32));
+    buffer_writer_.send_value_u16(parameter_types.size());
+    for (u32 parameter_type : parameter_types) {
+        buffer_writer_.send_value_u32(parameter_type);
+    }
+}
+
 void PGProtocolHandler::send_error_response(const HashMap<PGMessageType, String> &error_response_map) {
     // message header
     buffer_writer_.send_value_u8(static_cast<u8>(PGMessageType::kError));
@@ -37,10 +37,33 @@ public:
 
     void send_ready_for_query();
 
+    // Bytes of the next message are already received, no need to wait for the socket.
+    [[nodiscard]] inline bool has_buffered_data() const { return buffer_reader_.size() > 0; }
+
     PGMessageType read_command_type();
 
     String read_command_body();
 
+    PGParseMessage read_parse_body();
+
+    PGBindMessage read_bind_body();
+
+    // The body of a Describe or a Close
+    Pair<PGDescribeType, String> read_describe_body();
+
+    // The portal name of an Execute, the row limit is ignored and all rows are sent.
+    String read_execute_body();
+
+    // Discard a message, as those after an error of the extended query protocol until Sync.
+    void skip_command_body();
+
+    // A message without body, as ParseComplete or NoData
+    void send_message(PGMessageType message_type);
+
+    void send_parameter_description(const Vector<u32> &parameter_types);
+
+    void flush() { buffer_writer_.flush(); }
+
     void send_error_response(const HashMap<PGMessageType, String> &error_response_map);
     //
     //    String read_query_packet();
@@ -14,6 +14,7 @@
 
 module;
 
+#include <boost/asio/ip/tcp.hpp>
 #include <boost/bind.hpp>
 #include <thread>
 
@@ -25,6 +26,7 @@ import stl;
 import boost;
 import third_party;
 import infinity_exception;
+import default_values;
 
 import connection;
 
@@ -48,25 +50,35 @@ void PGServer::Run() {
         return ;
     }
 
+    // At most so many queries of the PG clients run at the same time, as for the thrift server.
+    query_thread_pool_ = MakeUnique<ThreadPool>(InfinityContext::instance().config()->connection_limit());
+
     acceptor_ptr_ = MakeUnique<boost::asio::ip::tcp::acceptor>(io_service_, boost::asio::ip::tcp::endpoint(address, pg_port));
     CreateConnection();
 
     fmt::print("Run 'psql -h {} -p {}' to connect to the server, only for test.\n", pg_listen_addr, pg_port);
 
+    for (SizeT i = 1; i < PG_IO_THREAD_COUNT; ++i) {
+        io_threads_.emplace_back([this]() { io_service_.run(); });
+    }
     io_service_.run();
+    for (auto &io_thread : io_threads_) {
+        io_thread.join();
+    }
 }
 
 void PGServer::Shutdown() {
 
     initialized_ = false;
 
-    while (running_connection_count_ > 0) {
-        // Running connection exists.
+    while (running_request_count_ > 0) {
+        // Running request exists.
         std::this_thread::yield();
     }
 
     io_service_.stop();
     acceptor_ptr_->close();
+    query_thread_pool_->stop(true);
 }
 
 void PGServer::CreateConnection() {
@@ -75,19 +87,40 @@ void PGServer::CreateConnection() {
 }
 
 void PGServer::StartConnection(SharedPtr<Connection> &connection) {
-    Thread connection_thread([connection = connection, &num_running_connections = this->running_connection_count_, initialized = this->initialized_]() mutable {
-        if(initialized) {
-            ++num_running_connections;
-            connection->Run();
-
-            // User disconnected
-            connection.reset();
-            --num_running_connections;
+    if (initialized_) {
+        connection->Init();
+        WaitForMessage(connection);
+    }
+    CreateConnection();
+}
+
+void PGServer::WaitForMessage(SharedPtr<Connection> connection) {
+    if (connection->HasBufferedMessage()) {
+        // The client sent the next message along with the last one.
+        HandleMessage(std::move(connection));
+        return;
+    }
+    SharedPtr<boost::asio::ip::tcp::socket> socket = connection->socket();
+    socket->async_wait(boost::asio::ip::tcp::socket::wait_read, [this, connection = std::move(connection)](const boost::system::error_code &error) {
+        if (error || !initialized_) {
+            // The connection is released with the last handler holding it.
+            return;
         }
+        HandleMessage(connection);
     });
+}
 
-    connection_thread.detach();
-    CreateConnection();
+void PGServer::HandleMessage(SharedPtr<Connection> connection) {
+    ++running_request_count_;
+    query_thread_pool_->push([this, connection = std::move(connection)](int) mutable {
+        // Only one message of a connection is handled at a time, the next wait starts after it.
+        if (connection->HandleMessage() && initialized_) {
+            WaitForMessage(std::move(connection));
+        }
+        // The connection is closed once no handler holds it.
+        connection.reset();
+        --running_request_count_;
+    });
 }
 
 } // namespace infinity
@@ -27,6 +27,8 @@ export struct StartupParameter {
     SharedPtr<String> config_path{};
 };
 
+// The sockets are served by the PG_IO_THREAD_COUNT threads of io_service_, which only wait for them to become readable. The
+// message is then handled and its query run on a thread of query_thread_pool_, so an idle connection takes no thread.
 export class PGServer {
 public:
     void Run();
@@ -38,10 +40,16 @@ private:
 
     void StartConnection(SharedPtr<Connection> &connection);
 
-    bool initialized_{false};
-    atomic_u64 running_connection_count_{0};
+    void WaitForMessage(SharedPtr<Connection> connection);
+
+    void HandleMessage(SharedPtr<Connection> connection);
+
+    atomic_bool initialized_{false};
+    atomic_u64 running_request_count_{0};
     boost::asio::io_service io_service_{};
     UniquePtr<boost::asio::ip::tcp::acceptor> acceptor_ptr_{};
+    Vector<Thread> io_threads_{};
+    UniquePtr<ThreadPool> query_thread_pool_{};
 };
 
 }
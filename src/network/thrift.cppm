@@ -19,11 +19,14 @@ module;
 #include <thrift/server/TThreadedServer.h>
 #include <thrift/transport/TSocket.h>
 #include <thrift/transport/TBufferTransports.h>
+#include <thrift/TProcessor.h>
 
 export module thrift;
 
 export namespace apache {
     namespace thrift {
+        using apache::thrift::TProcessor;
+
         namespace concurrency {
             using apache::thrift::concurrency::Thread;
             using apache::thrift::concurrency::ThreadFactory;
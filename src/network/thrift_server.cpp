@@ -14,6 +14,12 @@
 
 module;
 
+#include <arpa/inet.h>
+#include <boost/asio/buffer.hpp>
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/read.hpp>
+#include <boost/asio/write.hpp>
+#include <lz4.h>
 #include <memory>
 #include <thrift/TToString.h>
 #include <thrift/concurrency/ThreadFactory.h>
@@ -47,6 +53,7 @@ import third_party;
 
 import file_writer;
 import table_def;
+import data_table;
 import file_system_type;
 import file_system;
 import local_file_system;
@@ -312,6 +319,38 @@ public:
         ProcessQueryResult(response, result);
     }
 
+    void InsertColumnar(infinity_thrift_rpc::CommonResponse &response, const infinity_thrift_rpc::InsertColumnarRequest &request) final {
+        auto [infinity, infinity_status] = GetInfinityBySessionID(request.session_id);
+        if (!infinity_status.ok()) {
+            ProcessStatus(response, infinity_status);
+            return;
+        }
+
+        if (request.columns.empty()) {
+            ProcessStatus(response, Status::InsertWithoutValues());
+            return;
+        }
+
+        Vector<String> *columns = nullptr;
+        if (!request.column_names.empty()) {
+            columns = new Vector<String>(request.column_names.begin(), request.column_names.end());
+        }
+
+        // The column data is used in place, it lives as long as the request.
+        Vector<Vector<std::string_view>> column_data;
+        column_data.reserve(request.columns.size());
+        for (auto &column_field : request.columns) {
+            auto &chunks = column_data.emplace_back();
+            chunks.reserve(column_field.column_vectors.size());
+            for (auto &column_vector : column_field.column_vectors) {
+                chunks.emplace_back(column_vector);
+            }
+        }
+
+        auto result = infinity->InsertColumnar(request.db_name, request.table_name, columns, std::move(column_data));
+        ProcessQueryResult(response, result);
+    }
+
     Tuple<CopyFileType, Status> GetCopyFileType(infinity_thrift_rpc::CopyFileType::type copy_file_type) {
         switch (copy_file_type) {
             case infinity_thrift_rpc::CopyFileType::CSV:
@@ -322,6 +361,10 @@ public:
                 return {CopyFileType::kJSONL, Status::OK()};
             case infinity_thrift_rpc::CopyFileType::FVECS:
                 return {CopyFileType::kFVECS, Status::OK()};
+            case infinity_thrift_rpc::CopyFileType::PARQUET:
+                return {CopyFileType::kPARQUET, Status::OK()};
+            case infinity_thrift_rpc::CopyFileType::ARROW:
+                return {CopyFileType::kARROW, Status::OK()};
             default: {
                 return {CopyFileType::kInvalid, Status::ImportFileFormatError("Not implemented yet")};
             }
@@ -359,6 +402,18 @@ public:
     }
 
     void UploadFileChunk(infinity_thrift_rpc::UploadResponse &response, const infinity_thrift_rpc::FileChunk &request) final {
+        // Each chunk is appended to the file once it arrives, the client sends the next one after the response.
+        String decompressed_data;
+        const String *data = &request.data;
+        if (request.compression == infinity_thrift_rpc::CompressionType::LZ4) {
+            Status status = DecompressBinary(request.data, decompressed_data);
+            if (!status.ok()) {
+                ProcessStatus(response, status);
+                return;
+            }
+            data = &decompressed_data;
+        }
+
         LocalFileSystem fs;
         Path path(fmt::format("{}_{}_{}_{}",
                               *InfinityContext::instance().config()->temp_dir().get(),
@@ -366,8 +421,8 @@ public:
                               request.table_name,
                               request.file_name));
         if (request.index != 0) {
-            FileWriter file_writer(fs, path.c_str(), request.data.size(), FileFlags::WRITE_FLAG | FileFlags::APPEND_FLAG);
-            file_writer.Write(request.data.data(), request.data.size());
+            FileWriter file_writer(fs, path.c_str(), data->size(), FileFlags::WRITE_FLAG | FileFlags::APPEND_FLAG);
+            file_writer.Write(data->data(), data->size());
             file_writer.Flush();
         } else {
             // Check file exist
@@ -382,8 +437,8 @@ public:
                     return;
                 }
             }
-            FileWriter file_writer(fs, path.c_str(), request.data.size());
-            file_writer.Write(request.data.data(), request.data.size());
+            FileWriter file_writer(fs, path.c_str(), data->size());
+            file_writer.Write(data->data(), data->size());
             file_writer.Flush();
         }
         response.__set_error_code((i64)(ErrorCode::kOk));
@@ -407,143 +462,12 @@ public:
         //
         // auto start2 = std::chrono::steady_clock::now();
 
-        // select list
-        if (request.__isset.select_list == false or request.select_list.empty()) {
-            ProcessStatus(response, Status::EmptySelectFields());
-            return;
-        }
-
-        Vector<ParsedExpr *> *output_columns = new Vector<ParsedExpr *>();
-        output_columns->reserve(request.select_list.size());
-
-        Status parsed_expr_status;
-        for (auto &expr : request.select_list) {
-            auto parsed_expr = GetParsedExprFromProto(parsed_expr_status, expr);
-            if (!parsed_expr_status.ok()) {
-
-                if (output_columns != nullptr) {
-                    for (auto &expr_ptr : *output_columns) {
-                        delete expr_ptr;
-                    }
-                    delete output_columns;
-                    output_columns = nullptr;
-                }
-
-                if (parsed_expr != nullptr) {
-                    delete parsed_expr;
-                    parsed_expr = nullptr;
-                }
-
-                ProcessStatus(response, parsed_expr_status);
-                return;
-            }
-            output_columns->emplace_back(parsed_expr);
-        }
-
-        // search expr
-        SearchExpr *search_expr = nullptr;
-        if (request.__isset.search_expr) {
-            search_expr = new SearchExpr();
-            auto search_expr_list = new Vector<ParsedExpr *>();
-            SizeT knn_expr_count = request.search_expr.knn_exprs.size();
-            SizeT match_expr_count = request.search_expr.match_exprs.size();
-            bool fusion_expr_exists = request.search_expr.__isset.fusion_expr;
-            SizeT total_expr_count = knn_expr_count + match_expr_count + fusion_expr_exists;
-            search_expr_list->reserve(total_expr_count);
-            for (SizeT idx = 0; idx < knn_expr_count; ++idx) {
-                auto [knn_expr, knn_expr_status] = GetKnnExprFromProto(request.search_expr.knn_exprs[idx]);
-                if (!knn_expr_status.ok()) {
-
-                    if (output_columns != nullptr) {
-                        for (auto &expr_ptr : *output_columns) {
-                            delete expr_ptr;
-                        }
-                        delete output_columns;
-                        output_columns = nullptr;
-                    }
-
-                    if (search_expr_list != nullptr) {
-                        for (auto &expr_ptr : *search_expr_list) {
-                            delete expr_ptr;
-                        }
-                        delete search_expr_list;
-                        search_expr_list = nullptr;
-                    }
-
-                    if (knn_expr != nullptr) {
-                        delete knn_expr;
-                        knn_expr = nullptr;
-                    }
-
-                    if (search_expr != nullptr) {
-                        delete search_expr;
-                        search_expr = nullptr;
-                    }
-
-                    ProcessStatus(response, knn_expr_status);
-                    return;
-                }
-                search_expr_list->emplace_back(knn_expr);
-            }
-
-            for (SizeT idx = 0; idx < match_expr_count; ++idx) {
-                ParsedExpr *match_expr = GetMatchExprFromProto(request.search_expr.match_exprs[idx]);
-                search_expr_list->emplace_back(match_expr);
-            }
-
-            if (fusion_expr_exists) {
-                ParsedExpr *fusion_expr = GetFusionExprFromProto(request.search_expr.fusion_expr);
-                search_expr_list->emplace_back(fusion_expr);
-            }
-
-            search_expr->SetExprs(search_expr_list);
-        }
-
-        // filter
-        ParsedExpr *filter = nullptr;
-        if (request.__isset.where_expr == true) {
-            filter = GetParsedExprFromProto(parsed_expr_status, request.where_expr);
-            if (!parsed_expr_status.ok()) {
-
-                if (output_columns != nullptr) {
-                    for (auto &expr_ptr : *output_columns) {
-                        delete expr_ptr;
-                    }
-                    delete output_columns;
-                    output_columns = nullptr;
-                }
-
-                if (search_expr != nullptr) {
-                    delete search_expr;
-                    search_expr = nullptr;
-                }
-
-                if (filter != nullptr) {
-                    delete filter;
-                    filter = nullptr;
-                }
-
-                ProcessStatus(response, parsed_expr_status);
-                return;
-            }
-        }
-
-        // TODO:
-        //    ParsedExpr *offset;
-        // offset = new ParsedExpr();
-
-        // limit
-        //        ParsedExpr *limit = nullptr;
-        //        if (request.__isset.limit_expr == true) {
-        //            limit = GetParsedExprFromProto(request.limit_expr);
-        //        }
-
         // auto end2 = std::chrono::steady_clock::now();
         // phase_2_duration_ += end2 - start2;
         //
         // auto start3 = std::chrono::steady_clock::now();
 
-        const QueryResult result = infinity->Search(request.db_name, request.table_name, search_expr, filter, output_columns);
+        const QueryResult result = SelectQuery(infinity, request);
 
         // auto end3 = std::chrono::steady_clock::now();
         //
@@ -554,7 +478,8 @@ public:
         if (result.IsOk()) {
             auto &columns = response.column_fields;
             columns.resize(result.result_table_->ColumnCount());
-            ProcessDataBlocks(result, response, columns);
+            ProcessDataBlocks(result, response, columns, request.arrow_layout);
+            CompressColumns(response, request.compression);
         } else {
             ProcessQueryResult(response, result);
         }
@@ -583,6 +508,133 @@ public:
         // }
     }
 
+    void BatchSelect(infinity_thrift_rpc::BatchSelectResponse &response, const infinity_thrift_rpc::BatchSelectRequest &request) final {
+        auto [infinity, infinity_status] = GetInfinityBySessionID(request.session_id);
+        if (!infinity_status.ok()) {
+            ProcessStatus(response, infinity_status);
+            return;
+        }
+
+        // A request that can't be parsed gets its error, the others still run.
+        SizeT request_count = request.requests.size();
+        Vector<Status> parse_status(request_count);
+        Vector<SearchQuery> queries;
+        Vector<SizeT> query_request_idx;
+        for (SizeT idx = 0; idx < request_count; ++idx) {
+            SearchQuery query;
+            parse_status[idx] = ParseSelectRequest(request.requests[idx], query);
+            if (parse_status[idx].ok()) {
+                queries.emplace_back(std::move(query));
+                query_request_idx.emplace_back(idx);
+            }
+        }
+
+        Vector<QueryResult> results = infinity->BatchSearch(std::move(queries));
+
+        auto &responses = response.responses;
+        responses.resize(request_count);
+        for (SizeT idx = 0; idx < request_count; ++idx) {
+            if (!parse_status[idx].ok()) {
+                ProcessStatus(responses[idx], parse_status[idx]);
+            }
+        }
+        for (SizeT query_idx = 0; query_idx < results.size(); ++query_idx) {
+            const QueryResult &result = results[query_idx];
+            const auto &select_request = request.requests[query_request_idx[query_idx]];
+            auto &select_response = responses[query_request_idx[query_idx]];
+            if (result.IsOk()) {
+                auto &columns = select_response.column_fields;
+                columns.resize(result.result_table_->ColumnCount());
+                ProcessDataBlocks(result, select_response, columns, select_request.arrow_layout);
+                CompressColumns(select_response, select_request.compression);
+            } else {
+                ProcessQueryResult(select_response, result);
+            }
+        }
+        response.__isset.responses = true;
+        response.__set_error_code((i64)(ErrorCode::kOk));
+    }
+
+    void OpenCursor(infinity_thrift_rpc::SelectResponse &response, const infinity_thrift_rpc::SelectRequest &request) final {
+        auto [infinity, infinity_status] = GetInfinityBySessionID(request.session_id);
+        if (!infinity_status.ok()) {
+            ProcessStatus(response, infinity_status);
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(cursor_map_mutex_);
+            if (cursor_map_[request.session_id].size() >= MAX_SESSION_CURSOR_COUNT) {
+                ProcessStatus(response, Status::TooManyCursors(request.session_id, MAX_SESSION_CURSOR_COUNT));
+                return;
+            }
+        }
+
+        QueryResult result = SelectQuery(infinity, request);
+        if (!result.IsOk()) {
+            ProcessQueryResult(response, result);
+            return;
+        }
+
+        // Only the column definitions now, the blocks are converted when they are fetched.
+        SizeT column_count = result.result_table_->ColumnCount();
+        Vector<infinity_thrift_rpc::ColumnField> columns(column_count);
+        HandleColumnDef(response, column_count, result.result_table_->definition_ptr_, columns);
+
+        auto cursor = MakeShared<SelectCursor>();
+        cursor->result_table_ = std::move(result.result_table_);
+        cursor->arrow_layout_ = request.arrow_layout;
+        cursor->compression_ = request.compression;
+        std::lock_guard<std::mutex> lock(cursor_map_mutex_);
+        auto &session_cursors = cursor_map_[request.session_id];
+        if (session_cursors.size() >= MAX_SESSION_CURSOR_COUNT) {
+            ProcessStatus(response, Status::TooManyCursors(request.session_id, MAX_SESSION_CURSOR_COUNT));
+            return;
+        }
+        i64 cursor_id = next_cursor_id_++;
+        session_cursors.emplace(cursor_id, std::move(cursor));
+        response.__set_cursor_id(cursor_id);
+    }
+
+    void FetchCursor(infinity_thrift_rpc::SelectResponse &response, const infinity_thrift_rpc::CursorRequest &request) final {
+        auto [cursor, status] = GetCursor(request.session_id, request.cursor_id);
+        if (!status.ok()) {
+            ProcessStatus(response, status);
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(cursor->mutex_);
+        DataTable *result_table = cursor->result_table_.get();
+        SizeT column_count = result_table->ColumnCount();
+        SizeT block_count = result_table->DataBlockCount();
+        SizeT fetch_block_count = std::max<i64>(request.block_count, 1);
+        SizeT end_block_idx = std::min(cursor->next_block_idx_ + fetch_block_count, block_count);
+        auto &columns = response.column_fields;
+        columns.resize(column_count);
+        for (; cursor->next_block_idx_ < end_block_idx; ++cursor->next_block_idx_) {
+            // The cursor lets go of each block once it is converted.
+            SharedPtr<DataBlock> data_block = std::move(result_table->GetDataBlockById(cursor->next_block_idx_));
+            status = ProcessColumns(data_block, column_count, columns, cursor->arrow_layout_);
+            if (!status.ok()) {
+                ProcessStatus(response, status);
+                return;
+            }
+        }
+        HandleColumnDef(response, column_count, result_table->definition_ptr_, columns);
+        CompressColumns(response, cursor->compression_);
+
+        if (cursor->next_block_idx_ < block_count) {
+            response.__set_cursor_id(request.cursor_id);
+        } else {
+            // An exhausted cursor is closed, the response without cursor id is the last one.
+            RemoveCursor(request.session_id, request.cursor_id);
+        }
+    }
+
+    void CloseCursor(infinity_thrift_rpc::CommonResponse &response, const infinity_thrift_rpc::CursorRequest &request) final {
+        ProcessStatus(response, RemoveCursor(request.session_id, request.cursor_id));
+    }
+
     void Explain(infinity_thrift_rpc::SelectResponse &response, const infinity_thrift_rpc::ExplainRequest &request) final {
         auto [infinity, infinity_status] = GetInfinityBySessionID(request.session_id);
         if (!infinity_status.ok()) {
@@ -673,6 +725,38 @@ public:
                 search_expr_list->emplace_back(fusion_expr);
             }
 
+            if (request.search_expr.__isset.rerank_expr) {
+                // It follows the FUSION, so it reranks the fused rows
+                auto [rerank_expr, rerank_expr_status] = GetKnnExprFromProto(request.search_expr.rerank_expr);
+                if (!rerank_expr_status.ok()) {
+
+                    if (output_columns != nullptr) {
+                        for (auto &expr_ptr : *output_columns) {
+                            delete expr_ptr;
+                        }
+                        delete output_columns;
+                        output_columns = nullptr;
+                    }
+
+                    if (search_expr_list != nullptr) {
+                        for (auto &expr_ptr : *search_expr_list) {
+                            delete expr_ptr;
+                        }
+                        delete search_expr_list;
+                        search_expr_list = nullptr;
+                    }
+
+                    if (rerank_expr != nullptr) {
+                        delete rerank_expr;
+                        rerank_expr = nullptr;
+                    }
+
+                    ProcessStatus(response, rerank_expr_status);
+                    return;
+                }
+                search_expr_list->emplace_back(rerank_expr);
+            }
+
             search_expr->SetExprs(search_expr_list);
         }
 
@@ -1131,7 +1215,8 @@ public:
         if (result.IsOk()) {
             SharedPtr<DataBlock> data_block = result.result_table_->GetDataBlockById(0);
             auto row_count = data_block->row_count();
-            if (row_count != 9) {
+            // an index type may add rows of its own after the common ones
+            if (row_count < 9) {
                 UnrecoverableError("ShowIndex: query result is invalid.");
             }
 
@@ -1190,6 +1275,22 @@ private:
     std::mutex infinity_session_map_mutex_{};
     HashMap<u64, SharedPtr<Infinity>> infinity_session_map_{};
 
+    // The result of an OpenCursor, sent block by block by FetchCursor.
+    struct SelectCursor {
+        std::mutex mutex_{};
+        SharedPtr<DataTable> result_table_{};
+        SizeT next_block_idx_{};
+        bool arrow_layout_{};
+        infinity_thrift_rpc::CompressionType::type compression_{infinity_thrift_rpc::CompressionType::NoCompression};
+    };
+
+    static constexpr SizeT MAX_SESSION_CURSOR_COUNT = 8;
+
+    std::mutex cursor_map_mutex_{};
+    // session id -> cursor id -> cursor, the cursors of a session are dropped when it disconnects
+    HashMap<i64, HashMap<i64, SharedPtr<SelectCursor>>> cursor_map_{};
+    i64 next_cursor_id_{1};
+
     // SizeT count_ = 0;
     // std::chrono::duration<double> phase_1_duration_{};
     // std::chrono::duration<double> phase_2_duration_{};
@@ -1197,6 +1298,195 @@ private:
     // std::chrono::duration<double> phase_4_duration_{};
 
 private:
+    // Build the query of a select request and run it, an invalid request gives a result of its status.
+    static QueryResult SelectQuery(Infinity *infinity, const infinity_thrift_rpc::SelectRequest &request) {
+        SearchQuery query;
+        Status status = ParseSelectRequest(request, query);
+        if (!status.ok()) {
+            return status;
+        }
+        return infinity->Search(query.db_name_, query.table_name_, query.search_expr_, query.filter_, query.output_columns_);
+    }
+
+    // The expressions of the request, owned by the query if it succeeds.
+    static Status ParseSelectRequest(const infinity_thrift_rpc::SelectRequest &request, SearchQuery &query) {
+        // select list
+        if (request.__isset.select_list == false or request.select_list.empty()) {
+            return Status::EmptySelectFields();
+        }
+
+        Vector<ParsedExpr *> *output_columns = new Vector<ParsedExpr *>();
+        output_columns->reserve(request.select_list.size());
+
+        Status parsed_expr_status;
+        for (auto &expr : request.select_list) {
+            auto parsed_expr = GetParsedExprFromProto(parsed_expr_status, expr);
+            if (!parsed_expr_status.ok()) {
+
+                if (output_columns != nullptr) {
+                    for (auto &expr_ptr : *output_columns) {
+                        delete expr_ptr;
+                    }
+                    delete output_columns;
+                    output_columns = nullptr;
+                }
+
+                if (parsed_expr != nullptr) {
+                    delete parsed_expr;
+                    parsed_expr = nullptr;
+                }
+
+                return parsed_expr_status;
+            }
+            output_columns->emplace_back(parsed_expr);
+        }
+
+        // search expr
+        SearchExpr *search_expr = nullptr;
+        if (request.__isset.search_expr) {
+            search_expr = new SearchExpr();
+            auto search_expr_list = new Vector<ParsedExpr *>();
+            SizeT knn_expr_count = request.search_expr.knn_exprs.size();
+            SizeT match_expr_count = request.search_expr.match_exprs.size();
+            bool fusion_expr_exists = request.search_expr.__isset.fusion_expr;
+            SizeT total_expr_count = knn_expr_count + match_expr_count + fusion_expr_exists;
+            search_expr_list->reserve(total_expr_count);
+            for (SizeT idx = 0; idx < knn_expr_count; ++idx) {
+                auto [knn_expr, knn_expr_status] = GetKnnExprFromProto(request.search_expr.knn_exprs[idx]);
+                if (!knn_expr_status.ok()) {
+
+                    if (output_columns != nullptr) {
+                        for (auto &expr_ptr : *output_columns) {
+                            delete expr_ptr;
+                        }
+                        delete output_columns;
+                        output_columns = nullptr;
+                    }
+
+                    if (search_expr_list != nullptr) {
+                        for (auto &expr_ptr : *search_expr_list) {
+                            delete expr_ptr;
+                        }
+                        delete search_expr_list;
+                        search_expr_list = nullptr;
+                    }
+
+                    if (knn_expr != nullptr) {
+                        delete knn_expr;
+                        knn_expr = nullptr;
+                    }
+
+                    if (search_expr != nullptr) {
+                        delete search_expr;
+                        search_expr = nullptr;
+                    }
+
+                    return knn_expr_status;
+                }
+                search_expr_list->emplace_back(knn_expr);
+            }
+
+            for (SizeT idx = 0; idx < match_expr_count; ++idx) {
+                ParsedExpr *match_expr = GetMatchExprFromProto(request.search_expr.match_exprs[idx]);
+                search_expr_list->emplace_back(match_expr);
+            }
+
+            if (fusion_expr_exists) {
+                ParsedExpr *fusion_expr = GetFusionExprFromProto(request.search_expr.fusion_expr);
+                search_expr_list->emplace_back(fusion_expr);
+            }
+
+            if (request.search_expr.__isset.rerank_expr) {
+                // It follows the FUSION, so it reranks the fused rows
+                auto [rerank_expr, rerank_expr_status] = GetKnnExprFromProto(request.search_expr.rerank_expr);
+                if (!rerank_expr_status.ok()) {
+
+                    if (output_columns != nullptr) {
+                        for (auto &expr_ptr : *output_columns) {
+                            delete expr_ptr;
+                        }
+                        delete output_columns;
+                        output_columns = nullptr;
+                    }
+
+                    if (search_expr_list != nullptr) {
+                        for (auto &expr_ptr : *search_expr_list) {
+                            delete expr_ptr;
+                        }
+                        delete search_expr_list;
+                        search_expr_list = nullptr;
+                    }
+
+                    if (rerank_expr != nullptr) {
+                        delete rerank_expr;
+                        rerank_expr = nullptr;
+                    }
+
+                    if (search_expr != nullptr) {
+                        delete search_expr;
+                        search_expr = nullptr;
+                    }
+
+                    return rerank_expr_status;
+                }
+                search_expr_list->emplace_back(rerank_expr);
+            }
+
+            search_expr->SetExprs(search_expr_list);
+        }
+
+        // filter
+        ParsedExpr *filter = nullptr;
+        if (request.__isset.where_expr == true) {
+            filter = GetParsedExprFromProto(parsed_expr_status, request.where_expr);
+            if (!parsed_expr_status.ok()) {
+
+                if (output_columns != nullptr) {
+                    for (auto &expr_ptr : *output_columns) {
+                        delete expr_ptr;
+                    }
+                    delete output_columns;
+                    output_columns = nullptr;
+                }
+
+                if (search_expr != nullptr) {
+                    delete search_expr;
+                    search_expr = nullptr;
+                }
+
+                if (filter != nullptr) {
+                    delete filter;
+                    filter = nullptr;
+                }
+
+                return parsed_expr_status;
+            }
+        }
+
+        // TODO:
+        //    ParsedExpr *offset;
+        // offset = new ParsedExpr();
+
+        // limit
+        //        ParsedExpr *limit = nullptr;
+        //        if (request.__isset.limit_expr == true) {
+        //            limit = GetParsedExprFromProto(request.limit_expr);
+        //        }
+
+        query.db_name_ = request.db_name;
+        query.table_name_ = request.table_name;
+        query.search_expr_ = search_expr;
+        query.filter_ = filter;
+        query.output_columns_ = output_columns;
+        return Status::OK();
+    }
+
+    static QueryResult ErrorResult(Status status) {
+        QueryResult result;
+        result.status_ = std::move(status);
+        return result;
+    }
+
     Tuple<Infinity *, Status> GetInfinityBySessionID(i64 session_id) {
         std::lock_guard<std::mutex> lock(infinity_session_map_mutex_);
         auto iter = infinity_session_map_.find(session_id);
@@ -1214,6 +1504,30 @@ private:
         }
         iter->second->RemoteDisconnect();
         infinity_session_map_.erase(session_id);
+        std::lock_guard<std::mutex> cursor_lock(cursor_map_mutex_);
+        cursor_map_.erase(session_id);
+        return Status::OK();
+    }
+
+    Tuple<SharedPtr<SelectCursor>, Status> GetCursor(i64 session_id, i64 cursor_id) {
+        std::lock_guard<std::mutex> lock(cursor_map_mutex_);
+        auto session_iter = cursor_map_.find(session_id);
+        if (session_iter == cursor_map_.end()) {
+            return {nullptr, Status::CursorNotFound(cursor_id)};
+        }
+        auto iter = session_iter->second.find(cursor_id);
+        if (iter == session_iter->second.end()) {
+            return {nullptr, Status::CursorNotFound(cursor_id)};
+        }
+        return {iter->second, Status::OK()};
+    }
+
+    Status RemoveCursor(i64 session_id, i64 cursor_id) {
+        std::lock_guard<std::mutex> lock(cursor_map_mutex_);
+        auto session_iter = cursor_map_.find(session_id);
+        if (session_iter == cursor_map_.end() || session_iter->second.erase(cursor_id) == 0) {
+            return Status::CursorNotFound(cursor_id);
+        }
         return Status::OK();
     }
 
@@ -1685,12 +1999,14 @@ private:
         return infinity_thrift_rpc::ElementType::ElementFloat32;
     }
 
-    void
-    ProcessDataBlocks(const QueryResult &result, infinity_thrift_rpc::SelectResponse &response, Vector<infinity_thrift_rpc::ColumnField> &columns) {
+    void ProcessDataBlocks(const QueryResult &result,
+                           infinity_thrift_rpc::SelectResponse &response,
+                           Vector<infinity_thrift_rpc::ColumnField> &columns,
+                           bool arrow_layout = false) {
         SizeT blocks_count = result.result_table_->DataBlockCount();
         for (SizeT block_idx = 0; block_idx < blocks_count; ++block_idx) {
             auto data_block = result.result_table_->GetDataBlockById(block_idx);
-            Status status = ProcessColumns(data_block, result.result_table_->ColumnCount(), columns);
+            Status status = ProcessColumns(data_block, result.result_table_->ColumnCount(), columns, arrow_layout);
             if (!status.ok()) {
                 ProcessStatus(response, status);
                 return;
@@ -1699,13 +2015,16 @@ private:
         HandleColumnDef(response, result.result_table_->ColumnCount(), result.result_table_->definition_ptr_, columns);
     }
 
-    Status ProcessColumns(const SharedPtr<DataBlock> &data_block, SizeT column_count, Vector<infinity_thrift_rpc::ColumnField> &columns) {
+    Status ProcessColumns(const SharedPtr<DataBlock> &data_block,
+                          SizeT column_count,
+                          Vector<infinity_thrift_rpc::ColumnField> &columns,
+                          bool arrow_layout = false) {
         auto row_count = data_block->row_count();
         for (SizeT col_index = 0; col_index < column_count; ++col_index) {
             auto &result_column_vector = data_block->column_vectors[col_index];
             infinity_thrift_rpc::ColumnField &output_column_field = columns[col_index];
             output_column_field.__set_column_type(DataTypeToProtoColumnType(result_column_vector->data_type()));
-            Status status = ProcessColumnFieldType(output_column_field, row_count, result_column_vector);
+            Status status = ProcessColumnFieldType(output_column_field, row_count, result_column_vector, arrow_layout);
             if (!status.ok()) {
                 return status;
             }
@@ -1713,6 +2032,62 @@ private:
         return Status::OK();
     }
 
+    // The columns of a response smaller than this are sent as they are, even if the client asked for compression.
+    static constexpr SizeT MIN_COMPRESSED_RESPONSE_SIZE = 64 * 1024;
+
+    static void CompressColumns(infinity_thrift_rpc::SelectResponse &response, infinity_thrift_rpc::CompressionType::type compression) {
+        if (compression != infinity_thrift_rpc::CompressionType::LZ4 || response.error_code != (i64)(ErrorCode::kOk)) {
+            return;
+        }
+        SizeT total_size = 0;
+        for (const auto &column_field : response.column_fields) {
+            for (const auto &column_vector : column_field.column_vectors) {
+                if (column_vector.size() > LZ4_MAX_INPUT_SIZE) {
+                    return;
+                }
+                total_size += column_vector.size();
+            }
+        }
+        if (total_size < MIN_COMPRESSED_RESPONSE_SIZE) {
+            return;
+        }
+        for (auto &column_field : response.column_fields) {
+            for (auto &column_vector : column_field.column_vectors) {
+                column_vector = CompressBinary(column_vector);
+            }
+        }
+        response.__set_compression(infinity_thrift_rpc::CompressionType::LZ4);
+    }
+
+    // The LZ4 block of the data, prefixed with the size of the data as a 4-byte little-endian integer.
+    static String CompressBinary(const String &data) {
+        u32 data_size = data.size();
+        String compressed(sizeof(u32) + LZ4_compressBound(data_size), '\0');
+        std::memcpy(compressed.data(), &data_size, sizeof(u32));
+        i32 compressed_size = LZ4_compress_default(data.data(), compressed.data() + sizeof(u32), data_size, compressed.size() - sizeof(u32));
+        compressed.resize(sizeof(u32) + compressed_size);
+        return compressed;
+    }
+
+    static Status DecompressBinary(const String &compressed, String &data) {
+        if (compressed.size() < sizeof(u32)) {
+            return Status::ImportFileFormatError("Truncated LZ4 compressed data");
+        }
+        u32 data_size = 0;
+        std::memcpy(&data_size, compressed.data(), sizeof(u32));
+        SizeT block_size = compressed.size() - sizeof(u32);
+        // LZ4 doesn't expand the data more than 255 times, a larger size is a corrupted one
+        if (data_size > block_size * 255 + 16) {
+            return Status::ImportFileFormatError(fmt::format("Invalid LZ4 decompressed size: {}", data_size));
+        }
+        data.resize(data_size);
+        i32 decompressed_size = LZ4_decompress_safe(compressed.data() + sizeof(u32), data.data(), block_size, data_size);
+        if (decompressed_size != (i32)data_size) {
+            return Status::ImportFileFormatError("Corrupted LZ4 compressed data");
+        }
+        return Status::OK();
+    }
+
     void HandleColumnDef(infinity_thrift_rpc::SelectResponse &response,
                          SizeT column_count,
                          SharedPtr<TableDef> table_def,
@@ -1735,8 +2110,10 @@ private:
         response.__set_error_code((i64)(ErrorCode::kOk));
     }
 
-    Status
-    ProcessColumnFieldType(infinity_thrift_rpc::ColumnField &output_column_field, SizeT row_count, const shared_ptr<ColumnVector> &column_vector) {
+    Status ProcessColumnFieldType(infinity_thrift_rpc::ColumnField &output_column_field,
+                                  SizeT row_count,
+                                  const shared_ptr<ColumnVector> &column_vector,
+                                  bool arrow_layout = false) {
         switch (column_vector->data_type()->type()) {
             case LogicalType::kBoolean:
             case LogicalType::kTinyInt:
@@ -1750,7 +2127,11 @@ private:
                 break;
             }
             case LogicalType::kVarchar: {
-                HandleVarcharType(output_column_field, row_count, column_vector);
+                if (arrow_layout) {
+                    HandleVarcharArrowType(output_column_field, row_count, column_vector);
+                } else {
+                    HandleVarcharType(output_column_field, row_count, column_vector);
+                }
                 break;
             }
             case LogicalType::kEmbedding: {
@@ -1812,6 +2193,35 @@ private:
         output_column_field.__set_column_type(DataTypeToProtoColumnType(column_vector->data_type()));
     }
 
+    // The layout of an arrow string array: the row_count + 1 i32 offsets of the strings in one binary, their bytes in the next one.
+    void
+    HandleVarcharArrowType(infinity_thrift_rpc::ColumnField &output_column_field, SizeT row_count, const std::shared_ptr<ColumnVector> &column_vector) {
+        String offsets;
+        offsets.resize((row_count + 1) * sizeof(i32));
+        auto *offsets_ptr = reinterpret_cast<i32 *>(offsets.data());
+        offsets_ptr[0] = 0;
+        for (SizeT index = 0; index < row_count; ++index) {
+            VarcharT &varchar = ((VarcharT *)column_vector->data())[index];
+            offsets_ptr[index + 1] = offsets_ptr[index] + varchar.length_;
+        }
+
+        String dst;
+        dst.resize(offsets_ptr[row_count]);
+        for (SizeT index = 0; index < row_count; ++index) {
+            VarcharT &varchar = ((VarcharT *)column_vector->data())[index];
+            char *dst_ptr = dst.data() + offsets_ptr[index];
+            if (varchar.IsInlined()) {
+                std::memcpy(dst_ptr, varchar.short_.data_, varchar.length_);
+            } else {
+                column_vector->buffer_->fix_heap_mgr_->ReadFromHeap(dst_ptr, varchar.vector_.chunk_id_, varchar.vector_.chunk_offset_, varchar.length_);
+            }
+        }
+
+        output_column_field.column_vectors.emplace_back(std::move(offsets));
+        output_column_field.column_vectors.emplace_back(std::move(dst));
+        output_column_field.__set_column_type(DataTypeToProtoColumnType(column_vector->data_type()));
+    }
+
     void
     HandleEmbeddingType(infinity_thrift_rpc::ColumnField &output_column_field, SizeT row_count, const std::shared_ptr<ColumnVector> &column_vector) {
         auto size = column_vector->data_type()->Size() * row_count;
@@ -1848,6 +2258,23 @@ private:
         }
     }
 
+    static void
+    ProcessStatus(infinity_thrift_rpc::BatchSelectResponse &response, const Status &status, const String error_header = kErrorMsgHeader) {
+        response.__set_error_code((i64)(status.code()));
+        if (!status.ok()) {
+            response.__set_error_msg(status.message());
+            LOG_ERROR(fmt::format("{}: {}", error_header, status.message()));
+        }
+    }
+
+    static void ProcessStatus(infinity_thrift_rpc::UploadResponse &response, const Status &status, const String error_header = kErrorMsgHeader) {
+        response.__set_error_code((i64)(status.code()));
+        if (!status.ok()) {
+            response.__set_error_msg(status.message());
+            LOG_ERROR(fmt::format("{}: {}", error_header, status.message()));
+        }
+    }
+
     static void ProcessStatus(infinity_thrift_rpc::ShowTableResponse &response, const Status &status, const String error_header = kErrorMsgHeader) {
         response.__set_error_code((i64)(status.code()));
         if (!status.ok()) {
@@ -2058,4 +2485,139 @@ void NonBlockPoolThriftServer::Start() { server_thread_->start(); }
 
 void NonBlockPoolThriftServer::Shutdown() { server_thread_->join(); }
 
+class MultiplexedThriftConnection {
+public:
+    // as TFramedTransport
+    static constexpr u32 MAX_FRAME_SIZE = 256 * 1024 * 1024;
+
+    explicit MultiplexedThriftConnection(boost::asio::io_service &io_service) : socket_(io_service) {}
+
+    boost::asio::ip::tcp::socket socket_;
+    // big endian, as read from the socket
+    u32 frame_size_{};
+    // the response frames not written yet, the first one is being written
+    Deque<SharedPtr<Vector<u8>>> write_queue_{};
+};
+
+void MultiplexedThriftServer::Init(i32 port_no, i32 pool_size) {
+    service_handler_ = MakeShared<InfinityServiceHandler>();
+    processor_ = MakeShared<infinity_thrift_rpc::InfinityServiceProcessor>(service_handler_);
+    request_thread_pool_ = MakeUnique<ThreadPool>(pool_size);
+
+    std::cout << "Multiplexed thrift server listen on: 0.0.0.0:" << port_no << ", thread pool: " << pool_size << std::endl;
+    acceptor_ = MakeUnique<boost::asio::ip::tcp::acceptor>(io_service_, boost::asio::ip::tcp::endpoint(boost::asio::ip::tcp::v4(), port_no));
+}
+
+void MultiplexedThriftServer::Start() {
+    running_ = true;
+    Accept();
+    io_service_.run();
+}
+
+void MultiplexedThriftServer::Shutdown() {
+    running_ = false;
+    while (running_request_count_ > 0) {
+        // Running request exists.
+        std::this_thread::yield();
+    }
+    io_service_.stop();
+    acceptor_->close();
+    request_thread_pool_->stop(true);
+}
+
+void MultiplexedThriftServer::Accept() {
+    auto connection = MakeShared<MultiplexedThriftConnection>(io_service_);
+    acceptor_->async_accept(connection->socket_, [this, connection](const boost::system::error_code &error) {
+        if (!running_) {
+            return;
+        }
+        if (!error) {
+            connection->socket_.set_option(boost::asio::ip::tcp::no_delay(true));
+            ReadFrame(connection);
+        }
+        Accept();
+    });
+}
+
+void MultiplexedThriftServer::ReadFrame(SharedPtr<MultiplexedThriftConnection> connection) {
+    auto size_buffer = boost::asio::buffer(&connection->frame_size_, sizeof(connection->frame_size_));
+    boost::asio::async_read(connection->socket_, size_buffer, [this, connection](const boost::system::error_code &error, SizeT) {
+        if (error || !running_) {
+            // The connection is closed with the last handler holding it.
+            return;
+        }
+        u32 frame_size = ntohl(connection->frame_size_);
+        if (frame_size == 0 || frame_size > MultiplexedThriftConnection::MAX_FRAME_SIZE) {
+            LOG_ERROR(fmt::format("Multiplexed thrift connection: invalid frame size {}", frame_size));
+            return;
+        }
+        auto frame = MakeShared<Vector<u8>>(frame_size);
+        boost::asio::async_read(connection->socket_,
+                                boost::asio::buffer(frame->data(), frame->size()),
+                                [this, connection, frame](const boost::system::error_code &error, SizeT) {
+                                    if (error || !running_) {
+                                        return;
+                                    }
+                                    HandleFrame(connection, frame);
+                                    // The next request is read while this one runs.
+                                    ReadFrame(connection);
+                                });
+    });
+}
+
+void MultiplexedThriftServer::HandleFrame(SharedPtr<MultiplexedThriftConnection> connection, SharedPtr<Vector<u8>> frame) {
+    ++running_request_count_;
+    request_thread_pool_->push([this, connection = std::move(connection), frame = std::move(frame)](int) mutable {
+        auto input = MakeShared<TMemoryBuffer>(frame->data(), frame->size(), TMemoryBuffer::OBSERVE);
+        auto output = MakeShared<TMemoryBuffer>();
+        // Reserve the frame size, written once the response is complete.
+        u32 frame_size = 0;
+        output->write(reinterpret_cast<const u8 *>(&frame_size), sizeof(frame_size));
+        try {
+            auto input_protocol = MakeShared<TBinaryProtocol>(input);
+            auto output_protocol = MakeShared<TBinaryProtocol>(output);
+            processor_->process(input_protocol, output_protocol, nullptr);
+        } catch (const std::exception &e) {
+            // A malformed request, the requests after it can't be told apart.
+            LOG_ERROR(fmt::format("Multiplexed thrift connection: {}", e.what()));
+            io_service_.post([connection = std::move(connection)]() {
+                boost::system::error_code error;
+                connection->socket_.close(error);
+            });
+            --running_request_count_;
+            return;
+        }
+        u8 *buffer = nullptr;
+        u32 size = 0;
+        output->getBuffer(&buffer, &size);
+        auto response = MakeShared<Vector<u8>>(buffer, buffer + size);
+        frame_size = htonl(size - sizeof(frame_size));
+        std::memcpy(response->data(), &frame_size, sizeof(frame_size));
+
+        // The socket is only written by the io thread, the responses are queued there in order of completion.
+        io_service_.post([connection = std::move(connection), response = std::move(response)]() mutable {
+            connection->write_queue_.push_back(std::move(response));
+            if (connection->write_queue_.size() == 1) {
+                WriteResponses(std::move(connection));
+            }
+        });
+        --running_request_count_;
+    });
+}
+
+void MultiplexedThriftServer::WriteResponses(SharedPtr<MultiplexedThriftConnection> connection) {
+    const Vector<u8> &response = *connection->write_queue_.front();
+    auto buffer = boost::asio::buffer(response.data(), response.size());
+    boost::asio::async_write(connection->socket_, buffer, [connection](const boost::system::error_code &error, SizeT) mutable {
+        if (error) {
+            connection->write_queue_.clear();
+            return;
+        }
+        connection->write_queue_.pop_front();
+        if (!connection->write_queue_.empty()) {
+            WriteResponses(std::move(connection));
+        }
+    });
+}
+
 } // namespace infinity
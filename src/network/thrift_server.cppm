@@ -24,6 +24,7 @@ import infinity;
 
 import query_options;
 import thrift;
+import boost;
 
 using namespace std;
 // using namespace apache::thrift;
@@ -68,4 +69,35 @@ private:
     SharedPtr<apache::thrift::concurrency::Thread> server_thread_{};
 };
 
+class MultiplexedThriftConnection;
+
+// Many requests in flight on one connection. A request is a message of the binary protocol in a frame of TFramedTransport, and
+// the response carries the seqid of its request. The I/O thread reads the frames of a connection one after another and hands
+// them to pool_size threads, the responses are written as soon as they are completed, not in the order of the requests. The
+// requests of one session still have to be sent one at a time, a client runs concurrent queries in sessions of their own.
+export class MultiplexedThriftServer {
+public:
+    void Init(i32 port_no, i32 pool_size);
+    void Start();
+    void Shutdown();
+
+private:
+    void Accept();
+
+    void ReadFrame(SharedPtr<MultiplexedThriftConnection> connection);
+
+    void HandleFrame(SharedPtr<MultiplexedThriftConnection> connection, SharedPtr<Vector<u8>> frame);
+
+    static void WriteResponses(SharedPtr<MultiplexedThriftConnection> connection);
+
+    atomic_bool running_{false};
+    atomic_u64 running_request_count_{0};
+    // the sockets are only touched by the thread running io_service_
+    boost::asio::io_service io_service_{};
+    UniquePtr<boost::asio::ip::tcp::acceptor> acceptor_{};
+    UniquePtr<ThreadPool> request_thread_pool_{};
+    SharedPtr<InfinityServiceHandler> service_handler_{};
+    SharedPtr<apache::thrift::TProcessor> processor_{};
+};
+
 } // namespace infinity
@@ -56,6 +56,9 @@ std::string ConstantExpr::ToString() const {
         case LiteralType::kTimestamp: {
             return fmt::format("{}", date_value_);
         }
+        case LiteralType::kParameter: {
+            return fmt::format("${}", integer_value_);
+        }
         case LiteralType::kInterval: {
             switch (interval_type_) {
                 case TimeUnit::kSecond: {
@@ -33,6 +33,7 @@ enum class LiteralType {
     kIntegerArray,
     kDoubleArray,
     kInterval,
+    kParameter,
 };
 
 class ConstantExpr : public ParsedExpr {
@@ -114,6 +114,9 @@ std::string KnnExpr::KnnDistanceType2Str(KnnDistanceType knn_distance_type) {
         case KnnDistanceType::kHamming: {
             return "Hamming";
         }
+        case KnnDistanceType::kMaxSim: {
+            return "MaxSim";
+        }
         case KnnDistanceType::kInvalid: {
             ParserError("Invalid knn distance type");
             break;
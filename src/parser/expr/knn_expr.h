@@ -26,6 +26,7 @@ enum class KnnDistanceType {
     kCosine,
     kInnerProduct,
     kHamming,
+    kMaxSim, // sum over the query tokens of the largest inner product with a row token
 };
 
 class KnnExpr : public ParsedExpr {
@@ -42,6 +42,9 @@ std::string SearchExpr::ToString() const {
     if (fusion_expr_ != nullptr) {
         oss << ", " << fusion_expr_->ToString();
     }
+    if (rerank_expr_ != nullptr) {
+        oss << ", " << rerank_expr_->ToString();
+    }
     return oss.str();
 }
 
@@ -66,6 +69,13 @@ void SearchExpr::Validate() const {
 void SearchExpr::AddExpr(infinity::ParsedExpr *expr) {
     switch (expr->type_) {
         case ParsedExprType::kKnn:
+            if (fusion_expr_ != nullptr) {
+                if (rerank_expr_ != nullptr) {
+                    ParserError("More than one KNN expr after FUSION");
+                }
+                rerank_expr_ = static_cast<KnnExpr *>(expr);
+                break;
+            }
             knn_exprs_.push_back(static_cast<KnnExpr *>(expr));
             break;
         case ParsedExprType::kMatch:
@@ -35,6 +35,8 @@ public:
     std::vector<MatchExpr *> match_exprs_{};
     std::vector<KnnExpr *> knn_exprs_{};
     FusionExpr *fusion_expr_{};
+    // A KNN after the FUSION reranks the fused rows by another embedding column
+    KnnExpr *rerank_expr_{};
 
 private:
     std::vector<infinity::ParsedExpr *> *exprs_{};
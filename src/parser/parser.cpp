@@ -291,101 +291,103 @@ enum yysymbol_kind_t
   YYSYMBOL_177_ = 177,                     /* '.'  */
   YYSYMBOL_178_ = 178,                     /* ';'  */
   YYSYMBOL_179_ = 179,                     /* ','  */
-  YYSYMBOL_YYACCEPT = 180,                 /* $accept  */
-  YYSYMBOL_input_pattern = 181,            /* input_pattern  */
-  YYSYMBOL_statement_list = 182,           /* statement_list  */
-  YYSYMBOL_statement = 183,                /* statement  */
-  YYSYMBOL_explainable_statement = 184,    /* explainable_statement  */
-  YYSYMBOL_create_statement = 185,         /* create_statement  */
-  YYSYMBOL_table_element_array = 186,      /* table_element_array  */
-  YYSYMBOL_table_element = 187,            /* table_element  */
-  YYSYMBOL_table_column = 188,             /* table_column  */
-  YYSYMBOL_column_type = 189,              /* column_type  */
-  YYSYMBOL_column_constraints = 190,       /* column_constraints  */
-  YYSYMBOL_column_constraint = 191,        /* column_constraint  */
-  YYSYMBOL_table_constraint = 192,         /* table_constraint  */
-  YYSYMBOL_identifier_array = 193,         /* identifier_array  */
-  YYSYMBOL_delete_statement = 194,         /* delete_statement  */
-  YYSYMBOL_insert_statement = 195,         /* insert_statement  */
-  YYSYMBOL_optional_identifier_array = 196, /* optional_identifier_array  */
-  YYSYMBOL_explain_statement = 197,        /* explain_statement  */
-  YYSYMBOL_explain_type = 198,             /* explain_type  */
-  YYSYMBOL_update_statement = 199,         /* update_statement  */
-  YYSYMBOL_update_expr_array = 200,        /* update_expr_array  */
-  YYSYMBOL_update_expr = 201,              /* update_expr  */
-  YYSYMBOL_drop_statement = 202,           /* drop_statement  */
-  YYSYMBOL_copy_statement = 203,           /* copy_statement  */
-  YYSYMBOL_select_statement = 204,         /* select_statement  */
-  YYSYMBOL_select_with_paren = 205,        /* select_with_paren  */
-  YYSYMBOL_select_without_paren = 206,     /* select_without_paren  */
-  YYSYMBOL_select_clause_with_modifier = 207, /* select_clause_with_modifier  */
-  YYSYMBOL_select_clause_without_modifier_paren = 208, /* select_clause_without_modifier_paren  */
-  YYSYMBOL_select_clause_without_modifier = 209, /* select_clause_without_modifier  */
-  YYSYMBOL_order_by_clause = 210,          /* order_by_clause  */
-  YYSYMBOL_order_by_expr_list = 211,       /* order_by_expr_list  */
-  YYSYMBOL_order_by_expr = 212,            /* order_by_expr  */
-  YYSYMBOL_order_by_type = 213,            /* order_by_type  */
-  YYSYMBOL_limit_expr = 214,               /* limit_expr  */
-  YYSYMBOL_offset_expr = 215,              /* offset_expr  */
-  YYSYMBOL_distinct = 216,                 /* distinct  */
-  YYSYMBOL_from_clause = 217,              /* from_clause  */
-  YYSYMBOL_search_clause = 218,            /* search_clause  */
-  YYSYMBOL_where_clause = 219,             /* where_clause  */
-  YYSYMBOL_having_clause = 220,            /* having_clause  */
-  YYSYMBOL_group_by_clause = 221,          /* group_by_clause  */
-  YYSYMBOL_set_operator = 222,             /* set_operator  */
-  YYSYMBOL_table_reference = 223,          /* table_reference  */
-  YYSYMBOL_table_reference_unit = 224,     /* table_reference_unit  */
-  YYSYMBOL_table_reference_name = 225,     /* table_reference_name  */
-  YYSYMBOL_table_name = 226,               /* table_name  */
-  YYSYMBOL_table_alias = 227,              /* table_alias  */
-  YYSYMBOL_with_clause = 228,              /* with_clause  */
-  YYSYMBOL_with_expr_list = 229,           /* with_expr_list  */
-  YYSYMBOL_with_expr = 230,                /* with_expr  */
-  YYSYMBOL_join_clause = 231,              /* join_clause  */
-  YYSYMBOL_join_type = 232,                /* join_type  */
-  YYSYMBOL_show_statement = 233,           /* show_statement  */
-  YYSYMBOL_flush_statement = 234,          /* flush_statement  */
-  YYSYMBOL_optimize_statement = 235,       /* optimize_statement  */
-  YYSYMBOL_command_statement = 236,        /* command_statement  */
-  YYSYMBOL_expr_array = 237,               /* expr_array  */
-  YYSYMBOL_expr_array_list = 238,          /* expr_array_list  */
-  YYSYMBOL_expr_alias = 239,               /* expr_alias  */
-  YYSYMBOL_expr = 240,                     /* expr  */
-  YYSYMBOL_operand = 241,                  /* operand  */
-  YYSYMBOL_knn_expr = 242,                 /* knn_expr  */
-  YYSYMBOL_match_expr = 243,               /* match_expr  */
-  YYSYMBOL_query_expr = 244,               /* query_expr  */
-  YYSYMBOL_fusion_expr = 245,              /* fusion_expr  */
-  YYSYMBOL_sub_search_array = 246,         /* sub_search_array  */
-  YYSYMBOL_function_expr = 247,            /* function_expr  */
-  YYSYMBOL_conjunction_expr = 248,         /* conjunction_expr  */
-  YYSYMBOL_between_expr = 249,             /* between_expr  */
-  YYSYMBOL_in_expr = 250,                  /* in_expr  */
-  YYSYMBOL_case_expr = 251,                /* case_expr  */
-  YYSYMBOL_case_check_array = 252,         /* case_check_array  */
-  YYSYMBOL_cast_expr = 253,                /* cast_expr  */
-  YYSYMBOL_subquery_expr = 254,            /* subquery_expr  */
-  YYSYMBOL_column_expr = 255,              /* column_expr  */
-  YYSYMBOL_constant_expr = 256,            /* constant_expr  */
-  YYSYMBOL_array_expr = 257,               /* array_expr  */
-  YYSYMBOL_long_array_expr = 258,          /* long_array_expr  */
-  YYSYMBOL_unclosed_long_array_expr = 259, /* unclosed_long_array_expr  */
-  YYSYMBOL_double_array_expr = 260,        /* double_array_expr  */
-  YYSYMBOL_unclosed_double_array_expr = 261, /* unclosed_double_array_expr  */
-  YYSYMBOL_interval_expr = 262,            /* interval_expr  */
-  YYSYMBOL_copy_option_list = 263,         /* copy_option_list  */
-  YYSYMBOL_copy_option = 264,              /* copy_option  */
-  YYSYMBOL_file_path = 265,                /* file_path  */
-  YYSYMBOL_if_exists = 266,                /* if_exists  */
-  YYSYMBOL_if_not_exists = 267,            /* if_not_exists  */
-  YYSYMBOL_semicolon = 268,                /* semicolon  */
-  YYSYMBOL_if_not_exists_info = 269,       /* if_not_exists_info  */
-  YYSYMBOL_with_index_param_list = 270,    /* with_index_param_list  */
-  YYSYMBOL_optional_table_properties_list = 271, /* optional_table_properties_list  */
-  YYSYMBOL_index_param_list = 272,         /* index_param_list  */
-  YYSYMBOL_index_param = 273,              /* index_param  */
-  YYSYMBOL_index_info_list = 274           /* index_info_list  */
+  YYSYMBOL_180_ = 180,                     /* '?'  */
+  YYSYMBOL_YYACCEPT = 181,                 /* $accept  */
+  YYSYMBOL_input_pattern = 182,            /* input_pattern  */
+  YYSYMBOL_statement_list = 183,           /* statement_list  */
+  YYSYMBOL_statement = 184,                /* statement  */
+  YYSYMBOL_explainable_statement = 185,    /* explainable_statement  */
+  YYSYMBOL_create_statement = 186,         /* create_statement  */
+  YYSYMBOL_table_element_array = 187,      /* table_element_array  */
+  YYSYMBOL_table_element = 188,            /* table_element  */
+  YYSYMBOL_table_column = 189,             /* table_column  */
+  YYSYMBOL_column_type = 190,              /* column_type  */
+  YYSYMBOL_column_constraints = 191,       /* column_constraints  */
+  YYSYMBOL_column_constraint = 192,        /* column_constraint  */
+  YYSYMBOL_table_constraint = 193,         /* table_constraint  */
+  YYSYMBOL_identifier_array = 194,         /* identifier_array  */
+  YYSYMBOL_delete_statement = 195,         /* delete_statement  */
+  YYSYMBOL_insert_statement = 196,         /* insert_statement  */
+  YYSYMBOL_optional_identifier_array = 197, /* optional_identifier_array  */
+  YYSYMBOL_explain_statement = 198,        /* explain_statement  */
+  YYSYMBOL_explain_type = 199,             /* explain_type  */
+  YYSYMBOL_update_statement = 200,         /* update_statement  */
+  YYSYMBOL_update_expr_array = 201,        /* update_expr_array  */
+  YYSYMBOL_update_expr = 202,              /* update_expr  */
+  YYSYMBOL_drop_statement = 203,           /* drop_statement  */
+  YYSYMBOL_copy_statement = 204,           /* copy_statement  */
+  YYSYMBOL_select_statement = 205,         /* select_statement  */
+  YYSYMBOL_select_with_paren = 206,        /* select_with_paren  */
+  YYSYMBOL_select_without_paren = 207,     /* select_without_paren  */
+  YYSYMBOL_select_clause_with_modifier = 208, /* select_clause_with_modifier  */
+  YYSYMBOL_select_clause_without_modifier_paren = 209, /* select_clause_without_modifier_paren  */
+  YYSYMBOL_select_clause_without_modifier = 210, /* select_clause_without_modifier  */
+  YYSYMBOL_order_by_clause = 211,          /* order_by_clause  */
+  YYSYMBOL_order_by_expr_list = 212,       /* order_by_expr_list  */
+  YYSYMBOL_order_by_expr = 213,            /* order_by_expr  */
+  YYSYMBOL_order_by_type = 214,            /* order_by_type  */
+  YYSYMBOL_limit_expr = 215,               /* limit_expr  */
+  YYSYMBOL_offset_expr = 216,              /* offset_expr  */
+  YYSYMBOL_distinct = 217,                 /* distinct  */
+  YYSYMBOL_from_clause = 218,              /* from_clause  */
+  YYSYMBOL_search_clause = 219,            /* search_clause  */
+  YYSYMBOL_where_clause = 220,             /* where_clause  */
+  YYSYMBOL_having_clause = 221,            /* having_clause  */
+  YYSYMBOL_group_by_clause = 222,          /* group_by_clause  */
+  YYSYMBOL_set_operator = 223,             /* set_operator  */
+  YYSYMBOL_table_reference = 224,          /* table_reference  */
+  YYSYMBOL_table_reference_unit = 225,     /* table_reference_unit  */
+  YYSYMBOL_table_reference_name = 226,     /* table_reference_name  */
+  YYSYMBOL_table_name = 227,               /* table_name  */
+  YYSYMBOL_table_alias = 228,              /* table_alias  */
+  YYSYMBOL_with_clause = 229,              /* with_clause  */
+  YYSYMBOL_with_expr_list = 230,           /* with_expr_list  */
+  YYSYMBOL_with_expr = 231,                /* with_expr  */
+  YYSYMBOL_join_clause = 232,              /* join_clause  */
+  YYSYMBOL_join_type = 233,                /* join_type  */
+  YYSYMBOL_show_statement = 234,           /* show_statement  */
+  YYSYMBOL_flush_statement = 235,          /* flush_statement  */
+  YYSYMBOL_optimize_statement = 236,       /* optimize_statement  */
+  YYSYMBOL_command_statement = 237,        /* command_statement  */
+  YYSYMBOL_expr_array = 238,               /* expr_array  */
+  YYSYMBOL_expr_array_list = 239,          /* expr_array_list  */
+  YYSYMBOL_expr_alias = 240,               /* expr_alias  */
+  YYSYMBOL_expr = 241,                     /* expr  */
+  YYSYMBOL_operand = 242,                  /* operand  */
+  YYSYMBOL_knn_expr = 243,                 /* knn_expr  */
+  YYSYMBOL_match_expr = 244,               /* match_expr  */
+  YYSYMBOL_query_expr = 245,               /* query_expr  */
+  YYSYMBOL_fusion_expr = 246,              /* fusion_expr  */
+  YYSYMBOL_sub_search_array = 247,         /* sub_search_array  */
+  YYSYMBOL_function_expr = 248,            /* function_expr  */
+  YYSYMBOL_conjunction_expr = 249,         /* conjunction_expr  */
+  YYSYMBOL_between_expr = 250,             /* between_expr  */
+  YYSYMBOL_in_expr = 251,                  /* in_expr  */
+  YYSYMBOL_case_expr = 252,                /* case_expr  */
+  YYSYMBOL_case_check_array = 253,         /* case_check_array  */
+  YYSYMBOL_cast_expr = 254,                /* cast_expr  */
+  YYSYMBOL_subquery_expr = 255,            /* subquery_expr  */
+  YYSYMBOL_column_expr = 256,              /* column_expr  */
+  YYSYMBOL_constant_expr = 257,            /* constant_expr  */
+  YYSYMBOL_array_expr = 258,               /* array_expr  */
+  YYSYMBOL_parameter_expr = 259,           /* parameter_expr  */
+  YYSYMBOL_long_array_expr = 260,          /* long_array_expr  */
+  YYSYMBOL_unclosed_long_array_expr = 261, /* unclosed_long_array_expr  */
+  YYSYMBOL_double_array_expr = 262,        /* double_array_expr  */
+  YYSYMBOL_unclosed_double_array_expr = 263, /* unclosed_double_array_expr  */
+  YYSYMBOL_interval_expr = 264,            /* interval_expr  */
+  YYSYMBOL_copy_option_list = 265,         /* copy_option_list  */
+  YYSYMBOL_copy_option = 266,              /* copy_option  */
+  YYSYMBOL_file_path = 267,                /* file_path  */
+  YYSYMBOL_if_exists = 268,                /* if_exists  */
+  YYSYMBOL_if_not_exists = 269,            /* if_not_exists  */
+  YYSYMBOL_semicolon = 270,                /* semicolon  */
+  YYSYMBOL_if_not_exists_info = 271,       /* if_not_exists_info  */
+  YYSYMBOL_with_index_param_list = 272,    /* with_index_param_list  */
+  YYSYMBOL_optional_table_properties_list = 273, /* optional_table_properties_list  */
+  YYSYMBOL_index_param_list = 274,         /* index_param_list  */
+  YYSYMBOL_index_param = 275,              /* index_param  */
+  YYSYMBOL_index_info_list = 276           /* index_info_list  */
 };
 typedef enum yysymbol_kind_t yysymbol_kind_t;
 
@@ -399,7 +401,7 @@ typedef enum yysymbol_kind_t yysymbol_kind_t;
 #pragma GCC diagnostic ignored "-Wunused-but-set-variable"
 #endif
 
-#line 403 "parser.cpp"
+#line 405 "parser.cpp"
 
 #ifdef short
 # undef short
@@ -723,18 +725,18 @@ union yyalloc
 #endif /* !YYCOPY_NEEDED */
 
 /* YYFINAL -- State number of the termination state.  */
-#define YYFINAL  82
+#define YYFINAL  87
 /* YYLAST -- Last index in YYTABLE.  */
-#define YYLAST   875
+#define YYLAST   896
 
 /* YYNTOKENS -- Number of terminals.  */
-#define YYNTOKENS  180
+#define YYNTOKENS  181
 /* YYNNTS -- Number of nonterminals.  */
-#define YYNNTS  95
+#define YYNNTS  96
 /* YYNRULES -- Number of rules.  */
-#define YYNRULES  353
+#define YYNRULES  360
 /* YYNSTATES -- Number of states.  */
-#define YYNSTATES  686
+#define YYNSTATES  701
 
 /* YYMAXUTOK -- Last valid token kind.  */
 #define YYMAXUTOK   419
@@ -757,7 +759,7 @@ static const yytype_uint8 yytranslate[] =
        2,     2,     2,     2,     2,     2,     2,   172,     2,     2,
      175,   176,   170,   168,   179,   169,   177,   171,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,   178,
-     166,   165,   167,     2,     2,     2,     2,     2,     2,     2,
+     166,   165,   167,   180,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,   173,     2,   174,     2,     2,     2,     2,     2,     2,
@@ -802,39 +804,40 @@ static const yytype_int16 yyrline[] =
        0,   473,   473,   477,   483,   490,   491,   492,   493,   494,
      495,   496,   497,   498,   499,   500,   501,   503,   504,   505,
      506,   507,   508,   509,   510,   511,   512,   513,   520,   537,
-     553,   582,   598,   616,   645,   649,   655,   658,   664,   699,
-     733,   734,   735,   736,   737,   738,   739,   740,   741,   742,
-     743,   744,   745,   746,   747,   748,   749,   750,   751,   754,
-     756,   757,   758,   759,   762,   763,   764,   765,   766,   767,
-     768,   769,   770,   771,   772,   773,   774,   775,   776,   777,
-     796,   800,   810,   813,   816,   819,   823,   828,   835,   841,
-     851,   867,   901,   914,   917,   924,   930,   933,   936,   939,
-     942,   945,   948,   951,   958,   971,   975,   980,   993,  1006,
-    1021,  1036,  1051,  1074,  1115,  1160,  1163,  1166,  1175,  1185,
-    1188,  1192,  1197,  1219,  1222,  1227,  1243,  1246,  1250,  1254,
-    1259,  1265,  1268,  1271,  1275,  1279,  1281,  1285,  1287,  1290,
-    1294,  1297,  1301,  1306,  1310,  1313,  1317,  1320,  1324,  1327,
-    1331,  1334,  1337,  1340,  1348,  1351,  1366,  1366,  1368,  1382,
-    1391,  1396,  1405,  1410,  1415,  1421,  1428,  1431,  1435,  1438,
-    1443,  1455,  1462,  1476,  1479,  1482,  1485,  1488,  1491,  1494,
-    1500,  1504,  1508,  1512,  1516,  1520,  1524,  1528,  1535,  1541,
-    1552,  1563,  1574,  1586,  1598,  1611,  1622,  1640,  1644,  1648,
-    1656,  1670,  1676,  1681,  1687,  1693,  1701,  1707,  1713,  1719,
-    1725,  1733,  1739,  1745,  1761,  1765,  1770,  1774,  1801,  1807,
-    1811,  1812,  1813,  1814,  1815,  1817,  1820,  1826,  1829,  1830,
-    1831,  1832,  1833,  1834,  1835,  1836,  1838,  2005,  2013,  2024,
-    2030,  2039,  2045,  2055,  2059,  2063,  2067,  2071,  2075,  2079,
-    2083,  2088,  2096,  2104,  2113,  2120,  2127,  2134,  2141,  2148,
-    2156,  2164,  2172,  2180,  2188,  2196,  2204,  2212,  2220,  2228,
-    2236,  2244,  2274,  2282,  2291,  2299,  2308,  2316,  2322,  2329,
-    2335,  2342,  2347,  2354,  2361,  2369,  2393,  2399,  2405,  2412,
-    2420,  2427,  2434,  2439,  2449,  2454,  2459,  2464,  2469,  2474,
-    2479,  2484,  2489,  2494,  2497,  2500,  2503,  2507,  2510,  2514,
-    2518,  2523,  2528,  2532,  2537,  2542,  2548,  2554,  2560,  2566,
-    2572,  2578,  2584,  2590,  2596,  2602,  2608,  2619,  2623,  2628,
-    2650,  2660,  2666,  2670,  2671,  2673,  2674,  2676,  2677,  2689,
-    2697,  2701,  2704,  2708,  2711,  2715,  2719,  2724,  2729,  2737,
-    2744,  2755,  2803,  2852
+     553,   582,   598,   628,   646,   675,   679,   685,   688,   694,
+     729,   763,   764,   765,   766,   767,   768,   769,   770,   771,
+     772,   773,   774,   775,   776,   777,   778,   779,   780,   781,
+     784,   786,   787,   788,   789,   792,   793,   794,   795,   796,
+     797,   798,   799,   800,   801,   802,   803,   804,   805,   806,
+     807,   826,   830,   840,   843,   846,   849,   853,   858,   865,
+     871,   881,   897,   931,   944,   947,   954,   960,   963,   966,
+     969,   972,   975,   978,   981,   988,  1001,  1005,  1010,  1023,
+    1036,  1051,  1066,  1081,  1104,  1145,  1190,  1193,  1196,  1205,
+    1215,  1218,  1222,  1227,  1249,  1252,  1257,  1273,  1276,  1280,
+    1284,  1289,  1295,  1298,  1301,  1305,  1309,  1311,  1315,  1317,
+    1320,  1324,  1327,  1331,  1336,  1340,  1343,  1347,  1350,  1354,
+    1357,  1361,  1364,  1367,  1370,  1378,  1381,  1396,  1396,  1398,
+    1412,  1421,  1426,  1435,  1440,  1445,  1451,  1458,  1461,  1465,
+    1468,  1473,  1485,  1492,  1506,  1509,  1512,  1515,  1518,  1521,
+    1524,  1530,  1534,  1538,  1542,  1546,  1550,  1565,  1569,  1573,
+    1580,  1586,  1597,  1608,  1619,  1631,  1643,  1656,  1667,  1685,
+    1689,  1693,  1701,  1715,  1721,  1726,  1732,  1738,  1746,  1752,
+    1758,  1764,  1770,  1778,  1784,  1790,  1802,  1821,  1843,  1859,
+    1863,  1868,  1872,  1899,  1905,  1909,  1910,  1911,  1912,  1913,
+    1915,  1918,  1924,  1927,  1928,  1929,  1930,  1931,  1932,  1933,
+    1934,  1936,  2105,  2113,  2124,  2130,  2139,  2145,  2155,  2159,
+    2163,  2167,  2171,  2175,  2179,  2183,  2188,  2196,  2204,  2213,
+    2220,  2227,  2234,  2241,  2248,  2256,  2264,  2272,  2280,  2288,
+    2296,  2304,  2312,  2320,  2328,  2336,  2344,  2374,  2382,  2391,
+    2399,  2408,  2416,  2422,  2429,  2435,  2442,  2447,  2454,  2461,
+    2469,  2493,  2499,  2505,  2512,  2520,  2527,  2534,  2539,  2549,
+    2554,  2559,  2564,  2569,  2574,  2579,  2584,  2589,  2594,  2597,
+    2600,  2603,  2606,  2610,  2613,  2618,  2625,  2629,  2634,  2639,
+    2643,  2648,  2653,  2659,  2665,  2671,  2677,  2683,  2689,  2695,
+    2701,  2707,  2713,  2719,  2730,  2734,  2739,  2776,  2786,  2792,
+    2796,  2797,  2799,  2800,  2802,  2803,  2815,  2823,  2827,  2830,
+    2834,  2837,  2841,  2845,  2850,  2855,  2863,  2870,  2881,  2933,
+    2986
 };
 #endif
 
@@ -874,29 +877,29 @@ static const char *const yytname[] =
   "OFF", "EXPORT", "PROFILE", "CONFIGS", "PROFILES", "STATUS", "VAR",
   "SEARCH", "MATCH", "QUERY", "FUSION", "NUMBER", "'='", "'<'", "'>'",
   "'+'", "'-'", "'*'", "'/'", "'%'", "'['", "']'", "'('", "')'", "'.'",
-  "';'", "','", "$accept", "input_pattern", "statement_list", "statement",
-  "explainable_statement", "create_statement", "table_element_array",
-  "table_element", "table_column", "column_type", "column_constraints",
-  "column_constraint", "table_constraint", "identifier_array",
-  "delete_statement", "insert_statement", "optional_identifier_array",
-  "explain_statement", "explain_type", "update_statement",
-  "update_expr_array", "update_expr", "drop_statement", "copy_statement",
-  "select_statement", "select_with_paren", "select_without_paren",
-  "select_clause_with_modifier", "select_clause_without_modifier_paren",
-  "select_clause_without_modifier", "order_by_clause",
-  "order_by_expr_list", "order_by_expr", "order_by_type", "limit_expr",
-  "offset_expr", "distinct", "from_clause", "search_clause",
-  "where_clause", "having_clause", "group_by_clause", "set_operator",
-  "table_reference", "table_reference_unit", "table_reference_name",
-  "table_name", "table_alias", "with_clause", "with_expr_list",
-  "with_expr", "join_clause", "join_type", "show_statement",
-  "flush_statement", "optimize_statement", "command_statement",
-  "expr_array", "expr_array_list", "expr_alias", "expr", "operand",
-  "knn_expr", "match_expr", "query_expr", "fusion_expr",
+  "';'", "','", "'?'", "$accept", "input_pattern", "statement_list",
+  "statement", "explainable_statement", "create_statement",
+  "table_element_array", "table_element", "table_column", "column_type",
+  "column_constraints", "column_constraint", "table_constraint",
+  "identifier_array", "delete_statement", "insert_statement",
+  "optional_identifier_array", "explain_statement", "explain_type",
+  "update_statement", "update_expr_array", "update_expr", "drop_statement",
+  "copy_statement", "select_statement", "select_with_paren",
+  "select_without_paren", "select_clause_with_modifier",
+  "select_clause_without_modifier_paren", "select_clause_without_modifier",
+  "order_by_clause", "order_by_expr_list", "order_by_expr",
+  "order_by_type", "limit_expr", "offset_expr", "distinct", "from_clause",
+  "search_clause", "where_clause", "having_clause", "group_by_clause",
+  "set_operator", "table_reference", "table_reference_unit",
+  "table_reference_name", "table_name", "table_alias", "with_clause",
+  "with_expr_list", "with_expr", "join_clause", "join_type",
+  "show_statement", "flush_statement", "optimize_statement",
+  "command_statement", "expr_array", "expr_array_list", "expr_alias",
+  "expr", "operand", "knn_expr", "match_expr", "query_expr", "fusion_expr",
   "sub_search_array", "function_expr", "conjunction_expr", "between_expr",
   "in_expr", "case_expr", "case_check_array", "cast_expr", "subquery_expr",
-  "column_expr", "constant_expr", "array_expr", "long_array_expr",
-  "unclosed_long_array_expr", "double_array_expr",
+  "column_expr", "constant_expr", "array_expr", "parameter_expr",
+  "long_array_expr", "unclosed_long_array_expr", "double_array_expr",
   "unclosed_double_array_expr", "interval_expr", "copy_option_list",
   "copy_option", "file_path", "if_exists", "if_not_exists", "semicolon",
   "if_not_exists_info", "with_index_param_list",
@@ -911,12 +914,12 @@ yysymbol_name (yysymbol_kind_t yysymbol)
 }
 #endif
 
-#define YYPACT_NINF (-600)
+#define YYPACT_NINF (-633)
 
 #define yypact_value_is_default(Yyn) \
   ((Yyn) == YYPACT_NINF)
 
-#define YYTABLE_NINF (-341)
+#define YYTABLE_NINF (-348)
 
 #define yytable_value_is_error(Yyn) \
   ((Yyn) == YYTABLE_NINF)
@@ -925,75 +928,77 @@ yysymbol_name (yysymbol_kind_t yysymbol)
    STATE-NUM.  */
 static const yytype_int16 yypact[] =
 {
-     255,    28,    -4,   169,    45,   -22,    45,    88,   462,    35,
-      33,   306,    74,    45,    93,   -83,   -59,   107,   -65,  -600,
-    -600,  -600,  -600,  -600,  -600,  -600,  -600,    69,  -600,  -600,
-     118,  -600,  -600,  -600,  -600,    64,    64,    64,    64,    57,
-      45,    90,    90,    90,    90,    90,     4,   187,    45,   132,
-     222,   224,  -600,  -600,  -600,  -600,  -600,  -600,  -600,   341,
-     226,    45,  -600,  -600,  -600,    75,    99,  -600,  -600,   242,
-      45,  -600,  -600,  -600,  -600,  -600,   204,    82,  -600,   257,
-     101,   103,  -600,   205,  -600,   264,  -600,  -600,    -1,   232,
-    -600,   235,   218,   301,    45,    45,    45,   318,   247,   170,
-     251,   327,    45,    45,    45,   346,   353,   355,   297,   365,
-     365,    26,    30,  -600,  -600,  -600,  -600,  -600,  -600,  -600,
-      69,  -600,  -600,  -600,  -600,  -600,   277,  -600,  -600,  -600,
-    -600,   208,    93,   365,  -600,  -600,  -600,  -600,    -1,  -600,
-    -600,  -600,   444,   324,   311,   322,  -600,   -40,  -600,   170,
-    -600,    45,   409,    -7,  -600,  -600,  -600,  -600,  -600,   411,
-    -600,   262,   -45,  -600,   444,  -600,  -600,   400,   405,  -600,
-    -600,  -600,  -600,  -600,  -600,  -600,  -600,  -600,  -600,   471,
-     483,  -600,  -600,  -600,   118,  -600,  -600,   316,   317,   328,
-    -600,  -600,   307,   476,   329,   344,   302,   516,   517,   518,
-     519,  -600,  -600,   521,   349,   350,   354,   356,   357,   559,
-     559,  -600,   331,   412,   -58,  -600,   -31,   598,  -600,  -600,
-    -600,  -600,  -600,  -600,  -600,  -600,  -600,  -600,  -600,   360,
-    -600,  -600,  -123,  -600,  -119,  -600,   444,   444,   461,  -600,
-     -59,    14,   478,   363,  -600,   -38,   364,  -600,    45,   444,
-     355,  -600,   279,   366,   367,  -600,   396,   372,  -600,  -600,
-     238,  -600,  -600,  -600,  -600,  -600,  -600,  -600,  -600,  -600,
-    -600,  -600,  -600,   559,   368,   650,   473,   444,   444,   -25,
-      37,  -600,  -600,  -600,  -600,   307,  -600,   536,   444,   548,
-     549,   550,   336,   336,  -600,  -600,   379,  -100,     3,   444,
-     397,   556,   444,   444,   -55,   394,   -36,   559,   559,   559,
-     559,   559,   559,   559,   559,   559,   559,   559,   559,   559,
-     559,     5,  -600,   564,  -600,   566,   393,  -600,   -48,   279,
-     444,  -600,    69,   749,   465,   414,     1,  -600,  -600,  -600,
-     -59,   409,   415,  -600,   581,   444,   407,  -600,   279,  -600,
-     430,   430,   585,  -600,  -600,   444,  -600,     6,   473,   447,
-     418,   -15,   -61,    76,  -600,   444,   444,   520,   -96,   416,
-      47,    77,  -600,  -600,   -59,   422,   334,  -600,    23,  -600,
-    -600,    27,   297,  -600,  -600,   455,   428,   559,   412,   484,
-    -600,   664,   664,   289,   289,   612,   664,   664,   289,   289,
-     336,   336,  -600,  -600,  -600,  -600,  -600,  -600,  -600,   444,
-    -600,  -600,  -600,   279,  -600,  -600,  -600,  -600,  -600,  -600,
-    -600,  -600,  -600,  -600,  -600,   433,  -600,  -600,  -600,  -600,
-    -600,  -600,  -600,  -600,  -600,  -600,   434,   435,    87,   436,
-     409,   587,    14,    69,    96,   409,  -600,    97,   441,   614,
-     618,  -600,   116,  -600,   120,  -600,   150,  -600,   446,  -600,
-     749,   444,  -600,   444,   -44,   -37,   559,   450,   620,  -600,
-     622,  -600,   623,    -8,     3,   571,  -600,  -600,  -600,  -600,
-    -600,  -600,   572,  -600,   627,  -600,  -600,  -600,  -600,  -600,
-     452,   582,   412,   664,   457,   155,  -600,   559,  -600,   629,
-     158,   197,   522,   530,  -600,  -600,    87,  -600,   409,   167,
-     472,  -600,  -600,   486,   168,  -600,   444,  -600,  -600,  -600,
-     430,  -600,  -600,  -600,   464,   279,   -42,  -600,   444,   529,
-     474,  -600,  -600,   194,   479,   480,    23,   334,     3,     3,
-     477,    27,   601,   603,   482,   195,  -600,  -600,   650,   202,
-     485,   491,   493,   496,   497,   498,   499,   500,   501,   505,
-     507,   508,   509,   510,   511,   512,  -600,  -600,  -600,   209,
-    -600,   660,   662,   542,   244,  -600,  -600,  -600,   279,  -600,
-     689,  -600,   698,  -600,  -600,  -600,  -600,   642,   409,  -600,
-    -600,  -600,  -600,   444,   444,  -600,  -600,  -600,  -600,   700,
-     701,   703,   704,   705,   706,   707,   708,   709,   710,   711,
-     712,   718,   719,   720,   724,   725,  -600,   575,   290,  -600,
-     663,   739,  -600,   565,   569,   444,   308,   567,   279,   577,
-     579,   580,   583,   584,   586,   596,   597,   599,   600,   610,
-     615,   616,   617,   621,   624,   630,   190,  -600,   660,   573,
-    -600,   663,   743,  -600,   279,  -600,  -600,  -600,  -600,  -600,
-    -600,  -600,  -600,  -600,  -600,  -600,  -600,  -600,  -600,  -600,
-    -600,  -600,  -600,  -600,  -600,  -600,  -600,   660,  -600,   595,
-     312,   752,  -600,   631,   663,  -600
+     450,   160,   226,    31,   305,    41,   -28,    41,   -25,   479,
+     503,    24,   207,    78,    41,    95,   -53,   -56,   109,   -60,
+    -633,  -633,  -633,  -633,  -633,  -633,  -633,  -633,   213,  -633,
+    -633,   161,  -633,  -633,  -633,  -633,   142,    41,   186,   128,
+     128,   128,   128,   -19,    41,   149,   149,   149,   149,   149,
+      46,   238,    41,    65,   225,   256,  -633,  -633,  -633,  -633,
+    -633,  -633,  -633,   624,  -633,   261,    41,  -633,  -633,  -633,
+     108,   112,  -633,  -633,   272,    41,  -633,  -633,  -633,  -633,
+    -633,   241,   153,  -633,   335,   185,   195,  -633,    59,  -633,
+     351,  -633,  -633,     0,   314,  -633,   313,  -633,  -633,   331,
+     327,   384,    41,    41,    41,   399,   342,   231,   350,   431,
+      41,    41,    41,   437,   438,   443,   392,   446,   446,    32,
+      35,  -633,  -633,  -633,  -633,  -633,  -633,  -633,   213,  -633,
+    -633,  -633,  -633,  -633,   157,  -633,  -633,  -633,  -633,   297,
+      95,   446,  -633,  -633,  -633,  -633,     0,  -633,  -633,  -633,
+     407,   414,   410,    41,   418,  -633,     3,  -633,   231,  -633,
+      41,   494,    15,  -633,  -633,  -633,  -633,  -633,   440,  -633,
+     336,   -50,  -633,   407,  -633,  -633,   425,   426,  -633,  -633,
+    -633,  -633,  -633,  -633,  -633,  -633,  -633,  -633,   508,   514,
+    -633,  -633,  -633,   161,  -633,  -633,   360,   361,   359,  -633,
+    -633,   721,   439,   363,   369,   189,   541,   546,   549,   550,
+    -633,  -633,   551,   380,   383,   385,   389,   390,   521,   521,
+    -633,   191,   325,   553,   -57,  -633,   -32,   583,  -633,  -633,
+    -633,  -633,  -633,  -633,  -633,  -633,  -633,  -633,  -633,   394,
+    -633,  -633,  -633,  -118,  -633,   -41,  -633,   407,   407,   497,
+    -633,  -633,    41,   -56,    11,   512,   397,  -633,  -116,   398,
+    -633,    41,   407,   443,  -633,   140,   403,   406,  -633,   277,
+     408,  -633,  -633,   221,  -633,  -633,  -633,  -633,  -633,  -633,
+    -633,  -633,  -633,  -633,  -633,  -633,   521,   411,   645,   496,
+     407,   407,   -36,   214,  -633,  -633,  -633,  -633,   721,  -633,
+     575,   407,   581,   585,   586,   196,   196,  -633,  -633,   415,
+      -8,  -633,     4,   407,   432,   590,   407,   407,   -49,   420,
+     -40,   521,   521,   521,   521,   521,   521,   521,   521,   521,
+     521,   521,   521,   521,   521,     6,  -633,   591,  -633,   594,
+     417,  -633,   -42,   140,   407,  -633,  -633,   213,   730,   480,
+     435,    33,  -633,  -633,  -633,   -56,   494,   436,  -633,   603,
+     407,   441,  -633,   140,  -633,   404,   404,   609,  -633,  -633,
+     407,  -633,    53,   496,   471,   442,   -30,    -3,   215,  -633,
+     407,   407,   552,    22,   447,    74,    82,  -633,  -633,   -56,
+     451,   358,  -633,    21,  -633,  -633,    57,   392,  -633,  -633,
+     475,   454,   521,   325,   519,  -633,    77,    77,   148,   148,
+     593,    77,    77,   148,   148,   196,   196,  -633,  -633,  -633,
+    -633,  -633,  -633,  -633,   407,  -633,  -633,  -633,   140,  -633,
+    -633,  -633,  -633,  -633,  -633,  -633,  -633,  -633,  -633,  -633,
+     457,  -633,  -633,  -633,  -633,  -633,  -633,  -633,  -633,  -633,
+    -633,   466,   467,    63,   473,   494,   618,    11,   213,   131,
+     494,  -633,   163,   477,   649,   654,  -633,   184,  -633,   202,
+    -633,   209,  -633,   487,  -633,   730,   407,  -633,   407,   -52,
+       1,   521,   491,   663,  -633,   664,  -633,   665,    -9,     4,
+     614,  -633,  -633,  -633,  -633,  -633,  -633,   615,  -633,   670,
+    -633,  -633,  -633,  -633,  -633,   495,   623,   325,    77,   500,
+     216,  -633,   521,  -633,   675,   188,   340,   566,   569,  -633,
+    -633,    63,  -633,   494,   229,   513,  -633,  -633,   542,   244,
+    -633,   407,  -633,  -633,  -633,   404,  -633,  -633,  -633,   517,
+     140,   -38,  -633,   407,   540,   516,  -633,  -633,   259,   522,
+     523,    21,   358,     4,     4,   525,    57,   644,   659,   527,
+     275,  -633,  -633,   645,   276,   536,   538,   547,   548,   555,
+     557,   558,   560,   561,   562,   563,   564,   565,   567,   568,
+     577,  -633,  -633,  -633,   292,  -633,   716,   722,   579,   303,
+    -633,  -633,  -633,   140,  -633,   741,  -633,   753,  -633,  -633,
+    -633,  -633,   705,   494,  -633,  -633,  -633,  -633,   407,   407,
+    -633,  -633,  -633,  -633,   762,   763,   764,   765,   766,   767,
+     768,   769,   770,   771,   773,   774,   775,   780,   781,   782,
+     783,  -633,   626,   320,  -633,   714,   790,  -633,   616,   620,
+     407,   367,   619,   140,   621,   625,   627,   628,   629,   630,
+     631,   632,   633,   666,   667,   682,   683,   684,   685,   686,
+     687,   181,  -633,   716,   689,  -633,   714,   796,  -633,   140,
+    -633,  -633,  -633,  -633,  -633,  -633,  -633,  -633,  -633,  -633,
+    -633,  -633,  -633,  -633,  -633,  -633,  -633,  -633,  -633,  -633,
+    -633,  -633,   716,  -633,   660,   373,   788,  -633,   690,   714,
+    -633
 };
 
 /* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
@@ -1001,105 +1006,107 @@ static const yytype_int16 yypact[] =
    means the default is an error.  */
 static const yytype_int16 yydefact[] =
 {
-     167,     0,     0,     0,     0,     0,     0,     0,   103,     0,
-       0,     0,     0,     0,     0,     0,   167,     0,   338,     3,
-       5,    10,    12,    13,    11,     6,     7,     9,   116,   115,
-       0,     8,    14,    15,    16,   336,   336,   336,   336,   336,
-       0,   334,   334,   334,   334,   334,   160,     0,     0,     0,
-       0,     0,    97,   101,    98,    99,   100,   102,    96,   167,
-       0,     0,   181,   182,   180,     0,     0,   183,   184,     0,
-       0,   197,   198,   199,   201,   200,     0,   166,   168,     0,
-       0,     0,     1,   167,     2,   150,   152,   153,     0,   139,
-     121,   127,     0,     0,     0,     0,     0,     0,     0,    94,
-       0,     0,     0,     0,     0,     0,     0,     0,   145,     0,
-       0,     0,     0,    95,    17,    22,    24,    23,    18,    19,
-      21,    20,    25,    26,    27,   188,   189,   185,   186,   187,
-     213,     0,     0,     0,   120,   119,     4,   151,     0,   117,
-     118,   138,     0,     0,   135,     0,    28,     0,    29,    94,
-     339,     0,     0,   167,   333,   108,   110,   109,   111,     0,
-     161,     0,   145,   105,     0,    90,   332,     0,     0,   205,
-     207,   206,   203,   204,   210,   212,   211,   208,   209,     0,
-       0,   191,   190,   195,     0,   169,   202,     0,     0,   290,
-     294,   297,   298,     0,     0,     0,     0,     0,     0,     0,
-       0,   295,   296,     0,     0,     0,     0,     0,     0,     0,
-       0,   292,     0,   167,   141,   214,   219,   220,   232,   233,
-     234,   235,   229,   224,   223,   222,   230,   231,   221,   228,
-     227,   305,     0,   306,     0,   304,     0,     0,   137,   335,
-     167,     0,     0,     0,    88,     0,     0,    92,     0,     0,
-       0,   104,   144,     0,     0,   196,   192,     0,   124,   123,
-       0,   316,   315,   318,   317,   320,   319,   322,   321,   324,
-     323,   326,   325,     0,     0,   256,   167,     0,     0,     0,
-       0,   299,   300,   301,   302,     0,   303,     0,     0,     0,
-       0,     0,   258,   257,   313,   310,     0,     0,     0,     0,
-     143,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     168,     0,     0,     0,     0,     0,     0,     0,     0,   104,
+       0,     0,     0,     0,     0,     0,     0,   168,     0,   345,
+       3,     5,    10,    12,    13,    11,     6,     7,     9,   117,
+     116,     0,     8,    14,    15,    16,     0,     0,     0,   343,
+     343,   343,   343,   343,     0,   341,   341,   341,   341,   341,
+     161,     0,     0,     0,     0,     0,    98,   102,    99,   100,
+     101,   103,    97,   168,   186,     0,     0,   182,   183,   181,
+       0,     0,   184,   185,     0,     0,   199,   200,   201,   203,
+     202,     0,   167,   169,     0,     0,     0,     1,   168,     2,
+     151,   153,   154,     0,   140,   122,   128,   218,   216,     0,
+       0,     0,     0,     0,     0,     0,     0,    95,     0,     0,
+       0,     0,     0,     0,     0,     0,   146,     0,     0,     0,
+       0,    96,    17,    22,    24,    23,    18,    19,    21,    20,
+      25,    26,    27,   190,   191,   187,   188,   189,   215,     0,
+       0,     0,   121,   120,     4,   152,     0,   118,   119,   139,
+       0,     0,   136,     0,     0,    28,     0,    29,    95,   346,
+       0,     0,   168,   340,   109,   111,   110,   112,     0,   162,
+       0,   146,   106,     0,    91,   339,     0,     0,   207,   209,
+     208,   205,   206,   212,   214,   213,   210,   211,     0,     0,
+     193,   192,   197,     0,   170,   204,     0,     0,   295,   299,
+     302,   303,     0,     0,     0,     0,     0,     0,     0,     0,
+     300,   301,     0,     0,     0,     0,     0,     0,     0,     0,
+     297,     0,   168,     0,   142,   219,   224,   225,   237,   238,
+     239,   240,   234,   229,   228,   227,   235,   236,   226,   233,
+     232,   312,   310,     0,   311,     0,   309,     0,     0,   138,
+     217,   342,     0,   168,     0,     0,     0,    89,     0,     0,
+      93,     0,     0,     0,   105,   145,     0,     0,   198,   194,
+       0,   125,   124,     0,   323,   322,   325,   324,   327,   326,
+     329,   328,   331,   330,   333,   332,     0,     0,   261,   168,
+       0,     0,     0,     0,   304,   305,   306,   307,     0,   308,
+       0,     0,     0,     0,     0,   263,   262,   320,   317,     0,
+       0,   315,     0,     0,   144,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,   309,     0,   312,     0,   126,   128,   133,   134,
-       0,   122,    31,     0,     0,     0,     0,    34,    36,    37,
-     167,     0,    33,    93,     0,     0,    91,   112,   107,   106,
-       0,     0,     0,   193,   170,     0,   251,     0,   167,     0,
-       0,     0,     0,     0,   281,     0,     0,     0,     0,     0,
-       0,     0,   226,   225,   167,   140,   154,   156,   165,   157,
-     215,     0,   145,   218,   274,   275,     0,     0,   167,     0,
-     255,   265,   266,   269,   270,     0,   272,   264,   267,   268,
-     260,   259,   261,   262,   263,   291,   293,   311,   314,     0,
-     131,   132,   130,   136,    40,    43,    44,    41,    42,    45,
-      46,    60,    47,    49,    48,    63,    50,    51,    52,    53,
-      54,    55,    56,    57,    58,    59,     0,     0,    38,     0,
-       0,   344,     0,    32,     0,     0,    89,     0,     0,     0,
-       0,   331,     0,   327,     0,   194,     0,   252,     0,   286,
-       0,     0,   279,     0,     0,     0,     0,     0,     0,   239,
-       0,   241,     0,     0,     0,     0,   174,   175,   176,   177,
-     173,   178,     0,   163,     0,   158,   243,   244,   245,   246,
-     142,   149,   167,   273,     0,     0,   254,     0,   129,     0,
-       0,     0,     0,     0,    83,    84,    39,    80,     0,     0,
-       0,    30,    35,   353,     0,   216,     0,   330,   329,   114,
-       0,   113,   253,   287,     0,   283,     0,   282,     0,     0,
-       0,   307,   308,     0,     0,     0,   165,   155,     0,     0,
-     162,     0,     0,   147,     0,     0,   288,   277,   276,     0,
+       0,     0,     0,     0,     0,     0,   316,     0,   319,     0,
+     127,   129,   134,   135,     0,   123,    32,    31,     0,     0,
+       0,     0,    35,    37,    38,   168,     0,    34,    94,     0,
+       0,    92,   113,   108,   107,     0,     0,     0,   195,   171,
+       0,   256,     0,   168,     0,     0,     0,     0,     0,   286,
+       0,     0,     0,     0,     0,     0,     0,   231,   230,   168,
+     141,   155,   157,   166,   158,   220,     0,   146,   223,   279,
+     280,     0,     0,   168,     0,   260,   270,   271,   274,   275,
+       0,   277,   269,   272,   273,   265,   264,   266,   267,   268,
+     296,   298,   318,   321,     0,   132,   133,   131,   137,    41,
+      44,    45,    42,    43,    46,    47,    61,    48,    50,    49,
+      64,    51,    52,    53,    54,    55,    56,    57,    58,    59,
+      60,     0,     0,    39,     0,     0,   351,     0,    33,     0,
+       0,    90,     0,     0,     0,     0,   338,     0,   334,     0,
+     196,     0,   257,     0,   291,     0,     0,   284,     0,     0,
+       0,     0,     0,     0,   244,     0,   246,     0,     0,     0,
+       0,   175,   176,   177,   178,   174,   179,     0,   164,     0,
+     159,   248,   249,   250,   251,   143,   150,   168,   278,     0,
+       0,   259,     0,   130,     0,     0,     0,     0,     0,    84,
+      85,    40,    81,     0,     0,     0,    30,    36,   360,     0,
+     221,     0,   337,   336,   115,     0,   114,   258,   292,     0,
+     288,     0,   287,     0,     0,     0,   313,   314,     0,     0,
+       0,   166,   156,     0,     0,   163,     0,     0,   148,     0,
+       0,   293,   282,   281,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,    85,    82,    81,     0,
-      87,     0,     0,     0,     0,   328,   285,   280,   284,   271,
-       0,   237,     0,   240,   242,   159,   171,     0,     0,   247,
-     248,   249,   250,     0,     0,   125,   289,   278,    62,     0,
+       0,    86,    83,    82,     0,    88,     0,     0,     0,     0,
+     335,   290,   285,   289,   276,     0,   242,     0,   245,   247,
+     160,   172,     0,     0,   252,   253,   254,   255,     0,     0,
+     126,   294,   283,    63,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,    86,   347,     0,   345,
-     342,     0,   217,     0,     0,     0,     0,   148,   146,     0,
+       0,    87,   354,     0,   352,   349,     0,   222,     0,     0,
+       0,     0,   149,   147,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,   343,     0,     0,
-     351,   342,     0,   238,   172,   164,    61,    67,    68,    65,
-      66,    69,    70,    71,    64,    75,    76,    73,    74,    77,
-      78,    79,    72,   348,   350,   349,   346,     0,   352,     0,
-       0,     0,   341,     0,   342,   236
+       0,     0,   350,     0,     0,   358,   349,     0,   243,   173,
+     165,    62,    68,    69,    66,    67,    70,    71,    72,    65,
+      76,    77,    74,    75,    78,    79,    80,    73,   355,   357,
+     356,   353,     0,   359,     0,     0,     0,   348,     0,   349,
+     241
 };
 
 /* YYPGOTO[NTERM-NUM].  */
 static const yytype_int16 yypgoto[] =
 {
-    -600,  -600,  -600,   678,  -600,   735,  -600,   369,  -600,   338,
-    -600,   293,  -600,  -336,   737,   746,   659,  -600,  -600,   751,
-    -600,   562,   754,   755,   -56,   807,   -16,   640,   687,   -35,
-    -600,  -600,   417,  -600,  -600,  -600,  -600,  -600,  -600,  -158,
-    -600,  -600,  -600,  -600,   384,   -71,    62,   291,  -600,  -600,
-     696,  -600,  -600,   800,   802,   803,   806,  -258,  -600,   568,
-    -163,  -165,  -372,  -371,  -370,  -368,  -600,  -600,  -600,  -600,
-    -600,  -600,   589,  -600,  -600,  -600,  -600,  -600,   399,  -600,
-     402,  -600,   667,   523,   351,   -72,   193,   278,  -600,  -600,
-    -599,  -600,   196,   227,  -600
+    -633,  -633,  -633,   752,  -633,   739,  -633,   412,  -633,   393,
+    -633,   344,  -633,  -352,   804,   807,   713,  -633,  -633,   809,
+    -633,   610,   811,   812,   -62,   859,   -17,   688,   731,   -51,
+    -633,  -633,   455,  -633,  -633,  -633,  -633,  -633,  -633,  -166,
+    -633,  -633,  -633,  -633,   391,  -205,    13,   332,  -633,  -633,
+     738,  -633,  -633,   819,   821,   822,   823,  -271,  -633,   574,
+    -170,  -172,  -386,  -384,  -379,  -375,  -633,  -633,  -633,  -633,
+    -633,  -633,   596,  -633,  -633,  -633,  -633,  -633,  -633,   409,
+    -633,   413,  -633,   677,   524,   357,   -86,   192,   334,  -633,
+    -633,  -632,  -633,   201,   233,  -633
 };
 
 /* YYDEFGOTO[NTERM-NUM].  */
 static const yytype_int16 yydefgoto[] =
 {
-       0,    17,    18,    19,   113,    20,   336,   337,   338,   438,
-     506,   507,   339,   245,    21,    22,   153,    23,    59,    24,
-     162,   163,    25,    26,    27,    28,    29,    90,   139,    91,
-     144,   326,   327,   412,   238,   331,   142,   300,   382,   165,
-     595,   543,    88,   375,   376,   377,   378,   485,    30,    77,
-      78,   379,   482,    31,    32,    33,    34,   214,   346,   215,
-     216,   217,   218,   219,   220,   221,   490,   222,   223,   224,
-     225,   226,   280,   227,   228,   229,   230,   530,   231,   232,
-     233,   234,   235,   452,   453,   167,   101,    93,    84,    98,
-     650,   511,   618,   619,   342
+       0,    18,    19,    20,   121,    21,   351,   352,   353,   453,
+     521,   522,   354,   258,    22,    23,   162,    24,    63,    25,
+     171,   172,    26,    27,    28,    29,    30,    95,   147,    96,
+     152,   340,   341,   427,   249,   345,   150,   314,   397,   174,
+     610,   558,    93,   390,   391,   392,   393,   500,    31,    82,
+      83,   394,   497,    32,    33,    34,    35,   224,   361,   225,
+     226,   227,   228,   229,   230,   231,   505,   232,   233,   234,
+     235,   236,   293,   237,   238,   239,   240,   545,   241,   242,
+     243,   244,   245,   246,   467,   468,   176,   109,   101,    89,
+     106,   665,   526,   633,   634,   357
 };
 
 /* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
@@ -1107,302 +1114,309 @@ static const yytype_int16 yydefgoto[] =
    number is the opposite.  If YYTABLE_NINF, syntax error.  */
 static const yytype_int16 yytable[] =
 {
-      81,   252,   357,   120,   251,   444,    46,    89,   405,   486,
-     487,   488,    85,   489,    86,   240,    87,   333,   298,    14,
-     386,   164,   410,   411,   301,   461,   483,   246,   275,    40,
-     169,   170,   171,   279,   174,   175,   176,   389,   168,   527,
-     460,   577,   302,   303,   292,   293,   302,   303,    46,   528,
-     297,   322,   678,   140,    48,   324,   323,    35,    36,    37,
-     325,   186,   278,    70,    60,    61,    47,    62,    49,    38,
-      39,    14,    79,   328,   329,    75,   373,    74,   484,    63,
-      64,   302,   303,   467,   390,   685,   348,   447,   172,    85,
-     387,    86,   177,    87,   302,   303,    76,   456,   302,   303,
-     302,   303,    99,   188,   509,   302,   303,    82,   275,   514,
-     108,   302,   303,    83,   361,   362,    16,   302,   303,  -340,
-     364,   299,   365,   126,   366,   368,    89,   302,   303,    92,
-     495,   334,   130,   335,   250,   241,    92,   247,   343,   384,
-     385,   344,   391,   392,   393,   394,   395,   396,   397,   398,
-     399,   400,   401,   402,   403,   404,   147,   148,   149,   462,
-     502,   463,   100,   366,   156,   157,   158,   413,   536,   589,
-     590,   591,   569,   592,   138,   406,   205,   441,   374,   173,
-     442,   106,   457,   178,   332,   299,    65,    66,   206,   207,
-     208,    67,    68,   673,    69,   674,   675,   296,    41,    42,
-      43,   107,   464,   465,   503,  -337,   504,   505,   109,   110,
-      44,    45,     1,   243,     2,     3,     4,     5,     6,     7,
-       8,     9,   493,   469,   491,   111,   470,   112,    10,   125,
-      11,    12,    13,   127,   545,   102,   103,   104,   105,    50,
-      51,   189,   190,   191,   192,   129,   328,   550,   551,   552,
-     553,   554,   626,   471,   555,   556,   472,   128,   574,   131,
-     360,   132,     1,   133,     2,     3,     4,     5,     6,     7,
-       8,     9,   513,   515,   557,   344,   299,   134,    10,   135,
-      11,    12,    13,    14,   443,   137,   558,   559,   560,   561,
-     562,   145,   519,   563,   564,   520,   521,   141,   525,   520,
-     526,   529,   143,   355,   146,   189,   190,   191,   192,   151,
-     347,   193,   194,   565,    94,    95,    96,    97,   473,   179,
-     195,   150,   196,   180,   181,   154,   522,   182,   183,   299,
-     155,   547,   548,    14,   299,   627,   294,   295,   197,   198,
-     199,   200,   458,   570,   573,   152,   344,   344,     1,   159,
-       2,     3,     4,     5,     6,     7,   160,     9,   161,    15,
-     201,   202,   203,   164,    10,   578,    11,    12,    13,   166,
-     581,   597,   494,   582,   299,   193,   194,   236,   598,   237,
-      16,   599,   204,   184,   195,   616,   196,   205,   344,   278,
-     475,  -179,   476,   477,   478,   479,   239,   480,   481,   206,
-     207,   208,   197,   198,   199,   200,   209,   210,   211,    15,
-     306,   212,   244,   213,   356,   189,   190,   191,   192,    14,
-     622,   302,   303,   299,   201,   202,   203,   249,  -341,  -341,
-      16,   628,   261,   262,   263,   264,   265,   266,   267,   268,
-     269,   270,   271,   272,   352,   353,   204,   189,   190,   191,
-     192,   205,    71,    72,    73,  -341,  -341,   316,   317,   318,
-     319,   320,   654,   206,   207,   208,   647,   586,   587,   648,
-     209,   210,   211,   248,   255,   212,   544,   213,   253,   189,
-     190,   191,   192,   254,   655,   193,   194,   344,   682,   256,
-      14,   648,   258,   259,   195,    15,   196,    52,    53,    54,
-      55,    56,    57,   260,   276,    58,   318,   319,   320,   449,
-     450,   451,   197,   198,   199,   200,    16,   193,   194,   277,
-     281,   282,   283,   284,   287,   288,   195,   285,   196,   289,
-     330,   290,   291,   340,   201,   202,   203,   321,   341,   345,
-     367,   350,   351,   358,   197,   198,   199,   200,   354,   273,
-     274,    14,   369,   370,   371,   372,   204,   381,   195,   383,
-     196,   205,   189,   190,   191,   192,   201,   202,   203,   388,
-     407,   408,   409,   206,   207,   208,   197,   198,   199,   200,
-     209,   210,   211,   439,   446,   212,   448,   213,   204,   440,
-     445,   455,   387,   205,   459,   468,   466,   302,   201,   202,
-     203,   474,   359,   492,   496,   206,   207,   208,   499,   500,
-     501,   508,   209,   210,   211,   510,   516,   212,   517,   213,
-     204,   518,   523,   212,   533,   205,   534,   535,   538,   539,
-     540,   541,   273,   546,   542,   549,   572,   206,   207,   208,
-     576,   195,   566,   196,   209,   210,   211,   571,   567,   212,
-     306,   213,   588,   580,   593,   583,   584,   594,   596,   197,
-     198,   199,   200,   617,   600,   620,   307,   308,   309,   310,
-     601,   304,   602,   305,   312,   603,   604,   605,   606,   607,
-     608,   201,   202,   203,   609,   359,   610,   611,   612,   613,
-     614,   615,   621,   623,   313,   314,   315,   316,   317,   318,
-     319,   320,   624,   204,   625,   579,   629,   630,   205,   631,
-     632,   633,   634,   635,   636,   637,   638,   639,   640,   306,
-     206,   207,   208,   359,   641,   642,   643,   209,   210,   211,
-     644,   645,   212,   306,   213,   307,   308,   309,   310,   311,
-     646,   649,   651,   312,   652,   653,   299,   679,   677,   307,
-     308,   309,   310,   656,   497,   657,   658,   312,   683,   659,
-     660,   136,   661,   313,   314,   315,   316,   317,   318,   319,
-     320,   306,   662,   663,   681,   664,   665,   313,   314,   315,
-     316,   317,   318,   319,   320,   306,   666,   307,   308,   309,
-     310,   667,   668,   669,   114,   312,   115,   670,   524,   568,
-     671,  -341,  -341,   309,   310,   116,   672,   684,   242,  -341,
-     117,   512,   349,   118,   119,   313,   314,   315,   316,   317,
-     318,   319,   320,    80,   257,   187,   498,   585,   185,  -341,
-     314,   315,   316,   317,   318,   319,   320,   414,   415,   416,
-     417,   418,   419,   420,   421,   422,   423,   424,   425,   426,
-     427,   428,   429,   430,   431,   432,   433,   434,   537,   121,
-     435,   122,   123,   436,   437,   124,   531,   380,   363,   532,
-     286,   575,     0,   680,   454,   676
+      86,   128,   372,   265,   459,   264,   252,    50,    94,   420,
+     501,    90,   502,    91,   348,    92,   173,   503,    51,   312,
+      53,   504,    15,   315,   498,   475,   401,    80,   425,   426,
+     288,   542,   177,   404,   693,   292,   178,   179,   180,   183,
+     184,   185,   148,  -347,    50,   592,   305,   306,    52,   259,
+      98,   291,   310,   100,    75,   195,   336,   107,   253,  -344,
+     358,   337,     1,   359,    44,   116,     2,   700,     3,     4,
+       5,     6,     7,     8,     9,    10,   499,   342,   343,   134,
+     405,    79,    11,   476,    12,    13,    14,   543,   138,   462,
+     316,   317,   363,    15,   181,   197,   402,   186,    81,   471,
+     316,   317,    84,   524,   316,   317,   316,   317,   529,    87,
+     316,   317,   316,   317,   288,   156,   157,   158,    88,    17,
+     376,   377,   313,   165,   166,   167,    54,    55,   349,   263,
+     350,   383,   510,   338,   316,   317,   517,    15,   339,   316,
+     317,   117,   118,   316,   317,   260,   399,   400,    97,   406,
+     407,   408,   409,   410,   411,   412,   413,   414,   415,   416,
+     417,   418,   419,    36,   316,   317,   250,   551,   388,    94,
+     604,   584,   605,   256,   428,   146,   421,   606,   254,   389,
+     518,   607,   519,   520,   688,   182,   689,   690,   187,    99,
+      37,   347,   198,   199,   200,   201,   307,   308,   320,   188,
+     100,   482,    38,   189,   190,   309,   214,   191,   192,   456,
+     479,   480,   457,    16,  -348,  -348,   323,   324,   215,   216,
+     217,   108,  -348,   114,   198,   199,   200,   201,   119,   472,
+     508,   506,   313,    90,    17,    91,   560,    92,   110,   111,
+     112,   113,  -348,   328,   329,   330,   331,   332,   333,   334,
+     484,   641,   115,   485,   342,    39,    40,    41,   486,   120,
+     589,   487,   202,   203,   133,   346,   135,    42,    43,   320,
+     136,   204,   375,   205,   362,   137,   291,   565,   566,   567,
+     568,   569,   316,   317,   570,   571,   370,  -348,  -348,   206,
+     207,   208,   209,   458,   202,   203,   139,   379,   477,   380,
+     478,   381,   381,   204,   572,   205,   540,   528,   541,   544,
+     359,   210,   211,   212,  -348,  -348,   330,   331,   332,   333,
+     334,   206,   207,   208,   209,   367,   368,   488,   198,   199,
+     200,   201,   140,   213,    45,    46,    47,   642,   214,   530,
+     563,   141,   313,   210,   211,   212,    48,    49,   601,   602,
+     215,   216,   217,    76,    77,    78,   473,   218,   219,   220,
+     534,   142,   221,   535,   222,   213,   332,   333,   334,   223,
+     214,   143,   145,   593,   102,   103,   104,   105,   536,   149,
+     151,   535,   215,   216,   217,   537,   509,   155,   313,   218,
+     219,   220,   562,   153,   221,   313,   222,   371,   202,   203,
+     154,   223,   159,    15,   160,   585,   161,   204,   359,   205,
+     198,   199,   200,   201,   490,  -180,   491,   492,   493,   494,
+     588,   495,   496,   359,   163,   206,   207,   208,   209,   573,
+     574,   575,   576,   577,   164,   596,   578,   579,   597,   643,
+     168,   169,   198,   199,   200,   201,   170,   210,   211,   212,
+     175,   612,   613,     1,   313,   614,   580,     2,   173,     3,
+       4,     5,     6,     7,     8,     9,    10,   247,   631,   213,
+     669,   359,   193,    11,   214,    12,    13,    14,   248,   637,
+     202,   203,   313,   464,   465,   466,   215,   216,   217,   204,
+     559,   205,   251,   218,   219,   220,   662,   257,   221,   663,
+     222,   262,   261,   266,   267,   223,    64,   206,   207,   208,
+     209,   268,   286,   287,    56,    57,    58,    59,    60,    61,
+     269,   204,    62,   205,   198,   199,   200,   201,    15,   210,
+     211,   212,    65,    66,   273,    67,   271,   272,   289,   206,
+     207,   208,   209,   670,   290,   294,   359,    68,    69,   697,
+     295,   213,   663,   296,   297,   300,   214,   298,   301,   311,
+     302,   210,   211,   212,   303,   304,   344,   355,   215,   216,
+     217,   335,   356,   360,    15,   218,   219,   220,   365,   382,
+     221,   366,   222,   213,   369,   384,   373,   223,   214,   385,
+     386,   387,   396,   398,   286,   403,   424,   422,   454,   423,
+     215,   216,   217,   204,    16,   205,   461,   218,   219,   220,
+     455,   460,   221,   374,   222,   470,   402,   316,   474,   223,
+     463,   206,   207,   208,   209,    17,   483,     1,   481,   507,
+     489,     2,   514,     3,     4,     5,     6,     7,     8,   511,
+      10,   515,   516,   210,   211,   212,   525,    11,   523,    12,
+      13,    14,   531,   532,    70,    71,   318,   533,   319,    72,
+      73,   320,    74,   538,   221,   213,   374,   548,   549,   550,
+     214,   553,   554,   555,   556,   557,   561,   321,   322,   323,
+     324,   564,   215,   216,   217,   326,   581,   582,   586,   218,
+     219,   220,   587,   591,   221,   595,   222,   608,   598,   599,
+     603,   223,    15,   611,   320,   327,   328,   329,   330,   331,
+     332,   333,   334,   609,   320,   615,   594,   616,   374,   632,
+     321,   322,   323,   324,   325,   635,   617,   618,   326,   636,
+     321,   322,   323,   324,   619,   512,   620,   621,   326,   622,
+     623,   624,   625,   626,   627,   638,   628,   629,   327,   328,
+     329,   330,   331,   332,   333,   334,   630,   639,   327,   328,
+     329,   330,   331,   332,   333,   334,   320,   640,   644,   645,
+     646,   647,   648,   649,   650,   651,   652,   653,    16,   654,
+     655,   656,   321,   322,   323,   324,   657,   658,   659,   660,
+     326,   661,   664,   666,   698,   667,   668,   671,   313,    17,
+     694,   672,   122,   673,   674,   675,   676,   677,   678,   679,
+     327,   328,   329,   330,   331,   332,   333,   334,   429,   430,
+     431,   432,   433,   434,   435,   436,   437,   438,   439,   440,
+     441,   442,   443,   444,   445,   446,   447,   448,   449,   696,
+     144,   450,   680,   681,   451,   452,   274,   275,   276,   277,
+     278,   279,   280,   281,   282,   283,   284,   285,   682,   683,
+     684,   685,   686,   687,   692,   583,   699,   123,   539,   527,
+     124,   255,   125,   364,   126,   127,    85,   196,   194,   513,
+     552,   270,   129,   600,   130,   131,   132,   395,   378,   299,
+     469,   546,   590,   695,     0,   547,   691
 };
 
 static const yytype_int16 yycheck[] =
 {
-      16,   164,   260,    59,   162,   341,     3,     8,     3,   381,
-     381,   381,    20,   381,    22,    55,    24,     3,    76,    78,
-      75,    66,    70,    71,    55,    86,     3,    34,   193,    33,
-       4,     5,     6,   196,     4,     5,     6,    73,   110,    83,
-      55,    83,   142,   143,   209,   210,   142,   143,     3,    86,
-     213,   174,   651,    88,    76,   174,   179,    29,    30,    31,
-     179,   133,    87,    30,    29,    30,     4,    32,     6,    41,
-      42,    78,   155,   236,   237,    13,   176,     3,    55,    44,
-      45,   142,   143,   179,   120,   684,   249,   345,    62,    20,
-     145,    22,    62,    24,   142,   143,     3,   355,   142,   143,
-     142,   143,    40,   138,   440,   142,   143,     0,   273,   445,
-      48,   142,   143,   178,   277,   278,   175,   142,   143,    62,
-      83,   179,    85,    61,    87,   288,     8,   142,   143,    72,
-     388,   117,    70,   119,   179,   175,    72,   153,   176,   302,
-     303,   179,   307,   308,   309,   310,   311,   312,   313,   314,
-     315,   316,   317,   318,   319,   320,    94,    95,    96,    83,
-      73,    85,    72,    87,   102,   103,   104,   330,   176,   541,
-     541,   541,   508,   541,   175,   170,   149,   176,   175,   153,
-     179,   177,   176,   153,   240,   179,   151,   152,   161,   162,
-     163,   156,   157,     3,   159,     5,     6,   213,    29,    30,
-      31,    14,   365,   366,   117,     0,   119,   120,    76,    77,
-      41,    42,     7,   151,     9,    10,    11,    12,    13,    14,
-      15,    16,   387,   176,   382,     3,   179,     3,    23,     3,
-      25,    26,    27,   158,   492,    42,    43,    44,    45,   151,
-     152,     3,     4,     5,     6,     3,   409,    89,    90,    91,
-      92,    93,   588,   176,    96,    97,   179,   158,   516,    55,
-     276,   179,     7,     6,     9,    10,    11,    12,    13,    14,
-      15,    16,   176,   176,   116,   179,   179,   176,    23,   176,
-      25,    26,    27,    78,   340,    21,    89,    90,    91,    92,
-      93,    73,   176,    96,    97,   179,   176,    65,   461,   179,
-     463,   466,    67,    65,     3,     3,     4,     5,     6,    62,
-     248,    73,    74,   116,    36,    37,    38,    39,   374,    42,
-      82,     3,    84,    46,    47,    74,   176,    50,    51,   179,
-       3,   176,   497,    78,   179,   593,     5,     6,   100,   101,
-     102,   103,   358,   176,   176,   175,   179,   179,     7,     3,
-       9,    10,    11,    12,    13,    14,     3,    16,     3,   154,
-     122,   123,   124,    66,    23,   528,    25,    26,    27,     4,
-     176,   176,   388,   179,   179,    73,    74,    53,   176,    68,
-     175,   179,   144,   175,    82,   176,    84,   149,   179,    87,
-      56,    57,    58,    59,    60,    61,    74,    63,    64,   161,
-     162,   163,   100,   101,   102,   103,   168,   169,   170,   154,
-     121,   173,     3,   175,   176,     3,     4,     5,     6,    78,
-     176,   142,   143,   179,   122,   123,   124,   165,   139,   140,
-     175,   594,   125,   126,   127,   128,   129,   130,   131,   132,
-     133,   134,   135,   136,    48,    49,   144,     3,     4,     5,
-       6,   149,   146,   147,   148,   166,   167,   168,   169,   170,
-     171,   172,   625,   161,   162,   163,   176,   538,   539,   179,
-     168,   169,   170,    62,     3,   173,   492,   175,    78,     3,
-       4,     5,     6,    78,   176,    73,    74,   179,   176,     6,
-      78,   179,   176,   176,    82,   154,    84,    35,    36,    37,
-      38,    39,    40,   175,   175,    43,   170,   171,   172,    79,
-      80,    81,   100,   101,   102,   103,   175,    73,    74,   175,
-       4,     4,     4,     4,   175,   175,    82,     6,    84,   175,
-      69,   175,   175,    55,   122,   123,   124,   177,   175,   175,
-       4,   175,   175,   175,   100,   101,   102,   103,   176,    73,
-      74,    78,     4,     4,     4,   176,   144,   160,    82,     3,
-      84,   149,     3,     4,     5,     6,   122,   123,   124,   175,
-       6,     5,   179,   161,   162,   163,   100,   101,   102,   103,
-     168,   169,   170,   118,     3,   173,   179,   175,   144,   175,
-     175,     6,   145,   149,   176,   179,    76,   142,   122,   123,
-     124,   179,    73,   175,   120,   161,   162,   163,   175,   175,
-     175,   175,   168,   169,   170,    28,   175,   173,     4,   175,
-     144,     3,   176,   173,     4,   149,     4,     4,    57,    57,
-       3,   179,    73,   176,    52,     6,   150,   161,   162,   163,
-     176,    82,   120,    84,   168,   169,   170,   175,   118,   173,
-     121,   175,   175,   179,    53,   176,   176,    54,   176,   100,
-     101,   102,   103,     3,   179,     3,   137,   138,   139,   140,
-     179,    73,   179,    75,   145,   179,   179,   179,   179,   179,
-     179,   122,   123,   124,   179,    73,   179,   179,   179,   179,
-     179,   179,   150,     4,   165,   166,   167,   168,   169,   170,
-     171,   172,     4,   144,    62,   176,     6,     6,   149,     6,
-       6,     6,     6,     6,     6,     6,     6,     6,     6,   121,
-     161,   162,   163,    73,     6,     6,     6,   168,   169,   170,
-       6,     6,   173,   121,   175,   137,   138,   139,   140,   141,
-     165,    78,     3,   145,   179,   176,   179,     4,   175,   137,
-     138,   139,   140,   176,   142,   176,   176,   145,     6,   176,
-     176,    83,   176,   165,   166,   167,   168,   169,   170,   171,
-     172,   121,   176,   176,   179,   176,   176,   165,   166,   167,
-     168,   169,   170,   171,   172,   121,   176,   137,   138,   139,
-     140,   176,   176,   176,    59,   145,    59,   176,   460,   506,
-     176,   137,   138,   139,   140,    59,   176,   176,   149,   145,
-      59,   442,   250,    59,    59,   165,   166,   167,   168,   169,
-     170,   171,   172,    16,   184,   138,   409,   536,   132,   165,
-     166,   167,   168,   169,   170,   171,   172,    88,    89,    90,
-      91,    92,    93,    94,    95,    96,    97,    98,    99,   100,
-     101,   102,   103,   104,   105,   106,   107,   108,   474,    59,
-     111,    59,    59,   114,   115,    59,   467,   299,   279,   467,
-     203,   520,    -1,   677,   351,   648
+      17,    63,   273,   173,   356,   171,     3,     3,     8,     3,
+     396,    20,   396,    22,     3,    24,    66,   396,     5,    76,
+       7,   396,    78,    55,     3,    55,    75,    14,    70,    71,
+     202,    83,   118,    73,   666,   205,     4,     5,     6,     4,
+       5,     6,    93,    62,     3,    83,   218,   219,    76,    34,
+      37,    87,   222,    72,    30,   141,   174,    44,    55,     0,
+     176,   179,     3,   179,    33,    52,     7,   699,     9,    10,
+      11,    12,    13,    14,    15,    16,    55,   247,   248,    66,
+     120,     3,    23,    86,    25,    26,    27,    86,    75,   360,
+     142,   143,   262,    78,    62,   146,   145,    62,     3,   370,
+     142,   143,   155,   455,   142,   143,   142,   143,   460,     0,
+     142,   143,   142,   143,   286,   102,   103,   104,   178,   175,
+     290,   291,   179,   110,   111,   112,   151,   152,   117,   179,
+     119,   301,   403,   174,   142,   143,    73,    78,   179,   142,
+     143,    76,    77,   142,   143,   162,   316,   317,     6,   321,
+     322,   323,   324,   325,   326,   327,   328,   329,   330,   331,
+     332,   333,   334,     3,   142,   143,   153,   176,   176,     8,
+     556,   523,   556,   160,   344,   175,   170,   556,   175,   175,
+     117,   556,   119,   120,     3,   153,     5,     6,   153,     3,
+      30,   253,     3,     4,     5,     6,     5,     6,   121,    42,
+      72,   179,    42,    46,    47,   222,   149,    50,    51,   176,
+     380,   381,   179,   154,   137,   138,   139,   140,   161,   162,
+     163,    72,   145,   177,     3,     4,     5,     6,     3,   176,
+     402,   397,   179,    20,   175,    22,   507,    24,    46,    47,
+      48,    49,   165,   166,   167,   168,   169,   170,   171,   172,
+     176,   603,    14,   179,   424,    29,    30,    31,   176,     3,
+     531,   179,    73,    74,     3,   252,   158,    41,    42,   121,
+     158,    82,   289,    84,   261,     3,    87,    89,    90,    91,
+      92,    93,   142,   143,    96,    97,    65,   139,   140,   100,
+     101,   102,   103,   355,    73,    74,    55,    83,    83,    85,
+      85,    87,    87,    82,   116,    84,   476,   176,   478,   481,
+     179,   122,   123,   124,   166,   167,   168,   169,   170,   171,
+     172,   100,   101,   102,   103,    48,    49,   389,     3,     4,
+       5,     6,   179,   144,    29,    30,    31,   608,   149,   176,
+     512,     6,   179,   122,   123,   124,    41,    42,   553,   554,
+     161,   162,   163,   146,   147,   148,   373,   168,   169,   170,
+     176,   176,   173,   179,   175,   144,   170,   171,   172,   180,
+     149,   176,    21,   543,    40,    41,    42,    43,   176,    65,
+      67,   179,   161,   162,   163,   176,   403,     3,   179,   168,
+     169,   170,   176,    62,   173,   179,   175,   176,    73,    74,
+      73,   180,     3,    78,    62,   176,   175,    82,   179,    84,
+       3,     4,     5,     6,    56,    57,    58,    59,    60,    61,
+     176,    63,    64,   179,    74,   100,   101,   102,   103,    89,
+      90,    91,    92,    93,     3,   176,    96,    97,   179,   609,
+       3,     3,     3,     4,     5,     6,     3,   122,   123,   124,
+       4,   176,   176,     3,   179,   179,   116,     7,    66,     9,
+      10,    11,    12,    13,    14,    15,    16,    53,   176,   144,
+     640,   179,   175,    23,   149,    25,    26,    27,    68,   176,
+      73,    74,   179,    79,    80,    81,   161,   162,   163,    82,
+     507,    84,    74,   168,   169,   170,   176,     3,   173,   179,
+     175,   165,    62,    78,    78,   180,     3,   100,   101,   102,
+     103,     3,    73,    74,    35,    36,    37,    38,    39,    40,
+       6,    82,    43,    84,     3,     4,     5,     6,    78,   122,
+     123,   124,    29,    30,   175,    32,   176,   176,   175,   100,
+     101,   102,   103,   176,   175,     4,   179,    44,    45,   176,
+       4,   144,   179,     4,     4,   175,   149,     6,   175,     6,
+     175,   122,   123,   124,   175,   175,    69,    55,   161,   162,
+     163,   177,   175,   175,    78,   168,   169,   170,   175,     4,
+     173,   175,   175,   144,   176,     4,   175,   180,   149,     4,
+       4,   176,   160,     3,    73,   175,   179,     6,   118,     5,
+     161,   162,   163,    82,   154,    84,     3,   168,   169,   170,
+     175,   175,   173,    73,   175,     6,   145,   142,   176,   180,
+     179,   100,   101,   102,   103,   175,   179,     3,    76,   175,
+     179,     7,   175,     9,    10,    11,    12,    13,    14,   120,
+      16,   175,   175,   122,   123,   124,    28,    23,   175,    25,
+      26,    27,   175,     4,   151,   152,    73,     3,    75,   156,
+     157,   121,   159,   176,   173,   144,    73,     4,     4,     4,
+     149,    57,    57,     3,   179,    52,   176,   137,   138,   139,
+     140,     6,   161,   162,   163,   145,   120,   118,   175,   168,
+     169,   170,   150,   176,   173,   179,   175,    53,   176,   176,
+     175,   180,    78,   176,   121,   165,   166,   167,   168,   169,
+     170,   171,   172,    54,   121,   179,   176,   179,    73,     3,
+     137,   138,   139,   140,   141,     3,   179,   179,   145,   150,
+     137,   138,   139,   140,   179,   142,   179,   179,   145,   179,
+     179,   179,   179,   179,   179,     4,   179,   179,   165,   166,
+     167,   168,   169,   170,   171,   172,   179,     4,   165,   166,
+     167,   168,   169,   170,   171,   172,   121,    62,     6,     6,
+       6,     6,     6,     6,     6,     6,     6,     6,   154,     6,
+       6,     6,   137,   138,   139,   140,     6,     6,     6,     6,
+     145,   165,    78,     3,     6,   179,   176,   176,   179,   175,
+       4,   176,    63,   176,   176,   176,   176,   176,   176,   176,
+     165,   166,   167,   168,   169,   170,   171,   172,    88,    89,
+      90,    91,    92,    93,    94,    95,    96,    97,    98,    99,
+     100,   101,   102,   103,   104,   105,   106,   107,   108,   179,
+      88,   111,   176,   176,   114,   115,   125,   126,   127,   128,
+     129,   130,   131,   132,   133,   134,   135,   136,   176,   176,
+     176,   176,   176,   176,   175,   521,   176,    63,   475,   457,
+      63,   158,    63,   263,    63,    63,    17,   146,   140,   424,
+     489,   193,    63,   551,    63,    63,    63,   313,   292,   212,
+     366,   482,   535,   692,    -1,   482,   663
 };
 
 /* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
    state STATE-NUM.  */
 static const yytype_int16 yystos[] =
 {
-       0,     7,     9,    10,    11,    12,    13,    14,    15,    16,
-      23,    25,    26,    27,    78,   154,   175,   181,   182,   183,
-     185,   194,   195,   197,   199,   202,   203,   204,   205,   206,
-     228,   233,   234,   235,   236,    29,    30,    31,    41,    42,
-      33,    29,    30,    31,    41,    42,     3,   226,    76,   226,
-     151,   152,    35,    36,    37,    38,    39,    40,    43,   198,
-      29,    30,    32,    44,    45,   151,   152,   156,   157,   159,
-      30,   146,   147,   148,     3,   226,     3,   229,   230,   155,
-     205,   206,     0,   178,   268,    20,    22,    24,   222,     8,
-     207,   209,    72,   267,   267,   267,   267,   267,   269,   226,
-      72,   266,   266,   266,   266,   266,   177,    14,   226,    76,
-      77,     3,     3,   184,   185,   194,   195,   199,   202,   203,
-     204,   233,   234,   235,   236,     3,   226,   158,   158,     3,
-     226,    55,   179,     6,   176,   176,   183,    21,   175,   208,
-     209,    65,   216,    67,   210,    73,     3,   226,   226,   226,
-       3,    62,   175,   196,    74,     3,   226,   226,   226,     3,
-       3,     3,   200,   201,    66,   219,     4,   265,   265,     4,
-       5,     6,    62,   153,     4,     5,     6,    62,   153,    42,
-      46,    47,    50,    51,   175,   230,   265,   208,   209,     3,
-       4,     5,     6,    73,    74,    82,    84,   100,   101,   102,
-     103,   122,   123,   124,   144,   149,   161,   162,   163,   168,
-     169,   170,   173,   175,   237,   239,   240,   241,   242,   243,
-     244,   245,   247,   248,   249,   250,   251,   253,   254,   255,
-     256,   258,   259,   260,   261,   262,    53,    68,   214,    74,
-      55,   175,   196,   226,     3,   193,    34,   206,    62,   165,
-     179,   219,   240,    78,    78,     3,     6,   207,   176,   176,
-     175,   125,   126,   127,   128,   129,   130,   131,   132,   133,
-     134,   135,   136,    73,    74,   241,   175,   175,    87,   240,
-     252,     4,     4,     4,     4,     6,   262,   175,   175,   175,
-     175,   175,   241,   241,     5,     6,   206,   240,    76,   179,
-     217,    55,   142,   143,    73,    75,   121,   137,   138,   139,
-     140,   141,   145,   165,   166,   167,   168,   169,   170,   171,
-     172,   177,   174,   179,   174,   179,   211,   212,   240,   240,
-      69,   215,   204,     3,   117,   119,   186,   187,   188,   192,
-      55,   175,   274,   176,   179,   175,   238,   226,   240,   201,
-     175,   175,    48,    49,   176,    65,   176,   237,   175,    73,
-     206,   240,   240,   252,    83,    85,    87,     4,   240,     4,
-       4,     4,   176,   176,   175,   223,   224,   225,   226,   231,
-     239,   160,   218,     3,   240,   240,    75,   145,   175,    73,
-     120,   241,   241,   241,   241,   241,   241,   241,   241,   241,
-     241,   241,   241,   241,   241,     3,   170,     6,     5,   179,
-      70,    71,   213,   240,    88,    89,    90,    91,    92,    93,
-      94,    95,    96,    97,    98,    99,   100,   101,   102,   103,
-     104,   105,   106,   107,   108,   111,   114,   115,   189,   118,
-     175,   176,   179,   204,   193,   175,     3,   237,   179,    79,
-      80,    81,   263,   264,   263,     6,   237,   176,   206,   176,
-      55,    86,    83,    85,   240,   240,    76,   179,   179,   176,
-     179,   176,   179,   204,   179,    56,    58,    59,    60,    61,
-      63,    64,   232,     3,    55,   227,   242,   243,   244,   245,
-     246,   219,   175,   241,   206,   237,   120,   142,   212,   175,
-     175,   175,    73,   117,   119,   120,   190,   191,   175,   193,
-      28,   271,   187,   176,   193,   176,   175,     4,     3,   176,
-     179,   176,   176,   176,   189,   240,   240,    83,    86,   241,
-     257,   258,   260,     4,     4,     4,   176,   224,    57,    57,
-       3,   179,    52,   221,   206,   237,   176,   176,   241,     6,
-      89,    90,    91,    92,    93,    96,    97,   116,    89,    90,
-      91,    92,    93,    96,    97,   116,   120,   118,   191,   193,
-     176,   175,   150,   176,   237,   264,   176,    83,   240,   176,
-     179,   176,   179,   176,   176,   227,   225,   225,   175,   242,
-     243,   244,   245,    53,    54,   220,   176,   176,   176,   179,
+       0,     3,     7,     9,    10,    11,    12,    13,    14,    15,
+      16,    23,    25,    26,    27,    78,   154,   175,   182,   183,
+     184,   186,   195,   196,   198,   200,   203,   204,   205,   206,
+     207,   229,   234,   235,   236,   237,     3,    30,    42,    29,
+      30,    31,    41,    42,    33,    29,    30,    31,    41,    42,
+       3,   227,    76,   227,   151,   152,    35,    36,    37,    38,
+      39,    40,    43,   199,     3,    29,    30,    32,    44,    45,
+     151,   152,   156,   157,   159,    30,   146,   147,   148,     3,
+     227,     3,   230,   231,   155,   206,   207,     0,   178,   270,
+      20,    22,    24,   223,     8,   208,   210,     6,   227,     3,
+      72,   269,   269,   269,   269,   269,   271,   227,    72,   268,
+     268,   268,   268,   268,   177,    14,   227,    76,    77,     3,
+       3,   185,   186,   195,   196,   200,   203,   204,   205,   234,
+     235,   236,   237,     3,   227,   158,   158,     3,   227,    55,
+     179,     6,   176,   176,   184,    21,   175,   209,   210,    65,
+     217,    67,   211,    62,    73,     3,   227,   227,   227,     3,
+      62,   175,   197,    74,     3,   227,   227,   227,     3,     3,
+       3,   201,   202,    66,   220,     4,   267,   267,     4,     5,
+       6,    62,   153,     4,     5,     6,    62,   153,    42,    46,
+      47,    50,    51,   175,   231,   267,   209,   210,     3,     4,
+       5,     6,    73,    74,    82,    84,   100,   101,   102,   103,
+     122,   123,   124,   144,   149,   161,   162,   163,   168,   169,
+     170,   173,   175,   180,   238,   240,   241,   242,   243,   244,
+     245,   246,   248,   249,   250,   251,   252,   254,   255,   256,
+     257,   259,   260,   261,   262,   263,   264,    53,    68,   215,
+     227,    74,     3,    55,   175,   197,   227,     3,   194,    34,
+     207,    62,   165,   179,   220,   241,    78,    78,     3,     6,
+     208,   176,   176,   175,   125,   126,   127,   128,   129,   130,
+     131,   132,   133,   134,   135,   136,    73,    74,   242,   175,
+     175,    87,   241,   253,     4,     4,     4,     4,     6,   264,
+     175,   175,   175,   175,   175,   242,   242,     5,     6,   207,
+     241,     6,    76,   179,   218,    55,   142,   143,    73,    75,
+     121,   137,   138,   139,   140,   141,   145,   165,   166,   167,
+     168,   169,   170,   171,   172,   177,   174,   179,   174,   179,
+     212,   213,   241,   241,    69,   216,   227,   205,     3,   117,
+     119,   187,   188,   189,   193,    55,   175,   276,   176,   179,
+     175,   239,   227,   241,   202,   175,   175,    48,    49,   176,
+      65,   176,   238,   175,    73,   207,   241,   241,   253,    83,
+      85,    87,     4,   241,     4,     4,     4,   176,   176,   175,
+     224,   225,   226,   227,   232,   240,   160,   219,     3,   241,
+     241,    75,   145,   175,    73,   120,   242,   242,   242,   242,
+     242,   242,   242,   242,   242,   242,   242,   242,   242,   242,
+       3,   170,     6,     5,   179,    70,    71,   214,   241,    88,
+      89,    90,    91,    92,    93,    94,    95,    96,    97,    98,
+      99,   100,   101,   102,   103,   104,   105,   106,   107,   108,
+     111,   114,   115,   190,   118,   175,   176,   179,   205,   194,
+     175,     3,   238,   179,    79,    80,    81,   265,   266,   265,
+       6,   238,   176,   207,   176,    55,    86,    83,    85,   241,
+     241,    76,   179,   179,   176,   179,   176,   179,   205,   179,
+      56,    58,    59,    60,    61,    63,    64,   233,     3,    55,
+     228,   243,   244,   245,   246,   247,   220,   175,   242,   207,
+     238,   120,   142,   213,   175,   175,   175,    73,   117,   119,
+     120,   191,   192,   175,   194,    28,   273,   188,   176,   194,
+     176,   175,     4,     3,   176,   179,   176,   176,   176,   190,
+     241,   241,    83,    86,   242,   258,   260,   262,     4,     4,
+       4,   176,   225,    57,    57,     3,   179,    52,   222,   207,
+     238,   176,   176,   242,     6,    89,    90,    91,    92,    93,
+      96,    97,   116,    89,    90,    91,    92,    93,    96,    97,
+     116,   120,   118,   192,   194,   176,   175,   150,   176,   238,
+     266,   176,    83,   241,   176,   179,   176,   179,   176,   176,
+     228,   226,   226,   175,   243,   244,   245,   246,    53,    54,
+     221,   176,   176,   176,   179,   179,   179,   179,   179,   179,
      179,   179,   179,   179,   179,   179,   179,   179,   179,   179,
-     179,   179,   179,   179,   179,   179,   176,     3,   272,   273,
-       3,   150,   176,     4,     4,    62,   193,   237,   240,     6,
+     179,   176,     3,   274,   275,     3,   150,   176,     4,     4,
+      62,   194,   238,   241,     6,     6,     6,     6,     6,     6,
        6,     6,     6,     6,     6,     6,     6,     6,     6,     6,
-       6,     6,     6,     6,     6,     6,   165,   176,   179,    78,
-     270,     3,   179,   176,   240,   176,   176,   176,   176,   176,
+       6,   165,   176,   179,    78,   272,     3,   179,   176,   241,
      176,   176,   176,   176,   176,   176,   176,   176,   176,   176,
-     176,   176,   176,     3,     5,     6,   273,   175,   270,     4,
-     272,   179,   176,     6,   176,   270
+     176,   176,   176,   176,   176,   176,   176,   176,     3,     5,
+       6,   275,   175,   272,     4,   274,   179,   176,     6,   176,
+     272
 };
 
 /* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
 static const yytype_int16 yyr1[] =
 {
-       0,   180,   181,   182,   182,   183,   183,   183,   183,   183,
-     183,   183,   183,   183,   183,   183,   183,   184,   184,   184,
-     184,   184,   184,   184,   184,   184,   184,   184,   185,   185,
-     185,   185,   185,   185,   186,   186,   187,   187,   188,   188,
-     189,   189,   189,   189,   189,   189,   189,   189,   189,   189,
-     189,   189,   189,   189,   189,   189,   189,   189,   189,   189,
-     189,   189,   189,   189,   189,   189,   189,   189,   189,   189,
-     189,   189,   189,   189,   189,   189,   189,   189,   189,   189,
-     190,   190,   191,   191,   191,   191,   192,   192,   193,   193,
-     194,   195,   195,   196,   196,   197,   198,   198,   198,   198,
-     198,   198,   198,   198,   199,   200,   200,   201,   202,   202,
-     202,   202,   202,   203,   203,   204,   204,   204,   204,   205,
-     205,   206,   207,   208,   208,   209,   210,   210,   211,   211,
-     212,   213,   213,   213,   214,   214,   215,   215,   216,   216,
-     217,   217,   218,   218,   219,   219,   220,   220,   221,   221,
-     222,   222,   222,   222,   223,   223,   224,   224,   225,   225,
-     226,   226,   227,   227,   227,   227,   228,   228,   229,   229,
-     230,   231,   231,   232,   232,   232,   232,   232,   232,   232,
-     233,   233,   233,   233,   233,   233,   233,   233,   233,   233,
-     233,   233,   233,   233,   233,   233,   233,   234,   234,   234,
-     235,   236,   236,   236,   236,   236,   236,   236,   236,   236,
-     236,   236,   236,   236,   237,   237,   238,   238,   239,   239,
-     240,   240,   240,   240,   240,   241,   241,   241,   241,   241,
-     241,   241,   241,   241,   241,   241,   242,   243,   243,   244,
-     244,   245,   245,   246,   246,   246,   246,   246,   246,   246,
-     246,   247,   247,   247,   247,   247,   247,   247,   247,   247,
-     247,   247,   247,   247,   247,   247,   247,   247,   247,   247,
-     247,   247,   247,   247,   248,   248,   249,   250,   250,   251,
-     251,   251,   251,   252,   252,   253,   254,   254,   254,   254,
-     255,   255,   255,   255,   256,   256,   256,   256,   256,   256,
-     256,   256,   256,   256,   256,   256,   256,   257,   257,   258,
-     259,   259,   260,   261,   261,   262,   262,   262,   262,   262,
-     262,   262,   262,   262,   262,   262,   262,   263,   263,   264,
-     264,   264,   265,   266,   266,   267,   267,   268,   268,   269,
-     269,   270,   270,   271,   271,   272,   272,   273,   273,   273,
-     273,   274,   274,   274
+       0,   181,   182,   183,   183,   184,   184,   184,   184,   184,
+     184,   184,   184,   184,   184,   184,   184,   185,   185,   185,
+     185,   185,   185,   185,   185,   185,   185,   185,   186,   186,
+     186,   186,   186,   186,   186,   187,   187,   188,   188,   189,
+     189,   190,   190,   190,   190,   190,   190,   190,   190,   190,
+     190,   190,   190,   190,   190,   190,   190,   190,   190,   190,
+     190,   190,   190,   190,   190,   190,   190,   190,   190,   190,
+     190,   190,   190,   190,   190,   190,   190,   190,   190,   190,
+     190,   191,   191,   192,   192,   192,   192,   193,   193,   194,
+     194,   195,   196,   196,   197,   197,   198,   199,   199,   199,
+     199,   199,   199,   199,   199,   200,   201,   201,   202,   203,
+     203,   203,   203,   203,   204,   204,   205,   205,   205,   205,
+     206,   206,   207,   208,   209,   209,   210,   211,   211,   212,
+     212,   213,   214,   214,   214,   215,   215,   216,   216,   217,
+     217,   218,   218,   219,   219,   220,   220,   221,   221,   222,
+     222,   223,   223,   223,   223,   224,   224,   225,   225,   226,
+     226,   227,   227,   228,   228,   228,   228,   229,   229,   230,
+     230,   231,   232,   232,   233,   233,   233,   233,   233,   233,
+     233,   234,   234,   234,   234,   234,   234,   234,   234,   234,
+     234,   234,   234,   234,   234,   234,   234,   234,   234,   235,
+     235,   235,   236,   237,   237,   237,   237,   237,   237,   237,
+     237,   237,   237,   237,   237,   237,   237,   237,   237,   238,
+     238,   239,   239,   240,   240,   241,   241,   241,   241,   241,
+     242,   242,   242,   242,   242,   242,   242,   242,   242,   242,
+     242,   243,   244,   244,   245,   245,   246,   246,   247,   247,
+     247,   247,   247,   247,   247,   247,   248,   248,   248,   248,
+     248,   248,   248,   248,   248,   248,   248,   248,   248,   248,
+     248,   248,   248,   248,   248,   248,   248,   248,   248,   249,
+     249,   250,   251,   251,   252,   252,   252,   252,   253,   253,
+     254,   255,   255,   255,   255,   256,   256,   256,   256,   257,
+     257,   257,   257,   257,   257,   257,   257,   257,   257,   257,
+     257,   257,   257,   258,   258,   259,   260,   261,   261,   262,
+     263,   263,   264,   264,   264,   264,   264,   264,   264,   264,
+     264,   264,   264,   264,   265,   265,   266,   266,   266,   267,
+     268,   268,   269,   269,   270,   270,   271,   271,   272,   272,
+     273,   273,   274,   274,   275,   275,   275,   275,   276,   276,
+     276
 };
 
 /* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
@@ -1411,39 +1425,40 @@ static const yytype_int8 yyr2[] =
        0,     2,     2,     1,     3,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     4,     4,
-       8,     6,     7,     6,     1,     3,     1,     1,     2,     3,
+       8,     6,     6,     7,     6,     1,     3,     1,     1,     2,
+       3,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     6,     4,     1,     6,     6,     6,     6,     6,     6,
+       1,     1,     6,     4,     1,     6,     6,     6,     6,     6,
        6,     6,     6,     6,     6,     6,     6,     6,     6,     6,
-       1,     2,     2,     1,     1,     2,     5,     4,     1,     3,
-       4,     6,     5,     3,     0,     3,     1,     1,     1,     1,
-       1,     1,     1,     0,     5,     1,     3,     3,     4,     4,
-       4,     4,     6,     8,     8,     1,     1,     3,     3,     3,
-       3,     2,     4,     3,     3,     8,     3,     0,     1,     3,
-       2,     1,     1,     0,     2,     0,     2,     0,     1,     0,
-       2,     0,     2,     0,     2,     0,     2,     0,     3,     0,
-       1,     2,     1,     1,     1,     3,     1,     1,     2,     4,
-       1,     3,     2,     1,     5,     0,     2,     0,     1,     3,
-       5,     4,     6,     1,     1,     1,     1,     1,     1,     0,
-       2,     2,     2,     2,     2,     3,     3,     3,     3,     3,
-       4,     4,     5,     6,     7,     4,     5,     2,     2,     2,
-       2,     2,     4,     4,     4,     4,     4,     4,     4,     4,
-       4,     4,     4,     3,     1,     3,     3,     5,     3,     1,
-       1,     1,     1,     1,     1,     3,     3,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,    13,     6,     8,     4,
-       6,     4,     6,     1,     1,     1,     1,     3,     3,     3,
-       3,     3,     4,     5,     4,     3,     2,     2,     2,     3,
-       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
-       3,     6,     3,     4,     3,     3,     5,     5,     6,     4,
-       6,     3,     5,     4,     5,     6,     4,     5,     5,     6,
-       1,     3,     1,     3,     1,     1,     1,     1,     1,     2,
-       2,     2,     2,     2,     1,     1,     1,     1,     1,     2,
-       2,     3,     2,     2,     3,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     1,     3,     2,
-       2,     1,     1,     2,     0,     3,     0,     1,     0,     2,
-       0,     4,     0,     4,     0,     1,     3,     1,     3,     3,
-       3,     6,     7,     3
+       6,     1,     2,     2,     1,     1,     2,     5,     4,     1,
+       3,     4,     6,     5,     3,     0,     3,     1,     1,     1,
+       1,     1,     1,     1,     0,     5,     1,     3,     3,     4,
+       4,     4,     4,     6,     8,     8,     1,     1,     3,     3,
+       3,     3,     2,     4,     3,     3,     8,     3,     0,     1,
+       3,     2,     1,     1,     0,     2,     0,     2,     0,     1,
+       0,     2,     0,     2,     0,     2,     0,     2,     0,     3,
+       0,     1,     2,     1,     1,     1,     3,     1,     1,     2,
+       4,     1,     3,     2,     1,     5,     0,     2,     0,     1,
+       3,     5,     4,     6,     1,     1,     1,     1,     1,     1,
+       0,     2,     2,     2,     2,     2,     2,     3,     3,     3,
+       3,     3,     4,     4,     5,     6,     7,     4,     5,     2,
+       2,     2,     2,     2,     4,     4,     4,     4,     4,     4,
+       4,     4,     4,     4,     4,     3,     3,     5,     3,     1,
+       3,     3,     5,     3,     1,     1,     1,     1,     1,     1,
+       3,     3,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,    13,     6,     8,     4,     6,     4,     6,     1,     1,
+       1,     1,     3,     3,     3,     3,     3,     4,     5,     4,
+       3,     2,     2,     2,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     6,     3,     4,     3,
+       3,     5,     5,     6,     4,     6,     3,     5,     4,     5,
+       6,     4,     5,     5,     6,     1,     3,     1,     3,     1,
+       1,     1,     1,     1,     2,     2,     2,     2,     2,     1,
+       1,     1,     1,     1,     1,     2,     2,     2,     3,     2,
+       2,     3,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     1,     3,     2,     2,     1,     1,
+       2,     0,     3,     0,     1,     0,     2,     0,     4,     0,
+       4,     0,     1,     3,     1,     3,     3,     3,     6,     7,
+       3
 };
 
 
@@ -2011,7 +2026,7 @@ yydestruct (const char *yymsg,
             {
     free(((*yyvaluep).str_value));
 }
-#line 2015 "parser.cpp"
+#line 2030 "parser.cpp"
         break;
 
     case YYSYMBOL_STRING: /* STRING  */
@@ -2019,7 +2034,7 @@ yydestruct (const char *yymsg,
             {
     free(((*yyvaluep).str_value));
 }
-#line 2023 "parser.cpp"
+#line 2038 "parser.cpp"
         break;
 
     case YYSYMBOL_statement_list: /* statement_list  */
@@ -2033,7 +2048,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).stmt_array));
     }
 }
-#line 2037 "parser.cpp"
+#line 2052 "parser.cpp"
         break;
 
     case YYSYMBOL_table_element_array: /* table_element_array  */
@@ -2047,7 +2062,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).table_element_array_t));
     }
 }
-#line 2051 "parser.cpp"
+#line 2066 "parser.cpp"
         break;
 
     case YYSYMBOL_column_constraints: /* column_constraints  */
@@ -2058,7 +2073,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).column_constraints_t));
     }
 }
-#line 2062 "parser.cpp"
+#line 2077 "parser.cpp"
         break;
 
     case YYSYMBOL_identifier_array: /* identifier_array  */
@@ -2067,7 +2082,7 @@ yydestruct (const char *yymsg,
     fprintf(stderr, "destroy identifier array\n");
     delete (((*yyvaluep).identifier_array_t));
 }
-#line 2071 "parser.cpp"
+#line 2086 "parser.cpp"
         break;
 
     case YYSYMBOL_optional_identifier_array: /* optional_identifier_array  */
@@ -2076,7 +2091,7 @@ yydestruct (const char *yymsg,
     fprintf(stderr, "destroy identifier array\n");
     delete (((*yyvaluep).identifier_array_t));
 }
-#line 2080 "parser.cpp"
+#line 2095 "parser.cpp"
         break;
 
     case YYSYMBOL_update_expr_array: /* update_expr_array  */
@@ -2090,7 +2105,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).update_expr_array_t));
     }
 }
-#line 2094 "parser.cpp"
+#line 2109 "parser.cpp"
         break;
 
     case YYSYMBOL_update_expr: /* update_expr  */
@@ -2101,7 +2116,7 @@ yydestruct (const char *yymsg,
         delete ((*yyvaluep).update_expr_t);
     }
 }
-#line 2105 "parser.cpp"
+#line 2120 "parser.cpp"
         break;
 
     case YYSYMBOL_select_statement: /* select_statement  */
@@ -2111,7 +2126,7 @@ yydestruct (const char *yymsg,
         delete ((*yyvaluep).select_stmt);
     }
 }
-#line 2115 "parser.cpp"
+#line 2130 "parser.cpp"
         break;
 
     case YYSYMBOL_select_with_paren: /* select_with_paren  */
@@ -2121,7 +2136,7 @@ yydestruct (const char *yymsg,
         delete ((*yyvaluep).select_stmt);
     }
 }
-#line 2125 "parser.cpp"
+#line 2140 "parser.cpp"
         break;
 
     case YYSYMBOL_select_without_paren: /* select_without_paren  */
@@ -2131,7 +2146,7 @@ yydestruct (const char *yymsg,
         delete ((*yyvaluep).select_stmt);
     }
 }
-#line 2135 "parser.cpp"
+#line 2150 "parser.cpp"
         break;
 
     case YYSYMBOL_select_clause_with_modifier: /* select_clause_with_modifier  */
@@ -2141,7 +2156,7 @@ yydestruct (const char *yymsg,
         delete ((*yyvaluep).select_stmt);
     }
 }
-#line 2145 "parser.cpp"
+#line 2160 "parser.cpp"
         break;
 
     case YYSYMBOL_select_clause_without_modifier_paren: /* select_clause_without_modifier_paren  */
@@ -2151,7 +2166,7 @@ yydestruct (const char *yymsg,
         delete ((*yyvaluep).select_stmt);
     }
 }
-#line 2155 "parser.cpp"
+#line 2170 "parser.cpp"
         break;
 
     case YYSYMBOL_select_clause_without_modifier: /* select_clause_without_modifier  */
@@ -2161,7 +2176,7 @@ yydestruct (const char *yymsg,
         delete ((*yyvaluep).select_stmt);
     }
 }
-#line 2165 "parser.cpp"
+#line 2180 "parser.cpp"
         break;
 
     case YYSYMBOL_order_by_clause: /* order_by_clause  */
@@ -2175,7 +2190,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).order_by_expr_list_t));
     }
 }
-#line 2179 "parser.cpp"
+#line 2194 "parser.cpp"
         break;
 
     case YYSYMBOL_order_by_expr_list: /* order_by_expr_list  */
@@ -2189,7 +2204,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).order_by_expr_list_t));
     }
 }
-#line 2193 "parser.cpp"
+#line 2208 "parser.cpp"
         break;
 
     case YYSYMBOL_order_by_expr: /* order_by_expr  */
@@ -2199,7 +2214,7 @@ yydestruct (const char *yymsg,
     delete ((*yyvaluep).order_by_expr_t)->expr_;
     delete ((*yyvaluep).order_by_expr_t);
 }
-#line 2203 "parser.cpp"
+#line 2218 "parser.cpp"
         break;
 
     case YYSYMBOL_limit_expr: /* limit_expr  */
@@ -2207,7 +2222,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2211 "parser.cpp"
+#line 2226 "parser.cpp"
         break;
 
     case YYSYMBOL_offset_expr: /* offset_expr  */
@@ -2215,7 +2230,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2219 "parser.cpp"
+#line 2234 "parser.cpp"
         break;
 
     case YYSYMBOL_from_clause: /* from_clause  */
@@ -2224,7 +2239,7 @@ yydestruct (const char *yymsg,
     fprintf(stderr, "destroy table reference\n");
     delete (((*yyvaluep).table_reference_t));
 }
-#line 2228 "parser.cpp"
+#line 2243 "parser.cpp"
         break;
 
     case YYSYMBOL_search_clause: /* search_clause  */
@@ -2232,7 +2247,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2236 "parser.cpp"
+#line 2251 "parser.cpp"
         break;
 
     case YYSYMBOL_where_clause: /* where_clause  */
@@ -2240,7 +2255,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2244 "parser.cpp"
+#line 2259 "parser.cpp"
         break;
 
     case YYSYMBOL_having_clause: /* having_clause  */
@@ -2248,7 +2263,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2252 "parser.cpp"
+#line 2267 "parser.cpp"
         break;
 
     case YYSYMBOL_group_by_clause: /* group_by_clause  */
@@ -2262,7 +2277,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).expr_array_t));
     }
 }
-#line 2266 "parser.cpp"
+#line 2281 "parser.cpp"
         break;
 
     case YYSYMBOL_table_reference: /* table_reference  */
@@ -2271,7 +2286,7 @@ yydestruct (const char *yymsg,
     fprintf(stderr, "destroy table reference\n");
     delete (((*yyvaluep).table_reference_t));
 }
-#line 2275 "parser.cpp"
+#line 2290 "parser.cpp"
         break;
 
     case YYSYMBOL_table_reference_unit: /* table_reference_unit  */
@@ -2280,7 +2295,7 @@ yydestruct (const char *yymsg,
     fprintf(stderr, "destroy table reference\n");
     delete (((*yyvaluep).table_reference_t));
 }
-#line 2284 "parser.cpp"
+#line 2299 "parser.cpp"
         break;
 
     case YYSYMBOL_table_reference_name: /* table_reference_name  */
@@ -2289,7 +2304,7 @@ yydestruct (const char *yymsg,
     fprintf(stderr, "destroy table reference\n");
     delete (((*yyvaluep).table_reference_t));
 }
-#line 2293 "parser.cpp"
+#line 2308 "parser.cpp"
         break;
 
     case YYSYMBOL_table_name: /* table_name  */
@@ -2302,7 +2317,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).table_name_t));
     }
 }
-#line 2306 "parser.cpp"
+#line 2321 "parser.cpp"
         break;
 
     case YYSYMBOL_table_alias: /* table_alias  */
@@ -2311,7 +2326,7 @@ yydestruct (const char *yymsg,
     fprintf(stderr, "destroy table alias\n");
     delete (((*yyvaluep).table_alias_t));
 }
-#line 2315 "parser.cpp"
+#line 2330 "parser.cpp"
         break;
 
     case YYSYMBOL_with_clause: /* with_clause  */
@@ -2325,7 +2340,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).with_expr_list_t));
     }
 }
-#line 2329 "parser.cpp"
+#line 2344 "parser.cpp"
         break;
 
     case YYSYMBOL_with_expr_list: /* with_expr_list  */
@@ -2339,7 +2354,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).with_expr_list_t));
     }
 }
-#line 2343 "parser.cpp"
+#line 2358 "parser.cpp"
         break;
 
     case YYSYMBOL_with_expr: /* with_expr  */
@@ -2349,7 +2364,7 @@ yydestruct (const char *yymsg,
     delete ((*yyvaluep).with_expr_t)->select_;
     delete ((*yyvaluep).with_expr_t);
 }
-#line 2353 "parser.cpp"
+#line 2368 "parser.cpp"
         break;
 
     case YYSYMBOL_join_clause: /* join_clause  */
@@ -2358,7 +2373,7 @@ yydestruct (const char *yymsg,
     fprintf(stderr, "destroy table reference\n");
     delete (((*yyvaluep).table_reference_t));
 }
-#line 2362 "parser.cpp"
+#line 2377 "parser.cpp"
         break;
 
     case YYSYMBOL_expr_array: /* expr_array  */
@@ -2372,7 +2387,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).expr_array_t));
     }
 }
-#line 2376 "parser.cpp"
+#line 2391 "parser.cpp"
         break;
 
     case YYSYMBOL_expr_array_list: /* expr_array_list  */
@@ -2389,7 +2404,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).expr_array_list_t));
     }
 }
-#line 2393 "parser.cpp"
+#line 2408 "parser.cpp"
         break;
 
     case YYSYMBOL_expr_alias: /* expr_alias  */
@@ -2397,7 +2412,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2401 "parser.cpp"
+#line 2416 "parser.cpp"
         break;
 
     case YYSYMBOL_expr: /* expr  */
@@ -2405,7 +2420,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2409 "parser.cpp"
+#line 2424 "parser.cpp"
         break;
 
     case YYSYMBOL_operand: /* operand  */
@@ -2413,7 +2428,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2417 "parser.cpp"
+#line 2432 "parser.cpp"
         break;
 
     case YYSYMBOL_knn_expr: /* knn_expr  */
@@ -2421,7 +2436,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2425 "parser.cpp"
+#line 2440 "parser.cpp"
         break;
 
     case YYSYMBOL_match_expr: /* match_expr  */
@@ -2429,7 +2444,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2433 "parser.cpp"
+#line 2448 "parser.cpp"
         break;
 
     case YYSYMBOL_query_expr: /* query_expr  */
@@ -2437,7 +2452,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2441 "parser.cpp"
+#line 2456 "parser.cpp"
         break;
 
     case YYSYMBOL_fusion_expr: /* fusion_expr  */
@@ -2445,7 +2460,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2449 "parser.cpp"
+#line 2464 "parser.cpp"
         break;
 
     case YYSYMBOL_sub_search_array: /* sub_search_array  */
@@ -2459,7 +2474,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).expr_array_t));
     }
 }
-#line 2463 "parser.cpp"
+#line 2478 "parser.cpp"
         break;
 
     case YYSYMBOL_function_expr: /* function_expr  */
@@ -2467,7 +2482,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2471 "parser.cpp"
+#line 2486 "parser.cpp"
         break;
 
     case YYSYMBOL_conjunction_expr: /* conjunction_expr  */
@@ -2475,7 +2490,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2479 "parser.cpp"
+#line 2494 "parser.cpp"
         break;
 
     case YYSYMBOL_between_expr: /* between_expr  */
@@ -2483,7 +2498,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2487 "parser.cpp"
+#line 2502 "parser.cpp"
         break;
 
     case YYSYMBOL_in_expr: /* in_expr  */
@@ -2491,7 +2506,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2495 "parser.cpp"
+#line 2510 "parser.cpp"
         break;
 
     case YYSYMBOL_case_expr: /* case_expr  */
@@ -2499,7 +2514,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2503 "parser.cpp"
+#line 2518 "parser.cpp"
         break;
 
     case YYSYMBOL_case_check_array: /* case_check_array  */
@@ -2512,7 +2527,7 @@ yydestruct (const char *yymsg,
         }
     }
 }
-#line 2516 "parser.cpp"
+#line 2531 "parser.cpp"
         break;
 
     case YYSYMBOL_cast_expr: /* cast_expr  */
@@ -2520,7 +2535,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2524 "parser.cpp"
+#line 2539 "parser.cpp"
         break;
 
     case YYSYMBOL_subquery_expr: /* subquery_expr  */
@@ -2528,7 +2543,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2532 "parser.cpp"
+#line 2547 "parser.cpp"
         break;
 
     case YYSYMBOL_column_expr: /* column_expr  */
@@ -2536,7 +2551,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2540 "parser.cpp"
+#line 2555 "parser.cpp"
         break;
 
     case YYSYMBOL_constant_expr: /* constant_expr  */
@@ -2544,7 +2559,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 2548 "parser.cpp"
+#line 2563 "parser.cpp"
         break;
 
     case YYSYMBOL_array_expr: /* array_expr  */
@@ -2552,7 +2567,15 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 2556 "parser.cpp"
+#line 2571 "parser.cpp"
+        break;
+
+    case YYSYMBOL_parameter_expr: /* parameter_expr  */
+#line 318 "parser.y"
+            {
+    delete (((*yyvaluep).const_expr_t));
+}
+#line 2579 "parser.cpp"
         break;
 
     case YYSYMBOL_long_array_expr: /* long_array_expr  */
@@ -2560,7 +2583,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 2564 "parser.cpp"
+#line 2587 "parser.cpp"
         break;
 
     case YYSYMBOL_unclosed_long_array_expr: /* unclosed_long_array_expr  */
@@ -2568,7 +2591,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 2572 "parser.cpp"
+#line 2595 "parser.cpp"
         break;
 
     case YYSYMBOL_double_array_expr: /* double_array_expr  */
@@ -2576,7 +2599,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 2580 "parser.cpp"
+#line 2603 "parser.cpp"
         break;
 
     case YYSYMBOL_unclosed_double_array_expr: /* unclosed_double_array_expr  */
@@ -2584,7 +2607,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 2588 "parser.cpp"
+#line 2611 "parser.cpp"
         break;
 
     case YYSYMBOL_interval_expr: /* interval_expr  */
@@ -2592,7 +2615,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 2596 "parser.cpp"
+#line 2619 "parser.cpp"
         break;
 
     case YYSYMBOL_file_path: /* file_path  */
@@ -2600,7 +2623,7 @@ yydestruct (const char *yymsg,
             {
     free(((*yyvaluep).str_value));
 }
-#line 2604 "parser.cpp"
+#line 2627 "parser.cpp"
         break;
 
     case YYSYMBOL_if_not_exists_info: /* if_not_exists_info  */
@@ -2611,7 +2634,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).if_not_exists_info_t));
     }
 }
-#line 2615 "parser.cpp"
+#line 2638 "parser.cpp"
         break;
 
     case YYSYMBOL_with_index_param_list: /* with_index_param_list  */
@@ -2625,7 +2648,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).with_index_param_list_t));
     }
 }
-#line 2629 "parser.cpp"
+#line 2652 "parser.cpp"
         break;
 
     case YYSYMBOL_optional_table_properties_list: /* optional_table_properties_list  */
@@ -2639,7 +2662,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).with_index_param_list_t));
     }
 }
-#line 2643 "parser.cpp"
+#line 2666 "parser.cpp"
         break;
 
     case YYSYMBOL_index_info_list: /* index_info_list  */
@@ -2653,7 +2676,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).index_info_list_t));
     }
 }
-#line 2657 "parser.cpp"
+#line 2680 "parser.cpp"
         break;
 
       default:
@@ -2761,7 +2784,7 @@ YYLTYPE yylloc = yyloc_default;
   yylloc.string_length = 0;
 }
 
-#line 2765 "parser.cpp"
+#line 2788 "parser.cpp"
 
   yylsp[0] = yylloc;
   goto yysetstate;
@@ -2976,7 +2999,7 @@ yyreduce:
                                          {
     result->statements_ptr_ = (yyvsp[-1].stmt_array);
 }
-#line 2980 "parser.cpp"
+#line 3003 "parser.cpp"
     break;
 
   case 3: /* statement_list: statement  */
@@ -2987,7 +3010,7 @@ yyreduce:
     (yyval.stmt_array) = new std::vector<infinity::BaseStatement*>();
     (yyval.stmt_array)->push_back((yyvsp[0].base_stmt));
 }
-#line 2991 "parser.cpp"
+#line 3014 "parser.cpp"
     break;
 
   case 4: /* statement_list: statement_list ';' statement  */
@@ -2998,145 +3021,145 @@ yyreduce:
     (yyvsp[-2].stmt_array)->push_back((yyvsp[0].base_stmt));
     (yyval.stmt_array) = (yyvsp[-2].stmt_array);
 }
-#line 3002 "parser.cpp"
+#line 3025 "parser.cpp"
     break;
 
   case 5: /* statement: create_statement  */
 #line 490 "parser.y"
                              { (yyval.base_stmt) = (yyvsp[0].create_stmt); }
-#line 3008 "parser.cpp"
+#line 3031 "parser.cpp"
     break;
 
   case 6: /* statement: drop_statement  */
 #line 491 "parser.y"
                  { (yyval.base_stmt) = (yyvsp[0].drop_stmt); }
-#line 3014 "parser.cpp"
+#line 3037 "parser.cpp"
     break;
 
   case 7: /* statement: copy_statement  */
 #line 492 "parser.y"
                  { (yyval.base_stmt) = (yyvsp[0].copy_stmt); }
-#line 3020 "parser.cpp"
+#line 3043 "parser.cpp"
     break;
 
   case 8: /* statement: show_statement  */
 #line 493 "parser.y"
                  { (yyval.base_stmt) = (yyvsp[0].show_stmt); }
-#line 3026 "parser.cpp"
+#line 3049 "parser.cpp"
     break;
 
   case 9: /* statement: select_statement  */
 #line 494 "parser.y"
                    { (yyval.base_stmt) = (yyvsp[0].select_stmt); }
-#line 3032 "parser.cpp"
+#line 3055 "parser.cpp"
     break;
 
   case 10: /* statement: delete_statement  */
 #line 495 "parser.y"
                    { (yyval.base_stmt) = (yyvsp[0].delete_stmt); }
-#line 3038 "parser.cpp"
+#line 3061 "parser.cpp"
     break;
 
   case 11: /* statement: update_statement  */
 #line 496 "parser.y"
                    { (yyval.base_stmt) = (yyvsp[0].update_stmt); }
-#line 3044 "parser.cpp"
+#line 3067 "parser.cpp"
     break;
 
   case 12: /* statement: insert_statement  */
 #line 497 "parser.y"
                    { (yyval.base_stmt) = (yyvsp[0].insert_stmt); }
-#line 3050 "parser.cpp"
+#line 3073 "parser.cpp"
     break;
 
   case 13: /* statement: explain_statement  */
 #line 498 "parser.y"
                     { (yyval.base_stmt) = (yyvsp[0].explain_stmt); }
-#line 3056 "parser.cpp"
+#line 3079 "parser.cpp"
     break;
 
   case 14: /* statement: flush_statement  */
 #line 499 "parser.y"
                   { (yyval.base_stmt) = (yyvsp[0].flush_stmt); }
-#line 3062 "parser.cpp"
+#line 3085 "parser.cpp"
     break;
 
   case 15: /* statement: optimize_statement  */
 #line 500 "parser.y"
                      { (yyval.base_stmt) = (yyvsp[0].optimize_stmt); }
-#line 3068 "parser.cpp"
+#line 3091 "parser.cpp"
     break;
 
   case 16: /* statement: command_statement  */
 #line 501 "parser.y"
                     { (yyval.base_stmt) = (yyvsp[0].command_stmt); }
-#line 3074 "parser.cpp"
+#line 3097 "parser.cpp"
     break;
 
   case 17: /* explainable_statement: create_statement  */
 #line 503 "parser.y"
                                          { (yyval.base_stmt) = (yyvsp[0].create_stmt); }
-#line 3080 "parser.cpp"
+#line 3103 "parser.cpp"
     break;
 
   case 18: /* explainable_statement: drop_statement  */
 #line 504 "parser.y"
                  { (yyval.base_stmt) = (yyvsp[0].drop_stmt); }
-#line 3086 "parser.cpp"
+#line 3109 "parser.cpp"
     break;
 
   case 19: /* explainable_statement: copy_statement  */
 #line 505 "parser.y"
                  { (yyval.base_stmt) = (yyvsp[0].copy_stmt); }
-#line 3092 "parser.cpp"
+#line 3115 "parser.cpp"
     break;
 
   case 20: /* explainable_statement: show_statement  */
 #line 506 "parser.y"
                  { (yyval.base_stmt) = (yyvsp[0].show_stmt); }
-#line 3098 "parser.cpp"
+#line 3121 "parser.cpp"
     break;
 
   case 21: /* explainable_statement: select_statement  */
 #line 507 "parser.y"
                    { (yyval.base_stmt) = (yyvsp[0].select_stmt); }
-#line 3104 "parser.cpp"
+#line 3127 "parser.cpp"
     break;
 
   case 22: /* explainable_statement: delete_statement  */
 #line 508 "parser.y"
                    { (yyval.base_stmt) = (yyvsp[0].delete_stmt); }
-#line 3110 "parser.cpp"
+#line 3133 "parser.cpp"
     break;
 
   case 23: /* explainable_statement: update_statement  */
 #line 509 "parser.y"
                    { (yyval.base_stmt) = (yyvsp[0].update_stmt); }
-#line 3116 "parser.cpp"
+#line 3139 "parser.cpp"
     break;
 
   case 24: /* explainable_statement: insert_statement  */
 #line 510 "parser.y"
                    { (yyval.base_stmt) = (yyvsp[0].insert_stmt); }
-#line 3122 "parser.cpp"
+#line 3145 "parser.cpp"
     break;
 
   case 25: /* explainable_statement: flush_statement  */
 #line 511 "parser.y"
                   { (yyval.base_stmt) = (yyvsp[0].flush_stmt); }
-#line 3128 "parser.cpp"
+#line 3151 "parser.cpp"
     break;
 
   case 26: /* explainable_statement: optimize_statement  */
 #line 512 "parser.y"
                      { (yyval.base_stmt) = (yyvsp[0].optimize_stmt); }
-#line 3134 "parser.cpp"
+#line 3157 "parser.cpp"
     break;
 
   case 27: /* explainable_statement: command_statement  */
 #line 513 "parser.y"
                     { (yyval.base_stmt) = (yyvsp[0].command_stmt); }
-#line 3140 "parser.cpp"
+#line 3163 "parser.cpp"
     break;
 
   case 28: /* create_statement: CREATE DATABASE if_not_exists IDENTIFIER  */
@@ -3156,7 +3179,7 @@ yyreduce:
     (yyval.create_stmt)->create_info_ = create_schema_info;
     (yyval.create_stmt)->create_info_->conflict_type_ = (yyvsp[-1].bool_value) ? infinity::ConflictType::kIgnore : infinity::ConflictType::kError;
 }
-#line 3160 "parser.cpp"
+#line 3183 "parser.cpp"
     break;
 
   case 29: /* create_statement: CREATE COLLECTION if_not_exists table_name  */
@@ -3174,7 +3197,7 @@ yyreduce:
     (yyval.create_stmt)->create_info_->conflict_type_ = (yyvsp[-1].bool_value) ? infinity::ConflictType::kIgnore : infinity::ConflictType::kError;
     delete (yyvsp[0].table_name_t);
 }
-#line 3178 "parser.cpp"
+#line 3201 "parser.cpp"
     break;
 
   case 30: /* create_statement: CREATE TABLE if_not_exists table_name '(' table_element_array ')' optional_table_properties_list  */
@@ -3207,7 +3230,7 @@ yyreduce:
     (yyval.create_stmt)->create_info_ = create_table_info;
     (yyval.create_stmt)->create_info_->conflict_type_ = (yyvsp[-5].bool_value) ? infinity::ConflictType::kIgnore : infinity::ConflictType::kError;
 }
-#line 3211 "parser.cpp"
+#line 3234 "parser.cpp"
     break;
 
   case 31: /* create_statement: CREATE TABLE if_not_exists table_name AS select_statement  */
@@ -3227,11 +3250,45 @@ yyreduce:
     create_table_info->select_ = (yyvsp[0].select_stmt);
     (yyval.create_stmt)->create_info_ = create_table_info;
 }
-#line 3231 "parser.cpp"
+#line 3254 "parser.cpp"
     break;
 
-  case 32: /* create_statement: CREATE VIEW if_not_exists table_name optional_identifier_array AS select_statement  */
+  case 32: /* create_statement: CREATE TABLE if_not_exists table_name IDENTIFIER table_name  */
 #line 598 "parser.y"
+                                                              {
+    bool is_clone = strcasecmp((yyvsp[-1].str_value), "clone") == 0;
+    free((yyvsp[-1].str_value));
+    (yyval.create_stmt) = new infinity::CreateStatement();
+    std::shared_ptr<infinity::CreateTableInfo> create_table_info = std::make_shared<infinity::CreateTableInfo>();
+    if((yyvsp[-2].table_name_t)->schema_name_ptr_ != nullptr) {
+        create_table_info->schema_name_ = (yyvsp[-2].table_name_t)->schema_name_ptr_;
+        free((yyvsp[-2].table_name_t)->schema_name_ptr_);
+    }
+    create_table_info->table_name_ = (yyvsp[-2].table_name_t)->table_name_ptr_;
+    free((yyvsp[-2].table_name_t)->table_name_ptr_);
+    delete (yyvsp[-2].table_name_t);
+
+    if((yyvsp[0].table_name_t)->schema_name_ptr_ != nullptr) {
+        create_table_info->clone_schema_name_ = (yyvsp[0].table_name_t)->schema_name_ptr_;
+        free((yyvsp[0].table_name_t)->schema_name_ptr_);
+    }
+    create_table_info->clone_table_name_ = (yyvsp[0].table_name_t)->table_name_ptr_;
+    free((yyvsp[0].table_name_t)->table_name_ptr_);
+    delete (yyvsp[0].table_name_t);
+
+    create_table_info->conflict_type_ = (yyvsp[-3].bool_value) ? infinity::ConflictType::kIgnore : infinity::ConflictType::kError;
+    (yyval.create_stmt)->create_info_ = create_table_info;
+    if (!is_clone) {
+        delete (yyval.create_stmt);
+        yyerror(&yyloc, scanner, result, "Unknown create table option");
+        YYERROR;
+    }
+}
+#line 3288 "parser.cpp"
+    break;
+
+  case 33: /* create_statement: CREATE VIEW if_not_exists table_name optional_identifier_array AS select_statement  */
+#line 628 "parser.y"
                                                                                      {
     (yyval.create_stmt) = new infinity::CreateStatement();
     std::shared_ptr<infinity::CreateViewInfo> create_view_info = std::make_shared<infinity::CreateViewInfo>();
@@ -3248,11 +3305,11 @@ yyreduce:
     create_view_info->conflict_type_ = (yyvsp[-4].bool_value) ? infinity::ConflictType::kIgnore : infinity::ConflictType::kError;
     (yyval.create_stmt)->create_info_ = create_view_info;
 }
-#line 3252 "parser.cpp"
+#line 3309 "parser.cpp"
     break;
 
-  case 33: /* create_statement: CREATE INDEX if_not_exists_info ON table_name index_info_list  */
-#line 616 "parser.y"
+  case 34: /* create_statement: CREATE INDEX if_not_exists_info ON table_name index_info_list  */
+#line 646 "parser.y"
                                                                 {
     std::shared_ptr<infinity::CreateIndexInfo> create_index_info = std::make_shared<infinity::CreateIndexInfo>();
     if((yyvsp[-1].table_name_t)->schema_name_ptr_ != nullptr) {
@@ -3281,45 +3338,45 @@ yyreduce:
     (yyval.create_stmt) = new infinity::CreateStatement();
     (yyval.create_stmt)->create_info_ = create_index_info;
 }
-#line 3285 "parser.cpp"
+#line 3342 "parser.cpp"
     break;
 
-  case 34: /* table_element_array: table_element  */
-#line 645 "parser.y"
+  case 35: /* table_element_array: table_element  */
+#line 675 "parser.y"
                                     {
     (yyval.table_element_array_t) = new std::vector<infinity::TableElement*>();
     (yyval.table_element_array_t)->push_back((yyvsp[0].table_element_t));
 }
-#line 3294 "parser.cpp"
+#line 3351 "parser.cpp"
     break;
 
-  case 35: /* table_element_array: table_element_array ',' table_element  */
-#line 649 "parser.y"
+  case 36: /* table_element_array: table_element_array ',' table_element  */
+#line 679 "parser.y"
                                         {
     (yyvsp[-2].table_element_array_t)->push_back((yyvsp[0].table_element_t));
     (yyval.table_element_array_t) = (yyvsp[-2].table_element_array_t);
 }
-#line 3303 "parser.cpp"
+#line 3360 "parser.cpp"
     break;
 
-  case 36: /* table_element: table_column  */
-#line 655 "parser.y"
+  case 37: /* table_element: table_column  */
+#line 685 "parser.y"
                              {
     (yyval.table_element_t) = (yyvsp[0].table_column_t);
 }
-#line 3311 "parser.cpp"
+#line 3368 "parser.cpp"
     break;
 
-  case 37: /* table_element: table_constraint  */
-#line 658 "parser.y"
+  case 38: /* table_element: table_constraint  */
+#line 688 "parser.y"
                    {
     (yyval.table_element_t) = (yyvsp[0].table_constraint_t);
 }
-#line 3319 "parser.cpp"
+#line 3376 "parser.cpp"
     break;
 
-  case 38: /* table_column: IDENTIFIER column_type  */
-#line 664 "parser.y"
+  case 39: /* table_column: IDENTIFIER column_type  */
+#line 694 "parser.y"
                        {
     std::shared_ptr<infinity::TypeInfo> type_info_ptr{nullptr};
     switch((yyvsp[0].column_type_t).logical_type_) {
@@ -3355,11 +3412,11 @@ yyreduce:
     }
     */
 }
-#line 3359 "parser.cpp"
+#line 3416 "parser.cpp"
     break;
 
-  case 39: /* table_column: IDENTIFIER column_type column_constraints  */
-#line 699 "parser.y"
+  case 40: /* table_column: IDENTIFIER column_type column_constraints  */
+#line 729 "parser.y"
                                             {
     std::shared_ptr<infinity::TypeInfo> type_info_ptr{nullptr};
     switch((yyvsp[-1].column_type_t).logical_type_) {
@@ -3392,260 +3449,260 @@ yyreduce:
     }
     */
 }
-#line 3396 "parser.cpp"
+#line 3453 "parser.cpp"
     break;
 
-  case 40: /* column_type: BOOLEAN  */
-#line 733 "parser.y"
+  case 41: /* column_type: BOOLEAN  */
+#line 763 "parser.y"
         { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kBoolean, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3402 "parser.cpp"
+#line 3459 "parser.cpp"
     break;
 
-  case 41: /* column_type: TINYINT  */
-#line 734 "parser.y"
+  case 42: /* column_type: TINYINT  */
+#line 764 "parser.y"
           { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTinyInt, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3408 "parser.cpp"
+#line 3465 "parser.cpp"
     break;
 
-  case 42: /* column_type: SMALLINT  */
-#line 735 "parser.y"
+  case 43: /* column_type: SMALLINT  */
+#line 765 "parser.y"
            { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kSmallInt, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3414 "parser.cpp"
+#line 3471 "parser.cpp"
     break;
 
-  case 43: /* column_type: INTEGER  */
-#line 736 "parser.y"
+  case 44: /* column_type: INTEGER  */
+#line 766 "parser.y"
           { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kInteger, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3420 "parser.cpp"
+#line 3477 "parser.cpp"
     break;
 
-  case 44: /* column_type: INT  */
-#line 737 "parser.y"
+  case 45: /* column_type: INT  */
+#line 767 "parser.y"
       { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kInteger, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3426 "parser.cpp"
+#line 3483 "parser.cpp"
     break;
 
-  case 45: /* column_type: BIGINT  */
-#line 738 "parser.y"
+  case 46: /* column_type: BIGINT  */
+#line 768 "parser.y"
          { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kBigInt, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3432 "parser.cpp"
+#line 3489 "parser.cpp"
     break;
 
-  case 46: /* column_type: HUGEINT  */
-#line 739 "parser.y"
+  case 47: /* column_type: HUGEINT  */
+#line 769 "parser.y"
           { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kHugeInt, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3438 "parser.cpp"
+#line 3495 "parser.cpp"
     break;
 
-  case 47: /* column_type: FLOAT  */
-#line 740 "parser.y"
+  case 48: /* column_type: FLOAT  */
+#line 770 "parser.y"
         { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kFloat, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3444 "parser.cpp"
+#line 3501 "parser.cpp"
     break;
 
-  case 48: /* column_type: REAL  */
-#line 741 "parser.y"
+  case 49: /* column_type: REAL  */
+#line 771 "parser.y"
         { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kFloat, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3450 "parser.cpp"
+#line 3507 "parser.cpp"
     break;
 
-  case 49: /* column_type: DOUBLE  */
-#line 742 "parser.y"
+  case 50: /* column_type: DOUBLE  */
+#line 772 "parser.y"
          { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kDouble, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3456 "parser.cpp"
+#line 3513 "parser.cpp"
     break;
 
-  case 50: /* column_type: DATE  */
-#line 743 "parser.y"
+  case 51: /* column_type: DATE  */
+#line 773 "parser.y"
        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kDate, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3462 "parser.cpp"
+#line 3519 "parser.cpp"
     break;
 
-  case 51: /* column_type: TIME  */
-#line 744 "parser.y"
+  case 52: /* column_type: TIME  */
+#line 774 "parser.y"
        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTime, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3468 "parser.cpp"
+#line 3525 "parser.cpp"
     break;
 
-  case 52: /* column_type: DATETIME  */
-#line 745 "parser.y"
+  case 53: /* column_type: DATETIME  */
+#line 775 "parser.y"
            { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kDateTime, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3474 "parser.cpp"
+#line 3531 "parser.cpp"
     break;
 
-  case 53: /* column_type: TIMESTAMP  */
-#line 746 "parser.y"
+  case 54: /* column_type: TIMESTAMP  */
+#line 776 "parser.y"
             { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTimestamp, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3480 "parser.cpp"
+#line 3537 "parser.cpp"
     break;
 
-  case 54: /* column_type: UUID  */
-#line 747 "parser.y"
+  case 55: /* column_type: UUID  */
+#line 777 "parser.y"
        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kUuid, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3486 "parser.cpp"
+#line 3543 "parser.cpp"
     break;
 
-  case 55: /* column_type: POINT  */
-#line 748 "parser.y"
+  case 56: /* column_type: POINT  */
+#line 778 "parser.y"
         { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kPoint, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3492 "parser.cpp"
+#line 3549 "parser.cpp"
     break;
 
-  case 56: /* column_type: LINE  */
-#line 749 "parser.y"
+  case 57: /* column_type: LINE  */
+#line 779 "parser.y"
        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kLine, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3498 "parser.cpp"
+#line 3555 "parser.cpp"
     break;
 
-  case 57: /* column_type: LSEG  */
-#line 750 "parser.y"
+  case 58: /* column_type: LSEG  */
+#line 780 "parser.y"
        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kLineSeg, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3504 "parser.cpp"
+#line 3561 "parser.cpp"
     break;
 
-  case 58: /* column_type: BOX  */
-#line 751 "parser.y"
+  case 59: /* column_type: BOX  */
+#line 781 "parser.y"
       { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kBox, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3510 "parser.cpp"
+#line 3567 "parser.cpp"
     break;
 
-  case 59: /* column_type: CIRCLE  */
-#line 754 "parser.y"
+  case 60: /* column_type: CIRCLE  */
+#line 784 "parser.y"
          { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kCircle, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3516 "parser.cpp"
+#line 3573 "parser.cpp"
     break;
 
-  case 60: /* column_type: VARCHAR  */
-#line 756 "parser.y"
+  case 61: /* column_type: VARCHAR  */
+#line 786 "parser.y"
           { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kVarchar, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3522 "parser.cpp"
+#line 3579 "parser.cpp"
     break;
 
-  case 61: /* column_type: DECIMAL '(' LONG_VALUE ',' LONG_VALUE ')'  */
-#line 757 "parser.y"
+  case 62: /* column_type: DECIMAL '(' LONG_VALUE ',' LONG_VALUE ')'  */
+#line 787 "parser.y"
                                             { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kDecimal, 0, (yyvsp[-3].long_value), (yyvsp[-1].long_value), infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3528 "parser.cpp"
+#line 3585 "parser.cpp"
     break;
 
-  case 62: /* column_type: DECIMAL '(' LONG_VALUE ')'  */
-#line 758 "parser.y"
+  case 63: /* column_type: DECIMAL '(' LONG_VALUE ')'  */
+#line 788 "parser.y"
                              { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kDecimal, 0, (yyvsp[-1].long_value), 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3534 "parser.cpp"
+#line 3591 "parser.cpp"
     break;
 
-  case 63: /* column_type: DECIMAL  */
-#line 759 "parser.y"
+  case 64: /* column_type: DECIMAL  */
+#line 789 "parser.y"
           { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kDecimal, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3540 "parser.cpp"
+#line 3597 "parser.cpp"
     break;
 
-  case 64: /* column_type: EMBEDDING '(' BIT ',' LONG_VALUE ')'  */
-#line 762 "parser.y"
+  case 65: /* column_type: EMBEDDING '(' BIT ',' LONG_VALUE ')'  */
+#line 792 "parser.y"
                                        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemBit}; }
-#line 3546 "parser.cpp"
+#line 3603 "parser.cpp"
     break;
 
-  case 65: /* column_type: EMBEDDING '(' TINYINT ',' LONG_VALUE ')'  */
-#line 763 "parser.y"
+  case 66: /* column_type: EMBEDDING '(' TINYINT ',' LONG_VALUE ')'  */
+#line 793 "parser.y"
                                            { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt8}; }
-#line 3552 "parser.cpp"
+#line 3609 "parser.cpp"
     break;
 
-  case 66: /* column_type: EMBEDDING '(' SMALLINT ',' LONG_VALUE ')'  */
-#line 764 "parser.y"
+  case 67: /* column_type: EMBEDDING '(' SMALLINT ',' LONG_VALUE ')'  */
+#line 794 "parser.y"
                                             { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt16}; }
-#line 3558 "parser.cpp"
+#line 3615 "parser.cpp"
     break;
 
-  case 67: /* column_type: EMBEDDING '(' INTEGER ',' LONG_VALUE ')'  */
-#line 765 "parser.y"
+  case 68: /* column_type: EMBEDDING '(' INTEGER ',' LONG_VALUE ')'  */
+#line 795 "parser.y"
                                            { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt32}; }
-#line 3564 "parser.cpp"
+#line 3621 "parser.cpp"
     break;
 
-  case 68: /* column_type: EMBEDDING '(' INT ',' LONG_VALUE ')'  */
-#line 766 "parser.y"
+  case 69: /* column_type: EMBEDDING '(' INT ',' LONG_VALUE ')'  */
+#line 796 "parser.y"
                                        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt32}; }
-#line 3570 "parser.cpp"
+#line 3627 "parser.cpp"
     break;
 
-  case 69: /* column_type: EMBEDDING '(' BIGINT ',' LONG_VALUE ')'  */
-#line 767 "parser.y"
+  case 70: /* column_type: EMBEDDING '(' BIGINT ',' LONG_VALUE ')'  */
+#line 797 "parser.y"
                                           { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt64}; }
-#line 3576 "parser.cpp"
+#line 3633 "parser.cpp"
     break;
 
-  case 70: /* column_type: EMBEDDING '(' FLOAT ',' LONG_VALUE ')'  */
-#line 768 "parser.y"
+  case 71: /* column_type: EMBEDDING '(' FLOAT ',' LONG_VALUE ')'  */
+#line 798 "parser.y"
                                          { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemFloat}; }
-#line 3582 "parser.cpp"
+#line 3639 "parser.cpp"
     break;
 
-  case 71: /* column_type: EMBEDDING '(' DOUBLE ',' LONG_VALUE ')'  */
-#line 769 "parser.y"
+  case 72: /* column_type: EMBEDDING '(' DOUBLE ',' LONG_VALUE ')'  */
+#line 799 "parser.y"
                                           { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemDouble}; }
-#line 3588 "parser.cpp"
+#line 3645 "parser.cpp"
     break;
 
-  case 72: /* column_type: VECTOR '(' BIT ',' LONG_VALUE ')'  */
-#line 770 "parser.y"
+  case 73: /* column_type: VECTOR '(' BIT ',' LONG_VALUE ')'  */
+#line 800 "parser.y"
                                     { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemBit}; }
-#line 3594 "parser.cpp"
+#line 3651 "parser.cpp"
     break;
 
-  case 73: /* column_type: VECTOR '(' TINYINT ',' LONG_VALUE ')'  */
-#line 771 "parser.y"
+  case 74: /* column_type: VECTOR '(' TINYINT ',' LONG_VALUE ')'  */
+#line 801 "parser.y"
                                         { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt8}; }
-#line 3600 "parser.cpp"
+#line 3657 "parser.cpp"
     break;
 
-  case 74: /* column_type: VECTOR '(' SMALLINT ',' LONG_VALUE ')'  */
-#line 772 "parser.y"
+  case 75: /* column_type: VECTOR '(' SMALLINT ',' LONG_VALUE ')'  */
+#line 802 "parser.y"
                                          { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt16}; }
-#line 3606 "parser.cpp"
+#line 3663 "parser.cpp"
     break;
 
-  case 75: /* column_type: VECTOR '(' INTEGER ',' LONG_VALUE ')'  */
-#line 773 "parser.y"
+  case 76: /* column_type: VECTOR '(' INTEGER ',' LONG_VALUE ')'  */
+#line 803 "parser.y"
                                         { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt32}; }
-#line 3612 "parser.cpp"
+#line 3669 "parser.cpp"
     break;
 
-  case 76: /* column_type: VECTOR '(' INT ',' LONG_VALUE ')'  */
-#line 774 "parser.y"
+  case 77: /* column_type: VECTOR '(' INT ',' LONG_VALUE ')'  */
+#line 804 "parser.y"
                                     { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt32}; }
-#line 3618 "parser.cpp"
+#line 3675 "parser.cpp"
     break;
 
-  case 77: /* column_type: VECTOR '(' BIGINT ',' LONG_VALUE ')'  */
-#line 775 "parser.y"
+  case 78: /* column_type: VECTOR '(' BIGINT ',' LONG_VALUE ')'  */
+#line 805 "parser.y"
                                        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt64}; }
-#line 3624 "parser.cpp"
+#line 3681 "parser.cpp"
     break;
 
-  case 78: /* column_type: VECTOR '(' FLOAT ',' LONG_VALUE ')'  */
-#line 776 "parser.y"
+  case 79: /* column_type: VECTOR '(' FLOAT ',' LONG_VALUE ')'  */
+#line 806 "parser.y"
                                       { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemFloat}; }
-#line 3630 "parser.cpp"
+#line 3687 "parser.cpp"
     break;
 
-  case 79: /* column_type: VECTOR '(' DOUBLE ',' LONG_VALUE ')'  */
-#line 777 "parser.y"
+  case 80: /* column_type: VECTOR '(' DOUBLE ',' LONG_VALUE ')'  */
+#line 807 "parser.y"
                                        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemDouble}; }
-#line 3636 "parser.cpp"
+#line 3693 "parser.cpp"
     break;
 
-  case 80: /* column_constraints: column_constraint  */
-#line 796 "parser.y"
+  case 81: /* column_constraints: column_constraint  */
+#line 826 "parser.y"
                                        {
     (yyval.column_constraints_t) = new std::unordered_set<infinity::ConstraintType>();
     (yyval.column_constraints_t)->insert((yyvsp[0].column_constraint_t));
 }
-#line 3645 "parser.cpp"
+#line 3702 "parser.cpp"
     break;
 
-  case 81: /* column_constraints: column_constraints column_constraint  */
-#line 800 "parser.y"
+  case 82: /* column_constraints: column_constraints column_constraint  */
+#line 830 "parser.y"
                                        {
     if((yyvsp[-1].column_constraints_t)->contains((yyvsp[0].column_constraint_t))) {
         yyerror(&yyloc, scanner, result, "Duplicate column constraint.");
@@ -3655,85 +3712,85 @@ yyreduce:
     (yyvsp[-1].column_constraints_t)->insert((yyvsp[0].column_constraint_t));
     (yyval.column_constraints_t) = (yyvsp[-1].column_constraints_t);
 }
-#line 3659 "parser.cpp"
+#line 3716 "parser.cpp"
     break;
 
-  case 82: /* column_constraint: PRIMARY KEY  */
-#line 810 "parser.y"
+  case 83: /* column_constraint: PRIMARY KEY  */
+#line 840 "parser.y"
                                 {
     (yyval.column_constraint_t) = infinity::ConstraintType::kPrimaryKey;
 }
-#line 3667 "parser.cpp"
+#line 3724 "parser.cpp"
     break;
 
-  case 83: /* column_constraint: UNIQUE  */
-#line 813 "parser.y"
+  case 84: /* column_constraint: UNIQUE  */
+#line 843 "parser.y"
          {
     (yyval.column_constraint_t) = infinity::ConstraintType::kUnique;
 }
-#line 3675 "parser.cpp"
+#line 3732 "parser.cpp"
     break;
 
-  case 84: /* column_constraint: NULLABLE  */
-#line 816 "parser.y"
+  case 85: /* column_constraint: NULLABLE  */
+#line 846 "parser.y"
            {
     (yyval.column_constraint_t) = infinity::ConstraintType::kNull;
 }
-#line 3683 "parser.cpp"
+#line 3740 "parser.cpp"
     break;
 
-  case 85: /* column_constraint: NOT NULLABLE  */
-#line 819 "parser.y"
+  case 86: /* column_constraint: NOT NULLABLE  */
+#line 849 "parser.y"
                {
     (yyval.column_constraint_t) = infinity::ConstraintType::kNotNull;
 }
-#line 3691 "parser.cpp"
+#line 3748 "parser.cpp"
     break;
 
-  case 86: /* table_constraint: PRIMARY KEY '(' identifier_array ')'  */
-#line 823 "parser.y"
+  case 87: /* table_constraint: PRIMARY KEY '(' identifier_array ')'  */
+#line 853 "parser.y"
                                                         {
     (yyval.table_constraint_t) = new infinity::TableConstraint();
     (yyval.table_constraint_t)->names_ptr_ = (yyvsp[-1].identifier_array_t);
     (yyval.table_constraint_t)->constraint_ = infinity::ConstraintType::kPrimaryKey;
 }
-#line 3701 "parser.cpp"
+#line 3758 "parser.cpp"
     break;
 
-  case 87: /* table_constraint: UNIQUE '(' identifier_array ')'  */
-#line 828 "parser.y"
+  case 88: /* table_constraint: UNIQUE '(' identifier_array ')'  */
+#line 858 "parser.y"
                                   {
     (yyval.table_constraint_t) = new infinity::TableConstraint();
     (yyval.table_constraint_t)->names_ptr_ = (yyvsp[-1].identifier_array_t);
     (yyval.table_constraint_t)->constraint_ = infinity::ConstraintType::kUnique;
 }
-#line 3711 "parser.cpp"
+#line 3768 "parser.cpp"
     break;
 
-  case 88: /* identifier_array: IDENTIFIER  */
-#line 835 "parser.y"
+  case 89: /* identifier_array: IDENTIFIER  */
+#line 865 "parser.y"
                               {
     (yyval.identifier_array_t) = new std::vector<std::string>();
     ParserHelper::ToLower((yyvsp[0].str_value));
     (yyval.identifier_array_t)->emplace_back((yyvsp[0].str_value));
     free((yyvsp[0].str_value));
 }
-#line 3722 "parser.cpp"
+#line 3779 "parser.cpp"
     break;
 
-  case 89: /* identifier_array: identifier_array ',' IDENTIFIER  */
-#line 841 "parser.y"
+  case 90: /* identifier_array: identifier_array ',' IDENTIFIER  */
+#line 871 "parser.y"
                                   {
     ParserHelper::ToLower((yyvsp[0].str_value));
     (yyvsp[-2].identifier_array_t)->emplace_back((yyvsp[0].str_value));
     free((yyvsp[0].str_value));
     (yyval.identifier_array_t) = (yyvsp[-2].identifier_array_t);
 }
-#line 3733 "parser.cpp"
+#line 3790 "parser.cpp"
     break;
 
-  case 90: /* delete_statement: DELETE FROM table_name where_clause  */
-#line 851 "parser.y"
+  case 91: /* delete_statement: DELETE FROM table_name where_clause  */
+#line 881 "parser.y"
                                                        {
     (yyval.delete_stmt) = new infinity::DeleteStatement();
 
@@ -3746,11 +3803,11 @@ yyreduce:
     delete (yyvsp[-1].table_name_t);
     (yyval.delete_stmt)->where_expr_ = (yyvsp[0].expr_t);
 }
-#line 3750 "parser.cpp"
+#line 3807 "parser.cpp"
     break;
 
-  case 91: /* insert_statement: INSERT INTO table_name optional_identifier_array VALUES expr_array_list  */
-#line 867 "parser.y"
+  case 92: /* insert_statement: INSERT INTO table_name optional_identifier_array VALUES expr_array_list  */
+#line 897 "parser.y"
                                                                                           {
     bool is_error{false};
     for (auto expr_array : *(yyvsp[0].expr_array_list_t)) {
@@ -3785,11 +3842,11 @@ yyreduce:
     (yyval.insert_stmt)->columns_ = (yyvsp[-2].identifier_array_t);
     (yyval.insert_stmt)->values_ = (yyvsp[0].expr_array_list_t);
 }
-#line 3789 "parser.cpp"
+#line 3846 "parser.cpp"
     break;
 
-  case 92: /* insert_statement: INSERT INTO table_name optional_identifier_array select_without_paren  */
-#line 901 "parser.y"
+  case 93: /* insert_statement: INSERT INTO table_name optional_identifier_array select_without_paren  */
+#line 931 "parser.y"
                                                                         {
     (yyval.insert_stmt) = new infinity::InsertStatement();
     if((yyvsp[-2].table_name_t)->schema_name_ptr_ != nullptr) {
@@ -3802,101 +3859,101 @@ yyreduce:
     (yyval.insert_stmt)->columns_ = (yyvsp[-1].identifier_array_t);
     (yyval.insert_stmt)->select_ = (yyvsp[0].select_stmt);
 }
-#line 3806 "parser.cpp"
+#line 3863 "parser.cpp"
     break;
 
-  case 93: /* optional_identifier_array: '(' identifier_array ')'  */
-#line 914 "parser.y"
+  case 94: /* optional_identifier_array: '(' identifier_array ')'  */
+#line 944 "parser.y"
                                                     {
     (yyval.identifier_array_t) = (yyvsp[-1].identifier_array_t);
 }
-#line 3814 "parser.cpp"
+#line 3871 "parser.cpp"
     break;
 
-  case 94: /* optional_identifier_array: %empty  */
-#line 917 "parser.y"
+  case 95: /* optional_identifier_array: %empty  */
+#line 947 "parser.y"
   {
     (yyval.identifier_array_t) = nullptr;
 }
-#line 3822 "parser.cpp"
+#line 3879 "parser.cpp"
     break;
 
-  case 95: /* explain_statement: EXPLAIN explain_type explainable_statement  */
-#line 924 "parser.y"
+  case 96: /* explain_statement: EXPLAIN explain_type explainable_statement  */
+#line 954 "parser.y"
                                                                {
     (yyval.explain_stmt) = new infinity::ExplainStatement();
     (yyval.explain_stmt)->type_ = (yyvsp[-1].explain_type_t);
     (yyval.explain_stmt)->statement_ = (yyvsp[0].base_stmt);
 }
-#line 3832 "parser.cpp"
+#line 3889 "parser.cpp"
     break;
 
-  case 96: /* explain_type: ANALYZE  */
-#line 930 "parser.y"
+  case 97: /* explain_type: ANALYZE  */
+#line 960 "parser.y"
                       {
     (yyval.explain_type_t) = infinity::ExplainType::kAnalyze;
 }
-#line 3840 "parser.cpp"
+#line 3897 "parser.cpp"
     break;
 
-  case 97: /* explain_type: AST  */
-#line 933 "parser.y"
+  case 98: /* explain_type: AST  */
+#line 963 "parser.y"
       {
     (yyval.explain_type_t) = infinity::ExplainType::kAst;
 }
-#line 3848 "parser.cpp"
+#line 3905 "parser.cpp"
     break;
 
-  case 98: /* explain_type: RAW  */
-#line 936 "parser.y"
+  case 99: /* explain_type: RAW  */
+#line 966 "parser.y"
       {
     (yyval.explain_type_t) = infinity::ExplainType::kUnOpt;
 }
-#line 3856 "parser.cpp"
+#line 3913 "parser.cpp"
     break;
 
-  case 99: /* explain_type: LOGICAL  */
-#line 939 "parser.y"
+  case 100: /* explain_type: LOGICAL  */
+#line 969 "parser.y"
           {
     (yyval.explain_type_t) = infinity::ExplainType::kOpt;
 }
-#line 3864 "parser.cpp"
+#line 3921 "parser.cpp"
     break;
 
-  case 100: /* explain_type: PHYSICAL  */
-#line 942 "parser.y"
+  case 101: /* explain_type: PHYSICAL  */
+#line 972 "parser.y"
            {
     (yyval.explain_type_t) = infinity::ExplainType::kPhysical;
 }
-#line 3872 "parser.cpp"
+#line 3929 "parser.cpp"
     break;
 
-  case 101: /* explain_type: PIPELINE  */
-#line 945 "parser.y"
+  case 102: /* explain_type: PIPELINE  */
+#line 975 "parser.y"
            {
     (yyval.explain_type_t) = infinity::ExplainType::kPipeline;
 }
-#line 3880 "parser.cpp"
+#line 3937 "parser.cpp"
     break;
 
-  case 102: /* explain_type: FRAGMENT  */
-#line 948 "parser.y"
+  case 103: /* explain_type: FRAGMENT  */
+#line 978 "parser.y"
            {
     (yyval.explain_type_t) = infinity::ExplainType::kFragment;
 }
-#line 3888 "parser.cpp"
+#line 3945 "parser.cpp"
     break;
 
-  case 103: /* explain_type: %empty  */
-#line 951 "parser.y"
+  case 104: /* explain_type: %empty  */
+#line 981 "parser.y"
   {
     (yyval.explain_type_t) = infinity::ExplainType::kPhysical;
 }
-#line 3896 "parser.cpp"
+#line 3953 "parser.cpp"
     break;
 
-  case 104: /* update_statement: UPDATE table_name SET update_expr_array where_clause  */
-#line 958 "parser.y"
+  case 105: /* update_statement: UPDATE table_name SET update_expr_array where_clause  */
+#line 988 "parser.y"
                                                                        {
     (yyval.update_stmt) = new infinity::UpdateStatement();
     if((yyvsp[-3].table_name_t)->schema_name_ptr_ != nullptr) {
@@ -3909,29 +3966,29 @@ yyreduce:
     (yyval.update_stmt)->where_expr_ = (yyvsp[0].expr_t);
     (yyval.update_stmt)->update_expr_array_ = (yyvsp[-1].update_expr_array_t);
 }
-#line 3913 "parser.cpp"
+#line 3970 "parser.cpp"
     break;
 
-  case 105: /* update_expr_array: update_expr  */
-#line 971 "parser.y"
+  case 106: /* update_expr_array: update_expr  */
+#line 1001 "parser.y"
                                {
     (yyval.update_expr_array_t) = new std::vector<infinity::UpdateExpr*>();
     (yyval.update_expr_array_t)->emplace_back((yyvsp[0].update_expr_t));
 }
-#line 3922 "parser.cpp"
+#line 3979 "parser.cpp"
     break;
 
-  case 106: /* update_expr_array: update_expr_array ',' update_expr  */
-#line 975 "parser.y"
+  case 107: /* update_expr_array: update_expr_array ',' update_expr  */
+#line 1005 "parser.y"
                                     {
     (yyvsp[-2].update_expr_array_t)->emplace_back((yyvsp[0].update_expr_t));
     (yyval.update_expr_array_t) = (yyvsp[-2].update_expr_array_t);
 }
-#line 3931 "parser.cpp"
+#line 3988 "parser.cpp"
     break;
 
-  case 107: /* update_expr: IDENTIFIER '=' expr  */
-#line 980 "parser.y"
+  case 108: /* update_expr: IDENTIFIER '=' expr  */
+#line 1010 "parser.y"
                                   {
     (yyval.update_expr_t) = new infinity::UpdateExpr();
     ParserHelper::ToLower((yyvsp[-2].str_value));
@@ -3939,11 +3996,11 @@ yyreduce:
     free((yyvsp[-2].str_value));
     (yyval.update_expr_t)->value = (yyvsp[0].expr_t);
 }
-#line 3943 "parser.cpp"
+#line 4000 "parser.cpp"
     break;
 
-  case 108: /* drop_statement: DROP DATABASE if_exists IDENTIFIER  */
-#line 993 "parser.y"
+  case 109: /* drop_statement: DROP DATABASE if_exists IDENTIFIER  */
+#line 1023 "parser.y"
                                                    {
     (yyval.drop_stmt) = new infinity::DropStatement();
     std::shared_ptr<infinity::DropSchemaInfo> drop_schema_info = std::make_shared<infinity::DropSchemaInfo>();
@@ -3955,11 +4012,11 @@ yyreduce:
     (yyval.drop_stmt)->drop_info_ = drop_schema_info;
     (yyval.drop_stmt)->drop_info_->conflict_type_ = (yyvsp[-1].bool_value) ? infinity::ConflictType::kIgnore : infinity::ConflictType::kError;
 }
-#line 3959 "parser.cpp"
+#line 4016 "parser.cpp"
     break;
 
-  case 109: /* drop_statement: DROP COLLECTION if_exists table_name  */
-#line 1006 "parser.y"
+  case 110: /* drop_statement: DROP COLLECTION if_exists table_name  */
+#line 1036 "parser.y"
                                        {
     (yyval.drop_stmt) = new infinity::DropStatement();
     std::shared_ptr<infinity::DropCollectionInfo> drop_collection_info = std::make_unique<infinity::DropCollectionInfo>();
@@ -3973,11 +4030,11 @@ yyreduce:
     (yyval.drop_stmt)->drop_info_->conflict_type_ = (yyvsp[-1].bool_value) ? infinity::ConflictType::kIgnore : infinity::ConflictType::kError;
     delete (yyvsp[0].table_name_t);
 }
-#line 3977 "parser.cpp"
+#line 4034 "parser.cpp"
     break;
 
-  case 110: /* drop_statement: DROP TABLE if_exists table_name  */
-#line 1021 "parser.y"
+  case 111: /* drop_statement: DROP TABLE if_exists table_name  */
+#line 1051 "parser.y"
                                   {
     (yyval.drop_stmt) = new infinity::DropStatement();
     std::shared_ptr<infinity::DropTableInfo> drop_table_info = std::make_unique<infinity::DropTableInfo>();
@@ -3991,11 +4048,11 @@ yyreduce:
     (yyval.drop_stmt)->drop_info_->conflict_type_ = (yyvsp[-1].bool_value) ? infinity::ConflictType::kIgnore : infinity::ConflictType::kError;
     delete (yyvsp[0].table_name_t);
 }
-#line 3995 "parser.cpp"
+#line 4052 "parser.cpp"
     break;
 
-  case 111: /* drop_statement: DROP VIEW if_exists table_name  */
-#line 1036 "parser.y"
+  case 112: /* drop_statement: DROP VIEW if_exists table_name  */
+#line 1066 "parser.y"
                                  {
     (yyval.drop_stmt) = new infinity::DropStatement();
     std::shared_ptr<infinity::DropViewInfo> drop_view_info = std::make_unique<infinity::DropViewInfo>();
@@ -4009,11 +4066,11 @@ yyreduce:
     (yyval.drop_stmt)->drop_info_->conflict_type_ = (yyvsp[-1].bool_value) ? infinity::ConflictType::kIgnore : infinity::ConflictType::kError;
     delete (yyvsp[0].table_name_t);
 }
-#line 4013 "parser.cpp"
+#line 4070 "parser.cpp"
     break;
 
-  case 112: /* drop_statement: DROP INDEX if_exists IDENTIFIER ON table_name  */
-#line 1051 "parser.y"
+  case 113: /* drop_statement: DROP INDEX if_exists IDENTIFIER ON table_name  */
+#line 1081 "parser.y"
                                                 {
     (yyval.drop_stmt) = new infinity::DropStatement();
     std::shared_ptr<infinity::DropIndexInfo> drop_index_info = std::make_shared<infinity::DropIndexInfo>();
@@ -4032,11 +4089,11 @@ yyreduce:
     free((yyvsp[0].table_name_t)->table_name_ptr_);
     delete (yyvsp[0].table_name_t);
 }
-#line 4036 "parser.cpp"
+#line 4093 "parser.cpp"
     break;
 
-  case 113: /* copy_statement: COPY table_name TO file_path WITH '(' copy_option_list ')'  */
-#line 1074 "parser.y"
+  case 114: /* copy_statement: COPY table_name TO file_path WITH '(' copy_option_list ')'  */
+#line 1104 "parser.y"
                                                                            {
     (yyval.copy_stmt) = new infinity::CopyStatement();
 
@@ -4078,11 +4135,11 @@ yyreduce:
     }
     delete (yyvsp[-1].copy_option_array);
 }
-#line 4082 "parser.cpp"
+#line 4139 "parser.cpp"
     break;
 
-  case 114: /* copy_statement: COPY table_name FROM file_path WITH '(' copy_option_list ')'  */
-#line 1115 "parser.y"
+  case 115: /* copy_statement: COPY table_name FROM file_path WITH '(' copy_option_list ')'  */
+#line 1145 "parser.y"
                                                                {
     (yyval.copy_stmt) = new infinity::CopyStatement();
 
@@ -4124,27 +4181,27 @@ yyreduce:
     }
     delete (yyvsp[-1].copy_option_array);
 }
-#line 4128 "parser.cpp"
+#line 4185 "parser.cpp"
     break;
 
-  case 115: /* select_statement: select_without_paren  */
-#line 1160 "parser.y"
+  case 116: /* select_statement: select_without_paren  */
+#line 1190 "parser.y"
                                         {
     (yyval.select_stmt) = (yyvsp[0].select_stmt);
 }
-#line 4136 "parser.cpp"
+#line 4193 "parser.cpp"
     break;
 
-  case 116: /* select_statement: select_with_paren  */
-#line 1163 "parser.y"
+  case 117: /* select_statement: select_with_paren  */
+#line 1193 "parser.y"
                     {
     (yyval.select_stmt) = (yyvsp[0].select_stmt);
 }
-#line 4144 "parser.cpp"
+#line 4201 "parser.cpp"
     break;
 
-  case 117: /* select_statement: select_statement set_operator select_clause_without_modifier_paren  */
-#line 1166 "parser.y"
+  case 118: /* select_statement: select_statement set_operator select_clause_without_modifier_paren  */
+#line 1196 "parser.y"
                                                                      {
     infinity::SelectStatement* node = (yyvsp[-2].select_stmt);
     while(node->nested_select_ != nullptr) {
@@ -4154,11 +4211,11 @@ yyreduce:
     node->nested_select_ = (yyvsp[0].select_stmt);
     (yyval.select_stmt) = (yyvsp[-2].select_stmt);
 }
-#line 4158 "parser.cpp"
+#line 4215 "parser.cpp"
     break;
 
-  case 118: /* select_statement: select_statement set_operator select_clause_without_modifier  */
-#line 1175 "parser.y"
+  case 119: /* select_statement: select_statement set_operator select_clause_without_modifier  */
+#line 1205 "parser.y"
                                                                {
     infinity::SelectStatement* node = (yyvsp[-2].select_stmt);
     while(node->nested_select_ != nullptr) {
@@ -4168,36 +4225,36 @@ yyreduce:
     node->nested_select_ = (yyvsp[0].select_stmt);
     (yyval.select_stmt) = (yyvsp[-2].select_stmt);
 }
-#line 4172 "parser.cpp"
+#line 4229 "parser.cpp"
     break;
 
-  case 119: /* select_with_paren: '(' select_without_paren ')'  */
-#line 1185 "parser.y"
+  case 120: /* select_with_paren: '(' select_without_paren ')'  */
+#line 1215 "parser.y"
                                                  {
     (yyval.select_stmt) = (yyvsp[-1].select_stmt);
 }
-#line 4180 "parser.cpp"
+#line 4237 "parser.cpp"
     break;
 
-  case 120: /* select_with_paren: '(' select_with_paren ')'  */
-#line 1188 "parser.y"
+  case 121: /* select_with_paren: '(' select_with_paren ')'  */
+#line 1218 "parser.y"
                             {
     (yyval.select_stmt) = (yyvsp[-1].select_stmt);
 }
-#line 4188 "parser.cpp"
+#line 4245 "parser.cpp"
     break;
 
-  case 121: /* select_without_paren: with_clause select_clause_with_modifier  */
-#line 1192 "parser.y"
+  case 122: /* select_without_paren: with_clause select_clause_with_modifier  */
+#line 1222 "parser.y"
                                                               {
     (yyvsp[0].select_stmt)->with_exprs_ = (yyvsp[-1].with_expr_list_t);
     (yyval.select_stmt) = (yyvsp[0].select_stmt);
 }
-#line 4197 "parser.cpp"
+#line 4254 "parser.cpp"
     break;
 
-  case 122: /* select_clause_with_modifier: select_clause_without_modifier order_by_clause limit_expr offset_expr  */
-#line 1197 "parser.y"
+  case 123: /* select_clause_with_modifier: select_clause_without_modifier order_by_clause limit_expr offset_expr  */
+#line 1227 "parser.y"
                                                                                                    {
     if((yyvsp[-1].expr_t) == nullptr and (yyvsp[0].expr_t) != nullptr) {
         delete (yyvsp[-3].select_stmt);
@@ -4219,27 +4276,27 @@ yyreduce:
     (yyvsp[-3].select_stmt)->offset_expr_ = (yyvsp[0].expr_t);
     (yyval.select_stmt) = (yyvsp[-3].select_stmt);
 }
-#line 4223 "parser.cpp"
+#line 4280 "parser.cpp"
     break;
 
-  case 123: /* select_clause_without_modifier_paren: '(' select_clause_without_modifier ')'  */
-#line 1219 "parser.y"
+  case 124: /* select_clause_without_modifier_paren: '(' select_clause_without_modifier ')'  */
+#line 1249 "parser.y"
                                                                              {
   (yyval.select_stmt) = (yyvsp[-1].select_stmt);
 }
-#line 4231 "parser.cpp"
+#line 4288 "parser.cpp"
     break;
 
-  case 124: /* select_clause_without_modifier_paren: '(' select_clause_without_modifier_paren ')'  */
-#line 1222 "parser.y"
+  case 125: /* select_clause_without_modifier_paren: '(' select_clause_without_modifier_paren ')'  */
+#line 1252 "parser.y"
                                                {
     (yyval.select_stmt) = (yyvsp[-1].select_stmt);
 }
-#line 4239 "parser.cpp"
+#line 4296 "parser.cpp"
     break;
 
-  case 125: /* select_clause_without_modifier: SELECT distinct expr_array from_clause search_clause where_clause group_by_clause having_clause  */
-#line 1227 "parser.y"
+  case 126: /* select_clause_without_modifier: SELECT distinct expr_array from_clause search_clause where_clause group_by_clause having_clause  */
+#line 1257 "parser.y"
                                                                                                 {
     (yyval.select_stmt) = new infinity::SelectStatement();
     (yyval.select_stmt)->select_list_ = (yyvsp[-5].expr_array_t);
@@ -4255,245 +4312,245 @@ yyreduce:
         YYERROR;
     }
 }
-#line 4259 "parser.cpp"
+#line 4316 "parser.cpp"
     break;
 
-  case 126: /* order_by_clause: ORDER BY order_by_expr_list  */
-#line 1243 "parser.y"
+  case 127: /* order_by_clause: ORDER BY order_by_expr_list  */
+#line 1273 "parser.y"
                                               {
     (yyval.order_by_expr_list_t) = (yyvsp[0].order_by_expr_list_t);
 }
-#line 4267 "parser.cpp"
+#line 4324 "parser.cpp"
     break;
 
-  case 127: /* order_by_clause: %empty  */
-#line 1246 "parser.y"
+  case 128: /* order_by_clause: %empty  */
+#line 1276 "parser.y"
                        {
     (yyval.order_by_expr_list_t) = nullptr;
 }
-#line 4275 "parser.cpp"
+#line 4332 "parser.cpp"
     break;
 
-  case 128: /* order_by_expr_list: order_by_expr  */
-#line 1250 "parser.y"
+  case 129: /* order_by_expr_list: order_by_expr  */
+#line 1280 "parser.y"
                                   {
     (yyval.order_by_expr_list_t) = new std::vector<infinity::OrderByExpr*>();
     (yyval.order_by_expr_list_t)->emplace_back((yyvsp[0].order_by_expr_t));
 }
-#line 4284 "parser.cpp"
+#line 4341 "parser.cpp"
     break;
 
-  case 129: /* order_by_expr_list: order_by_expr_list ',' order_by_expr  */
-#line 1254 "parser.y"
+  case 130: /* order_by_expr_list: order_by_expr_list ',' order_by_expr  */
+#line 1284 "parser.y"
                                        {
     (yyvsp[-2].order_by_expr_list_t)->emplace_back((yyvsp[0].order_by_expr_t));
     (yyval.order_by_expr_list_t) = (yyvsp[-2].order_by_expr_list_t);
 }
-#line 4293 "parser.cpp"
+#line 4350 "parser.cpp"
     break;
 
-  case 130: /* order_by_expr: expr order_by_type  */
-#line 1259 "parser.y"
+  case 131: /* order_by_expr: expr order_by_type  */
+#line 1289 "parser.y"
                                    {
     (yyval.order_by_expr_t) = new infinity::OrderByExpr();
     (yyval.order_by_expr_t)->expr_ = (yyvsp[-1].expr_t);
     (yyval.order_by_expr_t)->type_ = (yyvsp[0].order_by_type_t);
 }
-#line 4303 "parser.cpp"
+#line 4360 "parser.cpp"
     break;
 
-  case 131: /* order_by_type: ASC  */
-#line 1265 "parser.y"
+  case 132: /* order_by_type: ASC  */
+#line 1295 "parser.y"
                    {
     (yyval.order_by_type_t) = infinity::kAsc;
 }
-#line 4311 "parser.cpp"
+#line 4368 "parser.cpp"
     break;
 
-  case 132: /* order_by_type: DESC  */
-#line 1268 "parser.y"
+  case 133: /* order_by_type: DESC  */
+#line 1298 "parser.y"
        {
     (yyval.order_by_type_t) = infinity::kDesc;
 }
-#line 4319 "parser.cpp"
+#line 4376 "parser.cpp"
     break;
 
-  case 133: /* order_by_type: %empty  */
-#line 1271 "parser.y"
+  case 134: /* order_by_type: %empty  */
+#line 1301 "parser.y"
   {
     (yyval.order_by_type_t) = infinity::kAsc;
 }
-#line 4327 "parser.cpp"
+#line 4384 "parser.cpp"
     break;
 
-  case 134: /* limit_expr: LIMIT expr  */
-#line 1275 "parser.y"
+  case 135: /* limit_expr: LIMIT expr  */
+#line 1305 "parser.y"
                        {
     (yyval.expr_t) = (yyvsp[0].expr_t);
 }
-#line 4335 "parser.cpp"
+#line 4392 "parser.cpp"
     break;
 
-  case 135: /* limit_expr: %empty  */
-#line 1279 "parser.y"
+  case 136: /* limit_expr: %empty  */
+#line 1309 "parser.y"
 {   (yyval.expr_t) = nullptr; }
-#line 4341 "parser.cpp"
+#line 4398 "parser.cpp"
     break;
 
-  case 136: /* offset_expr: OFFSET expr  */
-#line 1281 "parser.y"
+  case 137: /* offset_expr: OFFSET expr  */
+#line 1311 "parser.y"
                          {
     (yyval.expr_t) = (yyvsp[0].expr_t);
 }
-#line 4349 "parser.cpp"
+#line 4406 "parser.cpp"
     break;
 
-  case 137: /* offset_expr: %empty  */
-#line 1285 "parser.y"
+  case 138: /* offset_expr: %empty  */
+#line 1315 "parser.y"
 {   (yyval.expr_t) = nullptr; }
-#line 4355 "parser.cpp"
+#line 4412 "parser.cpp"
     break;
 
-  case 138: /* distinct: DISTINCT  */
-#line 1287 "parser.y"
+  case 139: /* distinct: DISTINCT  */
+#line 1317 "parser.y"
                     {
     (yyval.bool_value) = true;
 }
-#line 4363 "parser.cpp"
+#line 4420 "parser.cpp"
     break;
 
-  case 139: /* distinct: %empty  */
-#line 1290 "parser.y"
+  case 140: /* distinct: %empty  */
+#line 1320 "parser.y"
   {
     (yyval.bool_value) = false;
 }
-#line 4371 "parser.cpp"
+#line 4428 "parser.cpp"
     break;
 
-  case 140: /* from_clause: FROM table_reference  */
-#line 1294 "parser.y"
+  case 141: /* from_clause: FROM table_reference  */
+#line 1324 "parser.y"
                                   {
     (yyval.table_reference_t) = (yyvsp[0].table_reference_t);
 }
-#line 4379 "parser.cpp"
+#line 4436 "parser.cpp"
     break;
 
-  case 141: /* from_clause: %empty  */
-#line 1297 "parser.y"
+  case 142: /* from_clause: %empty  */
+#line 1327 "parser.y"
                        {
     (yyval.table_reference_t) = nullptr;
 }
-#line 4387 "parser.cpp"
+#line 4444 "parser.cpp"
     break;
 
-  case 142: /* search_clause: SEARCH sub_search_array  */
-#line 1301 "parser.y"
+  case 143: /* search_clause: SEARCH sub_search_array  */
+#line 1331 "parser.y"
                                        {
     infinity::SearchExpr* search_expr = new infinity::SearchExpr();
     search_expr->SetExprs((yyvsp[0].expr_array_t));
     (yyval.expr_t) = search_expr;
 }
-#line 4397 "parser.cpp"
+#line 4454 "parser.cpp"
     break;
 
-  case 143: /* search_clause: %empty  */
-#line 1306 "parser.y"
+  case 144: /* search_clause: %empty  */
+#line 1336 "parser.y"
                          {
     (yyval.expr_t) = nullptr;
 }
-#line 4405 "parser.cpp"
+#line 4462 "parser.cpp"
     break;
 
-  case 144: /* where_clause: WHERE expr  */
-#line 1310 "parser.y"
+  case 145: /* where_clause: WHERE expr  */
+#line 1340 "parser.y"
                          {
     (yyval.expr_t) = (yyvsp[0].expr_t);
 }
-#line 4413 "parser.cpp"
+#line 4470 "parser.cpp"
     break;
 
-  case 145: /* where_clause: %empty  */
-#line 1313 "parser.y"
+  case 146: /* where_clause: %empty  */
+#line 1343 "parser.y"
                         {
     (yyval.expr_t) = nullptr;
 }
-#line 4421 "parser.cpp"
+#line 4478 "parser.cpp"
     break;
 
-  case 146: /* having_clause: HAVING expr  */
-#line 1317 "parser.y"
+  case 147: /* having_clause: HAVING expr  */
+#line 1347 "parser.y"
                            {
     (yyval.expr_t) = (yyvsp[0].expr_t);
 }
-#line 4429 "parser.cpp"
+#line 4486 "parser.cpp"
     break;
 
-  case 147: /* having_clause: %empty  */
-#line 1320 "parser.y"
+  case 148: /* having_clause: %empty  */
+#line 1350 "parser.y"
                         {
     (yyval.expr_t) = nullptr;
 }
-#line 4437 "parser.cpp"
+#line 4494 "parser.cpp"
     break;
 
-  case 148: /* group_by_clause: GROUP BY expr_array  */
-#line 1324 "parser.y"
+  case 149: /* group_by_clause: GROUP BY expr_array  */
+#line 1354 "parser.y"
                                      {
     (yyval.expr_array_t) = (yyvsp[0].expr_array_t);
 }
-#line 4445 "parser.cpp"
+#line 4502 "parser.cpp"
     break;
 
-  case 149: /* group_by_clause: %empty  */
-#line 1327 "parser.y"
+  case 150: /* group_by_clause: %empty  */
+#line 1357 "parser.y"
   {
     (yyval.expr_array_t) = nullptr;
 }
-#line 4453 "parser.cpp"
+#line 4510 "parser.cpp"
     break;
 
-  case 150: /* set_operator: UNION  */
-#line 1331 "parser.y"
+  case 151: /* set_operator: UNION  */
+#line 1361 "parser.y"
                      {
     (yyval.set_operator_t) = infinity::SetOperatorType::kUnion;
 }
-#line 4461 "parser.cpp"
+#line 4518 "parser.cpp"
     break;
 
-  case 151: /* set_operator: UNION ALL  */
-#line 1334 "parser.y"
+  case 152: /* set_operator: UNION ALL  */
+#line 1364 "parser.y"
             {
     (yyval.set_operator_t) = infinity::SetOperatorType::kUnionAll;
 }
-#line 4469 "parser.cpp"
+#line 4526 "parser.cpp"
     break;
 
-  case 152: /* set_operator: INTERSECT  */
-#line 1337 "parser.y"
+  case 153: /* set_operator: INTERSECT  */
+#line 1367 "parser.y"
             {
     (yyval.set_operator_t) = infinity::SetOperatorType::kIntersect;
 }
-#line 4477 "parser.cpp"
+#line 4534 "parser.cpp"
     break;
 
-  case 153: /* set_operator: EXCEPT  */
-#line 1340 "parser.y"
+  case 154: /* set_operator: EXCEPT  */
+#line 1370 "parser.y"
          {
     (yyval.set_operator_t) = infinity::SetOperatorType::kExcept;
 }
-#line 4485 "parser.cpp"
+#line 4542 "parser.cpp"
     break;
 
-  case 154: /* table_reference: table_reference_unit  */
-#line 1348 "parser.y"
+  case 155: /* table_reference: table_reference_unit  */
+#line 1378 "parser.y"
                                        {
     (yyval.table_reference_t) = (yyvsp[0].table_reference_t);
 }
-#line 4493 "parser.cpp"
+#line 4550 "parser.cpp"
     break;
 
-  case 155: /* table_reference: table_reference ',' table_reference_unit  */
-#line 1351 "parser.y"
+  case 156: /* table_reference: table_reference ',' table_reference_unit  */
+#line 1381 "parser.y"
                                            {
     infinity::CrossProductReference* cross_product_ref = nullptr;
     if((yyvsp[-2].table_reference_t)->type_ == infinity::TableRefType::kCrossProduct) {
@@ -4507,11 +4564,11 @@ yyreduce:
 
     (yyval.table_reference_t) = cross_product_ref;
 }
-#line 4511 "parser.cpp"
+#line 4568 "parser.cpp"
     break;
 
-  case 158: /* table_reference_name: table_name table_alias  */
-#line 1368 "parser.y"
+  case 159: /* table_reference_name: table_name table_alias  */
+#line 1398 "parser.y"
                                               {
     infinity::TableReference* table_ref = new infinity::TableReference();
     if((yyvsp[-1].table_name_t)->schema_name_ptr_ != nullptr) {
@@ -4525,32 +4582,32 @@ yyreduce:
     table_ref->alias_ = (yyvsp[0].table_alias_t);
     (yyval.table_reference_t) = table_ref;
 }
-#line 4529 "parser.cpp"
+#line 4586 "parser.cpp"
     break;
 
-  case 159: /* table_reference_name: '(' select_statement ')' table_alias  */
-#line 1382 "parser.y"
+  case 160: /* table_reference_name: '(' select_statement ')' table_alias  */
+#line 1412 "parser.y"
                                        {
     infinity::SubqueryReference* subquery_reference = new infinity::SubqueryReference();
     subquery_reference->select_statement_ = (yyvsp[-2].select_stmt);
     subquery_reference->alias_ = (yyvsp[0].table_alias_t);
     (yyval.table_reference_t) = subquery_reference;
 }
-#line 4540 "parser.cpp"
+#line 4597 "parser.cpp"
     break;
 
-  case 160: /* table_name: IDENTIFIER  */
-#line 1391 "parser.y"
+  case 161: /* table_name: IDENTIFIER  */
+#line 1421 "parser.y"
                         {
     (yyval.table_name_t) = new infinity::TableName();
     ParserHelper::ToLower((yyvsp[0].str_value));
     (yyval.table_name_t)->table_name_ptr_ = (yyvsp[0].str_value);
 }
-#line 4550 "parser.cpp"
+#line 4607 "parser.cpp"
     break;
 
-  case 161: /* table_name: IDENTIFIER '.' IDENTIFIER  */
-#line 1396 "parser.y"
+  case 162: /* table_name: IDENTIFIER '.' IDENTIFIER  */
+#line 1426 "parser.y"
                             {
     (yyval.table_name_t) = new infinity::TableName();
     ParserHelper::ToLower((yyvsp[-2].str_value));
@@ -4558,84 +4615,84 @@ yyreduce:
     (yyval.table_name_t)->schema_name_ptr_ = (yyvsp[-2].str_value);
     (yyval.table_name_t)->table_name_ptr_ = (yyvsp[0].str_value);
 }
-#line 4562 "parser.cpp"
+#line 4619 "parser.cpp"
     break;
 
-  case 162: /* table_alias: AS IDENTIFIER  */
-#line 1405 "parser.y"
+  case 163: /* table_alias: AS IDENTIFIER  */
+#line 1435 "parser.y"
                             {
     (yyval.table_alias_t) = new infinity::TableAlias();
     ParserHelper::ToLower((yyvsp[0].str_value));
     (yyval.table_alias_t)->alias_ = (yyvsp[0].str_value);
 }
-#line 4572 "parser.cpp"
+#line 4629 "parser.cpp"
     break;
 
-  case 163: /* table_alias: IDENTIFIER  */
-#line 1410 "parser.y"
+  case 164: /* table_alias: IDENTIFIER  */
+#line 1440 "parser.y"
              {
     (yyval.table_alias_t) = new infinity::TableAlias();
     ParserHelper::ToLower((yyvsp[0].str_value));
     (yyval.table_alias_t)->alias_ = (yyvsp[0].str_value);
 }
-#line 4582 "parser.cpp"
+#line 4639 "parser.cpp"
     break;
 
-  case 164: /* table_alias: AS IDENTIFIER '(' identifier_array ')'  */
-#line 1415 "parser.y"
+  case 165: /* table_alias: AS IDENTIFIER '(' identifier_array ')'  */
+#line 1445 "parser.y"
                                          {
     (yyval.table_alias_t) = new infinity::TableAlias();
     ParserHelper::ToLower((yyvsp[-3].str_value));
     (yyval.table_alias_t)->alias_ = (yyvsp[-3].str_value);
     (yyval.table_alias_t)->column_alias_array_ = (yyvsp[-1].identifier_array_t);
 }
-#line 4593 "parser.cpp"
+#line 4650 "parser.cpp"
     break;
 
-  case 165: /* table_alias: %empty  */
-#line 1421 "parser.y"
+  case 166: /* table_alias: %empty  */
+#line 1451 "parser.y"
   {
     (yyval.table_alias_t) = nullptr;
 }
-#line 4601 "parser.cpp"
+#line 4658 "parser.cpp"
     break;
 
-  case 166: /* with_clause: WITH with_expr_list  */
-#line 1428 "parser.y"
+  case 167: /* with_clause: WITH with_expr_list  */
+#line 1458 "parser.y"
                                   {
     (yyval.with_expr_list_t) = (yyvsp[0].with_expr_list_t);
 }
-#line 4609 "parser.cpp"
+#line 4666 "parser.cpp"
     break;
 
-  case 167: /* with_clause: %empty  */
-#line 1431 "parser.y"
+  case 168: /* with_clause: %empty  */
+#line 1461 "parser.y"
                           {
     (yyval.with_expr_list_t) = nullptr;
 }
-#line 4617 "parser.cpp"
+#line 4674 "parser.cpp"
     break;
 
-  case 168: /* with_expr_list: with_expr  */
-#line 1435 "parser.y"
+  case 169: /* with_expr_list: with_expr  */
+#line 1465 "parser.y"
                           {
     (yyval.with_expr_list_t) = new std::vector<infinity::WithExpr*>();
     (yyval.with_expr_list_t)->emplace_back((yyvsp[0].with_expr_t));
 }
-#line 4626 "parser.cpp"
+#line 4683 "parser.cpp"
     break;
 
-  case 169: /* with_expr_list: with_expr_list ',' with_expr  */
-#line 1438 "parser.y"
+  case 170: /* with_expr_list: with_expr_list ',' with_expr  */
+#line 1468 "parser.y"
                                  {
     (yyvsp[-2].with_expr_list_t)->emplace_back((yyvsp[0].with_expr_t));
     (yyval.with_expr_list_t) = (yyvsp[-2].with_expr_list_t);
 }
-#line 4635 "parser.cpp"
+#line 4692 "parser.cpp"
     break;
 
-  case 170: /* with_expr: IDENTIFIER AS '(' select_clause_with_modifier ')'  */
-#line 1443 "parser.y"
+  case 171: /* with_expr: IDENTIFIER AS '(' select_clause_with_modifier ')'  */
+#line 1473 "parser.y"
                                                              {
     (yyval.with_expr_t) = new infinity::WithExpr();
     ParserHelper::ToLower((yyvsp[-4].str_value));
@@ -4643,11 +4700,11 @@ yyreduce:
     free((yyvsp[-4].str_value));
     (yyval.with_expr_t)->select_ = (yyvsp[-1].select_stmt);
 }
-#line 4647 "parser.cpp"
+#line 4704 "parser.cpp"
     break;
 
-  case 171: /* join_clause: table_reference_unit NATURAL JOIN table_reference_name  */
-#line 1455 "parser.y"
+  case 172: /* join_clause: table_reference_unit NATURAL JOIN table_reference_name  */
+#line 1485 "parser.y"
                                                                     {
     infinity::JoinReference* join_reference = new infinity::JoinReference();
     join_reference->left_ = (yyvsp[-3].table_reference_t);
@@ -4655,11 +4712,11 @@ yyreduce:
     join_reference->join_type_ = infinity::JoinType::kNatural;
     (yyval.table_reference_t) = join_reference;
 }
-#line 4659 "parser.cpp"
+#line 4716 "parser.cpp"
     break;
 
-  case 172: /* join_clause: table_reference_unit join_type JOIN table_reference_name ON expr  */
-#line 1462 "parser.y"
+  case 173: /* join_clause: table_reference_unit join_type JOIN table_reference_name ON expr  */
+#line 1492 "parser.y"
                                                                    {
     infinity::JoinReference* join_reference = new infinity::JoinReference();
     join_reference->left_ = (yyvsp[-5].table_reference_t);
@@ -4668,129 +4725,149 @@ yyreduce:
     join_reference->condition_ = (yyvsp[0].expr_t);
     (yyval.table_reference_t) = join_reference;
 }
-#line 4672 "parser.cpp"
+#line 4729 "parser.cpp"
     break;
 
-  case 173: /* join_type: INNER  */
-#line 1476 "parser.y"
+  case 174: /* join_type: INNER  */
+#line 1506 "parser.y"
                   {
     (yyval.join_type_t) = infinity::JoinType::kInner;
 }
-#line 4680 "parser.cpp"
+#line 4737 "parser.cpp"
     break;
 
-  case 174: /* join_type: LEFT  */
-#line 1479 "parser.y"
+  case 175: /* join_type: LEFT  */
+#line 1509 "parser.y"
        {
     (yyval.join_type_t) = infinity::JoinType::kLeft;
 }
-#line 4688 "parser.cpp"
+#line 4745 "parser.cpp"
     break;
 
-  case 175: /* join_type: RIGHT  */
-#line 1482 "parser.y"
+  case 176: /* join_type: RIGHT  */
+#line 1512 "parser.y"
         {
     (yyval.join_type_t) = infinity::JoinType::kRight;
 }
-#line 4696 "parser.cpp"
+#line 4753 "parser.cpp"
     break;
 
-  case 176: /* join_type: OUTER  */
-#line 1485 "parser.y"
+  case 177: /* join_type: OUTER  */
+#line 1515 "parser.y"
         {
     (yyval.join_type_t) = infinity::JoinType::kFull;
 }
-#line 4704 "parser.cpp"
+#line 4761 "parser.cpp"
     break;
 
-  case 177: /* join_type: FULL  */
-#line 1488 "parser.y"
+  case 178: /* join_type: FULL  */
+#line 1518 "parser.y"
        {
     (yyval.join_type_t) = infinity::JoinType::kFull;
 }
-#line 4712 "parser.cpp"
+#line 4769 "parser.cpp"
     break;
 
-  case 178: /* join_type: CROSS  */
-#line 1491 "parser.y"
+  case 179: /* join_type: CROSS  */
+#line 1521 "parser.y"
         {
     (yyval.join_type_t) = infinity::JoinType::kCross;
 }
-#line 4720 "parser.cpp"
+#line 4777 "parser.cpp"
     break;
 
-  case 179: /* join_type: %empty  */
-#line 1494 "parser.y"
+  case 180: /* join_type: %empty  */
+#line 1524 "parser.y"
                 {
 }
-#line 4727 "parser.cpp"
+#line 4784 "parser.cpp"
     break;
 
-  case 180: /* show_statement: SHOW DATABASES  */
-#line 1500 "parser.y"
+  case 181: /* show_statement: SHOW DATABASES  */
+#line 1530 "parser.y"
                                {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kDatabases;
 }
-#line 4736 "parser.cpp"
+#line 4793 "parser.cpp"
     break;
 
-  case 181: /* show_statement: SHOW TABLES  */
-#line 1504 "parser.y"
+  case 182: /* show_statement: SHOW TABLES  */
+#line 1534 "parser.y"
               {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kTables;
 }
-#line 4745 "parser.cpp"
+#line 4802 "parser.cpp"
     break;
 
-  case 182: /* show_statement: SHOW VIEWS  */
-#line 1508 "parser.y"
+  case 183: /* show_statement: SHOW VIEWS  */
+#line 1538 "parser.y"
              {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kViews;
 }
-#line 4754 "parser.cpp"
+#line 4811 "parser.cpp"
     break;
 
-  case 183: /* show_statement: SHOW CONFIGS  */
-#line 1512 "parser.y"
+  case 184: /* show_statement: SHOW CONFIGS  */
+#line 1542 "parser.y"
                {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kConfigs;
 }
-#line 4763 "parser.cpp"
+#line 4820 "parser.cpp"
     break;
 
-  case 184: /* show_statement: SHOW PROFILES  */
-#line 1516 "parser.y"
+  case 185: /* show_statement: SHOW PROFILES  */
+#line 1546 "parser.y"
                 {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kProfiles;
 }
-#line 4772 "parser.cpp"
+#line 4829 "parser.cpp"
     break;
 
-  case 185: /* show_statement: SHOW SESSION STATUS  */
-#line 1520 "parser.y"
+  case 186: /* show_statement: SHOW IDENTIFIER  */
+#line 1550 "parser.y"
+                  {
+    (yyval.show_stmt) = new infinity::ShowStatement();
+    if (strcasecmp((yyvsp[0].str_value), "slow_queries") == 0) {
+        (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kSlowQueries;
+        free((yyvsp[0].str_value));
+    } else if (strcasecmp((yyvsp[0].str_value), "queries") == 0) {
+        (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kQueries;
+        free((yyvsp[0].str_value));
+    } else {
+        free((yyvsp[0].str_value));
+        delete (yyval.show_stmt);
+        yyerror(&yyloc, scanner, result, "Unknown show type");
+        YYERROR;
+    }
+}
+#line 4849 "parser.cpp"
+    break;
+
+  case 187: /* show_statement: SHOW SESSION STATUS  */
+#line 1565 "parser.y"
                       {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kSessionStatus;
 }
-#line 4781 "parser.cpp"
+#line 4858 "parser.cpp"
     break;
 
-  case 186: /* show_statement: SHOW GLOBAL STATUS  */
-#line 1524 "parser.y"
+  case 188: /* show_statement: SHOW GLOBAL STATUS  */
+#line 1569 "parser.y"
                      {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kGlobalStatus;
 }
-#line 4790 "parser.cpp"
+#line 4867 "parser.cpp"
     break;
 
-  case 187: /* show_statement: SHOW VAR IDENTIFIER  */
-#line 1528 "parser.y"
+  case 189: /* show_statement: SHOW VAR IDENTIFIER  */
+#line 1573 "parser.y"
                       {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kVar;
@@ -4798,22 +4875,22 @@ yyreduce:
     (yyval.show_stmt)->var_name_ = std::string((yyvsp[0].str_value));
     free((yyvsp[0].str_value));
 }
-#line 4802 "parser.cpp"
+#line 4879 "parser.cpp"
     break;
 
-  case 188: /* show_statement: SHOW DATABASE IDENTIFIER  */
-#line 1535 "parser.y"
+  case 190: /* show_statement: SHOW DATABASE IDENTIFIER  */
+#line 1580 "parser.y"
                            {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kDatabase;
     (yyval.show_stmt)->schema_name_ = (yyvsp[0].str_value);
     free((yyvsp[0].str_value));
 }
-#line 4813 "parser.cpp"
+#line 4890 "parser.cpp"
     break;
 
-  case 189: /* show_statement: SHOW TABLE table_name  */
-#line 1541 "parser.y"
+  case 191: /* show_statement: SHOW TABLE table_name  */
+#line 1586 "parser.y"
                         {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kTable;
@@ -4825,11 +4902,11 @@ yyreduce:
     free((yyvsp[0].table_name_t)->table_name_ptr_);
     delete (yyvsp[0].table_name_t);
 }
-#line 4829 "parser.cpp"
+#line 4906 "parser.cpp"
     break;
 
-  case 190: /* show_statement: SHOW TABLE table_name COLUMNS  */
-#line 1552 "parser.y"
+  case 192: /* show_statement: SHOW TABLE table_name COLUMNS  */
+#line 1597 "parser.y"
                                 {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kColumns;
@@ -4841,11 +4918,11 @@ yyreduce:
     free((yyvsp[-1].table_name_t)->table_name_ptr_);
     delete (yyvsp[-1].table_name_t);
 }
-#line 4845 "parser.cpp"
+#line 4922 "parser.cpp"
     break;
 
-  case 191: /* show_statement: SHOW TABLE table_name SEGMENTS  */
-#line 1563 "parser.y"
+  case 193: /* show_statement: SHOW TABLE table_name SEGMENTS  */
+#line 1608 "parser.y"
                                  {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kSegments;
@@ -4857,11 +4934,11 @@ yyreduce:
     free((yyvsp[-1].table_name_t)->table_name_ptr_);
     delete (yyvsp[-1].table_name_t);
 }
-#line 4861 "parser.cpp"
+#line 4938 "parser.cpp"
     break;
 
-  case 192: /* show_statement: SHOW TABLE table_name SEGMENT LONG_VALUE  */
-#line 1574 "parser.y"
+  case 194: /* show_statement: SHOW TABLE table_name SEGMENT LONG_VALUE  */
+#line 1619 "parser.y"
                                            {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kSegment;
@@ -4874,11 +4951,11 @@ yyreduce:
     (yyval.show_stmt)->segment_id_ = (yyvsp[0].long_value);
     delete (yyvsp[-2].table_name_t);
 }
-#line 4878 "parser.cpp"
+#line 4955 "parser.cpp"
     break;
 
-  case 193: /* show_statement: SHOW TABLE table_name SEGMENT LONG_VALUE BLOCKS  */
-#line 1586 "parser.y"
+  case 195: /* show_statement: SHOW TABLE table_name SEGMENT LONG_VALUE BLOCKS  */
+#line 1631 "parser.y"
                                                   {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kBlocks;
@@ -4891,11 +4968,11 @@ yyreduce:
     (yyval.show_stmt)->segment_id_ = (yyvsp[-1].long_value);
     delete (yyvsp[-3].table_name_t);
 }
-#line 4895 "parser.cpp"
+#line 4972 "parser.cpp"
     break;
 
-  case 194: /* show_statement: SHOW TABLE table_name SEGMENT LONG_VALUE BLOCK LONG_VALUE  */
-#line 1598 "parser.y"
+  case 196: /* show_statement: SHOW TABLE table_name SEGMENT LONG_VALUE BLOCK LONG_VALUE  */
+#line 1643 "parser.y"
                                                             {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kBlock;
@@ -4909,11 +4986,11 @@ yyreduce:
     (yyval.show_stmt)->block_id_ = (yyvsp[0].long_value);
     delete (yyvsp[-4].table_name_t);
 }
-#line 4913 "parser.cpp"
+#line 4990 "parser.cpp"
     break;
 
-  case 195: /* show_statement: SHOW TABLE table_name INDEXES  */
-#line 1611 "parser.y"
+  case 197: /* show_statement: SHOW TABLE table_name INDEXES  */
+#line 1656 "parser.y"
                                 {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kIndexes;
@@ -4925,11 +5002,11 @@ yyreduce:
     free((yyvsp[-1].table_name_t)->table_name_ptr_);
     delete (yyvsp[-1].table_name_t);
 }
-#line 4929 "parser.cpp"
+#line 5006 "parser.cpp"
     break;
 
-  case 196: /* show_statement: SHOW TABLE table_name INDEX IDENTIFIER  */
-#line 1622 "parser.y"
+  case 198: /* show_statement: SHOW TABLE table_name INDEX IDENTIFIER  */
+#line 1667 "parser.y"
                                          {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kIndex;
@@ -4944,38 +5021,38 @@ yyreduce:
     (yyval.show_stmt)->index_name_ = (yyvsp[0].str_value);
     free((yyvsp[0].str_value));
 }
-#line 4948 "parser.cpp"
+#line 5025 "parser.cpp"
     break;
 
-  case 197: /* flush_statement: FLUSH DATA  */
-#line 1640 "parser.y"
+  case 199: /* flush_statement: FLUSH DATA  */
+#line 1685 "parser.y"
                             {
     (yyval.flush_stmt) = new infinity::FlushStatement();
     (yyval.flush_stmt)->type_ = infinity::FlushType::kData;
 }
-#line 4957 "parser.cpp"
+#line 5034 "parser.cpp"
     break;
 
-  case 198: /* flush_statement: FLUSH LOG  */
-#line 1644 "parser.y"
+  case 200: /* flush_statement: FLUSH LOG  */
+#line 1689 "parser.y"
             {
     (yyval.flush_stmt) = new infinity::FlushStatement();
     (yyval.flush_stmt)->type_ = infinity::FlushType::kLog;
 }
-#line 4966 "parser.cpp"
+#line 5043 "parser.cpp"
     break;
 
-  case 199: /* flush_statement: FLUSH BUFFER  */
-#line 1648 "parser.y"
+  case 201: /* flush_statement: FLUSH BUFFER  */
+#line 1693 "parser.y"
                {
     (yyval.flush_stmt) = new infinity::FlushStatement();
     (yyval.flush_stmt)->type_ = infinity::FlushType::kBuffer;
 }
-#line 4975 "parser.cpp"
+#line 5052 "parser.cpp"
     break;
 
-  case 200: /* optimize_statement: OPTIMIZE table_name  */
-#line 1656 "parser.y"
+  case 202: /* optimize_statement: OPTIMIZE table_name  */
+#line 1701 "parser.y"
                                         {
     (yyval.optimize_stmt) = new infinity::OptimizeStatement();
     if((yyvsp[0].table_name_t)->schema_name_ptr_ != nullptr) {
@@ -4986,54 +5063,54 @@ yyreduce:
     free((yyvsp[0].table_name_t)->table_name_ptr_);
     delete (yyvsp[0].table_name_t);
 }
-#line 4990 "parser.cpp"
+#line 5067 "parser.cpp"
     break;
 
-  case 201: /* command_statement: USE IDENTIFIER  */
-#line 1670 "parser.y"
+  case 203: /* command_statement: USE IDENTIFIER  */
+#line 1715 "parser.y"
                                   {
     (yyval.command_stmt) = new infinity::CommandStatement();
     ParserHelper::ToLower((yyvsp[0].str_value));
     (yyval.command_stmt)->command_info_ = std::make_unique<infinity::UseCmd>((yyvsp[0].str_value));
     free((yyvsp[0].str_value));
 }
-#line 5001 "parser.cpp"
+#line 5078 "parser.cpp"
     break;
 
-  case 202: /* command_statement: EXPORT PROFILE LONG_VALUE file_path  */
-#line 1676 "parser.y"
+  case 204: /* command_statement: EXPORT PROFILE LONG_VALUE file_path  */
+#line 1721 "parser.y"
                                       {
     (yyval.command_stmt) = new infinity::CommandStatement();
     (yyval.command_stmt)->command_info_ = std::make_unique<infinity::ExportCmd>((yyvsp[0].str_value), infinity::ExportType::kProfileRecord, (yyvsp[-1].long_value));
     free((yyvsp[0].str_value));
 }
-#line 5011 "parser.cpp"
+#line 5088 "parser.cpp"
     break;
 
-  case 203: /* command_statement: SET SESSION IDENTIFIER ON  */
-#line 1681 "parser.y"
+  case 205: /* command_statement: SET SESSION IDENTIFIER ON  */
+#line 1726 "parser.y"
                             {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     (yyval.command_stmt) = new infinity::CommandStatement();
     (yyval.command_stmt)->command_info_ = std::make_unique<infinity::SetCmd>(infinity::SetScope::kSession, infinity::SetVarType::kBool, (yyvsp[-1].str_value), true);
     free((yyvsp[-1].str_value));
 }
-#line 5022 "parser.cpp"
+#line 5099 "parser.cpp"
     break;
 
-  case 204: /* command_statement: SET SESSION IDENTIFIER OFF  */
-#line 1687 "parser.y"
+  case 206: /* command_statement: SET SESSION IDENTIFIER OFF  */
+#line 1732 "parser.y"
                              {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     (yyval.command_stmt) = new infinity::CommandStatement();
     (yyval.command_stmt)->command_info_ = std::make_unique<infinity::SetCmd>(infinity::SetScope::kSession, infinity::SetVarType::kBool, (yyvsp[-1].str_value), false);
     free((yyvsp[-1].str_value));
 }
-#line 5033 "parser.cpp"
+#line 5110 "parser.cpp"
     break;
 
-  case 205: /* command_statement: SET SESSION IDENTIFIER STRING  */
-#line 1693 "parser.y"
+  case 207: /* command_statement: SET SESSION IDENTIFIER STRING  */
+#line 1738 "parser.y"
                                 {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     ParserHelper::ToLower((yyvsp[0].str_value));
@@ -5042,55 +5119,55 @@ yyreduce:
     free((yyvsp[-1].str_value));
     free((yyvsp[0].str_value));
 }
-#line 5046 "parser.cpp"
+#line 5123 "parser.cpp"
     break;
 
-  case 206: /* command_statement: SET SESSION IDENTIFIER LONG_VALUE  */
-#line 1701 "parser.y"
+  case 208: /* command_statement: SET SESSION IDENTIFIER LONG_VALUE  */
+#line 1746 "parser.y"
                                     {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     (yyval.command_stmt) = new infinity::CommandStatement();
     (yyval.command_stmt)->command_info_ = std::make_unique<infinity::SetCmd>(infinity::SetScope::kSession, infinity::SetVarType::kInteger, (yyvsp[-1].str_value), (yyvsp[0].long_value));
     free((yyvsp[-1].str_value));
 }
-#line 5057 "parser.cpp"
+#line 5134 "parser.cpp"
     break;
 
-  case 207: /* command_statement: SET SESSION IDENTIFIER DOUBLE_VALUE  */
-#line 1707 "parser.y"
+  case 209: /* command_statement: SET SESSION IDENTIFIER DOUBLE_VALUE  */
+#line 1752 "parser.y"
                                       {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     (yyval.command_stmt) = new infinity::CommandStatement();
     (yyval.command_stmt)->command_info_ = std::make_unique<infinity::SetCmd>(infinity::SetScope::kSession, infinity::SetVarType::kDouble, (yyvsp[-1].str_value), (yyvsp[0].double_value));
     free((yyvsp[-1].str_value));
 }
-#line 5068 "parser.cpp"
+#line 5145 "parser.cpp"
     break;
 
-  case 208: /* command_statement: SET GLOBAL IDENTIFIER ON  */
-#line 1713 "parser.y"
+  case 210: /* command_statement: SET GLOBAL IDENTIFIER ON  */
+#line 1758 "parser.y"
                            {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     (yyval.command_stmt) = new infinity::CommandStatement();
     (yyval.command_stmt)->command_info_ = std::make_unique<infinity::SetCmd>(infinity::SetScope::kGlobal, infinity::SetVarType::kBool, (yyvsp[-1].str_value), true);
     free((yyvsp[-1].str_value));
 }
-#line 5079 "parser.cpp"
+#line 5156 "parser.cpp"
     break;
 
-  case 209: /* command_statement: SET GLOBAL IDENTIFIER OFF  */
-#line 1719 "parser.y"
+  case 211: /* command_statement: SET GLOBAL IDENTIFIER OFF  */
+#line 1764 "parser.y"
                             {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     (yyval.command_stmt) = new infinity::CommandStatement();
     (yyval.command_stmt)->command_info_ = std::make_unique<infinity::SetCmd>(infinity::SetScope::kGlobal, infinity::SetVarType::kBool, (yyvsp[-1].str_value), false);
     free((yyvsp[-1].str_value));
 }
-#line 5090 "parser.cpp"
+#line 5167 "parser.cpp"
     break;
 
-  case 210: /* command_statement: SET GLOBAL IDENTIFIER STRING  */
-#line 1725 "parser.y"
+  case 212: /* command_statement: SET GLOBAL IDENTIFIER STRING  */
+#line 1770 "parser.y"
                                {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     ParserHelper::ToLower((yyvsp[0].str_value));
@@ -5099,33 +5176,33 @@ yyreduce:
     free((yyvsp[-1].str_value));
     free((yyvsp[0].str_value));
 }
-#line 5103 "parser.cpp"
+#line 5180 "parser.cpp"
     break;
 
-  case 211: /* command_statement: SET GLOBAL IDENTIFIER LONG_VALUE  */
-#line 1733 "parser.y"
+  case 213: /* command_statement: SET GLOBAL IDENTIFIER LONG_VALUE  */
+#line 1778 "parser.y"
                                    {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     (yyval.command_stmt) = new infinity::CommandStatement();
     (yyval.command_stmt)->command_info_ = std::make_unique<infinity::SetCmd>(infinity::SetScope::kGlobal, infinity::SetVarType::kInteger, (yyvsp[-1].str_value), (yyvsp[0].long_value));
     free((yyvsp[-1].str_value));
 }
-#line 5114 "parser.cpp"
+#line 5191 "parser.cpp"
     break;
 
-  case 212: /* command_statement: SET GLOBAL IDENTIFIER DOUBLE_VALUE  */
-#line 1739 "parser.y"
+  case 214: /* command_statement: SET GLOBAL IDENTIFIER DOUBLE_VALUE  */
+#line 1784 "parser.y"
                                      {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     (yyval.command_stmt) = new infinity::CommandStatement();
     (yyval.command_stmt)->command_info_ = std::make_unique<infinity::SetCmd>(infinity::SetScope::kGlobal, infinity::SetVarType::kDouble, (yyvsp[-1].str_value), (yyvsp[0].double_value));
     free((yyvsp[-1].str_value));
 }
-#line 5125 "parser.cpp"
+#line 5202 "parser.cpp"
     break;
 
-  case 213: /* command_statement: COMPACT TABLE table_name  */
-#line 1745 "parser.y"
+  case 215: /* command_statement: COMPACT TABLE table_name  */
+#line 1790 "parser.y"
                            {
     (yyval.command_stmt) = new infinity::CommandStatement();
     if ((yyvsp[0].table_name_t)->schema_name_ptr_ != nullptr) {
@@ -5137,38 +5214,104 @@ yyreduce:
         free((yyvsp[0].table_name_t)->table_name_ptr_);
     } delete (yyvsp[0].table_name_t);
 }
-#line 5141 "parser.cpp"
+#line 5218 "parser.cpp"
     break;
 
-  case 214: /* expr_array: expr_alias  */
-#line 1761 "parser.y"
+  case 216: /* command_statement: IDENTIFIER TABLE table_name  */
+#line 1802 "parser.y"
+                              {
+    ParserHelper::ToLower((yyvsp[-2].str_value));
+    bool is_warmup = strcmp((yyvsp[-2].str_value), "warmup") == 0;
+    free((yyvsp[-2].str_value));
+    std::string schema_name;
+    if ((yyvsp[0].table_name_t)->schema_name_ptr_ != nullptr) {
+        schema_name = (yyvsp[0].table_name_t)->schema_name_ptr_;
+        free((yyvsp[0].table_name_t)->schema_name_ptr_);
+    }
+    std::string table_name = (yyvsp[0].table_name_t)->table_name_ptr_;
+    free((yyvsp[0].table_name_t)->table_name_ptr_);
+    delete (yyvsp[0].table_name_t);
+    if (!is_warmup) {
+        yyerror(&yyloc, scanner, result, "Unknown command");
+        YYERROR;
+    }
+    (yyval.command_stmt) = new infinity::CommandStatement();
+    (yyval.command_stmt)->command_info_ = std::make_unique<infinity::WarmupCmd>(std::move(schema_name), std::move(table_name), std::string());
+}
+#line 5242 "parser.cpp"
+    break;
+
+  case 217: /* command_statement: IDENTIFIER INDEX IDENTIFIER ON table_name  */
+#line 1821 "parser.y"
+                                            {
+    ParserHelper::ToLower((yyvsp[-4].str_value));
+    bool is_warmup = strcmp((yyvsp[-4].str_value), "warmup") == 0;
+    free((yyvsp[-4].str_value));
+    std::string index_name = (yyvsp[-2].str_value);
+    free((yyvsp[-2].str_value));
+    std::string schema_name;
+    if ((yyvsp[0].table_name_t)->schema_name_ptr_ != nullptr) {
+        schema_name = (yyvsp[0].table_name_t)->schema_name_ptr_;
+        free((yyvsp[0].table_name_t)->schema_name_ptr_);
+    }
+    std::string table_name = (yyvsp[0].table_name_t)->table_name_ptr_;
+    free((yyvsp[0].table_name_t)->table_name_ptr_);
+    delete (yyvsp[0].table_name_t);
+    if (!is_warmup) {
+        yyerror(&yyloc, scanner, result, "Unknown command");
+        YYERROR;
+    }
+    (yyval.command_stmt) = new infinity::CommandStatement();
+    (yyval.command_stmt)->command_info_ = std::make_unique<infinity::WarmupCmd>(std::move(schema_name), std::move(table_name), std::move(index_name));
+}
+#line 5268 "parser.cpp"
+    break;
+
+  case 218: /* command_statement: IDENTIFIER IDENTIFIER LONG_VALUE  */
+#line 1843 "parser.y"
+                                   {
+    bool is_kill_query = strcasecmp((yyvsp[-2].str_value), "kill") == 0 && strcasecmp((yyvsp[-1].str_value), "query") == 0;
+    free((yyvsp[-2].str_value));
+    free((yyvsp[-1].str_value));
+    if (!is_kill_query || (yyvsp[0].long_value) < 0) {
+        yyerror(&yyloc, scanner, result, "Unknown command");
+        YYERROR;
+    }
+    (yyval.command_stmt) = new infinity::CommandStatement();
+    (yyval.command_stmt)->command_info_ = std::make_unique<infinity::KillQueryCmd>((yyvsp[0].long_value));
+}
+#line 5284 "parser.cpp"
+    break;
+
+  case 219: /* expr_array: expr_alias  */
+#line 1859 "parser.y"
                         {
     (yyval.expr_array_t) = new std::vector<infinity::ParsedExpr*>();
     (yyval.expr_array_t)->emplace_back((yyvsp[0].expr_t));
 }
-#line 5150 "parser.cpp"
+#line 5293 "parser.cpp"
     break;
 
-  case 215: /* expr_array: expr_array ',' expr_alias  */
-#line 1765 "parser.y"
+  case 220: /* expr_array: expr_array ',' expr_alias  */
+#line 1863 "parser.y"
                             {
     (yyvsp[-2].expr_array_t)->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_array_t) = (yyvsp[-2].expr_array_t);
 }
-#line 5159 "parser.cpp"
+#line 5302 "parser.cpp"
     break;
 
-  case 216: /* expr_array_list: '(' expr_array ')'  */
-#line 1770 "parser.y"
+  case 221: /* expr_array_list: '(' expr_array ')'  */
+#line 1868 "parser.y"
                                      {
     (yyval.expr_array_list_t) = new std::vector<std::vector<infinity::ParsedExpr*>*>();
     (yyval.expr_array_list_t)->push_back((yyvsp[-1].expr_array_t));
 }
-#line 5168 "parser.cpp"
+#line 5311 "parser.cpp"
     break;
 
-  case 217: /* expr_array_list: expr_array_list ',' '(' expr_array ')'  */
-#line 1774 "parser.y"
+  case 222: /* expr_array_list: expr_array_list ',' '(' expr_array ')'  */
+#line 1872 "parser.y"
                                          {
     if(!(yyvsp[-4].expr_array_list_t)->empty() && (yyvsp[-4].expr_array_list_t)->back()->size() != (yyvsp[-1].expr_array_t)->size()) {
         yyerror(&yyloc, scanner, result, "The expr_array in list shall have the same size.");
@@ -5184,57 +5327,57 @@ yyreduce:
     (yyvsp[-4].expr_array_list_t)->push_back((yyvsp[-1].expr_array_t));
     (yyval.expr_array_list_t) = (yyvsp[-4].expr_array_list_t);
 }
-#line 5188 "parser.cpp"
+#line 5331 "parser.cpp"
     break;
 
-  case 218: /* expr_alias: expr AS IDENTIFIER  */
-#line 1801 "parser.y"
+  case 223: /* expr_alias: expr AS IDENTIFIER  */
+#line 1899 "parser.y"
                                 {
     (yyval.expr_t) = (yyvsp[-2].expr_t);
     ParserHelper::ToLower((yyvsp[0].str_value));
     (yyval.expr_t)->alias_ = (yyvsp[0].str_value);
     free((yyvsp[0].str_value));
 }
-#line 5199 "parser.cpp"
+#line 5342 "parser.cpp"
     break;
 
-  case 219: /* expr_alias: expr  */
-#line 1807 "parser.y"
+  case 224: /* expr_alias: expr  */
+#line 1905 "parser.y"
        {
     (yyval.expr_t) = (yyvsp[0].expr_t);
 }
-#line 5207 "parser.cpp"
+#line 5350 "parser.cpp"
     break;
 
-  case 225: /* operand: '(' expr ')'  */
-#line 1817 "parser.y"
+  case 230: /* operand: '(' expr ')'  */
+#line 1915 "parser.y"
                       {
    (yyval.expr_t) = (yyvsp[-1].expr_t);
 }
-#line 5215 "parser.cpp"
+#line 5358 "parser.cpp"
     break;
 
-  case 226: /* operand: '(' select_without_paren ')'  */
-#line 1820 "parser.y"
+  case 231: /* operand: '(' select_without_paren ')'  */
+#line 1918 "parser.y"
                                {
     infinity::SubqueryExpr* subquery_expr = new infinity::SubqueryExpr();
     subquery_expr->subquery_type_ = infinity::SubqueryType::kScalar;
     subquery_expr->select_ = (yyvsp[-1].select_stmt);
     (yyval.expr_t) = subquery_expr;
 }
-#line 5226 "parser.cpp"
+#line 5369 "parser.cpp"
     break;
 
-  case 227: /* operand: constant_expr  */
-#line 1826 "parser.y"
+  case 232: /* operand: constant_expr  */
+#line 1924 "parser.y"
                 {
     (yyval.expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 5234 "parser.cpp"
+#line 5377 "parser.cpp"
     break;
 
-  case 236: /* knn_expr: KNN '(' expr ',' array_expr ',' STRING ',' STRING ',' LONG_VALUE ')' with_index_param_list  */
-#line 1838 "parser.y"
+  case 241: /* knn_expr: KNN '(' expr ',' array_expr ',' STRING ',' STRING ',' LONG_VALUE ')' with_index_param_list  */
+#line 1936 "parser.y"
                                                                                                       {
     infinity::KnnExpr* knn_expr = new infinity::KnnExpr();
     (yyval.expr_t) = knn_expr;
@@ -5252,6 +5395,8 @@ yyreduce:
         knn_expr->distance_type_ = infinity::KnnDistanceType::kCosine;
     } else if(strcmp((yyvsp[-4].str_value), "hamming") == 0) {
         knn_expr->distance_type_ = infinity::KnnDistanceType::kHamming;
+    } else if(strcmp((yyvsp[-4].str_value), "maxsim") == 0) {
+        knn_expr->distance_type_ = infinity::KnnDistanceType::kMaxSim;
     } else {
         for (auto* param_ptr: *(yyvsp[0].with_index_param_list_t)) {
             delete param_ptr;
@@ -5401,11 +5546,11 @@ yyreduce:
     knn_expr->topn_ = (yyvsp[-2].long_value);
     knn_expr->opt_params_ = (yyvsp[0].with_index_param_list_t);
 }
-#line 5405 "parser.cpp"
+#line 5550 "parser.cpp"
     break;
 
-  case 237: /* match_expr: MATCH '(' STRING ',' STRING ')'  */
-#line 2005 "parser.y"
+  case 242: /* match_expr: MATCH '(' STRING ',' STRING ')'  */
+#line 2105 "parser.y"
                                              {
     infinity::MatchExpr* match_expr = new infinity::MatchExpr();
     match_expr->fields_ = std::string((yyvsp[-3].str_value));
@@ -5414,11 +5559,11 @@ yyreduce:
     free((yyvsp[-1].str_value));
     (yyval.expr_t) = match_expr;
 }
-#line 5418 "parser.cpp"
+#line 5563 "parser.cpp"
     break;
 
-  case 238: /* match_expr: MATCH '(' STRING ',' STRING ',' STRING ')'  */
-#line 2013 "parser.y"
+  case 243: /* match_expr: MATCH '(' STRING ',' STRING ',' STRING ')'  */
+#line 2113 "parser.y"
                                              {
     infinity::MatchExpr* match_expr = new infinity::MatchExpr();
     match_expr->fields_ = std::string((yyvsp[-5].str_value));
@@ -5429,22 +5574,22 @@ yyreduce:
     free((yyvsp[-1].str_value));
     (yyval.expr_t) = match_expr;
 }
-#line 5433 "parser.cpp"
+#line 5578 "parser.cpp"
     break;
 
-  case 239: /* query_expr: QUERY '(' STRING ')'  */
-#line 2024 "parser.y"
+  case 244: /* query_expr: QUERY '(' STRING ')'  */
+#line 2124 "parser.y"
                                   {
     infinity::MatchExpr* match_expr = new infinity::MatchExpr();
     match_expr->matching_text_ = std::string((yyvsp[-1].str_value));
     free((yyvsp[-1].str_value));
     (yyval.expr_t) = match_expr;
 }
-#line 5444 "parser.cpp"
+#line 5589 "parser.cpp"
     break;
 
-  case 240: /* query_expr: QUERY '(' STRING ',' STRING ')'  */
-#line 2030 "parser.y"
+  case 245: /* query_expr: QUERY '(' STRING ',' STRING ')'  */
+#line 2130 "parser.y"
                                   {
     infinity::MatchExpr* match_expr = new infinity::MatchExpr();
     match_expr->matching_text_ = std::string((yyvsp[-3].str_value));
@@ -5453,22 +5598,22 @@ yyreduce:
     free((yyvsp[-1].str_value));
     (yyval.expr_t) = match_expr;
 }
-#line 5457 "parser.cpp"
+#line 5602 "parser.cpp"
     break;
 
-  case 241: /* fusion_expr: FUSION '(' STRING ')'  */
-#line 2039 "parser.y"
+  case 246: /* fusion_expr: FUSION '(' STRING ')'  */
+#line 2139 "parser.y"
                                     {
     infinity::FusionExpr* fusion_expr = new infinity::FusionExpr();
     fusion_expr->method_ = std::string((yyvsp[-1].str_value));
     free((yyvsp[-1].str_value));
     (yyval.expr_t) = fusion_expr;
 }
-#line 5468 "parser.cpp"
+#line 5613 "parser.cpp"
     break;
 
-  case 242: /* fusion_expr: FUSION '(' STRING ',' STRING ')'  */
-#line 2045 "parser.y"
+  case 247: /* fusion_expr: FUSION '(' STRING ',' STRING ')'  */
+#line 2145 "parser.y"
                                    {
     infinity::FusionExpr* fusion_expr = new infinity::FusionExpr();
     fusion_expr->method_ = std::string((yyvsp[-3].str_value));
@@ -5477,83 +5622,83 @@ yyreduce:
     free((yyvsp[-1].str_value));
     (yyval.expr_t) = fusion_expr;
 }
-#line 5481 "parser.cpp"
+#line 5626 "parser.cpp"
     break;
 
-  case 243: /* sub_search_array: knn_expr  */
-#line 2055 "parser.y"
+  case 248: /* sub_search_array: knn_expr  */
+#line 2155 "parser.y"
                             {
     (yyval.expr_array_t) = new std::vector<infinity::ParsedExpr*>();
     (yyval.expr_array_t)->emplace_back((yyvsp[0].expr_t));
 }
-#line 5490 "parser.cpp"
+#line 5635 "parser.cpp"
     break;
 
-  case 244: /* sub_search_array: match_expr  */
-#line 2059 "parser.y"
+  case 249: /* sub_search_array: match_expr  */
+#line 2159 "parser.y"
              {
     (yyval.expr_array_t) = new std::vector<infinity::ParsedExpr*>();
     (yyval.expr_array_t)->emplace_back((yyvsp[0].expr_t));
 }
-#line 5499 "parser.cpp"
+#line 5644 "parser.cpp"
     break;
 
-  case 245: /* sub_search_array: query_expr  */
-#line 2063 "parser.y"
+  case 250: /* sub_search_array: query_expr  */
+#line 2163 "parser.y"
              {
     (yyval.expr_array_t) = new std::vector<infinity::ParsedExpr*>();
     (yyval.expr_array_t)->emplace_back((yyvsp[0].expr_t));
 }
-#line 5508 "parser.cpp"
+#line 5653 "parser.cpp"
     break;
 
-  case 246: /* sub_search_array: fusion_expr  */
-#line 2067 "parser.y"
+  case 251: /* sub_search_array: fusion_expr  */
+#line 2167 "parser.y"
               {
     (yyval.expr_array_t) = new std::vector<infinity::ParsedExpr*>();
     (yyval.expr_array_t)->emplace_back((yyvsp[0].expr_t));
 }
-#line 5517 "parser.cpp"
+#line 5662 "parser.cpp"
     break;
 
-  case 247: /* sub_search_array: sub_search_array ',' knn_expr  */
-#line 2071 "parser.y"
+  case 252: /* sub_search_array: sub_search_array ',' knn_expr  */
+#line 2171 "parser.y"
                                 {
     (yyvsp[-2].expr_array_t)->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_array_t) = (yyvsp[-2].expr_array_t);
 }
-#line 5526 "parser.cpp"
+#line 5671 "parser.cpp"
     break;
 
-  case 248: /* sub_search_array: sub_search_array ',' match_expr  */
-#line 2075 "parser.y"
+  case 253: /* sub_search_array: sub_search_array ',' match_expr  */
+#line 2175 "parser.y"
                                   {
     (yyvsp[-2].expr_array_t)->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_array_t) = (yyvsp[-2].expr_array_t);
 }
-#line 5535 "parser.cpp"
+#line 5680 "parser.cpp"
     break;
 
-  case 249: /* sub_search_array: sub_search_array ',' query_expr  */
-#line 2079 "parser.y"
+  case 254: /* sub_search_array: sub_search_array ',' query_expr  */
+#line 2179 "parser.y"
                                   {
     (yyvsp[-2].expr_array_t)->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_array_t) = (yyvsp[-2].expr_array_t);
 }
-#line 5544 "parser.cpp"
+#line 5689 "parser.cpp"
     break;
 
-  case 250: /* sub_search_array: sub_search_array ',' fusion_expr  */
-#line 2083 "parser.y"
+  case 255: /* sub_search_array: sub_search_array ',' fusion_expr  */
+#line 2183 "parser.y"
                                    {
     (yyvsp[-2].expr_array_t)->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_array_t) = (yyvsp[-2].expr_array_t);
 }
-#line 5553 "parser.cpp"
+#line 5698 "parser.cpp"
     break;
 
-  case 251: /* function_expr: IDENTIFIER '(' ')'  */
-#line 2088 "parser.y"
+  case 256: /* function_expr: IDENTIFIER '(' ')'  */
+#line 2188 "parser.y"
                                    {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     ParserHelper::ToLower((yyvsp[-2].str_value));
@@ -5562,11 +5707,11 @@ yyreduce:
     func_expr->arguments_ = nullptr;
     (yyval.expr_t) = func_expr;
 }
-#line 5566 "parser.cpp"
+#line 5711 "parser.cpp"
     break;
 
-  case 252: /* function_expr: IDENTIFIER '(' expr_array ')'  */
-#line 2096 "parser.y"
+  case 257: /* function_expr: IDENTIFIER '(' expr_array ')'  */
+#line 2196 "parser.y"
                                 {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     ParserHelper::ToLower((yyvsp[-3].str_value));
@@ -5575,11 +5720,11 @@ yyreduce:
     func_expr->arguments_ = (yyvsp[-1].expr_array_t);
     (yyval.expr_t) = func_expr;
 }
-#line 5579 "parser.cpp"
+#line 5724 "parser.cpp"
     break;
 
-  case 253: /* function_expr: IDENTIFIER '(' DISTINCT expr_array ')'  */
-#line 2104 "parser.y"
+  case 258: /* function_expr: IDENTIFIER '(' DISTINCT expr_array ')'  */
+#line 2204 "parser.y"
                                          {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     ParserHelper::ToLower((yyvsp[-4].str_value));
@@ -5589,11 +5734,11 @@ yyreduce:
     func_expr->distinct_ = true;
     (yyval.expr_t) = func_expr;
 }
-#line 5593 "parser.cpp"
+#line 5738 "parser.cpp"
     break;
 
-  case 254: /* function_expr: operand IS NOT NULLABLE  */
-#line 2113 "parser.y"
+  case 259: /* function_expr: operand IS NOT NULLABLE  */
+#line 2213 "parser.y"
                           {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "is_not_null";
@@ -5601,11 +5746,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[-3].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 5605 "parser.cpp"
+#line 5750 "parser.cpp"
     break;
 
-  case 255: /* function_expr: operand IS NULLABLE  */
-#line 2120 "parser.y"
+  case 260: /* function_expr: operand IS NULLABLE  */
+#line 2220 "parser.y"
                       {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "is_null";
@@ -5613,11 +5758,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[-2].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 5617 "parser.cpp"
+#line 5762 "parser.cpp"
     break;
 
-  case 256: /* function_expr: NOT operand  */
-#line 2127 "parser.y"
+  case 261: /* function_expr: NOT operand  */
+#line 2227 "parser.y"
               {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "not";
@@ -5625,11 +5770,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 5629 "parser.cpp"
+#line 5774 "parser.cpp"
     break;
 
-  case 257: /* function_expr: '-' operand  */
-#line 2134 "parser.y"
+  case 262: /* function_expr: '-' operand  */
+#line 2234 "parser.y"
               {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "-";
@@ -5637,11 +5782,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 5641 "parser.cpp"
+#line 5786 "parser.cpp"
     break;
 
-  case 258: /* function_expr: '+' operand  */
-#line 2141 "parser.y"
+  case 263: /* function_expr: '+' operand  */
+#line 2241 "parser.y"
               {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "+";
@@ -5649,11 +5794,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 5653 "parser.cpp"
+#line 5798 "parser.cpp"
     break;
 
-  case 259: /* function_expr: operand '-' operand  */
-#line 2148 "parser.y"
+  case 264: /* function_expr: operand '-' operand  */
+#line 2248 "parser.y"
                       {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "-";
@@ -5662,11 +5807,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 5666 "parser.cpp"
+#line 5811 "parser.cpp"
     break;
 
-  case 260: /* function_expr: operand '+' operand  */
-#line 2156 "parser.y"
+  case 265: /* function_expr: operand '+' operand  */
+#line 2256 "parser.y"
                       {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "+";
@@ -5675,11 +5820,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 5679 "parser.cpp"
+#line 5824 "parser.cpp"
     break;
 
-  case 261: /* function_expr: operand '*' operand  */
-#line 2164 "parser.y"
+  case 266: /* function_expr: operand '*' operand  */
+#line 2264 "parser.y"
                       {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "*";
@@ -5688,11 +5833,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 5692 "parser.cpp"
+#line 5837 "parser.cpp"
     break;
 
-  case 262: /* function_expr: operand '/' operand  */
-#line 2172 "parser.y"
+  case 267: /* function_expr: operand '/' operand  */
+#line 2272 "parser.y"
                       {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "/";
@@ -5701,11 +5846,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 5705 "parser.cpp"
+#line 5850 "parser.cpp"
     break;
 
-  case 263: /* function_expr: operand '%' operand  */
-#line 2180 "parser.y"
+  case 268: /* function_expr: operand '%' operand  */
+#line 2280 "parser.y"
                       {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "%";
@@ -5714,11 +5859,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 5718 "parser.cpp"
+#line 5863 "parser.cpp"
     break;
 
-  case 264: /* function_expr: operand '=' operand  */
-#line 2188 "parser.y"
+  case 269: /* function_expr: operand '=' operand  */
+#line 2288 "parser.y"
                       {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "=";
@@ -5727,11 +5872,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 5731 "parser.cpp"
+#line 5876 "parser.cpp"
     break;
 
-  case 265: /* function_expr: operand EQUAL operand  */
-#line 2196 "parser.y"
+  case 270: /* function_expr: operand EQUAL operand  */
+#line 2296 "parser.y"
                         {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "=";
@@ -5740,11 +5885,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 5744 "parser.cpp"
+#line 5889 "parser.cpp"
     break;
 
-  case 266: /* function_expr: operand NOT_EQ operand  */
-#line 2204 "parser.y"
+  case 271: /* function_expr: operand NOT_EQ operand  */
+#line 2304 "parser.y"
                          {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "<>";
@@ -5753,11 +5898,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 5757 "parser.cpp"
+#line 5902 "parser.cpp"
     break;
 
-  case 267: /* function_expr: operand '<' operand  */
-#line 2212 "parser.y"
+  case 272: /* function_expr: operand '<' operand  */
+#line 2312 "parser.y"
                       {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "<";
@@ -5766,11 +5911,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 5770 "parser.cpp"
+#line 5915 "parser.cpp"
     break;
 
-  case 268: /* function_expr: operand '>' operand  */
-#line 2220 "parser.y"
+  case 273: /* function_expr: operand '>' operand  */
+#line 2320 "parser.y"
                       {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = ">";
@@ -5779,11 +5924,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 5783 "parser.cpp"
+#line 5928 "parser.cpp"
     break;
 
-  case 269: /* function_expr: operand LESS_EQ operand  */
-#line 2228 "parser.y"
+  case 274: /* function_expr: operand LESS_EQ operand  */
+#line 2328 "parser.y"
                           {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "<=";
@@ -5792,11 +5937,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 5796 "parser.cpp"
+#line 5941 "parser.cpp"
     break;
 
-  case 270: /* function_expr: operand GREATER_EQ operand  */
-#line 2236 "parser.y"
+  case 275: /* function_expr: operand GREATER_EQ operand  */
+#line 2336 "parser.y"
                              {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = ">=";
@@ -5805,11 +5950,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 5809 "parser.cpp"
+#line 5954 "parser.cpp"
     break;
 
-  case 271: /* function_expr: EXTRACT '(' STRING FROM operand ')'  */
-#line 2244 "parser.y"
+  case 276: /* function_expr: EXTRACT '(' STRING FROM operand ')'  */
+#line 2344 "parser.y"
                                       {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     ParserHelper::ToLower((yyvsp[-3].str_value));
@@ -5840,11 +5985,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[-1].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 5844 "parser.cpp"
+#line 5989 "parser.cpp"
     break;
 
-  case 272: /* function_expr: operand LIKE operand  */
-#line 2274 "parser.y"
+  case 277: /* function_expr: operand LIKE operand  */
+#line 2374 "parser.y"
                        {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "like";
@@ -5853,11 +5998,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 5857 "parser.cpp"
+#line 6002 "parser.cpp"
     break;
 
-  case 273: /* function_expr: operand NOT LIKE operand  */
-#line 2282 "parser.y"
+  case 278: /* function_expr: operand NOT LIKE operand  */
+#line 2382 "parser.y"
                            {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "not_like";
@@ -5866,11 +6011,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 5870 "parser.cpp"
+#line 6015 "parser.cpp"
     break;
 
-  case 274: /* conjunction_expr: expr AND expr  */
-#line 2291 "parser.y"
+  case 279: /* conjunction_expr: expr AND expr  */
+#line 2391 "parser.y"
                                 {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "and";
@@ -5879,11 +6024,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 5883 "parser.cpp"
+#line 6028 "parser.cpp"
     break;
 
-  case 275: /* conjunction_expr: expr OR expr  */
-#line 2299 "parser.y"
+  case 280: /* conjunction_expr: expr OR expr  */
+#line 2399 "parser.y"
                {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "or";
@@ -5892,11 +6037,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 5896 "parser.cpp"
+#line 6041 "parser.cpp"
     break;
 
-  case 276: /* between_expr: operand BETWEEN operand AND operand  */
-#line 2308 "parser.y"
+  case 281: /* between_expr: operand BETWEEN operand AND operand  */
+#line 2408 "parser.y"
                                                   {
     infinity::BetweenExpr* between_expr = new infinity::BetweenExpr();
     between_expr->value_ = (yyvsp[-4].expr_t);
@@ -5904,44 +6049,44 @@ yyreduce:
     between_expr->upper_bound_ = (yyvsp[0].expr_t);
     (yyval.expr_t) = between_expr;
 }
-#line 5908 "parser.cpp"
+#line 6053 "parser.cpp"
     break;
 
-  case 277: /* in_expr: operand IN '(' expr_array ')'  */
-#line 2316 "parser.y"
+  case 282: /* in_expr: operand IN '(' expr_array ')'  */
+#line 2416 "parser.y"
                                        {
     infinity::InExpr* in_expr = new infinity::InExpr(true);
     in_expr->left_ = (yyvsp[-4].expr_t);
     in_expr->arguments_ = (yyvsp[-1].expr_array_t);
     (yyval.expr_t) = in_expr;
 }
-#line 5919 "parser.cpp"
+#line 6064 "parser.cpp"
     break;
 
-  case 278: /* in_expr: operand NOT IN '(' expr_array ')'  */
-#line 2322 "parser.y"
+  case 283: /* in_expr: operand NOT IN '(' expr_array ')'  */
+#line 2422 "parser.y"
                                     {
     infinity::InExpr* in_expr = new infinity::InExpr(false);
     in_expr->left_ = (yyvsp[-5].expr_t);
     in_expr->arguments_ = (yyvsp[-1].expr_array_t);
     (yyval.expr_t) = in_expr;
 }
-#line 5930 "parser.cpp"
+#line 6075 "parser.cpp"
     break;
 
-  case 279: /* case_expr: CASE expr case_check_array END  */
-#line 2329 "parser.y"
+  case 284: /* case_expr: CASE expr case_check_array END  */
+#line 2429 "parser.y"
                                           {
     infinity::CaseExpr* case_expr = new infinity::CaseExpr();
     case_expr->expr_ = (yyvsp[-2].expr_t);
     case_expr->case_check_array_ = (yyvsp[-1].case_check_array_t);
     (yyval.expr_t) = case_expr;
 }
-#line 5941 "parser.cpp"
+#line 6086 "parser.cpp"
     break;
 
-  case 280: /* case_expr: CASE expr case_check_array ELSE expr END  */
-#line 2335 "parser.y"
+  case 285: /* case_expr: CASE expr case_check_array ELSE expr END  */
+#line 2435 "parser.y"
                                            {
     infinity::CaseExpr* case_expr = new infinity::CaseExpr();
     case_expr->expr_ = (yyvsp[-4].expr_t);
@@ -5949,32 +6094,32 @@ yyreduce:
     case_expr->else_expr_ = (yyvsp[-1].expr_t);
     (yyval.expr_t) = case_expr;
 }
-#line 5953 "parser.cpp"
+#line 6098 "parser.cpp"
     break;
 
-  case 281: /* case_expr: CASE case_check_array END  */
-#line 2342 "parser.y"
+  case 286: /* case_expr: CASE case_check_array END  */
+#line 2442 "parser.y"
                             {
     infinity::CaseExpr* case_expr = new infinity::CaseExpr();
     case_expr->case_check_array_ = (yyvsp[-1].case_check_array_t);
     (yyval.expr_t) = case_expr;
 }
-#line 5963 "parser.cpp"
+#line 6108 "parser.cpp"
     break;
 
-  case 282: /* case_expr: CASE case_check_array ELSE expr END  */
-#line 2347 "parser.y"
+  case 287: /* case_expr: CASE case_check_array ELSE expr END  */
+#line 2447 "parser.y"
                                       {
     infinity::CaseExpr* case_expr = new infinity::CaseExpr();
     case_expr->case_check_array_ = (yyvsp[-3].case_check_array_t);
     case_expr->else_expr_ = (yyvsp[-1].expr_t);
     (yyval.expr_t) = case_expr;
 }
-#line 5974 "parser.cpp"
+#line 6119 "parser.cpp"
     break;
 
-  case 283: /* case_check_array: WHEN expr THEN expr  */
-#line 2354 "parser.y"
+  case 288: /* case_check_array: WHEN expr THEN expr  */
+#line 2454 "parser.y"
                                       {
     (yyval.case_check_array_t) = new std::vector<infinity::WhenThen*>();
     infinity::WhenThen* when_then_ptr = new infinity::WhenThen();
@@ -5982,11 +6127,11 @@ yyreduce:
     when_then_ptr->then_ = (yyvsp[0].expr_t);
     (yyval.case_check_array_t)->emplace_back(when_then_ptr);
 }
-#line 5986 "parser.cpp"
+#line 6131 "parser.cpp"
     break;
 
-  case 284: /* case_check_array: case_check_array WHEN expr THEN expr  */
-#line 2361 "parser.y"
+  case 289: /* case_check_array: case_check_array WHEN expr THEN expr  */
+#line 2461 "parser.y"
                                        {
     infinity::WhenThen* when_then_ptr = new infinity::WhenThen();
     when_then_ptr->when_ = (yyvsp[-2].expr_t);
@@ -5994,11 +6139,11 @@ yyreduce:
     (yyvsp[-4].case_check_array_t)->emplace_back(when_then_ptr);
     (yyval.case_check_array_t) = (yyvsp[-4].case_check_array_t);
 }
-#line 5998 "parser.cpp"
+#line 6143 "parser.cpp"
     break;
 
-  case 285: /* cast_expr: CAST '(' expr AS column_type ')'  */
-#line 2369 "parser.y"
+  case 290: /* cast_expr: CAST '(' expr AS column_type ')'  */
+#line 2469 "parser.y"
                                             {
     std::shared_ptr<infinity::TypeInfo> type_info_ptr{nullptr};
     switch((yyvsp[-1].column_type_t).logical_type_) {
@@ -6022,33 +6167,33 @@ yyreduce:
     cast_expr->expr_ = (yyvsp[-3].expr_t);
     (yyval.expr_t) = cast_expr;
 }
-#line 6026 "parser.cpp"
+#line 6171 "parser.cpp"
     break;
 
-  case 286: /* subquery_expr: EXISTS '(' select_without_paren ')'  */
-#line 2393 "parser.y"
+  case 291: /* subquery_expr: EXISTS '(' select_without_paren ')'  */
+#line 2493 "parser.y"
                                                    {
     infinity::SubqueryExpr* subquery_expr = new infinity::SubqueryExpr();
     subquery_expr->subquery_type_ = infinity::SubqueryType::kExists;
     subquery_expr->select_ = (yyvsp[-1].select_stmt);
     (yyval.expr_t) = subquery_expr;
 }
-#line 6037 "parser.cpp"
+#line 6182 "parser.cpp"
     break;
 
-  case 287: /* subquery_expr: NOT EXISTS '(' select_without_paren ')'  */
-#line 2399 "parser.y"
+  case 292: /* subquery_expr: NOT EXISTS '(' select_without_paren ')'  */
+#line 2499 "parser.y"
                                           {
     infinity::SubqueryExpr* subquery_expr = new infinity::SubqueryExpr();
     subquery_expr->subquery_type_ = infinity::SubqueryType::kNotExists;
     subquery_expr->select_ = (yyvsp[-1].select_stmt);
     (yyval.expr_t) = subquery_expr;
 }
-#line 6048 "parser.cpp"
+#line 6193 "parser.cpp"
     break;
 
-  case 288: /* subquery_expr: operand IN '(' select_without_paren ')'  */
-#line 2405 "parser.y"
+  case 293: /* subquery_expr: operand IN '(' select_without_paren ')'  */
+#line 2505 "parser.y"
                                           {
     infinity::SubqueryExpr* subquery_expr = new infinity::SubqueryExpr();
     subquery_expr->subquery_type_ = infinity::SubqueryType::kIn;
@@ -6056,11 +6201,11 @@ yyreduce:
     subquery_expr->select_ = (yyvsp[-1].select_stmt);
     (yyval.expr_t) = subquery_expr;
 }
-#line 6060 "parser.cpp"
+#line 6205 "parser.cpp"
     break;
 
-  case 289: /* subquery_expr: operand NOT IN '(' select_without_paren ')'  */
-#line 2412 "parser.y"
+  case 294: /* subquery_expr: operand NOT IN '(' select_without_paren ')'  */
+#line 2512 "parser.y"
                                               {
     infinity::SubqueryExpr* subquery_expr = new infinity::SubqueryExpr();
     subquery_expr->subquery_type_ = infinity::SubqueryType::kNotIn;
@@ -6068,11 +6213,11 @@ yyreduce:
     subquery_expr->select_ = (yyvsp[-1].select_stmt);
     (yyval.expr_t) = subquery_expr;
 }
-#line 6072 "parser.cpp"
+#line 6217 "parser.cpp"
     break;
 
-  case 290: /* column_expr: IDENTIFIER  */
-#line 2420 "parser.y"
+  case 295: /* column_expr: IDENTIFIER  */
+#line 2520 "parser.y"
                          {
     infinity::ColumnExpr* column_expr = new infinity::ColumnExpr();
     ParserHelper::ToLower((yyvsp[0].str_value));
@@ -6080,11 +6225,11 @@ yyreduce:
     free((yyvsp[0].str_value));
     (yyval.expr_t) = column_expr;
 }
-#line 6084 "parser.cpp"
+#line 6229 "parser.cpp"
     break;
 
-  case 291: /* column_expr: column_expr '.' IDENTIFIER  */
-#line 2427 "parser.y"
+  case 296: /* column_expr: column_expr '.' IDENTIFIER  */
+#line 2527 "parser.y"
                              {
     infinity::ColumnExpr* column_expr = (infinity::ColumnExpr*)(yyvsp[-2].expr_t);
     ParserHelper::ToLower((yyvsp[0].str_value));
@@ -6092,21 +6237,21 @@ yyreduce:
     free((yyvsp[0].str_value));
     (yyval.expr_t) = column_expr;
 }
-#line 6096 "parser.cpp"
+#line 6241 "parser.cpp"
     break;
 
-  case 292: /* column_expr: '*'  */
-#line 2434 "parser.y"
+  case 297: /* column_expr: '*'  */
+#line 2534 "parser.y"
       {
     infinity::ColumnExpr* column_expr = new infinity::ColumnExpr();
     column_expr->star_ = true;
     (yyval.expr_t) = column_expr;
 }
-#line 6106 "parser.cpp"
+#line 6251 "parser.cpp"
     break;
 
-  case 293: /* column_expr: column_expr '.' '*'  */
-#line 2439 "parser.y"
+  case 298: /* column_expr: column_expr '.' '*'  */
+#line 2539 "parser.y"
                       {
     infinity::ColumnExpr* column_expr = (infinity::ColumnExpr*)(yyvsp[-2].expr_t);
     if(column_expr->star_) {
@@ -6116,353 +6261,372 @@ yyreduce:
     column_expr->star_ = true;
     (yyval.expr_t) = column_expr;
 }
-#line 6120 "parser.cpp"
+#line 6265 "parser.cpp"
     break;
 
-  case 294: /* constant_expr: STRING  */
-#line 2449 "parser.y"
+  case 299: /* constant_expr: STRING  */
+#line 2549 "parser.y"
                       {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kString);
     const_expr->str_value_ = (yyvsp[0].str_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6130 "parser.cpp"
+#line 6275 "parser.cpp"
     break;
 
-  case 295: /* constant_expr: TRUE  */
-#line 2454 "parser.y"
+  case 300: /* constant_expr: TRUE  */
+#line 2554 "parser.y"
        {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kBoolean);
     const_expr->bool_value_ = true;
     (yyval.const_expr_t) = const_expr;
 }
-#line 6140 "parser.cpp"
+#line 6285 "parser.cpp"
     break;
 
-  case 296: /* constant_expr: FALSE  */
-#line 2459 "parser.y"
+  case 301: /* constant_expr: FALSE  */
+#line 2559 "parser.y"
         {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kBoolean);
     const_expr->bool_value_ = false;
     (yyval.const_expr_t) = const_expr;
 }
-#line 6150 "parser.cpp"
+#line 6295 "parser.cpp"
     break;
 
-  case 297: /* constant_expr: DOUBLE_VALUE  */
-#line 2464 "parser.y"
+  case 302: /* constant_expr: DOUBLE_VALUE  */
+#line 2564 "parser.y"
                {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kDouble);
     const_expr->double_value_ = (yyvsp[0].double_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6160 "parser.cpp"
+#line 6305 "parser.cpp"
     break;
 
-  case 298: /* constant_expr: LONG_VALUE  */
-#line 2469 "parser.y"
+  case 303: /* constant_expr: LONG_VALUE  */
+#line 2569 "parser.y"
              {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInteger);
     const_expr->integer_value_ = (yyvsp[0].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6170 "parser.cpp"
+#line 6315 "parser.cpp"
     break;
 
-  case 299: /* constant_expr: DATE STRING  */
-#line 2474 "parser.y"
+  case 304: /* constant_expr: DATE STRING  */
+#line 2574 "parser.y"
               {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kDate);
     const_expr->date_value_ = (yyvsp[0].str_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6180 "parser.cpp"
+#line 6325 "parser.cpp"
     break;
 
-  case 300: /* constant_expr: TIME STRING  */
-#line 2479 "parser.y"
+  case 305: /* constant_expr: TIME STRING  */
+#line 2579 "parser.y"
               {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kTime);
     const_expr->date_value_ = (yyvsp[0].str_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6190 "parser.cpp"
+#line 6335 "parser.cpp"
     break;
 
-  case 301: /* constant_expr: DATETIME STRING  */
-#line 2484 "parser.y"
+  case 306: /* constant_expr: DATETIME STRING  */
+#line 2584 "parser.y"
                   {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kDateTime);
     const_expr->date_value_ = (yyvsp[0].str_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6200 "parser.cpp"
+#line 6345 "parser.cpp"
     break;
 
-  case 302: /* constant_expr: TIMESTAMP STRING  */
-#line 2489 "parser.y"
+  case 307: /* constant_expr: TIMESTAMP STRING  */
+#line 2589 "parser.y"
                    {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kTimestamp);
     const_expr->date_value_ = (yyvsp[0].str_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6210 "parser.cpp"
+#line 6355 "parser.cpp"
     break;
 
-  case 303: /* constant_expr: INTERVAL interval_expr  */
-#line 2494 "parser.y"
+  case 308: /* constant_expr: INTERVAL interval_expr  */
+#line 2594 "parser.y"
                          {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 6218 "parser.cpp"
+#line 6363 "parser.cpp"
     break;
 
-  case 304: /* constant_expr: interval_expr  */
-#line 2497 "parser.y"
+  case 309: /* constant_expr: interval_expr  */
+#line 2597 "parser.y"
                 {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 6226 "parser.cpp"
+#line 6371 "parser.cpp"
     break;
 
-  case 305: /* constant_expr: long_array_expr  */
-#line 2500 "parser.y"
+  case 310: /* constant_expr: long_array_expr  */
+#line 2600 "parser.y"
                   {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 6234 "parser.cpp"
+#line 6379 "parser.cpp"
     break;
 
-  case 306: /* constant_expr: double_array_expr  */
-#line 2503 "parser.y"
+  case 311: /* constant_expr: double_array_expr  */
+#line 2603 "parser.y"
                     {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 6242 "parser.cpp"
+#line 6387 "parser.cpp"
     break;
 
-  case 307: /* array_expr: long_array_expr  */
-#line 2507 "parser.y"
+  case 312: /* constant_expr: parameter_expr  */
+#line 2606 "parser.y"
+                 {
+    (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
+}
+#line 6395 "parser.cpp"
+    break;
+
+  case 313: /* array_expr: long_array_expr  */
+#line 2610 "parser.y"
                             {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 6250 "parser.cpp"
+#line 6403 "parser.cpp"
     break;
 
-  case 308: /* array_expr: double_array_expr  */
-#line 2510 "parser.y"
+  case 314: /* array_expr: double_array_expr  */
+#line 2613 "parser.y"
                     {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 6258 "parser.cpp"
+#line 6411 "parser.cpp"
+    break;
+
+  case 315: /* parameter_expr: '?' LONG_VALUE  */
+#line 2618 "parser.y"
+                               {
+    infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kParameter);
+    const_expr->integer_value_ = (yyvsp[0].long_value);
+    result->parameter_exprs_.emplace_back(const_expr);
+    (yyval.const_expr_t) = const_expr;
+}
+#line 6422 "parser.cpp"
     break;
 
-  case 309: /* long_array_expr: unclosed_long_array_expr ']'  */
-#line 2514 "parser.y"
+  case 316: /* long_array_expr: unclosed_long_array_expr ']'  */
+#line 2625 "parser.y"
                                               {
     (yyval.const_expr_t) = (yyvsp[-1].const_expr_t);
 }
-#line 6266 "parser.cpp"
+#line 6430 "parser.cpp"
     break;
 
-  case 310: /* unclosed_long_array_expr: '[' LONG_VALUE  */
-#line 2518 "parser.y"
+  case 317: /* unclosed_long_array_expr: '[' LONG_VALUE  */
+#line 2629 "parser.y"
                                          {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kIntegerArray);
     const_expr->long_array_.emplace_back((yyvsp[0].long_value));
     (yyval.const_expr_t) = const_expr;
 }
-#line 6276 "parser.cpp"
+#line 6440 "parser.cpp"
     break;
 
-  case 311: /* unclosed_long_array_expr: unclosed_long_array_expr ',' LONG_VALUE  */
-#line 2523 "parser.y"
+  case 318: /* unclosed_long_array_expr: unclosed_long_array_expr ',' LONG_VALUE  */
+#line 2634 "parser.y"
                                           {
     (yyvsp[-2].const_expr_t)->long_array_.emplace_back((yyvsp[0].long_value));
     (yyval.const_expr_t) = (yyvsp[-2].const_expr_t);
 }
-#line 6285 "parser.cpp"
+#line 6449 "parser.cpp"
     break;
 
-  case 312: /* double_array_expr: unclosed_double_array_expr ']'  */
-#line 2528 "parser.y"
+  case 319: /* double_array_expr: unclosed_double_array_expr ']'  */
+#line 2639 "parser.y"
                                                   {
     (yyval.const_expr_t) = (yyvsp[-1].const_expr_t);
 }
-#line 6293 "parser.cpp"
+#line 6457 "parser.cpp"
     break;
 
-  case 313: /* unclosed_double_array_expr: '[' DOUBLE_VALUE  */
-#line 2532 "parser.y"
+  case 320: /* unclosed_double_array_expr: '[' DOUBLE_VALUE  */
+#line 2643 "parser.y"
                                              {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kDoubleArray);
     const_expr->double_array_.emplace_back((yyvsp[0].double_value));
     (yyval.const_expr_t) = const_expr;
 }
-#line 6303 "parser.cpp"
+#line 6467 "parser.cpp"
     break;
 
-  case 314: /* unclosed_double_array_expr: unclosed_double_array_expr ',' DOUBLE_VALUE  */
-#line 2537 "parser.y"
+  case 321: /* unclosed_double_array_expr: unclosed_double_array_expr ',' DOUBLE_VALUE  */
+#line 2648 "parser.y"
                                               {
     (yyvsp[-2].const_expr_t)->double_array_.emplace_back((yyvsp[0].double_value));
     (yyval.const_expr_t) = (yyvsp[-2].const_expr_t);
 }
-#line 6312 "parser.cpp"
+#line 6476 "parser.cpp"
     break;
 
-  case 315: /* interval_expr: LONG_VALUE SECONDS  */
-#line 2542 "parser.y"
+  case 322: /* interval_expr: LONG_VALUE SECONDS  */
+#line 2653 "parser.y"
                                   {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kSecond;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6323 "parser.cpp"
+#line 6487 "parser.cpp"
     break;
 
-  case 316: /* interval_expr: LONG_VALUE SECOND  */
-#line 2548 "parser.y"
+  case 323: /* interval_expr: LONG_VALUE SECOND  */
+#line 2659 "parser.y"
                     {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kSecond;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6334 "parser.cpp"
+#line 6498 "parser.cpp"
     break;
 
-  case 317: /* interval_expr: LONG_VALUE MINUTES  */
-#line 2554 "parser.y"
+  case 324: /* interval_expr: LONG_VALUE MINUTES  */
+#line 2665 "parser.y"
                      {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kMinute;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6345 "parser.cpp"
+#line 6509 "parser.cpp"
     break;
 
-  case 318: /* interval_expr: LONG_VALUE MINUTE  */
-#line 2560 "parser.y"
+  case 325: /* interval_expr: LONG_VALUE MINUTE  */
+#line 2671 "parser.y"
                     {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kMinute;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6356 "parser.cpp"
+#line 6520 "parser.cpp"
     break;
 
-  case 319: /* interval_expr: LONG_VALUE HOURS  */
-#line 2566 "parser.y"
+  case 326: /* interval_expr: LONG_VALUE HOURS  */
+#line 2677 "parser.y"
                    {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kHour;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6367 "parser.cpp"
+#line 6531 "parser.cpp"
     break;
 
-  case 320: /* interval_expr: LONG_VALUE HOUR  */
-#line 2572 "parser.y"
+  case 327: /* interval_expr: LONG_VALUE HOUR  */
+#line 2683 "parser.y"
                   {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kHour;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6378 "parser.cpp"
+#line 6542 "parser.cpp"
     break;
 
-  case 321: /* interval_expr: LONG_VALUE DAYS  */
-#line 2578 "parser.y"
+  case 328: /* interval_expr: LONG_VALUE DAYS  */
+#line 2689 "parser.y"
                   {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kDay;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6389 "parser.cpp"
+#line 6553 "parser.cpp"
     break;
 
-  case 322: /* interval_expr: LONG_VALUE DAY  */
-#line 2584 "parser.y"
+  case 329: /* interval_expr: LONG_VALUE DAY  */
+#line 2695 "parser.y"
                  {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kDay;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6400 "parser.cpp"
+#line 6564 "parser.cpp"
     break;
 
-  case 323: /* interval_expr: LONG_VALUE MONTHS  */
-#line 2590 "parser.y"
+  case 330: /* interval_expr: LONG_VALUE MONTHS  */
+#line 2701 "parser.y"
                     {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kMonth;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6411 "parser.cpp"
+#line 6575 "parser.cpp"
     break;
 
-  case 324: /* interval_expr: LONG_VALUE MONTH  */
-#line 2596 "parser.y"
+  case 331: /* interval_expr: LONG_VALUE MONTH  */
+#line 2707 "parser.y"
                    {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kMonth;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6422 "parser.cpp"
+#line 6586 "parser.cpp"
     break;
 
-  case 325: /* interval_expr: LONG_VALUE YEARS  */
-#line 2602 "parser.y"
+  case 332: /* interval_expr: LONG_VALUE YEARS  */
+#line 2713 "parser.y"
                    {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kYear;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6433 "parser.cpp"
+#line 6597 "parser.cpp"
     break;
 
-  case 326: /* interval_expr: LONG_VALUE YEAR  */
-#line 2608 "parser.y"
+  case 333: /* interval_expr: LONG_VALUE YEAR  */
+#line 2719 "parser.y"
                   {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kYear;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6444 "parser.cpp"
+#line 6608 "parser.cpp"
     break;
 
-  case 327: /* copy_option_list: copy_option  */
-#line 2619 "parser.y"
+  case 334: /* copy_option_list: copy_option  */
+#line 2730 "parser.y"
                                {
     (yyval.copy_option_array) = new std::vector<infinity::CopyOption*>();
     (yyval.copy_option_array)->push_back((yyvsp[0].copy_option_t));
 }
-#line 6453 "parser.cpp"
+#line 6617 "parser.cpp"
     break;
 
-  case 328: /* copy_option_list: copy_option_list ',' copy_option  */
-#line 2623 "parser.y"
+  case 335: /* copy_option_list: copy_option_list ',' copy_option  */
+#line 2734 "parser.y"
                                    {
     (yyvsp[-2].copy_option_array)->push_back((yyvsp[0].copy_option_t));
     (yyval.copy_option_array) = (yyvsp[-2].copy_option_array);
 }
-#line 6462 "parser.cpp"
+#line 6626 "parser.cpp"
     break;
 
-  case 329: /* copy_option: FORMAT IDENTIFIER  */
-#line 2628 "parser.y"
+  case 336: /* copy_option: FORMAT IDENTIFIER  */
+#line 2739 "parser.y"
                                 {
     (yyval.copy_option_t) = new infinity::CopyOption();
     (yyval.copy_option_t)->option_type_ = infinity::CopyOptionType::kFormat;
@@ -6478,6 +6642,21 @@ yyreduce:
     } else if (strcasecmp((yyvsp[0].str_value), "fvecs") == 0) {
         (yyval.copy_option_t)->file_type_ = infinity::CopyFileType::kFVECS;
         free((yyvsp[0].str_value));
+    } else if (strcasecmp((yyvsp[0].str_value), "bvecs") == 0) {
+        (yyval.copy_option_t)->file_type_ = infinity::CopyFileType::kBVECS;
+        free((yyvsp[0].str_value));
+    } else if (strcasecmp((yyvsp[0].str_value), "ivecs") == 0) {
+        (yyval.copy_option_t)->file_type_ = infinity::CopyFileType::kIVECS;
+        free((yyvsp[0].str_value));
+    } else if (strcasecmp((yyvsp[0].str_value), "fbin") == 0) {
+        (yyval.copy_option_t)->file_type_ = infinity::CopyFileType::kFBIN;
+        free((yyvsp[0].str_value));
+    } else if (strcasecmp((yyvsp[0].str_value), "parquet") == 0) {
+        (yyval.copy_option_t)->file_type_ = infinity::CopyFileType::kPARQUET;
+        free((yyvsp[0].str_value));
+    } else if (strcasecmp((yyvsp[0].str_value), "arrow") == 0) {
+        (yyval.copy_option_t)->file_type_ = infinity::CopyFileType::kARROW;
+        free((yyvsp[0].str_value));
     } else {
         free((yyvsp[0].str_value));
         delete (yyval.copy_option_t);
@@ -6485,11 +6664,11 @@ yyreduce:
         YYERROR;
     }
 }
-#line 6489 "parser.cpp"
+#line 6668 "parser.cpp"
     break;
 
-  case 330: /* copy_option: DELIMITER STRING  */
-#line 2650 "parser.y"
+  case 337: /* copy_option: DELIMITER STRING  */
+#line 2776 "parser.y"
                    {
     (yyval.copy_option_t) = new infinity::CopyOption();
     (yyval.copy_option_t)->option_type_ = infinity::CopyOptionType::kDelimiter;
@@ -6500,53 +6679,53 @@ yyreduce:
     }
     free((yyvsp[0].str_value));
 }
-#line 6504 "parser.cpp"
+#line 6683 "parser.cpp"
     break;
 
-  case 331: /* copy_option: HEADER  */
-#line 2660 "parser.y"
+  case 338: /* copy_option: HEADER  */
+#line 2786 "parser.y"
          {
     (yyval.copy_option_t) = new infinity::CopyOption();
     (yyval.copy_option_t)->option_type_ = infinity::CopyOptionType::kHeader;
     (yyval.copy_option_t)->header_ = true;
 }
-#line 6514 "parser.cpp"
+#line 6693 "parser.cpp"
     break;
 
-  case 332: /* file_path: STRING  */
-#line 2666 "parser.y"
+  case 339: /* file_path: STRING  */
+#line 2792 "parser.y"
                    {
     (yyval.str_value) = (yyvsp[0].str_value);
 }
-#line 6522 "parser.cpp"
+#line 6701 "parser.cpp"
     break;
 
-  case 333: /* if_exists: IF EXISTS  */
-#line 2670 "parser.y"
+  case 340: /* if_exists: IF EXISTS  */
+#line 2796 "parser.y"
                      { (yyval.bool_value) = true; }
-#line 6528 "parser.cpp"
+#line 6707 "parser.cpp"
     break;
 
-  case 334: /* if_exists: %empty  */
-#line 2671 "parser.y"
+  case 341: /* if_exists: %empty  */
+#line 2797 "parser.y"
   { (yyval.bool_value) = false; }
-#line 6534 "parser.cpp"
+#line 6713 "parser.cpp"
     break;
 
-  case 335: /* if_not_exists: IF NOT EXISTS  */
-#line 2673 "parser.y"
+  case 342: /* if_not_exists: IF NOT EXISTS  */
+#line 2799 "parser.y"
                               { (yyval.bool_value) = true; }
-#line 6540 "parser.cpp"
+#line 6719 "parser.cpp"
     break;
 
-  case 336: /* if_not_exists: %empty  */
-#line 2674 "parser.y"
+  case 343: /* if_not_exists: %empty  */
+#line 2800 "parser.y"
   { (yyval.bool_value) = false; }
-#line 6546 "parser.cpp"
+#line 6725 "parser.cpp"
     break;
 
-  case 339: /* if_not_exists_info: if_not_exists IDENTIFIER  */
-#line 2689 "parser.y"
+  case 346: /* if_not_exists_info: if_not_exists IDENTIFIER  */
+#line 2815 "parser.y"
                                               {
     (yyval.if_not_exists_info_t) = new infinity::IfNotExistsInfo();
     (yyval.if_not_exists_info_t)->exists_ = true;
@@ -6555,79 +6734,79 @@ yyreduce:
     (yyval.if_not_exists_info_t)->info_ = (yyvsp[0].str_value);
     free((yyvsp[0].str_value));
 }
-#line 6559 "parser.cpp"
+#line 6738 "parser.cpp"
     break;
 
-  case 340: /* if_not_exists_info: %empty  */
-#line 2697 "parser.y"
+  case 347: /* if_not_exists_info: %empty  */
+#line 2823 "parser.y"
   {
     (yyval.if_not_exists_info_t) = new infinity::IfNotExistsInfo();
 }
-#line 6567 "parser.cpp"
+#line 6746 "parser.cpp"
     break;
 
-  case 341: /* with_index_param_list: WITH '(' index_param_list ')'  */
-#line 2701 "parser.y"
+  case 348: /* with_index_param_list: WITH '(' index_param_list ')'  */
+#line 2827 "parser.y"
                                                       {
     (yyval.with_index_param_list_t) = std::move((yyvsp[-1].index_param_list_t));
 }
-#line 6575 "parser.cpp"
+#line 6754 "parser.cpp"
     break;
 
-  case 342: /* with_index_param_list: %empty  */
-#line 2704 "parser.y"
+  case 349: /* with_index_param_list: %empty  */
+#line 2830 "parser.y"
   {
     (yyval.with_index_param_list_t) = new std::vector<infinity::InitParameter*>();
 }
-#line 6583 "parser.cpp"
+#line 6762 "parser.cpp"
     break;
 
-  case 343: /* optional_table_properties_list: PROPERTIES '(' index_param_list ')'  */
-#line 2708 "parser.y"
+  case 350: /* optional_table_properties_list: PROPERTIES '(' index_param_list ')'  */
+#line 2834 "parser.y"
                                                                      {
     (yyval.with_index_param_list_t) = (yyvsp[-1].index_param_list_t);
 }
-#line 6591 "parser.cpp"
+#line 6770 "parser.cpp"
     break;
 
-  case 344: /* optional_table_properties_list: %empty  */
-#line 2711 "parser.y"
+  case 351: /* optional_table_properties_list: %empty  */
+#line 2837 "parser.y"
   {
     (yyval.with_index_param_list_t) = nullptr;
 }
-#line 6599 "parser.cpp"
+#line 6778 "parser.cpp"
     break;
 
-  case 345: /* index_param_list: index_param  */
-#line 2715 "parser.y"
+  case 352: /* index_param_list: index_param  */
+#line 2841 "parser.y"
                                {
     (yyval.index_param_list_t) = new std::vector<infinity::InitParameter*>();
     (yyval.index_param_list_t)->push_back((yyvsp[0].index_param_t));
 }
-#line 6608 "parser.cpp"
+#line 6787 "parser.cpp"
     break;
 
-  case 346: /* index_param_list: index_param_list ',' index_param  */
-#line 2719 "parser.y"
+  case 353: /* index_param_list: index_param_list ',' index_param  */
+#line 2845 "parser.y"
                                    {
     (yyvsp[-2].index_param_list_t)->push_back((yyvsp[0].index_param_t));
     (yyval.index_param_list_t) = (yyvsp[-2].index_param_list_t);
 }
-#line 6617 "parser.cpp"
+#line 6796 "parser.cpp"
     break;
 
-  case 347: /* index_param: IDENTIFIER  */
-#line 2724 "parser.y"
+  case 354: /* index_param: IDENTIFIER  */
+#line 2850 "parser.y"
                          {
     (yyval.index_param_t) = new infinity::InitParameter();
     (yyval.index_param_t)->param_name_ = (yyvsp[0].str_value);
     free((yyvsp[0].str_value));
 }
-#line 6627 "parser.cpp"
+#line 6806 "parser.cpp"
     break;
 
-  case 348: /* index_param: IDENTIFIER '=' IDENTIFIER  */
-#line 2729 "parser.y"
+  case 355: /* index_param: IDENTIFIER '=' IDENTIFIER  */
+#line 2855 "parser.y"
                             {
     (yyval.index_param_t) = new infinity::InitParameter();
     (yyval.index_param_t)->param_name_ = (yyvsp[-2].str_value);
@@ -6636,11 +6815,11 @@ yyreduce:
     (yyval.index_param_t)->param_value_ = (yyvsp[0].str_value);
     free((yyvsp[0].str_value));
 }
-#line 6640 "parser.cpp"
+#line 6819 "parser.cpp"
     break;
 
-  case 349: /* index_param: IDENTIFIER '=' LONG_VALUE  */
-#line 2737 "parser.y"
+  case 356: /* index_param: IDENTIFIER '=' LONG_VALUE  */
+#line 2863 "parser.y"
                             {
     (yyval.index_param_t) = new infinity::InitParameter();
     (yyval.index_param_t)->param_name_ = (yyvsp[-2].str_value);
@@ -6648,11 +6827,11 @@ yyreduce:
 
     (yyval.index_param_t)->param_value_ = std::to_string((yyvsp[0].long_value));
 }
-#line 6652 "parser.cpp"
+#line 6831 "parser.cpp"
     break;
 
-  case 350: /* index_param: IDENTIFIER '=' DOUBLE_VALUE  */
-#line 2744 "parser.y"
+  case 357: /* index_param: IDENTIFIER '=' DOUBLE_VALUE  */
+#line 2870 "parser.y"
                               {
     (yyval.index_param_t) = new infinity::InitParameter();
     (yyval.index_param_t)->param_name_ = (yyvsp[-2].str_value);
@@ -6660,11 +6839,11 @@ yyreduce:
 
     (yyval.index_param_t)->param_value_ = std::to_string((yyvsp[0].double_value));
 }
-#line 6664 "parser.cpp"
+#line 6843 "parser.cpp"
     break;
 
-  case 351: /* index_info_list: '(' identifier_array ')' USING IDENTIFIER with_index_param_list  */
-#line 2755 "parser.y"
+  case 358: /* index_info_list: '(' identifier_array ')' USING IDENTIFIER with_index_param_list  */
+#line 2881 "parser.y"
                                                                                   {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     infinity::IndexType index_type = infinity::IndexType::kInvalid;
@@ -6674,6 +6853,10 @@ yyreduce:
         index_type = infinity::IndexType::kHnsw;
     } else if (strcmp((yyvsp[-1].str_value), "ivfflat") == 0) {
         index_type = infinity::IndexType::kIVFFlat;
+    } else if (strcmp((yyvsp[-1].str_value), "ivfpq") == 0) {
+        index_type = infinity::IndexType::kIVFPQ;
+    } else if (strcmp((yyvsp[-1].str_value), "bitmap") == 0) {
+        index_type = infinity::IndexType::kBitmap;
     } else {
         free((yyvsp[-1].str_value));
         delete (yyvsp[-4].identifier_array_t);
@@ -6713,11 +6896,11 @@ yyreduce:
     }
     delete (yyvsp[-4].identifier_array_t);
 }
-#line 6717 "parser.cpp"
+#line 6900 "parser.cpp"
     break;
 
-  case 352: /* index_info_list: index_info_list '(' identifier_array ')' USING IDENTIFIER with_index_param_list  */
-#line 2803 "parser.y"
+  case 359: /* index_info_list: index_info_list '(' identifier_array ')' USING IDENTIFIER with_index_param_list  */
+#line 2933 "parser.y"
                                                                                   {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     infinity::IndexType index_type = infinity::IndexType::kInvalid;
@@ -6727,6 +6910,10 @@ yyreduce:
         index_type = infinity::IndexType::kHnsw;
     } else if (strcmp((yyvsp[-1].str_value), "ivfflat") == 0) {
         index_type = infinity::IndexType::kIVFFlat;
+    } else if (strcmp((yyvsp[-1].str_value), "ivfpq") == 0) {
+        index_type = infinity::IndexType::kIVFPQ;
+    } else if (strcmp((yyvsp[-1].str_value), "bitmap") == 0) {
+        index_type = infinity::IndexType::kBitmap;
     } else {
         free((yyvsp[-1].str_value));
         delete (yyvsp[-4].identifier_array_t);
@@ -6767,11 +6954,11 @@ yyreduce:
     }
     delete (yyvsp[-4].identifier_array_t);
 }
-#line 6771 "parser.cpp"
+#line 6958 "parser.cpp"
     break;
 
-  case 353: /* index_info_list: '(' identifier_array ')'  */
-#line 2852 "parser.y"
+  case 360: /* index_info_list: '(' identifier_array ')'  */
+#line 2986 "parser.y"
                            {
     infinity::IndexType index_type = infinity::IndexType::kSecondary;
     size_t index_count = (yyvsp[-1].identifier_array_t)->size();
@@ -6785,11 +6972,11 @@ yyreduce:
     }
     delete (yyvsp[-1].identifier_array_t);
 }
-#line 6789 "parser.cpp"
+#line 6976 "parser.cpp"
     break;
 
 
-#line 6793 "parser.cpp"
+#line 6980 "parser.cpp"
 
       default: break;
     }
@@ -7018,7 +7205,7 @@ yyreturnlab:
   return yyresult;
 }
 
-#line 2866 "parser.y"
+#line 3000 "parser.y"
 
 
 void
@@ -420,7 +420,7 @@ struct SQL_LTYPE {
 %type <expr_t>                  having_clause where_clause limit_expr offset_expr operand in_expr between_expr
 %type <expr_t>                  conjunction_expr cast_expr case_expr
 %type <expr_t>                  match_expr query_expr fusion_expr search_clause
-%type <const_expr_t>            constant_expr interval_expr
+%type <const_expr_t>            constant_expr interval_expr parameter_expr
 %type <const_expr_t>            array_expr long_array_expr unclosed_long_array_expr double_array_expr unclosed_double_array_expr
 %type <expr_array_t>            expr_array group_by_clause sub_search_array
 %type <expr_array_list_t>       expr_array_list
@@ -594,6 +594,36 @@ create_statement : CREATE DATABASE if_not_exists IDENTIFIER {
     create_table_info->select_ = $6;
     $$->create_info_ = create_table_info;
 }
+/* CREATE TABLE table_name CLONE table_name; CLONE is not a keyword, so that it stays usable as a name */
+| CREATE TABLE if_not_exists table_name IDENTIFIER table_name {
+    bool is_clone = strcasecmp($5, "clone") == 0;
+    free($5);
+    $$ = new infinity::CreateStatement();
+    std::shared_ptr<infinity::CreateTableInfo> create_table_info = std::make_shared<infinity::CreateTableInfo>();
+    if($4->schema_name_ptr_ != nullptr) {
+        create_table_info->schema_name_ = $4->schema_name_ptr_;
+        free($4->schema_name_ptr_);
+    }
+    create_table_info->table_name_ = $4->table_name_ptr_;
+    free($4->table_name_ptr_);
+    delete $4;
+
+    if($6->schema_name_ptr_ != nullptr) {
+        create_table_info->clone_schema_name_ = $6->schema_name_ptr_;
+        free($6->schema_name_ptr_);
+    }
+    create_table_info->clone_table_name_ = $6->table_name_ptr_;
+    free($6->table_name_ptr_);
+    delete $6;
+
+    create_table_info->conflict_type_ = $3 ? infinity::ConflictType::kIgnore : infinity::ConflictType::kError;
+    $$->create_info_ = create_table_info;
+    if (!is_clone) {
+        delete $$;
+        yyerror(&yyloc, scanner, result, "Unknown create table option");
+        YYERROR;
+    }
+}
 /* CREATE VIEW table_name AS SELECT .... ; */
 | CREATE VIEW if_not_exists table_name optional_identifier_array AS select_statement {
     $$ = new infinity::CreateStatement();
@@ -1517,6 +1547,21 @@ show_statement: SHOW DATABASES {
     $$ = new infinity::ShowStatement();
     $$->show_type_ = infinity::ShowStmtType::kProfiles;
 }
+| SHOW IDENTIFIER {
+    $$ = new infinity::ShowStatement();
+    if (strcasecmp($2, "slow_queries") == 0) {
+        $$->show_type_ = infinity::ShowStmtType::kSlowQueries;
+        free($2);
+    } else if (strcasecmp($2, "queries") == 0) {
+        $$->show_type_ = infinity::ShowStmtType::kQueries;
+        free($2);
+    } else {
+        free($2);
+        delete $$;
+        yyerror(&yyloc, scanner, result, "Unknown show type");
+        YYERROR;
+    }
+}
 | SHOW SESSION STATUS {
     $$ = new infinity::ShowStatement();
     $$->show_type_ = infinity::ShowStmtType::kSessionStatus;
@@ -1753,6 +1798,59 @@ command_statement: USE IDENTIFIER {
         free($3->table_name_ptr_);
     } delete $3;
 }
+/* WARMUP is not a keyword, so that it stays usable as a name */
+| IDENTIFIER TABLE table_name {
+    ParserHelper::ToLower($1);
+    bool is_warmup = strcmp($1, "warmup") == 0;
+    free($1);
+    std::string schema_name;
+    if ($3->schema_name_ptr_ != nullptr) {
+        schema_name = $3->schema_name_ptr_;
+        free($3->schema_name_ptr_);
+    }
+    std::string table_name = $3->table_name_ptr_;
+    free($3->table_name_ptr_);
+    delete $3;
+    if (!is_warmup) {
+        yyerror(&yyloc, scanner, result, "Unknown command");
+        YYERROR;
+    }
+    $$ = new infinity::CommandStatement();
+    $$->command_info_ = std::make_unique<infinity::WarmupCmd>(std::move(schema_name), std::move(table_name), std::string());
+}
+| IDENTIFIER INDEX IDENTIFIER ON table_name {
+    ParserHelper::ToLower($1);
+    bool is_warmup = strcmp($1, "warmup") == 0;
+    free($1);
+    std::string index_name = $3;
+    free($3);
+    std::string schema_name;
+    if ($5->schema_name_ptr_ != nullptr) {
+        schema_name = $5->schema_name_ptr_;
+        free($5->schema_name_ptr_);
+    }
+    std::string table_name = $5->table_name_ptr_;
+    free($5->table_name_ptr_);
+    delete $5;
+    if (!is_warmup) {
+        yyerror(&yyloc, scanner, result, "Unknown command");
+        YYERROR;
+    }
+    $$ = new infinity::CommandStatement();
+    $$->command_info_ = std::make_unique<infinity::WarmupCmd>(std::move(schema_name), std::move(table_name), std::move(index_name));
+}
+/* KILL and QUERY are not keywords either */
+| IDENTIFIER IDENTIFIER LONG_VALUE {
+    bool is_kill_query = strcasecmp($1, "kill") == 0 && strcasecmp($2, "query") == 0;
+    free($1);
+    free($2);
+    if (!is_kill_query || $3 < 0) {
+        yyerror(&yyloc, scanner, result, "Unknown command");
+        YYERROR;
+    }
+    $$ = new infinity::CommandStatement();
+    $$->command_info_ = std::make_unique<infinity::KillQueryCmd>($3);
+}
 
 /*
  * EXPRESSION
@@ -1852,6 +1950,8 @@ knn_expr : KNN '(' expr ',' array_expr ',' STRING ',' STRING ',' LONG_VALUE ')'
         knn_expr->distance_type_ = infinity::KnnDistanceType::kCosine;
     } else if(strcmp($9, "hamming") == 0) {
         knn_expr->distance_type_ = infinity::KnnDistanceType::kHamming;
+    } else if(strcmp($9, "maxsim") == 0) {
+        knn_expr->distance_type_ = infinity::KnnDistanceType::kMaxSim;
     } else {
         for (auto* param_ptr: *$13) {
             delete param_ptr;
@@ -2502,6 +2602,9 @@ constant_expr: STRING {
 }
 | double_array_expr {
     $$ = $1;
+}
+| parameter_expr {
+    $$ = $1;
 };
 
 array_expr: long_array_expr {
@@ -2511,6 +2614,14 @@ array_expr: long_array_expr {
     $$ = $1;
 }
 
+// The $n of a statement of the extended query protocol, rewritten to ?n before parsing. The value is bound later.
+parameter_expr: '?' LONG_VALUE {
+    infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kParameter);
+    const_expr->integer_value_ = $2;
+    result->parameter_exprs_.emplace_back(const_expr);
+    $$ = const_expr;
+}
+
 long_array_expr: unclosed_long_array_expr ']' {
     $$ = $1;
 };
@@ -2640,6 +2751,21 @@ copy_option : FORMAT IDENTIFIER {
     } else if (strcasecmp($2, "fvecs") == 0) {
         $$->file_type_ = infinity::CopyFileType::kFVECS;
         free($2);
+    } else if (strcasecmp($2, "bvecs") == 0) {
+        $$->file_type_ = infinity::CopyFileType::kBVECS;
+        free($2);
+    } else if (strcasecmp($2, "ivecs") == 0) {
+        $$->file_type_ = infinity::CopyFileType::kIVECS;
+        free($2);
+    } else if (strcasecmp($2, "fbin") == 0) {
+        $$->file_type_ = infinity::CopyFileType::kFBIN;
+        free($2);
+    } else if (strcasecmp($2, "parquet") == 0) {
+        $$->file_type_ = infinity::CopyFileType::kPARQUET;
+        free($2);
+    } else if (strcasecmp($2, "arrow") == 0) {
+        $$->file_type_ = infinity::CopyFileType::kARROW;
+        free($2);
     } else {
         free($2);
         delete $$;
@@ -2761,6 +2887,10 @@ index_info_list : '(' identifier_array ')' USING IDENTIFIER with_index_param_lis
         index_type = infinity::IndexType::kHnsw;
     } else if (strcmp($5, "ivfflat") == 0) {
         index_type = infinity::IndexType::kIVFFlat;
+    } else if (strcmp($5, "ivfpq") == 0) {
+        index_type = infinity::IndexType::kIVFPQ;
+    } else if (strcmp($5, "bitmap") == 0) {
+        index_type = infinity::IndexType::kBitmap;
     } else {
         free($5);
         delete $2;
@@ -2809,6 +2939,10 @@ index_info_list : '(' identifier_array ')' USING IDENTIFIER with_index_param_lis
         index_type = infinity::IndexType::kHnsw;
     } else if (strcmp($6, "ivfflat") == 0) {
         index_type = infinity::IndexType::kIVFFlat;
+    } else if (strcmp($6, "ivfpq") == 0) {
+        index_type = infinity::IndexType::kIVFPQ;
+    } else if (strcmp($6, "bitmap") == 0) {
+        index_type = infinity::IndexType::kBitmap;
     } else {
         free($6);
         delete $3;
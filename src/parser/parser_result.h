@@ -15,6 +15,7 @@
 #pragma once
 
 #include "base_statement.h"
+#include "expr/constant_expr.h"
 
 #include <vector>
 
@@ -38,12 +39,15 @@ public:
             delete statements_ptr_;
             statements_ptr_ = nullptr;
         }
+        parameter_exprs_.clear();
         error_message_.clear();
         error_line_ = 0;
         error_position_ = 0;
     }
 
     std::vector<BaseStatement *> *statements_ptr_;
+    // The parameters of the statements, owned by the statements
+    std::vector<ConstantExpr *> parameter_exprs_{};
     std::string error_message_;
     size_t error_line_;
     size_t error_position_;
@@ -931,7 +931,7 @@ YY_RULE_SETUP
 case 25:
 YY_RULE_SETUP
 #line 81 "search_lexer.l"
-{ BEGIN INITIAL; yylval->build<std::string>(string_buffer.str()); return token::STRING; }
+{ BEGIN INITIAL; yylval->build<std::string>(string_buffer.str()); return token::PHRASE; }
 	YY_BREAK
 case YY_STATE_EOF(DOUBLE_QUOTED_STRING):
 #line 82 "search_lexer.l"
@@ -194,6 +194,7 @@ namespace infinity {
         break;
 
       case symbol_kind::S_STRING: // STRING
+      case symbol_kind::S_PHRASE: // PHRASE
         value.copy< std::string > (YY_MOVE (that.value));
         break;
 
@@ -242,6 +243,7 @@ namespace infinity {
         break;
 
       case symbol_kind::S_STRING: // STRING
+      case symbol_kind::S_PHRASE: // PHRASE
         value.move< std::string > (YY_MOVE (s.value));
         break;
 
@@ -360,6 +362,7 @@ namespace infinity {
         break;
 
       case symbol_kind::S_STRING: // STRING
+      case symbol_kind::S_PHRASE: // PHRASE
         value.YY_MOVE_OR_COPY< std::string > (YY_MOVE (that.value));
         break;
 
@@ -392,6 +395,7 @@ namespace infinity {
         break;
 
       case symbol_kind::S_STRING: // STRING
+      case symbol_kind::S_PHRASE: // PHRASE
         value.move< std::string > (YY_MOVE (that.value));
         break;
 
@@ -424,6 +428,7 @@ namespace infinity {
         break;
 
       case symbol_kind::S_STRING: // STRING
+      case symbol_kind::S_PHRASE: // PHRASE
         value.copy< std::string > (that.value);
         break;
 
@@ -455,6 +460,7 @@ namespace infinity {
         break;
 
       case symbol_kind::S_STRING: // STRING
+      case symbol_kind::S_PHRASE: // PHRASE
         value.move< std::string > (that.value);
         break;
 
@@ -730,6 +736,7 @@ namespace infinity {
         break;
 
       case symbol_kind::S_STRING: // STRING
+      case symbol_kind::S_PHRASE: // PHRASE
         yylhs.value.emplace< std::string > ();
         break;
 
@@ -763,108 +770,108 @@ namespace infinity {
           switch (yyn)
             {
   case 2: // topLevelQuery: query "end of file"
-#line 74 "search_parser.y"
+#line 75 "search_parser.y"
             {
     parse_result = std::move(yystack_[1].value.as < std::unique_ptr<QueryNode> > ());
 }
-#line 771 "search_parser.cpp"
+#line 778 "search_parser.cpp"
     break;
 
   case 3: // query: clause
-#line 79 "search_parser.y"
+#line 80 "search_parser.y"
          { yylhs.value.as < std::unique_ptr<QueryNode> > () = std::move(yystack_[0].value.as < std::unique_ptr<QueryNode> > ()); }
-#line 777 "search_parser.cpp"
+#line 784 "search_parser.cpp"
     break;
 
   case 4: // query: query clause
-#line 80 "search_parser.y"
+#line 81 "search_parser.y"
                {
     auto query = std::make_unique<OrQueryNode>();
     query->Add(std::move(yystack_[1].value.as < std::unique_ptr<QueryNode> > ()));
     query->Add(std::move(yystack_[0].value.as < std::unique_ptr<QueryNode> > ()));
     yylhs.value.as < std::unique_ptr<QueryNode> > () = std::move(query);
 }
-#line 788 "search_parser.cpp"
+#line 795 "search_parser.cpp"
     break;
 
   case 5: // query: query OR clause
-#line 86 "search_parser.y"
+#line 87 "search_parser.y"
                   {
     auto query = std::make_unique<OrQueryNode>();
     query->Add(std::move(yystack_[2].value.as < std::unique_ptr<QueryNode> > ()));
     query->Add(std::move(yystack_[0].value.as < std::unique_ptr<QueryNode> > ()));
     yylhs.value.as < std::unique_ptr<QueryNode> > () = std::move(query);
 }
-#line 799 "search_parser.cpp"
+#line 806 "search_parser.cpp"
     break;
 
   case 6: // clause: term
-#line 94 "search_parser.y"
+#line 95 "search_parser.y"
        { yylhs.value.as < std::unique_ptr<QueryNode> > () = std::move(yystack_[0].value.as < std::unique_ptr<QueryNode> > ()); }
-#line 805 "search_parser.cpp"
+#line 812 "search_parser.cpp"
     break;
 
   case 7: // clause: clause AND term
-#line 95 "search_parser.y"
+#line 96 "search_parser.y"
                   {
     auto query = std::make_unique<AndQueryNode>();
     query->Add(std::move(yystack_[2].value.as < std::unique_ptr<QueryNode> > ()));
     query->Add(std::move(yystack_[0].value.as < std::unique_ptr<QueryNode> > ()));
     yylhs.value.as < std::unique_ptr<QueryNode> > () = std::move(query);
 }
-#line 816 "search_parser.cpp"
+#line 823 "search_parser.cpp"
     break;
 
   case 8: // term: basic_filter_boost
-#line 103 "search_parser.y"
+#line 104 "search_parser.y"
                      { yylhs.value.as < std::unique_ptr<QueryNode> > () = std::move(yystack_[0].value.as < std::unique_ptr<QueryNode> > ()); }
-#line 822 "search_parser.cpp"
+#line 829 "search_parser.cpp"
     break;
 
   case 9: // term: NOT term
-#line 104 "search_parser.y"
+#line 105 "search_parser.y"
            {
     auto query = std::make_unique<NotQueryNode>();
     query->Add(std::move(yystack_[0].value.as < std::unique_ptr<QueryNode> > ()));
     yylhs.value.as < std::unique_ptr<QueryNode> > () = std::move(query);
 }
-#line 832 "search_parser.cpp"
+#line 839 "search_parser.cpp"
     break;
 
   case 10: // term: LPAREN query RPAREN
-#line 109 "search_parser.y"
+#line 110 "search_parser.y"
                       { yylhs.value.as < std::unique_ptr<QueryNode> > () = std::move(yystack_[1].value.as < std::unique_ptr<QueryNode> > ()); }
-#line 838 "search_parser.cpp"
+#line 845 "search_parser.cpp"
     break;
 
   case 11: // term: LPAREN query RPAREN CARAT
-#line 110 "search_parser.y"
+#line 111 "search_parser.y"
                             {
     yylhs.value.as < std::unique_ptr<QueryNode> > () = std::move(yystack_[2].value.as < std::unique_ptr<QueryNode> > ());
     yylhs.value.as < std::unique_ptr<QueryNode> > ()->MultiplyWeight(yystack_[0].value.as < float > ());
 }
-#line 847 "search_parser.cpp"
+#line 854 "search_parser.cpp"
     break;
 
   case 12: // basic_filter_boost: basic_filter
-#line 116 "search_parser.y"
+#line 117 "search_parser.y"
                {
     yylhs.value.as < std::unique_ptr<QueryNode> > () = std::move(yystack_[0].value.as < std::unique_ptr<QueryNode> > ());
 }
-#line 855 "search_parser.cpp"
+#line 862 "search_parser.cpp"
     break;
 
   case 13: // basic_filter_boost: basic_filter CARAT
-#line 119 "search_parser.y"
+#line 120 "search_parser.y"
                      {
     yylhs.value.as < std::unique_ptr<QueryNode> > () = std::move(yystack_[1].value.as < std::unique_ptr<QueryNode> > ());
     yylhs.value.as < std::unique_ptr<QueryNode> > ()->MultiplyWeight(yystack_[0].value.as < float > ());
 }
-#line 864 "search_parser.cpp"
+#line 871 "search_parser.cpp"
     break;
 
   case 14: // basic_filter: STRING
-#line 125 "search_parser.y"
+#line 126 "search_parser.y"
          {
     const std::string &field = default_field;
     if(field.empty()){
@@ -873,19 +880,40 @@ namespace infinity {
     }
     yylhs.value.as < std::unique_ptr<QueryNode> > () = driver.AnalyzeAndBuildQueryNode(field, std::move(yystack_[0].value.as < std::string > ()));
 }
-#line 877 "search_parser.cpp"
+#line 884 "search_parser.cpp"
     break;
 
-  case 15: // basic_filter: STRING OP_COLON STRING
-#line 133 "search_parser.y"
+  case 15: // basic_filter: PHRASE
+#line 134 "search_parser.y"
+         {
+    const std::string &field = default_field;
+    if(field.empty()){
+        error(yystack_[0].location, "default_field is empty");
+        YYERROR;
+    }
+    yylhs.value.as < std::unique_ptr<QueryNode> > () = driver.AnalyzeAndBuildQueryNode(field, std::move(yystack_[0].value.as < std::string > ()), true);
+}
+#line 897 "search_parser.cpp"
+    break;
+
+  case 16: // basic_filter: STRING OP_COLON STRING
+#line 142 "search_parser.y"
                          {
     yylhs.value.as < std::unique_ptr<QueryNode> > () = driver.AnalyzeAndBuildQueryNode(yystack_[2].value.as < std::string > (), std::move(yystack_[0].value.as < std::string > ()));
 }
-#line 885 "search_parser.cpp"
+#line 905 "search_parser.cpp"
+    break;
+
+  case 17: // basic_filter: STRING OP_COLON PHRASE
+#line 145 "search_parser.y"
+                         {
+    yylhs.value.as < std::unique_ptr<QueryNode> > () = driver.AnalyzeAndBuildQueryNode(yystack_[2].value.as < std::string > (), std::move(yystack_[0].value.as < std::string > ()), true);
+}
+#line 913 "search_parser.cpp"
     break;
 
 
-#line 889 "search_parser.cpp"
+#line 917 "search_parser.cpp"
 
             default:
               break;
@@ -1244,67 +1272,67 @@ namespace infinity {
   const signed char
   SearchParser::yypact_[] =
   {
-       4,     4,     4,    -5,    15,     1,    10,    -7,    -7,    12,
-      -7,    13,    -6,    -7,    -7,     4,    10,     4,    -7,    16,
-      -7,    10,    -7,    -7
+      17,    17,    17,    -6,    -7,     8,     1,     7,    -7,    -7,
+      -5,    -7,    14,     4,    -7,    -7,    17,     7,    17,    -7,
+      20,    -7,    -7,     7,    -7,    -7
   };
 
   const signed char
   SearchParser::yydefact_[] =
   {
-       0,     0,     0,    14,     0,     0,     3,     6,     8,    12,
-       9,     0,     0,     1,     2,     0,     4,     0,    13,    10,
-      15,     5,     7,    11
+       0,     0,     0,    14,    15,     0,     0,     3,     6,     8,
+      12,     9,     0,     0,     1,     2,     0,     4,     0,    13,
+      10,    16,    17,     5,     7,    11
   };
 
   const signed char
   SearchParser::yypgoto_[] =
   {
-      -7,    -7,    20,    -3,    -1,    -7,    -7
+      -7,    -7,    24,    -3,    -1,    -7,    -7
   };
 
   const signed char
   SearchParser::yydefgoto_[] =
   {
-       0,     4,     5,     6,     7,     8,     9
+       0,     5,     6,     7,     8,     9,    10
   };
 
   const signed char
   SearchParser::yytable_[] =
   {
-      10,    14,    16,    12,    20,    15,     1,     2,    16,     1,
-       2,     3,    21,    17,     3,    13,    22,    15,     1,     2,
-      19,    18,    11,     3,     0,    23
+      11,    15,    13,    17,    19,    16,     1,     2,    14,    17,
+      18,     3,     4,    23,    21,    22,     0,    24,    16,     1,
+       2,    20,     1,     2,     3,     4,    12,     3,     4,    25
   };
 
   const signed char
   SearchParser::yycheck_[] =
   {
-       1,     0,     5,     8,    10,     4,     5,     6,    11,     5,
-       6,    10,    15,     3,    10,     0,    17,     4,     5,     6,
-       7,     9,     2,    10,    -1,     9
+       1,     0,     8,     6,     9,     4,     5,     6,     0,    12,
+       3,    10,    11,    16,    10,    11,    -1,    18,     4,     5,
+       6,     7,     5,     6,    10,    11,     2,    10,    11,     9
   };
 
   const signed char
   SearchParser::yystos_[] =
   {
-       0,     5,     6,    10,    12,    13,    14,    15,    16,    17,
-      15,    13,     8,     0,     0,     4,    14,     3,     9,     7,
-      10,    14,    15,     9
+       0,     5,     6,    10,    11,    13,    14,    15,    16,    17,
+      18,    16,    14,     8,     0,     0,     4,    15,     3,     9,
+       7,    10,    11,    15,    16,     9
   };
 
   const signed char
   SearchParser::yyr1_[] =
   {
-       0,    11,    12,    13,    13,    13,    14,    14,    15,    15,
-      15,    15,    16,    16,    17,    17
+       0,    12,    13,    14,    14,    14,    15,    15,    16,    16,
+      16,    16,    17,    17,    18,    18,    18,    18
   };
 
   const signed char
   SearchParser::yyr2_[] =
   {
        0,     2,     2,     1,     2,     3,     1,     3,     1,     2,
-       3,     4,     1,     2,     1,     3
+       3,     4,     1,     2,     1,     1,     3,     3
   };
 
 
@@ -1315,7 +1343,7 @@ namespace infinity {
   const SearchParser::yytname_[] =
   {
   "\"end of file\"", "error", "\"invalid token\"", "AND", "OR", "NOT",
-  "LPAREN", "RPAREN", "OP_COLON", "CARAT", "STRING", "$accept",
+  "LPAREN", "RPAREN", "OP_COLON", "CARAT", "STRING", "PHRASE", "$accept",
   "topLevelQuery", "query", "clause", "term", "basic_filter_boost",
   "basic_filter", YY_NULLPTR
   };
@@ -1326,8 +1354,8 @@ namespace infinity {
   const unsigned char
   SearchParser::yyrline_[] =
   {
-       0,    74,    74,    79,    80,    86,    94,    95,   103,   104,
-     109,   110,   116,   119,   125,   133
+       0,    75,    75,    80,    81,    87,    95,    96,   104,   105,
+     110,   111,   117,   120,   126,   134,   142,   145
   };
 
   void
@@ -1365,9 +1393,9 @@ namespace infinity {
 
 #line 9 "search_parser.y"
 } // infinity
-#line 1369 "search_parser.cpp"
+#line 1397 "search_parser.cpp"
 
-#line 137 "search_parser.y"
+#line 149 "search_parser.y"
 
 
 namespace infinity{
@@ -421,6 +421,7 @@ namespace infinity {
       char dummy1[sizeof (float)];
 
       // STRING
+      // PHRASE
       char dummy2[sizeof (std::string)];
 
       // topLevelQuery
@@ -489,7 +490,8 @@ namespace infinity {
     RPAREN = 7,                    // RPAREN
     OP_COLON = 8,                  // OP_COLON
     CARAT = 9,                     // CARAT
-    STRING = 10                    // STRING
+    STRING = 10,                   // STRING
+    PHRASE = 11                    // PHRASE
       };
       /// Backward compatibility alias (Bison 3.6).
       typedef token_kind_type yytokentype;
@@ -506,7 +508,7 @@ namespace infinity {
     {
       enum symbol_kind_type
       {
-        YYNTOKENS = 11, ///< Number of tokens.
+        YYNTOKENS = 12, ///< Number of tokens.
         S_YYEMPTY = -2,
         S_YYEOF = 0,                             // "end of file"
         S_YYerror = 1,                           // error
@@ -519,13 +521,14 @@ namespace infinity {
         S_OP_COLON = 8,                          // OP_COLON
         S_CARAT = 9,                             // CARAT
         S_STRING = 10,                           // STRING
-        S_YYACCEPT = 11,                         // $accept
-        S_topLevelQuery = 12,                    // topLevelQuery
-        S_query = 13,                            // query
-        S_clause = 14,                           // clause
-        S_term = 15,                             // term
-        S_basic_filter_boost = 16,               // basic_filter_boost
-        S_basic_filter = 17                      // basic_filter
+        S_PHRASE = 11,                           // PHRASE
+        S_YYACCEPT = 12,                         // $accept
+        S_topLevelQuery = 13,                    // topLevelQuery
+        S_query = 14,                            // query
+        S_clause = 15,                           // clause
+        S_term = 16,                             // term
+        S_basic_filter_boost = 17,               // basic_filter_boost
+        S_basic_filter = 18                      // basic_filter
       };
     };
 
@@ -567,6 +570,7 @@ namespace infinity {
         break;
 
       case symbol_kind::S_STRING: // STRING
+      case symbol_kind::S_PHRASE: // PHRASE
         value.move< std::string > (std::move (that.value));
         break;
 
@@ -673,6 +677,7 @@ switch (yykind)
         break;
 
       case symbol_kind::S_STRING: // STRING
+      case symbol_kind::S_PHRASE: // PHRASE
         value.template destroy< std::string > ();
         break;
 
@@ -807,7 +812,7 @@ switch (yykind)
 #endif
       {
 #if !defined _MSC_VER || defined __clang__
-        YY_ASSERT (tok == token::STRING);
+        YY_ASSERT ((token::STRING <= tok && tok <= token::PHRASE));
 #endif
       }
     };
@@ -1023,6 +1028,21 @@ switch (yykind)
         return symbol_type (token::STRING, v, l);
       }
 #endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_PHRASE (std::string v, location_type l)
+      {
+        return symbol_type (token::PHRASE, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_PHRASE (const std::string& v, const location_type& l)
+      {
+        return symbol_type (token::PHRASE, v, l);
+      }
+#endif
 
 
     class context
@@ -1353,9 +1373,9 @@ switch (yykind)
     /// Constants.
     enum
     {
-      yylast_ = 25,     ///< Last index in yytable_.
+      yylast_ = 29,     ///< Last index in yytable_.
       yynnts_ = 7,  ///< Number of nonterminal symbols.
-      yyfinal_ = 13 ///< Termination state number.
+      yyfinal_ = 14 ///< Termination state number.
     };
 
 
@@ -1370,7 +1390,7 @@ switch (yykind)
 
 #line 9 "search_parser.y"
 } // infinity
-#line 1374 "search_parser.h"
+#line 1394 "search_parser.h"
 
 
 
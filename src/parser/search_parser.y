@@ -58,6 +58,7 @@
 %token                 OP_COLON
 %token <float>         CARAT
 %token <std::string>   STRING
+%token <std::string>   PHRASE
 
 /* nonterminal symbol */
 %type <std::unique_ptr<QueryNode>>  topLevelQuery query clause term basic_filter_boost basic_filter
@@ -130,8 +131,19 @@ basic_filter
     }
     $$ = driver.AnalyzeAndBuildQueryNode(field, std::move($1));
 }
+| PHRASE {
+    const std::string &field = default_field;
+    if(field.empty()){
+        error(@1, "default_field is empty");
+        YYERROR;
+    }
+    $$ = driver.AnalyzeAndBuildQueryNode(field, std::move($1), true);
+}
 | STRING OP_COLON STRING {
     $$ = driver.AnalyzeAndBuildQueryNode($1, std::move($3));
+}
+| STRING OP_COLON PHRASE {
+    $$ = driver.AnalyzeAndBuildQueryNode($1, std::move($3), true);
 };
 
 %%
@@ -28,6 +28,8 @@ enum class CommandType {
     kExport,
     kCheckTable,
     kCompactTable,
+    kWarmup,
+    kKillQuery,
 };
 
 class CommandInfo {
@@ -170,6 +172,35 @@ public:
     std::string table_name_;
 };
 
+// WARMUP TABLE t / WARMUP INDEX i ON t: load the index files of a table into memory before the first query needs them.
+class WarmupCmd final : public CommandInfo {
+public:
+    WarmupCmd(std::string &&schema_name, std::string &&table_name, std::string &&index_name)
+        : CommandInfo(CommandType::kWarmup), schema_name_(std::move(schema_name)), table_name_(std::move(table_name)),
+          index_name_(std::move(index_name)) {}
+
+    std::string ToString() const final;
+
+public:
+    std::string schema_name_{};
+
+    std::string table_name_;
+
+    // empty for all indexes of the table
+    std::string index_name_{};
+};
+
+// KILL QUERY id: cancel a running query of any session, the id is the query_id of SHOW QUERIES.
+class KillQueryCmd final : public CommandInfo {
+public:
+    explicit KillQueryCmd(uint64_t query_id) : CommandInfo(CommandType::kKillQuery), query_id_(query_id) {}
+
+    std::string ToString() const final;
+
+public:
+    uint64_t query_id_{0};
+};
+
 class CommandStatement final : public BaseStatement {
 public:
     CommandStatement() : BaseStatement(StatementType::kCommand) {}
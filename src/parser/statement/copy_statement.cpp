@@ -44,6 +44,26 @@ std::string CopyStatement::ToString() const {
             file_format = "JSONL";
             break;
         }
+        case CopyFileType::kBVECS: {
+            file_format = "BVECS";
+            break;
+        }
+        case CopyFileType::kIVECS: {
+            file_format = "IVECS";
+            break;
+        }
+        case CopyFileType::kFBIN: {
+            file_format = "FBIN";
+            break;
+        }
+        case CopyFileType::kPARQUET: {
+            file_format = "PARQUET";
+            break;
+        }
+        case CopyFileType::kARROW: {
+            file_format = "ARROW";
+            break;
+        }
         case CopyFileType::kInvalid: {
             file_format = "Invalid";
             break;
@@ -33,6 +33,12 @@ std::string IndexInfo::IndexTypeToString(IndexType index_type) {
         case IndexType::kSecondary: {
             return "SECONDARY";
         }
+        case IndexType::kIVFPQ: {
+            return "IVFPQ";
+        }
+        case IndexType::kBitmap: {
+            return "BITMAP";
+        }
         case IndexType::kInvalid: {
             ParserError("Invalid conflict type.");
         }
@@ -49,6 +55,10 @@ IndexType IndexInfo::StringToIndexType(const std::string &index_type_str) {
         return IndexType::kFullText;
     } else if (index_type_str == "SECONDARY") {
         return IndexType::kSecondary;
+    } else if (index_type_str == "IVFPQ") {
+        return IndexType::kIVFPQ;
+    } else if (index_type_str == "BITMAP") {
+        return IndexType::kBitmap;
     } else {
         return IndexType::kInvalid;
     }
@@ -26,6 +26,8 @@ enum class IndexType {
     kHnsw,
     kFullText,
     kSecondary,
+    kIVFPQ,
+    kBitmap,
     kInvalid,
 };
 
@@ -59,6 +59,9 @@ std::string CreateTableInfo::ToString() const {
             ParserError("Invalid conflict type.");
         }
     }
+    if (!clone_table_name_.empty()) {
+        ss << "Clone " << clone_table_name_ << " ";
+    }
     return ss.str();
 }
 
@@ -44,6 +44,10 @@ public:
     std::vector<infinity::InitParameter *> properties_{};
 
     SelectStatement *select_{nullptr};
+
+    // CREATE TABLE ... CLONE source, the new table shares the data files of the source table.
+    std::string clone_schema_name_{};
+    std::string clone_table_name_{};
 };
 
 } // namespace infinity
@@ -17,6 +17,8 @@
 #include "base_statement.h"
 #include "statement/select_statement.h"
 
+#include <string_view>
+
 namespace infinity {
 
 class InsertStatement final : public BaseStatement {
@@ -33,6 +35,10 @@ public:
     std::vector<std::string> *columns_{nullptr};
     std::vector<std::vector<ParsedExpr *> *> *values_{nullptr};
 
+    // A columnar insert instead of values_: column_data_[i] holds the values of columns_[i] in the binary layout of the column type,
+    // split into chunks of whole rows. The chunks aren't owned by the statement.
+    std::vector<std::vector<std::string_view>> column_data_{};
+
     SelectStatement *select_{nullptr};
 };
 
@@ -80,6 +80,14 @@ std::string ShowStatement::ToString() const {
             ss << "Show profiles";
             break;
         }
+        case ShowStmtType::kSlowQueries: {
+            ss << "Show slow queries";
+            break;
+        }
+        case ShowStmtType::kQueries: {
+            ss << "Show queries";
+            break;
+        }
         case ShowStmtType::kSessionStatus: {
             ss << "Show session status";
             break;
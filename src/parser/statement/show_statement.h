@@ -31,6 +31,8 @@ enum class ShowStmtType {
     kIndexes,
     kConfigs,
     kProfiles,
+    kSlowQueries,
+    kQueries,
     kSegments,
     kSegment,
     kBlocks,
@@ -25,6 +25,11 @@ enum class CopyFileType {
     kJSON,
     kJSONL,
     kFVECS,
+    kBVECS,
+    kIVECS,
+    kFBIN,
+    kPARQUET,
+    kARROW,
     kInvalid,
 };
 
@@ -38,6 +43,16 @@ inline std::shared_ptr<std::string> copy_file_to_str(CopyFileType copy_file_type
             return std::make_shared<std::string>("FVECS");
         case CopyFileType::kJSONL:
             return std::make_shared<std::string>("JSONL");
+        case CopyFileType::kBVECS:
+            return std::make_shared<std::string>("BVECS");
+        case CopyFileType::kIVECS:
+            return std::make_shared<std::string>("IVECS");
+        case CopyFileType::kFBIN:
+            return std::make_shared<std::string>("FBIN");
+        case CopyFileType::kPARQUET:
+            return std::make_shared<std::string>("PARQUET");
+        case CopyFileType::kARROW:
+            return std::make_shared<std::string>("ARROW");
         case CopyFileType::kInvalid:
             return std::make_shared<std::string>("Invalid");
     }
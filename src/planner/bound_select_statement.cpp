@@ -77,6 +77,7 @@ SharedPtr<LogicalNode> BoundSelectStatement::BuildPlan(QueryContext *query_conte
     const SharedPtr<BindContext> &bind_context = this->bind_context_;
     if (search_expr_.get() == nullptr) {
         SharedPtr<LogicalNode> root = BuildFrom(table_ref_ptr_, query_context, bind_context);
+        BuildSemiJoins(root, where_conditions_, query_context);
         if (!where_conditions_.empty()) {
             SharedPtr<LogicalNode> filter = BuildFilter(root, where_conditions_, query_context, bind_context);
             filter->set_left_node(root);
@@ -109,7 +110,10 @@ SharedPtr<LogicalNode> BoundSelectStatement::BuildPlan(QueryContext *query_conte
             }
 
             if (limit_expression_.get() == nullptr) {
-                SharedPtr<LogicalNode> sort = MakeShared<LogicalSort>(bind_context->GetNewLogicalNodeId(), order_by_expressions_, order_by_types_);
+                SharedPtr<LogicalNode> sort = MakeShared<LogicalSort>(bind_context->GetNewLogicalNodeId(),
+                                                                      static_pointer_cast<BaseTableRef>(table_ref_ptr_),
+                                                                      order_by_expressions_,
+                                                                      order_by_types_);
                 sort->set_left_node(root);
                 root = sort;
             } else {
@@ -156,8 +160,10 @@ SharedPtr<LogicalNode> BoundSelectStatement::BuildPlan(QueryContext *query_conte
                 UnrecoverableError("Not base table reference");
             }
             auto base_table_ref = static_pointer_cast<BaseTableRef>(table_ref_ptr_);
-            SharedPtr<LogicalNode> matchNode = MakeShared<LogicalMatch>(bind_context->GetNewLogicalNodeId(), base_table_ref, match_expr);
-            match_knn_nodes.push_back(matchNode);
+            auto match_node = MakeShared<LogicalMatch>(bind_context->GetNewLogicalNodeId(), base_table_ref, match_expr);
+            // FIXME: need check if there is subquery inside the where conditions
+            match_node->filter_expression_ = ComposeExpressionWithDelimiter(where_conditions_, ConjunctionType::kAnd);
+            match_knn_nodes.push_back(std::move(match_node));
         }
 
         bind_context->GenerateTableIndex();
@@ -174,7 +180,8 @@ SharedPtr<LogicalNode> BoundSelectStatement::BuildPlan(QueryContext *query_conte
         }
 
         if (search_expr_->fusion_expr_.get() != nullptr) {
-            SharedPtr<LogicalNode> fusionNode = MakeShared<LogicalFusion>(bind_context->GetNewLogicalNodeId(), search_expr_->fusion_expr_);
+            SharedPtr<LogicalFusion> fusionNode = MakeShared<LogicalFusion>(bind_context->GetNewLogicalNodeId(), search_expr_->fusion_expr_);
+            fusionNode->base_table_ref_ = static_pointer_cast<BaseTableRef>(table_ref_ptr_);
             fusionNode->set_left_node(match_knn_nodes[0]);
             if (match_knn_nodes.size() > 1)
                 fusionNode->set_right_node(match_knn_nodes[1]);
@@ -183,6 +190,12 @@ SharedPtr<LogicalNode> BoundSelectStatement::BuildPlan(QueryContext *query_conte
             root = match_knn_nodes[0];
         }
 
+        if (limit_expression_.get() != nullptr) {
+            auto limit = MakeShared<LogicalLimit>(bind_context->GetNewLogicalNodeId(), limit_expression_, offset_expression_);
+            limit->set_left_node(root);
+            root = limit;
+        }
+
         auto project = MakeShared<LogicalProject>(bind_context->GetNewLogicalNodeId(), projection_expressions_, projection_index_);
         project->set_left_node(root);
         root = project;
@@ -336,6 +349,28 @@ SharedPtr<LogicalNode> BoundSelectStatement::BuildFilter(SharedPtr<LogicalNode>
     return filter;
 }
 
+void BoundSelectStatement::BuildSemiJoins(SharedPtr<LogicalNode> &root, Vector<SharedPtr<BaseExpression>> &conditions, QueryContext *query_context) {
+    Vector<SharedPtr<BaseExpression>> remaining_conditions;
+    for (auto &condition : conditions) {
+        if (condition->type() != ExpressionType::kSubQuery) {
+            remaining_conditions.emplace_back(condition);
+            continue;
+        }
+        auto *subquery_expr_ptr = static_cast<SubqueryExpression *>(condition.get());
+        const SharedPtr<BindContext> &subquery_bind_context = subquery_expr_ptr->bound_select_statement_ptr_->bind_context_;
+        bool correlated = subquery_bind_context->HasCorrelatedColumn();
+        if (!SubqueryUnnest::CanUnnestAsSemiJoin(subquery_expr_ptr, correlated)) {
+            remaining_conditions.emplace_back(condition);
+            continue;
+        }
+        building_subquery_ = true;
+        SharedPtr<LogicalNode> subquery_plan = subquery_expr_ptr->bound_select_statement_ptr_->BuildPlan(query_context);
+        SubqueryUnnest::UnnestAsSemiJoin(subquery_expr_ptr, root, subquery_plan, query_context, subquery_bind_context, correlated);
+        building_subquery_ = false;
+    }
+    conditions = std::move(remaining_conditions);
+}
+
 void BoundSelectStatement::BuildSubquery(SharedPtr<LogicalNode> &root,
                                          SharedPtr<BaseExpression> &condition,
                                          QueryContext *query_context,
@@ -66,6 +66,9 @@ public:
                                        QueryContext *query_context,
                                        const SharedPtr<BindContext> &bind_context);
 
+    // The IN and EXISTS subqueries among the conditions become semi or anti joins on root, they are removed from the conditions.
+    void BuildSemiJoins(SharedPtr<LogicalNode> &root, Vector<SharedPtr<BaseExpression>> &conditions, QueryContext *query_context);
+
     void BuildSubquery(SharedPtr<LogicalNode> &root,
                        SharedPtr<BaseExpression> &condition,
                        QueryContext *query_context,
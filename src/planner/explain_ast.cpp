@@ -547,6 +547,14 @@ void ExplainAST::BuildShow(const ShowStatement *show_statement, SharedPtr<Vector
             result->emplace_back(MakeShared<String>("SHOW PROFILES"));
             break;
         }
+        case ShowStmtType::kSlowQueries: {
+            result->emplace_back(MakeShared<String>("SHOW SLOW_QUERIES"));
+            break;
+        }
+        case ShowStmtType::kQueries: {
+            result->emplace_back(MakeShared<String>("SHOW QUERIES"));
+            break;
+        }
         case ShowStmtType::kSessionStatus: {
             result->emplace_back(MakeShared<String>("SHOW SESSION STATUS"));
             break;
@@ -625,6 +633,31 @@ void ExplainAST::BuildCopy(const CopyStatement *copy_statement, SharedPtr<Vector
             result->emplace_back(file_type);
             break;
         }
+        case CopyFileType::kBVECS: {
+            SharedPtr<String> file_type = MakeShared<String>(String(intent_size, ' ') + "file type: BVECS");
+            result->emplace_back(file_type);
+            break;
+        }
+        case CopyFileType::kIVECS: {
+            SharedPtr<String> file_type = MakeShared<String>(String(intent_size, ' ') + "file type: IVECS");
+            result->emplace_back(file_type);
+            break;
+        }
+        case CopyFileType::kFBIN: {
+            SharedPtr<String> file_type = MakeShared<String>(String(intent_size, ' ') + "file type: FBIN");
+            result->emplace_back(file_type);
+            break;
+        }
+        case CopyFileType::kPARQUET: {
+            SharedPtr<String> file_type = MakeShared<String>(String(intent_size, ' ') + "file type: PARQUET");
+            result->emplace_back(file_type);
+            break;
+        }
+        case CopyFileType::kARROW: {
+            SharedPtr<String> file_type = MakeShared<String>(String(intent_size, ' ') + "file type: ARROW");
+            result->emplace_back(file_type);
+            break;
+        }
         case CopyFileType::kInvalid: {
             UnrecoverableError("Invalid file type");
         }
@@ -42,6 +42,7 @@ import logical_sort;
 import logical_limit;
 import logical_top;
 import logical_cross_product;
+import logical_union;
 import logical_join;
 import logical_show;
 import logical_import;
@@ -87,8 +88,10 @@ void ExplainLogicalPlan::Explain(const LogicalNode *statement, SharedPtr<Vector<
         }
         case LogicalNodeType::kExcept:
             break;
-        case LogicalNodeType::kUnion:
+        case LogicalNodeType::kUnion: {
+            Explain((LogicalUnion *)statement, result, intent_size);
             break;
+        }
         case LogicalNodeType::kIntersect:
             break;
         case LogicalNodeType::kJoin: {
@@ -1169,6 +1172,37 @@ void ExplainLogicalPlan::Explain(const LogicalCrossProduct *cross_product_node,
     }
 }
 
+void ExplainLogicalPlan::Explain(const LogicalUnion *union_node, SharedPtr<Vector<SharedPtr<String>>> &result, i64 intent_size) {
+    {
+        String union_header;
+        if (intent_size != 0) {
+            union_header = String(intent_size - 2, ' ');
+            union_header += "-> UNION ALL ";
+        } else {
+            union_header = "UNION ALL ";
+        }
+        union_header += "(";
+        union_header += std::to_string(union_node->node_id());
+        union_header += ")";
+        result->emplace_back(MakeShared<String>(union_header));
+    }
+
+    // Output column
+    {
+        String output_columns_str = String(intent_size, ' ');
+        output_columns_str += " - output columns: [";
+        SharedPtr<Vector<String>> output_columns = union_node->GetOutputNames();
+        SizeT column_count = output_columns->size();
+        for (SizeT idx = 0; idx < column_count - 1; ++idx) {
+            output_columns_str += output_columns->at(idx);
+            output_columns_str += ", ";
+        }
+        output_columns_str += output_columns->back();
+        output_columns_str += "]";
+        result->emplace_back(MakeShared<String>(output_columns_str));
+    }
+}
+
 void ExplainLogicalPlan::Explain(const LogicalJoin *join_node, SharedPtr<Vector<SharedPtr<String>>> &result, i64 intent_size) {
     {
         String join_header;
@@ -1392,6 +1426,43 @@ void ExplainLogicalPlan::Explain(const LogicalShow *show_node, SharedPtr<Vector<
             result->emplace_back(MakeShared<String>(output_columns_str));
             break;
         }
+        case ShowType::kShowSlowQueries: {
+            String show_str;
+            if (intent_size != 0) {
+                show_str = String(intent_size - 2, ' ');
+                show_str += "-> SHOW SLOW_QUERIES ";
+            } else {
+                show_str = "SHOW SLOW_QUERIES ";
+            }
+            show_str += "(";
+            show_str += std::to_string(show_node->node_id());
+            show_str += ")";
+            result->emplace_back(MakeShared<String>(show_str));
+
+            String output_columns_str = String(intent_size, ' ');
+            output_columns_str += " - output columns: [record_no, session_id, reason, query, parser, logical planner, optimizer, physical planner, "
+                                  "pipeline builder, task builder, executor, commit, rollback, total_cost]";
+            result->emplace_back(MakeShared<String>(output_columns_str));
+            break;
+        }
+        case ShowType::kShowQueries: {
+            String show_str;
+            if (intent_size != 0) {
+                show_str = String(intent_size - 2, ' ');
+                show_str += "-> SHOW QUERIES ";
+            } else {
+                show_str = "SHOW QUERIES ";
+            }
+            show_str += "(";
+            show_str += std::to_string(show_node->node_id());
+            show_str += ")";
+            result->emplace_back(MakeShared<String>(show_str));
+
+            String output_columns_str = String(intent_size, ' ');
+            output_columns_str += " - output columns: [query_id, session_id, elapsed, fragments, tasks, rows_scanned, memory, operator, query]";
+            result->emplace_back(MakeShared<String>(output_columns_str));
+            break;
+        }
         case ShowType::kShowIndexes: {
             String show_str;
             if (intent_size != 0) {
@@ -1772,6 +1843,31 @@ void ExplainLogicalPlan::Explain(const LogicalImport *import_node, SharedPtr<Vec
             result->emplace_back(file_type);
             break;
         }
+        case CopyFileType::kBVECS: {
+            SharedPtr<String> file_type = MakeShared<String>(fmt::format("{} - type: BVECS", String(intent_size, ' ')));
+            result->emplace_back(file_type);
+            break;
+        }
+        case CopyFileType::kIVECS: {
+            SharedPtr<String> file_type = MakeShared<String>(fmt::format("{} - type: IVECS", String(intent_size, ' ')));
+            result->emplace_back(file_type);
+            break;
+        }
+        case CopyFileType::kFBIN: {
+            SharedPtr<String> file_type = MakeShared<String>(fmt::format("{} - type: FBIN", String(intent_size, ' ')));
+            result->emplace_back(file_type);
+            break;
+        }
+        case CopyFileType::kPARQUET: {
+            SharedPtr<String> file_type = MakeShared<String>(fmt::format("{} - type: PARQUET", String(intent_size, ' ')));
+            result->emplace_back(file_type);
+            break;
+        }
+        case CopyFileType::kARROW: {
+            SharedPtr<String> file_type = MakeShared<String>(fmt::format("{} - type: ARROW", String(intent_size, ' ')));
+            result->emplace_back(file_type);
+            break;
+        }
         case CopyFileType::kFVECS: {
             SharedPtr<String> file_type = MakeShared<String>(fmt::format("{} - type: FVECS", String(intent_size, ' ')));
             result->emplace_back(file_type);
@@ -1842,6 +1938,31 @@ void ExplainLogicalPlan::Explain(const LogicalExport *export_node, SharedPtr<Vec
             result->emplace_back(file_type);
             break;
         }
+        case CopyFileType::kBVECS: {
+            SharedPtr<String> file_type = MakeShared<String>(fmt::format("{} - type: BVECS", String(intent_size, ' ')));
+            result->emplace_back(file_type);
+            break;
+        }
+        case CopyFileType::kIVECS: {
+            SharedPtr<String> file_type = MakeShared<String>(fmt::format("{} - type: IVECS", String(intent_size, ' ')));
+            result->emplace_back(file_type);
+            break;
+        }
+        case CopyFileType::kFBIN: {
+            SharedPtr<String> file_type = MakeShared<String>(fmt::format("{} - type: FBIN", String(intent_size, ' ')));
+            result->emplace_back(file_type);
+            break;
+        }
+        case CopyFileType::kPARQUET: {
+            SharedPtr<String> file_type = MakeShared<String>(fmt::format("{} - type: PARQUET", String(intent_size, ' ')));
+            result->emplace_back(file_type);
+            break;
+        }
+        case CopyFileType::kARROW: {
+            SharedPtr<String> file_type = MakeShared<String>(fmt::format("{} - type: ARROW", String(intent_size, ' ')));
+            result->emplace_back(file_type);
+            break;
+        }
         case CopyFileType::kFVECS: {
             SharedPtr<String> file_type = MakeShared<String>(fmt::format("{} - type: FVECS", String(intent_size, ' ')));
             result->emplace_back(file_type);
@@ -40,6 +40,7 @@ import logical_sort;
 import logical_limit;
 import logical_top;
 import logical_cross_product;
+import logical_union;
 import logical_join;
 import logical_show;
 import logical_import;
@@ -100,6 +101,8 @@ public:
 
     static void Explain(const LogicalCrossProduct *cross_product_node, SharedPtr<Vector<SharedPtr<String>>> &result, i64 intent_size = 0);
 
+    static void Explain(const LogicalUnion *union_node, SharedPtr<Vector<SharedPtr<String>>> &result, i64 intent_size = 0);
+
     static void Explain(const LogicalJoin *join_node, SharedPtr<Vector<SharedPtr<String>>> &result, i64 intent_size = 0);
 
     static void Explain(const LogicalShow *show_node, SharedPtr<Vector<SharedPtr<String>>> &result, i64 intent_size = 0);
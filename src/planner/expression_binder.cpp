@@ -14,6 +14,7 @@
 
 module;
 
+#include <cstdlib>
 #include <string>
 
 module expression_binder;
@@ -44,6 +45,7 @@ import match_expression;
 import function;
 import aggregate_function;
 import aggregate_function_set;
+import approx_percentile;
 
 import column_identifer;
 
@@ -72,9 +74,13 @@ import between_expr;
 import subquery_expr;
 import match_expr;
 import data_type;
+import expression_type;
 
 import catalog;
 import table_entry;
+import column_vector;
+import expression_state;
+import expression_evaluator;
 
 namespace infinity {
 
@@ -257,6 +263,9 @@ SharedPtr<BaseExpression> ExpressionBinder::BuildValueExpr(const ConstantExpr &e
             Value value = Value::MakeNull();
             return MakeShared<ValueExpression>(value);
         }
+        case LiteralType::kParameter: {
+            RecoverableError(Status::SyntaxError(fmt::format("No value is bound to parameter ${}", expr.integer_value_)));
+        }
     }
 
     UnrecoverableError("Unreachable.");
@@ -321,18 +330,23 @@ SharedPtr<BaseExpression> ExpressionBinder::BuildFuncExpr(const FunctionExpr &ex
                     continue;
                 }
                 String name = arguments[idx]->Name();
-                arguments[idx] = CastExpression::AddCastToType(arguments[idx], scalar_function.parameter_types_[idx]);
+                arguments[idx] = FoldConstant(CastExpression::AddCastToType(arguments[idx], scalar_function.parameter_types_[idx]));
                 // reset the alias name
                 arguments[idx]->alias_ = name;
             }
 
             SharedPtr<FunctionExpression> function_expr_ptr = MakeShared<FunctionExpression>(scalar_function, arguments);
-            return function_expr_ptr;
+            return FoldConstant(function_expr_ptr);
         }
         case FunctionType::kAggregate: {
             // SharedPtr<AggregateFunctionSet> aggregate_function_set_ptr
             auto aggregate_function_set_ptr = static_pointer_cast<AggregateFunctionSet>(function_set_ptr);
             AggregateFunction aggregate_function = aggregate_function_set_ptr->GetMostMatchFunction(arguments[0]);
+            if (function_set_ptr->name() == "APPROX_PERCENTILE") {
+                BindApproxPercentileFraction(aggregate_function, arguments);
+            } else if (arguments.size() != 1) {
+                RecoverableError(Status::FunctionArgsError(function_set_ptr->name()));
+            }
             auto aggregate_function_ptr = MakeShared<AggregateExpression>(aggregate_function, arguments);
             return aggregate_function_ptr;
         }
@@ -347,7 +361,56 @@ SharedPtr<BaseExpression> ExpressionBinder::BuildFuncExpr(const FunctionExpr &ex
 
 SharedPtr<BaseExpression> ExpressionBinder::BuildCastExpr(const CastExpr &expr, BindContext *bind_context_ptr, i64 depth, bool) {
     SharedPtr<BaseExpression> source_expr_ptr = BuildExpression(*expr.expr_, bind_context_ptr, depth, false);
-    return CastExpression::AddCastToType(source_expr_ptr, expr.data_type_);
+    return FoldConstant(CastExpression::AddCastToType(source_expr_ptr, expr.data_type_));
+}
+
+SharedPtr<BaseExpression> ExpressionBinder::FoldConstant(const SharedPtr<BaseExpression> &expression) {
+    if (expression->type() != ExpressionType::kFunction && expression->type() != ExpressionType::kCast) {
+        return expression;
+    }
+    for (const auto &argument : expression->arguments()) {
+        if (argument->type() != ExpressionType::kValue) {
+            return expression;
+        }
+    }
+    switch (expression->Type().type()) {
+        case LogicalType::kBoolean:
+        case LogicalType::kTinyInt:
+        case LogicalType::kSmallInt:
+        case LogicalType::kInteger:
+        case LogicalType::kBigInt:
+        case LogicalType::kFloat:
+        case LogicalType::kDouble:
+        case LogicalType::kVarchar:
+        case LogicalType::kDate:
+        case LogicalType::kTime:
+        case LogicalType::kDateTime:
+        case LogicalType::kTimestamp:
+        case LogicalType::kInterval: {
+            break;
+        }
+        default: {
+            return expression;
+        }
+    }
+
+    SharedPtr<ColumnVector> result_vector;
+    try {
+        SharedPtr<BaseExpression> folded_expression = expression;
+        SharedPtr<ExpressionState> expression_state = ExpressionState::CreateState(folded_expression);
+        result_vector = expression_state->OutputColumnVector();
+        ExpressionEvaluator expr_evaluator; // does not need input_data_block_
+        expr_evaluator.Execute(folded_expression, expression_state, result_vector);
+    } catch (const RecoverableException &) {
+        return expression;
+    }
+    if (result_vector->Size() == 0 || !result_vector->nulls_ptr_->IsTrue(0)) {
+        return expression;
+    }
+    auto value_expression = MakeShared<ValueExpression>(result_vector->GetValue(0));
+    // the output keeps the name of the expression
+    value_expression->alias_ = expression->Name();
+    return value_expression;
 }
 
 SharedPtr<BaseExpression> ExpressionBinder::BuildCaseExpr(const CaseExpr &expr, BindContext *bind_context_ptr, i64 depth, bool) {
@@ -439,6 +502,31 @@ SharedPtr<BaseExpression> ExpressionBinder::BuildInExpr(const InExpr &expr, Bind
     return in_expression_ptr;
 }
 
+// A maxsim search compares the tokens of the query and of a row: the column packs the token vectors of a row, zero vectors
+// pad the rows with fewer tokens. The token_dim option gives their dimension, it divides both embeddings.
+static void CheckMaxSimTokens(const KnnExpr &parsed_knn_expr, const EmbeddingInfo *embedding_info) {
+    if (parsed_knn_expr.embedding_data_type_ != EmbeddingDataType::kElemFloat || embedding_info->Type() != EmbeddingDataType::kElemFloat) {
+        RecoverableError(Status::SyntaxError("MaxSim search supports float embeddings."));
+    }
+    i64 token_dim = 0;
+    if (parsed_knn_expr.opt_params_ != nullptr) {
+        for (const auto *param : *parsed_knn_expr.opt_params_) {
+            if (param->param_name_ == "token_dim") {
+                token_dim = std::strtol(param->param_value_.c_str(), nullptr, 10);
+            }
+        }
+    }
+    if (token_dim <= 0) {
+        RecoverableError(Status::SyntaxError("MaxSim search needs a positive token_dim option."));
+    }
+    if ((i64)embedding_info->Dimension() % token_dim != 0 || parsed_knn_expr.dimension_ % token_dim != 0) {
+        RecoverableError(Status::SyntaxError(fmt::format("token_dim: {} should divide the query dimension: {} and the column dimension: {}",
+                                                         token_dim,
+                                                         parsed_knn_expr.dimension_,
+                                                         embedding_info->Dimension())));
+    }
+}
+
 SharedPtr<BaseExpression> ExpressionBinder::BuildKnnExpr(const KnnExpr &parsed_knn_expr, BindContext *bind_context_ptr, i64 depth, bool) {
     // Bind KNN expression
     Vector<SharedPtr<BaseExpression>> arguments;
@@ -452,17 +540,37 @@ SharedPtr<BaseExpression> ExpressionBinder::BuildKnnExpr(const KnnExpr &parsed_k
         String topn = std::to_string(parsed_knn_expr.topn_);
         RecoverableError(Status::InvalidParameterValue("topn", topn, "topn should be greater than 0"));
     }
+    if (parsed_knn_expr.opt_params_ != nullptr) {
+        for (const auto *param : *parsed_knn_expr.opt_params_) {
+            if (param->param_name_ != "threshold") {
+                continue;
+            }
+            const char *begin = param->param_value_.c_str();
+            char *end = nullptr;
+            std::strtof(begin, &end);
+            if (end == begin || *end != '\0') {
+                RecoverableError(Status::InvalidParameterValue("threshold", param->param_value_, "threshold should be a number"));
+            }
+        }
+    }
     auto expr_ptr = BuildColExpr((ColumnExpr &)*parsed_knn_expr.column_expr_, bind_context_ptr, depth, false);
     TypeInfo *type_info = expr_ptr->Type().type_info().get();
     if (type_info == nullptr or type_info->type() != TypeInfoType::kEmbedding) {
         RecoverableError(Status::SyntaxError("Expect the column search is an embedding column"));
     } else {
         EmbeddingInfo *embedding_info = (EmbeddingInfo *)type_info;
-        if ((i64)embedding_info->Dimension() != parsed_knn_expr.dimension_) {
+        if (parsed_knn_expr.distance_type_ == KnnDistanceType::kMaxSim) {
+            CheckMaxSimTokens(parsed_knn_expr, embedding_info);
+        } else if ((i64)embedding_info->Dimension() != parsed_knn_expr.dimension_) {
             RecoverableError(Status::SyntaxError(fmt::format("Query embedding with dimension: {} which doesn't not matched with {}",
                                                              parsed_knn_expr.dimension_,
                                                              embedding_info->Dimension())));
         }
+        if (embedding_info->Type() != parsed_knn_expr.embedding_data_type_) {
+            RecoverableError(Status::SyntaxError(fmt::format("Query embedding with element type: {} which doesn't not matched with {}",
+                                                             EmbeddingType::EmbeddingDataType2String(parsed_knn_expr.embedding_data_type_),
+                                                             EmbeddingType::EmbeddingDataType2String(embedding_info->Type()))));
+        }
     }
 
     arguments.emplace_back(expr_ptr);
@@ -493,6 +601,14 @@ SharedPtr<BaseExpression> ExpressionBinder::BuildSearchExpr(const SearchExpr &ex
     }
     if (expr.fusion_expr_ != nullptr)
         fusion_expr = MakeShared<FusionExpression>(expr.fusion_expr_->method_, expr.fusion_expr_->options_);
+    if (expr.rerank_expr_ != nullptr) {
+        // The fused rows are scored with the gemm of float embeddings
+        if (expr.rerank_expr_->embedding_data_type_ != EmbeddingDataType::kElemFloat ||
+            expr.rerank_expr_->distance_type_ == KnnDistanceType::kHamming) {
+            RecoverableError(Status::NotSupport("Rerank supports float embeddings with l2, ip, cosine or maxsim."));
+        }
+        fusion_expr->rerank_expr_ = static_pointer_cast<KnnExpression>(BuildKnnExpr(*expr.rerank_expr_, bind_context_ptr, depth, false));
+    }
     SharedPtr<SearchExpression> bound_search_expr = MakeShared<SearchExpression>(match_exprs, knn_exprs, fusion_expr);
     return bound_search_expr;
 }
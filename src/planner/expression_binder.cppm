@@ -88,6 +88,10 @@ public:
 protected:
     Optional<SharedPtr<BaseExpression>> TryBuildSpecialFuncExpr(const FunctionExpr &expr, BindContext *bind_context_ptr, i64 depth);
 
+    // A function or a cast of constants is computed once here, instead of for each block. The expression is kept if computing
+    // it fails, the error is raised when the query runs.
+    static SharedPtr<BaseExpression> FoldConstant(const SharedPtr<BaseExpression> &expression);
+
     QueryContext *query_context_{};
 };
 
@@ -37,6 +37,7 @@ import logical_top;
 import logical_insert;
 import logical_update;
 import logical_knn_scan;
+import logical_match;
 import logical_index_scan;
 
 import aggregate_expression;
@@ -141,6 +142,13 @@ void LogicalNodeVisitor::VisitNodeExpression(LogicalNode &op) {
             }
             break;
         }
+        case LogicalNodeType::kMatch: {
+            auto &node = (LogicalMatch &)op;
+            if (node.filter_expression_) {
+                VisitExpression(node.filter_expression_);
+            }
+            break;
+        }
         case LogicalNodeType::kIndexScan: {
             // always keep the original expression
             break;
@@ -15,6 +15,8 @@
 module;
 
 #include <cassert>
+#include <charconv>
+#include <cstring>
 #include <string>
 #include <tuple>
 #include <vector>
@@ -37,6 +39,7 @@ import cast_function;
 import bound_cast_func;
 import base_expression;
 import txn;
+import table_entry;
 import table_entry_type;
 import third_party;
 import table_def;
@@ -55,9 +58,12 @@ import logical_show;
 import logical_flush;
 import logical_optimize;
 import logical_export;
+import block_index;
+import embedding_info;
 import logical_import;
 import logical_explain;
 import logical_command;
+import logical_union;
 import explain_logical_plan;
 import explain_ast;
 
@@ -67,8 +73,10 @@ import status;
 import default_values;
 import index_base;
 import index_ivfflat;
+import index_ivfpq;
 import index_hnsw;
 import index_secondary;
+import index_bitmap;
 import index_full_text;
 import base_table_ref;
 import table_ref;
@@ -86,6 +94,11 @@ import drop_schema_info;
 import drop_table_info;
 import drop_view_info;
 import column_def;
+import sort_key;
+import data_block;
+import column_vector;
+import value;
+import data_type;
 
 namespace {
 
@@ -121,6 +134,94 @@ IdentifierValidationStatus IdentifierValidation(const String &identifier) {
     return IdentifierValidationStatus::kOk;
 }
 
+// The row size of a column in the binary layout of a columnar insert, 0 for the varchar rows of an i32 length and the bytes.
+SizeT ColumnarRowSize(const DataType &column_type) {
+    switch (column_type.type()) {
+        case LogicalType::kBoolean: {
+            return 1;
+        }
+        case LogicalType::kTinyInt:
+        case LogicalType::kSmallInt:
+        case LogicalType::kInteger:
+        case LogicalType::kBigInt:
+        case LogicalType::kFloat:
+        case LogicalType::kDouble:
+        case LogicalType::kDate:
+        case LogicalType::kEmbedding: {
+            return column_type.Size();
+        }
+        case LogicalType::kVarchar: {
+            return 0;
+        }
+        default: {
+            RecoverableError(Status::NotSupport(fmt::format("Columnar insert of {} column", column_type.ToString())));
+            return 0;
+        }
+    }
+}
+
+SizeT ColumnarRowCount(const String &column_name, SizeT row_size, const Vector<std::string_view> &chunks) {
+    SizeT row_count = 0;
+    for (const std::string_view &chunk : chunks) {
+        if (row_size > 0) {
+            if (chunk.size() % row_size != 0) {
+                RecoverableError(Status::SyntaxError(fmt::format("INSERT: Data of column {} isn't made of whole rows", column_name)));
+            }
+            row_count += chunk.size() / row_size;
+            continue;
+        }
+        SizeT offset = 0;
+        while (offset < chunk.size()) {
+            i32 length = -1;
+            if (offset + sizeof(i32) <= chunk.size()) {
+                std::memcpy(&length, chunk.data() + offset, sizeof(i32));
+                offset += sizeof(i32);
+            }
+            if (length < 0 || offset + length > chunk.size()) {
+                RecoverableError(Status::SyntaxError(fmt::format("INSERT: Data of column {} isn't made of whole rows", column_name)));
+            }
+            offset += length;
+            ++row_count;
+        }
+    }
+    return row_count;
+}
+
+// Append the next row_count rows of the binary column data, from the row at offset of chunks[chunk_idx] on.
+void AppendColumnarRows(ColumnVector &column_vector,
+                        SizeT row_size,
+                        const Vector<std::string_view> &chunks,
+                        SizeT &chunk_idx,
+                        SizeT &offset,
+                        SizeT row_count) {
+    while (row_count > 0) {
+        const std::string_view &chunk = chunks[chunk_idx];
+        if (offset == chunk.size()) {
+            ++chunk_idx;
+            offset = 0;
+            continue;
+        }
+        if (row_size == 0) {
+            i32 length = 0;
+            std::memcpy(&length, chunk.data() + offset, sizeof(i32));
+            offset += sizeof(i32);
+            column_vector.AppendValue(Value::MakeVarchar(chunk.data() + offset, length));
+            offset += length;
+            --row_count;
+        } else if (column_vector.data_type()->type() == LogicalType::kBoolean) {
+            column_vector.AppendValue(Value::MakeBool(chunk[offset] != 0));
+            offset += row_size;
+            --row_count;
+        } else {
+            // the fixed-width rows of the chunk are copied as they are
+            SizeT copy_count = std::min(row_count, (chunk.size() - offset) / row_size);
+            column_vector.AppendRaw(chunk.data() + offset, copy_count);
+            offset += copy_count * row_size;
+            row_count -= copy_count;
+        }
+    }
+}
+
 } // namespace
 
 namespace infinity {
@@ -183,14 +284,56 @@ Status LogicalPlanner::Build(const BaseStatement *statement, SharedPtr<BindConte
 }
 
 Status LogicalPlanner::BuildSelect(const SelectStatement *statement, SharedPtr<BindContext> &bind_context_ptr) {
-    UniquePtr<QueryBinder> query_binder_ptr = MakeUnique<QueryBinder>(this->query_context_ptr_, bind_context_ptr);
-    UniquePtr<BoundSelectStatement> bound_statement_ptr = query_binder_ptr->BindSelect(*statement);
-    this->logical_plan_ = bound_statement_ptr->BuildPlan(query_context_ptr_);
+    if (statement->nested_select_ == nullptr) {
+        UniquePtr<QueryBinder> query_binder_ptr = MakeUnique<QueryBinder>(this->query_context_ptr_, bind_context_ptr);
+        UniquePtr<BoundSelectStatement> bound_statement_ptr = query_binder_ptr->BindSelect(*statement);
+        this->logical_plan_ = bound_statement_ptr->BuildPlan(query_context_ptr_);
+        return Status::OK();
+    }
+    return BuildSetOperation(statement, bind_context_ptr);
+}
+
+Status LogicalPlanner::BuildSetOperation(const SelectStatement *statement, SharedPtr<BindContext> &bind_context_ptr) {
+    for (const SelectStatement *node = statement; node->nested_select_ != nullptr; node = node->nested_select_) {
+        if (node->set_op_ != SetOperatorType::kUnionAll) {
+            RecoverableError(Status::NotSupport("Only UNION ALL is supported in set operation."));
+        }
+    }
+
+    SharedPtr<LogicalNode> set_operation_plan = nullptr;
+    for (const SelectStatement *node = statement; node != nullptr; node = node->nested_select_) {
+        // Each input is bound in its own context, columns of other inputs aren't visible to it.
+        SharedPtr<BindContext> input_bind_context_ptr = BindContext::Make(bind_context_ptr);
+        QueryBinder input_query_binder(this->query_context_ptr_, input_bind_context_ptr);
+        UniquePtr<BoundSelectStatement> bound_statement_ptr = input_query_binder.BindSelect(*node);
+        SharedPtr<LogicalNode> input_plan = bound_statement_ptr->BuildPlan(query_context_ptr_);
+        if (set_operation_plan.get() == nullptr) {
+            set_operation_plan = std::move(input_plan);
+            continue;
+        }
+
+        SharedPtr<Vector<SharedPtr<DataType>>> output_types = set_operation_plan->GetOutputTypes();
+        SharedPtr<Vector<SharedPtr<DataType>>> input_types = input_plan->GetOutputTypes();
+        if (output_types->size() != input_types->size()) {
+            RecoverableError(Status::SyntaxError(
+                fmt::format("Each UNION ALL query must have the same number of columns, {} vs {}.", output_types->size(), input_types->size())));
+        }
+        for (SizeT column_idx = 0; column_idx < output_types->size(); ++column_idx) {
+            if (*output_types->at(column_idx) != *input_types->at(column_idx)) {
+                RecoverableError(Status::DataTypeMismatch(output_types->at(column_idx)->ToString(), input_types->at(column_idx)->ToString()));
+            }
+        }
+        set_operation_plan = MakeShared<LogicalUnion>(bind_context_ptr->GetNewLogicalNodeId(), set_operation_plan, input_plan);
+    }
+    this->logical_plan_ = set_operation_plan;
     return Status::OK();
 }
 
 Status LogicalPlanner::BuildInsert(InsertStatement *statement, SharedPtr<BindContext> &bind_context_ptr) {
     BindSchemaName(statement->schema_name_);
+    if (!statement->column_data_.empty()) {
+        return BuildInsertColumnar(statement, bind_context_ptr);
+    }
     if (statement->select_ == nullptr) {
         return BuildInsertValue(statement, bind_context_ptr);
     } else {
@@ -335,6 +478,89 @@ Status LogicalPlanner::BuildInsertValue(const InsertStatement *statement, Shared
     return Status::OK();
 }
 
+Status LogicalPlanner::BuildInsertColumnar(const InsertStatement *statement, SharedPtr<BindContext> &bind_context_ptr) {
+    const String &schema_name = statement->schema_name_;
+    const String &table_name = statement->table_name_;
+    if (table_name.empty()) {
+        UnrecoverableError("Insert statement missing table table_name.");
+    }
+    Txn *txn = query_context_ptr_->GetTxn();
+    auto [table_entry, status] = txn->GetTableByName(schema_name, table_name);
+    if (!status.ok()) {
+        RecoverableError(status);
+    }
+    if (table_entry->EntryType() == TableEntryType::kCollectionEntry) {
+        RecoverableError(Status::NotSupport("Currently, collection isn't supported."));
+    }
+
+    // The data of each table column, every column must be given.
+    SizeT table_column_count = table_entry->ColumnCount();
+    SizeT column_count = statement->columns_ != nullptr ? statement->columns_->size() : table_column_count;
+    if (column_count != table_column_count || statement->column_data_.size() != table_column_count) {
+        RecoverableError(Status::SyntaxError(fmt::format("INSERT: Table column count ({}) and "
+                                                         "input column count mismatch ({})",
+                                                         table_column_count,
+                                                         statement->column_data_.size())));
+    }
+    Vector<const Vector<std::string_view> *> column_data(table_column_count, nullptr);
+    for (SizeT column_idx = 0; column_idx < column_count; ++column_idx) {
+        SizeT table_column_id = column_idx;
+        if (statement->columns_ != nullptr) {
+            table_column_id = table_entry->GetColumnIdByName(statement->columns_->at(column_idx));
+        }
+        if (column_data[table_column_id] != nullptr) {
+            RecoverableError(Status::SyntaxError(fmt::format("INSERT: Column {} is given more than once", statement->columns_->at(column_idx))));
+        }
+        column_data[table_column_id] = &statement->column_data_[column_idx];
+    }
+
+    Vector<SharedPtr<DataType>> column_types;
+    Vector<SizeT> row_sizes;
+    SizeT row_count = 0;
+    for (SizeT column_id = 0; column_id < table_column_count; ++column_id) {
+        const ColumnDef *column_def = table_entry->GetColumnDefByID(column_id);
+        SizeT row_size = ColumnarRowSize(*column_def->column_type_);
+        SizeT column_row_count = ColumnarRowCount(column_def->name(), row_size, *column_data[column_id]);
+        if (column_id > 0 && column_row_count != row_count) {
+            RecoverableError(Status::SyntaxError(
+                fmt::format("INSERT: Column {} has {} rows, not {} like the others", column_def->name(), column_row_count, row_count)));
+        }
+        row_count = column_row_count;
+        column_types.emplace_back(column_def->column_type_);
+        row_sizes.emplace_back(row_size);
+    }
+    if (row_count == 0) {
+        RecoverableError(Status::SyntaxError("INSERT: No row to insert"));
+    }
+
+    // Split the rows into blocks of DEFAULT_BLOCK_CAPACITY rows.
+    Vector<SharedPtr<DataBlock>> data_blocks;
+    Vector<Pair<SizeT, SizeT>> positions(table_column_count, {0, 0});
+    for (SizeT block_begin = 0; block_begin < row_count; block_begin += DEFAULT_BLOCK_CAPACITY) {
+        SizeT block_row_count = std::min<SizeT>(DEFAULT_BLOCK_CAPACITY, row_count - block_begin);
+        SharedPtr<DataBlock> data_block = DataBlock::Make();
+        data_block->Init(column_types);
+        for (SizeT column_id = 0; column_id < table_column_count; ++column_id) {
+            auto &[chunk_idx, offset] = positions[column_id];
+            AppendColumnarRows(*data_block->column_vectors[column_id],
+                               row_sizes[column_id],
+                               *column_data[column_id],
+                               chunk_idx,
+                               offset,
+                               block_row_count);
+        }
+        data_block->Finalize();
+        data_blocks.emplace_back(std::move(data_block));
+    }
+
+    SharedPtr<LogicalNode> logical_insert = MakeShared<LogicalInsert>(bind_context_ptr->GetNewLogicalNodeId(),
+                                                                      table_entry,
+                                                                      bind_context_ptr->GenerateTableIndex(),
+                                                                      std::move(data_blocks));
+    this->logical_plan_ = logical_insert;
+    return Status::OK();
+}
+
 Status LogicalPlanner::BuildInsertSelect(const InsertStatement *, SharedPtr<BindContext> &) {
     RecoverableError(Status::NotSupport("Not supported"));
     return Status::OK();
@@ -382,6 +608,9 @@ Status LogicalPlanner::BuildCreate(CreateStatement *statement, SharedPtr<BindCon
 
 Status LogicalPlanner::BuildCreateTable(const CreateStatement *statement, SharedPtr<BindContext> &bind_context_ptr) {
     auto *create_table_info = (CreateTableInfo *)statement->create_info_.get();
+    if (!create_table_info->clone_table_name_.empty()) {
+        return BuildCloneTable(statement, bind_context_ptr);
+    }
 
     // Check if columns is given.
     Vector<SharedPtr<ColumnDef>> columns;
@@ -427,6 +656,8 @@ Status LogicalPlanner::BuildCreateTable(const CreateStatement *statement, Shared
     }
 
     SharedPtr<TableDef> table_def_ptr = TableDef::Make(MakeShared<String>("default"), MakeShared<String>(create_table_info->table_name_), columns);
+    ColumnID ttl_column_id = INVALID_COLUMN_ID;
+    u64 ttl_seconds = 0;
     for (HashSet<String> visited_param_names; auto *property_ptr : create_table_info->properties_) {
         auto &[param_name, param_value] = *property_ptr;
         if (auto [_, success] = visited_param_names.insert(param_name); !success) {
@@ -464,8 +695,52 @@ Status LogicalPlanner::BuildCreateTable(const CreateStatement *statement, Shared
                         fmt::format("Bloom filter can't be created for {} type column {}", def->type()->ToString(), def->name()));
                 }
             }
+        } else if (param_name == "segment_capacity") {
+            // the segment offset of a row must fit in the bits of SEGMENT_MASK_IN_DOCID, and a segment is made of whole blocks
+            SizeT segment_capacity = 0;
+            auto [end_ptr, ec] = std::from_chars(param_value.data(), param_value.data() + param_value.size(), segment_capacity);
+            if (ec != std::errc() || end_ptr != param_value.data() + param_value.size() || segment_capacity == 0 ||
+                segment_capacity > DEFAULT_SEGMENT_CAPACITY || segment_capacity % DEFAULT_BLOCK_CAPACITY != 0) {
+                return Status::SyntaxError(fmt::format("segment_capacity must be a multiple of {} up to {}, got: {}",
+                                                       DEFAULT_BLOCK_CAPACITY,
+                                                       DEFAULT_SEGMENT_CAPACITY,
+                                                       param_value));
+            }
+            table_def_ptr->set_segment_capacity(segment_capacity);
+        } else if (param_name == "sort_key") {
+            // the rows of each imported or compacted segment are ordered by the sort keys of this column
+            SizeT column_id = table_def_ptr->GetColIdByName(param_value);
+            if (column_id == static_cast<SizeT>(-1)) {
+                return Status::SyntaxError(fmt::format("Column {} not found in table {}", param_value, *table_def_ptr->table_name()));
+            }
+            if (const auto &def = table_def_ptr->columns()[column_id]; !SortKeyEncoder::FixedWidth(*def->type())) {
+                return Status::SyntaxError(fmt::format("{} type column {} can't be a sort key", def->type()->ToString(), def->name()));
+            }
+            table_def_ptr->set_sort_column_id(column_id);
+        } else if (param_name == "ttl_column") {
+            // the rows expire ttl seconds after the time in this column
+            SizeT column_id = table_def_ptr->GetColIdByName(param_value);
+            if (column_id == static_cast<SizeT>(-1)) {
+                return Status::SyntaxError(fmt::format("Column {} not found in table {}", param_value, *table_def_ptr->table_name()));
+            }
+            if (const auto &def = table_def_ptr->columns()[column_id];
+                def->type()->type() != LogicalType::kTimestamp && def->type()->type() != LogicalType::kDateTime) {
+                return Status::SyntaxError(fmt::format("{} type column {} can't be a ttl column", def->type()->ToString(), def->name()));
+            }
+            ttl_column_id = column_id;
+        } else if (param_name == "ttl") {
+            auto [end_ptr, ec] = std::from_chars(param_value.data(), param_value.data() + param_value.size(), ttl_seconds);
+            if (ec != std::errc() || end_ptr != param_value.data() + param_value.size() || ttl_seconds == 0) {
+                return Status::SyntaxError(fmt::format("ttl must be a positive number of seconds, got: {}", param_value));
+            }
+        } else if (param_name == "block_capacity") {
+            return Status::NotSupport(fmt::format("block_capacity can't be set, the blocks of all tables have {} rows", DEFAULT_BLOCK_CAPACITY));
         }
     }
+    if ((ttl_column_id == INVALID_COLUMN_ID) != (ttl_seconds == 0)) {
+        return Status::SyntaxError("ttl and ttl_column must be set together");
+    }
+    table_def_ptr->set_ttl(ttl_column_id, ttl_seconds);
 
     SharedPtr<LogicalNode> logical_create_table_operator = LogicalCreateTable::Make(bind_context_ptr->GetNewLogicalNodeId(),
                                                                                     schema_name_ptr,
@@ -486,6 +761,59 @@ Status LogicalPlanner::BuildCreateTable(const CreateStatement *statement, Shared
     return Status::OK();
 }
 
+Status LogicalPlanner::BuildCloneTable(const CreateStatement *statement, SharedPtr<BindContext> &bind_context_ptr) {
+    auto *create_table_info = (CreateTableInfo *)statement->create_info_.get();
+
+    switch (IdentifierValidation(create_table_info->table_name_)) {
+        case IdentifierValidationStatus::kOk:
+            break;
+        case IdentifierValidationStatus::kEmpty:
+            return Status::EmptyTableName();
+        case IdentifierValidationStatus::kExceedLimit:
+            return Status::ExceedTableNameLength(create_table_info->table_name_.length());
+        case IdentifierValidationStatus::kInvalidName: {
+            return Status::InvalidTableName(create_table_info->table_name_);
+        }
+    }
+
+    // The clone is imported by the txn that creates it, and a txn writes a single database.
+    BindSchemaName(create_table_info->clone_schema_name_);
+    if (!IsEqual(create_table_info->clone_schema_name_, create_table_info->schema_name_)) {
+        return Status::NotSupport(fmt::format("Clone table {}.{} into database {}",
+                                              create_table_info->clone_schema_name_,
+                                              create_table_info->clone_table_name_,
+                                              create_table_info->schema_name_));
+    }
+
+    Txn *txn = query_context_ptr_->GetTxn();
+    auto [source_table_entry, status] = txn->GetTableByName(create_table_info->schema_name_, create_table_info->clone_table_name_);
+    if (!status.ok()) {
+        return status;
+    }
+
+    // The clone has the columns and the properties of the source.
+    Vector<SharedPtr<ColumnDef>> columns;
+    for (const auto &column_def : source_table_entry->column_defs()) {
+        columns.emplace_back(MakeShared<ColumnDef>(*column_def));
+    }
+    SharedPtr<TableDef> table_def_ptr = TableDef::Make(MakeShared<String>("default"), MakeShared<String>(create_table_info->table_name_), columns);
+    table_def_ptr->set_segment_capacity(source_table_entry->segment_capacity());
+    table_def_ptr->set_sort_column_id(source_table_entry->sort_column_id());
+    table_def_ptr->set_ttl(source_table_entry->ttl_column_id(), source_table_entry->ttl_seconds());
+
+    SharedPtr<LogicalCreateTable> logical_create_table_operator = LogicalCreateTable::Make(bind_context_ptr->GetNewLogicalNodeId(),
+                                                                                           MakeShared<String>(create_table_info->schema_name_),
+                                                                                           table_def_ptr,
+                                                                                           bind_context_ptr->GenerateTableIndex(),
+                                                                                           create_table_info->conflict_type_);
+    logical_create_table_operator->set_clone_table_name(MakeShared<String>(create_table_info->clone_table_name_));
+
+    this->logical_plan_ = logical_create_table_operator;
+    this->names_ptr_->emplace_back("OK");
+    this->types_ptr_->emplace_back(LogicalType::kInteger);
+    return Status::OK();
+}
+
 Status LogicalPlanner::BuildCreateCollection(const CreateStatement *statement, SharedPtr<BindContext> &bind_context_ptr) {
     auto *create_collection_info = (CreateCollectionInfo *)statement->create_info_.get();
 
@@ -584,6 +912,7 @@ Status LogicalPlanner::BuildCreateIndex(const CreateStatement *statement, Shared
             fmt::format("Index {} consists of {} IndexInfo however 1 is expected", *index_name, create_index_info->index_info_list_->size())));
     }
     IndexInfo *index_info = create_index_info->index_info_list_->at(0);
+    bool pinned = index_info->index_param_list_ != nullptr && IndexBase::TakePinnedParam(*index_info->index_param_list_);
     SharedPtr<IndexBase> base_index_ptr{nullptr};
     switch (index_info->index_type_) {
         case IndexType::kFullText: {
@@ -614,17 +943,33 @@ Status LogicalPlanner::BuildCreateIndex(const CreateStatement *statement, Shared
                                                 *(index_info->index_param_list_));
             break;
         }
+        case IndexType::kIVFPQ: {
+            assert(index_info->index_param_list_ != nullptr);
+            IndexIVFPQ::ValidateColumnDataType(base_table_ref, index_info->column_name_); // may throw exception
+            base_index_ptr = IndexIVFPQ::Make(index_name,
+                                              fmt::format("{}_{}", create_index_info->table_name_, *index_name),
+                                              {index_info->column_name_},
+                                              *(index_info->index_param_list_));
+            break;
+        }
         case IndexType::kSecondary: {
             IndexSecondary::ValidateColumnDataType(base_table_ref, index_info->column_name_); // may throw exception
             base_index_ptr =
                 IndexSecondary::Make(index_name, fmt::format("{}_{}", create_index_info->table_name_, *index_name), {index_info->column_name_});
             break;
         }
+        case IndexType::kBitmap: {
+            IndexBitmap::ValidateColumnDataType(base_table_ref, index_info->column_name_); // may throw exception
+            base_index_ptr =
+                IndexBitmap::Make(index_name, fmt::format("{}_{}", create_index_info->table_name_, *index_name), {index_info->column_name_});
+            break;
+        }
         case IndexType::kInvalid: {
             UnrecoverableError("Invalid index type.");
             break;
         }
     }
+    base_index_ptr->pinned_ = pinned;
 
     auto logical_create_index_operator =
         MakeShared<LogicalCreateIndex>(bind_context_ptr->GetNewLogicalNodeId(), base_table_ref, base_index_ptr, create_index_info->conflict_type_);
@@ -794,15 +1139,49 @@ Status LogicalPlanner::BuildExport(const CopyStatement *statement, SharedPtr<Bin
         RecoverableError(status);
     }
 
-    // Check the file existence
+    switch (statement->copy_file_type_) {
+        case CopyFileType::kBVECS:
+        case CopyFileType::kIVECS:
+        case CopyFileType::kFBIN:
+        case CopyFileType::kPARQUET:
+        case CopyFileType::kARROW: {
+            RecoverableError(Status::NotSupport(fmt::format("Export {} file", *copy_file_to_str(statement->copy_file_type_))));
+            break;
+        }
+        default: {
+            break;
+        }
+    }
+    if (statement->copy_file_type_ == CopyFileType::kFVECS) {
+        if (table_entry->ColumnCount() != 1) {
+            RecoverableError(Status::NotSupport("FVECS file must have only one column."));
+        }
+        const auto &column_type = table_entry->GetColumnDefByID(0)->column_type_;
+        if (column_type->type() != LogicalType::kEmbedding ||
+            static_cast<EmbeddingInfo *>(column_type->type_info().get())->Type() != kElemFloat) {
+            RecoverableError(Status::NotSupport("FVECS file must have only one embedding column with float element."));
+        }
+    }
+    for (const auto &column_def : table_entry->column_defs()) {
+        const auto &column_type = column_def->column_type_;
+        if (column_type->type() == LogicalType::kEmbedding &&
+            static_cast<EmbeddingInfo *>(column_type->type_info().get())->Type() == kElemBit) {
+            RecoverableError(Status::NotSupport(fmt::format("Export bit embedding column: {}", column_def->name_)));
+        }
+    }
+
+    // The file will be created or truncated, check the directory of the file
     LocalFileSystem fs;
 
-    String to_write_path;
-    if (!fs.Exists(statement->file_path_)) {
-        RecoverableError(Status::FileNotFound(statement->file_path_));
+    String to_write_dir = Path(statement->file_path_).parent_path().string();
+    if (!to_write_dir.empty() && !fs.Exists(to_write_dir)) {
+        RecoverableError(Status::FileNotFound(to_write_dir));
     }
 
+    SharedPtr<BlockIndex> block_index = table_entry->GetBlockIndex(txn->BeginTS());
     SharedPtr<LogicalNode> logical_export = MakeShared<LogicalExport>(bind_context_ptr->GetNewLogicalNodeId(),
+                                                                      table_entry,
+                                                                      std::move(block_index),
                                                                       statement->schema_name_,
                                                                       statement->table_name_,
                                                                       statement->file_path_,
@@ -877,6 +1256,13 @@ Status LogicalPlanner::BuildCommand(const CommandStatement *statement, SharedPtr
             this->logical_plan_ = logical_command;
             break;
         }
+        case CommandType::kKillQuery: {
+            SharedPtr<LogicalNode> logical_command =
+                MakeShared<LogicalCommand>(bind_context_ptr->GetNewLogicalNodeId(), std::move(command_statement->command_info_));
+
+            this->logical_plan_ = logical_command;
+            break;
+        }
         case CommandType::kCheckTable: {
             CheckTable *check_table = (CheckTable *)(command_statement->command_info_.get());
             auto [table_entry, status] = txn->GetTableByName(query_context_ptr_->schema_name(), check_table->table_name());
@@ -905,6 +1291,21 @@ Status LogicalPlanner::BuildCommand(const CommandStatement *statement, SharedPtr
             this->logical_plan_ = logical_command;
             break;
         }
+        case CommandType::kWarmup: {
+            auto *warmup_cmd = static_cast<WarmupCmd *>(command_statement->command_info_.get());
+            BindSchemaName(warmup_cmd->schema_name_);
+
+            Txn *txn = query_context_ptr_->GetTxn();
+            auto [table_entry, status] = txn->GetTableByName(warmup_cmd->schema_name_, warmup_cmd->table_name_);
+            if (!status.ok()) {
+                RecoverableError(status);
+            }
+            auto logical_command = MakeShared<LogicalCommand>(bind_context_ptr->GetNewLogicalNodeId(), std::move(command_statement->command_info_));
+            logical_command->table_entry_ = table_entry;
+
+            this->logical_plan_ = logical_command;
+            break;
+        }
         default: {
             UnrecoverableError("Invalid command type.");
         }
@@ -946,6 +1347,12 @@ Status LogicalPlanner::BuildShow(ShowStatement *statement, SharedPtr<BindContext
         case ShowStmtType::kProfiles: {
             return BuildShowProfiles(statement, bind_context_ptr);
         }
+        case ShowStmtType::kSlowQueries: {
+            return BuildShowSlowQueries(statement, bind_context_ptr);
+        }
+        case ShowStmtType::kQueries: {
+            return BuildShowQueries(statement, bind_context_ptr);
+        }
         case ShowStmtType::kSegments: {
             return BuildShowSegments(statement, bind_context_ptr);
         }
@@ -994,6 +1401,26 @@ Status LogicalPlanner::BuildShowProfiles(const ShowStatement *statement, SharedP
     return Status::OK();
 }
 
+Status LogicalPlanner::BuildShowSlowQueries(const ShowStatement *statement, SharedPtr<BindContext> &bind_context_ptr) {
+    SharedPtr<LogicalNode> logical_show = MakeShared<LogicalShow>(bind_context_ptr->GetNewLogicalNodeId(),
+                                                                  ShowType::kShowSlowQueries,
+                                                                  statement->schema_name_,
+                                                                  statement->table_name_,
+                                                                  bind_context_ptr->GenerateTableIndex());
+    this->logical_plan_ = logical_show;
+    return Status::OK();
+}
+
+Status LogicalPlanner::BuildShowQueries(const ShowStatement *statement, SharedPtr<BindContext> &bind_context_ptr) {
+    SharedPtr<LogicalNode> logical_show = MakeShared<LogicalShow>(bind_context_ptr->GetNewLogicalNodeId(),
+                                                                  ShowType::kShowQueries,
+                                                                  statement->schema_name_,
+                                                                  statement->table_name_,
+                                                                  bind_context_ptr->GenerateTableIndex());
+    this->logical_plan_ = logical_show;
+    return Status::OK();
+}
+
 Status LogicalPlanner::BuildShowIndexes(const ShowStatement *statement, SharedPtr<BindContext> &bind_context_ptr) {
     SharedPtr<LogicalNode> logical_show = MakeShared<LogicalShow>(bind_context_ptr->GetNewLogicalNodeId(),
                                                                   ShowType::kShowIndexes,
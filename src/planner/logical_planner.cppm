@@ -56,12 +56,18 @@ public:
 
     Status BuildSelect(const SelectStatement *statement, SharedPtr<BindContext> &bind_context_ptr);
 
+    // Set operations of a chain of selects, only UNION ALL is supported.
+    Status BuildSetOperation(const SelectStatement *statement, SharedPtr<BindContext> &bind_context_ptr);
+
     Status BuildInsert(InsertStatement *statement, SharedPtr<BindContext> &bind_context_ptr);
 
     Status BuildInsertValue(const InsertStatement *statement, SharedPtr<BindContext> &bind_context_ptr);
 
     Status BuildInsertSelect(const InsertStatement *statement, SharedPtr<BindContext> &bind_context_ptr);
 
+    // the rows of InsertStatement::column_data_, in data blocks of the table columns
+    Status BuildInsertColumnar(const InsertStatement *statement, SharedPtr<BindContext> &bind_context_ptr);
+
     // Update operator
     Status BuildUpdate(const UpdateStatement *statement, SharedPtr<BindContext> &bind_context_ptr);
 
@@ -75,6 +81,8 @@ public:
 
     Status BuildCreateTable(const CreateStatement *statement, SharedPtr<BindContext> &bind_context_ptr);
 
+    Status BuildCloneTable(const CreateStatement *statement, SharedPtr<BindContext> &bind_context_ptr);
+
     Status BuildCreateCollection(const CreateStatement *statement, SharedPtr<BindContext> &bind_context_ptr);
 
     Status BuildCreateView(const CreateStatement *statement, SharedPtr<BindContext> &bind_context_ptr);
@@ -140,6 +148,10 @@ public:
 
     Status BuildShowProfiles(const ShowStatement *statement, SharedPtr<BindContext> &bind_context_ptr);
 
+    Status BuildShowSlowQueries(const ShowStatement *statement, SharedPtr<BindContext> &bind_context_ptr);
+
+    Status BuildShowQueries(const ShowStatement *statement, SharedPtr<BindContext> &bind_context_ptr);
+
     Status BuildShowSessionStatus(const ShowStatement *statement, SharedPtr<BindContext> &bind_context_ptr);
 
     Status BuildShowGlobalStatus(const ShowStatement *statement, SharedPtr<BindContext> &bind_context_ptr);
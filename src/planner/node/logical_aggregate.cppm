@@ -25,6 +25,7 @@ import base_expression;
 import base_table_ref;
 import internal_types;
 import data_type;
+import statistics_aggregate;
 
 namespace infinity {
 
@@ -56,6 +57,9 @@ public:
     u64 aggregate_index_{};
 
     SharedPtr<BaseTableRef> base_table_ref_;
+
+    // set by AggregateStatisticsPushDown, one for each aggregate, the table scan below answers them for the blocks it can
+    Vector<StatisticsAggregate> statistics_aggregates_{};
 };
 
 } // namespace infinity
@@ -104,6 +104,17 @@ String LogicalCommand::ToString(i64 &space) const {
             ss << String(space, ' ') << arrow_str << "Compact table: " << compact_table_info->schema_name_ << " " << compact_table_info->table_name_;
             break;
         }
+        case CommandType::kWarmup: {
+            WarmupCmd *warmup_info = (WarmupCmd *)(command_info_.get());
+            ss << String(space, ' ') << arrow_str << "Warmup: " << warmup_info->schema_name_ << " " << warmup_info->table_name_ << " "
+               << warmup_info->index_name_;
+            break;
+        }
+        case CommandType::kKillQuery: {
+            KillQueryCmd *kill_query_info = (KillQueryCmd *)(command_info_.get());
+            ss << String(space, ' ') << arrow_str << "Kill query: " << kill_query_info->query_id_;
+            break;
+        }
         case CommandType::kInvalid: {
             UnrecoverableError("Invalid command type.");
         }
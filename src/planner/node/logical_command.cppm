@@ -47,7 +47,7 @@ public:
     inline String name() final { return "LogicalCommand"; }
 
 public:
-    TableEntry *table_entry_ = nullptr; // only used for compact command
+    TableEntry *table_entry_ = nullptr; // only used for compact and warmup commands
 
 private:
     SharedPtr<CommandInfo> command_info_{};
@@ -48,6 +48,9 @@ String LogicalCreateTable::ToString(i64 &space) const {
         arrow_str = "->  ";
     }
     ss << String(space, ' ') << arrow_str << "Create Table: " << *schema_name_ << "." << table_definition_->ToString();
+    if (clone_table_name_.get() != nullptr) {
+        ss << " Clone: " << *clone_table_name_;
+    }
     space += arrow_str.size();
 
     return ss.str();
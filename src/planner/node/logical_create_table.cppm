@@ -57,11 +57,17 @@ public:
 
     inline ConflictType conflict_type() const { return conflict_type_; }
 
+    [[nodiscard]] const SharedPtr<String> &clone_table_name() const { return clone_table_name_; }
+
+    void set_clone_table_name(SharedPtr<String> clone_table_name) { clone_table_name_ = std::move(clone_table_name); }
+
 private:
     SharedPtr<String> schema_name_{};
     SharedPtr<TableDef> table_definition_{};
     u64 table_index_{};
     ConflictType conflict_type_{ConflictType::kInvalid};
+    // The table of which the data files are shared by the new table, null if not a clone.
+    SharedPtr<String> clone_table_name_{};
 };
 
 } // namespace infinity
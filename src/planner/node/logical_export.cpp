@@ -59,6 +59,26 @@ String LogicalExport::ToString(i64 &space) const {
             ss << "(JSONL) ";
             break;
         }
+        case CopyFileType::kBVECS: {
+            ss << "(BVECS) ";
+            break;
+        }
+        case CopyFileType::kIVECS: {
+            ss << "(IVECS) ";
+            break;
+        }
+        case CopyFileType::kFBIN: {
+            ss << "(FBIN) ";
+            break;
+        }
+        case CopyFileType::kPARQUET: {
+            ss << "(PARQUET) ";
+            break;
+        }
+        case CopyFileType::kARROW: {
+            ss << "(ARROW) ";
+            break;
+        }
         case CopyFileType::kInvalid: {
             ss << "(Invalid) ";
             break;
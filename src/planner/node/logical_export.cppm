@@ -23,14 +23,25 @@ import logical_node;
 import data_type;
 import internal_types;
 import statement_common;
+import table_entry;
+import block_index;
 
 namespace infinity {
 
 export class LogicalExport : public LogicalNode {
 public:
-    explicit LogicalExport(u64 node_id, String schema_name, String table_name, String file_path, bool header, char delimiter, CopyFileType type)
-        : LogicalNode(node_id, LogicalNodeType::kExport), schema_name_(std::move(schema_name)), table_name_(std::move(table_name)),
-          file_path_(std::move(file_path)), header_(header), delimiter_(delimiter), file_type_(type) {}
+    explicit LogicalExport(u64 node_id,
+                           TableEntry *table_entry,
+                           SharedPtr<BlockIndex> block_index,
+                           String schema_name,
+                           String table_name,
+                           String file_path,
+                           bool header,
+                           char delimiter,
+                           CopyFileType type)
+        : LogicalNode(node_id, LogicalNodeType::kExport), table_entry_(table_entry), block_index_(std::move(block_index)),
+          schema_name_(std::move(schema_name)), table_name_(std::move(table_name)), file_path_(std::move(file_path)), header_(header),
+          delimiter_(delimiter), file_type_(type) {}
 
     [[nodiscard]] Vector<ColumnBinding> GetColumnBindings() const final;
 
@@ -44,6 +55,10 @@ public:
 
     [[nodiscard]] CopyFileType FileType() const { return file_type_; }
 
+    [[nodiscard]] inline TableEntry *table_entry() const { return table_entry_; }
+
+    [[nodiscard]] inline const SharedPtr<BlockIndex> &block_index() const { return block_index_; }
+
     [[nodiscard]] inline const String &schema_name() const { return schema_name_; }
 
     [[nodiscard]] inline const String &table_name() const { return table_name_; }
@@ -55,6 +70,8 @@ public:
     [[nodiscard]] char delimiter() const { return delimiter_; }
 
 private:
+    TableEntry *table_entry_{};
+    SharedPtr<BlockIndex> block_index_{};
     String schema_name_{"default"};
     String table_name_{};
     String file_path_{};
@@ -46,6 +46,8 @@ public:
     inline String name() final { return "LogicalFusion"; }
 
     SharedPtr<FusionExpression> fusion_expr_{};
+    // The rerank reads the embeddings of the fused rows from the table
+    SharedPtr<BaseTableRef> base_table_ref_{};
 };
 
 } // namespace infinity
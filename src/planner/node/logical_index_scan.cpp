@@ -31,6 +31,12 @@ import function_expression;
 import cast_expression;
 import column_expression;
 import logical_type;
+import table_entry;
+import table_index_entry;
+import index_base;
+import create_index_info;
+import secondary_index_scan_execute_expression;
+import internal_types;
 
 namespace infinity {
 
@@ -39,7 +45,7 @@ LogicalIndexScan::LogicalIndexScan(u64 node_id,
                                    SharedPtr<BaseExpression> &&index_filter_qualified,
                                    HashMap<ColumnID, TableIndexEntry *> &&column_index_map,
                                    Vector<FilterExecuteElem> &&filter_execute_command,
-                                   UniquePtr<FastRoughFilterEvaluator> &&fast_rough_filter_evaluator,
+                                   SharedPtr<FastRoughFilterEvaluator> fast_rough_filter_evaluator,
                                    bool add_row_id)
     : LogicalNode(node_id, LogicalNodeType::kIndexScan), base_table_ref_(std::move(base_table_ref)),
       index_filter_qualified_(std::move(index_filter_qualified)), column_index_map_(std::move(column_index_map)),
@@ -72,6 +78,42 @@ SharedPtr<Vector<SharedPtr<DataType>>> LogicalIndexScan::GetOutputTypes() const
     return result_types;
 }
 
+Optional<ColumnID> LogicalIndexScan::CoverableColumn() const {
+    Optional<ColumnID> column_id;
+    for (const auto &elem : filter_execute_command_) {
+        if (!std::holds_alternative<FilterExecuteSingleRange>(elem)) {
+            continue;
+        }
+        ColumnID range_column_id = std::get<FilterExecuteSingleRange>(elem).GetColumnID();
+        if (column_id.has_value() && *column_id != range_column_id) {
+            return None;
+        }
+        column_id = range_column_id;
+    }
+    if (!column_id.has_value()) {
+        return None;
+    }
+    if (column_index_map_.at(*column_id)->index_base()->index_type_ != IndexType::kSecondary) {
+        return None;
+    }
+    // the key of a varchar is a prefix, the keys of datetime and timestamp are epoch times
+    switch (base_table_ref_->table_entry_ptr_->GetColumnDefByID(*column_id)->type()->type()) {
+        case LogicalType::kTinyInt:
+        case LogicalType::kSmallInt:
+        case LogicalType::kInteger:
+        case LogicalType::kBigInt:
+        case LogicalType::kFloat:
+        case LogicalType::kDouble:
+        case LogicalType::kDate:
+        case LogicalType::kTime: {
+            return column_id;
+        }
+        default: {
+            return None;
+        }
+    }
+}
+
 TableEntry *LogicalIndexScan::table_collection_ptr() const { return base_table_ref_->table_entry_ptr_; }
 
 String LogicalIndexScan::TableAlias() const { return base_table_ref_->alias_; }
@@ -39,7 +39,7 @@ public:
                               SharedPtr<BaseExpression> &&index_filter_qualified,
                               HashMap<ColumnID, TableIndexEntry *> &&column_index_map,
                               Vector<FilterExecuteElem> &&filter_execute_command,
-                              UniquePtr<FastRoughFilterEvaluator> &&fast_rough_filter_evaluator,
+                              SharedPtr<FastRoughFilterEvaluator> fast_rough_filter_evaluator,
                               bool add_row_id = true);
 
     [[nodiscard]] Vector<ColumnBinding> GetColumnBindings() const final;
@@ -58,6 +58,10 @@ public:
 
     inline String name() final { return "LogicalIndexScan"; }
 
+    // The column whose values the scan can output from the keys of its secondary index, without loading the data blocks:
+    // all the ranges of the filter are on it, and its ordered key is the value itself. None otherwise.
+    [[nodiscard]] Optional<ColumnID> CoverableColumn() const;
+
     SharedPtr<BaseTableRef> base_table_ref_{};
 
     // filter expression is constructed with fundamental expression "[cast] x compare (value expression)" and conjunction "and", "or" and "not"
@@ -66,7 +70,13 @@ public:
     // Commands used in PhysicalIndexScan::ExecuteInternal()
     Vector<FilterExecuteElem> filter_execute_command_;
 
-    UniquePtr<FastRoughFilterEvaluator> fast_rough_filter_evaluator_;
+    SharedPtr<FastRoughFilterEvaluator> fast_rough_filter_evaluator_;
+
+    // set by LazyLoad when the scan outputs this column from the index keys, it is the only column of base_table_ref_
+    Optional<ColumnID> covered_column_id_{};
+
+    // set by LimitPushDown when the scan is right under a LIMIT: each task stops after so many rows
+    Optional<SizeT> row_limit_{};
 
     bool add_row_id_;
 };
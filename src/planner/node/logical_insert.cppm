@@ -25,6 +25,7 @@ import base_expression;
 import table_entry;
 import internal_types;
 import data_type;
+import data_block;
 
 namespace infinity {
 
@@ -35,6 +36,11 @@ public:
         : LogicalNode(node_id, LogicalNodeType::kInsert), table_entry_(table_collection_ptr), value_list_(std::move(value_list)),
           table_index_(table_index){};
 
+    // the columnar insert, whose rows come already in blocks of the table columns
+    explicit inline LogicalInsert(u64 node_id, TableEntry *table_collection_ptr, u64 table_index, Vector<SharedPtr<DataBlock>> data_blocks)
+        : LogicalNode(node_id, LogicalNodeType::kInsert), table_entry_(table_collection_ptr), table_index_(table_index),
+          data_blocks_(std::move(data_blocks)){};
+
     [[nodiscard]] Vector<ColumnBinding> GetColumnBindings() const final;
 
     [[nodiscard]] SharedPtr<Vector<String>> GetOutputNames() const final;
@@ -57,6 +63,8 @@ public:
 
     [[nodiscard]] inline u64 table_index() const { return table_index_; }
 
+    [[nodiscard]] inline const Vector<SharedPtr<DataBlock>> &data_blocks() const { return data_blocks_; }
+
 public:
     static bool NeedCastInInsert(const DataType &from, const DataType &to) {
         if (from.type() == to.type()) {
@@ -75,6 +83,7 @@ private:
     TableEntry *table_entry_{};
     Vector<Vector<SharedPtr<BaseExpression>>> value_list_{};
     u64 table_index_{};
+    Vector<SharedPtr<DataBlock>> data_blocks_{};
 };
 
 } // namespace infinity
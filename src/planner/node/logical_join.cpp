@@ -25,9 +25,25 @@ import column_binding;
 import logical_node_type;
 import base_expression;
 import internal_types;
+import default_values;
 
 namespace infinity {
 
+namespace {
+
+// The row id column appended to the scan output by lazy load has no binding. Pad the bindings of the child,
+// so that the index of a binding is the same as the index of its column in the join output.
+void AppendChildBindings(Vector<ColumnBinding> &result_binding, const SharedPtr<LogicalNode> &child) {
+    Vector<ColumnBinding> child_binding = child->GetColumnBindings();
+    SizeT child_column_count = child->GetOutputTypes()->size();
+    result_binding.insert(result_binding.end(), child_binding.begin(), child_binding.end());
+    for (SizeT idx = child_binding.size(); idx < child_column_count; ++idx) {
+        result_binding.emplace_back(std::numeric_limits<SizeT>::max(), COLUMN_IDENTIFIER_ROW_ID);
+    }
+}
+
+} // namespace
+
 LogicalJoin::LogicalJoin(u64 node_id,
                          JoinType join_type,
                          String alias,
@@ -44,10 +60,17 @@ Vector<ColumnBinding> LogicalJoin::GetColumnBindings() const {
     if (join_type_ == JoinType::kMark) {
         result_binding.emplace_back(mark_index_, 0);
     }
-    Vector<ColumnBinding> left_binding = this->left_node_->GetColumnBindings();
-    Vector<ColumnBinding> right_binding = this->right_node_->GetColumnBindings();
-    result_binding.insert(result_binding.end(), left_binding.begin(), left_binding.end());
-    result_binding.insert(result_binding.end(), right_binding.begin(), right_binding.end());
+    AppendChildBindings(result_binding, this->left_node_);
+    if (!OutputsLeftOnly()) {
+        AppendChildBindings(result_binding, this->right_node_);
+    }
+    return result_binding;
+}
+
+Vector<ColumnBinding> LogicalJoin::GetInputBindings() const {
+    Vector<ColumnBinding> result_binding;
+    AppendChildBindings(result_binding, this->left_node_);
+    AppendChildBindings(result_binding, this->right_node_);
     return result_binding;
 }
 
@@ -59,6 +82,9 @@ SharedPtr<Vector<String>> LogicalJoin::GetOutputNames() const {
     for (auto &name_str : *left_output_names) {
         result->emplace_back(name_str);
     }
+    if (OutputsLeftOnly()) {
+        return result;
+    }
 
     for (auto &name_str : *right_output_names) {
         result->emplace_back(name_str);
@@ -75,6 +101,9 @@ SharedPtr<Vector<SharedPtr<DataType>>> LogicalJoin::GetOutputTypes() const {
     for (auto &name_str : *left_output_names) {
         result->emplace_back(name_str);
     }
+    if (OutputsLeftOnly()) {
+        return result;
+    }
 
     for (auto &name_str : *right_output_names) {
         result->emplace_back(name_str);
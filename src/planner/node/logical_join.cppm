@@ -42,6 +42,11 @@ public:
 
     [[nodiscard]] SharedPtr<Vector<SharedPtr<DataType>>> GetOutputTypes() const final;
 
+    // The columns of both inputs, which the conditions read. A semi or anti join only outputs the columns of the left input.
+    [[nodiscard]] Vector<ColumnBinding> GetInputBindings() const;
+
+    [[nodiscard]] inline bool OutputsLeftOnly() const { return join_type_ == JoinType::kSemi || join_type_ == JoinType::kAnti; }
+
     String ToString(i64 &space) const final;
 
     inline String name() final { return "LogicalJoin"; }
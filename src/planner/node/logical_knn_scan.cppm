@@ -57,7 +57,7 @@ public:
 
     SharedPtr<BaseExpression> filter_expression_{};
 
-    UniquePtr<FastRoughFilterEvaluator> fast_rough_filter_evaluator_;
+    SharedPtr<FastRoughFilterEvaluator> fast_rough_filter_evaluator_;
 
     u64 knn_table_index_{};
 };
@@ -106,6 +106,13 @@ String LogicalMatch::ToString(i64 &space) const {
     match_info += " - match info: " + match_expr_->ToString();
     ss << match_info << std::endl;
 
+    // filter expression
+    if (filter_expression_.get() != nullptr) {
+        String filter_str = String(space, ' ');
+        filter_str += " - filter: " + filter_expression_->ToString();
+        ss << filter_str << std::endl;
+    }
+
     // Output columns
     String output_columns = String(space, ' ');
     output_columns += " - output columns: [";
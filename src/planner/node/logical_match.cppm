@@ -21,11 +21,13 @@ import logical_node_type;
 import column_binding;
 import logical_node;
 
+import base_expression;
 import match_expression;
 import base_table_ref;
 import table_entry;
 import internal_types;
 import data_type;
+import fast_rough_filter;
 
 namespace infinity {
 
@@ -51,6 +53,14 @@ public:
 
     SharedPtr<BaseTableRef> base_table_ref_{};
     SharedPtr<MatchExpression> match_expr_{};
+
+    // the WHERE conditions of the SEARCH, the rows failing them are skipped before scoring
+    SharedPtr<BaseExpression> filter_expression_{};
+
+    // set by LimitPushDown, the rows of the LIMIT above the match when fewer than its topn option
+    Optional<u32> limit_top_n_{};
+
+    SharedPtr<FastRoughFilterEvaluator> fast_rough_filter_evaluator_;
 };
 
 } // namespace infinity
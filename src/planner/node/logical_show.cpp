@@ -48,6 +48,10 @@ String ToString(ShowType type) {
             return "Show configs";
         case ShowType::kShowProfiles:
             return "Show profiles";
+        case ShowType::kShowSlowQueries:
+            return "Show slow queries";
+        case ShowType::kShowQueries:
+            return "Show queries";
         case ShowType::kShowSegments:
             return "Show segments";
         case ShowType::kShowSegment:
@@ -36,6 +36,8 @@ export enum class ShowType {
     kShowColumn,
     kShowConfigs,
     kShowProfiles,
+    kShowSlowQueries,
+    kShowQueries,
     kShowIndexes,
     kShowSegments,
     kShowSegment,
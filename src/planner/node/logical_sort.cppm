@@ -24,13 +24,18 @@ import data_type;
 import base_expression;
 import internal_types;
 import select_statement;
+import base_table_ref;
 
 namespace infinity {
 
 export class LogicalSort : public LogicalNode {
 public:
-    inline LogicalSort(u64 node_id, Vector<SharedPtr<BaseExpression>> expressions, Vector<OrderType> order_by_types)
-        : LogicalNode(node_id, LogicalNodeType::kSort), expressions_(std::move(expressions)), order_by_types_(std::move(order_by_types)) {}
+    inline LogicalSort(u64 node_id,
+                       SharedPtr<BaseTableRef> base_table_ref,
+                       Vector<SharedPtr<BaseExpression>> expressions,
+                       Vector<OrderType> order_by_types)
+        : LogicalNode(node_id, LogicalNodeType::kSort), base_table_ref_(std::move(base_table_ref)), expressions_(std::move(expressions)),
+          order_by_types_(std::move(order_by_types)) {}
 
     [[nodiscard]] Vector<ColumnBinding> GetColumnBindings() const final;
 
@@ -42,6 +47,8 @@ public:
 
     inline String name() final { return "LogicalSort"; }
 
+    // Table of the lazily loaded columns, which are loaded after the rows are merged in parallel sort.
+    SharedPtr<BaseTableRef> base_table_ref_{};
     Vector<SharedPtr<BaseExpression>> expressions_{};
     Vector<OrderType> order_by_types_{};
 };
@@ -0,0 +1,53 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <sstream>
+
+module logical_union;
+
+import stl;
+import column_binding;
+import logical_node_type;
+
+import internal_types;
+
+namespace infinity {
+
+LogicalUnion::LogicalUnion(u64 node_id, const SharedPtr<LogicalNode> &left, const SharedPtr<LogicalNode> &right)
+    : LogicalNode(node_id, LogicalNodeType::kUnion) {
+    this->set_left_node(left);
+    this->set_right_node(right);
+}
+
+Vector<ColumnBinding> LogicalUnion::GetColumnBindings() const { return this->left_node_->GetColumnBindings(); }
+
+SharedPtr<Vector<String>> LogicalUnion::GetOutputNames() const { return this->left_node_->GetOutputNames(); }
+
+SharedPtr<Vector<SharedPtr<DataType>>> LogicalUnion::GetOutputTypes() const { return this->left_node_->GetOutputTypes(); }
+
+String LogicalUnion::ToString(i64 &space) const {
+    std::stringstream ss;
+    String arrow_str;
+    if (space > 3) {
+        space -= 4;
+        arrow_str = "->  ";
+    }
+    ss << String(space, ' ') << arrow_str << "Union All: ";
+    space += arrow_str.size();
+    return ss.str();
+}
+
+} // namespace infinity
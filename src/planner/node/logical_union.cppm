@@ -0,0 +1,45 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module logical_union;
+
+import stl;
+import logical_node_type;
+import column_binding;
+import logical_node;
+import data_type;
+import internal_types;
+
+namespace infinity {
+
+// UNION ALL of two inputs with the same output types. A chain of UNION ALL is a left deep tree of LogicalUnion,
+// the output names and column bindings are those of the leftmost input.
+export class LogicalUnion : public LogicalNode {
+public:
+    explicit LogicalUnion(u64 node_id, const SharedPtr<LogicalNode> &left, const SharedPtr<LogicalNode> &right);
+
+    [[nodiscard]] Vector<ColumnBinding> GetColumnBindings() const final;
+
+    [[nodiscard]] SharedPtr<Vector<String>> GetOutputNames() const final;
+
+    [[nodiscard]] SharedPtr<Vector<SharedPtr<DataType>>> GetOutputTypes() const final;
+
+    String ToString(i64 &space) const final;
+
+    inline String name() final { return "LogicalUnion"; }
+};
+
+} // namespace infinity
@@ -22,6 +22,10 @@ import column_pruner;
 import lazy_load;
 import secondary_index_scan_builder;
 import apply_fast_rough_filter;
+import predicate_push_down;
+import join_order_optimizer;
+import limit_push_down;
+import aggregate_statistics_push_down;
 import explain_logical_plan;
 import optimizer_rule;
 import bound_delete_statement;
@@ -37,8 +41,13 @@ namespace infinity {
 
 Optimizer::Optimizer(QueryContext *query_context_ptr) : query_context_ptr_(query_context_ptr) {
     // TODO: need an equivalent expression optimizer
-    AddRule(MakeUnique<ApplyFastRoughFilter>());      // put it before SecondaryIndexScanBuilder
-    AddRule(MakeUnique<SecondaryIndexScanBuilder>()); // put it before ColumnPruner
+    AddRule(MakeUnique<PredicatePushDown>());           // put it before ApplyFastRoughFilter, filters pushed to the scans use it too
+    AddRule(MakeUnique<JoinOrderOptimizer>());          // put it after PredicatePushDown, the rows of the join inputs are filtered
+    AddRule(MakeUnique<ApplyFastRoughFilter>());        // put it before SecondaryIndexScanBuilder
+    AddRule(MakeUnique<SecondaryIndexScanBuilder>());   // put it before ColumnPruner
+    AddRule(MakeUnique<ConjunctReorder>());             // put it after SecondaryIndexScanBuilder, which takes the index conjuncts
+    AddRule(MakeUnique<LimitPushDown>());               // put it after SecondaryIndexScanBuilder, which builds the index scans
+    AddRule(MakeUnique<AggregateStatisticsPushDown>()); // put it after SecondaryIndexScanBuilder, the scans kept are table scans
     AddRule(MakeUnique<ColumnPruner>());
     AddRule(MakeUnique<LazyLoad>());
     AddRule(MakeUnique<ColumnRemapper>());
@@ -0,0 +1,121 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+module aggregate_statistics_push_down;
+
+import stl;
+import logical_node;
+import logical_node_type;
+import logical_aggregate;
+import logical_table_scan;
+import query_context;
+import base_expression;
+import column_expression;
+import aggregate_expression;
+import expression_type;
+import statistics_aggregate;
+import logical_type;
+
+namespace infinity {
+
+namespace {
+
+// The types whose min and max the minmax filter keeps exactly, and the merge of the partial aggregates handles
+bool IsStatisticsMinMaxType(LogicalType type) {
+    switch (type) {
+        case LogicalType::kTinyInt:
+        case LogicalType::kSmallInt:
+        case LogicalType::kInteger:
+        case LogicalType::kBigInt:
+        case LogicalType::kFloat:
+        case LogicalType::kDouble: {
+            return true;
+        }
+        default: {
+            return false;
+        }
+    }
+}
+
+class AggregateStatisticsPushDownMethod {
+public:
+    void VisitNode(const SharedPtr<LogicalNode> &op) {
+        if (op.get() == nullptr) {
+            return;
+        }
+        if (op->operator_type() == LogicalNodeType::kAggregate) {
+            PushDown(static_cast<LogicalAggregate &>(*op));
+        }
+        VisitNode(op->left_node());
+        VisitNode(op->right_node());
+    }
+
+private:
+    static void PushDown(LogicalAggregate &aggregate) {
+        if (!aggregate.groups_.empty() || aggregate.aggregates_.empty()) {
+            return;
+        }
+        LogicalNode *input = aggregate.left_node().get();
+        bool has_filter = input->operator_type() == LogicalNodeType::kFilter;
+        if (has_filter) {
+            input = input->left_node().get();
+        }
+        if (input->operator_type() != LogicalNodeType::kTableScan) {
+            return;
+        }
+        auto &table_scan = static_cast<LogicalTableScan &>(*input);
+        if (has_filter && table_scan.fast_rough_filter_evaluator_.get() == nullptr) {
+            // no block could be shown to pass the filter
+            return;
+        }
+
+        Vector<StatisticsAggregate> statistics_aggregates;
+        statistics_aggregates.reserve(aggregate.aggregates_.size());
+        for (const auto &expression : aggregate.aggregates_) {
+            if (expression->type() != ExpressionType::kAggregate || expression->arguments().size() != 1 ||
+                expression->arguments()[0]->type() != ExpressionType::kColumn) {
+                return;
+            }
+            const auto &argument = static_cast<const ColumnExpression &>(*expression->arguments()[0]);
+            if (argument.binding().table_idx != table_scan.TableIndex()) {
+                return;
+            }
+            StatisticsAggregate statistics_aggregate;
+            statistics_aggregate.column_id_ = argument.binding().column_idx;
+            const String function_name = static_cast<const AggregateExpression &>(*expression).aggregate_function_.GetFuncName();
+            if (function_name == "COUNT") {
+                // count(*) is bound as the count of the first column, the rows are counted whatever their values
+                statistics_aggregate.type_ = StatisticsAggregateType::kCount;
+            } else if (function_name == "MIN" && IsStatisticsMinMaxType(argument.Type().type())) {
+                statistics_aggregate.type_ = StatisticsAggregateType::kMin;
+            } else if (function_name == "MAX" && IsStatisticsMinMaxType(argument.Type().type())) {
+                statistics_aggregate.type_ = StatisticsAggregateType::kMax;
+            } else {
+                return;
+            }
+            statistics_aggregates.push_back(statistics_aggregate);
+        }
+        aggregate.statistics_aggregates_ = std::move(statistics_aggregates);
+    }
+};
+
+} // namespace
+
+void AggregateStatisticsPushDown::ApplyToPlan(QueryContext *, SharedPtr<LogicalNode> &logical_plan) {
+    AggregateStatisticsPushDownMethod().VisitNode(logical_plan);
+}
+
+} // namespace infinity
@@ -0,0 +1,39 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module aggregate_statistics_push_down;
+
+import stl;
+import logical_node;
+import query_context;
+import optimizer_rule;
+
+namespace infinity {
+
+// Lets the table scan below an aggregate without group by answer COUNT, MIN and MAX of numeric columns from the metadata of a
+// block: its row count when all its rows are visible, the min and max of its minmax filter when the filter was built after the
+// last change of the block. With a filter, only the blocks whose minmax filter shows that every row passes are answered, the
+// others are still read and aggregated, the ones ruled out are skipped as before.
+export class AggregateStatisticsPushDown final : public OptimizerRule {
+public:
+    ~AggregateStatisticsPushDown() final = default;
+
+    void ApplyToPlan(QueryContext *query_context_ptr, SharedPtr<LogicalNode> &logical_plan) final;
+
+    String name() const final { return "Aggregate Statistics Push Down"; }
+};
+
+} // namespace infinity
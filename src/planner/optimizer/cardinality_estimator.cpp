@@ -0,0 +1,288 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <algorithm>
+
+module cardinality_estimator;
+
+import stl;
+import logical_node;
+import logical_node_type;
+import logical_table_scan;
+import logical_filter;
+import logical_join;
+import join_reference;
+import base_expression;
+import expression_type;
+import function_expression;
+import column_expression;
+import value_expression;
+import in_expression;
+import column_binding;
+import column_statistics;
+import query_context;
+import table_entry;
+import txn;
+import value;
+import logical_type;
+import internal_types;
+
+namespace infinity {
+
+namespace {
+
+constexpr f64 kEqualSelectivity = 0.1;
+constexpr f64 kRangeSelectivity = 0.33;
+constexpr f64 kDefaultSelectivity = 0.5;
+
+// The column compared by a predicate, through the casts added by the binder
+const ColumnExpression *ComparedColumn(const SharedPtr<BaseExpression> &expression) {
+    const BaseExpression *current = expression.get();
+    while (current->type() == ExpressionType::kCast) {
+        current = current->arguments()[0].get();
+    }
+    if (current->type() != ExpressionType::kColumn) {
+        return nullptr;
+    }
+    const auto *column_expression = static_cast<const ColumnExpression *>(current);
+    return column_expression->depth() == 0 ? column_expression : nullptr;
+}
+
+Optional<f64> NumericConstant(const SharedPtr<BaseExpression> &expression) {
+    if (expression->type() != ExpressionType::kValue) {
+        return None;
+    }
+    const Value &value = static_cast<const ValueExpression &>(*expression).GetValue();
+    switch (value.type().type()) {
+        case LogicalType::kTinyInt: {
+            return value.GetValue<TinyIntT>();
+        }
+        case LogicalType::kSmallInt: {
+            return value.GetValue<SmallIntT>();
+        }
+        case LogicalType::kInteger: {
+            return value.GetValue<IntegerT>();
+        }
+        case LogicalType::kBigInt: {
+            return static_cast<f64>(value.GetValue<BigIntT>());
+        }
+        case LogicalType::kFloat: {
+            return value.GetValue<FloatT>();
+        }
+        case LogicalType::kDouble: {
+            return value.GetValue<DoubleT>();
+        }
+        default: {
+            return None;
+        }
+    }
+}
+
+} // namespace
+
+CardinalityEstimator::CardinalityEstimator(QueryContext *query_context, const SharedPtr<LogicalNode> &plan) : query_context_(query_context) {
+    CollectTableScans(plan);
+}
+
+void CardinalityEstimator::CollectTableScans(const SharedPtr<LogicalNode> &op) {
+    if (!op) {
+        return;
+    }
+    if (op->operator_type() == LogicalNodeType::kTableScan) {
+        auto *table_scan = static_cast<LogicalTableScan *>(op.get());
+        table_scans_.emplace(table_scan->TableIndex(), table_scan);
+    }
+    CollectTableScans(op->left_node());
+    CollectTableScans(op->right_node());
+}
+
+const ColumnStatistics *CardinalityEstimator::GetStatistics(const ColumnBinding &binding) {
+    auto iter = statistics_.find(binding);
+    if (iter == statistics_.end()) {
+        Optional<ColumnStatistics> statistics;
+        if (auto scan_iter = table_scans_.find(binding.table_idx); scan_iter != table_scans_.end()) {
+            TableEntry *table_entry = scan_iter->second->table_collection_ptr();
+            statistics = table_entry->GetColumnStatistics(binding.column_idx, query_context_->GetTxn()->BeginTS());
+            // the statistics of a few sealed segments say little about the rows still being appended
+            if (statistics.has_value() && statistics->row_count_ * 2 < table_entry->row_count()) {
+                statistics = None;
+            }
+        }
+        iter = statistics_.emplace(binding, std::move(statistics)).first;
+    }
+    return iter->second.has_value() ? &*iter->second : nullptr;
+}
+
+Optional<f64> CardinalityEstimator::EstimateDistinctCount(const ColumnBinding &binding) {
+    const ColumnStatistics *statistics = GetStatistics(binding);
+    if (statistics == nullptr) {
+        return None;
+    }
+    return std::max<f64>(statistics->DistinctCount(), 1);
+}
+
+f64 CardinalityEstimator::EstimateRows(const LogicalNode &op) {
+    switch (op.operator_type()) {
+        case LogicalNodeType::kTableScan: {
+            return static_cast<const LogicalTableScan &>(op).table_collection_ptr()->row_count();
+        }
+        case LogicalNodeType::kFilter: {
+            return EstimateRows(*op.left_node()) * EstimateSelectivity(static_cast<const LogicalFilter &>(op).expression());
+        }
+        case LogicalNodeType::kCrossProduct: {
+            return EstimateRows(*op.left_node()) * EstimateRows(*op.right_node());
+        }
+        case LogicalNodeType::kJoin: {
+            const auto &join = static_cast<const LogicalJoin &>(op);
+            f64 left_rows = EstimateRows(*op.left_node());
+            f64 right_rows = EstimateRows(*op.right_node());
+            f64 inner_rows = left_rows * right_rows;
+            for (const auto &condition : join.conditions_) {
+                inner_rows *= EstimateSelectivity(condition);
+            }
+            switch (join.join_type_) {
+                case JoinType::kInner:
+                case JoinType::kCross:
+                case JoinType::kNatural: {
+                    return inner_rows;
+                }
+                case JoinType::kLeft: {
+                    return std::max(left_rows, inner_rows);
+                }
+                case JoinType::kRight: {
+                    return std::max(right_rows, inner_rows);
+                }
+                case JoinType::kFull: {
+                    return std::max(left_rows + right_rows, inner_rows);
+                }
+                case JoinType::kSemi: {
+                    // each left row once, if it has a match
+                    return std::min(left_rows, inner_rows);
+                }
+                default: {
+                    // anti and mark joins output the left rows at most
+                    return left_rows;
+                }
+            }
+        }
+        default: {
+            return op.left_node() ? EstimateRows(*op.left_node()) : 1;
+        }
+    }
+}
+
+f64 CardinalityEstimator::EqualSelectivity(const SharedPtr<BaseExpression> &left, const SharedPtr<BaseExpression> &right) {
+    const ColumnExpression *left_column = ComparedColumn(left);
+    const ColumnExpression *right_column = ComparedColumn(right);
+    Optional<f64> left_distinct = left_column != nullptr ? EstimateDistinctCount(left_column->binding()) : None;
+    Optional<f64> right_distinct = right_column != nullptr ? EstimateDistinctCount(right_column->binding()) : None;
+    if (left_column != nullptr && right_column != nullptr) {
+        // the values of the side with fewer distinct values are assumed to be among those of the other side
+        if (left_distinct.has_value() || right_distinct.has_value()) {
+            return 1.0 / std::max(left_distinct.value_or(1), right_distinct.value_or(1));
+        }
+        return kEqualSelectivity;
+    }
+    if (left_distinct.has_value()) {
+        return 1.0 / *left_distinct;
+    }
+    if (right_distinct.has_value()) {
+        return 1.0 / *right_distinct;
+    }
+    return kEqualSelectivity;
+}
+
+Optional<f64> CardinalityEstimator::LessEqualFraction(const SharedPtr<BaseExpression> &column, const SharedPtr<BaseExpression> &value) {
+    const ColumnExpression *column_expression = ComparedColumn(column);
+    Optional<f64> constant = NumericConstant(value);
+    if (column_expression == nullptr || !constant.has_value()) {
+        return None;
+    }
+    const ColumnStatistics *statistics = GetStatistics(column_expression->binding());
+    if (statistics == nullptr) {
+        return None;
+    }
+    return statistics->LessEqualFraction(*constant);
+}
+
+f64 CardinalityEstimator::EstimateSelectivity(const SharedPtr<BaseExpression> &expression) {
+    switch (expression->type()) {
+        case ExpressionType::kFunction: {
+            const String &function_name = static_cast<FunctionExpression &>(*expression).ScalarFunctionName();
+            const auto &arguments = expression->arguments();
+            if (function_name == "=") {
+                return EqualSelectivity(arguments[0], arguments[1]);
+            }
+            if (function_name == "<>") {
+                return 1.0 - EqualSelectivity(arguments[0], arguments[1]);
+            }
+            if (function_name == "<" || function_name == "<=") {
+                if (Optional<f64> fraction = LessEqualFraction(arguments[0], arguments[1]); fraction.has_value()) {
+                    return *fraction;
+                }
+                if (Optional<f64> fraction = LessEqualFraction(arguments[1], arguments[0]); fraction.has_value()) {
+                    return 1.0 - *fraction;
+                }
+                return kRangeSelectivity;
+            }
+            if (function_name == ">" || function_name == ">=") {
+                if (Optional<f64> fraction = LessEqualFraction(arguments[0], arguments[1]); fraction.has_value()) {
+                    return 1.0 - *fraction;
+                }
+                if (Optional<f64> fraction = LessEqualFraction(arguments[1], arguments[0]); fraction.has_value()) {
+                    return *fraction;
+                }
+                return kRangeSelectivity;
+            }
+            if (function_name == "like") {
+                return 0.25;
+            }
+            if (function_name == "not_like") {
+                return 0.75;
+            }
+            if (function_name == "AND") {
+                return EstimateSelectivity(arguments[0]) * EstimateSelectivity(arguments[1]);
+            }
+            if (function_name == "OR") {
+                f64 left = EstimateSelectivity(arguments[0]);
+                f64 right = EstimateSelectivity(arguments[1]);
+                return left + right - left * right;
+            }
+            if (function_name == "NOT") {
+                return 1.0 - EstimateSelectivity(arguments[0]);
+            }
+            return kDefaultSelectivity;
+        }
+        case ExpressionType::kIn: {
+            auto &in_expression = static_cast<InExpression &>(*expression);
+            f64 selectivity = kEqualSelectivity;
+            f64 max_selectivity = kDefaultSelectivity;
+            if (const ColumnExpression *column_expression = ComparedColumn(in_expression.left_operand()); column_expression != nullptr) {
+                if (Optional<f64> distinct_count = EstimateDistinctCount(column_expression->binding()); distinct_count.has_value()) {
+                    selectivity = 1.0 / *distinct_count;
+                    max_selectivity = 1.0;
+                }
+            }
+            selectivity = std::min(selectivity * expression->arguments().size(), max_selectivity);
+            return in_expression.in_type() == InType::kNotIn ? 1.0 - selectivity : selectivity;
+        }
+        default: {
+            return kDefaultSelectivity;
+        }
+    }
+}
+
+} // namespace infinity
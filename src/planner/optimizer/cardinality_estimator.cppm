@@ -0,0 +1,59 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module cardinality_estimator;
+
+import stl;
+import logical_node;
+import logical_table_scan;
+import base_expression;
+import column_binding;
+import column_statistics;
+import query_context;
+
+namespace infinity {
+
+// Estimates the rows of logical plan nodes and the selectivity of predicates, from the column statistics of the sealed segments
+// of the scanned tables. Without statistics fixed guesses are used: 0.1 for "=", 0.33 for a range, 0.5 for the rest.
+export class CardinalityEstimator {
+public:
+    // The columns of the table scans in the plan are looked up
+    CardinalityEstimator(QueryContext *query_context, const SharedPtr<LogicalNode> &plan);
+
+    f64 EstimateRows(const LogicalNode &op);
+
+    // The fraction of the rows a boolean expression is expected to keep
+    f64 EstimateSelectivity(const SharedPtr<BaseExpression> &expression);
+
+    // None if the column isn't one of a scanned table, or most of its rows have no statistics
+    Optional<f64> EstimateDistinctCount(const ColumnBinding &binding);
+
+private:
+    void CollectTableScans(const SharedPtr<LogicalNode> &op);
+
+    const ColumnStatistics *GetStatistics(const ColumnBinding &binding);
+
+    f64 EqualSelectivity(const SharedPtr<BaseExpression> &left, const SharedPtr<BaseExpression> &right);
+
+    // The fraction of the rows with column <= value, None without a histogram of the column
+    Optional<f64> LessEqualFraction(const SharedPtr<BaseExpression> &column, const SharedPtr<BaseExpression> &value);
+
+    QueryContext *query_context_{};
+    HashMap<SizeT, LogicalTableScan *> table_scans_{};
+    HashMap<ColumnBinding, Optional<ColumnStatistics>> statistics_{};
+};
+
+} // namespace infinity
@@ -58,8 +58,12 @@ void RemoveUnusedColumns::VisitNode(LogicalNode &op) {
             return;
         }
         case LogicalNodeType::kUnion: {
-            // TODO: Union is not supported yet
-            break;
+            // All output columns of each input are the output of union, they are pruned as the root of the input plan.
+            RemoveUnusedColumns left_remove(true);
+            left_remove.VisitNode(*op.left_node());
+            RemoveUnusedColumns right_remove(true);
+            right_remove.VisitNode(*op.right_node());
+            return;
         }
         case LogicalNodeType::kIntersect:
             break;
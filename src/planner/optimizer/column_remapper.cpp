@@ -16,6 +16,7 @@ module;
 
 import logical_node;
 import logical_node_type;
+import logical_join;
 import stl;
 import base_expression;
 import column_expression;
@@ -32,10 +33,10 @@ namespace infinity {
 void BindingRemapper::VisitNode(LogicalNode &op) {
     auto load_func = [&]() {
         auto load_metas = op.load_metas();
+        // The loaded columns are appended after the row id, so the special columns are counted from the input columns.
         column_cnt_ = output_types_? output_types_->size() : 0;
 
         if (load_metas.get() != nullptr) {
-            column_cnt_ += load_metas->size();
             for (SizeT i = 0; i < load_metas->size(); ++i) {
                 auto &load_meta = (*load_metas)[i];
                 // fix index_ value (will be used in PhysicalOperator::InputLoad), now always append to the end
@@ -45,7 +46,16 @@ void BindingRemapper::VisitNode(LogicalNode &op) {
         }
     };
 
-    if (op.operator_type() == LogicalNodeType::kJoin or op.operator_type() == LogicalNodeType::kKnnScan) {
+    if (op.operator_type() == LogicalNodeType::kJoin && static_cast<LogicalJoin &>(op).OutputsLeftOnly()) {
+        // the conditions of a semi or anti join read both inputs, its output is the left input
+        VisitNodeChildren(op);
+        bindings_ = static_cast<LogicalJoin &>(op).GetInputBindings();
+        VisitNodeExpression(op);
+        bindings_ = op.GetColumnBindings();
+        output_types_ = op.GetOutputTypes();
+        load_func();
+    } else if (op.operator_type() == LogicalNodeType::kJoin or op.operator_type() == LogicalNodeType::kKnnScan or
+        op.operator_type() == LogicalNodeType::kMatch) {
         VisitNodeChildren(op);
         bindings_ = op.GetColumnBindings();
         output_types_ = op.GetOutputTypes();
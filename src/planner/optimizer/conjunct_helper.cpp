@@ -0,0 +1,101 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+module conjunct_helper;
+
+import stl;
+import base_expression;
+import query_context;
+import logical_node;
+import column_binding;
+import expression_type;
+import function_expression;
+import conjunction_expression;
+import column_expression;
+import in_expression;
+import scalar_function;
+import scalar_function_set;
+import catalog;
+
+namespace infinity {
+
+void ConjunctHelper::SplitConjuncts(const SharedPtr<BaseExpression> &expression, Vector<SharedPtr<BaseExpression>> &conjuncts) {
+    if (expression->type() == ExpressionType::kFunction && static_cast<FunctionExpression &>(*expression).ScalarFunctionName() == "AND") {
+        SplitConjuncts(expression->arguments()[0], conjuncts);
+        SplitConjuncts(expression->arguments()[1], conjuncts);
+        return;
+    }
+    if (expression->type() == ExpressionType::kConjunction &&
+        static_cast<ConjunctionExpression &>(*expression).conjunction_type() == ConjunctionType::kAnd) {
+        SplitConjuncts(expression->arguments()[0], conjuncts);
+        SplitConjuncts(expression->arguments()[1], conjuncts);
+        return;
+    }
+    conjuncts.push_back(expression);
+}
+
+SharedPtr<BaseExpression> ConjunctHelper::ComposeConjuncts(QueryContext *query_context, const Vector<SharedPtr<BaseExpression>> &conjuncts) {
+    auto and_function_set_ptr = static_pointer_cast<ScalarFunctionSet>(Catalog::GetFunctionSetByName(query_context->storage()->catalog(), "AND"));
+    SharedPtr<BaseExpression> result = conjuncts[0];
+    for (SizeT i = 1; i < conjuncts.size(); ++i) {
+        Vector<SharedPtr<BaseExpression>> arguments{result, conjuncts[i]};
+        ScalarFunction and_function = and_function_set_ptr->GetMostMatchFunction(arguments);
+        result = MakeShared<FunctionExpression>(and_function, std::move(arguments));
+    }
+    return result;
+}
+
+bool ConjunctHelper::CollectTables(const SharedPtr<BaseExpression> &expression, HashSet<SizeT> &tables) {
+    switch (expression->type()) {
+        case ExpressionType::kSubQuery:
+        case ExpressionType::kCase: {
+            return false;
+        }
+        case ExpressionType::kColumn: {
+            auto &column_expression = static_cast<ColumnExpression &>(*expression);
+            if (column_expression.depth() > 0) {
+                return false;
+            }
+            tables.insert(column_expression.binding().table_idx);
+            return true;
+        }
+        case ExpressionType::kIn: {
+            if (!CollectTables(static_cast<InExpression &>(*expression).left_operand(), tables)) {
+                return false;
+            }
+            break;
+        }
+        default: {
+            break;
+        }
+    }
+    for (const auto &argument : expression->arguments()) {
+        if (!CollectTables(argument, tables)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+HashSet<SizeT> ConjunctHelper::OutputTables(const LogicalNode &op) {
+    HashSet<SizeT> tables;
+    for (const auto &binding : op.GetColumnBindings()) {
+        tables.insert(binding.table_idx);
+    }
+    return tables;
+}
+
+} // namespace infinity
@@ -0,0 +1,42 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module conjunct_helper;
+
+import stl;
+import base_expression;
+import query_context;
+import logical_node;
+
+namespace infinity {
+
+// The conjuncts of the filters and join conditions moved and reordered by the optimizer rules
+export class ConjunctHelper {
+public:
+    static void SplitConjuncts(const SharedPtr<BaseExpression> &expression, Vector<SharedPtr<BaseExpression>> &conjuncts);
+
+    // ((c0 AND c1) AND c2) ..., the conjuncts are evaluated in their order
+    static SharedPtr<BaseExpression> ComposeConjuncts(QueryContext *query_context, const Vector<SharedPtr<BaseExpression>> &conjuncts);
+
+    // The tables of the columns read by the expression. False if the expression can't be moved: it has a subquery, a case, or a
+    // column of an outer query.
+    static bool CollectTables(const SharedPtr<BaseExpression> &expression, HashSet<SizeT> &tables);
+
+    // The tables of the columns output by the node
+    static HashSet<SizeT> OutputTables(const LogicalNode &op);
+};
+
+} // namespace infinity
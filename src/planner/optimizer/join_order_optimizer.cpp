@@ -0,0 +1,371 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <algorithm>
+#include <bit>
+#include <limits>
+
+module join_order_optimizer;
+
+import stl;
+import logical_node;
+import logical_node_type;
+import logical_filter;
+import logical_join;
+import logical_cross_product;
+import join_reference;
+import query_context;
+import base_expression;
+import conjunct_helper;
+import cardinality_estimator;
+
+namespace infinity {
+
+namespace {
+
+// Every order of up to this many inputs is considered
+constexpr SizeT kMaxExhaustiveInputs = 10;
+// The inputs of a join tree are sets of bits
+constexpr SizeT kMaxInputs = 64;
+
+bool IsReorderable(const SharedPtr<LogicalNode> &op) {
+    if (!op) {
+        return false;
+    }
+    if (op->operator_type() == LogicalNodeType::kCrossProduct) {
+        return true;
+    }
+    if (op->operator_type() != LogicalNodeType::kJoin) {
+        return false;
+    }
+    JoinType join_type = static_cast<const LogicalJoin &>(*op).join_type_;
+    return join_type == JoinType::kInner || join_type == JoinType::kCross;
+}
+
+struct JoinPredicate {
+    SharedPtr<BaseExpression> expression_;
+    u64 inputs_{}; // evaluated by the lowest join of all these inputs
+    f64 selectivity_{};
+    bool placed_{};
+};
+
+struct JoinPlan {
+    f64 cost_{};
+    u64 left_{}; // the inputs of the two sides, 0 for a single input
+    u64 right_{};
+};
+
+// Finds the order of one join tree and builds it
+class JoinOrderSolver {
+public:
+    JoinOrderSolver(QueryContext *query_context,
+                    CardinalityEstimator &cardinality_estimator,
+                    Vector<SharedPtr<LogicalNode>> inputs,
+                    Vector<JoinPredicate> predicates,
+                    Vector<u64> join_node_ids,
+                    String alias)
+        : query_context_(query_context), inputs_(std::move(inputs)), predicates_(std::move(predicates)), join_node_ids_(std::move(join_node_ids)),
+          alias_(std::move(alias)) {
+        std::sort(join_node_ids_.begin(), join_node_ids_.end());
+        input_rows_.reserve(inputs_.size());
+        for (const auto &input : inputs_) {
+            input_rows_.push_back(std::max(cardinality_estimator.EstimateRows(*input), 1.0));
+        }
+    }
+
+    SharedPtr<LogicalNode> Solve() {
+        all_inputs_ = inputs_.size() == kMaxInputs ? std::numeric_limits<u64>::max() : (u64(1) << inputs_.size()) - 1;
+        for (SizeT i = 0; i < inputs_.size(); ++i) {
+            plans_[u64(1) << i] = JoinPlan{};
+        }
+        if (inputs_.size() <= kMaxExhaustiveInputs) {
+            SolveExhaustive(false);
+            if (!plans_.contains(all_inputs_)) {
+                SolveExhaustive(true);
+            }
+        } else {
+            SolveGreedy();
+        }
+        return Build(all_inputs_);
+    }
+
+private:
+    f64 Rows(u64 inputs) {
+        if (auto iter = rows_.find(inputs); iter != rows_.end()) {
+            return iter->second;
+        }
+        f64 rows = 1;
+        for (u64 remaining = inputs; remaining != 0; remaining &= remaining - 1) {
+            rows *= input_rows_[std::countr_zero(remaining)];
+        }
+        for (const auto &predicate : predicates_) {
+            if ((predicate.inputs_ & ~inputs) == 0) {
+                rows *= predicate.selectivity_;
+            }
+        }
+        rows = std::max(rows, 1.0);
+        rows_.emplace(inputs, rows);
+        return rows;
+    }
+
+    bool Connected(u64 left, u64 right) const {
+        u64 inputs = left | right;
+        return std::any_of(predicates_.begin(), predicates_.end(), [&](const JoinPredicate &predicate) {
+            return (predicate.inputs_ & ~inputs) == 0 && (predicate.inputs_ & left) != 0 && (predicate.inputs_ & right) != 0;
+        });
+    }
+
+    // The cost of a plan is the sum of the rows of its joins
+    void AddPlan(u64 left, u64 right) {
+        u64 inputs = left | right;
+        f64 cost = plans_[left].cost_ + plans_[right].cost_ + Rows(inputs);
+        auto iter = plans_.find(inputs);
+        if (iter == plans_.end() || cost < iter->second.cost_) {
+            plans_[inputs] = JoinPlan{cost, left, right};
+        }
+    }
+
+    // Each set of inputs is joined the cheapest way of splitting it in two planned sets. The sets grow in numeric order, so the
+    // subsets of a set are planned before it.
+    void SolveExhaustive(bool allow_cross_product) {
+        for (u64 inputs = 1; inputs <= all_inputs_; ++inputs) {
+            if (std::popcount(inputs) < 2) {
+                continue;
+            }
+            u64 lowest_input = inputs & (~inputs + 1);
+            for (u64 left = (inputs - 1) & inputs; left != 0; left = (left - 1) & inputs) {
+                // each split once, with the lowest input on the left
+                if ((left & lowest_input) == 0) {
+                    continue;
+                }
+                u64 right = inputs ^ left;
+                if (!plans_.contains(left) || !plans_.contains(right)) {
+                    continue;
+                }
+                if (!allow_cross_product && !Connected(left, right)) {
+                    continue;
+                }
+                AddPlan(left, right);
+            }
+        }
+    }
+
+    // Joins the two connected sets with the fewest result rows until one is left, sets are cross joined when none is connected
+    void SolveGreedy() {
+        Vector<u64> sets;
+        for (SizeT i = 0; i < inputs_.size(); ++i) {
+            sets.push_back(u64(1) << i);
+        }
+        while (sets.size() > 1) {
+            SizeT best_i = 0;
+            SizeT best_j = 0;
+            f64 best_rows = std::numeric_limits<f64>::max();
+            bool best_connected = false;
+            for (SizeT i = 0; i < sets.size(); ++i) {
+                for (SizeT j = i + 1; j < sets.size(); ++j) {
+                    bool connected = Connected(sets[i], sets[j]);
+                    if (best_connected && !connected) {
+                        continue;
+                    }
+                    f64 rows = Rows(sets[i] | sets[j]);
+                    if ((connected && !best_connected) || rows < best_rows) {
+                        best_i = i;
+                        best_j = j;
+                        best_rows = rows;
+                        best_connected = connected;
+                    }
+                }
+            }
+            AddPlan(sets[best_i], sets[best_j]);
+            sets[best_i] |= sets[best_j];
+            sets.erase(sets.begin() + best_j);
+        }
+    }
+
+    SharedPtr<LogicalNode> Build(u64 inputs) {
+        const JoinPlan plan = plans_.at(inputs);
+        if (plan.left_ == 0) {
+            return inputs_[std::countr_zero(inputs)];
+        }
+        u64 left = plan.left_;
+        u64 right = plan.right_;
+        // the hash join builds its table on the right input
+        if (Rows(right) > Rows(left)) {
+            std::swap(left, right);
+        }
+        SharedPtr<LogicalNode> left_node = Build(left);
+        SharedPtr<LogicalNode> right_node = Build(right);
+
+        Vector<SharedPtr<BaseExpression>> conditions;
+        for (auto &predicate : predicates_) {
+            if (!predicate.placed_ && (predicate.inputs_ & ~inputs) == 0) {
+                conditions.push_back(predicate.expression_);
+                predicate.placed_ = true;
+            }
+        }
+        // the joins are rebuilt bottom up with the node ids of the old ones
+        u64 node_id = next_join_ < join_node_ids_.size() ? join_node_ids_[next_join_++] : query_context_->GetNextNodeID();
+        String alias = inputs == all_inputs_ ? alias_ : String();
+        if (conditions.empty()) {
+            return MakeShared<LogicalCrossProduct>(node_id, std::move(alias), left_node, right_node);
+        }
+        return MakeShared<LogicalJoin>(node_id, JoinType::kInner, std::move(alias), std::move(conditions), left_node, right_node);
+    }
+
+    QueryContext *query_context_{};
+    Vector<SharedPtr<LogicalNode>> inputs_;
+    Vector<f64> input_rows_;
+    Vector<JoinPredicate> predicates_;
+    Vector<u64> join_node_ids_;
+    SizeT next_join_{};
+    String alias_;
+    u64 all_inputs_{};
+    HashMap<u64, JoinPlan> plans_;
+    HashMap<u64, f64> rows_;
+};
+
+class JoinOrderMethod {
+public:
+    JoinOrderMethod(QueryContext *query_context, const SharedPtr<LogicalNode> &plan)
+        : query_context_(query_context), cardinality_estimator_(query_context, plan) {}
+
+    void VisitNode(SharedPtr<LogicalNode> &op) {
+        if (!op) {
+            return;
+        }
+        if (op->operator_type() == LogicalNodeType::kFilter && IsReorderable(op->left_node())) {
+            auto &filter = static_cast<LogicalFilter &>(*op);
+            Vector<SharedPtr<BaseExpression>> conjuncts;
+            ConjunctHelper::SplitConjuncts(filter.expression(), conjuncts);
+            Vector<SharedPtr<BaseExpression>> remaining_conjuncts = ReorderJoins(op->left_node(), conjuncts);
+            if (remaining_conjuncts.empty()) {
+                SharedPtr<LogicalNode> join = op->left_node();
+                op = std::move(join);
+            } else if (remaining_conjuncts.size() < conjuncts.size()) {
+                filter.expression() = ConjunctHelper::ComposeConjuncts(query_context_, remaining_conjuncts);
+            }
+            return;
+        }
+        if (IsReorderable(op)) {
+            ReorderJoins(op, {});
+            return;
+        }
+        VisitNode(op->left_node());
+        VisitNode(op->right_node());
+    }
+
+private:
+    void CollectJoinTree(const SharedPtr<LogicalNode> &op,
+                         Vector<SharedPtr<LogicalNode>> &inputs,
+                         Vector<SharedPtr<BaseExpression>> &conditions,
+                         Vector<u64> &join_node_ids) {
+        if (!IsReorderable(op)) {
+            inputs.push_back(op);
+            return;
+        }
+        join_node_ids.push_back(op->node_id());
+        if (op->operator_type() == LogicalNodeType::kJoin) {
+            for (const auto &condition : static_cast<const LogicalJoin &>(*op).conditions_) {
+                ConjunctHelper::SplitConjuncts(condition, conditions);
+            }
+        }
+        CollectJoinTree(op->left_node(), inputs, conditions, join_node_ids);
+        CollectJoinTree(op->right_node(), inputs, conditions, join_node_ids);
+    }
+
+    // The inputs read by the expression, false if it reads anything else
+    static bool InputsOf(const SharedPtr<BaseExpression> &expression, const HashMap<SizeT, SizeT> &table_inputs, u64 &inputs) {
+        HashSet<SizeT> tables;
+        if (!ConjunctHelper::CollectTables(expression, tables)) {
+            return false;
+        }
+        inputs = 0;
+        for (SizeT table_idx : tables) {
+            auto iter = table_inputs.find(table_idx);
+            if (iter == table_inputs.end()) {
+                return false;
+            }
+            inputs |= u64(1) << iter->second;
+        }
+        return true;
+    }
+
+    // Reorders the join tree under root, the conjuncts of the filter above it which connect its inputs become join conditions.
+    // Returns the conjuncts left to the filter.
+    Vector<SharedPtr<BaseExpression>> ReorderJoins(SharedPtr<LogicalNode> &root, const Vector<SharedPtr<BaseExpression>> &filter_conjuncts) {
+        Vector<SharedPtr<LogicalNode>> inputs;
+        Vector<SharedPtr<BaseExpression>> conditions;
+        Vector<u64> join_node_ids;
+        CollectJoinTree(root, inputs, conditions, join_node_ids);
+        if (inputs.size() > kMaxInputs) {
+            VisitNode(root->left_node());
+            VisitNode(root->right_node());
+            return filter_conjuncts;
+        }
+        for (auto &input : inputs) {
+            VisitNode(input);
+        }
+
+        HashMap<SizeT, SizeT> table_inputs;
+        for (SizeT i = 0; i < inputs.size(); ++i) {
+            for (SizeT table_idx : ConjunctHelper::OutputTables(*inputs[i])) {
+                table_inputs.emplace(table_idx, i);
+            }
+        }
+        u64 all_inputs = inputs.size() == kMaxInputs ? std::numeric_limits<u64>::max() : (u64(1) << inputs.size()) - 1;
+
+        Vector<JoinPredicate> predicates;
+        for (const auto &condition : conditions) {
+            u64 condition_inputs = 0;
+            // a condition of a join can't go above the joins, the ones that don't read the inputs stay at the top join
+            if (!InputsOf(condition, table_inputs, condition_inputs) || condition_inputs == 0) {
+                condition_inputs = all_inputs;
+            }
+            predicates.push_back(JoinPredicate{condition, condition_inputs, cardinality_estimator_.EstimateSelectivity(condition)});
+        }
+        Vector<SharedPtr<BaseExpression>> remaining_conjuncts;
+        for (const auto &conjunct : filter_conjuncts) {
+            u64 conjunct_inputs = 0;
+            if (InputsOf(conjunct, table_inputs, conjunct_inputs) && std::popcount(conjunct_inputs) >= 2) {
+                predicates.push_back(JoinPredicate{conjunct, conjunct_inputs, cardinality_estimator_.EstimateSelectivity(conjunct)});
+            } else {
+                remaining_conjuncts.push_back(conjunct);
+            }
+        }
+
+        String alias = root->operator_type() == LogicalNodeType::kJoin ? static_cast<const LogicalJoin &>(*root).alias_
+                                                                         : static_cast<const LogicalCrossProduct &>(*root).alias_;
+        JoinOrderSolver solver(query_context_,
+                               cardinality_estimator_,
+                               std::move(inputs),
+                               std::move(predicates),
+                               std::move(join_node_ids),
+                               std::move(alias));
+        root = solver.Solve();
+        return remaining_conjuncts;
+    }
+
+    QueryContext *query_context_{};
+    CardinalityEstimator cardinality_estimator_;
+};
+
+} // namespace
+
+void JoinOrderOptimizer::ApplyToPlan(QueryContext *query_context_ptr, SharedPtr<LogicalNode> &logical_plan) {
+    JoinOrderMethod(query_context_ptr, logical_plan).VisitNode(logical_plan);
+}
+
+} // namespace infinity
@@ -0,0 +1,40 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module join_order_optimizer;
+
+import stl;
+import logical_node;
+import query_context;
+import optimizer_rule;
+
+namespace infinity {
+
+// Reorders each tree of inner joins and cross products, with the filter above it, by the estimated rows of the intermediate
+// results. Up to 10 inputs every order is considered by dynamic programming over the subsets of inputs, more are joined greedily,
+// the pair with the fewest result rows first. Inputs are only cross joined when no predicate connects them, and the smaller
+// input of a join becomes its right input, which the hash join builds on. Each predicate is evaluated by the lowest join which
+// has all its columns, so an equality filter above a cross product becomes the condition of a join.
+export class JoinOrderOptimizer final : public OptimizerRule {
+public:
+    ~JoinOrderOptimizer() final = default;
+
+    void ApplyToPlan(QueryContext *query_context_ptr, SharedPtr<LogicalNode> &logical_plan) final;
+
+    String name() const final { return "Join Order Optimizer"; }
+};
+
+} // namespace infinity
@@ -29,6 +29,7 @@ import logical_knn_scan;
 import logical_match;
 import base_table_ref;
 import load_meta;
+import internal_types;
 
 namespace infinity {
 
@@ -132,25 +133,54 @@ void CleanScan::VisitNode(LogicalNode &op) {
             // KnnScan base table ref has two parts:
             // 1. the columns used by next operator
             // 2. the columns used by filter expression in knn
+            // A projection right above the KnnScan loads its columns by the row ids of the merged top k rows instead,
+            // so the columns are not read for the rows of each KnnScan task which are dropped by MergeKnn.
             auto &knn_load_metas = *knn_scan.load_metas();
             Vector<LoadMeta> knn_scan_columns = std::move(knn_load_metas);
             knn_load_metas.clear(); // need to set load_metas of KnnScan to empty vector
-            auto &last_op_load_metas = *last_op_load_metas_;
-            knn_scan_columns.insert(knn_scan_columns.end(), last_op_load_metas.begin(), last_op_load_metas.end());
+            bool late_load = parent_op_type_ == LogicalNodeType::kProjection;
+            if (!late_load) {
+                auto &last_op_load_metas = *last_op_load_metas_;
+                knn_scan_columns.insert(knn_scan_columns.end(), last_op_load_metas.begin(), last_op_load_metas.end());
+            }
             Vector<SizeT> project_idxs = LoadedColumn(&knn_scan_columns, knn_scan.base_table_ref_.get());
-            scan_table_indexes_.push_back(knn_scan.base_table_ref_->table_index_);
+            if (!late_load) {
+                scan_table_indexes_.push_back(knn_scan.base_table_ref_->table_index_);
+            }
             knn_scan.base_table_ref_->RetainColumnByIndices(std::move(project_idxs));
             break;
         }
         case LogicalNodeType::kIndexScan: {
             auto &index_scan = static_cast<LogicalIndexScan &>(op);
-            Vector<SizeT> project_idxs; // empty output
+            // empty output, the columns are loaded by the row ids
+            // unless the next operator only loads the column covered by the index, then the scan outputs it from the index keys
+            Vector<SizeT> project_idxs;
+            Optional<ColumnID> coverable_column = index_scan.CoverableColumn();
+            if (coverable_column.has_value() && last_op_load_metas_) {
+                Vector<const LoadMeta *> scan_load_metas;
+                for (const auto &load_meta : *last_op_load_metas_) {
+                    if (load_meta.binding_.table_idx == index_scan.TableIndex()) {
+                        scan_load_metas.push_back(&load_meta);
+                    }
+                }
+                if (scan_load_metas.size() == 1 && scan_load_metas[0]->binding_.column_idx == *coverable_column) {
+                    project_idxs.push_back(scan_load_metas[0]->index_);
+                    scan_table_indexes_.push_back(index_scan.TableIndex());
+                    index_scan.covered_column_id_ = coverable_column;
+                }
+            }
             index_scan.base_table_ref_->RetainColumnByIndices(std::move(project_idxs));
             break;
         }
         case LogicalNodeType::kMatch: {
             auto &match = static_cast<LogicalMatch &>(op);
-            Vector<SizeT> project_idxs = LoadedColumn(last_op_load_metas_.get(), match.base_table_ref_.get());
+            // Match base table ref has the columns used by next operator and the columns used by its filter expression
+            auto &match_load_metas = *match.load_metas();
+            Vector<LoadMeta> match_columns = std::move(match_load_metas);
+            match_load_metas.clear();
+            auto &last_op_load_metas = *last_op_load_metas_;
+            match_columns.insert(match_columns.end(), last_op_load_metas.begin(), last_op_load_metas.end());
+            Vector<SizeT> project_idxs = LoadedColumn(&match_columns, match.base_table_ref_.get());
 
             scan_table_indexes_.push_back(match.base_table_ref_->table_index_);
             match.base_table_ref_->RetainColumnByIndices(std::move(project_idxs));
@@ -159,24 +189,30 @@ void CleanScan::VisitNode(LogicalNode &op) {
         case LogicalNodeType::kLimit:
         case LogicalNodeType::kFusion: {
             // Skip
+            LogicalNodeType parent_op_type = parent_op_type_;
+            parent_op_type_ = op.operator_type();
             VisitNodeChildren(op);
             VisitNodeExpression(op);
+            parent_op_type_ = parent_op_type;
             break;
         }
         default: {
             last_op_load_metas_ = op.load_metas();
+            LogicalNodeType parent_op_type = parent_op_type_;
+            parent_op_type_ = op.operator_type();
             VisitNodeChildren(op);
             VisitNodeExpression(op);
+            parent_op_type_ = parent_op_type;
 
             auto load_metas = op.load_metas();
             if (!scan_table_indexes_.empty()) {
                 Vector<LoadMeta> filtered_metas;
 
-                for (SizeT i = 0; i < scan_table_indexes_.size(); i++) {
-                    for (SizeT j = 0; j < load_metas->size(); j++) {
-                        if ((*load_metas)[j].binding_.table_idx != scan_table_indexes_[i]) {
-                            filtered_metas.push_back((*load_metas)[j]);
-                        }
+                // Keep the columns which are not loaded by the scans under this operator, e.g. both sides of a join.
+                for (SizeT j = 0; j < load_metas->size(); j++) {
+                    auto table_idx = (*load_metas)[j].binding_.table_idx;
+                    if (std::find(scan_table_indexes_.begin(), scan_table_indexes_.end(), table_idx) == scan_table_indexes_.end()) {
+                        filtered_metas.push_back((*load_metas)[j]);
                     }
                 }
                 op.set_load_metas(MakeShared<Vector<LoadMeta>>(std::move(filtered_metas)));
@@ -54,6 +54,7 @@ private:
     SharedPtr<BaseExpression> VisitReplace(const SharedPtr<ColumnExpression> &expression) final;
 
     SharedPtr<Vector<LoadMeta>> last_op_load_metas_{};
+    LogicalNodeType parent_op_type_{LogicalNodeType::kInvalid};
     Vector<SizeT> scan_table_indexes_{};
 };
 
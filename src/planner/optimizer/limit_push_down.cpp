@@ -0,0 +1,93 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <limits>
+
+module limit_push_down;
+
+import stl;
+import logical_node;
+import logical_node_type;
+import logical_limit;
+import logical_knn_scan;
+import logical_match;
+import logical_index_scan;
+import query_context;
+import base_expression;
+import value_expression;
+import knn_expression;
+import knn_expr;
+
+namespace infinity {
+
+namespace {
+
+class LimitPushDownMethod {
+public:
+    void VisitNode(const SharedPtr<LogicalNode> &op) {
+        if (op.get() == nullptr) {
+            return;
+        }
+        if (op->operator_type() == LogicalNodeType::kLimit) {
+            PushDown(static_cast<LogicalLimit &>(*op));
+        }
+        VisitNode(op->left_node());
+        VisitNode(op->right_node());
+    }
+
+private:
+    static void PushDown(LogicalLimit &limit) {
+        i64 row_count = static_pointer_cast<ValueExpression>(limit.limit_expression_)->GetValue().value_.big_int;
+        if (limit.offset_expression_.get() != nullptr) {
+            row_count += static_pointer_cast<ValueExpression>(limit.offset_expression_)->GetValue().value_.big_int;
+        }
+        if (row_count <= 0) {
+            return;
+        }
+        const SharedPtr<LogicalNode> &child = limit.left_node();
+        switch (child->operator_type()) {
+            case LogicalNodeType::kKnnScan: {
+                auto &knn_scan = static_cast<LogicalKnnScan &>(*child);
+                const KnnExpression &knn_expression = *knn_scan.knn_expression_;
+                if (knn_expression.threshold_.has_value() || knn_expression.distance_type_ == KnnDistanceType::kMaxSim) {
+                    break;
+                }
+                if (knn_expression.topn_ > row_count) {
+                    knn_scan.knn_expression_ = MakeShared<KnnExpression>(knn_expression, row_count);
+                }
+                break;
+            }
+            case LogicalNodeType::kMatch: {
+                auto &match = static_cast<LogicalMatch &>(*child);
+                match.limit_top_n_ = static_cast<u32>(std::min<i64>(row_count, std::numeric_limits<u32>::max()));
+                break;
+            }
+            case LogicalNodeType::kIndexScan: {
+                static_cast<LogicalIndexScan &>(*child).row_limit_ = row_count;
+                break;
+            }
+            default: {
+                break;
+            }
+        }
+    }
+};
+
+} // namespace
+
+void LimitPushDown::ApplyToPlan(QueryContext *, SharedPtr<LogicalNode> &logical_plan) { LimitPushDownMethod().VisitNode(logical_plan); }
+
+} // namespace infinity
@@ -0,0 +1,38 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module limit_push_down;
+
+import stl;
+import logical_node;
+import query_context;
+import optimizer_rule;
+
+namespace infinity {
+
+// Passes the rows a LIMIT keeps, its limit plus its offset, to the scan right below it: a KNN scan searches for no more neighbors
+// than that, a MATCH scores only that many top documents and an index scan stops once it has output that many rows. Both searches
+// apply the filter of the query before ranking, so no row is lost. A range search by threshold is left alone.
+export class LimitPushDown final : public OptimizerRule {
+public:
+    ~LimitPushDown() final = default;
+
+    void ApplyToPlan(QueryContext *query_context_ptr, SharedPtr<LogicalNode> &logical_plan) final;
+
+    String name() const final { return "Limit Push Down"; }
+};
+
+} // namespace infinity
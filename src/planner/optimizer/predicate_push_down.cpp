@@ -0,0 +1,264 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <algorithm>
+
+module predicate_push_down;
+
+import stl;
+import logical_node;
+import logical_node_type;
+import logical_filter;
+import logical_join;
+import join_reference;
+import query_context;
+import base_expression;
+import expression_type;
+import function_expression;
+import in_expression;
+import logical_type;
+import conjunct_helper;
+import cardinality_estimator;
+
+namespace infinity {
+
+namespace {
+
+bool Covers(const HashSet<SizeT> &output_tables, const HashSet<SizeT> &tables) {
+    return std::all_of(tables.begin(), tables.end(), [&](SizeT table_idx) { return output_tables.contains(table_idx); });
+}
+
+class PredicatePushDownMethod {
+public:
+    explicit PredicatePushDownMethod(QueryContext *query_context) : query_context_(query_context) {}
+
+    void VisitNode(SharedPtr<LogicalNode> &op) {
+        if (!op) {
+            return;
+        }
+        if (op->operator_type() == LogicalNodeType::kFilter) {
+            if (PushDownFilter(op)) {
+                // the filter is gone, visit the node that took its place
+                VisitNode(op);
+                return;
+            }
+        } else if (op->operator_type() == LogicalNodeType::kJoin) {
+            PushDownJoinConditions(static_cast<LogicalJoin &>(*op));
+        }
+        VisitNode(op->left_node());
+        VisitNode(op->right_node());
+    }
+
+private:
+    // Whether a filter above the join can be moved to its sides without changing the result
+    static bool CanPushThrough(const LogicalNode &join) {
+        if (join.operator_type() == LogicalNodeType::kCrossProduct) {
+            return true;
+        }
+        if (join.operator_type() != LogicalNodeType::kJoin) {
+            return false;
+        }
+        // the rows an outer join pads with nulls, and the mark joins of subqueries, are left alone. A filter above a semi or anti
+        // join reads only the left input, it filters the rows before they are probed.
+        JoinType join_type = static_cast<const LogicalJoin &>(join).join_type_;
+        return join_type == JoinType::kInner || join_type == JoinType::kCross || join_type == JoinType::kSemi || join_type == JoinType::kAnti;
+    }
+
+    // Splits the conjuncts into those reading only the left side, only the right side, and the rest
+    static void Partition(const LogicalNode &join,
+                          const Vector<SharedPtr<BaseExpression>> &conjuncts,
+                          Vector<SharedPtr<BaseExpression>> &left_conjuncts,
+                          Vector<SharedPtr<BaseExpression>> &right_conjuncts,
+                          Vector<SharedPtr<BaseExpression>> &remaining_conjuncts) {
+        HashSet<SizeT> left_tables = ConjunctHelper::OutputTables(*join.left_node());
+        HashSet<SizeT> right_tables = ConjunctHelper::OutputTables(*join.right_node());
+        for (const auto &conjunct : conjuncts) {
+            HashSet<SizeT> tables;
+            if (!ConjunctHelper::CollectTables(conjunct, tables) || tables.empty()) {
+                remaining_conjuncts.push_back(conjunct);
+            } else if (Covers(left_tables, tables)) {
+                left_conjuncts.push_back(conjunct);
+            } else if (Covers(right_tables, tables)) {
+                right_conjuncts.push_back(conjunct);
+            } else {
+                remaining_conjuncts.push_back(conjunct);
+            }
+        }
+    }
+
+    // The conjuncts become a filter on the child, or are added to the filter already there
+    void AddFilter(SharedPtr<LogicalNode> &child, Vector<SharedPtr<BaseExpression>> conjuncts) {
+        if (conjuncts.empty()) {
+            return;
+        }
+        if (child->operator_type() == LogicalNodeType::kFilter) {
+            auto &filter = static_cast<LogicalFilter &>(*child);
+            conjuncts.insert(conjuncts.begin(), filter.expression());
+            filter.expression() = ConjunctHelper::ComposeConjuncts(query_context_, conjuncts);
+            return;
+        }
+        auto filter = MakeShared<LogicalFilter>(query_context_->GetNextNodeID(), ConjunctHelper::ComposeConjuncts(query_context_, conjuncts));
+        filter->set_left_node(child);
+        child = std::move(filter);
+    }
+
+    // True if all the conjuncts were moved and the filter is replaced by its child
+    bool PushDownFilter(SharedPtr<LogicalNode> &op) {
+        SharedPtr<LogicalNode> child = op->left_node();
+        if (!CanPushThrough(*child)) {
+            return false;
+        }
+
+        auto &filter = static_cast<LogicalFilter &>(*op);
+        Vector<SharedPtr<BaseExpression>> conjuncts;
+        ConjunctHelper::SplitConjuncts(filter.expression(), conjuncts);
+        Vector<SharedPtr<BaseExpression>> left_conjuncts;
+        Vector<SharedPtr<BaseExpression>> right_conjuncts;
+        Vector<SharedPtr<BaseExpression>> remaining_conjuncts;
+        Partition(*child, conjuncts, left_conjuncts, right_conjuncts, remaining_conjuncts);
+        if (left_conjuncts.empty() && right_conjuncts.empty()) {
+            return false;
+        }
+        AddFilter(child->left_node(), std::move(left_conjuncts));
+        AddFilter(child->right_node(), std::move(right_conjuncts));
+        if (remaining_conjuncts.empty()) {
+            op = std::move(child);
+            return true;
+        }
+        filter.expression() = ConjunctHelper::ComposeConjuncts(query_context_, remaining_conjuncts);
+        return false;
+    }
+
+    // A condition of an inner or semi join on one side only filters that side. One condition is always kept for the join itself.
+    // The condition of an anti join on the right side only filters the right side, the left rows it fails are output.
+    void PushDownJoinConditions(LogicalJoin &join) {
+        if (join.join_type_ != JoinType::kInner && join.join_type_ != JoinType::kSemi && join.join_type_ != JoinType::kAnti) {
+            return;
+        }
+        Vector<SharedPtr<BaseExpression>> conjuncts;
+        for (const auto &condition : join.conditions_) {
+            ConjunctHelper::SplitConjuncts(condition, conjuncts);
+        }
+        Vector<SharedPtr<BaseExpression>> left_conjuncts;
+        Vector<SharedPtr<BaseExpression>> right_conjuncts;
+        Vector<SharedPtr<BaseExpression>> remaining_conjuncts;
+        Partition(join, conjuncts, left_conjuncts, right_conjuncts, remaining_conjuncts);
+        if (join.join_type_ == JoinType::kAnti) {
+            remaining_conjuncts.insert(remaining_conjuncts.end(), left_conjuncts.begin(), left_conjuncts.end());
+            left_conjuncts.clear();
+        }
+        if (remaining_conjuncts.empty() || (left_conjuncts.empty() && right_conjuncts.empty())) {
+            return;
+        }
+        AddFilter(join.left_node(), std::move(left_conjuncts));
+        AddFilter(join.right_node(), std::move(right_conjuncts));
+        join.conditions_ = std::move(remaining_conjuncts);
+    }
+
+    QueryContext *query_context_{};
+};
+
+// The relative cost of evaluating an expression on a row: comparing strings and matching patterns cost more than arithmetic
+f64 EstimateCost(const SharedPtr<BaseExpression> &expression) {
+    f64 cost = 0;
+    switch (expression->type()) {
+        case ExpressionType::kFunction: {
+            const String &function_name = static_cast<FunctionExpression &>(*expression).ScalarFunctionName();
+            if (function_name == "like" || function_name == "not_like") {
+                cost = 8;
+            } else {
+                cost = 1;
+                for (const auto &argument : expression->arguments()) {
+                    if (argument->Type().type() == LogicalType::kVarchar) {
+                        cost = 4;
+                        break;
+                    }
+                }
+            }
+            break;
+        }
+        case ExpressionType::kIn: {
+            auto &in_expression = static_cast<InExpression &>(*expression);
+            cost = in_expression.left_operand()->Type().type() == LogicalType::kVarchar ? 4 : 2;
+            cost += EstimateCost(in_expression.left_operand());
+            break;
+        }
+        case ExpressionType::kCast: {
+            cost = 1;
+            break;
+        }
+        case ExpressionType::kCase: {
+            cost = 4;
+            break;
+        }
+        default: {
+            break;
+        }
+    }
+    for (const auto &argument : expression->arguments()) {
+        cost += EstimateCost(argument);
+    }
+    return cost;
+}
+
+class ConjunctReorderMethod {
+public:
+    ConjunctReorderMethod(QueryContext *query_context, const SharedPtr<LogicalNode> &plan)
+        : query_context_(query_context), cardinality_estimator_(query_context, plan) {}
+
+    void VisitNode(const SharedPtr<LogicalNode> &op) {
+        if (!op) {
+            return;
+        }
+        if (op->operator_type() == LogicalNodeType::kFilter) {
+            auto &filter = static_cast<LogicalFilter &>(*op);
+            Vector<SharedPtr<BaseExpression>> conjuncts;
+            ConjunctHelper::SplitConjuncts(filter.expression(), conjuncts);
+            if (conjuncts.size() > 1) {
+                Vector<Pair<f64, SharedPtr<BaseExpression>>> ranked;
+                ranked.reserve(conjuncts.size());
+                for (auto &conjunct : conjuncts) {
+                    f64 rank = EstimateCost(conjunct) * cardinality_estimator_.EstimateSelectivity(conjunct);
+                    ranked.emplace_back(rank, std::move(conjunct));
+                }
+                std::stable_sort(ranked.begin(), ranked.end(), [](const auto &lhs, const auto &rhs) { return lhs.first < rhs.first; });
+                conjuncts.clear();
+                for (auto &[rank, conjunct] : ranked) {
+                    conjuncts.push_back(std::move(conjunct));
+                }
+                filter.expression() = ConjunctHelper::ComposeConjuncts(query_context_, conjuncts);
+            }
+        }
+        VisitNode(op->left_node());
+        VisitNode(op->right_node());
+    }
+
+private:
+    QueryContext *query_context_{};
+    CardinalityEstimator cardinality_estimator_;
+};
+
+} // namespace
+
+void PredicatePushDown::ApplyToPlan(QueryContext *query_context_ptr, SharedPtr<LogicalNode> &logical_plan) {
+    PredicatePushDownMethod(query_context_ptr).VisitNode(logical_plan);
+}
+
+void ConjunctReorder::ApplyToPlan(QueryContext *query_context_ptr, SharedPtr<LogicalNode> &logical_plan) {
+    ConjunctReorderMethod(query_context_ptr, logical_plan).VisitNode(logical_plan);
+}
+
+} // namespace infinity
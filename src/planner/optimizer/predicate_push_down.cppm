@@ -0,0 +1,49 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module predicate_push_down;
+
+import stl;
+import logical_node;
+import query_context;
+import optimizer_rule;
+
+namespace infinity {
+
+// Moves the conjuncts of a filter above an inner join or a cross product, which only read the columns of one side, into a filter
+// on that side, so that they are evaluated before the join and reach the table scans. The single side conditions of an inner
+// join are moved the same way.
+export class PredicatePushDown final : public OptimizerRule {
+public:
+    ~PredicatePushDown() final = default;
+
+    void ApplyToPlan(QueryContext *query_context_ptr, SharedPtr<LogicalNode> &logical_plan) final;
+
+    String name() const final { return "Predicate Push Down"; }
+};
+
+// Orders the conjuncts of each filter by estimated cost times selectivity, the cheap and selective ones first. The filter is
+// rebuilt as a left deep AND, and ExpressionSelector evaluates each conjunct only on the rows selected by the ones before it.
+export class ConjunctReorder final : public OptimizerRule {
+public:
+    ~ConjunctReorder() final = default;
+
+    void ApplyToPlan(QueryContext *query_context_ptr, SharedPtr<LogicalNode> &logical_plan) final;
+
+    String name() const final { return "Conjunct Reorder"; }
+};
+
+} // namespace infinity
@@ -27,6 +27,7 @@ import expression_state;
 import expression_evaluator;
 import expression_type;
 import function_expression;
+import in_expression;
 import base_table_ref;
 import logger;
 import third_party;
@@ -45,6 +46,7 @@ import value;
 import column_vector;
 import filter_expression_push_down_helper;
 import table_index_meta;
+import logical_type;
 
 namespace infinity {
 
@@ -198,7 +200,7 @@ private:
                     RecoverableError(status);
                 }
                 const IndexBase *index_base = table_index_entry->index_base();
-                if (index_base->index_type_ != IndexType::kSecondary) {
+                if (index_base->index_type_ != IndexType::kSecondary && index_base->index_type_ != IndexType::kBitmap) {
                     continue;
                 }
                 String column_name = index_base->column_name();
@@ -214,8 +216,10 @@ private:
 
     inline void FindIndexFilterCandidates() {
         for (auto &expression : flatten_and_subexpressions_) {
-            if (CanApplyIndexScan(expression)) {
-                index_filter_candidates_.emplace_back(std::move(expression));
+            // an IN list that can't use the index stays as it is, evaluated with the set of its values
+            SharedPtr<BaseExpression> rewritten_expression = RewriteInExpression(expression);
+            if (CanApplyIndexScan(rewritten_expression)) {
+                index_filter_candidates_.emplace_back(std::move(rewritten_expression));
             } else {
                 index_filter_leftover_.emplace_back(std::move(expression));
             }
@@ -223,6 +227,61 @@ private:
         flatten_and_subexpressions_.clear();
     }
 
+    // "x IN (v1, v2, ...)" is rewritten into "x = v1 OR x = v2 OR ...", so that an IN list on an indexed column is a union of the
+    // bitmaps of its values. The rewrite goes through the "and" and "or" expressions, into new expressions: the original is kept
+    // when the result can't use the index.
+    SharedPtr<BaseExpression> RewriteInExpression(const SharedPtr<BaseExpression> &expression) {
+        if (expression->type() == ExpressionType::kFunction) {
+            auto function_expression = std::static_pointer_cast<FunctionExpression>(expression);
+            if (auto const &f_name = function_expression->ScalarFunctionName(); f_name == "AND" or f_name == "OR") {
+                Vector<SharedPtr<BaseExpression>> arguments;
+                bool rewritten = false;
+                for (const auto &child_expression : expression->arguments()) {
+                    arguments.emplace_back(RewriteInExpression(child_expression));
+                    rewritten |= arguments.back() != child_expression;
+                }
+                if (rewritten) {
+                    return MakeShared<FunctionExpression>(function_expression->func_, std::move(arguments));
+                }
+            }
+            return expression;
+        }
+        if (expression->type() != ExpressionType::kIn) {
+            return expression;
+        }
+        auto in_expression = std::static_pointer_cast<InExpression>(expression);
+        if (in_expression->in_type() != InType::kIn || in_expression->arguments().empty()) {
+            return expression;
+        }
+        Catalog *catalog = query_context_->storage()->catalog();
+        auto equal_function_set_ptr = static_pointer_cast<ScalarFunctionSet>(Catalog::GetFunctionSetByName(catalog, "="));
+        auto or_function_set_ptr = static_pointer_cast<ScalarFunctionSet>(Catalog::GetFunctionSetByName(catalog, "OR"));
+        SharedPtr<BaseExpression> result;
+        for (const auto &value_expression : in_expression->arguments()) {
+            // each comparison gets its own column expression, the later rules replace them one by one
+            auto left_operand = CopyIndexFilterExpression(in_expression->left_operand());
+            Vector<SharedPtr<BaseExpression>> arguments{std::move(left_operand), value_expression};
+            ScalarFunction equal_func = equal_function_set_ptr->GetMostMatchFunction(arguments);
+            for (SizeT idx = 0; idx < arguments.size(); ++idx) {
+                if (arguments[idx]->Type() == equal_func.parameter_types_[idx]) {
+                    continue;
+                }
+                String name = arguments[idx]->Name();
+                arguments[idx] = CastExpression::AddCastToType(arguments[idx], equal_func.parameter_types_[idx]);
+                arguments[idx]->alias_ = name;
+            }
+            SharedPtr<BaseExpression> equal_expression = MakeShared<FunctionExpression>(std::move(equal_func), std::move(arguments));
+            if (!result) {
+                result = std::move(equal_expression);
+            } else {
+                Vector<SharedPtr<BaseExpression>> or_arguments{std::move(result), std::move(equal_expression)};
+                ScalarFunction or_func = or_function_set_ptr->GetMostMatchFunction(or_arguments);
+                result = MakeShared<FunctionExpression>(std::move(or_func), std::move(or_arguments));
+            }
+        }
+        return result;
+    }
+
     // classification of subexpressions
     inline bool CanApplyIndexScan(const SharedPtr<BaseExpression> &expression) {
         // case 1. expression is a scalar expression containing only one column and the column has a secondary index
@@ -365,6 +424,10 @@ private:
         //     1. fundamental expression ([cast] x compare value_expr)
         //     2. conjunction "and", "or" and "not".
         for (auto &expression : index_filter_candidates_) {
+            if (HasInexactIndexKey(expression)) {
+                // the index scan returns a superset of the rows, the filter checks them again
+                index_filter_leftover_.emplace_back(CopyIndexFilterExpression(expression));
+            }
             if (!index_filter_qualified_) {
                 index_filter_qualified_ = std::move(expression);
             } else {
@@ -393,6 +456,54 @@ private:
         index_filter_leftover_.clear();
     }
 
+    // the index key of a varchar column is the prefix of the string
+    static bool HasInexactIndexKey(const SharedPtr<BaseExpression> &expression) {
+        if (expression->type() == ExpressionType::kColumn) {
+            return expression->Type().type() == LogicalType::kVarchar;
+        }
+        for (const auto &argument : expression->arguments()) {
+            if (HasInexactIndexKey(argument)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // The column expressions of the leftover filter are replaced by the later optimizer rules, so the filter and the index scan
+    // can't share them. The value expressions on the right side are shared.
+    static SharedPtr<BaseExpression> CopyIndexFilterExpression(const SharedPtr<BaseExpression> &expression) {
+        switch (expression->type()) {
+            case ExpressionType::kFunction: {
+                auto function_expression = std::static_pointer_cast<FunctionExpression>(expression);
+                Vector<SharedPtr<BaseExpression>> arguments;
+                for (const auto &argument : expression->arguments()) {
+                    arguments.emplace_back(CopyIndexFilterExpression(argument));
+                }
+                return MakeShared<FunctionExpression>(function_expression->func_, std::move(arguments));
+            }
+            case ExpressionType::kCast: {
+                auto cast_expression = std::static_pointer_cast<CastExpression>(expression);
+                return MakeShared<CastExpression>(cast_expression->func_,
+                                                  CopyIndexFilterExpression(expression->arguments()[0]),
+                                                  cast_expression->Type());
+            }
+            case ExpressionType::kColumn: {
+                auto column_expression = std::static_pointer_cast<ColumnExpression>(expression);
+                auto binding = column_expression->binding();
+                return ColumnExpression::Make(column_expression->Type(),
+                                              column_expression->table_name(),
+                                              binding.table_idx,
+                                              column_expression->column_name(),
+                                              binding.column_idx,
+                                              column_expression->depth(),
+                                              column_expression->special());
+            }
+            default: {
+                return expression;
+            }
+        }
+    }
+
     inline bool AddIndexForBooleanExpression(SharedPtr<BaseExpression> &expression) {
         if (expression->type() == ExpressionType::kFunction) {
             auto function_expression = std::static_pointer_cast<FunctionExpression>(expression);
@@ -448,6 +559,9 @@ public:
     FastRoughFilterEvaluatorTrue() = default;
     ~FastRoughFilterEvaluatorTrue() final = default;
     bool EvaluateInner(TxnTimeStamp, const FastRoughFilter &) const final { return true; }
+    bool EvaluateZoneInner(const FastRoughFilter &, u32) const final { return true; }
+    // also stands for the expressions which can't be evaluated on the filter
+    bool EvaluateAllPassInner(const FastRoughFilter &) const final { return false; }
 };
 
 class FastRoughFilterEvaluatorFalse final : public FastRoughFilterEvaluator {
@@ -455,6 +569,8 @@ public:
     FastRoughFilterEvaluatorFalse() = default;
     ~FastRoughFilterEvaluatorFalse() final = default;
     bool EvaluateInner(TxnTimeStamp, const FastRoughFilter &) const final { return false; }
+    bool EvaluateZoneInner(const FastRoughFilter &, u32) const final { return false; }
+    bool EvaluateAllPassInner(const FastRoughFilter &) const final { return false; }
 };
 
 class FastRoughFilterEvaluatorCombineAnd final : public FastRoughFilterEvaluator {
@@ -468,6 +584,12 @@ public:
     bool EvaluateInner(TxnTimeStamp query_ts, const FastRoughFilter &filter) const final {
         return left_->EvaluateInner(query_ts, filter) and right_->EvaluateInner(query_ts, filter);
     }
+    bool EvaluateZoneInner(const FastRoughFilter &filter, u32 zone_id) const final {
+        return left_->EvaluateZoneInner(filter, zone_id) and right_->EvaluateZoneInner(filter, zone_id);
+    }
+    bool EvaluateAllPassInner(const FastRoughFilter &filter) const final {
+        return left_->EvaluateAllPassInner(filter) and right_->EvaluateAllPassInner(filter);
+    }
 };
 
 class FastRoughFilterEvaluatorCombineOr final : public FastRoughFilterEvaluator {
@@ -481,6 +603,12 @@ public:
     bool EvaluateInner(TxnTimeStamp query_ts, const FastRoughFilter &filter) const final {
         return left_->EvaluateInner(query_ts, filter) or right_->EvaluateInner(query_ts, filter);
     }
+    bool EvaluateZoneInner(const FastRoughFilter &filter, u32 zone_id) const final {
+        return left_->EvaluateZoneInner(filter, zone_id) or right_->EvaluateZoneInner(filter, zone_id);
+    }
+    bool EvaluateAllPassInner(const FastRoughFilter &filter) const final {
+        return left_->EvaluateAllPassInner(filter) or right_->EvaluateAllPassInner(filter);
+    }
 };
 
 // fast "equal" filter
@@ -492,6 +620,9 @@ public:
     FastRoughFilterEvaluatorProbabilisticDataFilter(ColumnID column_id, Value value) : column_id_(column_id), value_(std::move(value)) {}
     ~FastRoughFilterEvaluatorProbabilisticDataFilter() final = default;
     bool EvaluateInner(TxnTimeStamp query_ts, const FastRoughFilter &filter) const final { return filter.MayContain(query_ts, column_id_, value_); }
+    // the zones have no bloom filter
+    bool EvaluateZoneInner(const FastRoughFilter &, u32) const final { return true; }
+    bool EvaluateAllPassInner(const FastRoughFilter &) const final { return false; }
 };
 
 // fast "range" filter
@@ -507,6 +638,10 @@ public:
     bool EvaluateInner(TxnTimeStamp query_ts, const FastRoughFilter &filter) const final {
         return filter.MayInRange(column_id_, value_, compare_type_);
     }
+    bool EvaluateZoneInner(const FastRoughFilter &filter, u32 zone_id) const final {
+        return filter.ZoneMayInRange(zone_id, column_id_, value_, compare_type_);
+    }
+    bool EvaluateAllPassInner(const FastRoughFilter &filter) const final { return filter.AllInRange(column_id_, value_, compare_type_); }
 };
 
 class FastRoughFilterExpressionPushDownMethod {
@@ -716,4 +851,30 @@ UniquePtr<FastRoughFilterEvaluator> FilterExpressionPushDown::PushDownToFastRoug
     return FastRoughFilterExpressionPushDownMethod::SolveForFastRoughFilter(expression);
 }
 
+UniquePtr<FastRoughFilterEvaluator> FilterExpressionPushDown::PushDownJoinKeysToFastRoughFilter(ColumnID column_id,
+                                                                                               const Optional<Pair<Value, Value>> &min_max_key,
+                                                                                               const Vector<Value> &keys) {
+    if (!min_max_key.has_value()) {
+        return MakeUnique<FastRoughFilterEvaluatorFalse>();
+    }
+    const auto &[min_key, max_key] = *min_max_key;
+    auto lower_evaluator = MakeUnique<FastRoughFilterEvaluatorMinMaxFilter>(column_id, min_key, FilterCompareType::kGreaterEqual);
+    auto upper_evaluator = MakeUnique<FastRoughFilterEvaluatorMinMaxFilter>(column_id, max_key, FilterCompareType::kLessEqual);
+    UniquePtr<FastRoughFilterEvaluator> result =
+        MakeUnique<FastRoughFilterEvaluatorCombineAnd>(std::move(lower_evaluator), std::move(upper_evaluator));
+    UniquePtr<FastRoughFilterEvaluator> any_key;
+    for (const Value &key : keys) {
+        auto key_evaluator = MakeUnique<FastRoughFilterEvaluatorProbabilisticDataFilter>(column_id, key);
+        if (any_key) {
+            any_key = MakeUnique<FastRoughFilterEvaluatorCombineOr>(std::move(any_key), std::move(key_evaluator));
+        } else {
+            any_key = std::move(key_evaluator);
+        }
+    }
+    if (any_key) {
+        result = MakeUnique<FastRoughFilterEvaluatorCombineAnd>(std::move(result), std::move(any_key));
+    }
+    return result;
+}
+
 } // namespace infinity
\ No newline at end of file
@@ -24,6 +24,8 @@ import index_base;
 import table_index_entry;
 import secondary_index_scan_execute_expression;
 import fast_rough_filter;
+import value;
+import internal_types;
 
 namespace infinity {
 
@@ -50,6 +52,11 @@ public:
     PushDownToIndexScan(QueryContext *query_context, const BaseTableRef &base_table_ref, SharedPtr<BaseExpression> &&expression);
 
     static UniquePtr<FastRoughFilterEvaluator> PushDownToFastRoughFilter(SharedPtr<BaseExpression> &expression);
+
+    // The join keys of the build side of a hash join as the filter "min_key <= column <= max_key", and "column in keys" if the keys
+    // are given. No key at all rules out everything.
+    static UniquePtr<FastRoughFilterEvaluator>
+    PushDownJoinKeysToFastRoughFilter(ColumnID column_id, const Optional<Pair<Value, Value>> &min_max_key, const Vector<Value> &keys);
 };
 
 } // namespace infinity
\ No newline at end of file
@@ -273,6 +273,12 @@ inline void RewriteCompare(Value &right_val, FilterCompareType &compare_type) {
             right_val = Value::MakeTimestamp(right_val_timestamp);
             break;
         }
+        case LogicalType::kVarchar: {
+            // the index key of a varchar is its prefix, which is not strictly ordered with the string
+            // the rows of the prefix are kept, and checked again by the filter
+            compare_type = compare_type == FilterCompareType::kLess ? FilterCompareType::kLessEqual : FilterCompareType::kGreaterEqual;
+            break;
+        }
         default: {
             UnrecoverableError(fmt::format("FindPrev(): type error: {}.", right_val.type().ToString()));
         }
@@ -82,6 +82,10 @@ private:
                 result.SetIntervalRange<TimestampT>(value, compare_type);
                 break;
             }
+            case LogicalType::kVarchar: {
+                result.SetIntervalRange<VarcharT>(value, compare_type);
+                break;
+            }
             default: {
                 UnrecoverableError(fmt::format("SaveToResult(): type error: {}.", value.type().ToString()));
             }
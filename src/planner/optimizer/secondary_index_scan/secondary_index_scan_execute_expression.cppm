@@ -41,9 +41,13 @@ public:
                   "FilterExecuteSingleRangeT: Now only support integral or floating point index key type.");
 
     explicit FilterIntervalRangeT(const Value &val, FilterCompareType compare_type) {
-        ColumnValueType raw_val = val.GetValue<ColumnValueType>();
-        T val_ = ConvertToOrderedKeyValue(raw_val);
-        AddFilter(val_, compare_type);
+        if constexpr (std::is_same_v<ColumnValueType, VarcharT>) {
+            AddFilter(ConvertToOrderedVarcharKey(val.GetVarchar()), compare_type);
+        } else {
+            ColumnValueType raw_val = val.GetValue<ColumnValueType>();
+            T val_ = ConvertToOrderedKeyValue(raw_val);
+            AddFilter(val_, compare_type);
+        }
     }
 
     [[nodiscard]] bool MergeAnd(const FilterIntervalRangeT &other) {
@@ -113,7 +117,8 @@ export using FilterIntervalRange = std::variant<std::monostate,
                                                 FilterIntervalRangeT<DateT>,
                                                 FilterIntervalRangeT<TimeT>,
                                                 FilterIntervalRangeT<DateTimeT>,
-                                                FilterIntervalRangeT<TimestampT>>;
+                                                FilterIntervalRangeT<TimestampT>,
+                                                FilterIntervalRangeT<VarcharT>>;
 
 // because some rows may be deleted, kAlwaysTrue is meaningless
 // kInterval of the same column can be merged in "AND" condition
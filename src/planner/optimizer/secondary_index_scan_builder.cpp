@@ -14,6 +14,11 @@
 
 module;
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <type_traits>
+
 module secondary_index_scan_builder;
 
 import stl;
@@ -28,9 +33,110 @@ import infinity_exception;
 import logger;
 import third_party;
 import filter_expression_push_down;
+import secondary_index_scan_execute_expression;
+import filter_value_type_classification;
+import column_statistics;
+import table_entry;
+import txn;
+import catalog;
+import base_expression;
+import function_expression;
+import scalar_function;
+import scalar_function_set;
 
 namespace infinity {
 
+// The index scan fetches the selected rows by their row ids, a sequential table scan is faster above this fraction of the rows.
+constexpr double kIndexScanMaxSelectivity = 0.15;
+
+// The estimated fraction of the rows in the range, from the statistics of its column. None if there are no statistics for it.
+Optional<double> EstimateRangeSelectivity(const FilterExecuteSingleRange &single_range, TableEntry *table_entry, TxnTimeStamp begin_ts) {
+    if (single_range.IsEmpty()) {
+        return 0.0;
+    }
+    Optional<ColumnStatistics> statistics = table_entry->GetColumnStatistics(single_range.GetColumnID(), begin_ts);
+    if (!statistics.has_value() || statistics->Empty()) {
+        return None;
+    }
+    const double non_null_fraction = 1.0 - static_cast<double>(statistics->null_count_) / statistics->row_count_;
+    return std::visit(Overload{[&]<typename ColumnValueType>(const FilterIntervalRangeT<ColumnValueType> &interval_range) -> Optional<double> {
+                                   using T = FilterIntervalRangeT<ColumnValueType>::T;
+                                   auto [begin_val, end_val] = interval_range.GetRange();
+                                   if (end_val < begin_val) {
+                                       return 0.0;
+                                   }
+                                   if (begin_val == end_val) {
+                                       return non_null_fraction / std::max<u64>(statistics->DistinctCount(), 1);
+                                   }
+                                   // the histogram is on the values, only the keys of the numeric columns are their values
+                                   if constexpr (!std::is_same_v<T, ColumnValueType>) {
+                                       return None;
+                                   } else {
+                                       double lower_fraction = 0.0;
+                                       if (begin_val != std::numeric_limits<T>::lowest()) {
+                                           double below_begin = 0.0;
+                                           if constexpr (std::is_integral_v<T>) {
+                                               below_begin = static_cast<double>(begin_val) - 1;
+                                           } else {
+                                               below_begin = std::nextafter(static_cast<double>(begin_val), -INFINITY);
+                                           }
+                                           Optional<double> fraction = statistics->LessEqualFraction(below_begin);
+                                           if (!fraction.has_value()) {
+                                               return None;
+                                           }
+                                           lower_fraction = *fraction;
+                                       }
+                                       double upper_fraction = 1.0;
+                                       if (end_val != std::numeric_limits<T>::max()) {
+                                           Optional<double> fraction = statistics->LessEqualFraction(static_cast<double>(end_val));
+                                           if (!fraction.has_value()) {
+                                               return None;
+                                           }
+                                           upper_fraction = *fraction;
+                                       }
+                                       return non_null_fraction * std::clamp(upper_fraction - lower_fraction, 0.0, 1.0);
+                                   }
+                               },
+                               [](const std::monostate &) -> Optional<double> { return None; }},
+                      single_range.GetIntervalRange());
+}
+
+// The estimated fraction of the rows selected by the index filter, the ranges are taken as independent.
+// None if it can't be estimated, the rows of a range without statistics may all be selected.
+Optional<double> EstimateIndexScanSelectivity(const Vector<FilterExecuteElem> &filter_execute_command, TableEntry *table_entry, TxnTimeStamp begin_ts) {
+    Vector<Optional<double>> stack;
+    for (const auto &elem : filter_execute_command) {
+        std::visit(Overload{[&](FilterExecuteCombineType combine_type) {
+                                if (stack.size() < 2) {
+                                    UnrecoverableError("EstimateIndexScanSelectivity(): filter command stack error.");
+                                }
+                                Optional<double> right = stack.back();
+                                stack.pop_back();
+                                Optional<double> &left = stack.back();
+                                if (combine_type == FilterExecuteCombineType::kAnd) {
+                                    // "and" selects at most the rows of one side
+                                    if (left.has_value() && right.has_value()) {
+                                        left = *left * *right;
+                                    } else if (right.has_value()) {
+                                        left = right;
+                                    }
+                                } else if (left.has_value() && right.has_value()) {
+                                    left = *left + *right - *left * *right;
+                                } else {
+                                    left = None;
+                                }
+                            },
+                            [&](const FilterExecuteSingleRange &single_range) {
+                                stack.push_back(EstimateRangeSelectivity(single_range, table_entry, begin_ts));
+                            }},
+                   elem);
+    }
+    if (stack.size() != 1) {
+        UnrecoverableError("EstimateIndexScanSelectivity(): filter command stack error.");
+    }
+    return stack.back();
+}
+
 // Different from LogicalNodeVisitor, this visitor accepts shared_ptr<LogicalNode> as input.
 class BuildSecondaryIndexScan {
 public:
@@ -59,9 +165,31 @@ public:
                 auto &s_leftover = index_scan_solve_result.extra_leftover_filter_;
                 auto &filter_execute_command = index_scan_solve_result.filter_execute_command_;
                 // 1. check if the filter can be pushed down to the table scan
+                Optional<double> selectivity;
+                if (v_qualified) {
+                    selectivity = EstimateIndexScanSelectivity(filter_execute_command,
+                                                               base_table_ref_ptr->table_entry_ptr_,
+                                                               query_context_->GetTxn()->BeginTS());
+                }
                 if (!v_qualified) {
                     // no qualified index filter condition, keep the table scan
                     LOG_TRACE("BuildSecondaryIndexScan: No qualified index scan filter. Keep the table scan.");
+                } else if (selectivity.has_value() && *selectivity > kIndexScanMaxSelectivity) {
+                    // not selective enough, keep the table scan and filter all the conditions, the blocks are still pruned by the
+                    // fast rough filter
+                    LOG_TRACE(fmt::format("BuildSecondaryIndexScan: Estimated selectivity {} of the index scan filter. Keep the table scan.",
+                                          *selectivity));
+                    if (s_leftover) {
+                        Vector<SharedPtr<BaseExpression>> arguments;
+                        arguments.emplace_back(std::move(v_qualified));
+                        arguments.emplace_back(std::move(s_leftover));
+                        auto and_function_set_ptr = Catalog::GetFunctionSetByName(query_context_->storage()->catalog(), "AND");
+                        auto and_scalar_function_set_ptr = static_pointer_cast<ScalarFunctionSet>(and_function_set_ptr);
+                        ScalarFunction and_func = and_scalar_function_set_ptr->GetMostMatchFunction(arguments);
+                        s_leftover = MakeShared<FunctionExpression>(std::move(and_func), std::move(arguments));
+                    } else {
+                        s_leftover = std::move(v_qualified);
+                    }
                 } else {
                     // try to push down the qualified index filter condition to the scan
                     // replace logical table scan with logical index scan
@@ -0,0 +1,256 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <cstring>
+
+module plan_cache;
+
+import stl;
+import third_party;
+import logical_node;
+import base_statement;
+import select_statement;
+import base_table_reference;
+import table_reference;
+import parsed_expr;
+import column_expr;
+import constant_expr;
+import function_expr;
+import between_expr;
+import in_expr;
+import search_expr;
+import knn_expr;
+import statement_common;
+
+namespace infinity {
+
+namespace {
+
+// The strings are prefixed with their length, so that no two shapes have the same key.
+void AppendString(String &key, const char *str) {
+    SizeT len = str == nullptr ? 0 : std::strlen(str);
+    key += fmt::format("{}:", len);
+    key.append(str == nullptr ? "" : str, len);
+}
+
+void AppendString(String &key, const String &str) {
+    key += fmt::format("{}:", str.size());
+    key += str;
+}
+
+bool AppendExpr(String &key, const ParsedExpr *expr);
+
+bool AppendExprList(String &key, const Vector<ParsedExpr *> *exprs) {
+    if (exprs == nullptr) {
+        key += "[]";
+        return true;
+    }
+    key += fmt::format("[{}", exprs->size());
+    for (const ParsedExpr *expr : *exprs) {
+        if (!AppendExpr(key, expr)) {
+            return false;
+        }
+    }
+    key += ']';
+    return true;
+}
+
+bool AppendConstant(String &key, const ConstantExpr *constant) {
+    key += fmt::format("K{}", static_cast<i32>(constant->literal_type_));
+    switch (constant->literal_type_) {
+        case LiteralType::kBoolean: {
+            key += constant->bool_value_ ? '1' : '0';
+            return true;
+        }
+        case LiteralType::kInteger: {
+            key += fmt::format("{};", constant->integer_value_);
+            return true;
+        }
+        case LiteralType::kDouble: {
+            // the shortest representation that reads back to the same double
+            key += fmt::format("{};", constant->double_value_);
+            return true;
+        }
+        case LiteralType::kString: {
+            AppendString(key, constant->str_value_);
+            return true;
+        }
+        case LiteralType::kDate:
+        case LiteralType::kTime:
+        case LiteralType::kDateTime:
+        case LiteralType::kTimestamp: {
+            AppendString(key, constant->date_value_);
+            return true;
+        }
+        case LiteralType::kInterval: {
+            key += fmt::format("{},{};", constant->integer_value_, static_cast<i32>(constant->interval_type_));
+            return true;
+        }
+        case LiteralType::kNull: {
+            return true;
+        }
+        default: {
+            // arrays aren't expected in the shapes worth caching, and parameters can't be bound
+            return false;
+        }
+    }
+}
+
+bool AppendExpr(String &key, const ParsedExpr *expr) {
+    if (expr == nullptr) {
+        key += '~';
+        return true;
+    }
+    key += '(';
+    switch (expr->type_) {
+        case ParsedExprType::kColumn: {
+            const auto *column = static_cast<const ColumnExpr *>(expr);
+            key += fmt::format("C{}{}", column->star_ ? '*' : '-', column->names_.size());
+            for (const String &name : column->names_) {
+                AppendString(key, name);
+            }
+            break;
+        }
+        case ParsedExprType::kConstant: {
+            if (!AppendConstant(key, static_cast<const ConstantExpr *>(expr))) {
+                return false;
+            }
+            break;
+        }
+        case ParsedExprType::kFunction: {
+            const auto *function = static_cast<const FunctionExpr *>(expr);
+            key += function->distinct_ ? "FD" : "F";
+            AppendString(key, function->func_name_);
+            if (!AppendExprList(key, function->arguments_)) {
+                return false;
+            }
+            break;
+        }
+        case ParsedExprType::kBetween: {
+            const auto *between = static_cast<const BetweenExpr *>(expr);
+            key += 'B';
+            if (!AppendExpr(key, between->value_) || !AppendExpr(key, between->lower_bound_) || !AppendExpr(key, between->upper_bound_)) {
+                return false;
+            }
+            break;
+        }
+        case ParsedExprType::kIn: {
+            const auto *in = static_cast<const InExpr *>(expr);
+            key += in->not_in_ ? "NI" : "I";
+            if (!AppendExpr(key, in->left_) || !AppendExprList(key, in->arguments_)) {
+                return false;
+            }
+            break;
+        }
+        default: {
+            return false;
+        }
+    }
+    AppendString(key, expr->alias_);
+    key += ')';
+    return true;
+}
+
+bool AppendKnn(String &key, const KnnExpr *knn) {
+    key += fmt::format("KNN{},{},{},{}", knn->dimension_, static_cast<i32>(knn->embedding_data_type_), static_cast<i32>(knn->distance_type_), knn->topn_);
+    if (!AppendExpr(key, knn->column_expr_)) {
+        return false;
+    }
+    if (knn->opt_params_ != nullptr) {
+        key += fmt::format("[{}", knn->opt_params_->size());
+        for (const InitParameter *param : *knn->opt_params_) {
+            AppendString(key, param->param_name_);
+            AppendString(key, param->param_value_);
+        }
+        key += ']';
+    }
+    AppendString(key, knn->alias_);
+    return true;
+}
+
+} // namespace
+
+bool PlanCache::MakeKey(const BaseStatement *statement, const String &schema_name, String &key, const KnnExpr *&knn_expr) {
+    knn_expr = nullptr;
+    if (statement->type_ != StatementType::kSelect) {
+        return false;
+    }
+    const auto *select = static_cast<const SelectStatement *>(statement);
+    // the shape of a search from the clients: one table, the output columns, a filter, a limit, and at most one knn search
+    if (select->select_distinct_ || select->group_by_list_ != nullptr || select->having_expr_ != nullptr || select->order_by_list != nullptr ||
+        select->with_exprs_ != nullptr || select->nested_select_ != nullptr) {
+        return false;
+    }
+    if (select->table_ref_ == nullptr || select->table_ref_->type_ != TableRefType::kTable || select->table_ref_->alias_ != nullptr) {
+        return false;
+    }
+    const auto *table_ref = static_cast<const TableReference *>(select->table_ref_);
+
+    key.clear();
+    AppendString(key, schema_name);
+    AppendString(key, table_ref->db_name_);
+    AppendString(key, table_ref->table_name_);
+    if (!AppendExprList(key, select->select_list_) || !AppendExpr(key, select->where_expr_) || !AppendExpr(key, select->limit_expr_) ||
+        !AppendExpr(key, select->offset_expr_)) {
+        return false;
+    }
+    if (select->search_expr_ != nullptr) {
+        const auto *search = static_cast<const SearchExpr *>(select->search_expr_);
+        if (!search->match_exprs_.empty() || search->fusion_expr_ != nullptr || search->knn_exprs_.size() != 1) {
+            return false;
+        }
+        knn_expr = search->knn_exprs_[0];
+        if (!AppendKnn(key, knn_expr)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+SharedPtr<const CachedPlan> PlanCache::Get(const String &key) {
+    std::unique_lock lock(mutex_);
+    auto iter = entries_.find(key);
+    if (iter == entries_.end()) {
+        return nullptr;
+    }
+    lru_.splice(lru_.begin(), lru_, iter->second);
+    return iter->second->second;
+}
+
+void PlanCache::Put(const String &key, SharedPtr<const CachedPlan> plan) {
+    if (capacity_ == 0) {
+        return;
+    }
+    std::unique_lock lock(mutex_);
+    if (auto iter = entries_.find(key); iter != entries_.end()) {
+        iter->second->second = std::move(plan);
+        lru_.splice(lru_.begin(), lru_, iter->second);
+        return;
+    }
+    lru_.emplace_front(key, std::move(plan));
+    entries_.emplace(key, lru_.begin());
+    if (lru_.size() > capacity_) {
+        entries_.erase(lru_.back().first);
+        lru_.pop_back();
+    }
+}
+
+SizeT PlanCache::size() {
+    std::unique_lock lock(mutex_);
+    return lru_.size();
+}
+
+} // namespace infinity
@@ -0,0 +1,68 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module plan_cache;
+
+import stl;
+import logical_node;
+import base_statement;
+import knn_expr;
+
+namespace infinity {
+
+// An optimized logical plan, it is only read once cached, the physical planner doesn't take anything out of it.
+export struct CachedPlan {
+    SharedPtr<LogicalNode> logical_plan_{};
+    u64 max_node_id_{};
+    // TxnManager::write_version() before the txn that built the plan began, no write was committing then
+    u64 write_version_{};
+
+    // A txn which began at txn_write_version sees the snapshot of the plan only if it began at the same version, a txn begun
+    // before a commit must not take the plan of a newer snapshot. current_write_version is the version when the plan is looked up.
+    bool UsableBy(u64 txn_write_version, u64 current_write_version) const {
+        return write_version_ == txn_write_version && txn_write_version == current_write_version;
+    }
+};
+
+// Optimized logical plans of recent selects, by the shape of the statement. The query embedding of the knn search isn't part of
+// the shape: a plan found here is used with the embedding of the new statement. The constants of the filter and of the limit are
+// part of it, since the optimizer turns them into index ranges and rough filters. A plan holds the block index of its snapshot,
+// the caller only uses it while the write version of the TxnManager is unchanged.
+export class PlanCache {
+public:
+    explicit PlanCache(SizeT capacity) : capacity_(capacity) {}
+
+    // False if the statement can't use a cached plan. Otherwise the shape of the statement in the current schema, and the knn
+    // expression whose embedding is left out of it, if any.
+    static bool MakeKey(const BaseStatement *statement, const String &schema_name, String &key, const KnnExpr *&knn_expr);
+
+    SharedPtr<const CachedPlan> Get(const String &key);
+
+    void Put(const String &key, SharedPtr<const CachedPlan> plan);
+
+    SizeT size();
+
+private:
+    using LruList = List<Pair<String, SharedPtr<const CachedPlan>>>;
+
+    const SizeT capacity_;
+    std::mutex mutex_{};
+    // most recently used first
+    LruList lru_{};
+    HashMap<String, LruList::iterator> entries_{};
+};
+
+} // namespace infinity
@@ -919,9 +919,10 @@ void QueryBinder::CheckKnnAndOrderBy(KnnDistanceType distance_type, OrderType or
             break;
         }
         case KnnDistanceType::kInnerProduct:
-        case KnnDistanceType::kCosine: {
+        case KnnDistanceType::kCosine:
+        case KnnDistanceType::kMaxSim: {
             if (order_type != OrderType::kDesc) {
-                RecoverableError(Status::SyntaxError("Inner product and cosine distance need descending order"));
+                RecoverableError(Status::SyntaxError("Inner product, cosine and maxsim distance need descending order"));
             }
             break;
         }
@@ -0,0 +1,36 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module statistics_aggregate;
+
+import stl;
+
+namespace infinity {
+
+export enum class StatisticsAggregateType {
+    kCount,
+    kMin,
+    kMax,
+};
+
+// An aggregate without group by over a table scan, which the scan answers for the blocks it can from their row count and their
+// minmax filter instead of reading their rows.
+export struct StatisticsAggregate {
+    StatisticsAggregateType type_{StatisticsAggregateType::kCount};
+    ColumnID column_id_{}; // the column of the table, for min and max
+};
+
+} // namespace infinity
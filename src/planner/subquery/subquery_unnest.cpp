@@ -40,6 +40,11 @@ import logical_join;
 import logical_limit;
 import logical_aggregate;
 import logical_cross_product;
+import logical_project;
+import logical_filter;
+import logical_node_type;
+import conjunct_helper;
+import corrlated_expr_detector;
 
 import function_set;
 import scalar_function;
@@ -59,6 +64,153 @@ import data_type;
 
 namespace infinity {
 
+namespace {
+
+void CheckCorrelatedColumns(const Vector<SharedPtr<ColumnExpression>> &correlated_columns) {
+    if (correlated_columns.empty()) {
+        RecoverableError(Status::SyntaxError("No correlated column"));
+    }
+
+    // Valid the correlated columns are from one table.
+    SizeT column_count = correlated_columns.size();
+    SizeT table_index = correlated_columns[0]->binding().table_idx;
+    for (SizeT idx = 1; idx < column_count; ++idx) {
+        if (table_index != correlated_columns[idx]->binding().table_idx) {
+            RecoverableError(Status::SyntaxError("Correlated columns can be only from one table, now."));
+        }
+    }
+}
+
+SharedPtr<BaseExpression> MakeEqualExpression(QueryContext *query_context, SharedPtr<BaseExpression> left, SharedPtr<BaseExpression> right) {
+    Vector<SharedPtr<BaseExpression>> function_arguments;
+    function_arguments.reserve(2);
+    function_arguments.emplace_back(std::move(left));
+    function_arguments.emplace_back(std::move(right));
+
+    Catalog *catalog = query_context->storage()->catalog();
+    SharedPtr<FunctionSet> function_set_ptr = Catalog::GetFunctionSetByName(catalog, "=");
+    auto scalar_function_set_ptr = static_pointer_cast<ScalarFunctionSet>(function_set_ptr);
+    ScalarFunction equi_function = scalar_function_set_ptr->GetMostMatchFunction(function_arguments);
+    return MakeShared<FunctionExpression>(equi_function, function_arguments);
+}
+
+bool IsCorrelatedExpression(const Vector<SharedPtr<ColumnExpression>> &correlated_columns, SharedPtr<BaseExpression> expression) {
+    CorrelatedExpressionsDetector detector(correlated_columns);
+    detector.VisitExpression(expression);
+    return detector.IsCorrelated();
+}
+
+bool IsCorrelatedPlan(const Vector<SharedPtr<ColumnExpression>> &correlated_columns, LogicalNode &op) {
+    CorrelatedExpressionsDetector detector(correlated_columns);
+    detector.VisitNode(op);
+    if (detector.IsCorrelated()) {
+        return true;
+    }
+    if (op.left_node().get() != nullptr && IsCorrelatedPlan(correlated_columns, *op.left_node())) {
+        return true;
+    }
+    return op.right_node().get() != nullptr && IsCorrelatedPlan(correlated_columns, *op.right_node());
+}
+
+// (outer column, inner column) of a conjunct "inner column = outer column"
+Optional<Pair<SharedPtr<ColumnExpression>, SharedPtr<ColumnExpression>>> CorrelatedEquality(const SharedPtr<BaseExpression> &conjunct) {
+    if (conjunct->type() != ExpressionType::kFunction) {
+        return None;
+    }
+    auto *function_expression = static_cast<FunctionExpression *>(conjunct.get());
+    auto &arguments = function_expression->arguments();
+    if (function_expression->ScalarFunctionName() != "=" || arguments.size() != 2) {
+        return None;
+    }
+    if (arguments[0]->type() != ExpressionType::kColumn || arguments[1]->type() != ExpressionType::kColumn) {
+        return None;
+    }
+    auto lhs = static_pointer_cast<ColumnExpression>(arguments[0]);
+    auto rhs = static_pointer_cast<ColumnExpression>(arguments[1]);
+    if (lhs->Type() != rhs->Type() || lhs->IsCorrelated() == rhs->IsCorrelated() || lhs->special().has_value() || rhs->special().has_value()) {
+        return None;
+    }
+    using ColumnPair = Pair<SharedPtr<ColumnExpression>, SharedPtr<ColumnExpression>>;
+    return lhs->IsCorrelated() ? ColumnPair(lhs, rhs) : ColumnPair(rhs, lhs);
+}
+
+// The subquery is a projection over filters, and its only correlated conjuncts are "inner column = outer column". The conjuncts
+// are moved out of the subquery as the conditions of the join and the inner columns are put first in the projection, the
+// subquery is joined as it is instead of as the cross product with the outer table built by DependentJoinFlattener.
+// Returns the number of inner columns put in the projection, 0 if the subquery isn't of this form and nothing is changed.
+SizeT PullUpCorrelatedConditions(QueryContext *query_context,
+                                 const Vector<SharedPtr<ColumnExpression>> &correlated_columns,
+                                 const SharedPtr<LogicalNode> &subquery_plan,
+                                 Vector<SharedPtr<BaseExpression>> &join_conditions) {
+    if (subquery_plan->operator_type() != LogicalNodeType::kProjection) {
+        return 0;
+    }
+    auto &project = static_cast<LogicalProject &>(*subquery_plan);
+    for (const auto &expression : project.expressions_) {
+        if (IsCorrelatedExpression(correlated_columns, expression)) {
+            return 0;
+        }
+    }
+
+    Vector<SharedPtr<LogicalNode>> filters;
+    Vector<Vector<SharedPtr<BaseExpression>>> kept_conjuncts;
+    Vector<Pair<SharedPtr<ColumnExpression>, SharedPtr<ColumnExpression>>> equalities;
+    SharedPtr<LogicalNode> input = project.left_node();
+    while (input.get() != nullptr && input->operator_type() == LogicalNodeType::kFilter) {
+        Vector<SharedPtr<BaseExpression>> conjuncts;
+        ConjunctHelper::SplitConjuncts(static_cast<LogicalFilter &>(*input).expression(), conjuncts);
+        Vector<SharedPtr<BaseExpression>> &kept = kept_conjuncts.emplace_back();
+        for (const auto &conjunct : conjuncts) {
+            auto equality = CorrelatedEquality(conjunct);
+            if (equality.has_value()) {
+                equalities.emplace_back(std::move(*equality));
+            } else if (IsCorrelatedExpression(correlated_columns, conjunct)) {
+                return 0;
+            } else {
+                kept.emplace_back(conjunct);
+            }
+        }
+        filters.emplace_back(input);
+        input = input->left_node();
+    }
+    if (equalities.empty() || (input.get() != nullptr && IsCorrelatedPlan(correlated_columns, *input))) {
+        return 0;
+    }
+
+    // a filter left without conjuncts is removed
+    SharedPtr<LogicalNode> parent = subquery_plan;
+    for (SizeT idx = 0; idx < filters.size(); ++idx) {
+        if (kept_conjuncts[idx].empty()) {
+            parent->set_left_node(filters[idx]->left_node());
+            continue;
+        }
+        static_cast<LogicalFilter &>(*filters[idx]).expression() = ConjunctHelper::ComposeConjuncts(query_context, kept_conjuncts[idx]);
+        parent->set_left_node(filters[idx]);
+        parent = filters[idx];
+    }
+
+    // The inner columns are the first outputs, the columns which aren't read are pruned from the end of the projection
+    Vector<SharedPtr<BaseExpression>> inner_columns;
+    inner_columns.reserve(equalities.size());
+    for (SizeT idx = 0; idx < equalities.size(); ++idx) {
+        const auto &[outer_column, inner_column] = equalities[idx];
+        inner_columns.emplace_back(inner_column);
+        SharedPtr<ColumnExpression> left_column = ColumnExpression::Make(outer_column->Type(),
+                                                                         outer_column->table_name(),
+                                                                         outer_column->binding().table_idx,
+                                                                         outer_column->column_name(),
+                                                                         outer_column->binding().column_idx,
+                                                                         0);
+        SharedPtr<ColumnExpression> right_column =
+            ColumnExpression::Make(inner_column->Type(), inner_column->table_name(), project.table_index_, inner_column->column_name(), idx, 0);
+        join_conditions.emplace_back(MakeEqualExpression(query_context, left_column, right_column));
+    }
+    project.expressions_.insert(project.expressions_.begin(), inner_columns.begin(), inner_columns.end());
+    return inner_columns.size();
+}
+
+} // namespace
+
 void SubqueryUnnest::UnnestSubqueries(SharedPtr<BaseExpression> &expr_ptr,
                                       SharedPtr<LogicalNode> &root,
                                       QueryContext *query_context,
@@ -222,19 +374,7 @@ SharedPtr<BaseExpression> SubqueryUnnest::UnnestCorrelated(SubqueryExpression *e
                                                            QueryContext *query_context,
                                                            const SharedPtr<BindContext> &bind_context) {
     auto &correlated_columns = bind_context->correlated_column_exprs_;
-
-    if (correlated_columns.empty()) {
-        RecoverableError(Status::SyntaxError("No correlated column"));
-    }
-
-    // Valid the correlated columns are from one table.
-    SizeT column_count = correlated_columns.size();
-    SizeT table_index = correlated_columns[0]->binding().table_idx;
-    for (SizeT idx = 1; idx < column_count; ++idx) {
-        if (table_index != correlated_columns[idx]->binding().table_idx) {
-            RecoverableError(Status::SyntaxError("Correlated columns can be only from one table, now."));
-        }
-    }
+    CheckCorrelatedColumns(correlated_columns);
 
     switch (expr_ptr->subquery_type_) {
 
@@ -397,6 +537,68 @@ SharedPtr<BaseExpression> SubqueryUnnest::UnnestCorrelated(SubqueryExpression *e
     return nullptr;
 }
 
+bool SubqueryUnnest::CanUnnestAsSemiJoin(const SubqueryExpression *expr_ptr, bool correlated) {
+    switch (expr_ptr->subquery_type_) {
+        case SubqueryType::kIn: {
+            return true;
+        }
+        case SubqueryType::kExists:
+        case SubqueryType::kNotExists: {
+            // an uncorrelated EXISTS has no condition to join on
+            return correlated;
+        }
+        default: {
+            return false;
+        }
+    }
+}
+
+void SubqueryUnnest::UnnestAsSemiJoin(SubqueryExpression *expr_ptr,
+                                      SharedPtr<LogicalNode> &root,
+                                      SharedPtr<LogicalNode> &subquery_plan,
+                                      QueryContext *query_context,
+                                      const SharedPtr<BindContext> &bind_context,
+                                      bool correlated) {
+    Vector<SharedPtr<BaseExpression>> join_conditions;
+    SharedPtr<LogicalNode> right = subquery_plan;
+    // the first output column of the subquery
+    SizeT output_begin = 0;
+    if (correlated) {
+        auto &correlated_columns = bind_context->correlated_column_exprs_;
+        CheckCorrelatedColumns(correlated_columns);
+        output_begin = PullUpCorrelatedConditions(query_context, correlated_columns, subquery_plan, join_conditions);
+        if (output_begin == 0) {
+            DependentJoinFlattener dependent_join_flattener(bind_context, query_context);
+            dependent_join_flattener.DetectCorrelatedExpressions(subquery_plan);
+            // Push down the dependent join, the correlated columns become equal conditions of the join
+            right = dependent_join_flattener.PushDependentJoin(subquery_plan);
+            GenerateJoinConditions(query_context,
+                                   join_conditions,
+                                   correlated_columns,
+                                   right->GetColumnBindings(),
+                                   dependent_join_flattener.CorrelatedColumnBaseIndex());
+        }
+    }
+
+    if (expr_ptr->subquery_type_ == SubqueryType::kIn) {
+        // The left operand equals the first output column of the subquery
+        ColumnBinding right_column_binding = right->GetColumnBindings()[output_begin];
+        SharedPtr<ColumnExpression> right_column = ColumnExpression::Make(*right->GetOutputTypes()->at(output_begin),
+                                                                          "",
+                                                                          right_column_binding.table_idx,
+                                                                          right->GetOutputNames()->at(output_begin),
+                                                                          right_column_binding.column_idx,
+                                                                          0);
+        join_conditions.emplace_back(
+            MakeEqualExpression(query_context, expr_ptr->left_, CastExpression::AddCastToType(right_column, expr_ptr->left_->Type())));
+    }
+
+    JoinType join_type = expr_ptr->subquery_type_ == SubqueryType::kNotExists ? JoinType::kAnti : JoinType::kSemi;
+    u64 logical_node_id = bind_context->GetNewLogicalNodeId();
+    String alias = fmt::format("logical_join{}", logical_node_id);
+    root = MakeShared<LogicalJoin>(logical_node_id, join_type, alias, join_conditions, root, right);
+}
+
 void SubqueryUnnest::GenerateJoinConditions(QueryContext *query_context,
                                             Vector<SharedPtr<BaseExpression>> &join_conditions,
                                             const Vector<SharedPtr<ColumnExpression>> &correlated_columns,
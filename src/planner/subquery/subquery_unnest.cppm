@@ -52,6 +52,18 @@ public:
                                                       QueryContext *query_context,
                                                       const SharedPtr<BindContext> &bind_context);
 
+    // An IN, or a correlated EXISTS or NOT EXISTS, subquery which is a conjunct of the WHERE clause only keeps or drops the rows
+    // of the outer plan. It is planned as a semi or anti join which outputs the outer rows, instead of a mark join.
+    // NOT IN stays a mark join: a NULL in the subquery drops every row, which an anti join doesn't do.
+    static bool CanUnnestAsSemiJoin(const SubqueryExpression *expr_ptr, bool correlated);
+
+    static void UnnestAsSemiJoin(SubqueryExpression *expr_ptr,
+                                 SharedPtr<LogicalNode> &root,
+                                 SharedPtr<LogicalNode> &subquery_plan,
+                                 QueryContext *query_context,
+                                 const SharedPtr<BindContext> &bind_context,
+                                 bool correlated);
+
 private:
     static void GenerateJoinConditions(QueryContext *query_context,
                                        Vector<SharedPtr<BaseExpression>> &conditions,
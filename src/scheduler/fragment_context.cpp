@@ -33,29 +33,42 @@ import physical_table_scan;
 import physical_index_scan;
 import physical_knn_scan;
 import physical_aggregate;
+import physical_merge_parallel_aggregate;
 import physical_explain;
 import physical_create_index_prepare;
 import physical_create_index_do;
+import physical_export;
 import physical_sort;
+import physical_project;
+import physical_filter;
 import physical_top;
 import physical_merge_top;
+import physical_merge_sort;
 
 import global_block_id;
+import block_index;
 import knn_expression;
 import value_expression;
 import column_expression;
 import third_party;
 import query_context;
+import query_progress;
+import txn;
 import physical_source;
 import physical_sink;
 import data_table;
 import data_block;
 import physical_merge_knn;
+import physical_match;
+import physical_merge_match;
+import match_scan_data;
 import merge_knn_data;
 import create_index_data;
 import logger;
 import task_scheduler;
+import default_values;
 import plan_fragment;
+import join_runtime_filter;
 import aggregate_expression;
 import expression_state;
 import column_def;
@@ -76,6 +89,24 @@ UniquePtr<OperatorState> MakeCreateIndexDoState(PhysicalCreateIndexDo *physical_
     return operator_state;
 }
 
+UniquePtr<OperatorState> MakeExportState(PhysicalExport *physical_export, FragmentTask *task, FragmentContext *fragment_ctx) {
+    UniquePtr<ExportOperatorState> operator_state = MakeUnique<ExportOperatorState>();
+    auto *parallel_materialize_fragment_ctx = static_cast<ParallelMaterializedFragmentCtx *>(fragment_ctx);
+    operator_state->block_ids_ = std::move(parallel_materialize_fragment_ctx->export_task_blocks_[task->TaskID()]);
+    operator_state->export_shared_data_ = parallel_materialize_fragment_ctx->export_shared_data_.get();
+    return operator_state;
+}
+
+UniquePtr<OperatorState> MakeMatchState(PhysicalMatch *physical_match, FragmentTask *task, FragmentContext *fragment_ctx) {
+    UniquePtr<MatchOperatorState> operator_state = MakeUnique<MatchOperatorState>();
+    if (fragment_ctx->ContextType() == FragmentType::kParallelMaterialize) {
+        auto *parallel_materialize_fragment_ctx = static_cast<ParallelMaterializedFragmentCtx *>(fragment_ctx);
+        operator_state->segment_ids_ = parallel_materialize_fragment_ctx->match_task_segments_[task->TaskID()];
+        operator_state->match_shared_data_ = parallel_materialize_fragment_ctx->match_shared_data_.get();
+    }
+    return operator_state;
+}
+
 UniquePtr<OperatorState> MakeTableScanState(PhysicalTableScan *physical_table_scan, FragmentTask *task) {
     SourceState *source_state = task->source_state_.get();
 
@@ -88,7 +119,7 @@ UniquePtr<OperatorState> MakeTableScanState(PhysicalTableScan *physical_table_sc
     UniquePtr<OperatorState> operator_state = MakeUnique<TableScanOperatorState>();
     TableScanOperatorState *table_scan_op_state_ptr = (TableScanOperatorState *)(operator_state.get());
     table_scan_op_state_ptr->table_scan_function_data_ = MakeUnique<TableScanFunctionData>(physical_table_scan->GetBlockIndex(),
-                                                                                           table_scan_source_state->global_ids_,
+                                                                                           table_scan_source_state->shared_data_.get(),
                                                                                            physical_table_scan->ColumnIDs());
     return operator_state;
 }
@@ -150,6 +181,7 @@ UniquePtr<OperatorState> MakeMergeKnnState(PhysicalMergeKnn *physical_merge_knn,
                                                                                         knn_expr->topn_,
                                                                                         knn_expr->embedding_data_type_,
                                                                                         knn_expr->distance_type_,
+                                                                                        knn_expr->threshold_,
                                                                                         physical_merge_knn->table_ref_);
 
     return operator_state;
@@ -188,6 +220,48 @@ UniquePtr<OperatorState> MakeMergeTopState(PhysicalOperator *physical_op) {
     return operator_state;
 }
 
+UniquePtr<OperatorState> MakeMergeSortState(PhysicalOperator *physical_op) {
+    auto operator_state = MakeUnique<MergeSortOperatorState>();
+    auto &expr_states = operator_state->expr_states_;
+    auto &sort_expressions = (static_cast<PhysicalMergeSort *>(physical_op))->GetSortExpressions();
+    expr_states.reserve(sort_expressions.size());
+    for (auto &expr : sort_expressions) {
+        expr_states.emplace_back(ExpressionState::CreateState(expr));
+    }
+    return operator_state;
+}
+
+// The last operator of a child fragment sends its output to the parent fragment through the local queue.
+bool SinkToLocalQueue(PlanFragment *fragment_ptr) { return fragment_ptr->GetSinkNode()->sink_type() == SinkType::kLocalQueue; }
+
+// Blocks with a selection are materialized by the sink, projection evaluates its expressions on the selected rows.
+// Other operators read the column vectors directly and need dense blocks.
+bool AcceptSelection(SizeT operator_id, const Vector<PhysicalOperator *> &physical_ops) {
+    return operator_id == 0 || physical_ops[operator_id - 1]->operator_type() == PhysicalOperatorType::kProjection;
+}
+
+UniquePtr<OperatorState> MakeHashJoinState(FragmentContext *fragment_ctx) {
+    auto operator_state = MakeUnique<HashJoinOperatorState>();
+    // Child fragments are added in the order of left and right input.
+    auto &child_fragments = fragment_ctx->fragment_ptr()->Children();
+    if (child_fragments.size() != 2) {
+        UnrecoverableError("Hash join should have two child fragments.");
+    }
+    operator_state->left_fragment_id_ = child_fragments[0]->FragmentID();
+    return operator_state;
+}
+
+UniquePtr<OperatorState> MakeMergeJoinState(FragmentContext *fragment_ctx) {
+    auto operator_state = MakeUnique<MergeJoinOperatorState>();
+    // Child fragments are added in the order of left and right input.
+    auto &child_fragments = fragment_ctx->fragment_ptr()->Children();
+    if (child_fragments.size() != 2) {
+        UnrecoverableError("Sort merge join should have two child fragments.");
+    }
+    operator_state->left_fragment_id_ = child_fragments[0]->FragmentID();
+    return operator_state;
+}
+
 UniquePtr<OperatorState>
 MakeTaskState(SizeT operator_id, const Vector<PhysicalOperator *> &physical_ops, FragmentTask *task, FragmentContext *fragment_ctx) {
     switch (physical_ops[operator_id]->operator_type()) {
@@ -200,7 +274,7 @@ MakeTaskState(SizeT operator_id, const Vector<PhysicalOperator *> &physical_ops,
                 UnrecoverableError("Table scan operator must be the first operator of the fragment.");
             }
 
-            if (operator_id == 0) {
+            if (operator_id == 0 && fragment_ctx->GetSinkOperator()->sink_type() != SinkType::kLocalQueue) {
                 UnrecoverableError("Table scan shouldn't be the last operator of the fragment.");
             }
             auto physical_table_scan = static_cast<PhysicalTableScan *>(physical_ops[operator_id]);
@@ -224,14 +298,19 @@ MakeTaskState(SizeT operator_id, const Vector<PhysicalOperator *> &physical_ops,
             return MakeTaskStateTemplate<MergeParallelAggregateOperatorState>(physical_ops[operator_id]);
         }
         case PhysicalOperatorType::kFilter: {
-            return MakeTaskStateTemplate<FilterOperatorState>(physical_ops[operator_id]);
+            auto operator_state = MakeUnique<FilterOperatorState>();
+            operator_state->keep_selection_ = AcceptSelection(operator_id, physical_ops);
+            // The common subexpressions of the conjuncts share one state
+            auto physical_filter = static_cast<PhysicalFilter *>(physical_ops[operator_id]);
+            operator_state->condition_state_ = ExpressionState::CreateStates({physical_filter->condition()})[0];
+            return operator_state;
         }
         case PhysicalOperatorType::kIndexScan: {
             if (operator_id != physical_ops.size() - 1) {
                 UnrecoverableError("Table scan operator must be the first operator of the fragment.");
             }
 
-            if (operator_id == 0) {
+            if (operator_id == 0 && fragment_ctx->GetSinkOperator()->sink_type() != SinkType::kLocalQueue) {
                 UnrecoverableError("Table scan shouldn't be the last operator of the fragment.");
             }
             auto physical_index_scan = static_cast<PhysicalIndexScan *>(physical_ops[operator_id]);
@@ -260,13 +339,17 @@ MakeTaskState(SizeT operator_id, const Vector<PhysicalOperator *> &physical_ops,
             return MakeMergeTopState(physical_ops[operator_id]);
         }
         case PhysicalOperatorType::kProjection: {
-            return MakeTaskStateTemplate<ProjectionOperatorState>(physical_ops[operator_id]);
+            auto operator_state = MakeUnique<ProjectionOperatorState>();
+            operator_state->keep_selection_ = AcceptSelection(operator_id, physical_ops);
+            // The common subexpressions share one state
+            operator_state->expr_states_ = ExpressionState::CreateStates(static_cast<PhysicalProject *>(physical_ops[operator_id])->expressions_);
+            return operator_state;
         }
         case PhysicalOperatorType::kSort: {
             return MakeSortState(physical_ops[operator_id]);
         }
         case PhysicalOperatorType::kMergeSort: {
-            return MakeTaskStateTemplate<MergeSortOperatorState>(physical_ops[operator_id]);
+            return MakeMergeSortState(physical_ops[operator_id]);
         }
         case PhysicalOperatorType::kDelete: {
             return MakeTaskStateTemplate<DeleteOperatorState>(physical_ops[operator_id]);
@@ -281,7 +364,8 @@ MakeTaskState(SizeT operator_id, const Vector<PhysicalOperator *> &physical_ops,
             return MakeTaskStateTemplate<ImportOperatorState>(physical_ops[operator_id]);
         }
         case PhysicalOperatorType::kExport: {
-            return MakeTaskStateTemplate<ExportOperatorState>(physical_ops[operator_id]);
+            auto *physical_export = static_cast<PhysicalExport *>(physical_ops[operator_id]);
+            return MakeExportState(physical_export, task, fragment_ctx);
         }
         case PhysicalOperatorType::kFlush: {
             return MakeTaskStateTemplate<FlushOperatorState>(physical_ops[operator_id]);
@@ -336,11 +420,24 @@ MakeTaskState(SizeT operator_id, const Vector<PhysicalOperator *> &physical_ops,
             return MakeTaskStateTemplate<ShowOperatorState>(physical_ops[operator_id]);
         }
         case PhysicalOperatorType::kMatch: {
-            return MakeTaskStateTemplate<MatchOperatorState>(physical_ops[operator_id]);
+            auto *physical_match = static_cast<PhysicalMatch *>(physical_ops[operator_id]);
+            return MakeMatchState(physical_match, task, fragment_ctx);
+        }
+        case PhysicalOperatorType::kMergeMatch: {
+            return MakeTaskStateTemplate<MergeMatchOperatorState>(physical_ops[operator_id]);
         }
         case PhysicalOperatorType::kFusion: {
             return MakeTaskStateTemplate<FusionOperatorState>(physical_ops[operator_id]);
         }
+        case PhysicalOperatorType::kJoinHash: {
+            return MakeHashJoinState(fragment_ctx);
+        }
+        case PhysicalOperatorType::kJoinMerge: {
+            return MakeMergeJoinState(fragment_ctx);
+        }
+        case PhysicalOperatorType::kUnionAll: {
+            return MakeTaskStateTemplate<UnionAllOperatorState>(physical_ops[operator_id]);
+        }
         default: {
             UnrecoverableError(fmt::format("Not support {} now", PhysicalOperatorToString(physical_ops[operator_id]->operator_type())));
         }
@@ -412,6 +509,7 @@ void FragmentContext::BuildTask(QueryContext *query_context, FragmentContext *pa
 
     Vector<UniquePtr<FragmentTask>> &tasks = fragment_context->Tasks();
     i64 real_parallel_size = tasks.size();
+    query_context->progress()->AddFragment(real_parallel_size);
 
     for (i64 operator_id = operator_count - 1; operator_id >= 0; --operator_id) {
 
@@ -510,6 +608,14 @@ bool FragmentContext::TryFinishFragment() {
     } else {
         LOG_TRACE(fmt::format("All tasks in fragment: {} are completed", fragment_id));
 
+        if (auto *runtime_filter = fragment_ptr_->GetRuntimeFilter(); runtime_filter != nullptr) {
+            // all the build keys are in the runtime filter, the probe fragment can start
+            runtime_filter->Publish();
+            PlanFragment *probe_fragment = fragment_ptr_->GetProbeFragment();
+            LOG_TRACE(fmt::format("Schedule fragment: {} because its runtime filter is published.", probe_fragment->FragmentID()));
+            query_context_->scheduler()->ScheduleFragment(probe_fragment);
+        }
+
         if (parent_plan_fragment != nullptr) {
             auto *parent_fragment_ctx = parent_plan_fragment->GetContext();
             if (parent_fragment_ctx->TryStartFragment()) {
@@ -526,12 +632,32 @@ bool FragmentContext::TryFinishFragment() {
     }
 }
 
+void FragmentContext::ScheduleStreamParent() {
+    auto *parent_plan_fragment = fragment_ptr_->GetParent();
+    if (fragment_type_ != FragmentType::kParallelStream || parent_plan_fragment == nullptr) {
+        return;
+    }
+    query_context_->scheduler()->WakeUpFragment(parent_plan_fragment);
+}
+
 Vector<PhysicalOperator *> &FragmentContext::GetOperators() { return fragment_ptr_->GetOperators(); }
 
 PhysicalSink *FragmentContext::GetSinkOperator() const { return fragment_ptr_->GetSinkNode(); }
 
 PhysicalSource *FragmentContext::GetSourceOperator() const { return fragment_ptr_->GetSourceNode(); }
 
+// Tasks worth spending on a scan of `estimated_rows` rows: a small scan runs on one task, and under load a fragment
+// doesn't ask for more tasks than there are idle workers.
+i64 EstimatedScanParallelism(i64 parallel_count, SizeT estimated_rows, QueryContext *query_context) {
+    i64 work_task_n = static_cast<i64>((estimated_rows + PARALLEL_SCAN_MIN_ROWS_PER_TASK - 1) / PARALLEL_SCAN_MIN_ROWS_PER_TASK);
+    parallel_count = std::min(parallel_count, work_task_n);
+    TaskScheduler *scheduler = query_context->scheduler();
+    if (scheduler != nullptr && parallel_count > 1) {
+        parallel_count = std::min(parallel_count, static_cast<i64>(scheduler->IdleWorkerCount()));
+    }
+    return std::max(parallel_count, 1l);
+}
+
 SizeT InitKnnScanFragmentContext(PhysicalKnnScan *knn_scan_operator, FragmentContext *fragment_context, QueryContext *query_context) {
 
     SizeT task_n = knn_scan_operator->TaskCount();
@@ -550,7 +676,8 @@ SizeT InitKnnScanFragmentContext(PhysicalKnnScan *knn_scan_operator, FragmentCon
                                               1,
                                               knn_expr->query_embedding_.ptr,
                                               knn_expr->embedding_data_type_,
-                                              knn_expr->distance_type_);
+                                              knn_expr->distance_type_,
+                                              knn_expr->threshold_);
             break;
         }
         case FragmentType::kParallelMaterialize: {
@@ -566,7 +693,8 @@ SizeT InitKnnScanFragmentContext(PhysicalKnnScan *knn_scan_operator, FragmentCon
                                               1,
                                               knn_expr->query_embedding_.ptr,
                                               knn_expr->embedding_data_type_,
-                                              knn_expr->distance_type_);
+                                              knn_expr->distance_type_,
+                                              knn_expr->threshold_);
             break;
         }
         default: {
@@ -594,6 +722,14 @@ void FragmentContext::MakeSourceState(i64 parallel_count) {
             UnrecoverableError("Unexpected operator type");
         }
         case PhysicalOperatorType::kAggregate: {
+            if (fragment_type_ == FragmentType::kSerialMaterialize) {
+                // Group by aggregate gets the input from the child fragment.
+                if (tasks_.size() != 1) {
+                    UnrecoverableError(fmt::format("{} task count isn't correct.", PhysicalOperatorToString(first_operator->operator_type())));
+                }
+                tasks_[0]->source_state_ = MakeUnique<QueueSourceState>();
+                break;
+            }
             if (fragment_type_ != FragmentType::kParallelMaterialize) {
                 UnrecoverableError(
                     fmt::format("{} should in parallel materialized fragment", PhysicalOperatorToString(first_operator->operator_type())));
@@ -620,6 +756,17 @@ void FragmentContext::MakeSourceState(i64 parallel_count) {
             }
             break;
         }
+        case PhysicalOperatorType::kMergeParallelAggregate: {
+            // Each merge task gets one partition of the partial results from its own queue.
+            if (fragment_type_ != FragmentType::kParallelMaterialize && fragment_type_ != FragmentType::kSerialMaterialize) {
+                UnrecoverableError(
+                    fmt::format("{} should in parallel/serial materialized fragment", PhysicalOperatorToString(first_operator->operator_type())));
+            }
+            for (auto &task : tasks_) {
+                task->source_state_ = MakeUnique<QueueSourceState>();
+            }
+            break;
+        }
         case PhysicalOperatorType::kParallelAggregate:
         case PhysicalOperatorType::kFilter:
         case PhysicalOperatorType::kHash:
@@ -637,7 +784,10 @@ void FragmentContext::MakeSourceState(i64 parallel_count) {
         case PhysicalOperatorType::kMergeTop:
         case PhysicalOperatorType::kMergeSort:
         case PhysicalOperatorType::kMergeKnn:
-        case PhysicalOperatorType::kFusion: {
+        case PhysicalOperatorType::kMergeMatch:
+        case PhysicalOperatorType::kFusion:
+        case PhysicalOperatorType::kJoinHash:
+        case PhysicalOperatorType::kJoinMerge: {
             if (fragment_type_ != FragmentType::kSerialMaterialize) {
                 UnrecoverableError(
                     fmt::format("{} should be serial materialized fragment", PhysicalOperatorToString(first_operator->operator_type())));
@@ -650,6 +800,7 @@ void FragmentContext::MakeSourceState(i64 parallel_count) {
             tasks_[0]->source_state_ = MakeUnique<QueueSourceState>();
             break;
         }
+        case PhysicalOperatorType::kExport:
         case PhysicalOperatorType::kCreateIndexDo: {
             if (fragment_type_ != FragmentType::kParallelMaterialize) {
                 UnrecoverableError(
@@ -660,13 +811,24 @@ void FragmentContext::MakeSourceState(i64 parallel_count) {
             }
             break;
         }
-        case PhysicalOperatorType::kUnionAll:
+        case PhysicalOperatorType::kUnionAll: {
+            // The blocks of all inputs are streamed to the single task, the task is scheduled whenever an input task completes.
+            if (fragment_type_ != FragmentType::kParallelStream) {
+                UnrecoverableError(
+                    fmt::format("{} should be parallel stream fragment", PhysicalOperatorToString(first_operator->operator_type())));
+            }
+
+            if (tasks_.size() != 1) {
+                UnrecoverableError(fmt::format("{} task count isn't correct.", PhysicalOperatorToString(first_operator->operator_type())));
+            }
+
+            tasks_[0]->source_state_ = MakeUnique<QueueSourceState>();
+            break;
+        }
         case PhysicalOperatorType::kIntersect:
         case PhysicalOperatorType::kExcept:
         case PhysicalOperatorType::kDummyScan:
-        case PhysicalOperatorType::kJoinHash:
         case PhysicalOperatorType::kJoinNestedLoop:
-        case PhysicalOperatorType::kJoinMerge:
         case PhysicalOperatorType::kJoinIndex:
         case PhysicalOperatorType::kCrossProduct:
         case PhysicalOperatorType::kPreparedPlan: {
@@ -677,11 +839,17 @@ void FragmentContext::MakeSourceState(i64 parallel_count) {
                 UnrecoverableError(fmt::format("{} task count isn't correct.", PhysicalOperatorToString(first_operator->operator_type())));
             }
 
-            // Partition the hash range to each source state
+            // All tasks pull block morsels from one shared cursor
             auto *table_scan_operator = (PhysicalTableScan *)first_operator;
-            Vector<SharedPtr<Vector<GlobalBlockID>>> blocks_group = table_scan_operator->PlanBlockEntries(parallel_count);
+            SharedPtr<TableScanSharedData> shared_data = table_scan_operator->MakeSharedData();
+            const Vector<GlobalBlockID> &block_ids = *shared_data->global_block_ids_;
             for (i64 task_id = 0; task_id < parallel_count; ++task_id) {
-                tasks_[task_id]->source_state_ = MakeUnique<TableScanSourceState>(blocks_group[task_id]);
+                // tasks start roughly in order, so task i usually claims the i-th morsel first
+                SizeT first_block_idx = task_id * shared_data->morsel_size_;
+                if (first_block_idx < block_ids.size()) {
+                    tasks_[task_id]->SetSegmentHint(block_ids[first_block_idx].segment_id_);
+                }
+                tasks_[task_id]->source_state_ = MakeUnique<TableScanSourceState>(shared_data);
             }
             break;
         }
@@ -694,6 +862,9 @@ void FragmentContext::MakeSourceState(i64 parallel_count) {
             auto *index_scan_operator = (PhysicalIndexScan *)first_operator;
             Vector<UniquePtr<Vector<SegmentID>>> segment_ids = index_scan_operator->PlanSegments(parallel_count);
             for (i64 task_id = 0; task_id < parallel_count; ++task_id) {
+                if (!segment_ids[task_id]->empty()) {
+                    tasks_[task_id]->SetSegmentHint(segment_ids[task_id]->front());
+                }
                 tasks_[task_id]->source_state_ = MakeUnique<IndexScanSourceState>(std::move(segment_ids[task_id]));
             }
             break;
@@ -713,10 +884,24 @@ void FragmentContext::MakeSourceState(i64 parallel_count) {
             }
             break;
         }
+        case PhysicalOperatorType::kMatch: {
+            if (fragment_type_ != FragmentType::kParallelMaterialize && fragment_type_ != FragmentType::kSerialMaterialize) {
+                UnrecoverableError(
+                    fmt::format("{} should in parallel/serial materialized fragment", PhysicalOperatorToString(first_operator->operator_type())));
+            }
+
+            if ((i64)tasks_.size() != parallel_count) {
+                UnrecoverableError(fmt::format("{} task count isn't correct.", PhysicalOperatorToString(first_operator->operator_type())));
+            }
+
+            for (auto &task : tasks_) {
+                task->source_state_ = MakeUnique<EmptySourceState>();
+            }
+            break;
+        }
         case PhysicalOperatorType::kCommand:
         case PhysicalOperatorType::kInsert:
         case PhysicalOperatorType::kImport:
-        case PhysicalOperatorType::kExport:
         case PhysicalOperatorType::kAlter:
         case PhysicalOperatorType::kCreateTable:
         case PhysicalOperatorType::kCreateIndexPrepare:
@@ -731,7 +916,6 @@ void FragmentContext::MakeSourceState(i64 parallel_count) {
         case PhysicalOperatorType::kDropView:
         case PhysicalOperatorType::kExplain:
         case PhysicalOperatorType::kShow:
-        case PhysicalOperatorType::kMatch:
         case PhysicalOperatorType::kOptimize:
         case PhysicalOperatorType::kFlush: {
             if (fragment_type_ != FragmentType::kSerialMaterialize) {
@@ -762,6 +946,21 @@ void FragmentContext::MakeSinkState(i64 parallel_count) {
             UnrecoverableError("Unexpected operator type");
         }
         case PhysicalOperatorType::kAggregate: {
+            if (fragment_type_ == FragmentType::kSerialMaterialize) {
+                // Group by aggregate
+                if (tasks_.size() != 1) {
+                    UnrecoverableError("SerialMaterialize type fragment should only have 1 task.");
+                }
+                if (SinkToLocalQueue(fragment_ptr_)) {
+                    tasks_[0]->sink_state_ = MakeUnique<QueueSinkState>(fragment_ptr_->FragmentID(), 0);
+                } else {
+                    auto sink_state = MakeUnique<MaterializeSinkState>(fragment_ptr_->FragmentID(), 0);
+                    sink_state->column_types_ = last_operator->GetOutputTypes();
+                    sink_state->column_names_ = last_operator->GetOutputNames();
+                    tasks_[0]->sink_state_ = std::move(sink_state);
+                }
+                break;
+            }
             if (fragment_type_ != FragmentType::kParallelStream) {
                 UnrecoverableError(fmt::format("{} should in parallel stream fragment", PhysicalOperatorToString(last_operator->operator_type())));
             }
@@ -777,7 +976,41 @@ void FragmentContext::MakeSinkState(i64 parallel_count) {
             }
             break;
         }
-        case PhysicalOperatorType::kParallelAggregate:
+        case PhysicalOperatorType::kParallelAggregate: {
+            if (fragment_type_ != FragmentType::kParallelStream) {
+                UnrecoverableError(fmt::format("{} should in parallel stream fragment", PhysicalOperatorToString(last_operator->operator_type())));
+            }
+
+            if ((i64)tasks_.size() != parallel_count) {
+                UnrecoverableError(fmt::format("{} task count isn't correct.", PhysicalOperatorToString(last_operator->operator_type())));
+            }
+
+            // The partial results are always sent to the merge fragment.
+            for (u64 task_id = 0; (i64)task_id < parallel_count; ++task_id) {
+                tasks_[task_id]->sink_state_ = MakeUnique<QueueSinkState>(fragment_ptr_->FragmentID(), task_id);
+            }
+            break;
+        }
+        case PhysicalOperatorType::kMergeParallelAggregate: {
+            if ((i64)tasks_.size() != parallel_count) {
+                UnrecoverableError(fmt::format("{} task count isn't correct.", PhysicalOperatorToString(last_operator->operator_type())));
+            }
+
+            if (SinkToLocalQueue(fragment_ptr_)) {
+                for (u64 task_id = 0; (i64)task_id < parallel_count; ++task_id) {
+                    tasks_[task_id]->sink_state_ = MakeUnique<QueueSinkState>(fragment_ptr_->FragmentID(), task_id);
+                }
+                break;
+            }
+
+            for (u64 task_id = 0; (i64)task_id < parallel_count; ++task_id) {
+                auto sink_state = MakeUnique<MaterializeSinkState>(fragment_ptr_->FragmentID(), task_id);
+                sink_state->column_types_ = last_operator->GetOutputTypes();
+                sink_state->column_names_ = last_operator->GetOutputNames();
+                tasks_[task_id]->sink_state_ = std::move(sink_state);
+            }
+            break;
+        }
         case PhysicalOperatorType::kHash: {
             if (fragment_type_ != FragmentType::kParallelStream) {
                 UnrecoverableError(fmt::format("{} should in parallel stream fragment", PhysicalOperatorToString(last_operator->operator_type())));
@@ -797,8 +1030,10 @@ void FragmentContext::MakeSinkState(i64 parallel_count) {
             break;
         }
         case PhysicalOperatorType::kLimit: {
-            if (fragment_type_ != FragmentType::kParallelStream) {
-                UnrecoverableError(fmt::format("{} should in parallel stream fragment", PhysicalOperatorToString(last_operator->operator_type())));
+            // Limit is in a parallel materialized fragment when it is on top of the merge of a parallel aggregate.
+            if (fragment_type_ != FragmentType::kParallelStream && fragment_type_ != FragmentType::kParallelMaterialize) {
+                UnrecoverableError(
+                    fmt::format("{} should in parallel stream/materialized fragment", PhysicalOperatorToString(last_operator->operator_type())));
             }
 
             if ((i64)tasks_.size() != parallel_count) {
@@ -812,13 +1047,13 @@ void FragmentContext::MakeSinkState(i64 parallel_count) {
             }
             break;
         }
-        case PhysicalOperatorType::kMergeParallelAggregate:
         case PhysicalOperatorType::kMergeAggregate:
         case PhysicalOperatorType::kMergeHash:
         case PhysicalOperatorType::kMergeLimit:
         case PhysicalOperatorType::kMergeTop:
         case PhysicalOperatorType::kMergeSort:
-        case PhysicalOperatorType::kMergeKnn: {
+        case PhysicalOperatorType::kMergeKnn:
+        case PhysicalOperatorType::kMergeMatch: {
             if (fragment_type_ != FragmentType::kSerialMaterialize) {
                 UnrecoverableError(
                     fmt::format("{} should in serial materialized fragment", PhysicalOperatorToString(last_operator->operator_type())));
@@ -874,8 +1109,12 @@ void FragmentContext::MakeSinkState(i64 parallel_count) {
         }
         case PhysicalOperatorType::kTableScan:
         case PhysicalOperatorType::kFilter:
-        case PhysicalOperatorType::kIndexScan: {
-            if (fragment_type_ == FragmentType::kSerialMaterialize) {
+        case PhysicalOperatorType::kIndexScan:
+        case PhysicalOperatorType::kJoinHash:
+        case PhysicalOperatorType::kJoinMerge: {
+            // Filter and join can be on top of a join, which is in serial materialized fragment.
+            if (fragment_type_ == FragmentType::kSerialMaterialize && last_operator->operator_type() != PhysicalOperatorType::kFilter &&
+                last_operator->operator_type() != PhysicalOperatorType::kJoinHash && last_operator->operator_type() != PhysicalOperatorType::kJoinMerge) {
                 UnrecoverableError(
                     fmt::format("{} should in parallel materialized/stream fragment", PhysicalOperatorToString(last_operator->operator_type())));
             }
@@ -884,6 +1123,13 @@ void FragmentContext::MakeSinkState(i64 parallel_count) {
                 UnrecoverableError(fmt::format("{} task count isn't correct.", PhysicalOperatorToString(last_operator->operator_type())));
             }
 
+            if (SinkToLocalQueue(fragment_ptr_)) {
+                for (u64 task_id = 0; (i64)task_id < parallel_count; ++task_id) {
+                    tasks_[task_id]->sink_state_ = MakeUnique<QueueSinkState>(fragment_ptr_->FragmentID(), task_id);
+                }
+                break;
+            }
+
             for (u64 task_id = 0; (i64)task_id < parallel_count; ++task_id) {
                 tasks_[task_id]->sink_state_ = MakeUnique<MaterializeSinkState>(fragment_ptr_->FragmentID(), task_id);
                 MaterializeSinkState *sink_state_ptr = static_cast<MaterializeSinkState *>(tasks_[task_id]->sink_state_.get());
@@ -893,7 +1139,15 @@ void FragmentContext::MakeSinkState(i64 parallel_count) {
             break;
         }
         case PhysicalOperatorType::kProjection: {
-            if (fragment_type_ == FragmentType::kSerialMaterialize) {
+            if (SinkToLocalQueue(fragment_ptr_)) {
+                if ((i64)tasks_.size() != parallel_count) {
+                    UnrecoverableError(fmt::format("{} task count isn't correct.", PhysicalOperatorToString(last_operator->operator_type())));
+                }
+
+                for (u64 task_id = 0; (i64)task_id < parallel_count; ++task_id) {
+                    tasks_[task_id]->sink_state_ = MakeUnique<QueueSinkState>(fragment_ptr_->FragmentID(), task_id);
+                }
+            } else if (fragment_type_ == FragmentType::kSerialMaterialize) {
                 if (tasks_.size() != 1) {
                     UnrecoverableError("SerialMaterialize type fragment should only have 1 task.");
                 }
@@ -916,13 +1170,29 @@ void FragmentContext::MakeSinkState(i64 parallel_count) {
             }
             break;
         }
-        case PhysicalOperatorType::kUnionAll:
+        case PhysicalOperatorType::kUnionAll: {
+            if (fragment_type_ != FragmentType::kParallelStream) {
+                UnrecoverableError(fmt::format("{} should in parallel stream fragment", PhysicalOperatorToString(last_operator->operator_type())));
+            }
+
+            if (tasks_.size() != 1) {
+                UnrecoverableError(fmt::format("{} task count isn't correct.", PhysicalOperatorToString(last_operator->operator_type())));
+            }
+
+            if (SinkToLocalQueue(fragment_ptr_)) {
+                tasks_[0]->sink_state_ = MakeUnique<QueueSinkState>(fragment_ptr_->FragmentID(), 0);
+            } else {
+                auto sink_state = MakeUnique<MaterializeSinkState>(fragment_ptr_->FragmentID(), 0);
+                sink_state->column_types_ = last_operator->GetOutputTypes();
+                sink_state->column_names_ = last_operator->GetOutputNames();
+                tasks_[0]->sink_state_ = std::move(sink_state);
+            }
+            break;
+        }
         case PhysicalOperatorType::kIntersect:
         case PhysicalOperatorType::kExcept:
         case PhysicalOperatorType::kDummyScan:
-        case PhysicalOperatorType::kJoinHash:
         case PhysicalOperatorType::kJoinNestedLoop:
-        case PhysicalOperatorType::kJoinMerge:
         case PhysicalOperatorType::kJoinIndex:
         case PhysicalOperatorType::kCrossProduct:
         case PhysicalOperatorType::kAlter:
@@ -944,8 +1214,7 @@ void FragmentContext::MakeSinkState(i64 parallel_count) {
             }
         }
         case PhysicalOperatorType::kInsert:
-        case PhysicalOperatorType::kImport:
-        case PhysicalOperatorType::kExport: {
+        case PhysicalOperatorType::kImport: {
             if (fragment_type_ != FragmentType::kSerialMaterialize) {
                 UnrecoverableError(
                     fmt::format("{} should in serial materialized fragment", PhysicalOperatorToString(last_operator->operator_type())));
@@ -958,6 +1227,7 @@ void FragmentContext::MakeSinkState(i64 parallel_count) {
             tasks_[0]->sink_state_ = MakeUnique<MessageSinkState>();
             break;
         }
+        case PhysicalOperatorType::kExport:
         case PhysicalOperatorType::kCreateIndexDo: {
             if (fragment_type_ != FragmentType::kParallelMaterialize) {
                 UnrecoverableError(
@@ -1007,30 +1277,55 @@ void FragmentContext::CreateTasks(i64 cpu_count, i64 operator_count) {
         case PhysicalOperatorType::kTableScan: {
             auto *table_scan_operator = static_cast<PhysicalTableScan *>(first_operator);
             parallel_count = std::min(parallel_count, (i64)(table_scan_operator->TaskletCount()));
-            if (parallel_count == 0) {
-                parallel_count = 1;
-            }
+            parallel_count = EstimatedScanParallelism(parallel_count, table_scan_operator->GetBlockIndex()->RowCount(), query_context_);
             break;
         }
         case PhysicalOperatorType::kIndexScan: {
             auto *index_scan_operator = static_cast<PhysicalIndexScan *>(first_operator);
             parallel_count = std::min(parallel_count, (i64)(index_scan_operator->TaskletCount()));
-            if (parallel_count == 0) {
-                parallel_count = 1;
-            }
+            parallel_count = EstimatedScanParallelism(parallel_count, index_scan_operator->EstimatedRowCount(), query_context_);
             break;
         }
         case PhysicalOperatorType::kKnnScan: {
             auto *knn_scan_operator = static_cast<PhysicalKnnScan *>(first_operator);
+            // Each index entry is a whole segment of work, a brute force task is one block.
+            SizeT estimated_rows = knn_scan_operator->BruteForceBlockCount() * DEFAULT_BLOCK_CAPACITY +
+                                   knn_scan_operator->IndexEntryCount() * PARALLEL_SCAN_MIN_ROWS_PER_TASK;
             SizeT task_n = InitKnnScanFragmentContext(knn_scan_operator, this, query_context_);
             parallel_count = std::min(parallel_count, (i64)task_n);
+            parallel_count = EstimatedScanParallelism(parallel_count, estimated_rows, query_context_);
+            break;
+        }
+        case PhysicalOperatorType::kMergeParallelAggregate: {
+            // One task for each partition of the partial aggregate results.
+            auto *merge_parallel_aggregate_operator = static_cast<PhysicalMergeParallelAggregate *>(first_operator);
+            parallel_count = std::min(parallel_count, (i64)(merge_parallel_aggregate_operator->PartitionCount()));
             if (parallel_count == 0) {
                 parallel_count = 1;
             }
             break;
         }
-        case PhysicalOperatorType::kMatch:
+        case PhysicalOperatorType::kMatch: {
+            if (fragment_type_ != FragmentType::kParallelMaterialize) {
+                parallel_count = 1;
+                break;
+            }
+            // Each task searches some whole segments, the rows of the table decide whether more than one task is worth it.
+            auto *match_operator = static_cast<PhysicalMatch *>(first_operator);
+            parallel_count = std::min(parallel_count, (i64)(match_operator->TaskletCount()));
+            parallel_count = EstimatedScanParallelism(parallel_count, match_operator->GetBlockIndex()->RowCount(), query_context_);
+            parallel_count = std::max(parallel_count, 1l);
+            auto *parallel_materialize_fragment_ctx = static_cast<ParallelMaterializedFragmentCtx *>(this);
+            const TxnTimeStamp begin_ts = query_context_->GetTxn()->BeginTS();
+            parallel_materialize_fragment_ctx->match_task_segments_ = match_operator->PlanSegments(parallel_count, begin_ts);
+            parallel_materialize_fragment_ctx->match_shared_data_ = MakeUnique<MatchSharedData>();
+            break;
+        }
         case PhysicalOperatorType::kMergeKnn:
+        case PhysicalOperatorType::kMergeMatch:
+        case PhysicalOperatorType::kJoinHash:
+        case PhysicalOperatorType::kJoinMerge:
+        case PhysicalOperatorType::kUnionAll:
         case PhysicalOperatorType::kProjection: {
             // Serial Materialize
             parallel_count = 1;
@@ -1042,6 +1337,18 @@ void FragmentContext::CreateTasks(i64 cpu_count, i64 operator_count) {
             parallel_count = std::max(parallel_count, 1l);
             break;
         }
+        case PhysicalOperatorType::kExport: {
+            // One task exports one or more segments, all tasks write into the file created here.
+            auto *export_operator = static_cast<PhysicalExport *>(first_operator);
+            parallel_count = std::min(parallel_count, (i64)(export_operator->TaskletCount()));
+            if (parallel_count == 0) {
+                parallel_count = 1;
+            }
+            auto *parallel_materialize_fragment_ctx = static_cast<ParallelMaterializedFragmentCtx *>(this);
+            parallel_materialize_fragment_ctx->export_task_blocks_ = export_operator->PlanSegmentBlocks(parallel_count);
+            parallel_materialize_fragment_ctx->export_shared_data_ = export_operator->MakeSharedData(parallel_count);
+            break;
+        }
         default: {
             break;
         }
@@ -1167,6 +1474,18 @@ SharedPtr<DataTable> ParallelMaterializedFragmentCtx::GetResultInternal() {
         result_table = DataTable::MakeSummaryResultTable(counter, sum);
         return result_table;
     }
+    if (tasks_[0]->sink_state_->state_type() == SinkStateType::kMessage) {
+        // Only the task finishing the work has the message.
+        for (const auto &task : tasks_) {
+            auto *message_sink_state = static_cast<MessageSinkState *>(task->sink_state_.get());
+            if (message_sink_state->message_.get() != nullptr) {
+                result_table = DataTable::MakeEmptyResultTable();
+                result_table->SetResultMsg(std::move(message_sink_state->message_));
+                return result_table;
+            }
+        }
+        UnrecoverableError("No response message");
+    }
 
     auto *first_materialize_sink_state = static_cast<MaterializeSinkState *>(tasks_[0]->sink_state_.get());
     Vector<SharedPtr<ColumnDef>> column_defs;
@@ -25,6 +25,9 @@ import data_table;
 import data_block;
 import knn_scan_data;
 import create_index_data;
+import export_data;
+import match_scan_data;
+import global_block_id;
 import logger;
 import third_party;
 
@@ -119,6 +122,9 @@ public:
 
     bool TryFinishFragment();
 
+    // A stream fragment hands each output batch to its parent fragment at once, instead of when its tasks finish.
+    void ScheduleStreamParent();
+
     Vector<PhysicalOperator *> &GetOperators();
 
     [[nodiscard]] PhysicalSink *GetSinkOperator() const;
@@ -215,6 +221,14 @@ public:
 
     UniquePtr<CreateIndexSharedData> create_index_shared_data_{};
 
+    // Blocks exported by each task and the file shared by the tasks.
+    Vector<Vector<GlobalBlockID>> export_task_blocks_{};
+    UniquePtr<ExportSharedData> export_shared_data_{};
+
+    // Segments searched by each task of a parallel match and the score threshold shared by the tasks.
+    Vector<SharedPtr<Vector<SegmentID>>> match_task_segments_{};
+    UniquePtr<MatchSharedData> match_shared_data_{};
+
 protected:
     HashMap<u64, Vector<SharedPtr<DataBlock>>> task_results_{};
 };
@@ -30,14 +30,36 @@ import infinity_exception;
 import operator_state;
 import physical_operator_type;
 import query_context;
+import query_progress;
+import config;
 import base_table_ref;
 import defer_op;
 import fragment_context;
 import status;
 import parser_assert;
+import default_values;
+import blocking_queue;
+import io_stats;
+import trace_span;
 
 namespace infinity {
 
+namespace {
+
+// A trace span keeps the pointer of its name
+const char *OperatorTraceName(PhysicalOperatorType type) {
+    static const Vector<String> names = [] {
+        Vector<String> operator_names;
+        for (i8 idx = 0; idx <= static_cast<i8>(PhysicalOperatorType::kSource); ++idx) {
+            operator_names.push_back(PhysicalOperatorToString(static_cast<PhysicalOperatorType>(idx)));
+        }
+        return operator_names;
+    }();
+    return names[static_cast<i8>(type)].c_str();
+}
+
+} // namespace
+
 void FragmentTask::Init() {
     //    FragmentContext *fragment_context = (FragmentContext *)fragment_context_;
     // Init each operator input / output
@@ -50,6 +72,8 @@ void FragmentTask::OnExecute() {
     //    prof.Begin();
     FragmentContext *fragment_context = (FragmentContext *)fragment_context_;
     QueryContext *query_context = fragment_context->query_context();
+    IOPurposeScope io_purpose_scope(IOPurpose::kQuery);
+    TraceSpan task_span("task", "fragment task", task_id_);
 
     // TODO:
     // Tell the fragment type:
@@ -58,6 +82,12 @@ void FragmentTask::OnExecute() {
     //     - Source operator will indicate the last execution
     // For streaming type, we need to run sink each execution
 
+    if (fragment_context->ContextType() == FragmentType::kParallelStream && SinkBackpressured()) {
+        // The parent fragment hasn't consumed the earlier output yet, leave the worker to the other tasks.
+        LOG_TRACE(fmt::format("Task: {} of Fragment: {} waits for the parent fragment", task_id_, FragmentId()));
+        return;
+    }
+
     PhysicalSource *source_op = fragment_context->GetSourceOperator();
 
     bool execute_success{false};
@@ -67,14 +97,17 @@ void FragmentTask::OnExecute() {
         // No source error
         Vector<PhysicalOperator *> &operator_refs = fragment_context->GetOperators();
 
-        bool enable_profiler = query_context->is_enable_profiling();
-        TaskProfiler profiler(TaskBinding(), enable_profiler, operator_count_);
+        bool enable_profiler = query_context->is_enable_profiling() || query_context->is_analyzing();
+        TaskProfiler profiler(TaskBinding(), enable_profiler, operator_count_, query_context->global_config()->profile_hardware_counters());
         HashMap<SizeT, SharedPtr<BaseTableRef>> table_refs;
         profiler.Begin();
         try {
+            query_context->CheckCanceled();
             for (i64 op_idx = operator_count_ - 1; op_idx >= 0; --op_idx) {
                 profiler.StartOperator(operator_refs[op_idx]);
+                query_context->progress()->SetCurrentOperator(operator_refs[op_idx]->operator_type());
                 DeferFn defer_fn([&]() { profiler.StopOperator(operator_states_[op_idx].get()); });
+                TraceSpan operator_span("operator", OperatorTraceName(operator_refs[op_idx]->operator_type()), task_id_);
 
                 operator_refs[op_idx]->InputLoad(fragment_context->query_context(), operator_states_[op_idx].get(), table_refs);
                 execute_success = operator_refs[op_idx]->Execute(fragment_context->query_context(), operator_states_[op_idx].get());
@@ -109,9 +142,23 @@ void FragmentTask::OnExecute() {
     } else if (execute_success) {
         PhysicalSink *sink_op = fragment_context->GetSinkOperator();
         sink_op->Execute(query_context, fragment_context, sink_state_.get());
+        fragment_context->ScheduleStreamParent();
     }
 }
 
+bool FragmentTask::SinkBackpressured() const {
+    if (sink_state_->state_type_ != SinkStateType::kQueue) {
+        return false;
+    }
+    auto *queue_sink_state = static_cast<QueueSinkState *>(sink_state_.get());
+    for (const auto *next_fragment_queue : queue_sink_state->fragment_data_queues_) {
+        if (next_fragment_queue->Size() >= STREAM_QUEUE_BACKPRESSURE_SIZE) {
+            return true;
+        }
+    }
+    return false;
+}
+
 u64 FragmentTask::FragmentId() const {
     auto *fragment_context = static_cast<FragmentContext *>(fragment_context_);
     return fragment_context->fragment_ptr()->FragmentID();
@@ -149,6 +196,21 @@ bool FragmentTask::QuitFromWorkerLoop() {
     return false;
 }
 
+bool FragmentTask::TryWakeUp() {
+    if (source_state_->state_type_ != SourceStateType::kQueue) {
+        return false;
+    }
+    auto *queue_state = static_cast<QueueSourceState *>(source_state_.get());
+
+    std::unique_lock lock(mutex_);
+    if (status_ != FragmentTaskStatus::kPending || queue_state->source_queue_.Empty()) {
+        return false;
+    }
+    status_ = FragmentTaskStatus::kRunning;
+    LOG_TRACE(fmt::format("Task: {} of Fragment: {} is woken up by its child fragment", task_id_, FragmentId()));
+    return true;
+}
+
 TaskBinding FragmentTask::TaskBinding() const {
     struct TaskBinding binding {};
 
@@ -166,7 +228,13 @@ bool FragmentTask::CompleteTask() {
     }
     FragmentContext *fragment_context = (FragmentContext *)fragment_context_;
     LOG_TRACE(fmt::format("Task: {} of Fragment: {} is completed", task_id_, FragmentId()));
-    return fragment_context->TryFinishFragment();
+    QueryProgress *progress = fragment_context->query_context()->progress();
+    progress->FinishTask();
+    bool fragment_finished = fragment_context->TryFinishFragment();
+    if (fragment_finished) {
+        progress->FinishFragment();
+    }
+    return fragment_finished;
 }
 
 String FragmentTask::PhysOpsToString() {
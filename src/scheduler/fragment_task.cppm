@@ -63,6 +63,12 @@ public:
 
     [[nodiscard]] inline i64 LastWorkerID() const { return last_worker_id_; }
 
+    // The first segment read by the task, -1 if the task isn't scoped to segments. The NUMA aware scheduler runs the task on
+    // the NUMA node of the segment.
+    inline void SetSegmentHint(i64 segment_id) { segment_hint_ = segment_id; }
+
+    [[nodiscard]] inline i64 SegmentHint() const { return segment_hint_; }
+
     u64 FragmentId() const;
 
     [[nodiscard]] inline i64 TaskID() const { return task_id_; }
@@ -74,6 +80,9 @@ public:
 
     bool QuitFromWorkerLoop();
 
+    // Resume a pending task which reads from a queue once the child fragment has pushed data into the queue
+    bool TryWakeUp();
+
     [[nodiscard]] TaskBinding TaskBinding() const;
 
     bool CompleteTask();
@@ -92,6 +101,9 @@ public:
 
     UniquePtr<SinkState> sink_state_{};
 
+private:
+    bool SinkBackpressured() const;
+
 private:
     std::mutex mutex_;
 
@@ -100,6 +112,7 @@ private:
     void *fragment_context_{};
     bool is_terminator_{false};
     i64 last_worker_id_{-1};
+    i64 segment_hint_{-1};
     i64 task_id_{-1};
     i64 operator_count_{0};
 };
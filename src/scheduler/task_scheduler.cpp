@@ -14,7 +14,6 @@
 
 module;
 
-#include <list>
 #include <sched.h>
 
 module task_scheduler;
@@ -37,9 +36,77 @@ import physical_sink;
 import base_statement;
 import extra_ddl_info;
 import create_statement;
+import options;
+import global_resource_usage;
 
 namespace infinity {
 
+namespace {
+
+constexpr Array<SizeT, QUERY_PRIORITY_COUNT> LANE_SHARES = {INTERACTIVE_LANE_SHARE, BATCH_LANE_SHARE, BACKGROUND_LANE_SHARE};
+
+QueryPriority TaskPriority(FragmentTask *task) { return task->fragment_context()->query_context()->query_priority(); }
+
+} // namespace
+
+void WorkerQueue::Enqueue(FragmentTask *task, QueryPriority priority) {
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        lanes_[static_cast<SizeT>(priority)].push_back(task);
+    }
+    cv_.notify_one();
+}
+
+bool WorkerQueue::TryDequeue(FragmentTask *&task) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    return PopByShare(task);
+}
+
+bool WorkerQueue::TryDequeueFor(FragmentTask *&task, MicroSeconds timeout) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    cv_.wait_for(lock, timeout, [this] {
+        for (const auto &lane : lanes_) {
+            if (!lane.empty()) {
+                return true;
+            }
+        }
+        return false;
+    });
+    return PopByShare(task);
+}
+
+bool WorkerQueue::TrySteal(FragmentTask *&task) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    for (auto &lane : lanes_) {
+        if (!lane.empty()) {
+            if (lane.back()->IsTerminator()) {
+                return false;
+            }
+            task = lane.back();
+            lane.pop_back();
+            return true;
+        }
+    }
+    return false;
+}
+
+bool WorkerQueue::PopByShare(FragmentTask *&task) {
+    for (SizeT turn = 0; turn < 2; ++turn) {
+        for (SizeT lane_idx = 0; lane_idx < QUERY_PRIORITY_COUNT; ++lane_idx) {
+            auto &lane = lanes_[lane_idx];
+            if (!lane.empty() && credits_[lane_idx] > 0) {
+                --credits_[lane_idx];
+                task = lane.front();
+                lane.pop_front();
+                return true;
+            }
+        }
+        // The lanes with tasks used up their shares, start the next turn.
+        credits_ = LANE_SHARES;
+    }
+    return false;
+}
+
 // Non-static memory methods
 
 TaskScheduler::TaskScheduler(const Config *config_ptr) { Init(config_ptr); }
@@ -48,6 +115,7 @@ void TaskScheduler::Init(const Config *config_ptr) {
     worker_count_ = config_ptr->worker_cpu_limit();
     worker_array_.reserve(worker_count_);
     worker_workloads_.resize(worker_count_);
+    worker_busy_times_.resize(worker_count_);
     u64 cpu_count = Thread::hardware_concurrency();
 
     u64 cpu_select_step = cpu_count / worker_count_;
@@ -57,19 +125,47 @@ void TaskScheduler::Init(const Config *config_ptr) {
         cpu_select_step = 1;
     }
 
+    numa_aware_ = config_ptr->numa_aware();
     for (u64 cpu_id = 0; cpu_id < worker_count_; cpu_id += cpu_select_step) {
-        UniquePtr<FragmentTaskBlockQueue> worker_queue = MakeUnique<FragmentTaskBlockQueue>();
-        UniquePtr<Thread> worker_thread = MakeUnique<Thread>(&TaskScheduler::WorkerLoop, this, worker_queue.get(), cpu_id);
-        // Pin the thread to specific cpu
-        ThreadUtil::pin(*worker_thread, cpu_id % cpu_count);
+        u64 worker_id = worker_array_.size();
+        i64 numa_node_id = numa_aware_ ? ThreadUtil::NumaNodeOfCpu(cpu_id % cpu_count) : 0;
+        u64 numa_node = 0;
+        while (numa_node < numa_node_ids_.size() && numa_node_ids_[numa_node] != numa_node_id) {
+            ++numa_node;
+        }
+        if (numa_node == numa_node_ids_.size()) {
+            numa_node_ids_.emplace_back(numa_node_id);
+            node_workers_.emplace_back();
+        }
+        node_workers_[numa_node].emplace_back(worker_id);
 
-        worker_array_.emplace_back(cpu_id, std::move(worker_queue), std::move(worker_thread));
-        worker_workloads_[cpu_id] = 0;
+        // A worker puts its unfinished tasks back into its own queue, so the queue isn't bounded.
+        UniquePtr<WorkerQueue> worker_queue = MakeUnique<WorkerQueue>();
+        // The worker array is complete before the workers start to steal from each other.
+        worker_array_.emplace_back(cpu_id, numa_node, std::move(worker_queue), nullptr);
+        worker_workloads_[worker_id] = 0;
+        worker_busy_times_[worker_id] = 0;
     }
 
     if (worker_array_.empty()) {
         UnrecoverableError("No cpu is used in scheduler");
     }
+    // Workers are indexed by their position in worker_array_.
+    worker_count_ = worker_array_.size();
+    query_concurrency_limit_ = config_ptr->query_concurrency_limit();
+    if (query_concurrency_limit_ == 0) {
+        query_concurrency_limit_ = 2 * worker_count_;
+    }
+
+    for (u64 worker_id = 0; worker_id < worker_array_.size(); ++worker_id) {
+        Worker &worker = worker_array_[worker_id];
+        worker.thread_ = MakeUnique<Thread>(&TaskScheduler::WorkerLoop, this, worker.queue_.get(), worker_id);
+        // Pin the thread to specific cpu
+        ThreadUtil::pin(*worker.thread_, worker.cpu_id_ % cpu_count);
+    }
+    if (numa_aware_) {
+        LOG_INFO(fmt::format("NUMA aware scheduler with {} nodes", numa_node_ids_.size()));
+    }
 
     initialized_ = true;
 }
@@ -79,15 +175,33 @@ void TaskScheduler::UnInit() {
     UniquePtr<FragmentTask> terminate_task = MakeUnique<FragmentTask>(true);
 
     for (const auto &worker : worker_array_) {
-        worker.queue_->Enqueue(terminate_task.get());
+        worker.queue_->Enqueue(terminate_task.get(), QueryPriority::kInteractive);
         worker.thread_->join();
     }
 }
 
-u64 TaskScheduler::FindLeastWorkloadWorker() {
-    u64 min_workload = worker_workloads_[0];
-    u64 min_workload_worker_id = 0;
-    for (u64 worker_id = 1; worker_id < worker_count_ && min_workload; ++worker_id) {
+u64 TaskScheduler::IdleWorkerCount() const {
+    u64 idle_worker_count = 0;
+    for (u64 worker_id = 0; worker_id < worker_count_; ++worker_id) {
+        if (worker_workloads_[worker_id] == 0) {
+            ++idle_worker_count;
+        }
+    }
+    return idle_worker_count;
+}
+
+u64 TaskScheduler::FindLeastWorkloadWorker(const FragmentTask *task) {
+    const Vector<u64> *candidates = nullptr;
+    if (numa_aware_ && task->SegmentHint() >= 0) {
+        candidates = &node_workers_[task->SegmentHint() % node_workers_.size()];
+    }
+    u64 candidate_count = candidates == nullptr ? worker_count_ : candidates->size();
+    auto candidate_worker = [&](u64 idx) { return candidates == nullptr ? idx : (*candidates)[idx]; };
+
+    u64 min_workload_worker_id = candidate_worker(0);
+    u64 min_workload = worker_workloads_[min_workload_worker_id];
+    for (u64 idx = 1; idx < candidate_count && min_workload; ++idx) {
+        u64 worker_id = candidate_worker(idx);
         u64 current_worker_load = worker_workloads_[worker_id];
         if (current_worker_load < min_workload) {
             min_workload = current_worker_load;
@@ -102,7 +216,10 @@ SizeT TaskScheduler::GetStartFragments(PlanFragment *plan_fragment, Vector<PlanF
     std::function<void(PlanFragment *)> TraversePlanFragmentTree = [&](PlanFragment *root) -> void {
         all_fragment_n += root->GetContext()->Tasks().size();
         if (root->Children().empty()) {
-            leaf_fragments.emplace_back(root);
+            // the probe fragment of a hash join with a runtime filter is started by the build fragment
+            if (!root->WaitRuntimeFilter()) {
+                leaf_fragments.emplace_back(root);
+            }
             return;
         }
         for (auto &child : root->Children()) {
@@ -115,43 +232,82 @@ SizeT TaskScheduler::GetStartFragments(PlanFragment *plan_fragment, Vector<PlanF
     return all_fragment_n;
 }
 
-void TaskScheduler::Schedule(PlanFragment *plan_fragment, const BaseStatement *base_statement) {
-    if (!initialized_) {
-        UnrecoverableError("Scheduler isn't initialized");
-    }
-    // DumpPlanFragment(plan_fragment);
-    bool use_scheduler = false;
+bool TaskScheduler::UseScheduler(const BaseStatement *base_statement) {
     switch(base_statement->Type()) {
         case StatementType::kSelect:
         case StatementType::kExplain:
         case StatementType::kDelete:
         case StatementType::kUpdate:
         {
-            use_scheduler = true; // continue;
-            break;
+            return true;
         }
         case StatementType::kCreate: {
             const CreateStatement *create_statement = static_cast<const CreateStatement *>(base_statement);
-            if (create_statement->create_info_->type_ == DDLType::kIndex) {
-                // Create index will generate multiple tasks
-                use_scheduler = true;
-            }
-            break;
+            // Create index will generate multiple tasks
+            return create_statement->create_info_->type_ == DDLType::kIndex;
         }
         default: {
-            ;
+            return false;
         }
     }
+}
+
+bool TaskScheduler::RunInline(PlanFragment *plan_fragment) {
+    return !plan_fragment->HasChild() && plan_fragment->GetContext()->Tasks().size() == 1;
+}
+
+bool TaskScheduler::AdmitQuery(const BaseStatement *base_statement, QueryPriority priority) {
+    if (!UseScheduler(base_statement)) {
+        return false;
+    }
+    SizeT lane_idx = static_cast<SizeT>(priority);
+    {
+        std::unique_lock<std::mutex> lock(admission_mutex_);
+        ++waiting_query_n_[lane_idx];
+        admission_cv_.wait(lock, [&] {
+            if (running_query_n_ >= query_concurrency_limit_) {
+                return false;
+            }
+            for (SizeT higher_idx = 0; higher_idx < lane_idx; ++higher_idx) {
+                if (waiting_query_n_[higher_idx] > 0) {
+                    return false;
+                }
+            }
+            return true;
+        });
+        --waiting_query_n_[lane_idx];
+        ++running_query_n_;
+    }
+    // The lower priority queries may wait for this one to be admitted.
+    admission_cv_.notify_all();
+    return true;
+}
+
+void TaskScheduler::ReleaseQuery() {
+    {
+        std::unique_lock<std::mutex> lock(admission_mutex_);
+        --running_query_n_;
+    }
+    admission_cv_.notify_all();
+}
+
+void TaskScheduler::Schedule(PlanFragment *plan_fragment, const BaseStatement *base_statement) {
+    if (!initialized_) {
+        UnrecoverableError("Scheduler isn't initialized");
+    }
+    // DumpPlanFragment(plan_fragment);
+    bool use_scheduler = UseScheduler(base_statement);
+
+    if (RunInline(plan_fragment)) {
+        // A plan of one task runs on the session thread, the handoff to a worker costs more than a point lookup itself.
+        FragmentTask *task = plan_fragment->GetContext()->Tasks()[0].get();
+        RunTask(task);
+        return;
+    }
 
     if(!use_scheduler) {
         if (!plan_fragment->HasChild()) {
-            if (plan_fragment->GetContext()->Tasks().size() == 1) {
-                FragmentTask *task = plan_fragment->GetContext()->Tasks()[0].get();
-                RunTask(task);
-                return ;
-            } else {
-                UnrecoverableError("Oops! None select and create idnex statement has multiple fragments.");
-            }
+            UnrecoverableError("Oops! None select and create idnex statement has multiple fragments.");
         } else {
             UnrecoverableError("None select statement has multiple fragments.");
         }
@@ -167,7 +323,7 @@ void TaskScheduler::Schedule(PlanFragment *plan_fragment, const BaseStatement *b
             if (!task->TryIntoWorkerLoop()) {
                 UnrecoverableError("Task can't be scheduled");
             }
-            u64 worker_id = FindLeastWorkloadWorker();
+            u64 worker_id = FindLeastWorkloadWorker(task.get());
             ScheduleTask(task.get(), worker_id);
         }
     }
@@ -204,7 +360,7 @@ void TaskScheduler::ScheduleFragment(PlanFragment *plan_fragment) {
     }
     for (auto *task_ptr : task_ptrs) {
         if (task_ptr->LastWorkerID() == -1) {
-            u64 worker_id = FindLeastWorkloadWorker();
+            u64 worker_id = FindLeastWorkloadWorker(task_ptr);
             ScheduleTask(task_ptr, worker_id);
         } else {
             ScheduleTask(task_ptr, task_ptr->LastWorkerID());
@@ -212,43 +368,74 @@ void TaskScheduler::ScheduleFragment(PlanFragment *plan_fragment) {
     }
 }
 
+void TaskScheduler::WakeUpFragment(PlanFragment *plan_fragment) {
+    auto &tasks = plan_fragment->GetContext()->Tasks();
+    for (auto &task : tasks) {
+        if (!task->TryWakeUp()) {
+            continue;
+        }
+        if (task->LastWorkerID() == -1) {
+            ScheduleTask(task.get(), FindLeastWorkloadWorker(task.get()));
+        } else {
+            ScheduleTask(task.get(), task->LastWorkerID());
+        }
+    }
+}
+
 void TaskScheduler::ScheduleTask(FragmentTask *task, u64 worker_id) {
     ++worker_workloads_[worker_id];
-    worker_array_[worker_id].queue_->Enqueue(task);
+    worker_array_[worker_id].queue_->Enqueue(task, TaskPriority(task));
 }
 
-void TaskScheduler::WorkerLoop(FragmentTaskBlockQueue *task_queue, i64 worker_id) {
-    List<FragmentTask *> task_lists;
-    auto iter = task_lists.end();
-    auto last_iter = task_lists.end();
-    while (true) {
-        if (iter == last_iter) {
-            Vector<FragmentTask *> dequeue_output;
-            if (task_lists.empty()) {
-                task_queue->DequeueBulk(dequeue_output);
-            } else {
-                task_queue->TryDequeueBulk(dequeue_output);
+bool TaskScheduler::StealTask(u64 worker_id, FragmentTask *&task) {
+    // In NUMA aware mode the workers of the same node are tried first.
+    u64 numa_node = worker_array_[worker_id].numa_node_;
+    for (SizeT pass = 0; pass < 2; ++pass) {
+        for (u64 offset = 1; offset < worker_count_; ++offset) {
+            u64 victim_id = (worker_id + offset) % worker_count_;
+            if (numa_aware_ && (worker_array_[victim_id].numa_node_ == numa_node) != (pass == 0)) {
+                continue;
             }
-            if (!dequeue_output.empty()) {
-                task_lists.insert(task_lists.end(), dequeue_output.begin(), dequeue_output.end());
+            if (worker_array_[victim_id].queue_->TrySteal(task)) {
+                --worker_workloads_[victim_id];
+                ++worker_workloads_[worker_id];
+                LOG_TRACE(fmt::format("Worker: {} steals task: {} of Fragment: {} from worker: {}", worker_id, task->TaskID(), task->FragmentId(), victim_id));
+                return true;
             }
-            last_iter = task_lists.end();
         }
-        if (iter == task_lists.end()) {
-            iter = task_lists.begin();
+        if (!numa_aware_) {
+            break;
+        }
+    }
+    return false;
+}
+
+// A worker runs the next task of its queue once and puts it back to the end of its lane if it isn't finished, so the tasks
+// of a worker run in turn. An idle worker steals the queued tasks of a busy worker which is stuck on a long task.
+void TaskScheduler::WorkerLoop(WorkerQueue *task_queue, i64 worker_id) {
+    while (true) {
+        FragmentTask *fragment_task = nullptr;
+        if (!task_queue->TryDequeue(fragment_task) && !StealTask(worker_id, fragment_task)) {
+            if (!task_queue->TryDequeueFor(fragment_task, MicroSeconds(WORKER_STEAL_INTERVAL_US))) {
+                continue;
+            }
         }
-        auto &fragment_task = *iter;
         if (fragment_task->IsTerminator()) {
             break;
         }
         auto *fragment_ctx = fragment_task->fragment_context();
         if (!fragment_ctx->notifier()->StartTask()) {
             --worker_workloads_[worker_id];
-            iter = task_lists.erase(iter);
             continue;
         }
 
+        auto begin = Clock::now();
         fragment_task->OnExecute();
+        NanoSeconds busy_time = Clock::now() - begin;
+        worker_busy_times_[worker_id].fetch_add(busy_time.count(), std::memory_order_relaxed);
+        if (numa_aware_) {
+            GlobalResourceUsage::AddNumaNodeBusyTime(numa_node_ids_[worker_array_[worker_id].numa_node_], busy_time.count());
+        }
         fragment_task->SetLastWorkID(worker_id);
 
         bool error = false;
@@ -259,19 +446,16 @@ void TaskScheduler::WorkerLoop(FragmentTaskBlockQueue *task_queue, i64 worker_id
                 // auto *sink_op = fragment_ctx->GetSinkOperator();
                 --worker_workloads_[worker_id];
                 fragment_task->CompleteTask();
-                iter = task_lists.erase(iter);
                 finish = true;
             } else if (fragment_task->QuitFromWorkerLoop()) {
                 --worker_workloads_[worker_id];
-                iter = task_lists.erase(iter);
             } else {
-                ++iter;
+                task_queue->Enqueue(fragment_task, TaskPriority(fragment_task));
             }
         } else {
             error = true;
             finish = true;
             --worker_workloads_[worker_id];
-            iter = task_lists.erase(iter);
         }
         if (finish) {
             fragment_ctx->notifier()->FinishTask(error, fragment_ctx);
@@ -19,21 +19,43 @@ export module task_scheduler;
 import config;
 import stl;
 import fragment_task;
-import blocking_queue;
 import base_statement;
+import options;
 
 namespace infinity {
 
 class QueryContext;
 class PlanFragment;
 
-using FragmentTaskBlockQueue = BlockingQueue<FragmentTask*>;
+// Tasks of a worker in one lane per QueryPriority. The lanes take turns by their shares, so a lower priority lane still
+// makes progress while a higher priority lane is busy.
+class WorkerQueue {
+public:
+    void Enqueue(FragmentTask *task, QueryPriority priority);
+
+    bool TryDequeue(FragmentTask *&task);
+
+    // Wait for a task at most timeout.
+    bool TryDequeueFor(FragmentTask *&task, MicroSeconds timeout);
+
+    // Take a task from the back of the highest priority lane for another worker, terminators are never stolen.
+    bool TrySteal(FragmentTask *&task);
+
+private:
+    bool PopByShare(FragmentTask *&task);
+
+    std::mutex mutex_{};
+    std::condition_variable cv_{};
+    Array<Deque<FragmentTask *>, QUERY_PRIORITY_COUNT> lanes_{};
+    Array<SizeT, QUERY_PRIORITY_COUNT> credits_{};
+};
 
 struct Worker {
-    Worker(u64 cpu_id, UniquePtr<FragmentTaskBlockQueue> queue, UniquePtr<Thread> thread)
-        : cpu_id_(cpu_id), queue_(std::move(queue)), thread_(std::move(thread)) {}
+    Worker(u64 cpu_id, u64 numa_node, UniquePtr<WorkerQueue> queue, UniquePtr<Thread> thread)
+        : cpu_id_(cpu_id), numa_node_(numa_node), queue_(std::move(queue)), thread_(std::move(thread)) {}
     u64 cpu_id_{0};
-    UniquePtr<FragmentTaskBlockQueue> queue_{};
+    u64 numa_node_{0}; // index into TaskScheduler::node_workers_
+    UniquePtr<WorkerQueue> queue_{};
     UniquePtr<Thread> thread_{};
 };
 
@@ -53,10 +75,36 @@ public:
     // `plan_fragment` can be scheduled because all of its dependencies are met.
     void ScheduleFragment(PlanFragment *plan_fragment);
 
+    // Schedule the pending tasks of the fragment which have data in their source queue
+    void WakeUpFragment(PlanFragment *plan_fragment);
+
     void DumpPlanFragment(PlanFragment *plan_fragment);
 
+    // Wait until the query can run within the query concurrency limit. The queries of a higher priority are admitted
+    // first. Returns false if the statement doesn't run on the workers, then ReleaseQuery isn't called.
+    bool AdmitQuery(const BaseStatement *base_statement, QueryPriority priority);
+
+    // A plan of a single fragment with a single task is run by Schedule on the calling thread.
+    static bool RunInline(PlanFragment *plan_fragment);
+
+    void ReleaseQuery();
+
+    // Workers which have no queued or running task at the moment
+    u64 IdleWorkerCount() const;
+
+    u64 WorkerCount() const { return worker_count_; }
+
+    // Queued and running tasks of the worker
+    u64 WorkerQueueDepth(u64 worker_id) const { return worker_workloads_[worker_id].load(); }
+
+    // Time the worker spent in running tasks, in nanoseconds
+    u64 WorkerBusyTime(u64 worker_id) const { return worker_busy_times_[worker_id].load(std::memory_order_relaxed); }
+
 private:
-    u64 FindLeastWorkloadWorker();
+    static bool UseScheduler(const BaseStatement *base_statement);
+
+    // In NUMA aware mode a task scoped to a segment goes to the workers of the node of the segment.
+    u64 FindLeastWorkloadWorker(const FragmentTask *task);
 
     SizeT GetStartFragments(PlanFragment* plan_fragment, Vector<PlanFragment *>& leaf_fragments);
 
@@ -64,15 +112,29 @@ private:
 
     void RunTask(FragmentTask *task);
 
-    void WorkerLoop(FragmentTaskBlockQueue *task_queue, i64 worker_id);
+    // Take a queued task from the back of another worker's queue.
+    bool StealTask(u64 worker_id, FragmentTask *&task);
+
+    void WorkerLoop(WorkerQueue *task_queue, i64 worker_id);
 
 private:
     bool initialized_{false};
 
     Vector<Worker> worker_array_{};
     Deque<Atomic<u64>> worker_workloads_{};
+    Deque<Atomic<u64>> worker_busy_times_{}; // only added to by the worker itself
 
     u64 worker_count_{0};
+
+    bool numa_aware_{false};
+    Vector<i64> numa_node_ids_{};          // NUMA node id of each node index
+    Vector<Vector<u64>> node_workers_{};   // workers of each node index
+
+    std::mutex admission_mutex_{};
+    std::condition_variable admission_cv_{};
+    u64 query_concurrency_limit_{0};
+    u64 running_query_n_{0};
+    Array<u64, QUERY_PRIORITY_COUNT> waiting_query_n_{};
 };
 
 } // namespace infinity
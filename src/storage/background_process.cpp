@@ -21,6 +21,9 @@ module background_process;
 import stl;
 import bg_task;
 import compact_segments_task;
+import rebuild_hnsw_task;
+import merge_fulltext_chunks_task;
+import warmup_indexes_task;
 import update_segment_bloom_filter_task;
 import logger;
 import blocking_queue;
@@ -28,93 +31,231 @@ import infinity_exception;
 import wal_manager;
 import catalog;
 import third_party;
+import buffer_manager;
+import default_values;
+import io_stats;
+import trace_span;
 
 namespace infinity {
 
-BGTaskProcessor::BGTaskProcessor(WalManager *wal_manager, Catalog *catalog) : wal_manager_(wal_manager), catalog_(catalog) {}
+namespace {
+
+// The threads of each lane. Two tasks of one type, e.g. two compactions of a table, aren't safe to run at the same time.
+constexpr Array<SizeT, static_cast<SizeT>(BGTaskLane::kInvalid)> LANE_THREAD_COUNT{1, 1, 1, 1};
+
+// The lanes stop in this order, the checkpoint lane is the last since the commits of the other lanes add delta entries to it.
+constexpr Array<BGTaskLane, static_cast<SizeT>(BGTaskLane::kInvalid)> LANE_STOP_ORDER{BGTaskLane::kCompaction,
+                                                                                    BGTaskLane::kIndexBuild,
+                                                                                    BGTaskLane::kCleanup,
+                                                                                    BGTaskLane::kCheckpoint};
+
+} // namespace
+
+String BGTaskLaneToString(BGTaskLane lane) {
+    switch (lane) {
+        case BGTaskLane::kCheckpoint:
+            return "checkpoint";
+        case BGTaskLane::kCompaction:
+            return "compaction";
+        case BGTaskLane::kIndexBuild:
+            return "index build";
+        case BGTaskLane::kCleanup:
+            return "cleanup";
+        default:
+            return "invalid";
+    }
+}
+
+BGTaskProcessor::BGTaskProcessor(WalManager *wal_manager, Catalog *catalog, BufferManager *buffer_mgr)
+    : wal_manager_(wal_manager), catalog_(catalog), buffer_mgr_(buffer_mgr) {}
 
 void BGTaskProcessor::Start() {
-    processor_thread_ = Thread([this] { Process(); });
+    for (SizeT lane_idx = 0; lane_idx < lanes_.size(); ++lane_idx) {
+        for (SizeT thread_idx = 0; thread_idx < LANE_THREAD_COUNT[lane_idx]; ++thread_idx) {
+            lanes_[lane_idx].threads_.emplace_back([this, lane_idx] { Process(static_cast<BGTaskLane>(lane_idx)); });
+        }
+    }
     LOG_INFO("Background processor is started.");
 }
 
 void BGTaskProcessor::Stop() {
     LOG_INFO("Background processor is stopping.");
-    SharedPtr<StopProcessorTask> stop_task = MakeShared<StopProcessorTask>();
-    task_queue_.Enqueue(stop_task);
-    stop_task->Wait();
-    processor_thread_.join();
+    for (BGTaskLane lane : LANE_STOP_ORDER) {
+        Lane &current_lane = lanes_[static_cast<SizeT>(lane)];
+        // Each thread of the lane takes one stop task.
+        Vector<SharedPtr<StopProcessorTask>> stop_tasks;
+        for (SizeT thread_idx = 0; thread_idx < current_lane.threads_.size(); ++thread_idx) {
+            stop_tasks.push_back(MakeShared<StopProcessorTask>());
+            current_lane.task_queue_.Enqueue(stop_tasks.back());
+        }
+        for (const auto &stop_task : stop_tasks) {
+            stop_task->Wait();
+        }
+        for (Thread &thread : current_lane.threads_) {
+            thread.join();
+        }
+        current_lane.threads_.clear();
+    }
     LOG_INFO("Background processor is stopped.");
 }
 
-void BGTaskProcessor::Submit(SharedPtr<BGTask> bg_task) { task_queue_.Enqueue(std::move(bg_task)); }
-
-void BGTaskProcessor::Process() {
-    bool running{true};
-    Deque<SharedPtr<BGTask>> tasks;
-    while (running) {
-        task_queue_.DequeueBulk(tasks);
-        for(const auto& bg_task: tasks) {
-            switch (bg_task->type_) {
-                case BGTaskType::kStopProcessor: {
-                    LOG_INFO("Stop the background processor");
-                    running = false;
-                    break;
-                }
-                case BGTaskType::kForceCheckpoint: {
-                    LOG_INFO("Force checkpoint in background");
-                    ForceCheckpointTask *force_ckp_task = static_cast<ForceCheckpointTask *>(bg_task.get());
-                    auto [max_commit_ts, wal_size] = catalog_->GetCheckpointState();
-                    wal_manager_->Checkpoint(force_ckp_task, max_commit_ts, wal_size);
-                    LOG_INFO("Force checkpoint in background done");
-                    break;
-                }
-                case BGTaskType::kAddDeltaEntry: {
-                    auto *task = static_cast<AddDeltaEntryTask *>(bg_task.get());
-                    catalog_->AddDeltaEntry(std::move(task->delta_entry_), task->wal_size_);
-                    break;
-                }
-                case BGTaskType::kCheckpoint: {
-                    LOG_INFO("Checkpoint in background");
-                    auto *task = static_cast<CheckpointTask *>(bg_task.get());
-                    bool is_full_checkpoint = task->is_full_checkpoint_;
-                    auto [max_commit_ts, wal_size] = catalog_->GetCheckpointState();
-                    wal_manager_->Checkpoint(is_full_checkpoint, max_commit_ts, wal_size);
-                    LOG_INFO("Checkpoint in background done");
-                    break;
-                }
-                case BGTaskType::kCompactSegments: {
-                    LOG_INFO("Compact segments in background");
-                    auto *task = static_cast<CompactSegmentsTask *>(bg_task.get());
-//                    task->BeginTxn();
-                    task->Execute();
-                    task->CommitTxn();
-                    LOG_INFO("Compact segments in background done");
-                    break;
-                }
-                case BGTaskType::kCleanup: {
-                    LOG_INFO("Cleanup in background");
-                    auto task = static_cast<CleanupTask *>(bg_task.get());
-                    task->Execute();
-                    LOG_INFO("Cleanup in background done");
-                    break;
-                }
-                case BGTaskType::kUpdateSegmentBloomFilterData: {
-                    LOG_INFO("Update segment bloom filter");
-                    auto *task = static_cast<UpdateSegmentBloomFilterTask *>(bg_task.get());
-                    task->Execute();
-                    LOG_INFO("Update segment bloom filter done");
-                    break;
-                }
-                default: {
-                    UnrecoverableError("Invalid background task");
-                    break;
-                }
-            }
+void BGTaskProcessor::Submit(SharedPtr<BGTask> bg_task) {
+    BGTaskLane lane = LaneOf(bg_task->type_);
+    lanes_[static_cast<SizeT>(lane)].task_queue_.Enqueue(std::move(bg_task));
+}
+
+BGTaskLane BGTaskProcessor::LaneOf(BGTaskType type) {
+    switch (type) {
+        case BGTaskType::kAddDeltaEntry:
+        case BGTaskType::kCheckpoint:
+        case BGTaskType::kForceCheckpoint: {
+            return BGTaskLane::kCheckpoint;
+        }
+        case BGTaskType::kCompactSegments: {
+            return BGTaskLane::kCompaction;
+        }
+        case BGTaskType::kRebuildHnswIndex:
+        case BGTaskType::kMergeFulltextChunks:
+        case BGTaskType::kWarmupIndexes:
+        case BGTaskType::kUpdateSegmentBloomFilterData: {
+            return BGTaskLane::kIndexBuild;
+        }
+        case BGTaskType::kCleanup: {
+            return BGTaskLane::kCleanup;
+        }
+        default: {
+            UnrecoverableError(fmt::format("Invalid background task: {}", BGTaskTypeToString(type)));
+            return BGTaskLane::kInvalid;
+        }
+    }
+}
+
+Vector<Pair<BGTaskLane, SizeT>> BGTaskProcessor::QueueLengths() const {
+    Vector<Pair<BGTaskLane, SizeT>> queue_lengths;
+    for (SizeT lane_idx = 0; lane_idx < lanes_.size(); ++lane_idx) {
+        queue_lengths.emplace_back(static_cast<BGTaskLane>(lane_idx), lanes_[lane_idx].task_queue_.Size());
+    }
+    return queue_lengths;
+}
 
+void BGTaskProcessor::DeferUnderMemoryPressure(const char *task_name) {
+    if (buffer_mgr_ == nullptr) {
+        return;
+    }
+    if (!buffer_mgr_->WaitForMemoryPressureBelow(MemoryPressure::kCritical, std::chrono::milliseconds(BG_TASK_MEMORY_WAIT_MS))) {
+        LOG_WARN(fmt::format("{} runs under critical memory pressure, buffer memory {} / {}",
+                             task_name,
+                             buffer_mgr_->memory_usage(),
+                             buffer_mgr_->memory_limit()));
+    }
+}
+
+void BGTaskProcessor::Process(BGTaskLane lane) {
+    BlockingQueue<SharedPtr<BGTask>> &task_queue = lanes_[static_cast<SizeT>(lane)].task_queue_;
+    while (true) {
+        SharedPtr<BGTask> bg_task = task_queue.DequeueReturn();
+        if (bg_task->type_ == BGTaskType::kStopProcessor) {
+            LOG_INFO(fmt::format("Stop the {} lane of the background processor", BGTaskLaneToString(lane)));
             bg_task->Complete();
+            break;
+        }
+        ProcessTask(bg_task.get());
+        bg_task->Complete();
+    }
+}
+
+void BGTaskProcessor::ProcessTask(BGTask *bg_task) {
+    switch (bg_task->type_) {
+        case BGTaskType::kForceCheckpoint: {
+            LOG_INFO("Force checkpoint in background");
+            ForceCheckpointTask *force_ckp_task = static_cast<ForceCheckpointTask *>(bg_task);
+            std::lock_guard<std::mutex> lock(checkpoint_cleanup_mutex_);
+            IOPurposeScope io_purpose_scope(IOPurpose::kCheckpoint);
+            TraceSpan checkpoint_span("background", "force checkpoint");
+            auto [max_commit_ts, wal_size] = catalog_->GetCheckpointState();
+            wal_manager_->Checkpoint(force_ckp_task, max_commit_ts, wal_size);
+            LOG_INFO("Force checkpoint in background done");
+            break;
+        }
+        case BGTaskType::kAddDeltaEntry: {
+            auto *task = static_cast<AddDeltaEntryTask *>(bg_task);
+            catalog_->AddDeltaEntry(std::move(task->delta_entry_), task->wal_size_);
+            break;
+        }
+        case BGTaskType::kCheckpoint: {
+            LOG_INFO("Checkpoint in background");
+            auto *task = static_cast<CheckpointTask *>(bg_task);
+            bool is_full_checkpoint = task->is_full_checkpoint_;
+            std::lock_guard<std::mutex> lock(checkpoint_cleanup_mutex_);
+            IOPurposeScope io_purpose_scope(IOPurpose::kCheckpoint);
+            TraceSpan checkpoint_span("background", is_full_checkpoint ? "full checkpoint" : "delta checkpoint");
+            auto [max_commit_ts, wal_size] = catalog_->GetCheckpointState();
+            wal_manager_->Checkpoint(is_full_checkpoint, max_commit_ts, wal_size);
+            LOG_INFO("Checkpoint in background done");
+            break;
+        }
+        case BGTaskType::kCompactSegments: {
+            LOG_INFO("Compact segments in background");
+            auto *task = static_cast<CompactSegmentsTask *>(bg_task);
+            DeferUnderMemoryPressure("Compact segments");
+            IOPurposeScope io_purpose_scope(IOPurpose::kCompaction);
+            TraceSpan compact_span("background", "compact segments");
+//            task->BeginTxn();
+            task->Execute();
+            task->CommitTxn();
+            LOG_INFO("Compact segments in background done");
+            break;
+        }
+        case BGTaskType::kRebuildHnswIndex: {
+            LOG_INFO("Rebuild hnsw index in background");
+            auto *task = static_cast<RebuildHnswTask *>(bg_task);
+            DeferUnderMemoryPressure("Rebuild hnsw index");
+            IOPurposeScope io_purpose_scope(IOPurpose::kIndexBuild);
+            TraceSpan rebuild_span("background", "rebuild hnsw index");
+            task->Execute();
+            task->CommitTxn();
+            LOG_INFO("Rebuild hnsw index in background done");
+            break;
+        }
+        case BGTaskType::kMergeFulltextChunks: {
+            LOG_INFO("Merge fulltext chunks in background");
+            auto *task = static_cast<MergeFulltextChunksTask *>(bg_task);
+            DeferUnderMemoryPressure("Merge fulltext chunks");
+            IOPurposeScope io_purpose_scope(IOPurpose::kIndexBuild);
+            TraceSpan merge_span("background", "merge fulltext chunks");
+            task->Execute();
+            task->CommitTxn();
+            LOG_INFO("Merge fulltext chunks in background done");
+            break;
+        }
+        case BGTaskType::kWarmupIndexes: {
+            LOG_INFO("Warm up pinned indexes in background");
+            auto *task = static_cast<WarmupIndexesTask *>(bg_task);
+            task->Execute();
+            task->CommitTxn();
+            LOG_INFO("Warm up pinned indexes in background done");
+            break;
+        }
+        case BGTaskType::kCleanup: {
+            LOG_INFO("Cleanup in background");
+            auto task = static_cast<CleanupTask *>(bg_task);
+            std::lock_guard<std::mutex> lock(checkpoint_cleanup_mutex_);
+            TraceSpan cleanup_span("background", "cleanup");
+            task->Execute();
+            LOG_INFO("Cleanup in background done");
+            break;
+        }
+        case BGTaskType::kUpdateSegmentBloomFilterData: {
+            LOG_INFO("Update segment bloom filter");
+            auto *task = static_cast<UpdateSegmentBloomFilterTask *>(bg_task);
+            task->Execute();
+            LOG_INFO("Update segment bloom filter done");
+            break;
+        }
+        default: {
+            UnrecoverableError("Invalid background task");
+            break;
         }
-        tasks.clear();
     }
 }
 
@@ -24,25 +24,53 @@ export module background_process;
 namespace infinity {
 
 class Catalog;
+class BufferManager;
+
+// Each lane has its own queue and threads, so that a long compaction or index build doesn't hold back the checkpoints.
+export enum class BGTaskLane : u8 {
+    kCheckpoint,
+    kCompaction,
+    kIndexBuild,
+    kCleanup,
+    kInvalid,
+};
+
+export String BGTaskLaneToString(BGTaskLane lane);
 
 export class BGTaskProcessor {
 public:
-    explicit BGTaskProcessor(WalManager *wal_manager, Catalog *catalog);
+    explicit BGTaskProcessor(WalManager *wal_manager, Catalog *catalog, BufferManager *buffer_mgr);
     void Start();
     void Stop();
 
 public:
     void Submit(SharedPtr<BGTask> bg_task);
 
+    static BGTaskLane LaneOf(BGTaskType type);
+
+    // The count of the tasks waiting in each lane.
+    Vector<Pair<BGTaskLane, SizeT>> QueueLengths() const;
+
 private:
-    void Process();
+    void Process(BGTaskLane lane);
+
+    void ProcessTask(BGTask *bg_task);
+
+    // Defer a task which needs much memory while the buffers in use fill the buffer memory, so that it doesn't fight the queries.
+    void DeferUnderMemoryPressure(const char *task_name);
 
 private:
-    BlockingQueue<SharedPtr<BGTask>> task_queue_;
-    Thread processor_thread_{};
+    struct Lane {
+        BlockingQueue<SharedPtr<BGTask>> task_queue_{};
+        Vector<Thread> threads_{};
+    };
+    Array<Lane, static_cast<SizeT>(BGTaskLane::kInvalid)> lanes_{};
+    // Checkpoints and cleanups both walk the catalog and the files on disk, they still run one at a time.
+    std::mutex checkpoint_cleanup_mutex_{};
 
     WalManager *wal_manager_{};
     Catalog *catalog_{};
+    BufferManager *buffer_mgr_{};
 };
 
 } // namespace infinity
@@ -32,6 +32,9 @@ export enum class BGTaskType {
     kCompactSegments,
     kCleanup,
     kUpdateSegmentBloomFilterData, // Not used
+    kRebuildHnswIndex,
+    kMergeFulltextChunks,
+    kWarmupIndexes,
     kInvalid
 };
 
@@ -51,6 +54,12 @@ export String BGTaskTypeToString(BGTaskType type) {
             return "Cleanup";
         case BGTaskType::kUpdateSegmentBloomFilterData:
             return "UpdateSegmentBloomFilterData";
+        case BGTaskType::kRebuildHnswIndex:
+            return "RebuildHnswIndex";
+        case BGTaskType::kMergeFulltextChunks:
+            return "MergeFulltextChunks";
+        case BGTaskType::kWarmupIndexes:
+            return "WarmupIndexes";
         default:
             return "Invalid";
     }
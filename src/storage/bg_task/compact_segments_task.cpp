@@ -38,6 +38,7 @@ import wal_manager;
 import wal_entry;
 import global_block_id;
 import block_index;
+import engine_metrics;
 import segment_iter;
 import segment_entry;
 import table_index_entry;
@@ -47,9 +48,35 @@ import compaction_alg;
 import status;
 import build_fast_rough_filter_task;
 import catalog_delta_entry;
+import index_base;
+import index_full_text;
+import index_defines;
+import analyzer_pool;
+import analyzer;
+import term;
+import bp_reorder;
+import sort_key;
+import select_statement;
+import column_def;
+import data_type;
+import logical_type;
+import internal_types;
+import value;
+import fast_rough_filter;
+import filter_expression_push_down_helper;
 
 namespace infinity {
 
+namespace {
+
+// Slow down while the buffers in use fill the buffer memory: the new blocks can't be freed until they are flushed, and
+// reading old blocks evicts the blocks the queries use.
+void ThrottleUnderMemoryPressure(BufferManager *buffer_mgr) {
+    buffer_mgr->WaitForMemoryPressureBelow(MemoryPressure::kHigh, std::chrono::milliseconds(COMPACT_BLOCK_MEMORY_WAIT_MS));
+}
+
+} // namespace
+
 RowID RowIDRemapper::GetNewRowID(SegmentID segment_id, BlockID block_id, BlockOffset block_offset) const {
     auto &block_vec = row_id_map_.at(GlobalBlockID(segment_id, block_id));
     auto iter = std::upper_bound(block_vec.begin(),
@@ -62,7 +89,7 @@ RowID RowIDRemapper::GetNewRowID(SegmentID segment_id, BlockID block_id, BlockOf
     }
     --iter;
     RowID rtn = iter->second;
-    rtn.segment_offset_ += iter->first - block_offset;
+    rtn.segment_offset_ += block_offset - iter->first;
     return rtn;
 }
 
@@ -126,6 +153,12 @@ SharedPtr<CompactSegmentsTask> CompactSegmentsTask::MakeTaskWithWholeTable(Table
     return MakeShared<CompactSegmentsTask>(table_entry, std::move(segments), txn, CompactSegmentsTaskType::kCompactTable);
 }
 
+SharedPtr<CompactSegmentsTask> CompactSegmentsTask::MakeTaskWithExpiry(TableEntry *table_entry, Txn *txn) {
+    Vector<SegmentEntry *> segments = table_entry->PickCompactSegments(); // the compaction is resumed without the dropped segments
+    LOG_TRACE(fmt::format("Add expire task, table dir: {}, begin ts: {}", *table_entry->TableEntryDir(), txn->BeginTS()));
+    return MakeShared<CompactSegmentsTask>(table_entry, std::move(segments), txn, CompactSegmentsTaskType::kExpireTable);
+}
+
 CompactSegmentsTask::CompactSegmentsTask(TableEntry *table_entry, Vector<SegmentEntry *> &&segments, Txn *txn, CompactSegmentsTaskType type)
     : BGTask(BGTaskType::kCompactSegments, false), task_type_(type), db_name_(table_entry->GetDBName()), table_name_(table_entry->GetTableName()),
       commit_ts_(table_entry->commit_ts_), segments_(std::move(segments)), txn_(txn) {}
@@ -145,11 +178,20 @@ bool CompactSegmentsTask::Execute() {
         // If the table is compacted, the table will be removed.
         return false;
     }
+    auto compact_begin = Clock::now();
     CompactSegmentsTaskState state(table_entry);
-    CompactSegments(state);
-    CreateNewIndex(state);
+    if (task_type_ == CompactSegmentsTaskType::kExpireTable) {
+        ExpireRows(state);
+        if (state.old_segments_.empty()) {
+            return true;
+        }
+    } else {
+        CompactSegments(state);
+        CreateNewIndex(state);
+    }
     SaveSegmentsData(state);
     ApplyDeletes(state);
+    EngineMetrics::instance().compaction_duration_us_.Observe(ChronoCast<MicroSeconds>(Clock::now() - compact_begin).count());
     return true;
 }
 
@@ -159,12 +201,13 @@ void CompactSegmentsTask::CompactSegments(CompactSegmentsTaskState &state) {
     auto &old_segments = state.old_segments_;
 
     auto block_index = MakeShared<BlockIndex>();
+    ThreadPool pool(COMPACT_THREAD_NUM);
     auto DoCompact = [&](const Vector<SegmentEntry *> &to_compact_segments) {
         if (to_compact_segments.empty()) {
             return;
         }
 
-        auto new_segment = CompactSegmentsToOne(state, to_compact_segments);
+        auto new_segment = CompactSegmentsToOne(state, to_compact_segments, pool);
         block_index->Insert(new_segment.get(), UNCOMMIT_TS, false);
         {
             String ss;
@@ -187,7 +230,7 @@ void CompactSegmentsTask::CompactSegments(CompactSegmentsTaskState &state) {
                     to_compact_segments.push_back(segment);
                 }
             }
-            GreedyCompactableSegmentsGenerator generator(to_compact_segments, DEFAULT_SEGMENT_CAPACITY);
+            GreedyCompactableSegmentsGenerator generator(to_compact_segments, state.table_entry_->segment_capacity());
 
             while (true) {
                 Vector<SegmentEntry *> to_compact_segments = generator.generate();
@@ -221,6 +264,80 @@ void CompactSegmentsTask::CompactSegments(CompactSegmentsTaskState &state) {
     state.new_table_ref_ = MakeUnique<BaseTableRef>(state.table_entry_, block_index);
 }
 
+void CompactSegmentsTask::ExpireRows(CompactSegmentsTaskState &state) {
+    auto *table_entry = state.table_entry_;
+    ColumnID ttl_column_id = table_entry->ttl_column_id();
+    bool is_timestamp = table_entry->GetColumnDefByID(ttl_column_id)->type()->type() == LogicalType::kTimestamp;
+    auto make_value = [is_timestamp](i64 epoch_seconds) {
+        return is_timestamp ? Value::MakeTimestamp(TimestampT(epoch_seconds)) : Value::MakeDateTime(DateTimeT(epoch_seconds));
+    };
+    // the rows before the cutoff are expired
+    i64 now_seconds = std::chrono::duration_cast<Seconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+    i64 cutoff = now_seconds - static_cast<i64>(table_entry->ttl_seconds());
+    const DateTimeT cutoff_time(cutoff);
+    const Value expired_max = make_value(cutoff - 1);
+    const Value live_min = make_value(cutoff);
+
+    // 1. the sealed segments whose rows are all expired are dropped, the compaction goes on with the other picked segments
+    auto &old_segments = state.old_segments_;
+    Vector<SegmentEntry *> kept_segments;
+    for (auto *segment : segments_) {
+        if (segment->GetFastRoughFilter()->BuiltAllInRange(ttl_column_id, expired_max, FilterCompareType::kLessEqual) &&
+            segment->TrySetCompacting(this)) {
+            old_segments.push_back(segment);
+        } else {
+            kept_segments.push_back(segment);
+        }
+    }
+    table_entry->ResumeCompaction(kept_segments);
+    if (!old_segments.empty()) {
+        String ss;
+        for (auto *segment : old_segments) {
+            ss += std::to_string(segment->segment_id()) + " ";
+        }
+        LOG_INFO(fmt::format("Table {}, dropping expired segments: {}", *table_name_, ss));
+        state.segment_data_.emplace_back(nullptr, old_segments);
+    }
+
+    // 2. the expired rows of the other segments are deleted, the blocks whose rows are all alive are skipped
+    TxnTimeStamp begin_ts = txn_->BeginTS();
+    BufferManager *buffer_mgr = txn_->buffer_mgr();
+    SharedPtr<BlockIndex> block_index = table_entry->GetBlockIndex(begin_ts);
+    Vector<RowID> row_ids;
+    for (auto *segment : block_index->segments_) {
+        if (std::find(old_segments.begin(), old_segments.end(), segment) != old_segments.end() ||
+            segment->GetFastRoughFilter()->BuiltAllInRange(ttl_column_id, live_min, FilterCompareType::kGreaterEqual)) {
+            continue;
+        }
+        BlockEntryIter block_entry_iter(segment);
+        for (auto *block = block_entry_iter.Next(); block != nullptr; block = block_entry_iter.Next()) {
+            if (block->GetFastRoughFilter()->BuiltAllInRange(ttl_column_id, live_min, FilterCompareType::kGreaterEqual)) {
+                continue;
+            }
+            ColumnVector column = block->GetColumnBlockEntry(ttl_column_id)->GetColumnVector(buffer_mgr);
+            // a timestamp is a datetime
+            const auto *times = reinterpret_cast<const DateTimeT *>(column.data());
+            SizeT read_offset = 0;
+            while (true) {
+                auto [row_begin, row_end] = block->GetVisibleRange(begin_ts, read_offset);
+                if (row_begin == row_end) {
+                    break;
+                }
+                for (SizeT row = row_begin; row < row_end; ++row) {
+                    if (times[row] < cutoff_time) {
+                        row_ids.emplace_back(segment->segment_id(), block->block_id() * DEFAULT_BLOCK_CAPACITY + row);
+                    }
+                }
+                read_offset = row_end;
+            }
+        }
+    }
+    if (!row_ids.empty()) {
+        LOG_INFO(fmt::format("Table {}, deleting {} expired rows", *table_name_, row_ids.size()));
+        txn_->Delete(*db_name_, *table_name_, row_ids, false);
+    }
+}
+
 void CompactSegmentsTask::CreateNewIndex(CompactSegmentsTaskState &state) {
     BaseTableRef *new_table_ref = state.new_table_ref_.get();
     auto *table_entry = new_table_ref->table_entry_ptr_;
@@ -255,7 +372,7 @@ void CompactSegmentsTask::SaveSegmentsData(CompactSegmentsTaskState &state) {
 
     TxnTimeStamp flush_ts = txn_->BeginTS();
     for (auto &[new_segment, old_segments] : segment_data) {
-        if (new_segment->row_count() > 0) {
+        if (new_segment.get() != nullptr && new_segment->row_count() > 0) {
             new_segment->FlushNewData(flush_ts);
             segment_infos.push_back(WalSegmentInfo(new_segment.get()));
         }
@@ -276,6 +393,10 @@ void CompactSegmentsTask::ApplyDeletes(CompactSegmentsTaskState &state) {
     for (auto *old_segment : old_segments) {
         old_segment->SetNoDelete();
     }
+    if (task_type_ == CompactSegmentsTaskType::kExpireTable) {
+        // the rows deleted while expiring are dropped with their segments
+        return;
+    }
 
     Vector<RowID> row_ids;
     for (const auto &delete_info : to_deletes_) {
@@ -293,8 +414,63 @@ void CompactSegmentsTask::AddToDelete(SegmentID segment_id, Vector<SegmentOffset
     to_deletes_.emplace_back(ToDeleteInfo{segment_id, std::move(delete_offsets)});
 }
 
-SharedPtr<SegmentEntry> CompactSegmentsTask::CompactSegmentsToOne(CompactSegmentsTaskState &state, const Vector<SegmentEntry *> &segments) {
+SharedPtr<IndexBase> CompactSegmentsTask::GetReorderIndex(TableEntry *table_entry) {
+    TransactionID txn_id = txn_->TxnID();
+    TxnTimeStamp begin_ts = txn_->BeginTS();
+
+    auto map_guard = table_entry->IndexMetaMap();
+    for (auto &[index_name, table_index_meta] : *map_guard) {
+        auto [table_index_entry, status] = table_index_meta->GetEntryNolock(txn_id, begin_ts);
+        if (!status.ok()) {
+            continue;
+        }
+        const SharedPtr<IndexBase> &index_base = table_index_entry->table_index_def();
+        if (index_base->index_type_ == IndexType::kFullText and (static_cast<const IndexFullText *>(index_base.get())->flag_ & of_doc_reorder)) {
+            return index_base;
+        }
+    }
+    return nullptr;
+}
+
+SharedPtr<SegmentEntry>
+CompactSegmentsTask::CompactSegmentsToOne(CompactSegmentsTaskState &state, const Vector<SegmentEntry *> &segments, ThreadPool &pool) {
     auto *table_entry = state.table_entry_;
+    if (ColumnID sort_column_id = table_entry->sort_column_id(); sort_column_id != INVALID_COLUMN_ID) {
+        const DataType &sort_type = *table_entry->GetColumnDefByID(sort_column_id)->type();
+        return CompactSegmentsToOneInOrder(state, segments, [&](const Vector<Vector<ColumnVector>> &block_columns, const Vector<OldRow> &old_rows) {
+            Vector<u64> keys;
+            keys.reserve(old_rows.size());
+            for (const OldRow &old_row : old_rows) {
+                const ColumnVector &column = block_columns[old_row.block_idx_][sort_column_id];
+                keys.push_back(SortKeyEncoder::EncodeFixed(column, sort_type, OrderType::kAsc, old_row.block_offset_));
+            }
+            return OrderByFixedKeys(keys);
+        });
+    }
+    if (SharedPtr<IndexBase> reorder_index = GetReorderIndex(table_entry); reorder_index.get() != nullptr) {
+        const auto *index_fulltext = static_cast<const IndexFullText *>(reorder_index.get());
+        ColumnID text_column_id = table_entry->GetColumnIdByName(index_fulltext->column_name());
+        return CompactSegmentsToOneInOrder(state, segments, [&](const Vector<Vector<ColumnVector>> &block_columns, const Vector<OldRow> &old_rows) {
+            // the distinct terms of each row
+            Vector<u32> doc_term_offsets{0};
+            Vector<u32> doc_terms;
+            HashMap<String, u32> term_ids;
+            ScopedAnalyzer analyzer(index_fulltext->analyzer_);
+            for (const OldRow &old_row : old_rows) {
+                TermList terms;
+                analyzer->Analyze(block_columns[old_row.block_idx_][text_column_id].ToString(old_row.block_offset_), terms);
+                SizeT doc_begin = doc_terms.size();
+                for (const Term &term : terms) {
+                    auto [iter, _] = term_ids.emplace(term.text_, term_ids.size());
+                    doc_terms.push_back(iter->second);
+                }
+                std::sort(doc_terms.begin() + doc_begin, doc_terms.end());
+                doc_terms.erase(std::unique(doc_terms.begin() + doc_begin, doc_terms.end()), doc_terms.end());
+                doc_term_offsets.push_back(doc_terms.size());
+            }
+            return BPReorder(doc_term_offsets, doc_terms, term_ids.size());
+        });
+    }
     auto &remapper = state.remapper_;
     auto new_segment = SegmentEntry::NewSegmentEntry(table_entry, Catalog::GetNextSegmentID(table_entry), txn_);
 
@@ -302,15 +478,18 @@ SharedPtr<SegmentEntry> CompactSegmentsTask::CompactSegmentsToOne(CompactSegment
     SizeT column_count = table_entry->ColumnCount();
     BufferManager *buffer_mgr = txn_->buffer_mgr();
 
-    auto new_block = BlockEntry::NewBlockEntry(new_segment.get(), 0, 0, column_count, txn_);
+    struct CopyRange {
+        BlockEntry *old_block_;
+        BlockOffset row_begin_;
+        SizeT read_size_;
+    };
+
+    // 1. assign the visible rows to the new blocks in order, and map the old row ids to the new ones
+    Vector<Vector<CopyRange>> new_block_ranges(1);
+    SizeT new_block_row_count = 0;
     for (auto *old_segment : segments) {
         BlockEntryIter block_entry_iter(old_segment); // TODO: compact segment should be sealed. use better way to iterate block
         for (auto *old_block = block_entry_iter.Next(); old_block != nullptr; old_block = block_entry_iter.Next()) {
-            Vector<ColumnVector> input_column_vectors;
-            for (ColumnID column_id = 0; column_id < column_count; ++column_id) {
-                auto *column_block_entry = old_block->GetColumnBlockEntry(column_id);
-                input_column_vectors.emplace_back(column_block_entry->GetColumnVector(buffer_mgr));
-            }
             SizeT read_offset = 0;
             while (true) {
                 // The delete ops after begin_ts is not visible and must in to_delete
@@ -319,32 +498,144 @@ SharedPtr<SegmentEntry> CompactSegmentsTask::CompactSegmentsToOne(CompactSegment
                 if (read_size == 0) {
                     break;
                 }
-
-                auto block_entry_append = [&](SizeT row_begin, SizeT read_size) {
-                    new_block->AppendBlock(input_column_vectors, row_begin, read_size, buffer_mgr);
-                    RowID new_row_id(new_segment->segment_id(), new_block->block_id() * DEFAULT_BLOCK_CAPACITY + new_block->row_count());
+                while (read_size > 0) {
+                    if (new_block_row_count == static_cast<SizeT>(DEFAULT_BLOCK_CAPACITY)) {
+                        new_block_ranges.emplace_back();
+                        new_block_row_count = 0;
+                    }
+                    SizeT copy_size = std::min<SizeT>(read_size, DEFAULT_BLOCK_CAPACITY - new_block_row_count);
+                    BlockID new_block_id = new_block_ranges.size() - 1;
+                    RowID new_row_id(new_segment->segment_id(), new_block_id * DEFAULT_BLOCK_CAPACITY + new_block_row_count);
                     remapper.AddMap(old_segment->segment_id(), old_block->block_id(), row_begin, new_row_id);
-                    read_offset = row_begin + read_size;
-                };
+                    new_block_ranges.back().push_back(CopyRange{old_block, static_cast<BlockOffset>(row_begin), copy_size});
+                    row_begin += copy_size;
+                    read_size -= copy_size;
+                    new_block_row_count += copy_size;
+                }
+                read_offset = row_end;
+            }
+        }
+    }
+    if (new_block_row_count == 0) {
+        return new_segment;
+    }
+
+    // 2. fill the new blocks in parallel, each worker reads the old blocks its new block is made of
+    Vector<UniquePtr<BlockEntry>> new_blocks(new_block_ranges.size());
+    auto fill_block = [&](SizeT new_block_idx) {
+        ThrottleUnderMemoryPressure(buffer_mgr);
+        auto new_block = BlockEntry::NewBlockEntry(new_segment.get(), new_block_idx, 0, column_count, txn_);
+        BlockEntry *input_block = nullptr;
+        Vector<ColumnVector> input_column_vectors;
+        for (const CopyRange &range : new_block_ranges[new_block_idx]) {
+            if (range.old_block_ != input_block) {
+                input_block = range.old_block_;
+                input_column_vectors.clear();
+                for (ColumnID column_id = 0; column_id < column_count; ++column_id) {
+                    auto *column_block_entry = input_block->GetColumnBlockEntry(column_id);
+                    input_column_vectors.emplace_back(column_block_entry->GetColumnVector(buffer_mgr));
+                }
+            }
+            new_block->AppendBlock(input_column_vectors, range.row_begin_, range.read_size_, buffer_mgr);
+        }
+        new_blocks[new_block_idx] = std::move(new_block);
+    };
+    if (new_blocks.size() == 1) {
+        fill_block(0);
+    } else {
+        Vector<Future<void>> futures;
+        futures.reserve(new_blocks.size());
+        for (SizeT new_block_idx = 0; new_block_idx < new_blocks.size(); ++new_block_idx) {
+            futures.push_back(pool.push([&fill_block, new_block_idx](int) { fill_block(new_block_idx); }));
+        }
+        for (auto &future : futures) {
+            future.get();
+        }
+    }
+
+    // 3. the blocks are appended in the order of their ids
+    for (auto &new_block : new_blocks) {
+        new_segment->AppendBlockEntry(std::move(new_block));
+    }
+    return new_segment;
+}
+
+SharedPtr<SegmentEntry>
+CompactSegmentsTask::CompactSegmentsToOneInOrder(CompactSegmentsTaskState &state, const Vector<SegmentEntry *> &segments, const RowOrderFunc &order_rows) {
+    auto *table_entry = state.table_entry_;
+    auto &remapper = state.remapper_;
+    auto new_segment = SegmentEntry::NewSegmentEntry(table_entry, Catalog::GetNextSegmentID(table_entry), txn_);
 
-                if (read_size + new_block->row_count() > new_block->row_capacity()) {
-                    SizeT read_size1 = new_block->row_capacity() - new_block->row_count();
-                    block_entry_append(row_begin, read_size1);
-                    row_begin += read_size1;
-                    read_size -= read_size1;
-                    new_segment->AppendBlockEntry(std::move(new_block));
+    TxnTimeStamp begin_ts = txn_->BeginTS();
+    SizeT column_count = table_entry->ColumnCount();
+    BufferManager *buffer_mgr = txn_->buffer_mgr();
 
-                    new_block = BlockEntry::NewBlockEntry(new_segment.get(), new_segment->GetNextBlockID(), 0, column_count, txn_);
+    // 1. collect the visible rows, the column vectors of all old blocks are held until the rows are appended
+    Vector<GlobalBlockID> old_block_ids;
+    Vector<Vector<ColumnVector>> old_block_columns;
+    Vector<OldRow> old_rows;
+    for (auto *old_segment : segments) {
+        BlockEntryIter block_entry_iter(old_segment);
+        for (auto *old_block = block_entry_iter.Next(); old_block != nullptr; old_block = block_entry_iter.Next()) {
+            ThrottleUnderMemoryPressure(buffer_mgr);
+            u32 block_idx = old_block_ids.size();
+            old_block_ids.emplace_back(old_segment->segment_id(), old_block->block_id());
+            Vector<ColumnVector> &column_vectors = old_block_columns.emplace_back();
+            for (ColumnID column_id = 0; column_id < column_count; ++column_id) {
+                auto *column_block_entry = old_block->GetColumnBlockEntry(column_id);
+                column_vectors.emplace_back(column_block_entry->GetColumnVector(buffer_mgr));
+            }
+            SizeT read_offset = 0;
+            while (true) {
+                auto [row_begin, row_end] = old_block->GetVisibleRange(begin_ts, read_offset);
+                if (row_begin == row_end) {
+                    break;
                 }
-                block_entry_append(row_begin, read_size);
+                for (SizeT row = row_begin; row < row_end; ++row) {
+                    old_rows.push_back(OldRow{block_idx, static_cast<BlockOffset>(row)});
+                }
+                read_offset = row_end;
+            }
+        }
+    }
+
+    // 2. append the rows in the new order, the rows following each other in an old block are copied in one batch
+    Vector<u32> order = order_rows(old_block_columns, old_rows);
+    Vector<RowID> new_row_ids(old_rows.size());
+    auto new_block = BlockEntry::NewBlockEntry(new_segment.get(), 0, 0, column_count, txn_);
+    for (SizeT i = 0; i < order.size();) {
+        if (new_block->row_count() == new_block->row_capacity()) {
+            new_segment->AppendBlockEntry(std::move(new_block));
+            new_block = BlockEntry::NewBlockEntry(new_segment.get(), new_segment->GetNextBlockID(), 0, column_count, txn_);
+        }
+        const OldRow &first_row = old_rows[order[i]];
+        SizeT room = new_block->row_capacity() - new_block->row_count();
+        SizeT batch_size = 1;
+        while (batch_size < room && i + batch_size < order.size()) {
+            const OldRow &next_row = old_rows[order[i + batch_size]];
+            if (next_row.block_idx_ != first_row.block_idx_ || next_row.block_offset_ != first_row.block_offset_ + batch_size) {
+                break;
             }
+            ++batch_size;
+        }
+        SegmentOffset new_offset = new_block->block_id() * DEFAULT_BLOCK_CAPACITY + new_block->row_count();
+        for (SizeT j = 0; j < batch_size; ++j) {
+            new_row_ids[order[i + j]] = RowID(new_segment->segment_id(), new_offset + j);
         }
+        new_block->AppendBlock(old_block_columns[first_row.block_idx_], first_row.block_offset_, batch_size, buffer_mgr);
+        i += batch_size;
     }
     if (new_block->row_count() > 0) {
         new_segment->AppendBlockEntry(std::move(new_block));
     }
 
+    // 3. map every row on its own, in the order of the old rows so that the offsets of each old block are ascending
+    for (SizeT row = 0; row < old_rows.size(); ++row) {
+        const OldRow &old_row = old_rows[row];
+        const GlobalBlockID &old_block_id = old_block_ids[old_row.block_idx_];
+        remapper.AddMap(old_block_id.segment_id_, old_block_id.block_id_, old_row.block_offset_, new_row_ids[row]);
+    }
     return new_segment;
 }
 
-} // namespace infinity
\ No newline at end of file
+} // namespace infinity
@@ -24,6 +24,8 @@ import txn;
 import global_block_id;
 import base_table_ref;
 import internal_types;
+import index_base;
+import column_vector;
 
 namespace infinity {
 
@@ -81,6 +83,7 @@ export struct CompactSegmentsTaskState {
 export enum class CompactSegmentsTaskType : i8 {
     kCompactTable,
     kCompactPickedSegments,
+    kExpireTable, // drops the rows older than the ttl of the table
     kInvalid,
 };
 
@@ -90,6 +93,8 @@ public:
 
     static SharedPtr<CompactSegmentsTask> MakeTaskWithWholeTable(TableEntry *table_entry, Txn *txn);
 
+    static SharedPtr<CompactSegmentsTask> MakeTaskWithExpiry(TableEntry *table_entry, Txn *txn);
+
     explicit CompactSegmentsTask(TableEntry *table_entry, Vector<SegmentEntry *> &&segments, Txn *txn, CompactSegmentsTaskType type);
 
 public:
@@ -112,6 +117,9 @@ public:
 public:
     void CompactSegments(CompactSegmentsTaskState &state);
 
+    // Drops the sealed segments whose rows are all expired and deletes the expired rows of the other segments
+    void ExpireRows(CompactSegmentsTaskState &state);
+
     void CreateNewIndex(CompactSegmentsTaskState &state);
 
     // Save new segment, set no_delete_ts, add compact wal cmd
@@ -121,7 +129,26 @@ public:
     void ApplyDeletes(CompactSegmentsTaskState &state);
 
 private:
-    SharedPtr<SegmentEntry> CompactSegmentsToOne(CompactSegmentsTaskState &state, const Vector<SegmentEntry *> &segments);
+    // The visible rows are assigned to the new blocks first, then the new blocks are filled by the workers of pool.
+    SharedPtr<SegmentEntry> CompactSegmentsToOne(CompactSegmentsTaskState &state, const Vector<SegmentEntry *> &segments, ThreadPool &pool);
+
+    // the first full-text index of the table asking for reordered rows, nullptr if none
+    SharedPtr<IndexBase> GetReorderIndex(TableEntry *table_entry);
+
+    // A visible row of the old segments: the index of its old block and its offset in the block
+    struct OldRow {
+        u32 block_idx_;
+        BlockOffset block_offset_;
+    };
+
+    // The order of the old rows in the new segment, given the column vectors of each old block and the old rows
+    using RowOrderFunc = std::function<Vector<u32>(const Vector<Vector<ColumnVector>> &, const Vector<OldRow> &)>;
+
+    // Appends the rows in the order of order_rows instead of the order of the old segments. The table sort key orders the
+    // rows by the sort key column, a full-text index asking for reordered rows orders them by graph bisection over the
+    // terms of the indexed column so that the index built on the new segment has smaller doc id gaps.
+    SharedPtr<SegmentEntry>
+    CompactSegmentsToOneInOrder(CompactSegmentsTaskState &state, const Vector<SegmentEntry *> &segments, const RowOrderFunc &order_rows);
 
 private:
     const CompactSegmentsTaskType task_type_;
@@ -0,0 +1,162 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+module;
+
+module merge_fulltext_chunks_task;
+
+import stl;
+import bg_task;
+import txn;
+import txn_manager;
+import txn_store;
+import third_party;
+import logger;
+import default_values;
+import internal_types;
+import index_base;
+import index_full_text;
+import memory_pool;
+import column_index_merger;
+import table_entry;
+import table_index_entry;
+import segment_index_entry;
+import segment_entry;
+import chunk_index_entry;
+
+namespace infinity {
+
+namespace {
+
+u32 FulltextChunkTier(u32 row_count) {
+    u32 tier = 0;
+    for (u64 tier_bound = u64(FULL_TEXT_CHUNK_MERGE_S) * FULL_TEXT_CHUNK_MERGE_C; row_count >= tier_bound; tier_bound *= FULL_TEXT_CHUNK_MERGE_C) {
+        ++tier;
+    }
+    return tier;
+}
+
+} // namespace
+
+Pair<SizeT, SizeT> PickFulltextChunksToMerge(const Vector<u32> &chunk_row_counts) {
+    const SizeT chunk_num = chunk_row_counts.size();
+    Vector<u32> tiers(chunk_num);
+    u32 max_tier = 0;
+    for (SizeT i = 0; i < chunk_num; ++i) {
+        tiers[i] = FulltextChunkTier(chunk_row_counts[i]);
+        max_tier = std::max(max_tier, tiers[i]);
+    }
+    for (u32 tier = 0; tier <= max_tier; ++tier) {
+        SizeT run_begin = 0;
+        SizeT tier_chunk_num = 0;
+        for (SizeT i = 0; i <= chunk_num; ++i) {
+            if (i == chunk_num || tiers[i] > tier) {
+                if (tier_chunk_num >= FULL_TEXT_CHUNK_MERGE_C) {
+                    return {run_begin, i};
+                }
+                run_begin = i + 1;
+                tier_chunk_num = 0;
+            } else if (tiers[i] == tier) {
+                ++tier_chunk_num;
+            }
+        }
+    }
+    return {0, 0};
+}
+
+SharedPtr<MergeFulltextChunksTask> MergeFulltextChunksTask::MakeTask(TableEntry *table_entry,
+                                                                     TableIndexEntry *table_index_entry,
+                                                                     SegmentIndexEntry *segment_index_entry,
+                                                                     std::function<Txn *()> generate_txn) {
+    if (table_index_entry->index_base()->index_type_ != IndexType::kFullText) {
+        return nullptr;
+    }
+    SharedPtr<SegmentEntry> segment_entry = table_entry->GetSegmentByID(segment_index_entry->segment_id(), MAX_TIMESTAMP);
+    if (segment_entry.get() == nullptr) {
+        return nullptr;
+    }
+    // a compaction rebuilds the indexes of the segments it picks anyway
+    SegmentStatus status = segment_entry->status();
+    if (status == SegmentStatus::kCompacting || status == SegmentStatus::kNoDelete || status == SegmentStatus::kDeprecated) {
+        return nullptr;
+    }
+    if (!segment_index_entry->TryBeginFulltextMerge()) {
+        return nullptr;
+    }
+    Vector<SharedPtr<ChunkIndexEntry>> chunk_index_entries;
+    segment_index_entry->GetChunkIndexEntries(chunk_index_entries);
+    Vector<u32> chunk_row_counts;
+    for (const auto &chunk_index_entry : chunk_index_entries) {
+        chunk_row_counts.push_back(chunk_index_entry->row_count_);
+    }
+    auto [merge_begin, merge_end] = PickFulltextChunksToMerge(chunk_row_counts);
+    if (merge_begin == merge_end) {
+        segment_index_entry->EndFulltextMerge();
+        return nullptr;
+    }
+    Vector<SharedPtr<ChunkIndexEntry>> merging_chunk_index_entries(chunk_index_entries.begin() + merge_begin,
+                                                                   chunk_index_entries.begin() + merge_end);
+    Txn *txn = generate_txn();
+    LOG_INFO(fmt::format("Add merge fulltext chunks task, index dir: {}, segment: {}, chunks: [{}, {}) of {}, begin ts: {}",
+                         *table_index_entry->index_dir(),
+                         segment_index_entry->segment_id(),
+                         merge_begin,
+                         merge_end,
+                         chunk_index_entries.size(),
+                         txn->BeginTS()));
+    return MakeShared<MergeFulltextChunksTask>(table_entry, table_index_entry, segment_index_entry, std::move(merging_chunk_index_entries), txn);
+}
+
+MergeFulltextChunksTask::MergeFulltextChunksTask(TableEntry *table_entry,
+                                                 TableIndexEntry *table_index_entry,
+                                                 SegmentIndexEntry *segment_index_entry,
+                                                 Vector<SharedPtr<ChunkIndexEntry>> &&chunk_index_entries,
+                                                 Txn *txn)
+    : BGTask(BGTaskType::kMergeFulltextChunks, false), table_entry_(table_entry), table_index_entry_(table_index_entry),
+      segment_index_entry_(segment_index_entry), chunk_index_entries_(std::move(chunk_index_entries)), txn_(txn) {}
+
+void MergeFulltextChunksTask::Execute() {
+    Vector<String> base_names;
+    Vector<RowID> base_rowids;
+    RowID base_rowid = chunk_index_entries_[0]->base_rowid_;
+    u32 total_row_count = 0;
+    for (const auto &chunk_index_entry : chunk_index_entries_) {
+        base_names.push_back(chunk_index_entry->base_name_);
+        base_rowids.push_back(chunk_index_entry->base_rowid_);
+        total_row_count += chunk_index_entry->row_count_;
+    }
+    String dst_base_name = fmt::format("ft_{}_{}", base_rowid.ToUint64(), total_row_count);
+    const auto *index_fulltext = static_cast<const IndexFullText *>(table_index_entry_->index_base());
+    // the pools of the table index are not thread safe, and an OPTIMIZE may merge other segments at the same time
+    MemoryPool memory_pool;
+    RecyclePool buffer_pool;
+    ColumnIndexMerger column_index_merger(*table_index_entry_->index_dir(), index_fulltext->flag_, &memory_pool, &buffer_pool);
+    column_index_merger.SetRateLimit(txn_->txn_mgr()->fulltext_merge_rate_limit());
+    column_index_merger.Merge(base_names, base_rowids, dst_base_name, &table_index_entry_->GetFulltextThreadPool());
+
+    TxnTableStore *txn_table_store = txn_->GetTxnTableStore(table_entry_);
+    for (const auto &chunk_index_entry : chunk_index_entries_) {
+        txn_table_store->AddChunkIndexStore(table_index_entry_, chunk_index_entry.get());
+    }
+    SharedPtr<ChunkIndexEntry> merged_chunk_index_entry =
+        MakeShared<ChunkIndexEntry>(segment_index_entry_, dst_base_name, base_rowid, total_row_count);
+    txn_table_store->AddChunkIndexStore(table_index_entry_, merged_chunk_index_entry.get());
+    segment_index_entry_->ReplaceChunkIndexEntries(merged_chunk_index_entry);
+    // a later transaction may have dumped a chunk of the index already
+    table_index_entry_->UpdateFulltextSegmentTs(std::max(txn_->BeginTS(), table_index_entry_->GetFulltexSegmentUpdateTs()));
+    segment_index_entry_->EndFulltextMerge();
+}
+
+} // namespace infinity
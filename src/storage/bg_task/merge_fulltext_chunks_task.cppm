@@ -0,0 +1,69 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+module;
+
+export module merge_fulltext_chunks_task;
+
+import stl;
+import bg_task;
+import txn;
+import internal_types;
+
+namespace infinity {
+
+struct TableEntry;
+struct TableIndexEntry;
+class SegmentIndexEntry;
+class ChunkIndexEntry;
+
+// The range [first, second) of the chunks, in row order, that the tiered policy merges next, first == second if none.
+// A chunk of less than S * C^(t+1) rows is in tier t. Going up from tier 0, the first run of chunks next to each other and of at
+// most tier t that holds C chunks of tier t is merged, the smaller chunks stranded in the run are taken along.
+// So a segment keeps less than C chunks of a tier between two larger chunks, and every row is rewritten about once per tier.
+export Pair<SizeT, SizeT> PickFulltextChunksToMerge(const Vector<u32> &chunk_row_counts);
+
+// Merge the chunks of a full-text index of a segment in the background, so that a query does not pay for a posting of every
+// chunk dumped since the last OPTIMIZE.
+export class MergeFulltextChunksTask final : public BGTask {
+public:
+    // Returns nullptr if the chunks of the segment index need no merge, the transaction is only begun otherwise.
+    static SharedPtr<MergeFulltextChunksTask>
+    MakeTask(TableEntry *table_entry, TableIndexEntry *table_index_entry, SegmentIndexEntry *segment_index_entry, std::function<Txn *()> generate_txn);
+
+    MergeFulltextChunksTask(TableEntry *table_entry,
+                            TableIndexEntry *table_index_entry,
+                            SegmentIndexEntry *segment_index_entry,
+                            Vector<SharedPtr<ChunkIndexEntry>> &&chunk_index_entries,
+                            Txn *txn);
+
+    ~MergeFulltextChunksTask() override = default;
+
+    String ToString() const override { return "Merge fulltext chunks task"; }
+
+    void CommitTxn() { txn_->txn_mgr()->CommitTxn(txn_); }
+
+    void Execute();
+
+private:
+    TableEntry *const table_entry_;
+    TableIndexEntry *const table_index_entry_;
+    SegmentIndexEntry *const segment_index_entry_;
+    Vector<SharedPtr<ChunkIndexEntry>> chunk_index_entries_;
+
+    Txn *const txn_;
+};
+
+} // namespace infinity
@@ -23,6 +23,11 @@ import background_process;
 import bg_task;
 import catalog;
 import txn_manager;
+import txn;
+import db_entry;
+import table_entry;
+import compact_segments_task;
+import default_values;
 import third_party;
 
 namespace infinity {
@@ -43,6 +48,20 @@ void CleanupPeriodicTrigger::Trigger() {
     bg_processor_->Submit(std::move(cleanup_task));
 }
 
+void TTLPeriodicTrigger::Trigger() {
+    Txn *list_txn = txn_mgr_->BeginTxn();
+    for (DBEntry *db_entry : catalog_->Databases(list_txn->TxnID(), list_txn->BeginTS())) {
+        for (TableEntry *table_entry : db_entry->TableCollections(list_txn->TxnID(), list_txn->BeginTS())) {
+            if (table_entry->ttl_column_id() == INVALID_COLUMN_ID) {
+                continue;
+            }
+            auto expire_task = CompactSegmentsTask::MakeTaskWithExpiry(table_entry, txn_mgr_->BeginTxn());
+            bg_processor_->Submit(std::move(expire_task));
+        }
+    }
+    txn_mgr_->CommitTxn(list_txn);
+}
+
 void CheckpointPeriodicTrigger::Trigger() {
     auto checkpoint_task = MakeShared<CheckpointTask>(is_full_checkpoint_);
     LOG_INFO(fmt::format("Trigger {} periodic checkpoint.", is_full_checkpoint_ ? "FULL" : "DELTA"));
@@ -63,6 +63,20 @@ private:
     TxnTimeStamp last_visible_ts_{0};
 };
 
+// Submits a task dropping the expired rows of each table with a ttl
+export class TTLPeriodicTrigger final : public PeriodicTrigger {
+public:
+    TTLPeriodicTrigger(std::chrono::milliseconds interval, BGTaskProcessor *bg_processor, Catalog *catalog, TxnManager *txn_mgr)
+        : PeriodicTrigger(interval), bg_processor_(bg_processor), catalog_(catalog), txn_mgr_(txn_mgr) {}
+
+    virtual void Trigger() override;
+
+private:
+    BGTaskProcessor *const bg_processor_{};
+    Catalog *const catalog_{};
+    TxnManager *const txn_mgr_{};
+};
+
 export class CheckpointPeriodicTrigger final : public PeriodicTrigger {
 public:
     explicit CheckpointPeriodicTrigger(std::chrono::milliseconds interval, WalManager *wal_mgr, bool full_checkpoint)
@@ -0,0 +1,107 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+module rebuild_hnsw_task;
+
+import stl;
+import bg_task;
+import txn;
+import txn_manager;
+import txn_store;
+import third_party;
+import logger;
+import default_values;
+import internal_types;
+import index_base;
+import table_entry;
+import table_index_meta;
+import table_index_entry;
+import segment_index_entry;
+import segment_entry;
+import chunk_index_entry;
+
+namespace infinity {
+
+SharedPtr<RebuildHnswTask> RebuildHnswTask::MakeTask(TableEntry *table_entry, SegmentID segment_id, std::function<Txn *()> generate_txn) {
+    SharedPtr<SegmentEntry> segment_entry = table_entry->GetSegmentByID(segment_id, MAX_TIMESTAMP);
+    if (segment_entry.get() == nullptr || segment_entry->row_count() < HNSW_TOMBSTONE_REBUILD_MIN_ROWS) {
+        return nullptr;
+    }
+    // a compaction rebuilds the indexes of the segments it picks anyway
+    SegmentStatus status = segment_entry->status();
+    if (status == SegmentStatus::kCompacting || status == SegmentStatus::kNoDelete || status == SegmentStatus::kDeprecated) {
+        return nullptr;
+    }
+    Vector<Pair<TableIndexEntry *, SegmentIndexEntry *>> index_entries;
+    {
+        auto index_meta_map_guard = table_entry->IndexMetaMap();
+        for (auto &[_, table_index_meta] : *index_meta_map_guard) {
+            auto [table_index_entry, index_status] = table_index_meta->GetEntryNolock(0UL, MAX_TIMESTAMP);
+            if (!index_status.ok() || table_index_entry->index_base()->index_type_ != IndexType::kHnsw) {
+                continue;
+            }
+            auto iter = table_index_entry->index_by_segment().find(segment_id);
+            if (iter == table_index_entry->index_by_segment().end()) {
+                continue;
+            }
+            SegmentIndexEntry *segment_index_entry = iter->second.get();
+            if (segment_index_entry->GetHnswTombstoneRatio(segment_entry.get()) < HNSW_TOMBSTONE_REBUILD_RATIO) {
+                continue;
+            }
+            if (segment_index_entry->TryBeginHnswRebuild()) {
+                index_entries.emplace_back(table_index_entry, segment_index_entry);
+            }
+        }
+    }
+    if (index_entries.empty()) {
+        return nullptr;
+    }
+    Txn *txn = generate_txn();
+    LOG_INFO(fmt::format("Add rebuild hnsw task, table dir: {}, segment: {}, begin ts: {}",
+                         *table_entry->TableEntryDir(),
+                         segment_id,
+                         txn->BeginTS()));
+    return MakeShared<RebuildHnswTask>(table_entry, segment_id, std::move(index_entries), txn);
+}
+
+RebuildHnswTask::RebuildHnswTask(TableEntry *table_entry,
+                                 SegmentID segment_id,
+                                 Vector<Pair<TableIndexEntry *, SegmentIndexEntry *>> &&index_entries,
+                                 Txn *txn)
+    : BGTask(BGTaskType::kRebuildHnswIndex, false), table_entry_(table_entry), segment_id_(segment_id), index_entries_(std::move(index_entries)),
+      txn_(txn) {}
+
+void RebuildHnswTask::Execute() {
+    TxnTimeStamp begin_ts = txn_->BeginTS();
+    SharedPtr<SegmentEntry> segment_entry = table_entry_->GetSegmentByID(segment_id_, begin_ts);
+    TxnTableStore *txn_table_store = txn_->GetTxnTableStore(table_entry_);
+    for (auto &[table_index_entry, segment_index_entry] : index_entries_) {
+        if (segment_entry.get() != nullptr) {
+            Vector<SharedPtr<ChunkIndexEntry>> chunk_index_entries;
+            segment_index_entry->GetChunkIndexEntries(chunk_index_entries);
+            SharedPtr<ChunkIndexEntry> chunk_index_entry = segment_index_entry->RebuildHnsw(segment_entry.get(), txn_->buffer_mgr(), begin_ts);
+            if (chunk_index_entry.get() != nullptr) {
+                for (auto &old_chunk_index_entry : chunk_index_entries) {
+                    txn_table_store->AddChunkIndexStore(table_index_entry, old_chunk_index_entry.get());
+                }
+                txn_table_store->AddChunkIndexStore(table_index_entry, chunk_index_entry.get());
+            }
+        }
+        segment_index_entry->EndHnswRebuild();
+    }
+}
+
+} // namespace infinity
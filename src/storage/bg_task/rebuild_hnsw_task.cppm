@@ -0,0 +1,55 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module rebuild_hnsw_task;
+
+import stl;
+import bg_task;
+import txn;
+import internal_types;
+
+namespace infinity {
+
+struct TableEntry;
+struct TableIndexEntry;
+class SegmentIndexEntry;
+
+// Rebuild the hnsw indexes of a segment once too many of the indexed rows are deleted. A graph full of deleted vertices
+// still has to be walked by every search, and a filtered search has to look further to find k visible rows.
+export class RebuildHnswTask final : public BGTask {
+public:
+    // Returns nullptr if no hnsw index of the segment needs a rebuild, the transaction is only begun otherwise.
+    static SharedPtr<RebuildHnswTask> MakeTask(TableEntry *table_entry, SegmentID segment_id, std::function<Txn *()> generate_txn);
+
+    RebuildHnswTask(TableEntry *table_entry, SegmentID segment_id, Vector<Pair<TableIndexEntry *, SegmentIndexEntry *>> &&index_entries, Txn *txn);
+
+    ~RebuildHnswTask() override = default;
+
+    String ToString() const override { return "Rebuild hnsw task"; }
+
+    void CommitTxn() { txn_->txn_mgr()->CommitTxn(txn_); }
+
+    void Execute();
+
+private:
+    TableEntry *const table_entry_;
+    const SegmentID segment_id_;
+    Vector<Pair<TableIndexEntry *, SegmentIndexEntry *>> index_entries_;
+
+    Txn *const txn_;
+};
+
+} // namespace infinity
@@ -15,7 +15,9 @@
 module;
 
 #include <algorithm>
+#include <bit>
 #include <string_view>
+#include <type_traits>
 module build_fast_rough_filter_task;
 
 import stl;
@@ -35,6 +37,7 @@ import probabilistic_data_filter;
 import min_max_data_filter;
 import fast_rough_filter;
 import filter_value_type_classification;
+import column_statistics;
 
 template <>
 class std::numeric_limits<infinity::InnerMinMaxDataFilterVarcharType> {
@@ -129,12 +132,75 @@ void UpdateMax(InnerMinMaxDataFilterVarcharType &max, const String &input_str) {
     }
 }
 
+template <typename ValueType>
+class BuildFastRoughFilterTask::ZoneMinMaxBuilder {
+    using MinMaxInnerValueType = InnerMinMaxDataFilterInfo<ValueType>::InnerValueType;
+
+public:
+    // filter: nullptr if the filter of the block isn't built
+    ZoneMinMaxBuilder(FastRoughFilter *filter, ColumnID column_id)
+        : filter_(filter), column_id_(column_id), zone_row_count_(filter ? filter->zone_row_count_ : 0),
+          zone_count_(filter ? filter->zone_min_max_data_filters_.size() : 0) {}
+
+    template <typename InputType>
+    void Update(u32 block_offset, const InputType &value) {
+        if (zone_count_ == 0) {
+            return;
+        }
+        while (zone_id_ < block_offset / zone_row_count_) {
+            FinishZone();
+        }
+        UpdateMin(zone_min_value_, value);
+        UpdateMax(zone_max_value_, value);
+    }
+
+    // the zones without visible rows keep an empty range
+    void Finish() {
+        while (zone_id_ < zone_count_) {
+            FinishZone();
+        }
+    }
+
+private:
+    void FinishZone() {
+        filter_->BuildZoneMinMaxDataFilter<ValueType>(zone_id_++, column_id_, std::move(zone_min_value_), std::move(zone_max_value_));
+        zone_min_value_ = std::numeric_limits<MinMaxInnerValueType>::max();
+        zone_max_value_ = std::numeric_limits<MinMaxInnerValueType>::lowest();
+    }
+
+    FastRoughFilter *filter_{};
+    ColumnID column_id_{};
+    u32 zone_row_count_{};
+    u32 zone_count_{};
+    u32 zone_id_{};
+    MinMaxInnerValueType zone_min_value_ = std::numeric_limits<MinMaxInnerValueType>::max();
+    MinMaxInnerValueType zone_max_value_ = std::numeric_limits<MinMaxInnerValueType>::lowest();
+};
+
 inline void Advance(TotalRowCount &total_row_count_handler) {
     if (++total_row_count_handler.total_row_count_read_ > total_row_count_handler.total_row_count_in_segment_) {
         UnrecoverableError("BUG: BuildFastRoughFilterArg: total_row_count overflow");
     }
 }
 
+template <typename ValueType>
+constexpr bool HaveHistogram = std::is_arithmetic_v<ValueType> && !std::is_same_v<ValueType, BooleanT>;
+
+template <typename ValueType>
+void CollectStatistics(ColumnStatisticsCollector &collector, const ColumnVector &column_vector, BlockOffset offset, const ValueType &value) {
+    if (!column_vector.nulls_ptr_->IsTrue(offset)) {
+        collector.AddNull();
+    } else if constexpr (std::is_floating_point_v<ValueType>) {
+        // -0.0 and 0.0 are one value
+        using KeyType = std::conditional_t<sizeof(ValueType) == sizeof(u32), u32, u64>;
+        collector.AddValue(value == 0 ? 0 : std::bit_cast<KeyType>(value), static_cast<double>(value));
+    } else if constexpr (HaveHistogram<ValueType>) {
+        collector.AddValue(ConvertValueToU64(value), static_cast<double>(value));
+    } else {
+        collector.AddValue(ConvertValueToU64(value));
+    }
+}
+
 template <CanBuildBloomFilter ValueType, bool CheckTS>
 void BuildFastRoughFilterTask::BuildOnlyBloomFilter(BuildFastRoughFilterArg &arg) {
     LOG_TRACE(fmt::format("BuildFastRoughFilterTask: BuildOnlyBloomFilter job begin for column: {}", arg.column_id_));
@@ -142,9 +208,9 @@ void BuildFastRoughFilterTask::BuildOnlyBloomFilter(BuildFastRoughFilterArg &arg
         arg.distinct_keys_ = MakeUniqueForOverwrite<u64[]>(arg.total_row_count_in_segment_);
         arg.distinct_keys_backup_ = MakeUniqueForOverwrite<u64[]>(arg.total_row_count_in_segment_);
     }
-    auto iter = BlockEntryIter(arg.segment_entry_);
+    ColumnStatisticsCollector statistics_collector(HaveHistogram<ValueType>);
     Vector<u64> input_data; // for reuse
-    for (auto *block_entry = iter.Next(); block_entry != nullptr; block_entry = iter.Next()) {
+    for (auto [block_entry, build_block_filter] : arg.block_entries_) {
         // check row count
         u32 block_row_cnt = block_entry->row_count();
         if (block_row_cnt == 0) {
@@ -156,6 +222,7 @@ void BuildFastRoughFilterTask::BuildOnlyBloomFilter(BuildFastRoughFilterArg &arg
         // prepare column_iter
         BlockColumnEntry *block_column_entry = block_entry->GetColumnBlockEntry(arg.column_id_);
         BlockColumnIter<CheckTS> column_iter(block_column_entry, arg.buffer_manager_, arg.begin_ts_);
+        const ColumnVector &column_vector = *column_iter.column_vector();
         // step 1. swap arg.distinct_keys_ and arg.distinct_keys_backup_
         std::swap(arg.distinct_keys_, arg.distinct_keys_backup_);
         // step 2. collect data in row
@@ -166,16 +233,15 @@ void BuildFastRoughFilterTask::BuildOnlyBloomFilter(BuildFastRoughFilterArg &arg
             auto *u8_ptr = reinterpret_cast<const u8 *>(column_iter.data());
             for (auto next_pair = column_iter.Next(); next_pair; next_pair = column_iter.Next()) {
                 Advance(arg.total_row_count_handler_); // need to count actual row count
-                if (!have_0 or !have_1) {
-                    // need to access data
-                    auto &[_, offset] = next_pair.value();
-                    auto [byte_cnt, remain_cnt] = std::div(offset, 8);
-                    bool val = u8_ptr[byte_cnt] & (u8(1) << remain_cnt);
-                    if (val) {
-                        have_1 = true;
-                    } else {
-                        have_0 = true;
-                    }
+                // the statistics need every value
+                auto &[_, offset] = next_pair.value();
+                auto [byte_cnt, remain_cnt] = std::div(offset, 8);
+                bool val = u8_ptr[byte_cnt] & (u8(1) << remain_cnt);
+                CollectStatistics(statistics_collector, column_vector, offset, BooleanT(val));
+                if (val) {
+                    have_1 = true;
+                } else {
+                    have_0 = true;
                 }
             }
             if (have_0) {
@@ -193,9 +259,11 @@ void BuildFastRoughFilterTask::BuildOnlyBloomFilter(BuildFastRoughFilterArg &arg
                 if constexpr (std::is_same_v<ValueType, VarcharT>) {
                     Value val = column_iter.column_vector()->GetValue(offset);
                     const String &str = val.GetVarchar();
+                    CollectStatistics(statistics_collector, column_vector, offset, str);
                     input_data.push_back(ConvertValueToU64(str));
                 } else {
                     const auto &val = *static_cast<const ValueType *>(ptr);
+                    CollectStatistics(statistics_collector, column_vector, offset, val);
                     input_data.push_back(ConvertValueToU64(val));
                 }
             }
@@ -204,7 +272,12 @@ void BuildFastRoughFilterTask::BuildOnlyBloomFilter(BuildFastRoughFilterArg &arg
         std::sort(input_data.begin(), input_data.end());
         u32 input_distinct_count = std::unique(input_data.begin(), input_data.end()) - input_data.begin();
         // step 4. build probabilistic_data_filter for block
-        block_entry->GetFastRoughFilter()->BuildProbabilisticDataFilter(arg.begin_ts_, arg.column_id_, input_data.data(), input_distinct_count);
+        if (build_block_filter) {
+            block_entry->GetFastRoughFilter()->BuildProbabilisticDataFilter(arg.begin_ts_, arg.column_id_, input_data.data(), input_distinct_count);
+        }
+        if (!arg.build_segment_filter_) {
+            continue;
+        }
         // step 5. merge u64 distinct key array
         arg.distinct_count_ = std::set_union(arg.distinct_keys_backup_.get(),
                                              arg.distinct_keys_backup_.get() + arg.distinct_count_,
@@ -213,11 +286,14 @@ void BuildFastRoughFilterTask::BuildOnlyBloomFilter(BuildFastRoughFilterArg &arg
                                              arg.distinct_keys_.get()) -
                               arg.distinct_keys_.get();
     }
-    // finally, build probabilistic_data_filter for segment
-    arg.segment_entry_->GetFastRoughFilter()->BuildProbabilisticDataFilter(arg.begin_ts_,
-                                                                           arg.column_id_,
-                                                                           arg.distinct_keys_.get(),
-                                                                           arg.distinct_count_);
+    if (arg.build_segment_filter_) {
+        // finally, build probabilistic_data_filter for segment
+        arg.segment_entry_->GetFastRoughFilter()->BuildProbabilisticDataFilter(arg.begin_ts_,
+                                                                               arg.column_id_,
+                                                                               arg.distinct_keys_.get(),
+                                                                               arg.distinct_count_);
+        arg.segment_entry_->GetFastRoughFilter()->BuildColumnStatistics(arg.column_id_, statistics_collector.Finish());
+    }
     LOG_TRACE(fmt::format("BuildFastRoughFilterTask: BuildOnlyBloomFilter job end for column: {}", arg.column_id_));
 }
 
@@ -229,8 +305,8 @@ void BuildFastRoughFilterTask::BuildOnlyMinMaxFilter(BuildFastRoughFilterArg &ar
     // step 0. prepare min and max value
     MinMaxInnerValueType segment_min_value = std::numeric_limits<MinMaxInnerValueType>::max();
     MinMaxInnerValueType segment_max_value = std::numeric_limits<MinMaxInnerValueType>::lowest();
-    auto iter = BlockEntryIter(arg.segment_entry_);
-    for (auto *block_entry = iter.Next(); block_entry != nullptr; block_entry = iter.Next()) {
+    ColumnStatisticsCollector statistics_collector(HaveHistogram<ValueType>);
+    for (auto [block_entry, build_block_filter] : arg.block_entries_) {
         // check row count
         u32 block_row_cnt = block_entry->row_count();
         if (block_row_cnt == 0) {
@@ -240,8 +316,10 @@ void BuildFastRoughFilterTask::BuildOnlyMinMaxFilter(BuildFastRoughFilterArg &ar
         // step 1. update min and max value for block
         MinMaxInnerValueType block_min_value = std::numeric_limits<MinMaxInnerValueType>::max();
         MinMaxInnerValueType block_max_value = std::numeric_limits<MinMaxInnerValueType>::lowest();
+        ZoneMinMaxBuilder<ValueType> zone_builder(build_block_filter ? block_entry->GetFastRoughFilter() : nullptr, arg.column_id_);
         BlockColumnEntry *block_column_entry = block_entry->GetColumnBlockEntry(arg.column_id_);
         BlockColumnIter<CheckTS> column_iter(block_column_entry, arg.buffer_manager_, arg.begin_ts_);
+        const ColumnVector &column_vector = *column_iter.column_vector();
         for (auto next_pair = column_iter.Next(); next_pair; next_pair = column_iter.Next()) {
             Advance(arg.total_row_count_handler_);
             auto &[ptr, offset] = next_pair.value();
@@ -250,22 +328,32 @@ void BuildFastRoughFilterTask::BuildOnlyMinMaxFilter(BuildFastRoughFilterArg &ar
                 const String &str = val.GetVarchar();
                 UpdateMin(block_min_value, str);
                 UpdateMax(block_max_value, str);
+                zone_builder.Update(offset, str);
+                CollectStatistics(statistics_collector, column_vector, offset, str);
             } else {
                 const auto &val = *static_cast<const ValueType *>(ptr);
                 UpdateMin(block_min_value, val);
                 UpdateMax(block_max_value, val);
+                zone_builder.Update(offset, val);
+                CollectStatistics(statistics_collector, column_vector, offset, val);
             }
         }
+        zone_builder.Finish();
         // step 2. merge min, max for segment
         UpdateMin(segment_min_value, block_min_value);
         UpdateMax(segment_max_value, block_max_value);
         // step 3. build min_max_data_filter for block
-        block_entry->GetFastRoughFilter()->BuildMinMaxDataFilter<ValueType>(arg.column_id_, std::move(block_min_value), std::move(block_max_value));
+        if (build_block_filter) {
+            block_entry->GetFastRoughFilter()->BuildMinMaxDataFilter<ValueType>(arg.column_id_, std::move(block_min_value), std::move(block_max_value));
+        }
+    }
+    if (arg.build_segment_filter_) {
+        // finally, build min_max_data_filter for segment
+        arg.segment_entry_->GetFastRoughFilter()->BuildMinMaxDataFilter<ValueType>(arg.column_id_,
+                                                                                   std::move(segment_min_value),
+                                                                                   std::move(segment_max_value));
+        arg.segment_entry_->GetFastRoughFilter()->BuildColumnStatistics(arg.column_id_, statistics_collector.Finish());
     }
-    // finally, build min_max_data_filter for segment
-    arg.segment_entry_->GetFastRoughFilter()->BuildMinMaxDataFilter<ValueType>(arg.column_id_,
-                                                                               std::move(segment_min_value),
-                                                                               std::move(segment_max_value));
     LOG_TRACE(fmt::format("BuildFastRoughFilterTask: BuildOnlyMinMaxFilter job end for column: {}", arg.column_id_));
 }
 
@@ -281,9 +369,9 @@ void BuildFastRoughFilterTask::BuildMinMaxAndBloomFilter(BuildFastRoughFilterArg
     // step 0. prepare min and max value
     MinMaxInnerValueType segment_min_value = std::numeric_limits<MinMaxInnerValueType>::max();
     MinMaxInnerValueType segment_max_value = std::numeric_limits<MinMaxInnerValueType>::lowest();
-    auto iter = BlockEntryIter(arg.segment_entry_);
+    ColumnStatisticsCollector statistics_collector(HaveHistogram<ValueType>);
     Vector<u64> input_data; // for reuse
-    for (auto *block_entry = iter.Next(); block_entry != nullptr; block_entry = iter.Next()) {
+    for (auto [block_entry, build_block_filter] : arg.block_entries_) {
         // check row count
         u32 block_row_cnt = block_entry->row_count();
         if (block_row_cnt == 0) {
@@ -295,11 +383,13 @@ void BuildFastRoughFilterTask::BuildMinMaxAndBloomFilter(BuildFastRoughFilterArg
         // prepare column_iter
         BlockColumnEntry *block_column_entry = block_entry->GetColumnBlockEntry(arg.column_id_);
         BlockColumnIter<CheckTS> column_iter(block_column_entry, arg.buffer_manager_, arg.begin_ts_);
+        const ColumnVector &column_vector = *column_iter.column_vector();
         // step 1. swap arg.distinct_keys_ and arg.distinct_keys_backup_
         std::swap(arg.distinct_keys_, arg.distinct_keys_backup_);
         // step 2. collect data in row, get and update min and max value
         MinMaxInnerValueType block_min_value = std::numeric_limits<MinMaxInnerValueType>::max();
         MinMaxInnerValueType block_max_value = std::numeric_limits<MinMaxInnerValueType>::lowest();
+        ZoneMinMaxBuilder<ValueType> zone_builder(build_block_filter ? block_entry->GetFastRoughFilter() : nullptr, arg.column_id_);
         for (auto next_pair = column_iter.Next(); next_pair; next_pair = column_iter.Next()) {
             Advance(arg.total_row_count_handler_);
             auto &[ptr, offset] = next_pair.value();
@@ -308,22 +398,32 @@ void BuildFastRoughFilterTask::BuildMinMaxAndBloomFilter(BuildFastRoughFilterArg
                 const String &str = val.GetVarchar();
                 UpdateMin(block_min_value, str);
                 UpdateMax(block_max_value, str);
+                zone_builder.Update(offset, str);
+                CollectStatistics(statistics_collector, column_vector, offset, str);
                 input_data.push_back(ConvertValueToU64(str));
             } else {
                 const auto &val = *static_cast<const ValueType *>(ptr);
                 UpdateMin(block_min_value, val);
                 UpdateMax(block_max_value, val);
+                zone_builder.Update(offset, val);
+                CollectStatistics(statistics_collector, column_vector, offset, val);
                 input_data.push_back(ConvertValueToU64(val));
             }
         }
+        zone_builder.Finish();
         UpdateMin(segment_min_value, block_min_value);
         UpdateMax(segment_max_value, block_max_value);
         // step 3. sort data and remove duplicate
         std::sort(input_data.begin(), input_data.end());
         u32 input_distinct_count = std::unique(input_data.begin(), input_data.end()) - input_data.begin();
         // step 4. build probabilistic_data_filter and min_max_data_filter for block
-        block_entry->GetFastRoughFilter()->BuildProbabilisticDataFilter(arg.begin_ts_, arg.column_id_, input_data.data(), input_distinct_count);
-        block_entry->GetFastRoughFilter()->BuildMinMaxDataFilter<ValueType>(arg.column_id_, std::move(block_min_value), std::move(block_max_value));
+        if (build_block_filter) {
+            block_entry->GetFastRoughFilter()->BuildProbabilisticDataFilter(arg.begin_ts_, arg.column_id_, input_data.data(), input_distinct_count);
+            block_entry->GetFastRoughFilter()->BuildMinMaxDataFilter<ValueType>(arg.column_id_, std::move(block_min_value), std::move(block_max_value));
+        }
+        if (!arg.build_segment_filter_) {
+            continue;
+        }
         // step 5. merge u64 distinct key array
         arg.distinct_count_ = std::set_union(arg.distinct_keys_backup_.get(),
                                              arg.distinct_keys_backup_.get() + arg.distinct_count_,
@@ -332,42 +432,67 @@ void BuildFastRoughFilterTask::BuildMinMaxAndBloomFilter(BuildFastRoughFilterArg
                                              arg.distinct_keys_.get()) -
                               arg.distinct_keys_.get();
     }
-    // finally, build probabilistic_data_filter for segment
-    arg.segment_entry_->GetFastRoughFilter()->BuildProbabilisticDataFilter(arg.begin_ts_,
-                                                                           arg.column_id_,
-                                                                           arg.distinct_keys_.get(),
-                                                                           arg.distinct_count_);
-    // finally, build min_max_data_filter for segment
-    arg.segment_entry_->GetFastRoughFilter()->BuildMinMaxDataFilter<ValueType>(arg.column_id_,
-                                                                               std::move(segment_min_value),
-                                                                               std::move(segment_max_value));
+    if (arg.build_segment_filter_) {
+        // finally, build probabilistic_data_filter for segment
+        arg.segment_entry_->GetFastRoughFilter()->BuildProbabilisticDataFilter(arg.begin_ts_,
+                                                                               arg.column_id_,
+                                                                               arg.distinct_keys_.get(),
+                                                                               arg.distinct_count_);
+        // finally, build min_max_data_filter for segment
+        arg.segment_entry_->GetFastRoughFilter()->BuildMinMaxDataFilter<ValueType>(arg.column_id_,
+                                                                                   std::move(segment_min_value),
+                                                                                   std::move(segment_max_value));
+        arg.segment_entry_->GetFastRoughFilter()->BuildColumnStatistics(arg.column_id_, statistics_collector.Finish());
+    }
     LOG_TRACE(fmt::format("BuildFastRoughFilterTask: BuildMinMaxAndBloomFilter job end for column: {}", arg.column_id_));
 }
 
-void ApplyToAllFastRoughFilterInSegment(SegmentEntry *segment_entry, std::invocable<FastRoughFilter *> auto func) {
-    // first, apply to block_entry
-    BlockEntryIter block_entry_iter{segment_entry};
-    for (auto *block_entry = block_entry_iter.Next(); block_entry; block_entry = block_entry_iter.Next()) {
-        func(block_entry->GetFastRoughFilter());
+void ApplyToAllFastRoughFilterInSegment(SegmentEntry *segment_entry,
+                                        const Vector<Pair<BlockEntry *, bool>> &block_entries,
+                                        std::invocable<FastRoughFilter *> auto func) {
+    // first, apply to the blocks whose filter is built
+    for (auto [block_entry, build_block_filter] : block_entries) {
+        if (build_block_filter) {
+            func(block_entry->GetFastRoughFilter());
+        }
     }
     // then, apply to segment_entry
     func(segment_entry->GetFastRoughFilter());
 }
 
-void BuildFastRoughFilterTask::CheckAndSetSegmentHaveStartedBuildMinMaxFilterTask(SegmentEntry *segment, TxnTimeStamp begin_ts) {
-    ApplyToAllFastRoughFilterInSegment(segment, [begin_ts](FastRoughFilter *filter) { filter->SetHaveStartedMinMaxFilterBuildTask(begin_ts); });
+void BuildFastRoughFilterTask::CheckAndSetSegmentHaveStartedBuildMinMaxFilterTask(SegmentEntry *segment,
+                                                                                  const Vector<Pair<BlockEntry *, bool>> &block_entries,
+                                                                                  TxnTimeStamp begin_ts) {
+    ApplyToAllFastRoughFilterInSegment(segment, block_entries, [begin_ts](FastRoughFilter *filter) {
+        filter->SetHaveStartedMinMaxFilterBuildTask(begin_ts);
+    });
 }
 
-void BuildFastRoughFilterTask::SetSegmentBeginBuildMinMaxFilterTask(SegmentEntry *segment, u32 column_count) {
-    ApplyToAllFastRoughFilterInSegment(segment, [column_count](FastRoughFilter *filter) { filter->BeginBuildMinMaxFilterTask(column_count); });
+void BuildFastRoughFilterTask::SetSegmentBeginBuildMinMaxFilterTask(SegmentEntry *segment,
+                                                                    const Vector<Pair<BlockEntry *, bool>> &block_entries,
+                                                                    u32 column_count) {
+    ApplyToAllFastRoughFilterInSegment(segment, block_entries, [column_count](FastRoughFilter *filter) {
+        filter->BeginBuildMinMaxFilterTask(column_count);
+    });
+}
+
+void BuildFastRoughFilterTask::SetBlockBeginBuildZoneMap(BlockEntry *block_entry, u32 column_count, u32 zone_row_count) {
+    u32 block_row_cnt = block_entry->row_count();
+    if (block_row_cnt > zone_row_count) {
+        u32 zone_count = (block_row_cnt + zone_row_count - 1) / zone_row_count;
+        block_entry->GetFastRoughFilter()->BeginBuildZoneMap(zone_row_count, zone_count, column_count);
+    }
 }
 
-void BuildFastRoughFilterTask::SetSegmentFinishBuildMinMaxFilterTask(SegmentEntry *segment) {
-    ApplyToAllFastRoughFilterInSegment(segment, [](FastRoughFilter *filter) { filter->FinishBuildMinMaxFilterTask(); });
+void BuildFastRoughFilterTask::SetSegmentFinishBuildMinMaxFilterTask(SegmentEntry *segment, const Vector<Pair<BlockEntry *, bool>> &block_entries) {
+    ApplyToAllFastRoughFilterInSegment(segment, block_entries, [](FastRoughFilter *filter) { filter->FinishBuildMinMaxFilterTask(); });
 }
 
 // deprecate except this
-void BuildFastRoughFilterTask::ExecuteOnNewSealedSegment(SegmentEntry *segment_entry, BufferManager *buffer_manager, TxnTimeStamp begin_ts) {
+void BuildFastRoughFilterTask::ExecuteOnNewSealedSegment(SegmentEntry *segment_entry,
+                                                         BufferManager *buffer_manager,
+                                                         TxnTimeStamp begin_ts,
+                                                         u32 zone_row_count) {
     bool use_block_version = false;
     switch (auto status = segment_entry->status(); status) {
         case SegmentStatus::kUnsealed: {
@@ -394,29 +519,78 @@ void BuildFastRoughFilterTask::ExecuteOnNewSealedSegment(SegmentEntry *segment_e
         }
     }
     LOG_TRACE(fmt::format("BuildFastRoughFilterTask: build fast rough filter for segment {}, job begin.", segment_entry->segment_id()));
+    // the blocks filled up by append already have their filters, they are only read for the filter of the segment
+    Vector<Pair<BlockEntry *, bool>> block_entries;
+    BlockEntryIter block_entry_iter{segment_entry};
+    for (auto *block_entry = block_entry_iter.Next(); block_entry; block_entry = block_entry_iter.Next()) {
+        block_entries.emplace_back(block_entry, !block_entry->GetFastRoughFilter()->HaveStartedMinMaxFilterBuildTask());
+    }
     // step 1. when build minmax, set timestamp
-    CheckAndSetSegmentHaveStartedBuildMinMaxFilterTask(segment_entry, begin_ts);
+    CheckAndSetSegmentHaveStartedBuildMinMaxFilterTask(segment_entry, block_entries, begin_ts);
     // step2. when build minmax, init filters to size of column_count
     const u32 column_count = segment_entry->column_count();
-    SetSegmentBeginBuildMinMaxFilterTask(segment_entry, column_count);
+    SetSegmentBeginBuildMinMaxFilterTask(segment_entry, block_entries, column_count);
+    segment_entry->GetFastRoughFilter()->BeginBuildColumnStatistics(column_count);
+    if (zone_row_count > 0) {
+        for (auto [block_entry, build_block_filter] : block_entries) {
+            if (build_block_filter) {
+                SetBlockBeginBuildZoneMap(block_entry, column_count, zone_row_count);
+            }
+        }
+    }
     // step 3. build filter
     if (use_block_version) {
-        ExecuteInner<true>(segment_entry, buffer_manager, begin_ts);
+        ExecuteInner<true>(segment_entry, block_entries, true, buffer_manager, begin_ts);
     } else {
-        ExecuteInner<false>(segment_entry, buffer_manager, begin_ts);
+        ExecuteInner<false>(segment_entry, block_entries, true, buffer_manager, begin_ts);
     }
     // step 4. set finish build MinMax atomic flag
-    SetSegmentFinishBuildMinMaxFilterTask(segment_entry);
+    SetSegmentFinishBuildMinMaxFilterTask(segment_entry, block_entries);
     LOG_TRACE(fmt::format("BuildFastRoughFilterTask: build fast rough filter for segment {}, job end.", segment_entry->segment_id()));
 }
 
+void BuildFastRoughFilterTask::ExecuteOnFullBlock(SegmentEntry *segment_entry,
+                                                  BlockEntry *block_entry,
+                                                  BufferManager *buffer_manager,
+                                                  TxnTimeStamp begin_ts,
+                                                  u32 zone_row_count) {
+    FastRoughFilter *filter = block_entry->GetFastRoughFilter();
+    if (filter->HaveStartedMinMaxFilterBuildTask()) {
+        // built by the txn which filled the block up
+        return;
+    }
+    LOG_TRACE(fmt::format("BuildFastRoughFilterTask: build fast rough filter for full block {} of segment {}, job begin.",
+                          block_entry->block_id(),
+                          segment_entry->segment_id()));
+    const Vector<Pair<BlockEntry *, bool>> block_entries{{block_entry, true}};
+    filter->SetHaveStartedMinMaxFilterBuildTask(begin_ts);
+    const u32 column_count = segment_entry->column_count();
+    filter->BeginBuildMinMaxFilterTask(column_count);
+    if (zone_row_count > 0) {
+        SetBlockBeginBuildZoneMap(block_entry, column_count, zone_row_count);
+    }
+    // the block is full, all its rows are committed by begin_ts
+    ExecuteInner<false>(segment_entry, block_entries, false, buffer_manager, begin_ts);
+    filter->FinishBuildMinMaxFilterTask();
+    LOG_TRACE(fmt::format("BuildFastRoughFilterTask: build fast rough filter for full block {} of segment {}, job end.",
+                          block_entry->block_id(),
+                          segment_entry->segment_id()));
+}
+
 void BuildFastRoughFilterTask::ExecuteUpdateSegmentBloomFilter(SegmentEntry *segment_entry, BufferManager *buffer_manager, TxnTimeStamp begin_ts) {}
 
 // will check every column
 template <bool CheckTS>
-void BuildFastRoughFilterTask::ExecuteInner(SegmentEntry *segment_entry, BufferManager *buffer_manager, TxnTimeStamp begin_ts) {
+void BuildFastRoughFilterTask::ExecuteInner(SegmentEntry *segment_entry,
+                                            const Vector<Pair<BlockEntry *, bool>> &block_entries,
+                                            bool build_segment_filter,
+                                            BufferManager *buffer_manager,
+                                            TxnTimeStamp begin_ts) {
     const u32 column_count = segment_entry->column_count();
-    const u32 segment_row_count = segment_entry->row_count();
+    u32 segment_row_count = 0;
+    for (auto [block_entry, _] : block_entries) {
+        segment_row_count += block_entry->row_count();
+    }
     // total_row_count_in_segment may be greater than rows actually read,
     // because there may be deleted rows
     UniquePtr<u64[]> distinct_keys = nullptr;
@@ -437,7 +611,15 @@ void BuildFastRoughFilterTask::ExecuteInner(SegmentEntry *segment_entry, BufferM
             continue;
         }
         // step 2.2. collect distinct data from blocks and build probabilistic_data_filter for blocks and segment
-        BuildFastRoughFilterArg arg(segment_entry, column_id, distinct_keys, distinct_keys_backup, buffer_manager, begin_ts, segment_row_count);
+        BuildFastRoughFilterArg arg(segment_entry,
+                                    block_entries,
+                                    build_segment_filter,
+                                    column_id,
+                                    distinct_keys,
+                                    distinct_keys_backup,
+                                    buffer_manager,
+                                    begin_ts,
+                                    segment_row_count);
         switch (data_type_ptr->type()) {
             case kBoolean: {
                 BuildFilter<BooleanT, CheckTS>(arg, build_min_max_filter, build_bloom_filter);
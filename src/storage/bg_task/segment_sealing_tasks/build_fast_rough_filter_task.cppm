@@ -18,6 +18,7 @@ export module build_fast_rough_filter_task;
 
 import stl;
 import segment_entry;
+import block_entry;
 import buffer_manager;
 import infinity_exception;
 import filter_value_type_classification;
@@ -34,6 +35,10 @@ struct TotalRowCount {
 
 struct BuildFastRoughFilterArg {
     SegmentEntry *segment_entry_{};
+    // the blocks to read, and whether to build the filter of each of them
+    const Vector<Pair<BlockEntry *, bool>> &block_entries_;
+    // false when only the filters of the blocks are built
+    bool build_segment_filter_{};
     ColumnID column_id_{};
     UniquePtr<u64[]> &distinct_keys_;
     UniquePtr<u64[]> &distinct_keys_backup_;
@@ -44,32 +49,53 @@ struct BuildFastRoughFilterArg {
     TotalRowCount total_row_count_handler_{total_row_count_in_segment_};
 
     BuildFastRoughFilterArg(SegmentEntry *segment_entry,
+                            const Vector<Pair<BlockEntry *, bool>> &block_entries,
+                            bool build_segment_filter,
                             ColumnID column_id,
                             UniquePtr<u64[]> &distinct_keys,
                             UniquePtr<u64[]> &distinct_keys_backup,
                             BufferManager *buffer_manager,
                             TxnTimeStamp begin_ts,
                             u32 total_row_count_in_segment)
-        : segment_entry_(segment_entry), column_id_(column_id), distinct_keys_(distinct_keys), distinct_keys_backup_(distinct_keys_backup),
-          buffer_manager_(buffer_manager), begin_ts_(begin_ts), total_row_count_in_segment_(total_row_count_in_segment) {}
+        : segment_entry_(segment_entry), block_entries_(block_entries), build_segment_filter_(build_segment_filter), column_id_(column_id),
+          distinct_keys_(distinct_keys), distinct_keys_backup_(distinct_keys_backup), buffer_manager_(buffer_manager), begin_ts_(begin_ts),
+          total_row_count_in_segment_(total_row_count_in_segment) {}
 };
 
 export class BuildFastRoughFilterTask {
 public:
-    static void ExecuteOnNewSealedSegment(SegmentEntry *segment_entry, BufferManager *buffer_manager, TxnTimeStamp begin_ts);
+    // zone_row_count: the rows of a zone of the zone map of the blocks, 0 for no zone map
+    static void ExecuteOnNewSealedSegment(SegmentEntry *segment_entry, BufferManager *buffer_manager, TxnTimeStamp begin_ts, u32 zone_row_count = 0);
+
+    // Builds the filters of a block of an unsealed segment once it is full, no row is appended to it any more. The segment filter
+    // is built when the segment is sealed, which keeps the filters of the blocks already built.
+    static void
+    ExecuteOnFullBlock(SegmentEntry *segment_entry, BlockEntry *block_entry, BufferManager *buffer_manager, TxnTimeStamp begin_ts, u32 zone_row_count = 0);
 
     static void ExecuteUpdateSegmentBloomFilter(SegmentEntry *segment_entry, BufferManager *buffer_manager, TxnTimeStamp begin_ts);
 
 private:
-    static void CheckAndSetSegmentHaveStartedBuildMinMaxFilterTask(SegmentEntry *segment, TxnTimeStamp begin_ts);
+    // block_entries: the blocks of the segment, those whose filter is built are flagged
+    static void
+    CheckAndSetSegmentHaveStartedBuildMinMaxFilterTask(SegmentEntry *segment, const Vector<Pair<BlockEntry *, bool>> &block_entries, TxnTimeStamp begin_ts);
+
+    static void SetSegmentBeginBuildMinMaxFilterTask(SegmentEntry *segment, const Vector<Pair<BlockEntry *, bool>> &block_entries, u32 column_count);
 
-    static void SetSegmentBeginBuildMinMaxFilterTask(SegmentEntry *segment, u32 column_count);
+    static void SetBlockBeginBuildZoneMap(BlockEntry *block_entry, u32 column_count, u32 zone_row_count);
 
-    static void SetSegmentFinishBuildMinMaxFilterTask(SegmentEntry *segment);
+    static void SetSegmentFinishBuildMinMaxFilterTask(SegmentEntry *segment, const Vector<Pair<BlockEntry *, bool>> &block_entries);
 
 private:
+    // collects the min and max of the zones of a block, the rows are read in order
+    template <typename ValueType>
+    class ZoneMinMaxBuilder;
+
     template <bool CheckTS>
-    static void ExecuteInner(SegmentEntry *segment_entry, BufferManager *buffer_manager, TxnTimeStamp begin_ts);
+    static void ExecuteInner(SegmentEntry *segment_entry,
+                             const Vector<Pair<BlockEntry *, bool>> &block_entries,
+                             bool build_segment_filter,
+                             BufferManager *buffer_manager,
+                             TxnTimeStamp begin_ts);
 
     template <CanBuildBloomFilter ValueType, bool CheckTS>
     static void BuildOnlyBloomFilter(BuildFastRoughFilterArg &arg);
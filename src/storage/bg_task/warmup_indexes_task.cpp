@@ -0,0 +1,37 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+module warmup_indexes_task;
+
+import stl;
+import bg_task;
+import txn;
+import txn_manager;
+import catalog;
+import db_entry;
+import table_entry;
+
+namespace infinity {
+
+void WarmupIndexesTask::Execute() {
+    for (DBEntry *db_entry : catalog_->Databases(txn_->TxnID(), txn_->BeginTS())) {
+        for (TableEntry *table_entry : db_entry->TableCollections(txn_->TxnID(), txn_->BeginTS())) {
+            table_entry->WarmupIndexes(txn_, String(), true);
+        }
+    }
+}
+
+} // namespace infinity
@@ -0,0 +1,46 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module warmup_indexes_task;
+
+import stl;
+import bg_task;
+import txn;
+
+namespace infinity {
+
+class Catalog;
+
+// Load the pinned indexes of all tables after the server starts, so that the first queries on them don't wait on the disk.
+export class WarmupIndexesTask final : public BGTask {
+public:
+    WarmupIndexesTask(Catalog *catalog, Txn *txn) : BGTask(BGTaskType::kWarmupIndexes, true), catalog_(catalog), txn_(txn) {}
+
+    ~WarmupIndexesTask() override = default;
+
+    String ToString() const override { return "Warmup indexes task"; }
+
+    void CommitTxn() { txn_->txn_mgr()->CommitTxn(txn_); }
+
+    void Execute();
+
+private:
+    Catalog *const catalog_;
+
+    Txn *const txn_;
+};
+
+} // namespace infinity
@@ -14,21 +14,27 @@
 
 module;
 
+#include <thread>
+
 import stl;
 import file_worker;
 import third_party;
 import local_file_system;
 import logger;
-import specific_concurrent_queue;
 
 import infinity_exception;
 import buffer_obj;
+import buffer_handle;
+import cold_storage;
+import default_values;
+import engine_metrics;
 
 module buffer_manager;
 
 namespace infinity {
-BufferManager::BufferManager(u64 memory_limit, SharedPtr<String> data_dir, SharedPtr<String> temp_dir)
-    : data_dir_(std::move(data_dir)), temp_dir_(std::move(temp_dir)), memory_limit_(memory_limit), current_memory_size_(0) {
+BufferManager::BufferManager(u64 memory_limit, SharedPtr<String> data_dir, SharedPtr<String> temp_dir, UniquePtr<ColdStorage> cold_storage)
+    : data_dir_(std::move(data_dir)), temp_dir_(std::move(temp_dir)), memory_limit_(memory_limit), current_memory_size_(0),
+      cold_storage_(std::move(cold_storage)) {
     LocalFileSystem fs;
     if (!fs.Exists(*data_dir_)) {
         fs.CreateDirectory(*data_dir_);
@@ -43,75 +49,126 @@ BufferObj *BufferManager::Allocate(UniquePtr<FileWorker> file_worker) {
     auto buffer_obj = MakeUnique<BufferObj>(this, true, std::move(file_worker));
 
     auto res = buffer_obj.get();
-    std::unique_lock w_locker(rw_locker_);
-    if (auto iter = buffer_map_.find(file_path); iter != buffer_map_.end()) {
+    BufferMapShard &shard = GetShard(file_path);
+    std::unique_lock w_locker(shard.rw_locker_);
+    if (auto iter = shard.buffer_map_.find(file_path); iter != shard.buffer_map_.end()) {
         UnrecoverableError(fmt::format("BufferManager::Allocate: file {} already exists.", file_path.c_str()));
     }
-    buffer_map_.emplace(file_path, std::move(buffer_obj));
+    shard.buffer_map_.emplace(std::move(file_path), std::move(buffer_obj));
     return res;
 }
 
 BufferObj *BufferManager::Get(UniquePtr<FileWorker> file_worker) {
     String file_path = file_worker->GetFilePath();
-
-    rw_locker_.lock_shared();
-    auto iter1 = buffer_map_.find(file_path);
-    rw_locker_.unlock_shared();
-
-    if (iter1 != buffer_map_.end()) {
-        return iter1->second.get();
+    BufferMapShard &shard = GetShard(file_path);
+    {
+        std::shared_lock r_locker(shard.rw_locker_);
+        if (auto iter = shard.buffer_map_.find(file_path); iter != shard.buffer_map_.end()) {
+            return iter->second.get();
+        }
     }
 
     // Cannot find BufferHandle in buffer_map, read from disk
     auto buffer_obj = MakeUnique<BufferObj>(this, false, std::move(file_worker));
 
-    rw_locker_.lock();
-    auto [iter2, insert_ok] = buffer_map_.emplace(std::move(file_path), std::move(buffer_obj));
-    // If insert_ok is false, it means another thread has inserted the same buffer handle. Return it.
-    rw_locker_.unlock();
-
-    return iter2->second.get();
+    std::unique_lock w_locker(shard.rw_locker_);
+    // If another thread has inserted the same buffer handle, return it.
+    auto [iter, insert_ok] = shard.buffer_map_.emplace(std::move(file_path), std::move(buffer_obj));
+    return iter->second.get();
 }
 
 // return false if buffer_obj is not loaded
 void BufferManager::RemoveBufferObj(const String &file_path) {
-    std::unique_lock w_lock(rw_locker_);
-    if (auto iter = buffer_map_.find(file_path); iter != buffer_map_.end()) {
-        buffer_map_.erase(iter);
+    if (cold_storage_ != nullptr) {
+        cold_storage_->Remove(file_path);
+    }
+    BufferMapShard &shard = GetShard(file_path);
+    std::unique_lock w_lock(shard.rw_locker_);
+    if (auto iter = shard.buffer_map_.find(file_path); iter != shard.buffer_map_.end()) {
+        shard.buffer_map_.erase(iter);
     }
 }
 
+Future<void> BufferManager::Prefetch(BufferObj *buffer_obj) {
+    return prefetch_pool_.push([this, buffer_obj](int) {
+        // A read ahead must not evict buffers that may still be used to make room for a buffer that may not be.
+        if (buffer_obj->status() == BufferStatus::kFreed && current_memory_size_ + buffer_obj->GetBufferSize() <= memory_limit_) {
+            // The handle is dropped at once, the data stays in memory until the gc frees it.
+            BufferHandle buffer_handle = buffer_obj->Load();
+        }
+    });
+}
+
 void BufferManager::RequestSpace(SizeT need_size, BufferObj *buffer_obj) {
+    // a victim in use is put back, so that each buffer is tried at most once
+    SizeT try_count = gc_replacer_.size();
     while (current_memory_size_ + need_size > memory_limit_) {
-        BufferObj *buffer_obj1 = nullptr;
-        /// FIXME: Actually it is not a good idea to use the moodycamel::ConcurrentQueue.
-        /// When dealing with heavy concurrent read requests, and each request holds some buffer_objs that may cause
-        /// memory usage to exceed the memory_limit, the current handling will lead to some problems. We should consider
-        /// triggering the garbage collection (gc) to free up unnecessary buffer_objs in gc_queue. But currently, we
-        /// only attempt this once, and the service may crash if the head item of the queue shouldn't be freed.
-        /// TODO:
-        /// 1. Replace moodycamel::ConcurrentQueue with a queue using a replacement strategy.
-        /// 2. When encountering out-of-memory situations, first attempt to trigger the gc to try to free up some buffer_objs
-        ///    (not only once now) in gc_queue.
-        /// 3. If the memory usage still exceeds the memory_limit, then consider crashing the service or outputting a warning log.
-        if (gc_queue_.TryDequeue(buffer_obj1)) {
-            if (buffer_obj == buffer_obj1) {
-                UnrecoverableError("buffer object duplicated in gc_queue.");
-            }
-            auto size = buffer_obj1->GetBufferSize();
-            if (buffer_obj1->Free()) {
-                current_memory_size_ -= size;
-            }
+        BufferObj *buffer_obj1 = try_count > 0 ? gc_replacer_.PopVictim() : nullptr;
+        if (buffer_obj1 == nullptr) {
+            // every buffer in memory is in use, going over the limit is better than failing the query
+            LOG_WARN(fmt::format("Buffer memory {} exceeds the limit {}, no unused buffer to free.", current_memory_size_ + need_size, memory_limit_));
+            break;
+        }
+        --try_count;
+        if (buffer_obj == buffer_obj1) {
+            UnrecoverableError("buffer object duplicated in gc_replacer.");
+        }
+        if (buffer_obj1->pinned()) {
+            // pinned after it was unloaded, Unpin puts it back
+            continue;
+        }
+        auto size = buffer_obj1->GetBufferSize();
+        if (buffer_obj1->Free()) {
+            current_memory_size_ -= size;
+            EngineMetrics::instance().buffer_evictions_.Add();
         } else {
-            UnrecoverableError("Out of memory.");
+            // loaded again since it was unloaded
+            gc_replacer_.Touch(buffer_obj1, size, true);
         }
     }
     current_memory_size_ += need_size;
 }
 
-void BufferManager::PushGCQueue(BufferObj *buffer_obj) {
-    // gc_queue_ is lock-free. No lock is needed.
-    gc_queue_.Enqueue(buffer_obj);
+MemoryPressure BufferManager::memory_pressure() const {
+    u64 memory_usage = current_memory_size_.load();
+    u64 evictable_size = gc_replacer_.total_size();
+    u64 pinned_size = memory_usage > evictable_size ? memory_usage - evictable_size : 0;
+    if (pinned_size >= memory_limit_ * MEMORY_PRESSURE_CRITICAL_RATIO) {
+        return MemoryPressure::kCritical;
+    }
+    if (pinned_size >= memory_limit_ * MEMORY_PRESSURE_HIGH_RATIO) {
+        return MemoryPressure::kHigh;
+    }
+    return MemoryPressure::kLow;
+}
+
+bool BufferManager::WaitForMemoryPressureBelow(MemoryPressure pressure, std::chrono::milliseconds timeout) const {
+    // polled rather than signaled, so that loading and unloading buffers pay nothing for it
+    constexpr auto poll_interval = std::chrono::milliseconds(10);
+    auto deadline = std::chrono::steady_clock::now() + timeout;
+    while (memory_pressure() >= pressure) {
+        if (std::chrono::steady_clock::now() >= deadline) {
+            return false;
+        }
+        std::this_thread::sleep_for(poll_interval);
+    }
+    return true;
 }
 
+Vector<u64> BufferManager::MemoryUsageByType() {
+    Vector<u64> memory_usage(BUFFER_TYPE_COUNT);
+    for (BufferMapShard &shard : buffer_map_shards_) {
+        std::shared_lock r_locker(shard.rw_locker_);
+        for (const auto &[file_path, buffer_obj] : shard.buffer_map_) {
+            BufferStatus status = buffer_obj->status();
+            if (status == BufferStatus::kLoaded || status == BufferStatus::kUnloaded) {
+                memory_usage[static_cast<SizeT>(buffer_obj->type())] += buffer_obj->GetBufferSize();
+            }
+        }
+    }
+    return memory_usage;
+}
+
+void BufferManager::PushGCQueue(BufferObj *buffer_obj) { gc_replacer_.Touch(buffer_obj, buffer_obj->GetBufferSize(), buffer_obj->IsIndex()); }
+
 } // namespace infinity
@@ -16,7 +16,9 @@ module;
 
 import stl;
 import file_worker;
-import specific_concurrent_queue;
+import buffer_replacer;
+import default_values;
+import cold_storage;
 
 export module buffer_manager;
 
@@ -24,9 +26,17 @@ namespace infinity {
 
 class BufferObj;
 
+// How much of the buffer memory is held by buffers in use, which the buffer manager can't free. The buffers waiting to be
+// freed don't count, a pool full of them is a warm cache rather than a shortage.
+export enum class MemoryPressure : u8 {
+    kLow,
+    kHigh,     // compaction slows down
+    kCritical, // background tasks are deferred, mem indexes are dumped early
+};
+
 export class BufferManager {
 public:
-    explicit BufferManager(u64 memory_limit, SharedPtr<String> data_dir, SharedPtr<String> temp_dir);
+    explicit BufferManager(u64 memory_limit, SharedPtr<String> data_dir, SharedPtr<String> temp_dir, UniquePtr<ColdStorage> cold_storage = nullptr);
 
 public:
     // Create a new BufferHandle, or in replay process. (read data block from wal)
@@ -37,10 +47,17 @@ public:
 
     void RemoveBufferObj(const String &file_path);
 
+    // Read a freed buffer on a prefetch thread, so that the worker which loads it later doesn't wait on the disk.
+    // The caller keeps the future and waits for it before the buffer obj may be removed.
+    Future<void> Prefetch(BufferObj *buffer_obj);
+
     SharedPtr<String> GetDataDir() const { return data_dir_; }
 
     SharedPtr<String> GetTempDir() const { return temp_dir_; }
 
+    // The tier the files of sealed segments are offloaded to, null if not configured.
+    ColdStorage *cold_storage() const { return cold_storage_.get(); }
+
     u64 memory_limit() const {
         // memory_limit is const var, no need to lock
         return memory_limit_;
@@ -48,6 +65,15 @@ public:
 
     u64 memory_usage() const { return current_memory_size_.load(); }
 
+    MemoryPressure memory_pressure() const;
+
+    // The memory of the buffers in memory indexed by BufferType, for the metrics. It locks each shard in turn.
+    Vector<u64> MemoryUsageByType();
+
+    // Block a background task while the memory pressure is at pressure or above, for at most timeout.
+    // Return false if it timed out.
+    bool WaitForMemoryPressureBelow(MemoryPressure pressure, std::chrono::milliseconds timeout) const;
+
 private:
     friend class BufferObj;
 
@@ -55,16 +81,30 @@ private:
     void RequestSpace(SizeT need_size, BufferObj *buffer_obj);
 
     // BufferHandle calls it, after unload.
-    void PushGCQueue(BufferObj *buffer_handle);
+    void PushGCQueue(BufferObj *buffer_obj);
 
 private:
-    std::shared_mutex rw_locker_{};
+    // The buffer objs are spread over shards by the hash of the file path, so that the first loads of many blocks by many
+    // workers seldom wait for the same lock.
+    static constexpr SizeT BUFFER_MAP_SHARD_NUM = 64;
+
+    struct alignas(64) BufferMapShard {
+        std::shared_mutex rw_locker_{};
+        HashMap<String, UniquePtr<BufferObj>> buffer_map_{};
+    };
+
+    BufferMapShard &GetShard(const String &file_path) { return buffer_map_shards_[std::hash<String>{}(file_path) % BUFFER_MAP_SHARD_NUM]; }
 
     SharedPtr<String> data_dir_;
     SharedPtr<String> temp_dir_;
     const u64 memory_limit_{};
     atomic_u64 current_memory_size_{}; // TODO: need to be atomic
-    HashMap<String, UniquePtr<BufferObj>> buffer_map_{};
-    SpecificConcurrentQueue<BufferObj *> gc_queue_{};
+    Array<BufferMapShard, BUFFER_MAP_SHARD_NUM> buffer_map_shards_{};
+    // a quarter of the memory is for buffers used once
+    BufferReplacer gc_replacer_{memory_limit_ / 4};
+    UniquePtr<ColdStorage> cold_storage_{};
+
+    // Declared last so the pending reads are drained before the buffer objs are destroyed.
+    ThreadPool prefetch_pool_{BUFFER_PREFETCH_THREAD_NUM};
 };
 } // namespace infinity
\ No newline at end of file
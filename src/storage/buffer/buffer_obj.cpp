@@ -16,8 +16,14 @@ module;
 
 import stl;
 import file_worker;
+import file_system;
+import cold_storage;
+import local_file_system;
 import buffer_handle;
 import buffer_manager;
+import io_counter;
+import engine_metrics;
+import trace_span;
 import infinity_exception;
 import logger;
 
@@ -49,10 +55,19 @@ BufferHandle BufferObj::Load() {
     switch (status_) {
         case BufferStatus::kLoaded:
         case BufferStatus::kUnloaded: {
+            ++ThreadIOCounter().buffer_hits_;
+            EngineMetrics::instance().buffer_hits_.Add();
             break;
         }
         case BufferStatus::kFreed: {
+            ++ThreadIOCounter().buffer_misses_;
+            EngineMetrics::instance().buffer_misses_.Add();
+            TraceSpan load_span("buffer", "load");
             buffer_mgr_->RequestSpace(GetBufferSize(), this);
+            if (ColdStorage *cold_storage = buffer_mgr_->cold_storage(); cold_storage != nullptr && type_ == BufferType::kPersistent) {
+                // the local copy may have been evicted
+                cold_storage->Fetch(GetFilename());
+            }
             file_worker_->ReadFromFile(type_ != BufferType::kPersistent);
             if (type_ == BufferType::kEphemeral) {
                 type_ = BufferType::kTemp;
@@ -77,6 +92,13 @@ BufferHandle BufferObj::Load() {
 
 void BufferObj::GetMutPointer() {
     std::unique_lock<std::shared_mutex> w_locker(rw_locker_);
+    if (type_ == BufferType::kPersistent) {
+        file_worker_->PrepareMutation();
+        if (ColdStorage *cold_storage = buffer_mgr_->cold_storage(); cold_storage != nullptr) {
+            // the file will be rewritten, the cold copy is stale and the local copy must not be evicted
+            cold_storage->Remove(GetFilename());
+        }
+    }
     type_ = BufferType::kEphemeral;
 }
 
@@ -86,10 +108,11 @@ void BufferObj::UnloadInner() {
         case BufferStatus::kLoaded: {
             --rc_;
             if (rc_ == 0) {
-                if (!wait_for_gc_) {
+                // also when it waits for gc already, which tells the gc that it is used again
+                if (!pinned_) {
                     buffer_mgr_->PushGCQueue(this);
-                    wait_for_gc_ = true;
                 }
+                wait_for_gc_ = true;
                 status_ = BufferStatus::kUnloaded;
             }
             break;
@@ -100,6 +123,19 @@ void BufferObj::UnloadInner() {
     }
 }
 
+void BufferObj::Pin() {
+    std::unique_lock<std::shared_mutex> w_locker(rw_locker_);
+    pinned_ = true;
+}
+
+void BufferObj::Unpin() {
+    std::unique_lock<std::shared_mutex> w_locker(rw_locker_);
+    if (pinned_ && status_ == BufferStatus::kUnloaded) {
+        buffer_mgr_->PushGCQueue(this);
+    }
+    pinned_ = false;
+}
+
 bool BufferObj::Free() {
     std::unique_lock<std::shared_mutex> w_locker(rw_locker_);
     switch (status_) {
@@ -110,6 +146,7 @@ bool BufferObj::Free() {
             return false;
         }
         case BufferStatus::kUnloaded: {
+            TraceSpan evict_span("buffer", "evict");
             switch (type_) {
                 case BufferType::kTemp:
                 case BufferType::kPersistent: {
@@ -174,6 +211,39 @@ void BufferObj::CloseFile() {
     rw_locker_.unlock();
 }
 
+void BufferObj::CloseFile(Vector<UniquePtr<FileHandler>> &unsynced_files) {
+    unsynced_files.push_back(file_worker_->TakeFile());
+    rw_locker_.unlock();
+}
+
+void BufferObj::Offload() {
+    ColdStorage *cold_storage = buffer_mgr_->cold_storage();
+    if (cold_storage == nullptr) {
+        return;
+    }
+    std::shared_lock<std::shared_mutex> r_locker(rw_locker_);
+    // only a saved file which is not going to be written again
+    if (type_ == BufferType::kPersistent && status_ != BufferStatus::kClean) {
+        cold_storage->Upload(GetFilename());
+    }
+}
+
+bool BufferObj::LinkFile(const String &dst_path) {
+    // exclusive, so that a file being saved is not linked half written
+    std::unique_lock<std::shared_mutex> w_locker(rw_locker_);
+    String src_path = GetFilename();
+    if (ColdStorage *cold_storage = buffer_mgr_->cold_storage(); cold_storage != nullptr && type_ == BufferType::kPersistent) {
+        // the local copy may have been evicted
+        cold_storage->Fetch(src_path);
+    }
+    LocalFileSystem fs;
+    if (!fs.Exists(src_path)) {
+        return false;
+    }
+    LocalFileSystem::HardLink(src_path, dst_path);
+    return true;
+}
+
 void BufferObj::SetAndTryCleanup() {
     std::unique_lock<std::shared_mutex> w_locker(rw_locker_);
     switch (status_) {
@@ -16,6 +16,7 @@ module;
 
 import stl;
 import file_worker;
+import file_system;
 import buffer_handle;
 
 export module buffer_obj;
@@ -38,6 +39,8 @@ export enum class BufferType {
     kTemp,
 };
 
+export constexpr SizeT BUFFER_TYPE_COUNT = static_cast<SizeT>(BufferType::kTemp) + 1;
+
 export String BufferStatusToString(BufferStatus status) {
     switch (status) {
         case BufferStatus::kLoaded:
@@ -80,12 +83,34 @@ public:
 
     void CloseFile();
 
+    // Instead of Sync() and CloseFile(): the written file is added to unsynced_files, to be synced with other files by the caller.
+    void CloseFile(Vector<UniquePtr<FileHandler>> &unsynced_files);
+
+    // Upload the saved file to the cold storage of the buffer manager, if there is one.
+    void Offload();
+
+    // Hard link the saved file to dst_path, for a cloned table. Returns false if the file was never saved.
+    bool LinkFile(const String &dst_path);
+
     void SetAndTryCleanup();
 
     SizeT GetBufferSize() const { return file_worker_->GetMemoryCost(); }
 
     String GetFilename() const { return file_worker_->GetFilePath(); }
 
+    bool IsIndex() const { return file_worker_->IsIndex(); }
+
+    // A pinned buffer isn't put into the gc queue when it is unloaded, so it stays in memory once loaded.
+    void Pin();
+
+    // The buffer goes into the gc queue again if it is unloaded. Called before the buffer is cleaned up.
+    void Unpin();
+
+    bool pinned() {
+        std::shared_lock<std::shared_mutex> r_locker(rw_locker_);
+        return pinned_;
+    }
+
 private:
     // Friend to encapsulate `Unload` interface and to increase `rc_`.
     friend class BufferHandle;
@@ -117,6 +142,7 @@ protected:
     BufferType type_{BufferType::kTemp};
     u64 rc_{0};
     bool wait_for_gc_{false};
+    bool pinned_{false};
     const UniquePtr<FileWorker> file_worker_;
 };
 
@@ -0,0 +1,74 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+module;
+
+module buffer_replacer;
+
+import stl;
+
+namespace infinity {
+
+void BufferReplacer::Touch(BufferObj *buffer_obj, SizeT size, bool protect) {
+    std::unique_lock lock(mutex_);
+    auto iter = entries_.find(buffer_obj);
+    if (iter == entries_.end()) {
+        EntryList &list = protect ? protected_ : probation_;
+        list.push_back(Entry{buffer_obj, size, protect});
+        auto entry_iter = list.end();
+        entries_.emplace(buffer_obj, --entry_iter);
+        if (!protect) {
+            probation_size_ += size;
+        }
+        total_size_ += size;
+        return;
+    }
+    // used again before it is freed
+    auto entry_iter = iter->second;
+    if (!entry_iter->protected_) {
+        probation_size_ -= entry_iter->size_;
+        entry_iter->protected_ = true;
+        protected_.splice(protected_.end(), probation_, entry_iter);
+    } else {
+        protected_.splice(protected_.end(), protected_, entry_iter);
+    }
+}
+
+BufferObj *BufferReplacer::PopVictim() {
+    std::unique_lock lock(mutex_);
+    EntryList *list = nullptr;
+    if (!probation_.empty() and (probation_size_ > probation_limit_ or protected_.empty())) {
+        list = &probation_;
+    } else if (!protected_.empty()) {
+        list = &protected_;
+    } else {
+        return nullptr;
+    }
+    Entry entry = list->front();
+    list->pop_front();
+    entries_.erase(entry.buffer_obj_);
+    if (!entry.protected_) {
+        probation_size_ -= entry.size_;
+    }
+    total_size_ -= entry.size_;
+    return entry.buffer_obj_;
+}
+
+SizeT BufferReplacer::size() {
+    std::unique_lock lock(mutex_);
+    return entries_.size();
+}
+
+} // namespace infinity
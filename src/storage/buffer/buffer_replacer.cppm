@@ -0,0 +1,65 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+module;
+
+export module buffer_replacer;
+
+import stl;
+
+namespace infinity {
+
+class BufferObj;
+
+// Chooses the unloaded buffers to free when the buffer manager needs memory, a 2Q policy that resists scans.
+// A buffer unloaded for the first time enters the probation list, and moves to the protected list if it is unloaded again
+// before it is freed, so an import or a full scan touching every block once only turns over the probation list.
+// Index buffers are protected from the start, a scan of data blocks never pushes them out.
+// Victims are taken from the probation list while its buffers hold more than probation_limit bytes or nothing is
+// protected, otherwise from the least recently used end of the protected list.
+export class BufferReplacer {
+public:
+    explicit BufferReplacer(SizeT probation_limit) : probation_limit_(probation_limit) {}
+
+    // buffer_obj of size bytes is unloaded, or is in use when it is chosen as a victim
+    void Touch(BufferObj *buffer_obj, SizeT size, bool protect);
+
+    // remove the next victim and return it, nullptr if there is none
+    BufferObj *PopVictim();
+
+    SizeT size();
+
+    // bytes of the buffers waiting to be freed, some of which may have been loaded again
+    SizeT total_size() const { return total_size_.load(); }
+
+private:
+    struct Entry {
+        BufferObj *buffer_obj_{};
+        SizeT size_{};
+        bool protected_{};
+    };
+    using EntryList = List<Entry>;
+
+    const SizeT probation_limit_;
+    std::mutex mutex_{};
+    // least recently unloaded first
+    EntryList probation_{};
+    EntryList protected_{};
+    SizeT probation_size_{0};
+    Atomic<SizeT> total_size_{0};
+    HashMap<BufferObj *, EntryList::iterator> entries_{};
+};
+
+} // namespace infinity
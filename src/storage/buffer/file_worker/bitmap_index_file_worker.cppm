@@ -0,0 +1,59 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module bitmap_index_file_worker;
+
+import stl;
+import index_file_worker;
+import file_worker;
+
+import index_base;
+import column_def;
+
+namespace infinity {
+
+export struct CreateBitmapIndexParam : public CreateIndexParam {
+    const u32 row_count_{}; // rows in the segment, include the deleted rows
+    CreateBitmapIndexParam(SharedPtr<IndexBase> index_base, SharedPtr<ColumnDef> column_def, u32 row_count)
+        : CreateIndexParam(index_base, column_def), row_count_(row_count) {}
+};
+
+// BitmapIndexFileWorker holds the BitmapIndexData of a segment in one file
+export class BitmapIndexFileWorker final : public IndexFileWorker {
+public:
+    explicit BitmapIndexFileWorker(SharedPtr<String> file_dir,
+                                   SharedPtr<String> file_name,
+                                   SharedPtr<IndexBase> index_base,
+                                   SharedPtr<ColumnDef> column_def,
+                                   u32 row_count)
+        : IndexFileWorker(file_dir, file_name, index_base, column_def), row_count_(row_count) {}
+
+    ~BitmapIndexFileWorker() final;
+
+public:
+    void AllocateInMemory() final;
+
+    void FreeInMemory() final;
+
+protected:
+    void WriteToFileImpl(bool &prepare_success) final;
+
+    void ReadFromFileImpl() final;
+
+    const u32 row_count_{};
+};
+
+} // namespace infinity
@@ -14,6 +14,9 @@
 
 module;
 
+#include <sys/mman.h>
+#include <unistd.h>
+
 module data_file_worker;
 
 import stl;
@@ -21,11 +24,22 @@ import infinity_exception;
 import local_file_system;
 import third_party;
 import status;
+import column_encoding;
+import huge_page_allocator;
+import file_system;
+import default_values;
 
 namespace infinity {
 
-DataFileWorker::DataFileWorker(SharedPtr<String> file_dir, SharedPtr<String> file_name, SizeT buffer_size)
-    : FileWorker(std::move(file_dir), std::move(file_name)), buffer_size_(buffer_size) {}
+namespace {
+
+constexpr u64 PLAIN_MAGIC_NUMBER = 0x00dd3344;
+constexpr u64 ENCODED_MAGIC_NUMBER = 0x00dd3345;
+
+} // namespace
+
+DataFileWorker::DataFileWorker(SharedPtr<String> file_dir, SharedPtr<String> file_name, SizeT buffer_size, SizeT value_width)
+    : FileWorker(std::move(file_dir), std::move(file_name)), buffer_size_(buffer_size), value_width_(value_width) {}
 
 DataFileWorker::~DataFileWorker() {
     if (data_ != nullptr) {
@@ -41,26 +55,69 @@ void DataFileWorker::AllocateInMemory() {
     if (buffer_size_ == 0) {
         UnrecoverableError("Buffer size is 0.");
     }
-    data_ = static_cast<void *>(new char[buffer_size_]{});
+    data_ = HugePageAllocator::Allocate(buffer_size_);
+    data_size_ = buffer_size_;
 }
 
 void DataFileWorker::FreeInMemory() {
     if (data_ == nullptr) {
         UnrecoverableError("Data is already freed.");
     }
-    delete[] static_cast<char *>(data_);
+    if (mmap_addr_ != nullptr) {
+        munmap(mmap_addr_, mmap_size_);
+        mmap_addr_ = nullptr;
+        mmap_size_ = 0;
+    } else {
+        HugePageAllocator::Deallocate(data_, data_size_);
+    }
     data_ = nullptr;
 }
 
+void DataFileWorker::PrepareMutation() {
+    if (mmap_addr_ == nullptr || mmap_private_) {
+        return;
+    }
+    // The file is rewritten from data_ at the next checkpoint. A page still shared with the file would change under the writer if
+    // the column is encoded this time, so every page is copied now.
+    static const SizeT page_size = sysconf(_SC_PAGESIZE);
+    auto *ptr = static_cast<volatile char *>(mmap_addr_);
+    for (SizeT offset = 0; offset < mmap_size_; offset += page_size) {
+        ptr[offset] = ptr[offset];
+    }
+    mmap_private_ = true;
+}
+
+bool DataFileWorker::MapFile(SizeT file_size, SizeT buffer_size) {
+    // a spill file is rewritten in place, and many small mappings would run into the max map count
+    if (read_from_spill_ || buffer_size < DATA_FILE_MMAP_MIN_SIZE) {
+        return false;
+    }
+    i32 fd = static_cast<LocalFileHandler *>(file_handler_.get())->fd_;
+    void *addr = mmap(nullptr, file_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    if (addr == MAP_FAILED) {
+        return false;
+    }
+    mmap_addr_ = addr;
+    mmap_size_ = file_size;
+    mmap_private_ = false;
+    data_ = static_cast<char *>(addr) + 2 * sizeof(u64);
+    data_size_ = buffer_size;
+    return true;
+}
+
 void DataFileWorker::WriteToFileImpl(bool &prepare_success) {
     LocalFileSystem fs;
     // File structure:
     // - header: magic number
     // - header: buffer size
-    // - data buffer
+    // - header: encoding type, value width, encoded size (only if the magic number is ENCODED_MAGIC_NUMBER)
+    // - data buffer, or the encoded data
     // - footer: checksum
 
-    u64 magic_number = 0x00dd3344;
+    Vector<char> encoded;
+    ColumnEncodingType encoding_type = EncodeColumn(static_cast<const char *>(data_), buffer_size_, value_width_, encoded);
+
+    u64 magic_number = encoding_type == ColumnEncodingType::kPlain ? PLAIN_MAGIC_NUMBER : ENCODED_MAGIC_NUMBER;
     u64 nbytes = fs.Write(*file_handler_, &magic_number, sizeof(magic_number));
     if (nbytes != sizeof(magic_number)) {
         RecoverableError(Status::DataIOError(fmt::format("Write magic number which length is {}.", nbytes)));
@@ -71,9 +128,23 @@ void DataFileWorker::WriteToFileImpl(bool &prepare_success) {
         RecoverableError(Status::DataIOError(fmt::format("Write buffer length field which length is {}.", nbytes)));
     }
 
-    nbytes = fs.Write(*file_handler_, data_, buffer_size_);
-    if (nbytes != buffer_size_) {
-        RecoverableError(Status::DataIOError(fmt::format("Expect to write buffer with size: {}, but {} bytes is written", buffer_size_, nbytes)));
+    if (encoding_type == ColumnEncodingType::kPlain) {
+        nbytes = fs.Write(*file_handler_, data_, buffer_size_);
+        if (nbytes != buffer_size_) {
+            RecoverableError(
+                Status::DataIOError(fmt::format("Expect to write buffer with size: {}, but {} bytes is written", buffer_size_, nbytes)));
+        }
+    } else {
+        u64 encoding_header[3] = {static_cast<u64>(encoding_type), value_width_, encoded.size()};
+        nbytes = fs.Write(*file_handler_, encoding_header, sizeof(encoding_header));
+        if (nbytes != sizeof(encoding_header)) {
+            RecoverableError(Status::DataIOError(fmt::format("Write encoding header which length is {}.", nbytes)));
+        }
+        nbytes = fs.Write(*file_handler_, encoded.data(), encoded.size());
+        if (nbytes != encoded.size()) {
+            RecoverableError(
+                Status::DataIOError(fmt::format("Expect to write encoded buffer with size: {}, but {} bytes is written", encoded.size(), nbytes)));
+        }
     }
 
     u64 checksum{};
@@ -98,7 +169,7 @@ void DataFileWorker::ReadFromFileImpl() {
     if (nbytes != sizeof(magic_number)) {
         RecoverableError(Status::DataIOError(fmt::format("Read magic number which length isn't {}.", nbytes)));
     }
-    if (magic_number != 0x00dd3344) {
+    if (magic_number != PLAIN_MAGIC_NUMBER && magic_number != ENCODED_MAGIC_NUMBER) {
         RecoverableError(Status::DataIOError(fmt::format("Incorrect file header magic number: {}.", magic_number)));
     }
 
@@ -107,15 +178,48 @@ void DataFileWorker::ReadFromFileImpl() {
     if (nbytes != sizeof(buffer_size_)) {
         RecoverableError(Status::DataIOError(fmt::format("Unmatched buffer length: {} / {}", nbytes, buffer_size_)));
     }
-    if (file_size != buffer_size_ + 3 * sizeof(u64)) {
-        RecoverableError(Status::DataIOError(fmt::format("File size: {} isn't matched with {}.", file_size, buffer_size_ + 3 * sizeof(u64))));
-    }
 
-    // file body
-    data_ = static_cast<void *>(new char[buffer_size_]{});
-    nbytes = fs.Read(*file_handler_, data_, buffer_size_);
-    if (nbytes != buffer_size_) {
-        RecoverableError(Status::DataIOError(fmt::format("Expect to read buffer with size: {}, but {} bytes is read", buffer_size_, nbytes)));
+    if (magic_number == ENCODED_MAGIC_NUMBER) {
+        u64 encoding_header[3]{};
+        nbytes = fs.Read(*file_handler_, encoding_header, sizeof(encoding_header));
+        if (nbytes != sizeof(encoding_header)) {
+            RecoverableError(Status::DataIOError(fmt::format("Incorrect encoding header length: {}.", nbytes)));
+        }
+        auto [encoding_type, value_width, encoded_size] = encoding_header;
+        if (file_size != encoded_size + 6 * sizeof(u64)) {
+            RecoverableError(Status::DataIOError(fmt::format("File size: {} isn't matched with {}.", file_size, encoded_size + 6 * sizeof(u64))));
+        }
+        auto encoded = MakeUniqueForOverwrite<char[]>(encoded_size);
+        nbytes = fs.Read(*file_handler_, encoded.get(), encoded_size);
+        if (nbytes != encoded_size) {
+            RecoverableError(
+                Status::DataIOError(fmt::format("Expect to read encoded buffer with size: {}, but {} bytes is read", encoded_size, nbytes)));
+        }
+        data_ = HugePageAllocator::Allocate(buffer_size_);
+        data_size_ = buffer_size_;
+        DecodeColumn(static_cast<ColumnEncodingType>(encoding_type),
+                     encoded.get(),
+                     encoded_size,
+                     value_width,
+                     static_cast<char *>(data_),
+                     buffer_size_);
+    } else {
+        if (file_size != buffer_size_ + 3 * sizeof(u64)) {
+            RecoverableError(Status::DataIOError(fmt::format("File size: {} isn't matched with {}.", file_size, buffer_size_ + 3 * sizeof(u64))));
+        }
+
+        // file body, its layout is the one in memory
+        if (MapFile(file_size, buffer_size_)) {
+            fs.Seek(*file_handler_, file_size - sizeof(u64));
+        } else {
+            data_ = HugePageAllocator::Allocate(buffer_size_);
+            data_size_ = buffer_size_;
+            nbytes = fs.Read(*file_handler_, data_, buffer_size_);
+            if (nbytes != buffer_size_) {
+                RecoverableError(
+                    Status::DataIOError(fmt::format("Expect to read buffer with size: {}, but {} bytes is read", buffer_size_, nbytes)));
+            }
+        }
     }
 
     // file footer: checksum
@@ -23,7 +23,8 @@ namespace infinity {
 
 export class DataFileWorker : public FileWorker {
 public:
-    explicit DataFileWorker(SharedPtr<String> file_dir, SharedPtr<String> file_name, SizeT buffer_size);
+    // value_width: the width of the fixed width values in the buffer, which are then encoded on disk. 0 to write the buffer as is.
+    explicit DataFileWorker(SharedPtr<String> file_dir, SharedPtr<String> file_name, SizeT buffer_size, SizeT value_width = 0);
 
     virtual ~DataFileWorker() override;
 
@@ -34,6 +35,8 @@ public:
 
     SizeT GetMemoryCost() const override { return buffer_size_; }
 
+    void PrepareMutation() override;
+
 protected:
     void WriteToFileImpl(bool &prepare_success) override;
 
@@ -41,5 +44,15 @@ protected:
 
 private:
     const SizeT buffer_size_;
+    const SizeT value_width_;
+    SizeT data_size_{0}; // the size of data_, read from the file if the worker is made with buffer size 0
+
+    // A large plain column read from the data dir is mapped instead of read, data_ points into the mapping. The mapping is private,
+    // the pages shared with the page cache are copied only when written.
+    bool MapFile(SizeT file_size, SizeT buffer_size);
+
+    void *mmap_addr_{nullptr};
+    SizeT mmap_size_{0};
+    bool mmap_private_{false}; // all pages of the mapping are copied
 };
 } // namespace infinity
\ No newline at end of file
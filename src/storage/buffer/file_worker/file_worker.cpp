@@ -26,6 +26,7 @@ import defer_op;
 import status;
 import local_file_system;
 import logger;
+import io_stats;
 
 namespace infinity {
 
@@ -46,12 +47,17 @@ void FileWorker::WriteToFile(bool to_spill) {
         UnrecoverableError("No data will be written.");
     }
     LocalFileSystem fs;
+    IOTableScope io_table_scope(table_io_stats_.get() != nullptr ? table_io_stats_.get() : ThreadIOContext().table_io_stats_);
 
     String write_dir = ChooseFileDir(to_spill);
     if (!fs.Exists(write_dir)) {
         fs.CreateDirectory(write_dir);
     }
     String write_path = fmt::format("{}/{}", write_dir, *file_name_);
+    if (!to_spill) {
+        // A file shared with a cloned table is copied on write.
+        LocalFileSystem::UnshareFile(write_path);
+    }
 
     u8 flags = FileFlags::WRITE_FLAG | FileFlags::CREATE_FLAG;
     file_handler_ = fs.OpenFile(write_path, flags, FileLockType::kWriteLock);
@@ -74,6 +80,7 @@ void FileWorker::WriteToFile(bool to_spill) {
 
 void FileWorker::ReadFromFile(bool from_spill) {
     LocalFileSystem fs;
+    IOTableScope io_table_scope(table_io_stats_.get() != nullptr ? table_io_stats_.get() : ThreadIOContext().table_io_stats_);
 
     String read_path = fmt::format("{}/{}", ChooseFileDir(from_spill), *file_name_);
     u8 flags = FileFlags::READ_FLAG;
@@ -82,6 +89,7 @@ void FileWorker::ReadFromFile(bool from_spill) {
         file_handler_->Close();
         file_handler_ = nullptr;
     });
+    read_from_spill_ = from_spill;
     ReadFromFileImpl();
 }
 
@@ -19,6 +19,7 @@ export module file_worker;
 import stl;
 import file_system;
 import third_party;
+import io_stats;
 
 namespace infinity {
 
@@ -45,6 +46,12 @@ public:
 
     virtual SizeT GetMemoryCost() const = 0;
 
+    // index buffers are kept in memory before data blocks
+    virtual bool IsIndex() const { return false; }
+
+    // Called before the data read from the file is modified for the first time.
+    virtual void PrepareMutation() {}
+
     void *GetData() { return data_; }
 
     void SetBaseTempDir(SharedPtr<String> base_dir, SharedPtr<String> temp_dir) {
@@ -52,6 +59,9 @@ public:
         temp_dir_ = std::move(temp_dir);
     }
 
+    // The reads and writes of the file are counted for the table owning it
+    void SetTableIOStats(SharedPtr<TableIOStats> table_io_stats) { table_io_stats_ = std::move(table_io_stats); }
+
     // Get file path. As key of buffer handle.
     String GetFilePath() const { return fmt::format("{}/{}", *file_dir_, *file_name_); }
 
@@ -59,6 +69,9 @@ public:
 
     void CloseFile();
 
+    // Hand over the open file instead of closing it, for the caller to sync it together with other files.
+    UniquePtr<FileHandler> TakeFile() { return std::move(file_handler_); }
+
 protected:
     virtual void WriteToFileImpl(bool &prepare_success) = 0;
 
@@ -74,10 +87,13 @@ public:
 protected:
     void *data_{nullptr};
     UniquePtr<FileHandler> file_handler_{nullptr};
+    // set before ReadFromFileImpl, a spill file is rewritten later and can not be mapped
+    bool read_from_spill_{false};
 
 private:
     // following members are not init in constructor
     SharedPtr<String> base_dir_{};
     SharedPtr<String> temp_dir_{};
+    SharedPtr<TableIOStats> table_io_stats_{};
 };
 } // namespace infinity
\ No newline at end of file
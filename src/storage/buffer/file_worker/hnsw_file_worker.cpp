@@ -117,7 +117,12 @@ void HnswFileWorker::ReadFromFileImpl() {
     switch (embedding_type) {
         case kElemFloat: {
             AbstractHnsw<f32, SegmentOffset> abstract_hnsw(nullptr, index_hnsw);
-            abstract_hnsw.Load(*file_handler_);
+            // a persisted index is never modified, search it in the page cache instead of reading it into memory
+            if (read_from_spill_) {
+                abstract_hnsw.Load(*file_handler_);
+            } else {
+                abstract_hnsw.LoadFromMmap(file_handler_->path_.string());
+            }
             data_ = abstract_hnsw.RawPtr();
             break;
         }
@@ -44,6 +44,8 @@ public:
 
     SizeT GetMemoryCost() const override { return 0; }
 
+    bool IsIndex() const override { return true; }
+
     ~IndexFileWorker() override = default;
 };
 
@@ -37,6 +37,7 @@ import buffer_manager;
 import status;
 import logical_type;
 import embedding_info;
+import number_parser;
 
 import block_column_entry;
 
@@ -53,6 +54,9 @@ VectorBufferType ColumnVector::InitializeHelper(ColumnVectorType vector_type, Si
     if (vector_type == ColumnVectorType::kInvalid) {
         UnrecoverableError("Attempt to initialize column vector to invalid type.");
     }
+    if (vector_type == ColumnVectorType::kDictionary) {
+        UnrecoverableError("Column vector with dictionary is initialized by InitializeDictionary.");
+    }
 
     // require BooleanT vector to be initialized with ColumnVectorType::kConstant or ColumnVectorType::kCompactBit
     // if ColumnVectorType::kFlat is used, change it to ColumnVectorType::kCompactBit
@@ -139,6 +143,17 @@ void ColumnVector::Initialize(BufferManager *buffer_mgr,
 }
 
 void ColumnVector::Initialize(const ColumnVector &other, const Selection &input_select) {
+    if (other.vector_type_ == ColumnVectorType::kDictionary) {
+        // the selected rows keep the codes into the same dictionary
+        InitializeDictionary(other.dictionary_, DEFAULT_VECTOR_SIZE);
+        tail_index_ = input_select.Size();
+        auto *codes = reinterpret_cast<u32 *>(data_ptr_);
+        const u32 *other_codes = other.dictionary_codes();
+        for (SizeT idx = 0; idx < tail_index_; ++idx) {
+            codes[idx] = other_codes[input_select.Get(idx)];
+        }
+        return;
+    }
     ColumnVectorType vector_type = other.vector_type_;
     Initialize(vector_type, vector_type == ColumnVectorType::kConstant ? other.capacity() : DEFAULT_VECTOR_SIZE);
 
@@ -281,6 +296,16 @@ void ColumnVector::Initialize(ColumnVectorType vector_type, const ColumnVector &
     if (end_idx <= start_idx) {
         UnrecoverableError("End index should larger than start index.");
     }
+    if (other.vector_type_ == ColumnVectorType::kDictionary) {
+        if (vector_type == ColumnVectorType::kDictionary) {
+            InitializeDictionary(other.dictionary_, end_idx - start_idx);
+            AppendDictionaryCodes(other.dictionary_codes() + start_idx, end_idx - start_idx);
+            return;
+        }
+        if (vector_type != ColumnVectorType::kConstant) {
+            return Initialize(vector_type, *other.Flatten(), start_idx, end_idx);
+        }
+    }
     Initialize(vector_type, end_idx - start_idx);
 
     if (vector_type_ == ColumnVectorType::kConstant) {
@@ -420,10 +445,135 @@ void ColumnVector::Initialize(ColumnVectorType vector_type, const ColumnVector &
     }
 }
 
+void ColumnVector::InitializeDictionary(SharedPtr<ColumnVector> dictionary, SizeT capacity) {
+    if (initialized) {
+        UnrecoverableError("Column vector is already initialized.");
+    }
+    if (dictionary.get() == nullptr || dictionary->vector_type() != ColumnVectorType::kFlat || *dictionary->data_type() != *data_type_) {
+        UnrecoverableError("The dictionary should be a kFlat column vector of the same data type.");
+    }
+    initialized = true;
+    vector_type_ = ColumnVectorType::kDictionary;
+    capacity_ = capacity;
+    tail_index_ = 0;
+    data_type_size_ = data_type_->Size();
+    dictionary_ = std::move(dictionary);
+    // The buffer keeps the codes instead of the values, so it is never the one of a reset vector.
+    buffer_ = VectorBuffer::Make(sizeof(u32), capacity_, VectorBufferType::kStandard);
+    nulls_ptr_ = Bitmask::Make(capacity_);
+    data_ptr_ = buffer_->GetDataMut();
+}
+
+void ColumnVector::AppendDictionaryCodes(const u32 *codes, SizeT count) {
+    if (vector_type_ != ColumnVectorType::kDictionary) {
+        UnrecoverableError("Attempt to append codes to a column vector without dictionary.");
+    }
+    if (tail_index_ + count > capacity_) {
+        UnrecoverableError(fmt::format("Attempt to append {} codes to {} rows, which exceeds {} limit.", count, tail_index_, capacity_));
+    }
+    std::memcpy(reinterpret_cast<u32 *>(data_ptr_) + tail_index_, codes, count * sizeof(u32));
+    tail_index_ += count;
+}
+
+SharedPtr<ColumnVector> ColumnVector::DictionaryEncode(const ColumnVector &flat, SizeT max_dictionary_size) {
+    if (flat.vector_type_ != ColumnVectorType::kFlat || flat.tail_index_ == 0 || max_dictionary_size == 0) {
+        return nullptr;
+    }
+    const LogicalType type = flat.data_type_->type();
+    switch (type) {
+        case LogicalType::kTinyInt:
+        case LogicalType::kSmallInt:
+        case LogicalType::kInteger:
+        case LogicalType::kBigInt:
+        case LogicalType::kHugeInt:
+        case LogicalType::kFloat:
+        case LogicalType::kDouble:
+        case LogicalType::kDecimal:
+        case LogicalType::kDate:
+        case LogicalType::kTime:
+        case LogicalType::kDateTime:
+        case LogicalType::kTimestamp:
+        case LogicalType::kVarchar: {
+            break;
+        }
+        default: {
+            return nullptr;
+        }
+    }
+
+    const SizeT row_count = flat.tail_index_;
+    auto dictionary = MakeShared<ColumnVector>(flat.data_type_);
+    dictionary->Initialize(ColumnVectorType::kFlat, std::min(max_dictionary_size, row_count));
+    Vector<u32> codes(row_count, 0);
+    // the values are told apart by their bytes, the content of a varchar instead of its heap position
+    HashMap<String, u32> value_codes;
+    String value;
+    for (SizeT idx = 0; idx < row_count; ++idx) {
+        if (!flat.nulls_ptr_->IsTrue(idx)) {
+            continue;
+        }
+        if (type == LogicalType::kVarchar) {
+            const VarcharT &varchar = reinterpret_cast<const VarcharT *>(flat.data_ptr_)[idx];
+            if (varchar.IsInlined()) {
+                value.assign(varchar.short_.data_, varchar.length_);
+            } else {
+                value.resize(varchar.length_);
+                flat.buffer_->fix_heap_mgr_->ReadFromHeap(value.data(), varchar.vector_.chunk_id_, varchar.vector_.chunk_offset_, varchar.length_);
+            }
+        } else {
+            value.assign(flat.data_ptr_ + idx * flat.data_type_size_, flat.data_type_size_);
+        }
+        auto [iter, inserted] = value_codes.emplace(value, static_cast<u32>(dictionary->Size()));
+        if (inserted) {
+            if (dictionary->Size() == max_dictionary_size) {
+                return nullptr;
+            }
+            dictionary->AppendWith(flat, idx, 1);
+        }
+        codes[idx] = iter->second;
+    }
+    if (dictionary->Size() == 0) {
+        return nullptr;
+    }
+
+    auto encoded = MakeShared<ColumnVector>(flat.data_type_);
+    encoded->InitializeDictionary(std::move(dictionary), flat.capacity_);
+    encoded->AppendDictionaryCodes(codes.data(), row_count);
+    encoded->nulls_ptr_->DeepCopy(*flat.nulls_ptr_);
+    return encoded;
+}
+
+SharedPtr<ColumnVector> ColumnVector::Flatten() const {
+    if (vector_type_ != ColumnVectorType::kDictionary) {
+        UnrecoverableError("Only the column vector with dictionary can be flattened.");
+    }
+    auto flat = MakeShared<ColumnVector>(data_type_);
+    flat->Initialize(ColumnVectorType::kFlat, capacity_);
+    const u32 *codes = dictionary_codes();
+    if (data_type_->type() == LogicalType::kVarchar) {
+        for (SizeT idx = 0; idx < tail_index_; ++idx) {
+            flat->AppendWith(*dictionary_, codes[idx], 1);
+        }
+    } else {
+        for (SizeT idx = 0; idx < tail_index_; ++idx) {
+            std::memcpy(flat->data_ptr_ + idx * data_type_size_, dictionary_->data_ptr_ + codes[idx] * data_type_size_, data_type_size_);
+        }
+        flat->tail_index_ = tail_index_;
+    }
+    flat->nulls_ptr_->DeepCopy(*nulls_ptr_);
+    return flat;
+}
+
 void ColumnVector::CopyRow(const ColumnVector &other, SizeT dst_idx, SizeT src_idx) {
     if (!initialized) {
         UnrecoverableError("Column vector isn't initialized.");
     }
+    if (other.vector_type_ == ColumnVectorType::kDictionary) {
+        if (src_idx >= other.tail_index_) {
+            UnrecoverableError("Attempting to access invalid position of source column vector");
+        }
+        return CopyRow(*other.dictionary_, dst_idx, other.dictionary_codes()[src_idx]);
+    }
     if (data_type_->type() == LogicalType::kInvalid) {
         UnrecoverableError("Data type isn't assigned.");
     }
@@ -582,6 +732,9 @@ String ColumnVector::ToString(SizeT row_index) const {
     if (!(this->nulls_ptr_->IsTrue(row_index))) {
         return "null";
     }
+    if (vector_type_ == ColumnVectorType::kDictionary) {
+        return dictionary_->ToString(dictionary_codes()[row_index]);
+    }
 
     switch (data_type_->type()) {
         case kBoolean: {
@@ -714,6 +867,9 @@ Value ColumnVector::GetValue(SizeT index) const {
     if (!(this->nulls_ptr_->IsTrue(index))) {
         return Value::MakeValue(*this->data_type_);
     }
+    if (vector_type_ == ColumnVectorType::kDictionary) {
+        return dictionary_->GetValue(dictionary_codes()[index]);
+    }
 
     switch (data_type_->type()) {
 
@@ -1167,31 +1323,23 @@ void ColumnVector::AppendByPtr(const_ptr_t value_ptr) {
     }
 }
 
-namespace {
-Vector<std::string_view> SplitArrayElement(std::string_view data, char delimiter) {
-    SizeT data_size = data.size();
-    if (data_size < 2 || data[0] != '[' || data[data_size - 1] != ']') {
-        RecoverableError(Status::ImportFileFormatError("Embedding data must be surrounded by [ and ]"));
+void ColumnVector::AppendRaw(const_ptr_t data, SizeT count) {
+    if (!initialized) {
+        UnrecoverableError("Column vector isn't initialized.");
     }
-    Vector<std::string_view> ret;
-    SizeT i = 1, j = 1;
-    while (true) {
-        if (data[i] == delimiter || data[i] == ' ' || i == data_size - 1) {
-            if (i > j) {
-                ret.emplace_back(data.begin() + j, data.begin() + i);
-            }
-            j = i + 1;
-        }
-        if (i == data_size - 1) {
-            break;
-        }
-        i++;
+    if (vector_type_ != ColumnVectorType::kFlat) {
+        UnrecoverableError("Only flat column vector can append raw data.");
+    }
+    if (data_type_->type() == LogicalType::kBoolean || data_type_->type() == LogicalType::kVarchar) {
+        UnrecoverableError(fmt::format("Can't append raw data to a {} column vector.", data_type_->ToString()));
     }
-    return ret;
+    if (tail_index_ + count > capacity_) {
+        UnrecoverableError(fmt::format("Exceed the column vector capacity.({}/{})", tail_index_ + count, capacity_));
+    }
+    std::memcpy(data_ptr_ + tail_index_ * data_type_size_, data, count * data_type_size_);
+    tail_index_ += count;
 }
 
-} // namespace
-
 void ColumnVector::AppendByStringView(std::string_view sv, char delimiter) {
     SizeT index = tail_index_++;
     switch (data_type_->type()) {
@@ -1240,45 +1388,7 @@ void ColumnVector::AppendByStringView(std::string_view sv, char delimiter) {
             break;
         }
         case kEmbedding: {
-            auto embedding_info = static_cast<EmbeddingInfo *>(data_type_->type_info().get());
-            Vector<std::string_view> ele_str_views = SplitArrayElement(sv, delimiter);
-            if (embedding_info->Dimension() < ele_str_views.size()) {
-                RecoverableError(Status::ImportFileFormatError("Embedding data size exceeds dimension."));
-            }
-            SizeT dst_off = index * data_type_->Size();
-            switch (embedding_info->Type()) {
-                case kElemBit: {
-                    RecoverableError(Status::NotSupport("Not implemented"));
-                    break;
-                }
-                case kElemInt8: {
-                    AppendEmbedding<TinyIntT>(ele_str_views, dst_off);
-                    break;
-                }
-                case kElemInt16: {
-                    AppendEmbedding<SmallIntT>(ele_str_views, dst_off);
-                    break;
-                }
-                case kElemInt32: {
-                    AppendEmbedding<IntegerT>(ele_str_views, dst_off);
-                    break;
-                }
-                case kElemInt64: {
-                    AppendEmbedding<BigIntT>(ele_str_views, dst_off);
-                    break;
-                }
-                case kElemFloat: {
-                    AppendEmbedding<FloatT>(ele_str_views, dst_off);
-                    break;
-                }
-                case kElemDouble: {
-                    AppendEmbedding<DoubleT>(ele_str_views, dst_off);
-                    break;
-                }
-                default: {
-                    UnrecoverableError("Invalid embedding type");
-                }
-            }
+            AppendEmbeddings(&sv, 1, delimiter, index);
             break;
         }
         case kVarchar: {
@@ -1301,6 +1411,95 @@ void ColumnVector::AppendByStringView(std::string_view sv, char delimiter) {
     }
 }
 
+template <typename T>
+void ColumnVector::ParseEmbeddings(const std::string_view *svs, SizeT count, char delimiter, SizeT index) {
+    SizeT dimension = static_cast<EmbeddingInfo *>(data_type_->type_info().get())->Dimension();
+    T *dst = reinterpret_cast<T *>(data_ptr_) + index * dimension;
+    for (SizeT i = 0; i < count; ++i, dst += dimension) {
+        i64 element_count = ParseEmbedding(svs[i], delimiter, dst, dimension);
+        if (element_count < 0) {
+            RecoverableError(Status::ImportFileFormatError(fmt::format("Invalid embedding data of dimension {}: {}", dimension, svs[i])));
+        }
+        std::fill(dst + element_count, dst + dimension, T{});
+    }
+}
+
+void ColumnVector::AppendEmbeddings(const std::string_view *svs, SizeT count, char delimiter, SizeT index) {
+    auto embedding_info = static_cast<EmbeddingInfo *>(data_type_->type_info().get());
+    switch (embedding_info->Type()) {
+        case kElemInt8: {
+            ParseEmbeddings<TinyIntT>(svs, count, delimiter, index);
+            break;
+        }
+        case kElemInt16: {
+            ParseEmbeddings<SmallIntT>(svs, count, delimiter, index);
+            break;
+        }
+        case kElemInt32: {
+            ParseEmbeddings<IntegerT>(svs, count, delimiter, index);
+            break;
+        }
+        case kElemInt64: {
+            ParseEmbeddings<BigIntT>(svs, count, delimiter, index);
+            break;
+        }
+        case kElemFloat: {
+            ParseEmbeddings<FloatT>(svs, count, delimiter, index);
+            break;
+        }
+        case kElemDouble: {
+            ParseEmbeddings<DoubleT>(svs, count, delimiter, index);
+            break;
+        }
+        case kElemBit: {
+            RecoverableError(Status::NotSupport("Not implemented"));
+            break;
+        }
+        default: {
+            UnrecoverableError("Invalid embedding type");
+        }
+    }
+}
+
+void ColumnVector::AppendByStringViews(const Vector<std::string_view> &svs, char delimiter) {
+    switch (data_type_->type()) {
+        case kTinyInt: {
+            AppendFromStrings<TinyIntT>(svs);
+            break;
+        }
+        case kSmallInt: {
+            AppendFromStrings<SmallIntT>(svs);
+            break;
+        }
+        case kInteger: {
+            AppendFromStrings<IntegerT>(svs);
+            break;
+        }
+        case kBigInt: {
+            AppendFromStrings<BigIntT>(svs);
+            break;
+        }
+        case kFloat: {
+            AppendFromStrings<FloatT>(svs);
+            break;
+        }
+        case kDouble: {
+            AppendFromStrings<DoubleT>(svs);
+            break;
+        }
+        case kEmbedding: {
+            AppendEmbeddings(svs.data(), svs.size(), delimiter, tail_index_);
+            tail_index_ += svs.size();
+            break;
+        }
+        default: {
+            for (std::string_view sv : svs) {
+                AppendByStringView(sv, delimiter);
+            }
+        }
+    }
+}
+
 void ColumnVector::AppendWith(const ColumnVector &other, SizeT from, SizeT count) {
     if (count == 0) {
         return;
@@ -1315,6 +1514,20 @@ void ColumnVector::AppendWith(const ColumnVector &other, SizeT from, SizeT count
             fmt::format("Attempt to append {} rows data to {} rows data, which exceeds {} limit.", count, this->tail_index_, this->capacity_));
     }
 
+    if (other.vector_type_ == ColumnVectorType::kDictionary) {
+        if (this->vector_type_ == ColumnVectorType::kDictionary && this->dictionary_ == other.dictionary_) {
+            return AppendDictionaryCodes(other.dictionary_codes() + from, count);
+        }
+        const u32 *codes = other.dictionary_codes();
+        for (SizeT idx = 0; idx < count; ++idx) {
+            AppendWith(*other.dictionary_, codes[from + idx], 1);
+        }
+        return;
+    }
+    if (this->vector_type_ == ColumnVectorType::kDictionary) {
+        UnrecoverableError("Attempt to append values to a column vector with dictionary.");
+    }
+
     switch (data_type_->type()) {
         case kBoolean: {
             CopyValue<BooleanT>(*this, other, from, count);
@@ -1503,9 +1716,16 @@ void ColumnVector::ShallowCopy(const ColumnVector &other) {
     this->initialized = other.initialized;
     this->capacity_ = other.capacity_;
     this->tail_index_ = other.tail_index_;
+    this->dictionary_ = other.dictionary_;
 }
 
 void ColumnVector::Reset() {
+    // 0. The buffer of the codes can't hold the values, it is dropped with the dictionary.
+    if (vector_type_ == ColumnVectorType::kDictionary) {
+        buffer_.reset();
+        dictionary_.reset();
+    }
+
     // 1. Vector type is reset to invalid.
     vector_type_ = ColumnVectorType::kInvalid;
 
@@ -1585,6 +1805,9 @@ i32 ColumnVector::GetSizeInBytes() const {
     if (!initialized) {
         UnrecoverableError("Column vector isn't initialized.");
     }
+    if (vector_type_ == ColumnVectorType::kDictionary) {
+        return Flatten()->GetSizeInBytes();
+    }
     if (vector_type_ != ColumnVectorType::kFlat && vector_type_ != ColumnVectorType::kConstant && vector_type_ != ColumnVectorType::kCompactBit) {
         UnrecoverableError(fmt::format("Not supported vector_type {}", int(vector_type_)));
     }
@@ -1606,6 +1829,9 @@ void ColumnVector::WriteAdv(char *&ptr) const {
     if (!initialized) {
         UnrecoverableError("Column vector isn't initialized.");
     }
+    if (vector_type_ == ColumnVectorType::kDictionary) {
+        return Flatten()->WriteAdv(ptr);
+    }
     if (vector_type_ != ColumnVectorType::kFlat && vector_type_ != ColumnVectorType::kConstant && vector_type_ != ColumnVectorType::kCompactBit) {
         UnrecoverableError(fmt::format("Not supported vector_type {}", int(vector_type_)));
     }
@@ -43,7 +43,7 @@ export enum class ColumnVectorType : i8 {
     kFlat,          // Stand without any encode
     kConstant,      // All vector has same type and value
     kCompactBit,    // Compact bit encoding
-                    //    kDictionary, // There is a dictionary zone
+    kDictionary,    // A u32 code of each row into a kFlat vector of the distinct values
                     //    kRLE, // Run length encoding
                     //    kSequence,
                     //    kBias,
@@ -81,6 +81,9 @@ private:
 
     SizeT tail_index_{0};
 
+    // The distinct values of a kDictionary vector
+    SharedPtr<ColumnVector> dictionary_{nullptr};
+
 public:
     // Construct a column vector without initialization;
     explicit ColumnVector(SharedPtr<DataType> data_type) : vector_type_(ColumnVectorType::kInvalid), data_type_(std::move(data_type)) {
@@ -93,7 +96,7 @@ public:
     ColumnVector(const ColumnVector &right)
         : data_type_size_(right.data_type_size_), buffer_(right.buffer_), nulls_ptr_(right.nulls_ptr_), initialized(right.initialized),
           vector_type_(right.vector_type_), data_type_(right.data_type_), data_ptr_(right.data_ptr_), capacity_(right.capacity_),
-          tail_index_(right.tail_index_) {
+          tail_index_(right.tail_index_), dictionary_(right.dictionary_) {
 #ifdef INFINITY_DEBUG
         GlobalResourceUsage::IncrObjectCount("ColumnVector");
 #endif
@@ -103,7 +106,7 @@ public:
     ColumnVector(ColumnVector &&right)
         : data_type_size_(right.data_type_size_), buffer_(std::move(right.buffer_)), nulls_ptr_(std::move(right.nulls_ptr_)),
           initialized(right.initialized), vector_type_(right.vector_type_), data_type_(std::move(right.data_type_)), data_ptr_(right.data_ptr_),
-          capacity_(right.capacity_), tail_index_(right.tail_index_) {
+          capacity_(right.capacity_), tail_index_(right.tail_index_), dictionary_(std::move(right.dictionary_)) {
 #ifdef INFINITY_DEBUG
         GlobalResourceUsage::IncrObjectCount("ColumnVector");
 #endif
@@ -174,6 +177,22 @@ public:
 
     void Initialize(const ColumnVector &other, SizeT start_idx, SizeT end_idx) { Initialize(other.vector_type_, other, start_idx, end_idx); }
 
+    // Initialize a kDictionary vector of the values of the kFlat dictionary, the codes are appended by AppendDictionaryCodes.
+    void InitializeDictionary(SharedPtr<ColumnVector> dictionary, SizeT capacity = DEFAULT_VECTOR_SIZE);
+
+    // Encode the rows of a kFlat vector with a dictionary.
+    // Return nullptr if the type can't be encoded, or the rows have no value or more than max_dictionary_size distinct values.
+    static SharedPtr<ColumnVector> DictionaryEncode(const ColumnVector &flat, SizeT max_dictionary_size);
+
+    // The kFlat vector of the values of this kDictionary vector, with the same nulls.
+    SharedPtr<ColumnVector> Flatten() const;
+
+    [[nodiscard]] const SharedPtr<ColumnVector> &dictionary() const { return dictionary_; }
+
+    [[nodiscard]] const u32 *dictionary_codes() const { return reinterpret_cast<const u32 *>(data_ptr_); }
+
+    void AppendDictionaryCodes(const u32 *codes, SizeT count);
+
     String ToString(SizeT row_index) const;
 
     // Return the <index> of the vector
@@ -188,8 +207,14 @@ public:
 
     void AppendByPtr(const_ptr_t value_ptr);
 
+    // Append count values of a fixed size type in its binary layout with one copy, not for boolean or varchar.
+    void AppendRaw(const_ptr_t data, SizeT count);
+
     void AppendByStringView(std::string_view sv, char delimiter);
 
+    // Appends the strings of a batch of rows, the type is dispatched once for the batch.
+    void AppendByStringViews(const Vector<std::string_view> &svs, char delimiter);
+
     void AppendWith(const ColumnVector &other, SizeT start_row, SizeT count);
 
     // input parameter:
@@ -230,13 +255,19 @@ private:
         }
     }
 
+    // Parses the embedding strings of count rows into the rows from index on, the element type is dispatched once.
+    void AppendEmbeddings(const std::string_view *svs, SizeT count, char delimiter, SizeT index);
+
     template <typename T>
-    void AppendEmbedding(const Vector<std::string_view> &ele_str_views, SizeT dst_off) {
-        for (SizeT i = 0; auto &ele_str_view : ele_str_views) {
-            T value = DataType::StringToValue<T>(ele_str_view);
-            ((T *)(data_ptr_ + dst_off))[i] = value;
-            ++i;
+    void ParseEmbeddings(const std::string_view *svs, SizeT count, char delimiter, SizeT index);
+
+    template <typename T>
+    void AppendFromStrings(const Vector<std::string_view> &svs) {
+        T *data = reinterpret_cast<T *>(data_ptr_) + tail_index_;
+        for (SizeT i = 0; i < svs.size(); ++i) {
+            data[i] = DataType::StringToValue<T>(svs[i]);
         }
+        tail_index_ += svs.size();
     }
 
     // Used by Append by Ptr
@@ -833,12 +864,43 @@ public:
         return *this;
     }
     auto &operator[](u32 index) { return SetIndex(index); }
+    u32 GetLength() const { return data_ptr_[idx_].length_; }
+    // The chars kept in the VarcharT itself: a short value as a whole, or the prefix of a long value.
+    std::string_view GetInlineView() const {
+        const VarcharT &value = data_ptr_[idx_];
+        return {value.short_.data_, value.IsInlined() ? value.length_ : VARCHAR_PREFIX_LEN};
+    }
+    void GetString(String &buffer) const {
+        const VarcharT &value = data_ptr_[idx_];
+        buffer.resize(value.length_);
+        if (value.IsInlined()) {
+            std::memcpy(buffer.data(), value.short_.data_, value.length_);
+            return;
+        }
+        auto char_iterator = fix_heap_mgr_->GetNextCharIterator(value);
+        for (u32 i = 0; i < value.length_; ++i) {
+            buffer[i] = char_iterator.GetNextChar();
+        }
+    }
     // Does not check type.
+    // A short value is inlined and a long value keeps its first VARCHAR_PREFIX_LEN chars inline at the same place,
+    // so the heap is only read when the inline chars tie.
     friend std::strong_ordering ThreeWayCompareReaderValue(const IteratorType &left, const IteratorType &right) {
         const VarcharT &left_value = left.data_ptr_[left.idx_];
         const VarcharT &right_value = right.data_ptr_[right.idx_];
         auto left_length = static_cast<u32>(left_value.length_);
         auto right_length = static_cast<u32>(right_value.length_);
+        u32 common_length = std::min(left_length, right_length);
+        u32 inline_length = common_length;
+        if (!left_value.IsInlined() || !right_value.IsInlined()) {
+            inline_length = std::min<u32>(inline_length, VARCHAR_PREFIX_LEN);
+        }
+        if (auto cmp = CompareCharArray(left_value.short_.data_, right_value.short_.data_, inline_length); cmp != std::strong_ordering::equal) {
+            return cmp;
+        }
+        if (inline_length == common_length) {
+            return left_length <=> right_length;
+        }
         auto left_char_iterator = left.fix_heap_mgr_->GetNextCharIterator(left_value);
         auto right_char_iterator = right.fix_heap_mgr_->GetNextCharIterator(right_value);
         return CompareCharArray(left_char_iterator, left_length, right_char_iterator, right_length);
@@ -851,6 +913,13 @@ public:
         if (left_length != right_length) {
             return false;
         }
+        // Values of the same length are either both inlined or both long.
+        if (left_value.IsInlined()) {
+            return std::memcmp(left_value.short_.data_, right_value.short_.data_, left_length) == 0;
+        }
+        if (std::memcmp(left_value.vector_.prefix_, right_value.vector_.prefix_, VARCHAR_PREFIX_LEN) != 0) {
+            return false;
+        }
         auto left_char_iterator = left.fix_heap_mgr_->GetNextCharIterator(left_value);
         auto right_char_iterator = right.fix_heap_mgr_->GetNextCharIterator(right_value);
         for (u32 i = 0; i < left_length; ++i) {
@@ -877,6 +946,14 @@ private:
         }
         return left_len <=> right_len;
     }
+    static std::strong_ordering CompareCharArray(const char *left, const char *right, u32 len) {
+        for (u32 i = 0; i < len; ++i) {
+            if (left[i] != right[i]) {
+                return left[i] <=> right[i];
+            }
+        }
+        return std::strong_ordering::equal;
+    }
 };
 
 // BooleanColumnWriter does not check null, range and type.
@@ -66,6 +66,7 @@ VectorHeapChunk FixHeapManager::AllocateChunk() {
         auto file_worker = MakeUnique<DataFileWorker>(block_column_entry_->base_dir(),
                                                       block_column_entry_->OutlineFilename(current_chunk_idx_),
                                                       current_chunk_size_);
+        file_worker->SetTableIOStats(block_column_entry_->table_io_stats());
         auto *buffer_obj = buffer_mgr_->Allocate(std::move(file_worker));
         block_column_entry_->AppendOutlineBuffer(buffer_obj);
         return VectorHeapChunk(buffer_obj);
@@ -116,6 +117,7 @@ VectorHeapChunk &FixHeapManager::ReadChunk(ChunkId chunk_id) {
         auto filename = block_column_entry_->OutlineFilename(chunk_id);
         auto base_dir = block_column_entry_->base_dir();
         auto file_worker = MakeUnique<DataFileWorker>(base_dir, filename, current_chunk_size_);
+        file_worker->SetTableIOStats(block_column_entry_->table_io_stats());
         outline_buffer = buffer_mgr_->Get(std::move(file_worker));
 
         if (outline_buffer == nullptr) {
@@ -46,11 +46,15 @@ public:
         auto left_vector_type = left->vector_type();
         auto right_vector_type = right->vector_type();
         auto check_vector_type_valid = [](ColumnVectorType vector_type) {
-            // only support kFlat and kConstant
-            return vector_type == ColumnVectorType::kFlat || vector_type == ColumnVectorType::kConstant;
+            // only support kFlat, kConstant and kDictionary
+            return vector_type == ColumnVectorType::kFlat || vector_type == ColumnVectorType::kConstant ||
+                   vector_type == ColumnVectorType::kDictionary;
         };
         if (!check_vector_type_valid(left_vector_type) || !check_vector_type_valid(right_vector_type)) {
-            UnrecoverableError("Invalid input ColumnVectorType. Support only kFlat and kConstant.");
+            UnrecoverableError("Invalid input ColumnVectorType. Support only kFlat, kConstant and kDictionary.");
+        }
+        if (left_vector_type == ColumnVectorType::kDictionary || right_vector_type == ColumnVectorType::kDictionary) {
+            return ExecuteDictionary(left, right, result, count, state_ptr, nullable);
         }
         const SharedPtr<Bitmask> &left_null = left->nulls_ptr_;
         const SharedPtr<Bitmask> &right_null = right->nulls_ptr_;
@@ -69,11 +73,22 @@ public:
         } else if (left_vector_type == ColumnVectorType::kFlat && right_vector_type == ColumnVectorType::kFlat) {
             if (!nullable || (left_null->IsAllTrue() && right_null->IsAllTrue())) {
                 result_null->SetAllTrue();
-                auto left_ptr = ColumnValueReader<LeftType>(left);
-                auto right_ptr = ColumnValueReader<RightType>(right);
-                BooleanColumnWriter result_ptr(result);
-                for (SizeT i = 0; i < count; ++i) {
-                    Operator::template Execute(left_ptr[i], right_ptr[i], result_ptr[i], result_null.get(), 0, state_ptr);
+                if constexpr (PODValueType<LeftType>) {
+                    const auto *left_data = reinterpret_cast<const LeftType *>(left->data());
+                    const auto *right_data = reinterpret_cast<const RightType *>(right->data());
+                    ExecuteValidUnits([left_data](SizeT idx) { return left_data[idx]; },
+                                      [right_data](SizeT idx) { return right_data[idx]; },
+                                      result,
+                                      0,
+                                      count,
+                                      state_ptr);
+                } else {
+                    auto left_ptr = ColumnValueReader<LeftType>(left);
+                    auto right_ptr = ColumnValueReader<RightType>(right);
+                    BooleanColumnWriter result_ptr(result);
+                    for (SizeT i = 0; i < count; ++i) {
+                        Operator::template Execute(left_ptr[i], right_ptr[i], result_ptr[i], result_null.get(), 0, state_ptr);
+                    }
                 }
             } else {
                 ResultBooleanExecuteWithNull(left, right, result, count, state_ptr);
@@ -85,10 +100,20 @@ public:
                 result_null->SetAllFalse();
             } else if (!nullable || (left_null->IsAllTrue() && right_null->IsAllTrue())) {
                 result_null->SetAllTrue();
-                auto right_ptr = ColumnValueReader<RightType>(right);
-                BooleanColumnWriter result_ptr(result);
-                for (SizeT i = 0; i < count; ++i) {
-                    Operator::template Execute(left_c, right_ptr[i], result_ptr[i], result_null.get(), 0, state_ptr);
+                if constexpr (PODValueType<LeftType>) {
+                    const auto *right_data = reinterpret_cast<const RightType *>(right->data());
+                    ExecuteValidUnits([left_c](SizeT) { return left_c; },
+                                      [right_data](SizeT idx) { return right_data[idx]; },
+                                      result,
+                                      0,
+                                      count,
+                                      state_ptr);
+                } else {
+                    auto right_ptr = ColumnValueReader<RightType>(right);
+                    BooleanColumnWriter result_ptr(result);
+                    for (SizeT i = 0; i < count; ++i) {
+                        Operator::template Execute(left_c, right_ptr[i], result_ptr[i], result_null.get(), 0, state_ptr);
+                    }
                 }
             } else {
                 ResultBooleanExecuteWithNull(left_c, right, result, count, state_ptr);
@@ -100,10 +125,20 @@ public:
                 result_null->SetAllFalse();
             } else if (!nullable || (left_null->IsAllTrue() && right_null->IsAllTrue())) {
                 result_null->SetAllTrue();
-                auto left_ptr = ColumnValueReader<LeftType>(left);
-                BooleanColumnWriter result_ptr(result);
-                for (SizeT i = 0; i < count; ++i) {
-                    Operator::template Execute(left_ptr[i], right_c, result_ptr[i], result_null.get(), 0, state_ptr);
+                if constexpr (PODValueType<LeftType>) {
+                    const auto *left_data = reinterpret_cast<const LeftType *>(left->data());
+                    ExecuteValidUnits([left_data](SizeT idx) { return left_data[idx]; },
+                                      [right_c](SizeT) { return right_c; },
+                                      result,
+                                      0,
+                                      count,
+                                      state_ptr);
+                } else {
+                    auto left_ptr = ColumnValueReader<LeftType>(left);
+                    BooleanColumnWriter result_ptr(result);
+                    for (SizeT i = 0; i < count; ++i) {
+                        Operator::template Execute(left_ptr[i], right_c, result_ptr[i], result_null.get(), 0, state_ptr);
+                    }
                 }
             } else {
                 ResultBooleanExecuteWithNull(left, right_c, result, count, state_ptr);
@@ -113,6 +148,105 @@ public:
     }
 
 private:
+    // Takes the result of one row, so that the results of a unit are written to the compact bits at once.
+    struct UnitResultBit {
+        u8 value_;
+        void SetValue(bool value) { value_ = value; }
+    };
+
+    // Rows [start_index, end_index) are all valid and start_index is at a unit boundary.
+    // Per unit, the rows are compared into bytes and the bytes are packed into one word. Both loops have neither
+    // branches nor read-modify-writes of the result buffer, so compilers vectorize them for the numeric types.
+    static inline void
+    ExecuteValidUnits(auto &&get_left, auto &&get_right, SharedPtr<ColumnVector> &result, SizeT start_index, SizeT end_index, void *state_ptr) {
+        static_assert(BitmaskBuffer::UNIT_BITS == 64, "static_assert: BitmaskBuffer::UNIT_BITS == 64");
+        auto result_u8 = reinterpret_cast<u8 *>(result->data());
+        UnitResultBit unit_results[BitmaskBuffer::UNIT_BITS];
+        for (SizeT unit_start = start_index; unit_start < end_index; unit_start += BitmaskBuffer::UNIT_BITS) {
+            const SizeT unit_rows = std::min<SizeT>(BitmaskBuffer::UNIT_BITS, end_index - unit_start);
+            for (SizeT j = 0; j < unit_rows; ++j) {
+                Operator::template Execute(get_left(unit_start + j), get_right(unit_start + j), unit_results[j], nullptr, 0, state_ptr);
+            }
+            u64 unit_word = 0;
+            for (SizeT j = 0; j < unit_rows; ++j) {
+                unit_word |= u64(unit_results[j].value_) << j;
+            }
+            WriteUnitWord(result_u8, unit_start, unit_rows, unit_word);
+        }
+    }
+
+    // Writes the bits of the first unit_rows rows of a unit, the bits after them are kept.
+    static inline void WriteUnitWord(u8 *result_u8, SizeT unit_start, SizeT unit_rows, u64 unit_word) {
+        u8 *unit_u8 = result_u8 + unit_start / 8;
+        const SizeT full_bytes = unit_rows / 8;
+        for (SizeT b = 0; b < full_bytes; ++b) {
+            unit_u8[b] = u8(unit_word >> (b * 8));
+        }
+        if (const SizeT tail = unit_rows % 8; tail > 0) {
+            const u8 keep_mask = u8(0xff) << tail;
+            unit_u8[full_bytes] = (unit_u8[full_bytes] & keep_mask) | (u8(unit_word >> (full_bytes * 8)) & ~keep_mask);
+        }
+    }
+
+    // A dictionary compared with a constant is compared once for each value of the dictionary, and the rows take the
+    // result of their code. Otherwise the dictionary is flattened.
+    static inline void ExecuteDictionary(const SharedPtr<ColumnVector> &left,
+                                         const SharedPtr<ColumnVector> &right,
+                                         SharedPtr<ColumnVector> &result,
+                                         SizeT count,
+                                         void *state_ptr,
+                                         bool nullable) {
+        const bool left_dictionary = left->vector_type() == ColumnVectorType::kDictionary;
+        const SharedPtr<ColumnVector> &encoded = left_dictionary ? left : right;
+        const SharedPtr<ColumnVector> &other = left_dictionary ? right : left;
+        if (other->vector_type() != ColumnVectorType::kConstant) {
+            return Execute(left_dictionary ? left->Flatten() : left,
+                           right->vector_type() == ColumnVectorType::kDictionary ? right->Flatten() : right,
+                           result,
+                           count,
+                           state_ptr,
+                           nullable);
+        }
+
+        const SharedPtr<ColumnVector> &dictionary = encoded->dictionary();
+        SizeT dictionary_size = dictionary->Size();
+        auto dictionary_result = MakeShared<ColumnVector>(result->data_type());
+        dictionary_result->Initialize(ColumnVectorType::kCompactBit, dictionary_size);
+        if (left_dictionary) {
+            Execute(dictionary, other, dictionary_result, dictionary_size, state_ptr, nullable);
+        } else {
+            Execute(other, dictionary, dictionary_result, dictionary_size, state_ptr, nullable);
+        }
+
+        SharedPtr<Bitmask> &result_null = result->nulls_ptr_;
+        if (!dictionary_result->nulls_ptr_->IsAllTrue()) {
+            // the constant is null
+            result_null->SetAllFalse();
+            result->Finalize(count);
+            return;
+        }
+        if (nullable) {
+            result_null->DeepCopy(*(encoded->nulls_ptr_));
+        } else {
+            result_null->SetAllTrue();
+        }
+        Vector<u8> dictionary_bits(dictionary_size);
+        for (SizeT idx = 0; idx < dictionary_size; ++idx) {
+            dictionary_bits[idx] = dictionary_result->buffer_->GetCompactBit(idx);
+        }
+        const u32 *codes = encoded->dictionary_codes();
+        auto result_u8 = reinterpret_cast<u8 *>(result->data());
+        for (SizeT unit_start = 0; unit_start < count; unit_start += BitmaskBuffer::UNIT_BITS) {
+            const SizeT unit_rows = std::min<SizeT>(BitmaskBuffer::UNIT_BITS, count - unit_start);
+            u64 unit_word = 0;
+            for (SizeT j = 0; j < unit_rows; ++j) {
+                unit_word |= u64(dictionary_bits[codes[unit_start + j]]) << j;
+            }
+            WriteUnitWord(result_u8, unit_start, unit_rows, unit_word);
+        }
+        result->Finalize(count);
+    }
+
     static inline void ResultBooleanExecuteWithNull(const SharedPtr<ColumnVector> &left,
                                                     const SharedPtr<ColumnVector> &right,
                                                     SharedPtr<ColumnVector> &result,
@@ -141,8 +275,17 @@ private:
             end_index = std::min(end_index, count);
             if (result_null_data[i] == BitmaskBuffer::UNIT_MAX) {
                 // all data of 64 rows are not null
-                for (SizeT b = start_index; b < end_index; ++b) {
-                    Operator::template Execute(left_ptr[b], right_ptr[b], result_ptr[b], result_null.get(), 0, state_ptr);
+                if constexpr (PODValueType<LeftType>) {
+                    ExecuteValidUnits([&left_ptr](SizeT idx) { return left_ptr[idx]; },
+                                      [&right_ptr](SizeT idx) { return right_ptr[idx]; },
+                                      result,
+                                      start_index,
+                                      end_index,
+                                      state_ptr);
+                } else {
+                    for (SizeT b = start_index; b < end_index; ++b) {
+                        Operator::template Execute(left_ptr[b], right_ptr[b], result_ptr[b], result_null.get(), 0, state_ptr);
+                    }
                 }
                 start_index = end_index;
             } else if (result_null_data[i] == BitmaskBuffer::UNIT_MIN) {
@@ -183,8 +326,17 @@ private:
             end_index = std::min(end_index, count);
             if (result_null_data[i] == BitmaskBuffer::UNIT_MAX) {
                 // all data of 64 rows are not null
-                for (SizeT b = start_index; b < end_index; ++b) {
-                    Operator::template Execute(left_constant, right_ptr[b], result_ptr[b], result_null.get(), 0, state_ptr);
+                if constexpr (PODValueType<LeftType>) {
+                    ExecuteValidUnits([left_constant](SizeT) { return left_constant; },
+                                      [&right_ptr](SizeT idx) { return right_ptr[idx]; },
+                                      result,
+                                      start_index,
+                                      end_index,
+                                      state_ptr);
+                } else {
+                    for (SizeT b = start_index; b < end_index; ++b) {
+                        Operator::template Execute(left_constant, right_ptr[b], result_ptr[b], result_null.get(), 0, state_ptr);
+                    }
                 }
                 start_index = end_index;
             } else if (result_null_data[i] == BitmaskBuffer::UNIT_MIN) {
@@ -225,8 +377,17 @@ private:
             end_index = std::min(end_index, count);
             if (result_null_data[i] == BitmaskBuffer::UNIT_MAX) {
                 // all data of 64 rows are not null
-                for (SizeT b = start_index; b < end_index; ++b) {
-                    Operator::template Execute(left_ptr[b], right_constant, result_ptr[b], result_null.get(), 0, state_ptr);
+                if constexpr (PODValueType<LeftType>) {
+                    ExecuteValidUnits([&left_ptr](SizeT idx) { return left_ptr[idx]; },
+                                      [right_constant](SizeT) { return right_constant; },
+                                      result,
+                                      start_index,
+                                      end_index,
+                                      state_ptr);
+                } else {
+                    for (SizeT b = start_index; b < end_index; ++b) {
+                        Operator::template Execute(left_ptr[b], right_constant, result_ptr[b], result_null.get(), 0, state_ptr);
+                    }
                 }
                 start_index = end_index;
             } else if (result_null_data[i] == BitmaskBuffer::UNIT_MIN) {
@@ -569,6 +730,9 @@ public:
             case ColumnVectorType::kHeterogeneous: {
                 return ExecuteHeterogeneous<LeftType, RightType, ResultType, Operator>(left, right, result, count, state_ptr, nullable);
             }
+            case ColumnVectorType::kDictionary: {
+                return Execute<LeftType, RightType, ResultType, Operator>(left->Flatten(), right, result, count, state_ptr, nullable);
+            }
         }
     }
 
@@ -597,6 +761,9 @@ private:
             case ColumnVectorType::kCompactBit: {
                 UnrecoverableError("CompactBit isn't implemented.");
             }
+            case ColumnVectorType::kDictionary: {
+                return Execute<LeftType, RightType, ResultType, Operator>(left, right->Flatten(), result, count, state_ptr, nullable);
+            }
         }
     }
 
@@ -623,6 +790,9 @@ private:
             case ColumnVectorType::kCompactBit: {
                 UnrecoverableError("CompactBit isn't implemented.");
             }
+            case ColumnVectorType::kDictionary: {
+                return Execute<LeftType, RightType, ResultType, Operator>(left, right->Flatten(), result, count, state_ptr, nullable);
+            }
         }
     }
 
@@ -649,6 +819,9 @@ private:
             case ColumnVectorType::kCompactBit: {
                 UnrecoverableError("CompactBit isn't implemented.");
             }
+            case ColumnVectorType::kDictionary: {
+                return Execute<LeftType, RightType, ResultType, Operator>(left, right->Flatten(), result, count, state_ptr, nullable);
+            }
         }
     }
 
@@ -662,9 +835,9 @@ private:
                                        void *state_ptr,
                                        bool nullable) {
 
-        const auto *left_ptr = (const LeftType *)(left->data());
-        const auto *right_ptr = (const RightType *)(right->data());
-        auto *result_ptr = (ResultType *)(result->data());
+        const auto *__restrict left_ptr = (const LeftType *)(left->data());
+        const auto *__restrict right_ptr = (const RightType *)(right->data());
+        auto *__restrict result_ptr = (ResultType *)(result->data());
         SharedPtr<Bitmask> &result_null = result->nulls_ptr_;
 
         if (nullable) {
@@ -735,6 +908,7 @@ private:
         const u64 *result_null_data = result_null->GetData();
         SizeT unit_count = BitmaskBuffer::UnitCount(count);
         for (SizeT i = 0, start_index = 0, end_index = BitmaskBuffer::UNIT_BITS; i < unit_count; ++i, end_index += BitmaskBuffer::UNIT_BITS) {
+            end_index = std::min(end_index, count);
             if (result_null_data[i] == BitmaskBuffer::UNIT_MAX) {
                 // all data of 64 rows are not null
                 while (start_index < end_index) {
@@ -748,11 +922,10 @@ private:
                 }
             } else if (result_null_data[i] == BitmaskBuffer::UNIT_MIN) {
                 // all data of 64 rows are null
-                ;
+                start_index = end_index;
             } else {
-                SizeT original_start = start_index;
-                while (start_index < end_index) {
-                    if (result_null->IsTrue(start_index - original_start)) {
+                for (; start_index < end_index; ++start_index) {
+                    if (result_null->IsTrue(start_index)) {
                         // This row isn't null
                         Operator::template Execute<LeftType, RightType, ResultType>(left_ptr[start_index],
                                                                                     right_ptr[start_index],
@@ -760,7 +933,6 @@ private:
                                                                                     result_null.get(),
                                                                                     start_index,
                                                                                     state_ptr);
-                        ++start_index;
                     }
                 }
             }
@@ -775,9 +947,9 @@ private:
                                            void *state_ptr,
                                            bool nullable) {
 
-        const auto *left_ptr = (const LeftType *)(left->data());
-        const auto *right_ptr = (const RightType *)(right->data());
-        auto *result_ptr = (ResultType *)(result->data());
+        const auto *__restrict left_ptr = (const LeftType *)(left->data());
+        const auto *__restrict right_ptr = (const RightType *)(right->data());
+        auto *__restrict result_ptr = (ResultType *)(result->data());
         SharedPtr<Bitmask> &result_null = result->nulls_ptr_;
 
         if (nullable) {
@@ -849,6 +1021,7 @@ private:
         const u64 *result_null_data = result_null->GetData();
         SizeT unit_count = BitmaskBuffer::UnitCount(count);
         for (SizeT i = 0, start_index = 0, end_index = BitmaskBuffer::UNIT_BITS; i < unit_count; ++i, end_index += BitmaskBuffer::UNIT_BITS) {
+            end_index = std::min(end_index, count);
             if (result_null_data[i] == BitmaskBuffer::UNIT_MAX) {
                 // all data of 64 rows are not null
                 while (start_index < end_index) {
@@ -862,11 +1035,10 @@ private:
                 }
             } else if (result_null_data[i] == BitmaskBuffer::UNIT_MIN) {
                 // all data of 64 rows are null
-                ;
+                start_index = end_index;
             } else {
-                SizeT original_start = start_index;
-                while (start_index < end_index) {
-                    if (result_null->IsTrue(start_index - original_start)) {
+                for (; start_index < end_index; ++start_index) {
+                    if (result_null->IsTrue(start_index)) {
                         // This row isn't null
                         Operator::template Execute<LeftType, RightType, ResultType>(left_ptr[start_index],
                                                                                     right_ptr[0],
@@ -874,7 +1046,6 @@ private:
                                                                                     result_null.get(),
                                                                                     start_index,
                                                                                     state_ptr);
-                        ++start_index;
                     }
                 }
             }
@@ -899,9 +1070,9 @@ private:
                                            void *state_ptr,
                                            bool nullable) {
 
-        const auto *left_ptr = (const LeftType *)(left->data());
-        const auto *right_ptr = (const RightType *)(right->data());
-        auto *result_ptr = (ResultType *)(result->data());
+        const auto *__restrict left_ptr = (const LeftType *)(left->data());
+        const auto *__restrict right_ptr = (const RightType *)(right->data());
+        auto *__restrict result_ptr = (ResultType *)(result->data());
         SharedPtr<Bitmask> &result_null = result->nulls_ptr_;
 
         if (nullable) {
@@ -973,6 +1144,7 @@ private:
         const u64 *result_null_data = result_null->GetData();
         SizeT unit_count = BitmaskBuffer::UnitCount(count);
         for (SizeT i = 0, start_index = 0, end_index = BitmaskBuffer::UNIT_BITS; i < unit_count; ++i, end_index += BitmaskBuffer::UNIT_BITS) {
+            end_index = std::min(end_index, count);
             if (result_null_data[i] == BitmaskBuffer::UNIT_MAX) {
                 // all data of 64 rows are not null
                 while (start_index < end_index) {
@@ -986,11 +1158,10 @@ private:
                 }
             } else if (result_null_data[i] == BitmaskBuffer::UNIT_MIN) {
                 // all data of 64 rows are null
-                ;
+                start_index = end_index;
             } else {
-                SizeT original_start = start_index;
-                while (start_index < end_index) {
-                    if (result_null->IsTrue(start_index - original_start)) {
+                for (; start_index < end_index; ++start_index) {
+                    if (result_null->IsTrue(start_index)) {
                         // This row isn't null
                         Operator::template Execute<LeftType, RightType, ResultType>(left_ptr[0],
                                                                                     right_ptr[start_index],
@@ -998,7 +1169,6 @@ private:
                                                                                     result_null.get(),
                                                                                     start_index,
                                                                                     state_ptr);
-                        ++start_index;
                     }
                 }
             }
@@ -1013,9 +1183,9 @@ private:
                                                void *state_ptr,
                                                bool nullable) {
 
-        const auto *left_ptr = (const LeftType *)(left->data());
-        const auto *right_ptr = (const RightType *)(right->data());
-        auto *result_ptr = (ResultType *)(result->data());
+        const auto *__restrict left_ptr = (const LeftType *)(left->data());
+        const auto *__restrict right_ptr = (const RightType *)(right->data());
+        auto *__restrict result_ptr = (ResultType *)(result->data());
         SharedPtr<Bitmask> &result_null = result->nulls_ptr_;
 
         if (nullable) {
@@ -83,6 +83,9 @@ public:
                 UnrecoverableError("Compact Bit embedding is not implemented yet.");
                 // return ExecuteHeterogeneous<InputElemType, OutputElemType, Operator>(input, result, count, state_ptr, nullable);
             }
+            case ColumnVectorType::kDictionary: {
+                UnrecoverableError("Dictionary embedding is not implemented yet.");
+            }
         }
     }
 
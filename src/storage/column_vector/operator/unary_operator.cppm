@@ -103,6 +103,9 @@ public:
             case ColumnVectorType::kHeterogeneous: {
                 return ExecuteHeterogeneous<InputType, ResultType, Operator>(input_ptr, result_ptr, result_null, count, state_ptr);
             }
+            case ColumnVectorType::kDictionary: {
+                return ExecuteDictionary<InputType, ResultType, Operator>(input, result, count, state_ptr, nullable);
+            }
         }
 
         UnrecoverableError("Unexpected error.");
@@ -140,6 +143,7 @@ private:
             const u64 *input_null_data = input_null->GetData();
             SizeT unit_count = BitmaskBuffer::UnitCount(count);
             for (SizeT i = 0, start_index = 0, end_index = BitmaskBuffer::UNIT_BITS; i < unit_count; ++i, end_index += BitmaskBuffer::UNIT_BITS) {
+                end_index = std::min(end_index, count);
                 if (input_null_data[i] == BitmaskBuffer::UNIT_MAX) {
                     // all data of 64 rows are not null
                     while (start_index < end_index) {
@@ -152,18 +156,16 @@ private:
                     }
                 } else if (input_null_data[i] == BitmaskBuffer::UNIT_MIN) {
                     // all data of 64 rows are null
-                    ;
+                    start_index = end_index;
                 } else {
-                    SizeT original_start = start_index;
-                    while (start_index < end_index) {
-                        if (input_null->IsTrue(start_index - original_start)) {
+                    for (; start_index < end_index; ++start_index) {
+                        if (input_null->IsTrue(start_index)) {
                             // This row isn't null
                             Operator::template Execute<InputType, ResultType>(input_ptr[start_index],
                                                                               result_ptr[start_index],
                                                                               result_null.get(),
                                                                               start_index,
                                                                               state_ptr);
-                            ++start_index;
                         }
                     }
                 }
@@ -182,6 +184,47 @@ private:
         }
     }
 
+    // The operator runs once for each value of the dictionary, and the rows take the result of their code.
+    // A result kept in bits or in a heap isn't gathered, the dictionary is flattened for it.
+    template <typename InputType, typename ResultType, typename Operator>
+    static void inline ExecuteDictionary(const SharedPtr<ColumnVector> &input, SharedPtr<ColumnVector> &result, SizeT count, void *state_ptr, bool nullable) {
+        if constexpr (std::is_same_v<ResultType, BooleanT> || std::is_same_v<ResultType, VarcharT> || !std::is_trivially_copyable_v<ResultType>) {
+            return Execute<InputType, ResultType, Operator>(input->Flatten(), result, count, state_ptr, nullable);
+        } else {
+            if (result->vector_type() != ColumnVectorType::kFlat) {
+                UnrecoverableError("Target vector type isn't flat.");
+            }
+            const SharedPtr<ColumnVector> &dictionary = input->dictionary();
+            SizeT dictionary_size = dictionary->Size();
+            auto dictionary_result = MakeShared<ColumnVector>(result->data_type());
+            dictionary_result->Initialize(ColumnVectorType::kFlat, dictionary_size);
+            Execute<InputType, ResultType, Operator>(dictionary, dictionary_result, dictionary_size, state_ptr, nullable);
+
+            const u32 *codes = input->dictionary_codes();
+            const auto *dictionary_result_ptr = (const ResultType *)(dictionary_result->data());
+            auto *__restrict result_ptr = (ResultType *)(result->data());
+            for (SizeT i = 0; i < count; ++i) {
+                result_ptr[i] = dictionary_result_ptr[codes[i]];
+            }
+            SharedPtr<Bitmask> &result_null = result->nulls_ptr_;
+            if (nullable) {
+                result_null->DeepCopy(*(input->nulls_ptr_));
+            } else {
+                result_null->SetAllTrue();
+            }
+            const SharedPtr<Bitmask> &dictionary_result_null = dictionary_result->nulls_ptr_;
+            if (!dictionary_result_null->IsAllTrue()) {
+                // the values failing the operator
+                for (SizeT i = 0; i < count; ++i) {
+                    if (!dictionary_result_null->IsTrue(codes[i])) {
+                        result_null->SetFalse(i);
+                    }
+                }
+            }
+            result->Finalize(count);
+        }
+    }
+
     template <typename Operator>
     static void inline ExecuteBoolean(const SharedPtr<ColumnVector> &input, SharedPtr<ColumnVector> &result, SizeT count, void *state_ptr) {
         SharedPtr<Bitmask> &result_null = result->nulls_ptr_;
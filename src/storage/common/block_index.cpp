@@ -46,6 +46,19 @@ void BlockIndex::Reserve(SizeT n) {
     segment_block_index_.reserve(n);
 }
 
+SizeT BlockIndex::RowCount() const {
+    SizeT row_count = 0;
+    for (const auto *segment_entry : segments_) {
+        row_count += segment_entry->row_count();
+    }
+    return row_count;
+}
+
+SizeT BlockIndex::SegmentBlockCount(SegmentID segment_id) const {
+    auto seg_it = segment_block_index_.find(segment_id);
+    return seg_it != segment_block_index_.end() ? seg_it->second.size() : 0;
+}
+
 BlockEntry *BlockIndex::GetBlockEntry(u32 segment_id, u16 block_id) const {
     auto seg_it = segment_block_index_.find(segment_id);
     if (seg_it != segment_block_index_.end()) {
@@ -33,6 +33,12 @@ export struct BlockIndex {
 
     inline SizeT SegmentCount() const { return segments_.size(); }
 
+    // Visible blocks of a segment
+    SizeT SegmentBlockCount(SegmentID segment_id) const;
+
+    // Rows of the visible segments, used to estimate the work of a scan
+    SizeT RowCount() const;
+
     BlockEntry *GetBlockEntry(u32 segment_id, u16 block_id) const;
 
     Vector<SegmentEntry *> segments_;
@@ -0,0 +1,340 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+module;
+
+#include <cstring>
+
+module column_encoding;
+
+import stl;
+import infinity_exception;
+import status;
+import third_party;
+
+namespace infinity {
+
+namespace {
+
+constexpr SizeT MAX_DICTIONARY_SIZE = 1 << 16;
+
+u32 BitWidth(u64 max_value) { return max_value == 0 ? 0 : 64 - __builtin_clzll(max_value); }
+
+SizeT PackedSize(SizeT count, u32 bits) { return (count * bits + 63) / 64 * sizeof(u64); }
+
+// the value sign extended, so that the frame of reference of negative integers is narrow too
+u64 ReadInteger(const char *ptr, SizeT width) {
+    switch (width) {
+        case 1: {
+            i8 value;
+            std::memcpy(&value, ptr, sizeof(value));
+            return static_cast<u64>(static_cast<i64>(value));
+        }
+        case 2: {
+            i16 value;
+            std::memcpy(&value, ptr, sizeof(value));
+            return static_cast<u64>(static_cast<i64>(value));
+        }
+        case 4: {
+            i32 value;
+            std::memcpy(&value, ptr, sizeof(value));
+            return static_cast<u64>(static_cast<i64>(value));
+        }
+        default: {
+            u64 value;
+            std::memcpy(&value, ptr, sizeof(value));
+            return value;
+        }
+    }
+}
+
+// little endian: the low bytes of the sign extended value are the value
+void WriteInteger(char *ptr, SizeT width, u64 value) { std::memcpy(ptr, &value, width); }
+
+void PackBits(const Vector<u64> &values, u32 bits, char *dst) {
+    Vector<u64> words(PackedSize(values.size(), bits) / sizeof(u64), 0);
+    for (SizeT i = 0, pos = 0; bits > 0 && i < values.size(); ++i, pos += bits) {
+        SizeT word = pos / 64;
+        u32 offset = pos % 64;
+        words[word] |= values[i] << offset;
+        if (offset + bits > 64) {
+            words[word + 1] |= values[i] >> (64 - offset);
+        }
+    }
+    if (!words.empty()) {
+        std::memcpy(dst, words.data(), words.size() * sizeof(u64));
+    }
+}
+
+void UnpackBits(const char *src, SizeT count, u32 bits, Vector<u64> &values) {
+    values.assign(count, 0);
+    if (bits == 0) {
+        return;
+    }
+    Vector<u64> words(PackedSize(count, bits) / sizeof(u64));
+    std::memcpy(words.data(), src, words.size() * sizeof(u64));
+    const u64 mask = bits == 64 ? ~u64(0) : (u64(1) << bits) - 1;
+    for (SizeT i = 0, pos = 0; i < count; ++i, pos += bits) {
+        SizeT word = pos / 64;
+        u32 offset = pos % 64;
+        u64 value = words[word] >> offset;
+        if (offset + bits > 64) {
+            value |= words[word + 1] << (64 - offset);
+        }
+        values[i] = value & mask;
+    }
+}
+
+template <typename T>
+void Append(Vector<char> &dst, const T &value) {
+    const char *ptr = reinterpret_cast<const char *>(&value);
+    dst.insert(dst.end(), ptr, ptr + sizeof(T));
+}
+
+class EncodedReader {
+public:
+    EncodedReader(const char *encoded, SizeT encoded_size) : ptr_(encoded), end_(encoded + encoded_size) {}
+
+    const char *Take(SizeT size) {
+        if (size > SizeT(end_ - ptr_)) {
+            RecoverableError(Status::DataIOError("Column encoded data is truncated."));
+        }
+        const char *ptr = ptr_;
+        ptr_ += size;
+        return ptr;
+    }
+
+    template <typename T>
+    T Read() {
+        T value;
+        std::memcpy(&value, Take(sizeof(T)), sizeof(T));
+        return value;
+    }
+
+private:
+    const char *ptr_;
+    const char *end_;
+};
+
+// format: (run length: u32, value) per run
+SizeT RLESize(const char *data, SizeT count, SizeT value_width) {
+    SizeT run_count = count > 0;
+    for (SizeT i = 1; i < count; ++i) {
+        run_count += std::memcmp(data + i * value_width, data + (i - 1) * value_width, value_width) != 0;
+    }
+    return run_count * (sizeof(u32) + value_width);
+}
+
+void EncodeRLE(const char *data, SizeT count, SizeT value_width, Vector<char> &encoded) {
+    for (SizeT i = 0; i < count;) {
+        SizeT run_end = i + 1;
+        while (run_end < count && std::memcmp(data + run_end * value_width, data + i * value_width, value_width) == 0) {
+            ++run_end;
+        }
+        Append(encoded, static_cast<u32>(run_end - i));
+        encoded.insert(encoded.end(), data + i * value_width, data + (i + 1) * value_width);
+        i = run_end;
+    }
+}
+
+void DecodeRLE(EncodedReader &reader, SizeT count, SizeT value_width, char *data) {
+    for (SizeT i = 0; i < count;) {
+        SizeT run_length = reader.Read<u32>();
+        const char *value = reader.Take(value_width);
+        if (run_length == 0 || run_length > count - i) {
+            RecoverableError(Status::DataIOError(fmt::format("Invalid column run length {}.", run_length)));
+        }
+        for (SizeT end = i + run_length; i < end; ++i) {
+            std::memcpy(data + i * value_width, value, value_width);
+        }
+    }
+}
+
+// format: dictionary size: u32, index bit width: u8, the distinct values, bit packed indices
+SizeT BuildDictionary(const char *data, SizeT count, SizeT value_width, Vector<u64> &ids, Vector<std::string_view> &values) {
+    HashMap<std::string_view, u64> dictionary;
+    ids.resize(count);
+    for (SizeT i = 0; i < count; ++i) {
+        std::string_view value(data + i * value_width, value_width);
+        auto [iter, inserted] = dictionary.emplace(value, values.size());
+        if (inserted) {
+            if (values.size() == MAX_DICTIONARY_SIZE) {
+                return std::numeric_limits<SizeT>::max();
+            }
+            values.push_back(value);
+        }
+        ids[i] = iter->second;
+    }
+    return sizeof(u32) + sizeof(u8) + values.size() * value_width + PackedSize(count, BitWidth(values.size() - 1));
+}
+
+void EncodeDictionary(const Vector<u64> &ids, const Vector<std::string_view> &values, Vector<char> &encoded) {
+    u8 bits = BitWidth(values.size() - 1);
+    Append(encoded, static_cast<u32>(values.size()));
+    Append(encoded, bits);
+    for (const auto &value : values) {
+        encoded.insert(encoded.end(), value.begin(), value.end());
+    }
+    SizeT offset = encoded.size();
+    encoded.resize(offset + PackedSize(ids.size(), bits));
+    PackBits(ids, bits, encoded.data() + offset);
+}
+
+void DecodeDictionary(EncodedReader &reader, SizeT count, SizeT value_width, char *data) {
+    SizeT dictionary_size = reader.Read<u32>();
+    u8 bits = reader.Read<u8>();
+    if (bits > 32) {
+        RecoverableError(Status::DataIOError(fmt::format("Invalid column dictionary index width {}.", bits)));
+    }
+    const char *values = reader.Take(dictionary_size * value_width);
+    Vector<u64> ids;
+    UnpackBits(reader.Take(PackedSize(count, bits)), count, bits, ids);
+    for (SizeT i = 0; i < count; ++i) {
+        if (ids[i] >= dictionary_size) {
+            RecoverableError(Status::DataIOError(fmt::format("Invalid column dictionary index {}.", ids[i])));
+        }
+        std::memcpy(data + i * value_width, values + ids[i] * value_width, value_width);
+    }
+}
+
+// format: frame of reference: u64, bit width: u8, bit packed offsets to the frame of reference
+SizeT BitPackingSize(const char *data, SizeT count, SizeT value_width, u64 &min_value, u32 &bits) {
+    i64 min = std::numeric_limits<i64>::max();
+    i64 max = std::numeric_limits<i64>::min();
+    for (SizeT i = 0; i < count; ++i) {
+        i64 value = static_cast<i64>(ReadInteger(data + i * value_width, value_width));
+        min = std::min(min, value);
+        max = std::max(max, value);
+    }
+    min_value = static_cast<u64>(min);
+    bits = count > 0 ? BitWidth(static_cast<u64>(max) - min_value) : 0;
+    return sizeof(u64) + sizeof(u8) + PackedSize(count, bits);
+}
+
+void EncodeBitPacking(const char *data, SizeT count, SizeT value_width, u64 min_value, u32 bits, Vector<char> &encoded) {
+    Vector<u64> offsets(count);
+    for (SizeT i = 0; i < count; ++i) {
+        offsets[i] = ReadInteger(data + i * value_width, value_width) - min_value;
+    }
+    Append(encoded, min_value);
+    Append(encoded, static_cast<u8>(bits));
+    SizeT offset = encoded.size();
+    encoded.resize(offset + PackedSize(count, bits));
+    PackBits(offsets, bits, encoded.data() + offset);
+}
+
+void DecodeBitPacking(EncodedReader &reader, SizeT count, SizeT value_width, char *data) {
+    u64 min_value = reader.Read<u64>();
+    u8 bits = reader.Read<u8>();
+    if (bits > 64) {
+        RecoverableError(Status::DataIOError(fmt::format("Invalid column bit width {}.", bits)));
+    }
+    Vector<u64> offsets;
+    UnpackBits(reader.Take(PackedSize(count, bits)), count, bits, offsets);
+    for (SizeT i = 0; i < count; ++i) {
+        WriteInteger(data + i * value_width, value_width, min_value + offsets[i]);
+    }
+}
+
+} // namespace
+
+ColumnEncodingType EncodeColumn(const char *data, SizeT size, SizeT value_width, Vector<char> &encoded) {
+    encoded.clear();
+    if (value_width == 0 || size == 0 || size % value_width != 0) {
+        return ColumnEncodingType::kPlain;
+    }
+    const SizeT count = size / value_width;
+    auto best_type = ColumnEncodingType::kPlain;
+    SizeT best_size = size - size / 8;
+
+    SizeT rle_size = RLESize(data, count, value_width);
+    if (rle_size < best_size) {
+        best_type = ColumnEncodingType::kRLE;
+        best_size = rle_size;
+    }
+    Vector<u64> ids;
+    Vector<std::string_view> values;
+    SizeT dictionary_size = BuildDictionary(data, count, value_width, ids, values);
+    if (dictionary_size < best_size) {
+        best_type = ColumnEncodingType::kDictionary;
+        best_size = dictionary_size;
+    }
+    u64 min_value = 0;
+    u32 bits = 0;
+    if (value_width == 1 || value_width == 2 || value_width == 4 || value_width == 8) {
+        SizeT bit_packing_size = BitPackingSize(data, count, value_width, min_value, bits);
+        if (bit_packing_size < best_size) {
+            best_type = ColumnEncodingType::kBitPacking;
+            best_size = bit_packing_size;
+        }
+    }
+
+    encoded.reserve(best_size);
+    switch (best_type) {
+        case ColumnEncodingType::kPlain: {
+            break;
+        }
+        case ColumnEncodingType::kRLE: {
+            EncodeRLE(data, count, value_width, encoded);
+            break;
+        }
+        case ColumnEncodingType::kDictionary: {
+            EncodeDictionary(ids, values, encoded);
+            break;
+        }
+        case ColumnEncodingType::kBitPacking: {
+            EncodeBitPacking(data, count, value_width, min_value, bits, encoded);
+            break;
+        }
+    }
+    return best_type;
+}
+
+void DecodeColumn(ColumnEncodingType type, const char *encoded, SizeT encoded_size, SizeT value_width, char *data, SizeT size) {
+    if (type == ColumnEncodingType::kPlain) {
+        if (encoded_size != size) {
+            RecoverableError(Status::DataIOError(fmt::format("Plain column size {} isn't {}.", encoded_size, size)));
+        }
+        std::memcpy(data, encoded, size);
+        return;
+    }
+    if (value_width == 0 || size % value_width != 0) {
+        RecoverableError(Status::DataIOError(fmt::format("Invalid column value width {} of size {}.", value_width, size)));
+    }
+    const SizeT count = size / value_width;
+    EncodedReader reader(encoded, encoded_size);
+    switch (type) {
+        case ColumnEncodingType::kRLE: {
+            DecodeRLE(reader, count, value_width, data);
+            break;
+        }
+        case ColumnEncodingType::kDictionary: {
+            DecodeDictionary(reader, count, value_width, data);
+            break;
+        }
+        case ColumnEncodingType::kBitPacking: {
+            if (value_width != 1 && value_width != 2 && value_width != 4 && value_width != 8) {
+                RecoverableError(Status::DataIOError(fmt::format("Invalid bit packed value width {}.", value_width)));
+            }
+            DecodeBitPacking(reader, count, value_width, data);
+            break;
+        }
+        default: {
+            RecoverableError(Status::DataIOError(fmt::format("Unknown column encoding {}.", static_cast<u8>(type))));
+        }
+    }
+}
+
+} // namespace infinity
@@ -0,0 +1,41 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+module;
+
+export module column_encoding;
+
+import stl;
+
+namespace infinity {
+
+// Lightweight encodings of the fixed width values of a column block, chosen when the block is written to disk and
+// decoded back to the plain values when it is read.
+// Each encoding is lossless for any bytes: the values are compared as bytes, and bit packing reads them as signed integers.
+export enum class ColumnEncodingType : u8 {
+    kPlain = 0,
+    kRLE = 1,        // runs of equal values: sorted or low cardinality columns, the empty tail of a block
+    kDictionary = 2, // distinct values and their bit packed indices: low cardinality columns such as short varchars
+    kBitPacking = 3, // frame of reference and bit packing: integers in a narrow range
+};
+
+// Encode the size bytes of values of value_width bytes with the encoding that saves the most.
+// Return kPlain, and leave encoded empty, if no encoding saves an eighth of the size.
+export ColumnEncodingType EncodeColumn(const char *data, SizeT size, SizeT value_width, Vector<char> &encoded);
+
+// Decode into size bytes of data. Throw a recoverable error if the encoded data is corrupted.
+export void DecodeColumn(ColumnEncodingType type, const char *encoded, SizeT encoded_size, SizeT value_width, char *data, SizeT size);
+
+} // namespace infinity
@@ -58,6 +58,11 @@ struct FastPForWrapper<FastPForCodec::SIMDBitPacking>::Impl {
     FastPForLib::CompositeCodec<FastPForLib::SIMDBinaryPacking, FastPForLib::VariableByte> codec;
 };
 
+template <>
+struct FastPForWrapper<FastPForCodec::SIMDBitPackingStreamVByte>::Impl {
+    FastPForLib::CompositeCodec<FastPForLib::SIMDBinaryPacking, FastPForLib::StreamVByte> codec;
+};
+
 template <FastPForCodec Codec>
 FastPForWrapper<Codec>::FastPForWrapper() : impl_(new FastPForWrapper<Codec>::Impl) {}
 
@@ -91,5 +96,6 @@ void FastPForWrapper<Codec>::RevertDelta(u32 *src, SizeT count) {
 
 // template struct FastPForWrapper<FastPForCodec::FastPFor>;
 template struct FastPForWrapper<FastPForCodec::SIMDBitPacking>;
+template struct FastPForWrapper<FastPForCodec::SIMDBitPackingStreamVByte>;
 
 } // namespace infinity
\ No newline at end of file
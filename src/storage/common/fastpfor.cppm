@@ -20,7 +20,7 @@ export module fastpfor;
 
 namespace infinity {
 
-export enum class FastPForCodec { SIMDFastPFor, SIMDNewPFor, StreamVByte, SIMDBitPacking };
+export enum class FastPForCodec { SIMDFastPFor, SIMDNewPFor, StreamVByte, SIMDBitPacking, SIMDBitPackingStreamVByte };
 
 export template <FastPForCodec Codec>
 struct FastPForWrapper {
@@ -45,5 +45,7 @@ export using SIMDFastPFor = FastPForWrapper<FastPForCodec::SIMDFastPFor>;
 export using SIMDNewPFor = FastPForWrapper<FastPForCodec::SIMDNewPFor>;
 export using StreamVByte = FastPForWrapper<FastPForCodec::StreamVByte>;
 export using SIMDBitPacking = FastPForWrapper<FastPForCodec::SIMDBitPacking>;
+// 128 integer blocks are bit packed, the remainder is StreamVByte coded instead of VariableByte
+export using SIMDBitPackingStreamVByte = FastPForWrapper<FastPForCodec::SIMDBitPackingStreamVByte>;
 
 } // namespace infinity
\ No newline at end of file
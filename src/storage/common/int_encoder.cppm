@@ -60,8 +60,20 @@ inline u32 IntEncoder<T, Compressor>::Decode(T *dest, u32 dest_len, ByteSliceRea
     return (u32)compressor_.Decompress(dest, dest_len, (const u32 *)buf_ptr, comp_len);
 }
 
+// The u32 encoders are used through this interface so that the codec of a doc list can be chosen per index.
+export class Int32EncoderBase {
+public:
+    virtual ~Int32EncoderBase() = default;
+
+    // src_len: number of elements in src. Return number of bytes after compression
+    virtual u32 Encode(ByteSliceWriter &slice_writer, const u32 *src, u32 src_len) const = 0;
+
+    // return number of elements
+    virtual u32 Decode(u32 *dest, u32 dest_len, ByteSliceReader &slice_reader) const = 0;
+};
+
 export template <FastPForCodec Codec>
-class IntEncoder<u32, FastPForWrapper<Codec>> {
+class IntEncoder<u32, FastPForWrapper<Codec>> : public Int32EncoderBase {
 public:
     const static size_t ENCODER_BUFFER_SIZE = 1024;
     const static size_t ENCODER_BUFFER_BYTE_SIZE = ENCODER_BUFFER_SIZE * sizeof(u32);
@@ -71,11 +83,9 @@ public:
     virtual ~IntEncoder() {}
 
 public:
-    // src_len: number of elements in src. Return number of bytes after compression
-    inline u32 Encode(ByteSliceWriter &slice_writer, const u32 *src, u32 src_len) const;
+    inline u32 Encode(ByteSliceWriter &slice_writer, const u32 *src, u32 src_len) const override;
 
-    // return number of elements
-    inline u32 Decode(u32 *dest, u32 dest_len, ByteSliceReader &slice_reader) const;
+    inline u32 Decode(u32 *dest, u32 dest_len, ByteSliceReader &slice_reader) const override;
 
 private:
     FastPForWrapper<Codec> compressor_{};
@@ -97,7 +107,13 @@ inline u32 IntEncoder<u32, FastPForWrapper<Codec>>::Decode(u32 *dest, u32 dest_l
     u32 comp_len = slice_reader.ReadByte();
     void *buf_ptr = buffer;
     comp_len *= sizeof(u32);
-    size_t len = slice_reader.ReadMayCopy(buf_ptr, comp_len);
+    size_t len = 0;
+    if constexpr (Codec == FastPForCodec::SIMDBitPackingStreamVByte) {
+        // the simd StreamVByte decoder loads past the end of its input, it must not run off the slice
+        len = slice_reader.Read(buf_ptr, comp_len);
+    } else {
+        len = slice_reader.ReadMayCopy(buf_ptr, comp_len);
+    }
     if (len != comp_len) {
         UnrecoverableError("Decode posting FAILEDF");
     }
@@ -16,6 +16,7 @@ module;
 
 import stl;
 import table_entry_type;
+import io_stats;
 
 export module meta_info;
 
@@ -33,6 +34,9 @@ export struct TableInfo {
     i64 column_count_{};
     i64 segment_count_{};
     i64 row_count_{};
+    // the reads and writes of the files of the table and its indexes since the start
+    IOStatsInfo io_read_{};
+    IOStatsInfo io_write_{};
 };
 
 export struct TableIndexInfo {
@@ -43,6 +47,11 @@ export struct TableIndexInfo {
     SharedPtr<String> index_other_params_{};
     SharedPtr<String> index_column_ids_{};
     SharedPtr<String> index_column_names_{};
+    // secondary index: the error bounds, the most levels and the total size of the PGM indexes of the segments
+    u32 pgm_min_epsilon_{};
+    u32 pgm_max_epsilon_{};
+    SizeT pgm_height_{};
+    SizeT pgm_size_{};
 };
 
 export struct TableDetail {
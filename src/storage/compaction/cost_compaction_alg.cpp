@@ -0,0 +1,254 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <algorithm>
+#include <vector>
+
+module cost_compaction_alg;
+
+import stl;
+import segment_entry;
+import infinity_exception;
+import txn;
+import compaction_alg;
+import third_party;
+import logger;
+import table_entry;
+
+namespace infinity {
+
+Atomic<SizeT> CostCompactionAlg::global_running_task_n_{0};
+
+Optional<Pair<Vector<SegmentEntry *>, Txn *>> CostCompactionAlg::AddSegment(SegmentEntry *new_segment, std::function<Txn *()> generate_txn) {
+    std::unique_lock lock(mtx_);
+    auto now = Clock::now();
+    segments_.emplace(new_segment->segment_id(), SegmentInfo{new_segment, now});
+    if (status_ == CompactionStatus::kDisable) {
+        // If is disable, manual compaction is going
+        // new segment will be add after manual compaction is committed/rollback
+        return None;
+    }
+    Vector<SegmentID> picked = PickSmallSegments(now);
+    if (picked.empty() || !TryStartTask()) {
+        return None;
+    }
+    return StartTask(picked, generate_txn, "Add");
+}
+
+Optional<Pair<Vector<SegmentEntry *>, Txn *>> CostCompactionAlg::DeleteInSegment(SegmentID segment_id, std::function<Txn *()> generate_txn) {
+    std::unique_lock lock(mtx_);
+    auto iter = segments_.find(segment_id);
+    if (iter == segments_.end()) {
+        return None; // this segment is compacting, ignore it
+    }
+    if (status_ == CompactionStatus::kDisable) {
+        // If is disable, manual compaction is going
+        return None;
+    }
+    const SegmentEntry *shrink_segment = iter->second.segment_entry_;
+    Vector<SegmentID> picked;
+    if (DeleteRatio(shrink_segment) >= config_.delete_ratio_) {
+        picked.push_back(segment_id);
+        FillWithSmallSegments(picked, shrink_segment->actual_row_count(), segment_id);
+    } else {
+        // the deletes may have left one more small segment
+        picked = PickSmallSegments(Clock::now());
+    }
+    if (picked.empty() || !TryStartTask()) {
+        return None;
+    }
+    return StartTask(picked, generate_txn, "Delete");
+}
+
+void CostCompactionAlg::CommitCompact(TransactionID commit_txn_id) {
+    std::unique_lock lock(mtx_);
+    if (status_ != CompactionStatus::kRunning) {
+        UnrecoverableError(fmt::format("Wrong status of compaction alg: {}", (u8)status_));
+    }
+    compacting_segments_.erase(commit_txn_id);
+    FinishTask();
+    if (table_entry_ != nullptr) {
+        LOG_INFO(fmt::format("Compact task commit, table_entry: {}, running_task: {}", *table_entry_->TableEntryDir(), running_task_n_));
+    }
+}
+
+void CostCompactionAlg::RollbackCompact(TransactionID rollback_txn_id) {
+    std::unique_lock lock(mtx_);
+    if (status_ != CompactionStatus::kRunning) {
+        UnrecoverableError(fmt::format("Rollback compact when compaction not running, {}", (u8)status_));
+    }
+    if (auto iter = compacting_segments_.find(rollback_txn_id); iter != compacting_segments_.end()) {
+        for (const auto &segment_info : iter->second) {
+            segments_.emplace(segment_info.segment_entry_->segment_id(), segment_info);
+        }
+        compacting_segments_.erase(iter);
+    }
+    FinishTask();
+    if (table_entry_ != nullptr) {
+        LOG_INFO(fmt::format("Compact task rollback, table_entry: {}, running_task: {}", *table_entry_->TableEntryDir(), running_task_n_));
+    }
+}
+
+// Must be called when all segments are not compacting
+void CostCompactionAlg::Enable(const Vector<SegmentEntry *> &segment_entries) {
+    std::unique_lock lock(mtx_);
+    if (status_ != CompactionStatus::kDisable) {
+        UnrecoverableError(fmt::format("Enable compaction when compaction not disable, {}", (u8)status_));
+    }
+    if (running_task_n_ != 0) {
+        UnrecoverableError(fmt::format("Running task is not 0 when enable compaction, table_ptr: {}", (u64)table_entry_));
+    }
+    auto now = Clock::now();
+    for (auto *segment_entry : segment_entries) {
+        segments_.emplace(segment_entry->segment_id(), SegmentInfo{segment_entry, now});
+    }
+    status_ = CompactionStatus::kEnable;
+    cv_.notify_one();
+}
+
+void CostCompactionAlg::Disable() {
+    std::unique_lock lock(mtx_);
+    cv_.wait(lock, [this]() {
+        bool res = (status_ == CompactionStatus::kEnable);
+        if (!res && table_entry_ != nullptr) {
+            LOG_WARN(fmt::format("table {} is auto compacting now. wait", *(table_entry_->TableEntryDir())));
+        }
+        return res;
+    });
+    segments_.clear();
+    compacting_segments_.clear();
+    status_ = CompactionStatus::kDisable;
+}
+
+void CostCompactionAlg::AddSegmentNoCheck(SegmentEntry *new_segment) {
+    std::unique_lock lock(mtx_);
+    if (status_ != CompactionStatus::kEnable) {
+        UnrecoverableError(fmt::format("Called when compaction not enable, {}", (u8)status_));
+    }
+    segments_.emplace(new_segment->segment_id(), SegmentInfo{new_segment, Clock::now()});
+}
+
+double CostCompactionAlg::DeleteRatio(const SegmentEntry *segment_entry) const {
+    SizeT row_count = segment_entry->row_count();
+    if (row_count == 0) {
+        return 0;
+    }
+    return 1.0 - static_cast<double>(segment_entry->actual_row_count()) / row_count;
+}
+
+Vector<SegmentID> CostCompactionAlg::PickSmallSegments(Clock::time_point now) const {
+    Vector<const SegmentInfo *> small_segments;
+    for (const auto &[segment_id, segment_info] : segments_) {
+        if (IsSmall(segment_info.segment_entry_)) {
+            small_segments.push_back(&segment_info);
+        }
+    }
+    if (small_segments.size() <= config_.max_small_segments_) {
+        return {};
+    }
+    bool overloaded = small_segments.size() > 2 * config_.max_small_segments_;
+    if (!overloaded) {
+        if (now - last_compact_time_ < config_.min_interval_) {
+            return {};
+        }
+        std::erase_if(small_segments, [&](const SegmentInfo *segment_info) { return now - segment_info->add_time_ < config_.min_segment_age_; });
+    }
+    std::sort(small_segments.begin(), small_segments.end(), [](const SegmentInfo *lhs, const SegmentInfo *rhs) {
+        SizeT lhs_rows = lhs->segment_entry_->actual_row_count();
+        SizeT rhs_rows = rhs->segment_entry_->actual_row_count();
+        return lhs_rows != rhs_rows ? lhs_rows < rhs_rows : lhs->add_time_ < rhs->add_time_;
+    });
+    Vector<SegmentID> picked;
+    SizeT picked_rows = 0;
+    for (const SegmentInfo *segment_info : small_segments) {
+        SizeT row_count = segment_info->segment_entry_->actual_row_count();
+        if (picked_rows + row_count > config_.max_segment_capacity_) {
+            break;
+        }
+        picked.push_back(segment_info->segment_entry_->segment_id());
+        picked_rows += row_count;
+    }
+    if (picked.size() <= 1) {
+        return {};
+    }
+    return picked;
+}
+
+void CostCompactionAlg::FillWithSmallSegments(Vector<SegmentID> &picked, SizeT picked_rows, SegmentID exclude) const {
+    Vector<const SegmentEntry *> small_segments;
+    for (const auto &[segment_id, segment_info] : segments_) {
+        if (segment_id != exclude && IsSmall(segment_info.segment_entry_)) {
+            small_segments.push_back(segment_info.segment_entry_);
+        }
+    }
+    std::sort(small_segments.begin(), small_segments.end(), [](const SegmentEntry *lhs, const SegmentEntry *rhs) {
+        return lhs->actual_row_count() < rhs->actual_row_count();
+    });
+    for (const SegmentEntry *segment_entry : small_segments) {
+        SizeT row_count = segment_entry->actual_row_count();
+        if (picked_rows + row_count > config_.max_segment_capacity_) {
+            break;
+        }
+        picked.push_back(segment_entry->segment_id());
+        picked_rows += row_count;
+    }
+}
+
+bool CostCompactionAlg::TryStartTask() {
+    if (global_running_task_n_.fetch_add(1) >= config_.max_running_tasks_) {
+        global_running_task_n_.fetch_sub(1);
+        return false;
+    }
+    if (++running_task_n_ == 1) {
+        status_ = CompactionStatus::kRunning;
+    }
+    last_compact_time_ = Clock::now();
+    return true;
+}
+
+Pair<Vector<SegmentEntry *>, Txn *>
+CostCompactionAlg::StartTask(const Vector<SegmentID> &picked, std::function<Txn *()> &generate_txn, const char *reason) {
+    if (table_entry_ != nullptr) {
+        LOG_INFO(fmt::format("Start compact task({}), table_entry: {}, segments: {}, running_task: {}",
+                             reason,
+                             *table_entry_->TableEntryDir(),
+                             picked.size(),
+                             running_task_n_));
+    }
+    Txn *txn = generate_txn();
+    auto &compacting_segments = compacting_segments_[txn->TxnID()];
+    Vector<SegmentEntry *> compact_segments;
+    for (SegmentID segment_id : picked) {
+        auto iter = segments_.find(segment_id);
+        if (iter == segments_.end()) {
+            UnrecoverableError("Algorithm bug.");
+        }
+        compact_segments.push_back(iter->second.segment_entry_);
+        compacting_segments.push_back(iter->second);
+        segments_.erase(iter);
+    }
+    return MakePair(std::move(compact_segments), std::move(txn));
+}
+
+void CostCompactionAlg::FinishTask() {
+    global_running_task_n_.fetch_sub(1);
+    if (--running_task_n_ == 0) {
+        status_ = CompactionStatus::kEnable;
+        cv_.notify_one();
+    }
+}
+
+} // namespace infinity
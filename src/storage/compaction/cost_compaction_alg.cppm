@@ -0,0 +1,108 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module cost_compaction_alg;
+
+import stl;
+import segment_entry;
+import txn;
+import compaction_alg;
+import table_entry;
+import default_values;
+
+namespace infinity {
+
+export struct CostCompactionConfig {
+    SizeT max_segment_capacity_ = DEFAULT_SEGMENT_CAPACITY;
+    SizeT max_small_segments_ = COST_COMPACTION_MAX_SMALL_SEGMENTS; // the bound of the read amplification
+    double delete_ratio_ = COST_COMPACTION_DELETE_RATIO;
+    std::chrono::milliseconds min_interval_{COST_COMPACTION_MIN_INTERVAL_MS};
+    std::chrono::milliseconds min_segment_age_{COST_COMPACTION_MIN_SEGMENT_AGE_MS};
+    SizeT max_running_tasks_ = COST_COMPACTION_MAX_RUNNING_TASKS;
+};
+
+/*
+    Picks the segments by the cost of compacting them instead of by fixed layers:
+    - A segment with many deleted rows is compacted first, so the deleted rows stop costing scans and index searches.
+    - Segments less than half full are merged once a table has more than `max_small_segments_` of them, which bounds the
+      segments a scan visits. The smallest and oldest of them are picked: the rows copied and indexed again are the cost
+      of a pick, and a new segment may still be merged by the next append.
+    - A table is compacted again only `min_interval_` after its previous compaction, unless it has twice the small
+      segments, so a table taking many writes is not compacted all the time.
+    - No new compaction starts while `max_running_tasks_` compactions of all tables are running.
+    The segments not picked stay in the algorithm and are checked again on the next append or delete.
+*/
+export class CostCompactionAlg final : public CompactionAlg {
+public:
+    explicit CostCompactionAlg(const CostCompactionConfig &config = CostCompactionConfig(), TableEntry *table_entry = nullptr)
+        : CompactionAlg(), config_(config), table_entry_(table_entry) {}
+
+    Optional<Pair<Vector<SegmentEntry *>, Txn *>> AddSegment(SegmentEntry *new_segment, std::function<Txn *()> generate_txn) override;
+
+    Optional<Pair<Vector<SegmentEntry *>, Txn *>> DeleteInSegment(SegmentID segment_id, std::function<Txn *()> generate_txn) override;
+
+    void CommitCompact(TransactionID commit_txn_id) override;
+
+    void RollbackCompact(TransactionID rollback_txn_id) override;
+
+    void Enable(const Vector<SegmentEntry *> &segment_entries) override;
+
+    void Disable() override;
+
+    void AddSegmentNoCheck(SegmentEntry *new_segment) override;
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct SegmentInfo {
+        SegmentEntry *segment_entry_;
+        Clock::time_point add_time_;
+    };
+
+    bool IsSmall(const SegmentEntry *segment_entry) const { return segment_entry->actual_row_count() < config_.max_segment_capacity_ / 2; }
+
+    double DeleteRatio(const SegmentEntry *segment_entry) const;
+
+    // The small segments to merge, empty if the table doesn't need a compaction now.
+    Vector<SegmentID> PickSmallSegments(Clock::time_point now) const;
+
+    // Fills the room left by `picked_rows` with the cheapest small segments other than `exclude`.
+    void FillWithSmallSegments(Vector<SegmentID> &picked, SizeT picked_rows, SegmentID exclude) const;
+
+    bool TryStartTask();
+
+    Pair<Vector<SegmentEntry *>, Txn *> StartTask(const Vector<SegmentID> &picked, std::function<Txn *()> &generate_txn, const char *reason);
+
+    void FinishTask();
+
+private:
+    const CostCompactionConfig config_;
+    TableEntry *table_entry_;
+
+    std::mutex mtx_;
+    std::condition_variable cv_;
+
+    HashMap<SegmentID, SegmentInfo> segments_;
+    HashMap<TransactionID, Vector<SegmentInfo>> compacting_segments_;
+
+    Clock::time_point last_compact_time_{};
+    int running_task_n_{};
+
+    // the compaction tasks of all tables started by this algorithm
+    static Atomic<SizeT> global_running_task_n_;
+};
+
+} // namespace infinity
@@ -124,6 +124,53 @@ void DataBlock::Init(const Vector<SharedPtr<ColumnVector>> &input_vectors) {
     Finalize();
 }
 
+void DataBlock::InitWithSelection(const DataBlock *input, SharedPtr<Selection> input_select) {
+    if (input == nullptr) {
+        UnrecoverableError("Invalid input data block");
+    }
+    if (input->HasSelection()) {
+        UnrecoverableError("Input data block already has a selection.");
+    }
+    InitWithSelection(input->column_vectors, std::move(input_select));
+}
+
+void DataBlock::InitWithSelection(const Vector<SharedPtr<ColumnVector>> &input_vectors, SharedPtr<Selection> input_select) {
+    if (initialized) {
+        UnrecoverableError("Data block was initialized before.");
+    }
+    if (input_vectors.empty() || input_select.get() == nullptr) {
+        UnrecoverableError("Invalid input column vectors or select");
+    }
+    column_count_ = input_vectors.size();
+    column_vectors = input_vectors;
+    capacity_ = column_vectors[0]->capacity();
+    selection_ = std::move(input_select);
+    row_count_ = selection_->Size();
+    initialized = true;
+    finalized = true;
+}
+
+void DataBlock::Materialize() {
+    if (selection_.get() == nullptr) {
+        return;
+    }
+    for (SizeT idx = 0; idx < column_count_; ++idx) {
+        column_vectors[idx] = MaterializeColumn(idx);
+    }
+    capacity_ = column_vectors[0]->capacity();
+    selection_.reset();
+}
+
+SharedPtr<ColumnVector> DataBlock::MaterializeColumn(SizeT column_index) const {
+    const SharedPtr<ColumnVector> &column_vector = column_vectors[column_index];
+    if (selection_.get() == nullptr) {
+        return column_vector;
+    }
+    auto result = MakeShared<ColumnVector>(column_vector->data_type());
+    result->Initialize(*column_vector, *selection_);
+    return result;
+}
+
 void DataBlock::UnInit() {
     if (!initialized) {
         // Already in un-initialized state
@@ -131,6 +178,7 @@ void DataBlock::UnInit() {
     }
 
     column_vectors.clear();
+    selection_.reset();
 
     row_count_ = 0;
     initialized = false;
@@ -151,6 +199,7 @@ void DataBlock::Reset() {
         column_vectors[i]->Reset();
         column_vectors[i]->Initialize(old_vector_type);
     }
+    selection_.reset();
 
     row_count_ = 0;
     finalized = false;
@@ -170,12 +219,18 @@ void DataBlock::Reset(SizeT capacity) {
         column_vectors[i]->Reset();
         column_vectors[i]->Initialize(old_vector_type, capacity);
     }
+    selection_.reset();
     row_count_ = 0;
     capacity_ = capacity;
     finalized = false;
 }
 
-Value DataBlock::GetValue(SizeT column_index, SizeT row_index) const { return column_vectors[column_index]->GetValue(row_index); }
+Value DataBlock::GetValue(SizeT column_index, SizeT row_index) const {
+    if (selection_.get() != nullptr) {
+        row_index = selection_->Get(row_index);
+    }
+    return column_vectors[column_index]->GetValue(row_index);
+}
 
 void DataBlock::SetValue(SizeT column_index, SizeT row_index, const Value &val) {
     if (column_index >= column_count_) {
@@ -49,6 +49,22 @@ public:
 
     void Init(const Vector<SharedPtr<ColumnVector>> &column_vectors);
 
+    // Share the column vectors of the input, the rows of this block are the rows selected by input_select.
+    // Nothing is copied until an operator requiring dense columns calls Materialize.
+    void InitWithSelection(const DataBlock *input, SharedPtr<Selection> input_select);
+
+    void InitWithSelection(const Vector<SharedPtr<ColumnVector>> &input_vectors, SharedPtr<Selection> input_select);
+
+    // Copy the selected rows into dense column vectors and drop the selection.
+    void Materialize();
+
+    // Dense column vector of the rows of this block, the column vector itself when there is no selection.
+    [[nodiscard]] SharedPtr<ColumnVector> MaterializeColumn(SizeT column_index) const;
+
+    [[nodiscard]] inline bool HasSelection() const { return selection_.get() != nullptr; }
+
+    [[nodiscard]] inline const SharedPtr<Selection> &selection() const { return selection_; }
+
     void UnInit();
 
     [[nodiscard]] inline bool Initialized() const { return initialized; }
@@ -124,6 +140,9 @@ public:
     Vector<SharedPtr<ColumnVector>> column_vectors;
 
 private:
+    // Rows of the column vectors belonging to this block, all rows when it's null.
+    SharedPtr<Selection> selection_{};
+
     u16 row_count_{0};
     SizeT column_count_{0};
     SizeT capacity_{0};
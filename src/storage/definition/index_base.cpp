@@ -22,15 +22,18 @@ module index_base;
 import stl;
 import serialize;
 import index_ivfflat;
+import index_ivfpq;
 import index_hnsw;
 import index_full_text;
 import index_secondary;
+import index_bitmap;
 import third_party;
 import status;
 
 import infinity_exception;
 import create_index_info;
 import index_defines;
+import statement_common;
 
 namespace infinity {
 
@@ -42,6 +45,9 @@ String MetricTypeToString(MetricType metric_type) {
         case MetricType::kMetricL2: {
             return "l2";
         }
+        case MetricType::kMetricCosine: {
+            return "cosine";
+        }
         case MetricType::kInvalid: {
             return "Invalid";
         }
@@ -53,6 +59,8 @@ MetricType StringToMetricType(const String &str) {
         return MetricType::kMetricInnerProduct;
     } else if (str == "l2") {
         return MetricType::kMetricL2;
+    } else if (str == "cosine") {
+        return MetricType::kMetricCosine;
     } else {
         return MetricType::kInvalid;
     }
@@ -112,6 +120,13 @@ SharedPtr<IndexBase> IndexBase::ReadAdv(char *&ptr, int32_t maxbytes) {
             res = MakeShared<IndexIVFFlat>(index_name, file_name, column_names, centroids_count, metric_type);
             break;
         }
+        case IndexType::kIVFPQ: {
+            size_t centroids_count = ReadBufAdv<size_t>(ptr);
+            MetricType metric_type = ReadBufAdv<MetricType>(ptr);
+            size_t subspace_dim = ReadBufAdv<size_t>(ptr);
+            res = MakeShared<IndexIVFPQ>(index_name, file_name, column_names, centroids_count, metric_type, subspace_dim);
+            break;
+        }
         case IndexType::kHnsw: {
             MetricType metric_type = ReadBufAdv<MetricType>(ptr);
             HnswEncodeType encode_type = ReadBufAdv<HnswEncodeType>(ptr);
@@ -131,6 +146,10 @@ SharedPtr<IndexBase> IndexBase::ReadAdv(char *&ptr, int32_t maxbytes) {
             res = MakeShared<IndexSecondary>(index_name, file_name, std::move(column_names));
             break;
         }
+        case IndexType::kBitmap: {
+            res = MakeShared<IndexBitmap>(index_name, file_name, std::move(column_names));
+            break;
+        }
         case IndexType::kInvalid: {
             UnrecoverableError("Error index method while reading");
         }
@@ -157,12 +176,36 @@ String IndexBase::ToString() const {
     return ss.str();
 }
 
+bool IndexBase::TakePinnedParam(Vector<InitParameter *> &index_param_list) {
+    bool pinned = false;
+    for (auto iter = index_param_list.begin(); iter != index_param_list.end();) {
+        String param_name = (*iter)->param_name_;
+        std::transform(param_name.begin(), param_name.end(), param_name.begin(), ::tolower);
+        if (param_name != "pinned") {
+            ++iter;
+            continue;
+        }
+        const String &param_value = (*iter)->param_value_;
+        if (param_value.empty() || param_value == "1") {
+            pinned = true;
+        } else if (param_value != "0") {
+            RecoverableError(Status::InvalidIndexDefinition(fmt::format("Index parameter pinned: {} isn't 0 or 1.", param_value)));
+        }
+        delete *iter;
+        iter = index_param_list.erase(iter);
+    }
+    return pinned;
+}
+
 nlohmann::json IndexBase::Serialize() const {
     nlohmann::json res;
     res["index_type"] = IndexInfo::IndexTypeToString(index_type_);
     res["index_name"] = *index_name_;
     res["file_name"] = file_name_;
     res["column_names"] = column_names_;
+    if (pinned_) {
+        res["pinned"] = true;
+    }
     return res;
 }
 
@@ -181,6 +224,14 @@ SharedPtr<IndexBase> IndexBase::Deserialize(const nlohmann::json &index_def_json
             res = std::static_pointer_cast<IndexBase>(ptr);
             break;
         }
+        case IndexType::kIVFPQ: {
+            size_t centroids_count = index_def_json["centroids_count"];
+            MetricType metric_type = StringToMetricType(index_def_json["metric_type"]);
+            size_t subspace_dim = index_def_json["subspace_dim"];
+            auto ptr = MakeShared<IndexIVFPQ>(index_name, file_name, std::move(column_names), centroids_count, metric_type, subspace_dim);
+            res = std::static_pointer_cast<IndexBase>(ptr);
+            break;
+        }
         case IndexType::kHnsw: {
             SizeT M = index_def_json["M"];
             SizeT ef_construction = index_def_json["ef_construction"];
@@ -193,7 +244,19 @@ SharedPtr<IndexBase> IndexBase::Deserialize(const nlohmann::json &index_def_json
         }
         case IndexType::kFullText: {
             String analyzer = index_def_json["analyzer"];
-            auto ptr = MakeShared<IndexFullText>(index_name, file_name, std::move(column_names), analyzer);
+            optionflag_t flag = OPTION_FLAG_ALL;
+            // indexes written before the codec was configurable are bp128
+            if (index_def_json.contains("codec") && index_def_json["codec"] == "stream_vbyte") {
+                flag |= of_stream_vbyte;
+            }
+            // indexes written before the skip index have none
+            if (index_def_json.contains("skip_index") && index_def_json["skip_index"] == true) {
+                flag |= of_skip_index;
+            }
+            if (index_def_json.contains("reorder") && index_def_json["reorder"] == "bp") {
+                flag |= of_doc_reorder;
+            }
+            auto ptr = MakeShared<IndexFullText>(index_name, file_name, std::move(column_names), analyzer, flag);
             res = std::static_pointer_cast<IndexBase>(ptr);
             break;
         }
@@ -202,6 +265,11 @@ SharedPtr<IndexBase> IndexBase::Deserialize(const nlohmann::json &index_def_json
             res = std::static_pointer_cast<IndexBase>(ptr);
             break;
         }
+        case IndexType::kBitmap: {
+            auto ptr = MakeShared<IndexBitmap>(index_name, file_name, std::move(column_names));
+            res = std::static_pointer_cast<IndexBase>(ptr);
+            break;
+        }
         case IndexType::kInvalid: {
             UnrecoverableError("Error index method while deserializing");
         }
@@ -209,6 +277,10 @@ SharedPtr<IndexBase> IndexBase::Deserialize(const nlohmann::json &index_def_json
             RecoverableError(Status::NotSupport("Not implemented"));
         }
     }
+    // indexes written before the attribute are not pinned
+    if (index_def_json.contains("pinned")) {
+        res->pinned_ = index_def_json["pinned"];
+    }
     return res;
 }
 
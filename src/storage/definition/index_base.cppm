@@ -20,6 +20,7 @@ import stl;
 
 import third_party;
 import create_index_info;
+import statement_common;
 
 namespace infinity {
 
@@ -27,6 +28,8 @@ namespace infinity {
 export enum class MetricType {
     kMetricInnerProduct,
     kMetricL2,
+    // an index of this metric stores its vectors scaled to unit length, cosine is then inner product
+    kMetricCosine,
     kInvalid,
 };
 
@@ -64,10 +67,16 @@ public:
 
     inline String column_name() const { return column_names_[0]; }
 
+    // `pinned` is a parameter of every index type, so it is taken out of the list before the parameters of the type are checked.
+    // A bare `pinned` or `pinned = 1` sets it.
+    static bool TakePinnedParam(Vector<InitParameter *> &index_param_list);
+
 public:
     const IndexType index_type_{IndexType::kInvalid};
     SharedPtr<String> index_name_{};
     const String file_name_{};
     const Vector<String> column_names_{};
+    // The buffers of a pinned index are never evicted, and they are loaded when the server starts.
+    bool pinned_{false};
 };
 } // namespace infinity
\ No newline at end of file
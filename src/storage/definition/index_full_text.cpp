@@ -40,6 +40,7 @@ SharedPtr<IndexBase> IndexFullText::Make(SharedPtr<String> index_name,
                                          Vector<String> column_names,
                                          const Vector<InitParameter *> &index_param_list) {
     String analyzer{};
+    optionflag_t flag = OPTION_FLAG_ALL | of_skip_index;
     SizeT param_count = index_param_list.size();
     for (SizeT param_idx = 0; param_idx < param_count; ++param_idx) {
         InitParameter *parameter = index_param_list[param_idx];
@@ -47,16 +48,34 @@ SharedPtr<IndexBase> IndexFullText::Make(SharedPtr<String> index_name,
         ToLowerString(para_name);
         if (para_name == "analyzer") {
             analyzer = parameter->param_value_;
+        } else if (para_name == "codec") {
+            String codec = parameter->param_value_;
+            ToLowerString(codec);
+            if (codec == "stream_vbyte") {
+                flag |= of_stream_vbyte;
+            } else if (codec != "bp128") {
+                RecoverableError(Status::InvalidIndexDefinition(fmt::format("Full-text index codec: {} isn't bp128 or stream_vbyte.", codec)));
+            }
+        } else if (para_name == "reorder") {
+            String reorder = parameter->param_value_;
+            ToLowerString(reorder);
+            if (reorder == "bp") {
+                flag |= of_doc_reorder;
+            } else if (reorder != "none") {
+                RecoverableError(Status::InvalidIndexDefinition(fmt::format("Full-text index reorder: {} isn't bp or none.", reorder)));
+            }
         }
     }
-    return MakeShared<IndexFullText>(index_name, file_name, std::move(column_names), analyzer);
+    return MakeShared<IndexFullText>(index_name, file_name, std::move(column_names), analyzer, flag);
 }
 
+String IndexFullText::CodecString() const { return (flag_ & of_stream_vbyte) ? "stream_vbyte" : "bp128"; }
+
 bool IndexFullText::operator==(const IndexFullText &other) const {
     if (this->index_type_ != other.index_type_ || this->file_name_ != other.file_name_ || this->column_names_ != other.column_names_) {
         return false;
     }
-    return analyzer_ == other.analyzer_;
+    return analyzer_ == other.analyzer_ && flag_ == other.flag_;
 }
 
 bool IndexFullText::operator!=(const IndexFullText &other) const { return !(*this == other); }
@@ -80,6 +99,12 @@ String IndexFullText::ToString() const {
     if (!analyzer_.empty()) {
         output_str += ", " + analyzer_;
     }
+    if (flag_ & of_stream_vbyte) {
+        output_str += ", " + CodecString();
+    }
+    if (flag_ & of_doc_reorder) {
+        output_str += ", bp reorder";
+    }
     return output_str;
 }
 
@@ -87,6 +112,12 @@ String IndexFullText::ToString() const {
 String IndexFullText::BuildOtherParamsString() const {
     std::stringstream ss;
     ss << "analyzer = " << analyzer_;
+    if (flag_ & of_stream_vbyte) {
+        ss << ", codec = " << CodecString();
+    }
+    if (flag_ & of_doc_reorder) {
+        ss << ", reorder = bp";
+    }
     return ss.str();
 }
 
@@ -94,6 +125,9 @@ String IndexFullText::BuildOtherParamsString() const {
 nlohmann::json IndexFullText::Serialize() const {
     nlohmann::json res = IndexBase::Serialize();
     res["analyzer"] = analyzer_;
+    res["codec"] = CodecString();
+    res["skip_index"] = (flag_ & of_skip_index) != 0;
+    res["reorder"] = (flag_ & of_doc_reorder) ? "bp" : "none";
     return res;
 }
 
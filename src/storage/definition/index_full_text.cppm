@@ -25,6 +25,7 @@ import create_index_info;
 import statement_common;
 import base_table_ref;
 import index_defines;
+import sparse_analyzer;
 
 namespace infinity {
 
@@ -42,6 +43,10 @@ public:
         if (analyzer.empty()) {
             analyzer_ = "standard";
         }
+        if (analyzer_ == SPARSE_ANALYZER) {
+            // sparse vector weights are stored as term frequency, there are no positions
+            flag_ &= ~of_position_list;
+        }
     };
 
     ~IndexFullText() final = default;
@@ -61,6 +66,8 @@ public:
 
     virtual String BuildOtherParamsString() const override;
 
+    String CodecString() const;
+
     virtual nlohmann::json Serialize() const override;
 
     static SharedPtr<IndexFullText> Deserialize(const nlohmann::json &index_def_json);
@@ -38,6 +38,8 @@ HnswEncodeType StringToHnswEncodeType(const String &str) {
         return HnswEncodeType::kPlain;
     } else if (str == "lvq") {
         return HnswEncodeType::kLVQ;
+    } else if (str == "pq") {
+        return HnswEncodeType::kPQ;
     } else {
         return HnswEncodeType::kInvalid;
     }
@@ -49,6 +51,8 @@ String HnswEncodeTypeToString(HnswEncodeType encode_type) {
             return "plain";
         case HnswEncodeType::kLVQ:
             return "lvq";
+        case HnswEncodeType::kPQ:
+            return "pq";
         default:
             return "invalid";
     }
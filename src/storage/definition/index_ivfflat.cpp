@@ -48,6 +48,9 @@ SharedPtr<IndexBase> IndexIVFFlat::Make(SharedPtr<String> index_name,
     if (metric_type == MetricType::kInvalid) {
         RecoverableError(Status::LackIndexParam());
     }
+    if (metric_type == MetricType::kMetricCosine) {
+        RecoverableError(Status::InvalidIndexDefinition("IVFFlat supports the ip and l2 metrics."));
+    }
     return MakeShared<IndexIVFFlat>(index_name, file_name, std::move(column_names), centroids_count, metric_type);
 }
 
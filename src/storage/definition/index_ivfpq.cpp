@@ -0,0 +1,122 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+module index_ivfpq;
+
+import infinity_exception;
+import stl;
+import index_base;
+import status;
+import third_party;
+import serialize;
+import logical_type;
+import embedding_info;
+import internal_types;
+import default_values;
+import statement_common;
+
+namespace infinity {
+
+SharedPtr<IndexBase> IndexIVFPQ::Make(SharedPtr<String> index_name,
+                                      const String &file_name,
+                                      Vector<String> column_names,
+                                      const Vector<InitParameter *> &index_param_list) {
+    SizeT centroids_count = 0;
+    MetricType metric_type = MetricType::kInvalid;
+    SizeT subspace_dim = PQ_SUBSPACE_DIM;
+    for (auto para : index_param_list) {
+        if (para->param_name_ == "centroids_count") {
+            centroids_count = std::stoi(para->param_value_);
+        } else if (para->param_name_ == "metric") {
+            metric_type = StringToMetricType(para->param_value_);
+        } else if (para->param_name_ == "subspace_dim") {
+            subspace_dim = std::stoi(para->param_value_);
+        }
+    }
+    if (metric_type == MetricType::kInvalid) {
+        RecoverableError(Status::LackIndexParam());
+    }
+    if (metric_type == MetricType::kMetricCosine) {
+        RecoverableError(Status::InvalidIndexDefinition("IVFPQ supports the ip and l2 metrics."));
+    }
+    if (subspace_dim == 0) {
+        RecoverableError(Status::InvalidIndexDefinition("IVFPQ subspace_dim should be greater than 0."));
+    }
+    return MakeShared<IndexIVFPQ>(index_name, file_name, std::move(column_names), centroids_count, metric_type, subspace_dim);
+}
+
+bool IndexIVFPQ::operator==(const IndexIVFPQ &other) const {
+    if (this->index_type_ != other.index_type_ || this->file_name_ != other.file_name_ || this->column_names_ != other.column_names_) {
+        return false;
+    }
+    return centroids_count_ == other.centroids_count_ && metric_type_ == other.metric_type_ && subspace_dim_ == other.subspace_dim_;
+}
+
+bool IndexIVFPQ::operator!=(const IndexIVFPQ &other) const { return !(*this == other); }
+
+i32 IndexIVFPQ::GetSizeInBytes() const {
+    SizeT size = IndexBase::GetSizeInBytes();
+    size += sizeof(centroids_count_);
+    size += sizeof(metric_type_);
+    size += sizeof(subspace_dim_);
+    return size;
+}
+
+void IndexIVFPQ::WriteAdv(char *&ptr) const {
+    IndexBase::WriteAdv(ptr);
+    WriteBufAdv(ptr, centroids_count_);
+    WriteBufAdv(ptr, metric_type_);
+    WriteBufAdv(ptr, subspace_dim_);
+}
+
+String IndexIVFPQ::ToString() const {
+    std::stringstream ss;
+    ss << IndexBase::ToString() << ", " << centroids_count_ << ", " << MetricTypeToString(metric_type_) << ", " << subspace_dim_;
+    return ss.str();
+}
+
+String IndexIVFPQ::BuildOtherParamsString() const {
+    std::stringstream ss;
+    ss << "metric = " << MetricTypeToString(metric_type_) << ", centroids_count = " << centroids_count_ << ", subspace_dim = " << subspace_dim_;
+    return ss.str();
+}
+
+nlohmann::json IndexIVFPQ::Serialize() const {
+    nlohmann::json res = IndexBase::Serialize();
+    res["centroids_count"] = centroids_count_;
+    res["metric_type"] = MetricTypeToString(metric_type_);
+    res["subspace_dim"] = subspace_dim_;
+    return res;
+}
+
+void IndexIVFPQ::ValidateColumnDataType(const SharedPtr<BaseTableRef> &base_table_ref, const String &column_name) {
+    auto &column_names_vector = *(base_table_ref->column_names_);
+    auto &column_types_vector = *(base_table_ref->column_types_);
+    SizeT column_id = std::find(column_names_vector.begin(), column_names_vector.end(), column_name) - column_names_vector.begin();
+    if (column_id == column_names_vector.size()) {
+        RecoverableError(Status::ColumnNotExist(column_name));
+    } else if (auto &data_type = column_types_vector[column_id];
+               data_type->type() != LogicalType::kEmbedding || static_cast<EmbeddingInfo *>(data_type->type_info().get())->Type() != kElemFloat) {
+        RecoverableError(Status::InvalidIndexDefinition(
+            fmt::format("Attempt to create IVFPQ index on column: {}, data type: {}.", column_name, data_type->ToString())));
+    }
+}
+
+} // namespace infinity
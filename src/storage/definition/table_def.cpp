@@ -57,7 +57,8 @@ bool TableDef::operator==(const TableDef &other) const {
     if (this->schema_name_.get() == nullptr || other.schema_name_.get() == nullptr || this->table_name_.get() == nullptr ||
         other.table_name_.get() == nullptr || !IsEqual(*(this->schema_name_), *(other.schema_name_)) ||
         !IsEqual(*(this->table_name_), *(other.table_name_)) || this->columns_.size() != other.columns_.size() ||
-        this->column_name2id_.size() != other.column_name2id_.size()) {
+        this->column_name2id_.size() != other.column_name2id_.size() || this->segment_capacity_ != other.segment_capacity_ ||
+        this->sort_column_id_ != other.sort_column_id_ || this->ttl_column_id_ != other.ttl_column_id_ || this->ttl_seconds_ != other.ttl_seconds_) {
         return false;
     }
     for (u32 i = 0; i < this->columns_.size(); i++) {
@@ -87,6 +88,10 @@ i32 TableDef::GetSizeInBytes() const {
         size += cd.constraints_.size() * sizeof(ConstraintType);
         size += sizeof(u8); // build_bloom_filter_
     }
+    size += sizeof(u64); // segment_capacity_
+    size += sizeof(u64); // sort_column_id_
+    size += sizeof(u64); // ttl_column_id_
+    size += sizeof(u64); // ttl_seconds_
     return size;
 }
 
@@ -107,6 +112,10 @@ void TableDef::WriteAdv(char *&ptr) const {
         u8 bf = cd.build_bloom_filter_ ? 1 : 0;
         WriteBufAdv(ptr, bf);
     }
+    WriteBufAdv<u64>(ptr, segment_capacity_);
+    WriteBufAdv<u64>(ptr, sort_column_id_);
+    WriteBufAdv<u64>(ptr, ttl_column_id_);
+    WriteBufAdv<u64>(ptr, ttl_seconds_);
     return;
 }
 
@@ -138,11 +147,19 @@ SharedPtr<TableDef> TableDef::ReadAdv(char *&ptr, i32 maxbytes) {
         cd->build_bloom_filter_ = bf;
         columns.push_back(cd);
     }
+    u64 segment_capacity = ReadBufAdv<u64>(ptr);
+    u64 sort_column_id = ReadBufAdv<u64>(ptr);
+    u64 ttl_column_id = ReadBufAdv<u64>(ptr);
+    u64 ttl_seconds = ReadBufAdv<u64>(ptr);
     maxbytes = ptr_end - ptr;
     if (maxbytes < 0) {
         UnrecoverableError("ptr goes out of range when reading TableDef");
     }
-    return TableDef::Make(MakeShared<String>(schema_name), MakeShared<String>(table_name), columns);
+    auto table_def = TableDef::Make(MakeShared<String>(schema_name), MakeShared<String>(table_name), columns);
+    table_def->set_segment_capacity(segment_capacity);
+    table_def->set_sort_column_id(sort_column_id);
+    table_def->set_ttl(ttl_column_id, ttl_seconds);
+    return table_def;
 }
 
 } // namespace infinity
\ No newline at end of file
@@ -19,6 +19,7 @@ import stl;
 
 import index_base;
 import column_def;
+import default_values;
 
 namespace infinity {
 
@@ -60,6 +61,26 @@ public:
 
     [[nodiscard]] inline const SharedPtr<String> &schema_name() const { return schema_name_; }
 
+    // The max rows of a segment of the table, a multiple of DEFAULT_BLOCK_CAPACITY up to DEFAULT_SEGMENT_CAPACITY
+    [[nodiscard]] inline SizeT segment_capacity() const { return segment_capacity_; }
+
+    inline void set_segment_capacity(SizeT segment_capacity) { segment_capacity_ = segment_capacity; }
+
+    // The column the rows of each imported or compacted segment are sorted by, INVALID_COLUMN_ID if none
+    [[nodiscard]] inline ColumnID sort_column_id() const { return sort_column_id_; }
+
+    inline void set_sort_column_id(ColumnID sort_column_id) { sort_column_id_ = sort_column_id; }
+
+    // The timestamp column whose rows older than ttl_seconds expire, INVALID_COLUMN_ID if the rows never expire
+    [[nodiscard]] inline ColumnID ttl_column_id() const { return ttl_column_id_; }
+
+    [[nodiscard]] inline u64 ttl_seconds() const { return ttl_seconds_; }
+
+    inline void set_ttl(ColumnID ttl_column_id, u64 ttl_seconds) {
+        ttl_column_id_ = ttl_column_id;
+        ttl_seconds_ = ttl_seconds;
+    }
+
     [[nodiscard]] inline SizeT GetColIdByName(const String &name) const {
         if (column_name2id_.contains(name)) {
             return column_name2id_.at(name);
@@ -77,6 +98,10 @@ private:
     SharedPtr<String> table_name_{};
     Vector<SharedPtr<ColumnDef>> columns_{};
     HashMap<String, SizeT> column_name2id_{};
+    SizeT segment_capacity_{DEFAULT_SEGMENT_CAPACITY};
+    ColumnID sort_column_id_{INVALID_COLUMN_ID};
+    ColumnID ttl_column_id_{INVALID_COLUMN_ID};
+    u64 ttl_seconds_{0};
     Vector<IndexBase> indexes_{};
 };
 
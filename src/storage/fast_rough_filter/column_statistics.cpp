@@ -0,0 +1,274 @@
+//  Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+
+module;
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+module column_statistics;
+
+import stl;
+import infinity_exception;
+import third_party;
+
+namespace infinity {
+
+namespace {
+
+// the finalizer of murmur3
+inline u64 MixKey(u64 key) {
+    key ^= key >> 33;
+    key *= 0xff51afd7ed558ccdULL;
+    key ^= key >> 33;
+    key *= 0xc4ceb9fe1a85ec53ULL;
+    key ^= key >> 33;
+    return key;
+}
+
+} // namespace
+
+void HyperLogLog::Add(u64 value_key) {
+    const u64 hash = MixKey(value_key);
+    const u32 register_id = hash >> (64 - kPrecision);
+    // the guard bit bounds the rank when the remaining bits are all zero
+    const u64 remaining = (hash << kPrecision) | (u64(1) << (kPrecision - 1));
+    const u8 rank = std::countl_zero(remaining) + 1;
+    registers_[register_id] = std::max(registers_[register_id], rank);
+}
+
+void HyperLogLog::Merge(const HyperLogLog &other) {
+    for (u32 i = 0; i < kRegisterCount; ++i) {
+        registers_[i] = std::max(registers_[i], other.registers_[i]);
+    }
+}
+
+u64 HyperLogLog::Estimate() const {
+    constexpr double m = kRegisterCount;
+    constexpr double alpha = 0.7213 / (1.0 + 1.079 / m);
+    double inverse_sum = 0;
+    u32 zero_registers = 0;
+    for (u8 rank : registers_) {
+        inverse_sum += std::ldexp(1.0, -rank);
+        zero_registers += rank == 0;
+    }
+    double estimate = alpha * m * m / inverse_sum;
+    if (estimate <= 2.5 * m && zero_registers > 0) {
+        // linear counting is more accurate for the small cardinalities
+        estimate = m * std::log(m / zero_registers);
+    }
+    return static_cast<u64>(std::llround(estimate));
+}
+
+void HyperLogLog::SerializeToStringStream(OStringStream &os) const {
+    os.write(reinterpret_cast<const char *>(registers_.data()), kRegisterCount);
+}
+
+void HyperLogLog::DeserializeFromStringStream(IStringStream &is) { is.read(reinterpret_cast<char *>(registers_.data()), kRegisterCount); }
+
+void EquiDepthHistogram::Build(Vector<double> &sample, u64 value_count) {
+    upper_bounds_.clear();
+    counts_.clear();
+    if (sample.empty()) {
+        return;
+    }
+    std::sort(sample.begin(), sample.end());
+    const SizeT sample_count = sample.size();
+    const SizeT bucket_count = std::min<SizeT>(kBucketCount, sample_count);
+    const double scale = static_cast<double>(value_count) / sample_count;
+    min_value_ = sample.front();
+    for (SizeT bucket_id = 0; bucket_id < bucket_count; ++bucket_id) {
+        SizeT begin = bucket_id * sample_count / bucket_count;
+        SizeT end = (bucket_id + 1) * sample_count / bucket_count;
+        double upper_bound = sample[end - 1];
+        double count = (end - begin) * scale;
+        // the buckets of a frequent value are one bucket
+        if (!upper_bounds_.empty() && upper_bounds_.back() == upper_bound) {
+            counts_.back() += count;
+        } else {
+            upper_bounds_.push_back(upper_bound);
+            counts_.push_back(count);
+        }
+    }
+}
+
+void EquiDepthHistogram::Merge(const EquiDepthHistogram &other) {
+    if (other.Empty()) {
+        return;
+    }
+    if (Empty()) {
+        *this = other;
+        return;
+    }
+    // the merged buckets are cut at the bounds of the two histograms where the total count passes each depth
+    Vector<double> points;
+    points.reserve(upper_bounds_.size() + other.upper_bounds_.size() + 2);
+    points.push_back(min_value_);
+    points.push_back(other.min_value_);
+    points.insert(points.end(), upper_bounds_.begin(), upper_bounds_.end());
+    points.insert(points.end(), other.upper_bounds_.begin(), other.upper_bounds_.end());
+    std::sort(points.begin(), points.end());
+    points.erase(std::unique(points.begin(), points.end()), points.end());
+
+    EquiDepthHistogram merged;
+    merged.min_value_ = points.front();
+    const double total_count = ValueCount() + other.ValueCount();
+    double previous_count = 0;
+    for (SizeT i = 0; i < points.size(); ++i) {
+        double count = LessEqualCount(points[i]) + other.LessEqualCount(points[i]);
+        double depth = total_count * (merged.counts_.size() + 1) / kBucketCount;
+        if (count < depth && i + 1 < points.size()) {
+            continue;
+        }
+        if (count <= previous_count) {
+            continue;
+        }
+        if (merged.counts_.size() == kBucketCount) {
+            merged.upper_bounds_.back() = points[i];
+            merged.counts_.back() += count - previous_count;
+        } else {
+            merged.upper_bounds_.push_back(points[i]);
+            merged.counts_.push_back(count - previous_count);
+        }
+        previous_count = count;
+    }
+    *this = std::move(merged);
+}
+
+double EquiDepthHistogram::LessEqualCount(double value) const {
+    if (Empty() || value < min_value_) {
+        return 0;
+    }
+    double count = 0;
+    for (SizeT i = 0; i < counts_.size(); ++i) {
+        if (value >= upper_bounds_[i]) {
+            count += counts_[i];
+            continue;
+        }
+        // the values are taken as uniform inside a bucket
+        double lower_bound = i == 0 ? min_value_ : upper_bounds_[i - 1];
+        if (upper_bounds_[i] > lower_bound) {
+            count += counts_[i] * (value - lower_bound) / (upper_bounds_[i] - lower_bound);
+        }
+        break;
+    }
+    return count;
+}
+
+double EquiDepthHistogram::ValueCount() const {
+    double value_count = 0;
+    for (double count : counts_) {
+        value_count += count;
+    }
+    return value_count;
+}
+
+u32 EquiDepthHistogram::GetSerializeSizeInBytes() const {
+    return sizeof(u32) + sizeof(min_value_) + counts_.size() * (sizeof(double) + sizeof(double));
+}
+
+void EquiDepthHistogram::SerializeToStringStream(OStringStream &os) const {
+    u32 bucket_count = counts_.size();
+    os.write(reinterpret_cast<const char *>(&bucket_count), sizeof(bucket_count));
+    os.write(reinterpret_cast<const char *>(&min_value_), sizeof(min_value_));
+    os.write(reinterpret_cast<const char *>(upper_bounds_.data()), bucket_count * sizeof(double));
+    os.write(reinterpret_cast<const char *>(counts_.data()), bucket_count * sizeof(double));
+}
+
+void EquiDepthHistogram::DeserializeFromStringStream(IStringStream &is) {
+    u32 bucket_count = 0;
+    is.read(reinterpret_cast<char *>(&bucket_count), sizeof(bucket_count));
+    if (bucket_count > kBucketCount) {
+        UnrecoverableError(fmt::format("EquiDepthHistogram::DeserializeFromStringStream(): bucket count {} error", bucket_count));
+    }
+    is.read(reinterpret_cast<char *>(&min_value_), sizeof(min_value_));
+    upper_bounds_.resize(bucket_count);
+    counts_.resize(bucket_count);
+    is.read(reinterpret_cast<char *>(upper_bounds_.data()), bucket_count * sizeof(double));
+    is.read(reinterpret_cast<char *>(counts_.data()), bucket_count * sizeof(double));
+}
+
+u64 ColumnStatistics::DistinctCount() const {
+    u64 value_count = row_count_ - null_count_;
+    if (value_count == 0) {
+        return 0;
+    }
+    return std::clamp<u64>(distinct_values_.Estimate(), 1, value_count);
+}
+
+Optional<double> ColumnStatistics::LessEqualFraction(double value) const {
+    double value_count = histogram_.ValueCount();
+    if (value_count <= 0) {
+        return None;
+    }
+    return std::clamp(histogram_.LessEqualCount(value) / value_count, 0.0, 1.0);
+}
+
+void ColumnStatistics::Merge(const ColumnStatistics &other) {
+    if (other.Empty()) {
+        return;
+    }
+    if (Empty()) {
+        *this = other;
+        return;
+    }
+    row_count_ += other.row_count_;
+    null_count_ += other.null_count_;
+    distinct_values_.Merge(other.distinct_values_);
+    histogram_.Merge(other.histogram_);
+}
+
+u32 ColumnStatistics::GetSerializeSizeInBytes() const {
+    return sizeof(row_count_) + sizeof(null_count_) + HyperLogLog::kRegisterCount + histogram_.GetSerializeSizeInBytes();
+}
+
+void ColumnStatistics::SerializeToStringStream(OStringStream &os) const {
+    os.write(reinterpret_cast<const char *>(&row_count_), sizeof(row_count_));
+    os.write(reinterpret_cast<const char *>(&null_count_), sizeof(null_count_));
+    distinct_values_.SerializeToStringStream(os);
+    histogram_.SerializeToStringStream(os);
+}
+
+void ColumnStatistics::DeserializeFromStringStream(IStringStream &is) {
+    is.read(reinterpret_cast<char *>(&row_count_), sizeof(row_count_));
+    is.read(reinterpret_cast<char *>(&null_count_), sizeof(null_count_));
+    distinct_values_.DeserializeFromStringStream(is);
+    histogram_.DeserializeFromStringStream(is);
+}
+
+ColumnStatistics ColumnStatisticsCollector::Finish() {
+    if (!sample_.empty()) {
+        statistics_.histogram_.Build(sample_, statistics_.row_count_ - statistics_.null_count_);
+        sample_.clear();
+    }
+    return std::move(statistics_);
+}
+
+void ColumnStatisticsCollector::Sample(double value) {
+    if (sample_.size() < kSampleSize) {
+        sample_.push_back(value);
+    } else {
+        // xorshift64
+        random_state_ ^= random_state_ << 13;
+        random_state_ ^= random_state_ >> 7;
+        random_state_ ^= random_state_ << 17;
+        u64 sample_id = random_state_ % (sampled_count_ + 1);
+        if (sample_id < kSampleSize) {
+            sample_[sample_id] = value;
+        }
+    }
+    ++sampled_count_;
+}
+
+} // namespace infinity
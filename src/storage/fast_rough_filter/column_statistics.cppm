@@ -0,0 +1,134 @@
+//  Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+
+module;
+
+export module column_statistics;
+
+import stl;
+
+namespace infinity {
+
+// HyperLogLog sketch of the distinct values of a column, the sketches of two segments merge into the sketch of both.
+export class HyperLogLog {
+public:
+    static constexpr u32 kPrecision = 10;
+    static constexpr u32 kRegisterCount = 1u << kPrecision; // about 3% standard error
+
+    // value_key: the u64 key of a value, it is hashed again here so that close keys spread over the registers
+    void Add(u64 value_key);
+
+    void Merge(const HyperLogLog &other);
+
+    u64 Estimate() const;
+
+    void SerializeToStringStream(OStringStream &os) const;
+
+    void DeserializeFromStringStream(IStringStream &is);
+
+private:
+    Array<u8, kRegisterCount> registers_{};
+};
+
+// Equi-depth histogram of a numeric column, bucket i holds about counts_[i] values in (upper_bounds_[i - 1], upper_bounds_[i]],
+// the first bucket starts at min_value_.
+export class EquiDepthHistogram {
+public:
+    static constexpr u32 kBucketCount = 64;
+
+    bool Empty() const { return counts_.empty(); }
+
+    // sample: a uniform sample of the value_count values of the column, sorted here
+    void Build(Vector<double> &sample, u64 value_count);
+
+    void Merge(const EquiDepthHistogram &other);
+
+    // The estimated number of values <= value.
+    double LessEqualCount(double value) const;
+
+    double ValueCount() const;
+
+    u32 GetSerializeSizeInBytes() const;
+
+    void SerializeToStringStream(OStringStream &os) const;
+
+    void DeserializeFromStringStream(IStringStream &is);
+
+private:
+    double min_value_{};
+    Vector<double> upper_bounds_;
+    Vector<double> counts_;
+};
+
+// The statistics of a column in a segment, or in a table after merging the ones of its segments.
+export struct ColumnStatistics {
+    u64 row_count_{}; // visible rows when built, 0 if the column has no statistics
+    u64 null_count_{};
+    HyperLogLog distinct_values_;
+    EquiDepthHistogram histogram_; // only for numeric columns
+
+    bool Empty() const { return row_count_ == 0; }
+
+    u64 DistinctCount() const;
+
+    // The estimated fraction of the non-null values <= value, None if the column has no histogram.
+    Optional<double> LessEqualFraction(double value) const;
+
+    void Merge(const ColumnStatistics &other);
+
+    u32 GetSerializeSizeInBytes() const;
+
+    void SerializeToStringStream(OStringStream &os) const;
+
+    void DeserializeFromStringStream(IStringStream &is);
+};
+
+// Collects the statistics of a column in one pass over its rows. The histogram is built on a reservoir sample of the values, so
+// the memory doesn't grow with the rows of a segment.
+export class ColumnStatisticsCollector {
+public:
+    static constexpr SizeT kSampleSize = 4096;
+
+    explicit ColumnStatisticsCollector(bool build_histogram) : build_histogram_(build_histogram) {}
+
+    void AddNull() {
+        ++statistics_.row_count_;
+        ++statistics_.null_count_;
+    }
+
+    void AddValue(u64 value_key) {
+        ++statistics_.row_count_;
+        statistics_.distinct_values_.Add(value_key);
+    }
+
+    void AddValue(u64 value_key, double numeric_value) {
+        AddValue(value_key);
+        if (build_histogram_) {
+            Sample(numeric_value);
+        }
+    }
+
+    ColumnStatistics Finish();
+
+private:
+    void Sample(double value);
+
+    const bool build_histogram_;
+    ColumnStatistics statistics_;
+    Vector<double> sample_;
+    u64 sampled_count_{};
+    u64 random_state_{0x9E3779B97F4A7C15ULL};
+};
+
+} // namespace infinity
@@ -14,6 +14,7 @@
 
 module;
 
+#include "base64.hpp"
 #include <map> // fix nlohmann::json compile error in release mode
 module fast_rough_filter;
 import stl;
@@ -26,15 +27,87 @@ import third_party;
 import local_file_system;
 import infinity_exception;
 import filter_expression_push_down_helper;
+import column_statistics;
 
 namespace infinity {
 
+// the column statistics follow the zone map, so the zone map is written, maybe empty, when there are statistics
+u32 FastRoughFilter::GetZoneMapSerializeSizeInBytes() const {
+    if (zone_min_max_data_filters_.empty() && column_statistics_.empty()) {
+        return 0;
+    }
+    u32 zone_count = zone_min_max_data_filters_.size();
+    u32 total_binary_bytes = sizeof(zone_row_count_) + sizeof(zone_count);
+    for (const auto &zone_filter : zone_min_max_data_filters_) {
+        total_binary_bytes += zone_filter.GetSerializeSizeInBytes();
+    }
+    return total_binary_bytes;
+}
+
+void FastRoughFilter::SerializeZoneMapToStringStream(OStringStream &os) const {
+    if (zone_min_max_data_filters_.empty() && column_statistics_.empty()) {
+        return;
+    }
+    u32 zone_count = zone_min_max_data_filters_.size();
+    os.write(reinterpret_cast<const char *>(&zone_row_count_), sizeof(zone_row_count_));
+    os.write(reinterpret_cast<const char *>(&zone_count), sizeof(zone_count));
+    for (const auto &zone_filter : zone_min_max_data_filters_) {
+        zone_filter.SerializeToStringStream(os);
+    }
+}
+
+void FastRoughFilter::DeserializeZoneMapFromStringStream(IStringStream &is) {
+    u32 zone_count = 0;
+    is.read(reinterpret_cast<char *>(&zone_row_count_), sizeof(zone_row_count_));
+    is.read(reinterpret_cast<char *>(&zone_count), sizeof(zone_count));
+    zone_min_max_data_filters_.clear();
+    zone_min_max_data_filters_.resize(zone_count);
+    for (auto &zone_filter : zone_min_max_data_filters_) {
+        zone_filter.DeserializeFromStringStream(is);
+    }
+}
+
+u32 FastRoughFilter::GetColumnStatisticsSerializeSizeInBytes() const {
+    if (column_statistics_.empty()) {
+        return 0;
+    }
+    u32 column_count = column_statistics_.size();
+    u32 total_binary_bytes = sizeof(column_count);
+    for (const auto &statistics : column_statistics_) {
+        total_binary_bytes += statistics.GetSerializeSizeInBytes();
+    }
+    return total_binary_bytes;
+}
+
+void FastRoughFilter::SerializeColumnStatisticsToStringStream(OStringStream &os) const {
+    if (column_statistics_.empty()) {
+        return;
+    }
+    u32 column_count = column_statistics_.size();
+    os.write(reinterpret_cast<const char *>(&column_count), sizeof(column_count));
+    for (const auto &statistics : column_statistics_) {
+        statistics.SerializeToStringStream(os);
+    }
+}
+
+void FastRoughFilter::DeserializeColumnStatisticsFromStringStream(IStringStream &is) {
+    u32 column_count = 0;
+    is.read(reinterpret_cast<char *>(&column_count), sizeof(column_count));
+    column_statistics_.clear();
+    column_statistics_.resize(column_count);
+    for (auto &statistics : column_statistics_) {
+        statistics.DeserializeFromStringStream(is);
+    }
+}
+
 String FastRoughFilter::SerializeToString() const {
     if (HaveMinMaxFilter()) {
         u32 probabilistic_data_filter_binary_bytes = probabilistic_data_filter_->GetSerializeSizeInBytes();
         u32 min_max_data_filter_binary_bytes = min_max_data_filter_->GetSerializeSizeInBytes();
-        u32 total_binary_bytes =
-            sizeof(total_binary_bytes) + sizeof(build_time_) + probabilistic_data_filter_binary_bytes + min_max_data_filter_binary_bytes;
+        u32 zone_map_binary_bytes = GetZoneMapSerializeSizeInBytes();
+        u32 column_statistics_binary_bytes = GetColumnStatisticsSerializeSizeInBytes();
+        u32 total_binary_bytes = sizeof(total_binary_bytes) + sizeof(build_time_) + probabilistic_data_filter_binary_bytes +
+                                 min_max_data_filter_binary_bytes + zone_map_binary_bytes + column_statistics_binary_bytes;
         String save_to_binary;
         save_to_binary.reserve(total_binary_bytes);
         OStringStream os(std::move(save_to_binary));
@@ -42,10 +115,15 @@ String FastRoughFilter::SerializeToString() const {
         os.write(reinterpret_cast<const char *>(&build_time_), sizeof(build_time_));
         probabilistic_data_filter_->SerializeToStringStream(os, probabilistic_data_filter_binary_bytes);
         min_max_data_filter_->SerializeToStringStream(os, min_max_data_filter_binary_bytes);
+        // the zone map and the column statistics are the optional tail
+        SerializeZoneMapToStringStream(os);
+        SerializeColumnStatisticsToStringStream(os);
         if (os.view().size() != total_binary_bytes) {
             UnrecoverableError("BUG: FastRoughFilter::SerializeToString(): save size error");
         }
         return std::move(os).str();
+    } else if (invalidated_.test(std::memory_order_acquire)) {
+        return {};
     } else {
         UnrecoverableError("FastRoughFilter::SerializeToString(): No FastRoughFilter data.");
         return {};
@@ -53,6 +131,10 @@ String FastRoughFilter::SerializeToString() const {
 }
 
 void FastRoughFilter::DeserializeFromString(const String &str) {
+    if (str.empty()) {
+        Invalidate();
+        return;
+    }
     // load necessary parts
     IStringStream is(str);
     u32 total_binary_bytes;
@@ -69,6 +151,12 @@ void FastRoughFilter::DeserializeFromString(const String &str) {
         min_max_data_filter_ = MakeUnique<MinMaxDataFilter>();
     }
     min_max_data_filter_->DeserializeFromStringStream(is);
+    if (is and u32(is.tellg()) < total_binary_bytes) {
+        DeserializeZoneMapFromStringStream(is);
+    }
+    if (is and u32(is.tellg()) < total_binary_bytes) {
+        DeserializeColumnStatisticsFromStringStream(is);
+    }
     // check position
     if (!is or u32(is.tellg()) != is.view().size()) {
         UnrecoverableError("FastRoughFilter::DeserializeFromString(): load size error");
@@ -82,6 +170,21 @@ void FastRoughFilter::SaveToJsonFile(nlohmann::json &entry_json) const {
         entry_json[JsonTagBuildTime] = build_time_;
         probabilistic_data_filter_->SaveToJsonFile(entry_json);
         min_max_data_filter_->SaveToJsonFile(entry_json);
+        if (!zone_min_max_data_filters_.empty()) {
+            entry_json[JsonTagZoneRowCount] = zone_row_count_;
+            for (const auto &zone_filter : zone_min_max_data_filters_) {
+                nlohmann::json zone_json;
+                zone_filter.SaveToJsonFile(zone_json);
+                entry_json[JsonTagZoneMap].emplace_back(std::move(zone_json));
+            }
+        }
+        if (!column_statistics_.empty()) {
+            String save_to_binary;
+            save_to_binary.reserve(GetColumnStatisticsSerializeSizeInBytes());
+            OStringStream os(std::move(save_to_binary));
+            SerializeColumnStatisticsToStringStream(os);
+            entry_json[JsonTagColumnStatistics] = base64::to_base64(os.view());
+        }
     } else {
         LOG_TRACE("FastRoughFilter::SaveToJsonFile(): No MinMax data.");
     }
@@ -90,7 +193,7 @@ void FastRoughFilter::SaveToJsonFile(nlohmann::json &entry_json) const {
 // will throw in caller function if return false
 // called in deserialize, remove unnecessary lock
 bool FastRoughFilter::LoadFromJsonFile(const nlohmann::json &entry_json) {
-    if (HaveMinMaxFilter()) [[unlikely]] {
+    if (finished_build_minmax_filter_.test(std::memory_order_acquire)) [[unlikely]] {
         UnrecoverableError("BUG: FastRoughFilter::LoadFromJsonFile(): Already have data.");
     }
     // LOG_TRACE("FastRoughFilter::LoadFromJsonFile(): try to load filter data from json.");
@@ -124,6 +227,28 @@ bool FastRoughFilter::LoadFromJsonFile(const nlohmann::json &entry_json) {
             LOG_TRACE("FastRoughFilter::LoadFromJsonFile(): Cannot load MinMaxDataFilter data from json.");
         }
     }
+    if (entry_json.contains(JsonTagZoneMap)) {
+        // load the zone map of a block
+        zone_row_count_ = entry_json[JsonTagZoneRowCount];
+        for (const auto &zone_json : entry_json[JsonTagZoneMap]) {
+            auto &zone_filter = zone_min_max_data_filters_.emplace_back();
+            if (!zone_filter.LoadFromJsonFile(zone_json)) {
+                load_success = false;
+                LOG_TRACE("FastRoughFilter::LoadFromJsonFile(): Cannot load zone MinMaxDataFilter data from json.");
+                break;
+            }
+        }
+    }
+    if (entry_json.contains(JsonTagColumnStatistics)) {
+        String statistics_base64 = entry_json[JsonTagColumnStatistics];
+        auto statistics_binary = base64::from_base64(statistics_base64);
+        IStringStream is(statistics_binary);
+        DeserializeColumnStatisticsFromStringStream(is);
+        if (!is or u32(is.tellg()) != is.view().size()) {
+            load_success = false;
+            LOG_TRACE("FastRoughFilter::LoadFromJsonFile(): Cannot load column statistics from json.");
+        }
+    }
     if (load_success) {
         FinishBuildMinMaxFilterTask();
         // LOG_TRACE("FastRoughFilter::LoadFromJsonFile(): successfully load FastRoughFilter data from json.");
@@ -133,4 +258,35 @@ bool FastRoughFilter::LoadFromJsonFile(const nlohmann::json &entry_json) {
     return load_success;
 }
 
-} // namespace infinity
\ No newline at end of file
+Optional<Vector<Pair<u32, u32>>> FastRoughFilterEvaluator::EvaluateZones(TxnTimeStamp query_ts, const FastRoughFilter &filter, u32 row_count) const {
+    if (!filter.HaveZoneMap() || query_ts < filter.GetMinMaxBuildTime()) {
+        return None;
+    }
+    const u32 zone_row_count = filter.zone_row_count();
+    const u32 zone_count = std::min<u32>(filter.zone_count(), (row_count + zone_row_count - 1) / zone_row_count);
+    Vector<Pair<u32, u32>> row_ranges;
+    for (u32 zone_id = 0; zone_id < zone_count; ++zone_id) {
+        if (!EvaluateZoneInner(filter, zone_id)) {
+            continue;
+        }
+        u32 zone_begin = zone_id * zone_row_count;
+        u32 zone_end = std::min(zone_begin + zone_row_count, row_count);
+        if (!row_ranges.empty() && row_ranges.back().second == zone_begin) {
+            row_ranges.back().second = zone_end;
+        } else {
+            row_ranges.emplace_back(zone_begin, zone_end);
+        }
+    }
+    // the rows appended after the zone map was built
+    u32 zone_map_end = zone_count * zone_row_count;
+    if (zone_map_end < row_count) {
+        if (!row_ranges.empty() && row_ranges.back().second == zone_map_end) {
+            row_ranges.back().second = row_count;
+        } else {
+            row_ranges.emplace_back(zone_map_end, row_count);
+        }
+    }
+    return row_ranges;
+}
+
+} // namespace infinity
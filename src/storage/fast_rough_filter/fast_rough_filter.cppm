@@ -25,6 +25,7 @@ import third_party;
 import local_file_system;
 import infinity_exception;
 import filter_expression_push_down_helper;
+import column_statistics;
 
 namespace infinity {
 
@@ -34,21 +35,34 @@ export class FastRoughFilterEvaluator;
 // used in block_entry and segment_entry
 // sealed segment will have minmax filter
 // some columns may have bloom filter
+// the blocks may have a zone map: a minmax filter per zone of zone_row_count_ rows
+// the segment has the statistics of the columns with a filter, for the estimates of the planner
 export class FastRoughFilter {
 private:
     friend class BuildFastRoughFilterTask;
     friend class FastRoughFilterEvaluator;
     static constexpr std::string_view JsonTagBuildTime = "fast_rough_filter_build_time";
+    static constexpr std::string_view JsonTagZoneRowCount = "zone_row_count";
+    static constexpr std::string_view JsonTagZoneMap = "zone_min_max_data_filters";
+    static constexpr std::string_view JsonTagColumnStatistics = "column_statistics";
 
     // in minmax build task, first set build_time_ to be the begin_ts of the task txn
     // if set to valid time, we know one job has started
     mutable std::mutex mutex_check_task_start_;
     TxnTimeStamp build_time_{UNCOMMIT_TS};     // for minmax filter
     atomic_flag finished_build_minmax_filter_; // for minmax filter
+    atomic_flag invalidated_;                  // set once the data is updated in place, until the segment is compacted
     UniquePtr<MinMaxDataFilter> min_max_data_filter_;
 
     UniquePtr<ProbabilisticDataFilter> probabilistic_data_filter_;
 
+    // built with the minmax filter, empty if no zone map
+    u32 zone_row_count_{};
+    Vector<MinMaxDataFilter> zone_min_max_data_filters_;
+
+    // built with the minmax filter of a segment, empty for a block
+    Vector<ColumnStatistics> column_statistics_;
+
 public:
     // bloom filter test
     inline bool MayContain(TxnTimeStamp query_ts, ColumnID column_id, const Value &value) const {
@@ -60,6 +74,46 @@ public:
         return min_max_data_filter_->MayInRange(column_id, value, compare_type);
     }
 
+    // minmax filter test that every value of the column is in range
+    inline bool AllInRange(ColumnID column_id, const Value &value, FilterCompareType compare_type) const {
+        return min_max_data_filter_->AllInRange(column_id, value, compare_type);
+    }
+
+    // AllInRange of a filter covering every row, false if the filter isn't built or is invalidated
+    inline bool BuiltAllInRange(ColumnID column_id, const Value &value, FilterCompareType compare_type) const {
+        return HaveMinMaxFilter() && AllInRange(column_id, value, compare_type);
+    }
+
+    // minmax filter test of the rows [zone_id * zone_row_count(), (zone_id + 1) * zone_row_count()) of a block
+    inline bool ZoneMayInRange(u32 zone_id, ColumnID column_id, const Value &value, FilterCompareType compare_type) const {
+        return zone_min_max_data_filters_[zone_id].MayInRange(column_id, value, compare_type);
+    }
+
+    // The exact min and max of a numeric column of the rows, if the filter was built after their last change at data_ts and before
+    // query_ts. None otherwise.
+    inline Optional<Pair<Value, Value>> GetExactMinMax(TxnTimeStamp query_ts, TxnTimeStamp data_ts, ColumnID column_id) const {
+        if (!HaveExactMinMaxFilter(query_ts, data_ts)) {
+            return None;
+        }
+        return min_max_data_filter_->GetMinMax(column_id);
+    }
+
+    inline u32 zone_row_count() const { return zone_row_count_; }
+
+    inline u32 zone_count() const { return zone_min_max_data_filters_.size(); }
+
+    // nullptr if the filter isn't built or the column has no statistics
+    inline const ColumnStatistics *GetColumnStatistics(ColumnID column_id) const {
+        if (!HaveMinMaxFilter() || column_id >= column_statistics_.size() || column_statistics_[column_id].Empty()) {
+            return nullptr;
+        }
+        return &column_statistics_[column_id];
+    }
+
+    // The filters no longer hold after the values are updated in place.
+    void Invalidate() { invalidated_.test_and_set(std::memory_order_release); }
+
+    // Empty when the filter is invalidated.
     String SerializeToString() const;
 
     void DeserializeFromString(const String &str);
@@ -69,7 +123,16 @@ public:
     bool LoadFromJsonFile(const nlohmann::json &entry_json);
 
 private:
-    inline bool HaveMinMaxFilter() const { return finished_build_minmax_filter_.test(std::memory_order_acquire); }
+    inline bool HaveMinMaxFilter() const {
+        return finished_build_minmax_filter_.test(std::memory_order_acquire) && !invalidated_.test(std::memory_order_acquire);
+    }
+
+    // the minmax filter covers exactly the rows last changed at data_ts, and query_ts sees it
+    inline bool HaveExactMinMaxFilter(TxnTimeStamp query_ts, TxnTimeStamp data_ts) const {
+        return HaveMinMaxFilter() && data_ts < GetMinMaxBuildTime() && GetMinMaxBuildTime() <= query_ts;
+    }
+
+    inline bool HaveZoneMap() const { return HaveMinMaxFilter() && !zone_min_max_data_filters_.empty(); }
 
     // call after check finished_build_minmax_filter_, thus no need to lock
     inline TxnTimeStamp GetMinMaxBuildTime() const { return build_time_; }
@@ -92,6 +155,15 @@ private:
         min_max_data_filter_ = MakeUnique<MinMaxDataFilter>(column_count);
     }
 
+    void BeginBuildZoneMap(u32 zone_row_count, u32 zone_count, u32 column_count) {
+        zone_row_count_ = zone_row_count;
+        zone_min_max_data_filters_.assign(zone_count, MinMaxDataFilter(column_count));
+    }
+
+    void BeginBuildColumnStatistics(u32 column_count) { column_statistics_.assign(column_count, ColumnStatistics()); }
+
+    void BuildColumnStatistics(ColumnID column_id, ColumnStatistics &&statistics) { column_statistics_[column_id] = std::move(statistics); }
+
     void FinishBuildMinMaxFilterTask() { finished_build_minmax_filter_.test_and_set(std::memory_order_release); }
 
     void BuildProbabilisticDataFilter(TxnTimeStamp begin_ts, ColumnID column_id, u64 *data, u32 count) {
@@ -103,6 +175,25 @@ private:
     void BuildMinMaxDataFilter(ColumnID column_id, MinMaxInnerValT &&min, MinMaxInnerValT &&max) {
         min_max_data_filter_->Build<OriginalValueType>(column_id, std::forward<MinMaxInnerValT>(min), std::forward<MinMaxInnerValT>(max));
     }
+
+    template <typename OriginalValueType, typename MinMaxInnerValT>
+    void BuildZoneMinMaxDataFilter(u32 zone_id, ColumnID column_id, MinMaxInnerValT &&min, MinMaxInnerValT &&max) {
+        zone_min_max_data_filters_[zone_id].Build<OriginalValueType>(column_id,
+                                                                     std::forward<MinMaxInnerValT>(min),
+                                                                     std::forward<MinMaxInnerValT>(max));
+    }
+
+    u32 GetZoneMapSerializeSizeInBytes() const;
+
+    void SerializeZoneMapToStringStream(OStringStream &os) const;
+
+    void DeserializeZoneMapFromStringStream(IStringStream &is);
+
+    u32 GetColumnStatisticsSerializeSizeInBytes() const;
+
+    void SerializeColumnStatisticsToStringStream(OStringStream &os) const;
+
+    void DeserializeColumnStatisticsFromStringStream(IStringStream &is);
 };
 
 class FastRoughFilterEvaluator {
@@ -122,7 +213,36 @@ public:
         return EvaluateInner(query_ts, filter);
     }
 
+    // A segment filter is only worth checking when it can rule out several blocks at once, the filter of a single block decides
+    // the same. True, i.e. not ruled out, for a segment of less than kSegmentFilterMinBlockCount blocks.
+    static constexpr u32 kSegmentFilterMinBlockCount = 2;
+
+    inline bool EvaluateSegment(TxnTimeStamp query_ts, const FastRoughFilter &segment_filter, u32 block_count) const {
+        if (block_count < kSegmentFilterMinBlockCount) {
+            return true;
+        }
+        return Evaluate(query_ts, segment_filter);
+    }
+
+    // The row ranges [begin, end) of a block of row_count rows which are not ruled out by the zone map of the block, adjacent zones
+    // are merged. None if the zone map can't be applied, then all the rows may pass. Call after Evaluate() of the block is true.
+    Optional<Vector<Pair<u32, u32>>> EvaluateZones(TxnTimeStamp query_ts, const FastRoughFilter &filter, u32 row_count) const;
+
+    // True if every row passes, i.e. the rows needn't be checked, the filter being built after their last change at data_ts. False
+    // if it can't be decided, only exact min and max decide it.
+    inline bool EvaluateAllPass(TxnTimeStamp query_ts, const FastRoughFilter &filter, TxnTimeStamp data_ts) const {
+        if (!filter.HaveExactMinMaxFilter(query_ts, data_ts)) {
+            return false;
+        }
+        return EvaluateAllPassInner(filter);
+    }
+
     virtual bool EvaluateInner(TxnTimeStamp query_ts, const FastRoughFilter &filter) const = 0;
+
+    virtual bool EvaluateAllPassInner(const FastRoughFilter &filter) const = 0;
+
+    // the zone only has a minmax filter
+    virtual bool EvaluateZoneInner(const FastRoughFilter &filter, u32 zone_id) const = 0;
 };
 
 } // namespace infinity
\ No newline at end of file
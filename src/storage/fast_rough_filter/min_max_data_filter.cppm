@@ -84,6 +84,46 @@ public:
 
     [[nodiscard]] inline bool MayInRange(const Value &value, FilterCompareType compare_type) const { return MayInRangeT(value, compare_type); }
 
+    // false if it can't be decided, i.e. for varchar whose min and max are truncated
+    [[nodiscard]] inline bool AllInRange(const Value &value, FilterCompareType compare_type) const {
+        if constexpr (std::is_same_v<InnerValueType, OriginalValueType>) {
+            OriginalValueType original_value = value.GetValue<OriginalValueType>();
+            switch (compare_type) {
+                case FilterCompareType::kLessEqual: {
+                    return max_ <= original_value;
+                }
+                case FilterCompareType::kGreaterEqual: {
+                    return min_ >= original_value;
+                }
+                default: {
+                    UnrecoverableError("InnerMinMaxDataFilterDerived::AllInRange(): Unexpected compare type!");
+                    return false;
+                }
+            }
+        } else {
+            return false;
+        }
+    }
+
+    // None for the types which aren't numeric
+    [[nodiscard]] inline Optional<Pair<Value, Value>> GetMinMax() const {
+        if constexpr (std::is_same_v<OriginalValueType, TinyIntT>) {
+            return MakePair(Value::MakeTinyInt(min_), Value::MakeTinyInt(max_));
+        } else if constexpr (std::is_same_v<OriginalValueType, SmallIntT>) {
+            return MakePair(Value::MakeSmallInt(min_), Value::MakeSmallInt(max_));
+        } else if constexpr (std::is_same_v<OriginalValueType, IntegerT>) {
+            return MakePair(Value::MakeInt(min_), Value::MakeInt(max_));
+        } else if constexpr (std::is_same_v<OriginalValueType, BigIntT>) {
+            return MakePair(Value::MakeBigInt(min_), Value::MakeBigInt(max_));
+        } else if constexpr (std::is_same_v<OriginalValueType, FloatT>) {
+            return MakePair(Value::MakeFloat(min_), Value::MakeFloat(max_));
+        } else if constexpr (std::is_same_v<OriginalValueType, DoubleT>) {
+            return MakePair(Value::MakeDouble(min_), Value::MakeDouble(max_));
+        } else {
+            return None;
+        }
+    }
+
     [[nodiscard]] u32 SizeInBytes() const { return sizeof(min_) + sizeof(max_); }
 
     void SaveToOStringStream(OStringStream &os) const {
@@ -180,6 +220,24 @@ public:
                           min_max_filters_[column_id]);
     }
 
+    // Whether every value of the column is in range, false if it can't be decided.
+    [[nodiscard]] inline bool AllInRange(ColumnID column_id, const Value &value, FilterCompareType compare_type) const {
+        return std::visit(Overload{[](const std::monostate &) -> bool { return false; },
+                                   [&value, compare_type]<typename T>(const InnerMinMaxDataFilterT<T> &filter) -> bool {
+                                       return filter.AllInRange(value, compare_type);
+                                   }},
+                          min_max_filters_[column_id]);
+    }
+
+    // The min and max of a numeric column, None for the other columns.
+    [[nodiscard]] inline Optional<Pair<Value, Value>> GetMinMax(ColumnID column_id) const {
+        return std::visit(Overload{[](const std::monostate &) -> Optional<Pair<Value, Value>> { return None; },
+                                   []<typename T>(const InnerMinMaxDataFilterT<T> &filter) -> Optional<Pair<Value, Value>> {
+                                       return filter.GetMinMax();
+                                   }},
+                          min_max_filters_[column_id]);
+    }
+
     // used in build_fast_rough_filter_task
     template <typename OriginalValueType, typename MinMaxInnerValT>
     void Build(ColumnID column_id, MinMaxInnerValT &&min, MinMaxInnerValT &&max) {
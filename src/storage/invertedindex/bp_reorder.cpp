@@ -0,0 +1,155 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+module;
+
+module bp_reorder;
+
+import stl;
+
+namespace infinity {
+
+namespace {
+
+constexpr u32 BP_MAX_ITERATIONS = 20;
+constexpr SizeT BP_MIN_PARTITION_SIZE = 32;
+constexpr u32 BP_MAX_DEPTH = 40;
+
+class BPReorderer {
+public:
+    BPReorderer(Vector<u32> &&doc_term_offsets, Vector<u32> &&doc_terms, u32 term_count, SizeT doc_count)
+        : doc_term_offsets_(std::move(doc_term_offsets)), doc_terms_(std::move(doc_terms)), left_degrees_(term_count, 0),
+          right_degrees_(term_count, 0), log2_table_(doc_count + 2, 0.0f) {
+        for (SizeT i = 1; i < log2_table_.size(); ++i) {
+            log2_table_[i] = std::log2(static_cast<float>(i));
+        }
+    }
+
+    // split docs into two halves so that fewer terms are in both, and recurse into the halves
+    void Bisect(u32 *docs, SizeT doc_count, u32 depth);
+
+private:
+    // A term in d of the n docs of a half costs about d * log2(n / (d + 1)) bits of doc id gaps there.
+    // Returns the decrease of the cost when doc moves from one half to the other, the halves are of the same size.
+    float MoveGain(u32 doc, const Vector<u32> &from_degrees, const Vector<u32> &to_degrees) const {
+        float gain = 0.0f;
+        for (u32 i = doc_term_offsets_[doc]; i < doc_term_offsets_[doc + 1]; ++i) {
+            u32 term = doc_terms_[i];
+            u32 from_degree = from_degrees[term];
+            u32 to_degree = to_degrees[term];
+            gain += (from_degree - 1) * log2_table_[from_degree] - from_degree * log2_table_[from_degree + 1];
+            gain += (to_degree + 1) * log2_table_[to_degree + 2] - to_degree * log2_table_[to_degree + 1];
+        }
+        return gain;
+    }
+
+    void AddDegrees(const u32 *docs, SizeT doc_count, Vector<u32> &degrees, i32 delta) {
+        for (SizeT i = 0; i < doc_count; ++i) {
+            for (u32 j = doc_term_offsets_[docs[i]]; j < doc_term_offsets_[docs[i] + 1]; ++j) {
+                degrees[doc_terms_[j]] += delta;
+            }
+        }
+    }
+
+    const Vector<u32> doc_term_offsets_;
+    const Vector<u32> doc_terms_;
+    // docs having the term in each half of the partition being bisected
+    Vector<u32> left_degrees_;
+    Vector<u32> right_degrees_;
+    Vector<float> log2_table_;
+};
+
+void BPReorderer::Bisect(u32 *docs, SizeT doc_count, u32 depth) {
+    if (doc_count < 2 * BP_MIN_PARTITION_SIZE or depth >= BP_MAX_DEPTH) {
+        return;
+    }
+    SizeT left_count = doc_count / 2;
+    SizeT right_count = doc_count - left_count;
+    u32 *left = docs;
+    u32 *right = docs + left_count;
+    AddDegrees(left, left_count, left_degrees_, 1);
+    AddDegrees(right, right_count, right_degrees_, 1);
+
+    Vector<Pair<float, u32>> left_gains(left_count);
+    Vector<Pair<float, u32>> right_gains(right_count);
+    auto by_gain_desc = [](const Pair<float, u32> &lhs, const Pair<float, u32> &rhs) { return lhs.first > rhs.first; };
+    for (u32 iteration = 0; iteration < BP_MAX_ITERATIONS; ++iteration) {
+        for (SizeT i = 0; i < left_count; ++i) {
+            left_gains[i] = {MoveGain(left[i], left_degrees_, right_degrees_), left[i]};
+        }
+        for (SizeT i = 0; i < right_count; ++i) {
+            right_gains[i] = {MoveGain(right[i], right_degrees_, left_degrees_), right[i]};
+        }
+        std::sort(left_gains.begin(), left_gains.end(), by_gain_desc);
+        std::sort(right_gains.begin(), right_gains.end(), by_gain_desc);
+        // swap the pairs whose moves gain together
+        SizeT swap_count = 0;
+        while (swap_count < left_count and swap_count < right_count and left_gains[swap_count].first + right_gains[swap_count].first > 0) {
+            ++swap_count;
+        }
+        if (swap_count == 0) {
+            break;
+        }
+        for (SizeT i = 0; i < swap_count; ++i) {
+            const u32 left_doc = left_gains[i].second;
+            const u32 right_doc = right_gains[i].second;
+            AddDegrees(&left_doc, 1, left_degrees_, -1);
+            AddDegrees(&left_doc, 1, right_degrees_, 1);
+            AddDegrees(&right_doc, 1, right_degrees_, -1);
+            AddDegrees(&right_doc, 1, left_degrees_, 1);
+            std::swap(left_gains[i].second, right_gains[i].second);
+        }
+        for (SizeT i = 0; i < left_count; ++i) {
+            left[i] = left_gains[i].second;
+        }
+        for (SizeT i = 0; i < right_count; ++i) {
+            right[i] = right_gains[i].second;
+        }
+    }
+    AddDegrees(left, left_count, left_degrees_, -1);
+    AddDegrees(right, right_count, right_degrees_, -1);
+
+    Bisect(left, left_count, depth + 1);
+    Bisect(right, right_count, depth + 1);
+}
+
+} // namespace
+
+Vector<u32> BPReorder(const Vector<u32> &doc_term_offsets, const Vector<u32> &doc_terms, u32 term_count) {
+    const SizeT doc_count = doc_term_offsets.size() - 1;
+    // a term of a single doc gains nothing wherever the doc goes
+    Vector<u32> doc_freqs(term_count, 0);
+    for (u32 term : doc_terms) {
+        ++doc_freqs[term];
+    }
+    Vector<u32> shared_term_offsets(doc_count + 1, 0);
+    Vector<u32> shared_terms;
+    for (SizeT doc = 0; doc < doc_count; ++doc) {
+        for (u32 i = doc_term_offsets[doc]; i < doc_term_offsets[doc + 1]; ++i) {
+            if (doc_freqs[doc_terms[i]] > 1) {
+                shared_terms.push_back(doc_terms[i]);
+            }
+        }
+        shared_term_offsets[doc + 1] = shared_terms.size();
+    }
+
+    Vector<u32> order(doc_count);
+    std::iota(order.begin(), order.end(), 0);
+    BPReorderer reorderer(std::move(shared_term_offsets), std::move(shared_terms), term_count, doc_count);
+    reorderer.Bisect(order.data(), doc_count, 0);
+    return order;
+}
+
+} // namespace infinity
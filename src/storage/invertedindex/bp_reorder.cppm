@@ -0,0 +1,30 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+module;
+
+export module bp_reorder;
+
+import stl;
+
+namespace infinity {
+
+// Orders docs by recursive graph bisection (BP, "Compressing Graphs and Indexes with Recursive Graph Bisection", Dhulipala et al.),
+// so that docs sharing terms get close doc ids, which narrows the doc id gaps of the posting lists and tightens their block max.
+// doc i has the terms doc_terms[doc_term_offsets[i], doc_term_offsets[i + 1]), each term once, term ids are below term_count.
+// Returns the docs in their new order.
+export Vector<u32> BPReorder(const Vector<u32> &doc_term_offsets, const Vector<u32> &doc_terms, u32 term_count);
+
+} // namespace infinity
@@ -39,11 +39,15 @@ ColumnIndexIterator::~ColumnIndexIterator() {
     ByteSlice::DestroySlice(pos_list_slice_);
 }
 
+void ColumnIndexIterator::SetRange(const String &lower, const String &upper) { dict_reader_->InitRangeIterator(lower, upper); }
+
 bool ColumnIndexIterator::Next(String &key, PostingDecoder *&decoder) {
     bool ret = dict_reader_->Next(key, term_meta_);
     if (!ret)
         return false;
     u32 total_len = 0;
+    // the iteration may not start from the first term
+    posting_file_->Seek(term_meta_.doc_start_);
     DecodeDocList();
     DecodePosList();
 
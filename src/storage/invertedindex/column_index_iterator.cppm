@@ -21,6 +21,9 @@ public:
 
     ~ColumnIndexIterator();
 
+    // only iterate the terms in [lower, upper), an empty bound is unbounded
+    void SetRange(const String &lower, const String &upper);
+
     bool Next(String &term, PostingDecoder *&decoder);
 
 private:
@@ -3,6 +3,7 @@ module;
 #include <cassert>
 #include <fstream>
 #include <string>
+#include <thread>
 
 module column_index_merger;
 
@@ -26,6 +27,7 @@ import third_party;
 import file_system;
 import file_system_type;
 import infinity_exception;
+import dict_reader;
 
 namespace infinity {
 ColumnIndexMerger::ColumnIndexMerger(const String &index_dir, optionflag_t flag, MemoryPool *memory_pool, RecyclePool *buffer_pool)
@@ -33,11 +35,14 @@ ColumnIndexMerger::ColumnIndexMerger(const String &index_dir, optionflag_t flag,
 
 ColumnIndexMerger::~ColumnIndexMerger() {}
 
-SharedPtr<PostingMerger> ColumnIndexMerger::CreatePostingMerger() {
-    return MakeShared<PostingMerger>(memory_pool_, buffer_pool_, flag_, column_length_mutex_, column_length_array_);
+// a partition of a parallel merge holds at least this many posting bytes of the merged chunks
+constexpr u64 MIN_MERGE_PARTITION_BYTES = 16 * 1024 * 1024;
+
+SharedPtr<PostingMerger> ColumnIndexMerger::CreatePostingMerger(MemoryPool *memory_pool, RecyclePool *buffer_pool) {
+    return MakeShared<PostingMerger>(memory_pool, buffer_pool, flag_, column_length_mutex_, column_length_array_);
 }
 
-void ColumnIndexMerger::Merge(const Vector<String> &base_names, const Vector<RowID> &base_rowids, const String &dst_base_name) {
+void ColumnIndexMerger::Merge(const Vector<String> &base_names, const Vector<RowID> &base_rowids, const String &dst_base_name, ThreadPool *thread_pool) {
     assert(base_names.size() == base_rowids.size());
     if (base_rowids.empty()) {
         return;
@@ -46,25 +51,16 @@ void ColumnIndexMerger::Merge(const Vector<String> &base_names, const Vector<Row
     String index_prefix = path.string();
     String dict_file = index_prefix + DICT_SUFFIX;
     String fst_file = dict_file + ".fst";
-    SharedPtr<FileWriter> dict_file_writer = MakeShared<FileWriter>(fs_, dict_file, 1024);
-    TermMetaDumper term_meta_dumpler((PostingFormatOption(flag_)));
     String posting_file = index_prefix + POSTING_SUFFIX;
-    posting_file_writer_ = MakeShared<FileWriter>(fs_, posting_file, 1024);
-
-    std::ofstream ofs(fst_file.c_str(), std::ios::binary | std::ios::trunc);
-    OstreamWriter wtr(ofs);
-    FstBuilder fst_builder(wtr);
-
-    SegmentTermPostingQueue term_posting_queue(index_dir_, base_names, base_rowids, flag_);
-    String term;
-    TermMeta term_meta;
-    SizeT term_meta_offset = 0;
 
     auto merge_base_rowid = base_rowids[0];
     for (auto& row_id : base_rowids) {
         merge_base_rowid = std::min(merge_base_rowid, row_id);
     }
 
+    throttled_bytes_ = 0;
+    merge_start_ = std::chrono::steady_clock::now();
+
     {
         // prepare column length info
         // the indexes to be merged should be from the same segment
@@ -87,19 +83,82 @@ void ColumnIndexMerger::Merge(const Vector<String> &base_names, const Vector<Row
         }
     }
 
-    while (!term_posting_queue.Empty()) {
-        const Vector<SegmentTermPosting *> &merging_term_postings = term_posting_queue.GetCurrentMerging(term);
-
-        MergeTerm(term, term_meta, merging_term_postings, merge_base_rowid);
+    // 1. split the term space
+    Vector<String> split_keys;
+    if (thread_pool != nullptr and thread_pool->size() > 1) {
+        u64 total_posting_bytes = 0;
+        for (const String &base_name : base_names) {
+            total_posting_bytes += fs_.GetFileSizeByPath((Path(index_dir_) / base_name).string() + POSTING_SUFFIX);
+        }
+        const SizeT partition_num = std::min<u64>(thread_pool->size(), total_posting_bytes / MIN_MERGE_PARTITION_BYTES);
+        if (partition_num > 1) {
+            split_keys = SplitTermSpace(base_names, partition_num);
+        }
+    }
+    const SizeT partition_num = split_keys.size() + 1;
 
-        term_meta_dumpler.Dump(dict_file_writer, term_meta);
+    // 2. merge the partitions, the first one is written to the posting file directly
+    Vector<String> partition_posting_files(partition_num, posting_file);
+    for (SizeT i = 1; i < partition_num; ++i) {
+        partition_posting_files[i] = fmt::format("{}.part{}", posting_file, i);
+    }
+    // TermMeta copies drop the posting offsets, so the metas are filled in place in a deque
+    Vector<Deque<Pair<String, TermMeta>>> merged_terms(partition_num);
+    if (partition_num == 1) {
+        MergePartition(base_names, base_rowids, merge_base_rowid, String(), String(), posting_file, memory_pool_, buffer_pool_, merged_terms[0]);
+    } else {
+        // the pools are not thread safe, every partition has its own
+        Vector<UniquePtr<MemoryPool>> memory_pools;
+        Vector<UniquePtr<RecyclePool>> buffer_pools;
+        Vector<Future<void>> futures;
+        for (SizeT i = 0; i < partition_num; ++i) {
+            memory_pools.push_back(MakeUnique<MemoryPool>());
+            buffer_pools.push_back(MakeUnique<RecyclePool>());
+            const String lower = i == 0 ? String() : split_keys[i - 1];
+            const String upper = i + 1 == partition_num ? String() : split_keys[i];
+            futures.push_back(thread_pool->push([&, i, lower, upper](int) {
+                MergePartition(base_names,
+                               base_rowids,
+                               merge_base_rowid,
+                               lower,
+                               upper,
+                               partition_posting_files[i],
+                               memory_pools[i].get(),
+                               buffer_pools[i].get(),
+                               merged_terms[i]);
+            }));
+        }
+        for (auto &future : futures) {
+            future.get();
+        }
+    }
 
-        fst_builder.Insert((u8 *)term.c_str(), term.length(), term_meta_offset);
-        term_meta_offset = dict_file_writer->TotalWrittenBytes();
-        term_posting_queue.MoveToNextTerm();
+    // 3. stitch the posting files, and write the dictionary with the term metas moved by the start of their partitions
+    SharedPtr<FileWriter> dict_file_writer = MakeShared<FileWriter>(fs_, dict_file, 1024);
+    TermMetaDumper term_meta_dumpler((PostingFormatOption(flag_)));
+    std::ofstream ofs(fst_file.c_str(), std::ios::binary | std::ios::trunc);
+    OstreamWriter wtr(ofs);
+    FstBuilder fst_builder(wtr);
+    const bool has_position = PostingFormatOption(flag_).HasPositionList();
+    for (SizeT i = 0; i < partition_num; ++i) {
+        u64 partition_start = 0;
+        if (i > 0) {
+            partition_start = fs_.GetFileSizeByPath(posting_file);
+            fs_.AppendFile(posting_file, partition_posting_files[i]);
+            fs_.DeleteFile(partition_posting_files[i]);
+        }
+        for (auto &[term, term_meta] : merged_terms[i]) {
+            term_meta.doc_start_ += partition_start;
+            if (has_position) {
+                term_meta.pos_start_ += partition_start;
+                term_meta.pos_end_ += partition_start;
+            }
+            SizeT term_meta_offset = dict_file_writer->TotalWrittenBytes();
+            term_meta_dumpler.Dump(dict_file_writer, term_meta);
+            fst_builder.Insert((u8 *)term.c_str(), term.length(), term_meta_offset);
+        }
     }
     dict_file_writer->Sync();
-    posting_file_writer_->Sync();
     fst_builder.Finish();
     fs_.AppendFile(dict_file, fst_file);
     fs_.DeleteFile(fst_file);
@@ -107,16 +166,72 @@ void ColumnIndexMerger::Merge(const Vector<String> &base_names, const Vector<Row
     buffer_pool_->Release();
 }
 
-void ColumnIndexMerger::MergeTerm(const String &term,
-                                  TermMeta &term_meta,
-                                  const Vector<SegmentTermPosting *> &merging_term_postings,
-                                  const RowID &merge_base_rowid) {
-    SharedPtr<PostingMerger> posting_merger = CreatePostingMerger();
-    posting_merger->Merge(merging_term_postings, merge_base_rowid);
+Vector<String> ColumnIndexMerger::SplitTermSpace(const Vector<String> &base_names, SizeT partition_num) {
+    String largest_base_name;
+    u64 largest_posting_bytes = 0;
+    for (const String &base_name : base_names) {
+        const u64 posting_bytes = fs_.GetFileSizeByPath((Path(index_dir_) / base_name).string() + POSTING_SUFFIX);
+        if (posting_bytes >= largest_posting_bytes) {
+            largest_posting_bytes = posting_bytes;
+            largest_base_name = base_name;
+        }
+    }
+    // a term starts a new partition when the postings before it reach the next 1 / partition_num of the chunk
+    const String dict_file = (Path(index_dir_) / largest_base_name).string() + DICT_SUFFIX;
+    DictionaryReader dict_reader(dict_file, PostingFormatOption(flag_));
+    const u64 partition_bytes = largest_posting_bytes / partition_num;
+    Vector<String> split_keys;
+    String term;
+    TermMeta term_meta;
+    while (split_keys.size() + 1 < partition_num and dict_reader.Next(term, term_meta)) {
+        if (term_meta.doc_start_ >= (split_keys.size() + 1) * partition_bytes) {
+            split_keys.push_back(term);
+        }
+    }
+    return split_keys;
+}
+
+void ColumnIndexMerger::MergePartition(const Vector<String> &base_names,
+                                       const Vector<RowID> &base_rowids,
+                                       RowID merge_base_rowid,
+                                       const String &lower,
+                                       const String &upper,
+                                       const String &posting_file,
+                                       MemoryPool *memory_pool,
+                                       RecyclePool *buffer_pool,
+                                       Deque<Pair<String, TermMeta>> &merged_terms) {
+    LocalFileSystem fs;
+    SharedPtr<FileWriter> posting_file_writer = MakeShared<FileWriter>(fs, posting_file, 1024);
+    SegmentTermPostingQueue term_posting_queue(index_dir_, base_names, base_rowids, flag_, lower, upper);
+    String term;
+    while (!term_posting_queue.Empty()) {
+        const Vector<SegmentTermPosting *> &merging_term_postings = term_posting_queue.GetCurrentMerging(term);
+
+        SharedPtr<PostingMerger> posting_merger = CreatePostingMerger(memory_pool, buffer_pool);
+        posting_merger->Merge(merging_term_postings, merge_base_rowid);
+        auto &[merged_term, term_meta] = merged_terms.emplace_back();
+        merged_term = term;
+        term_meta.SetDocFreq(posting_merger->GetDF());
+        term_meta.SetTotalTermFreq(posting_merger->GetTotalTF());
+        const SizeT written_before = posting_file_writer->TotalWrittenBytes();
+        posting_merger->Dump(posting_file_writer, term_meta);
+        Throttle(posting_file_writer->TotalWrittenBytes() - written_before);
+
+        term_posting_queue.MoveToNextTerm();
+    }
+    posting_file_writer->Sync();
+}
 
-    posting_merger->Dump(posting_file_writer_, term_meta);
-//    memory_pool_->Reset();
-//    buffer_pool_->Reset();
+void ColumnIndexMerger::Throttle(u64 written_bytes) {
+    if (rate_limit_ == 0) {
+        return;
+    }
+    const u64 total_bytes = throttled_bytes_.fetch_add(written_bytes) + written_bytes;
+    const auto expected_elapsed = std::chrono::nanoseconds(static_cast<i64>(f64(total_bytes) / rate_limit_ * 1e9));
+    const auto elapsed = std::chrono::steady_clock::now() - merge_start_;
+    if (expected_elapsed > elapsed) {
+        std::this_thread::sleep_for(expected_elapsed - elapsed);
+    }
 }
 
 } // namespace infinity
\ No newline at end of file
@@ -22,20 +22,42 @@ public:
     ColumnIndexMerger(const String &index_dir, optionflag_t flag, MemoryPool *memory_pool, RecyclePool *buffer_pool);
     ~ColumnIndexMerger();
 
-    void Merge(const Vector<String> &base_names, const Vector<RowID> &base_rowids, const String &dst_base_name);
+    // with a thread pool, the term space is split into ranges merged in parallel, then the partitions are stitched together
+    void Merge(const Vector<String> &base_names, const Vector<RowID> &base_rowids, const String &dst_base_name, ThreadPool *thread_pool = nullptr);
+
+    // limit the posting bytes written per second by all partitions of a merge, 0 for no limit
+    void SetRateLimit(u64 bytes_per_second) { rate_limit_ = bytes_per_second; }
 
 private:
-    SharedPtr<PostingMerger> CreatePostingMerger();
+    SharedPtr<PostingMerger> CreatePostingMerger(MemoryPool *memory_pool, RecyclePool *buffer_pool);
+
+    // split keys of the term space by the posting bytes of the largest chunk, partition i holds the terms in [split_keys[i - 1], split_keys[i])
+    Vector<String> SplitTermSpace(const Vector<String> &base_names, SizeT partition_num);
 
-    void MergeTerm(const String &term, TermMeta &term_meta, const Vector<SegmentTermPosting *> &merging_term_postings, const RowID &merge_base_rowid);
+    // merge the terms in [lower, upper) into posting_file, the term metas are relative to the start of posting_file
+    void MergePartition(const Vector<String> &base_names,
+                        const Vector<RowID> &base_rowids,
+                        RowID merge_base_rowid,
+                        const String &lower,
+                        const String &upper,
+                        const String &posting_file,
+                        MemoryPool *memory_pool,
+                        RecyclePool *buffer_pool,
+                        Deque<Pair<String, TermMeta>> &merged_terms);
+
+    // sleep while the merge is ahead of the rate limit
+    void Throttle(u64 written_bytes);
 
     String index_dir_;
     optionflag_t flag_;
     MemoryPool *memory_pool_{nullptr};
     RecyclePool *buffer_pool_{nullptr};
-    SharedPtr<FileWriter> posting_file_writer_;
     LocalFileSystem fs_;
 
+    u64 rate_limit_{0};
+    atomic_u64 throttled_bytes_{0};
+    std::chrono::steady_clock::time_point merge_start_{};
+
     // for column length info
     std::shared_mutex column_length_mutex_;
     Vector<u32> column_length_array_;
@@ -39,19 +39,27 @@ import index_base;
 import index_full_text;
 import third_party;
 import blockmax_term_doc_iterator;
+import sparse_analyzer;
 
 namespace infinity {
-void ColumnIndexReader::Open(optionflag_t flag, String &&index_dir, Map<SegmentID, SharedPtr<SegmentIndexEntry>> &&index_by_segment) {
+void ColumnIndexReader::Open(optionflag_t flag,
+                             String &&index_dir,
+                             Map<SegmentID, SharedPtr<SegmentIndexEntry>> &&index_by_segment,
+                             FullTextTermStats *term_stats) {
     flag_ = flag;
+    term_stats_ = term_stats;
     index_dir_ = std::move(index_dir);
     index_by_segment_ = std::move(index_by_segment);
     // need to ensure that segment_id is in ascending order
     for (const auto &[segment_id, segment_index_entry] : index_by_segment_) {
-        auto [base_names, base_row_ids, memory_indexer] = segment_index_entry->GetFullTextIndexSnapshot();
+        auto [base_names, base_row_ids, commit_tss, memory_indexer] = segment_index_entry->GetFullTextIndexSnapshot();
         // segment_readers
         for (u32 i = 0; i < base_names.size(); ++i) {
-            SharedPtr<DiskIndexSegmentReader> segment_reader = MakeShared<DiskIndexSegmentReader>(index_dir_, base_names[i], base_row_ids[i], flag);
+            SharedPtr<DiskIndexSegmentReader> segment_reader =
+                MakeShared<DiskIndexSegmentReader>(index_dir_, base_names[i], base_row_ids[i], commit_tss[i], flag);
             segment_readers_.push_back(std::move(segment_reader));
+            reader_segment_ids_.push_back(segment_id);
+            reader_in_memory_.push_back(false);
         }
         // for loading column length files
         base_names_.insert(base_names_.end(), std::move_iterator(base_names.begin()), std::move_iterator(base_names.end()));
@@ -60,50 +68,92 @@ void ColumnIndexReader::Open(optionflag_t flag, String &&index_dir, Map<SegmentI
             // segment_reader
             SharedPtr<InMemIndexSegmentReader> segment_reader = MakeShared<InMemIndexSegmentReader>(memory_indexer);
             segment_readers_.push_back(std::move(segment_reader));
+            reader_segment_ids_.push_back(segment_id);
+            reader_in_memory_.push_back(true);
             // for loading column length file
             base_names_.push_back(memory_indexer->GetBaseName());
             base_row_ids_.push_back(memory_indexer->GetBaseRowId());
         }
     }
+    if (term_stats_ != nullptr) {
+        Vector<String> disk_base_names;
+        for (SizeT i = 0; i < base_names_.size(); ++i) {
+            if (!reader_in_memory_[i]) {
+                disk_base_names.push_back(base_names_[i]);
+            }
+        }
+        term_stats_->Sync(index_dir_, disk_base_names, flag_);
+    }
     // put an INVALID_ROWID at the end of base_row_ids_
     base_row_ids_.emplace_back(INVALID_ROWID);
 }
 
-UniquePtr<PostingIterator> ColumnIndexReader::Lookup(const String &term, MemoryPool *session_pool) {
+SharedPtr<Vector<SegmentPosting>>
+ColumnIndexReader::GetSegmentPostings(const String &term, MemoryPool *session_pool, const Vector<SegmentID> *segment_ids, u32 &doc_freq) {
     SharedPtr<Vector<SegmentPosting>> seg_postings = MakeShared<Vector<SegmentPosting>>();
+    doc_freq = term_stats_ != nullptr ? static_cast<u32>(term_stats_->GetDocFreq(term)) : 0;
     for (u32 i = 0; i < segment_readers_.size(); ++i) {
+        // segment_ids is sorted
+        bool wanted = !segment_ids or std::binary_search(segment_ids->begin(), segment_ids->end(), reader_segment_ids_[i]);
+        bool counted = term_stats_ == nullptr or reader_in_memory_[i];
+        if (!wanted and !counted) {
+            continue;
+        }
         SegmentPosting seg_posting;
         auto ret = segment_readers_[i]->GetSegmentPosting(term, seg_posting, session_pool);
-        if (ret) {
+        if (!ret) {
+            continue;
+        }
+        if (counted) {
+            doc_freq += seg_posting.GetTermMeta().GetDocFreq();
+        }
+        if (wanted) {
             seg_postings->push_back(seg_posting);
         }
     }
+    return seg_postings;
+}
+
+UniquePtr<PostingIterator> ColumnIndexReader::Lookup(const String &term, MemoryPool *session_pool, const Vector<SegmentID> *segment_ids) {
+    u32 doc_freq = 0;
+    SharedPtr<Vector<SegmentPosting>> seg_postings = GetSegmentPostings(term, session_pool, segment_ids, doc_freq);
     if (seg_postings->empty())
         return nullptr;
     auto iter = MakeUnique<PostingIterator>(flag_, session_pool);
     u32 state_pool_size = 0; // TODO
     iter->Init(std::move(seg_postings), state_pool_size);
+    // BM25 of the postings of some segments shall be the same as of all segments
+    iter->SetDocFreq(doc_freq);
     return iter;
 }
 
-UniquePtr<BlockMaxTermDocIterator> ColumnIndexReader::LookupBlockMax(const String &term, MemoryPool *session_pool, float weight) {
-    SharedPtr<Vector<SegmentPosting>> seg_postings = MakeShared<Vector<SegmentPosting>>();
-    for (u32 i = 0; i < segment_readers_.size(); ++i) {
-        SegmentPosting seg_posting;
-        auto ret = segment_readers_[i]->GetSegmentPosting(term, seg_posting, session_pool);
-        if (ret) {
-            seg_postings->push_back(seg_posting);
-        }
-    }
+UniquePtr<BlockMaxTermDocIterator>
+ColumnIndexReader::LookupBlockMax(const String &term, MemoryPool *session_pool, float weight, const Vector<SegmentID> *segment_ids) {
+    u32 doc_freq = 0;
+    SharedPtr<Vector<SegmentPosting>> seg_postings = GetSegmentPostings(term, session_pool, segment_ids, doc_freq);
     if (seg_postings->empty())
         return nullptr;
     auto result = MakeUnique<BlockMaxTermDocIterator>(flag_, session_pool);
     result->MultiplyWeight(weight);
     u32 state_pool_size = 0; // TODO
-    result->InitPostingIterator(std::move(seg_postings), state_pool_size);
+    result->InitPostingIterator(std::move(seg_postings), state_pool_size, doc_freq);
     return result;
 }
 
+Vector<String> ColumnIndexReader::ExpandPrefix(const String &prefix, SizeT max_expansion) const {
+    Vector<String> terms;
+    for (const auto &segment_reader : segment_readers_) {
+        // each segment contributes at most max_expansion terms, enough for the first max_expansion of the union
+        segment_reader->GetTermsWithPrefix(prefix, terms.size() + max_expansion, terms);
+    }
+    std::sort(terms.begin(), terms.end());
+    terms.erase(std::unique(terms.begin(), terms.end()), terms.end());
+    if (terms.size() > max_expansion) {
+        terms.resize(max_expansion);
+    }
+    return terms;
+}
+
 float ColumnIndexReader::GetAvgColumnLength() const {
     u64 column_len_sum = 0;
     u32 column_len_cnt = 0;
@@ -127,9 +177,10 @@ void TableIndexReaderCache::UpdateKnownUpdateTs(TxnTimeStamp ts, std::shared_mut
     last_known_update_ts_ = std::max(last_known_update_ts_, ts);
 }
 
-IndexReader TableIndexReaderCache::GetIndexReader(TransactionID txn_id, TxnTimeStamp begin_ts, TableEntry *self_table_entry_ptr) {
+IndexReader
+TableIndexReaderCache::GetIndexReader(TransactionID txn_id, TxnTimeStamp begin_ts, TableEntry *self_table_entry_ptr, MemoryPool *session_pool) {
     IndexReader result;
-    result.session_pool_ = MakeShared<MemoryPool>();
+    result.session_pool_ = session_pool;
     std::scoped_lock lock(mutex_);
     if (begin_ts >= cache_ts_ and begin_ts < first_known_update_ts_) [[likely]] {
         // no need to build, use cache
@@ -169,7 +220,8 @@ IndexReader TableIndexReaderCache::GetIndexReader(TransactionID txn_id, TxnTimeS
                     optionflag_t flag = index_full_text->flag_;
                     String index_dir = *(table_index_entry->index_dir());
                     Map<SegmentID, SharedPtr<SegmentIndexEntry>> index_by_segment = table_index_entry->GetIndexBySegmentSnapshot();
-                    column_index_reader->Open(flag, std::move(index_dir), std::move(index_by_segment));
+                    column_index_reader->Open(flag, std::move(index_dir), std::move(index_by_segment), &table_index_entry->GetFulltextTermStats());
+                    column_index_reader->weighted_tf_ = index_full_text->analyzer_ == SPARSE_ANALYZER;
                     (*result.column_index_readers_)[column_id] = std::move(column_index_reader);
                 }
             }
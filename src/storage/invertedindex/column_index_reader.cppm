@@ -24,6 +24,7 @@ import index_defines;
 import memory_indexer;
 import internal_types;
 import segment_index_entry;
+import term_stats;
 
 export module column_index_reader;
 
@@ -33,17 +34,33 @@ class BlockMaxTermDocIterator;
 
 export class ColumnIndexReader {
 public:
-    void Open(optionflag_t flag, String &&index_dir, Map<SegmentID, SharedPtr<SegmentIndexEntry>> &&index_by_segment);
+    // term_stats: when not null, synced with the disk chunks and used for the doc freqs of the terms
+    void Open(optionflag_t flag,
+              String &&index_dir,
+              Map<SegmentID, SharedPtr<SegmentIndexEntry>> &&index_by_segment,
+              FullTextTermStats *term_stats = nullptr);
 
-    UniquePtr<PostingIterator> Lookup(const String &term, MemoryPool *session_pool);
+    // segment_ids: when not null, only the postings of these segments are iterated, doc freq still counts all segments
+    UniquePtr<PostingIterator> Lookup(const String &term, MemoryPool *session_pool, const Vector<SegmentID> *segment_ids = nullptr);
 
-    UniquePtr<BlockMaxTermDocIterator> LookupBlockMax(const String &term, MemoryPool *session_pool, float weight);
+    UniquePtr<BlockMaxTermDocIterator>
+    LookupBlockMax(const String &term, MemoryPool *session_pool, float weight, const Vector<SegmentID> *segment_ids = nullptr);
+
+    // terms of all segments starting with prefix, the first max_expansion of them in lexicographical order
+    Vector<String> ExpandPrefix(const String &prefix, SizeT max_expansion) const;
 
     float GetAvgColumnLength() const;
 
 private:
+    SharedPtr<Vector<SegmentPosting>>
+    GetSegmentPostings(const String &term, MemoryPool *session_pool, const Vector<SegmentID> *segment_ids, u32 &doc_freq);
+
     optionflag_t flag_;
     Vector<SharedPtr<IndexSegmentReader>> segment_readers_;
+    // the segment of each reader, and whether it reads a memory indexer, whose doc freqs are not in term_stats_
+    Vector<SegmentID> reader_segment_ids_;
+    Vector<bool> reader_in_memory_;
+    FullTextTermStats *term_stats_{nullptr};
     Map<SegmentID, SharedPtr<SegmentIndexEntry>> index_by_segment_;
 
 public:
@@ -51,6 +68,8 @@ public:
     String index_dir_;
     Vector<String> base_names_;
     Vector<RowID> base_row_ids_;
+    // tf of the postings is the quantized weight of sparse vector terms
+    bool weighted_tf_ = false;
 };
 
 namespace detail {
@@ -66,14 +85,17 @@ export struct IndexReader {
 
     SharedPtr<FlatHashMap<u64, SharedPtr<ColumnIndexReader>, detail::Hash<u64>>> column_index_readers_;
     SharedPtr<Map<String, String>> column2analyzer_;
-    SharedPtr<MemoryPool> session_pool_;
+    // the memory pool of the query, the posting iterators of the search are allocated from it
+    MemoryPool *session_pool_{};
+    // set by the tasks of a parallel match, each task searches its own segments
+    SharedPtr<Vector<SegmentID>> segment_ids_;
 };
 
 export class TableIndexReaderCache {
 public:
     void UpdateKnownUpdateTs(TxnTimeStamp ts, std::shared_mutex &segment_update_ts_mutex, TxnTimeStamp &segment_update_ts);
 
-    IndexReader GetIndexReader(TransactionID txn_id, TxnTimeStamp begin_ts, TableEntry *table_entry_ptr);
+    IndexReader GetIndexReader(TransactionID txn_id, TxnTimeStamp begin_ts, TableEntry *table_entry_ptr, MemoryPool *session_pool);
 
 private:
     std::mutex mutex_;
@@ -16,14 +16,13 @@ module;
 
 #include <arpa/inet.h>
 #include <cassert>
-#include <cstdio>
 #include <cstring>
-#include <iostream>
 #include <vector>
 module column_inverter;
 import stl;
 import analyzer;
 import analyzer_pool;
+import sparse_analyzer;
 import string_ref;
 import term;
 import radix_sort;
@@ -33,6 +32,8 @@ import infinity_exception;
 import third_party;
 import status;
 import logger;
+import term_tuple_spill;
+import term_list_cache;
 
 namespace infinity {
 
@@ -42,13 +43,17 @@ static u32 Align(u32 unaligned) {
 }
 
 ColumnInverter::ColumnInverter(const String &analyzer, PostingWriterProvider posting_writer_provider)
-    : analyzer_(AnalyzerPool::instance().Get(analyzer)), posting_writer_provider_(posting_writer_provider) {
+    : analyzer_name_(analyzer), analyzer_(AnalyzerPool::instance().Checkout(analyzer)), weighted_tf_(analyzer == SPARSE_ANALYZER), posting_writer_provider_(posting_writer_provider) {
     if (analyzer_.get() == nullptr) {
         RecoverableError(Status::UnexpectedError(fmt::format("Invalid analyzer: {}", analyzer)));
     }
 }
 
-ColumnInverter::~ColumnInverter() = default;
+ColumnInverter::~ColumnInverter() {
+    if (analyzer_.get() != nullptr) {
+        AnalyzerPool::instance().Return(analyzer_name_, std::move(analyzer_));
+    }
+}
 
 bool ColumnInverter::CompareTermRef::operator()(const u32 lhs, const u32 rhs) const { return std::strcmp(GetTerm(lhs), GetTerm(rhs)) < 0; }
 
@@ -62,12 +67,34 @@ void ColumnInverter::InvertColumn(SharedPtr<ColumnVector> column_vector, u32 row
 }
 
 void ColumnInverter::InvertColumn(u32 doc_id, const String &val) {
-    auto terms_once_ = MakeUnique<TermList>();
-    analyzer_->Analyze(val, *terms_once_);
-    terms_per_doc_.push_back(Pair<u32, UniquePtr<TermList>>(doc_id, std::move(terms_once_)));
+    const TermList *terms = &analyzed_terms_;
+    SharedPtr<const TermList> cached_terms;
+    if (reuse_terms_ && term_list_cache_ != nullptr) {
+        cached_terms = term_list_cache_->Get(val);
+    }
+    if (cached_terms.get() != nullptr) {
+        terms = cached_terms.get();
+    } else {
+        analyzed_terms_.clear();
+        analyzer_->Analyze(val, analyzed_terms_);
+        if (term_list_cache_ != nullptr) {
+            term_list_cache_->Put(val, MakeShared<const TermList>(analyzed_terms_));
+        }
+    }
+    // the term texts are appended to one buffer, so a doc does not allocate for each of its terms
+    for (const Term &term : *terms) {
+        doc_terms_.emplace_back(doc_term_texts_.size(), term.text_.size());
+        doc_term_ids_.emplace_back(doc_id, term.word_offset_);
+        doc_term_texts_.insert(doc_term_texts_.end(), term.text_.begin(), term.text_.end());
+    }
+    doc_term_counts_.push_back(terms->size());
 }
 
 u32 ColumnInverter::AddTerm(StringRef term) {
+    std::string_view term_view(term.data(), term.size());
+    if (auto iter = term_ids_.find(term_view); iter != term_ids_.end()) {
+        return iter->second;
+    }
     const u32 terms_size = terms_.size();
     const u32 unpadded_size = terms_size + 4 + term.size() + 1;
     const u32 fully_padded_size = Align<4>(unpadded_size);
@@ -80,37 +107,43 @@ u32 ColumnInverter::AddTerm(StringRef term) {
 
     u32 term_ref = (terms_size + 4) >> 2;
     term_refs_.push_back(term_ref);
+    term_ids_.emplace(term_view, term_ref);
     return term_ref;
 }
 
-void ColumnInverter::MergePrepare() {
-    for (auto &doc_terms : terms_per_doc_) {
-        u32 doc_id = doc_terms.first;
-        auto &terms_once = doc_terms.second;
-        for (auto it = terms_once->begin(); it != terms_once->end(); ++it) {
-            StringRef term(it->text_);
-            u32 term_ref = AddTerm(term);
-            positions_.emplace_back(term_ref, doc_id, it->word_offset_);
-        }
+void ColumnInverter::AddDocTerms(const ColumnInverter &inverter) {
+    positions_.reserve(positions_.size() + inverter.doc_terms_.size());
+    for (SizeT i = 0; i < inverter.doc_terms_.size(); ++i) {
+        const auto &[text_offset, text_length] = inverter.doc_terms_[i];
+        const auto &[doc_id, word_offset] = inverter.doc_term_ids_[i];
+        u32 term_ref = AddTerm(StringRef(inverter.doc_term_texts_.data() + text_offset, text_length));
+        positions_.emplace_back(term_ref, doc_id, word_offset);
     }
-    terms_per_doc_.clear();
+}
+
+void ColumnInverter::ClearDocTerms() {
+    doc_term_texts_.clear();
+    doc_term_texts_.shrink_to_fit();
+    doc_terms_.clear();
+    doc_terms_.shrink_to_fit();
+    doc_term_ids_.clear();
+    doc_term_ids_.shrink_to_fit();
+    doc_term_counts_.clear();
+    doc_term_counts_.shrink_to_fit();
+}
+
+void ColumnInverter::MergePrepare() {
+    AddDocTerms(*this);
+    ClearDocTerms();
 }
 
 void ColumnInverter::Merge(ColumnInverter &rhs) {
     assert(begin_doc_id_ + doc_count_ == rhs.begin_doc_id_);
     MergePrepare();
-    for (auto &doc_terms : rhs.terms_per_doc_) {
-        u32 doc_id = doc_terms.first;
-        auto &terms_once = doc_terms.second;
-        for (auto it = terms_once->begin(); it != terms_once->end(); ++it) {
-            StringRef term(it->text_);
-            u32 term_ref = AddTerm(term);
-            positions_.emplace_back(term_ref, doc_id, it->word_offset_);
-        }
-    }
+    AddDocTerms(rhs);
     doc_count_ += rhs.doc_count_;
     merged_++;
-    rhs.terms_per_doc_.clear();
+    rhs.ClearDocTerms();
     rhs.doc_count_ = 0;
     rhs.merged_ = 0;
 }
@@ -126,9 +159,7 @@ void ColumnInverter::Merge(Vector<SharedPtr<ColumnInverter>> &inverters) {
 }
 
 void ColumnInverter::GetTermListLength(u32 *term_list_length_ptr) const {
-    for (const auto &[_, term_list] : terms_per_doc_) {
-        *(term_list_length_ptr++) = term_list->size();
-    }
+    std::memcpy(term_list_length_ptr, doc_term_counts_.data(), doc_term_counts_.size() * sizeof(u32));
 }
 
 struct TermRefRadix {
@@ -146,26 +177,12 @@ void ColumnInverter::SortTerms() {
                                                                                   &first_four_bytes[0],
                                                                                   first_four_bytes.size(),
                                                                                   16);
+    // the terms are unique, so the term number is the rank of the term
     for (u32 i(0); i < first_four_bytes.size(); i++) {
         term_refs_[i] = first_four_bytes[i] & 0xffffffffl;
+        UpdateTermNum(term_refs_[i], i);
     }
-    auto term_ref_begin(term_refs_.begin());
-    uint32_t term_num = 0; // First valid term number
-    const char *last_term = GetTermFromRef(*term_ref_begin);
-    UpdateTermNum(*term_ref_begin, term_num);
-    for (++term_ref_begin; term_ref_begin != term_refs_.end(); ++term_ref_begin) {
-        const char *term = GetTermFromRef(*term_ref_begin);
-        int cmpres = strcmp(last_term, term);
-        // assert(cmpres <= 0);
-        if (cmpres < 0) {
-            ++term_num;
-            term_refs_[term_num] = *term_ref_begin;
-            last_term = term;
-        }
-        UpdateTermNum(*term_ref_begin, term_num);
-    }
-    // assert(term_refs_.size() >= term_num + 1);
-    term_refs_.resize(term_num + 1);
+    term_ids_.clear();
     // Replace initial word reference by word number.
     for (auto &p : positions_) {
         p.term_num_ = GetTermNum(p.term_num_);
@@ -216,7 +233,12 @@ void ColumnInverter::GeneratePosting() {
             // printf(" EndDocument2-%u\n", last_doc_id);
         }
         last_doc_id = i.doc_id_;
-        posting->AddPosition(i.term_pos_);
+        if (weighted_tf_) {
+            // term_pos_ holds the quantized weight of a sparse vector term
+            posting->SetCurrentTF(i.term_pos_);
+        } else {
+            posting->AddPosition(i.term_pos_);
+        }
         // printf(" pos-%u", i.term_pos_);
     }
     if (last_doc_id != INVALID_DOCID) {
@@ -231,58 +253,21 @@ void ColumnInverter::SortForOfflineDump() {
     Sort();
 }
 
-/// Layout of the input of external sort file
-//    +-----------+  +----------------++--------------------++--------------------------++-------------------------------------------------------+
-//    |           |  |                ||                    ||                          ||                                                       |
-//    |   Count   |  |  Size of A Run ||   Num of records   ||   Position of Next Run   ||             Data of a Run                             |
-//    |           |  |                ||   within a Run     ||                          ||                                                       |
-//    +-----------+  +----------------++--------------------++--------------------------++-------------------------------------------------------+
-//                   ----------------------------------------------------------------------------------------------------------------------------+
-//                                                            Data within each group
-void ColumnInverter::SpillSortResults(FILE *spill_file, u64 &tuple_count) {
-    // spill sort results for external merge sort
-
-    // size of this Run in bytes
-    u32 data_size = 0;
-    u64 data_size_pos = ftell(spill_file);
-    fwrite(&data_size, sizeof(u32), 1, spill_file);
-    // number of tuples
-    u32 num_of_tuples = positions_.size();
-    tuple_count += num_of_tuples;
-    fwrite(&num_of_tuples, sizeof(u32), 1, spill_file);
-    // start offset for next spill
-    u64 next_start_offset = 0;
-    u64 next_start_offset_pos = ftell(spill_file);
-    fwrite(&next_start_offset, sizeof(u64), 1, spill_file);
-    u64 data_start_offset = ftell(spill_file);
-    // sorted data
-    u32 last_term_num = std::numeric_limits<u32>::max();
-    StringRef term;
-    u32 record_length = 0;
-    char str_null = '\0';
-    for (auto &i : positions_) {
-        if (last_term_num != i.term_num_) {
-            last_term_num = i.term_num_;
-            term = GetTermFromNum(last_term_num);
+void ColumnInverter::SpillSortResults(TermTupleSpillFile &spill_file) {
+    // the positions are sorted by term and doc, each term is written once followed by its tuples
+    spill_file.BeginRun();
+    for (SizeT i = 0; i < positions_.size();) {
+        const u32 term_num = positions_[i].term_num_;
+        SizeT end = i + 1;
+        while (end < positions_.size() and positions_[end].term_num_ == term_num) {
+            ++end;
+        }
+        spill_file.AddTerm(GetTermFromNum(term_num), end - i);
+        for (; i < end; ++i) {
+            spill_file.AddTuple(positions_[i].doc_id_, positions_[i].term_pos_);
         }
-        record_length = term.size() + sizeof(docid_t) + sizeof(u32) + 1;
-        if (record_length > 1024)
-            std::cout << "!!!!!! record_length " << record_length << std::endl;
-        fwrite(&record_length, sizeof(u32), 1, spill_file);
-        fwrite(term.data(), term.size(), 1, spill_file);
-        fwrite(&str_null, sizeof(char), 1, spill_file);
-        fwrite(&i.doc_id_, sizeof(docid_t), 1, spill_file);
-        fwrite(&i.term_pos_, sizeof(u32), 1, spill_file);
     }
-
-    // update data size
-    next_start_offset = ftell(spill_file);
-    data_size = next_start_offset - data_start_offset;
-    fseek(spill_file, data_size_pos, SEEK_SET);
-    fwrite(&data_size, sizeof(u32), 1, spill_file); // update offset for next spill
-    fseek(spill_file, next_start_offset_pos, SEEK_SET);
-    fwrite(&next_start_offset, sizeof(u64), 1, spill_file);
-    fseek(spill_file, next_start_offset, SEEK_SET);
+    spill_file.EndRun();
 }
 
 } // namespace infinity
\ No newline at end of file
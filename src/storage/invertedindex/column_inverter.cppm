@@ -14,8 +14,6 @@
 
 module;
 
-#include <cstdio>
-
 export module column_inverter;
 
 import stl;
@@ -26,6 +24,8 @@ import term;
 import string_ref;
 import internal_types;
 import posting_writer;
+import term_tuple_spill;
+import term_list_cache;
 
 namespace infinity {
 
@@ -42,6 +42,12 @@ public:
 
     void InvertColumn(u32 doc_id, const String &val);
 
+    // keep the terms of the analyzed texts in term_list_cache, and with reuse_terms look the texts up there before analyzing them
+    void SetTermListCache(TermListCache *term_list_cache, bool reuse_terms) {
+        term_list_cache_ = term_list_cache;
+        reuse_terms_ = reuse_terms;
+    }
+
     void SortForOfflineDump();
 
     void Merge(ColumnInverter &rhs);
@@ -74,13 +80,24 @@ public:
         }
     };
 
-    void SpillSortResults(FILE *spill_file, u64 &tuple_count);
+    // append the sorted positions to spill_file as a run
+    void SpillSortResults(TermTupleSpillFile &spill_file);
 
 private:
     using TermBuffer = Vector<char>;
     using PosInfoVec = Vector<PosInfo>;
     using U32Vec = Vector<u32>;
 
+    struct TermHash {
+        using is_transparent = void;
+        SizeT operator()(std::string_view term) const { return std::hash<std::string_view>{}(term); }
+    };
+
+    struct TermEqual {
+        using is_transparent = void;
+        bool operator()(std::string_view lhs, std::string_view rhs) const { return lhs == rhs; }
+    };
+
     struct CompareTermRef {
         const char *const term_buffer_;
 
@@ -105,20 +122,40 @@ private:
         *reinterpret_cast<u32 *>(p) = term_num;
     }
 
+    // Returns the ref of the term in terms_, a term is added only once.
     u32 AddTerm(StringRef term);
 
     void SortTerms();
 
     void MergePrepare();
 
+    // Adds the analyzed terms of the docs of inverter to the terms and positions of this one.
+    void AddDocTerms(const ColumnInverter &inverter);
+
+    void ClearDocTerms();
+
+    String analyzer_name_;
     UniquePtr<Analyzer> analyzer_{nullptr};
+    bool weighted_tf_{false};
     u32 begin_doc_id_{0};
     u32 doc_count_{0};
     u32 merged_{1};
     TermBuffer terms_;
     PosInfoVec positions_;
-    U32Vec term_refs_;
-    Vector<Pair<u32, UniquePtr<TermList>>> terms_per_doc_;
+    U32Vec term_refs_; // refs of the unique terms
+    // term -> ref, so that sorting and grouping work on the refs and a term string is kept once
+    HashMap<String, u32, TermHash, TermEqual> term_ids_;
+    // The analyzed terms of the docs not yet merged, kept in one buffer instead of a TermList per doc:
+    // doc_terms_ holds the offset and length of each term text in doc_term_texts_,
+    // doc_term_ids_ holds the doc id and the word offset of each term.
+    Vector<char> doc_term_texts_;
+    Vector<Pair<u32, u32>> doc_terms_;
+    Vector<Pair<u32, u32>> doc_term_ids_;
+    U32Vec doc_term_counts_;
+    // reused by each analyzed doc
+    TermList analyzed_terms_;
     PostingWriterProvider posting_writer_provider_{};
+    TermListCache *term_list_cache_{nullptr};
+    bool reuse_terms_{false};
 };
 } // namespace infinity
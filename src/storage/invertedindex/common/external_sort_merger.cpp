@@ -420,4 +420,5 @@ void SortMerger<KeyType, LenType>::Run() {
 
 template class SortMerger<u32, u8>;
 template class SortMerger<TermTuple, u32>;
+template class SortMerger<std::string_view, u32>;
 } // namespace infinity
\ No newline at end of file
@@ -73,6 +73,14 @@ public:
         }
     }
 
+    // append at most max_count keys starting with prefix, KeyType must be a string
+    void PrefixKeys(const KeyType &prefix, SizeT max_count, Vector<KeyType> &keys) {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        for (auto it = map_.lower_bound(prefix); it != map_.end() && keys.size() < max_count && it->first.starts_with(prefix); ++it) {
+            keys.push_back(it->first);
+        }
+    }
+
     // WARN: Caller shall ensure there's no concurrent write access
     Map<KeyType, ValueType>::iterator UnsafeBegin() { return map_.begin(); }
 
@@ -21,18 +21,72 @@ export int MmapFile(const String &fp, u8 *&data_ptr, SizeT &data_len) {
     if (len_f == 0)
         return -1;
     int f = open(fp.c_str(), O_RDONLY);
+    if (f < 0)
+        return -1;
     void *tmpd = mmap(NULL, len_f, PROT_READ, MAP_SHARED, f, 0);
+    close(f);
     if (tmpd == MAP_FAILED)
         return -1;
-    close(f);
-    int rc = madvise(tmpd, len_f, MADV_RANDOM | MADV_DONTDUMP);
-    if (rc < 0)
+    // one advice per call, the values are not flags
+    int rc = madvise(tmpd, len_f, MADV_RANDOM);
+    if (rc == 0)
+        rc = madvise(tmpd, len_f, MADV_DONTDUMP);
+    if (rc < 0) {
+        munmap(tmpd, len_f);
         return -1;
+    }
     data_ptr = (u8 *)tmpd;
     data_len = len_f;
     return 0;
 }
 
+export enum class MmapAdvice {
+    kRandom,
+    kSequential,
+    kWillNeed,
+};
+
+// Advise the kernel about a range of a mapping, the range is extended to whole pages.
+export int MmapAdvise(const u8 *data_ptr, SizeT data_len, MmapAdvice advice) {
+    static const uintptr_t page_size = sysconf(_SC_PAGESIZE);
+    uintptr_t begin = reinterpret_cast<uintptr_t>(data_ptr) & ~(page_size - 1);
+    uintptr_t end = reinterpret_cast<uintptr_t>(data_ptr) + data_len;
+    int mmap_advice = MADV_RANDOM;
+    switch (advice) {
+        case MmapAdvice::kRandom:
+            mmap_advice = MADV_RANDOM;
+            break;
+        case MmapAdvice::kSequential:
+            mmap_advice = MADV_SEQUENTIAL;
+            break;
+        case MmapAdvice::kWillNeed:
+            mmap_advice = MADV_WILLNEED;
+            break;
+    }
+    return madvise(reinterpret_cast<void *>(begin), end - begin, mmap_advice);
+}
+
+// Read a range of a mapping into the page cache and map its pages, so that the first searches don't fault on every page.
+// With lock the pages also stay in memory until the range is unmapped, which may fail for the RLIMIT_MEMLOCK.
+export int MmapPrefault(const u8 *data_ptr, SizeT data_len, bool lock) {
+    if (data_len == 0) {
+        return 0;
+    }
+    int rc = MmapAdvise(data_ptr, data_len, MmapAdvice::kWillNeed);
+    if (rc == 0 && lock) {
+        rc = mlock(data_ptr, data_len);
+    }
+    if (rc == 0 && !lock) {
+        static const SizeT page_size = sysconf(_SC_PAGESIZE);
+        u8 sum = 0;
+        for (SizeT offset = 0; offset < data_len; offset += page_size) {
+            sum += reinterpret_cast<const volatile u8 *>(data_ptr)[offset];
+        }
+        (void)sum;
+    }
+    return rc;
+}
+
 export int MunmapFile(u8 *&data_ptr, SizeT &data_len) {
     if (data_ptr != nullptr) {
         int rc = munmap(data_ptr, data_len);
@@ -0,0 +1,138 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module sharded_term_map;
+import stl;
+
+namespace infinity {
+
+// Term dictionary written by many inverters at once.
+// Terms are hashed to SHARD_NUM shards, each a hash map under its own lock, so concurrent writers seldom wait for each other.
+// The bytes of the terms are copied into an arena per shard instead of one heap string per term.
+// The terms are unordered, sorted order is only produced by UnsafeSortedItems() and PrefixKeys().
+export template <typename ValueType>
+class ShardedTermMap {
+private:
+    static constexpr SizeT SHARD_NUM = 64;
+    static constexpr SizeT ARENA_CHUNK_SIZE = 64 * 1024;
+
+    struct alignas(64) Shard {
+        std::shared_mutex mutex_;
+        HashMap<std::string_view, ValueType> map_;
+        Vector<UniquePtr<char[]>> arena_chunks_;
+        SizeT arena_chunk_size_ = 0;
+        SizeT arena_chunk_used_ = 0;
+
+        std::string_view StoreKey(std::string_view key) {
+            if (arena_chunk_used_ + key.size() > arena_chunk_size_) {
+                arena_chunk_size_ = std::max(ARENA_CHUNK_SIZE, key.size());
+                arena_chunk_used_ = 0;
+                arena_chunks_.push_back(MakeUniqueForOverwrite<char[]>(arena_chunk_size_));
+            }
+            char *dst = arena_chunks_.back().get() + arena_chunk_used_;
+            std::memcpy(dst, key.data(), key.size());
+            arena_chunk_used_ += key.size();
+            return std::string_view(dst, key.size());
+        }
+
+        void Clear() {
+            map_.clear();
+            arena_chunks_.clear();
+            arena_chunk_size_ = 0;
+            arena_chunk_used_ = 0;
+        }
+    };
+
+    Shard &GetShard(std::string_view key) { return shards_[std::hash<std::string_view>{}(key) % SHARD_NUM]; }
+
+    Array<Shard, SHARD_NUM> shards_;
+
+public:
+    bool Get(std::string_view key, ValueType &value) {
+        Shard &shard = GetShard(key);
+        std::shared_lock<std::shared_mutex> lock(shard.mutex_);
+        auto it = shard.map_.find(key);
+        if (it == shard.map_.end()) {
+            return false;
+        }
+        value = it->second;
+        return true;
+    }
+
+    // Get or add a value to the map, the new value is made by new_value_func only when the key is not found.
+    // Returns true if found.
+    template <typename NewValueFunc>
+    bool GetOrAdd(std::string_view key, ValueType &value, NewValueFunc &&new_value_func) {
+        Shard &shard = GetShard(key);
+        {
+            std::shared_lock<std::shared_mutex> lock(shard.mutex_);
+            if (auto it = shard.map_.find(key); it != shard.map_.end()) {
+                value = it->second;
+                return true;
+            }
+        }
+        std::unique_lock<std::shared_mutex> lock(shard.mutex_);
+        if (auto it = shard.map_.find(key); it != shard.map_.end()) {
+            value = it->second;
+            return true;
+        }
+        value = new_value_func();
+        shard.map_.emplace(shard.StoreKey(key), value);
+        return false;
+    }
+
+    void Clear() {
+        for (Shard &shard : shards_) {
+            std::unique_lock<std::shared_mutex> lock(shard.mutex_);
+            shard.Clear();
+        }
+    }
+
+    // append at most max_count keys starting with prefix, in ascending order
+    void PrefixKeys(std::string_view prefix, SizeT max_count, Vector<String> &keys) {
+        Vector<String> matched_keys;
+        for (Shard &shard : shards_) {
+            std::shared_lock<std::shared_mutex> lock(shard.mutex_);
+            for (const auto &[key, _] : shard.map_) {
+                if (key.starts_with(prefix)) {
+                    matched_keys.emplace_back(key);
+                }
+            }
+        }
+        std::sort(matched_keys.begin(), matched_keys.end());
+        for (SizeT i = 0; i < matched_keys.size() && keys.size() < max_count; ++i) {
+            keys.push_back(std::move(matched_keys[i]));
+        }
+    }
+
+    // all items in ascending order of keys
+    // WARN: Caller shall ensure there's no concurrent write access
+    Vector<Pair<std::string_view, ValueType>> UnsafeSortedItems() const {
+        Vector<Pair<std::string_view, ValueType>> items;
+        SizeT item_count = 0;
+        for (const Shard &shard : shards_) {
+            item_count += shard.map_.size();
+        }
+        items.reserve(item_count);
+        for (const Shard &shard : shards_) {
+            items.insert(items.end(), shard.map_.begin(), shard.map_.end());
+        }
+        std::sort(items.begin(), items.end(), [](const auto &lhs, const auto &rhs) { return lhs.first < rhs.first; });
+        return items;
+    }
+};
+
+} // namespace infinity
@@ -0,0 +1,244 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+module;
+
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wmissing-field-initializers"
+#pragma clang diagnostic ignored "-W#pragma-messages"
+
+#include <ctpl_stl.h>
+
+#pragma clang diagnostic pop
+
+#include <cassert>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <filesystem>
+#include <unistd.h>
+
+module term_tuple_spill;
+
+import stl;
+import third_party;
+import infinity_exception;
+
+namespace infinity {
+
+namespace {
+
+char *AllocAligned(SizeT size) {
+    void *ptr = std::aligned_alloc(TermTupleSpillFile::SPILL_ALIGNMENT, size);
+    if (ptr == nullptr) {
+        UnrecoverableError(fmt::format("Failed to allocate {} bytes of spill buffer", size));
+    }
+    return static_cast<char *>(ptr);
+}
+
+inline SizeT PadTo(SizeT size, SizeT alignment) { return (size + alignment - 1) / alignment * alignment; }
+
+constexpr char ZEROS[TermTupleSpillFile::SPILL_ALIGNMENT] = {};
+
+} // namespace
+
+TermTupleSpillFile::TermTupleSpillFile(const String &path) : path_(path) {
+    fd_ = open(path_.c_str(), O_CREAT | O_TRUNC | O_RDWR, 0644);
+    if (fd_ < 0) {
+        UnrecoverableError(fmt::format("Failed to open spill file {}: {}", path_, strerror(errno)));
+    }
+    buffer_ = AllocAligned(WRITE_BUFFER_SIZE);
+}
+
+TermTupleSpillFile::~TermTupleSpillFile() {
+    if (fd_ >= 0) {
+        close(fd_);
+        std::filesystem::remove(path_);
+    }
+    std::free(buffer_);
+}
+
+void TermTupleSpillFile::BeginRun() { run_begin_ = flushed_size_ + buffer_used_; }
+
+void TermTupleSpillFile::AddTerm(std::string_view term, u32 tuple_count) {
+    const u32 header[2] = {static_cast<u32>(term.size()), tuple_count};
+    Append(header, sizeof(header));
+    Append(term.data(), term.size());
+    Append(ZEROS, PadTo(term.size(), sizeof(SpillTuple)) - term.size());
+    tuple_count_ += tuple_count;
+}
+
+void TermTupleSpillFile::EndRun() {
+    const u64 run_end = flushed_size_ + buffer_used_;
+    runs_.push_back({run_begin_, run_end - run_begin_});
+    Append(ZEROS, PadTo(run_end, SPILL_ALIGNMENT) - run_end);
+}
+
+void TermTupleSpillFile::FinishWrite() {
+    if (buffer_used_ > 0) {
+        Flush();
+    }
+    std::free(buffer_);
+    buffer_ = nullptr;
+}
+
+void TermTupleSpillFile::Append(const void *data, SizeT size) {
+    const char *src = static_cast<const char *>(data);
+    while (size > 0) {
+        if (buffer_used_ == WRITE_BUFFER_SIZE) {
+            Flush();
+        }
+        const SizeT copy_size = std::min(size, WRITE_BUFFER_SIZE - buffer_used_);
+        std::memcpy(buffer_ + buffer_used_, src, copy_size);
+        buffer_used_ += copy_size;
+        src += copy_size;
+        size -= copy_size;
+    }
+}
+
+void TermTupleSpillFile::Flush() {
+    SizeT written = 0;
+    while (written < buffer_used_) {
+        const ssize_t ret = pwrite(fd_, buffer_ + written, buffer_used_ - written, flushed_size_ + written);
+        if (ret < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            UnrecoverableError(fmt::format("Failed to write spill file {}: {}", path_, strerror(errno)));
+        }
+        written += ret;
+    }
+    flushed_size_ += buffer_used_;
+    buffer_used_ = 0;
+}
+
+Vector<UniquePtr<TermTupleRunReader>> TermTupleSpillFile::OpenRunReaders(SizeT memory_budget, ThreadPool &read_ahead_pool) {
+    assert(buffer_ == nullptr);
+    Vector<UniquePtr<TermTupleRunReader>> readers;
+    if (runs_.empty()) {
+        return readers;
+    }
+    // two buffers per reader
+    SizeT buffer_size = memory_budget / (2 * runs_.size());
+    buffer_size = std::min(std::max(buffer_size, MIN_READ_BUFFER_SIZE), MAX_READ_BUFFER_SIZE) / SPILL_ALIGNMENT * SPILL_ALIGNMENT;
+    for (const SpillRun &run : runs_) {
+        readers.push_back(MakeUnique<TermTupleRunReader>(fd_, run, std::min<SizeT>(buffer_size, PadTo(run.size_, SPILL_ALIGNMENT)), read_ahead_pool));
+    }
+    return readers;
+}
+
+TermTupleRunReader::TermTupleRunReader(int fd, const SpillRun &run, SizeT buffer_size, ThreadPool &read_ahead_pool)
+    : fd_(fd), run_(run), buffer_size_(buffer_size), read_ahead_pool_(read_ahead_pool) {
+    buffers_[0] = AllocAligned(buffer_size_);
+    buffers_[1] = AllocAligned(buffer_size_);
+    current_size_ = std::min<u64>(buffer_size_, run_.size_);
+    scheduled_end_ = current_size_;
+    ReadAt(buffers_[current_], run_.offset_, current_size_);
+    ScheduleReadAhead();
+}
+
+TermTupleRunReader::~TermTupleRunReader() {
+    if (read_ahead_.valid()) {
+        read_ahead_.wait();
+    }
+    std::free(buffers_[0]);
+    std::free(buffers_[1]);
+}
+
+bool TermTupleRunReader::NextTerm() {
+    assert(tuple_left_ == 0);
+    if (buffer_begin_ + position_ >= run_.size_) {
+        return false;
+    }
+    u32 header[2];
+    Read(header, sizeof(header));
+    term_.resize(header[0]);
+    Read(term_.data(), term_.size());
+    // the padding never crosses a buffer, as the buffers hold a multiple of 8 bytes
+    position_ += PadTo(term_.size(), sizeof(SpillTuple)) - term_.size();
+    tuple_left_ = header[1];
+    return true;
+}
+
+SizeT TermTupleRunReader::ReadTuples(const SpillTuple *&tuples) {
+    if (tuple_left_ == 0) {
+        return 0;
+    }
+    if (position_ == current_size_) {
+        NextBuffer();
+    }
+    const SizeT tuple_num = std::min<SizeT>(tuple_left_, (current_size_ - position_) / sizeof(SpillTuple));
+    tuples = reinterpret_cast<const SpillTuple *>(buffers_[current_] + position_);
+    position_ += tuple_num * sizeof(SpillTuple);
+    tuple_left_ -= tuple_num;
+    return tuple_num;
+}
+
+void TermTupleRunReader::Read(void *data, SizeT size) {
+    char *dst = static_cast<char *>(data);
+    while (size > 0) {
+        if (position_ == current_size_) {
+            NextBuffer();
+        }
+        const SizeT copy_size = std::min(size, current_size_ - position_);
+        std::memcpy(dst, buffers_[current_] + position_, copy_size);
+        position_ += copy_size;
+        dst += copy_size;
+        size -= copy_size;
+    }
+}
+
+void TermTupleRunReader::NextBuffer() {
+    if (!read_ahead_.valid()) {
+        UnrecoverableError("Read past the end of a spill run");
+    }
+    const SizeT next_size = read_ahead_.get();
+    buffer_begin_ += current_size_;
+    current_ = 1 - current_;
+    current_size_ = next_size;
+    position_ = 0;
+    ScheduleReadAhead();
+}
+
+void TermTupleRunReader::ScheduleReadAhead() {
+    if (scheduled_end_ >= run_.size_) {
+        return;
+    }
+    char *buffer = buffers_[1 - current_];
+    const u64 offset = run_.offset_ + scheduled_end_;
+    const SizeT size = std::min<u64>(buffer_size_, run_.size_ - scheduled_end_);
+    scheduled_end_ += size;
+    read_ahead_ = read_ahead_pool_.push([this, buffer, offset, size](int) { return ReadAt(buffer, offset, size); });
+}
+
+SizeT TermTupleRunReader::ReadAt(char *buffer, u64 offset, SizeT size) {
+    SizeT read = 0;
+    while (read < size) {
+        const ssize_t ret = pread(fd_, buffer + read, size - read, offset + read);
+        if (ret < 0 && errno == EINTR) {
+            continue;
+        }
+        if (ret <= 0) {
+            UnrecoverableError(fmt::format("Failed to read spill file at {}: {}", offset + read, ret == 0 ? "unexpected end" : strerror(errno)));
+        }
+        read += ret;
+    }
+    return read;
+}
+
+} // namespace infinity
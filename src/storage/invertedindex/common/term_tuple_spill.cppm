@@ -0,0 +1,145 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+module;
+
+export module term_tuple_spill;
+
+import stl;
+
+namespace infinity {
+
+// A tuple of a term occurrence, the term itself is written once per run in front of its tuples.
+export struct SpillTuple {
+    u32 doc_id_;
+    u32 term_pos_;
+};
+
+export struct SpillRun {
+    u64 offset_{};
+    u64 size_{};
+};
+
+export class TermTupleRunReader;
+
+// Temp file of the offline index build. Each inverter spills its sorted tuples as a run:
+//    +-------------+---------------+----------------------------+-----------------------------+----
+//    | term length | tuple count n | term, zero padded to 8     | n * SpillTuple (doc, pos)   | next term ...
+//    +-------------+---------------+----------------------------+-----------------------------+----
+// Runs start at SPILL_ALIGNMENT and the file is written only in whole buffers, so all the writes and the reads of the merge
+// are large and aligned. The tuples are 8 byte aligned in the file and are read without a copy.
+// The file is removed when the object is destroyed.
+export class TermTupleSpillFile {
+public:
+    static constexpr SizeT SPILL_ALIGNMENT = 4096;
+    static constexpr SizeT WRITE_BUFFER_SIZE = 4 * 1024 * 1024;
+    static constexpr SizeT MIN_READ_BUFFER_SIZE = 64 * 1024;
+    static constexpr SizeT MAX_READ_BUFFER_SIZE = 4 * 1024 * 1024;
+
+    explicit TermTupleSpillFile(const String &path);
+
+    ~TermTupleSpillFile();
+
+    TermTupleSpillFile(const TermTupleSpillFile &) = delete;
+    TermTupleSpillFile &operator=(const TermTupleSpillFile &) = delete;
+
+    void BeginRun();
+
+    // tuple_count tuples of the term shall follow
+    void AddTerm(std::string_view term, u32 tuple_count);
+
+    void AddTuple(u32 doc_id, u32 term_pos) {
+        if (buffer_used_ == WRITE_BUFFER_SIZE) {
+            Flush();
+        }
+        auto *tuple = reinterpret_cast<SpillTuple *>(buffer_ + buffer_used_);
+        tuple->doc_id_ = doc_id;
+        tuple->term_pos_ = term_pos;
+        buffer_used_ += sizeof(SpillTuple);
+    }
+
+    void EndRun();
+
+    // Flush the written runs, no run can be added after it.
+    void FinishWrite();
+
+    // A reader of every run in order. The read buffers of all readers take about memory_budget bytes, each reader reads its next
+    // buffer in read_ahead_pool while the current one is consumed.
+    Vector<UniquePtr<TermTupleRunReader>> OpenRunReaders(SizeT memory_budget, ThreadPool &read_ahead_pool);
+
+    SizeT RunCount() const { return runs_.size(); }
+
+    u64 TupleCount() const { return tuple_count_; }
+
+private:
+    void Append(const void *data, SizeT size);
+
+    void Flush();
+
+    String path_;
+    int fd_{-1};
+    char *buffer_{nullptr};
+    SizeT buffer_used_{0};
+    u64 flushed_size_{0};
+    u64 run_begin_{0};
+    u64 tuple_count_{0};
+    Vector<SpillRun> runs_;
+};
+
+// Reads the terms of a run in order, and the tuples of each term straight from the read buffer.
+export class TermTupleRunReader {
+public:
+    TermTupleRunReader(int fd, const SpillRun &run, SizeT buffer_size, ThreadPool &read_ahead_pool);
+
+    ~TermTupleRunReader();
+
+    TermTupleRunReader(const TermTupleRunReader &) = delete;
+    TermTupleRunReader &operator=(const TermTupleRunReader &) = delete;
+
+    // Move to the next term, returns false at the end of the run. The tuples of the current term shall be all read.
+    bool NextTerm();
+
+    std::string_view term() const { return term_; }
+
+    // Returns the number of the next tuples of the current term that are in the read buffer, 0 if all are read.
+    SizeT ReadTuples(const SpillTuple *&tuples);
+
+private:
+    void Read(void *data, SizeT size);
+
+    void NextBuffer();
+
+    void ScheduleReadAhead();
+
+    SizeT ReadAt(char *buffer, u64 offset, SizeT size);
+
+    const int fd_;
+    const SpillRun run_;
+    const SizeT buffer_size_;
+    ThreadPool &read_ahead_pool_;
+
+    Array<char *, 2> buffers_{};
+    SizeT current_{0};       // index of the buffer being consumed
+    SizeT current_size_{0};  // bytes of the run in the current buffer
+    SizeT position_{0};      // consumed bytes of the current buffer
+    u64 buffer_begin_{0};    // run offset of the current buffer
+    u64 scheduled_end_{0};   // run offset up to which the reads are scheduled
+    Future<SizeT> read_ahead_{};
+
+    String term_;
+    u32 tuple_left_{0};
+};
+
+} // namespace infinity
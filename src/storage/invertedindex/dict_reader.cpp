@@ -68,6 +68,12 @@ void DictionaryReader::InitIterator(const String &min, const String &max) {
 
 void DictionaryReader::InitIterator(const String &prefix) { s_->Reset((u8 *)prefix.c_str(), prefix.length()); }
 
+void DictionaryReader::InitRangeIterator(const String &lower, const String &upper) {
+    Bound min = lower.empty() ? Bound() : Bound(Bound::kIncluded, (u8 *)lower.c_str(), lower.length());
+    Bound max = upper.empty() ? Bound() : Bound(Bound::kExcluded, (u8 *)upper.c_str(), upper.length());
+    s_->Reset(min, max);
+}
+
 bool DictionaryReader::Next(String &term, TermMeta &term_meta) {
     Vector<u8> key;
     u64 val;
@@ -81,4 +87,13 @@ bool DictionaryReader::Next(String &term, TermMeta &term_meta) {
     return true;
 }
 
+void DictionaryReader::LookupPrefix(const String &prefix, SizeT max_count, Vector<String> &terms) {
+    s_->Reset((u8 *)prefix.c_str(), prefix.length());
+    Vector<u8> key;
+    u64 val;
+    while (terms.size() < max_count && s_->Next(key, val)) {
+        terms.emplace_back((char *)key.data(), key.size());
+    }
+}
+
 } // namespace infinity
\ No newline at end of file
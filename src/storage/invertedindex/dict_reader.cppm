@@ -42,6 +42,12 @@ public:
 
     void InitIterator(const String &prefix);
 
+    // iterate the terms in [lower, upper), an empty bound is unbounded
+    void InitRangeIterator(const String &lower, const String &upper);
+
     bool Next(String &term, TermMeta &term_meta);
+
+    // append at most max_count terms starting with prefix, in lexicographical order
+    void LookupPrefix(const String &prefix, SizeT max_count, Vector<String> &terms);
 };
 } // namespace infinity
@@ -14,6 +14,8 @@
 
 module;
 
+#include <cassert>
+
 module disk_index_segment_reader;
 
 import stl;
@@ -21,43 +23,101 @@ import memory_pool;
 import segment_posting;
 import index_defines;
 import index_segment_reader;
-import file_reader;
 import dict_reader;
 import term_meta;
 import byte_slice;
 import posting_list_format;
+import mmap;
+import term_meta_cache;
+import default_values;
+import infinity_exception;
+import third_party;
 import internal_types;
 
 namespace infinity {
 
-DiskIndexSegmentReader::DiskIndexSegmentReader(const String &index_dir, const String &base_name, RowID base_row_id, optionflag_t flag)
-    : base_row_id_(base_row_id) {
+struct PostingFileMapping {
+    u8 *data_ptr_{nullptr};
+    SizeT data_len_{0};
+
+    // an empty posting file is left unmapped
+    explicit PostingFileMapping(const String &posting_file) { MmapFile(posting_file, data_ptr_, data_len_); }
+
+    ~PostingFileMapping() {
+        if (data_ptr_ != nullptr) {
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-variable"
+            int rc = MunmapFile(data_ptr_, data_len_);
+            assert(rc == 0);
+#pragma clang diagnostic pop
+        }
+    }
+};
+
+namespace {
+
+// A posting list pointing into the mapped posting file, which is kept mapped as long as the list lives.
+class MappedByteSliceList : public ByteSliceList {
+public:
+    MappedByteSliceList(SharedPtr<PostingFileMapping> mapping, u8 *data, SizeT data_size)
+        : ByteSliceList(ByteSlice::WrapData(data, data_size)), mapping_(std::move(mapping)) {}
+
+private:
+    SharedPtr<PostingFileMapping> mapping_;
+};
+
+} // namespace
+
+DiskIndexSegmentReader::DiskIndexSegmentReader(const String &index_dir,
+                                               const String &base_name,
+                                               RowID base_row_id,
+                                               TxnTimeStamp commit_ts,
+                                               optionflag_t flag)
+    : base_row_id_(base_row_id), commit_ts_(commit_ts) {
     Path path = Path(index_dir) / base_name;
     String path_str = path.string();
     String dict_file = path_str;
     dict_file.append(DICT_SUFFIX);
     dict_reader_ = MakeShared<DictionaryReader>(dict_file, PostingFormatOption(flag));
-    String posting_file = path_str;
-    posting_file.append(POSTING_SUFFIX);
-    posting_reader_ = MakeShared<FileReader>(fs_, posting_file, 1024);
+    posting_file_ = path_str;
+    posting_file_.append(POSTING_SUFFIX);
+    posting_mapping_ = MakeShared<PostingFileMapping>(posting_file_);
 }
 
 DiskIndexSegmentReader::~DiskIndexSegmentReader() {}
 
-bool DiskIndexSegmentReader::GetSegmentPosting(const String &term, SegmentPosting &seg_posting, MemoryPool *session_pool) const {
-    TermMeta term_meta;
-    if (!dict_reader_.get() || !dict_reader_->Lookup(term, term_meta))
+bool DiskIndexSegmentReader::GetSegmentPosting(const String &term, SegmentPosting &seg_posting, MemoryPool *) const {
+    if (!dict_reader_.get())
         return false;
+    // the hot terms skip the dictionary
+    TermMeta term_meta;
+    String cache_key = TermMetaCache::MakeKey(posting_file_, commit_ts_, term);
+    if (!TermMetaCache::instance().Get(cache_key, term_meta)) {
+        if (!dict_reader_->Lookup(term, term_meta))
+            return false;
+        TermMetaCache::instance().Put(cache_key, term_meta);
+    }
     u64 file_length = term_meta.pos_end_ - term_meta.doc_start_;
-    ByteSlice *slice = ByteSlice::CreateSlice(file_length, session_pool);
-    {
-        std::lock_guard<std::mutex> lock(mutex_);
-        posting_reader_->Seek(term_meta.doc_start_);
-        posting_reader_->Read((char *)slice->data_, file_length);
+    if (posting_mapping_->data_ptr_ == nullptr || term_meta.pos_end_ > posting_mapping_->data_len_) {
+        UnrecoverableError(fmt::format("Posting of term {} is out of the mapped posting file {}", term, posting_file_));
     }
-    SharedPtr<ByteSliceList> byte_slice_list = MakeShared<ByteSliceList>(slice, session_pool);
+    u8 *data = posting_mapping_->data_ptr_ + term_meta.doc_start_;
+    // the file is mapped for random access, ask for the pages of this list before decoding
+    if (file_length >= FULL_TEXT_SEQUENTIAL_POSTING_SIZE) {
+        MmapAdvise(data, file_length, MmapAdvice::kSequential);
+    }
+    MmapAdvise(data, file_length, MmapAdvice::kWillNeed);
+    auto byte_slice_list = MakeShared<MappedByteSliceList>(posting_mapping_, data, file_length);
     seg_posting.Init(std::move(byte_slice_list), base_row_id_, term_meta.doc_freq_, term_meta);
     return true;
 }
 
+void DiskIndexSegmentReader::GetTermsWithPrefix(const String &prefix, SizeT max_count, Vector<String> &terms) const {
+    if (!dict_reader_.get())
+        return;
+    // the dictionary stream is shared
+    std::lock_guard<std::mutex> lock(mutex_);
+    dict_reader_->LookupPrefix(prefix, max_count, terms);
+}
+
 } // namespace infinity
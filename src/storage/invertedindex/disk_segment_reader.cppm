@@ -21,25 +21,32 @@ import segment_posting;
 import index_defines;
 import index_segment_reader;
 import dict_reader;
-import file_reader;
 import posting_list_format;
-import local_file_system;
 import internal_types;
 
 namespace infinity {
+
+struct PostingFileMapping;
+
+// The posting file is mapped once and the posting lists are decoded from the mapping in place, the page cache keeps the hot terms.
 export class DiskIndexSegmentReader : public IndexSegmentReader {
 public:
-    DiskIndexSegmentReader(const String &index_dir, const String &base_name, RowID base_row_id, optionflag_t flag);
+    DiskIndexSegmentReader(const String &index_dir, const String &base_name, RowID base_row_id, TxnTimeStamp commit_ts, optionflag_t flag);
     virtual ~DiskIndexSegmentReader();
 
     bool GetSegmentPosting(const String &term, SegmentPosting &seg_posting, MemoryPool *session_pool) const override;
 
+    void GetTermsWithPrefix(const String &prefix, SizeT max_count, Vector<String> &terms) const override;
+
 private:
     RowID base_row_id_{INVALID_ROWID};
+    // the commit ts of the chunk, a key of its term metas in the TermMetaCache
+    TxnTimeStamp commit_ts_{};
+    String posting_file_{};
     SharedPtr<DictionaryReader> dict_reader_;
     mutable std::mutex mutex_;
-    SharedPtr<FileReader> posting_reader_;
-    LocalFileSystem fs_{};
+    // shared with the posting lists handed out, so a list outlives the reader safely
+    SharedPtr<PostingFileMapping> posting_mapping_;
 };
 
 } // namespace infinity
\ No newline at end of file
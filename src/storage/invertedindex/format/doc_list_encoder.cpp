@@ -14,6 +14,7 @@ import skiplist_reader;
 import index_defines;
 import skiplist_reader;
 import vbyte_compressor;
+import byte_slice;
 import logger;
 
 namespace infinity {
@@ -95,11 +96,18 @@ void DocListEncoder::Dump(const SharedPtr<FileWriter> &file, bool spill) {
         if (doc_skiplist_writer_.get()) {
             doc_skiplist_size = doc_skiplist_writer_->EstimateDumpSize();
         }
+        Vector<u32> skip_index = EncodeSkipIndex();
+        for (u32 value : skip_index) {
+            doc_skiplist_size += VByteCompressor::GetVInt32Length(value);
+        }
 
         u32 doc_list_size = doc_list_buffer_.EstimateDumpSize();
 
         file->WriteVInt(doc_skiplist_size);
         file->WriteVInt(doc_list_size);
+        for (u32 value : skip_index) {
+            file->WriteVInt(value);
+        }
     }
 
     if (doc_skiplist_writer_.get()) {
@@ -128,6 +136,9 @@ u32 DocListEncoder::GetDumpLength() {
     if (doc_skiplist_writer_.get()) {
         doc_skiplist_size = doc_skiplist_writer_->EstimateDumpSize();
     }
+    for (u32 value : EncodeSkipIndex()) {
+        doc_skiplist_size += VByteCompressor::GetVInt32Length(value);
+    }
     u32 doc_list_size = doc_list_buffer_.EstimateDumpSize();
     return VByteCompressor::GetVInt32Length(doc_skiplist_size) + VByteCompressor::GetVInt32Length(doc_list_size) + doc_skiplist_size + doc_list_size;
 }
@@ -164,6 +175,36 @@ void DocListEncoder::AddSkipListItem(u32 item_size) {
     }
 }
 
+Vector<u32> DocListEncoder::EncodeSkipIndex() const {
+    Vector<u32> values;
+    if (!format_option_.HasSkipIndex() or df_ < SKIP_INDEX_MIN_DOC_FREQ or !doc_skiplist_writer_.get()) {
+        return values;
+    }
+    // summarize the flushed skip list, see SkipListReaderByteSlice::LoadSkipIndex() for the layout
+    const ByteSliceList *skiplist = doc_skiplist_writer_->GetByteSliceList();
+    SkipListReaderByteSlice skiplist_reader(format_option_);
+    skiplist_reader.Load(skiplist, 0, skiplist->GetTotalSize());
+    Vector<SkipIndexEntry> skip_index;
+    skiplist_reader.BuildSkipIndex(skip_index);
+    values.push_back(static_cast<u32>(skip_index.size()));
+    u32 prev_skiplist_offset = 0;
+    for (const SkipIndexEntry &entry : skip_index) {
+        values.push_back(entry.last_doc_id_ - entry.prev_doc_id_);
+        values.push_back(entry.skiplist_offset_ - prev_skiplist_offset);
+        values.push_back(entry.record_count_);
+        values.push_back(entry.offset_sum_);
+        if (format_option_.HasTfList()) {
+            values.push_back(entry.ttf_sum_);
+        }
+        if (format_option_.HasBlockMax()) {
+            values.push_back(entry.block_max_tf_);
+            values.push_back(entry.block_max_tf_percentage_);
+        }
+        prev_skiplist_offset = entry.skiplist_offset_;
+    }
+    return values;
+}
+
 InMemDocListDecoder *DocListEncoder::GetInMemDocListDecoder(MemoryPool *session_pool) const {
     df_t df = df_;
     SkipListReaderPostingByteSlice *skiplist_reader = nullptr;
@@ -63,6 +63,9 @@ private:
 
     void AddSkipListItem(u32 item_size);
 
+    // the values written as vints before the doc skip list, empty if the list gets no skip index
+    Vector<u32> EncodeSkipIndex() const;
+
 private:
     PostingByteSlice doc_list_buffer_;
     bool own_doc_list_format_;
@@ -26,6 +26,8 @@ public:
         }
         short_list_vbyte_compress_ = 0;
         has_block_max_ = (option_flag & of_block_max) ? 1 : 0;
+        stream_vbyte_ = (option_flag & of_stream_vbyte) ? 1 : 0;
+        skip_index_ = (option_flag & of_skip_index) ? 1 : 0;
         unused_ = 0;
         // when has_block_max_ is set, has_tf_list_ must also be set
         if (has_block_max_ and !has_tf_list_) {
@@ -37,9 +39,12 @@ public:
     bool HasTfList() const { return has_tf_list_ == 1; }
     bool HasDocPayload() const { return has_doc_payload_ == 1; }
     bool HasBlockMax() const { return has_block_max_ == 1; }
+    bool IsStreamVByte() const { return stream_vbyte_ == 1; }
+    bool HasSkipIndex() const { return skip_index_ == 1; }
     bool operator==(const DocListFormatOption &right) const {
         return has_tf_ == right.has_tf_ && has_tf_list_ == right.has_tf_list_ && has_doc_payload_ == right.has_doc_payload_ &&
-               short_list_vbyte_compress_ == right.short_list_vbyte_compress_ && has_block_max_ == right.has_block_max_;
+               short_list_vbyte_compress_ == right.short_list_vbyte_compress_ && has_block_max_ == right.has_block_max_ &&
+               stream_vbyte_ == right.stream_vbyte_ && skip_index_ == right.skip_index_;
     }
     bool IsShortListVbyteCompress() const { return short_list_vbyte_compress_ == 1; }
     void SetShortListVbyteCompress(bool flag) { short_list_vbyte_compress_ = flag ? 1 : 0; }
@@ -50,7 +55,9 @@ private:
     u8 has_doc_payload_ : 1;
     u8 short_list_vbyte_compress_ : 1;
     u8 has_block_max_ : 1;
-    u8 unused_ : 3;
+    u8 stream_vbyte_ : 1;
+    u8 skip_index_ : 1;
+    u8 unused_ : 1;
 };
 
 export class DocSkipListFormat : public PostingFields {
@@ -133,7 +140,7 @@ public:
             TypedPostingField<u32> *doc_id_field = new TypedPostingField<u32>;
             doc_id_field->location_ = row_count++;
             doc_id_field->offset_ = offset;
-            doc_id_field->encoder_ = GetDocIDEncoder();
+            doc_id_field->encoder_ = GetDocIDEncoder(option.IsStreamVByte());
             values_.push_back(doc_id_field);
             offset += sizeof(u32);
         }
@@ -141,7 +148,7 @@ public:
             TypedPostingField<u32> *tf_field = new TypedPostingField<u32>;
             tf_field->location_ = row_count++;
             tf_field->offset_ = offset;
-            tf_field->encoder_ = GetTFEncoder();
+            tf_field->encoder_ = GetTFEncoder(option.IsStreamVByte());
             values_.push_back(tf_field);
             offset += sizeof(u32);
         }
@@ -25,6 +25,9 @@ public:
     // u16: block max (ceil(tf / doc length) * numeric_limits<u16>::max())
     virtual Pair<u32, u16> GetBlockMaxInfo() const = 0;
 
+    // the max info of the records from the one holding doc_id up to range_last_doc_id, when the skip list has a skip index
+    virtual bool GetSkipRangeMaxInfo(docid_t doc_id, docid_t &range_last_doc_id, Pair<u32, u16> &max_info) const { return false; }
+
     virtual bool DecodeCurrentDocIDBuffer(docid_t *doc_buffer) = 0;
 
     virtual bool DecodeCurrentTFBuffer(tf_t *tf_buffer) = 0;
@@ -56,8 +59,8 @@ public:
                      const DocListFormatOption &doc_list_format_option)
         : IndexDecoder(doc_list_format_option), skiplist_reader_(nullptr), session_pool_(session_pool), doc_list_reader_(doc_list_reader),
           doc_list_begin_pos_(doc_list_begin) {
-        doc_id_encoder_ = GetDocIDEncoder();
-        tf_list_encoder_ = GetTFEncoder();
+        doc_id_encoder_ = GetDocIDEncoder(doc_list_format_option.IsStreamVByte());
+        tf_list_encoder_ = GetTFEncoder(doc_list_format_option.IsStreamVByte());
         doc_payload_encoder_ = GetDocPayloadEncoder();
     }
 
@@ -76,12 +79,18 @@ public:
         skiplist_reader_ = session_pool_ ? (new ((session_pool_)->Allocate(sizeof(SkipListType))) SkipListType(doc_list_format_option_))
                                          : new SkipListType(doc_list_format_option_);
         skiplist_reader_->Load(posting_list, start, end);
+        if (doc_list_format_option_.HasSkipIndex() and df >= SKIP_INDEX_MIN_DOC_FREQ) {
+            skiplist_reader_->LoadSkipIndex();
+        }
     }
 
     void InitSkipList(u32 start, u32 end, ByteSlice *posting_list, df_t df) {
         skiplist_reader_ = session_pool_ ? (new ((session_pool_)->Allocate(sizeof(SkipListType))) SkipListType(doc_list_format_option_))
                                          : new SkipListType(doc_list_format_option_);
         skiplist_reader_->Load(posting_list, start, end);
+        if (doc_list_format_option_.HasSkipIndex() and df >= SKIP_INDEX_MIN_DOC_FREQ) {
+            skiplist_reader_->LoadSkipIndex();
+        }
     }
 
     bool DecodeSkipList(docid_t start_doc_id, docid_t &prev_last_doc_id, docid_t &last_doc_id, ttf_t &current_ttf) {
@@ -102,6 +111,10 @@ public:
         return skiplist_reader_->GetBlockMaxInfo();
     }
 
+    bool GetSkipRangeMaxInfo(docid_t doc_id, docid_t &range_last_doc_id, Pair<u32, u16> &max_info) const {
+        return skiplist_reader_->GetSkipIndexMaxInfo(doc_id, range_last_doc_id, max_info);
+    }
+
     bool DecodeCurrentDocIDBuffer(docid_t *doc_buffer) {
         doc_list_reader_->Seek(offset_ + doc_list_begin_pos_);
         doc_id_encoder_->Decode((u32 *)doc_buffer, MAX_DOC_PER_RECORD, *doc_list_reader_);
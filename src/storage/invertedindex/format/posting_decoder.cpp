@@ -94,9 +94,9 @@ u32 PostingDecoder::DecodePosList(pos_t *pos_list_buf, SizeT len) {
 }
 
 void PostingDecoder::InitDocListEncoder(const DocListFormatOption &doc_list_format_option, df_t df) {
-    doc_id_encoder_ = GetDocIDEncoder();
+    doc_id_encoder_ = GetDocIDEncoder(doc_list_format_option.IsStreamVByte());
     if (doc_list_format_option.HasTfList()) {
-        tf_list_encoder_ = GetTFEncoder();
+        tf_list_encoder_ = GetTFEncoder(doc_list_format_option.IsStreamVByte());
     }
 
     if (doc_list_format_option.HasDocPayload()) {
@@ -2,6 +2,7 @@ module;
 
 import stl;
 import int_encoder;
+import fastpfor;
 import no_compress_encoder;
 import vbyte_compress_encoder;
 
@@ -10,7 +11,8 @@ module posting_field;
 namespace infinity {
 
 struct EncoderProvider {
-    UniquePtr<Int32Encoder> int32_encoder_ = MakeUnique<Int32Encoder>();
+    UniquePtr<Int32Encoder> int32_encoder_ = MakeUnique<IntEncoder<u32, SIMDBitPacking>>();
+    UniquePtr<Int32Encoder> stream_vbyte_int32_encoder_ = MakeUnique<IntEncoder<u32, SIMDBitPackingStreamVByte>>();
     UniquePtr<Int16Encoder> int16_encoder_ = MakeUnique<Int16Encoder>();
     UniquePtr<NoCompressEncoder> no_compress_encoder_ = MakeUnique<NoCompressEncoder>();
     UniquePtr<VByteCompressEncoder> vbyte_compress_encoder_ = MakeUnique<VByteCompressEncoder>();
@@ -22,6 +24,8 @@ struct EncoderProvider {
 
     Int32Encoder *GetInt32Encoder() { return int32_encoder_.get(); }
 
+    Int32Encoder *GetStreamVByteInt32Encoder() { return stream_vbyte_int32_encoder_.get(); }
+
     Int16Encoder *GetInt16Encoder() { return int16_encoder_.get(); }
 
     NoCompressEncoder *GetNoCompressEncoder() { return no_compress_encoder_.get(); }
@@ -29,9 +33,13 @@ struct EncoderProvider {
     VByteCompressEncoder *GetVByteCompressEncoder() { return vbyte_compress_encoder_.get(); }
 };
 
-const Int32Encoder *GetDocIDEncoder() { return EncoderProvider::GetInstance()->GetInt32Encoder(); }
+const Int32Encoder *GetDocIDEncoder(bool stream_vbyte) {
+    return stream_vbyte ? EncoderProvider::GetInstance()->GetStreamVByteInt32Encoder() : EncoderProvider::GetInstance()->GetInt32Encoder();
+}
 
-const Int32Encoder *GetTFEncoder() { return EncoderProvider::GetInstance()->GetInt32Encoder(); }
+const Int32Encoder *GetTFEncoder(bool stream_vbyte) {
+    return stream_vbyte ? EncoderProvider::GetInstance()->GetStreamVByteInt32Encoder() : EncoderProvider::GetInstance()->GetInt32Encoder();
+}
 
 const Int16Encoder *GetDocPayloadEncoder() { return EncoderProvider::GetInstance()->GetInt16Encoder(); }
 
@@ -44,7 +44,7 @@ struct ValueTypeTraits<u32> {
 };
 
 // export typedef IntEncoder<u32, NewPForDeltaCompressor> Int32Encoder;
-export typedef IntEncoder<u32, SIMDBitPacking> Int32Encoder;
+export typedef Int32EncoderBase Int32Encoder;
 export typedef IntEncoder<u16, NewPForDeltaCompressor> Int16Encoder;
 export typedef NoCompressIntEncoder<u32> NoCompressEncoder;
 export typedef VByteIntEncoder<u32> VByteCompressEncoder;
@@ -61,12 +61,13 @@ struct EncoderTypeTraits<u16> {
 template <>
 struct EncoderTypeTraits<u32> {
     // typedef IntEncoder<u32, NewPForDeltaCompressor> Encoder;
-    typedef IntEncoder<u32, SIMDBitPacking> Encoder;
+    typedef Int32Encoder Encoder;
 };
 
-export const Int32Encoder *GetDocIDEncoder();
+// stream_vbyte: records shorter than a block are StreamVByte coded, see of_stream_vbyte
+export const Int32Encoder *GetDocIDEncoder(bool stream_vbyte);
 
-export const Int32Encoder *GetTFEncoder();
+export const Int32Encoder *GetTFEncoder(bool stream_vbyte);
 
 export const Int16Encoder *GetDocPayloadEncoder();
 
@@ -97,6 +97,9 @@ void SkipListReaderByteSlice::Load(const ByteSliceList *byte_slice_list, u32 sta
     end_ = end;
     byte_slice_reader_.Open(const_cast<ByteSliceList *>(byte_slice_list));
     byte_slice_reader_.Seek(start);
+    skip_index_.clear();
+    skiplist_begin_ = start;
+    buffer_idx_ = -1;
 }
 
 void SkipListReaderByteSlice::Load(ByteSlice *byte_slice, u32 start, u32 end) {
@@ -111,6 +114,119 @@ void SkipListReaderByteSlice::Load(ByteSlice *byte_slice, u32 start, u32 end) {
     end_ = end;
     byte_slice_reader_.Open(byte_slice);
     byte_slice_reader_.Seek(start);
+    skip_index_.clear();
+    skiplist_begin_ = start;
+    buffer_idx_ = -1;
+}
+
+void SkipListReaderByteSlice::LoadSkipIndex() {
+    // entry count, then per buffer: last doc id delta, offset delta in the skip list, record count, offset sum,
+    // ttf sum if tf list, max tf and max tf percentage if block max
+    u32 entry_count = byte_slice_reader_.ReadVUInt32();
+    skip_index_.resize(entry_count);
+    SkipIndexEntry prev_entry;
+    for (SkipIndexEntry &entry : skip_index_) {
+        entry.prev_doc_id_ = prev_entry.last_doc_id_;
+        entry.prev_record_count_ = prev_entry.prev_record_count_ + prev_entry.record_count_;
+        entry.prev_offset_ = prev_entry.prev_offset_ + prev_entry.offset_sum_;
+        entry.prev_ttf_ = prev_entry.prev_ttf_ + prev_entry.ttf_sum_;
+        entry.last_doc_id_ = entry.prev_doc_id_ + byte_slice_reader_.ReadVUInt32();
+        entry.skiplist_offset_ = prev_entry.skiplist_offset_ + byte_slice_reader_.ReadVUInt32();
+        entry.record_count_ = byte_slice_reader_.ReadVUInt32();
+        entry.offset_sum_ = byte_slice_reader_.ReadVUInt32();
+        if (has_tf_list_) {
+            entry.ttf_sum_ = byte_slice_reader_.ReadVUInt32();
+        }
+        if (has_block_max_) {
+            entry.block_max_tf_ = byte_slice_reader_.ReadVUInt32();
+            entry.block_max_tf_percentage_ = static_cast<u16>(byte_slice_reader_.ReadVUInt32());
+        }
+        prev_entry = entry;
+    }
+    skiplist_begin_ = byte_slice_reader_.Tell();
+}
+
+void SkipListReaderByteSlice::BuildSkipIndex(Vector<SkipIndexEntry> &skip_index) {
+    while (true) {
+        u32 skiplist_offset = byte_slice_reader_.Tell() - skiplist_begin_;
+        auto [status, ret] = LoadBuffer();
+        if (status != 0 or !ret) {
+            break;
+        }
+        SkipIndexEntry entry;
+        entry.skiplist_offset_ = skiplist_offset;
+        entry.record_count_ = num_in_buffer_;
+        entry.prev_doc_id_ = current_doc_id_;
+        entry.prev_record_count_ = skipped_item_count_;
+        entry.prev_offset_ = current_offset_;
+        entry.prev_ttf_ = current_ttf_;
+        for (u32 i = 0; i < num_in_buffer_; ++i) {
+            current_doc_id_ += doc_id_buffer_[i];
+            entry.offset_sum_ += offset_buffer_[i];
+            if (has_tf_list_) {
+                entry.ttf_sum_ += ttf_buffer_[i];
+            }
+            if (has_block_max_) {
+                entry.block_max_tf_ = std::max(entry.block_max_tf_, block_max_tf_buffer_[i]);
+                entry.block_max_tf_percentage_ = std::max(entry.block_max_tf_percentage_, block_max_tf_percentage_buffer_[i]);
+            }
+        }
+        entry.last_doc_id_ = current_doc_id_;
+        skipped_item_count_ += num_in_buffer_;
+        current_offset_ += entry.offset_sum_;
+        current_ttf_ += entry.ttf_sum_;
+        current_cursor_ = num_in_buffer_;
+        skip_index.push_back(entry);
+    }
+}
+
+SizeT SkipListReaderByteSlice::FindSkipIndexEntry(SizeT from_idx, u32 query_doc_id) const {
+    // mostly the doc is in the current buffer or the next one
+    for (SizeT idx = from_idx; idx < skip_index_.size() and idx < from_idx + 2; ++idx) {
+        if (skip_index_[idx].last_doc_id_ >= query_doc_id) {
+            return idx;
+        }
+    }
+    auto it = std::lower_bound(skip_index_.begin() + from_idx, skip_index_.end(), query_doc_id, [](const SkipIndexEntry &entry, u32 doc_id) {
+        return entry.last_doc_id_ < doc_id;
+    });
+    return it - skip_index_.begin();
+}
+
+bool SkipListReaderByteSlice::SkipTo(u32 query_doc_id, u32 &doc_id, u32 &prev_doc_id, u32 &offset, u32 &delta) {
+    if (!skip_index_.empty()) {
+        SizeT from_idx = (buffer_idx_ > 0 and skip_index_[buffer_idx_].prev_doc_id_ < query_doc_id) ? buffer_idx_ : 0;
+        // the last buffer when the doc is beyond the list, walking it exhausts the list as before
+        SizeT idx = std::min(FindSkipIndexEntry(from_idx, query_doc_id), skip_index_.size() - 1);
+        if (static_cast<i32>(idx) > buffer_idx_) {
+            // jump to the buffer without decoding the ones before it
+            const SkipIndexEntry &entry = skip_index_[idx];
+            byte_slice_reader_.Seek(skiplist_begin_ + entry.skiplist_offset_);
+            skipped_item_count_ = entry.prev_record_count_;
+            current_doc_id_ = entry.prev_doc_id_;
+            current_offset_ = entry.prev_offset_;
+            current_ttf_ = entry.prev_ttf_;
+            current_cursor_ = 0;
+            num_in_buffer_ = 0;
+            buffer_idx_ = static_cast<i32>(idx) - 1;
+        }
+    }
+    return SkipListReader::SkipTo(query_doc_id, doc_id, prev_doc_id, offset, delta);
+}
+
+bool SkipListReaderByteSlice::GetSkipIndexMaxInfo(u32 query_doc_id, u32 &range_last_doc_id, Pair<u32, u16> &max_info) const {
+    if (skip_index_.empty()) {
+        return false;
+    }
+    SizeT from_idx = (buffer_idx_ > 0 and skip_index_[buffer_idx_].prev_doc_id_ < query_doc_id) ? buffer_idx_ : 0;
+    SizeT idx = FindSkipIndexEntry(from_idx, query_doc_id);
+    if (idx == skip_index_.size()) {
+        return false;
+    }
+    const SkipIndexEntry &entry = skip_index_[idx];
+    range_last_doc_id = entry.last_doc_id_;
+    max_info = {entry.block_max_tf_, entry.block_max_tf_percentage_};
+    return true;
 }
 
 Pair<int, bool> SkipListReaderByteSlice::LoadBuffer() {
@@ -150,6 +266,7 @@ Pair<int, bool> SkipListReaderByteSlice::LoadBuffer() {
         }
         num_in_buffer_ = doc_num;
         current_cursor_ = 0;
+        ++buffer_idx_;
         return MakePair(0, true);
     }
     return MakePair(0, false);
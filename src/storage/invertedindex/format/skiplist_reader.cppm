@@ -12,6 +12,24 @@ import posting_byte_slice_reader;
 
 namespace infinity {
 
+// Summary of one buffer (SKIP_LIST_BUFFER_SIZE records) of a doc skip list.
+// A skip index of them leads the doc skip list of a long posting list, so SkipTo() can jump over buffers without decoding them,
+// and the block max iterators can pass over the buffers scoring under their threshold.
+export struct SkipIndexEntry {
+    u32 last_doc_id_ = 0;     // of the last record in the buffer
+    u32 skiplist_offset_ = 0; // of the buffer, from the end of the skip index
+    u32 record_count_ = 0;
+    u32 offset_sum_ = 0; // of the records in the buffer
+    u32 ttf_sum_ = 0;
+    u32 block_max_tf_ = 0; // max of the records in the buffer
+    u16 block_max_tf_percentage_ = 0;
+    // the state before the buffer
+    u32 prev_doc_id_ = 0;
+    u32 prev_record_count_ = 0;
+    u32 prev_offset_ = 0;
+    u32 prev_ttf_ = 0;
+};
+
 export class SkipListReader {
 public:
     explicit SkipListReader(const DocListFormatOption &doc_list_format_option) : doc_list_format_option_(doc_list_format_option) {
@@ -84,6 +102,20 @@ public:
 
     void Load(ByteSlice *byteSlice, u32 start, u32 end);
 
+    // read the skip index at the start, called right after Load() for the posting lists having one
+    void LoadSkipIndex();
+
+    // summarize every buffer of the skip list from the start, for writing a skip index
+    void BuildSkipIndex(Vector<SkipIndexEntry> &skip_index);
+
+    using SkipListReader::SkipTo;
+
+    bool SkipTo(u32 query_doc_id, u32 &doc_id, u32 &prev_doc_id, u32 &offset, u32 &delta);
+
+    // The max info of the records from the buffer holding query_doc_id up to range_last_doc_id.
+    // Returns false when there's no skip index or query_doc_id is beyond the list.
+    bool GetSkipIndexMaxInfo(u32 query_doc_id, u32 &range_last_doc_id, Pair<u32, u16> &max_info) const;
+
     const ByteSliceList *GetByteSliceList() const { return byte_slice_reader_.GetByteSliceList(); }
 
     u32 GetStart() const { return start_; }
@@ -96,6 +128,14 @@ protected:
     ByteSliceReader byte_slice_reader_;
     u32 start_ = 0;
     u32 end_ = 0;
+
+private:
+    // the first buffer of the skip index at or after from_idx whose last doc is not before query_doc_id, skip_index_.size() if none
+    SizeT FindSkipIndexEntry(SizeT from_idx, u32 query_doc_id) const;
+
+    Vector<SkipIndexEntry> skip_index_;
+    u32 skiplist_begin_ = 0; // where the buffers begin, after the skip index
+    i32 buffer_idx_ = -1;    // of the buffer decoded last
 };
 
 export class SkipListReaderPostingByteSlice final : public SkipListReader {
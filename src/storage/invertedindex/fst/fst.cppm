@@ -251,17 +251,12 @@ public:
 
     void Reset(u8 *prefix_ptr, SizeT prefix_len) {
         Bound min(Bound::kIncluded, prefix_ptr, prefix_len);
-        Bound max(Bound::kExcluded, prefix_ptr, prefix_len);
-        int i;
-        for (i = prefix_len - 1; i >= 0; i--) {
-            prefix_ptr[i]++;
-            if (prefix_ptr[i] != 0x00) {
-                break;
-            }
-        }
-        if (i < 0) {
-            max = Bound();
+        // the smallest key greater than every key with the prefix
+        Vector<u8> upper(prefix_ptr, prefix_ptr + prefix_len);
+        while (!upper.empty() && ++upper.back() == 0x00) {
+            upper.pop_back();
         }
+        Bound max = upper.empty() ? Bound() : Bound(Bound::kExcluded, upper.data(), upper.size());
         Reset(min, max);
     }
 
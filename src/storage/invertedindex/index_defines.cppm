@@ -20,6 +20,9 @@ export {
         of_position_list = 4,  // 1 << 2
         of_term_frequency = 8, // 1 << 3
         of_block_max = 16,     // 1 << 4
+        of_stream_vbyte = 32,  // 1 << 5, doc ids and tfs of records shorter than a block are StreamVByte coded
+        of_skip_index = 64,    // 1 << 6, doc skip lists of long posting lists are led by a skip index over their buffers
+        of_doc_reorder = 128,  // 1 << 7, not a posting format: rows of compacted segments are reordered by graph bisection over the terms
     };
 
     typedef u16 docpayload_t;
@@ -49,6 +52,8 @@ export {
     constexpr u32 MAX_UNCOMPRESSED_POS_LIST_SIZE = 5;
     constexpr u32 MAX_UNCOMPRESSED_SKIP_LIST_SIZE = 10;
     constexpr u8 SKIP_LIST_BUFFER_SIZE = 32;
+    // posting lists of at least this many docs get a skip index, when of_skip_index is set
+    constexpr u32 SKIP_INDEX_MIN_DOC_FREQ = 16 * SKIP_LIST_BUFFER_SIZE * MAX_DOC_PER_RECORD;
 
     constexpr const char *DICT_SUFFIX = ".dic";
     constexpr const char *POSTING_SUFFIX = ".pos";
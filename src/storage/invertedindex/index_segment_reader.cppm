@@ -27,6 +27,9 @@ public:
     virtual ~IndexSegmentReader() {}
 
     virtual bool GetSegmentPosting(const String &term, SegmentPosting &seg_posting, MemoryPool *session_pool) const = 0;
+
+    // append at most max_count terms starting with prefix, in lexicographical order
+    virtual void GetTermsWithPrefix(const String &prefix, SizeT max_count, Vector<String> &terms) const = 0;
 };
 
 } // namespace infinity
\ No newline at end of file
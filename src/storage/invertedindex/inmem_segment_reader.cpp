@@ -38,4 +38,8 @@ bool InMemIndexSegmentReader::GetSegmentPosting(const String &term, SegmentPosti
     return false;
 }
 
+void InMemIndexSegmentReader::GetTermsWithPrefix(const String &prefix, SizeT max_count, Vector<String> &terms) const {
+    posting_table_->store_.PrefixKeys(prefix, max_count, terms);
+}
+
 } // namespace infinity
\ No newline at end of file
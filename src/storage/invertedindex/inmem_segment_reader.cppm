@@ -33,6 +33,8 @@ public:
 
     bool GetSegmentPosting(const String &term, SegmentPosting &seg_posting, MemoryPool *session_pool) const override;
 
+    void GetTermsWithPrefix(const String &prefix, SizeT max_count, Vector<String> &terms) const override;
+
 private:
     SharedPtr<MemoryIndexer::PostingTable> posting_table_;
     RowID base_row_id_{INVALID_ROWID};
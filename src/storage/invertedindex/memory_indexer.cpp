@@ -38,12 +38,13 @@ import posting_writer;
 import column_vector;
 import analyzer;
 import analyzer_pool;
+import sparse_analyzer;
 import term;
 import column_inverter;
 import invert_task;
 import third_party;
 import ring;
-import external_sort_merger;
+import term_tuple_spill;
 import local_file_system;
 import file_writer;
 import term_meta;
@@ -55,7 +56,11 @@ import column_length_io;
 import logger;
 
 namespace infinity {
-constexpr int MAX_TUPLE_LENGTH = 1024; // we assume that analyzed term, together with docid/offset info, will never exceed such length
+// read buffers of all the runs in an offline merge, and the threads reading the next buffers of the runs
+constexpr SizeT OFFLINE_MERGE_READ_BUFFER_SIZE = 256 * 1024 * 1024;
+constexpr SizeT OFFLINE_MERGE_READ_AHEAD_THREADS = 2;
+// a batch of fewer rows is inverted by one task, the analysis of a larger one is spread over the pool
+constexpr u32 INVERT_TASK_MIN_ROWS = 1024;
 
 bool MemoryIndexer::KeyComp::operator()(const String &lhs, const String &rhs) const {
     int ret = strcmp(lhs.c_str(), rhs.c_str());
@@ -75,7 +80,6 @@ MemoryIndexer::MemoryIndexer(const String &index_dir,
     : index_dir_(index_dir), base_name_(base_name), base_row_id_(base_row_id), flag_(flag), analyzer_(analyzer), byte_slice_pool_(byte_slice_pool),
       buffer_pool_(buffer_pool), thread_pool_(thread_pool), ring_inverted_(10UL), ring_sorted_(10UL) {
     posting_table_ = MakeShared<PostingTable>();
-    prepared_posting_ = MakeShared<PostingWriter>(nullptr, nullptr, PostingFormatOption(flag_), column_length_mutex_, column_length_array_);
     Path path = Path(index_dir) / "tmp.merge";
     spill_full_path_ = path.string();
 }
@@ -92,50 +96,64 @@ void MemoryIndexer::Insert(SharedPtr<ColumnVector> column_vector,
                            u32 row_offset,
                            u32 row_count,
                            SharedPtr<FullTextColumnLengthFileHandler> fulltext_length_handler,
-                           bool offline) {
+                           bool offline,
+                           bool reuse_terms) {
     if (is_spilled_)
         Load();
 
+    // A large batch is analyzed by several tasks of the pool, each inverts a consecutive range of the rows.
+    u32 task_count = std::min<u32>(thread_pool_.size(), row_count / INVERT_TASK_MIN_ROWS);
+    task_count = std::max<u32>(task_count, 1);
     u64 seq_inserted(0);
     u32 doc_count(0);
     {
         std::unique_lock<std::mutex> lock(mutex_);
-        seq_inserted = seq_inserted_++;
+        seq_inserted = seq_inserted_;
+        seq_inserted_ += task_count;
         doc_count = doc_count_;
         doc_count_ += row_count;
     }
-    auto update_length_job = MakeShared<FullTextColumnLengthUpdateJob>(std::move(fulltext_length_handler),
-                                                                       row_count,
-                                                                       doc_count,
-                                                                       column_length_mutex_,
-                                                                       column_length_array_);
-    auto task = MakeShared<BatchInvertTask>(seq_inserted, column_vector, row_offset, row_count, doc_count);
-    if (offline) {
-        auto inverter = MakeShared<ColumnInverter>(this->analyzer_, nullptr);
-        auto func = [this, task, length_handler = std::move(update_length_job), inverter](int id) {
-            inverter->InvertColumn(task->column_vector_, task->row_offset_, task->row_count_, task->start_doc_id_);
-            inverter->GetTermListLength(length_handler->GetColumnLengthArray());
-            length_handler->DumpToFile();
-            inverter->SortForOfflineDump();
-            this->ring_sorted_.Put(task->task_seq_, inverter);
-        };
-        thread_pool_.push(std::move(func));
-    } else {
-        PostingWriterProvider provider = [this](const String &term) -> SharedPtr<PostingWriter> { return GetOrAddPosting(term); };
-        auto inverter = MakeShared<ColumnInverter>(this->analyzer_, provider);
-        auto func = [this, task, length_handler = std::move(update_length_job), inverter](int id) {
-            // LOG_INFO(fmt::format("online inverter {} begin", id));
-            inverter->InvertColumn(task->column_vector_, task->row_offset_, task->row_count_, task->start_doc_id_);
-            inverter->GetTermListLength(length_handler->GetColumnLengthArray());
-            length_handler->DumpToFile();
-            this->ring_inverted_.Put(task->task_seq_, inverter);
-            // LOG_INFO(fmt::format("online inverter {} end", id));
-        };
-        thread_pool_.push(std::move(func));
+    for (u32 task_idx = 0; task_idx < task_count; ++task_idx) {
+        u32 task_row_begin = u64(row_count) * task_idx / task_count;
+        u32 task_row_count = u64(row_count) * (task_idx + 1) / task_count - task_row_begin;
+        auto update_length_job = MakeShared<FullTextColumnLengthUpdateJob>(fulltext_length_handler,
+                                                                           task_row_count,
+                                                                           doc_count + task_row_begin,
+                                                                           column_length_mutex_,
+                                                                           column_length_array_);
+        auto task = MakeShared<BatchInvertTask>(seq_inserted + task_idx,
+                                                column_vector,
+                                                row_offset + task_row_begin,
+                                                task_row_count,
+                                                doc_count + task_row_begin);
+        if (offline) {
+            auto inverter = MakeShared<ColumnInverter>(this->analyzer_, nullptr);
+            auto func = [this, task, length_handler = std::move(update_length_job), inverter](int id) {
+                inverter->InvertColumn(task->column_vector_, task->row_offset_, task->row_count_, task->start_doc_id_);
+                inverter->GetTermListLength(length_handler->GetColumnLengthArray());
+                length_handler->DumpToFile();
+                inverter->SortForOfflineDump();
+                this->ring_sorted_.Put(task->task_seq_, inverter);
+            };
+            thread_pool_.push(std::move(func));
+        } else {
+            PostingWriterProvider provider = [this](const String &term) -> SharedPtr<PostingWriter> { return GetOrAddPosting(term); };
+            auto inverter = MakeShared<ColumnInverter>(this->analyzer_, provider);
+            inverter->SetTermListCache(&term_list_cache_, reuse_terms);
+            auto func = [this, task, length_handler = std::move(update_length_job), inverter](int id) {
+                // LOG_INFO(fmt::format("online inverter {} begin", id));
+                inverter->InvertColumn(task->column_vector_, task->row_offset_, task->row_count_, task->start_doc_id_);
+                inverter->GetTermListLength(length_handler->GetColumnLengthArray());
+                length_handler->DumpToFile();
+                this->ring_inverted_.Put(task->task_seq_, inverter);
+                // LOG_INFO(fmt::format("online inverter {} end", id));
+            };
+            thread_pool_.push(std::move(func));
+        }
     }
     {
         std::unique_lock<std::mutex> lock(mutex_);
-        inflight_tasks_++;
+        inflight_tasks_ += task_count;
     }
 }
 
@@ -152,17 +170,14 @@ SizeT MemoryIndexer::CommitOffline(bool wait_if_empty) {
     if (!changed)
         return 0;
     generating = true;
-    if (nullptr == spill_file_handle_) {
-        PrepareSpillFile();
+    if (spill_file_.get() == nullptr) {
+        spill_file_ = MakeUnique<TermTupleSpillFile>(spill_full_path_);
     }
     Vector<SharedPtr<ColumnInverter>> inverters;
     this->ring_sorted_.GetBatch(inverters, wait_if_empty);
     SizeT num = inverters.size();
-    if (num > 0) {
-        for (auto &inverter : inverters) {
-            inverter->SpillSortResults(this->spill_file_handle_, this->tuple_count_);
-            num_runs_++;
-        }
+    for (auto &inverter : inverters) {
+        inverter->SpillSortResults(*spill_file_);
     }
     generating_.compare_exchange_strong(generating, false);
     if (num > 0) {
@@ -244,14 +259,12 @@ void MemoryIndexer::Dump(bool offline, bool spill) {
     }
     if (posting_table_.get() != nullptr) {
         MemoryIndexer::PostingTableStore &posting_store = posting_table_->store_;
-        for (auto it = posting_store.UnsafeBegin(); it != posting_store.UnsafeEnd(); ++it) {
-            const MemoryIndexer::PostingPtr posting_writer = it->second;
+        for (const auto &[term, posting_writer] : posting_store.UnsafeSortedItems()) {
             TermMeta term_meta(posting_writer->GetDF(), posting_writer->GetTotalTF());
             posting_writer->Dump(posting_file_writer, term_meta, spill);
             SizeT term_meta_offset = dict_file_writer->TotalWrittenBytes();
             term_meta_dumpler.Dump(dict_file_writer, term_meta);
-            const String &term = it->first;
-            fst_builder.Insert((u8 *)term.c_str(), term.length(), term_meta_offset);
+            fst_builder.Insert((u8 *)term.data(), term.length(), term_meta_offset);
         }
         posting_file_writer->Sync();
         dict_file_writer->Sync();
@@ -293,10 +306,9 @@ SharedPtr<PostingWriter> MemoryIndexer::GetOrAddPosting(const String &term) {
     assert(posting_table_.get() != nullptr);
     MemoryIndexer::PostingTableStore &posting_store = posting_table_->store_;
     PostingPtr posting;
-    bool found = posting_store.GetOrAdd(term, posting, prepared_posting_);
-    if (!found) {
-        prepared_posting_ = MakeShared<PostingWriter>(nullptr, nullptr, PostingFormatOption(flag_), column_length_mutex_, column_length_array_);
-    }
+    posting_store.GetOrAdd(term, posting, [this]() {
+        return MakeShared<PostingWriter>(nullptr, nullptr, PostingFormatOption(flag_), column_length_mutex_, column_length_array_);
+    });
     return posting;
 }
 
@@ -304,22 +316,14 @@ void MemoryIndexer::Reset() {
     if (posting_table_.get()) {
         posting_table_->store_.Clear();
     }
+    term_list_cache_.Clear();
 }
 
 void MemoryIndexer::OfflineDump() {
     // Steps of offline dump:
-    // 1. External sort merge
+    // 1. Merge the sorted runs of the spill file term by term, reading ahead every run
     // 2. Generate posting
     // 3. Dump disk segment data
-    // LOG_INFO(fmt::format("MemoryIndexer::OfflineDump begin, num_runs_ {}", num_runs_));
-    FinalSpillFile();
-    constexpr u32 buffer_size_of_each_run = 2 * 1024 * 1024;
-    SortMerger<TermTuple, u32> *merger = new SortMerger<TermTuple, u32>(spill_full_path_.c_str(), num_runs_, buffer_size_of_each_run * num_runs_, 2);
-    merger->Run();
-    delete merger;
-    FILE *f = fopen(spill_full_path_.c_str(), "r");
-    u64 count;
-    fread((char *)&count, sizeof(u64), 1, f);
     Path path = Path(index_dir_) / base_name_;
     String index_prefix = path.string();
     LocalFileSystem fs;
@@ -333,85 +337,71 @@ void MemoryIndexer::OfflineDump() {
     OstreamWriter wtr(ofs);
     FstBuilder fst_builder(wtr);
 
-    u32 record_length;
-    char buf[MAX_TUPLE_LENGTH];
-    String last_term_str;
-    std::string_view last_term;
-    u32 last_doc_id = INVALID_DOCID;
-    UniquePtr<PostingWriter> posting;
-
-    for (u64 i = 0; i < count; ++i) {
-        fread(&record_length, sizeof(u32), 1, f);
-        if (record_length >= MAX_TUPLE_LENGTH) {
-            // rubbish tuple, abandoned
-            char *buffer = new char[record_length];
-            fread(buffer, record_length, 1, f);
-            // TermTuple tuple(buffer, record_length);
-            delete[] buffer;
-            continue;
-        }
-        fread(buf, record_length, 1, f);
-        TermTuple tuple(buf, record_length);
-        if (tuple.term_ != last_term) {
-            assert(last_term < tuple.term_);
-            if (last_doc_id != INVALID_DOCID) {
-                posting->EndDocument(last_doc_id, 0);
-                // printf(" EndDocument1-%u\n", last_doc_id);
-            }
-            if (posting.get()) {
-                TermMeta term_meta(posting->GetDF(), posting->GetTotalTF());
-                posting->Dump(posting_file_writer, term_meta);
-                SizeT term_meta_offset = dict_file_writer->TotalWrittenBytes();
-                term_meta_dumpler.Dump(dict_file_writer, term_meta);
-                fst_builder.Insert((u8 *)last_term.data(), last_term.length(), term_meta_offset);
+    if (spill_file_.get() != nullptr) {
+        spill_file_->FinishWrite();
+        ThreadPool read_ahead_pool(OFFLINE_MERGE_READ_AHEAD_THREADS);
+        Vector<UniquePtr<TermTupleRunReader>> readers = spill_file_->OpenRunReaders(OFFLINE_MERGE_READ_BUFFER_SIZE, read_ahead_pool);
+        // smallest term first, runs of the same term in the order they were spilled
+        auto greater = [&readers](u32 lhs, u32 rhs) {
+            int cmp = readers[lhs]->term().compare(readers[rhs]->term());
+            return cmp != 0 ? cmp > 0 : lhs > rhs;
+        };
+        Heap<u32, decltype(greater)> merge_heap(greater);
+        for (u32 i = 0; i < readers.size(); ++i) {
+            if (readers[i]->NextTerm()) {
+                merge_heap.push(i);
             }
-            posting =
+        }
+        // spilled tuples of sparse vector terms carry the quantized weight as term_pos_
+        const bool weighted_tf = analyzer_ == SPARSE_ANALYZER;
+        String term;
+        while (!merge_heap.empty()) {
+            term = readers[merge_heap.top()]->term();
+            UniquePtr<PostingWriter> posting =
                 MakeUnique<PostingWriter>(&byte_slice_pool_, &buffer_pool_, PostingFormatOption(flag_), column_length_mutex_, column_length_array_);
-            // printf("\nswitched-term-%d-<%s>\n", i.term_num_, term.data());
-            last_term_str = String(tuple.term_);
-            last_term = std::string_view(last_term_str);
-        } else if (last_doc_id != tuple.doc_id_) {
-            assert(last_doc_id != INVALID_DOCID);
-            assert(last_doc_id < tuple.doc_id_);
-            assert(posting.get() != nullptr);
+            // the runs are spilled in the order of the rows, so the docs of a term are in order when its runs are taken in order
+            u32 last_doc_id = INVALID_DOCID;
+            while (!merge_heap.empty() and readers[merge_heap.top()]->term() == term) {
+                const u32 run_idx = merge_heap.top();
+                merge_heap.pop();
+                TermTupleRunReader &reader = *readers[run_idx];
+                const SpillTuple *tuples = nullptr;
+                for (SizeT tuple_num = reader.ReadTuples(tuples); tuple_num > 0; tuple_num = reader.ReadTuples(tuples)) {
+                    for (SizeT i = 0; i < tuple_num; ++i) {
+                        const SpillTuple &tuple = tuples[i];
+                        if (tuple.doc_id_ != last_doc_id) {
+                            if (last_doc_id != INVALID_DOCID) {
+                                assert(last_doc_id < tuple.doc_id_);
+                                posting->EndDocument(last_doc_id, 0);
+                            }
+                            last_doc_id = tuple.doc_id_;
+                        }
+                        if (weighted_tf) {
+                            posting->SetCurrentTF(tuple.term_pos_);
+                        } else {
+                            posting->AddPosition(tuple.term_pos_);
+                        }
+                    }
+                }
+                if (reader.NextTerm()) {
+                    merge_heap.push(run_idx);
+                }
+            }
             posting->EndDocument(last_doc_id, 0);
-            // printf(" EndDocument2-%u\n", last_doc_id);
+            TermMeta term_meta(posting->GetDF(), posting->GetTotalTF());
+            posting->Dump(posting_file_writer, term_meta);
+            SizeT term_meta_offset = dict_file_writer->TotalWrittenBytes();
+            term_meta_dumpler.Dump(dict_file_writer, term_meta);
+            fst_builder.Insert((u8 *)term.data(), term.length(), term_meta_offset);
         }
-        last_doc_id = tuple.doc_id_;
-        posting->AddPosition(tuple.term_pos_);
-        // printf(" pos-%u", tuple.term_pos_);
-    }
-    if (last_doc_id != INVALID_DOCID) {
-        posting->EndDocument(last_doc_id, 0);
-        // printf(" EndDocument3-%u\n", last_doc_id);
-        TermMeta term_meta(posting->GetDF(), posting->GetTotalTF());
-        posting->Dump(posting_file_writer, term_meta);
-        SizeT term_meta_offset = dict_file_writer->TotalWrittenBytes();
-        term_meta_dumpler.Dump(dict_file_writer, term_meta);
-        fst_builder.Insert((u8 *)last_term.data(), last_term.length(), term_meta_offset);
+        // the readers shall be done with the file
+        readers.clear();
+        spill_file_.reset();
     }
     posting_file_writer->Sync();
     dict_file_writer->Sync();
     fst_builder.Finish();
     fs.AppendFile(dict_file, fst_file);
     fs.DeleteFile(fst_file);
-
-    // LOG_INFO(fmt::format("MemoryIndexer::OfflineDump done, num_runs_ {}", num_runs_));
-    num_runs_ = 0;
-    std::filesystem::remove(spill_full_path_);
 }
-
-void MemoryIndexer::FinalSpillFile() {
-    fseek(spill_file_handle_, 0, SEEK_SET);
-    fwrite(&tuple_count_, sizeof(u64), 1, spill_file_handle_);
-    fclose(spill_file_handle_);
-    tuple_count_ = 0;
-    spill_file_handle_ = nullptr;
-}
-
-void MemoryIndexer::PrepareSpillFile() {
-    spill_file_handle_ = fopen(spill_full_path_.c_str(), "w");
-    fwrite(&tuple_count_, sizeof(u64), 1, spill_file_handle_);
-}
-
 } // namespace infinity
\ No newline at end of file
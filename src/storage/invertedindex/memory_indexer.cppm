@@ -14,8 +14,6 @@
 
 module;
 
-#include <cstdio>
-
 export module memory_indexer;
 import stl;
 import memory_pool;
@@ -28,7 +26,10 @@ import internal_types;
 import ring;
 import skiplist;
 import internal_types;
-import map_with_lock;
+import sharded_term_map;
+import term_tuple_spill;
+import term_list_cache;
+import default_values;
 
 namespace infinity {
 
@@ -42,7 +43,8 @@ public:
 
     using PostingPtr = SharedPtr<PostingWriter>;
     // using PostingTableStore = SkipList<String, PostingPtr, KeyComp>;
-    using PostingTableStore = MapWithLock<String, PostingPtr>;
+    // using PostingTableStore = MapWithLock<String, PostingPtr>;
+    using PostingTableStore = ShardedTermMap<PostingPtr>;
 
     struct PostingTable {
         PostingTable();
@@ -63,11 +65,14 @@ public:
     ~MemoryIndexer();
 
     // Insert is non-blocking. Caller must ensure there's no RowID gap between each call.
+    // Online inserts keep the analyzed terms of their texts in the term list cache. With reuse_terms, the texts found there
+    // are not analyzed again.
     void Insert(SharedPtr<ColumnVector> column_vector,
                 u32 row_offset,
                 u32 row_count,
                 SharedPtr<FullTextColumnLengthFileHandler> fulltext_length_handler,
-                bool offline = false);
+                bool offline = false,
+                bool reuse_terms = false);
 
     // Commit is non-blocking and thread-safe. There shall be a background thread which call this method regularly.
     void Commit(bool offline = false);
@@ -95,6 +100,8 @@ public:
 
     MemoryPool *GetPool() { return &byte_slice_pool_; }
 
+    TermListCache &GetTermListCache() { return term_list_cache_; }
+
     SharedPtr<PostingTable> GetPostingTable() { return posting_table_; }
 
     SharedPtr<PostingWriter> GetOrAddPosting(const String &term);
@@ -112,10 +119,6 @@ private:
 
     void OfflineDump();
 
-    void FinalSpillFile();
-
-    void PrepareSpillFile();
-
 private:
     String index_dir_;
     String base_name_;
@@ -127,7 +130,6 @@ private:
     ThreadPool &thread_pool_;
     u32 doc_count_{0};
     SharedPtr<PostingTable> posting_table_;
-    PostingPtr prepared_posting_{nullptr};
     Ring<SharedPtr<ColumnInverter>> ring_inverted_;
     Ring<SharedPtr<ColumnInverter>> ring_sorted_;
     u64 seq_inserted_{0};
@@ -137,15 +139,16 @@ private:
     std::condition_variable cv_;
     std::mutex mutex_;
 
-    u32 num_runs_{0};                  // For offline index building
-    FILE *spill_file_handle_{nullptr}; // Temp file for offline external merge sort
-    String spill_full_path_;           // Path of spill file
-    u64 tuple_count_{0};               // Number of tuples for external merge sort
+    UniquePtr<TermTupleSpillFile> spill_file_; // Sorted runs of the inverters for offline index building
+    String spill_full_path_;                   // Path of spill file
 
     bool is_spilled_{false};
 
     // for column length info
     std::shared_mutex column_length_mutex_;
     Vector<u32> column_length_array_;
+
+    // part of the memory of the indexer, so it is released when the indexer is dumped
+    TermListCache term_list_cache_{FULL_TEXT_TERM_LIST_CACHE_BYTES};
 };
 } // namespace infinity
@@ -56,6 +56,23 @@ bool MultiPostingDecoder::SkipTo(RowID start_row_id, RowID &prev_last_doc_id, Ro
 // u16: block max (ceil(tf / doc length) * numeric_limits<u16>::max())
 Pair<u32, u16> MultiPostingDecoder::GetBlockMaxInfo() const { return index_decoder_->GetBlockMaxInfo(); }
 
+bool MultiPostingDecoder::GetSkipRangeMaxInfo(RowID row_id, RowID &range_last_row_id, Pair<u32, u16> &max_info) const {
+    if (index_decoder_ == nullptr or row_id < base_row_id_) {
+        return false;
+    }
+    // segment_cursor_ is the next segment
+    RowID next_seg_base_row_id = GetSegmentBaseRowId(segment_cursor_);
+    if (next_seg_base_row_id != INVALID_ROWID && row_id >= next_seg_base_row_id) {
+        return false;
+    }
+    docid_t range_last_doc_id = 0;
+    if (!index_decoder_->GetSkipRangeMaxInfo(docid_t(row_id - base_row_id_), range_last_doc_id, max_info)) {
+        return false;
+    }
+    range_last_row_id = base_row_id_ + range_last_doc_id;
+    return true;
+}
+
 bool MultiPostingDecoder::DecodeCurrentDocIDBuffer(docid_t *doc_buffer) {
     if (need_decode_doc_id_) {
         index_decoder_->DecodeCurrentDocIDBuffer(doc_buffer);
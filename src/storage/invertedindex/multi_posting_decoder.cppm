@@ -32,6 +32,9 @@ public:
     // u16: block max (ceil(tf / doc length) * numeric_limits<u16>::max())
     Pair<u32, u16> GetBlockMaxInfo() const;
 
+    // the max info of the docs from row_id up to range_last_row_id, known only within the segment being decoded and with a skip index
+    bool GetSkipRangeMaxInfo(RowID row_id, RowID &range_last_row_id, Pair<u32, u16> &max_info) const;
+
     bool DecodeCurrentDocIDBuffer(docid_t *doc_buffer);
 
     bool DecodeCurrentTFBuffer(tf_t *tf_buffer);
@@ -47,7 +50,7 @@ private:
 
     IndexDecoder *CreateIndexDecoder(u32 doc_list_begin_pos);
 
-    inline RowID GetSegmentBaseRowId(u32 seg_cursor) {
+    inline RowID GetSegmentBaseRowId(u32 seg_cursor) const {
         if (seg_cursor >= segment_count_) {
             return INVALID_ROWID;
         }
@@ -150,6 +150,16 @@ void PostingIterator::SeekPosition(pos_t pos, pos_t &result) {
     in_doc_pos_iterator_->SeekPosition(pos, result);
 }
 
+void PostingIterator::GetCurrentDocPositions(Vector<pos_t> &positions) {
+    positions.clear();
+    pos_t pos = INVALID_POSITION;
+    SeekPosition(0, pos);
+    while (pos != INVALID_POSITION) {
+        positions.push_back(pos);
+        SeekPosition(pos + 1, pos);
+    }
+}
+
 void PostingIterator::Reset() {
     if (!segment_postings_ || segment_postings_->size() == 0) {
         return;
@@ -28,6 +28,8 @@ public:
 
     u32 GetDocFreq() const { return doc_freq_; }
 
+    void SetDocFreq(u32 doc_freq) { doc_freq_ = doc_freq; }
+
     bool SkipTo(RowID doc_id);
 
     RowID PrevBlockLastDocID() const { return last_doc_id_in_prev_block_; }
@@ -40,12 +42,20 @@ public:
     // u16: block max (ceil(tf / doc length) * numeric_limits<u16>::max())
     Pair<u32, u16> GetBlockMaxInfo() const;
 
+    // the max info of the docs from doc_id up to range_last_doc_id, spanning many blocks, when the posting list has a skip index
+    bool GetSkipRangeMaxInfo(RowID doc_id, RowID &range_last_doc_id, Pair<u32, u16> &max_info) const {
+        return posting_decoder_->GetSkipRangeMaxInfo(doc_id, range_last_doc_id, max_info);
+    }
+
     RowID SeekDoc(RowID docId);
 
     Pair<bool, RowID> PeekInBlockRange(RowID doc_id, RowID doc_id_no_beyond);
 
     void SeekPosition(pos_t pos, pos_t &result);
 
+    // all positions of the term in current doc, in ascending order
+    void GetCurrentDocPositions(Vector<pos_t> &positions);
+
     docpayload_t GetCurrentDocPayload() {
         if (posting_option_.HasDocPayload()) {
             DecodeTFBuffer();
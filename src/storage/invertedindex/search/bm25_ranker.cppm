@@ -19,12 +19,21 @@ export module bm25_ranker;
 import stl;
 
 namespace infinity {
+
+// BM25 parameters
+export constexpr float BM25_K1 = 1.2F;
+export constexpr float BM25_B = 0.75F;
+
+// the length dependent part of the BM25 tf denominator: k1 * (1 - b + b * column_len / avg_column_len)
+export inline float BM25LengthNorm(u32 column_len, float avg_column_len) { return BM25_K1 * (1.0F - BM25_B + BM25_B * column_len / avg_column_len); }
+
 export class BM25Ranker {
 public:
     BM25Ranker(u64 total_df);
     ~BM25Ranker() = default;
 
-    void AddTermParam(u64 tf, u64 df, float avg_column_len, u32 column_len, float weight);
+    // length_norm: BM25LengthNorm() of the scored doc
+    void AddTermParam(u64 tf, u64 df, float length_norm, float weight);
 
     float GetScore() { return score_; }
 
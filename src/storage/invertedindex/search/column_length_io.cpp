@@ -27,6 +27,7 @@ import column_index_reader;
 import file_system_type;
 import file_system;
 import local_file_system;
+import bm25_ranker;
 
 namespace infinity {
 
@@ -90,8 +91,10 @@ void FullTextColumnLengthUpdateJob::DumpToFile() {
 FullTextColumnLengthReader::FullTextColumnLengthReader(UniquePtr<FileSystem> file_system,
                                                        const String &index_dir,
                                                        const Vector<String> &base_names,
-                                                       const Vector<RowID> &base_row_ids)
-    : file_system_(std::move(file_system)), index_dir_(index_dir), base_names_(base_names), base_row_ids_(base_row_ids) {}
+                                                       const Vector<RowID> &base_row_ids,
+                                                       float avg_column_len)
+    : file_system_(std::move(file_system)), index_dir_(index_dir), base_names_(base_names), base_row_ids_(base_row_ids),
+      avg_column_len_(avg_column_len) {}
 
 void FullTextColumnLengthReader::SeekFile(RowID row_id) {
     while (base_row_ids_[current_index_ + 1] <= row_id) {
@@ -117,13 +120,38 @@ void FullTextColumnLengthReader::SeekFile(RowID row_id) {
     if (read_count != file_size) {
         UnrecoverableError("SeekFile: read_count != file_size");
     }
+    BuildNormCodes(file_size / sizeof(u32));
+}
+
+void FullTextColumnLengthReader::BuildNormCodes(u32 array_len) {
+    norm_coded_ = false;
+    if (array_len == 0) {
+        return;
+    }
+    const auto [min_it, max_it] = std::minmax_element(column_length_array_.get(), column_length_array_.get() + array_len);
+    const u32 min_len = *min_it;
+    if (*max_it - min_len >= norm_table_.size()) {
+        return;
+    }
+    if (array_len > norm_code_array_capacity_) {
+        norm_code_array_capacity_ = column_length_array_capacity_;
+        norm_code_array_ = MakeUniqueForOverwrite<u8[]>(norm_code_array_capacity_);
+    }
+    for (u32 i = 0; i < array_len; ++i) {
+        norm_code_array_[i] = static_cast<u8>(column_length_array_[i] - min_len);
+    }
+    for (u32 code = 0; code < norm_table_.size(); ++code) {
+        norm_table_[code] = BM25LengthNorm(min_len + code, avg_column_len_);
+    }
+    norm_coded_ = true;
 }
 
 void ColumnLengthReader::AppendColumnLength(IndexReader *index_reader, const Vector<u64> &column_ids, Vector<float> &avg_column_length) {
     u64 column_id = column_ids.back();
     ColumnIndexReader *reader = index_reader->GetColumnIndexReader(column_id);
-    column_length_vector_.emplace_back(MakeUnique<LocalFileSystem>(), reader->index_dir_, reader->base_names_, reader->base_row_ids_);
-    avg_column_length.emplace_back(reader->GetAvgColumnLength());
+    const float avg_column_len = reader->GetAvgColumnLength();
+    column_length_vector_.emplace_back(MakeUnique<LocalFileSystem>(), reader->index_dir_, reader->base_names_, reader->base_row_ids_, avg_column_len);
+    avg_column_length.emplace_back(avg_column_len);
 }
 
 } // namespace infinity
\ No newline at end of file
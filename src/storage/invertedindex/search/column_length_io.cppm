@@ -19,6 +19,7 @@ export module column_length_io;
 import stl;
 import index_defines;
 import internal_types;
+import bm25_ranker;
 
 namespace infinity {
 class SegmentIndexEntry;
@@ -65,7 +66,8 @@ public:
     FullTextColumnLengthReader(UniquePtr<FileSystem> file_system,
                                const String &index_dir,
                                const Vector<String> &base_names,
-                               const Vector<RowID> &base_row_ids);
+                               const Vector<RowID> &base_row_ids,
+                               float avg_column_len);
 
     inline u32 GetColumnLength(RowID row_id) {
         // assume that there is a file which contains row_id
@@ -75,8 +77,23 @@ public:
         return column_length_array_[row_id - current_base_rowid_];
     }
 
+    // k1 * (1 - b + b * column_len / avg_column_len), the length dependent part of the BM25 denominator
+    inline float GetLengthNorm(RowID row_id) {
+        if (row_id >= next_base_rowid_ or row_id < current_base_rowid_) [[unlikely]] {
+            SeekFile(row_id);
+        }
+        const u32 offset = row_id - current_base_rowid_;
+        if (norm_coded_) [[likely]] {
+            return norm_table_[norm_code_array_[offset]];
+        }
+        return BM25LengthNorm(column_length_array_[offset], avg_column_len_);
+    }
+
     void SeekFile(RowID row_id);
 
+private:
+    void BuildNormCodes(u32 array_len);
+
 private:
     UniquePtr<FileSystem> file_system_;
     const String &index_dir_;
@@ -87,6 +104,13 @@ private:
     u32 current_index_ = 0;
     UniquePtr<u32[]> column_length_array_;
     u32 column_length_array_capacity_ = 0;
+    // when all lengths of the current chunk fit in [min_len, min_len + 255], each doc keeps a 1-byte code and
+    // the norms of the 256 possible lengths are precomputed, so scoring a doc is a byte load and a table lookup
+    float avg_column_len_ = 0;
+    bool norm_coded_ = false;
+    UniquePtr<u8[]> norm_code_array_;
+    u32 norm_code_array_capacity_ = 0;
+    Array<float, 256> norm_table_{};
 };
 
 export class ColumnLengthReader {
@@ -98,6 +122,8 @@ public:
     FullTextColumnLengthReader *GetColumnLengthReader(u32 scorer_column_idx) { return &column_length_vector_[scorer_column_idx]; }
 
     inline u32 GetColumnLength(u32 scorer_column_idx, RowID row_id) { return column_length_vector_[scorer_column_idx].GetColumnLength(row_id); }
+
+    inline float GetLengthNorm(u32 scorer_column_idx, RowID row_id) { return column_length_vector_[scorer_column_idx].GetLengthNorm(row_id); }
 };
 
 } // namespace infinity
\ No newline at end of file
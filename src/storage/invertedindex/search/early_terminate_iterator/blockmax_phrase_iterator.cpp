@@ -0,0 +1,93 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <vector>
+module blockmax_phrase_iterator;
+import stl;
+import index_defines;
+import early_terminate_iterator;
+import blockmax_and_iterator;
+import blockmax_term_doc_iterator;
+import phrase_doc_iterator;
+import internal_types;
+
+namespace infinity {
+
+BlockMaxPhraseIterator::BlockMaxPhraseIterator(Vector<UniquePtr<EarlyTerminateIterator>> iterators, u32 slop) : slop_(slop) {
+    phrase_terms_.reserve(iterators.size());
+    for (const auto &it : iterators) {
+        auto *term_iter = static_cast<BlockMaxTermDocIterator *>(it.get());
+        phrase_terms_.push_back(term_iter);
+        has_position_ = has_position_ and term_iter->HasPosition();
+    }
+    positions_.resize(phrase_terms_.size());
+    and_iterator_ = MakeUnique<BlockMaxAndIterator>(std::move(iterators));
+    doc_freq_ = and_iterator_->DocFreq();
+    bm25_score_upper_bound_ = and_iterator_->BM25ScoreUpperBound();
+}
+
+Pair<RowID, float> BlockMaxPhraseIterator::NextWithThreshold(float threshold) {
+    // TODO:
+    return {};
+}
+
+Pair<RowID, float> BlockMaxPhraseIterator::BlockNextWithThreshold(float threshold) {
+    for (RowID next_skip = doc_id_ + 1;;) {
+        if (!BlockSkipTo(next_skip, threshold)) [[unlikely]] {
+            return {INVALID_ROWID, 0.0F};
+        }
+        next_skip = std::max(next_skip, BlockMinPossibleDocID());
+        auto [success, score, id] = SeekInBlockRange(next_skip, threshold, BlockLastDocID());
+        if (success) {
+            return {id, score};
+        }
+        next_skip = BlockLastDocID() + 1;
+    }
+}
+
+Tuple<bool, float, RowID> BlockMaxPhraseIterator::SeekInBlockRange(RowID doc_id, float threshold, RowID doc_id_no_beyond) {
+    while (true) {
+        auto [success, score, id] = and_iterator_->SeekInBlockRange(doc_id, threshold, doc_id_no_beyond);
+        if (!success) {
+            return {false, 0.0F, INVALID_ROWID};
+        }
+        if (MatchPositions()) {
+            doc_id_ = id;
+            return {true, score, id};
+        }
+        doc_id = id + 1;
+    }
+}
+
+Pair<bool, RowID> BlockMaxPhraseIterator::PeekInBlockRange(RowID doc_id, RowID doc_id_no_beyond) {
+    if (!has_position_) {
+        return and_iterator_->PeekInBlockRange(doc_id, doc_id_no_beyond);
+    }
+    auto [success, score, id] = SeekInBlockRange(doc_id, 0.0F, doc_id_no_beyond);
+    return {success, id};
+}
+
+bool BlockMaxPhraseIterator::MatchPositions() {
+    if (!has_position_) {
+        return true;
+    }
+    for (SizeT i = 0; i < phrase_terms_.size(); ++i) {
+        phrase_terms_[i]->GetPositions(positions_[i]);
+    }
+    return PhrasePositionsMatch(positions_, slop_);
+}
+
+} // namespace infinity
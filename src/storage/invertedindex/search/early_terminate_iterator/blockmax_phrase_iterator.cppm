@@ -0,0 +1,63 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module blockmax_phrase_iterator;
+import stl;
+import index_defines;
+import early_terminate_iterator;
+import blockmax_and_iterator;
+import blockmax_term_doc_iterator;
+import internal_types;
+
+namespace infinity {
+
+// BlockMaxAndIterator over the phrase terms, positions are only checked for docs that pass it
+// block max scores of the "and" are upper bounds of the phrase
+export class BlockMaxPhraseIterator final : public EarlyTerminateIterator {
+public:
+    // iterators must be BlockMaxTermDocIterator, in phrase order
+    BlockMaxPhraseIterator(Vector<UniquePtr<EarlyTerminateIterator>> iterators, u32 slop);
+
+    Pair<RowID, float> NextWithThreshold(float threshold) override;
+
+    Pair<RowID, float> BlockNextWithThreshold(float threshold) override;
+
+    void UpdateScoreThreshold(float threshold) override { and_iterator_->UpdateScoreThreshold(threshold); }
+
+    bool BlockSkipTo(RowID doc_id, float threshold) override { return and_iterator_->BlockSkipTo(doc_id, threshold); }
+
+    RowID BlockMinPossibleDocID() const override { return and_iterator_->BlockMinPossibleDocID(); }
+
+    RowID BlockLastDocID() const override { return and_iterator_->BlockLastDocID(); }
+
+    float BlockMaxBM25Score() override { return and_iterator_->BlockMaxBM25Score(); }
+
+    Tuple<bool, float, RowID> SeekInBlockRange(RowID doc_id, float threshold, RowID doc_id_no_beyond) override;
+
+    // positions can not be checked without decoding, so the iterators are moved to the returned doc
+    Pair<bool, RowID> PeekInBlockRange(RowID doc_id, RowID doc_id_no_beyond) override;
+
+private:
+    bool MatchPositions();
+
+    Vector<BlockMaxTermDocIterator *> phrase_terms_;
+    Vector<Vector<pos_t>> positions_;
+    u32 slop_ = 0;
+    bool has_position_ = true;
+    UniquePtr<BlockMaxAndIterator> and_iterator_;
+};
+
+} // namespace infinity
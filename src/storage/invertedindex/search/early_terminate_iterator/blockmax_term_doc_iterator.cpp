@@ -27,13 +27,16 @@ import segment_posting;
 import posting_iterator;
 import column_length_io;
 import infinity_exception;
+import sparse_analyzer;
+import bm25_ranker;
 
 namespace infinity {
 BlockMaxTermDocIterator::BlockMaxTermDocIterator(optionflag_t flag, MemoryPool *session_pool) : iter_(flag, session_pool) {}
 
-bool BlockMaxTermDocIterator::InitPostingIterator(SharedPtr<Vector<SegmentPosting>> seg_postings, const u32 state_pool_size) {
+bool BlockMaxTermDocIterator::InitPostingIterator(SharedPtr<Vector<SegmentPosting>> seg_postings, const u32 state_pool_size, u32 doc_freq) {
     if (iter_.Init(std::move(seg_postings), state_pool_size)) {
-        doc_freq_ = iter_.GetDocFreq();
+        iter_.SetDocFreq(doc_freq);
+        doc_freq_ = doc_freq;
         return true;
     }
     UnrecoverableError("Unexpected case: Init PostingIterator failed");
@@ -45,6 +48,14 @@ bool BlockMaxTermDocIterator::BlockSkipTo(RowID doc_id, float threshold) {
         return false;
     }
     while (true) {
+        // pass a range of blocks scoring under the threshold by the skip index, without decoding its skip list
+        RowID range_last_doc_id = INVALID_ROWID;
+        Pair<u32, u16> range_max_info;
+        if ((doc_id > BlockLastDocID() or BlockLastDocID() == INVALID_ROWID) and iter_.GetSkipRangeMaxInfo(doc_id, range_last_doc_id, range_max_info) and
+            BlockMaxScore(range_max_info) < threshold) {
+            doc_id = range_last_doc_id + 1;
+            continue;
+        }
         if (!iter_.SkipTo(doc_id)) {
             doc_id_ = INVALID_ROWID;
             return false;
@@ -57,8 +68,8 @@ bool BlockMaxTermDocIterator::BlockSkipTo(RowID doc_id, float threshold) {
 }
 
 // BM25 parameters
-constexpr float k1 = 1.2F;
-constexpr float b = 0.75F;
+constexpr float k1 = BM25_K1;
+constexpr float b = BM25_B;
 
 void BlockMaxTermDocIterator::InitBM25Info(u64 total_df, float avg_column_len, FullTextColumnLengthReader *column_length_reader) {
     avg_column_len_ = avg_column_len;
@@ -68,26 +79,40 @@ void BlockMaxTermDocIterator::InitBM25Info(u64 total_df, float avg_column_len, F
     bm25_score_upper_bound_ = bm25_common_score_ / (1.0F + k1 * b / avg_column_len_);
 }
 
+void BlockMaxTermDocIterator::InitDotProductInfo() {
+    dot_product_ = true;
+    dot_product_factor_ = weight_ / SPARSE_WEIGHT_SCALE;
+    bm25_score_upper_bound_ = weight_ * SPARSE_WEIGHT_MAX;
+}
+
 // weight included
 float BlockMaxTermDocIterator::BlockMaxBM25Score() {
     if (auto last_doc_id = BlockLastDocID(); last_doc_id == block_max_bm25_score_cache_end_id_) {
         return block_max_bm25_score_cache_;
     } else {
         block_max_bm25_score_cache_end_id_ = last_doc_id;
-        // bm25_common_score_ / (1.0F + k1 * ((1.0F - b) / block_max_tf + b / block_max_percentage / avg_column_len));
-        auto [block_max_tf, block_max_percentage_u16] = GetBlockMaxInfo();
-        return block_max_bm25_score_cache_ =
-                   bm25_common_score_ /
-                   (1.0F + k1 * ((1.0F - b) / block_max_tf + b * std::numeric_limits<u16>::max() / (block_max_percentage_u16 * avg_column_len_)));
+        return block_max_bm25_score_cache_ = BlockMaxScore(GetBlockMaxInfo());
     }
 }
 
+float BlockMaxTermDocIterator::BlockMaxScore(Pair<u32, u16> block_max_info) const {
+    auto [block_max_tf, block_max_percentage_u16] = block_max_info;
+    if (dot_product_) {
+        return dot_product_factor_ * block_max_tf;
+    }
+    // bm25_common_score_ / (1.0F + k1 * ((1.0F - b) / block_max_tf + b / block_max_percentage / avg_column_len));
+    return bm25_common_score_ /
+           (1.0F + k1 * ((1.0F - b) / block_max_tf + b * std::numeric_limits<u16>::max() / (block_max_percentage_u16 * avg_column_len_)));
+}
+
 // weight included
 float BlockMaxTermDocIterator::BM25Score() {
     // bm25_common_score_ * tf / (tf + k1 * (1.0F - b + b * column_len / avg_column_len));
     auto tf = iter_.GetCurrentTF();
-    auto doc_len = column_length_reader_->GetColumnLength(doc_id_);
-    return bm25_common_score_ * tf / (tf + k1 * (1.0F - b + b * doc_len / avg_column_len_));
+    if (dot_product_) {
+        return dot_product_factor_ * tf;
+    }
+    return bm25_common_score_ * tf / (tf + column_length_reader_->GetLengthNorm(doc_id_));
 }
 
 Tuple<bool, float, RowID> BlockMaxTermDocIterator::SeekInBlockRange(RowID doc_id, float threshold, RowID doc_id_no_beyond) {
@@ -32,7 +32,8 @@ export class BlockMaxTermDocIterator final : public EarlyTerminateIterator {
 public:
     BlockMaxTermDocIterator(optionflag_t flag, MemoryPool *session_pool);
 
-    bool InitPostingIterator(SharedPtr<Vector<SegmentPosting>> seg_postings, const u32 state_pool_size);
+    // doc_freq: of all the segments, may be more than the doc freq of seg_postings
+    bool InitPostingIterator(SharedPtr<Vector<SegmentPosting>> seg_postings, const u32 state_pool_size, u32 doc_freq);
 
     void MultiplyWeight(float factor) { weight_ *= factor; }
 
@@ -50,6 +51,9 @@ public:
 
     void InitBM25Info(u64 total_df, float avg_column_len, FullTextColumnLengthReader *column_length_reader);
 
+    // score as weight * tf, tf being the quantized weight of a sparse vector term
+    void InitDotProductInfo();
+
     RowID BlockMinPossibleDocID() const override { return iter_.BlockLowestPossibleDocID(); }
 
     RowID BlockLastDocID() const override { return iter_.BlockLastDocID(); }
@@ -64,7 +68,15 @@ public:
     // weight included
     float BM25Score();
 
+    bool HasPosition() const { return iter_.HasPosition(); }
+
+    // positions of the term in current doc
+    void GetPositions(Vector<pos_t> &positions) { iter_.GetCurrentDocPositions(positions); }
+
 private:
+    // weight included, the score bound of a block or of a range of blocks
+    float BlockMaxScore(Pair<u32, u16> block_max_info) const;
+
     // similar to TermDocIterator
     PostingIterator iter_; // initialized in constructor and InitPostingIterator() function
     float weight_ = 1.0f;  // changed in MultiplyWeight()
@@ -72,6 +84,9 @@ private:
     float avg_column_len_ = 0;
     FullTextColumnLengthReader *column_length_reader_ = nullptr;
     float bm25_common_score_ = 0; // include: weight * smooth_idf * (k1 + 1.0F)
+    // for dot product score of sparse vectors, used in place of BM25
+    bool dot_product_ = false;
+    float dot_product_factor_ = 0; // include: weight / quantization scale
     float block_max_bm25_score_cache_ = 0;
     RowID block_max_bm25_score_cache_end_id_ = INVALID_ROWID;
 };
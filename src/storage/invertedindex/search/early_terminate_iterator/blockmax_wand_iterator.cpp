@@ -0,0 +1,246 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+module;
+
+#include <cassert>
+#include <tuple>
+#include <vector>
+module blockmax_wand_iterator;
+import stl;
+import index_defines;
+import early_terminate_iterator;
+import internal_types;
+
+namespace infinity {
+
+BlockMaxWandIterator::BlockMaxWandIterator(Vector<UniquePtr<EarlyTerminateIterator>> iterators) : iterators_(std::move(iterators)) {
+    // init df
+    doc_freq_ = std::accumulate(iterators_.begin(),
+                                iterators_.end(),
+                                u32{},
+                                [](const u32 sum, const UniquePtr<EarlyTerminateIterator> &iter) -> u32 { return sum + iter->DocFreq(); });
+    bm25_score_upper_bound_ = std::accumulate(iterators_.begin(),
+                                              iterators_.end(),
+                                              0.0f,
+                                              [](const float sum, const UniquePtr<EarlyTerminateIterator> &iter) -> float {
+                                                  return sum + iter->BM25ScoreUpperBound();
+                                              });
+    candidate_docs_.resize(iterators_.size(), INVALID_ROWID);
+    sorted_ids_.resize(iterators_.size());
+    std::iota(sorted_ids_.begin(), sorted_ids_.end(), 0u);
+}
+
+void BlockMaxWandIterator::MoveIterator(u32 i, RowID doc_id) {
+    const auto &it = iterators_[i];
+    while (true) {
+        if (!it->BlockSkipTo(doc_id, 0)) {
+            candidate_docs_[i] = INVALID_ROWID;
+            return;
+        }
+        doc_id = std::max(doc_id, it->BlockMinPossibleDocID());
+        if (auto [success, id] = it->PeekInBlockRange(doc_id, it->BlockLastDocID()); success) {
+            candidate_docs_[i] = id;
+            return;
+        }
+        doc_id = it->BlockLastDocID() + 1;
+    }
+}
+
+void BlockMaxWandIterator::ShallowMoveIterator(u32 i, RowID doc_id) {
+    const auto &it = iterators_[i];
+    if (!it->BlockSkipTo(doc_id, 0)) {
+        candidate_docs_[i] = INVALID_ROWID;
+        return;
+    }
+    candidate_docs_[i] = std::max(doc_id, it->BlockMinPossibleDocID());
+}
+
+Pair<RowID, float> BlockMaxWandIterator::BlockNextWithThreshold(float threshold) {
+    if (threshold > BM25ScoreUpperBound()) [[unlikely]] {
+        return {INVALID_ROWID, 0.0F};
+    }
+    const u32 n = iterators_.size();
+    // the iterators on the last result move past it
+    const RowID next_doc = candidates_inited_ ? doc_id_ + 1 : RowID(0);
+    for (u32 i = 0; i < n; ++i) {
+        if (!candidates_inited_ or candidate_docs_[i] < next_doc) {
+            MoveIterator(i, next_doc);
+        }
+    }
+    candidates_inited_ = true;
+    while (true) {
+        std::sort(sorted_ids_.begin(), sorted_ids_.end(), [this](u32 a, u32 b) { return candidate_docs_[a] < candidate_docs_[b]; });
+        // 1. find the pivot
+        u32 pivot = n;
+        float sum_scores_upper_bound = 0.0f;
+        for (u32 k = 0; k < n and candidate_docs_[sorted_ids_[k]] != INVALID_ROWID; ++k) {
+            sum_scores_upper_bound += iterators_[sorted_ids_[k]]->BM25ScoreUpperBound();
+            if (sum_scores_upper_bound >= threshold) {
+                pivot = k;
+                break;
+            }
+        }
+        if (pivot == n) {
+            doc_id_ = INVALID_ROWID;
+            return {INVALID_ROWID, 0.0F};
+        }
+        const RowID pivot_doc = candidate_docs_[sorted_ids_[pivot]];
+        // the iterators after the pivot on the same doc also contribute to it
+        u32 pivot_end = pivot + 1;
+        while (pivot_end < n and candidate_docs_[sorted_ids_[pivot_end]] == pivot_doc) {
+            ++pivot_end;
+        }
+        // 2. sum the block max scores of the blocks covering the pivot doc
+        float sum_block_max_bm25_score = 0.0f;
+        RowID skip_to = pivot_end < n ? candidate_docs_[sorted_ids_[pivot_end]] : INVALID_ROWID;
+        for (u32 k = 0; k < pivot_end; ++k) {
+            const auto &it = iterators_[sorted_ids_[k]];
+            if (!it->BlockSkipTo(pivot_doc, 0)) {
+                continue;
+            }
+            if (const RowID lowest_possible = it->BlockMinPossibleDocID(); lowest_possible > pivot_doc) {
+                skip_to = std::min(skip_to, lowest_possible);
+                continue;
+            }
+            sum_block_max_bm25_score += it->BlockMaxBM25Score();
+            skip_to = std::min(skip_to, it->BlockLastDocID() + 1);
+        }
+        if (sum_block_max_bm25_score < threshold) {
+            // no doc before skip_to can reach the threshold, the blocks are passed without decoding them
+            skip_to = std::max(skip_to, pivot_doc + 1);
+            for (u32 k = 0; k < pivot_end; ++k) {
+                ShallowMoveIterator(sorted_ids_[k], skip_to);
+            }
+            continue;
+        }
+        if (candidate_docs_[sorted_ids_[0]] != pivot_doc) {
+            // 3. move the iterators before the pivot to the pivot doc
+            for (u32 k = 0; k < pivot and candidate_docs_[sorted_ids_[k]] < pivot_doc; ++k) {
+                MoveIterator(sorted_ids_[k], pivot_doc);
+            }
+            continue;
+        }
+        // 4. score the pivot doc, the candidates moved shallowly may not match it
+        float score = 0.0f;
+        bool match_any = false;
+        for (u32 k = 0; k < pivot_end; ++k) {
+            auto [success, child_score, id] = iterators_[sorted_ids_[k]]->SeekInBlockRange(pivot_doc, 0, pivot_doc);
+            if (success) {
+                assert((id == pivot_doc));
+                match_any = true;
+                score += child_score;
+            }
+        }
+        if (match_any and score >= threshold) {
+            doc_id_ = pivot_doc;
+            return {pivot_doc, score};
+        }
+        for (u32 k = 0; k < pivot_end; ++k) {
+            MoveIterator(sorted_ids_[k], pivot_doc + 1);
+        }
+    }
+}
+
+// the block max scores only skip docs that can't reach the threshold, so the results are those of plain wand
+Pair<RowID, float> BlockMaxWandIterator::NextWithThreshold(float threshold) { return BlockNextWithThreshold(threshold); }
+
+void BlockMaxWandIterator::UpdateScoreThreshold(float threshold) {
+    const float base_threshold = threshold - BM25ScoreUpperBound();
+    for (const auto &it : iterators_) {
+        it->UpdateScoreThreshold(base_threshold + it->BM25ScoreUpperBound());
+    }
+}
+
+// as a child of another iterator
+
+bool BlockMaxWandIterator::BlockSkipTo(RowID doc_id, float threshold) {
+    if (threshold > BM25ScoreUpperBound()) [[unlikely]] {
+        return false;
+    }
+    while (true) {
+        RowID next_candidate = INVALID_ROWID;
+        float sum_block_max_bm25_score = 0.0f;
+        bool match_any = false;
+        for (const auto &it : iterators_) {
+            if (!it->BlockSkipTo(doc_id, 0)) {
+                continue;
+            }
+            if (const RowID lowest_possible = it->BlockMinPossibleDocID(); lowest_possible <= doc_id) {
+                match_any = true;
+                sum_block_max_bm25_score += it->BlockMaxBM25Score();
+                next_candidate = std::min(next_candidate, it->BlockLastDocID() + 1);
+            } else {
+                next_candidate = std::min(next_candidate, lowest_possible);
+            }
+        }
+        if (match_any and sum_block_max_bm25_score >= threshold) {
+            common_block_min_possible_doc_id_ = doc_id;
+            common_block_last_doc_id_ = next_candidate - 1;
+            common_block_max_bm25_score_ = sum_block_max_bm25_score;
+            return true;
+        }
+        if (next_candidate == INVALID_ROWID) {
+            return false;
+        }
+        doc_id = next_candidate;
+    }
+}
+
+Tuple<bool, float, RowID> BlockMaxWandIterator::SeekInBlockRange(RowID doc_id, float threshold, RowID doc_id_no_beyond) {
+    if (threshold > BlockMaxBM25Score()) [[unlikely]] {
+        return {false, 0.0F, INVALID_ROWID};
+    }
+    const RowID block_end = std::min(doc_id_no_beyond, BlockLastDocID());
+    assert((doc_id >= BlockMinPossibleDocID()));
+    while (doc_id <= block_end) {
+        RowID next_candidate = INVALID_ROWID;
+        float score = 0.0f;
+        bool match_any = false;
+        for (const auto &it : iterators_) {
+            if (auto [success, child_score, id] = it->SeekInBlockRange(doc_id, 0, doc_id); success) {
+                match_any = true;
+                score += child_score;
+            }
+            if (auto [success, id] = it->PeekInBlockRange(doc_id + 1, block_end); success) {
+                next_candidate = std::min(next_candidate, id);
+            }
+        }
+        if (match_any and score >= threshold) {
+            doc_id_ = doc_id;
+            return {true, score, doc_id};
+        }
+        doc_id = next_candidate;
+    }
+    return {false, 0.0F, INVALID_ROWID};
+}
+
+Pair<bool, RowID> BlockMaxWandIterator::PeekInBlockRange(RowID doc_id, RowID doc_id_no_beyond) {
+    const RowID seek_end = std::min(doc_id_no_beyond, BlockLastDocID());
+    if (doc_id > seek_end) {
+        return {false, INVALID_ROWID};
+    }
+    RowID next_candidate = INVALID_ROWID;
+    bool match_any = false;
+    for (const auto &it : iterators_) {
+        if (auto [success, id] = it->PeekInBlockRange(doc_id, seek_end); success) {
+            match_any = true;
+            next_candidate = std::min(next_candidate, id);
+        }
+    }
+    return {match_any, next_candidate};
+}
+
+} // namespace infinity
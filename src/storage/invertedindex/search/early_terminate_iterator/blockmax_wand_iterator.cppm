@@ -0,0 +1,73 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+module;
+
+export module blockmax_wand_iterator;
+import stl;
+import index_defines;
+import early_terminate_iterator;
+import internal_types;
+
+namespace infinity {
+
+// equivalent to "OR" iterator
+// BlockNextWithThreshold() runs block max wand: the iterators are kept sorted by their candidate docs, the pivot is the first
+// candidate the upper bounds of the iterators before it can lift to the threshold, and the block max scores around the pivot
+// decide if it is scored or skipped.
+// When it is the child of another iterator the union is searched block by block like in BlockMaxMaxscoreIterator.
+export class BlockMaxWandIterator final : public EarlyTerminateIterator {
+public:
+    explicit BlockMaxWandIterator(Vector<UniquePtr<EarlyTerminateIterator>> iterators);
+
+    Pair<RowID, float> NextWithThreshold(float threshold) override;
+
+    Pair<RowID, float> BlockNextWithThreshold(float threshold) override;
+
+    void UpdateScoreThreshold(float threshold) override;
+
+    bool BlockSkipTo(RowID doc_id, float threshold) override;
+
+    // following functions are available only after BlockSkipTo() is called
+
+    RowID BlockMinPossibleDocID() const override { return common_block_min_possible_doc_id_; }
+
+    RowID BlockLastDocID() const override { return common_block_last_doc_id_; }
+
+    float BlockMaxBM25Score() override { return common_block_max_bm25_score_; }
+
+    Tuple<bool, float, RowID> SeekInBlockRange(RowID doc_id, float threshold, RowID doc_id_no_beyond) override;
+
+    Pair<bool, RowID> PeekInBlockRange(RowID doc_id, RowID doc_id_no_beyond) override;
+
+private:
+    // set candidate_docs_[i] to the first doc not less than doc_id iterator i may match, INVALID_ROWID if there is none
+    void MoveIterator(u32 i, RowID doc_id);
+
+    // only move the block of iterator i, candidate_docs_[i] becomes a lower bound of the doc it may match
+    void ShallowMoveIterator(u32 i, RowID doc_id);
+
+    // block max info
+    RowID common_block_min_possible_doc_id_ = INVALID_ROWID;
+    RowID common_block_last_doc_id_ = INVALID_ROWID;
+    float common_block_max_bm25_score_ = 0.0f;
+    // wand state
+    bool candidates_inited_ = false;
+    Vector<RowID> candidate_docs_;
+    Vector<u32> sorted_ids_; // iterator ids sorted by candidate doc
+    Vector<UniquePtr<EarlyTerminateIterator>> iterators_;
+};
+
+} // namespace infinity
@@ -0,0 +1,129 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+module highlighter;
+
+import stl;
+
+namespace infinity {
+
+namespace {
+
+inline bool IsWordChar(char c) { return (c >= 'a' and c <= 'z') or (c >= 'A' and c <= 'Z') or (c >= '0' and c <= '9'); }
+
+inline char ToLower(char c) { return (c >= 'A' and c <= 'Z') ? c - 'A' + 'a' : c; }
+
+// the start of the utf-8 char at or after pos
+inline SizeT CharBegin(std::string_view text, SizeT pos) {
+    while (pos < text.size() and (static_cast<u8>(text[pos]) & 0xC0) == 0x80) {
+        ++pos;
+    }
+    return pos;
+}
+
+} // namespace
+
+Highlighter::Highlighter(const Vector<String> &terms, SizeT snippet_size) : snippet_size_(snippet_size) {
+    for (const String &term : terms) {
+        if (term.empty()) {
+            continue;
+        }
+        String lower_term(term.size(), '\0');
+        std::transform(term.begin(), term.end(), lower_term.begin(), ToLower);
+        terms_.push_back(std::move(lower_term));
+    }
+    // a longer term wins a match starting at the same place
+    std::sort(terms_.begin(), terms_.end(), [](const String &lhs, const String &rhs) { return lhs.size() > rhs.size(); });
+    terms_.erase(std::unique(terms_.begin(), terms_.end()), terms_.end());
+}
+
+String Highlighter::Highlight(std::string_view text) const {
+    String lower_text(text.size(), '\0');
+    std::transform(text.begin(), text.end(), lower_text.begin(), ToLower);
+    // 1. find the matched spans
+    Vector<Pair<SizeT, SizeT>> spans;
+    for (const String &term : terms_) {
+        const bool word_term = IsWordChar(term.front());
+        for (SizeT pos = lower_text.find(term); pos != String::npos; pos = lower_text.find(term, pos + 1)) {
+            if (word_term and pos > 0 and IsWordChar(lower_text[pos - 1])) {
+                continue;
+            }
+            SizeT end = pos + term.size();
+            if (word_term) {
+                while (end < lower_text.size() and IsWordChar(lower_text[end])) {
+                    ++end;
+                }
+            }
+            spans.emplace_back(pos, end);
+        }
+    }
+    std::sort(spans.begin(), spans.end());
+    SizeT merged_cnt = 0;
+    for (const auto &span : spans) {
+        if (merged_cnt > 0 and span.first <= spans[merged_cnt - 1].second) {
+            spans[merged_cnt - 1].second = std::max(spans[merged_cnt - 1].second, span.second);
+        } else {
+            spans[merged_cnt++] = span;
+        }
+    }
+    spans.resize(merged_cnt);
+
+    // 2. choose the part of the text to return
+    SizeT begin = 0;
+    SizeT end = text.size();
+    if (snippet_size_ > 0 and text.size() > snippet_size_) {
+        if (!spans.empty()) {
+            // leave a quarter of the snippet for the context before the first match
+            begin = spans.front().first - std::min(spans.front().first, snippet_size_ / 4);
+        }
+        begin = CharBegin(text, std::min(begin, text.size() - snippet_size_));
+        end = CharBegin(text, std::min(begin + snippet_size_, text.size()));
+        // never cut a match
+        for (const auto &[span_begin, span_end] : spans) {
+            if (span_begin < end and span_end > end) {
+                end = span_end;
+            }
+        }
+    }
+
+    // 3. mark the matches
+    String result;
+    result.reserve(end - begin + spans.size() * (PRE_TAG.size() + POST_TAG.size()) + 2 * ELLIPSIS.size());
+    if (begin > 0) {
+        result += ELLIPSIS;
+    }
+    SizeT copied = begin;
+    for (const auto &[span_begin, span_end] : spans) {
+        if (span_begin < begin) {
+            continue;
+        }
+        if (span_begin >= end) {
+            break;
+        }
+        result += text.substr(copied, span_begin - copied);
+        result += PRE_TAG;
+        result += text.substr(span_begin, span_end - span_begin);
+        result += POST_TAG;
+        copied = span_end;
+    }
+    result += text.substr(copied, end - copied);
+    if (end < text.size()) {
+        result += ELLIPSIS;
+    }
+    return result;
+}
+
+} // namespace infinity
@@ -0,0 +1,43 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module highlighter;
+
+import stl;
+
+namespace infinity {
+
+// Marks the query terms in a text column of the top n results of MATCH, so that the client needs neither the analyzer nor,
+// with a snippet size, the whole document.
+// A term starting with an ascii letter or digit matches at the start of a word case-insensitively, and the mark is extended
+// to the end of the word, which covers the stemmed terms and the prefixes. Other terms (e.g. CJK) match anywhere.
+export class Highlighter {
+public:
+    static constexpr std::string_view PRE_TAG = "<em>";
+    static constexpr std::string_view POST_TAG = "</em>";
+    static constexpr std::string_view ELLIPSIS = "...";
+
+    // snippet_size: 0 to keep the whole text, otherwise the text is cut to about snippet_size bytes starting a bit before the first match
+    Highlighter(const Vector<String> &terms, SizeT snippet_size);
+
+    String Highlight(std::string_view text) const;
+
+private:
+    Vector<String> terms_; // lower case, longest first
+    SizeT snippet_size_ = 0;
+};
+
+} // namespace infinity
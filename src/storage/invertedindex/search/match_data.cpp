@@ -24,6 +24,7 @@ import bm25_ranker;
 import internal_types;
 import column_index_reader;
 import blockmax_term_doc_iterator;
+import sparse_analyzer;
 
 namespace infinity {
 
@@ -36,6 +37,7 @@ u32 Scorer::GetOrSetColumnIndex(u64 column_id) {
     if (auto iter = column_index_map_.find(column_id); iter == column_index_map_.end()) {
         column_index_map_[column_id] = column_counter_;
         column_ids_.push_back(column_id);
+        weighted_tf_.push_back(index_reader_->GetColumnIndexReader(column_id)->weighted_tf_);
         column_length_reader_.AppendColumnLength(index_reader_, column_ids_, avg_column_length_);
         return column_counter_++;
     } else {
@@ -53,20 +55,33 @@ void Scorer::AddBlockMaxDocIterator(BlockMaxTermDocIterator *iter, u64 column_id
     u32 column_index = GetOrSetColumnIndex(column_id);
     block_max_iterators_.resize(column_index + 1);
     block_max_iterators_[column_index].push_back(iter);
-    iter->InitBM25Info(total_df_, avg_column_length_[column_index], column_length_reader_.GetColumnLengthReader(column_index));
+    if (weighted_tf_[column_index]) {
+        iter->InitDotProductInfo();
+    } else {
+        iter->InitBM25Info(total_df_, avg_column_length_[column_index], column_length_reader_.GetColumnLengthReader(column_index));
+    }
 }
 
 float Scorer::Score(RowID doc_id) {
     float score = 0.0F;
     for (u32 i = 0; i < column_counter_; i++) {
+        if (weighted_tf_[i]) {
+            // sparse vector: dot product of query term weights and quantized document weights
+            TermColumnMatchData column_match_data;
+            for (TermDocIterator *iter : iterators_[i]) {
+                if (iter->GetTermMatchData(column_match_data, doc_id)) {
+                    score += iter->GetWeight() * DequantizeSparseWeight(column_match_data.tf_);
+                }
+            }
+            continue;
+        }
         BM25Ranker ranker(total_df_);
-        float avg_column_length = avg_column_length_[i];
-        u32 column_len = column_length_reader_.GetColumnLength(i, doc_id);
+        const float length_norm = column_length_reader_.GetLengthNorm(i, doc_id);
         Vector<TermDocIterator *> &column_iters = iterators_[i];
         TermColumnMatchData column_match_data;
         for (u32 j = 0; j < column_iters.size(); j++) {
             if (column_iters[j]->GetTermMatchData(column_match_data, doc_id)) {
-                ranker.AddTermParam(column_match_data.tf_, column_iters[j]->GetDF(), avg_column_length, column_len, column_iters[j]->GetWeight());
+                ranker.AddTermParam(column_match_data.tf_, column_iters[j]->GetDF(), length_norm, column_iters[j]->GetWeight());
             }
         }
         score += ranker.GetScore();
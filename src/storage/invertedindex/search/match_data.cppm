@@ -54,6 +54,7 @@ private:
     u32 column_counter_{0};
     FlatHashMap<u64, u32, Hash> column_index_map_;
     Vector<u64> column_ids_;
+    Vector<bool> weighted_tf_;
     Vector<Vector<TermDocIterator *>> iterators_;
     Vector<Vector<BlockMaxTermDocIterator *>> block_max_iterators_;
     Vector<float> avg_column_length_;
@@ -0,0 +1,95 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <vector>
+module phrase_doc_iterator;
+
+import stl;
+import index_defines;
+import doc_iterator;
+import term_doc_iterator;
+import and_iterator;
+import internal_types;
+
+namespace infinity {
+
+bool PhrasePositionsMatch(const Vector<Vector<pos_t>> &positions, u32 slop) {
+    const SizeT term_cnt = positions.size();
+    for (const auto &term_positions : positions) {
+        if (term_positions.empty()) {
+            return false;
+        }
+    }
+    // smallest window covering one normalized position (position - i) from every term
+    Vector<SizeT> cursors(term_cnt, 0);
+    auto normalized = [&](SizeT i) { return static_cast<i64>(positions[i][cursors[i]]) - static_cast<i64>(i); };
+    while (true) {
+        SizeT min_idx = 0;
+        i64 min_pos = normalized(0);
+        i64 max_pos = min_pos;
+        for (SizeT i = 1; i < term_cnt; ++i) {
+            const i64 pos = normalized(i);
+            if (pos < min_pos) {
+                min_pos = pos;
+                min_idx = i;
+            }
+            max_pos = std::max(max_pos, pos);
+        }
+        if (max_pos - min_pos <= static_cast<i64>(slop)) {
+            return true;
+        }
+        if (++cursors[min_idx] == positions[min_idx].size()) {
+            return false;
+        }
+    }
+}
+
+PhraseDocIterator::PhraseDocIterator(Vector<UniquePtr<DocIterator>> iterators, u32 slop) : AndIterator(std::move(iterators)), slop_(slop) {
+    phrase_terms_.reserve(children_.size());
+    for (const auto &child : children_) {
+        auto *term_iter = static_cast<TermDocIterator *>(child.get());
+        phrase_terms_.push_back(term_iter);
+        // index without position list: can only check the terms appear in the doc
+        has_position_ = has_position_ and term_iter->HasPosition();
+    }
+    positions_.resize(phrase_terms_.size());
+    // AndIterator has moved to the first doc containing all terms, check its positions
+    if (doc_id_ != INVALID_ROWID and !MatchPositions()) {
+        DoSeek(doc_id_ + 1);
+    }
+}
+
+void PhraseDocIterator::DoSeek(RowID doc_id) {
+    while (true) {
+        AndIterator::DoSeek(doc_id);
+        if (doc_id_ == INVALID_ROWID or MatchPositions()) {
+            return;
+        }
+        doc_id = doc_id_ + 1;
+    }
+}
+
+bool PhraseDocIterator::MatchPositions() {
+    if (!has_position_) {
+        return true;
+    }
+    for (SizeT i = 0; i < phrase_terms_.size(); ++i) {
+        phrase_terms_[i]->GetPositions(positions_[i]);
+    }
+    return PhrasePositionsMatch(positions_, slop_);
+}
+
+} // namespace infinity
@@ -0,0 +1,49 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module phrase_doc_iterator;
+
+import stl;
+import index_defines;
+import doc_iterator;
+import term_doc_iterator;
+import and_iterator;
+import internal_types;
+
+namespace infinity {
+
+// positions[i]: positions of the i-th phrase term in a doc, in ascending order
+// match if some choice of one position per term has all (position - i) in a window of width slop
+// slop 0 is an exact phrase match
+export bool PhrasePositionsMatch(const Vector<Vector<pos_t>> &positions, u32 slop);
+
+// doc-level "and" intersection of the phrase terms, positions are only checked for docs that pass it
+export class PhraseDocIterator final : public AndIterator {
+public:
+    // iterators must be TermDocIterator, in phrase order
+    PhraseDocIterator(Vector<UniquePtr<DocIterator>> iterators, u32 slop);
+
+    void DoSeek(RowID doc_id) override;
+
+private:
+    bool MatchPositions();
+
+    Vector<TermDocIterator *> phrase_terms_;
+    Vector<Vector<pos_t>> positions_;
+    u32 slop_ = 0;
+    bool has_position_ = true;
+};
+} // namespace infinity
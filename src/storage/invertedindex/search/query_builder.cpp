@@ -34,9 +34,9 @@ import blockmax_term_doc_iterator;
 
 namespace infinity {
 
-QueryBuilder::QueryBuilder(TransactionID txn_id, TxnTimeStamp begin_ts, SharedPtr<BaseTableRef> &base_table_ref)
+QueryBuilder::QueryBuilder(TransactionID txn_id, TxnTimeStamp begin_ts, SharedPtr<BaseTableRef> &base_table_ref, MemoryPool *session_pool)
     : txn_id_(txn_id), begin_ts_(begin_ts), table_entry_(base_table_ref->table_entry_ptr_),
-      index_reader_(table_entry_->GetFullTextIndexReader(txn_id_, begin_ts_)) {
+      index_reader_(table_entry_->GetFullTextIndexReader(txn_id_, begin_ts_, session_pool)) {
     u64 total_row_count = 0;
     for (SegmentEntry *segment_entry : base_table_ref->block_index_->segments_) {
         total_row_count += segment_entry->row_count();
@@ -48,7 +48,10 @@ QueryBuilder::~QueryBuilder() {}
 
 UniquePtr<DocIterator> QueryBuilder::CreateSearch(FullTextQueryContext &context) {
     // Optimize the query tree.
-    context.query_tree_ = QueryNode::GetOptimizedQueryTree(std::move(context.query_tree_));
+    if (!context.optimized_) {
+        context.query_tree_ = QueryNode::GetOptimizedQueryTree(std::move(context.query_tree_));
+        context.optimized_ = true;
+    }
     // Create the iterator from the query tree.
     UniquePtr<DocIterator> result = context.query_tree_->CreateSearch(table_entry_, index_reader_, &scorer_);
     return result;
@@ -56,7 +59,10 @@ UniquePtr<DocIterator> QueryBuilder::CreateSearch(FullTextQueryContext &context)
 
 UniquePtr<EarlyTerminateIterator> QueryBuilder::CreateEarlyTerminateSearch(FullTextQueryContext &context) {
     // Optimize the query tree.
-    context.query_tree_ = QueryNode::GetOptimizedQueryTree(std::move(context.query_tree_));
+    if (!context.optimized_) {
+        context.query_tree_ = QueryNode::GetOptimizedQueryTree(std::move(context.query_tree_));
+        context.optimized_ = true;
+    }
     // Create the iterator from the query tree.
     UniquePtr<EarlyTerminateIterator> result = context.query_tree_->CreateEarlyTerminateSearch(table_entry_, index_reader_, &scorer_);
     return result;
@@ -24,24 +24,30 @@ import table_entry;
 import internal_types;
 import default_values;
 import base_table_ref;
+import memory_pool;
 
 namespace infinity {
 
 struct QueryNode;
 export struct FullTextQueryContext {
     UniquePtr<QueryNode> query_tree_;
+    // the tree is optimized once, before the first iterator is created from it
+    bool optimized_ = false;
 };
 
 class EarlyTerminateIterator;
 
 export class QueryBuilder {
 public:
-    QueryBuilder(TransactionID txn_id, TxnTimeStamp begin_ts, SharedPtr<BaseTableRef> &base_table_ref);
+    QueryBuilder(TransactionID txn_id, TxnTimeStamp begin_ts, SharedPtr<BaseTableRef> &base_table_ref, MemoryPool *session_pool);
 
     ~QueryBuilder();
 
     const Map<String, String> &GetColumn2Analyzer() { return index_reader_.GetColumn2Analyzer(); }
 
+    // search only the given sorted segments, the statistics for scoring are still of the whole table
+    void SetSegmentIDs(SharedPtr<Vector<SegmentID>> segment_ids) { index_reader_.segment_ids_ = std::move(segment_ids); }
+
     UniquePtr<DocIterator> CreateSearch(FullTextQueryContext &context);
 
     UniquePtr<EarlyTerminateIterator> CreateEarlyTerminateSearch(FullTextQueryContext &context);
@@ -7,6 +7,7 @@ import logger;
 import doc_iterator;
 import term_doc_iterator;
 import and_iterator;
+import phrase_doc_iterator;
 import and_not_iterator;
 import or_iterator;
 import table_entry;
@@ -18,6 +19,9 @@ import blockmax_term_doc_iterator;
 import blockmax_and_iterator;
 import blockmax_and_not_iterator;
 import blockmax_maxscore_iterator;
+import blockmax_phrase_iterator;
+import blockmax_wand_iterator;
+import default_values;
 
 namespace infinity {
 
@@ -29,6 +33,8 @@ namespace infinity {
 // 3. children of "or" can only be term, "and" or "and_not", because "or" will be optimized, and "not" is either optimized or not allowed
 // 4. "and_not" does not exist in parser output, it is generated during optimization
 //    "and_not": first child can be term, "and", "or", other children form a list of "not"
+// 5. "wand" does not exist in parser output, it is an optimized "or" with no more than FULL_TEXT_WAND_MAX_CHILDREN children
+//    wherever "or" is mentioned above for the optimized tree, "wand" is handled the same way
 
 std::unique_ptr<QueryNode> QueryNode::GetOptimizedQueryTree(std::unique_ptr<QueryNode> root) {
     if (!root) {
@@ -38,7 +44,10 @@ std::unique_ptr<QueryNode> QueryNode::GetOptimizedQueryTree(std::unique_ptr<Quer
     root->PushDownWeight();
     // optimize the query tree
     switch (root->GetType()) {
-        case QueryNodeType::TERM: {
+        case QueryNodeType::TERM:
+        case QueryNodeType::PHRASE:
+        case QueryNodeType::PREFIX_TERM:
+        case QueryNodeType::PREFIX_TERM: {
             // no need to optimize
             return root;
         }
@@ -69,6 +78,8 @@ std::unique_ptr<QueryNode> MultiQueryNode::GetNewOptimizedQueryTree() {
     for (auto &child : children_) {
         switch (child->GetType()) {
             case QueryNodeType::TERM:
+            case QueryNodeType::PHRASE:
+            case QueryNodeType::PREFIX_TERM:
                 // no need to optimize
                 break;
             case QueryNodeType::AND_NOT: {
@@ -118,13 +129,16 @@ std::unique_ptr<QueryNode> NotQueryNode::InnerGetNewOptimizedQueryTree() {
                 break;
             }
             case QueryNodeType::TERM:
+            case QueryNodeType::PHRASE:
+            case QueryNodeType::PREFIX_TERM:
             case QueryNodeType::AND:
             case QueryNodeType::AND_NOT: {
                 new_not_list.emplace_back(std::move(child));
                 break;
             }
-            case QueryNodeType::OR: {
-                auto &or_node = static_cast<OrQueryNode &>(*child);
+            case QueryNodeType::OR:
+            case QueryNodeType::WAND: {
+                auto &or_node = static_cast<MultiQueryNode &>(*child);
                 for (auto &or_child : or_node.children_) {
                     new_not_list.emplace_back(std::move(or_child));
                 }
@@ -169,7 +183,10 @@ std::unique_ptr<QueryNode> AndQueryNode::InnerGetNewOptimizedQueryTree() {
                 break;
             }
             case QueryNodeType::TERM:
-            case QueryNodeType::OR: {
+            case QueryNodeType::PHRASE:
+            case QueryNodeType::PREFIX_TERM:
+            case QueryNodeType::OR:
+            case QueryNodeType::WAND: {
                 and_list.emplace_back(std::move(child));
                 break;
             }
@@ -239,7 +256,7 @@ std::unique_ptr<QueryNode> AndQueryNode::InnerGetNewOptimizedQueryTree() {
 // 3.2. build result:
 //      all cases:  "or list" | "not list"
 //                       Y    |      Y       => invalid query
-//                       Y    |      N       => build "or"
+//                       Y    |      N       => build "or", or "wand" if there are no more than FULL_TEXT_WAND_MAX_CHILDREN children
 //                       N    |      Y       => build "not" of (child and ...), here child can be term, "and", "and_not" or "or", need optimization
 
 std::unique_ptr<QueryNode> OrQueryNode::InnerGetNewOptimizedQueryTree() {
@@ -251,12 +268,15 @@ std::unique_ptr<QueryNode> OrQueryNode::InnerGetNewOptimizedQueryTree() {
     // 3.1.
     for (auto &child : children_) {
         switch (child->GetType()) {
-            case QueryNodeType::OR: {
-                auto &or_node = static_cast<OrQueryNode &>(*child);
+            case QueryNodeType::OR:
+            case QueryNodeType::WAND: {
+                auto &or_node = static_cast<MultiQueryNode &>(*child);
                 or_list.insert(or_list.end(), std::make_move_iterator(or_node.children_.begin()), std::make_move_iterator(or_node.children_.end()));
                 break;
             }
             case QueryNodeType::TERM:
+            case QueryNodeType::PHRASE:
+            case QueryNodeType::PREFIX_TERM:
             case QueryNodeType::AND:
             case QueryNodeType::AND_NOT: {
                 or_list.emplace_back(std::move(child));
@@ -299,6 +319,11 @@ std::unique_ptr<QueryNode> OrQueryNode::InnerGetNewOptimizedQueryTree() {
         return not_node;
     } else if (not_list.empty()) {
         // at least 2 children
+        if (or_list.size() <= FULL_TEXT_WAND_MAX_CHILDREN) {
+            auto wand_node = std::make_unique<WandQueryNode>(); // new node, weight is reset to 1.0
+            wand_node->children_ = std::move(or_list);
+            return wand_node;
+        }
         auto or_node = std::make_unique<OrQueryNode>(); // new node, weight is reset to 1.0
         or_node->children_ = std::move(or_list);
         return or_node;
@@ -316,6 +341,14 @@ std::unique_ptr<QueryNode> AndNotQueryNode::InnerGetNewOptimizedQueryTree() {
     return nullptr;
 }
 
+// 5. deal with "wand":
+// "wand" does not exist in parser output, it is generated during optimization
+
+std::unique_ptr<QueryNode> WandQueryNode::InnerGetNewOptimizedQueryTree() {
+    UnrecoverableError("OptimizeInPlaceInner: Unexpected case! WandQueryNode should not exist in parser output");
+    return nullptr;
+}
+
 // create search iterator
 
 std::unique_ptr<DocIterator> TermQueryNode::CreateSearch(const TableEntry *table_entry, IndexReader &index_reader, Scorer *scorer) const {
@@ -323,7 +356,7 @@ std::unique_ptr<DocIterator> TermQueryNode::CreateSearch(const TableEntry *table
     ColumnIndexReader *column_index_reader = index_reader.GetColumnIndexReader(column_id);
     if (!column_index_reader)
         return nullptr;
-    auto posting_iterator = column_index_reader->Lookup(term_, index_reader.session_pool_.get());
+    auto posting_iterator = column_index_reader->Lookup(term_, index_reader.session_pool_, index_reader.segment_ids_.get());
     if (!posting_iterator) {
         return nullptr;
     }
@@ -341,7 +374,7 @@ TermQueryNode::CreateEarlyTerminateSearch(const TableEntry *table_entry, IndexRe
     ColumnIndexReader *column_index_reader = index_reader.GetColumnIndexReader(column_id);
     if (!column_index_reader)
         return nullptr;
-    auto search = column_index_reader->LookupBlockMax(term_, index_reader.session_pool_.get(), GetWeight());
+    auto search = column_index_reader->LookupBlockMax(term_, index_reader.session_pool_, GetWeight(), index_reader.segment_ids_.get());
     if (!search) {
         return nullptr;
     }
@@ -352,6 +385,113 @@ TermQueryNode::CreateEarlyTerminateSearch(const TableEntry *table_entry, IndexRe
     return search;
 }
 
+std::unique_ptr<DocIterator> PhraseQueryNode::CreateSearch(const TableEntry *table_entry, IndexReader &index_reader, Scorer *scorer) const {
+    ColumnID column_id = table_entry->GetColumnIdByName(column_);
+    ColumnIndexReader *column_index_reader = index_reader.GetColumnIndexReader(column_id);
+    if (!column_index_reader)
+        return nullptr;
+    Vector<std::unique_ptr<DocIterator>> term_doc_iters;
+    term_doc_iters.reserve(terms_.size());
+    for (const auto &term : terms_) {
+        auto posting_iterator = column_index_reader->Lookup(term, index_reader.session_pool_, index_reader.segment_ids_.get());
+        if (!posting_iterator) {
+            // phrase can not match if any term is missing
+            return nullptr;
+        }
+        term_doc_iters.emplace_back(MakeUnique<TermDocIterator>(std::move(posting_iterator), column_id, GetWeight()));
+    }
+    if (scorer) {
+        // nodes under "not" will not be added to scorer
+        for (auto &iter : term_doc_iters) {
+            scorer->AddDocIterator(static_cast<TermDocIterator *>(iter.get()), column_id);
+        }
+    }
+    return MakeUnique<PhraseDocIterator>(std::move(term_doc_iters), slop_);
+}
+
+std::unique_ptr<EarlyTerminateIterator>
+PhraseQueryNode::CreateEarlyTerminateSearch(const TableEntry *table_entry, IndexReader &index_reader, Scorer *scorer) const {
+    ColumnID column_id = table_entry->GetColumnIdByName(column_);
+    ColumnIndexReader *column_index_reader = index_reader.GetColumnIndexReader(column_id);
+    if (!column_index_reader)
+        return nullptr;
+    Vector<std::unique_ptr<EarlyTerminateIterator>> term_doc_iters;
+    term_doc_iters.reserve(terms_.size());
+    for (const auto &term : terms_) {
+        auto search = column_index_reader->LookupBlockMax(term, index_reader.session_pool_, GetWeight(), index_reader.segment_ids_.get());
+        if (!search) {
+            // phrase can not match if any term is missing
+            return nullptr;
+        }
+        if (scorer) {
+            // nodes under "not" will not be added to scorer
+            scorer->AddBlockMaxDocIterator(search.get(), column_id);
+        }
+        term_doc_iters.emplace_back(std::move(search));
+    }
+    return MakeUnique<BlockMaxPhraseIterator>(std::move(term_doc_iters), slop_);
+}
+
+std::unique_ptr<DocIterator> PrefixTermQueryNode::CreateSearch(const TableEntry *table_entry, IndexReader &index_reader, Scorer *scorer) const {
+    ColumnID column_id = table_entry->GetColumnIdByName(column_);
+    ColumnIndexReader *column_index_reader = index_reader.GetColumnIndexReader(column_id);
+    if (!column_index_reader)
+        return nullptr;
+    Vector<String> terms = column_index_reader->ExpandPrefix(prefix_, max_expansion_);
+    Vector<std::unique_ptr<DocIterator>> term_doc_iters;
+    term_doc_iters.reserve(terms.size());
+    for (const auto &term : terms) {
+        auto posting_iterator = column_index_reader->Lookup(term, index_reader.session_pool_, index_reader.segment_ids_.get());
+        if (!posting_iterator) {
+            continue;
+        }
+        auto search = MakeUnique<TermDocIterator>(std::move(posting_iterator), column_id, GetWeight());
+        if (scorer) {
+            // nodes under "not" will not be added to scorer
+            scorer->AddDocIterator(search.get(), column_id);
+        }
+        term_doc_iters.emplace_back(std::move(search));
+    }
+    if (term_doc_iters.empty()) {
+        return nullptr;
+    } else if (term_doc_iters.size() == 1) {
+        return std::move(term_doc_iters[0]);
+    } else {
+        return MakeUnique<OrIterator>(std::move(term_doc_iters));
+    }
+}
+
+std::unique_ptr<EarlyTerminateIterator>
+PrefixTermQueryNode::CreateEarlyTerminateSearch(const TableEntry *table_entry, IndexReader &index_reader, Scorer *scorer) const {
+    ColumnID column_id = table_entry->GetColumnIdByName(column_);
+    ColumnIndexReader *column_index_reader = index_reader.GetColumnIndexReader(column_id);
+    if (!column_index_reader)
+        return nullptr;
+    Vector<String> terms = column_index_reader->ExpandPrefix(prefix_, max_expansion_);
+    Vector<std::unique_ptr<EarlyTerminateIterator>> term_doc_iters;
+    term_doc_iters.reserve(terms.size());
+    for (const auto &term : terms) {
+        auto search = column_index_reader->LookupBlockMax(term, index_reader.session_pool_, GetWeight(), index_reader.segment_ids_.get());
+        if (!search) {
+            continue;
+        }
+        if (scorer) {
+            // nodes under "not" will not be added to scorer
+            scorer->AddBlockMaxDocIterator(search.get(), column_id);
+        }
+        term_doc_iters.emplace_back(std::move(search));
+    }
+    if (term_doc_iters.empty()) {
+        return nullptr;
+    } else if (term_doc_iters.size() == 1) {
+        return std::move(term_doc_iters[0]);
+    } else if (term_doc_iters.size() <= FULL_TEXT_WAND_MAX_CHILDREN) {
+        return MakeUnique<BlockMaxWandIterator>(std::move(term_doc_iters));
+    } else {
+        return MakeUnique<BlockMaxMaxscoreIterator>(std::move(term_doc_iters));
+    }
+}
+
 std::unique_ptr<DocIterator> AndQueryNode::CreateSearch(const TableEntry *table_entry, IndexReader &index_reader, Scorer *scorer) const {
     Vector<std::unique_ptr<DocIterator>> sub_doc_iters;
     sub_doc_iters.reserve(children_.size());
@@ -438,10 +578,14 @@ AndNotQueryNode::CreateEarlyTerminateSearch(const TableEntry *table_entry, Index
     }
 }
 
-std::unique_ptr<DocIterator> OrQueryNode::CreateSearch(const TableEntry *table_entry, IndexReader &index_reader, Scorer *scorer) const {
+namespace {
+
+// "or" and "wand" share the ordinary iterator, they differ in the early terminate iterator
+std::unique_ptr<DocIterator>
+CreateUnionSearch(const Vector<std::unique_ptr<QueryNode>> &children, const TableEntry *table_entry, IndexReader &index_reader, Scorer *scorer) {
     Vector<std::unique_ptr<DocIterator>> sub_doc_iters;
-    sub_doc_iters.reserve(children_.size());
-    for (auto &child : children_) {
+    sub_doc_iters.reserve(children.size());
+    for (auto &child : children) {
         auto iter = child->CreateSearch(table_entry, index_reader, scorer);
         if (iter) {
             sub_doc_iters.emplace_back(std::move(iter));
@@ -456,11 +600,14 @@ std::unique_ptr<DocIterator> OrQueryNode::CreateSearch(const TableEntry *table_e
     }
 }
 
-std::unique_ptr<EarlyTerminateIterator>
-OrQueryNode::CreateEarlyTerminateSearch(const TableEntry *table_entry, IndexReader &index_reader, Scorer *scorer) const {
+template <typename UnionIterator>
+std::unique_ptr<EarlyTerminateIterator> CreateUnionEarlyTerminateSearch(const Vector<std::unique_ptr<QueryNode>> &children,
+                                                                        const TableEntry *table_entry,
+                                                                        IndexReader &index_reader,
+                                                                        Scorer *scorer) {
     Vector<std::unique_ptr<EarlyTerminateIterator>> sub_doc_iters;
-    sub_doc_iters.reserve(children_.size());
-    for (auto &child : children_) {
+    sub_doc_iters.reserve(children.size());
+    for (auto &child : children) {
         auto iter = child->CreateEarlyTerminateSearch(table_entry, index_reader, scorer);
         if (iter) {
             sub_doc_iters.emplace_back(std::move(iter));
@@ -471,10 +618,30 @@ OrQueryNode::CreateEarlyTerminateSearch(const TableEntry *table_entry, IndexRead
     } else if (sub_doc_iters.size() == 1) {
         return std::move(sub_doc_iters[0]);
     } else {
-        return MakeUnique<BlockMaxMaxscoreIterator>(std::move(sub_doc_iters));
+        return MakeUnique<UnionIterator>(std::move(sub_doc_iters));
     }
 }
 
+} // namespace
+
+std::unique_ptr<DocIterator> OrQueryNode::CreateSearch(const TableEntry *table_entry, IndexReader &index_reader, Scorer *scorer) const {
+    return CreateUnionSearch(children_, table_entry, index_reader, scorer);
+}
+
+std::unique_ptr<EarlyTerminateIterator>
+OrQueryNode::CreateEarlyTerminateSearch(const TableEntry *table_entry, IndexReader &index_reader, Scorer *scorer) const {
+    return CreateUnionEarlyTerminateSearch<BlockMaxMaxscoreIterator>(children_, table_entry, index_reader, scorer);
+}
+
+std::unique_ptr<DocIterator> WandQueryNode::CreateSearch(const TableEntry *table_entry, IndexReader &index_reader, Scorer *scorer) const {
+    return CreateUnionSearch(children_, table_entry, index_reader, scorer);
+}
+
+std::unique_ptr<EarlyTerminateIterator>
+WandQueryNode::CreateEarlyTerminateSearch(const TableEntry *table_entry, IndexReader &index_reader, Scorer *scorer) const {
+    return CreateUnionEarlyTerminateSearch<BlockMaxWandIterator>(children_, table_entry, index_reader, scorer);
+}
+
 std::unique_ptr<DocIterator> NotQueryNode::CreateSearch(const TableEntry *table_entry, IndexReader &index_reader, Scorer *scorer) const {
     UnrecoverableError("NOT query node should be optimized into AND_NOT query node");
     return nullptr;
@@ -525,6 +692,32 @@ void TermQueryNode::PrintTree(std::ostream &os, const std::string &prefix, bool
     os << '\n';
 }
 
+void PhraseQueryNode::PrintTree(std::ostream &os, const std::string &prefix, bool is_final) const {
+    os << prefix;
+    os << (is_final ? "└──" : "├──");
+    os << QueryNodeTypeToString(type_);
+    os << " (weight: " << weight_ << ")";
+    os << " (column: " << column_ << ")";
+    os << " (terms:";
+    for (const auto &term : terms_) {
+        os << ' ' << term;
+    }
+    os << ")";
+    os << " (slop: " << slop_ << ")";
+    os << '\n';
+}
+
+void PrefixTermQueryNode::PrintTree(std::ostream &os, const std::string &prefix, bool is_final) const {
+    os << prefix;
+    os << (is_final ? "└──" : "├──");
+    os << QueryNodeTypeToString(type_);
+    os << " (weight: " << weight_ << ")";
+    os << " (column: " << column_ << ")";
+    os << " (prefix: " << prefix_ << ")";
+    os << " (max_expansion: " << max_expansion_ << ")";
+    os << '\n';
+}
+
 void MultiQueryNode::PrintTree(std::ostream &os, const std::string &prefix, bool is_final) const {
     os << prefix;
     os << (is_final ? "└──" : "├──");
@@ -15,6 +15,7 @@
 #ifndef QUERY_NODE_H
 #define QUERY_NODE_H
 
+#include <map>
 #include <memory>
 #include <ostream>
 #include <string>
@@ -31,13 +32,14 @@ enum class QueryNodeType : char {
     NOT,
     // may appear in optimized query tree:
     TERM,
+    PHRASE,
+    PREFIX_TERM,
     AND,
     AND_NOT,
     OR,
-    // unimplemented:
+    // does not exist in parser output, "or" of a few children is turned into it during optimization:
     WAND,
-    PHRASE,
-    PREFIX_TERM,
+    // unimplemented:
     SUFFIX_TERM,
     SUBSTRING_TERM,
 };
@@ -77,6 +79,10 @@ struct QueryNode {
 
     // recursively multiply and push down the weight to the leaf term nodes
     virtual void PushDownWeight(float factor = 1.0f) = 0;
+    // number of terms the query may search, used to choose between the ordinary and the early terminate iterators
+    virtual unsigned GetTermCount() const { return 1; }
+    // the terms (and prefixes) a matched doc may contain, by column, used to highlight the results
+    virtual void GetHighlightTerms(std::map<std::string, std::vector<std::string>> &) const {}
     // create the iterator from the query tree, need to be called after optimization
     virtual std::unique_ptr<DocIterator> CreateSearch(const TableEntry *table_entry, IndexReader &index_reader, Scorer *scorer) const = 0;
     virtual std::unique_ptr<EarlyTerminateIterator>
@@ -93,6 +99,50 @@ struct TermQueryNode final : public QueryNode {
     TermQueryNode() : QueryNode(QueryNodeType::TERM) {}
 
     void PushDownWeight(float factor) override { MultiplyWeight(factor); }
+    void GetHighlightTerms(std::map<std::string, std::vector<std::string>> &column_terms) const override {
+        column_terms[column_].push_back(term_);
+    }
+    std::unique_ptr<DocIterator> CreateSearch(const TableEntry *table_entry, IndexReader &index_reader, Scorer *scorer) const override;
+    std::unique_ptr<EarlyTerminateIterator>
+    CreateEarlyTerminateSearch(const TableEntry *table_entry, IndexReader &index_reader, Scorer *scorer) const override;
+    void PrintTree(std::ostream &os, const std::string &prefix, bool is_final) const override;
+};
+
+// terms of a quoted query, matched in order
+// slop: max distance the terms may be moved to form the phrase, 0 is exact match
+struct PhraseQueryNode final : public QueryNode {
+    std::vector<std::string> terms_;
+    std::string column_;
+    unsigned slop_{0};
+
+    PhraseQueryNode() : QueryNode(QueryNodeType::PHRASE) {}
+
+    void PushDownWeight(float factor) override { MultiplyWeight(factor); }
+    unsigned GetTermCount() const override { return terms_.size(); }
+    void GetHighlightTerms(std::map<std::string, std::vector<std::string>> &column_terms) const override {
+        auto &terms = column_terms[column_];
+        terms.insert(terms.end(), terms_.begin(), terms_.end());
+    }
+    std::unique_ptr<DocIterator> CreateSearch(const TableEntry *table_entry, IndexReader &index_reader, Scorer *scorer) const override;
+    std::unique_ptr<EarlyTerminateIterator>
+    CreateEarlyTerminateSearch(const TableEntry *table_entry, IndexReader &index_reader, Scorer *scorer) const override;
+    void PrintTree(std::ostream &os, const std::string &prefix, bool is_final) const override;
+};
+
+// "prefix*", or-ed over the terms of the dictionaries starting with prefix
+// max_expansion: only the first max_expansion matching terms in lexicographical order are searched
+struct PrefixTermQueryNode final : public QueryNode {
+    std::string prefix_;
+    std::string column_;
+    unsigned max_expansion_{64};
+
+    PrefixTermQueryNode() : QueryNode(QueryNodeType::PREFIX_TERM) {}
+
+    void PushDownWeight(float factor) override { MultiplyWeight(factor); }
+    unsigned GetTermCount() const override { return max_expansion_; }
+    void GetHighlightTerms(std::map<std::string, std::vector<std::string>> &column_terms) const override {
+        column_terms[column_].push_back(prefix_);
+    }
     std::unique_ptr<DocIterator> CreateSearch(const TableEntry *table_entry, IndexReader &index_reader, Scorer *scorer) const override;
     std::unique_ptr<EarlyTerminateIterator>
     CreateEarlyTerminateSearch(const TableEntry *table_entry, IndexReader &index_reader, Scorer *scorer) const override;
@@ -113,6 +163,18 @@ struct MultiQueryNode : public QueryNode {
         }
         ResetWeight();
     }
+    unsigned GetTermCount() const final {
+        unsigned count = 0;
+        for (const auto &child : children_) {
+            count += child->GetTermCount();
+        }
+        return count;
+    }
+    void GetHighlightTerms(std::map<std::string, std::vector<std::string>> &column_terms) const override {
+        for (const auto &child : children_) {
+            child->GetHighlightTerms(column_terms);
+        }
+    }
     std::unique_ptr<QueryNode> GetNewOptimizedQueryTree();
     virtual std::unique_ptr<QueryNode> InnerGetNewOptimizedQueryTree() = 0;
     void PrintTree(std::ostream &os, const std::string &prefix, bool is_final) const final;
@@ -123,6 +185,8 @@ struct MultiQueryNode : public QueryNode {
 // otherwise, query statement is invalid
 struct NotQueryNode final : public MultiQueryNode {
     NotQueryNode() : MultiQueryNode(QueryNodeType::NOT) {}
+    // the excluded terms are not in the matched docs
+    void GetHighlightTerms(std::map<std::string, std::vector<std::string>> &) const override {}
     std::unique_ptr<QueryNode> InnerGetNewOptimizedQueryTree() override;
     std::unique_ptr<DocIterator> CreateSearch(const TableEntry *table_entry, IndexReader &index_reader, Scorer *scorer) const override;
     std::unique_ptr<EarlyTerminateIterator>
@@ -137,6 +201,10 @@ struct AndQueryNode final : public MultiQueryNode {
 };
 struct AndNotQueryNode final : public MultiQueryNode {
     AndNotQueryNode() : MultiQueryNode(QueryNodeType::AND_NOT) {}
+    // only the first child is matched, the others are excluded
+    void GetHighlightTerms(std::map<std::string, std::vector<std::string>> &column_terms) const override {
+        children_.front()->GetHighlightTerms(column_terms);
+    }
     std::unique_ptr<QueryNode> InnerGetNewOptimizedQueryTree() override;
     std::unique_ptr<DocIterator> CreateSearch(const TableEntry *table_entry, IndexReader &index_reader, Scorer *scorer) const override;
     std::unique_ptr<EarlyTerminateIterator>
@@ -149,11 +217,17 @@ struct OrQueryNode final : public MultiQueryNode {
     std::unique_ptr<EarlyTerminateIterator>
     CreateEarlyTerminateSearch(const TableEntry *table_entry, IndexReader &index_reader, Scorer *scorer) const override;
 };
+// "or" of no more than FULL_TEXT_WAND_MAX_CHILDREN children, searched by block max wand instead of block max maxscore
+// "WandQueryNode" does not exist in parser output, it is generated during optimization
+struct WandQueryNode final : public MultiQueryNode {
+    WandQueryNode() : MultiQueryNode(QueryNodeType::WAND) {}
+    std::unique_ptr<QueryNode> InnerGetNewOptimizedQueryTree() override;
+    std::unique_ptr<DocIterator> CreateSearch(const TableEntry *table_entry, IndexReader &index_reader, Scorer *scorer) const override;
+    std::unique_ptr<EarlyTerminateIterator>
+    CreateEarlyTerminateSearch(const TableEntry *table_entry, IndexReader &index_reader, Scorer *scorer) const override;
+};
 
 // unimplemented
-struct WandQueryNode;
-struct PhraseQueryNode;
-struct PrefixTermQueryNode;
 struct SuffixTermQueryNode;
 struct SubstringTermQueryNode;
 
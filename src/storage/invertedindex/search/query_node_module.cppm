@@ -25,16 +25,16 @@ export using infinity::QueryNodeTypeToString;
 
 export using infinity::QueryNode;
 export using infinity::TermQueryNode;
+export using infinity::PhraseQueryNode;
+export using infinity::PrefixTermQueryNode;
 export using infinity::MultiQueryNode;
 export using infinity::AndQueryNode;
 export using infinity::AndNotQueryNode;
 export using infinity::OrQueryNode;
 export using infinity::NotQueryNode;
+export using infinity::WandQueryNode;
 
 // unimplemented
-// export using infinity::WandQueryNode;
-// export using infinity::PhraseQueryNode;
-// export using infinity::PrefixTermQueryNode;
 // export using infinity::SuffixTermQueryNode;
 // export using infinity::SubstringTermQueryNode;
 
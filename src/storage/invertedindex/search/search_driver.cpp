@@ -12,7 +12,9 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <algorithm>
 #include <cassert>
+#include <cctype>
 #include <istream>
 #include <sstream>
 #include <utility>
@@ -23,6 +25,7 @@
 #include "search_scanner.h"
 
 import term;
+import sparse_analyzer;
 import infinity_exception;
 import status;
 
@@ -117,20 +120,36 @@ std::unique_ptr<QueryNode> SearchDriver::ParseSingle(const std::string &query, c
     return result;
 }
 
-std::unique_ptr<QueryNode> SearchDriver::AnalyzeAndBuildQueryNode(const std::string &field, std::string &&text) const {
+std::unique_ptr<QueryNode> SearchDriver::AnalyzeAndBuildQueryNode(const std::string &field, std::string &&text, bool phrase) const {
     if (text.empty()) {
         RecoverableError(Status::SyntaxError("Empty query text"));
         return nullptr;
     }
+    // "prefix*": expanded through the term dictionaries instead of being analyzed
+    if (text.size() > 1 && text.back() == '*' && text.find_first_of(" \t\r\n*") == text.size() - 1) {
+        text.pop_back();
+        if (auto it = field2analyzer_.find(field); it != field2analyzer_.end() && !it->second.empty()) {
+            // indexed terms are lower case
+            std::transform(text.begin(), text.end(), text.begin(), [](unsigned char c) { return std::tolower(c); });
+        }
+        auto result = std::make_unique<PrefixTermQueryNode>();
+        result->prefix_ = std::move(text);
+        result->column_ = field;
+        result->max_expansion_ = prefix_max_expansion_;
+        return result;
+    }
     TermList terms;
     // 1. analyze
     bool analyzed = false;
+    // sparse vector query: each term is weighted by its own weight
+    bool weighted = false;
     if (!field.empty()) {
         if (auto it = field2analyzer_.find(field); it != field2analyzer_.end()) {
             if (const std::string &analyzer_name = it->second; !analyzer_name.empty()) {
                 auto analyzer_func = reinterpret_cast<void (*)(const std::string &, std::string &&, TermList &)>(analyze_func_);
                 analyzer_func(analyzer_name, std::move(text), terms);
                 analyzed = true;
+                weighted = analyzer_name == SPARSE_ANALYZER;
             }
         }
     }
@@ -147,6 +166,18 @@ std::unique_ptr<QueryNode> SearchDriver::AnalyzeAndBuildQueryNode(const std::str
         auto result = std::make_unique<TermQueryNode>();
         result->term_ = std::move(terms.front().text_);
         result->column_ = field;
+        if (weighted) {
+            result->MultiplyWeight(DequantizeSparseWeight(terms.front().word_offset_));
+        }
+        return result;
+    } else if (phrase) {
+        auto result = std::make_unique<PhraseQueryNode>();
+        result->terms_.reserve(terms.size());
+        for (auto &term : terms) {
+            result->terms_.emplace_back(std::move(term.text_));
+        }
+        result->column_ = field;
+        result->slop_ = phrase_slop_;
         return result;
     } else {
         auto result = std::make_unique<OrQueryNode>();
@@ -154,6 +185,9 @@ std::unique_ptr<QueryNode> SearchDriver::AnalyzeAndBuildQueryNode(const std::str
             auto subquery = std::make_unique<TermQueryNode>();
             subquery->term_ = std::move(term.text_);
             subquery->column_ = field;
+            if (weighted) {
+                subquery->MultiplyWeight(DequantizeSparseWeight(term.word_offset_));
+            }
             result->Add(std::move(subquery));
         }
         return result;
@@ -38,11 +38,18 @@ public:
     [[nodiscard]] std::unique_ptr<QueryNode> ParseSingle(const std::string &query, const std::string *default_field_ptr = nullptr) const;
 
     // used in SearchParser in ParseSingle
-    [[nodiscard]] std::unique_ptr<QueryNode> AnalyzeAndBuildQueryNode(const std::string &field, std::string &&text) const;
+    // phrase: text is double quoted, analyzed terms must match in order
+    [[nodiscard]] std::unique_ptr<QueryNode> AnalyzeAndBuildQueryNode(const std::string &field, std::string &&text, bool phrase = false) const;
 
     // will be set in PhysicalMatch
     void (*analyze_func_)() = nullptr;
 
+    // slop of phrase queries, will be set in PhysicalMatch
+    unsigned phrase_slop_ = 0;
+
+    // max number of terms a "prefix*" query expands to, will be set in PhysicalMatch
+    unsigned prefix_max_expansion_ = 64;
+
     /**
      * parsing options
      */
@@ -46,6 +46,11 @@ public:
 
     float GetWeight() const { return weight_; }
 
+    bool HasPosition() const { return iter_->HasPosition(); }
+
+    // positions of the term in current doc
+    void GetPositions(Vector<pos_t> &positions) { iter_->GetCurrentDocPositions(positions); }
+
 private:
     u64 column_id_;
     UniquePtr<PostingIterator> iter_;
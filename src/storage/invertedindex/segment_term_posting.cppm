@@ -44,7 +44,13 @@ public:
 
 export class SegmentTermPostingQueue {
 public:
-    SegmentTermPostingQueue(const String &index_dir, const Vector<String> &base_names, const Vector<RowID> &base_rowids, optionflag_t flag);
+    // only the terms in [lower, upper) are merged, an empty bound is unbounded
+    SegmentTermPostingQueue(const String &index_dir,
+                            const Vector<String> &base_names,
+                            const Vector<RowID> &base_rowids,
+                            optionflag_t flag,
+                            const String &lower = String(),
+                            const String &upper = String());
 
     ~SegmentTermPostingQueue();
 
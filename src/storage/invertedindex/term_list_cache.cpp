@@ -0,0 +1,84 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+module;
+
+module term_list_cache;
+
+import stl;
+import term;
+
+namespace infinity {
+
+SharedPtr<const TermList> TermListCache::Get(const String &text) {
+    std::unique_lock lock(mutex_);
+    auto iter = entries_.find(text);
+    if (iter == entries_.end()) {
+        return nullptr;
+    }
+    lru_.splice(lru_.begin(), lru_, iter->second);
+    return iter->second->terms_;
+}
+
+void TermListCache::Put(const String &text, SharedPtr<const TermList> terms) {
+    SizeT entry_bytes = EntryBytes(text, *terms);
+    if (entry_bytes > capacity_) {
+        return;
+    }
+    std::unique_lock lock(mutex_);
+    if (auto iter = entries_.find(text); iter != entries_.end()) {
+        Entry &entry = *iter->second;
+        bytes_ = bytes_ - entry.bytes_ + entry_bytes;
+        entry.terms_ = std::move(terms);
+        entry.bytes_ = entry_bytes;
+        lru_.splice(lru_.begin(), lru_, iter->second);
+    } else {
+        lru_.push_front(Entry{text, std::move(terms), entry_bytes});
+        entries_.emplace(lru_.front().text_, lru_.begin());
+        bytes_ += entry_bytes;
+    }
+    while (bytes_ > capacity_) {
+        bytes_ -= lru_.back().bytes_;
+        entries_.erase(lru_.back().text_);
+        lru_.pop_back();
+    }
+}
+
+void TermListCache::Clear() {
+    std::unique_lock lock(mutex_);
+    entries_.clear();
+    lru_.clear();
+    bytes_ = 0;
+}
+
+SizeT TermListCache::size() {
+    std::unique_lock lock(mutex_);
+    return lru_.size();
+}
+
+SizeT TermListCache::bytes() {
+    std::unique_lock lock(mutex_);
+    return bytes_;
+}
+
+SizeT TermListCache::EntryBytes(const String &text, const TermList &terms) {
+    SizeT entry_bytes = sizeof(Entry) + text.size() + sizeof(TermList);
+    for (const Term &term : terms) {
+        entry_bytes += sizeof(Term) + term.text_.size();
+    }
+    return entry_bytes;
+}
+
+} // namespace infinity
@@ -0,0 +1,64 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+module;
+
+export module term_list_cache;
+
+import stl;
+import term;
+
+namespace infinity {
+
+// Analyzed terms of recently inverted texts of a full-text memory indexer, by the text.
+// UPDATE deletes a row and appends it again, so a text column that the update does not change would be analyzed once more
+// for the same terms. The inverters of such rows look the text up here first. The least recently used texts are evicted
+// once the entries take more than capacity bytes.
+export class TermListCache {
+public:
+    explicit TermListCache(SizeT capacity) : capacity_(capacity) {}
+
+    SharedPtr<const TermList> Get(const String &text);
+
+    // A text whose entry alone takes more than the capacity isn't kept.
+    void Put(const String &text, SharedPtr<const TermList> terms);
+
+    void Clear();
+
+    SizeT size();
+
+    SizeT bytes();
+
+    // the bytes an entry is charged for, the text and the terms with their texts
+    static SizeT EntryBytes(const String &text, const TermList &terms);
+
+private:
+    struct Entry {
+        String text_;
+        SharedPtr<const TermList> terms_;
+        SizeT bytes_;
+    };
+    using LruList = List<Entry>;
+
+    const SizeT capacity_;
+    std::mutex mutex_{};
+    // most recently used first
+    LruList lru_{};
+    // the keys are views of the texts in lru_
+    HashMap<std::string_view, LruList::iterator> entries_{};
+    SizeT bytes_{};
+};
+
+} // namespace infinity
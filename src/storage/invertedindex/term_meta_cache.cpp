@@ -0,0 +1,84 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+module term_meta_cache;
+
+import stl;
+import term_meta;
+import default_values;
+import internal_types;
+
+namespace infinity {
+
+TermMetaCache::TermMetaCache() : capacity_(TERM_META_CACHE_CAPACITY) {}
+
+String TermMetaCache::MakeKey(const String &posting_file, TxnTimeStamp commit_ts, const String &term) {
+    String key = posting_file;
+    key.append(1, '\0');
+    key.append(std::to_string(commit_ts));
+    key.append(1, '\0');
+    key.append(term);
+    return key;
+}
+
+bool TermMetaCache::Get(const String &key, TermMeta &term_meta) {
+    std::unique_lock lock(mutex_);
+    auto iter = entries_.find(key);
+    if (iter == entries_.end()) {
+        return false;
+    }
+    lru_.splice(lru_.begin(), lru_, iter->second);
+    const Entry &entry = iter->second->second;
+    term_meta = entry.term_meta_;
+    term_meta.doc_start_ = entry.doc_start_;
+    term_meta.pos_start_ = entry.pos_start_;
+    term_meta.pos_end_ = entry.pos_end_;
+    return true;
+}
+
+void TermMetaCache::Put(const String &key, const TermMeta &term_meta) {
+    std::unique_lock lock(mutex_);
+    if (auto iter = entries_.find(key); iter != entries_.end()) {
+        lru_.splice(lru_.begin(), lru_, iter->second);
+        return;
+    }
+    lru_.emplace_front(key, Entry{term_meta, term_meta.doc_start_, term_meta.pos_start_, term_meta.pos_end_});
+    entries_.emplace(key, lru_.begin());
+    while (lru_.size() > capacity_) {
+        entries_.erase(lru_.back().first);
+        lru_.pop_back();
+    }
+}
+
+void TermMetaCache::Erase(const HashSet<String> &posting_files) {
+    std::unique_lock lock(mutex_);
+    for (auto iter = lru_.begin(); iter != lru_.end();) {
+        const String &key = iter->first;
+        if (posting_files.contains(key.substr(0, key.find('\0')))) {
+            entries_.erase(key);
+            iter = lru_.erase(iter);
+        } else {
+            ++iter;
+        }
+    }
+}
+
+SizeT TermMetaCache::size() {
+    std::unique_lock lock(mutex_);
+    return lru_.size();
+}
+
+} // namespace infinity
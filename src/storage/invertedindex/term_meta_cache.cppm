@@ -0,0 +1,65 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module term_meta_cache;
+
+import stl;
+import singleton;
+import term_meta;
+import internal_types;
+
+namespace infinity {
+
+// The term metas of hot terms looked up in the dictionaries of the disk chunks, shared by all the sessions and bounded by the
+// entry count. The posting bytes are read from the mapped posting file, only the dictionary lookup is saved.
+// A chunk never changes once dumped, the key carries its commit ts so a chunk rebuilt under the same name is looked up again.
+// The entries of the chunks of a cleaned up segment index are erased.
+export class TermMetaCache : public Singleton<TermMetaCache> {
+public:
+    TermMetaCache();
+
+    explicit TermMetaCache(SizeT capacity) : capacity_(capacity) {}
+
+    static String MakeKey(const String &posting_file, TxnTimeStamp commit_ts, const String &term);
+
+    bool Get(const String &key, TermMeta &term_meta);
+
+    void Put(const String &key, const TermMeta &term_meta);
+
+    // Drop the entries of the chunks whose files are removed, in one pass over the cache.
+    void Erase(const HashSet<String> &posting_files);
+
+    SizeT size();
+
+private:
+    // the copy of TermMeta leaves the file offsets out, they are kept on their own
+    struct Entry {
+        TermMeta term_meta_{};
+        u64 doc_start_{};
+        u64 pos_start_{};
+        u64 pos_end_{};
+    };
+
+    using LruList = List<Pair<String, Entry>>;
+
+    const SizeT capacity_;
+    std::mutex mutex_{};
+    // most recently used first
+    LruList lru_{};
+    HashMap<String, LruList::iterator> entries_{};
+};
+
+} // namespace infinity
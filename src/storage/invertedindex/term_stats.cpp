@@ -0,0 +1,91 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+module;
+
+module term_stats;
+
+import stl;
+import index_defines;
+import dict_reader;
+import term_meta;
+import posting_list_format;
+import local_file_system;
+
+namespace infinity {
+
+void FullTextTermStats::Sync(const String &index_dir, const Vector<String> &base_names, optionflag_t flag) {
+    auto DictPath = [&](const String &base_name) { return (Path(index_dir) / base_name).string() + DICT_SUFFIX; };
+
+    std::unique_lock lock(mutex_);
+    HashSet<String> new_base_names(base_names.begin(), base_names.end());
+    Vector<String> removed_base_names;
+    for (const String &base_name : base_names_) {
+        if (!new_base_names.contains(base_name)) {
+            removed_base_names.push_back(base_name);
+        }
+    }
+    LocalFileSystem fs;
+    bool recount = false;
+    for (const String &base_name : removed_base_names) {
+        if (!fs.Exists(DictPath(base_name))) {
+            recount = true;
+            break;
+        }
+    }
+    if (recount) {
+        doc_freqs_.clear();
+        base_names_.clear();
+    } else {
+        for (const String &base_name : removed_base_names) {
+            CountChunk(DictPath(base_name), flag, true);
+            base_names_.erase(base_name);
+        }
+    }
+    for (const String &base_name : base_names) {
+        if (base_names_.insert(base_name).second) {
+            CountChunk(DictPath(base_name), flag, false);
+        }
+    }
+}
+
+u64 FullTextTermStats::GetDocFreq(const String &term) {
+    std::shared_lock lock(mutex_);
+    auto iter = doc_freqs_.find(term);
+    return iter == doc_freqs_.end() ? 0 : iter->second;
+}
+
+void FullTextTermStats::CountChunk(const String &dict_path, optionflag_t flag, bool remove) {
+    DictionaryReader dict_reader(dict_path, PostingFormatOption(flag));
+    dict_reader.InitRangeIterator("", "");
+    String term;
+    TermMeta term_meta;
+    while (dict_reader.Next(term, term_meta)) {
+        if (!remove) {
+            doc_freqs_[term] += term_meta.GetDocFreq();
+            continue;
+        }
+        auto iter = doc_freqs_.find(term);
+        if (iter == doc_freqs_.end()) {
+            continue;
+        }
+        iter->second -= std::min<u64>(iter->second, term_meta.GetDocFreq());
+        if (iter->second == 0) {
+            doc_freqs_.erase(iter);
+        }
+    }
+}
+
+} // namespace infinity
@@ -0,0 +1,46 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+module;
+
+export module term_stats;
+
+import stl;
+import index_defines;
+
+namespace infinity {
+
+// Doc freqs of the terms summed over the disk chunks of a full-text index, so that BM25 of a query term takes one lookup
+// instead of a dictionary lookup in every chunk.
+// The stats follow the chunks of the latest index reader: a new reader syncs them with its chunks, which scans the dictionaries
+// of the chunks added and removed since then. A query running on an older reader may see the doc freqs of newer chunks.
+export class FullTextTermStats {
+public:
+    // Makes the stats count exactly the chunks of base_names.
+    // If the files of a removed chunk are gone already, the stats are counted again from all chunks.
+    void Sync(const String &index_dir, const Vector<String> &base_names, optionflag_t flag);
+
+    u64 GetDocFreq(const String &term);
+
+private:
+    // add the doc freqs of a chunk to the stats, or subtract them when remove
+    void CountChunk(const String &dict_path, optionflag_t flag, bool remove);
+
+    std::shared_mutex mutex_{};
+    HashSet<String> base_names_{};
+    HashMap<String, u64> doc_freqs_{};
+};
+
+} // namespace infinity
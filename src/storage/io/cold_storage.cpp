@@ -0,0 +1,178 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+module;
+
+#include <filesystem>
+
+module cold_storage;
+
+import stl;
+import logger;
+import third_party;
+
+namespace infinity {
+
+namespace fs = std::filesystem;
+
+namespace {
+
+// copy to a temporary name first, so that a crash never leaves a partial file under the real name
+bool CopyFile(const String &src_path, const String &dst_path, const char *tmp_suffix) {
+    std::error_code ec;
+    fs::create_directories(Path(dst_path).parent_path(), ec);
+    String tmp_path = dst_path + tmp_suffix;
+    if (!ec) {
+        fs::copy_file(src_path, tmp_path, fs::copy_options::overwrite_existing, ec);
+    }
+    if (!ec) {
+        fs::rename(tmp_path, dst_path, ec);
+    }
+    if (ec) {
+        LOG_WARN(fmt::format("Copy {} to {} failed: {}", src_path, dst_path, ec.message()));
+        fs::remove(tmp_path, ec);
+        return false;
+    }
+    return true;
+}
+
+} // namespace
+
+ColdStorage::ColdStorage(String data_dir, String cold_dir, SizeT local_cache_size)
+    : data_dir_(std::move(data_dir)), cold_dir_(std::move(cold_dir)), local_cache_size_(local_cache_size) {}
+
+String ColdStorage::ColdPath(const String &local_path) const {
+    if (!local_path.starts_with(data_dir_)) {
+        return String();
+    }
+    return cold_dir_ + local_path.substr(data_dir_.size());
+}
+
+void ColdStorage::Upload(const String &local_path) {
+    {
+        std::unique_lock lock(mutex_);
+        if (lru_map_.contains(local_path) || !pending_uploads_.insert(local_path).second) {
+            return;
+        }
+    }
+    upload_pool_.push([this, local_path](int) { UploadInner(local_path); });
+}
+
+void ColdStorage::UploadInner(const String &local_path) {
+    String cold_path = ColdPath(local_path);
+    std::error_code ec;
+    SizeT file_size = fs::file_size(local_path, ec);
+    bool uploaded = false;
+    if (cold_path.empty()) {
+        LOG_WARN(fmt::format("{} is not in the data dir, not uploaded.", local_path));
+    } else if (ec) {
+        if (!fs::exists(cold_path)) {
+            LOG_WARN(fmt::format("Upload {} failed: {}", local_path, ec.message()));
+        }
+        // else it was uploaded and evicted before
+    } else {
+        // the same file may be uploaded before a restart
+        SizeT cold_file_size = fs::file_size(cold_path, ec);
+        uploaded = (!ec && cold_file_size == file_size) || CopyFile(local_path, cold_path, ".upload");
+    }
+
+    std::unique_lock lock(mutex_);
+    if (pending_uploads_.erase(local_path) == 0) {
+        // removed during the upload
+        if (uploaded) {
+            fs::remove(cold_path, ec);
+        }
+        return;
+    }
+    if (uploaded) {
+        CacheInner(local_path, file_size);
+        EvictInner();
+    }
+}
+
+bool ColdStorage::Fetch(const String &local_path) {
+    {
+        std::unique_lock lock(mutex_);
+        if (auto iter = lru_map_.find(local_path); iter != lru_map_.end()) {
+            lru_.splice(lru_.end(), lru_, iter->second);
+            return true;
+        }
+    }
+    if (fs::exists(local_path)) {
+        // not uploaded yet
+        return true;
+    }
+    String cold_path = ColdPath(local_path);
+    std::error_code ec;
+    SizeT file_size = cold_path.empty() ? 0 : fs::file_size(cold_path, ec);
+    if (cold_path.empty() || ec) {
+        return false;
+    }
+    // a file is fetched by the loader of its buffer obj only, no other thread fetches it at the same time
+    if (!CopyFile(cold_path, local_path, ".fetch")) {
+        return false;
+    }
+    LOG_TRACE(fmt::format("Fetched {} from the cold storage.", local_path));
+    std::unique_lock lock(mutex_);
+    CacheInner(local_path, file_size);
+    EvictInner();
+    return true;
+}
+
+void ColdStorage::Remove(const String &local_path) {
+    {
+        std::unique_lock lock(mutex_);
+        pending_uploads_.erase(local_path);
+        if (auto iter = lru_map_.find(local_path); iter != lru_map_.end()) {
+            local_size_ -= iter->second->second;
+            lru_.erase(iter->second);
+            lru_map_.erase(iter);
+        }
+    }
+    String cold_path = ColdPath(local_path);
+    if (!cold_path.empty()) {
+        std::error_code ec;
+        fs::remove(cold_path, ec);
+    }
+}
+
+void ColdStorage::WaitForUploads() { upload_pool_.push([](int) {}).wait(); }
+
+void ColdStorage::CacheInner(const String &local_path, SizeT file_size) {
+    if (auto iter = lru_map_.find(local_path); iter != lru_map_.end()) {
+        lru_.splice(lru_.end(), lru_, iter->second);
+        return;
+    }
+    lru_.emplace_back(local_path, file_size);
+    lru_map_.emplace(local_path, --lru_.end());
+    local_size_ += file_size;
+}
+
+void ColdStorage::EvictInner() {
+    // the most recent file is kept even if alone it exceeds the cache size, it is about to be read
+    while (local_size_ > local_cache_size_ && lru_.size() > 1) {
+        auto &[local_path, file_size] = lru_.front();
+        std::error_code ec;
+        fs::remove(local_path, ec);
+        if (ec) {
+            LOG_WARN(fmt::format("Evict {} failed: {}", local_path, ec.message()));
+        }
+        local_size_ -= file_size;
+        lru_map_.erase(local_path);
+        lru_.pop_front();
+    }
+}
+
+} // namespace infinity
@@ -0,0 +1,77 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+module;
+
+export module cold_storage;
+
+import stl;
+
+namespace infinity {
+
+// The tier below the local data dir: the files of sealed segments are copied to cold_dir, which is meant to be an
+// object store bucket mounted as a file system (mountpoint-s3, s3fs) or an NFS share, and then the local copies are
+// only a cache of at most local_cache_size bytes. A file evicted from the cache is copied back when it is read again.
+// The files are laid out under cold_dir as under data_dir.
+// Only files that are never rewritten may be uploaded, the local copy of an uploaded file may be deleted at any time.
+export class ColdStorage {
+public:
+    ColdStorage(String data_dir, String cold_dir, SizeT local_cache_size);
+
+    // Copy the file to the cold dir in the background, then add its local copy to the cache.
+    void Upload(const String &local_path);
+
+    // Make sure the local copy of the file exists, copy it back from the cold dir if it was evicted.
+    // Return false if there is neither a local nor a cold copy.
+    bool Fetch(const String &local_path);
+
+    // The file is deleted, delete its cold copy too.
+    void Remove(const String &local_path);
+
+    // Wait until the uploads requested so far are done.
+    void WaitForUploads();
+
+    SizeT local_cache_usage() const {
+        std::unique_lock lock(mutex_);
+        return local_size_;
+    }
+
+private:
+    String ColdPath(const String &local_path) const;
+
+    void UploadInner(const String &local_path);
+
+    // Touch a file in the cache, or add it.
+    void CacheInner(const String &local_path, SizeT file_size);
+
+    void EvictInner();
+
+    const String data_dir_;
+    const String cold_dir_;
+    const SizeT local_cache_size_;
+
+    mutable std::mutex mutex_{};
+    // the uploaded files which have a local copy, the least recently used first
+    List<Pair<String, SizeT>> lru_{};
+    HashMap<String, List<Pair<String, SizeT>>::iterator> lru_map_{};
+    SizeT local_size_{};
+    // the queued uploads, an upload is canceled by removing its file from here
+    HashSet<String> pending_uploads_{};
+
+    // one thread, so that the uploads are done in order. Declared last to finish the uploads before the rest is destroyed.
+    ThreadPool upload_pool_{1};
+};
+
+} // namespace infinity
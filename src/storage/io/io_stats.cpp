@@ -0,0 +1,180 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <algorithm>
+
+module io_stats;
+
+import stl;
+import engine_metrics;
+import third_party;
+
+namespace infinity {
+
+namespace {
+
+// 1us to 1s, a read from the page cache takes a few microseconds
+const Vector<u64> IO_DURATION_BOUNDS_US = {1, 2, 5, 10, 20, 50, 100, 200, 500, 1'000, 2'000, 5'000, 10'000, 20'000, 50'000, 100'000, 200'000,
+                                           500'000, 1'000'000};
+
+constexpr f64 MICROSECONDS_TO_SECONDS = 1e-6;
+
+const char *IODirectionName(IODirection direction) { return direction == IODirection::kRead ? "read" : "write"; }
+
+} // namespace
+
+String IOPurposeToString(IOPurpose purpose) {
+    switch (purpose) {
+        case IOPurpose::kQuery:
+            return "query";
+        case IOPurpose::kWal:
+            return "wal";
+        case IOPurpose::kCheckpoint:
+            return "checkpoint";
+        case IOPurpose::kCompaction:
+            return "compaction";
+        case IOPurpose::kIndexBuild:
+            return "index_build";
+        case IOPurpose::kOther:
+            return "other";
+    }
+    return "invalid";
+}
+
+TableIOStats::~TableIOStats() { IOStatsRegistry::instance().RemoveTableIOStats(this); }
+
+IOStatsInfo TableIOStats::Snapshot(IODirection direction) const {
+    const Counters &counters = counters_[static_cast<SizeT>(direction)];
+    IOStatsInfo info;
+    info.bytes_ = counters.bytes_.load(std::memory_order_relaxed);
+    info.ops_ = counters.ops_.load(std::memory_order_relaxed);
+    info.duration_us_ = counters.duration_us_.load(std::memory_order_relaxed);
+    return info;
+}
+
+IOContext &ThreadIOContext() {
+    thread_local IOContext context;
+    return context;
+}
+
+IOStatsRegistry &IOStatsRegistry::instance() {
+    static IOStatsRegistry registry;
+    return registry;
+}
+
+IOStatsRegistry::IOStatsRegistry() {
+    for (auto &direction_stats : purpose_stats_) {
+        for (auto &stats : direction_stats) {
+            stats.duration_us_ = MakeUnique<MetricHistogram>(IO_DURATION_BOUNDS_US);
+        }
+    }
+}
+
+void IOStatsRegistry::Record(IODirection direction, u64 bytes, u64 duration_us) {
+    const IOContext &context = ThreadIOContext();
+    PurposeStats &stats = purpose_stats_[static_cast<SizeT>(context.purpose_)][static_cast<SizeT>(direction)];
+    stats.bytes_.Add(bytes);
+    stats.ops_.Add();
+    stats.duration_us_->Observe(duration_us);
+    if (context.table_io_stats_ != nullptr) {
+        context.table_io_stats_->Record(direction, bytes, duration_us);
+    }
+}
+
+SharedPtr<TableIOStats> IOStatsRegistry::NewTableIOStats(String db_name, String table_name) {
+    auto table_io_stats = MakeShared<TableIOStats>(std::move(db_name), std::move(table_name));
+    std::unique_lock<std::mutex> lock(mutex_);
+    table_io_stats_.push_back(table_io_stats.get());
+    return table_io_stats;
+}
+
+void IOStatsRegistry::RemoveTableIOStats(const TableIOStats *table_io_stats) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    auto iter = std::find(table_io_stats_.begin(), table_io_stats_.end(), table_io_stats);
+    if (iter != table_io_stats_.end()) {
+        table_io_stats_.erase(iter);
+    }
+}
+
+IOStatsInfo IOStatsRegistry::PurposeSnapshot(IOPurpose purpose, IODirection direction) const {
+    const PurposeStats &stats = purpose_stats_[static_cast<SizeT>(purpose)][static_cast<SizeT>(direction)];
+    IOStatsInfo info;
+    info.bytes_ = stats.bytes_.Value();
+    info.ops_ = stats.ops_.Value();
+    Vector<u64> bucket_counts;
+    stats.duration_us_->Collect(bucket_counts, info.duration_us_);
+    return info;
+}
+
+void IOStatsRegistry::Write(MetricsWriter &writer) {
+    constexpr Array<IODirection, 2> directions = {IODirection::kRead, IODirection::kWrite};
+
+    writer.WriteHeader("infinity_io_bytes_total", "counter", "Bytes read and written by purpose.");
+    for (SizeT purpose_idx = 0; purpose_idx < IO_PURPOSE_COUNT; ++purpose_idx) {
+        for (IODirection direction : directions) {
+            String labels =
+                fmt::format("purpose=\"{}\",direction=\"{}\"", IOPurposeToString(static_cast<IOPurpose>(purpose_idx)), IODirectionName(direction));
+            writer.WriteSample("infinity_io_bytes_total", labels, purpose_stats_[purpose_idx][static_cast<SizeT>(direction)].bytes_.Value());
+        }
+    }
+    writer.WriteHeader("infinity_io_duration_seconds", "histogram", "Time of the reads and writes by purpose.");
+    for (SizeT purpose_idx = 0; purpose_idx < IO_PURPOSE_COUNT; ++purpose_idx) {
+        for (IODirection direction : directions) {
+            String labels =
+                fmt::format("purpose=\"{}\",direction=\"{}\"", IOPurposeToString(static_cast<IOPurpose>(purpose_idx)), IODirectionName(direction));
+            writer.WriteHistogram("infinity_io_duration_seconds",
+                                  labels,
+                                  *purpose_stats_[purpose_idx][static_cast<SizeT>(direction)].duration_us_,
+                                  MICROSECONDS_TO_SECONDS);
+        }
+    }
+
+    // The tables without io since the start are left out
+    Vector<Tuple<String, IOStatsInfo, IOStatsInfo>> tables;
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        for (const TableIOStats *table_io_stats : table_io_stats_) {
+            IOStatsInfo read_info = table_io_stats->Snapshot(IODirection::kRead);
+            IOStatsInfo write_info = table_io_stats->Snapshot(IODirection::kWrite);
+            if (read_info.ops_ == 0 && write_info.ops_ == 0) {
+                continue;
+            }
+            String labels = fmt::format("db=\"{}\",table=\"{}\"", table_io_stats->db_name(), table_io_stats->table_name());
+            tables.emplace_back(std::move(labels), read_info, write_info);
+        }
+    }
+    writer.WriteHeader("infinity_table_io_bytes_total", "counter", "Bytes read and written in the files of a table and its indexes.");
+    for (const auto &[labels, read_info, write_info] : tables) {
+        writer.WriteSample("infinity_table_io_bytes_total", labels + ",direction=\"read\"", read_info.bytes_);
+        writer.WriteSample("infinity_table_io_bytes_total", labels + ",direction=\"write\"", write_info.bytes_);
+    }
+    writer.WriteHeader("infinity_table_io_ops_total", "counter", "Reads and writes in the files of a table and its indexes.");
+    for (const auto &[labels, read_info, write_info] : tables) {
+        writer.WriteSample("infinity_table_io_ops_total", labels + ",direction=\"read\"", read_info.ops_);
+        writer.WriteSample("infinity_table_io_ops_total", labels + ",direction=\"write\"", write_info.ops_);
+    }
+    writer.WriteHeader("infinity_table_io_duration_seconds_total", "counter", "Time of the reads and writes of a table and its indexes.");
+    for (const auto &[labels, read_info, write_info] : tables) {
+        writer.WriteSample("infinity_table_io_duration_seconds_total",
+                           labels + ",direction=\"read\"",
+                           read_info.duration_us_ * MICROSECONDS_TO_SECONDS);
+        writer.WriteSample("infinity_table_io_duration_seconds_total",
+                           labels + ",direction=\"write\"",
+                           write_info.duration_us_ * MICROSECONDS_TO_SECONDS);
+    }
+}
+
+} // namespace infinity
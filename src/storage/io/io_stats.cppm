@@ -0,0 +1,152 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module io_stats;
+
+import stl;
+import engine_metrics;
+
+namespace infinity {
+
+// What the reads and writes of a thread are for. The background tasks and the statements set it, by default the io is
+// counted as other.
+export enum class IOPurpose : u8 {
+    kQuery,
+    kWal,
+    kCheckpoint,
+    kCompaction,
+    kIndexBuild,
+    kOther,
+};
+
+export constexpr SizeT IO_PURPOSE_COUNT = static_cast<SizeT>(IOPurpose::kOther) + 1;
+
+export String IOPurposeToString(IOPurpose purpose);
+
+export enum class IODirection : u8 {
+    kRead,
+    kWrite,
+};
+
+export struct IOStatsInfo {
+    u64 bytes_{0};
+    u64 ops_{0};
+    u64 duration_us_{0};
+};
+
+// The reads and writes of the files of a table and its indexes. The io of a table is much slower than an atomic add,
+// so the counters are not sharded.
+export class TableIOStats {
+public:
+    TableIOStats(String db_name, String table_name) : db_name_(std::move(db_name)), table_name_(std::move(table_name)) {}
+
+    // Removes the stats from the IOStatsRegistry
+    ~TableIOStats();
+
+    void Record(IODirection direction, u64 bytes, u64 duration_us) {
+        Counters &counters = counters_[static_cast<SizeT>(direction)];
+        counters.bytes_.fetch_add(bytes, std::memory_order_relaxed);
+        counters.ops_.fetch_add(1, std::memory_order_relaxed);
+        counters.duration_us_.fetch_add(duration_us, std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] IOStatsInfo Snapshot(IODirection direction) const;
+
+    [[nodiscard]] const String &db_name() const { return db_name_; }
+
+    [[nodiscard]] const String &table_name() const { return table_name_; }
+
+private:
+    struct Counters {
+        atomic_u64 bytes_{0};
+        atomic_u64 ops_{0};
+        atomic_u64 duration_us_{0};
+    };
+
+    const String db_name_;
+    const String table_name_;
+    Array<Counters, 2> counters_{};
+};
+
+// The purpose and the table the io of the current thread is counted for
+export struct IOContext {
+    IOPurpose purpose_{IOPurpose::kOther};
+    TableIOStats *table_io_stats_{nullptr};
+};
+
+export IOContext &ThreadIOContext();
+
+// Sets the purpose of the io of the thread until the end of the scope. A nested scope overrides it, e.g. an index build
+// inside a statement.
+export class IOPurposeScope {
+public:
+    explicit IOPurposeScope(IOPurpose purpose) : prev_purpose_(ThreadIOContext().purpose_) { ThreadIOContext().purpose_ = purpose; }
+
+    ~IOPurposeScope() { ThreadIOContext().purpose_ = prev_purpose_; }
+
+private:
+    IOPurpose prev_purpose_;
+};
+
+// Counts the io of the thread for a table until the end of the scope, nullptr for no table
+export class IOTableScope {
+public:
+    explicit IOTableScope(TableIOStats *table_io_stats) : prev_table_io_stats_(ThreadIOContext().table_io_stats_) {
+        ThreadIOContext().table_io_stats_ = table_io_stats;
+    }
+
+    ~IOTableScope() { ThreadIOContext().table_io_stats_ = prev_table_io_stats_; }
+
+private:
+    TableIOStats *prev_table_io_stats_;
+};
+
+// The io of the engine by purpose, and the tables having io stats
+export class IOStatsRegistry {
+public:
+    static IOStatsRegistry &instance();
+
+    // Called by LocalFileSystem for every read and write
+    void Record(IODirection direction, u64 bytes, u64 duration_us);
+
+    SharedPtr<TableIOStats> NewTableIOStats(String db_name, String table_name);
+
+    [[nodiscard]] IOStatsInfo PurposeSnapshot(IOPurpose purpose, IODirection direction) const;
+
+    void Write(MetricsWriter &writer);
+
+private:
+    IOStatsRegistry();
+
+    struct PurposeStats {
+        MetricCounter bytes_{};
+        MetricCounter ops_{};
+        UniquePtr<MetricHistogram> duration_us_{};
+    };
+
+    // [purpose][direction]
+    Array<Array<PurposeStats, 2>, IO_PURPOSE_COUNT> purpose_stats_{};
+
+    void RemoveTableIOStats(const TableIOStats *table_io_stats);
+
+    friend class TableIOStats;
+
+    std::mutex mutex_{};
+    // Owned by the table entries and the file workers of their files, removed when the last of them is freed
+    Vector<const TableIOStats *> table_io_stats_{};
+};
+
+} // namespace infinity
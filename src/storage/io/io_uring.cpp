@@ -0,0 +1,180 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+module;
+
+#include <cerrno>
+#include <cstring>
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+module io_uring;
+
+import stl;
+
+namespace infinity {
+
+namespace {
+
+void *MapRing(i32 ring_fd, SizeT size, u64 offset) {
+    void *ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd, offset);
+    return ptr == MAP_FAILED ? nullptr : ptr;
+}
+
+template <typename T>
+T *RingField(void *ring, u32 offset) {
+    return reinterpret_cast<T *>(static_cast<char *>(ring) + offset);
+}
+
+} // namespace
+
+IOUring::IOUring(u32 entries) {
+    io_uring_params params;
+    std::memset(&params, 0, sizeof(params));
+    i32 ring_fd = syscall(__NR_io_uring_setup, entries, &params);
+    if (ring_fd < 0) {
+        return;
+    }
+
+    sq_ring_size_ = params.sq_off.array + params.sq_entries * sizeof(u32);
+    cq_ring_size_ = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+    const bool single_mmap = params.features & IORING_FEAT_SINGLE_MMAP;
+    if (single_mmap) {
+        sq_ring_size_ = cq_ring_size_ = std::max(sq_ring_size_, cq_ring_size_);
+    }
+    sq_ring_ = MapRing(ring_fd, sq_ring_size_, IORING_OFF_SQ_RING);
+    if (sq_ring_ != nullptr) {
+        cq_ring_ = single_mmap ? sq_ring_ : MapRing(ring_fd, cq_ring_size_, IORING_OFF_CQ_RING);
+    }
+    sqes_size_ = params.sq_entries * sizeof(io_uring_sqe);
+    if (cq_ring_ != nullptr) {
+        sqes_ = MapRing(ring_fd, sqes_size_, IORING_OFF_SQES);
+    }
+    if (sqes_ == nullptr) {
+        if (cq_ring_ != nullptr && cq_ring_ != sq_ring_) {
+            munmap(cq_ring_, cq_ring_size_);
+        }
+        if (sq_ring_ != nullptr) {
+            munmap(sq_ring_, sq_ring_size_);
+        }
+        sq_ring_ = cq_ring_ = nullptr;
+        close(ring_fd);
+        return;
+    }
+
+    sq_head_ = RingField<u32>(sq_ring_, params.sq_off.head);
+    sq_tail_ = RingField<u32>(sq_ring_, params.sq_off.tail);
+    sq_mask_ = *RingField<u32>(sq_ring_, params.sq_off.ring_mask);
+    sq_array_ = RingField<u32>(sq_ring_, params.sq_off.array);
+    cq_head_ = RingField<u32>(cq_ring_, params.cq_off.head);
+    cq_tail_ = RingField<u32>(cq_ring_, params.cq_off.tail);
+    cq_mask_ = *RingField<u32>(cq_ring_, params.cq_off.ring_mask);
+    cqes_ = RingField<io_uring_cqe>(cq_ring_, params.cq_off.cqes);
+    entries_ = params.sq_entries;
+    ring_fd_ = ring_fd;
+}
+
+IOUring::~IOUring() {
+    if (ring_fd_ < 0) {
+        return;
+    }
+    munmap(sqes_, sqes_size_);
+    if (cq_ring_ != sq_ring_) {
+        munmap(cq_ring_, cq_ring_size_);
+    }
+    munmap(sq_ring_, sq_ring_size_);
+    close(ring_fd_);
+}
+
+void *IOUring::GetSqe(i32 fd, u64 user_data) {
+    // only this thread writes the tail, the kernel moves the head while consuming
+    u32 tail = *sq_tail_ + queued_;
+    if (tail - __atomic_load_n(sq_head_, __ATOMIC_ACQUIRE) >= entries_) {
+        return nullptr;
+    }
+    u32 index = tail & sq_mask_;
+    auto *sqe = static_cast<io_uring_sqe *>(sqes_) + index;
+    std::memset(sqe, 0, sizeof(io_uring_sqe));
+    sqe->fd = fd;
+    sqe->user_data = user_data;
+    sq_array_[index] = index;
+    ++queued_;
+    return sqe;
+}
+
+bool IOUring::PrepareFsync(i32 fd, u64 user_data) {
+    auto *sqe = static_cast<io_uring_sqe *>(GetSqe(fd, user_data));
+    if (sqe == nullptr) {
+        return false;
+    }
+    sqe->opcode = IORING_OP_FSYNC;
+    return true;
+}
+
+bool IOUring::PrepareWrite(i32 fd, const void *data, u32 nbytes, u64 offset, u64 user_data) {
+    auto *sqe = static_cast<io_uring_sqe *>(GetSqe(fd, user_data));
+    if (sqe == nullptr) {
+        return false;
+    }
+    sqe->opcode = IORING_OP_WRITE;
+    sqe->addr = reinterpret_cast<u64>(data);
+    sqe->len = nbytes;
+    sqe->off = offset;
+    return true;
+}
+
+bool IOUring::PrepareRead(i32 fd, void *data, u32 nbytes, u64 offset, u64 user_data) {
+    auto *sqe = static_cast<io_uring_sqe *>(GetSqe(fd, user_data));
+    if (sqe == nullptr) {
+        return false;
+    }
+    sqe->opcode = IORING_OP_READ;
+    sqe->addr = reinterpret_cast<u64>(data);
+    sqe->len = nbytes;
+    sqe->off = offset;
+    return true;
+}
+
+i32 IOUring::SubmitAndWait(Vector<i32> &results) {
+    u32 to_submit = queued_;
+    u32 to_complete = queued_;
+    __atomic_store_n(sq_tail_, *sq_tail_ + queued_, __ATOMIC_RELEASE);
+    queued_ = 0;
+    while (to_complete > 0) {
+        i32 ret = syscall(__NR_io_uring_enter, ring_fd_, to_submit, to_complete, IORING_ENTER_GETEVENTS, nullptr, 0);
+        if (ret < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return -errno;
+        }
+        to_submit -= std::min(to_submit, u32(ret));
+
+        u32 head = *cq_head_;
+        u32 tail = __atomic_load_n(cq_tail_, __ATOMIC_ACQUIRE);
+        for (; head != tail && to_complete > 0; ++head, --to_complete) {
+            const auto &cqe = static_cast<io_uring_cqe *>(cqes_)[head & cq_mask_];
+            if (cqe.user_data < results.size()) {
+                results[cqe.user_data] = cqe.res;
+            }
+        }
+        __atomic_store_n(cq_head_, head, __ATOMIC_RELEASE);
+    }
+    return 0;
+}
+
+} // namespace infinity
@@ -0,0 +1,77 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+module;
+
+export module io_uring;
+
+import stl;
+
+namespace infinity {
+
+// A minimal io_uring on the raw system calls: requests are queued, then submitted together and waited for, so that the
+// device sees many I/Os in flight from one thread instead of one blocking call at a time.
+// If the kernel refuses to set up a ring (too old, or forbidden by seccomp), Valid() is false and the caller does the
+// I/O with the plain calls.
+export class IOUring {
+public:
+    explicit IOUring(u32 entries);
+
+    ~IOUring();
+
+    IOUring(const IOUring &) = delete;
+    IOUring &operator=(const IOUring &) = delete;
+
+    bool Valid() const { return ring_fd_ >= 0; }
+
+    // Queue a request, return false if the submission queue is full.
+    // user_data is the index of its result in SubmitAndWait().
+    bool PrepareFsync(i32 fd, u64 user_data);
+
+    bool PrepareWrite(i32 fd, const void *data, u32 nbytes, u64 offset, u64 user_data);
+
+    bool PrepareRead(i32 fd, void *data, u32 nbytes, u64 offset, u64 user_data);
+
+    // Submit the queued requests and wait until all of them complete.
+    // results[user_data] is set to the result of each request: the byte count, or -errno.
+    // Return 0, or -errno if the ring itself fails.
+    i32 SubmitAndWait(Vector<i32> &results);
+
+private:
+    void *GetSqe(i32 fd, u64 user_data);
+
+    i32 ring_fd_{-1};
+    u32 entries_{};
+
+    void *sq_ring_{};
+    SizeT sq_ring_size_{};
+    void *cq_ring_{};
+    SizeT cq_ring_size_{};
+    void *sqes_{};
+    SizeT sqes_size_{};
+
+    u32 *sq_head_{};
+    u32 *sq_tail_{};
+    u32 sq_mask_{};
+    u32 *sq_array_{};
+    u32 *cq_head_{};
+    u32 *cq_tail_{};
+    u32 cq_mask_{};
+    void *cqes_{};
+
+    u32 queued_{}; // prepared but not submitted
+};
+
+} // namespace infinity
@@ -29,6 +29,8 @@ import infinity_exception;
 import third_party;
 import logger;
 import status;
+import io_uring;
+import io_stats;
 
 module local_file_system;
 
@@ -38,6 +40,8 @@ namespace fs = std::filesystem;
 
 constexpr std::size_t BUFFER_SIZE = 4096; // Adjust buffer size as needed
 
+constexpr u32 SYNC_FILES_QUEUE_DEPTH = 64;
+
 LocalFileHandler::~LocalFileHandler() {
     if (fd_ != -1) {
         int ret = close(fd_);
@@ -121,19 +125,23 @@ void LocalFileSystem::Rename(const String &old_path, const String &new_path) {
 
 i64 LocalFileSystem::Read(FileHandler &file_handler, void *data, u64 nbytes) {
     i32 fd = ((LocalFileHandler &)file_handler).fd_;
+    auto begin_time = Clock::now();
     i64 read_count = read(fd, data, nbytes);
     if (read_count == -1) {
         UnrecoverableError(fmt::format("Can't read file: {}: {}", file_handler.path_.string(), strerror(errno)));
     }
+    IOStatsRegistry::instance().Record(IODirection::kRead, read_count, ElapsedFromStart(Clock::now(), begin_time).count() / 1000);
     return read_count;
 }
 
 i64 LocalFileSystem::Write(FileHandler &file_handler, const void *data, u64 nbytes) {
     i32 fd = ((LocalFileHandler &)file_handler).fd_;
+    auto begin_time = Clock::now();
     i64 write_count = write(fd, data, nbytes);
     if (write_count == -1) {
         UnrecoverableError(fmt::format("Can't write file: {}: {}. fd: {}", file_handler.path_.string(), strerror(errno), fd));
     }
+    IOStatsRegistry::instance().Record(IODirection::kWrite, write_count, ElapsedFromStart(Clock::now(), begin_time).count() / 1000);
     return write_count;
 }
 
@@ -153,6 +161,23 @@ SizeT LocalFileSystem::GetFileSize(FileHandler &file_handler) {
     return s.st_size;
 }
 
+void LocalFileSystem::HardLink(const String &src_path, const String &dst_path) {
+    if (link(src_path.c_str(), dst_path.c_str()) != 0) {
+        UnrecoverableError(fmt::format("Can't link file: {} to {}, {}", src_path, dst_path, strerror(errno)));
+    }
+}
+
+bool LocalFileSystem::UnshareFile(const String &path) {
+    struct stat file_stat {};
+    if (stat(path.c_str(), &file_stat) != 0 || file_stat.st_nlink <= 1) {
+        return false;
+    }
+    if (unlink(path.c_str()) != 0) {
+        UnrecoverableError(fmt::format("Can't unlink file: {}, {}", path, strerror(errno)));
+    }
+    return true;
+}
+
 void LocalFileSystem::DeleteFile(const String &file_name) {
     std::error_code error_code;
     Path p{file_name};
@@ -173,6 +198,38 @@ void LocalFileSystem::SyncFile(FileHandler &file_handler) {
     }
 }
 
+void LocalFileSystem::SyncFiles(const Vector<UniquePtr<FileHandler>> &file_handlers) {
+    const SizeT file_count = file_handlers.size();
+    if (file_count > 1) {
+        IOUring ring(std::min(file_count, SizeT(SYNC_FILES_QUEUE_DEPTH)));
+        Vector<i32> results(file_count, 0);
+        i32 ring_error = ring.Valid() ? 0 : -ENOSYS;
+        for (SizeT i = 0; i < file_count && ring_error == 0; ++i) {
+            i32 fd = static_cast<LocalFileHandler *>(file_handlers[i].get())->fd_;
+            if (!ring.PrepareFsync(fd, i)) {
+                // the queue is full, wait for the queued ones first
+                ring_error = ring.SubmitAndWait(results);
+                ring.PrepareFsync(fd, i);
+            }
+        }
+        if (ring_error == 0) {
+            ring_error = ring.SubmitAndWait(results);
+        }
+        if (ring_error == 0) {
+            for (SizeT i = 0; i < file_count; ++i) {
+                if (results[i] != 0) {
+                    UnrecoverableError(fmt::format("fsync failed: {}, {}", file_handlers[i]->path_.string(), strerror(-results[i])));
+                }
+            }
+            return;
+        }
+        LOG_WARN(fmt::format("io_uring is not available: {}, sync the files one by one.", strerror(-ring_error)));
+    }
+    for (const auto &file_handler : file_handlers) {
+        SyncFile(*file_handler);
+    }
+}
+
 void LocalFileSystem::AppendFile(const String &dst_path, const String &src_path) {
     Path dst{dst_path};
     Path src{src_path};
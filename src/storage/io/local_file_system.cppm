@@ -54,6 +54,9 @@ public:
 
     void SyncFile(FileHandler &file_handler) final;
 
+    // fsync the files together: they are submitted to an io_uring at once instead of one blocking call per file
+    void SyncFiles(const Vector<UniquePtr<FileHandler>> &file_handlers);
+
     void Close(FileHandler &file_handler) final;
 
     void AppendFile(const String &dst_path, const String &src_path) final;
@@ -79,6 +82,12 @@ public:
     static u64 GetFolderSizeByPath(const String& path);
 
     static String ConcatenateFilePath(const String& dir_path, const String& file_path);
+
+    // The two paths share the data of the file, a writer unshares its path first so the other one is unchanged.
+    static void HardLink(const String &src_path, const String &dst_path);
+
+    // Remove the path if the file has other hard links, the next write of the path creates a new file. Returns true if removed.
+    static bool UnshareFile(const String &path);
 };
 
 } // namespace infinity
\ No newline at end of file
@@ -29,6 +29,8 @@ import knn_result_handler;
 import bitmask;
 import knn_expr;
 import internal_types;
+import mlas_matrix_multiply;
+import default_values;
 
 namespace infinity {
 
@@ -106,6 +108,9 @@ public:
                                                base_ivf->partition_num_,
                                                base_ivf->centroids_.data(),
                                                assign_centroid_ids.get());
+            if (SearchBatch(base_ivf, segment_id, assign_centroid_ids.get(), nullptr, 1, [](SegmentOffset) { return true; })) {
+                return;
+            }
             for (u64 i = 0; i < this->query_count_; i++) {
                 u32 selected_centroid = assign_centroid_ids[i];
                 u32 contain_nums = base_ivf->ids_[selected_centroid].size();
@@ -128,6 +133,9 @@ public:
                                   centroid_ids.get(),
                                   centroid_dists.get(),
                                   false);
+            if (SearchBatch(base_ivf, segment_id, centroid_ids.get(), centroid_dists.get(), n_probes, [](SegmentOffset) { return true; })) {
+                return;
+            }
             for (u64 i = 0; i < this->query_count_; i++) {
                 const DistType *x_i = queries_ + i * this->dimension_;
                 for (u32 k = 0; k < n_probes && centroid_dists[k + i * n_probes] != InvalidValue(); ++k) {
@@ -165,6 +173,9 @@ public:
                                                base_ivf->partition_num_,
                                                base_ivf->centroids_.data(),
                                                assign_centroid_ids.get());
+            if (SearchBatch(base_ivf, segment_id, assign_centroid_ids.get(), nullptr, 1, filter)) {
+                return;
+            }
             for (u64 i = 0; i < this->query_count_; i++) {
                 u32 selected_centroid = assign_centroid_ids[i];
                 u32 contain_nums = base_ivf->ids_[selected_centroid].size();
@@ -190,6 +201,9 @@ public:
                                   centroid_ids.get(),
                                   centroid_dists.get(),
                                   false);
+            if (SearchBatch(base_ivf, segment_id, centroid_ids.get(), centroid_dists.get(), n_probes, filter)) {
+                return;
+            }
             for (u64 i = 0; i < this->query_count_; i++) {
                 const DistType *x_i = queries_ + i * this->dimension_;
                 for (u32 k = 0; k < n_probes && centroid_dists[k + i * n_probes] != InvalidValue(); ++k) {
@@ -246,6 +260,84 @@ public:
 
     [[nodiscard]] static bool CompareDist(const DistType &a, const DistType &b) { return Compare::Compare(b, a); }
 
+private:
+    // A batch of queries scans the probed lists list by list: the queries probing a list are compared to its vectors with one gemm
+    // per tile, so a list is read once for the whole batch. Returns false when the batch is too small for it.
+    template <typename Filter>
+    bool SearchBatch(const AnnIVFFlatIndexData<DistType> *base_ivf,
+                     u32 segment_id,
+                     const u32 *centroid_ids,
+                     const DistType *centroid_dists,
+                     u32 n_probes,
+                     Filter &&filter) {
+        if constexpr (!std::is_same_v<DistType, f32>) {
+            return false;
+        } else {
+            if (this->query_count_ < DISTANCE_COMPUTE_BLAS_MIN_QUERY_COUNT) {
+                return false;
+            }
+            const u32 dimension = this->dimension_;
+            Vector<Vector<u32>> list_queries(base_ivf->partition_num_);
+            for (u64 i = 0; i < this->query_count_; ++i) {
+                for (u32 k = 0; k < n_probes; ++k) {
+                    if (centroid_dists != nullptr && centroid_dists[k + i * n_probes] == InvalidValue()) {
+                        break;
+                    }
+                    list_queries[centroid_ids[k + i * n_probes]].push_back(i);
+                }
+            }
+            const SizeT bs_y = DISTANCE_COMPUTE_BLAS_DATABASE_BS;
+            Vector<f32> list_query_vecs;
+            Vector<f32> query_norms;
+            Vector<f32> vector_norms(bs_y);
+            Vector<f32> ip_block;
+            for (u32 list_id = 0; list_id < base_ivf->partition_num_; ++list_id) {
+                const Vector<u32> &queries = list_queries[list_id];
+                const SizeT contain_nums = base_ivf->ids_[list_id].size();
+                if (queries.empty() || contain_nums == 0) {
+                    continue;
+                }
+                list_query_vecs.resize(queries.size() * dimension);
+                for (SizeT q = 0; q < queries.size(); ++q) {
+                    Copy(queries_ + queries[q] * dimension, queries_ + (queries[q] + 1) * dimension, list_query_vecs.data() + q * dimension);
+                }
+                if constexpr (metric == MetricType::kMetricL2) {
+                    query_norms.resize(queries.size());
+                    L2NormsSquares(query_norms.data(), list_query_vecs.data(), dimension, queries.size());
+                }
+                ip_block.resize(queries.size() * bs_y);
+                const f32 *vectors = base_ivf->vectors_[list_id].data();
+                for (SizeT j0 = 0; j0 < contain_nums; j0 += bs_y) {
+                    const SizeT j1 = std::min(j0 + bs_y, contain_nums);
+                    matrixA_multiply_transpose_matrixB_output_to_C(list_query_vecs.data(),
+                                                                   vectors + j0 * dimension,
+                                                                   queries.size(),
+                                                                   j1 - j0,
+                                                                   dimension,
+                                                                   ip_block.data());
+                    if constexpr (metric == MetricType::kMetricL2) {
+                        L2NormsSquares(vector_norms.data(), vectors + j0 * dimension, dimension, j1 - j0);
+                    }
+                    for (SizeT j = j0; j < j1; ++j) {
+                        const SegmentOffset segment_offset = base_ivf->ids_[list_id][j];
+                        if (!filter(segment_offset)) {
+                            continue;
+                        }
+                        for (SizeT q = 0; q < queries.size(); ++q) {
+                            f32 distance = ip_block[q * (j1 - j0) + j - j0];
+                            if constexpr (metric == MetricType::kMetricL2) {
+                                // negative values can occur for identical vectors due to roundoff errors
+                                distance = std::max(query_norms[q] + vector_norms[j - j0] - 2 * distance, 0.0f);
+                            }
+                            result_handler_->AddResult(queries[q], distance, RowID(segment_id, segment_offset));
+                        }
+                    }
+                }
+            }
+            return true;
+        }
+    }
+
 private:
     UniquePtr<RowID[]> id_array_{};
     UniquePtr<DistType[]> distance_array_{};
@@ -0,0 +1,317 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <algorithm>
+#include <queue>
+
+export module annivfpq_index_data;
+
+import stl;
+import index_base;
+import file_system;
+import search_top_k;
+import kmeans_partition;
+import vector_distance;
+import hnsw_simd_func;
+import default_values;
+import infinity_exception;
+import logger;
+import third_party;
+import status;
+
+namespace infinity {
+
+// IVF with product quantized residuals. A vector is assigned to its nearest centroid, and its residual to the centroid is split into
+// subspaces of subspace_dim_ dimensions (the last one may be shorter), each replaced by the id of its nearest codeword. A query
+// builds a table of its subspace distances to the codewords for each list it probes, so its distance to a stored vector is a sum
+// of table lookups.
+export struct AnnIVFPQIndexData {
+    static_assert(PQ_CENTROID_NUM == 256, "PQ code is one byte");
+    using CodeType = u8;
+
+    bool loaded_{false};
+    MetricType metric_{MetricType::kInvalid};
+    u32 dimension_{};
+    u32 partition_num_{};
+    u32 subspace_dim_{};
+    u32 subspace_num_{};
+    u32 data_num_{};
+    Vector<f32> centroids_;
+    // the codewords of subspace i are in front of those of subspace i + 1
+    Vector<f32> codebook_;
+    Vector<Vector<SegmentOffset>> ids_;
+    // subspace_num_ codes per vector
+    Vector<Vector<CodeType>> codes_;
+
+    AnnIVFPQIndexData() = default;
+    AnnIVFPQIndexData(MetricType metric, u32 dimension, u32 partition_num, u32 subspace_dim)
+        : metric_(metric), dimension_(dimension), partition_num_(partition_num), subspace_dim_(subspace_dim),
+          subspace_num_((dimension + subspace_dim - 1) / subspace_dim) {}
+
+    u32 SubBegin(u32 sub_i) const { return sub_i * subspace_dim_; }
+
+    u32 SubLen(u32 sub_i) const { return std::min(subspace_dim_, dimension_ - SubBegin(sub_i)); }
+
+    const f32 *Codewords(u32 sub_i) const { return codebook_.data() + PQ_CENTROID_NUM * SubBegin(sub_i); }
+
+    // use iter for both training and insert
+    // used when create index for a segment
+    void BuildIndex(auto &&iter,
+                    const u32 dimension,
+                    const u32 full_row_count,
+                    const u32 min_points_per_centroid = 32,
+                    const u32 max_points_per_centroid = 256) {
+        if (loaded_) {
+            UnrecoverableError("AnnIVFPQIndexData::BuildIndex(): Index data already exists.");
+        }
+        if (dimension != dimension_) {
+            UnrecoverableError("Dimension not match");
+        }
+        if (metric_ != MetricType::kMetricL2 && metric_ != MetricType::kMetricInnerProduct) {
+            RecoverableError(Status::NotSupport("Metric type not supported"));
+            return;
+        }
+
+        // step 1. load input data
+        Vector<f32> segment_column_data;
+        segment_column_data.reserve(SizeT(full_row_count) * dimension);
+        Vector<SegmentOffset> segment_offset;
+        segment_offset.reserve(full_row_count);
+        u32 cnt = 0;
+        while (true) {
+            auto pair_opt = iter.Next();
+            if (!pair_opt) {
+                break;
+            }
+            if (cnt >= full_row_count) {
+                UnrecoverableError("AnnIVFPQIndexData::BuildIndex(): segment row count more than expected");
+            }
+            auto &[val_ptr, offset] = pair_opt.value();
+            segment_column_data.insert(segment_column_data.end(), val_ptr, val_ptr + dimension);
+            segment_offset.push_back(offset);
+            ++cnt;
+        }
+        if (cnt == 0) {
+            loaded_ = true;
+            return;
+        }
+
+        // step 2. train centroids and assign the vectors to them
+        partition_num_ = GetKMeansCentroids<f32>(metric_,
+                                                 dimension_,
+                                                 cnt,
+                                                 segment_column_data.data(),
+                                                 centroids_,
+                                                 std::min(partition_num_, cnt),
+                                                 0,
+                                                 min_points_per_centroid,
+                                                 max_points_per_centroid);
+        Vector<u32> assigned_partition_id(cnt);
+        search_top_1_without_dis<f32>(dimension_, cnt, segment_column_data.data(), partition_num_, centroids_.data(), assigned_partition_id.data());
+
+        // step 3. replace the vectors by their residuals, train the codebook of every subspace on them and encode them
+        for (u32 i = 0; i < cnt; ++i) {
+            f32 *vec = segment_column_data.data() + SizeT(i) * dimension_;
+            const f32 *centroid = centroids_.data() + SizeT(assigned_partition_id[i]) * dimension_;
+            for (u32 j = 0; j < dimension_; ++j) {
+                vec[j] -= centroid[j];
+            }
+        }
+        Vector<CodeType> codes(SizeT(cnt) * subspace_num_);
+        TrainAndEncode(cnt, segment_column_data.data(), codes.data());
+
+        // step 4. insert codes to partitions
+        Vector<u32> partition_element_count(partition_num_);
+        for (u32 i = 0; i < cnt; ++i) {
+            ++partition_element_count[assigned_partition_id[i]];
+        }
+        ids_.resize(partition_num_);
+        codes_.resize(partition_num_);
+        for (u32 i = 0; i < partition_num_; ++i) {
+            ids_[i].reserve(partition_element_count[i]);
+            codes_[i].reserve(SizeT(partition_element_count[i]) * subspace_num_);
+        }
+        for (u32 i = 0; i < cnt; ++i) {
+            u32 partition_of_i = assigned_partition_id[i];
+            const CodeType *code_i = codes.data() + SizeT(i) * subspace_num_;
+            codes_[partition_of_i].insert(codes_[partition_of_i].end(), code_i, code_i + subspace_num_);
+            ids_[partition_of_i].push_back(segment_offset[i]);
+        }
+        data_num_ = cnt;
+        loaded_ = true;
+    }
+
+    // The k nearest vectors of the n_probes lists nearest to the query, in ascending distance. The distances follow the hnsw
+    // convention: squared l2, negative inner product.
+    template <typename Filter>
+    Vector<Pair<f32, SegmentOffset>> Search(const f32 *query, u32 n_probes, SizeT k, const Filter &filter) const {
+        Vector<Pair<f32, SegmentOffset>> result;
+        if (data_num_ == 0 || k == 0) {
+            return result;
+        }
+        n_probes = std::clamp(n_probes, 1u, partition_num_);
+        auto probe_distances = MakeUniqueForOverwrite<f32[]>(n_probes);
+        auto probe_ids = MakeUniqueForOverwrite<u32[]>(n_probes);
+        search_top_k_with_dis(n_probes, dimension_, 1, query, partition_num_, centroids_.data(), probe_ids.get(), probe_distances.get(), false);
+
+        static const F32PQTableSumFuncType table_sum = GetF32PQTableSumFunc();
+        const bool inner_product = metric_ == MetricType::kMetricInnerProduct;
+        Vector<f32> table(SizeT(subspace_num_) * PQ_CENTROID_NUM);
+        Vector<f32> residual(dimension_);
+        if (inner_product) {
+            // <q, c + r> = <q, c> + sum of <q, r> over the subspaces, the table doesn't depend on the list
+            BuildTable(query, true, table.data());
+        }
+        // max heap of the k nearest so far
+        std::priority_queue<Pair<f32, SegmentOffset>> heap;
+        for (u32 probe = 0; probe < n_probes; ++probe) {
+            const u32 list = probe_ids[probe];
+            if (list >= partition_num_) {
+                continue;
+            }
+            const f32 *centroid = centroids_.data() + SizeT(list) * dimension_;
+            f32 list_distance = 0;
+            if (inner_product) {
+                list_distance = -IPDistance<f32>(query, centroid, dimension_);
+            } else {
+                for (u32 j = 0; j < dimension_; ++j) {
+                    residual[j] = query[j] - centroid[j];
+                }
+                BuildTable(residual.data(), false, table.data());
+            }
+            const auto &ids = ids_[list];
+            const CodeType *codes = codes_[list].data();
+            for (SizeT j = 0; j < ids.size(); ++j) {
+                if (!filter(ids[j])) {
+                    continue;
+                }
+                f32 distance = list_distance + table_sum(table.data(), codes + j * subspace_num_, subspace_num_);
+                if (heap.size() < k) {
+                    heap.emplace(distance, ids[j]);
+                } else if (distance < heap.top().first) {
+                    heap.pop();
+                    heap.emplace(distance, ids[j]);
+                }
+            }
+        }
+        result.resize(heap.size());
+        for (SizeT i = heap.size(); i > 0; --i) {
+            result[i - 1] = heap.top();
+            heap.pop();
+        }
+        return result;
+    }
+
+    void SaveIndexInner(FileHandler &file_handler) const {
+        if (!loaded_) {
+            UnrecoverableError("AnnIVFPQIndexData::SaveIndexInner(): Index data not loaded.");
+        }
+        file_handler.Write(&metric_, sizeof(metric_));
+        file_handler.Write(&dimension_, sizeof(dimension_));
+        file_handler.Write(&partition_num_, sizeof(partition_num_));
+        file_handler.Write(&subspace_dim_, sizeof(subspace_dim_));
+        file_handler.Write(&data_num_, sizeof(data_num_));
+        if (data_num_ == 0) {
+            return;
+        }
+        file_handler.Write(centroids_.data(), sizeof(f32) * dimension_ * partition_num_);
+        file_handler.Write(codebook_.data(), sizeof(f32) * PQ_CENTROID_NUM * dimension_);
+        for (u32 i = 0; i < partition_num_; ++i) {
+            u32 vector_element_num = ids_[i].size();
+            file_handler.Write(&vector_element_num, sizeof(vector_element_num));
+            file_handler.Write(ids_[i].data(), sizeof(SegmentOffset) * vector_element_num);
+            file_handler.Write(codes_[i].data(), sizeof(CodeType) * subspace_num_ * vector_element_num);
+        }
+    }
+
+    void ReadIndexInner(FileHandler &file_handler) {
+        file_handler.Read(&metric_, sizeof(metric_));
+        file_handler.Read(&dimension_, sizeof(dimension_));
+        file_handler.Read(&partition_num_, sizeof(partition_num_));
+        file_handler.Read(&subspace_dim_, sizeof(subspace_dim_));
+        file_handler.Read(&data_num_, sizeof(data_num_));
+        subspace_num_ = (dimension_ + subspace_dim_ - 1) / subspace_dim_;
+        loaded_ = true;
+        if (data_num_ == 0) {
+            return;
+        }
+        centroids_.resize(dimension_ * partition_num_);
+        file_handler.Read(centroids_.data(), sizeof(f32) * dimension_ * partition_num_);
+        codebook_.resize(PQ_CENTROID_NUM * dimension_);
+        file_handler.Read(codebook_.data(), sizeof(f32) * PQ_CENTROID_NUM * dimension_);
+        ids_.resize(partition_num_);
+        codes_.resize(partition_num_);
+        for (u32 i = 0; i < partition_num_; ++i) {
+            u32 vector_element_num;
+            file_handler.Read(&vector_element_num, sizeof(vector_element_num));
+            ids_[i].resize(vector_element_num);
+            file_handler.Read(ids_[i].data(), sizeof(SegmentOffset) * vector_element_num);
+            codes_[i].resize(SizeT(subspace_num_) * vector_element_num);
+            file_handler.Read(codes_[i].data(), sizeof(CodeType) * subspace_num_ * vector_element_num);
+        }
+    }
+
+private:
+    void TrainAndEncode(const u32 vector_count, const f32 *residuals, CodeType *codes) {
+        codebook_.assign(PQ_CENTROID_NUM * dimension_, 0);
+        const u32 codeword_num = std::min<u32>(PQ_CENTROID_NUM, vector_count);
+        Vector<f32> sub_residuals(SizeT(vector_count) * subspace_dim_);
+        Vector<f32> codewords;
+        Vector<u32> nearest(vector_count);
+        for (u32 sub_i = 0; sub_i < subspace_num_; ++sub_i) {
+            const u32 begin = SubBegin(sub_i);
+            const u32 len = SubLen(sub_i);
+            for (u32 i = 0; i < vector_count; ++i) {
+                const f32 *sub_vec = residuals + SizeT(i) * dimension_ + begin;
+                std::copy(sub_vec, sub_vec + len, sub_residuals.data() + SizeT(i) * len);
+            }
+            u32 trained_num = GetKMeansCentroids<f32>(MetricType::kMetricL2,
+                                                      len,
+                                                      vector_count,
+                                                      sub_residuals.data(),
+                                                      codewords,
+                                                      codeword_num,
+                                                      PQ_KMEANS_ITER,
+                                                      1,
+                                                      std::max<u32>(1, PQ_TRAIN_SAMPLE_NUM / codeword_num));
+            // with fewer vectors than codewords, the codewords repeat, so the nearest one is always a trained one
+            f32 *sub_codebook = codebook_.data() + PQ_CENTROID_NUM * begin;
+            for (u32 c = 0; c < PQ_CENTROID_NUM; ++c) {
+                std::copy_n(codewords.data() + SizeT(c % trained_num) * len, len, sub_codebook + SizeT(c) * len);
+            }
+            search_top_1_without_dis<f32>(len, vector_count, sub_residuals.data(), PQ_CENTROID_NUM, sub_codebook, nearest.data());
+            for (u32 i = 0; i < vector_count; ++i) {
+                codes[SizeT(i) * subspace_num_ + sub_i] = nearest[i];
+            }
+        }
+    }
+
+    // table[sub_i * PQ_CENTROID_NUM + c]: the squared l2 distance, or the negative inner product, of the subspace sub_i of vec and its
+    // codeword c
+    void BuildTable(const f32 *vec, bool inner_product, f32 *table) const {
+        for (u32 sub_i = 0; sub_i < subspace_num_; ++sub_i) {
+            const u32 len = SubLen(sub_i);
+            const f32 *sub_vec = vec + SubBegin(sub_i);
+            const f32 *codewords = Codewords(sub_i);
+            for (u32 c = 0; c < PQ_CENTROID_NUM; ++c) {
+                table[sub_i * PQ_CENTROID_NUM + c] =
+                    inner_product ? -IPDistance<f32>(sub_vec, codewords + c * len, len) : L2Distance<f32>(sub_vec, codewords + c * len, len);
+            }
+        }
+    }
+};
+
+} // namespace infinity
@@ -62,6 +62,97 @@ inline void NormalizeCentroids(u32 dimension, u32 partition_num, CentroidType *c
     }
 }
 
+// A task of the training takes at least this many rows, fewer aren't worth a thread.
+constexpr u32 kmeans_min_rows_per_task = 4096;
+
+inline u32 KMeansThreadNum(u32 row_count) {
+    u32 cpu_n = std::max(Thread::hardware_concurrency(), 1u);
+    return std::clamp(row_count / kmeans_min_rows_per_task, 1u, cpu_n);
+}
+
+// Run func(begin, end) over [0, n) split into one contiguous range per thread of the pool, or inline without a pool.
+// A range holds at least min_range_size items.
+template <typename Func>
+void KMeansParallelFor(ThreadPool *pool, u32 n, Func &&func, u32 min_range_size = kmeans_min_rows_per_task) {
+    min_range_size = std::max(min_range_size, 1u);
+    if (pool == nullptr || n < 2 * min_range_size) {
+        func(0u, n);
+        return;
+    }
+    u32 task_n = std::min(static_cast<u32>(pool->size()), n / min_range_size);
+    u32 range = (n + task_n - 1) / task_n;
+    Vector<Future<void>> futures;
+    futures.reserve(task_n);
+    for (u32 begin = 0; begin < n; begin += range) {
+        u32 end = std::min(n, begin + range);
+        futures.push_back(pool->push([&func, begin, end](int) { func(begin, end); }));
+    }
+    for (auto &future : futures) {
+        future.get();
+    }
+}
+
+// k-means++ seeding: each next centroid is a training vector drawn with probability proportional to its squared distance to the
+// nearest centroid chosen so far. Lloyd iterations from these seeds converge in far fewer passes than from random vectors.
+template <typename CentroidsType, typename ElemType>
+void KMeansPlusPlusInit(ThreadPool *pool,
+                        const u32 dimension,
+                        const u32 training_data_num,
+                        const ElemType *training_data,
+                        const u32 partition_num,
+                        CentroidsType *centroids) {
+    std::mt19937 gen(std::random_device{}());
+    auto copy_centroid = [&](u32 centroid_id, u32 vector_id) {
+        for (u32 j = 0; j < dimension; ++j) {
+            centroids[centroid_id * dimension + j] = training_data[vector_id * dimension + j];
+        }
+    };
+    copy_centroid(0, std::uniform_int_distribution<u32>(0, training_data_num - 1)(gen));
+    Vector<f32> min_distance(training_data_num, std::numeric_limits<f32>::max());
+    // the distances are summed per block of rows, so the draw scans the block sums and then a single block
+    constexpr u32 block_size = kmeans_min_rows_per_task;
+    const u32 block_n = (training_data_num + block_size - 1) / block_size;
+    Vector<f64> block_distance_sum(block_n);
+    for (u32 c = 1; c < partition_num; ++c) {
+        const CentroidsType *last_centroid = centroids + (c - 1) * dimension;
+        KMeansParallelFor(
+            pool,
+            block_n,
+            [&](u32 block_begin, u32 block_end) {
+                for (u32 block_id = block_begin; block_id < block_end; ++block_id) {
+                    f64 sum = 0;
+                    for (u32 i = block_id * block_size; i < std::min(training_data_num, (block_id + 1) * block_size); ++i) {
+                        f32 distance = L2Distance<f32>(training_data + i * dimension, last_centroid, dimension);
+                        min_distance[i] = std::min(min_distance[i], distance);
+                        sum += min_distance[i];
+                    }
+                    block_distance_sum[block_id] = sum;
+                }
+            },
+            1);
+        f64 distance_sum = std::reduce(block_distance_sum.begin(), block_distance_sum.end());
+        u32 chosen = 0;
+        if (distance_sum > 0) {
+            f64 target = std::uniform_real_distribution<f64>(0, distance_sum)(gen);
+            u32 block_id = 0;
+            for (; block_id + 1 < block_n && target >= block_distance_sum[block_id]; ++block_id) {
+                target -= block_distance_sum[block_id];
+            }
+            chosen = block_id * block_size;
+            for (; chosen + 1 < std::min(training_data_num, (block_id + 1) * block_size); ++chosen) {
+                target -= min_distance[chosen];
+                if (target < 0) {
+                    break;
+                }
+            }
+        } else {
+            // every vector sits on a centroid already
+            chosen = std::uniform_int_distribution<u32>(0, training_data_num - 1)(gen);
+        }
+        copy_centroid(c, chosen);
+    }
+}
+
 // CentroidsType: the type to calculate centroids
 // partition_num: the number of partitions, default to sqrt(vector_count)
 // iteration_max: the max iteration count, default to 10
@@ -134,32 +225,15 @@ export template <typename CentroidsType, typename ElemType, typename CentroidsOu
         }
     }
 
+    // The assignment and update steps, and the seeding, split the training vectors over a pool of threads.
+    UniquePtr<ThreadPool> pool;
+    if (u32 thread_n = KMeansThreadNum(training_data_num); thread_n > 1) {
+        pool = MakeUnique<ThreadPool>(thread_n);
+    }
+
     // Initializing centroids
     {
-        // If training vectors are randomly chosen, centroids can be copied from training data.
-        // Otherwise, centroids need to be randomly generated.
-        if (random_training_data_destructor) {
-            if constexpr (std::is_same_v<ElemType, CentroidsType>) {
-                memcpy(centroids, training_data, sizeof(ElemType) * partition_num * dimension);
-            } else {
-                for (u32 i = 0; i < partition_num * dimension; ++i) {
-                    centroids[i] = training_data[i];
-                }
-            }
-        } else {
-            Vector<u32> random_ids = RandomPermutatePartially(training_data_num, partition_num);
-            if constexpr (std::is_same_v<ElemType, CentroidsType>) {
-                for (u32 i = 0; i < partition_num; ++i) {
-                    memcpy(centroids + i * dimension, training_data + random_ids[i] * dimension, sizeof(ElemType) * dimension);
-                }
-            } else {
-                for (u32 i = 0; i < partition_num; ++i) {
-                    for (u32 j = 0; j < dimension; ++j) {
-                        centroids[i * dimension + j] = training_data[random_ids[i] * dimension + j];
-                    }
-                }
-            }
-        }
+        KMeansPlusPlusInit(pool.get(), dimension, training_data_num, training_data, partition_num, centroids);
         // normalize centroids if inner product metric is used
         if (metric == MetricType::kMetricInnerProduct) {
             NormalizeCentroids(dimension, partition_num, centroids);
@@ -181,14 +255,16 @@ export template <typename CentroidsType, typename ElemType, typename CentroidsOu
         f32 this_iter_distance = 0;
         // First : assign each training vector to a partition
         {
-            // search top 1
-            search_top_1_with_dis(dimension,
-                                  training_data_num,
-                                  training_data,
-                                  partition_num,
-                                  centroids,
-                                  training_data_partition_id.data(),
-                                  partition_element_distance.data());
+            // search top 1, each task on its own range of the training vectors
+            KMeansParallelFor(pool.get(), training_data_num, [&](u32 begin, u32 end) {
+                search_top_1_with_dis(dimension,
+                                      end - begin,
+                                      training_data + begin * dimension,
+                                      partition_num,
+                                      centroids,
+                                      training_data_partition_id.data() + begin,
+                                      partition_element_distance.data() + begin);
+            });
             // Clear partition_element_count
             memset(partition_element_count.data(), 0, sizeof(u32) * partition_num);
             // calculate partition_element_count
@@ -200,16 +276,36 @@ export template <typename CentroidsType, typename ElemType, typename CentroidsOu
         }
         // Second : update centroids
         {
-            // Clear old centroids data
-            memset(centroids, 0, sizeof(CentroidsType) * partition_num * dimension);
-            // Sum
-            for (u32 i = 0; i < training_data_num; ++i) {
-                auto vector_pos_i = training_data + i * dimension;
-                auto centroid_pos_i = centroids + training_data_partition_id[i] * dimension;
-                for (u32 j = 0; j < dimension; ++j) {
-                    centroid_pos_i[j] += vector_pos_i[j];
+            // Group the training vectors by partition, so that each task sums the vectors of its own range of partitions
+            Vector<u32> partition_begin(partition_num + 1);
+            for (u32 i = 0; i < partition_num; ++i) {
+                partition_begin[i + 1] = partition_begin[i] + partition_element_count[i];
+            }
+            Vector<u32> partition_vector_ids(training_data_num);
+            {
+                Vector<u32> fill_pos(partition_begin.begin(), partition_begin.end() - 1);
+                for (u32 i = 0; i < training_data_num; ++i) {
+                    partition_vector_ids[fill_pos[training_data_partition_id[i]]++] = i;
                 }
             }
+            // Clear old centroids data and sum
+            const u32 min_partitions_per_task = static_cast<u64>(kmeans_min_rows_per_task) * partition_num / training_data_num;
+            KMeansParallelFor(
+                pool.get(),
+                partition_num,
+                [&](u32 partition_begin_id, u32 partition_end_id) {
+                    for (u32 p = partition_begin_id; p < partition_end_id; ++p) {
+                        auto centroid_pos = centroids + p * dimension;
+                        memset(centroid_pos, 0, sizeof(CentroidsType) * dimension);
+                        for (u32 k = partition_begin[p]; k < partition_begin[p + 1]; ++k) {
+                            auto vector_pos = training_data + partition_vector_ids[k] * dimension;
+                            for (u32 j = 0; j < dimension; ++j) {
+                                centroid_pos[j] += vector_pos[j];
+                            }
+                        }
+                    }
+                },
+                min_partitions_per_task);
             // For L2 metric, divide the count. If there is no vector in a partition, the centroid of this partition will not be updated.
             // For IP metric, normalize centroids.
             if (metric == MetricType::kMetricL2) {
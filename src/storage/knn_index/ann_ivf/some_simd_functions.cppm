@@ -14,8 +14,6 @@
 
 module;
 
-#include <immintrin.h>
-
 export module some_simd_functions;
 
 import stl;
@@ -23,109 +21,22 @@ import hnsw_simd_func;
 
 namespace infinity {
 
-#if defined(__AVX2__)
-
-// x = ( x7, x6, x5, x4, x3, x2, x1, x0 )
-float calc_256_sum_8(__m256 x) {
-   // high_quad = ( x7, x6, x5, x4 )
-   const __m128 high_quad = _mm256_extractf128_ps(x, 1);
-   // low_quad = ( x3, x2, x1, x0 )
-   const __m128 low_quad = _mm256_castps256_ps128(x);
-   // sum_quad = ( x3 + x7, x2 + x6, x1 + x5, x0 + x4 )
-   const __m128 sum_quad = _mm_add_ps(low_quad, high_quad);
-   // low_dual = ( -, -, x1 + x5, x0 + x4 )
-   const __m128 low_dual = sum_quad;
-   // high_dual = ( -, -, x3 + x7, x2 + x6 )
-   const __m128 high_dual = _mm_movehl_ps(sum_quad, sum_quad);
-   // sum_dual = ( -, -, x1 + x3 + x5 + x7, x0 + x2 + x4 + x6 )
-   const __m128 sum_dual = _mm_add_ps(low_dual, high_dual);
-   // low = ( -, -, -, x0 + x2 + x4 + x6 )
-   const __m128 low = sum_dual;
-   // high = ( -, -, -, x1 + x3 + x5 + x7 )
-   const __m128 high = _mm_shuffle_ps(sum_dual, sum_dual, 0x1);
-   // sum = ( -, -, -, x0 + x1 + x2 + x3 + x4 + x5 + x6 + x7 )
-   const __m128 sum = _mm_add_ss(low, high);
-   return _mm_cvtss_f32(sum);
-}
-
-#endif
-
-#if defined(__AVX2__)
-
-export f32 L2Distance_simd(const f32 *vector1, const f32 *vector2, u32 dimension) {
-   u32 i = 0;
-   __m256 sum_1 = _mm256_setzero_ps();
-   __m256 sum_2 = _mm256_setzero_ps();
-   _mm_prefetch(vector1, _MM_HINT_NTA);
-   _mm_prefetch(vector2, _MM_HINT_NTA);
-   for (; i + 16 <= dimension; i += 16) {
-       _mm_prefetch(vector1 + i + 16, _MM_HINT_NTA);
-       _mm_prefetch(vector2 + i + 16, _MM_HINT_NTA);
-       auto diff_1 = _mm256_sub_ps(_mm256_loadu_ps(vector1 + i), _mm256_loadu_ps(vector2 + i));
-       auto diff_2 = _mm256_sub_ps(_mm256_loadu_ps(vector1 + i + 8), _mm256_loadu_ps(vector2 + i + 8));
-       auto mul_1 = _mm256_mul_ps(diff_1, diff_1);
-       auto mul_2 = _mm256_mul_ps(diff_2, diff_2);
-       // add mul to sum
-       sum_1 = _mm256_add_ps(sum_1, mul_1);
-       sum_2 = _mm256_add_ps(sum_2, mul_2);
-   }
-   if (i + 8 <= dimension) {
-       auto diff = _mm256_sub_ps(_mm256_loadu_ps(vector1 + i), _mm256_loadu_ps(vector2 + i));
-       auto mul = _mm256_mul_ps(diff, diff);
-       sum_1 = _mm256_add_ps(sum_1, mul);
-       i += 8;
-   }
-   f32 distance = calc_256_sum_8(sum_1) + calc_256_sum_8(sum_2);
-   for (; i < dimension; ++i) {
-       auto diff = vector1[i] - vector2[i];
-       distance += diff * diff;
-   }
-   return distance;
-}
-
-#elif defined(__SSE__) 
+// The ivf distances take the kernels of the widest instruction set the cpu supports, picked once. The dimension varies from call
+// to call, so ask for the residual kernels, which any dimension other than a multiple of 16 gets.
 
 export f32 L2Distance_simd(const f32 *vector1, const f32 *vector2, u32 dimension) {
-    return F32L2SSEResidual(vector1, vector2, dimension);
+    static const F32DistFuncType l2_func = GetF32L2Func(1);
+    return l2_func(vector1, vector2, dimension);
 }
 
-#endif
-
-#if defined(__AVX2__)
-
 export f32 IPDistance_simd(const f32 *vector1, const f32 *vector2, u32 dimension) {
-   u32 i = 0;
-   __m256 sum_1 = _mm256_setzero_ps();
-   __m256 sum_2 = _mm256_setzero_ps();
-   _mm_prefetch(vector1, _MM_HINT_NTA);
-   _mm_prefetch(vector2, _MM_HINT_NTA);
-   for (; i + 16 <= dimension; i += 16) {
-       _mm_prefetch(vector1 + i + 16, _MM_HINT_NTA);
-       _mm_prefetch(vector2 + i + 16, _MM_HINT_NTA);
-       auto mul_1 = _mm256_mul_ps(_mm256_loadu_ps(vector1 + i), _mm256_loadu_ps(vector2 + i));
-       auto mul_2 = _mm256_mul_ps(_mm256_loadu_ps(vector1 + i + 8), _mm256_loadu_ps(vector2 + i + 8));
-       // add mul to sum
-       sum_1 = _mm256_add_ps(sum_1, mul_1);
-       sum_2 = _mm256_add_ps(sum_2, mul_2);
-   }
-   if (i + 8 <= dimension) {
-       auto mul = _mm256_mul_ps(_mm256_loadu_ps(vector1 + i), _mm256_loadu_ps(vector2 + i));
-       sum_1 = _mm256_add_ps(sum_1, mul);
-       i += 8;
-   }
-   f32 distance = calc_256_sum_8(sum_1) + calc_256_sum_8(sum_2);
-   for (; i < dimension; ++i) {
-       distance += vector1[i] * vector2[i];
-   }
-   return distance;
+    static const F32DistFuncType ip_func = GetF32IPFunc(1);
+    return ip_func(vector1, vector2, dimension);
 }
 
-#elif defined(__SSE__) 
-
-export f32 IPDistance_simd(const f32 *vector1, const f32 *vector2, u32 dimension) {
-    return F32IPSSEResidual(vector1, vector2, dimension);
+export i32 I8IPDistance_simd(const i8 *vector1, const i8 *vector2, u32 dimension) {
+    static const I8IPFuncType ip_func = GetI8IPFunc(1);
+    return ip_func(vector1, vector2, dimension);
 }
 
-#endif
-
-} // namespace infinity
\ No newline at end of file
+} // namespace infinity
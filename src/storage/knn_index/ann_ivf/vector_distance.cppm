@@ -13,6 +13,8 @@
 // limitations under the License.
 
 module;
+#include <bit>
+#include <cstring>
 #include <type_traits>
 import stl;
 import some_simd_functions;
@@ -24,6 +26,14 @@ export template <typename DiffType, typename ElemType1, typename ElemType2, type
 DiffType L2Distance(const ElemType1 *vector1, const ElemType2 *vector2, const DimType dimension) {
     if constexpr (std::is_same_v<ElemType1, f32> && std::is_same_v<ElemType2, f32>) {
         return L2Distance_simd(vector1, vector2, dimension);
+    } else if constexpr (std::is_same_v<ElemType1, i8> && std::is_same_v<ElemType2, i8>) {
+        // exact in i32, a float sum would round once it passes 2^24
+        i32 distance = 0;
+        for (u32 i = 0; i < dimension; ++i) {
+            i32 diff = i32(vector1[i]) - i32(vector2[i]);
+            distance += diff * diff;
+        }
+        return static_cast<DiffType>(distance);
     } else {
         DiffType distance{};
         for (u32 i = 0; i < dimension; ++i) {
@@ -38,6 +48,8 @@ export template <typename DiffType, typename ElemType1, typename ElemType2, type
 DiffType IPDistance(const ElemType1 *vector1, const ElemType2 *vector2, const DimType dimension) {
     if constexpr (std::is_same_v<ElemType1, f32> && std::is_same_v<ElemType2, f32>) {
         return IPDistance_simd(vector1, vector2, dimension);
+    } else if constexpr (std::is_same_v<ElemType1, i8> && std::is_same_v<ElemType2, i8>) {
+        return static_cast<DiffType>(I8IPDistance_simd(vector1, vector2, dimension));
     } else {
         DiffType distance{};
         for (u32 i = 0; i < dimension; ++i) {
@@ -47,6 +59,23 @@ DiffType IPDistance(const ElemType1 *vector1, const ElemType2 *vector2, const Di
     }
 }
 
+// The number of differing bits of two bit embeddings, the dimension is their size in bytes.
+export template <typename DiffType, typename DimType = u32>
+DiffType HammingDistance(const u8 *vector1, const u8 *vector2, const DimType byte_count) {
+    u32 distance = 0;
+    DimType i = 0;
+    for (; i + sizeof(u64) <= byte_count; i += sizeof(u64)) {
+        u64 word1, word2;
+        std::memcpy(&word1, vector1 + i, sizeof(u64));
+        std::memcpy(&word2, vector2 + i, sizeof(u64));
+        distance += std::popcount(word1 ^ word2);
+    }
+    for (; i < byte_count; ++i) {
+        distance += std::popcount(static_cast<u8>(vector1[i] ^ vector2[i]));
+    }
+    return static_cast<DiffType>(distance);
+}
+
 export template <typename DiffType, typename ElemType, typename DimType = u32>
 DiffType L2NormSquare(const ElemType *vector, const DimType dimension) {
     return IPDistance<DiffType>(vector, vector, dimension);
@@ -59,4 +88,21 @@ void L2NormsSquares(DiffType *__restrict output, const ElemType *__restrict vect
     }
 }
 
+// Scales a vector to unit length, in place if output is the vector. A zero vector stays zero.
+export template <typename ElemType, typename DimType = u32>
+void L2Normalize(ElemType *output, const ElemType *vector, const DimType dimension) {
+    const auto norm = std::sqrt(L2NormSquare<ElemType>(vector, dimension));
+    const ElemType scale = norm > 0 ? 1 / norm : 0;
+    for (u32 i = 0; i < dimension; ++i) {
+        output[i] = vector[i] * scale;
+    }
+}
+
+// The cosine of a unit query and a vector, the vector is divided by its norm only.
+export template <typename DiffType, typename ElemType1, typename ElemType2, typename DimType = u32>
+DiffType CosineDistance(const ElemType1 *unit_query, const ElemType2 *vector, const DimType dimension) {
+    const DiffType norm = std::sqrt(L2NormSquare<DiffType>(vector, dimension));
+    return norm > 0 ? IPDistance<DiffType>(unit_query, vector, dimension) / norm : 0;
+}
+
 } // namespace infinity
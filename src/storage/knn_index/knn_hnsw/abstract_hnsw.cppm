@@ -21,6 +21,7 @@ import hnsw_alg;
 import dist_func_l2;
 import dist_func_ip;
 import lvq_store;
+import pq_store;
 import plain_store;
 import file_system;
 import hnsw_common;
@@ -37,13 +38,16 @@ class AbstractHnsw {
     using Hnsw2 = KnnHnsw<DataType, LabelType, PlainStore<DataType, LabelType>, PlainL2Dist<DataType, LabelType>>;
     using Hnsw3 = KnnHnsw<DataType, LabelType, LVQStore<DataType, LabelType, i8, LVQIPCache<DataType, i8>>, LVQIPDist<DataType, LabelType, i8>>;
     using Hnsw4 = KnnHnsw<DataType, LabelType, LVQStore<DataType, LabelType, i8, LVQL2Cache<DataType, i8>>, LVQL2Dist<DataType, LabelType, i8>>;
+    using Hnsw5 = KnnHnsw<DataType, LabelType, PQStore<DataType, LabelType, PQIPMetric<DataType>>, PQIPDist<DataType, LabelType>>;
+    using Hnsw6 = KnnHnsw<DataType, LabelType, PQStore<DataType, LabelType, PQL2Metric<DataType>>, PQL2Dist<DataType, LabelType>>;
 
 public:
-    AbstractHnsw(void *ptr, const IndexHnsw *index_hnsw) {
+    AbstractHnsw(void *ptr, const IndexHnsw *index_hnsw) : normalize_(index_hnsw->metric_type_ == MetricType::kMetricCosine) {
         switch (index_hnsw->encode_type_) {
             case HnswEncodeType::kPlain: {
                 switch (index_hnsw->metric_type_) {
-                    case MetricType::kMetricInnerProduct: {
+                    case MetricType::kMetricInnerProduct:
+                    case MetricType::kMetricCosine: {
                         knn_hnsw_ptr_ = reinterpret_cast<Hnsw1 *>(ptr);
                         break;
                     }
@@ -52,14 +56,15 @@ public:
                         break;
                     }
                     default: {
-                        UnrecoverableError("HNSW supports inner product and L2 distance.");
+                        UnrecoverableError("HNSW supports inner product, L2 and cosine distance.");
                     }
                 }
                 break;
             }
             case HnswEncodeType::kLVQ: {
                 switch (index_hnsw->metric_type_) {
-                    case MetricType::kMetricInnerProduct: {
+                    case MetricType::kMetricInnerProduct:
+                    case MetricType::kMetricCosine: {
                         knn_hnsw_ptr_ = reinterpret_cast<Hnsw3 *>(ptr);
                         break;
                     }
@@ -68,7 +73,24 @@ public:
                         break;
                     }
                     default: {
-                        UnrecoverableError("HNSW supports inner product and L2 distance.");
+                        UnrecoverableError("HNSW supports inner product, L2 and cosine distance.");
+                    }
+                }
+                break;
+            }
+            case HnswEncodeType::kPQ: {
+                switch (index_hnsw->metric_type_) {
+                    case MetricType::kMetricInnerProduct:
+                    case MetricType::kMetricCosine: {
+                        knn_hnsw_ptr_ = reinterpret_cast<Hnsw5 *>(ptr);
+                        break;
+                    }
+                    case MetricType::kMetricL2: {
+                        knn_hnsw_ptr_ = reinterpret_cast<Hnsw6 *>(ptr);
+                        break;
+                    }
+                    default: {
+                        UnrecoverableError("HNSW supports inner product, L2 and cosine distance.");
                     }
                 }
                 break;
@@ -86,7 +108,7 @@ public:
                 using T = std::decay_t<decltype(*arg)>;
                 if constexpr (std::is_same_v<T, Hnsw1> || std::is_same_v<T, Hnsw2>) {
                     knn_hnsw_ptr_ = T::Make(max_element, dimension, M, ef_c, {}).release();
-                } else if constexpr (std::is_same_v<T, Hnsw3> || std::is_same_v<T, Hnsw4>) {
+                } else if constexpr (std::is_same_v<T, Hnsw3> || std::is_same_v<T, Hnsw4> || std::is_same_v<T, Hnsw5> || std::is_same_v<T, Hnsw6>) {
                     knn_hnsw_ptr_ = T::Make(max_element, dimension, M, ef_c, {}).release();
                 } else {
                     UnrecoverableError("Invalid type");
@@ -101,7 +123,7 @@ public:
                 using T = std::decay_t<decltype(*arg)>;
                 if constexpr (std::is_same_v<T, Hnsw1> || std::is_same_v<T, Hnsw2>) {
                     knn_hnsw_ptr_ = T::Load(file_handler, {}).release();
-                } else if constexpr (std::is_same_v<T, Hnsw3> || std::is_same_v<T, Hnsw4>) {
+                } else if constexpr (std::is_same_v<T, Hnsw3> || std::is_same_v<T, Hnsw4> || std::is_same_v<T, Hnsw5> || std::is_same_v<T, Hnsw6>) {
                     knn_hnsw_ptr_ = T::Load(file_handler, {}).release();
                 } else {
                     UnrecoverableError("Invalid type");
@@ -110,6 +132,21 @@ public:
             knn_hnsw_ptr_);
     }
 
+    void LoadFromMmap(const String &path) {
+        std::visit(
+            [&path, this](auto &&arg) {
+                using T = std::decay_t<decltype(*arg)>;
+                if constexpr (std::is_same_v<T, Hnsw1> || std::is_same_v<T, Hnsw2>) {
+                    knn_hnsw_ptr_ = T::LoadFromMmap(path, {}).release();
+                } else if constexpr (std::is_same_v<T, Hnsw3> || std::is_same_v<T, Hnsw4> || std::is_same_v<T, Hnsw5> || std::is_same_v<T, Hnsw6>) {
+                    knn_hnsw_ptr_ = T::LoadFromMmap(path, {}).release();
+                } else {
+                    UnrecoverableError("Invalid type");
+                }
+            },
+            knn_hnsw_ptr_);
+    }
+
     void Save(FileHandler &file_handler) {
         std::visit([&file_handler](auto &&arg) { arg->Save(file_handler); }, knn_hnsw_ptr_);
     }
@@ -118,6 +155,10 @@ public:
         std::visit([](auto &&arg) { delete arg; }, knn_hnsw_ptr_);
     }
 
+    bool Prefault(bool lock) const {
+        return std::visit([lock](auto &&arg) { return arg->Prefault(lock); }, knn_hnsw_ptr_);
+    }
+
     SizeT GetVertexNum() const {
         return std::visit([](auto &&arg) { return arg->GetVertexNum(); }, knn_hnsw_ptr_);
     }
@@ -126,24 +167,51 @@ public:
         std::visit([idx](auto &&arg) { arg->Build(idx); }, knn_hnsw_ptr_);
     }
 
+    void BuildRange(SizeT begin, SizeT end) {
+        std::visit([begin, end](auto &&arg) { arg->BuildRange(begin, end); }, knn_hnsw_ptr_);
+    }
+
     void *RawPtr() const {
         return std::visit([](auto &&arg) { return reinterpret_cast<void *>(arg); }, knn_hnsw_ptr_);
     }
 
+    // A cosine index stores the vectors scaled to unit length and is searched with unit queries.
     template <DataIteratorConcept<const DataType *, LabelType> Iterator>
     void InsertVecs(Iterator &&iter, SizeT insert_n) {
-        std::visit([&iter, insert_n](auto &&arg) { arg->InsertVecs(std::move(iter), insert_n); }, knn_hnsw_ptr_);
+        std::visit(
+            [&iter, insert_n, this](auto &&arg) {
+                if (normalize_) {
+                    using NormalizedIter = NormalizedVectorIter<std::decay_t<Iterator>, DataType, LabelType>;
+                    arg->InsertVecs(NormalizedIter(std::move(iter), arg->Dimension()), insert_n);
+                } else {
+                    arg->InsertVecs(std::move(iter), insert_n);
+                }
+            },
+            knn_hnsw_ptr_);
     }
 
     template <DataIteratorConcept<const DataType *, LabelType> Iterator>
     void StoreData(Iterator &&iter, SizeT insert_n) {
-        std::visit([&iter, insert_n](auto &&arg) { arg->StoreData(std::move(iter), insert_n); }, knn_hnsw_ptr_);
+        std::visit(
+            [&iter, insert_n, this](auto &&arg) {
+                if (normalize_) {
+                    using NormalizedIter = NormalizedVectorIter<std::decay_t<Iterator>, DataType, LabelType>;
+                    arg->StoreData(NormalizedIter(std::move(iter), arg->Dimension()), insert_n);
+                } else {
+                    arg->StoreData(std::move(iter), insert_n);
+                }
+            },
+            knn_hnsw_ptr_);
     }
 
     void SetEf(SizeT ef) {
         std::visit([ef](auto &&arg) { arg->SetEf(ef); }, knn_hnsw_ptr_);
     }
 
+    SizeT GetEf() const {
+        return std::visit([](auto &&arg) { return arg->GetEf(); }, knn_hnsw_ptr_);
+    }
+
     template <bool WithLock, FilterConcept<LabelType> Filter>
     Tuple<SizeT, UniquePtr<DataType[]>, UniquePtr<LabelType[]>> KnnSearch(const DataType *q, SizeT k, const Filter &filter) const {
         return std::visit([q, k, &filter](auto &&arg) { return arg->template KnnSearch<WithLock, Filter>(q, k, filter); }, knn_hnsw_ptr_);
@@ -154,8 +222,22 @@ public:
         return std::visit([q, k](auto &&arg) { return arg->template KnnSearch<WithLock>(q, k); }, knn_hnsw_ptr_);
     }
 
+    template <bool WithLock, FilterConcept<LabelType> Filter>
+    Vector<Tuple<SizeT, UniquePtr<DataType[]>, UniquePtr<LabelType[]>>>
+    KnnSearchBatch(const DataType *queries, SizeT query_n, SizeT k, const Filter &filter) const {
+        return std::visit(
+            [queries, query_n, k, &filter](auto &&arg) { return arg->template KnnSearchBatch<WithLock, Filter>(queries, query_n, k, filter); },
+            knn_hnsw_ptr_);
+    }
+
+    template <bool WithLock>
+    Vector<Tuple<SizeT, UniquePtr<DataType[]>, UniquePtr<LabelType[]>>> KnnSearchBatch(const DataType *queries, SizeT query_n, SizeT k) const {
+        return std::visit([queries, query_n, k](auto &&arg) { return arg->template KnnSearchBatch<WithLock>(queries, query_n, k); }, knn_hnsw_ptr_);
+    }
+
 private:
-    std::variant<Hnsw1 *, Hnsw2 *, Hnsw3 *, Hnsw4 *> knn_hnsw_ptr_;
+    std::variant<Hnsw1 *, Hnsw2 *, Hnsw3 *, Hnsw4 *, Hnsw5 *, Hnsw6 *> knn_hnsw_ptr_;
+    const bool normalize_{};
 };
 
 } // namespace infinity
\ No newline at end of file
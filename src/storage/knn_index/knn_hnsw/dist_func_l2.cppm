@@ -21,6 +21,7 @@ import stl;
 import hnsw_common;
 import plain_store;
 import lvq_store;
+import pq_store;
 import hnsw_simd_func;
 
 export module dist_func_l2;
@@ -41,27 +42,7 @@ private:
 public:
     PlainL2Dist(SizeT dim) {
         if constexpr (std::is_same<DataType, float>()) {
-#if defined(USE_AVX512)
-            if (dim % 16 == 0) {
-                SIMDFunc = F32L2AVX512;
-            } else {
-                SIMDFunc = F32L2AVX512Residual;
-            }
-#elif defined(USE_AVX)
-            if (dim % 16 == 0) {
-                SIMDFunc = F32L2AVX;
-            } else {
-                SIMDFunc = F32L2AVXResidual;
-            }
-#elif defined(USE_SSE)
-            if (dim % 16 == 0) {
-                SIMDFunc = F32L2SSE;
-            } else {
-                SIMDFunc = F32L2SSEResidual;
-            }
-#else
-            SIMDFunc = F32IPBF;
-#endif
+            SIMDFunc = GetF32L2Func(dim);
         }
     }
 
@@ -103,27 +84,7 @@ private:
 public:
     LVQL2Dist(SizeT dim) {
         if constexpr (std::is_same<CompressType, i8>()) {
-#if defined(USE_AVX512)
-            if (dim % 64 == 0) {
-                SIMDFunc = I8IPAVX512;
-            } else {
-                SIMDFunc = I8IPAVX512Residual;
-            }
-#elif defined(USE_AVX)
-            if (dim % 32 == 0) {
-                SIMDFunc = I8IPAVX;
-            } else {
-                SIMDFunc = I8IPAVXResidual;
-            }
-#elif defined(USE_SSE)
-            if (dim % 16 == 0) {
-                SIMDFunc = I8IPSSE;
-            } else {
-                SIMDFunc = I8IPSSEResidual;
-            }
-#else
-            SIMDFunc = I8IPBF;
-#endif
+            SIMDFunc = GetI8IPFunc(dim);
         }
     }
 
@@ -140,4 +101,48 @@ public:
     }
 };
 
+export template <typename DataType>
+class PQL2Metric {
+public:
+    // squared l2 distance of one subspace
+    static DataType SubDistance(const DataType *v1, const DataType *v2, SizeT len) {
+        DataType res = 0;
+        for (SizeT i = 0; i < len; ++i) {
+            DataType diff = v1[i] - v2[i];
+            res += diff * diff;
+        }
+        return res;
+    }
+};
+
+export template <typename DataType, typename LabelType>
+class PQL2Dist {
+public:
+    using This = PQL2Dist<DataType, LabelType>;
+    using DataStore = PQStore<DataType, LabelType, PQL2Metric<DataType>>;
+    using StoreType = typename DataStore::StoreType;
+
+private:
+    using SIMDFuncType = DataType (*)(const DataType *, const u8 *, SizeT);
+
+    SIMDFuncType SIMDFunc = nullptr;
+
+public:
+    PQL2Dist(SizeT) {
+        if constexpr (std::is_same<DataType, float>()) {
+            SIMDFunc = GetF32PQTableSumFunc();
+        }
+    }
+
+    DataType operator()(const StoreType &v1, const StoreType &v2, const DataStore &data_store) const {
+        if (v1.table() != nullptr) {
+            return SIMDFunc(v1.table(), v2.codes(), data_store.subspace_num());
+        }
+        if (v2.table() != nullptr) {
+            return SIMDFunc(v2.table(), v1.codes(), data_store.subspace_num());
+        }
+        return data_store.SymmetricDistance(v1.codes(), v2.codes());
+    }
+};
+
 } // namespace infinity
\ No newline at end of file
@@ -13,6 +13,7 @@
 // limitations under the License.
 
 module;
+#include <algorithm>
 #include <cassert>
 #include <new>
 #include <vector>
@@ -20,6 +21,7 @@ module;
 import stl;
 import hnsw_common;
 import file_system;
+import huge_page_allocator;
 
 export module graph_store;
 
@@ -27,6 +29,8 @@ namespace infinity {
 
 export class GraphStore {
 private:
+    constexpr static SizeT cache_line_size_ = 64;
+
     constexpr static SizeT layer_n_offset_ = 0;
     constexpr static SizeT layers_p_offset_ = AlignTo(layer_n_offset_ + sizeof(LayerSize), sizeof(char *));
     constexpr static SizeT l0_neighbor_n_offset_ = AlignTo(layers_p_offset_ + sizeof(char *), sizeof(VertexListSize));
@@ -41,6 +45,8 @@ private:
     char *const graph_;
     const SizeT loaded_vertex_n_;
     char *const loaded_layers_;
+    // graph_ and loaded_layers_ point into the mapped index file, the graph is read only
+    const bool mapped_;
 
     i32 max_layer_{};
     VertexType enterpoint_{};
@@ -93,17 +99,27 @@ private:
     VertexL0Mut GetLevel0Mut(VertexType vertex_i) { return VertexL0Mut(graph_ + level0_size_ * vertex_i); }
     VertexLXMut GetLevelXMut(VertexL0Mut &level0, LayerSize layer_i) { return VertexLXMut(*level0.GetLayers().first + levelx_size_ * (layer_i - 1)); }
     VertexL0 GetLevel0(VertexType vertex_i) const { return VertexL0(graph_ + level0_size_ * vertex_i); }
-    VertexLX GetLevelX(const VertexL0 &level0, LayerSize layer_i) const { return VertexLX(level0.GetLayers().first + levelx_size_ * (layer_i - 1)); }
+    VertexLX GetLevelX(const VertexL0 &level0, LayerSize layer_i) const { return VertexLX(GetLayers(level0) + levelx_size_ * (layer_i - 1)); }
+
+    const char *GetLayers(const VertexL0 &level0) const {
+        const char *layers = level0.GetLayers().first;
+        // a mapped graph keeps the offset of the layers in the file instead of a pointer
+        return mapped_ ? loaded_layers_ + reinterpret_cast<SizeT>(layers) : layers;
+    }
+
+    static SizeT Level0Size(SizeT Mmax0) { return AlignTo(l0_neighbors_offset_ + sizeof(VertexType) * Mmax0, 8); }
+    static SizeT LevelXSize(SizeT Mmax) { return AlignTo(lx_neighbors_offset_ + sizeof(VertexType) * Mmax, 8); }
+    static char *AllocateGraph(SizeT size) { return static_cast<char *>(HugePageAllocator::Allocate(size, cache_line_size_)); }
 
 private:
-    GraphStore(SizeT max_vertex, SizeT Mmax, SizeT Mmax0, SizeT loaded_vertex_n, char *loaded_layers)
-        : level0_size_(AlignTo(l0_neighbors_offset_ + sizeof(VertexType) * Mmax0, 8)),                 //
-          levelx_size_(AlignTo(lx_neighbors_offset_ + sizeof(VertexType) * Mmax, 8)),                  //
-          max_vertex_num_(max_vertex),                                                                 //
-          graph_(static_cast<char *>(operator new[](max_vertex * level0_size_, std::align_val_t(8)))), //
-          loaded_vertex_n_(loaded_vertex_n),                                                           //
-          loaded_layers_(loaded_layers)                                                                //
-                                                                                                       //
+    GraphStore(SizeT max_vertex, SizeT Mmax, SizeT Mmax0, SizeT loaded_vertex_n, char *loaded_layers, const char *mapped_graph = nullptr)
+        : level0_size_(Level0Size(Mmax0)),                                                                               //
+          levelx_size_(LevelXSize(Mmax)),                                                                                //
+          max_vertex_num_(max_vertex),                                                                                   //
+          graph_(mapped_graph != nullptr ? const_cast<char *>(mapped_graph) : AllocateGraph(max_vertex * level0_size_)), //
+          loaded_vertex_n_(loaded_vertex_n),                                                                             //
+          loaded_layers_(loaded_layers),                                                                                 //
+          mapped_(mapped_graph != nullptr)                                                                               //
     {}
 
     void Init() {
@@ -135,6 +151,7 @@ public:
           graph_(other.graph_),                     //
           loaded_vertex_n_(other.loaded_vertex_n_), //
           loaded_layers_(other.loaded_layers_),     //
+          mapped_(other.mapped_),                   //
           max_layer_(other.max_layer_),             //
           enterpoint_(other.enterpoint_)            //
     {
@@ -143,11 +160,14 @@ public:
     }
 
     ~GraphStore() {
+        if (mapped_) {
+            return;
+        }
         if (graph_) {
             for (VertexType vertex_i = loaded_vertex_n_; vertex_i < VertexType(max_vertex_num_); ++vertex_i) {
                 delete[] GetLevel0(vertex_i).GetLayers().first;
             }
-            operator delete[](graph_, std::align_val_t(8));
+            HugePageAllocator::Deallocate(graph_, max_vertex_num_ * level0_size_, cache_line_size_);
         }
         if (loaded_layers_) {
             delete[] loaded_layers_;
@@ -183,6 +203,19 @@ public:
         }
         return GetLevelX(vertex, layer_i).GetNeighbors();
     }
+    // Start loading the neighbor list of `vertex_i` in `layer_i` before it is expanded.
+    void Prefetch(VertexType vertex_i, i32 layer_i) const {
+        if (layer_i == 0) {
+            const char *ptr = graph_ + level0_size_ * vertex_i;
+            for (SizeT offset = 0; offset < level0_size_; offset += cache_line_size_) {
+                __builtin_prefetch(ptr + offset);
+            }
+        } else {
+            const char *ptr = GetLevelX(GetLevel0(vertex_i), layer_i).GetNeighbors().first;
+            __builtin_prefetch(ptr);
+        }
+    }
+
     Pair<VertexType *, VertexListSize *> GetNeighborsMut(VertexType vertex_i, i32 layer_i) {
         VertexL0Mut vertex = GetLevel0Mut(vertex_i);
         if (layer_i == 0) {
@@ -199,12 +232,25 @@ public:
             layer_sum += GetLevel0(vertex_i).GetLayers().second;
         }
         file_handler.Write(&layer_sum, sizeof(layer_sum));
-        file_handler.Write(graph_, cur_vertex_n * level0_size_);
+        // the layers pointer of a vertex is saved as the offset of its layers in the layers section
+        constexpr VertexType chunk_n = 1024;
+        auto chunk = MakeUniqueForOverwrite<char[]>(chunk_n * level0_size_);
+        SizeT layers_offset = 0;
+        for (VertexType chunk_begin = 0; chunk_begin < cur_vertex_n; chunk_begin += chunk_n) {
+            VertexType chunk_end = std::min(cur_vertex_n, chunk_begin + chunk_n);
+            std::copy(graph_ + level0_size_ * chunk_begin, graph_ + level0_size_ * chunk_end, chunk.get());
+            for (VertexType vertex_i = chunk_begin; vertex_i < chunk_end; ++vertex_i) {
+                VertexL0Mut vertex(chunk.get() + level0_size_ * (vertex_i - chunk_begin));
+                auto [layers, layer_n] = vertex.GetLayers();
+                *layers = reinterpret_cast<char *>(layers_offset);
+                layers_offset += levelx_size_ * *layer_n;
+            }
+            file_handler.Write(chunk.get(), level0_size_ * (chunk_end - chunk_begin));
+        }
         for (VertexType vertex_i = 0; vertex_i < cur_vertex_n; ++vertex_i) {
             VertexL0 vertex = GetLevel0(vertex_i);
-            auto [layers, layer_n] = vertex.GetLayers();
-            if (layer_n) {
-                file_handler.Write(layers, levelx_size_ * layer_n);
+            if (LayerSize layer_n = vertex.GetLayers().second; layer_n) {
+                file_handler.Write(GetLayers(vertex), levelx_size_ * layer_n);
             }
         }
     }
@@ -222,21 +268,31 @@ public:
         graph_store.max_layer_ = max_layer;
         graph_store.enterpoint_ = enterpoint;
         file_handler.Read(graph_store.graph_, cur_vertex_n * graph_store.level0_size_);
-        char *loaded_layers_p = graph_store.loaded_layers_;
+        file_handler.Read(graph_store.loaded_layers_, graph_store.levelx_size_ * layer_sum);
         for (VertexType vertex_i = 0; vertex_i < cur_vertex_n; ++vertex_i) {
             VertexL0Mut vertex = graph_store.GetLevel0Mut(vertex_i);
-            LayerSize layer_n = *vertex.GetLayers().second;
-            if (layer_n) {
-                file_handler.Read(loaded_layers_p, graph_store.levelx_size_ * layer_n);
-                *vertex.GetLayers().first = loaded_layers_p;
-                loaded_layers_p += graph_store.levelx_size_ * layer_n;
-            } else {
-                *vertex.GetLayers().first = nullptr;
-            }
+            auto [layers, layer_n] = vertex.GetLayers();
+            *layers = *layer_n ? graph_store.loaded_layers_ + reinterpret_cast<SizeT>(*layers) : nullptr;
         }
         return graph_store;
     }
 
+    // Use the graph in the mapped file in place. The records are multiples of 8 bytes and viewed as SizeT to check their alignment.
+    static GraphStore LoadFromMmap(MmapReader &reader, SizeT Mmax, SizeT Mmax0, VertexType cur_vertex_n) {
+        i32 max_layer;
+        reader.Read(&max_layer, sizeof(max_layer));
+        VertexType enterpoint;
+        reader.Read(&enterpoint, sizeof(enterpoint));
+        SizeT layer_sum;
+        reader.Read(&layer_sum, sizeof(layer_sum));
+        const auto *graph = reinterpret_cast<const char *>(reader.View<SizeT>(cur_vertex_n * Level0Size(Mmax0) / sizeof(SizeT)));
+        const auto *layers = reinterpret_cast<const char *>(reader.View<SizeT>(layer_sum * LevelXSize(Mmax) / sizeof(SizeT)));
+        GraphStore graph_store(cur_vertex_n, Mmax, Mmax0, cur_vertex_n, const_cast<char *>(layers), graph);
+        graph_store.max_layer_ = max_layer;
+        graph_store.enterpoint_ = enterpoint;
+        return graph_store;
+    }
+
     //---------------------------------------------- Following is the tmp debug function. ----------------------------------------------
 
     // check invariant of graph
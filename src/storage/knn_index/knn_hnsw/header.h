@@ -1,13 +1,13 @@
 #pragma once
 #ifndef NO_MANUAL_VECTORIZATION
-#if (defined(__SSE2__) || _M_IX86_FP > 0 || defined(_M_AMD64) || defined(_M_X64))
+#if defined(__x86_64__) || defined(_M_AMD64) || defined(_M_X64)
+// All x86 kernels are compiled, each for its own target, and the one the cpu supports is picked at runtime.
 #define USE_SSE
-#ifdef __AVX2__
 #define USE_AVX
-#ifdef __AVX512F__
 #define USE_AVX512
-#endif
-#endif
+#elif defined(__aarch64__) || defined(_M_ARM64)
+// NEON is part of the aarch64 baseline.
+#define USE_NEON
 #endif
 #endif
 
@@ -15,94 +15,27 @@
 #ifdef _MSC_VER
 #include <intrin.h>
 #include <stdexcept>
-// void cpuid(int32_t out[4], int32_t eax, int32_t ecx) {
-//     __cpuidex(out, eax, ecx);
-// }
-// static __int64 xgetbv(unsigned int x) {
-//     return _xgetbv(x);
-// }
 #else
 #include <x86intrin.h>
 #include <cpuid.h>
 #include <stdint.h>
-// static void cpuid(int32_t cpuInfo[4], int32_t eax, int32_t ecx) {
-    // __cpuid_count(eax, ecx, cpuInfo[0], cpuInfo[1], cpuInfo[2], cpuInfo[3]);
-// }
-// static uint64_t xgetbv(unsigned int index) {
-    // uint32_t eax, edx;
-    // __asm__ __volatile__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(index));
-    // return ((uint64_t)edx << 32) | eax;
-// }
 #endif
 
-#if defined(USE_AVX512)
 #include <immintrin.h>
 #endif
 
+#if defined(USE_NEON)
+#include <arm_neon.h>
+#include <stdint.h>
+#endif
+
 #if defined(__GNUC__)
 #define PORTABLE_ALIGN32 __attribute__((aligned(32)))
 #define PORTABLE_ALIGN64 __attribute__((aligned(64)))
+// Compile a kernel for an instruction set above the baseline of the build.
+#define SIMD_TARGET(features) __attribute__((target(features)))
 #else
 #define PORTABLE_ALIGN32 __declspec(align(32))
 #define PORTABLE_ALIGN64 __declspec(align(64))
+#define SIMD_TARGET(features)
 #endif
-
-// Adapted from https://github.com/Mysticial/FeatureDetector
-#define _XCR_XFEATURE_ENABLED_MASK  0
-
-// static bool AVXCapable() {
-//     int cpuInfo[4];
-
-//     // CPU support
-//     cpuid(cpuInfo, 0, 0);
-//     int nIds = cpuInfo[0];
-
-//     bool HW_AVX = false;
-//     if (nIds >= 0x00000001) {
-//         cpuid(cpuInfo, 0x00000001, 0);
-//         HW_AVX = (cpuInfo[2] & ((int)1 << 28)) != 0;
-//     }
-
-//     // OS support
-//     cpuid(cpuInfo, 1, 0);
-
-//     bool osUsesXSAVE_XRSTORE = (cpuInfo[2] & (1 << 27)) != 0;
-//     bool cpuAVXSuport = (cpuInfo[2] & (1 << 28)) != 0;
-
-//     bool avxSupported = false;
-//     if (osUsesXSAVE_XRSTORE && cpuAVXSuport) {
-//         uint64_t xcrFeatureMask = xgetbv(_XCR_XFEATURE_ENABLED_MASK);
-//         avxSupported = (xcrFeatureMask & 0x6) == 0x6;
-//     }
-//     return HW_AVX && avxSupported;
-// }
-
-// static bool AVX512Capable() {
-//     if (!AVXCapable()) return false;
-
-//     int cpuInfo[4];
-
-//     // CPU support
-//     cpuid(cpuInfo, 0, 0);
-//     int nIds = cpuInfo[0];
-
-//     bool HW_AVX512F = false;
-//     if (nIds >= 0x00000007) {  //  AVX512 Foundation
-//         cpuid(cpuInfo, 0x00000007, 0);
-//         HW_AVX512F = (cpuInfo[1] & ((int)1 << 16)) != 0;
-//     }
-
-//     // OS support
-//     cpuid(cpuInfo, 1, 0);
-
-//     bool osUsesXSAVE_XRSTORE = (cpuInfo[2] & (1 << 27)) != 0;
-//     bool cpuAVXSuport = (cpuInfo[2] & (1 << 28)) != 0;
-
-//     bool avx512Supported = false;
-//     if (osUsesXSAVE_XRSTORE && cpuAVXSuport) {
-//         uint64_t xcrFeatureMask = xgetbv(_XCR_XFEATURE_ENABLED_MASK);
-//         avx512Supported = (xcrFeatureMask & 0xe6) == 0xe6;
-//     }
-//     return HW_AVX512F && avx512Supported;
-// }
-#endif
\ No newline at end of file
@@ -15,6 +15,7 @@
 module;
 
 #include <random>
+#include <xmmintrin.h>
 
 export module hnsw_alg;
 
@@ -29,6 +30,7 @@ import hnsw_common;
 import plain_store;
 import graph_store;
 import lvq_store;
+import hnsw_mem_pool;
 
 // Fixme: some variable has implicit type conversion.
 // Fixme: some variable has confusing name.
@@ -66,6 +68,8 @@ private:
     const double mult_;
     std::default_random_engine level_rng_{};
 
+    // the index file mapping used in place by the stores, released after them
+    UniquePtr<MmapRegion> mmap_region_;
     DataStore data_store_;
     GraphStore graph_store_;
     Distance distance_;
@@ -140,8 +144,9 @@ private:
             result_handler.AddResult(0, dist, enter_point);
         }
 
-        Vector<bool> visited(data_store_.cur_vec_num(), false);
-        visited[enter_point] = true;
+        VisitedTable &visited = ThreadLocalVisitedTable();
+        visited.Reset(data_store_.cur_vec_num());
+        visited.Visit(enter_point);
 
         while (!candidate.empty()) {
             const auto [minus_c_dist, c_idx] = candidate.top();
@@ -149,6 +154,10 @@ private:
             if (result_handler.GetSize(0) == result_n && -minus_c_dist > result_handler.GetDistance0(0)) {
                 break;
             }
+            if (!candidate.empty()) {
+                // the next candidate is expanded next round unless this round finds a closer one, hide the miss on its neighbor list
+                graph_store_.Prefetch(candidate.top().second, layer_idx);
+            }
 
             std::shared_lock<std::shared_mutex> lock;
             if constexpr (WithLock) {
@@ -159,10 +168,10 @@ private:
             int prefetch_start = neighbor_size - 1 - prefetch_offset_;
             for (int i = neighbor_size - 1; i >= 0; --i) {
                 VertexType n_idx = neighbors_p[i];
-                if (visited[n_idx]) {
+                if (visited.Visited(n_idx)) {
                     continue;
                 }
-                visited[n_idx] = true;
+                visited.Visit(n_idx);
                 if (prefetch_start >= 0) {
                     int lower = std::max(0, prefetch_start - prefetch_step_);
                     for (int i = prefetch_start; i >= lower; --i) {
@@ -358,6 +367,14 @@ public:
         }
     }
 
+    // Insert the stored vertices in [begin, end). Several threads may build disjoint ranges at the same time, they are
+    // synchronized by the vertex locks.
+    void BuildRange(VertexType begin, VertexType end) {
+        for (VertexType vertex_i = begin; vertex_i < end; ++vertex_i) {
+            Build(vertex_i);
+        }
+    }
+
     template <bool WithLock = false, FilterConcept<LabelType> Filter = NoneType>
     Tuple<SizeT, UniquePtr<DataType[]>, UniquePtr<LabelType[]>> KnnSearch(const DataType *q, SizeT k, const Filter &filter) const {
         auto [result_n, d_ptr, v_ptr] = KnnSearchInner<WithLock, Filter>(q, k, filter);
@@ -373,6 +390,48 @@ public:
         return KnnSearch<WithLock, NoneType>(q, k, None);
     }
 
+    // Search `query_n` queries stored one after another in `queries`. The greedy descent of the upper layers runs layer
+    // by layer for the whole batch, so the neighbor lists around the enterpoint are shared by all the queries while they
+    // are in cache. The layer 0 entry of the next query is prefetched while the current one is searched.
+    template <bool WithLock = false, FilterConcept<LabelType> Filter = NoneType>
+    Vector<Tuple<SizeT, UniquePtr<DataType[]>, UniquePtr<LabelType[]>>>
+    KnnSearchBatch(const DataType *queries, SizeT query_n, SizeT k, const Filter &filter) const {
+        Vector<typename DataStore::QueryType> query_vecs;
+        query_vecs.reserve(query_n);
+        for (SizeT query_i = 0; query_i < query_n; ++query_i) {
+            query_vecs.push_back(data_store_.MakeQuery(queries + query_i * data_store_.dim()));
+        }
+
+        Vector<VertexType> eps(query_n, graph_store_.enterpoint());
+        for (i32 cur_layer = graph_store_.max_layer(); cur_layer > 0; --cur_layer) {
+            for (SizeT query_i = 0; query_i < query_n; ++query_i) {
+                eps[query_i] = SearchLayerNearest<WithLock>(eps[query_i], query_vecs[query_i], cur_layer);
+            }
+        }
+
+        Vector<Tuple<SizeT, UniquePtr<DataType[]>, UniquePtr<LabelType[]>>> results;
+        results.reserve(query_n);
+        for (SizeT query_i = 0; query_i < query_n; ++query_i) {
+            if (query_i + 1 < query_n) {
+                VertexType next_ep = eps[query_i + 1];
+                data_store_.Prefetch(next_ep);
+                _mm_prefetch(reinterpret_cast<const char *>(graph_store_.GetNeighbors(next_ep, 0).first), _MM_HINT_T0);
+            }
+            auto [result_n, d_ptr, v_ptr] = SearchLayer<WithLock, Filter>(eps[query_i], query_vecs[query_i], 0, std::max(k, ef_), filter);
+            auto labels = MakeUniqueForOverwrite<LabelType[]>(result_n);
+            for (SizeT i = 0; i < result_n; ++i) {
+                labels[i] = GetLabel(v_ptr[i]);
+            }
+            results.emplace_back(result_n, std::move(d_ptr), std::move(labels));
+        }
+        return results;
+    }
+
+    template <bool WithLock = false>
+    Vector<Tuple<SizeT, UniquePtr<DataType[]>, UniquePtr<LabelType[]>>> KnnSearchBatch(const DataType *queries, SizeT query_n, SizeT k) const {
+        return KnnSearchBatch<WithLock, NoneType>(queries, query_n, k, None);
+    }
+
     // function for test, add sort for convenience
     template <bool WithLock = false, FilterConcept<LabelType> Filter = NoneType>
     Vector<Pair<DataType, LabelType>> KnnSearchSorted(const DataType *q, SizeT k, const Filter &filter) const {
@@ -393,8 +452,12 @@ public:
 
     void SetEf(SizeT ef) { ef_ = ef; }
 
+    SizeT GetEf() const { return ef_; }
+
     SizeT GetVertexNum() const { return data_store_.cur_vec_num(); }
 
+    SizeT Dimension() const { return data_store_.dim(); }
+
     void Save(FileHandler &file_handler) {
         file_handler.Write(&M_, sizeof(M_));
         file_handler.Write(&ef_construction_, sizeof(ef_construction_));
@@ -416,6 +479,29 @@ public:
         return UniquePtr<This>(new This(M, Mmax, Mmax0, ef_construction, std::move(data_store), std::move(graph_store), std::move(distance), 0, 0));
     }
 
+    // Map the index file and search it in place instead of reading it into memory. The loaded index can not be inserted into.
+    static UniquePtr<This> LoadFromMmap(const String &path, DataStore::InitArgs args) {
+        auto mmap_region = MakeUnique<MmapRegion>(path);
+        MmapReader reader(mmap_region->data(), mmap_region->size());
+        SizeT M;
+        reader.Read(&M, sizeof(M));
+        SizeT ef_construction;
+        reader.Read(&ef_construction, sizeof(ef_construction));
+        auto [Mmax, Mmax0] = This::GetMmax(M);
+
+        auto data_store = DataStore::LoadFromMmap(reader, args);
+        auto graph_store = GraphStore::LoadFromMmap(reader, Mmax, Mmax0, data_store.cur_vec_num());
+        Distance distance(data_store.dim());
+
+        auto ret =
+            UniquePtr<This>(new This(M, Mmax, Mmax0, ef_construction, std::move(data_store), std::move(graph_store), std::move(distance), 0, 0));
+        ret->mmap_region_ = std::move(mmap_region);
+        return ret;
+    }
+
+    // Read the mapped index file into memory ahead of the searches. An index loaded into memory has nothing to do.
+    bool Prefault(bool lock) const { return mmap_region_.get() == nullptr || mmap_region_->Prefault(lock); }
+
     //---------------------------------------------- Following is the tmp debug function. ----------------------------------------------
     void Check() const { graph_store_.CheckGraph(data_store_.cur_vec_num(), Mmax0_, Mmax_); }
 
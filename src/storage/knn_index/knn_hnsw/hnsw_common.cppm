@@ -14,6 +14,8 @@
 
 module;
 
+#include <cstdint>
+#include <cstring>
 #include <limits>
 #include <utility>
 
@@ -22,6 +24,9 @@ export module hnsw_common;
 import stl;
 import file_system;
 import infinity_exception;
+import mmap;
+import third_party;
+import vector_distance;
 
 namespace infinity {
 export constexpr SizeT AlignTo(SizeT a, SizeT b) { return (a + b - 1) / b * b; }
@@ -51,6 +56,11 @@ concept LVQCacheConcept = requires(LVQCache) {
     { LVQCache::MakeGlobalCache(std::declval<const MeanType *>(), (SizeT)0) } -> std::same_as<typename LVQCache::GlobalCacheType>;
 };
 
+export template <typename PQMetric, typename DataType>
+concept PQMetricConcept = requires(PQMetric) {
+    { PQMetric::SubDistance(std::declval<const DataType *>(), std::declval<const DataType *>(), (SizeT)0) } -> std::same_as<DataType>;
+};
+
 export template <typename DataStore, typename DataType>
 concept DataStoreConcept = requires(DataStore s) {
     { DataStore::Make((SizeT)0, (SizeT)0, std::declval<typename DataStore::InitArgs>()) } -> std::same_as<DataStore>;
@@ -101,7 +111,8 @@ public:
         file_handler.Write(&dim_, sizeof(SizeT));
     }
 
-    static DataStoreMeta Load(FileHandler &file_handler, SizeT new_vec_n) {
+    template <typename Reader>
+    static DataStoreMeta Load(Reader &file_handler, SizeT new_vec_n) {
         SizeT cur_vec_num, max_vec_num, dim;
         file_handler.Read(&cur_vec_num, sizeof(SizeT));
         file_handler.Read(&max_vec_num, sizeof(SizeT));
@@ -117,6 +128,9 @@ public:
         return ret;
     }
 
+    // a store used in place in a mapped file can not grow
+    void ShrinkToFit() { max_vec_num_ = cur_vec_num_; }
+
 public:
     SizeT cur_vec_num() const { return cur_vec_num_; }
 
@@ -125,6 +139,77 @@ public:
     SizeT dim() const { return dim_; }
 };
 
+// Every section of an index file is padded to FILE_SECTION_ALIGN bytes, so a mapped file can be used in place.
+export constexpr SizeT FILE_SECTION_ALIGN = 8;
+
+export void WriteSectionPadding(FileHandler &file_handler, SizeT section_size) {
+    constexpr char zeros[FILE_SECTION_ALIGN]{};
+    if (SizeT padding = AlignTo(section_size, FILE_SECTION_ALIGN) - section_size; padding > 0) {
+        file_handler.Write(zeros, padding);
+    }
+}
+
+export template <typename Reader>
+void SkipSectionPadding(Reader &reader, SizeT section_size) {
+    char zeros[FILE_SECTION_ALIGN];
+    if (SizeT padding = AlignTo(section_size, FILE_SECTION_ALIGN) - section_size; padding > 0) {
+        reader.Read(zeros, padding);
+    }
+}
+
+// A read only mapping of a whole index file.
+export class MmapRegion {
+    u8 *data_ = nullptr;
+    SizeT len_ = 0;
+
+public:
+    explicit MmapRegion(const String &path) {
+        if (MmapFile(path, data_, len_) != 0) {
+            UnrecoverableError(fmt::format("Can't mmap index file: {}", path));
+        }
+    }
+
+    MmapRegion(const MmapRegion &) = delete;
+    MmapRegion &operator=(const MmapRegion &) = delete;
+
+    ~MmapRegion() { MunmapFile(data_, len_); }
+
+    const char *data() const { return reinterpret_cast<const char *>(data_); }
+
+    SizeT size() const { return len_; }
+
+    // Returns false if the pages couldn't be locked.
+    bool Prefault(bool lock) const { return MmapPrefault(data_, len_, lock) == 0; }
+};
+
+// Reads an index file from a mapping. Read copies like FileHandler::Read, View returns a pointer into the mapping.
+export class MmapReader {
+    const char *ptr_;
+    const char *const end_;
+
+    const char *Advance(SizeT nbytes) {
+        if (nbytes > SizeT(end_ - ptr_)) {
+            UnrecoverableError("Read past the end of the mapped index file");
+        }
+        const char *ret = ptr_;
+        ptr_ += nbytes;
+        return ret;
+    }
+
+public:
+    MmapReader(const char *ptr, SizeT len) : ptr_(ptr), end_(ptr + len) {}
+
+    void Read(void *data, SizeT nbytes) { std::memcpy(data, Advance(nbytes), nbytes); }
+
+    template <typename T>
+    const T *View(SizeT n) {
+        if (reinterpret_cast<uintptr_t>(ptr_) % alignof(T) != 0) {
+            UnrecoverableError("Misaligned section in the mapped index file");
+        }
+        return reinterpret_cast<const T *>(Advance(sizeof(T) * n));
+    }
+};
+
 export template <typename Iterator, typename DataType, typename LabelType>
 concept DataIteratorConcept = requires(Iterator iter) {
     { iter.Next() } -> std::same_as<Optional<Pair<DataType, LabelType>>>;
@@ -151,6 +236,26 @@ public:
     }
 };
 
+// The vectors of another iterator scaled to unit length, a vector is valid until the next call.
+export template <typename Iterator, typename DataType, typename LabelType>
+class NormalizedVectorIter {
+    Iterator iter_;
+    const SizeT dim_;
+    Vector<DataType> buffer_;
+
+public:
+    NormalizedVectorIter(Iterator iter, SizeT dim) : iter_(std::move(iter)), dim_(dim), buffer_(dim) {}
+
+    Optional<Pair<const DataType *, LabelType>> Next() {
+        auto vec_opt = iter_.Next();
+        if (!vec_opt.has_value()) {
+            return None;
+        }
+        L2Normalize(buffer_.data(), vec_opt->first, dim_);
+        return std::make_pair(static_cast<const DataType *>(buffer_.data()), vec_opt->second);
+    }
+};
+
 export template <typename LabelType>
 class FilterBase {
 public:
@@ -0,0 +1,84 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+module hnsw_mem_index;
+
+import stl;
+import index_hnsw;
+import abstract_hnsw;
+import hnsw_common;
+import internal_types;
+import local_file_system;
+import file_system;
+import file_system_type;
+
+namespace infinity {
+
+HnswMemIndex::HnswMemIndex(const IndexHnsw *index_hnsw, HnswEncodeType encode_type)
+    : index_hnsw_(index_hnsw->index_name_,
+                  index_hnsw->file_name_,
+                  index_hnsw->column_names_,
+                  index_hnsw->metric_type_,
+                  encode_type,
+                  index_hnsw->M_,
+                  index_hnsw->ef_construction_,
+                  index_hnsw->ef_) {}
+
+HnswMemIndex::HnswMemIndex(const IndexHnsw *index_hnsw, SizeT dimension, SizeT capacity, HnswEncodeType encode_type)
+    : HnswMemIndex(index_hnsw, encode_type) {
+    dimension_ = dimension;
+    AbstractHnsw<f32, SegmentOffset> abstract_hnsw(nullptr, &index_hnsw_);
+    abstract_hnsw.Make(capacity, dimension, index_hnsw_.M_, index_hnsw_.ef_construction_);
+    hnsw_ = abstract_hnsw.RawPtr();
+}
+
+SharedPtr<HnswMemIndex> HnswMemIndex::Load(const IndexHnsw *index_hnsw, const String &path, HnswEncodeType encode_type) {
+    SharedPtr<HnswMemIndex> mem_index(new HnswMemIndex(index_hnsw, encode_type));
+    AbstractHnsw<f32, SegmentOffset> abstract_hnsw(nullptr, &mem_index->index_hnsw_);
+    abstract_hnsw.LoadFromMmap(path);
+    mem_index->hnsw_ = abstract_hnsw.RawPtr();
+    mem_index->row_count_ = abstract_hnsw.GetVertexNum();
+    return mem_index;
+}
+
+HnswMemIndex::~HnswMemIndex() {
+    if (hnsw_ != nullptr) {
+        AbstractHnsw<f32, SegmentOffset>(hnsw_, &index_hnsw_).Free();
+    }
+}
+
+bool HnswMemIndex::Prefault(bool lock) const {
+    std::shared_lock lock_guard(rw_mutex_);
+    return AbstractHnsw<f32, SegmentOffset>(hnsw_, &index_hnsw_).Prefault(lock);
+}
+
+void HnswMemIndex::Insert(const f32 *data, SegmentOffset begin_offset, SizeT row_count) {
+    std::unique_lock lock(rw_mutex_);
+    AbstractHnsw<f32, SegmentOffset> abstract_hnsw(hnsw_, &index_hnsw_);
+    abstract_hnsw.InsertVecs(DenseVectorIter<f32, SegmentOffset>(data, dimension_, row_count, begin_offset), row_count);
+    row_count_ += row_count;
+}
+
+void HnswMemIndex::Dump(const String &path) const {
+    std::shared_lock lock(rw_mutex_);
+    LocalFileSystem fs;
+    UniquePtr<FileHandler> file_handler = fs.OpenFile(path, FileFlags::WRITE_FLAG | FileFlags::CREATE_FLAG, FileLockType::kWriteLock);
+    AbstractHnsw<f32, SegmentOffset>(hnsw_, &index_hnsw_).Save(*file_handler);
+    fs.SyncFile(*file_handler);
+    file_handler->Close();
+}
+
+} // namespace infinity
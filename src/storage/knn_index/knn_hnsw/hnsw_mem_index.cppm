@@ -0,0 +1,83 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module hnsw_mem_index;
+
+import stl;
+import index_hnsw;
+import abstract_hnsw;
+import hnsw_common;
+import internal_types;
+
+namespace infinity {
+
+// A hnsw chunk over the rows appended to a segment after its index was built. The mutable chunk takes the rows at commit time,
+// a full chunk is dumped to a file and searched read only from then on. Appended chunks keep full precision vectors whatever the
+// encoding of the segment index is, a pq codebook or a lvq mean trained on the first few appended rows would fit the rest badly.
+// A chunk built in one pass, as a rebuild of the segment index is, can keep the encoding.
+export class HnswMemIndex {
+public:
+    HnswMemIndex(const IndexHnsw *index_hnsw, SizeT dimension, SizeT capacity, HnswEncodeType encode_type = HnswEncodeType::kPlain);
+
+    // Map a dumped chunk.
+    static SharedPtr<HnswMemIndex> Load(const IndexHnsw *index_hnsw, const String &path, HnswEncodeType encode_type = HnswEncodeType::kPlain);
+
+    ~HnswMemIndex();
+
+    // Insert `row_count` vectors labeled with the segment offsets from `begin_offset`.
+    void Insert(const f32 *data, SegmentOffset begin_offset, SizeT row_count);
+
+    // Insert at most `max_row_count` vectors from `iter` with their labels.
+    template <DataIteratorConcept<const f32 *, SegmentOffset> Iterator>
+    void Build(Iterator &&iter, SizeT max_row_count) {
+        std::unique_lock lock(rw_mutex_);
+        AbstractHnsw<f32, SegmentOffset> abstract_hnsw(hnsw_, &index_hnsw_);
+        abstract_hnsw.StoreData(std::move(iter), max_row_count);
+        abstract_hnsw.BuildRange(row_count_, abstract_hnsw.GetVertexNum());
+        row_count_ = abstract_hnsw.GetVertexNum();
+    }
+
+    void Dump(const String &path) const;
+
+    template <typename... Filter>
+    Vector<Tuple<SizeT, UniquePtr<f32[]>, UniquePtr<SegmentOffset[]>>>
+    KnnSearchBatch(const f32 *queries, SizeT query_n, SizeT k, const Filter &...filter) const {
+        std::shared_lock lock(rw_mutex_);
+        AbstractHnsw<f32, SegmentOffset> abstract_hnsw(hnsw_, &index_hnsw_);
+        return abstract_hnsw.template KnnSearchBatch<false>(queries, query_n, k, filter...);
+    }
+
+    SizeT row_count() const {
+        std::shared_lock lock(rw_mutex_);
+        return row_count_;
+    }
+
+    HnswEncodeType encode_type() const { return index_hnsw_.encode_type_; }
+
+    // Read a dumped chunk into memory, with lock it stays there. Returns false if it couldn't be locked.
+    bool Prefault(bool lock) const;
+
+private:
+    HnswMemIndex(const IndexHnsw *index_hnsw, HnswEncodeType encode_type);
+
+    const IndexHnsw index_hnsw_; // the index definition with the encoding of the chunk
+    void *hnsw_{};
+    SizeT dimension_{};
+    SizeT row_count_{};
+    mutable std::shared_mutex rw_mutex_{};
+};
+
+} // namespace infinity
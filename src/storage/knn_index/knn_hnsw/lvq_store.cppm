@@ -24,6 +24,7 @@ import hnsw_common;
 import file_system;
 import plain_store;
 import infinity_exception;
+import huge_page_allocator;
 
 export module lvq_store;
 
@@ -70,11 +71,14 @@ private:
     const SizeT compress_data_size_;
 
     char *ptr_;
+    // false when ptr_ points into the mapped index file
+    bool own_ptr_;
 
     const SizeT buffer_plain_size_;
     PlainStore plain_data_;
 
     UniquePtr<LabelType[]> labels_;
+    const LabelType *label_view_;
 
 private:
     constexpr GlobalCacheType *GetGlobalCacheMut() { return reinterpret_cast<GlobalCacheType *>(ptr_ + global_cache_offset_); }
@@ -117,52 +121,77 @@ public:
     SizeT dim() const { return meta_.dim(); }
 
 private:
-    LVQStore(DataStoreMeta meta, This::InitArgs init_args)
-        : meta_(std::move(meta)),                                                                                                                 //
-          compress_data_offset_(AlignTo(mean_offset_ + dim() * sizeof(MeanType), PADDING_SIZE)),                                                  //
-          compress_data_size_(AlignTo(compress_vec_offset_ + sizeof(CompressType) * dim(), PADDING_SIZE)),                                        //
-          ptr_(static_cast<char *>(operator new[](compress_data_offset_ + compress_data_size_ * max_vec_num(), std::align_val_t(PADDING_SIZE)))), //
-          buffer_plain_size_(init_args),                                                                                                          //
-          plain_data_(PlainStore::Make(0, dim())),                                                                                                //
-          labels_(MakeUnique<LabelType[]>(max_vec_num()))                                                                                         //
+    LVQStore(DataStoreMeta meta, This::InitArgs init_args, bool allocate = true)
+        : meta_(std::move(meta)),                                                                                             //
+          compress_data_offset_(AlignTo(mean_offset_ + dim() * sizeof(MeanType), PADDING_SIZE)),                              //
+          compress_data_size_(AlignTo(compress_vec_offset_ + sizeof(CompressType) * dim(), PADDING_SIZE)),                    //
+          ptr_(allocate ? static_cast<char *>(HugePageAllocator::Allocate(DataSize(max_vec_num()), PADDING_SIZE)) : nullptr), //
+          own_ptr_(allocate),                                                                                                 //
+          buffer_plain_size_(init_args),                                                                                      //
+          plain_data_(PlainStore::Make(0, dim())),                                                                            //
+          labels_(allocate ? MakeUnique<LabelType[]>(max_vec_num()) : nullptr),                                               //
+          label_view_(labels_.get())                                                                                          //
     {}
 
+    SizeT DataSize(SizeT vec_num) const { return compress_data_offset_ + compress_data_size_ * vec_num; }
+
 public:
     static This Make(SizeT max_vec_num, SizeT dim, This::InitArgs init_args) {
         DataStoreMeta meta(max_vec_num, dim);
         auto ret = This(std::move(meta), std::move(init_args));
-        std::fill(ret.ptr_, ret.ptr_ + ret.compress_data_offset_ + ret.compress_data_size_ * ret.max_vec_num(), 0);
+        std::fill(ret.ptr_, ret.ptr_ + ret.DataSize(ret.max_vec_num()), 0);
         return ret;
     }
 
     LVQStore(This &&other)
-        : meta_(std::move(other.meta_)),                    //
-          compress_data_offset_(other.compress_data_size_), //
-          compress_data_size_(other.compress_data_offset_), //
-          ptr_(std::exchange(other.ptr_, nullptr)),         //
-          buffer_plain_size_(other.buffer_plain_size_),     //
-          plain_data_(std::move(other.plain_data_)),        //
-          labels_(std::move(other.labels_))                 //
+        : meta_(std::move(other.meta_)),                      //
+          compress_data_offset_(other.compress_data_offset_), //
+          compress_data_size_(other.compress_data_size_),     //
+          ptr_(std::exchange(other.ptr_, nullptr)),           //
+          own_ptr_(other.own_ptr_),                           //
+          buffer_plain_size_(other.buffer_plain_size_),       //
+          plain_data_(std::move(other.plain_data_)),          //
+          labels_(std::move(other.labels_)),                  //
+          label_view_(other.label_view_)                      //
     {}
 
     ~LVQStore() {
-        if (ptr_ != nullptr) {
-            operator delete[](ptr_, std::align_val_t(PADDING_SIZE));
+        if (ptr_ != nullptr && own_ptr_) {
+            HugePageAllocator::Deallocate(ptr_, DataSize(max_vec_num()), PADDING_SIZE);
         }
     }
 
     void Save(FileHandler &file_handler) {
-        Compress();
+        // a loaded store has nothing outside the compressed data, and may be a read only mapping
+        if (plain_data_.cur_vec_num() > 0) {
+            Compress();
+        }
         meta_.Save(file_handler);
-        file_handler.Write(ptr_, compress_data_offset_ + compress_data_size_ * cur_vec_num());
-        file_handler.Write(labels_.get(), sizeof(LabelType) * cur_vec_num());
+        file_handler.Write(ptr_, DataSize(cur_vec_num()));
+        SizeT labels_size = sizeof(LabelType) * cur_vec_num();
+        file_handler.Write(label_view_, labels_size);
+        WriteSectionPadding(file_handler, labels_size);
     }
 
     static This Load(FileHandler &file_handler, SizeT max_vec_num, This::InitArgs init_args) {
         DataStoreMeta meta = DataStoreMeta::Load(file_handler, max_vec_num);
         auto ret = This(std::move(meta), std::move(init_args));
-        file_handler.Read(ret.ptr_, ret.compress_data_offset_ + ret.compress_data_size_ * ret.cur_vec_num());
-        file_handler.Read(ret.labels_.get(), sizeof(LabelType) * ret.cur_vec_num());
+        file_handler.Read(ret.ptr_, ret.DataSize(ret.cur_vec_num()));
+        SizeT labels_size = sizeof(LabelType) * ret.cur_vec_num();
+        file_handler.Read(ret.labels_.get(), labels_size);
+        SkipSectionPadding(file_handler, labels_size);
+        return ret;
+    }
+
+    static This LoadFromMmap(MmapReader &reader, This::InitArgs init_args) {
+        DataStoreMeta meta = DataStoreMeta::Load(reader, 0);
+        meta.ShrinkToFit();
+        auto ret = This(std::move(meta), std::move(init_args), false);
+        // the data size is a multiple of PADDING_SIZE, view it as the mean type to check the alignment of the mean vector
+        SizeT data_size = ret.DataSize(ret.cur_vec_num());
+        ret.ptr_ = const_cast<char *>(reinterpret_cast<const char *>(reader.View<MeanType>(data_size / sizeof(MeanType))));
+        ret.label_view_ = reader.View<LabelType>(ret.cur_vec_num());
+        SkipSectionPadding(reader, sizeof(LabelType) * ret.cur_vec_num());
         return ret;
     }
 
@@ -308,7 +337,7 @@ public:
 
     LabelType GetLabel(VertexType vec_i) const {
         if ((SizeT)vec_i < meta_.cur_vec_num()) {
-            return labels_[vec_i];
+            return label_view_[vec_i];
         }
         return plain_data_.GetLabel(vec_i - meta_.cur_vec_num());
     }
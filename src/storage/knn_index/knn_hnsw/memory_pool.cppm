@@ -122,6 +122,36 @@ struct PooledMaxHeapFunctor {
 
 export using VisitedMemPool = MemPool<PooledVectorBoolFunctor, SizeT, SizeT>;
 
+// Visited marks of a graph search. A vertex is visited if its tag equals the epoch of the current search, so starting
+// a new search only bumps the epoch. The tags are cleared once every 65535 searches when the epoch wraps around.
+export class VisitedTable {
+public:
+    // start a search over the first `vertex_n` vertices
+    void Reset(SizeT vertex_n) {
+        if (tags_.size() < vertex_n) {
+            tags_.resize(vertex_n, 0);
+        }
+        if (++epoch_ == 0) {
+            std::fill(tags_.begin(), tags_.end(), 0);
+            epoch_ = 1;
+        }
+    }
+
+    bool Visited(SizeT vertex_idx) const { return tags_[vertex_idx] == epoch_; }
+
+    void Visit(SizeT vertex_idx) { tags_[vertex_idx] = epoch_; }
+
+private:
+    Vector<u16> tags_{};
+    u16 epoch_{0};
+};
+
+// One table per thread, reused by all searches and inserts on the thread.
+export VisitedTable &ThreadLocalVisitedTable() {
+    thread_local VisitedTable visited_table;
+    return visited_table;
+}
+
 export template <typename T, typename C>
 using MaxHeapMemPool = MemPool<PooledMaxHeapFunctor<T, C>>;
 
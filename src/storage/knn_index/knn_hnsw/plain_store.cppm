@@ -38,6 +38,12 @@ private:
     DataStoreMeta meta_;
     UniquePtr<DataType[]> ptr_;
     UniquePtr<LabelType[]> labels_;
+    // point into ptr_ and labels_, or into the mapped index file
+    const DataType *vecs_;
+    const LabelType *label_view_;
+
+    PlainStore(DataStoreMeta meta, const DataType *vecs, const LabelType *labels)
+        : meta_(std::move(meta)), vecs_(vecs), label_view_(labels) {}
 
 public:
     static This Make(SizeT max_vec_num, SizeT dim, This::InitArgs = {}) {
@@ -47,20 +53,41 @@ public:
 
     PlainStore(DataStoreMeta meta)
         : meta_(std::move(meta)), ptr_(MakeUnique<DataType[]>(meta_.max_vec_num() * meta_.dim())),
-          labels_(MakeUnique<LabelType[]>(meta_.max_vec_num())) {}
+          labels_(MakeUnique<LabelType[]>(meta_.max_vec_num())), vecs_(ptr_.get()), label_view_(labels_.get()) {}
 
     void Save(FileHandler &file_handler) const {
         meta_.Save(file_handler);
-        file_handler.Write(ptr_.get(), sizeof(DataType) * cur_vec_num() * dim());
+        SizeT vecs_size = sizeof(DataType) * cur_vec_num() * dim();
+        file_handler.Write(vecs_, vecs_size);
+        WriteSectionPadding(file_handler, vecs_size);
+        SizeT labels_size = sizeof(LabelType) * cur_vec_num();
+        file_handler.Write(label_view_, labels_size);
+        WriteSectionPadding(file_handler, labels_size);
     }
 
     static This Load(FileHandler &file_handler, SizeT max_vec_num, This::InitArgs = {}) {
         DataStoreMeta meta = DataStoreMeta::Load(file_handler, max_vec_num);
         This ret(std::move(meta));
-        file_handler.Read(ret.ptr_.get(), sizeof(DataType) * ret.cur_vec_num() * ret.dim());
+        SizeT vecs_size = sizeof(DataType) * ret.cur_vec_num() * ret.dim();
+        file_handler.Read(ret.ptr_.get(), vecs_size);
+        SkipSectionPadding(file_handler, vecs_size);
+        SizeT labels_size = sizeof(LabelType) * ret.cur_vec_num();
+        file_handler.Read(ret.labels_.get(), labels_size);
+        SkipSectionPadding(file_handler, labels_size);
         return ret;
     }
 
+    static This LoadFromMmap(MmapReader &reader, This::InitArgs = {}) {
+        DataStoreMeta meta = DataStoreMeta::Load(reader, 0);
+        meta.ShrinkToFit();
+        SizeT vec_n = meta.cur_vec_num();
+        const DataType *vecs = reader.View<DataType>(vec_n * meta.dim());
+        SkipSectionPadding(reader, sizeof(DataType) * vec_n * meta.dim());
+        const LabelType *labels = reader.View<LabelType>(vec_n);
+        SkipSectionPadding(reader, sizeof(LabelType) * vec_n);
+        return This(std::move(meta), vecs, labels);
+    }
+
 public:
     SizeT cur_vec_num() const { return meta_.cur_vec_num(); }
     SizeT max_vec_num() const { return meta_.max_vec_num(); }
@@ -96,7 +123,7 @@ public:
 
     StoreType GetVec(SizeT vec_i) const {
         assert(vec_i < cur_vec_num());
-        return ptr_.get() + vec_i * dim();
+        return vecs_ + vec_i * dim();
     }
 
     QueryType MakeQuery(const DataType *vec) const { return vec; }
@@ -105,7 +132,7 @@ public:
         if ((SizeT)vec_i >= cur_vec_num()) {
             UnrecoverableError("vec_i is out of range");
         }
-        return labels_[vec_i];
+        return label_view_[vec_i];
     }
 
     void Prefetch(SizeT vec_i) const { _mm_prefetch(reinterpret_cast<const char *>(GetVec(vec_i)), _MM_HINT_T0); }
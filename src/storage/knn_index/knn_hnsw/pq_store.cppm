@@ -0,0 +1,308 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <type_traits>
+#include <utility>
+#include <xmmintrin.h>
+
+import stl;
+import hnsw_common;
+import file_system;
+import infinity_exception;
+import default_values;
+
+export module pq_store;
+
+namespace infinity {
+
+// Product quantization: the vector is split into subspaces of PQ_SUBSPACE_DIM dimensions (the last one may be shorter), and every
+// subspace is replaced by the id of its nearest centroid. The centroids are trained with k-means on the first vectors added.
+// A query keeps a table of its distance to every centroid, so its distance to a stored vector is a sum of table lookups.
+export template <typename DataType, typename LabelType, PQMetricConcept<DataType> PQMetric>
+class PQStore {
+public:
+    static_assert(PQ_CENTROID_NUM == 256, "PQ code is one byte");
+
+    using This = PQStore<DataType, LabelType, PQMetric>;
+    using InitArgs = Tuple<>;
+    using CodeType = u8;
+    class PQData;
+    using StoreType = PQData;
+    struct QueryPQ;
+    using QueryType = QueryPQ;
+
+    struct QueryPQ {
+        const UniquePtr<DataType[]> table_;
+    };
+
+    class PQData {
+        const CodeType *codes_ = nullptr;
+        const DataType *table_ = nullptr;
+
+    public:
+        PQData(const CodeType *codes) : codes_(codes) {}
+
+        PQData(const QueryPQ &query) : table_(query.table_.get()) {}
+
+        const CodeType *codes() const { return codes_; }
+
+        // distance table of a query, nullptr for a stored vector
+        const DataType *table() const { return table_; }
+    };
+
+private:
+    DataStoreMeta meta_;
+    const SizeT subspace_num_;
+    bool trained_ = false;
+
+    UniquePtr<DataType[]> codebook_; // centroids of subspace i are in front of those of subspace i + 1
+    UniquePtr<CodeType[]> codes_;
+    UniquePtr<LabelType[]> labels_;
+    // point into the buffers above, or into the mapped index file
+    const DataType *codebook_view_;
+    const CodeType *code_view_;
+    const LabelType *label_view_;
+
+    PQStore(DataStoreMeta meta, bool allocate = true)
+        : meta_(std::move(meta)), subspace_num_((meta_.dim() + PQ_SUBSPACE_DIM - 1) / PQ_SUBSPACE_DIM),
+          codebook_(allocate ? MakeUnique<DataType[]>(PQ_CENTROID_NUM * meta_.dim()) : nullptr),
+          codes_(allocate ? MakeUnique<CodeType[]>(meta_.max_vec_num() * subspace_num_) : nullptr),
+          labels_(allocate ? MakeUnique<LabelType[]>(meta_.max_vec_num()) : nullptr), codebook_view_(codebook_.get()), code_view_(codes_.get()),
+          label_view_(labels_.get()) {}
+
+    SizeT SubBegin(SizeT sub_i) const { return sub_i * PQ_SUBSPACE_DIM; }
+
+    SizeT SubLen(SizeT sub_i) const { return std::min(PQ_SUBSPACE_DIM, dim() - SubBegin(sub_i)); }
+
+    const DataType *Centroids(SizeT sub_i) const { return codebook_view_ + PQ_CENTROID_NUM * SubBegin(sub_i); }
+
+public:
+    static This Make(SizeT max_vec_num, SizeT dim, This::InitArgs = {}) {
+        DataStoreMeta meta(max_vec_num, dim);
+        return This(std::move(meta));
+    }
+
+    void Save(FileHandler &file_handler) const {
+        meta_.Save(file_handler);
+        file_handler.Write(&trained_, sizeof(trained_));
+        WriteSectionPadding(file_handler, sizeof(trained_));
+        file_handler.Write(codebook_view_, sizeof(DataType) * PQ_CENTROID_NUM * dim());
+        SizeT codes_size = sizeof(CodeType) * cur_vec_num() * subspace_num_;
+        file_handler.Write(code_view_, codes_size);
+        WriteSectionPadding(file_handler, codes_size);
+        SizeT labels_size = sizeof(LabelType) * cur_vec_num();
+        file_handler.Write(label_view_, labels_size);
+        WriteSectionPadding(file_handler, labels_size);
+    }
+
+    static This Load(FileHandler &file_handler, SizeT max_vec_num, This::InitArgs = {}) {
+        DataStoreMeta meta = DataStoreMeta::Load(file_handler, max_vec_num);
+        This ret(std::move(meta));
+        file_handler.Read(&ret.trained_, sizeof(ret.trained_));
+        SkipSectionPadding(file_handler, sizeof(ret.trained_));
+        file_handler.Read(ret.codebook_.get(), sizeof(DataType) * PQ_CENTROID_NUM * ret.dim());
+        SizeT codes_size = sizeof(CodeType) * ret.cur_vec_num() * ret.subspace_num_;
+        file_handler.Read(ret.codes_.get(), codes_size);
+        SkipSectionPadding(file_handler, codes_size);
+        SizeT labels_size = sizeof(LabelType) * ret.cur_vec_num();
+        file_handler.Read(ret.labels_.get(), labels_size);
+        SkipSectionPadding(file_handler, labels_size);
+        return ret;
+    }
+
+    static This LoadFromMmap(MmapReader &reader, This::InitArgs = {}) {
+        DataStoreMeta meta = DataStoreMeta::Load(reader, 0);
+        meta.ShrinkToFit();
+        This ret(std::move(meta), false);
+        reader.Read(&ret.trained_, sizeof(ret.trained_));
+        SkipSectionPadding(reader, sizeof(ret.trained_));
+        ret.codebook_view_ = reader.View<DataType>(PQ_CENTROID_NUM * ret.dim());
+        ret.code_view_ = reader.View<CodeType>(ret.cur_vec_num() * ret.subspace_num_);
+        SkipSectionPadding(reader, sizeof(CodeType) * ret.cur_vec_num() * ret.subspace_num_);
+        ret.label_view_ = reader.View<LabelType>(ret.cur_vec_num());
+        SkipSectionPadding(reader, sizeof(LabelType) * ret.cur_vec_num());
+        return ret;
+    }
+
+public:
+    SizeT cur_vec_num() const { return meta_.cur_vec_num(); }
+    SizeT max_vec_num() const { return meta_.max_vec_num(); }
+    SizeT dim() const { return meta_.dim(); }
+    SizeT subspace_num() const { return subspace_num_; }
+
+private:
+    static CodeType NearestCentroid(const DataType *sub_vec, const DataType *centroids, SizeT len) {
+        CodeType nearest = 0;
+        DataType nearest_dist = std::numeric_limits<DataType>::max();
+        for (SizeT c = 0; c < PQ_CENTROID_NUM; ++c) {
+            const DataType *centroid = centroids + c * len;
+            DataType dist = 0;
+            for (SizeT j = 0; j < len; ++j) {
+                DataType diff = sub_vec[j] - centroid[j];
+                dist += diff * diff;
+            }
+            if (dist < nearest_dist) {
+                nearest_dist = dist;
+                nearest = c;
+            }
+        }
+        return nearest;
+    }
+
+    static void KMeans(const DataType *data, SizeT n, SizeT len, DataType *centroids, std::mt19937 &rng) {
+        Vector<SizeT> perm(n);
+        std::iota(perm.begin(), perm.end(), 0);
+        std::shuffle(perm.begin(), perm.end(), rng);
+        // with fewer samples than centroids, some centroids repeat and stay empty
+        for (SizeT c = 0; c < PQ_CENTROID_NUM; ++c) {
+            Copy(data + perm[c % n] * len, data + (perm[c % n] + 1) * len, centroids + c * len);
+        }
+        Vector<SizeT> counts(PQ_CENTROID_NUM);
+        Vector<DataType> sums(PQ_CENTROID_NUM * len);
+        for (SizeT iter = 0; iter < PQ_KMEANS_ITER; ++iter) {
+            std::fill(counts.begin(), counts.end(), 0);
+            std::fill(sums.begin(), sums.end(), 0);
+            for (SizeT i = 0; i < n; ++i) {
+                const DataType *vec = data + i * len;
+                CodeType c = NearestCentroid(vec, centroids, len);
+                ++counts[c];
+                for (SizeT j = 0; j < len; ++j) {
+                    sums[c * len + j] += vec[j];
+                }
+            }
+            for (SizeT c = 0; c < PQ_CENTROID_NUM; ++c) {
+                if (counts[c] == 0) {
+                    continue;
+                }
+                for (SizeT j = 0; j < len; ++j) {
+                    centroids[c * len + j] = sums[c * len + j] / counts[c];
+                }
+            }
+        }
+    }
+
+    template <DataIteratorConcept<const DataType *, LabelType> Iterator>
+    void Train(Iterator &&train_iter) {
+        Vector<DataType> samples;
+        SizeT sample_n = 0;
+        while (sample_n < PQ_TRAIN_SAMPLE_NUM) {
+            auto vec_opt = train_iter.Next();
+            if (!vec_opt.has_value()) {
+                break;
+            }
+            const DataType *vec = vec_opt->first;
+            samples.insert(samples.end(), vec, vec + dim());
+            ++sample_n;
+        }
+        if (sample_n == 0) {
+            return;
+        }
+        std::mt19937 rng(0);
+        Vector<DataType> sub_samples(sample_n * PQ_SUBSPACE_DIM);
+        for (SizeT sub_i = 0; sub_i < subspace_num_; ++sub_i) {
+            SizeT begin = SubBegin(sub_i);
+            SizeT len = SubLen(sub_i);
+            for (SizeT i = 0; i < sample_n; ++i) {
+                Copy(samples.data() + i * dim() + begin, samples.data() + i * dim() + begin + len, sub_samples.data() + i * len);
+            }
+            KMeans(sub_samples.data(), sample_n, len, codebook_.get() + PQ_CENTROID_NUM * begin, rng);
+        }
+        trained_ = true;
+    }
+
+    void Encode(const DataType *vec, CodeType *codes) const {
+        for (SizeT sub_i = 0; sub_i < subspace_num_; ++sub_i) {
+            codes[sub_i] = NearestCentroid(vec + SubBegin(sub_i), Centroids(sub_i), SubLen(sub_i));
+        }
+    }
+
+public:
+    SizeT AddVec(const DataType *vec, SizeT vec_num) {
+        return AddVec(DenseVectorIter<DataType, LabelType>(vec, dim(), vec_num, meta_.cur_vec_num()), vec_num);
+    }
+
+    template <DataIteratorConcept<const DataType *, LabelType> Iterator>
+    SizeT AddVec(Iterator &&query_iter, SizeT vec_num) {
+        if (!trained_) {
+            std::remove_cvref_t<Iterator> train_iter = query_iter; // copy here
+            Train(std::move(train_iter));
+        }
+        SizeT new_idx = meta_.AllocateVec(vec_num);
+
+        SizeT actual_size = 0;
+        while (true) {
+            auto vec_opt = query_iter.Next();
+            if (!vec_opt.has_value()) {
+                break;
+            }
+            if (actual_size == vec_num) {
+                UnrecoverableError("vec_num is too small");
+            }
+            const auto &[vec, label] = vec_opt.value();
+            Encode(vec, codes_.get() + (new_idx + actual_size) * subspace_num_);
+            labels_[new_idx + actual_size] = label;
+            ++actual_size;
+        }
+        meta_.ReturnNotUsed(vec_num - actual_size);
+
+        return new_idx;
+    }
+
+    StoreType GetVec(SizeT vec_i) const {
+        if (vec_i >= cur_vec_num()) {
+            UnrecoverableError("Get Vec error");
+        }
+        return PQData(code_view_ + vec_i * subspace_num_);
+    }
+
+    void Prefetch(SizeT vec_i) const { _mm_prefetch(reinterpret_cast<const char *>(code_view_ + vec_i * subspace_num_), _MM_HINT_T0); }
+
+    QueryType MakeQuery(const DataType *vec) const {
+        auto table = MakeUniqueForOverwrite<DataType[]>(subspace_num_ * PQ_CENTROID_NUM);
+        for (SizeT sub_i = 0; sub_i < subspace_num_; ++sub_i) {
+            SizeT len = SubLen(sub_i);
+            const DataType *centroids = Centroids(sub_i);
+            for (SizeT c = 0; c < PQ_CENTROID_NUM; ++c) {
+                table[sub_i * PQ_CENTROID_NUM + c] = PQMetric::SubDistance(vec + SubBegin(sub_i), centroids + c * len, len);
+            }
+        }
+        return QueryType{std::move(table)};
+    }
+
+    // distance between two stored vectors, used when linking vertices during the build
+    DataType SymmetricDistance(const CodeType *codes1, const CodeType *codes2) const {
+        DataType res = 0;
+        for (SizeT sub_i = 0; sub_i < subspace_num_; ++sub_i) {
+            SizeT len = SubLen(sub_i);
+            const DataType *centroids = Centroids(sub_i);
+            res += PQMetric::SubDistance(centroids + codes1[sub_i] * len, centroids + codes2[sub_i] * len, len);
+        }
+        return res;
+    }
+
+    LabelType GetLabel(VertexType vec_i) const {
+        if ((SizeT)vec_i >= cur_vec_num()) {
+            UnrecoverableError("vec_i is out of range");
+        }
+        return label_view_[vec_i];
+    }
+};
+
+} // namespace infinity
@@ -22,9 +22,10 @@ export module hnsw_simd_func;
 
 namespace infinity {
 
+#if defined(USE_AVX)
 // for debug
 template <typename T>
-void log_m256(const __m256i &value) {
+SIMD_TARGET("avx2") void log_m256(const __m256i &value) {
     const size_t n = sizeof(__m256i) / sizeof(T);
     T buffer[n];
     _mm256_storeu_si256((__m256i_u *)buffer, value);
@@ -37,6 +38,7 @@ void log_m256(const __m256i &value) {
     }
     std::cout << "]" << std::endl;
 }
+#endif
 
 export int32_t I8IPBF(const int8_t *pv1, const int8_t *pv2, size_t dim) {
     int32_t res = 0;
@@ -47,7 +49,7 @@ export int32_t I8IPBF(const int8_t *pv1, const int8_t *pv2, size_t dim) {
 }
 
 #if defined(USE_AVX512)
-export int32_t I8IPAVX512(const int8_t *pv1, const int8_t *pv2, size_t dim) {
+export SIMD_TARGET("avx512f,avx512bw") int32_t I8IPAVX512(const int8_t *pv1, const int8_t *pv2, size_t dim) {
     size_t dim64 = dim >> 6;
     const int8_t *pend1 = pv1 + (dim64 << 6);
 
@@ -73,19 +75,46 @@ export int32_t I8IPAVX512(const int8_t *pv1, const int8_t *pv2, size_t dim) {
     return _mm512_reduce_add_epi32(sum);
 }
 
-export int32_t I8IPAVX512Residual(const int8_t *pv1, const int8_t *pv2, size_t dim) {
+export SIMD_TARGET("avx512f,avx512bw") int32_t I8IPAVX512Residual(const int8_t *pv1, const int8_t *pv2, size_t dim) {
     return I8IPAVX512(pv1, pv2, dim) + I8IPBF(pv1 + (dim & ~63), pv2 + (dim & ~63), dim & 63);
 }
+
+// vpdpbusd takes unsigned bytes on one side, so v1 is split into its low 7 bits and its sign bit as in I8IPAVX512.
+// It sums into i32 lanes directly, without the i16 step of maddubs.
+export SIMD_TARGET("avx512f,avx512bw,avx512vnni") int32_t I8IPAVX512VNNI(const int8_t *pv1, const int8_t *pv2, size_t dim) {
+    size_t dim64 = dim >> 6;
+    const int8_t *pend1 = pv1 + (dim64 << 6);
+
+    __m512i v1, v2;
+    __m512i low7_sum = _mm512_setzero_si512();
+    __m512i msb_sum = _mm512_setzero_si512();
+    const __m512i highest_bit = _mm512_set1_epi8(0x80);
+    while (pv1 < pend1) {
+        v1 = _mm512_loadu_si512((__m512i_u *)pv1);
+        pv1 += 64;
+        v2 = _mm512_loadu_si512((__m512i_u *)pv2);
+        pv2 += 64;
+
+        low7_sum = _mm512_dpbusd_epi32(low7_sum, _mm512_andnot_si512(highest_bit, v1), v2);
+        msb_sum = _mm512_dpbusd_epi32(msb_sum, _mm512_and_si512(v1, highest_bit), v2);
+    }
+
+    return _mm512_reduce_add_epi32(_mm512_sub_epi32(low7_sum, msb_sum));
+}
+
+export SIMD_TARGET("avx512f,avx512bw,avx512vnni") int32_t I8IPAVX512VNNIResidual(const int8_t *pv1, const int8_t *pv2, size_t dim) {
+    return I8IPAVX512VNNI(pv1, pv2, dim) + I8IPBF(pv1 + (dim & ~63), pv2 + (dim & ~63), dim & 63);
+}
 #endif
 
 #if defined(USE_AVX)
-export int32_t I8IPAVX(const int8_t *pv1, const int8_t *pv2, size_t dim) {
+export SIMD_TARGET("avx2") int32_t I8IPAVX(const int8_t *pv1, const int8_t *pv2, size_t dim) {
     size_t dim32 = dim >> 5;
     const int8_t *pend1 = pv1 + (dim32 << 5);
 
     __m256i v1, v2, msb, low7;
-    __m256i sum = _mm256_set1_ps(0);
-    const __m256 highest_bit = _mm256_set1_epi8(0x80);
+    __m256i sum = _mm256_setzero_si256();
+    const __m256i highest_bit = _mm256_set1_epi8(0x80);
     while (pv1 < pend1) {
         v1 = _mm256_loadu_si256((__m256i_u *)pv1);
         pv1 += 32;
@@ -109,20 +138,20 @@ export int32_t I8IPAVX(const int8_t *pv1, const int8_t *pv2, size_t dim) {
     return _mm256_extract_epi32(sum, 0) + _mm256_extract_epi32(sum, 4);
 }
 
-export int32_t I8IPAVXResidual(const int8_t *pv1, const int8_t *pv2, size_t dim) {
+export SIMD_TARGET("avx2") int32_t I8IPAVXResidual(const int8_t *pv1, const int8_t *pv2, size_t dim) {
     return I8IPAVX(pv1, pv2, dim) + I8IPBF(pv1 + (dim & ~31), pv2 + (dim & ~31), dim & 31);
 }
 
 #endif
 
 #if defined(USE_SSE)
-export int32_t I8IPSSE(const int8_t *pv1, const int8_t *pv2, size_t dim) {
+export SIMD_TARGET("ssse3,sse4.1") int32_t I8IPSSE(const int8_t *pv1, const int8_t *pv2, size_t dim) {
     size_t dim16 = dim >> 4;
     const int8_t *pend1 = pv1 + (dim16 << 4);
 
     __m128i v1, v2, msb, low7;
-    __m128i sum = _mm_set1_ps(0);
-    const __m128 highest_bit = _mm_set1_epi8(0x80);
+    __m128i sum = _mm_setzero_si128();
+    const __m128i highest_bit = _mm_set1_epi8(0x80);
     while (pv1 < pend1) {
         v1 = _mm_loadu_si128((__m128i_u *)pv1);
         pv1 += 16;
@@ -146,12 +175,38 @@ export int32_t I8IPSSE(const int8_t *pv1, const int8_t *pv2, size_t dim) {
     return _mm_extract_epi32(sum, 0);
 }
 
-export int32_t I8IPSSEResidual(const int8_t *pv1, const int8_t *pv2, size_t dim) {
+export SIMD_TARGET("ssse3,sse4.1") int32_t I8IPSSEResidual(const int8_t *pv1, const int8_t *pv2, size_t dim) {
     return I8IPSSE(pv1, pv2, dim) + I8IPBF(pv1 + (dim & ~15), pv2 + (dim & ~15), dim & 15);
 }
 
 #endif
 
+#if defined(USE_NEON)
+export int32_t I8IPNEON(const int8_t *pv1, const int8_t *pv2, size_t dim) {
+    size_t dim16 = dim >> 4;
+    const int8_t *pend1 = pv1 + (dim16 << 4);
+
+    int32x4_t sum = vdupq_n_s32(0);
+    while (pv1 < pend1) {
+        int8x16_t v1 = vld1q_s8(pv1);
+        pv1 += 16;
+        int8x16_t v2 = vld1q_s8(pv2);
+        pv2 += 16;
+
+        // a product of two i8 fits in i16, pairs of them are added into the i32 lanes
+        sum = vpadalq_s16(sum, vmull_s8(vget_low_s8(v1), vget_low_s8(v2)));
+        sum = vpadalq_s16(sum, vmull_high_s8(v1, v2));
+    }
+
+    return vaddvq_s32(sum);
+}
+
+export int32_t I8IPNEONResidual(const int8_t *pv1, const int8_t *pv2, size_t dim) {
+    return I8IPNEON(pv1, pv2, dim) + I8IPBF(pv1 + (dim & ~15), pv2 + (dim & ~15), dim & 15);
+}
+
+#endif
+
 //------------------------------//------------------------------//------------------------------
 
 export float F32L2BF(const float *pv1, const float *pv2, size_t dim) {
@@ -165,7 +220,7 @@ export float F32L2BF(const float *pv1, const float *pv2, size_t dim) {
 
 #if defined(USE_AVX512)
 
-export float F32L2AVX512(const float *pv1, const float *pv2, size_t dim) {
+export SIMD_TARGET("avx512f") float F32L2AVX512(const float *pv1, const float *pv2, size_t dim) {
     float PORTABLE_ALIGN64 TmpRes[16];
     size_t dim16 = dim >> 4;
 
@@ -191,7 +246,7 @@ export float F32L2AVX512(const float *pv1, const float *pv2, size_t dim) {
     return (res);
 }
 
-export float F32L2AVX512Residual(const float *pv1, const float *pv2, size_t dim) {
+export SIMD_TARGET("avx512f") float F32L2AVX512Residual(const float *pv1, const float *pv2, size_t dim) {
     return F32L2AVX512(pv1, pv2, dim) + F32L2BF(pv1 + (dim & ~15), pv2 + (dim & ~15), dim & 15);
 }
 
@@ -199,7 +254,7 @@ export float F32L2AVX512Residual(const float *pv1, const float *pv2, size_t dim)
 
 #if defined(USE_AVX)
 
-export float F32L2AVX(const float *pv1, const float *pv2, size_t dim) {
+export SIMD_TARGET("avx2,fma") float F32L2AVX(const float *pv1, const float *pv2, size_t dim) {
     float PORTABLE_ALIGN32 TmpRes[8];
     size_t dim16 = dim >> 4;
 
@@ -228,7 +283,7 @@ export float F32L2AVX(const float *pv1, const float *pv2, size_t dim) {
     return TmpRes[0] + TmpRes[1] + TmpRes[2] + TmpRes[3] + TmpRes[4] + TmpRes[5] + TmpRes[6] + TmpRes[7];
 }
 
-export float F32L2AVXResidual(const float *pv1, const float *pv2, size_t dim) {
+export SIMD_TARGET("avx2,fma") float F32L2AVXResidual(const float *pv1, const float *pv2, size_t dim) {
     return F32L2AVX(pv1, pv2, dim) + F32L2BF(pv1 + (dim & ~15), pv2 + (dim & ~15), dim & 15);
 }
 
@@ -283,6 +338,39 @@ export float F32L2SSEResidual(const float *pv1, const float *pv2, size_t dim) {
 
 #endif
 
+#if defined(USE_NEON)
+export float F32L2NEON(const float *pv1, const float *pv2, size_t dim) {
+    size_t dim16 = dim >> 4;
+
+    const float *pEnd1 = pv1 + (dim16 << 4);
+
+    float32x4_t sum0 = vdupq_n_f32(0);
+    float32x4_t sum1 = vdupq_n_f32(0);
+    float32x4_t sum2 = vdupq_n_f32(0);
+    float32x4_t sum3 = vdupq_n_f32(0);
+
+    while (pv1 < pEnd1) {
+        float32x4_t diff0 = vsubq_f32(vld1q_f32(pv1), vld1q_f32(pv2));
+        float32x4_t diff1 = vsubq_f32(vld1q_f32(pv1 + 4), vld1q_f32(pv2 + 4));
+        float32x4_t diff2 = vsubq_f32(vld1q_f32(pv1 + 8), vld1q_f32(pv2 + 8));
+        float32x4_t diff3 = vsubq_f32(vld1q_f32(pv1 + 12), vld1q_f32(pv2 + 12));
+        pv1 += 16;
+        pv2 += 16;
+        sum0 = vfmaq_f32(sum0, diff0, diff0);
+        sum1 = vfmaq_f32(sum1, diff1, diff1);
+        sum2 = vfmaq_f32(sum2, diff2, diff2);
+        sum3 = vfmaq_f32(sum3, diff3, diff3);
+    }
+
+    return vaddvq_f32(vaddq_f32(vaddq_f32(sum0, sum1), vaddq_f32(sum2, sum3)));
+}
+
+export float F32L2NEONResidual(const float *pv1, const float *pv2, size_t dim) {
+    return F32L2NEON(pv1, pv2, dim) + F32L2BF(pv1 + (dim & ~15), pv2 + (dim & ~15), dim & 15);
+}
+
+#endif
+
 //------------------------------//------------------------------//------------------------------
 
 export float F32IPBF(const float *pv1, const float *pv2, size_t dim) {
@@ -295,7 +383,7 @@ export float F32IPBF(const float *pv1, const float *pv2, size_t dim) {
 
 #if defined(USE_AVX512)
 
-export float F32IPAVX512(const float *pVect1, const float *pVect2, SizeT qty) {
+export SIMD_TARGET("avx512f") float F32IPAVX512(const float *pVect1, const float *pVect2, SizeT qty) {
     float PORTABLE_ALIGN64 TmpRes[16];
 
     size_t qty16 = qty / 16;
@@ -321,7 +409,7 @@ export float F32IPAVX512(const float *pVect1, const float *pVect2, SizeT qty) {
     return sum;
 }
 
-export float F32IPAVX512Residual(const float *pVect1, const float *pVect2, SizeT qty) {
+export SIMD_TARGET("avx512f") float F32IPAVX512Residual(const float *pVect1, const float *pVect2, SizeT qty) {
     return F32IPAVX512(pVect1, pVect2, qty) + F32IPBF(pVect1 + (qty & ~15), pVect2 + (qty & ~15), qty & 15);
 }
 
@@ -329,7 +417,7 @@ export float F32IPAVX512Residual(const float *pVect1, const float *pVect2, SizeT
 
 #if defined(USE_AVX)
 
-export float F32IPAVX(const float *pVect1, const float *pVect2, SizeT qty) {
+export SIMD_TARGET("avx2,fma") float F32IPAVX(const float *pVect1, const float *pVect2, SizeT qty) {
     float PORTABLE_ALIGN32 TmpRes[8];
 
     size_t qty16 = qty / 16;
@@ -360,7 +448,7 @@ export float F32IPAVX(const float *pVect1, const float *pVect2, SizeT qty) {
     return sum;
 }
 
-export float F32IPAVXResidual(const float *pVect1, const float *pVect2, SizeT qty) {
+export SIMD_TARGET("avx2,fma") float F32IPAVXResidual(const float *pVect1, const float *pVect2, SizeT qty) {
     return F32IPAVX(pVect1, pVect2, qty) + F32IPBF(pVect1 + (qty & ~15), pVect2 + (qty & ~15), qty & 15);
 }
 
@@ -416,4 +504,179 @@ export float F32IPSSEResidual(const float *pVect1, const float *pVect2, SizeT qt
 
 #endif
 
+#if defined(USE_NEON)
+export float F32IPNEON(const float *pVect1, const float *pVect2, SizeT qty) {
+    size_t qty16 = qty / 16;
+
+    const float *pEnd1 = pVect1 + 16 * qty16;
+
+    float32x4_t sum0 = vdupq_n_f32(0);
+    float32x4_t sum1 = vdupq_n_f32(0);
+    float32x4_t sum2 = vdupq_n_f32(0);
+    float32x4_t sum3 = vdupq_n_f32(0);
+
+    while (pVect1 < pEnd1) {
+        sum0 = vfmaq_f32(sum0, vld1q_f32(pVect1), vld1q_f32(pVect2));
+        sum1 = vfmaq_f32(sum1, vld1q_f32(pVect1 + 4), vld1q_f32(pVect2 + 4));
+        sum2 = vfmaq_f32(sum2, vld1q_f32(pVect1 + 8), vld1q_f32(pVect2 + 8));
+        sum3 = vfmaq_f32(sum3, vld1q_f32(pVect1 + 12), vld1q_f32(pVect2 + 12));
+        pVect1 += 16;
+        pVect2 += 16;
+    }
+
+    return vaddvq_f32(vaddq_f32(vaddq_f32(sum0, sum1), vaddq_f32(sum2, sum3)));
+}
+
+export float F32IPNEONResidual(const float *pVect1, const float *pVect2, SizeT qty) {
+    return F32IPNEON(pVect1, pVect2, qty) + F32IPBF(pVect1 + (qty & ~15), pVect2 + (qty & ~15), qty & 15);
+}
+
+#endif
+
+//------------------------------//------------------------------//------------------------------
+
+// sum of table[i * 256 + codes[i]] for the product quantization asymmetric distance
+export float F32PQTableSumBF(const float *table, const uint8_t *codes, size_t subspace_num) {
+    float res = 0;
+    for (size_t i = 0; i < subspace_num; ++i) {
+        res += table[i * 256 + codes[i]];
+    }
+    return res;
+}
+
+#if defined(USE_AVX)
+
+export SIMD_TARGET("avx2") float F32PQTableSumAVX(const float *table, const uint8_t *codes, size_t subspace_num) {
+    const __m256i sub_offset = _mm256_setr_epi32(0, 256, 512, 768, 1024, 1280, 1536, 1792);
+    __m256 sum256 = _mm256_setzero_ps();
+    size_t i = 0;
+    for (; i + 8 <= subspace_num; i += 8) {
+        __m128i code8 = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(codes + i));
+        __m256i idx = _mm256_add_epi32(_mm256_cvtepu8_epi32(code8), sub_offset);
+        sum256 = _mm256_add_ps(sum256, _mm256_i32gather_ps(table + i * 256, idx, 4));
+    }
+    alignas(32) float TmpRes[8];
+    _mm256_store_ps(TmpRes, sum256);
+    float sum = TmpRes[0] + TmpRes[1] + TmpRes[2] + TmpRes[3] + TmpRes[4] + TmpRes[5] + TmpRes[6] + TmpRes[7];
+    return sum + F32PQTableSumBF(table + i * 256, codes + i, subspace_num - i);
+}
+
+#endif
+
+//------------------------------//------------------------------//------------------------------
+
+// The widest instruction set the cpu supports. The kernels are picked when a distance is made, so one binary runs the widest
+// kernels on every node.
+export enum class SIMDLevel : i8 {
+    kNone,
+    kSSE,    // sse4.1
+    kAVX2,   // avx2 and fma
+    kAVX512, // avx512f and avx512bw
+    kNEON,
+};
+
+struct CpuFeatures {
+    SIMDLevel simd_level_ = SIMDLevel::kNone;
+    bool avx512_vnni_ = false;
+
+    CpuFeatures() {
+#if defined(USE_SSE) && defined(__GNUC__)
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw")) {
+            simd_level_ = SIMDLevel::kAVX512;
+            avx512_vnni_ = __builtin_cpu_supports("avx512vnni");
+        } else if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+            simd_level_ = SIMDLevel::kAVX2;
+        } else if (__builtin_cpu_supports("sse4.1")) {
+            simd_level_ = SIMDLevel::kSSE;
+        }
+#elif defined(USE_SSE)
+        simd_level_ = SIMDLevel::kSSE;
+#elif defined(USE_NEON)
+        simd_level_ = SIMDLevel::kNEON;
+#endif
+    }
+};
+
+const CpuFeatures &GetCpuFeatures() {
+    static const CpuFeatures cpu_features;
+    return cpu_features;
+}
+
+export SIMDLevel GetSIMDLevel() { return GetCpuFeatures().simd_level_; }
+
+export using F32DistFuncType = float (*)(const float *, const float *, SizeT);
+export using I8IPFuncType = int32_t (*)(const int8_t *, const int8_t *, SizeT);
+export using F32PQTableSumFuncType = float (*)(const float *, const uint8_t *, SizeT);
+
+export F32DistFuncType GetF32L2Func(SizeT dim) {
+    switch (GetSIMDLevel()) {
+#if defined(USE_SSE)
+        case SIMDLevel::kAVX512:
+            return dim % 16 == 0 ? F32L2AVX512 : F32L2AVX512Residual;
+        case SIMDLevel::kAVX2:
+            return dim % 16 == 0 ? F32L2AVX : F32L2AVXResidual;
+        case SIMDLevel::kSSE:
+            return dim % 16 == 0 ? F32L2SSE : F32L2SSEResidual;
+#endif
+#if defined(USE_NEON)
+        case SIMDLevel::kNEON:
+            return dim % 16 == 0 ? F32L2NEON : F32L2NEONResidual;
+#endif
+        default:
+            return F32L2BF;
+    }
+}
+
+export F32DistFuncType GetF32IPFunc(SizeT dim) {
+    switch (GetSIMDLevel()) {
+#if defined(USE_SSE)
+        case SIMDLevel::kAVX512:
+            return dim % 16 == 0 ? F32IPAVX512 : F32IPAVX512Residual;
+        case SIMDLevel::kAVX2:
+            return dim % 16 == 0 ? F32IPAVX : F32IPAVXResidual;
+        case SIMDLevel::kSSE:
+            return dim % 16 == 0 ? F32IPSSE : F32IPSSEResidual;
+#endif
+#if defined(USE_NEON)
+        case SIMDLevel::kNEON:
+            return dim % 16 == 0 ? F32IPNEON : F32IPNEONResidual;
+#endif
+        default:
+            return F32IPBF;
+    }
+}
+
+// The inner product of the int8 codes of the lvq store.
+export I8IPFuncType GetI8IPFunc(SizeT dim) {
+    switch (GetSIMDLevel()) {
+#if defined(USE_SSE)
+        case SIMDLevel::kAVX512:
+            if (GetCpuFeatures().avx512_vnni_) {
+                return dim % 64 == 0 ? I8IPAVX512VNNI : I8IPAVX512VNNIResidual;
+            }
+            return dim % 64 == 0 ? I8IPAVX512 : I8IPAVX512Residual;
+        case SIMDLevel::kAVX2:
+            return dim % 32 == 0 ? I8IPAVX : I8IPAVXResidual;
+        case SIMDLevel::kSSE:
+            return dim % 16 == 0 ? I8IPSSE : I8IPSSEResidual;
+#endif
+#if defined(USE_NEON)
+        case SIMDLevel::kNEON:
+            return dim % 16 == 0 ? I8IPNEON : I8IPNEONResidual;
+#endif
+        default:
+            return I8IPBF;
+    }
+}
+
+export F32PQTableSumFuncType GetF32PQTableSumFunc() {
+#if defined(USE_AVX)
+    if (GetSIMDLevel() == SIMDLevel::kAVX2 || GetSIMDLevel() == SIMDLevel::kAVX512) {
+        return F32PQTableSumAVX;
+    }
+#endif
+    return F32PQTableSumBF;
+}
+
 } // namespace infinity
\ No newline at end of file
@@ -0,0 +1,56 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+module knn_result_cache;
+
+import stl;
+
+namespace infinity {
+
+SharedPtr<const KnnCacheEntry> KnnResultCache::Get(const String &key) {
+    std::unique_lock lock(mutex_);
+    auto iter = entries_.find(key);
+    if (iter == entries_.end()) {
+        return nullptr;
+    }
+    lru_.splice(lru_.begin(), lru_, iter->second);
+    return iter->second->second;
+}
+
+void KnnResultCache::Put(const String &key, SharedPtr<const KnnCacheEntry> entry) {
+    if (capacity_ == 0) {
+        return;
+    }
+    std::unique_lock lock(mutex_);
+    if (auto iter = entries_.find(key); iter != entries_.end()) {
+        iter->second->second = std::move(entry);
+        lru_.splice(lru_.begin(), lru_, iter->second);
+        return;
+    }
+    lru_.emplace_front(key, std::move(entry));
+    entries_.emplace(key, lru_.begin());
+    if (lru_.size() > capacity_) {
+        entries_.erase(lru_.back().first);
+        lru_.pop_back();
+    }
+}
+
+SizeT KnnResultCache::size() {
+    std::unique_lock lock(mutex_);
+    return lru_.size();
+}
+
+} // namespace infinity
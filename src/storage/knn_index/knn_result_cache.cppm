@@ -0,0 +1,53 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module knn_result_cache;
+
+import stl;
+import internal_types;
+
+namespace infinity {
+
+// The knn results of one segment, the results of each query nearest first.
+export struct KnnCacheEntry {
+    // the begin ts of the query that computed them
+    TxnTimeStamp compute_ts_{};
+    Vector<Vector<Pair<f32, RowID>>> results_{};
+};
+
+// Per segment knn results of recent queries. The key identifies the query, its options and filter, the index and the index version,
+// the caller checks that the rows of the segment visible to it are the ones visible when the entry was computed.
+export class KnnResultCache {
+public:
+    explicit KnnResultCache(SizeT capacity) : capacity_(capacity) {}
+
+    SharedPtr<const KnnCacheEntry> Get(const String &key);
+
+    void Put(const String &key, SharedPtr<const KnnCacheEntry> entry);
+
+    SizeT size();
+
+private:
+    using LruList = List<Pair<String, SharedPtr<const KnnCacheEntry>>>;
+
+    const SizeT capacity_;
+    std::mutex mutex_{};
+    // most recently used first
+    LruList lru_{};
+    HashMap<String, LruList::iterator> entries_{};
+};
+
+} // namespace infinity
@@ -24,6 +24,9 @@ import infinity_exception;
 import bitmask;
 import default_values;
 import internal_types;
+import mlas_matrix_multiply;
+import vector_distance;
+import index_base;
 
 namespace infinity {
 
@@ -35,7 +38,10 @@ public:
 export template <typename DataType, template <typename, typename> typename C>
 class MergeKnn final : public MergeKnnBase {
     using ResultHandler = ReservoirResultHandler<C<DataType, RowID>>;
-    using DistFunc = DataType (*)(const DataType *, const DataType *, SizeT);
+    using RangeHandler = RangeResultHandler<C<DataType, RowID>>;
+    // the distance of two elements, the column elements may be of another type than the distances, e.g. int8 or packed bits
+    template <typename ElemType>
+    using DistFunc = DataType (*)(const ElemType *, const ElemType *, SizeT);
 
 public:
     explicit MergeKnn(u64 query_count, u64 topk)
@@ -44,12 +50,44 @@ public:
         result_handler_ = MakeUnique<ResultHandler>(query_count, topk, this->distance_array_.get(), this->idx_array_.get());
     }
 
+    // A range search keeps every result within the threshold instead of the top k.
+    MergeKnn(u64 query_count, u64 topk, Optional<DataType> threshold) : MergeKnn(query_count, topk) {
+        if (threshold.has_value()) {
+            range_handler_ = MakeUnique<RangeHandler>(query_count, *threshold);
+        }
+    }
+
     ~MergeKnn() final = default;
 
 public:
-    void Search(const DataType *query, const DataType *data, u32 dim, DistFunc dist_f, u16 row_cnt, u32 segment_id, u16 block_id);
-
-    void Search(const DataType *query, const DataType *data, u32 dim, DistFunc dist_f, u16 row_cnt, u32 segment_id, u16 block_id, Bitmask &bitmask);
+    template <typename ElemType>
+    void Search(const ElemType *query, const ElemType *data, u32 dim, DistFunc<ElemType> dist_f, u16 row_cnt, u32 segment_id, u16 block_id);
+
+    template <typename ElemType>
+    void Search(const ElemType *query,
+                const ElemType *data,
+                u32 dim,
+                DistFunc<ElemType> dist_f,
+                u16 row_cnt,
+                u32 segment_id,
+                u16 block_id,
+                Bitmask &bitmask);
+
+    // Brute force of all the queries against a block of float rows, a tile of queries times rows is one gemm. The distances are
+    // squared l2, the inner product, or the cosine of unit queries, the rows are then divided by their norms.
+    void SearchGemm(const f32 *query, const f32 *data, u32 dim, MetricType metric, u16 row_cnt, u32 segment_id, u16 block_id, Bitmask &bitmask);
+
+    // MaxSim of the queries against a block of rows, a query and a row pack token vectors of token_dim floats. The score of a row sums
+    // over the query tokens their largest inner product with a row token, one gemm per tile of row tokens. Zero tokens are padding.
+    void SearchMaxSim(const f32 *query,
+                      u32 query_dim,
+                      const f32 *data,
+                      u32 row_dim,
+                      u32 token_dim,
+                      u16 row_cnt,
+                      u32 segment_id,
+                      u16 block_id,
+                      Bitmask &bitmask);
 
     void Search(const DataType *dist, const RowID *row_ids, u16 count);
 
@@ -69,8 +107,22 @@ public:
 
     RowID *GetIDsByIdx(u64 idx) const;
 
+    // the number of results of a query once the search ends
+    i64 ResultCount(u64 idx) const;
+
     i64 total_count() const { return total_count_; }
 
+    bool IsRangeSearch() const { return range_handler_ != nullptr; }
+
+private:
+    void AddResult(SizeT query_id, DataType dist, RowID row_id) {
+        if (range_handler_) {
+            range_handler_->AddResult(query_id, dist, row_id);
+        } else {
+            result_handler_->AddResult(query_id, dist, row_id);
+        }
+    }
+
 private:
     i64 total_count_{};
     bool begin_{false};
@@ -81,27 +133,41 @@ private:
 
 private:
     UniquePtr<ResultHandler> result_handler_{};
+    UniquePtr<RangeHandler> range_handler_{};
+
+    // buffers of SearchGemm, the query norms are computed by the first call
+    UniquePtr<f32[]> query_norms_{};
+    UniquePtr<f32[]> row_norms_{};
+    UniquePtr<f32[]> ip_block_{};
 };
 
 template <typename DataType, template <typename, typename> typename C>
-void MergeKnn<DataType, C>::Search(const DataType *query, const DataType *data, u32 dim, DistFunc dist_f, u16 row_cnt, u32 segment_id, u16 block_id) {
+template <typename ElemType>
+void MergeKnn<DataType, C>::Search(const ElemType *query,
+                                   const ElemType *data,
+                                   u32 dim,
+                                   DistFunc<ElemType> dist_f,
+                                   u16 row_cnt,
+                                   u32 segment_id,
+                                   u16 block_id) {
     this->total_count_ += row_cnt;
     u32 segment_offset_start = block_id * DEFAULT_BLOCK_CAPACITY;
     for (u64 i = 0; i < this->query_count_; ++i) {
-        const DataType *x_i = query + i * dim;
-        const DataType *y_j = data;
+        const ElemType *x_i = query + i * dim;
+        const ElemType *y_j = data;
         for (u16 j = 0; j < row_cnt; ++j, y_j += dim) {
             auto dist = dist_f(x_i, y_j, dim);
-            result_handler_->AddResult(i, dist, RowID(segment_id, segment_offset_start + j));
+            AddResult(i, dist, RowID(segment_id, segment_offset_start + j));
         }
     }
 }
 
 template <typename DataType, template <typename, typename> typename C>
-void MergeKnn<DataType, C>::Search(const DataType *query,
-                                   const DataType *data,
+template <typename ElemType>
+void MergeKnn<DataType, C>::Search(const ElemType *query,
+                                   const ElemType *data,
                                    u32 dim,
-                                   DistFunc dist_f,
+                                   DistFunc<ElemType> dist_f,
                                    u16 row_cnt,
                                    u32 segment_id,
                                    u16 block_id,
@@ -112,20 +178,147 @@ void MergeKnn<DataType, C>::Search(const DataType *query,
     }
     u32 segment_offset_start = block_id * DEFAULT_BLOCK_CAPACITY;
     for (u64 i = 0; i < this->query_count_; ++i) {
-        const DataType *x_i = query + i * dim;
-        const DataType *y_j = data;
+        const ElemType *x_i = query + i * dim;
+        const ElemType *y_j = data;
         for (u16 j = 0; j < row_cnt; ++j, y_j += dim) {
             if (bitmask.IsTrue(j)) {
                 if (i == 0) {
                     ++this->total_count_;
                 }
                 auto dist = dist_f(x_i, y_j, dim);
-                result_handler_->AddResult(i, dist, RowID(segment_id, segment_offset_start + j));
+                AddResult(i, dist, RowID(segment_id, segment_offset_start + j));
             }
         }
     }
 }
 
+template <typename DataType, template <typename, typename> typename C>
+void MergeKnn<DataType, C>::SearchGemm(const f32 *query,
+                                       const f32 *data,
+                                       u32 dim,
+                                       MetricType metric,
+                                       u16 row_cnt,
+                                       u32 segment_id,
+                                       u16 block_id,
+                                       Bitmask &bitmask) {
+    if (row_cnt == 0 || this->query_count_ == 0) {
+        return;
+    }
+    const SizeT bs_x = std::min<SizeT>(DISTANCE_COMPUTE_BLAS_QUERY_BS, this->query_count_);
+    const SizeT bs_y = DISTANCE_COMPUTE_BLAS_DATABASE_BS;
+    if (ip_block_ == nullptr) {
+        ip_block_ = MakeUniqueForOverwrite<f32[]>(bs_x * bs_y);
+    }
+    if (metric == MetricType::kMetricL2 && query_norms_ == nullptr) {
+        query_norms_ = MakeUniqueForOverwrite<f32[]>(this->query_count_);
+        L2NormsSquares(query_norms_.get(), query, dim, this->query_count_);
+    }
+    if (metric != MetricType::kMetricInnerProduct) {
+        if (row_norms_ == nullptr) {
+            row_norms_ = MakeUniqueForOverwrite<f32[]>(DEFAULT_BLOCK_CAPACITY);
+        }
+        L2NormsSquares(row_norms_.get(), data, dim, row_cnt);
+    }
+    if (metric == MetricType::kMetricCosine) {
+        // the inverse norms, each row is scaled once for all the queries
+        for (u16 j = 0; j < row_cnt; ++j) {
+            row_norms_[j] = row_norms_[j] > 0 ? 1 / std::sqrt(row_norms_[j]) : 0;
+        }
+    }
+    const bool all_true = bitmask.IsAllTrue();
+    for (u16 j = 0; j < row_cnt; ++j) {
+        this->total_count_ += all_true || bitmask.IsTrue(j);
+    }
+
+    u32 segment_offset_start = block_id * DEFAULT_BLOCK_CAPACITY;
+    for (SizeT i0 = 0; i0 < this->query_count_; i0 += bs_x) {
+        SizeT i1 = std::min<SizeT>(i0 + bs_x, this->query_count_);
+        for (SizeT j0 = 0; j0 < row_cnt; j0 += bs_y) {
+            SizeT j1 = std::min<SizeT>(j0 + bs_y, row_cnt);
+            matrixA_multiply_transpose_matrixB_output_to_C(query + i0 * dim, data + j0 * dim, i1 - i0, j1 - j0, dim, ip_block_.get());
+            for (SizeT i = i0; i < i1; ++i) {
+                const f32 *ip_line = ip_block_.get() + (i - i0) * (j1 - j0) - j0;
+                for (SizeT j = j0; j < j1; ++j) {
+                    if (!all_true && !bitmask.IsTrue(j)) {
+                        continue;
+                    }
+                    DataType dist = ip_line[j];
+                    if (metric == MetricType::kMetricL2) {
+                        // negative values can occur for identical vectors due to roundoff errors
+                        dist = std::max<DataType>(query_norms_[i] + row_norms_[j] - 2 * dist, 0);
+                    } else if (metric == MetricType::kMetricCosine) {
+                        dist *= row_norms_[j];
+                    }
+                    AddResult(i, dist, RowID(segment_id, segment_offset_start + j));
+                }
+            }
+        }
+    }
+}
+
+template <typename DataType, template <typename, typename> typename C>
+void MergeKnn<DataType, C>::SearchMaxSim(const f32 *query,
+                                         u32 query_dim,
+                                         const f32 *data,
+                                         u32 row_dim,
+                                         u32 token_dim,
+                                         u16 row_cnt,
+                                         u32 segment_id,
+                                         u16 block_id,
+                                         Bitmask &bitmask) {
+    if (row_cnt == 0 || this->query_count_ == 0) {
+        return;
+    }
+    const SizeT query_token_n = query_dim / token_dim;
+    const SizeT row_token_n = row_dim / token_dim;
+    const SizeT token_cnt = row_cnt * row_token_n;
+    const SizeT bs_y = DISTANCE_COMPUTE_BLAS_DATABASE_BS;
+    Vector<f32> query_norms(query_token_n);
+    Vector<f32> token_norms(token_cnt);
+    L2NormsSquares(token_norms.data(), data, token_dim, token_cnt);
+    // the largest inner product of each query token with the tokens of each row
+    Vector<f32> max_ips(query_token_n * row_cnt);
+    Vector<f32> ip_block(query_token_n * bs_y);
+
+    const bool all_true = bitmask.IsAllTrue();
+    for (u16 j = 0; j < row_cnt; ++j) {
+        this->total_count_ += all_true || bitmask.IsTrue(j);
+    }
+
+    u32 segment_offset_start = block_id * DEFAULT_BLOCK_CAPACITY;
+    for (SizeT i = 0; i < this->query_count_; ++i) {
+        const f32 *query_i = query + i * query_dim;
+        L2NormsSquares(query_norms.data(), query_i, token_dim, query_token_n);
+        std::fill(max_ips.begin(), max_ips.end(), std::numeric_limits<f32>::lowest());
+        for (SizeT t0 = 0; t0 < token_cnt; t0 += bs_y) {
+            SizeT t1 = std::min<SizeT>(t0 + bs_y, token_cnt);
+            matrixA_multiply_transpose_matrixB_output_to_C(query_i, data + t0 * token_dim, query_token_n, t1 - t0, token_dim, ip_block.data());
+            for (SizeT m = 0; m < query_token_n; ++m) {
+                const f32 *ip_line = ip_block.data() + m * (t1 - t0) - t0;
+                f32 *max_line = max_ips.data() + m * row_cnt;
+                for (SizeT t = t0; t < t1; ++t) {
+                    if (token_norms[t] > 0) {
+                        max_line[t / row_token_n] = std::max(max_line[t / row_token_n], ip_line[t]);
+                    }
+                }
+            }
+        }
+        for (u16 j = 0; j < row_cnt; ++j) {
+            if (!all_true && !bitmask.IsTrue(j)) {
+                continue;
+            }
+            DataType score = 0;
+            for (SizeT m = 0; m < query_token_n; ++m) {
+                // a row of padding only scores 0
+                if (query_norms[m] > 0 && max_ips[m * row_cnt + j] != std::numeric_limits<f32>::lowest()) {
+                    score += max_ips[m * row_cnt + j];
+                }
+            }
+            AddResult(i, score, RowID(segment_id, segment_offset_start + j));
+        }
+    }
+}
+
 template <typename DataType, template <typename, typename> typename C>
 void MergeKnn<DataType, C>::Search(const DataType *dist, const RowID *row_ids, u16 count) {
     this->total_count_ += count;
@@ -133,7 +326,7 @@ void MergeKnn<DataType, C>::Search(const DataType *dist, const RowID *row_ids, u
         const DataType *d = dist + i * topk_;
         const RowID *r = row_ids + i * topk_;
         for (u16 j = 0; j < count; j++) {
-            result_handler_->AddResult(i, d[j], r[j]);
+            AddResult(i, d[j], r[j]);
         }
     }
 }
@@ -144,7 +337,7 @@ void MergeKnn<DataType, C>::Search(SizeT query_id, const DataType *dist, const R
         this->total_count_ += count;
     }
     for (u16 j = 0; j < count; j++) {
-        result_handler_->AddResult(query_id, dist[j], row_ids[j]);
+        AddResult(query_id, dist[j], row_ids[j]);
     }
 }
 
@@ -153,7 +346,11 @@ void MergeKnn<DataType, C>::Begin() {
     if (this->begin_ || this->query_count_ == 0) {
         return;
     }
-    result_handler_->Begin();
+    if (range_handler_) {
+        range_handler_->Begin();
+    } else {
+        result_handler_->Begin();
+    }
     this->begin_ = true;
 }
 
@@ -162,7 +359,11 @@ void MergeKnn<DataType, C>::End() {
     if (!this->begin_)
         return;
 
-    result_handler_->End();
+    if (range_handler_) {
+        range_handler_->End();
+    } else {
+        result_handler_->End();
+    }
 
     this->begin_ = false;
 }
@@ -172,7 +373,11 @@ void MergeKnn<DataType, C>::EndWithoutSort() {
     if (!this->begin_)
         return;
 
-    result_handler_->EndWithoutSort();
+    if (range_handler_) {
+        range_handler_->EndWithoutSort();
+    } else {
+        result_handler_->EndWithoutSort();
+    }
 
     this->begin_ = false;
 }
@@ -192,6 +397,9 @@ DataType *MergeKnn<DataType, C>::GetDistancesByIdx(u64 idx) const {
     if (idx >= this->query_count_) {
         UnrecoverableError("Query index exceeds the limit");
     }
+    if (range_handler_) {
+        return range_handler_->GetDistances(idx);
+    }
     return distance_array_.get() + idx * this->topk_;
 }
 
@@ -200,9 +408,20 @@ RowID *MergeKnn<DataType, C>::GetIDsByIdx(u64 idx) const {
     if (idx >= this->query_count_) {
         UnrecoverableError("Query index exceeds the limit");
     }
+    if (range_handler_) {
+        return range_handler_->GetIDs(idx);
+    }
     return idx_array_.get() + idx * this->topk_;
 }
 
+template <typename DataType, template <typename, typename> typename C>
+i64 MergeKnn<DataType, C>::ResultCount(u64 idx) const {
+    if (range_handler_) {
+        return range_handler_->GetSize(idx);
+    }
+    return std::min(this->topk_, this->total_count_);
+}
+
 template class MergeKnn<f32, CompareMax>;
 template class MergeKnn<f32, CompareMin>;
 
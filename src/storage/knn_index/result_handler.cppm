@@ -55,6 +55,7 @@ enum class ResultHandlerType {
     kHeap,
     kReservoir,
     kSingleBest,
+    kRange,
     kInvalid,
 };
 
@@ -565,4 +566,63 @@ public:
     }
 };
 
-} // namespace infinity
\ No newline at end of file
+// Keeps every result within a threshold instead of the top k, the results of a query grow as they are added. Compare tells whether the
+// first distance is farther than the second, as for the heap of the top k.
+export template <class Compare>
+class RangeResultHandler : public ResultHandlerBase {
+    using DistType = typename Compare::DistanceType;
+    using ID = typename Compare::IDType;
+    DistType threshold_;
+    Vector<Vector<DistType>> distances_;
+    Vector<Vector<ID>> ids_;
+
+public:
+    RangeResultHandler(SizeT n_queries, DistType threshold)
+        : ResultHandlerBase(ResultHandlerType::kRange), threshold_(threshold), distances_(n_queries), ids_(n_queries) {}
+
+    [[nodiscard]] bool Within(DistType distance) const { return !Compare::Compare(distance, threshold_); }
+
+    [[nodiscard]] DistType GetThreshold() const { return threshold_; }
+
+    [[nodiscard]] SizeT GetSize(SizeT q_id) const { return distances_[q_id].size(); }
+
+    DistType *GetDistances(SizeT q_id) { return distances_[q_id].data(); }
+
+    ID *GetIDs(SizeT q_id) { return ids_[q_id].data(); }
+
+    void Begin() {}
+
+    void AddResult(SizeT q_id, DistType distance, ID id) {
+        if (Within(distance)) {
+            distances_[q_id].push_back(distance);
+            ids_[q_id].push_back(id);
+        }
+    }
+
+    // nearest first
+    void End(SizeT q_id) {
+        auto &distances = distances_[q_id];
+        auto &ids = ids_[q_id];
+        Vector<SizeT> order(distances.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::sort(order.begin(), order.end(), [&](SizeT a, SizeT b) { return Compare::Compare(distances[b], distances[a], ids[b], ids[a]); });
+        Vector<DistType> sorted_distances(order.size());
+        Vector<ID> sorted_ids(order.size());
+        for (SizeT i = 0; i < order.size(); ++i) {
+            sorted_distances[i] = distances[order[i]];
+            sorted_ids[i] = ids[order[i]];
+        }
+        distances = std::move(sorted_distances);
+        ids = std::move(sorted_ids);
+    }
+
+    void End() {
+        for (SizeT i = 0; i < distances_.size(); ++i) {
+            End(i);
+        }
+    }
+
+    void EndWithoutSort() {}
+};
+
+} // namespace infinity
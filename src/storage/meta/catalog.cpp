@@ -52,6 +52,8 @@ import block_entry;
 import block_column_entry;
 import segment_index_entry;
 import log_file;
+import mmap;
+import defer_op;
 
 namespace infinity {
 
@@ -187,8 +189,17 @@ Tuple<TableEntry *, Status> Catalog::CreateTable(const String &db_name,
         return {nullptr, status};
     }
 
-    return db_entry
-        ->CreateTable(TableEntryType::kTableEntry, table_def->table_name(), table_def->columns(), txn_id, begin_ts, txn_mgr, conflict_type);
+    return db_entry->CreateTable(TableEntryType::kTableEntry,
+                                 table_def->table_name(),
+                                 table_def->columns(),
+                                 txn_id,
+                                 begin_ts,
+                                 txn_mgr,
+                                 conflict_type,
+                                 table_def->segment_capacity(),
+                                 table_def->sort_column_id(),
+                                 table_def->ttl_column_id(),
+                                 table_def->ttl_seconds());
 }
 
 Tuple<SharedPtr<TableEntry>, Status> Catalog::DropTableByName(const String &db_name,
@@ -328,6 +339,10 @@ Status Catalog::RollbackDelete(TableEntry *table_entry, TransactionID txn_id, De
     return table_entry->RollbackDelete(txn_id, append_state, buffer_mgr);
 }
 
+Status Catalog::Update(TableEntry *table_entry, TransactionID txn_id, void *txn_store, TxnTimeStamp commit_ts, const UpdateState &update_state) {
+    return table_entry->Update(txn_id, txn_store, commit_ts, update_state);
+}
+
 Status Catalog::CommitCompact(TableEntry *table_entry, TransactionID txn_id, TxnTimeStamp commit_ts, TxnCompactStore &compact_store) {
     return table_entry->CommitCompact(txn_id, commit_ts, compact_store);
 }
@@ -397,7 +412,7 @@ nlohmann::json Catalog::Serialize(TxnTimeStamp max_commit_ts) {
     {
         std::shared_lock<std::shared_mutex> lck(this->rw_locker());
         json_res["data_dir"] = *this->data_dir_;
-        json_res["next_txn_id"] = this->next_txn_id_;
+        json_res["next_txn_id"] = this->next_txn_id_.load();
         json_res["full_ckp_commit_ts"] = this->full_ckp_commit_ts_;
         databases.reserve(this->db_meta_map().size());
         for (auto &db_meta : this->db_meta_map()) {
@@ -426,13 +441,15 @@ UniquePtr<Catalog> Catalog::NewCatalog(SharedPtr<String> data_dir, bool create_d
     return catalog;
 }
 
-UniquePtr<Catalog>
-Catalog::LoadFromFiles(const FullCatalogFileInfo &full_ckp_info, const Vector<DeltaCatalogFileInfo> &delta_ckp_infos, BufferManager *buffer_mgr) {
+UniquePtr<Catalog> Catalog::LoadFromFiles(const FullCatalogFileInfo &full_ckp_info,
+                                          const Vector<DeltaCatalogFileInfo> &delta_ckp_infos,
+                                          BufferManager *buffer_mgr,
+                                          bool lazy_load) {
 
     // 1. load json
     // 2. load entries
     LOG_INFO(fmt::format("Load base FULL catalog json from: {}", full_ckp_info.path_));
-    auto catalog = Catalog::LoadFromFile(full_ckp_info, buffer_mgr);
+    auto catalog = Catalog::LoadFromFile(full_ckp_info, buffer_mgr, lazy_load);
 
     // Load catalogs delta checkpoints and merge.
     TxnTimeStamp max_commit_ts = 0;
@@ -529,6 +546,10 @@ void Catalog::LoadFromEntryDelta(TxnTimeStamp max_commit_ts, BufferManager *buff
                 auto row_count = add_table_entry_op->row_count_;
                 SegmentID unsealed_id = add_table_entry_op->unsealed_id_;
                 SegmentID next_segment_id = add_table_entry_op->next_segment_id_;
+                SizeT segment_capacity = add_table_entry_op->segment_capacity_;
+                ColumnID sort_column_id = add_table_entry_op->sort_column_id_;
+                ColumnID ttl_column_id = add_table_entry_op->ttl_column_id_;
+                u64 ttl_seconds = add_table_entry_op->ttl_seconds_;
 
                 auto *db_entry = this->GetDatabaseReplay(*db_name, txn_id, begin_ts);
                 if (merge_flag == MergeFlag::kDelete || merge_flag == MergeFlag::kDeleteAndNew) {
@@ -547,7 +568,11 @@ void Catalog::LoadFromEntryDelta(TxnTimeStamp max_commit_ts, BufferManager *buff
                                                                 commit_ts,
                                                                 row_count,
                                                                 unsealed_id,
-                                                                next_segment_id);
+                                                                next_segment_id,
+                                                                segment_capacity,
+                                                                sort_column_id,
+                                                                ttl_column_id,
+                                                                ttl_seconds);
                         },
                         txn_id,
                         begin_ts);
@@ -567,7 +592,11 @@ void Catalog::LoadFromEntryDelta(TxnTimeStamp max_commit_ts, BufferManager *buff
                                                                 commit_ts,
                                                                 row_count,
                                                                 unsealed_id,
-                                                                next_segment_id);
+                                                                next_segment_id,
+                                                                segment_capacity,
+                                                                sort_column_id,
+                                                                ttl_column_id,
+                                                                ttl_seconds);
                         },
                         txn_id,
                         begin_ts);
@@ -587,7 +616,11 @@ void Catalog::LoadFromEntryDelta(TxnTimeStamp max_commit_ts, BufferManager *buff
                                                                 commit_ts,
                                                                 row_count,
                                                                 unsealed_id,
-                                                                next_segment_id);
+                                                                next_segment_id,
+                                                                segment_capacity,
+                                                                sort_column_id,
+                                                                ttl_column_id,
+                                                                ttl_seconds);
                         },
                         txn_id,
                         begin_ts);
@@ -816,32 +849,44 @@ void Catalog::LoadFromEntryDelta(TxnTimeStamp max_commit_ts, BufferManager *buff
     }
 }
 
-UniquePtr<Catalog> Catalog::LoadFromFile(const FullCatalogFileInfo &full_ckp_info, BufferManager *buffer_mgr) {
+UniquePtr<Catalog> Catalog::LoadFromFile(const FullCatalogFileInfo &full_ckp_info, BufferManager *buffer_mgr, bool lazy_load) {
     const auto &catalog_path = full_ckp_info.path_;
 
-    LocalFileSystem fs;
-    UniquePtr<FileHandler> catalog_file_handler = fs.OpenFile(catalog_path, FileFlags::READ_FLAG, FileLockType::kReadLock);
-    SizeT file_size = fs.GetFileSize(*catalog_file_handler);
-    String json_str(file_size, 0);
-    SizeT n_bytes = catalog_file_handler->Read(json_str.data(), file_size);
-    if (file_size != n_bytes) {
+    u8 *data_ptr = nullptr;
+    SizeT data_len = 0;
+    if (MmapFile(catalog_path, data_ptr, data_len) < 0) {
         RecoverableError(Status::CatalogCorrupted(catalog_path));
     }
-
-    nlohmann::json catalog_json = nlohmann::json::parse(json_str);
-    return Deserialize(catalog_json, buffer_mgr);
+    DeferFn defer_fn([&]() { MunmapFile(data_ptr, data_len); });
+    MmapAdvise(data_ptr, data_len, MmapAdvice::kSequential);
+
+    nlohmann::json catalog_json;
+    constexpr SizeT header_size = FULL_CKP_MAGIC.size() + sizeof(u32);
+    if (data_len >= header_size && std::memcmp(data_ptr, FULL_CKP_MAGIC.data(), FULL_CKP_MAGIC.size()) == 0) {
+        u32 version = 0;
+        std::memcpy(&version, data_ptr + FULL_CKP_MAGIC.size(), sizeof(version));
+        if (version != FULL_CKP_VERSION) {
+            LOG_ERROR(fmt::format("Unknown version {} of catalog file: {}", version, catalog_path));
+            RecoverableError(Status::CatalogCorrupted(catalog_path));
+        }
+        catalog_json = nlohmann::json::from_msgpack(data_ptr + header_size, data_ptr + data_len);
+    } else {
+        // written as json text before the binary format
+        catalog_json = nlohmann::json::parse(data_ptr, data_ptr + data_len);
+    }
+    return Deserialize(catalog_json, buffer_mgr, lazy_load);
 }
 
-UniquePtr<Catalog> Catalog::Deserialize(const nlohmann::json &catalog_json, BufferManager *buffer_mgr) {
+UniquePtr<Catalog> Catalog::Deserialize(const nlohmann::json &catalog_json, BufferManager *buffer_mgr, bool lazy_load) {
     SharedPtr<String> data_dir = MakeShared<String>(catalog_json["data_dir"]);
 
     // FIXME: new catalog need a scheduler, current we use nullptr to represent it.
     auto catalog = MakeUnique<Catalog>(std::move(data_dir));
-    catalog->next_txn_id_ = catalog_json["next_txn_id"];
+    catalog->next_txn_id_ = catalog_json["next_txn_id"].get<TransactionID>();
     catalog->full_ckp_commit_ts_ = catalog_json["full_ckp_commit_ts"];
     if (catalog_json.contains("databases")) {
         for (const auto &db_json : catalog_json["databases"]) {
-            UniquePtr<DBMeta> db_meta = DBMeta::Deserialize(db_json, buffer_mgr);
+            UniquePtr<DBMeta> db_meta = DBMeta::Deserialize(db_json, buffer_mgr, lazy_load);
             catalog->db_meta_map().emplace(*db_meta->db_name(), std::move(db_meta));
         }
     }
@@ -855,7 +900,9 @@ void Catalog::SaveFullCatalog(TxnTimeStamp max_commit_ts, String &full_catalog_p
     // Serialize catalog to string
     full_ckp_commit_ts_ = max_commit_ts;
     nlohmann::json catalog_json = Serialize(max_commit_ts);
-    String catalog_str = catalog_json.dump();
+    String catalog_str(FULL_CKP_MAGIC);
+    catalog_str.append(reinterpret_cast<const char *>(&FULL_CKP_VERSION), sizeof(FULL_CKP_VERSION));
+    nlohmann::json::to_msgpack(catalog_json, catalog_str);
 
     // Save catalog to tmp file.
     // FIXME: Temp implementation, will be replaced by async task.
@@ -898,12 +945,19 @@ bool Catalog::SaveDeltaCatalog(TxnTimeStamp max_commit_ts, String &delta_catalog
     }
     LOG_INFO(fmt::format("Save delta catalog commit ts:{}, checkpoint max commit ts:{}.", flush_delta_entry->commit_ts(), max_commit_ts));
 
+    Vector<AddBlockEntryOp *> block_entry_ops;
+    Vector<SegmentEntry *> sealed_segments;
     for (auto &op : flush_delta_entry->operations()) {
         switch (op->GetType()) {
             case CatalogDeltaOpType::ADD_BLOCK_ENTRY: {
-                auto *block_entry_op = static_cast<AddBlockEntryOp *>(op.get());
-                LOG_TRACE(fmt::format("Flush block entry: {}", block_entry_op->ToString()));
-                block_entry_op->FlushDataToDisk(max_commit_ts);
+                block_entry_ops.push_back(static_cast<AddBlockEntryOp *>(op.get()));
+                break;
+            }
+            case CatalogDeltaOpType::SET_SEGMENT_STATUS_SEALED: {
+                auto *set_sealed_op = static_cast<SetSegmentStatusSealedOp *>(op.get());
+                if (set_sealed_op->segment_entry_ != nullptr) {
+                    sealed_segments.push_back(set_sealed_op->segment_entry_);
+                }
                 break;
             }
             case CatalogDeltaOpType::ADD_SEGMENT_INDEX_ENTRY: {
@@ -917,6 +971,13 @@ bool Catalog::SaveDeltaCatalog(TxnTimeStamp max_commit_ts, String &delta_catalog
         }
     }
 
+    FlushBlockEntries(block_entry_ops, max_commit_ts);
+
+    // the blocks of the newly sealed segments are all flushed now
+    for (auto *segment_entry : sealed_segments) {
+        segment_entry->Offload();
+    }
+
     // Save the global catalog delta entry to disk.
     auto exp_size = flush_delta_entry->GetSizeInBytes();
     Vector<char> buf(exp_size);
@@ -948,13 +1009,40 @@ bool Catalog::SaveDeltaCatalog(TxnTimeStamp max_commit_ts, String &delta_catalog
     return false;
 }
 
+void Catalog::FlushBlockEntries(Vector<AddBlockEntryOp *> &block_entry_ops, TxnTimeStamp max_commit_ts) {
+    // Write the blocks in the order of their directories so that the files of a segment land next to each other.
+    std::sort(block_entry_ops.begin(), block_entry_ops.end(), [](const AddBlockEntryOp *lhs, const AddBlockEntryOp *rhs) {
+        return *lhs->block_entry_->base_dir() < *rhs->block_entry_->base_dir();
+    });
+
+    // Throttle the writes so that a large checkpoint doesn't starve the foreground queries of I/O.
+    u64 rate_limit = txn_mgr_->checkpoint_flush_rate_limit();
+    auto start_time = std::chrono::steady_clock::now();
+    u64 written_bytes = 0;
+    for (auto *block_entry_op : block_entry_ops) {
+        LOG_TRACE(fmt::format("Flush block entry: {}", block_entry_op->ToString()));
+        written_bytes += block_entry_op->FlushDataToDisk(max_commit_ts);
+        if (rate_limit == 0) {
+            continue;
+        }
+        auto expected = std::chrono::nanoseconds(static_cast<i64>(static_cast<double>(written_bytes) / rate_limit * 1e9));
+        auto elapsed = std::chrono::steady_clock::now() - start_time;
+        if (expected > elapsed) {
+            std::this_thread::sleep_for(expected - elapsed);
+        }
+    }
+    LOG_INFO(fmt::format("Flushed {} block entries, {} bytes", block_entry_ops.size(), written_bytes));
+}
+
 void Catalog::AddDeltaEntry(UniquePtr<CatalogDeltaEntry> delta_entry, i64 wal_size) {
     global_catalog_delta_entry_->AddDeltaEntry(std::move(delta_entry), wal_size);
 }
 
 void Catalog::ReplayDeltaEntry(UniquePtr<CatalogDeltaEntry> delta_entry) { global_catalog_delta_entry_->ReplayDeltaEntry(std::move(delta_entry)); }
 
-void Catalog::PickCleanup(CleanupScanner *scanner) { db_meta_map_.PickCleanup(scanner); }
+void Catalog::PickCleanup(CleanupScanner *scanner) {
+    db_meta_map_.PickCleanup(scanner, [scanner](const String &db_name) { return scanner->PicksDB(db_name); });
+}
 
 void Catalog::MemIndexCommit() {
     auto db_meta_map_guard = db_meta_map_.GetMetaMap();
@@ -973,14 +1061,16 @@ void Catalog::MemIndexCommitLoop() {
     }
 }
 
-void Catalog::MemIndexRecover(BufferManager *buffer_manager) {
+Vector<TableEntry *> Catalog::GetTableEntriesNolock() {
+    Vector<TableEntry *> table_entries;
     auto db_meta_map_guard = db_meta_map_.GetMetaMap();
     for (auto &[_, db_meta] : *db_meta_map_guard) {
         auto [db_entry, status] = db_meta->GetEntryNolock(0UL, MAX_TIMESTAMP);
         if (status.ok()) {
-            db_entry->MemIndexRecover(buffer_manager);
+            db_entry->GetTableEntriesNolock(table_entries);
         }
     }
+    return table_entries;
 }
 
 Tuple<TxnTimeStamp, i64> Catalog::GetCheckpointState() const { return global_catalog_delta_entry_->GetCheckpointState(); }
@@ -100,6 +100,7 @@ public:
 
 class GlobalCatalogDeltaEntry;
 class CatalogDeltaEntry;
+class AddBlockEntryOp;
 export struct Catalog {
 public:
     explicit Catalog(SharedPtr<String> data_dir);
@@ -204,6 +205,8 @@ public:
 
     static Status RollbackDelete(TableEntry *table_entry, TransactionID txn_id, DeleteState &append_state, BufferManager *buffer_mgr);
 
+    static Status Update(TableEntry *table_entry, TransactionID txn_id, void *txn_store, TxnTimeStamp commit_ts, const UpdateState &update_state);
+
     static Status CommitCompact(TableEntry *table_entry, TransactionID txn_id, TxnTimeStamp commit_ts, TxnCompactStore &compact_store);
 
     static Status RollbackCompact(TableEntry *table_entry, TransactionID txn_id, TxnTimeStamp commit_ts, const TxnCompactStore &compact_store);
@@ -232,6 +235,11 @@ public:
     // Serialization and Deserialization
     nlohmann::json Serialize(TxnTimeStamp max_commit_ts);
 
+    // A full checkpoint file is FULL_CKP_MAGIC, the u32 FULL_CKP_VERSION and the serialized catalog as MessagePack, which is
+    // smaller and much faster to write and parse than the json text. Files of json text are still loaded.
+    static constexpr std::string_view FULL_CKP_MAGIC = "INFCATLG";
+    static constexpr u32 FULL_CKP_VERSION = 1;
+
     void SaveFullCatalog(TxnTimeStamp max_commit_ts, String &full_path);
 
     bool SaveDeltaCatalog(TxnTimeStamp max_commit_ts, String &delta_path);
@@ -242,17 +250,23 @@ public:
 
     static UniquePtr<Catalog> NewCatalog(SharedPtr<String> data_dir, bool create_default_db);
 
-    static UniquePtr<Catalog>
-    LoadFromFiles(const FullCatalogFileInfo &full_ckp_info, const Vector<DeltaCatalogFileInfo> &delta_ckp_infos, BufferManager *buffer_mgr);
+    // lazy_load: the segments and indexes of a table are loaded on its first access instead of on boot
+    static UniquePtr<Catalog> LoadFromFiles(const FullCatalogFileInfo &full_ckp_info,
+                                            const Vector<DeltaCatalogFileInfo> &delta_ckp_infos,
+                                            BufferManager *buffer_mgr,
+                                            bool lazy_load = false);
 
 private:
-    static UniquePtr<Catalog> Deserialize(const nlohmann::json &catalog_json, BufferManager *buffer_mgr);
+    static UniquePtr<Catalog> Deserialize(const nlohmann::json &catalog_json, BufferManager *buffer_mgr, bool lazy_load = false);
 
     static UniquePtr<CatalogDeltaEntry> LoadFromFileDelta(const DeltaCatalogFileInfo &delta_ckp_info);
 
+    // Flush the blocks sorted by their directories, limited to checkpoint_flush_rate_limit bytes per second.
+    void FlushBlockEntries(Vector<AddBlockEntryOp *> &block_entry_ops, TxnTimeStamp max_commit_ts);
+
     void LoadFromEntryDelta(TxnTimeStamp max_commit_ts, BufferManager *buffer_mgr);
 
-    static UniquePtr<Catalog> LoadFromFile(const FullCatalogFileInfo &full_ckp_info, BufferManager *buffer_mgr);
+    static UniquePtr<Catalog> LoadFromFile(const FullCatalogFileInfo &full_ckp_info, BufferManager *buffer_mgr, bool lazy_load = false);
 
 public:
     // Profile related methods
@@ -274,7 +288,7 @@ public:
 
     MetaMap<DBMeta> db_meta_map_{};
 
-    TransactionID next_txn_id_{};
+    Atomic<TransactionID> next_txn_id_{};
 
 private:
     TxnTimeStamp full_ckp_commit_ts_{};
@@ -301,10 +315,16 @@ private: // TODO: remove this
     void MemIndexCommitLoop();
 
 public:
-    void MemIndexRecover(BufferManager* buffer_manager);
+    // The tables of all the databases, for the recovery at startup
+    Vector<TableEntry *> GetTableEntriesNolock();
 
     void PickCleanup(CleanupScanner *scanner);
 
+    CleanupQueue *cleanup_queue() { return &cleanup_queue_; }
+
+private:
+    CleanupQueue cleanup_queue_{};
+
     // delta checkpoint info
 public:
     Tuple<TxnTimeStamp, i64> GetCheckpointState() const;
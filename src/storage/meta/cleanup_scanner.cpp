@@ -26,18 +26,108 @@ import infinity_exception;
 import status;
 import logger;
 import third_party;
+import default_values;
 
 namespace infinity {
 
+void CleanupQueue::Mark(const String &db_name, const String &table_name, TxnTimeStamp commit_ts) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    DBMark &db_mark = dbs_[db_name];
+    if (table_name.empty()) {
+        db_mark.whole_ = true;
+        db_mark.whole_ts_ = std::max(db_mark.whole_ts_, commit_ts);
+        return;
+    }
+    TxnTimeStamp &table_ts = db_mark.tables_[table_name];
+    table_ts = std::max(table_ts, commit_ts);
+}
+
+void CleanupQueue::MarkAll() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    all_ = true;
+}
+
+CleanupTargets CleanupQueue::Take(TxnTimeStamp visible_ts) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    CleanupTargets targets;
+    targets.all_ = all_;
+    all_ = false;
+    for (auto db_iter = dbs_.begin(); db_iter != dbs_.end();) {
+        const String &db_name = db_iter->first;
+        DBMark &db_mark = db_iter->second;
+        if (db_mark.whole_) {
+            targets.whole_dbs_.insert(db_name);
+            db_mark.whole_ = db_mark.whole_ts_ >= visible_ts;
+        }
+        for (auto table_iter = db_mark.tables_.begin(); table_iter != db_mark.tables_.end();) {
+            targets.tables_[db_name].insert(table_iter->first);
+            if (table_iter->second < visible_ts) {
+                table_iter = db_mark.tables_.erase(table_iter);
+            } else {
+                ++table_iter;
+            }
+        }
+        if (!db_mark.whole_ && db_mark.tables_.empty()) {
+            db_iter = dbs_.erase(db_iter);
+        } else {
+            ++db_iter;
+        }
+    }
+    return targets;
+}
+
+SizeT CleanupQueue::Size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    SizeT size = 0;
+    for (const auto &[db_name, db_mark] : dbs_) {
+        size += db_mark.whole_ + db_mark.tables_.size();
+    }
+    return size;
+}
+
 CleanupScanner::CleanupScanner(Catalog *catalog, TxnTimeStamp visible_ts) : catalog_(catalog), visible_ts_(visible_ts) {}
 
 void CleanupScanner::AddEntry(SharedPtr<EntryInterface> entry) { entries_.emplace_back(std::move(entry)); }
 
-void CleanupScanner::Scan() { catalog_->PickCleanup(this); }
+void CleanupScanner::Scan() {
+    targets_ = catalog_->cleanup_queue()->Take(visible_ts_);
+    catalog_->PickCleanup(this);
+}
+
+bool CleanupScanner::PicksDB(const String &db_name) const {
+    return targets_.all_ || targets_.whole_dbs_.contains(db_name) || targets_.tables_.contains(db_name);
+}
+
+bool CleanupScanner::PicksTable(const String &db_name, const String &table_name) const {
+    if (targets_.all_ || targets_.whole_dbs_.contains(db_name)) {
+        return true;
+    }
+    auto iter = targets_.tables_.find(db_name);
+    return iter != targets_.tables_.end() && iter->second.contains(table_name);
+}
 
 void CleanupScanner::Cleanup() && {
-    for (auto &entry : entries_) {
-        std::move(*entry).Cleanup();
+    // Each entry deletes its own files, the entries are deleted in batches on a few threads.
+    SizeT batch_count = (entries_.size() + CLEANUP_BATCH_SIZE - 1) / CLEANUP_BATCH_SIZE;
+    if (batch_count <= 1) {
+        for (auto &entry : entries_) {
+            std::move(*entry).Cleanup();
+        }
+        return;
+    }
+    ThreadPool delete_pool(std::min(batch_count, CLEANUP_THREAD_COUNT));
+    Vector<Future<void>> batches;
+    for (SizeT begin_idx = 0; begin_idx < entries_.size(); begin_idx += CLEANUP_BATCH_SIZE) {
+        SizeT end_idx = std::min(begin_idx + CLEANUP_BATCH_SIZE, entries_.size());
+        batches.push_back(delete_pool.push([this, begin_idx, end_idx](int) {
+            for (SizeT entry_idx = begin_idx; entry_idx < end_idx; ++entry_idx) {
+                std::move(*entries_[entry_idx]).Cleanup();
+            }
+        }));
+    }
+    // An exception of a batch is rethrown here, as the one of the serial cleanup.
+    for (auto &batch : batches) {
+        batch.get();
     }
 }
 
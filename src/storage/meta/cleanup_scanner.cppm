@@ -24,12 +24,50 @@ class Catalog;
 class EntryInterface;
 class MetaInterface;
 
+// What a cleanup walks, the tables of a whole database are in whole_dbs_.
+export struct CleanupTargets {
+    bool all_{false};
+    HashSet<String> whole_dbs_{};
+    HashMap<String, HashSet<String>> tables_{};
+};
+
+// The databases and tables changed by the commits since their last cleanup, so that a cleanup doesn't walk the whole catalog.
+export class CleanupQueue {
+public:
+    // An empty table name marks the whole database, e.g. a dropped one.
+    void Mark(const String &db_name, const String &table_name, TxnTimeStamp commit_ts);
+
+    // The next cleanup walks the whole catalog.
+    void MarkAll();
+
+    // A mark committed at or after visible_ts may have entries the cleanup can't pick yet, it is walked and stays queued.
+    CleanupTargets Take(TxnTimeStamp visible_ts);
+
+    SizeT Size() const;
+
+private:
+    struct DBMark {
+        bool whole_{false};
+        TxnTimeStamp whole_ts_{0};
+        HashMap<String, TxnTimeStamp> tables_{};
+    };
+
+    mutable std::mutex mutex_{};
+    // The replay leaves obsolete entries behind, the first cleanup after the start walks the whole catalog.
+    bool all_{true};
+    HashMap<String, DBMark> dbs_{};
+};
+
 export class CleanupScanner {
 public:
     CleanupScanner(Catalog *catalog, TxnTimeStamp visible_ts);
 
     void Scan();
 
+    bool PicksDB(const String &db_name) const;
+
+    bool PicksTable(const String &db_name, const String &table_name) const;
+
     void Cleanup() &&;
 
     void AddEntry(SharedPtr<EntryInterface> entry);
@@ -42,6 +80,7 @@ private:
     Catalog *const catalog_;
     const TxnTimeStamp visible_ts_;
 
+    CleanupTargets targets_{};
     Vector<SharedPtr<EntryInterface>> entries_;
 };
 
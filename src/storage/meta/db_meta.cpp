@@ -133,14 +133,14 @@ nlohmann::json DBMeta::Serialize(TxnTimeStamp max_commit_ts) {
     return json_res;
 }
 
-UniquePtr<DBMeta> DBMeta::Deserialize(const nlohmann::json &db_meta_json, BufferManager *buffer_mgr) {
+UniquePtr<DBMeta> DBMeta::Deserialize(const nlohmann::json &db_meta_json, BufferManager *buffer_mgr, bool lazy_load) {
     SharedPtr<String> data_dir = MakeShared<String>(db_meta_json["data_dir"]);
     SharedPtr<String> db_name = MakeShared<String>(db_meta_json["db_name"]);
     UniquePtr<DBMeta> res = MakeUnique<DBMeta>(data_dir, db_name);
 
     if (db_meta_json.contains("db_entries")) {
         for (const auto &db_entry_json : db_meta_json["db_entries"]) {
-            res->db_entry_list().emplace_back(DBEntry::Deserialize(db_entry_json, res.get(), buffer_mgr));
+            res->db_entry_list().emplace_back(DBEntry::Deserialize(db_entry_json, res.get(), buffer_mgr, lazy_load));
         }
     }
     res->db_entry_list().sort([](const SharedPtr<BaseEntry> &ent1, const SharedPtr<BaseEntry> &ent2) { return ent1->commit_ts_ > ent2->commit_ts_; });
@@ -28,6 +28,7 @@ import default_values;
 import third_party;
 import vector_buffer;
 import local_file_system;
+import file_system;
 import infinity_exception;
 import varchar_layout;
 import logger;
@@ -35,9 +36,27 @@ import data_file_worker;
 import catalog_delta_entry;
 import internal_types;
 import data_type;
+import block_entry;
+import segment_entry;
+import table_entry;
+import io_stats;
 
 namespace infinity {
 
+namespace {
+
+// Columns of values up to 16 bytes (integers, dates, the inline parts of varchars) are encoded on disk, wider values (e.g.
+// embeddings) seldom repeat and are written as is. Booleans are bitmaps, encoded byte by byte.
+SizeT EncodedValueWidth(const DataType *column_type) {
+    if (column_type->type() == kBoolean) {
+        return 1;
+    }
+    SizeT value_width = column_type->Size();
+    return value_width <= 16 ? value_width : 0;
+}
+
+} // namespace
+
 BlockColumnEntry::BlockColumnEntry(const BlockEntry *block_entry, ColumnID column_id, const SharedPtr<String> &base_dir_ref)
     : BaseEntry(EntryType::kBlockColumn, false), block_entry_(block_entry), column_id_(column_id), base_dir_(base_dir_ref) {}
 
@@ -57,7 +76,9 @@ UniquePtr<BlockColumnEntry> BlockColumnEntry::NewBlockColumnEntry(const BlockEnt
         // TODO
         total_data_size = (row_capacity + 7) / 8;
     }
-    auto file_worker = MakeUnique<DataFileWorker>(block_column_entry->base_dir_, block_column_entry->file_name_, total_data_size);
+    auto file_worker =
+        MakeUnique<DataFileWorker>(block_column_entry->base_dir_, block_column_entry->file_name_, total_data_size, EncodedValueWidth(column_type));
+    file_worker->SetTableIOStats(block_column_entry->table_io_stats());
 
     auto *buffer_mgr = txn->buffer_mgr();
     block_column_entry->buffer_ = buffer_mgr->Allocate(std::move(file_worker));
@@ -79,13 +100,15 @@ UniquePtr<BlockColumnEntry> BlockColumnEntry::NewReplayBlockColumnEntry(const Bl
     DataType *column_type = column_entry->column_type_.get();
     SizeT row_capacity = block_entry->row_capacity();
     SizeT total_data_size = (column_type->type() == kBoolean) ? ((row_capacity + 7) / 8) : (row_capacity * column_type->Size());
-    auto file_worker = MakeUnique<DataFileWorker>(column_entry->base_dir_, column_entry->file_name_, total_data_size);
+    auto file_worker = MakeUnique<DataFileWorker>(column_entry->base_dir_, column_entry->file_name_, total_data_size, EncodedValueWidth(column_type));
+    file_worker->SetTableIOStats(column_entry->table_io_stats());
 
     column_entry->buffer_ = buffer_manager->Get(std::move(file_worker));
 
     for (i32 outline_idx = 0; outline_idx < next_outline_idx; ++outline_idx) {
         // FIXME: not use default value
         auto file_worker = MakeUnique<DataFileWorker>(column_entry->base_dir_, column_entry->OutlineFilename(outline_idx), DEFAULT_FIXLEN_CHUNK_SIZE);
+        file_worker->SetTableIOStats(column_entry->table_io_stats());
         auto *buffer_obj = buffer_manager->Get(std::move(file_worker));
         column_entry->outline_buffers_.emplace_back(buffer_obj);
     }
@@ -94,10 +117,44 @@ UniquePtr<BlockColumnEntry> BlockColumnEntry::NewReplayBlockColumnEntry(const Bl
     return column_entry;
 }
 
+UniquePtr<BlockColumnEntry>
+BlockColumnEntry::NewCloneBlockColumnEntry(const BlockEntry *block_entry, BlockColumnEntry *source_column, BufferManager *buffer_mgr) {
+    const String &clone_dir = *block_entry->base_dir();
+    if (!source_column->buffer_->LinkFile(LocalFileSystem::ConcatenateFilePath(clone_dir, *source_column->file_name_))) {
+        UnrecoverableError(fmt::format("Column file {} to clone is not flushed", source_column->FilePath()));
+    }
+    // The outline buffers created after the flush are not on disk, the flushed rows don't refer to them.
+    i32 next_outline_idx = 0;
+    {
+        std::shared_lock lock(source_column->mutex_);
+        for (auto *outline_buffer : source_column->outline_buffers_) {
+            if (!outline_buffer->LinkFile(LocalFileSystem::ConcatenateFilePath(clone_dir, *source_column->OutlineFilename(next_outline_idx)))) {
+                break;
+            }
+            ++next_outline_idx;
+        }
+    }
+    return NewReplayBlockColumnEntry(block_entry,
+                                     source_column->column_id_,
+                                     buffer_mgr,
+                                     next_outline_idx,
+                                     source_column->LastChunkOff(),
+                                     UNCOMMIT_TS);
+}
+
+SharedPtr<TableIOStats> BlockColumnEntry::table_io_stats() const {
+    const SegmentEntry *segment_entry = block_entry_ != nullptr ? block_entry_->GetSegmentEntry() : nullptr;
+    if (segment_entry == nullptr || segment_entry->GetTableEntry() == nullptr) {
+        return nullptr;
+    }
+    return segment_entry->GetTableEntry()->io_stats();
+}
+
 ColumnVector BlockColumnEntry::GetColumnVector(BufferManager *buffer_mgr) {
     if (this->buffer_ == nullptr) {
         // Get buffer handle from buffer manager
         auto file_worker = MakeUnique<DataFileWorker>(this->base_dir_, this->file_name_, 0);
+        file_worker->SetTableIOStats(table_io_stats());
         this->buffer_ = buffer_mgr->Get(std::move(file_worker));
     }
 
@@ -114,7 +171,106 @@ void BlockColumnEntry::Append(const ColumnVector *input_column_vector, u16 input
     column_vector.AppendWith(*input_column_vector, input_column_vector_offset, append_rows);
 }
 
-void BlockColumnEntry::Flush(BlockColumnEntry *block_column_entry, SizeT checkpoint_row_count) {
+bool BlockColumnEntry::InPlaceUpdatable(const DataType &column_type) {
+    switch (column_type.type()) {
+        case kTinyInt:
+        case kSmallInt:
+        case kInteger:
+        case kBigInt:
+        case kHugeInt:
+        case kFloat:
+        case kDouble:
+        case kDecimal:
+        case kDate:
+        case kTime:
+        case kDateTime:
+        case kTimestamp: {
+            return column_type.Size() <= sizeof(UpdateUndoEntry::old_value_);
+        }
+        default: {
+            return false;
+        }
+    }
+}
+
+void BlockColumnEntry::UpdateInPlace(const Vector<Pair<BlockOffset, SizeT>> &rows,
+                                     const ColumnVector &values,
+                                     TxnTimeStamp commit_ts,
+                                     BufferManager *buffer_mgr) {
+    if (!InPlaceUpdatable(*column_type_)) {
+        UnrecoverableError(fmt::format("Column type {} can't be updated in place", column_type_->ToString()));
+    }
+    if (buffer_ == nullptr) {
+        GetColumnVector(buffer_mgr);
+    }
+    const SizeT value_width = column_type_->Size();
+    const bool constant = values.vector_type() == ColumnVectorType::kConstant;
+
+    BufferHandle buffer_handle = buffer_->Load();
+    auto *base = static_cast<u8 *>(buffer_handle.GetDataMut());
+
+    std::unique_lock lock(mutex_);
+    for (const auto &[offset, value_idx] : rows) {
+        u8 *target = base + offset * value_width;
+        // Keep the old value before it is overwritten, a reader checks the undo entries after reading the base.
+        UpdateUndoEntry &undo_entry = undo_entries_.emplace_back();
+        undo_entry.offset_ = offset;
+        undo_entry.commit_ts_ = commit_ts;
+        std::memcpy(undo_entry.old_value_.data(), target, value_width);
+        last_update_ts_ = commit_ts;
+        std::memcpy(target, values.data() + (constant ? 0 : value_idx) * value_width, value_width);
+    }
+}
+
+void BlockColumnEntry::ReadRows(ColumnVector &output, const ColumnVector &base, BlockOffset read_offset, SizeT row_count, TxnTimeStamp begin_ts)
+    const {
+    if (!InPlaceUpdatable(*column_type_)) {
+        output.AppendWith(base, read_offset, row_count);
+        return;
+    }
+    SizeT output_offset = output.Size();
+    std::shared_lock lock(mutex_);
+    output.AppendWith(base, read_offset, row_count);
+    ApplyUndoNolock(output, output_offset, read_offset, row_count, begin_ts);
+}
+
+void BlockColumnEntry::ApplyUndoNolock(ColumnVector &output, SizeT output_offset, BlockOffset read_offset, SizeT row_count, TxnTimeStamp begin_ts)
+    const {
+    if (last_update_ts_ <= begin_ts) {
+        return;
+    }
+    const SizeT value_width = column_type_->Size();
+    // From the newest to the oldest, so the value before the oldest invisible update wins.
+    for (auto iter = undo_entries_.rbegin(); iter != undo_entries_.rend() && iter->commit_ts_ > begin_ts; ++iter) {
+        if (iter->offset_ < read_offset || iter->offset_ >= read_offset + row_count) {
+            continue;
+        }
+        SizeT output_idx = output_offset + (iter->offset_ - read_offset);
+        std::memcpy(output.data() + output_idx * value_width, iter->old_value_.data(), value_width);
+    }
+}
+
+bool BlockColumnEntry::UpdatedAfter(BlockOffset offset, TxnTimeStamp begin_ts) const {
+    if (last_update_ts_ <= begin_ts) {
+        return false;
+    }
+    std::shared_lock lock(mutex_);
+    for (auto iter = undo_entries_.rbegin(); iter != undo_entries_.rend() && iter->commit_ts_ > begin_ts; ++iter) {
+        if (iter->offset_ == offset) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void BlockColumnEntry::TrimUndo(TxnTimeStamp visible_ts) {
+    std::unique_lock lock(mutex_);
+    while (!undo_entries_.empty() && undo_entries_.front().commit_ts_ <= visible_ts) {
+        undo_entries_.pop_front();
+    }
+}
+
+void BlockColumnEntry::Flush(BlockColumnEntry *block_column_entry, SizeT checkpoint_row_count, Vector<UniquePtr<FileHandler>> &unsynced_files) {
     // TODO: Opt, Flush certain row_count content
     DataType *column_type = block_column_entry->column_type_.get();
     switch (column_type->type()) {
@@ -143,8 +299,7 @@ void BlockColumnEntry::Flush(BlockColumnEntry *block_column_entry, SizeT checkpo
         case kRowID: {
             //            SizeT buffer_size = row_count * column_type->Size();
             if (block_column_entry->buffer_->Save()) {
-                block_column_entry->buffer_->Sync();
-                block_column_entry->buffer_->CloseFile();
+                block_column_entry->buffer_->CloseFile(unsynced_files);
             }
 
             break;
@@ -152,14 +307,12 @@ void BlockColumnEntry::Flush(BlockColumnEntry *block_column_entry, SizeT checkpo
         case kVarchar: {
             //            SizeT buffer_size = row_count * column_type->Size();
             if (block_column_entry->buffer_->Save()) {
-                block_column_entry->buffer_->Sync();
-                block_column_entry->buffer_->CloseFile();
+                block_column_entry->buffer_->CloseFile(unsynced_files);
             }
             std::shared_lock lock(block_column_entry->mutex_);
             for (auto *outline_buffer : block_column_entry->outline_buffers_) {
                 if (outline_buffer && outline_buffer->Save()) {
-                    outline_buffer->Sync();
-                    outline_buffer->CloseFile();
+                    outline_buffer->CloseFile(unsynced_files);
                 }
             }
             break;
@@ -182,6 +335,18 @@ void BlockColumnEntry::Flush(BlockColumnEntry *block_column_entry, SizeT checkpo
     }
 }
 
+void BlockColumnEntry::Offload() {
+    if (buffer_ != nullptr) {
+        buffer_->Offload();
+    }
+    std::shared_lock lock(mutex_);
+    for (auto *outline_buffer : outline_buffers_) {
+        if (outline_buffer) {
+            outline_buffer->Offload();
+        }
+    }
+}
+
 void BlockColumnEntry::Cleanup() {
     if (buffer_ != nullptr) {
         buffer_->SetAndTryCleanup();
@@ -23,10 +23,12 @@ import third_party;
 import buffer_manager;
 import column_vector;
 import local_file_system;
+import file_system;
 import vector_buffer;
 import txn;
 import internal_types;
 import base_entry;
+import io_stats;
 
 namespace infinity {
 
@@ -34,6 +36,13 @@ struct BlockEntry;
 struct TableEntry;
 struct SegmentEntry;
 
+// The value a committed in-place update overwrote, kept until no reader can see the older version any more.
+struct UpdateUndoEntry {
+    BlockOffset offset_{};
+    TxnTimeStamp commit_ts_{};
+    Array<u8, 16> old_value_{};
+};
+
 export struct BlockColumnEntry : public BaseEntry {
     friend struct BlockEntry;
 
@@ -49,6 +58,10 @@ public:
                                                                  u64 last_chunk_offset,
                                                                  TxnTimeStamp commit_ts);
 
+    // The column of a cloned block, the data and outline files of the source column are hard linked into the block dir.
+    static UniquePtr<BlockColumnEntry>
+    NewCloneBlockColumnEntry(const BlockEntry *block_entry, BlockColumnEntry *source_column, BufferManager *buffer_mgr);
+
     nlohmann::json Serialize();
 
     static UniquePtr<BlockColumnEntry> Deserialize(const nlohmann::json &column_data_json, BlockEntry *block_entry, BufferManager *buffer_mgr);
@@ -66,6 +79,9 @@ public:
 
     SharedPtr<String> OutlineFilename(SizeT file_idx) const { return MakeShared<String>(fmt::format("col_{}_out_{}", column_id_, file_idx)); }
 
+    // Of the table owning the block, for the file workers of the column files
+    SharedPtr<TableIOStats> table_io_stats() const;
+
     String FilePath() { return LocalFileSystem::ConcatenateFilePath(*base_dir_, *file_name_); }
     Vector<String> OutlinePaths() const;
 
@@ -93,11 +109,38 @@ public:
 public:
     void Append(const ColumnVector *input_column_vector, u16 input_offset, SizeT append_rows, BufferManager *buffer_mgr);
 
-    static void Flush(BlockColumnEntry *block_column_entry, SizeT row_count);
+    // Fixed-width columns are updated in place, the base data always holds the latest committed value.
+    static bool InPlaceUpdatable(const DataType &column_type);
+
+    // Overwrite the values at block offsets rows[i].first with values[rows[i].second], keeping the old values as undo.
+    void UpdateInPlace(const Vector<Pair<BlockOffset, SizeT>> &rows, const ColumnVector &values, TxnTimeStamp commit_ts, BufferManager *buffer_mgr);
+
+    // Append the rows [read_offset, read_offset + row_count) of base, the column vector of this entry, to output as begin_ts sees
+    // them: the values updated in place after begin_ts are restored from the undo entries. The rows of a column updatable in
+    // place are copied under the lock of UpdateInPlace, so a value is never read half written.
+    void ReadRows(ColumnVector &output, const ColumnVector &base, BlockOffset read_offset, SizeT row_count, TxnTimeStamp begin_ts) const;
+
+    // Whether the row was updated by a transaction that committed after begin_ts.
+    bool UpdatedAfter(BlockOffset offset, TxnTimeStamp begin_ts) const;
+
+    TxnTimeStamp last_update_ts() const { return last_update_ts_; }
+
+    // Drop the undo entries that are older than every active reader.
+    void TrimUndo(TxnTimeStamp visible_ts);
+
+    // The written files are added to unsynced_files, the caller syncs them together.
+    static void Flush(BlockColumnEntry *block_column_entry, SizeT row_count, Vector<UniquePtr<FileHandler>> &unsynced_files);
+
+    // Upload the column files to the cold storage, once the block is sealed and flushed.
+    void Offload();
 
     void Cleanup();
 
 private:
+    // Restore the values of rows [read_offset, read_offset + row_count) that were updated after begin_ts, the rows were
+    // appended to output from output_offset on. Called with mutex_ held.
+    void ApplyUndoNolock(ColumnVector &output, SizeT output_offset, BlockOffset read_offset, SizeT row_count, TxnTimeStamp begin_ts) const;
+
     const BlockEntry *block_entry_{nullptr};
     ColumnID column_id_{};
     SharedPtr<DataType> column_type_{};
@@ -109,6 +152,10 @@ private:
     mutable std::shared_mutex mutex_{};
     Vector<BufferObj *> outline_buffers_{};
     u64 last_chunk_offset_{};
+
+    // Ordered by commit_ts, protected by mutex_.
+    Deque<UpdateUndoEntry> undo_entries_{};
+    Atomic<TxnTimeStamp> last_update_ts_{0};
 };
 
 } // namespace infinity
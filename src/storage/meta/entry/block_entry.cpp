@@ -14,6 +14,7 @@
 
 module;
 
+#include <bit>
 #include <fstream>
 
 module block_entry;
@@ -24,6 +25,7 @@ import logger;
 import third_party;
 import defer_op;
 import local_file_system;
+import file_system;
 import serialize;
 import catalog_delta_entry;
 import internal_types;
@@ -38,6 +40,35 @@ import cleanup_scanner;
 
 namespace infinity {
 
+namespace {
+
+// Whether the row is deleted at begin_ts. A row not deleted has delete_ts 0, which wraps to the largest value, so one unsigned compare
+// covers both conditions and the loops below are vectorized.
+inline bool DeletedAt(TxnTimeStamp delete_ts, TxnTimeStamp begin_ts) { return delete_ts - 1 < begin_ts; }
+
+// The first row in [row_begin, row_end) whose deleted state at begin_ts is `deleted`, or row_end.
+BlockOffset FindRow(const TxnTimeStamp *deleted_ts, BlockOffset row_begin, BlockOffset row_end, TxnTimeStamp begin_ts, bool deleted) {
+    constexpr SizeT kBatch = 8;
+    SizeT row_idx = row_begin;
+    for (; row_idx + kBatch <= row_end; row_idx += kBatch) {
+        u32 match = 0;
+        for (SizeT k = 0; k < kBatch; ++k) {
+            match |= u32(DeletedAt(deleted_ts[row_idx + k], begin_ts) == deleted) << k;
+        }
+        if (match != 0) {
+            return row_idx + std::countr_zero(match);
+        }
+    }
+    for (; row_idx < row_end; ++row_idx) {
+        if (DeletedAt(deleted_ts[row_idx], begin_ts) == deleted) {
+            break;
+        }
+    }
+    return row_idx;
+}
+
+} // namespace
+
 /// class BlockEntry
 BlockEntry::BlockEntry(const SegmentEntry *segment_entry, BlockID block_id, TxnTimeStamp checkpoint_ts)
     : BaseEntry(EntryType::kBlock, false), segment_entry_(segment_entry), block_id_(block_id), row_count_(0), row_capacity_(DEFAULT_VECTOR_SIZE),
@@ -85,45 +116,93 @@ UniquePtr<BlockEntry> BlockEntry::NewReplayBlockEntry(const SegmentEntry *segmen
     return block_entry;
 }
 
+UniquePtr<BlockEntry> BlockEntry::NewCloneBlockEntry(const SegmentEntry *segment_entry,
+                                                     BlockEntry *source_block,
+                                                     TxnTimeStamp begin_ts,
+                                                     BufferManager *buffer_mgr,
+                                                     Vector<BlockOffset> &deleted_offsets) {
+    u16 row_count = 0;
+    {
+        std::shared_lock lock(source_block->rw_locker_);
+        row_count = source_block->block_version_->GetRowCount(begin_ts);
+        if (row_count > source_block->checkpoint_row_count_) {
+            return nullptr;
+        }
+        const Vector<TxnTimeStamp> &deleted = source_block->block_version_->deleted_;
+        for (BlockOffset block_offset = 0; block_offset < row_count; ++block_offset) {
+            if (DeletedAt(deleted[block_offset], begin_ts)) {
+                deleted_offsets.push_back(block_offset);
+            }
+        }
+    }
+
+    // The rows are on disk, only the version file is written until the clone changes.
+    auto block_entry = NewReplayBlockEntry(segment_entry,
+                                           source_block->block_id_,
+                                           row_count,
+                                           source_block->row_capacity_,
+                                           begin_ts,    /*min_row_ts*/
+                                           begin_ts,    /*max_row_ts*/
+                                           UNCOMMIT_TS, /*commit_ts*/
+                                           begin_ts,    /*checkpoint_ts*/
+                                           row_count,   /*checkpoint_row_count*/
+                                           buffer_mgr);
+    for (ColumnID column_id = 0; column_id < source_block->columns_.size(); ++column_id) {
+        auto column_entry = BlockColumnEntry::NewCloneBlockColumnEntry(block_entry.get(), source_block->columns_[column_id].get(), buffer_mgr);
+        block_entry->AddColumnReplay(std::move(column_entry), column_id);
+    }
+    block_entry->FlushVersion(*block_entry->block_version_);
+    return block_entry;
+}
+
 Pair<BlockOffset, BlockOffset> BlockEntry::GetVisibleRange(TxnTimeStamp begin_ts, u16 block_offset_begin) const {
     std::shared_lock lock(rw_locker_);
     begin_ts = std::min(begin_ts, this->max_row_ts_);
     auto &block_version = this->block_version_;
-    auto &deleted = block_version->deleted_;
     BlockOffset block_offset_end = block_version->GetRowCount(begin_ts);
-    while (block_offset_begin < block_offset_end && deleted[block_offset_begin] != 0 && deleted[block_offset_begin] <= begin_ts) {
-        block_offset_begin++;
+    if (block_offset_begin >= block_offset_end) {
+        return {block_offset_begin, block_offset_begin};
     }
-    BlockOffset row_idx;
-    for (row_idx = block_offset_begin; row_idx < block_offset_end; ++row_idx) {
-        if (deleted[row_idx] != 0 && deleted[row_idx] <= begin_ts) {
-            break;
-        }
+    if (!block_version->AnyDeleted(begin_ts)) {
+        return {block_offset_begin, block_offset_end};
     }
+    const TxnTimeStamp *deleted_ts = block_version->deleted_.data();
+    block_offset_begin = FindRow(deleted_ts, block_offset_begin, block_offset_end, begin_ts, false);
+    BlockOffset row_idx = FindRow(deleted_ts, block_offset_begin, block_offset_end, begin_ts, true);
     return {block_offset_begin, row_idx};
 }
 
 bool BlockEntry::CheckRowVisible(BlockOffset block_offset, TxnTimeStamp check_ts) const {
     std::shared_lock lock(rw_locker_);
     auto &block_version = this->block_version_;
-    auto &deleted = block_version->deleted_;
-    return deleted[block_offset] == 0 || deleted[block_offset] > check_ts;
+    if (!block_version->AnyDeleted(check_ts)) {
+        return true;
+    }
+    return !DeletedAt(block_version->deleted_[block_offset], check_ts);
 }
 
 void BlockEntry::SetDeleteBitmask(TxnTimeStamp query_ts, Bitmask &bitmask) const {
-    BlockOffset read_offset = 0;
-    while (true) {
-        auto [row_begin, row_end] = GetVisibleRange(query_ts, read_offset);
-        if (row_begin == row_end) {
-            break;
-        }
-        for (BlockOffset offset = read_offset; offset < row_begin; ++offset) {
-            bitmask.SetFalse(offset);
+    std::shared_lock lock(rw_locker_);
+    TxnTimeStamp begin_ts = std::min(query_ts, this->max_row_ts_);
+    auto &block_version = this->block_version_;
+    BlockOffset visible_row_count = block_version->GetRowCount(begin_ts);
+    if (block_version->AnyDeleted(begin_ts)) {
+        // The deleted rows of every 64 rows are gathered into a word, then cleared bit by bit. Deleted rows are few.
+        const TxnTimeStamp *deleted_ts = block_version->deleted_.data();
+        for (SizeT word_begin = 0; word_begin < visible_row_count; word_begin += 64) {
+            SizeT word_rows = std::min(SizeT(64), visible_row_count - word_begin);
+            u64 deleted_bits = 0;
+            for (SizeT k = 0; k < word_rows; ++k) {
+                deleted_bits |= u64(DeletedAt(deleted_ts[word_begin + k], begin_ts)) << k;
+            }
+            while (deleted_bits != 0) {
+                bitmask.SetFalse(word_begin + std::countr_zero(deleted_bits));
+                deleted_bits &= deleted_bits - 1;
+            }
         }
-        read_offset = row_end;
     }
-    // FIXME: read row_count_ is not thread safe
-    for (BlockOffset offset = read_offset; offset < row_count_; ++offset) {
+    // The rows appended after query_ts
+    for (BlockOffset offset = visible_row_count; offset < row_count_; ++offset) {
         bitmask.SetFalse(offset);
     }
 }
@@ -179,12 +258,69 @@ void BlockEntry::DeleteData(TransactionID txn_id, TxnTimeStamp commit_ts, const
 
     auto &block_version = this->block_version_;
     for (BlockOffset block_offset : rows) {
-        block_version->deleted_[block_offset] = commit_ts;
+        block_version->Delete(block_offset, commit_ts);
     }
 
     LOG_TRACE(fmt::format("Segment {} Block {} has deleted {} rows", segment_id, block_id, rows.size()));
 }
 
+void BlockEntry::UpdateData(TransactionID txn_id,
+                            TxnTimeStamp commit_ts,
+                            const Vector<ColumnID> &column_ids,
+                            const DataBlock *values,
+                            const Vector<Pair<BlockOffset, SizeT>> &rows,
+                            BufferManager *buffer_mgr) {
+    std::unique_lock<std::shared_mutex> lck(this->rw_locker_);
+    if (this->using_txn_id_ != 0 && this->using_txn_id_ != txn_id) {
+        UnrecoverableError(
+            fmt::format("Multiple transactions are changing data of Segment: {}, Block: {}", this->segment_entry_->segment_id(), this->block_id_));
+    }
+
+    this->using_txn_id_ = txn_id;
+
+    for (SizeT i = 0; i < column_ids.size(); ++i) {
+        columns_[column_ids[i]]->UpdateInPlace(rows, *values->column_vectors[i], commit_ts, buffer_mgr);
+    }
+    last_update_ts_ = commit_ts;
+    // The filters were built on the old values.
+    fast_rough_filter_.Invalidate();
+
+    LOG_TRACE(fmt::format("Segment {} Block {} has updated {} rows", this->segment_entry_->segment_id(), this->block_id_, rows.size()));
+}
+
+bool BlockEntry::CheckUpdateConflict(const Vector<BlockOffset> &offsets, TxnTimeStamp begin_ts) const {
+    std::shared_lock<std::shared_mutex> lck(this->rw_locker_);
+    const Vector<TxnTimeStamp> &deleted = this->block_version_->deleted_;
+    for (BlockOffset block_offset : offsets) {
+        if (deleted[block_offset] != 0 && deleted[block_offset] > begin_ts) {
+            return true;
+        }
+    }
+    if (last_update_ts_ <= begin_ts) {
+        return false;
+    }
+    for (const auto &column : columns_) {
+        if (column->last_update_ts() <= begin_ts) {
+            continue;
+        }
+        for (BlockOffset block_offset : offsets) {
+            if (column->UpdatedAfter(block_offset, begin_ts)) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+void BlockEntry::TrimUndo(TxnTimeStamp visible_ts) {
+    if (last_update_ts_ == 0) {
+        return;
+    }
+    for (auto &column : columns_) {
+        column->TrimUndo(visible_ts);
+    }
+}
+
 void BlockEntry::CommitBlock(TransactionID txn_id, TxnTimeStamp commit_ts) {
     std::unique_lock w_lock(this->rw_locker_);
 
@@ -213,26 +349,34 @@ void BlockEntry::CommitBlock(TransactionID txn_id, TxnTimeStamp commit_ts) {
     }
 }
 
-void BlockEntry::FlushData(int64_t checkpoint_row_count) {
+SizeT BlockEntry::FlushData(int64_t checkpoint_row_count) {
+    // the column files are written one by one and synced at once, so the device sees many fsyncs in flight
+    Vector<UniquePtr<FileHandler>> unsynced_files;
+    SizeT written_bytes = 0;
     SizeT column_count = this->columns_.size();
     SizeT column_idx = 0;
     while (column_idx < column_count) {
         BlockColumnEntry *block_column_entry = this->columns_[column_idx].get();
-        BlockColumnEntry::Flush(block_column_entry, checkpoint_row_count);
-        LOG_TRACE(fmt::format("ColumnData {} is flushed", block_column_entry->column_id()));
+        BlockColumnEntry::Flush(block_column_entry, checkpoint_row_count, unsynced_files);
+        written_bytes += checkpoint_row_count * block_column_entry->column_type()->Size();
+        LOG_TRACE(fmt::format("ColumnData {} is written", block_column_entry->column_id()));
         ++column_idx;
     }
+    LocalFileSystem fs;
+    fs.SyncFiles(unsynced_files);
+    return written_bytes;
 }
 
 void BlockEntry::FlushVersion(BlockVersion &checkpoint_version) { checkpoint_version.SaveToFile(this->VersionFilePath()); }
 
-void BlockEntry::Flush(TxnTimeStamp checkpoint_ts, bool check_commit) {
+SizeT BlockEntry::Flush(TxnTimeStamp checkpoint_ts, bool check_commit) {
     LOG_TRACE(fmt::format("Segment: {}, Block: {} is being flushing", this->segment_entry_->segment_id(), this->block_id_));
     if (checkpoint_ts < this->checkpoint_ts_) {
         UnrecoverableError(
             fmt::format("BlockEntry checkpoint_ts skew! checkpoint_ts: {}, this->checkpoint_ts_: {}", checkpoint_ts, this->checkpoint_ts_));
     }
     int checkpoint_row_count = 0;
+    bool version_changed = true;
 
     BlockVersion checkpoint_version(this->block_version_->deleted_.size());
     {
@@ -241,44 +385,53 @@ void BlockEntry::Flush(TxnTimeStamp checkpoint_ts, bool check_commit) {
         if (check_commit) {
             // Skip if entry has been flushed at some previous checkpoint, or is invisible at current checkpoint.
             if (this->max_row_ts_ <= this->checkpoint_ts_ || this->min_row_ts_ > checkpoint_ts)
-                return;
+                return 0;
             checkpoint_row_count = this->block_version_->GetRowCount(checkpoint_ts);
         } else {
             checkpoint_row_count = this->row_count_;
         }
         if (checkpoint_row_count == 0) {
             LOG_TRACE(fmt::format("Block entry {} is empty at checkpoint_ts {}", this->block_id_, checkpoint_ts));
-            return;
+            return 0;
         }
         const Vector<TxnTimeStamp> &deleted = this->block_version_->deleted_;
         if (checkpoint_row_count <= this->checkpoint_row_count_) {
             // BlockEntry doesn't append rows between the previous checkpoint and checkpoint_ts.
             bool deleted_between = false;
-            for (int i = 0; i < checkpoint_row_count; i++) {
+            for (int i = 0; i < checkpoint_row_count && this->block_version_->max_delete_ts() > this->checkpoint_ts_; i++) {
                 if (deleted[i] > this->checkpoint_ts_ && deleted[i] <= checkpoint_ts) {
                     deleted_between = true;
                     break;
                 }
             }
-            if (!deleted_between) // BlockEntry doesn't change between the previous checkpoint and checkpoint_ts.
-                return;
+            // The columns updated in place are written as a whole.
+            bool updated_between = this->last_update_ts_ > this->checkpoint_ts_;
+            if (!deleted_between && !updated_between) // BlockEntry doesn't change between the previous checkpoint and checkpoint_ts.
+                return 0;
+            // Only updated in place, the version file on disk is still current.
+            version_changed = deleted_between;
+        }
+        if (version_changed) {
+            checkpoint_version.created_ = this->block_version_->created_;
+            checkpoint_version.deleted_ = deleted;
         }
-        checkpoint_version.created_ = this->block_version_->created_;
-        checkpoint_version.deleted_ = deleted;
     }
-    for (int i = 0; i < checkpoint_row_count; i++) {
-        if (checkpoint_version.deleted_[i] > checkpoint_ts) {
-            checkpoint_version.deleted_[i] = 0;
+    SizeT written_bytes = 0;
+    if (version_changed) {
+        for (int i = 0; i < checkpoint_row_count; i++) {
+            if (checkpoint_version.deleted_[i] > checkpoint_ts) {
+                checkpoint_version.deleted_[i] = 0;
+            }
         }
+        FlushVersion(checkpoint_version);
+        written_bytes += checkpoint_row_count * sizeof(TxnTimeStamp);
     }
-
-    FlushVersion(checkpoint_version);
-    FlushData(checkpoint_row_count);
+    written_bytes += FlushData(checkpoint_row_count);
     this->checkpoint_ts_ = checkpoint_ts;
     this->checkpoint_row_count_ = checkpoint_row_count;
     LOG_TRACE(
         fmt::format("Segment: {}, Block {} is flushed {} rows", this->segment_entry_->segment_id(), this->block_id_, this->checkpoint_row_count_));
-    return;
+    return written_bytes;
 }
 
 void BlockEntry::FlushForImport(TxnTimeStamp checkpoint_ts) { this->Flush(checkpoint_ts, false); }
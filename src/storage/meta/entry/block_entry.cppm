@@ -65,6 +65,14 @@ public:
                                                      u16 checkpoint_row_count,
                                                      BufferManager *buffer_mgr);
 
+    // A block of a cloned segment with the rows of the source block visible at begin_ts, its column files are hard linked to those of the
+    // source. The rows deleted by begin_ts are appended to deleted_offsets. Returns nullptr if the visible rows are not all flushed.
+    static UniquePtr<BlockEntry> NewCloneBlockEntry(const SegmentEntry *segment_entry,
+                                                    BlockEntry *source_block,
+                                                    TxnTimeStamp begin_ts,
+                                                    BufferManager *buffer_mgr,
+                                                    Vector<BlockOffset> &deleted_offsets);
+
 public:
     nlohmann::json Serialize(TxnTimeStamp max_commit_ts);
 
@@ -76,7 +84,8 @@ public:
 
     void Cleanup();
 
-    void Flush(TxnTimeStamp checkpoint_ts, bool check_commit = true);
+    // Returns the approximate bytes written, 0 if the block didn't change since the previous checkpoint.
+    SizeT Flush(TxnTimeStamp checkpoint_ts, bool check_commit = true);
 
     void FlushForImport(TxnTimeStamp checkpoint_ts);
 
@@ -88,6 +97,19 @@ protected:
 
     void DeleteData(TransactionID txn_id, TxnTimeStamp commit_ts, const Vector<BlockOffset> &rows);
 
+    // Overwrite the fixed-width columns of the rows in place, the rows are pairs of (block offset, row in values).
+    void UpdateData(TransactionID txn_id,
+                    TxnTimeStamp commit_ts,
+                    const Vector<ColumnID> &column_ids,
+                    const DataBlock *values,
+                    const Vector<Pair<BlockOffset, SizeT>> &rows,
+                    BufferManager *buffer_mgr);
+
+    // Whether one of the rows was deleted or updated by a transaction that committed after begin_ts.
+    bool CheckUpdateConflict(const Vector<BlockOffset> &offsets, TxnTimeStamp begin_ts) const;
+
+    void TrimUndo(TxnTimeStamp visible_ts);
+
     void CommitBlock(TransactionID txn_id, TxnTimeStamp commit_ts);
 
     static SharedPtr<String> DetermineDir(const String &parent_dir, BlockID block_id);
@@ -106,6 +128,8 @@ public:
 
     inline TxnTimeStamp checkpoint_ts() const { return checkpoint_ts_; }
 
+    inline TxnTimeStamp last_update_ts() const { return last_update_ts_; }
+
     inline TransactionID using_txn_id() const { return using_txn_id_; }
 
     inline u16 checkpoint_row_count() const { return checkpoint_row_count_; }
@@ -142,7 +166,7 @@ public:
     inline void IncreaseRowCount(SizeT increased_row_count) { row_count_ += increased_row_count; }
 
 private:
-    void FlushData(i64 checkpoint_row_count);
+    SizeT FlushData(i64 checkpoint_row_count);
 
     void FlushVersion(BlockVersion &checkpoint_version);
 
@@ -164,6 +188,7 @@ protected:
     TxnTimeStamp min_row_ts_{UNCOMMIT_TS}; // Indicate the commit_ts which create this BlockEntry
     TxnTimeStamp max_row_ts_{0};           // Indicate the max commit_ts which create/update/delete data inside this BlockEntry
     TxnTimeStamp checkpoint_ts_{0};        // replay not set
+    Atomic<TxnTimeStamp> last_update_ts_{0}; // The commit_ts of the last in-place update
 
     TransactionID using_txn_id_{0}; // Temporarily used to lock the modification to block entry.
 
@@ -78,6 +78,7 @@ void BlockVersion::LoadFromFile(const String &version_path) {
     if (ptr - buf.data() != buf_len) {
         UnrecoverableError(fmt::format("Failed to load block_version file: {}", version_path));
     }
+    ResetDeleteSummary();
 }
 
 void BlockVersion::SaveToFile(const String &version_path) {
@@ -103,6 +104,23 @@ void BlockVersion::SaveToFile(const String &version_path) {
     ofs.close();
 }
 
+void BlockVersion::Delete(BlockOffset block_offset, TxnTimeStamp commit_ts) {
+    deleted_[block_offset] = commit_ts;
+    min_delete_ts_ = std::min(min_delete_ts_, commit_ts);
+    max_delete_ts_ = std::max(max_delete_ts_, commit_ts);
+}
+
+void BlockVersion::ResetDeleteSummary() {
+    min_delete_ts_ = UNCOMMIT_TS;
+    max_delete_ts_ = 0;
+    for (TxnTimeStamp delete_ts : deleted_) {
+        if (delete_ts != 0) {
+            min_delete_ts_ = std::min(min_delete_ts_, delete_ts);
+            max_delete_ts_ = std::max(max_delete_ts_, delete_ts);
+        }
+    }
+}
+
 void BlockVersion::Cleanup(const String &version_path) {
     LocalFileSystem fs;
 
@@ -17,6 +17,7 @@ module;
 export module block_version;
 
 import stl;
+import default_values;
 
 namespace infinity {
 
@@ -45,9 +46,24 @@ export struct BlockVersion {
 
     void Cleanup(const String &version_path);
 
+    // Mark the row deleted at commit_ts, deleted_ is only written here so the summary holds.
+    void Delete(BlockOffset block_offset, TxnTimeStamp commit_ts);
+
+    // Whether any row is deleted at begin_ts, false for nearly all blocks of a steady table.
+    bool AnyDeleted(TxnTimeStamp begin_ts) const { return min_delete_ts_ <= begin_ts; }
+
+    TxnTimeStamp max_delete_ts() const { return max_delete_ts_; }
+
     Vector<CreateField> created_{}; // second field width is same as timestamp, otherwise Valgrind will issue BlockVersion::SaveToFile has
                                     // risk to write uninitialized buffer. (ts, rows)
     Vector<TxnTimeStamp> deleted_{};
+
+private:
+    void ResetDeleteSummary();
+
+    // Summary of deleted_, not persisted
+    TxnTimeStamp min_delete_ts_{UNCOMMIT_TS};
+    TxnTimeStamp max_delete_ts_{0};
 };
 
 } // namespace infinity
@@ -64,6 +64,17 @@ export struct DeleteState {
     HashMap<SegmentID, HashMap<BlockID, Vector<BlockOffset>>> rows_; // use segment id, as the first level key, block id as the second level key
 };
 
+// The values of one in-place update, the rows map to (block offset, row in values_).
+export struct UpdateBatch {
+    Vector<ColumnID> column_ids_;
+    SharedPtr<DataBlock> values_;
+    HashMap<SegmentID, HashMap<BlockID, Vector<Pair<BlockOffset, SizeT>>>> rows_;
+};
+
+export struct UpdateState {
+    Vector<UpdateBatch> batches_;
+};
+
 export struct GetState {};
 
 export enum class ScanStateType {
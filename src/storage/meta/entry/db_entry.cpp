@@ -77,11 +77,26 @@ Tuple<TableEntry *, Status> DBEntry::CreateTable(TableEntryType table_entry_type
                                                  TransactionID txn_id,
                                                  TxnTimeStamp begin_ts,
                                                  TxnManager *txn_mgr,
-                                                 ConflictType conflict_type) {
+                                                 ConflictType conflict_type,
+                                                 SizeT segment_capacity,
+                                                 ColumnID sort_column_id,
+                                                 ColumnID ttl_column_id,
+                                                 u64 ttl_seconds) {
     auto init_table_meta = [&]() { return TableMeta::NewTableMeta(this->db_entry_dir_, table_name, this); };
     LOG_TRACE(fmt::format("Adding new table entry: {}", *table_name));
     auto [table_meta, r_lock] = this->table_meta_map_.GetMeta(*table_name, std::move(init_table_meta));
-    return table_meta->CreateEntry(std::move(r_lock), table_entry_type, table_name, columns, txn_id, begin_ts, txn_mgr, conflict_type);
+    return table_meta->CreateEntry(std::move(r_lock),
+                                   table_entry_type,
+                                   table_name,
+                                   columns,
+                                   txn_id,
+                                   begin_ts,
+                                   txn_mgr,
+                                   conflict_type,
+                                   segment_capacity,
+                                   sort_column_id,
+                                   ttl_column_id,
+                                   ttl_seconds);
 }
 
 Tuple<SharedPtr<TableEntry>, Status>
@@ -201,7 +216,7 @@ Status DBEntry::GetTablesDetail(TransactionID txn_id, TxnTimeStamp begin_ts, Vec
         table_detail.table_entry_type_ = table_entry->EntryType();
         table_detail.column_count_ = table_entry->ColumnCount();
         table_detail.row_count_ = table_entry->row_count();
-        table_detail.segment_capacity_ = DEFAULT_SEGMENT_CAPACITY;
+        table_detail.segment_capacity_ = table_entry->segment_capacity();
         table_detail.block_capacity_ = DEFAULT_BLOCK_CAPACITY;
 
         SharedPtr<BlockIndex> segment_index = table_entry->GetBlockIndex(begin_ts);
@@ -246,7 +261,7 @@ nlohmann::json DBEntry::Serialize(TxnTimeStamp max_commit_ts) {
     return json_res;
 }
 
-UniquePtr<DBEntry> DBEntry::Deserialize(const nlohmann::json &db_entry_json, DBMeta *db_meta, BufferManager *buffer_mgr) {
+UniquePtr<DBEntry> DBEntry::Deserialize(const nlohmann::json &db_entry_json, DBMeta *db_meta, BufferManager *buffer_mgr, bool lazy_load) {
     nlohmann::json json_res;
 
     bool deleted = db_entry_json["deleted"];
@@ -265,7 +280,7 @@ UniquePtr<DBEntry> DBEntry::Deserialize(const nlohmann::json &db_entry_json, DBM
 
     if (db_entry_json.contains("tables")) {
         for (const auto &table_meta_json : db_entry_json["tables"]) {
-            UniquePtr<TableMeta> table_meta = TableMeta::Deserialize(table_meta_json, res.get(), buffer_mgr);
+            UniquePtr<TableMeta> table_meta = TableMeta::Deserialize(table_meta_json, res.get(), buffer_mgr, lazy_load);
             res->table_meta_map().emplace(*table_meta->table_name_, std::move(table_meta));
         }
     }
@@ -281,7 +296,9 @@ String DBEntry::GetPathNameTail() const {
     return db_entry_dir_->substr(delimiter_i + 1);
 }
 
-void DBEntry::PickCleanup(CleanupScanner *scanner) { table_meta_map_.PickCleanup(scanner); }
+void DBEntry::PickCleanup(CleanupScanner *scanner) {
+    table_meta_map_.PickCleanup(scanner, [this, scanner](const String &table_name) { return scanner->PicksTable(*db_name_, table_name); });
+}
 
 void DBEntry::Cleanup() {
     if (this->deleted_) {
@@ -303,12 +320,12 @@ void DBEntry::MemIndexCommit() {
     }
 }
 
-void DBEntry::MemIndexRecover(BufferManager *buffer_manager) {
+void DBEntry::GetTableEntriesNolock(Vector<TableEntry *> &table_entries) {
     auto table_meta_map_guard = table_meta_map_.GetMetaMap();
     for (auto &[_, table_meta] : *table_meta_map_guard) {
         auto [table_entry, status] = table_meta->GetEntryNolock(0UL, MAX_TIMESTAMP);
         if (status.ok()) {
-            table_entry->MemIndexRecover(buffer_manager);
+            table_entries.push_back(table_entry);
         }
     }
 }
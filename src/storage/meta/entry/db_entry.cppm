@@ -31,6 +31,7 @@ import meta_map;
 import random;
 import meta_entry_interface;
 import cleanup_scanner;
+import default_values;
 
 namespace infinity {
 
@@ -69,7 +70,7 @@ public:
 
     nlohmann::json Serialize(TxnTimeStamp max_commit_ts);
 
-    static UniquePtr<DBEntry> Deserialize(const nlohmann::json &db_entry_json, DBMeta *db_meta, BufferManager *buffer_mgr);
+    static UniquePtr<DBEntry> Deserialize(const nlohmann::json &db_entry_json, DBMeta *db_meta, BufferManager *buffer_mgr, bool lazy_load = false);
 
     [[nodiscard]] const SharedPtr<String> &db_name_ptr() const { return db_name_; }
 
@@ -83,7 +84,11 @@ public:
                                             TransactionID txn_id,
                                             TxnTimeStamp begin_ts,
                                             TxnManager *txn_mgr,
-                                            ConflictType conflict_type);
+                                            ConflictType conflict_type,
+                                            SizeT segment_capacity = DEFAULT_SEGMENT_CAPACITY,
+                                            ColumnID sort_column_id = INVALID_COLUMN_ID,
+                                            ColumnID ttl_column_id = INVALID_COLUMN_ID,
+                                            u64 ttl_seconds = 0);
 
     Tuple<SharedPtr<TableEntry>, Status>
     DropTable(const String &table_collection_name, ConflictType conflict_type, TransactionID txn_id, TxnTimeStamp begin_ts, TxnManager *txn_mgr);
@@ -144,6 +149,6 @@ public:
     void Cleanup() override;
 
     void MemIndexCommit();
-    void MemIndexRecover(BufferManager *buffer_manager);
+    void GetTableEntriesNolock(Vector<TableEntry *> &table_entries);
 };
 } // namespace infinity
@@ -41,6 +41,7 @@ import catalog_delta_entry;
 import status;
 import compact_segments_task;
 import cleanup_scanner;
+import block_column_entry;
 import background_process;
 import wal_entry;
 
@@ -59,7 +60,7 @@ SharedPtr<SegmentEntry> SegmentEntry::NewSegmentEntry(TableEntry *table_entry, S
     SharedPtr<SegmentEntry> segment_entry = MakeShared<SegmentEntry>(table_entry,
                                                                      SegmentEntry::DetermineSegmentDir(*table_entry->TableEntryDir(), segment_id),
                                                                      segment_id,
-                                                                     DEFAULT_SEGMENT_CAPACITY,
+                                                                     table_entry->segment_capacity(),
                                                                      table_entry->ColumnCount(),
                                                                      SegmentStatus::kUnsealed);
     segment_entry->begin_ts_ = txn->BeginTS();
@@ -92,6 +93,58 @@ SharedPtr<SegmentEntry> SegmentEntry::NewReplaySegmentEntry(TableEntry *table_en
     return segment_entry;
 }
 
+Tuple<SharedPtr<SegmentEntry>, Status>
+SegmentEntry::NewCloneSegmentEntry(TableEntry *table_entry,
+                                   SegmentID segment_id,
+                                   SegmentEntry *source_segment,
+                                   Txn *txn,
+                                   Vector<RowID> &deleted_rows) {
+    TxnTimeStamp begin_ts = txn->BeginTS();
+    auto segment_entry = NewReplaySegmentEntry(table_entry,
+                                               segment_id,
+                                               SegmentStatus::kSealed,
+                                               source_segment->column_count_,
+                                               0,
+                                               0,
+                                               source_segment->row_capacity_,
+                                               begin_ts,    /*min_row_ts*/
+                                               begin_ts,    /*max_row_ts*/
+                                               UNCOMMIT_TS, /*commit_ts*/
+                                               UNCOMMIT_TS, /*deprecate_ts*/
+                                               begin_ts,
+                                               txn->TxnID());
+    Vector<SharedPtr<BlockEntry>> source_blocks;
+    {
+        std::shared_lock lock(source_segment->rw_locker_);
+        for (const auto &block_entry : source_segment->block_entries_) {
+            if (block_entry->min_row_ts() <= begin_ts) {
+                source_blocks.push_back(block_entry);
+            }
+        }
+    }
+    SizeT row_count = 0;
+    for (const auto &source_block : source_blocks) {
+        Vector<BlockOffset> deleted_offsets;
+        auto block_entry = BlockEntry::NewCloneBlockEntry(segment_entry.get(), source_block.get(), begin_ts, txn->buffer_mgr(), deleted_offsets);
+        if (block_entry.get() == nullptr) {
+            segment_entry->Cleanup();
+            String error_message =
+                fmt::format("Segment {} block {} to clone is not flushed", source_segment->segment_id_, source_block->block_id());
+            return {nullptr, Status::TxnConflict(txn->TxnID(), error_message)};
+        }
+        BlockID block_id = block_entry->block_id();
+        SegmentOffset block_begin = SegmentOffset(block_id) * DEFAULT_BLOCK_CAPACITY;
+        for (BlockOffset block_offset : deleted_offsets) {
+            deleted_rows.emplace_back(segment_id, block_begin + block_offset);
+        }
+        row_count += block_entry->row_count();
+        segment_entry->AddBlockReplay(std::move(block_entry), block_id);
+    }
+    segment_entry->row_count_ = row_count;
+    segment_entry->actual_row_count_ = row_count;
+    return {segment_entry, Status::OK()};
+}
+
 bool SegmentEntry::SetSealed() {
     std::unique_lock lock(rw_locker_);
     if (status_ != SegmentStatus::kUnsealed) {
@@ -101,6 +154,19 @@ bool SegmentEntry::SetSealed() {
     return true;
 }
 
+void SegmentEntry::Offload() {
+    std::shared_lock lock(rw_locker_);
+    OffloadInner();
+}
+
+void SegmentEntry::OffloadInner() {
+    for (auto &block_entry : block_entries_) {
+        for (auto &column : block_entry->columns()) {
+            column->Offload();
+        }
+    }
+}
+
 void SegmentEntry::AddBlockReplay(SharedPtr<BlockEntry> block_entry, BlockID block_id) {
     BlockID cur_blocks_size = block_entries_.size();
     if (block_id >= cur_blocks_size) {
@@ -114,7 +180,7 @@ bool SegmentEntry::TrySetCompacting(CompactSegmentsTask *compact_task) {
     if (status_ == SegmentStatus::kUnsealed) {
         UnrecoverableError("Assert: Compactable segment should be sealed.");
     }
-    if (status_ != SegmentStatus::kSealed) {
+    if (status_ != SegmentStatus::kSealed || !update_txns_.empty()) {
         return false;
     }
     compact_task_ = compact_task;
@@ -165,6 +231,41 @@ bool SegmentEntry::CheckDeleteConflict(Vector<Pair<SegmentEntry *, Vector<Segmen
     return false;
 }
 
+bool SegmentEntry::CheckUpdateConflict(const Vector<Pair<SegmentEntry *, Vector<SegmentOffset>>> &segments,
+                                       TransactionID txn_id,
+                                       TxnTimeStamp begin_ts) {
+    SizeT checked = 0;
+    bool conflict = false;
+    for (; checked < segments.size(); ++checked) {
+        const auto &[segment_entry, update_offsets] = segments[checked];
+        std::unique_lock lock(segment_entry->rw_locker_);
+        if (segment_entry->status_ != SegmentStatus::kSealed && segment_entry->status_ != SegmentStatus::kUnsealed) {
+            conflict = true;
+            break;
+        }
+        HashMap<BlockID, Vector<BlockOffset>> block_offsets;
+        for (SegmentOffset segment_offset : update_offsets) {
+            block_offsets[segment_offset / DEFAULT_BLOCK_CAPACITY].push_back(segment_offset % DEFAULT_BLOCK_CAPACITY);
+        }
+        for (const auto &[block_id, offsets] : block_offsets) {
+            if (segment_entry->block_entries_.at(block_id)->CheckUpdateConflict(offsets, begin_ts)) {
+                conflict = true;
+                break;
+            }
+        }
+        if (conflict) {
+            break;
+        }
+        segment_entry->update_txns_.insert(txn_id);
+    }
+    if (conflict) {
+        for (SizeT i = 0; i < checked; ++i) {
+            segments[i].first->RollbackUpdate(txn_id);
+        }
+    }
+    return conflict;
+}
+
 bool SegmentEntry::CheckRowVisible(SegmentOffset segment_offset, TxnTimeStamp check_ts) const {
     // FIXME: get the block_capacity from config?
     u32 block_capacity = DEFAULT_BLOCK_CAPACITY;
@@ -290,6 +391,7 @@ void SegmentEntry::DeleteData(TransactionID txn_id,
         if (this->first_delete_ts_ == UNCOMMIT_TS) {
             this->first_delete_ts_ = commit_ts;
         }
+        this->last_delete_ts_ = std::max(this->last_delete_ts_, commit_ts);
         if (status_ == SegmentStatus::kDeprecated) {
             UnrecoverableError("Assert: Should not commit delete to deprecated segment.");
         }
@@ -315,6 +417,51 @@ void SegmentEntry::DeleteData(TransactionID txn_id,
     }
 }
 
+// One writer
+void SegmentEntry::UpdateData(TransactionID txn_id,
+                              TxnTimeStamp commit_ts,
+                              const Vector<ColumnID> &column_ids,
+                              const DataBlock *values,
+                              const HashMap<BlockID, Vector<Pair<BlockOffset, SizeT>>> &block_row_hashmap,
+                              Txn *txn) {
+    TxnTableStore *txn_store = txn->GetTxnTableStore(table_entry_);
+
+    for (const auto &[block_id, update_rows] : block_row_hashmap) {
+        BlockEntry *block_entry = nullptr;
+        {
+            std::shared_lock lck(this->rw_locker_);
+            block_entry = block_entries_.at(block_id).get();
+        }
+
+        block_entry->UpdateData(txn_id, commit_ts, column_ids, values, update_rows, txn->buffer_mgr());
+        txn_store->AddBlockStore(this, block_entry);
+    }
+    {
+        std::unique_lock w_lock(rw_locker_);
+        if (status_ != SegmentStatus::kSealed && status_ != SegmentStatus::kUnsealed) {
+            UnrecoverableError("Assert: Should not commit update to a compacted segment.");
+        }
+        this->last_update_ts_ = std::max(this->last_update_ts_, commit_ts);
+        fast_rough_filter_.Invalidate();
+        update_txns_.erase(txn_id);
+    }
+}
+
+void SegmentEntry::RollbackUpdate(TransactionID txn_id) {
+    std::unique_lock w_lock(rw_locker_);
+    update_txns_.erase(txn_id);
+}
+
+void SegmentEntry::TrimUndo(TxnTimeStamp visible_ts) {
+    std::shared_lock lock(rw_locker_);
+    if (last_update_ts_ == 0) {
+        return;
+    }
+    for (auto &block_entry : block_entries_) {
+        block_entry->TrimUndo(visible_ts);
+    }
+}
+
 void SegmentEntry::CommitSegment(TransactionID txn_id, TxnTimeStamp commit_ts) {
     std::unique_lock w_lock(rw_locker_);
     min_row_ts_ = std::min(min_row_ts_, commit_ts);
@@ -385,6 +532,9 @@ nlohmann::json SegmentEntry::Serialize(TxnTimeStamp max_commit_ts) {
                 json_res["block_entries"].emplace_back(block_entry->Serialize(max_commit_ts));
             }
         }
+        if (status_ == SegmentStatus::kSealed) {
+            OffloadInner();
+        }
     }
     return json_res;
 }
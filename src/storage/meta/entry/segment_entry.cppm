@@ -30,6 +30,8 @@ import fast_rough_filter;
 import value;
 import meta_entry_interface;
 import cleanup_scanner;
+import status;
+import internal_types;
 
 namespace infinity {
 
@@ -37,6 +39,7 @@ class TxnTableStore;
 struct TableEntry;
 class CompactSegmentsTask;
 class BlockEntryIter;
+class DataBlock;
 
 export enum class SegmentStatus : u8 {
     kUnsealed,
@@ -76,6 +79,11 @@ public:
                                                          TxnTimeStamp begin_ts,
                                                          TransactionID txn_id);
 
+    // A sealed segment of the cloned table_entry with the rows of source_segment visible to txn, made of the blocks of
+    // BlockEntry::NewCloneBlockEntry. The rows deleted in the source are appended to deleted_rows.
+    static Tuple<SharedPtr<SegmentEntry>, Status>
+    NewCloneSegmentEntry(TableEntry *table_entry, SegmentID segment_id, SegmentEntry *source_segment, Txn *txn, Vector<RowID> &deleted_rows);
+
     nlohmann::json Serialize(TxnTimeStamp max_commit_ts);
 
     static SharedPtr<SegmentEntry> Deserialize(const nlohmann::json &table_entry_json, TableEntry *table_entry, BufferManager *buffer_mgr);
@@ -85,6 +93,9 @@ public:
 
     bool SetSealed();
 
+    // Upload the flushed column files of a sealed segment to the cold storage.
+    void Offload();
+
     bool TrySetCompacting(CompactSegmentsTask *compact_task);
 
     void SetNoDelete();
@@ -97,6 +108,10 @@ public:
 
     static bool CheckDeleteConflict(Vector<Pair<SegmentEntry *, Vector<SegmentOffset>>> &&segments, TransactionID txn_id);
 
+    // An in-place update conflicts with compaction and with the changes committed to the rows after begin_ts.
+    static bool
+    CheckUpdateConflict(const Vector<Pair<SegmentEntry *, Vector<SegmentOffset>>> &segments, TransactionID txn_id, TxnTimeStamp begin_ts);
+
     bool CheckRowVisible(SegmentOffset segment_offset, TxnTimeStamp check_ts) const;
 
     bool CheckVisible(TxnTimeStamp check_ts) const;
@@ -157,6 +172,11 @@ public:
         return deprecate_ts_;
     }
 
+    TxnTimeStamp last_delete_ts() const {
+        std::shared_lock lock(rw_locker_);
+        return last_delete_ts_;
+    }
+
     SharedPtr<BlockEntry> GetBlockEntryByID(BlockID block_id) const;
 
 public:
@@ -164,6 +184,18 @@ public:
 
     void DeleteData(TransactionID txn_id, TxnTimeStamp commit_ts, const HashMap<BlockID, Vector<BlockOffset>> &block_row_hashmap, Txn *txn);
 
+    void UpdateData(TransactionID txn_id,
+                    TxnTimeStamp commit_ts,
+                    const Vector<ColumnID> &column_ids,
+                    const DataBlock *values,
+                    const HashMap<BlockID, Vector<Pair<BlockOffset, SizeT>>> &block_row_hashmap,
+                    Txn *txn);
+
+    void RollbackUpdate(TransactionID txn_id);
+
+    // Drop the undo of the in-place updates older than every active reader.
+    void TrimUndo(TxnTimeStamp visible_ts);
+
     void CommitSegment(TransactionID txn_id, TxnTimeStamp commit_ts);
 
     void RollbackBlocks(TxnTimeStamp commit_ts, const Vector<BlockEntry *> &block_entry);
@@ -171,6 +203,9 @@ public:
 private:
     static SharedPtr<String> DetermineSegmentDir(const String &parent_dir, SegmentID seg_id);
 
+    // called when lock held
+    void OffloadInner();
+
 protected: // protected for unit test
     // called when lock held
     void IncreaseRowCount(SizeT increased_row_count) {
@@ -201,6 +236,7 @@ private:
     TxnTimeStamp min_row_ts_{UNCOMMIT_TS}; // Indicate the commit_ts which create this SegmentEntry
     TxnTimeStamp max_row_ts_{0};
     TxnTimeStamp first_delete_ts_{UNCOMMIT_TS}; // Indicate the first delete commit ts. If not delete, it is UNCOMMIT_TS
+    TxnTimeStamp last_delete_ts_{0};            // Indicate the last delete commit ts. If not delete, it is 0
     TxnTimeStamp deprecate_ts_{UNCOMMIT_TS};    // FIXME: need persist to disk
 
     Vector<SharedPtr<BlockEntry>> block_entries_{};
@@ -213,6 +249,8 @@ private:
 
     std::condition_variable_any no_delete_complete_cv_{};
     HashSet<TransactionID> delete_txns_; // current number of delete txn that write this segment
+    HashSet<TransactionID> update_txns_; // the in-place update txns not committed yet, the segment isn't compacted meanwhile
+    TxnTimeStamp last_update_ts_{0};
 
 public:
     void Cleanup() override;
@@ -37,6 +37,7 @@ import hnsw_alg;
 import catalog_delta_entry;
 import column_vector;
 import annivfflat_index_data;
+import annivfpq_index_data;
 import secondary_index_data;
 import type_info;
 import embedding_info;
@@ -46,6 +47,7 @@ import block_column_entry;
 import default_values;
 import segment_iter;
 import annivfflat_index_file_worker;
+import annivfpq_index_file_worker;
 import hnsw_file_worker;
 import secondary_index_file_worker;
 import index_full_text;
@@ -56,12 +58,25 @@ import local_file_system;
 import column_length_io;
 import chunk_index_entry;
 import abstract_hnsw;
+import hnsw_mem_index;
+import segment_entry;
+import secondary_index_in_mem;
+import term_meta_cache;
+import bitmap_index_data;
+import bitmap_index_file_worker;
+import index_build_progress;
 
 namespace infinity {
 
 SegmentIndexEntry::SegmentIndexEntry(TableIndexEntry *table_index_entry, SegmentID segment_id, Vector<BufferObj *> vector_buffer)
     : BaseEntry(EntryType::kSegmentIndex, false), table_index_entry_(table_index_entry), segment_id_(segment_id),
-      vector_buffer_(std::move(vector_buffer)){};
+      vector_buffer_(std::move(vector_buffer)) {
+    if (table_index_entry_ != nullptr && table_index_entry_->index_base()->pinned_) {
+        for (auto *buffer_obj : vector_buffer_) {
+            buffer_obj->Pin();
+        }
+    }
+}
 
 SharedPtr<SegmentIndexEntry> SegmentIndexEntry::CreateFakeEntry() {
     SharedPtr<SegmentIndexEntry> fake_entry;
@@ -138,7 +153,8 @@ void SegmentIndexEntry::MemIndexInsert(SharedPtr<BlockEntry> block_entry,
                                        u32 row_offset,
                                        u32 row_count,
                                        TxnTimeStamp commit_ts,
-                                       BufferManager *buffer_manager) {
+                                       BufferManager *buffer_manager,
+                                       bool column_kept) {
     u32 seg_id = block_entry->segment_id();
     u16 block_id = block_entry->block_id();
     RowID begin_row_id(seg_id, row_offset + u32(block_id) * block_entry->row_capacity());
@@ -172,12 +188,41 @@ void SegmentIndexEntry::MemIndexInsert(SharedPtr<BlockEntry> block_entry,
                 MakeShared<FullTextColumnLengthFileHandler>(MakeUnique<LocalFileSystem>(), column_length_file_path, this);
             BlockColumnEntry *block_column_entry = block_entry->GetColumnBlockEntry(column_id);
             SharedPtr<ColumnVector> column_vector = MakeShared<ColumnVector>(block_column_entry->GetColumnVector(buffer_manager));
-            memory_indexer_->Insert(column_vector, row_offset, row_count, std::move(column_length_file_handler), false);
+            memory_indexer_->Insert(column_vector, row_offset, row_count, std::move(column_length_file_handler), false, column_kept);
+            break;
+        }
+        case IndexType::kHnsw: {
+            const auto *index_hnsw = static_cast<const IndexHnsw *>(index_base);
+            SizeT dimension = static_cast<EmbeddingInfo *>(column_def->type()->type_info().get())->Dimension();
+            if (hnsw_mem_index_.get() == nullptr) {
+                // a range never spans blocks, so the chunk has room for the block that takes it past the dump row count
+                auto hnsw_mem_index = MakeShared<HnswMemIndex>(index_hnsw, dimension, HNSW_MEM_INDEX_DUMP_ROW_COUNT + DEFAULT_BLOCK_CAPACITY);
+                std::unique_lock<std::shared_mutex> lck(rw_locker_);
+                hnsw_mem_index_ = std::move(hnsw_mem_index);
+                hnsw_mem_base_rowid_ = begin_row_id;
+            } else {
+                assert(begin_row_id == hnsw_mem_base_rowid_ + u32(hnsw_mem_index_->row_count()));
+            }
+            BlockColumnEntry *block_column_entry = block_entry->GetColumnBlockEntry(column_id);
+            ColumnVector column_vector = block_column_entry->GetColumnVector(buffer_manager);
+            const auto *data = reinterpret_cast<const f32 *>(column_vector.data()) + SizeT(row_offset) * dimension;
+            hnsw_mem_index_->Insert(data, begin_row_id.segment_offset_, row_count);
+            break;
+        }
+        case IndexType::kSecondary:
+        case IndexType::kBitmap: {
+            if (secondary_index_in_mem_.get() == nullptr) {
+                auto secondary_index_in_mem = SecondaryIndexInMem::NewSecondaryIndexInMem(column_def->type());
+                std::unique_lock<std::shared_mutex> lck(rw_locker_);
+                secondary_index_in_mem_ = std::move(secondary_index_in_mem);
+            }
+            BlockColumnEntry *block_column_entry = block_entry->GetColumnBlockEntry(column_id);
+            ColumnVector column_vector = block_column_entry->GetColumnVector(buffer_manager);
+            secondary_index_in_mem_->Insert(column_vector, row_offset, row_count, begin_row_id.segment_offset_, commit_ts);
             break;
         }
         case IndexType::kIVFFlat:
-        case IndexType::kHnsw:
-        case IndexType::kSecondary: {
+        case IndexType::kIVFPQ: {
             UniquePtr<String> err_msg =
                 MakeUnique<String>(fmt::format("{} realtime index is not supported yet", IndexInfo::IndexTypeToString(index_base->index_type_)));
             LOG_WARN(*err_msg);
@@ -204,6 +249,26 @@ void SegmentIndexEntry::MemIndexCommit() {
 SharedPtr<ChunkIndexEntry> SegmentIndexEntry::MemIndexDump(bool spill) {
     SharedPtr<ChunkIndexEntry> chunk_index_entry = nullptr;
     const IndexBase *index_base = table_index_entry_->index_base();
+    if (index_base->index_type_ == IndexType::kHnsw) {
+        // The hnsw chunk is rebuilt from the column data on recovery, so it is never spilled.
+        if (spill || hnsw_mem_index_.get() == nullptr)
+            return nullptr;
+        const String &index_dir = *table_index_entry_->index_dir();
+        LocalFileSystem fs;
+        if (!fs.Exists(index_dir)) {
+            fs.CreateDirectory(index_dir);
+        }
+        String base_name = fmt::format("hnsw_{}", hnsw_mem_base_rowid_.ToUint64());
+        hnsw_mem_index_->Dump(fmt::format("{}/{}", index_dir, base_name));
+        chunk_index_entry = MakeShared<ChunkIndexEntry>(this, base_name, hnsw_mem_base_rowid_, hnsw_mem_index_->row_count());
+        // searches see the rows either in the mutable chunk or in the dumped one
+        std::unique_lock lock(rw_locker_);
+        assert(chunk_index_entries_.empty() ||
+               hnsw_mem_base_rowid_ == chunk_index_entries_.back()->base_rowid_ + chunk_index_entries_.back()->row_count_);
+        chunk_index_entries_.push_back(chunk_index_entry);
+        hnsw_chunks_.emplace(base_name, std::move(hnsw_mem_index_));
+        return chunk_index_entry;
+    }
     if (index_base->index_type_ != IndexType::kFullText || memory_indexer_.get() == nullptr)
         return nullptr;
     memory_indexer_->Dump(false, spill);
@@ -214,6 +279,17 @@ SharedPtr<ChunkIndexEntry> SegmentIndexEntry::MemIndexDump(bool spill) {
     return chunk_index_entry;
 }
 
+bool SegmentIndexEntry::MemIndexFull(const BufferManager *buffer_mgr) {
+    if (hnsw_mem_index_.get() == nullptr) {
+        return false;
+    }
+    SizeT row_count = hnsw_mem_index_->row_count();
+    if (row_count >= HNSW_MEM_INDEX_DUMP_ROW_COUNT) {
+        return true;
+    }
+    return row_count >= HNSW_MEM_INDEX_PRESSURE_DUMP_ROW_COUNT && buffer_mgr->memory_pressure() == MemoryPressure::kCritical;
+}
+
 void SegmentIndexEntry::MemIndexLoad(const String &base_name, RowID base_row_id) {
     const IndexBase *index_base = table_index_entry_->index_base();
     if (index_base->index_type_ != IndexType::kFullText)
@@ -272,8 +348,10 @@ void SegmentIndexEntry::PopulateEntirely(const SegmentEntry *segment_entry, Txn
             break;
         }
         case IndexType::kIVFFlat:
+        case IndexType::kIVFPQ:
         case IndexType::kHnsw:
-        case IndexType::kSecondary: {
+        case IndexType::kSecondary:
+        case IndexType::kBitmap: {
             UniquePtr<String> err_msg =
                 MakeUnique<String>(fmt::format("{} PopulateEntirely is not supported yet", IndexInfo::IndexTypeToString(index_base->index_type_)));
             LOG_WARN(*err_msg);
@@ -327,6 +405,28 @@ Status SegmentIndexEntry::CreateIndexPrepare(const SegmentEntry *segment_entry,
             }
             break;
         }
+        case IndexType::kIVFPQ: {
+            if (column_def->type()->type() != LogicalType::kEmbedding) {
+                UnrecoverableError("AnnIVFPQ only supports embedding type.");
+            }
+            auto embedding_info = static_cast<EmbeddingInfo *>(column_def->type()->type_info().get());
+            if (embedding_info->Type() != kElemFloat) {
+                RecoverableError(Status::NotSupport("Not support data type for index ivfpq."));
+            }
+            u32 dimension = embedding_info->Dimension();
+            u32 full_row_count = segment_entry->row_count();
+            BufferHandle buffer_handle = GetIndex();
+            auto annivfpq_index = reinterpret_cast<AnnIVFPQIndexData *>(buffer_handle.GetDataMut());
+            if (check_ts) {
+                OneColumnIterator<float> iter(segment_entry, buffer_mgr, column_def->id(), begin_ts);
+                annivfpq_index->BuildIndex(iter, dimension, full_row_count);
+            } else {
+                // Not check ts in uncommitted segment when compact segment
+                OneColumnIterator<float, false> iter(segment_entry, buffer_mgr, column_def->id(), begin_ts);
+                annivfpq_index->BuildIndex(iter, dimension, full_row_count);
+            }
+            break;
+        }
         case IndexType::kHnsw: {
             auto index_hnsw = static_cast<const IndexHnsw *>(index_base);
             if (column_def->type()->type() != LogicalType::kEmbedding) {
@@ -397,6 +497,16 @@ Status SegmentIndexEntry::CreateIndexPrepare(const SegmentEntry *segment_entry,
             secondary_index_builder->EndOutput();
             break;
         }
+        case IndexType::kBitmap: {
+            auto &data_type = column_def->type();
+            if (!(data_type->CanBuildSecondaryIndex())) {
+                UnrecoverableError(fmt::format("Cannot build bitmap index on data type: {}", data_type->ToString()));
+            }
+            BufferHandle buffer_handle = GetIndex();
+            auto bitmap_index = static_cast<BitmapIndexData *>(buffer_handle.GetDataMut());
+            bitmap_index->Build(segment_entry, buffer_mgr, column_def->id(), begin_ts, check_ts);
+            break;
+        }
         default: {
             UniquePtr<String> err_msg =
                 MakeUnique<String>(fmt::format("Invalid index type: {}", IndexInfo::IndexTypeToString(index_base->index_type_)));
@@ -425,15 +535,23 @@ Status SegmentIndexEntry::CreateIndexDo(atomic_u64 &create_index_idx) {
                 case kElemFloat: {
                     AbstractHnsw<f32, SegmentOffset> abstract_hnsw(buffer_handle.GetDataMut(), index_hnsw);
                     SizeT vertex_n = abstract_hnsw.GetVertexNum();
+                    IndexBuildProgress *build_progress = table_index_entry_->build_progress();
                     while (true) {
-                        SizeT idx = create_index_idx.fetch_add(1);
-                        if (idx % 10000 == 0) {
-                            LOG_TRACE(fmt::format("Insert index: {}", idx));
-                        }
-                        if (idx >= vertex_n) {
+                        // Claim a batch at a time, a claim per vertex makes all the tasks contend on the same counter.
+                        SizeT begin_idx = create_index_idx.fetch_add(HNSW_BUILD_BATCH_SIZE);
+                        if (begin_idx >= vertex_n) {
                             break;
                         }
-                        abstract_hnsw.Build(idx);
+                        SizeT end_idx = std::min(begin_idx + HNSW_BUILD_BATCH_SIZE, vertex_n);
+                        LOG_TRACE(fmt::format("Insert index: {}/{}", begin_idx, vertex_n));
+                        abstract_hnsw.BuildRange(begin_idx, end_idx);
+                        if (build_progress != nullptr) {
+                            SizeT built_n = end_idx - begin_idx;
+                            build_progress->AddRowsDone(built_n);
+                            if (hnsw_rows_built_.fetch_add(built_n) + built_n == vertex_n) {
+                                build_progress->FinishSegment();
+                            }
+                        }
                     }
                     break;
                 }
@@ -450,6 +568,221 @@ Status SegmentIndexEntry::CreateIndexDo(atomic_u64 &create_index_idx) {
     return Status::OK();
 }
 
+namespace {
+
+constexpr std::string_view HNSW_REBUILD_PREFIX = "hnsw_rebuild";
+
+bool IsHnswRebuildChunk(const ChunkIndexEntry &chunk_index_entry) { return chunk_index_entry.base_name_.starts_with(HNSW_REBUILD_PREFIX); }
+
+// The visible rows of the segment below `end_offset`. Copyable, so a pq store can train on a pass of its own.
+class HnswRebuildIter {
+public:
+    HnswRebuildIter(const SegmentEntry *segment_entry, BufferManager *buffer_mgr, ColumnID column_id, TxnTimeStamp begin_ts, SegmentOffset end_offset)
+        : iter_(segment_entry, buffer_mgr, column_id, begin_ts), end_offset_(end_offset) {}
+
+    Optional<Pair<const f32 *, SegmentOffset>> Next() {
+        auto ret = iter_.Next();
+        if (!ret.has_value() || ret->second >= end_offset_) {
+            return None;
+        }
+        return ret;
+    }
+
+private:
+    OneColumnIterator<f32> iter_;
+    SegmentOffset end_offset_;
+};
+
+} // namespace
+
+SizeT SegmentIndexEntry::GetHnswIndexRowCount() {
+    const auto *index_hnsw = static_cast<const IndexHnsw *>(table_index_entry_->index_base());
+    BufferHandle buffer_handle = GetIndex();
+    AbstractHnsw<f32, SegmentOffset> abstract_hnsw(buffer_handle.GetDataMut(), index_hnsw);
+    return abstract_hnsw.GetVertexNum();
+}
+
+SizeT SegmentIndexEntry::GetSecondaryIndexRowCount() {
+    BufferHandle buffer_handle = GetIndex();
+    if (table_index_entry_->index_base()->index_type_ == IndexType::kBitmap) {
+        return static_cast<const BitmapIndexData *>(buffer_handle.GetData())->GetFullDataNum();
+    }
+    return static_cast<const SecondaryIndexDataHead *>(buffer_handle.GetData())->GetFullDataNum();
+}
+
+void SegmentIndexEntry::CreateEmptySecondaryIndex() {
+    if (table_index_entry_->index_base()->index_type_ == IndexType::kBitmap) {
+        // a newly allocated bitmap index has no keys, loading it is enough
+        BufferHandle buffer_handle = GetIndex();
+        return;
+    }
+    const ColumnDef *column_def = table_index_entry_->column_def().get();
+    auto secondary_index_builder = GetSecondaryIndexDataBuilder(column_def->type(), 0, DEFAULT_BLOCK_CAPACITY);
+    secondary_index_builder->StartOutput();
+    {
+        BufferHandle buffer_handle_head = GetIndex();
+        auto secondary_index_head = static_cast<SecondaryIndexDataHead *>(buffer_handle_head.GetDataMut());
+        secondary_index_builder->OutputToHeader(secondary_index_head);
+    }
+    secondary_index_builder->EndOutput();
+}
+
+Vector<SharedPtr<HnswMemIndex>> SegmentIndexEntry::GetHnswChunks() {
+    const auto *index_hnsw = static_cast<const IndexHnsw *>(table_index_entry_->index_base());
+    Vector<SharedPtr<HnswMemIndex>> hnsw_chunks;
+    std::unique_lock lock(rw_locker_);
+    for (const auto &chunk_index_entry : chunk_index_entries_) {
+        auto &hnsw_chunk = hnsw_chunks_[chunk_index_entry->base_name_];
+        if (hnsw_chunk.get() == nullptr) {
+            String path = fmt::format("{}/{}", *table_index_entry_->index_dir(), chunk_index_entry->base_name_);
+            if (IsHnswRebuildChunk(*chunk_index_entry)) {
+                hnsw_chunk = HnswMemIndex::Load(index_hnsw, path, index_hnsw->encode_type_);
+                hnsw_rebuild_excluded_ = chunk_index_entry->row_count_ - hnsw_chunk->row_count();
+            } else {
+                hnsw_chunk = HnswMemIndex::Load(index_hnsw, path);
+            }
+        }
+        hnsw_chunks.push_back(hnsw_chunk);
+    }
+    if (hnsw_mem_index_.get() != nullptr) {
+        hnsw_chunks.push_back(hnsw_mem_index_);
+    }
+    return hnsw_chunks;
+}
+
+void SegmentIndexEntry::Warmup() {
+    const IndexBase *index_base = table_index_entry_->index_base();
+    const bool lock = index_base->pinned_;
+    bool locked = true;
+    for (auto *buffer_obj : vector_buffer_) {
+        BufferHandle buffer_handle = buffer_obj->Load();
+        if (index_base->index_type_ == IndexType::kHnsw) {
+            // a persisted hnsw index is mapped, loading it reads only the pages of the header
+            AbstractHnsw<f32, SegmentOffset> abstract_hnsw(const_cast<void *>(buffer_handle.GetData()), static_cast<const IndexHnsw *>(index_base));
+            locked &= abstract_hnsw.Prefault(lock);
+        }
+    }
+    if (index_base->index_type_ == IndexType::kHnsw) {
+        for (const auto &hnsw_chunk : GetHnswChunks()) {
+            locked &= hnsw_chunk->Prefault(lock);
+        }
+    }
+    if (!locked) {
+        LOG_WARN(fmt::format("Can't lock the hnsw files of segment {} of index {} in memory, check the RLIMIT_MEMLOCK.",
+                             segment_id_,
+                             *table_index_entry_->index_dir()));
+    }
+}
+
+SharedPtr<ChunkIndexEntry> SegmentIndexEntry::MergeHnswChunks(const SegmentEntry *segment_entry, BufferManager *buffer_mgr) {
+    Vector<SharedPtr<ChunkIndexEntry>> chunk_index_entries;
+    GetChunkIndexEntries(chunk_index_entries);
+    if (!chunk_index_entries.empty() && IsHnswRebuildChunk(*chunk_index_entries[0])) {
+        // the rebuilt chunk keeps the encoding of the segment index, only the chunks appended after it are merged
+        chunk_index_entries.erase(chunk_index_entries.begin());
+    }
+    if (chunk_index_entries.size() <= 1 || hnsw_rebuilding_.load()) {
+        return nullptr;
+    }
+    const auto *index_hnsw = static_cast<const IndexHnsw *>(table_index_entry_->index_base());
+    const ColumnDef *column_def = table_index_entry_->column_def().get();
+    SizeT dimension = static_cast<EmbeddingInfo *>(column_def->type()->type_info().get())->Dimension();
+
+    RowID base_rowid = chunk_index_entries[0]->base_rowid_;
+    u32 total_row_count = 0;
+    for (const auto &chunk_index_entry : chunk_index_entries) {
+        total_row_count += chunk_index_entry->row_count_;
+    }
+    // rebuild from the column data, the chunks cover a contiguous range of the segment
+    auto merged_chunk = MakeShared<HnswMemIndex>(index_hnsw, dimension, total_row_count);
+    SegmentOffset end_offset = base_rowid.segment_offset_ + total_row_count;
+    for (SegmentOffset offset = base_rowid.segment_offset_; offset < end_offset;) {
+        BlockID block_id = offset / DEFAULT_BLOCK_CAPACITY;
+        BlockOffset block_offset = offset % DEFAULT_BLOCK_CAPACITY;
+        SizeT row_count = std::min(SizeT(DEFAULT_BLOCK_CAPACITY - block_offset), SizeT(end_offset - offset));
+        SharedPtr<BlockEntry> block_entry = segment_entry->GetBlockEntryByID(block_id);
+        ColumnVector column_vector = block_entry->GetColumnBlockEntry(column_def->id())->GetColumnVector(buffer_mgr);
+        const auto *data = reinterpret_cast<const f32 *>(column_vector.data()) + SizeT(block_offset) * dimension;
+        merged_chunk->Insert(data, offset, row_count);
+        offset += row_count;
+    }
+    String base_name = fmt::format("hnsw_{}_{}", base_rowid.ToUint64(), total_row_count);
+    merged_chunk->Dump(fmt::format("{}/{}", *table_index_entry_->index_dir(), base_name));
+
+    SharedPtr<ChunkIndexEntry> merged_chunk_index_entry = MakeShared<ChunkIndexEntry>(this, base_name, base_rowid, total_row_count);
+    ReplaceChunkIndexEntries(merged_chunk_index_entry);
+    std::unique_lock lock(rw_locker_);
+    for (const auto &chunk_index_entry : chunk_index_entries) {
+        hnsw_chunks_.erase(chunk_index_entry->base_name_);
+    }
+    hnsw_chunks_.emplace(base_name, std::move(merged_chunk));
+    return merged_chunk_index_entry;
+}
+
+bool SegmentIndexEntry::HnswIndexReplaced() {
+    std::shared_lock lock(rw_locker_);
+    return !chunk_index_entries_.empty() && IsHnswRebuildChunk(*chunk_index_entries_[0]);
+}
+
+f64 SegmentIndexEntry::GetHnswTombstoneRatio(const SegmentEntry *segment_entry) {
+    SizeT row_count = segment_entry->row_count();
+    if (row_count == 0) {
+        return 0;
+    }
+    GetHnswChunks(); // the rows left out of a rebuilt chunk are known once it is mapped
+    SizeT deleted_row_count = row_count - segment_entry->actual_row_count();
+    std::shared_lock lock(rw_locker_);
+    if (deleted_row_count <= hnsw_rebuild_excluded_) {
+        return 0;
+    }
+    return f64(deleted_row_count - hnsw_rebuild_excluded_) / row_count;
+}
+
+SharedPtr<ChunkIndexEntry> SegmentIndexEntry::RebuildHnsw(const SegmentEntry *segment_entry, BufferManager *buffer_mgr, TxnTimeStamp begin_ts) {
+    SegmentOffset end_offset = 0;
+    {
+        std::shared_lock lock(rw_locker_);
+        if (!chunk_index_entries_.empty()) {
+            const auto &last_chunk = chunk_index_entries_.back();
+            end_offset = last_chunk->base_rowid_.segment_offset_ + last_chunk->row_count_;
+        }
+    }
+    if (end_offset == 0) {
+        end_offset = GetHnswIndexRowCount();
+    }
+    if (end_offset == 0) {
+        return nullptr;
+    }
+    const auto *index_hnsw = static_cast<const IndexHnsw *>(table_index_entry_->index_base());
+    const ColumnDef *column_def = table_index_entry_->column_def().get();
+    SizeT dimension = static_cast<EmbeddingInfo *>(column_def->type()->type_info().get())->Dimension();
+
+    // The graph is built anew rather than repaired around the deleted vertices, the labels are segment offsets so nothing is remapped.
+    auto rebuilt_chunk = MakeShared<HnswMemIndex>(index_hnsw, dimension, end_offset, index_hnsw->encode_type_);
+    rebuilt_chunk->Build(HnswRebuildIter(segment_entry, buffer_mgr, column_def->id(), begin_ts, end_offset), end_offset);
+    const String &index_dir = *table_index_entry_->index_dir();
+    LocalFileSystem fs;
+    if (!fs.Exists(index_dir)) {
+        fs.CreateDirectory(index_dir);
+    }
+    String base_name = fmt::format("{}_{}", HNSW_REBUILD_PREFIX, begin_ts);
+    rebuilt_chunk->Dump(fmt::format("{}/{}", index_dir, base_name));
+
+    auto rebuilt_chunk_index_entry = MakeShared<ChunkIndexEntry>(this, base_name, RowID(segment_id_, 0), end_offset);
+    std::unique_lock lock(rw_locker_);
+    auto covered_end = std::find_if(chunk_index_entries_.begin(), chunk_index_entries_.end(), [&](const auto &chunk_index_entry) {
+        return chunk_index_entry->base_rowid_.segment_offset_ + chunk_index_entry->row_count_ > end_offset;
+    });
+    for (auto iter = chunk_index_entries_.begin(); iter != covered_end; ++iter) {
+        hnsw_chunks_.erase((*iter)->base_name_);
+    }
+    chunk_index_entries_.erase(chunk_index_entries_.begin(), covered_end);
+    chunk_index_entries_.insert(chunk_index_entries_.begin(), rebuilt_chunk_index_entry);
+    hnsw_rebuild_excluded_ = end_offset - rebuilt_chunk->row_count();
+    hnsw_chunks_.emplace(base_name, std::move(rebuilt_chunk));
+    return rebuilt_chunk_index_entry;
+}
+
 bool SegmentIndexEntry::Flush(TxnTimeStamp checkpoint_ts) {
     if (table_index_entry_->index_base()->index_type_ == IndexType::kFullText) {
         // Fulltext index doesn't need to be checkpointed.
@@ -475,8 +808,17 @@ void SegmentIndexEntry::Cleanup() {
         if (buffer_obj == nullptr) {
             UnrecoverableError("vector_buffer should not has nullptr.");
         }
+        // the gc frees the cleaned up buffer
+        buffer_obj->Unpin();
         buffer_obj->SetAndTryCleanup();
     }
+    if (table_index_entry_->index_base()->index_type_ == IndexType::kFullText) {
+        HashSet<String> posting_files;
+        for (const auto &chunk_index_entry : chunk_index_entries_) {
+            posting_files.insert((Path(*table_index_entry_->index_dir()) / chunk_index_entry->base_name_).string() + POSTING_SUFFIX);
+        }
+        TermMetaCache::instance().Erase(posting_files);
+    }
 }
 
 void SegmentIndexEntry::PickCleanup(CleanupScanner *scanner) {}
@@ -487,6 +829,9 @@ SegmentIndexEntry::GetCreateIndexParam(SharedPtr<IndexBase> index_base, SizeT se
         case IndexType::kIVFFlat: {
             return MakeUnique<CreateAnnIVFFlatParam>(index_base, column_def, seg_row_count);
         }
+        case IndexType::kIVFPQ: {
+            return MakeUnique<CreateAnnIVFPQParam>(index_base, column_def, seg_row_count);
+        }
         case IndexType::kHnsw: {
             SizeT max_element = seg_row_count;
             return MakeUnique<CreateHnswParam>(index_base, column_def, max_element);
@@ -498,6 +843,9 @@ SegmentIndexEntry::GetCreateIndexParam(SharedPtr<IndexBase> index_base, SizeT se
             u32 part_capacity = DEFAULT_BLOCK_CAPACITY;
             return MakeUnique<CreateSecondaryIndexParam>(index_base, column_def, seg_row_count, part_capacity);
         }
+        case IndexType::kBitmap: {
+            return MakeUnique<CreateBitmapIndexParam>(index_base, column_def, seg_row_count);
+        }
         default: {
             UniquePtr<String> err_msg =
                 MakeUnique<String>(fmt::format("Invalid index type: {}", IndexInfo::IndexTypeToString(index_base->index_type_)));
@@ -32,6 +32,8 @@ import meta_entry_interface;
 import cleanup_scanner;
 import chunk_index_entry;
 import memory_indexer;
+import hnsw_mem_index;
+import secondary_index_in_mem;
 
 namespace infinity {
 
@@ -65,6 +67,9 @@ public:
 
     [[nodiscard]] inline u32 GetIndexPartNum() { return vector_buffer_.size() - 1; }
 
+    // the buffer GetIndex loads
+    [[nodiscard]] inline BufferObj *GetIndexBufferObj() const { return vector_buffer_[0]; }
+
     nlohmann::json Serialize();
 
     void SaveIndexFile();
@@ -87,7 +92,14 @@ public:
     inline TxnTimeStamp max_ts() const { return max_ts_; }
 
     // MemIndexInsert is non-blocking. Caller must ensure there's no RowID gap between each call.
-    void MemIndexInsert(SharedPtr<BlockEntry> block_entry, u32 row_offset, u32 row_count, TxnTimeStamp commit_ts, BufferManager* buffer_manager);
+    // column_kept: the rows are appended again by UPDATE with the indexed column unchanged, so a full-text index reuses
+    // the terms of the texts analyzed before.
+    void MemIndexInsert(SharedPtr<BlockEntry> block_entry,
+                        u32 row_offset,
+                        u32 row_count,
+                        TxnTimeStamp commit_ts,
+                        BufferManager *buffer_manager,
+                        bool column_kept = false);
 
     // User shall invoke this reguarly to populate recently inserted rows into the fulltext index. Noop for other types of index.
     void MemIndexCommit();
@@ -95,6 +107,10 @@ public:
     // Dump or spill the memory indexer
     SharedPtr<ChunkIndexEntry> MemIndexDump(bool spill = false);
 
+    // Whether the mutable hnsw chunk has taken enough rows to be dumped. Fulltext dumps when a block is sealed instead.
+    // Under critical memory pressure the chunk is dumped at fewer rows, to give its memory back sooner.
+    bool MemIndexFull(const BufferManager *buffer_mgr);
+
     // Init the mem index from previously spilled one.
     void MemIndexLoad(const String &base_name, RowID base_row_id);
 
@@ -105,6 +121,47 @@ public:
 
     Status CreateIndexDo(atomic_u64 &create_index_idx);
 
+    // The rows of the segment hnsw index, the rows appended after it are in the hnsw chunks.
+    SizeT GetHnswIndexRowCount();
+
+    // The hnsw chunks of the segment, dumped ones first and the mutable one last. Dumped chunks are mapped on first use.
+    Vector<SharedPtr<HnswMemIndex>> GetHnswChunks();
+
+    // The rows of the segment secondary or bitmap index, the rows appended after it are in the in-memory delta.
+    SizeT GetSecondaryIndexRowCount();
+
+    // Build the secondary or bitmap index of a segment created after the index as an empty one, its rows all go to the in-memory
+    // delta.
+    void CreateEmptySecondaryIndex();
+
+    // The rows appended after the secondary or bitmap index of the segment was built, nullptr if there are none.
+    const SecondaryIndexInMem *GetSecondaryIndexInMem() {
+        std::shared_lock lock(rw_locker_);
+        return secondary_index_in_mem_.get();
+    }
+
+    // Load the index of the segment into memory ahead of the queries. The mapped hnsw files are read into the page cache, and
+    // locked there if the index is pinned.
+    void Warmup();
+
+    // Rebuild the dumped hnsw chunks of the segment as one chunk, returns nullptr if there is nothing to merge.
+    SharedPtr<ChunkIndexEntry> MergeHnswChunks(const SegmentEntry *segment_entry, BufferManager *buffer_mgr);
+
+    // Whether a rebuilt chunk has taken the place of the segment hnsw index.
+    bool HnswIndexReplaced();
+
+    // The share of the indexed rows of the segment that are deleted but still in a hnsw graph.
+    f64 GetHnswTombstoneRatio(const SegmentEntry *segment_entry);
+
+    // Only one rebuild of the segment hnsw index runs at a time.
+    bool TryBeginHnswRebuild() { return !hnsw_rebuilding_.exchange(true); }
+
+    void EndHnswRebuild() { hnsw_rebuilding_.store(false); }
+
+    // Rebuild the segment hnsw index and its dumped chunks from the rows visible at `begin_ts`. The rebuilt chunk starts at the
+    // first row of the segment and replaces the chunks it covers, the segment index is not searched any more.
+    SharedPtr<ChunkIndexEntry> RebuildHnsw(const SegmentEntry *segment_entry, BufferManager *buffer_mgr, TxnTimeStamp begin_ts);
+
     static UniquePtr<CreateIndexParam> GetCreateIndexParam(SharedPtr<IndexBase> index_base, SizeT seg_row_count, SharedPtr<ColumnDef> column_def);
 
     void GetChunkIndexEntries(Vector<SharedPtr<ChunkIndexEntry>> &chunk_index_entries) {
@@ -113,8 +170,13 @@ public:
         chunk_index_entries.insert(chunk_index_entries.end(), chunk_index_entries_.begin(), chunk_index_entries_.end());
     }
 
+    // Only one merge of the full-text chunks of the segment runs at a time, either OPTIMIZE or a background merge.
+    bool TryBeginFulltextMerge() { return !fulltext_merging_.exchange(true); }
+
+    void EndFulltextMerge() { fulltext_merging_.store(false); }
+
     void ReplaceChunkIndexEntries(SharedPtr<ChunkIndexEntry> merged_chunk_index_entry) {
-        std::shared_lock lock(rw_locker_);
+        std::unique_lock lock(rw_locker_);
         SizeT num_entries = chunk_index_entries_.size();
         SizeT idx_first = num_entries;
         for (SizeT i = 0; i < num_entries; i++) {
@@ -138,16 +200,18 @@ public:
         chunk_index_entries_.erase(chunk_index_entries_.begin() + idx_first + 1, chunk_index_entries_.begin() + idx_last + 1);
     }
 
-    Tuple<Vector<String>, Vector<RowID>, MemoryIndexer *> GetFullTextIndexSnapshot() {
+    Tuple<Vector<String>, Vector<RowID>, Vector<TxnTimeStamp>, MemoryIndexer *> GetFullTextIndexSnapshot() {
         Vector<String> base_names;
         Vector<RowID> base_rowids;
+        Vector<TxnTimeStamp> commit_tss;
         std::shared_lock lock(rw_locker_);
         for (SizeT i = 0; i < chunk_index_entries_.size(); i++) {
             auto &chunk_index_entry = chunk_index_entries_[i];
             base_names.push_back(chunk_index_entry->base_name_);
             base_rowids.push_back(chunk_index_entry->base_rowid_);
+            commit_tss.push_back(chunk_index_entry->commit_ts_);
         }
-        return {base_names, base_rowids, memory_indexer_.get()};
+        return {base_names, base_rowids, commit_tss, memory_indexer_.get()};
     }
     Pair<u64, u32> GetFulltextColumnLenInfo() {
         std::shared_lock lock(rw_locker_);
@@ -186,6 +250,14 @@ private:
 
     Vector<SharedPtr<ChunkIndexEntry>> chunk_index_entries_{};
     UniquePtr<MemoryIndexer> memory_indexer_{};
+    SharedPtr<HnswMemIndex> hnsw_mem_index_{};
+    RowID hnsw_mem_base_rowid_{};
+    HashMap<String, SharedPtr<HnswMemIndex>> hnsw_chunks_{}; // dumped hnsw chunks by base name
+    SizeT hnsw_rebuild_excluded_{};                          // deleted rows left out of the rebuilt hnsw chunk
+    UniquePtr<SecondaryIndexInMem> secondary_index_in_mem_{};
+    atomic_bool hnsw_rebuilding_{false};
+    atomic_bool fulltext_merging_{false};
+    atomic_u64 hnsw_rows_built_{0}; // by the CreateIndexDo tasks, the one building the last batch counts the segment done
 
     u64 ft_column_len_sum_{}; // increase only
     u32 ft_column_len_cnt_{}; // increase only
@@ -43,7 +43,7 @@ import create_index_info;
 import column_def;
 import data_type;
 import default_values;
-import DBT_compaction_alg;
+import cost_compaction_alg;
 import compact_segments_task;
 import local_file_system;
 import build_fast_rough_filter_task;
@@ -52,6 +52,10 @@ import segment_index_entry;
 import chunk_index_entry;
 import cleanup_scanner;
 import column_index_merger;
+import column_statistics;
+import fast_rough_filter;
+import index_build_progress;
+import defer_op;
 
 namespace infinity {
 
@@ -64,12 +68,18 @@ TableEntry::TableEntry(bool is_delete,
                        TransactionID txn_id,
                        TxnTimeStamp begin_ts,
                        SegmentID unsealed_id,
-                       SegmentID next_segment_id)
+                       SegmentID next_segment_id,
+                       SizeT segment_capacity,
+                       ColumnID sort_column_id,
+                       ColumnID ttl_column_id,
+                       u64 ttl_seconds)
     : BaseEntry(EntryType::kTable, is_delete), table_meta_(table_meta), table_entry_dir_(std::move(table_entry_dir)),
-      table_name_(std::move(table_name)), columns_(columns), table_entry_type_(table_entry_type), unsealed_id_(unsealed_id),
+      table_name_(std::move(table_name)), columns_(columns), table_entry_type_(table_entry_type), segment_capacity_(segment_capacity),
+      sort_column_id_(sort_column_id), ttl_column_id_(ttl_column_id), ttl_seconds_(ttl_seconds), unsealed_id_(unsealed_id),
       next_segment_id_(next_segment_id) {
     begin_ts_ = begin_ts;
     txn_id_ = txn_id;
+    io_stats_ = IOStatsRegistry::instance().NewTableIOStats(table_meta_ != nullptr ? *GetDBName() : "", *table_name_);
 
     SizeT column_count = columns.size();
     for (SizeT idx = 0; idx < column_count; ++idx) {
@@ -78,7 +88,9 @@ TableEntry::TableEntry(bool is_delete,
 
     // this->SetCompactionAlg(nullptr);
     if (!is_delete) {
-        this->SetCompactionAlg(MakeUnique<DBTCompactionAlg>(DBT_COMPACTION_M, DBT_COMPACTION_C, DBT_COMPACTION_S, DEFAULT_SEGMENT_CAPACITY, this));
+        CostCompactionConfig compaction_config;
+        compaction_config.max_segment_capacity_ = segment_capacity_;
+        this->SetCompactionAlg(MakeUnique<CostCompactionAlg>(compaction_config, this));
         compaction_alg_->Enable({});
     }
 }
@@ -90,7 +102,11 @@ SharedPtr<TableEntry> TableEntry::NewTableEntry(bool is_delete,
                                                 TableEntryType table_entry_type,
                                                 TableMeta *table_meta,
                                                 TransactionID txn_id,
-                                                TxnTimeStamp begin_ts) {
+                                                TxnTimeStamp begin_ts,
+                                                SizeT segment_capacity,
+                                                ColumnID sort_column_id,
+                                                ColumnID ttl_column_id,
+                                                u64 ttl_seconds) {
     SharedPtr<String> table_entry_dir = is_delete ? MakeShared<String>("deleted") : TableEntry::DetermineTableDir(*db_entry_dir, *table_name);
     return MakeShared<TableEntry>(is_delete,
                                   std::move(table_entry_dir),
@@ -101,7 +117,11 @@ SharedPtr<TableEntry> TableEntry::NewTableEntry(bool is_delete,
                                   txn_id,
                                   begin_ts,
                                   INVALID_SEGMENT_ID,
-                                  0 /*next_segment_id*/);
+                                  0 /*next_segment_id*/,
+                                  segment_capacity,
+                                  sort_column_id,
+                                  ttl_column_id,
+                                  ttl_seconds);
 }
 
 SharedPtr<TableEntry> TableEntry::ReplayTableEntry(bool is_delete,
@@ -115,7 +135,11 @@ SharedPtr<TableEntry> TableEntry::ReplayTableEntry(bool is_delete,
                                                    TxnTimeStamp commit_ts,
                                                    SizeT row_count,
                                                    SegmentID unsealed_id,
-                                                   SegmentID next_segment_id) noexcept {
+                                                   SegmentID next_segment_id,
+                                                   SizeT segment_capacity,
+                                                   ColumnID sort_column_id,
+                                                   ColumnID ttl_column_id,
+                                                   u64 ttl_seconds) noexcept {
     auto table_entry = MakeShared<TableEntry>(is_delete,
                                               std::move(table_entry_dir),
                                               std::move(table_name),
@@ -125,7 +149,11 @@ SharedPtr<TableEntry> TableEntry::ReplayTableEntry(bool is_delete,
                                               txn_id,
                                               begin_ts,
                                               unsealed_id,
-                                              next_segment_id);
+                                              next_segment_id,
+                                              segment_capacity,
+                                              sort_column_id,
+                                              ttl_column_id,
+                                              ttl_seconds);
     // TODO need to check if commit_ts influence replay catalog delta entry
     table_entry->commit_ts_.store(commit_ts);
     table_entry->row_count_.store(row_count);
@@ -187,6 +215,8 @@ void TableEntry::RemoveIndexEntry(const String &index_name, TransactionID txn_id
 
 /// replay
 void TableEntry::UpdateEntryReplay(const SharedPtr<TableEntry> &table_entry) {
+    // build the segments with the unsealed id they were saved with
+    this->LoadLazyMeta();
     txn_id_.store(table_entry->txn_id_);
     begin_ts_ = table_entry->begin_ts_;
     commit_ts_.store(table_entry->commit_ts_);
@@ -275,6 +305,21 @@ void TableEntry::GetFulltextAnalyzers(TransactionID txn_id, TxnTimeStamp begin_t
     }
 }
 
+bool TableEntry::ColumnIndexed(TransactionID txn_id, TxnTimeStamp begin_ts, const String &column_name) {
+    auto index_meta_map_guard = index_meta_map_.GetMetaMap();
+    for (auto &[_, table_index_meta] : *index_meta_map_guard) {
+        auto [table_index_entry, status] = table_index_meta->GetEntryNolock(txn_id, begin_ts);
+        if (!status.ok()) {
+            continue;
+        }
+        const auto &column_names = table_index_entry->index_base()->column_names_;
+        if (std::find(column_names.begin(), column_names.end(), column_name) != column_names.end()) {
+            return true;
+        }
+    }
+    return false;
+}
+
 void TableEntry::Import(SharedPtr<SegmentEntry> segment_entry, Txn *txn) {
     {
         std::unique_lock lock(this->rw_locker_);
@@ -294,6 +339,22 @@ void TableEntry::Import(SharedPtr<SegmentEntry> segment_entry, Txn *txn) {
         if (!status.ok())
             continue;
         const IndexBase *index_base = table_index_entry->index_base();
+        if (index_base->index_type_ == IndexType::kHnsw) {
+            for (auto &[segment_id, segment_index_entry] : table_index_entry->index_by_segment()) {
+                Vector<SharedPtr<ChunkIndexEntry>> chunk_index_entries;
+                segment_index_entry->GetChunkIndexEntries(chunk_index_entries);
+                SharedPtr<SegmentEntry> segment_entry = GetSegmentByID(segment_id, MAX_TIMESTAMP);
+                SharedPtr<ChunkIndexEntry> chunk_index_entry = segment_index_entry->MergeHnswChunks(segment_entry.get(), txn->buffer_mgr());
+                if (chunk_index_entry.get() == nullptr) {
+                    continue;
+                }
+                for (auto &old_chunk_index_entry : chunk_index_entries) {
+                    txn_table_store->AddChunkIndexStore(table_index_entry, old_chunk_index_entry.get());
+                }
+                txn_table_store->AddChunkIndexStore(table_index_entry, chunk_index_entry.get());
+            }
+            continue;
+        }
         if (index_base->index_type_ != IndexType::kFullText) {
             UniquePtr<String> err_msg =
                 MakeUnique<String>(fmt::format("{} realtime index is not supported yet", IndexInfo::IndexTypeToString(index_base->index_type_)));
@@ -392,6 +453,33 @@ Status TableEntry::Delete(TransactionID txn_id, void *txn_store, TxnTimeStamp co
     return Status::OK();
 }
 
+Status TableEntry::Update(TransactionID txn_id, void *txn_store, TxnTimeStamp commit_ts, const UpdateState &update_state) {
+    TxnTableStore *txn_store_ptr = (TxnTableStore *)txn_store;
+    Txn *txn = txn_store_ptr->txn_;
+    for (const auto &update_batch : update_state.batches_) {
+        for (const auto &[segment_id, block_row_hashmap] : update_batch.rows_) {
+            SharedPtr<SegmentEntry> segment_entry = GetSegmentByID(segment_id, commit_ts);
+            if (!segment_entry) {
+                UniquePtr<String> err_msg = MakeUnique<String>(fmt::format("Going to update data in non-exist segment: {}", segment_id));
+                return Status(ErrorCode::kTableNotExist, std::move(err_msg));
+            }
+            segment_entry->UpdateData(txn_id, commit_ts, update_batch.column_ids_, update_batch.values_.get(), block_row_hashmap, txn);
+        }
+    }
+    return Status::OK();
+}
+
+void TableEntry::RollbackUpdate(TransactionID txn_id, const UpdateState &update_state) {
+    std::shared_lock lock(this->rw_locker_);
+    for (const auto &update_batch : update_state.batches_) {
+        for (const auto &[segment_id, _] : update_batch.rows_) {
+            if (auto iter = segment_map_.find(segment_id); iter != segment_map_.end()) {
+                iter->second->RollbackUpdate(txn_id);
+            }
+        }
+    }
+}
+
 void TableEntry::RollbackAppend(TransactionID txn_id, TxnTimeStamp commit_ts, void *txn_store) {
     //    auto *txn_store_ptr = (TxnTableStore *)txn_store;
     //    AppendState *append_state_ptr = txn_store_ptr->append_state_.get();
@@ -413,8 +501,11 @@ Status TableEntry::CommitCompact(TransactionID txn_id, TxnTimeStamp commit_ts, T
         {
             String ss = "Compact commit: " + *this->GetTableName();
             for (const auto &[segment_store, old_segments] : compact_store.compact_data_) {
-                auto *new_segment = segment_store.segment_entry_;
-                ss += ", new segment: " + std::to_string(new_segment->segment_id()) + ", old segment: ";
+                // the expired segments are dropped without a new segment
+                if (auto *new_segment = segment_store.segment_entry_; new_segment != nullptr) {
+                    ss += ", new segment: " + std::to_string(new_segment->segment_id());
+                }
+                ss += ", old segment: ";
                 for (const auto *old_segment : old_segments) {
                     ss += std::to_string(old_segment->segment_id_) + " ";
                 }
@@ -424,12 +515,13 @@ Status TableEntry::CommitCompact(TransactionID txn_id, TxnTimeStamp commit_ts, T
         std::unique_lock lock(this->rw_locker_);
         for (const auto &[segment_store, old_segments] : compact_store.compact_data_) {
 
-            auto *segment_entry = segment_store.segment_entry_;
-            new_segments.push_back(segment_entry);
+            if (auto *segment_entry = segment_store.segment_entry_; segment_entry != nullptr) {
+                new_segments.push_back(segment_entry);
 
-            segment_entry->CommitSegment(txn_id, commit_ts);
-            for (auto *block_entry : segment_store.block_entries_) {
-                block_entry->CommitBlock(txn_id, commit_ts);
+                segment_entry->CommitSegment(txn_id, commit_ts);
+                for (auto *block_entry : segment_store.block_entries_) {
+                    block_entry->CommitBlock(txn_id, commit_ts);
+                }
             }
 
             for (const auto &old_segment : old_segments) {
@@ -455,6 +547,10 @@ Status TableEntry::CommitCompact(TransactionID txn_id, TxnTimeStamp commit_ts, T
             compaction_alg_->Enable(new_segments);
             break;
         }
+        case CompactSegmentsTaskType::kExpireTable: {
+            // the compaction is enabled again without the dropped segments before the commit
+            break;
+        }
         default: {
             UnrecoverableError("Invalid compact task type");
         }
@@ -468,9 +564,15 @@ Status TableEntry::RollbackCompact(TransactionID txn_id, TxnTimeStamp commit_ts,
     }
     {
         for (const auto &[segment_store, old_segments] : compact_store.compact_data_) {
-            SharedPtr<SegmentEntry> segment;
-
             auto *segment_entry = segment_store.segment_entry_;
+            if (segment_entry == nullptr) {
+                std::unique_lock lock(this->rw_locker_);
+                for (auto *old_segment : old_segments) {
+                    old_segment->RollbackCompact();
+                }
+                continue;
+            }
+            SharedPtr<SegmentEntry> segment;
             segment_entry->RollbackBlocks(commit_ts, segment_store.block_entries_);
             if (segment_entry->Committed()) {
                 UnrecoverableError(fmt::format("RollbackCompact: segment {} is committed", segment_entry->segment_id()));
@@ -505,6 +607,10 @@ Status TableEntry::RollbackCompact(TransactionID txn_id, TxnTimeStamp commit_ts,
                 compaction_alg_->Enable(old_segments);
                 break;
             }
+            case CompactSegmentsTaskType::kExpireTable: {
+                // the segments kept by the rollback are picked again by the next expiry
+                break;
+            }
             default: {
                 UnrecoverableError("Invalid compact task type");
             }
@@ -561,7 +667,10 @@ void TableEntry::MemIndexInsert(Txn *txn, Vector<AppendRange> &append_ranges) {
             continue;
         const IndexBase *index_base = table_index_entry->index_base();
         switch (index_base->index_type_) {
-            case IndexType::kFullText: {
+            case IndexType::kFullText:
+            case IndexType::kHnsw:
+            case IndexType::kSecondary:
+            case IndexType::kBitmap: {
                 for (auto &[seg_id, ranges] : seg_append_ranges) {
                     MemIndexInsertInner(table_index_entry, txn, seg_id, ranges);
                 }
@@ -582,6 +691,9 @@ void TableEntry::MemIndexInsertInner(TableIndexEntry *table_index_entry, Txn *tx
     TxnTableStore *txn_table_store = txn->GetTxnTableStore(this);
     bool created = table_index_entry->GetOrCreateSegment(seg_id, txn, segment_index_entry);
     if (created) {
+        if (auto index_type = table_index_entry->index_base()->index_type_; index_type == IndexType::kSecondary || index_type == IndexType::kBitmap) {
+            segment_index_entry->CreateEmptySecondaryIndex();
+        }
         Vector<SegmentIndexEntry *> segment_index_entries{segment_index_entry.get()};
         txn_table_store->AddSegmentIndexesStore(table_index_entry, segment_index_entries);
         table_index_entry->UpdateFulltextSegmentTs(txn->CommitTS());
@@ -598,11 +710,14 @@ void TableEntry::MemIndexInsertInner(TableIndexEntry *table_index_entry, Txn *tx
         if (block_entry->GetAvailableCapacity() <= 0)
             dump_idx = i;
     }
+    // the hnsw chunk is dumped by its row count rather than by sealed blocks
+    bool dump_by_row_count = table_index_entry->index_base()->index_type_ == IndexType::kHnsw;
+    bool column_kept = txn_table_store->ColumnKeptByUpdate(table_index_entry->column_def()->id());
     for (SizeT i = 0; i < num_ranges; i++) {
         AppendRange &range = append_ranges[i];
         SharedPtr<BlockEntry> block_entry = block_entries[i];
-        segment_index_entry->MemIndexInsert(block_entry, range.start_offset_, range.row_count_, txn->CommitTS(), txn->buffer_mgr());
-        if (i == dump_idx) {
+        segment_index_entry->MemIndexInsert(block_entry, range.start_offset_, range.row_count_, txn->CommitTS(), txn->buffer_mgr(), column_kept);
+        if (dump_by_row_count ? segment_index_entry->MemIndexFull(txn->buffer_mgr()) : i == dump_idx) {
             SharedPtr<ChunkIndexEntry> chunk_index_entry = segment_index_entry->MemIndexDump();
             if (chunk_index_entry.get() != nullptr) {
                 txn_table_store->AddChunkIndexStore(table_index_entry, chunk_index_entry.get());
@@ -637,9 +752,12 @@ void TableEntry::MemIndexCommit() {
     }
 }
 
-void TableEntry::MemIndexRecover(BufferManager *buffer_manager) {
+void TableEntry::MemIndexRecover(BufferManager *buffer_manager, const String &index_name) {
     auto index_meta_map_guard = index_meta_map_.GetMetaMap();
-    for (auto &[_, table_index_meta] : *index_meta_map_guard) {
+    for (auto &[meta_index_name, table_index_meta] : *index_meta_map_guard) {
+        if (!index_name.empty() && meta_index_name != index_name) {
+            continue;
+        }
         auto [table_index_entry, status] = table_index_meta->GetEntryNolock(0UL, MAX_TIMESTAMP);
         if (!status.ok())
             continue;
@@ -652,7 +770,34 @@ void TableEntry::MemIndexRecover(BufferManager *buffer_manager) {
             // Determine block entries need to insert into MemIndexer
             Vector<AppendRange> append_ranges;
             Vector<SharedPtr<BlockEntry>> &block_entries = segment_entry->block_entries();
+            // the rows at create index time are in the hnsw, secondary or bitmap segment index, only the later ones go to the chunks
+            // or the in-memory delta
+            SizeT segment_index_row_count = 0;
             if (chunk_index_entries.empty()) {
+                switch (table_index_entry->index_base()->index_type_) {
+                    case IndexType::kHnsw: {
+                        segment_index_row_count = segment_index_entry->GetHnswIndexRowCount();
+                        break;
+                    }
+                    case IndexType::kSecondary:
+                    case IndexType::kBitmap: {
+                        segment_index_row_count = segment_index_entry->GetSecondaryIndexRowCount();
+                        break;
+                    }
+                    default: {
+                        break;
+                    }
+                }
+            }
+            if (chunk_index_entries.empty() && segment_index_row_count > 0) {
+                SizeT block_capacity = block_entries[0]->row_capacity();
+                for (SizeT i = segment_index_row_count / block_capacity; i < block_entries.size(); i++) {
+                    SizeT start_offset = i == segment_index_row_count / block_capacity ? segment_index_row_count % block_capacity : 0;
+                    if (block_entries[i]->row_count() > start_offset) {
+                        append_ranges.emplace_back(segment_id, i, start_offset, block_entries[i]->row_count() - start_offset);
+                    }
+                }
+            } else if (chunk_index_entries.empty()) {
                 for (SizeT i = 0; i < block_entries.size(); i++) {
                     append_ranges.emplace_back(segment_id, i, 0, block_entries[i]->row_count());
                 }
@@ -687,6 +832,9 @@ void TableEntry::MemIndexRecover(BufferManager *buffer_manager) {
                                                     range.row_count_,
                                                     segment_index_entry->max_ts(),
                                                     buffer_manager);
+                if (segment_index_entry->MemIndexFull(buffer_manager)) {
+                    segment_index_entry->MemIndexDump();
+                }
             }
             if (segment_id == unsealed_id_) {
                 table_index_entry->last_segment_ = segment_index_entry;
@@ -712,10 +860,32 @@ void TableEntry::OptimizeIndex(Txn *txn) {
             continue;
         }
         const IndexFullText *index_fulltext = static_cast<const IndexFullText *>(index_base);
+        // The segments to merge are counted first, so SHOW INDEX knows the totals while the first one is merged.
+        SharedPtr<IndexBuildProgress> build_progress =
+            IndexBuildRegistry::instance().Begin(*GetDBName(), *table_name_, *index_base->index_name_, IndexBuildPhase::kOptimize);
+        DeferFn end_build_progress([&]() { IndexBuildRegistry::instance().End(build_progress.get()); });
         for (auto &[segment_id, segment_index_entry] : table_index_entry->index_by_segment()) {
+            Vector<SharedPtr<ChunkIndexEntry>> chunk_index_entries;
+            segment_index_entry->GetChunkIndexEntries(chunk_index_entries);
+            if (chunk_index_entries.size() > 1) {
+                u64 row_count = 0;
+                for (const auto &chunk_index_entry : chunk_index_entries) {
+                    row_count += chunk_index_entry->row_count_;
+                }
+                build_progress->AddSegment(row_count);
+            }
+        }
+        for (auto &[segment_id, segment_index_entry] : table_index_entry->index_by_segment()) {
+            if (!segment_index_entry->TryBeginFulltextMerge()) {
+                LOG_WARN(fmt::format("Skip optimizing segment {} of index {}, its chunks are being merged in background",
+                                     segment_id,
+                                     *table_index_entry->index_dir()));
+                continue;
+            }
             Vector<SharedPtr<ChunkIndexEntry>> chunk_index_entries;
             segment_index_entry->GetChunkIndexEntries(chunk_index_entries);
             if (chunk_index_entries.size() <= 1) {
+                segment_index_entry->EndFulltextMerge();
                 continue;
             }
 
@@ -729,12 +899,13 @@ void TableEntry::OptimizeIndex(Txn *txn) {
                 base_rowids.push_back(chunk_index_entry->base_rowid_);
                 total_row_count += chunk_index_entry->row_count_;
             }
+            build_progress->BeginSegment(segment_id);
             String dst_base_name = fmt::format("ft_{}_{}", base_rowid.ToUint64(), total_row_count);
             ColumnIndexMerger column_index_merger(*table_index_entry->index_dir_,
                                                   index_fulltext->flag_,
                                                   &table_index_entry->GetFulltextByteSlicePool(),
                                                   &table_index_entry->GetFulltextBufferPool());
-            column_index_merger.Merge(base_names, base_rowids, dst_base_name);
+            column_index_merger.Merge(base_names, base_rowids, dst_base_name, &table_index_entry->GetFulltextThreadPool());
 
             for (SizeT i = 0; i < chunk_index_entries.size(); i++) {
                 auto &chunk_index_entry = chunk_index_entries[i];
@@ -747,13 +918,60 @@ void TableEntry::OptimizeIndex(Txn *txn) {
             txn_table_store->AddChunkIndexStore(table_index_entry, chunk_index_entry.get());
             segment_index_entry->ReplaceChunkIndexEntries(chunk_index_entry);
             // OPTIMIZE invoke this func at which the txn hasn't been commited yet.
-            TxnTimeStamp ts = std::max(txn->BeginTS(), txn->CommitTS());
-            assert(ts >= table_index_entry->GetFulltexSegmentUpdateTs());
+            // A background merge of another segment may have moved the update ts past it.
+            TxnTimeStamp ts = std::max({txn->BeginTS(), txn->CommitTS(), table_index_entry->GetFulltexSegmentUpdateTs()});
             table_index_entry->UpdateFulltextSegmentTs(ts);
+            segment_index_entry->EndFulltextMerge();
+            build_progress->AddRowsDone(total_row_count);
+            build_progress->FinishSegment();
         }
     }
 }
 
+void TableEntry::WarmupIndexes(Txn *txn, const String &index_name, bool pinned_only) {
+    Vector<SharedPtr<SegmentIndexEntry>> segment_index_entries;
+    bool index_found = index_name.empty();
+    {
+        auto index_meta_map_guard = index_meta_map_.GetMetaMap();
+        for (auto &[name, table_index_meta] : *index_meta_map_guard) {
+            if (!index_name.empty() && name != index_name) {
+                continue;
+            }
+            auto [table_index_entry, status] = table_index_meta->GetEntryNolock(txn->TxnID(), txn->BeginTS());
+            if (!status.ok()) {
+                continue;
+            }
+            index_found = true;
+            if (pinned_only && !table_index_entry->index_base()->pinned_) {
+                continue;
+            }
+            for (auto &[_, segment_index_entry] : table_index_entry->index_by_segment()) {
+                segment_index_entries.push_back(segment_index_entry);
+            }
+        }
+    }
+    if (!index_found) {
+        RecoverableError(Status::IndexNotExist(index_name));
+    }
+
+    SizeT thread_n = std::min(segment_index_entries.size(), WARMUP_THREAD_NUM);
+    if (thread_n <= 1) {
+        for (auto &segment_index_entry : segment_index_entries) {
+            segment_index_entry->Warmup();
+        }
+        return;
+    }
+    ThreadPool pool(thread_n);
+    Vector<Future<void>> futures;
+    futures.reserve(segment_index_entries.size());
+    for (auto &segment_index_entry : segment_index_entries) {
+        futures.push_back(pool.push([&segment_index_entry](int) { segment_index_entry->Warmup(); }));
+    }
+    for (auto &future : futures) {
+        future.get();
+    }
+}
+
 SharedPtr<SegmentEntry> TableEntry::GetSegmentByID(SegmentID segment_id, TxnTimeStamp ts) const {
     std::shared_lock lock(this->rw_locker_);
     auto iter = segment_map_.find(segment_id);
@@ -803,9 +1021,38 @@ SharedPtr<BlockIndex> TableEntry::GetBlockIndex(TxnTimeStamp begin_ts) {
     return result;
 }
 
+Optional<ColumnStatistics> TableEntry::GetColumnStatistics(ColumnID column_id, TxnTimeStamp begin_ts) {
+    Optional<ColumnStatistics> result;
+    std::shared_lock<std::shared_mutex> rw_locker(this->rw_locker_);
+    for (const auto &[segment_id, segment_entry] : this->segment_map_) {
+        if (!segment_entry->CheckVisible(begin_ts)) {
+            continue;
+        }
+        const ColumnStatistics *statistics = segment_entry->GetFastRoughFilter()->GetColumnStatistics(column_id);
+        if (statistics == nullptr) {
+            continue;
+        }
+        if (result.has_value()) {
+            result->Merge(*statistics);
+        } else {
+            result = *statistics;
+        }
+    }
+    return result;
+}
+
 nlohmann::json TableEntry::Serialize(TxnTimeStamp max_commit_ts) {
     nlohmann::json json_res;
 
+    // An entry not accessed since a lazy load is unchanged since the checkpoint it was read from, so write back that json.
+    std::unique_lock lazy_lock(lazy_meta_mtx_, std::defer_lock);
+    if (!lazy_meta_loaded_.load(std::memory_order_acquire)) {
+        lazy_lock.lock();
+        if (lazy_meta_loaded_.load(std::memory_order_relaxed)) {
+            lazy_lock.unlock();
+        }
+    }
+
     Vector<SegmentEntry *> segment_candidates;
     Vector<TableIndexMeta *> table_index_meta_candidates;
     Vector<String> table_index_name_candidates;
@@ -813,6 +1060,10 @@ nlohmann::json TableEntry::Serialize(TxnTimeStamp max_commit_ts) {
         std::shared_lock<std::shared_mutex> lck(this->rw_locker_);
         json_res["table_name"] = *this->GetTableName();
         json_res["table_entry_type"] = this->table_entry_type_;
+        json_res["segment_capacity"] = this->segment_capacity_;
+        json_res["sort_column_id"] = this->sort_column_id_;
+        json_res["ttl_column_id"] = this->ttl_column_id_;
+        json_res["ttl_seconds"] = this->ttl_seconds_;
         json_res["row_count"] = this->row_count_.load();
         json_res["begin_ts"] = this->begin_ts_;
         json_res["commit_ts"] = this->commit_ts_.load();
@@ -864,10 +1115,19 @@ nlohmann::json TableEntry::Serialize(TxnTimeStamp max_commit_ts) {
         json_res["table_indexes"].emplace_back(index_def_meta_json);
     }
 
+    if (lazy_lock.owns_lock()) {
+        for (const char *key : {"segments", "table_indexes"}) {
+            if (lazy_meta_json_->contains(key)) {
+                json_res[key] = (*lazy_meta_json_)[key];
+            }
+        }
+    }
+
     return json_res;
 }
 
-UniquePtr<TableEntry> TableEntry::Deserialize(const nlohmann::json &table_entry_json, TableMeta *table_meta, BufferManager *buffer_mgr) {
+UniquePtr<TableEntry>
+TableEntry::Deserialize(const nlohmann::json &table_entry_json, TableMeta *table_meta, BufferManager *buffer_mgr, bool lazy_load) {
     SharedPtr<String> table_name = MakeShared<String>(table_entry_json["table_name"]);
     TableEntryType table_entry_type = table_entry_json["table_entry_type"];
 
@@ -901,40 +1161,90 @@ UniquePtr<TableEntry> TableEntry::Deserialize(const nlohmann::json &table_entry_
     TxnTimeStamp begin_ts = table_entry_json["begin_ts"];
     SegmentID unsealed_id = table_entry_json["unsealed_id"];
     SegmentID next_segment_id = table_entry_json["next_segment_id"];
-
-    UniquePtr<TableEntry> table_entry = MakeUnique<
-        TableEntry>(deleted, table_entry_dir, table_name, columns, table_entry_type, table_meta, txn_id, begin_ts, unsealed_id, next_segment_id);
+    SizeT segment_capacity = table_entry_json.value("segment_capacity", DEFAULT_SEGMENT_CAPACITY);
+    ColumnID sort_column_id = table_entry_json.value("sort_column_id", INVALID_COLUMN_ID);
+    ColumnID ttl_column_id = table_entry_json.value("ttl_column_id", INVALID_COLUMN_ID);
+    u64 ttl_seconds = table_entry_json.value("ttl_seconds", u64(0));
+
+    UniquePtr<TableEntry> table_entry = MakeUnique<TableEntry>(deleted,
+                                                               table_entry_dir,
+                                                               table_name,
+                                                               columns,
+                                                               table_entry_type,
+                                                               table_meta,
+                                                               txn_id,
+                                                               begin_ts,
+                                                               unsealed_id,
+                                                               next_segment_id,
+                                                               segment_capacity,
+                                                               sort_column_id,
+                                                               ttl_column_id,
+                                                               ttl_seconds);
     table_entry->row_count_ = row_count;
+    table_entry->commit_ts_ = table_entry_json["commit_ts"];
 
-    if (table_entry_json.contains("segments")) {
-        for (const auto &segment_json : table_entry_json["segments"]) {
-            SharedPtr<SegmentEntry> segment_entry = SegmentEntry::Deserialize(segment_json, table_entry.get(), buffer_mgr);
-            table_entry->segment_map_.emplace(segment_entry->segment_id(), segment_entry);
+    if (table_entry->deleted_) {
+        if (table_entry_json.contains("segments") && !table_entry_json["segments"].empty()) {
+            UnrecoverableError("deleted table should have no segment");
         }
-        // here the unsealed_segment_ may be nullptr
-        if (table_entry->segment_map_.find(unsealed_id) != table_entry->segment_map_.end()) {
-            table_entry->unsealed_segment_ = table_entry->segment_map_.at(unsealed_id);
+    }
+
+    if (lazy_load && !table_entry->deleted_) {
+        auto lazy_meta_json = MakeUnique<nlohmann::json>();
+        if (table_entry_json.contains("segments")) {
+            (*lazy_meta_json)["segments"] = table_entry_json["segments"];
         }
+        if (table_entry_json.contains("table_indexes")) {
+            (*lazy_meta_json)["table_indexes"] = table_entry_json["table_indexes"];
+        }
+        table_entry->lazy_meta_json_ = std::move(lazy_meta_json);
+        table_entry->lazy_buffer_mgr_ = buffer_mgr;
+        table_entry->lazy_meta_loaded_ = false;
+    } else {
+        table_entry->LoadMetaFromJson(table_entry_json, buffer_mgr);
     }
 
-    table_entry->commit_ts_ = table_entry_json["commit_ts"];
+    return table_entry;
+}
 
-    if (table_entry->deleted_) {
-        if (!table_entry->segment_map_.empty()) {
-            UnrecoverableError("deleted table should have no segment");
+void TableEntry::LoadMetaFromJson(const nlohmann::json &table_entry_json, BufferManager *buffer_mgr) {
+    if (table_entry_json.contains("segments")) {
+        for (const auto &segment_json : table_entry_json["segments"]) {
+            SharedPtr<SegmentEntry> segment_entry = SegmentEntry::Deserialize(segment_json, this, buffer_mgr);
+            segment_map_.emplace(segment_entry->segment_id(), segment_entry);
+        }
+        // here the unsealed_segment_ may be nullptr
+        if (segment_map_.find(unsealed_id_) != segment_map_.end()) {
+            unsealed_segment_ = segment_map_.at(unsealed_id_);
         }
     }
 
+    // segment index entries read the row count of their segments
     if (table_entry_json.contains("table_indexes")) {
         for (const auto &index_def_meta_json : table_entry_json["table_indexes"]) {
 
-            UniquePtr<TableIndexMeta> table_index_meta = TableIndexMeta::Deserialize(index_def_meta_json, table_entry.get(), buffer_mgr);
+            UniquePtr<TableIndexMeta> table_index_meta = TableIndexMeta::Deserialize(index_def_meta_json, this, buffer_mgr);
             String index_name = index_def_meta_json["index_name"];
-            table_entry->index_meta_map().emplace(std::move(index_name), std::move(table_index_meta));
+            index_meta_map().emplace(std::move(index_name), std::move(table_index_meta));
         }
     }
+}
 
-    return table_entry;
+void TableEntry::LoadLazyMeta() {
+    if (lazy_meta_loaded_.load(std::memory_order_acquire)) {
+        return;
+    }
+    std::lock_guard lock(lazy_meta_mtx_);
+    if (lazy_meta_loaded_.load(std::memory_order_relaxed)) {
+        return;
+    }
+    LOG_TRACE(fmt::format("Load the segments and indexes of table {}", *table_name_));
+    {
+        std::unique_lock<std::shared_mutex> w_lock(rw_locker_);
+        LoadMetaFromJson(*lazy_meta_json_, lazy_buffer_mgr_);
+    }
+    lazy_meta_json_.reset();
+    lazy_meta_loaded_.store(true, std::memory_order_release);
 }
 
 u64 TableEntry::GetColumnIdByName(const String &column_name) const {
@@ -959,6 +1269,20 @@ bool TableEntry::CheckDeleteConflict(const Vector<RowID> &delete_row_ids, Transa
     return SegmentEntry::CheckDeleteConflict(std::move(check_segments), txn_id);
 }
 
+bool TableEntry::CheckUpdateConflict(const Vector<RowID> &update_row_ids, TransactionID txn_id, TxnTimeStamp begin_ts) {
+    HashMap<SegmentID, Vector<SegmentOffset>> update_row_map;
+    for (const auto row_id : update_row_ids) {
+        update_row_map[row_id.segment_id_].emplace_back(row_id.segment_offset_);
+    }
+    Vector<Pair<SegmentEntry *, Vector<SegmentOffset>>> check_segments;
+    std::shared_lock lock(this->rw_locker_);
+    for (auto &[segment_id, segment_offsets] : update_row_map) {
+        check_segments.emplace_back(this->segment_map_.at(segment_id).get(), std::move(segment_offsets));
+    }
+
+    return SegmentEntry::CheckUpdateConflict(check_segments, txn_id, begin_ts);
+}
+
 Optional<Pair<Vector<SegmentEntry *>, Txn *>> TableEntry::TryCompactAddSegment(SegmentEntry *new_segment, std::function<Txn *()> generate_txn) {
     if (compaction_alg_.get() == nullptr) {
         return None;
@@ -981,15 +1305,20 @@ Vector<SegmentEntry *> TableEntry::PickCompactSegments() const {
     std::shared_lock lock(this->rw_locker_);
     for (const auto &[segment_id, segment] : this->segment_map_) {
         auto status = segment->status();
+        // the compacting or no delete segments are dropped by an expire task which resumed the compaction before its commit
         if (status == SegmentStatus::kSealed) {
             result.emplace_back(segment.get());
-        } else if (status == SegmentStatus::kCompacting || status == SegmentStatus::kNoDelete) {
-            UnrecoverableError("Segment should not be compacting or no delete when picking manually");
         }
     }
     return result;
 }
 
+void TableEntry::ResumeCompaction(const Vector<SegmentEntry *> &segments) const {
+    if (compaction_alg_.get() != nullptr) {
+        compaction_alg_->Enable(segments);
+    }
+}
+
 void TableEntry::PickCleanup(CleanupScanner *scanner) {
     index_meta_map_.PickCleanup(scanner);
     Vector<SegmentID> cleanup_segment_ids;
@@ -1006,6 +1335,7 @@ void TableEntry::PickCleanup(CleanupScanner *scanner) {
                 scanner->AddEntry(std::move(iter->second));
                 iter = segment_map_.erase(iter);
             } else {
+                segment->TrimUndo(visible_ts);
                 ++iter;
             }
         }
@@ -1023,6 +1353,7 @@ void TableEntry::Cleanup() {
     if (this->deleted_) {
         return;
     }
+    this->LoadLazyMeta();
     for (auto &[segment_id, segment] : segment_map_) {
         segment->Cleanup();
     }
@@ -1032,8 +1363,8 @@ void TableEntry::Cleanup() {
     CleanupScanner::CleanupDir(*table_entry_dir_);
 }
 
-IndexReader TableEntry::GetFullTextIndexReader(TransactionID txn_id, TxnTimeStamp begin_ts) {
-    return fulltext_column_index_cache_.GetIndexReader(txn_id, begin_ts, this);
+IndexReader TableEntry::GetFullTextIndexReader(TransactionID txn_id, TxnTimeStamp begin_ts, MemoryPool *session_pool) {
+    return fulltext_column_index_cache_.GetIndexReader(txn_id, begin_ts, this, session_pool);
 }
 
 } // namespace infinity
@@ -43,6 +43,9 @@ import memory_pool;
 import meta_info;
 import block_entry;
 import column_index_reader;
+import column_statistics;
+import default_values;
+import io_stats;
 
 namespace infinity {
 
@@ -69,7 +72,11 @@ public:
                         TransactionID txn_id,
                         TxnTimeStamp begin_ts,
                         SegmentID unsealed_id,
-                        SegmentID next_segment_id);
+                        SegmentID next_segment_id,
+                        SizeT segment_capacity = DEFAULT_SEGMENT_CAPACITY,
+                        ColumnID sort_column_id = INVALID_COLUMN_ID,
+                        ColumnID ttl_column_id = INVALID_COLUMN_ID,
+                        u64 ttl_seconds = 0);
 
     static SharedPtr<TableEntry> NewTableEntry(bool is_delete,
                                                const SharedPtr<String> &db_entry_dir,
@@ -78,7 +85,11 @@ public:
                                                TableEntryType table_entry_type,
                                                TableMeta *table_meta,
                                                TransactionID txn_id,
-                                               TxnTimeStamp begin_ts);
+                                               TxnTimeStamp begin_ts,
+                                               SizeT segment_capacity = DEFAULT_SEGMENT_CAPACITY,
+                                               ColumnID sort_column_id = INVALID_COLUMN_ID,
+                                               ColumnID ttl_column_id = INVALID_COLUMN_ID,
+                                               u64 ttl_seconds = 0);
 
     static SharedPtr<TableEntry> ReplayTableEntry(bool is_delete,
                                                   TableMeta *table_meta,
@@ -91,7 +102,11 @@ public:
                                                   TxnTimeStamp commit_ts,
                                                   SizeT row_count,
                                                   SegmentID unsealed_id,
-                                                  SegmentID next_segment_id) noexcept;
+                                                  SegmentID next_segment_id,
+                                                  SizeT segment_capacity = DEFAULT_SEGMENT_CAPACITY,
+                                                  ColumnID sort_column_id = INVALID_COLUMN_ID,
+                                                  ColumnID ttl_column_id = INVALID_COLUMN_ID,
+                                                  u64 ttl_seconds = 0) noexcept;
 
 public:
     Tuple<TableIndexEntry *, Status>
@@ -150,6 +165,10 @@ public:
 
     Status RollbackDelete(TransactionID txn_id, DeleteState &append_state, BufferManager *buffer_mgr);
 
+    Status Update(TransactionID txn_id, void *txn_store, TxnTimeStamp commit_ts, const UpdateState &update_state);
+
+    void RollbackUpdate(TransactionID txn_id, const UpdateState &update_state);
+
     Status CommitCompact(TransactionID txn_id, TxnTimeStamp commit_ts, TxnCompactStore &compact_state);
 
     Status RollbackCompact(TransactionID txn_id, TxnTimeStamp commit_ts, const TxnCompactStore &compact_state);
@@ -175,11 +194,15 @@ public:
     // User shall invoke this reguarly to populate recently inserted rows into the fulltext index. Noop for other types of index.
     void MemIndexCommit();
 
-    // Invoked once at init stage to recovery memory index.
-    void MemIndexRecover(BufferManager *buffer_manager);
+    // Invoked once at init stage to recovery memory index. A read replica recovers only the index of index_name when it's created.
+    void MemIndexRecover(BufferManager *buffer_manager, const String &index_name = "");
 
     void OptimizeIndex(Txn *txn);
 
+    // Load the indexes of the table into memory, the segments in parallel. index_name: empty for all indexes.
+    // pinned_only: skip the indexes that aren't pinned, at startup.
+    void WarmupIndexes(Txn *txn, const String &index_name, bool pinned_only = false);
+
 public:
     // Getter
 
@@ -195,6 +218,20 @@ public:
 
     inline SizeT ColumnCount() const { return columns_.size(); }
 
+    // The row capacity of the new segments of the table
+    inline SizeT segment_capacity() const { return segment_capacity_; }
+
+    // The reads and writes of the files of the table and its indexes
+    inline const SharedPtr<TableIOStats> &io_stats() const { return io_stats_; }
+
+    // The column the rows of each imported or compacted segment are sorted by, INVALID_COLUMN_ID if none
+    inline ColumnID sort_column_id() const { return sort_column_id_; }
+
+    // The timestamp column whose rows older than ttl_seconds expire, INVALID_COLUMN_ID if the rows never expire
+    inline ColumnID ttl_column_id() const { return ttl_column_id_; }
+
+    inline u64 ttl_seconds() const { return ttl_seconds_; }
+
     const SharedPtr<String> &TableEntryDir() const { return table_entry_dir_; }
 
     String GetPathNameTail() const;
@@ -211,13 +248,27 @@ public:
 
     void GetFulltextAnalyzers(TransactionID txn_id, TxnTimeStamp begin_ts, Map<String, String> &column2analyzer);
 
+    // Whether an index visible to the txn is built on the column.
+    bool ColumnIndexed(TransactionID txn_id, TxnTimeStamp begin_ts, const String &column_name);
+
+    // The statistics of a column merged from the visible segments which have them, None if no segment has them.
+    // The rows of the segments without statistics, e.g. the unsealed segment, are not counted.
+    Optional<ColumnStatistics> GetColumnStatistics(ColumnID column_id, TxnTimeStamp begin_ts);
+
 public:
     nlohmann::json Serialize(TxnTimeStamp max_commit_ts);
 
-    static UniquePtr<TableEntry> Deserialize(const nlohmann::json &table_entry_json, TableMeta *table_meta, BufferManager *buffer_mgr);
+    // lazy_load: keep the json of the segments and indexes, and build them in LoadLazyMeta
+    static UniquePtr<TableEntry>
+    Deserialize(const nlohmann::json &table_entry_json, TableMeta *table_meta, BufferManager *buffer_mgr, bool lazy_load = false);
+
+    // Build the segments and indexes kept by a lazy catalog load. Called on every access of the entry, a no-op once loaded.
+    void LoadLazyMeta();
 
     bool CheckDeleteConflict(const Vector<RowID> &delete_row_ids, TransactionID txn_id);
 
+    bool CheckUpdateConflict(const Vector<RowID> &update_row_ids, TransactionID txn_id, TxnTimeStamp begin_ts);
+
 public:
     u64 GetColumnIdByName(const String &column_name) const;
 
@@ -225,7 +276,7 @@ public:
 
     const Vector<SharedPtr<ColumnDef>> &column_defs() const { return columns_; }
 
-    IndexReader GetFullTextIndexReader(TransactionID txn_id, TxnTimeStamp begin_ts);
+    IndexReader GetFullTextIndexReader(TransactionID txn_id, TxnTimeStamp begin_ts, MemoryPool *session_pool);
 
     void UpdateFullTextSegmentTs(TxnTimeStamp ts, std::shared_mutex &segment_update_ts_mutex, TxnTimeStamp &segment_update_ts) {
         return fulltext_column_index_cache_.UpdateKnownUpdateTs(ts, segment_update_ts_mutex, segment_update_ts);
@@ -246,6 +297,14 @@ private:
 
     const TableEntryType table_entry_type_{TableEntryType::kTableEntry};
 
+    const SizeT segment_capacity_{DEFAULT_SEGMENT_CAPACITY};
+
+    const ColumnID sort_column_id_{INVALID_COLUMN_ID};
+
+    const ColumnID ttl_column_id_{INVALID_COLUMN_ID};
+
+    const u64 ttl_seconds_{0};
+
     mutable std::shared_mutex rw_locker_{};
 
     // From data table
@@ -258,6 +317,14 @@ private:
     // for full text search cache
     TableIndexReaderCache fulltext_column_index_cache_;
 
+    SharedPtr<TableIOStats> io_stats_{};
+
+    // The "segments" and "table_indexes" json of a lazily loaded entry, null once they are built.
+    UniquePtr<nlohmann::json> lazy_meta_json_{};
+    BufferManager *lazy_buffer_mgr_{};
+    std::mutex lazy_meta_mtx_{};
+    Atomic<bool> lazy_meta_loaded_{true};
+
 public:
     // set nullptr to close auto compaction
     void SetCompactionAlg(UniquePtr<CompactionAlg> compaction_alg) { compaction_alg_ = std::move(compaction_alg); }
@@ -268,10 +335,16 @@ public:
 
     Vector<SegmentEntry *> PickCompactSegments() const;
 
+    // Enables the compaction disabled by PickCompactSegments again, with the picked segments which are still sealed
+    void ResumeCompaction(const Vector<SegmentEntry *> &segments) const;
+
 private:
     // the compaction algorithm, mutable because all its interface are protected by lock
     mutable UniquePtr<CompactionAlg> compaction_alg_{};
 
+private:
+    void LoadMetaFromJson(const nlohmann::json &table_entry_json, BufferManager *buffer_mgr);
+
 private: // TODO: remove it
     void MemIndexInsertInner(TableIndexEntry *table_index_entry, Txn *txn, SegmentID seg_id, Vector<AppendRange> &append_ranges);
 
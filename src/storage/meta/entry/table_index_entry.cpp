@@ -35,12 +35,15 @@ import logger;
 
 import index_file_worker;
 import annivfflat_index_file_worker;
+import annivfpq_index_file_worker;
 import hnsw_file_worker;
 import secondary_index_file_worker;
+import bitmap_index_file_worker;
 import embedding_info;
 import block_entry;
 import segment_entry;
 import table_entry;
+import trace_span;
 
 namespace infinity {
 
@@ -115,7 +118,12 @@ bool TableIndexEntry::GetOrCreateSegment(SegmentID segment_id, Txn *txn, SharedP
     std::unique_lock w_lock(rw_locker_);
     auto iter = index_by_segment_.find(segment_id);
     if (iter == index_by_segment_.end()) {
-        auto create_index_param = SegmentIndexEntry::GetCreateIndexParam(index_base_, DEFAULT_SEGMENT_CAPACITY, column_def_);
+        // the rows appended to a hnsw segment go to its hnsw chunks, and the ones of a secondary or bitmap segment to its in-memory
+        // delta, leave the segment index empty
+        bool empty_index = index_base_->index_type_ == IndexType::kHnsw || index_base_->index_type_ == IndexType::kSecondary ||
+                           index_base_->index_type_ == IndexType::kBitmap;
+        SizeT seg_row_count = empty_index ? 0 : table_index_meta_->GetTableEntry()->segment_capacity();
+        auto create_index_param = SegmentIndexEntry::GetCreateIndexParam(index_base_, seg_row_count, column_def_);
         segment_index_entry = SegmentIndexEntry::NewIndexEntry(this, segment_id, txn, create_index_param.get());
         index_by_segment_.emplace(segment_id, segment_index_entry);
         created = true;
@@ -143,6 +151,7 @@ void TableIndexEntry::CommitCreateIndex(TxnIndexStore *txn_index_store, TxnTimeS
     if (index_base()->index_type_ == IndexType::kFullText) {
         UpdateFulltextSegmentTs(commit_ts);
     }
+    EndBuildProgress();
 }
 
 void TableIndexEntry::RollbackCreateIndex(TxnIndexStore *txn_index_store) {
@@ -155,6 +164,7 @@ void TableIndexEntry::RollbackCreateIndex(TxnIndexStore *txn_index_store) {
             }
         }
     }
+    EndBuildProgress();
 }
 
 nlohmann::json TableIndexEntry::Serialize(TxnTimeStamp max_commit_ts) {
@@ -221,6 +231,7 @@ SharedPtr<TableIndexEntry> TableIndexEntry::Deserialize(const nlohmann::json &in
 
 void TableIndexEntry::MemIndexCommit() {
     if (last_segment_.get() != nullptr) {
+        TraceSpan commit_span("mem_index", "commit");
         last_segment_->MemIndexCommit();
     }
 }
@@ -249,12 +260,26 @@ Tuple<Vector<SegmentIndexEntry *>, Status>
 TableIndexEntry::CreateIndexPrepare(TableEntry *table_entry, BlockIndex *block_index, Txn *txn, bool prepare, bool is_replay, bool check_ts) {
     Vector<SegmentIndexEntry *> segment_index_entries;
     SegmentID unsealed_id = table_entry->unsealed_id();
+    IndexBuildProgress *build_progress = is_replay ? nullptr : build_progress_.get();
+    if (build_progress != nullptr) {
+        for (const auto *segment_entry : block_index->segments_) {
+            build_progress->AddSegment(segment_entry->row_count());
+        }
+    }
     for (const auto *segment_entry : block_index->segments_) {
         auto create_index_param = SegmentIndexEntry::GetCreateIndexParam(index_base_, segment_entry->row_count(), column_def_);
         SegmentID segment_id = segment_entry->segment_id();
         SharedPtr<SegmentIndexEntry> segment_index_entry = SegmentIndexEntry::NewIndexEntry(this, segment_id, txn, create_index_param.get());
         if (!is_replay) {
+            if (build_progress != nullptr) {
+                build_progress->BeginSegment(segment_id);
+            }
             segment_index_entry->CreateIndexPrepare(segment_entry, txn, prepare, check_ts);
+            // With prepare the hnsw graph is built by CreateIndexDo, which counts the rows of each batch.
+            if (build_progress != nullptr && !prepare) {
+                build_progress->AddRowsDone(segment_entry->row_count());
+                build_progress->FinishSegment();
+            }
         }
         index_by_segment_.emplace(segment_id, segment_index_entry);
         segment_index_entries.push_back(segment_index_entry.get());
@@ -272,6 +297,9 @@ Status TableIndexEntry::CreateIndexDo(const TableEntry *table_entry, HashMap<Seg
     }
     for (auto &[segment_id, segment_index_entry] : index_by_segment_) {
         atomic_u64 &create_index_idx = create_index_idxes.at(segment_id);
+        if (build_progress_.get() != nullptr) {
+            build_progress_->BeginSegment(segment_id);
+        }
         auto status = segment_index_entry->CreateIndexDo(create_index_idx);
         if (!status.ok()) {
             return status;
@@ -280,6 +308,17 @@ Status TableIndexEntry::CreateIndexDo(const TableEntry *table_entry, HashMap<Seg
     return Status::OK();
 }
 
+void TableIndexEntry::BeginBuildProgress(const String &db_name, const String &table_name) {
+    build_progress_ = IndexBuildRegistry::instance().Begin(db_name, table_name, *index_base_->index_name_, IndexBuildPhase::kCreate);
+}
+
+void TableIndexEntry::EndBuildProgress() {
+    if (build_progress_.get() != nullptr) {
+        IndexBuildRegistry::instance().End(build_progress_.get());
+        build_progress_.reset();
+    }
+}
+
 Vector<UniquePtr<IndexFileWorker>> TableIndexEntry::CreateFileWorker(CreateIndexParam *param, u32 segment_id) {
     Vector<UniquePtr<IndexFileWorker>> vector_file_worker;
     // reference file_worker will be invalidated when vector_file_worker is resized
@@ -312,6 +351,12 @@ Vector<UniquePtr<IndexFileWorker>> TableIndexEntry::CreateFileWorker(CreateIndex
             }
             break;
         }
+        case IndexType::kIVFPQ: {
+            auto create_annivfpq_param = static_cast<CreateAnnIVFPQParam *>(param);
+            file_worker =
+                MakeUnique<AnnIVFPQIndexFileWorker>(this->index_dir(), file_name, index_base, column_def, create_annivfpq_param->row_count_);
+            break;
+        }
         case IndexType::kHnsw: {
             auto create_hnsw_param = static_cast<CreateHnswParam *>(param);
             file_worker = MakeUnique<HnswFileWorker>(this->index_dir(), file_name, index_base, column_def, create_hnsw_param->max_element_);
@@ -340,6 +385,11 @@ Vector<UniquePtr<IndexFileWorker>> TableIndexEntry::CreateFileWorker(CreateIndex
             }
             break;
         }
+        case IndexType::kBitmap: {
+            auto create_bitmap_param = static_cast<CreateBitmapIndexParam *>(param);
+            file_worker = MakeUnique<BitmapIndexFileWorker>(this->index_dir(), file_name, index_base, column_def, create_bitmap_param->row_count_);
+            break;
+        }
         default: {
             UniquePtr<String> err_msg =
                 MakeUnique<String>(fmt::format("File worker isn't implemented: {}", IndexInfo::IndexTypeToString(index_base->index_type_)));
@@ -353,6 +403,12 @@ Vector<UniquePtr<IndexFileWorker>> TableIndexEntry::CreateFileWorker(CreateIndex
         LOG_ERROR(*err_msg);
         UnrecoverableError(*err_msg);
     }
+    const TableEntry *table_entry = table_index_meta_ != nullptr ? table_index_meta_->GetTableEntry() : nullptr;
+    if (table_entry != nullptr) {
+        for (auto &index_file_worker : vector_file_worker) {
+            index_file_worker->SetTableIOStats(table_entry->io_stats());
+        }
+    }
     return vector_file_worker;
 }
 
@@ -362,6 +418,9 @@ TableIndexEntry::GetCreateIndexParam(SharedPtr<IndexBase> index_base, SizeT seg_
         case IndexType::kIVFFlat: {
             return MakeUnique<CreateAnnIVFFlatParam>(index_base, column_def, seg_row_count);
         }
+        case IndexType::kIVFPQ: {
+            return MakeUnique<CreateAnnIVFPQParam>(index_base, column_def, seg_row_count);
+        }
         case IndexType::kHnsw: {
             SizeT max_element = seg_row_count;
             return MakeUnique<CreateHnswParam>(index_base, column_def, max_element);
@@ -373,6 +432,9 @@ TableIndexEntry::GetCreateIndexParam(SharedPtr<IndexBase> index_base, SizeT seg_
             u32 part_capacity = DEFAULT_BLOCK_CAPACITY;
             return MakeUnique<CreateSecondaryIndexParam>(index_base, column_def, seg_row_count, part_capacity);
         }
+        case IndexType::kBitmap: {
+            return MakeUnique<CreateBitmapIndexParam>(index_base, column_def, seg_row_count);
+        }
         default: {
             UniquePtr<String> err_msg =
                 MakeUnique<String>(fmt::format("Invalid index type: {}", IndexInfo::IndexTypeToString(index_base->index_type_)));
@@ -34,6 +34,8 @@ import index_file_worker;
 import column_def;
 import memory_pool;
 import block_entry;
+import term_stats;
+import index_build_progress;
 
 namespace infinity {
 
@@ -112,6 +114,13 @@ public:
 
     Status CreateIndexDo(const TableEntry *table_entry, HashMap<SegmentID, atomic_u64> &create_index_idxes);
 
+    // The progress of CREATE INDEX for SHOW INDEX, counted from the prepare to the commit or the rollback of the index.
+    void BeginBuildProgress(const String &db_name, const String &table_name);
+
+    IndexBuildProgress *build_progress() const { return build_progress_.get(); }
+
+    void EndBuildProgress();
+
     Vector<UniquePtr<IndexFileWorker>> CreateFileWorker(CreateIndexParam *param, u32 segment_id);
 
     static String IndexFileName(u32 segment_id) { return fmt::format("seg{}.idx", segment_id); }
@@ -121,6 +130,7 @@ public:
     MemoryPool &GetFulltextByteSlicePool() { return byte_slice_pool_; }
     RecyclePool &GetFulltextBufferPool() { return buffer_pool_; }
     ThreadPool &GetFulltextThreadPool() { return thread_pool_; }
+    FullTextTermStats &GetFulltextTermStats() { return term_stats_; }
     TxnTimeStamp GetFulltexSegmentUpdateTs() {
         std::shared_lock lock(segment_update_ts_mutex_);
         return segment_update_ts_;
@@ -145,6 +155,7 @@ private:
     MemoryPool byte_slice_pool_{};
     RecyclePool buffer_pool_{};
     ThreadPool thread_pool_{};
+    FullTextTermStats term_stats_{};
     std::shared_mutex segment_update_ts_mutex_{};
     TxnTimeStamp segment_update_ts_{0};
 
@@ -157,6 +168,9 @@ private:
     Map<SegmentID, SharedPtr<SegmentIndexEntry>> index_by_segment_{};
     SharedPtr<SegmentIndexEntry> last_segment_{};
 
+    // Only set while the index is built by the txn creating it, no other txn sees the entry until then
+    SharedPtr<IndexBuildProgress> build_progress_{};
+
 public:
     void Cleanup() override;
 
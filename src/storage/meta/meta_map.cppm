@@ -64,7 +64,8 @@ public:
 
     MapGuard GetMetaMap() { return {meta_map_, std::shared_lock(rw_locker_)}; }
 
-    void PickCleanup(CleanupScanner *scanner);
+    // Only the metas the filter picks by name are walked, all of them without a filter.
+    void PickCleanup(CleanupScanner *scanner, std::function<bool(const String &)> picks = nullptr);
 
     void Cleanup();
 
@@ -127,12 +128,14 @@ Tuple<Meta *, Status, std::shared_lock<std::shared_mutex>> MetaMap<Meta>::GetExi
 }
 
 template <MetaConcept Meta>
-void MetaMap<Meta>::PickCleanup(CleanupScanner *scanner) {
+void MetaMap<Meta>::PickCleanup(CleanupScanner *scanner, std::function<bool(const String &)> picks) {
     Vector<Meta *> metas;
     {
         std::unique_lock w_lock(rw_locker_);
         for (auto &[name, meta] : meta_map_) {
-            metas.push_back(meta.get());
+            if (picks == nullptr || picks(name)) {
+                metas.push_back(meta.get());
+            }
         }
     }
     bool may_empty = false;
@@ -14,6 +14,8 @@
 
 module;
 
+#include <algorithm>
+#include <limits>
 #include <vector>
 
 module table_index_meta;
@@ -33,6 +35,10 @@ import extra_ddl_info;
 import local_file_system;
 import txn;
 import create_index_info;
+import segment_index_entry;
+import buffer_handle;
+import secondary_index_data;
+import secondary_index_pgm;
 
 namespace infinity {
 
@@ -147,6 +153,22 @@ TableIndexMeta::GetTableIndexInfo(std::shared_lock<std::shared_mutex> &&r_lock,
     table_index_info->index_column_names_ = MakeShared<String>(column_names);
     table_index_info->index_column_ids_ = MakeShared<String>(column_ids);
 
+    if (index_base->index_type_ == IndexType::kSecondary) {
+        table_index_info->pgm_min_epsilon_ = std::numeric_limits<u32>::max();
+        for (const auto &[segment_id, segment_index_entry] : table_index_entry->index_by_segment()) {
+            BufferHandle index_handle = segment_index_entry->GetIndex();
+            const auto *index_head = static_cast<const SecondaryIndexDataHead *>(index_handle.GetData());
+            const SecondaryPGMIndex &pgm_index = index_head->GetPGMIndex();
+            table_index_info->pgm_min_epsilon_ = std::min(table_index_info->pgm_min_epsilon_, pgm_index.Epsilon());
+            table_index_info->pgm_max_epsilon_ = std::max(table_index_info->pgm_max_epsilon_, pgm_index.Epsilon());
+            table_index_info->pgm_height_ = std::max(table_index_info->pgm_height_, pgm_index.Height());
+            table_index_info->pgm_size_ += pgm_index.SizeInBytes();
+        }
+        if (table_index_info->pgm_max_epsilon_ == 0) {
+            table_index_info->pgm_min_epsilon_ = 0;
+        }
+    }
+
     return {table_index_info, status};
 }
 
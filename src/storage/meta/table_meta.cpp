@@ -34,6 +34,7 @@ import status;
 import infinity_exception;
 import column_def;
 import block_index;
+import io_stats;
 
 namespace infinity {
 
@@ -61,9 +62,24 @@ Tuple<TableEntry *, Status> TableMeta::CreateEntry(std::shared_lock<std::shared_
                                                    TransactionID txn_id,
                                                    TxnTimeStamp begin_ts,
                                                    TxnManager *txn_mgr,
-                                                   ConflictType conflict_type) {
+                                                   ConflictType conflict_type,
+                                                   SizeT segment_capacity,
+                                                   ColumnID sort_column_id,
+                                                   ColumnID ttl_column_id,
+                                                   u64 ttl_seconds) {
     auto init_table_entry = [&](TransactionID txn_id, TxnTimeStamp begin_ts) {
-        return TableEntry::NewTableEntry(false, this->db_entry_dir_, table_name, columns, table_entry_type, this, txn_id, begin_ts);
+        return TableEntry::NewTableEntry(false,
+                                         this->db_entry_dir_,
+                                         table_name,
+                                         columns,
+                                         table_entry_type,
+                                         this,
+                                         txn_id,
+                                         begin_ts,
+                                         segment_capacity,
+                                         sort_column_id,
+                                         ttl_column_id,
+                                         ttl_seconds);
     };
     return table_entry_list_.AddEntry(std::move(r_lock), std::move(init_table_entry), txn_id, begin_ts, txn_mgr, conflict_type);
 }
@@ -94,12 +110,15 @@ TableMeta::GetTableInfo(std::shared_lock<std::shared_mutex> &&r_lock, Transactio
     if (!status.ok()) {
         return {nullptr, status};
     }
+    table_entry->LoadLazyMeta();
 
     SharedPtr<TableInfo> table_info = MakeShared<TableInfo>();
     table_info->table_name_ = table_name_;
     table_info->table_entry_dir_ = table_entry->TableEntryDir();
     table_info->column_count_ = table_entry->ColumnCount();
     table_info->row_count_ = table_entry->row_count();
+    table_info->io_read_ = table_entry->io_stats()->Snapshot(IODirection::kRead);
+    table_info->io_write_ = table_entry->io_stats()->Snapshot(IODirection::kWrite);
 
     SharedPtr<BlockIndex> segment_index = table_entry->GetBlockIndex(begin_ts);
     table_info->segment_count_ = segment_index->SegmentCount();
@@ -141,6 +160,7 @@ TableEntry *TableMeta::GetEntryReplay(TransactionID txn_id, TxnTimeStamp begin_t
     if (!status.ok()) {
         UnrecoverableError(status.message());
     }
+    entry->LoadLazyMeta();
     return entry;
 }
 
@@ -187,14 +207,14 @@ nlohmann::json TableMeta::Serialize(TxnTimeStamp max_commit_ts) {
  * @param buffer_mgr
  * @return UniquePtr<TableMeta>
  */
-UniquePtr<TableMeta> TableMeta::Deserialize(const nlohmann::json &table_meta_json, DBEntry *db_entry, BufferManager *buffer_mgr) {
+UniquePtr<TableMeta> TableMeta::Deserialize(const nlohmann::json &table_meta_json, DBEntry *db_entry, BufferManager *buffer_mgr, bool lazy_load) {
     SharedPtr<String> db_entry_dir = MakeShared<String>(table_meta_json["db_entry_dir"]);
     SharedPtr<String> table_name = MakeShared<String>(table_meta_json["table_name"]);
     LOG_TRACE(fmt::format("load table {}", *table_name));
     UniquePtr<TableMeta> res = MakeUnique<TableMeta>(db_entry_dir, table_name, db_entry);
     if (table_meta_json.contains("table_entries")) {
         for (const auto &table_entry_json : table_meta_json["table_entries"]) {
-            UniquePtr<TableEntry> table_entry = TableEntry::Deserialize(table_entry_json, res.get(), buffer_mgr);
+            UniquePtr<TableEntry> table_entry = TableEntry::Deserialize(table_entry_json, res.get(), buffer_mgr, lazy_load);
             res->table_entry_list().emplace_back(std::move(table_entry));
         }
     }
@@ -53,7 +53,7 @@ public:
 
     nlohmann::json Serialize(TxnTimeStamp max_commit_ts);
 
-    static UniquePtr<TableMeta> Deserialize(const nlohmann::json &table_meta_json, DBEntry *db_entry, BufferManager *buffer_mgr);
+    static UniquePtr<TableMeta> Deserialize(const nlohmann::json &table_meta_json, DBEntry *db_entry, BufferManager *buffer_mgr, bool lazy_load = false);
 
     [[nodiscard]] const SharedPtr<String> &table_name_ptr() const { return table_name_; }
     [[nodiscard]] const String &table_name() const { return *table_name_; }
@@ -69,7 +69,11 @@ private:
                                             TransactionID txn_id,
                                             TxnTimeStamp begin_ts,
                                             TxnManager *txn_mgr,
-                                            ConflictType conflict_type);
+                                            ConflictType conflict_type,
+                                            SizeT segment_capacity,
+                                            ColumnID sort_column_id,
+                                            ColumnID ttl_column_id,
+                                            u64 ttl_seconds);
 
     Tuple<SharedPtr<TableEntry>, Status> DropEntry(std::shared_lock<std::shared_mutex> &&r_lock,
                                                    TransactionID txn_id,
@@ -81,11 +85,19 @@ private:
     Tuple<SharedPtr<TableInfo>, Status> GetTableInfo(std::shared_lock<std::shared_mutex> &&r_lock, TransactionID txn_id, TxnTimeStamp begin_ts);
 
     Tuple<TableEntry *, Status> GetEntry(std::shared_lock<std::shared_mutex> &&r_lock, TransactionID txn_id, TxnTimeStamp begin_ts) {
-        return table_entry_list_.GetEntry(std::move(r_lock), txn_id, begin_ts);
+        auto [table_entry, status] = table_entry_list_.GetEntry(std::move(r_lock), txn_id, begin_ts);
+        if (table_entry != nullptr) {
+            table_entry->LoadLazyMeta();
+        }
+        return {table_entry, status};
     }
 
     Tuple<TableEntry *, Status> GetEntryNolock(TransactionID txn_id, TxnTimeStamp begin_ts) {
-        return table_entry_list_.GetEntryNolock(txn_id, begin_ts);
+        auto [table_entry, status] = table_entry_list_.GetEntryNolock(txn_id, begin_ts);
+        if (table_entry != nullptr) {
+            table_entry->LoadLazyMeta();
+        }
+        return {table_entry, status};
     }
 
     void DeleteEntry(TransactionID txn_id);
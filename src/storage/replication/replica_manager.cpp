@@ -0,0 +1,367 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <thread>
+
+module replica_manager;
+
+import stl;
+import status;
+import third_party;
+import http_client;
+import wal_entry;
+import storage;
+import config;
+import catalog;
+import table_entry;
+import segment_entry;
+import index_base;
+import buffer_manager;
+import txn_manager;
+import wal_manager;
+import log_file;
+import logger;
+import default_values;
+import infinity_exception;
+
+namespace infinity {
+
+String ReplicaStateToString(ReplicaState state) {
+    switch (state) {
+        case ReplicaState::kBootstrapping:
+            return "bootstrapping";
+        case ReplicaState::kStreaming:
+            return "streaming";
+        case ReplicaState::kDisconnected:
+            return "disconnected";
+        case ReplicaState::kResyncRequired:
+            return "resync_required";
+    }
+    return "unknown";
+}
+
+ReplicaManager::ReplicaManager(Storage *storage, const String &leader_address, u64 poll_interval_ms)
+    : storage_(storage), client_(leader_address), poll_interval_ms_(poll_interval_ms) {}
+
+ReplicaManager::~ReplicaManager() {
+    if (running_.load()) {
+        Stop();
+    }
+}
+
+void ReplicaManager::Bootstrap() {
+    const Config *config = storage_->config();
+    const String &wal_dir = *config->wal_dir();
+    const String catalog_dir = *config->data_dir() + "/" + String(CATALOG_FILE_DIR);
+    while (true) {
+        i64 begin_ms = NowMs();
+        // The local wal and catalog are replaced, the data files are overwritten by the copies.
+        std::filesystem::remove_all(wal_dir);
+        std::filesystem::remove_all(catalog_dir);
+        std::filesystem::create_directories(wal_dir);
+
+        nlohmann::json manifest;
+        Status status = FetchManifest("", manifest);
+        if (status.ok()) {
+            status = FetchFiles(manifest);
+        }
+        String entries;
+        if (status.ok()) {
+            checkpoint_ts_ = manifest["checkpoint_ts"];
+            TxnTimeStamp leader_ts = 0;
+            bool resync = false;
+            status = FetchWal(checkpoint_ts_, 1, leader_ts, entries, resync);
+            if (status.ok() && resync) {
+                status = Status::UnexpectedError(fmt::format("The checkpoint at {} is recycled", checkpoint_ts_));
+            }
+        }
+        if (status.ok()) {
+            // The entry is parsed from a copy, the parse changes the buffer.
+            i32 entry_size = entries.size() >= sizeof(WalEntryHeader) ? reinterpret_cast<const WalEntryHeader *>(entries.data())->size_ : 0;
+            String entry_data = entries.substr(0, entry_size);
+            char *ptr = entry_data.data();
+            SharedPtr<WalEntry> entry = entry_size > 0 && (SizeT)entry_size <= entries.size() ? WalEntry::ReadAdv(ptr, entry_size) : nullptr;
+            WalCmdCheckpoint *checkpoint_cmd = nullptr;
+            if (entry.get() == nullptr || entry->commit_ts_ != checkpoint_ts_ || !entry->IsCheckPoint({}, checkpoint_cmd)) {
+                status = Status::UnexpectedError(fmt::format("The entry at {} isn't the checkpoint", checkpoint_ts_));
+            } else if (!CatalogFile::ParseValidCheckpointFilenames(catalog_dir, checkpoint_cmd->max_commit_ts_).has_value()) {
+                // A later checkpoint recycled the catalog files after the manifest was made.
+                status = Status::UnexpectedError(fmt::format("The catalog files of the checkpoint at {} are missing", checkpoint_ts_));
+            } else {
+                std::ofstream wal_file(wal_dir + "/" + WalFile::TempWalFilename(), std::ios::binary | std::ios::trunc);
+                wal_file.write(entries.data(), entry_size);
+                wal_file.close();
+                if (!wal_file) {
+                    status = Status::IOError(fmt::format("Can't write the wal file in {}", wal_dir));
+                }
+            }
+        }
+        if (status.ok()) {
+            applied_ts_.store(checkpoint_ts_);
+            synced_ms_.store(begin_ms);
+            LOG_INFO(fmt::format("Replica bootstrapped from the checkpoint of the leader at {}", checkpoint_ts_));
+            return;
+        }
+        LOG_WARN(fmt::format("Replica bootstrap failed, retry: {}", status.message()));
+        std::this_thread::sleep_for(std::chrono::milliseconds(poll_interval_ms_ * 10));
+    }
+}
+
+void ReplicaManager::Start() {
+    state_.store(ReplicaState::kStreaming);
+    running_.store(true);
+    thread_ = Thread([this] { Run(); });
+}
+
+void ReplicaManager::Stop() {
+    running_.store(false);
+    thread_.join();
+    LOG_INFO(fmt::format("Replica stopped at {}", applied_ts_.load()));
+}
+
+u64 ReplicaManager::StalenessMs() const { return std::max<i64>(0, NowMs() - synced_ms_.load()); }
+
+nlohmann::json ReplicaManager::ToJson() const {
+    nlohmann::json json;
+    json["state"] = ReplicaStateToString(state_.load());
+    json["applied_ts"] = applied_ts_.load();
+    json["leader_ts"] = leader_ts_.load();
+    json["staleness_ms"] = StalenessMs();
+    return json;
+}
+
+void ReplicaManager::Run() {
+    while (running_.load()) {
+        if (state_.load() == ReplicaState::kResyncRequired) {
+            break;
+        }
+        if (!Poll()) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(poll_interval_ms_));
+        }
+    }
+}
+
+bool ReplicaManager::Poll() {
+    i64 poll_ms = NowMs();
+    TxnTimeStamp leader_ts = 0;
+    String entries;
+    bool resync = false;
+    Status status = FetchWal(applied_ts_.load() + 1, REPLICATION_WAL_BATCH_BYTES, leader_ts, entries, resync);
+    if (!status.ok()) {
+        if (state_.load() != ReplicaState::kDisconnected) {
+            LOG_WARN(fmt::format("Replica disconnected from the leader: {}", status.message()));
+        }
+        state_.store(ReplicaState::kDisconnected);
+        return false;
+    }
+    if (resync) {
+        LOG_ERROR(fmt::format("The leader recycled the wal after {}, restart the replica to copy the files again", applied_ts_.load()));
+        state_.store(ReplicaState::kResyncRequired);
+        return false;
+    }
+    state_.store(ReplicaState::kStreaming);
+    leader_ts_.store(leader_ts);
+
+    char *ptr = entries.data();
+    char *const end = ptr + entries.size();
+    while (ptr + sizeof(WalEntryHeader) <= end) {
+        i32 entry_size = reinterpret_cast<const WalEntryHeader *>(ptr)->size_;
+        if (entry_size <= 0 || ptr + entry_size > end) {
+            LOG_WARN("Replica got a truncated wal entry from the leader");
+            return false;
+        }
+        char *entry_ptr = ptr;
+        SharedPtr<WalEntry> entry = WalEntry::ReadAdv(entry_ptr, entry_size);
+        if (entry.get() == nullptr) {
+            LOG_WARN("Replica got a corrupted wal entry from the leader");
+            return false;
+        }
+        ptr += entry_size;
+        if (entry->commit_ts_ <= applied_ts_.load()) {
+            continue;
+        }
+        try {
+            Apply(*entry);
+        } catch (const std::exception &e) {
+            // The entry may be applied in part, the replica can't go on.
+            LOG_ERROR(fmt::format("Replica failed to apply the wal entry at {}: {}", entry->commit_ts_, e.what()));
+            state_.store(ReplicaState::kResyncRequired);
+            return false;
+        }
+    }
+    if (applied_ts_.load() >= leader_ts) {
+        synced_ms_.store(poll_ms);
+        return false;
+    }
+    return !entries.empty();
+}
+
+void ReplicaManager::Apply(WalEntry &entry) {
+    Vector<String> segment_dirs;
+    SegmentDirs(entry, segment_dirs);
+    for (const auto &segment_dir : segment_dirs) {
+        nlohmann::json manifest;
+        Status status = FetchManifest(segment_dir, manifest);
+        if (status.ok()) {
+            status = FetchFiles(manifest);
+        }
+        if (!status.ok()) {
+            RecoverableError(status);
+        }
+    }
+
+    TxnManager *txn_mgr = storage_->txn_manager();
+    Catalog *catalog = storage_->catalog();
+    // The entry is committed with a txn id and a commit ts of the replica, the leader's may be used by the replica already.
+    TransactionID txn_id = ++catalog->next_txn_id_;
+    txn_mgr->BeginWriteCommit();
+    TxnTimeStamp commit_ts = txn_mgr->GetTimestamp();
+    for (const auto &cmd : entry.cmds_) {
+        storage_->wal_manager()->ReplayWalCmd(cmd.get(), txn_id, commit_ts);
+        if (cmd->GetType() == WalCommandType::CREATE_INDEX) {
+            // The replay only creates the index, the rows already in the table go to its memory index.
+            auto *create_index_cmd = static_cast<WalCmdCreateIndex *>(cmd.get());
+            auto [table_entry, status] = catalog->GetTableByName(create_index_cmd->db_name_, create_index_cmd->table_name_, txn_id, commit_ts);
+            if (status.ok()) {
+                table_entry->MemIndexRecover(storage_->buffer_manager(), create_index_cmd->index_base_->index_name_);
+            }
+        }
+    }
+    txn_mgr->EndWriteCommit();
+    applied_ts_.store(entry.commit_ts_);
+    LOG_TRACE(fmt::format("Replica applied the wal entry at {} as {}", entry.commit_ts_, commit_ts));
+}
+
+void ReplicaManager::SegmentDirs(WalEntry &entry, Vector<String> &dirs) {
+    const String &data_dir = *storage_->config()->data_dir();
+    auto add_segment_dir = [&](const String &db_name, const String &table_name, SegmentID segment_id) {
+        auto [table_entry, status] = storage_->catalog()->GetTableByName(db_name, table_name, 0, MAX_TIMESTAMP);
+        if (!status.ok()) {
+            RecoverableError(status);
+        }
+        SharedPtr<String> segment_dir = SegmentEntry::DetermineSegmentDir(*table_entry->TableEntryDir(), segment_id);
+        dirs.push_back(std::filesystem::relative(*segment_dir, data_dir).string());
+    };
+    for (const auto &cmd : entry.cmds_) {
+        if (cmd->GetType() == WalCommandType::IMPORT) {
+            auto *import_cmd = static_cast<WalCmdImport *>(cmd.get());
+            add_segment_dir(import_cmd->db_name_, import_cmd->table_name_, import_cmd->segment_info_.segment_id_);
+        } else if (cmd->GetType() == WalCommandType::COMPACT) {
+            auto *compact_cmd = static_cast<WalCmdCompact *>(cmd.get());
+            for (const auto &segment_info : compact_cmd->new_segment_infos_) {
+                add_segment_dir(compact_cmd->db_name_, compact_cmd->table_name_, segment_info.segment_id_);
+            }
+        }
+    }
+}
+
+Status ReplicaManager::FetchManifest(const String &dir, nlohmann::json &manifest) {
+    nlohmann::json request;
+    if (!dir.empty()) {
+        request["dir"] = dir;
+    }
+    u32 status_code = 0;
+    String response;
+    Status status = client_.Get("/replication/manifest", request.dump(), status_code, response);
+    if (!status.ok()) {
+        return status;
+    }
+    if (status_code != 200) {
+        return Status::UnexpectedError(fmt::format("Manifest request failed with {}: {}", status_code, response));
+    }
+    manifest = nlohmann::json::parse(response, nullptr, false);
+    if (manifest.is_discarded() || !manifest.contains("files")) {
+        return Status::UnexpectedError("Invalid manifest from the leader");
+    }
+    return Status::OK();
+}
+
+Status ReplicaManager::FetchFiles(const nlohmann::json &manifest) {
+    for (const auto &file_json : manifest["files"]) {
+        Status status = FetchFile(file_json["path"], file_json["size"]);
+        if (!status.ok()) {
+            return status;
+        }
+    }
+    return Status::OK();
+}
+
+Status ReplicaManager::FetchFile(const String &path, SizeT size) {
+    String full_path = *storage_->config()->data_dir() + "/" + path;
+    String temp_path = full_path + ".tmp";
+    std::filesystem::create_directories(Path(full_path).parent_path());
+    std::ofstream file(temp_path, std::ios::binary | std::ios::trunc);
+    SizeT offset = 0;
+    while (offset < size) {
+        nlohmann::json request;
+        request["path"] = path;
+        request["offset"] = offset;
+        request["length"] = std::min(size - offset, REPLICATION_FILE_CHUNK_BYTES);
+        u32 status_code = 0;
+        String data;
+        Status status = client_.Get("/replication/file", request.dump(), status_code, data);
+        if (!status.ok()) {
+            return status;
+        }
+        if (status_code != 200 || data.empty()) {
+            return Status::UnexpectedError(fmt::format("Can't copy {} at {}, {}: {}", path, offset, status_code, data));
+        }
+        file.write(data.data(), data.size());
+        offset += data.size();
+    }
+    file.close();
+    if (!file) {
+        return Status::IOError(fmt::format("Can't write {}", temp_path));
+    }
+    std::error_code error;
+    std::filesystem::rename(temp_path, full_path, error);
+    if (error) {
+        return Status::IOError(fmt::format("Can't rename {}: {}", temp_path, error.message()));
+    }
+    return Status::OK();
+}
+
+Status ReplicaManager::FetchWal(TxnTimeStamp from_ts, SizeT max_bytes, TxnTimeStamp &leader_ts, String &entries, bool &resync) {
+    nlohmann::json request;
+    request["from_ts"] = from_ts;
+    request["max_bytes"] = max_bytes;
+    u32 status_code = 0;
+    String response;
+    Status status = client_.Get("/replication/wal", request.dump(), status_code, response);
+    if (!status.ok()) {
+        return status;
+    }
+    resync = status_code == 410;
+    if (resync) {
+        return Status::OK();
+    }
+    if (status_code != 200 || response.size() < sizeof(TxnTimeStamp)) {
+        return Status::UnexpectedError(fmt::format("Wal request failed with {}: {}", status_code, response));
+    }
+    std::memcpy(&leader_ts, response.data(), sizeof(TxnTimeStamp));
+    entries = response.substr(sizeof(TxnTimeStamp));
+    return Status::OK();
+}
+
+i64 ReplicaManager::NowMs() {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+} // namespace infinity
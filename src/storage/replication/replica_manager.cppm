@@ -0,0 +1,103 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module replica_manager;
+
+import stl;
+import status;
+import third_party;
+import http_client;
+import wal_entry;
+
+namespace infinity {
+
+class Storage;
+
+export enum class ReplicaState {
+    kBootstrapping,
+    kStreaming,
+    kDisconnected,
+    // The leader recycled the wal the replica needs, a restart copies the files again.
+    kResyncRequired,
+};
+
+export String ReplicaStateToString(ReplicaState state);
+
+// The follower side of the replication. The replica starts from the files of the leader at a checkpoint, then tails the wal of
+// the leader and replays each entry as a txn of its own, the same way as the replay at the start.
+export class ReplicaManager {
+public:
+    ReplicaManager(Storage *storage, const String &leader_address, u64 poll_interval_ms);
+
+    ~ReplicaManager();
+
+    // Before the replay of the wal at the start: copies the data dir of the leader at a checkpoint and writes the entry of the
+    // checkpoint as the only local wal, so the replay recovers the catalog of the leader.
+    void Bootstrap();
+
+    // Tails the wal of the leader after the checkpoint, once the txn manager runs.
+    void Start();
+
+    void Stop();
+
+    ReplicaState state() const { return state_.load(); }
+
+    // The commit ts of the last entry applied, in the ts of the leader
+    TxnTimeStamp applied_ts() const { return applied_ts_.load(); }
+
+    // The time since the replica last had all the commits of the leader
+    u64 StalenessMs() const;
+
+    nlohmann::json ToJson() const;
+
+private:
+    void Run();
+
+    // Returns true if the leader has more entries to apply right away.
+    bool Poll();
+
+    void Apply(WalEntry &entry);
+
+    Status FetchManifest(const String &dir, nlohmann::json &manifest);
+
+    Status FetchFiles(const nlohmann::json &manifest);
+
+    Status FetchFile(const String &path, SizeT size);
+
+    // resync is set if the leader no longer has the entries
+    Status FetchWal(TxnTimeStamp from_ts, SizeT max_bytes, TxnTimeStamp &leader_ts, String &entries, bool &resync);
+
+    // The segment dirs added by the import or the compaction of the entry
+    void SegmentDirs(WalEntry &entry, Vector<String> &dirs);
+
+    static i64 NowMs();
+
+    Storage *storage_{};
+    HttpClient client_;
+    u64 poll_interval_ms_{};
+
+    Atomic<ReplicaState> state_{ReplicaState::kBootstrapping};
+    TxnTimeStamp checkpoint_ts_{};
+    Atomic<TxnTimeStamp> applied_ts_{};
+    Atomic<TxnTimeStamp> leader_ts_{};
+    // The time of the last poll after which all commits of the leader were applied
+    Atomic<i64> synced_ms_{};
+
+    Thread thread_{};
+    atomic_bool running_{false};
+};
+
+} // namespace infinity
@@ -0,0 +1,147 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+module replication_source;
+
+import stl;
+import status;
+import third_party;
+import storage;
+import wal_manager;
+import txn_manager;
+import txn;
+import bg_task;
+import config;
+import logger;
+
+namespace infinity {
+
+Status ReplicationSource::Manifest(nlohmann::json &manifest) {
+    // A full checkpoint lets the follower replay from a recent entry, if one is running its entry will do.
+    TxnManager *txn_mgr = storage_->txn_manager();
+    Txn *txn = txn_mgr->BeginTxn();
+    auto force_ckp_task = MakeShared<ForceCheckpointTask>(txn, true /*is_full_checkpoint*/);
+    if (storage_->wal_manager()->TrySubmitCheckpointTask(force_ckp_task)) {
+        force_ckp_task->Wait();
+    }
+    txn_mgr->CommitTxn(txn);
+
+    TxnTimeStamp checkpoint_ts = storage_->wal_manager()->LastCheckpointEntryTS();
+    if (checkpoint_ts == 0) {
+        return Status::UnexpectedError("No checkpoint in the wal of the leader");
+    }
+    manifest["checkpoint_ts"] = checkpoint_ts;
+    manifest["files"] = nlohmann::json::array();
+    ListFiles(*storage_->config()->data_dir(), manifest["files"]);
+    LOG_INFO(fmt::format("Replication manifest of {} files at checkpoint {}", manifest["files"].size(), checkpoint_ts));
+    return Status::OK();
+}
+
+Status ReplicationSource::ListDir(const String &dir, nlohmann::json &manifest) {
+    String full_path;
+    Status status = DataPath(dir, full_path);
+    if (!status.ok()) {
+        return status;
+    }
+    manifest["files"] = nlohmann::json::array();
+    if (std::filesystem::is_directory(full_path)) {
+        ListFiles(full_path, manifest["files"]);
+    }
+    return Status::OK();
+}
+
+Status ReplicationSource::ReadFile(const String &path, SizeT offset, SizeT length, String &data) {
+    String full_path;
+    Status status = DataPath(path, full_path);
+    if (!status.ok()) {
+        return status;
+    }
+    std::ifstream file(full_path, std::ios::binary);
+    if (!file.is_open()) {
+        return Status::FileNotFound(path);
+    }
+    file.seekg(0, std::ios::end);
+    SizeT file_size = file.tellg();
+    if (offset > file_size) {
+        return Status::IOError(fmt::format("Offset {} is beyond the size {} of {}", offset, file_size, path));
+    }
+    data.resize(std::min(length, file_size - offset));
+    file.seekg(offset);
+    file.read(data.data(), data.size());
+    if (!file) {
+        return Status::IOError(fmt::format("Can't read {}", path));
+    }
+    return Status::OK();
+}
+
+bool ReplicationSource::ReadWal(TxnTimeStamp from_ts, SizeT max_bytes, String &data) {
+    // Read before the entries, so a follower that applied up to it has all that was durable when it asked.
+    TxnTimeStamp leader_ts = storage_->wal_manager()->DurableCommitTS();
+    String entries;
+    if (!storage_->wal_manager()->ReadEntriesFrom(from_ts, max_bytes, entries)) {
+        return false;
+    }
+    data.resize(sizeof(TxnTimeStamp));
+    std::memcpy(data.data(), &leader_ts, sizeof(TxnTimeStamp));
+    data += entries;
+    return true;
+}
+
+Status ReplicationSource::DataPath(const String &path, String &full_path) const {
+    Path relative_path(path);
+    if (path.empty() || relative_path.is_absolute()) {
+        return Status::InvalidParameterValue("path", path, "a relative path under the data dir");
+    }
+    for (const auto &part : relative_path) {
+        if (part == "..") {
+            return Status::InvalidParameterValue("path", path, "a relative path under the data dir");
+        }
+    }
+    full_path = *storage_->config()->data_dir() + "/" + path;
+    return Status::OK();
+}
+
+void ReplicationSource::ListFiles(const String &dir, nlohmann::json &files) const {
+    const String &data_dir = *storage_->config()->data_dir();
+    std::error_code error;
+    for (auto iter = std::filesystem::recursive_directory_iterator(dir, error); !error && iter != std::filesystem::end(iter);
+         iter.increment(error)) {
+        if (!iter->is_regular_file(error)) {
+            continue;
+        }
+        // The temp files of a running checkpoint
+        String filename = iter->path().filename().string();
+        if (filename.starts_with("_") || filename.ends_with(".tmp")) {
+            continue;
+        }
+        SizeT file_size = iter->file_size(error);
+        if (error) {
+            // removed by the cleanup after it was listed
+            error.clear();
+            continue;
+        }
+        nlohmann::json file_json;
+        file_json["path"] = std::filesystem::relative(iter->path(), data_dir).string();
+        file_json["size"] = file_size;
+        files.push_back(std::move(file_json));
+    }
+}
+
+} // namespace infinity
@@ -0,0 +1,55 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module replication_source;
+
+import stl;
+import status;
+import third_party;
+
+namespace infinity {
+
+class Storage;
+
+// The leader side of the replication, served over http to the followers.
+export class ReplicationSource {
+public:
+    explicit ReplicationSource(Storage *storage) : storage_(storage) {}
+
+    // Takes a full checkpoint and lists the files under the data dir. A follower copies them and starts with the wal entry of
+    // the checkpoint, at checkpoint_ts in the manifest.
+    Status Manifest(nlohmann::json &manifest);
+
+    // Lists the files under a dir of the data dir, a follower copies the segments of an import or a compaction before it
+    // replays the entry.
+    Status ListDir(const String &dir, nlohmann::json &manifest);
+
+    Status ReadFile(const String &path, SizeT offset, SizeT length, String &data);
+
+    // The durable commit ts of the leader as 8 bytes, then the wal entries from from_ts. Returns false if the entries are
+    // recycled, the follower has to copy the files again.
+    bool ReadWal(TxnTimeStamp from_ts, SizeT max_bytes, String &data);
+
+private:
+    // The path under the data dir, a path out of it is refused.
+    Status DataPath(const String &path, String &full_path) const;
+
+    void ListFiles(const String &dir, nlohmann::json &files) const;
+
+    Storage *storage_{};
+};
+
+} // namespace infinity
@@ -0,0 +1,203 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <algorithm>
+
+module bitmap_index_data;
+
+import stl;
+import third_party;
+import file_system;
+import buffer_manager;
+import data_type;
+import logical_type;
+import internal_types;
+import default_values;
+import segment_entry;
+import block_entry;
+import segment_iter;
+import block_column_iter;
+import column_vector;
+import secondary_index_data;
+import infinity_exception;
+import logger;
+
+namespace infinity {
+
+template <typename RawValueType>
+class BitmapIndexDataT final : public BitmapIndexData {
+    using KeyType = ConvertToOrderedType<RawValueType>;
+
+public:
+    explicit BitmapIndexDataT(u32 full_data_num) : BitmapIndexData(full_data_num) {}
+
+    u32 GetKeyNum() const final { return keys_.size(); }
+
+    void Build(const SegmentEntry *segment_entry, BufferManager *buffer_mgr, ColumnID column_id, TxnTimeStamp begin_ts, bool check_ts) final {
+        if (check_ts) {
+            BuildInner<true>(segment_entry, buffer_mgr, column_id, begin_ts);
+        } else {
+            BuildInner<false>(segment_entry, buffer_mgr, column_id, begin_ts);
+        }
+    }
+
+    void RangeQuery(const void *begin_val, const void *end_val, RoaringBitmap &result) const final {
+        const KeyType begin_key = *static_cast<const KeyType *>(begin_val);
+        const KeyType end_key = *static_cast<const KeyType *>(end_val);
+        if (end_key < begin_key) {
+            return;
+        }
+        const SizeT begin_id = std::lower_bound(keys_.begin(), keys_.end(), begin_key) - keys_.begin();
+        const SizeT end_id = std::upper_bound(keys_.begin(), keys_.end(), end_key) - keys_.begin();
+        if (begin_id == end_id) {
+            return;
+        }
+        if (end_id - begin_id == 1) {
+            result |= bitmaps_[begin_id];
+            return;
+        }
+        // a range over many keys is one multi-way union instead of a union per key
+        Vector<const RoaringBitmap *> inputs;
+        inputs.reserve(end_id - begin_id + 1);
+        inputs.push_back(&result);
+        for (SizeT i = begin_id; i < end_id; ++i) {
+            inputs.push_back(&bitmaps_[i]);
+        }
+        result = RoaringBitmap::fastunion(inputs.size(), inputs.data());
+    }
+
+protected:
+    void SaveKeys(FileHandler &file_handler) const final { file_handler.Write(keys_.data(), keys_.size() * sizeof(KeyType)); }
+
+    void ReadKeys(FileHandler &file_handler, u32 key_num) final {
+        keys_.resize(key_num);
+        file_handler.Read(keys_.data(), key_num * sizeof(KeyType));
+    }
+
+private:
+    template <bool CheckTS>
+    void BuildInner(const SegmentEntry *segment_entry, BufferManager *buffer_mgr, ColumnID column_id, TxnTimeStamp begin_ts) {
+        if (data_num_ != 0) {
+            UnrecoverableError("BitmapIndexData::Build(): the index is already built");
+        }
+        Map<KeyType, RoaringBitmap> key_rows;
+        BlockEntryIter block_entry_iter(segment_entry);
+        for (auto *block_entry = block_entry_iter.Next(); block_entry != nullptr; block_entry = block_entry_iter.Next()) {
+            BlockColumnIter<CheckTS> column_iter(block_entry->GetColumnBlockEntry(column_id), buffer_mgr, begin_ts);
+            const SegmentOffset block_start_offset = block_entry->block_id() * DEFAULT_BLOCK_CAPACITY;
+            const ColumnVector &column_vector = *column_iter.column_vector();
+            for (auto pair_opt = column_iter.Next(); pair_opt; pair_opt = column_iter.Next()) {
+                if (data_num_ >= full_data_num_) {
+                    UnrecoverableError("BitmapIndexData::Build(): segment row count more than expected");
+                }
+                BlockOffset block_offset = pair_opt->second;
+                key_rows[GetOrderedKeyOfRow<RawValueType>(column_vector, block_offset)].add(block_start_offset + block_offset);
+                ++data_num_;
+            }
+        }
+        keys_.reserve(key_rows.size());
+        bitmaps_.reserve(key_rows.size());
+        for (auto &[key, rows] : key_rows) {
+            rows.runOptimize();
+            rows.shrinkToFit();
+            keys_.push_back(key);
+            bitmaps_.push_back(std::move(rows));
+        }
+        LOG_TRACE(fmt::format("BitmapIndexData::Build(): {} rows, {} keys.", data_num_, keys_.size()));
+    }
+
+    Vector<KeyType> keys_; // sorted distinct keys
+};
+
+void BitmapIndexData::SaveIndexInner(FileHandler &file_handler) const {
+    const u32 key_num = GetKeyNum();
+    file_handler.Write(&full_data_num_, sizeof(full_data_num_));
+    file_handler.Write(&data_num_, sizeof(data_num_));
+    file_handler.Write(&key_num, sizeof(key_num));
+    SaveKeys(file_handler);
+    Vector<char> buffer;
+    for (const auto &bitmap : bitmaps_) {
+        const u32 bitmap_size = bitmap.getSizeInBytes();
+        buffer.resize(bitmap_size);
+        bitmap.write(buffer.data());
+        file_handler.Write(&bitmap_size, sizeof(bitmap_size));
+        file_handler.Write(buffer.data(), bitmap_size);
+    }
+    LOG_TRACE("BitmapIndexData::SaveIndexInner() done.");
+}
+
+void BitmapIndexData::ReadIndexInner(FileHandler &file_handler) {
+    u32 key_num = 0;
+    file_handler.Read(&full_data_num_, sizeof(full_data_num_));
+    file_handler.Read(&data_num_, sizeof(data_num_));
+    file_handler.Read(&key_num, sizeof(key_num));
+    ReadKeys(file_handler, key_num);
+    bitmaps_.clear();
+    bitmaps_.reserve(key_num);
+    Vector<char> buffer;
+    for (u32 i = 0; i < key_num; ++i) {
+        u32 bitmap_size = 0;
+        file_handler.Read(&bitmap_size, sizeof(bitmap_size));
+        buffer.resize(bitmap_size);
+        file_handler.Read(buffer.data(), bitmap_size);
+        bitmaps_.push_back(RoaringBitmap::readSafe(buffer.data(), bitmap_size));
+    }
+    LOG_TRACE("BitmapIndexData::ReadIndexInner() done.");
+}
+
+UniquePtr<BitmapIndexData> BitmapIndexData::Make(const SharedPtr<DataType> &data_type, u32 full_data_num) {
+    switch (data_type->type()) {
+        case LogicalType::kTinyInt: {
+            return MakeUnique<BitmapIndexDataT<TinyIntT>>(full_data_num);
+        }
+        case LogicalType::kSmallInt: {
+            return MakeUnique<BitmapIndexDataT<SmallIntT>>(full_data_num);
+        }
+        case LogicalType::kInteger: {
+            return MakeUnique<BitmapIndexDataT<IntegerT>>(full_data_num);
+        }
+        case LogicalType::kBigInt: {
+            return MakeUnique<BitmapIndexDataT<BigIntT>>(full_data_num);
+        }
+        case LogicalType::kFloat: {
+            return MakeUnique<BitmapIndexDataT<FloatT>>(full_data_num);
+        }
+        case LogicalType::kDouble: {
+            return MakeUnique<BitmapIndexDataT<DoubleT>>(full_data_num);
+        }
+        case LogicalType::kDate: {
+            return MakeUnique<BitmapIndexDataT<DateT>>(full_data_num);
+        }
+        case LogicalType::kTime: {
+            return MakeUnique<BitmapIndexDataT<TimeT>>(full_data_num);
+        }
+        case LogicalType::kDateTime: {
+            return MakeUnique<BitmapIndexDataT<DateTimeT>>(full_data_num);
+        }
+        case LogicalType::kTimestamp: {
+            return MakeUnique<BitmapIndexDataT<TimestampT>>(full_data_num);
+        }
+        case LogicalType::kVarchar: {
+            return MakeUnique<BitmapIndexDataT<VarcharT>>(full_data_num);
+        }
+        default: {
+            UnrecoverableError(fmt::format("Need to add bitmap index support for data type: {}", data_type->ToString()));
+            return nullptr;
+        }
+    }
+}
+
+} // namespace infinity
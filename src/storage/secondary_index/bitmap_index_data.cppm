@@ -0,0 +1,65 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module bitmap_index_data;
+
+import stl;
+import third_party;
+import file_system;
+import buffer_manager;
+import data_type;
+import segment_entry;
+
+namespace infinity {
+
+// The bitmap index of a column in a segment: the distinct ordered keys of the column, and for each key a roaring bitmap of the
+// offsets of its rows. The keys are the ones of the secondary index, so the same key intervals are searched on both.
+export class BitmapIndexData {
+public:
+    virtual ~BitmapIndexData() = default;
+
+    [[nodiscard]] u32 GetFullDataNum() const { return full_data_num_; }
+    [[nodiscard]] u32 GetDataNum() const { return data_num_; }
+
+    // number of distinct keys
+    [[nodiscard]] virtual u32 GetKeyNum() const = 0;
+
+    virtual void Build(const SegmentEntry *segment_entry, BufferManager *buffer_mgr, ColumnID column_id, TxnTimeStamp begin_ts, bool check_ts) = 0;
+
+    // add the offsets of the rows whose key is in [*begin_val, *end_val]
+    // begin_val, end_val: pointers to the ordered key type of the column
+    virtual void RangeQuery(const void *begin_val, const void *end_val, RoaringBitmap &result) const = 0;
+
+    void SaveIndexInner(FileHandler &file_handler) const;
+
+    void ReadIndexInner(FileHandler &file_handler);
+
+    // used in BitmapIndexFileWorker::AllocateInMemory() and BitmapIndexFileWorker::ReadFromFileImpl()
+    static UniquePtr<BitmapIndexData> Make(const SharedPtr<DataType> &data_type, u32 full_data_num);
+
+protected:
+    explicit BitmapIndexData(u32 full_data_num) : full_data_num_(full_data_num) {}
+
+    virtual void SaveKeys(FileHandler &file_handler) const = 0;
+
+    virtual void ReadKeys(FileHandler &file_handler, u32 key_num) = 0;
+
+    u32 full_data_num_{};           // number of rows in the segment (include those deleted)
+    u32 data_num_{};                // number of rows in the bitmaps (except those deleted)
+    Vector<RoaringBitmap> bitmaps_; // bitmaps_[i] holds the rows of the i-th key
+};
+
+} // namespace infinity
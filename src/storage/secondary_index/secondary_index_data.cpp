@@ -32,6 +32,10 @@ import segment_iter;
 import buffer_manager;
 import secondary_index_pgm;
 import logger;
+import segment_entry;
+import block_entry;
+import block_column_iter;
+import value;
 
 namespace infinity {
 
@@ -58,6 +62,34 @@ inline void LoadFromSegmentColumnIterator(OneColumnIterator<RawValueType, CheckT
     std::sort(sorted_key_offset_pair.get(), sorted_key_offset_pair.get() + data_num);
 }
 
+// the data of a long varchar is in the heap of its column vector, so the keys are read through the block column vectors
+template <bool CheckTS, typename KeyType, typename OffsetType>
+inline void LoadVarcharFromSegment(const SegmentEntry *segment_entry,
+                                   BufferManager *buffer_mgr,
+                                   ColumnID column_id,
+                                   TxnTimeStamp begin_ts,
+                                   UniquePtr<Pair<KeyType, OffsetType>[]> &sorted_key_offset_pair,
+                                   const u32 full_data_num,
+                                   u32 &data_num) {
+    if (data_num != 0) {
+        UnrecoverableError("LoadVarcharFromSegment(): data_num is not initially 0");
+    }
+    BlockEntryIter block_entry_iter(segment_entry);
+    for (auto *block_entry = block_entry_iter.Next(); block_entry != nullptr; block_entry = block_entry_iter.Next()) {
+        BlockColumnIter<CheckTS> column_iter(block_entry->GetColumnBlockEntry(column_id), buffer_mgr, begin_ts);
+        const SegmentOffset block_start_offset = block_entry->block_id() * DEFAULT_BLOCK_CAPACITY;
+        for (auto pair_opt = column_iter.Next(); pair_opt; pair_opt = column_iter.Next()) {
+            if (data_num >= full_data_num) {
+                UnrecoverableError("LoadVarcharFromSegment(): segment row count more than expected");
+            }
+            BlockOffset block_offset = pair_opt->second;
+            Value value = column_iter.column_vector()->GetValue(block_offset);
+            sorted_key_offset_pair[data_num++] = {ConvertToOrderedVarcharKey(value.GetVarchar()), block_start_offset + block_offset};
+        }
+    }
+    std::sort(sorted_key_offset_pair.get(), sorted_key_offset_pair.get() + data_num);
+}
+
 // usage:
 //  1. AppendColumnVector(): merge sort, collect all values of the column in the segment
 //  2.1. OutputToPart(): copy sorted (key, offset) pairs into several SecondaryIndexDataPart structures.
@@ -81,7 +113,13 @@ public:
     void
     LoadSegmentData(const SegmentEntry *segment_entry, BufferManager *buffer_mgr, ColumnID column_id, TxnTimeStamp begin_ts, bool check_ts) final {
         static_assert(std::is_same_v<OffsetType, SegmentOffset>, "OffsetType != SegmentOffset, need to fix");
-        if (check_ts) {
+        if constexpr (std::is_same_v<RawValueType, VarcharT>) {
+            if (check_ts) {
+                return LoadVarcharFromSegment<true>(segment_entry, buffer_mgr, column_id, begin_ts, sorted_key_offset_pair_, full_data_num_, data_num_);
+            } else {
+                return LoadVarcharFromSegment<false>(segment_entry, buffer_mgr, column_id, begin_ts, sorted_key_offset_pair_, full_data_num_, data_num_);
+            }
+        } else if (check_ts) {
             OneColumnIterator<RawValueType> iter(segment_entry, buffer_mgr, column_id, begin_ts);
             return LoadFromSegmentColumnIterator(iter, sorted_key_offset_pair_, full_data_num_, data_num_);
         } else {
@@ -140,9 +178,10 @@ public:
         // 2. pgm
         sorted_key_offset_pair_.reset(); // release some memory
         {
-            index_head->pgm_index_ = GenerateSecondaryPGMIndex<KeyType>();
-            index_head->pgm_index_->BuildIndex(data_num_, sorted_keys_.get());
-            LOG_TRACE("OutputToHeader(): Successfully built pgm index.");
+            index_head->pgm_index_ = BuildSecondaryPGMIndex<KeyType>(data_num_, sorted_keys_.get());
+            LOG_TRACE(fmt::format("OutputToHeader(): Successfully built pgm index, epsilon: {}, size: {} bytes.",
+                                  index_head->pgm_index_->Epsilon(),
+                                  index_head->pgm_index_->SizeInBytes()));
         }
         // 3. finish
         ++output_part_progress_;
@@ -259,6 +298,9 @@ UniquePtr<SecondaryIndexDataBuilderBase> GetSecondaryIndexDataBuilder(const Shar
         case LogicalType::kTimestamp: {
             return MakeUnique<SecondaryIndexDataBuilder<TimestampT>>(full_data_num, part_capacity);
         }
+        case LogicalType::kVarchar: {
+            return MakeUnique<SecondaryIndexDataBuilder<VarcharT>>(full_data_num, part_capacity);
+        }
         default: {
             UnrecoverableError(fmt::format("Need to add secondary index support for data type: {}", data_type->ToString()));
             return {};
@@ -278,6 +320,8 @@ void SecondaryIndexDataHead::SaveIndexInner(FileHandler &file_handler) const {
     file_handler.Write(&data_type_key_, sizeof(data_type_key_));
     file_handler.Write(&data_type_offset_, sizeof(data_type_offset_));
     // pgm
+    const u32 pgm_epsilon = pgm_index_->Epsilon();
+    file_handler.Write(&pgm_epsilon, sizeof(pgm_epsilon));
     pgm_index_->SaveIndex(file_handler);
     LOG_TRACE("SaveIndexInner() done.");
 }
@@ -293,30 +337,32 @@ void SecondaryIndexDataHead::ReadIndexInner(FileHandler &file_handler) {
     file_handler.Read(&data_type_raw_, sizeof(data_type_raw_));
     file_handler.Read(&data_type_key_, sizeof(data_type_key_));
     file_handler.Read(&data_type_offset_, sizeof(data_type_offset_));
-    // initialize pgm
+    // initialize pgm with the error bound it was built with
+    u32 pgm_epsilon = 0;
+    file_handler.Read(&pgm_epsilon, sizeof(pgm_epsilon));
     switch (data_type_key_) {
         case LogicalType::kTinyInt: {
-            pgm_index_ = GenerateSecondaryPGMIndex<TinyIntT>();
+            pgm_index_ = GenerateSecondaryPGMIndex<TinyIntT>(pgm_epsilon);
             break;
         }
         case LogicalType::kSmallInt: {
-            pgm_index_ = GenerateSecondaryPGMIndex<SmallIntT>();
+            pgm_index_ = GenerateSecondaryPGMIndex<SmallIntT>(pgm_epsilon);
             break;
         }
         case LogicalType::kInteger: {
-            pgm_index_ = GenerateSecondaryPGMIndex<IntegerT>();
+            pgm_index_ = GenerateSecondaryPGMIndex<IntegerT>(pgm_epsilon);
             break;
         }
         case LogicalType::kBigInt: {
-            pgm_index_ = GenerateSecondaryPGMIndex<BigIntT>();
+            pgm_index_ = GenerateSecondaryPGMIndex<BigIntT>(pgm_epsilon);
             break;
         }
         case LogicalType::kFloat: {
-            pgm_index_ = GenerateSecondaryPGMIndex<FloatT>();
+            pgm_index_ = GenerateSecondaryPGMIndex<FloatT>(pgm_epsilon);
             break;
         }
         case LogicalType::kDouble: {
-            pgm_index_ = GenerateSecondaryPGMIndex<DoubleT>();
+            pgm_index_ = GenerateSecondaryPGMIndex<DoubleT>(pgm_epsilon);
             break;
         }
         default: {
@@ -32,6 +32,7 @@ import logical_type;
 import internal_types;
 import data_type;
 import segment_entry;
+import value;
 
 namespace infinity {
 
@@ -44,6 +45,10 @@ concept ConvertToOrderedI32 = IsAnyOf<T, DateT, TimeT>;
 template <typename T>
 concept ConvertToOrderedI64 = IsAnyOf<T, DateTimeT, TimestampT>;
 
+// the key of a varchar is its prefix, so the index of a varchar column only narrows the rows which may match
+template <typename T>
+concept ConvertToOrderedVarcharPrefix = IsAnyOf<T, VarcharT>;
+
 template <typename ValueT>
 struct ConvertToOrdered {
     static_assert(false, "type not supported");
@@ -64,8 +69,13 @@ struct ConvertToOrdered<T> {
     using type = i64;
 };
 
+template <ConvertToOrderedVarcharPrefix T>
+struct ConvertToOrdered<T> {
+    using type = i64;
+};
+
 export template <typename T>
-    requires KeepOrderedSelf<T> or ConvertToOrderedI32<T> or ConvertToOrderedI64<T>
+    requires KeepOrderedSelf<T> or ConvertToOrderedI32<T> or ConvertToOrderedI64<T> or ConvertToOrderedVarcharPrefix<T>
 using ConvertToOrderedType = ConvertToOrdered<T>::type;
 
 export template <typename RawValueType>
@@ -90,6 +100,28 @@ ConvertToOrderedType<RawValueType> ConvertToOrderedKeyValue(RawValueType value)
     return value.GetEpochTime();
 }
 
+// VarcharT, the data of a long varchar is not in the VarcharT value
+// the first 8 bytes in big endian order, strings sharing them get the same key
+// the sign bit is flipped so that the order of the i64 keys is the unsigned byte order of the strings
+export inline i64 ConvertToOrderedVarcharKey(const String &str) {
+    u64 key = 0;
+    const SizeT prefix_len = std::min<SizeT>(str.size(), sizeof(u64));
+    for (SizeT i = 0; i < prefix_len; ++i) {
+        key |= static_cast<u64>(static_cast<u8>(str[i])) << (56 - 8 * i);
+    }
+    return static_cast<i64>(key ^ (u64(1) << 63));
+}
+
+// the ordered key of the row idx of a column vector
+export template <typename RawValueType>
+ConvertToOrderedType<RawValueType> GetOrderedKeyOfRow(const ColumnVector &column_vector, u32 idx) {
+    if constexpr (std::is_same_v<RawValueType, VarcharT>) {
+        return ConvertToOrderedVarcharKey(column_vector.GetValue(idx).GetVarchar());
+    } else {
+        return ConvertToOrderedKeyValue(reinterpret_cast<const RawValueType *>(column_vector.data())[idx]);
+    }
+}
+
 template <typename T>
 LogicalType GetLogicalType = kInvalid;
 
@@ -129,7 +161,7 @@ public:
 
 // create a secondary index on each segment
 // now only support index for single column
-// now only support create index for POD type with size <= sizeof(i64)
+// now only support create index for POD type with size <= sizeof(i64), and varchar by its prefix
 // need to convert values in column into ordered number type
 // data_num : number of rows in the segment, except those deleted
 export UniquePtr<SecondaryIndexDataBuilderBase>
@@ -173,6 +205,7 @@ public:
 
     [[nodiscard]] u32 GetPartCapacity() const { return part_capacity_; }
     [[nodiscard]] u32 GetPartNum() const { return part_num_; }
+    [[nodiscard]] u32 GetFullDataNum() const { return full_data_num_; }
     [[nodiscard]] u32 GetDataNum() const { return data_num_; }
 
     [[nodiscard]] auto SearchPGM(const void *val_ptr) const {
@@ -182,6 +215,14 @@ public:
         return pgm_index_->SearchIndex(val_ptr);
     }
 
+    // the PGM index, for its error bound and size
+    [[nodiscard]] const SecondaryPGMIndex &GetPGMIndex() const {
+        if (!pgm_index_) {
+            UnrecoverableError("Not initialized yet.");
+        }
+        return *pgm_index_;
+    }
+
     void SaveIndexInner(FileHandler &file_handler) const;
 
     void ReadIndexInner(FileHandler &file_handler);
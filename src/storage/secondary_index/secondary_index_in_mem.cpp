@@ -0,0 +1,111 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+module secondary_index_in_mem;
+
+import stl;
+import third_party;
+import column_vector;
+import data_type;
+import logical_type;
+import internal_types;
+import secondary_index_data;
+import infinity_exception;
+
+namespace infinity {
+
+// the appended rows come in the order of their offsets, a tree keeps them sorted by key on each insert
+template <typename RawValueType>
+class SecondaryIndexInMemT final : public SecondaryIndexInMem {
+    using KeyType = ConvertToOrderedType<RawValueType>;
+
+public:
+    u32 GetRowCount() const final {
+        std::shared_lock lock(rw_mutex_);
+        return in_mem_.size();
+    }
+
+    void Insert(const ColumnVector &column_vector, u32 block_offset, u32 row_count, SegmentOffset segment_offset, TxnTimeStamp commit_ts) final {
+        std::unique_lock lock(rw_mutex_);
+        for (u32 i = 0; i < row_count; ++i) {
+            in_mem_.emplace(GetOrderedKeyOfRow<RawValueType>(column_vector, block_offset + i),
+                            Pair<SegmentOffset, TxnTimeStamp>(segment_offset + i, commit_ts));
+        }
+    }
+
+    void RangeQuery(const void *begin_val, const void *end_val, TxnTimeStamp begin_ts, RoaringBitmap &result) const final {
+        const KeyType begin_key = *static_cast<const KeyType *>(begin_val);
+        const KeyType end_key = *static_cast<const KeyType *>(end_val);
+        if (end_key < begin_key) {
+            return;
+        }
+        std::shared_lock lock(rw_mutex_);
+        for (auto iter = in_mem_.lower_bound(begin_key); iter != in_mem_.end() && iter->first <= end_key; ++iter) {
+            const auto &[segment_offset, commit_ts] = iter->second;
+            if (commit_ts <= begin_ts) {
+                result.add(segment_offset);
+            }
+        }
+    }
+
+private:
+    mutable std::shared_mutex rw_mutex_;
+    MultiMap<KeyType, Pair<SegmentOffset, TxnTimeStamp>> in_mem_;
+};
+
+UniquePtr<SecondaryIndexInMem> SecondaryIndexInMem::NewSecondaryIndexInMem(const SharedPtr<DataType> &data_type) {
+    switch (data_type->type()) {
+        case LogicalType::kTinyInt: {
+            return MakeUnique<SecondaryIndexInMemT<TinyIntT>>();
+        }
+        case LogicalType::kSmallInt: {
+            return MakeUnique<SecondaryIndexInMemT<SmallIntT>>();
+        }
+        case LogicalType::kInteger: {
+            return MakeUnique<SecondaryIndexInMemT<IntegerT>>();
+        }
+        case LogicalType::kBigInt: {
+            return MakeUnique<SecondaryIndexInMemT<BigIntT>>();
+        }
+        case LogicalType::kFloat: {
+            return MakeUnique<SecondaryIndexInMemT<FloatT>>();
+        }
+        case LogicalType::kDouble: {
+            return MakeUnique<SecondaryIndexInMemT<DoubleT>>();
+        }
+        case LogicalType::kDate: {
+            return MakeUnique<SecondaryIndexInMemT<DateT>>();
+        }
+        case LogicalType::kTime: {
+            return MakeUnique<SecondaryIndexInMemT<TimeT>>();
+        }
+        case LogicalType::kDateTime: {
+            return MakeUnique<SecondaryIndexInMemT<DateTimeT>>();
+        }
+        case LogicalType::kTimestamp: {
+            return MakeUnique<SecondaryIndexInMemT<TimestampT>>();
+        }
+        case LogicalType::kVarchar: {
+            return MakeUnique<SecondaryIndexInMemT<VarcharT>>();
+        }
+        default: {
+            UnrecoverableError(fmt::format("Need to add secondary index support for data type: {}", data_type->ToString()));
+            return nullptr;
+        }
+    }
+}
+
+} // namespace infinity
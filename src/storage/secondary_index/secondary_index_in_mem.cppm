@@ -0,0 +1,45 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module secondary_index_in_mem;
+
+import stl;
+import third_party;
+import column_vector;
+import data_type;
+
+namespace infinity {
+
+// The rows appended to a segment after its secondary index was built, sorted by the ordered key of the column.
+// PhysicalIndexScan searches it together with the PGM index of the segment.
+export class SecondaryIndexInMem {
+public:
+    virtual ~SecondaryIndexInMem() = default;
+
+    // number of rows in the delta
+    virtual u32 GetRowCount() const = 0;
+
+    // insert the rows [block_offset, block_offset + row_count) of a block column, the first one at segment_offset
+    virtual void Insert(const ColumnVector &column_vector, u32 block_offset, u32 row_count, SegmentOffset segment_offset, TxnTimeStamp commit_ts) = 0;
+
+    // add the offsets of the rows committed before begin_ts whose key is in [*begin_val, *end_val]
+    // begin_val, end_val: pointers to the ordered key type of the column
+    virtual void RangeQuery(const void *begin_val, const void *end_val, TxnTimeStamp begin_ts, RoaringBitmap &result) const = 0;
+
+    static UniquePtr<SecondaryIndexInMem> NewSecondaryIndexInMem(const SharedPtr<DataType> &data_type);
+};
+
+} // namespace infinity
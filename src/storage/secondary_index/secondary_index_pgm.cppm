@@ -14,6 +14,8 @@
 
 module;
 
+#include <algorithm>
+
 export module secondary_index_pgm;
 
 import stl;
@@ -30,8 +32,16 @@ struct SecondaryIndexApproxPos {
     SizeT upper_bound_{}; ///< The upper bound of the range.
 };
 
-template <typename IndexValueType>
-using PGMIndexType = PGMIndex<IndexValueType, 8>;
+template <typename IndexValueType, SizeT Epsilon>
+using PGMIndexType = PGMIndex<IndexValueType, Epsilon>;
+
+// The error bounds a PGM index can be built with. A larger one gives fewer segments, but a longer binary search over the 2 * epsilon + 2
+// keys around the approximate position.
+export constexpr Array<u32, 5> kSecondaryPGMEpsilons = {8, 16, 32, 64, 128};
+
+// The smallest error bound is taken whose index is at most 1 / kSecondaryPGMSizeRatio of the keys, or kSecondaryPGMMinSize bytes.
+export constexpr SizeT kSecondaryPGMSizeRatio = 64;
+export constexpr SizeT kSecondaryPGMMinSize = 4096;
 
 // PGMIndex member objects:
 // size_t n;                           ///< The number of elements this index was built on.
@@ -45,15 +55,15 @@ using PGMIndexType = PGMIndex<IndexValueType, 8>;
 // Floating slope;    ///< The slope of the segment.
 // int32_t intercept; ///< The intercept of the segment.
 
-template <typename IndexValueType>
-class PGMWithExtraFunction final : public PGMIndexType<IndexValueType> {
+template <typename IndexValueType, SizeT Epsilon>
+class PGMWithExtraFunction final : public PGMIndexType<IndexValueType, Epsilon> {
 public:
     PGMWithExtraFunction() = default;
 
     // call PGMIndexType constructor
     // input data in range (first, last) need to be sorted
     template <typename RandomIt>
-    PGMWithExtraFunction(RandomIt first, RandomIt last) : PGMIndexType<IndexValueType>(first, last) {}
+    PGMWithExtraFunction(RandomIt first, RandomIt last) : PGMIndexType<IndexValueType, Epsilon>(first, last) {}
 
     inline void Load(FileHandler &file_handler) {
         {
@@ -134,11 +144,18 @@ public:
     virtual void BuildIndex(SizeT data_cnt, const void *data_ptr) = 0;
 
     virtual SecondaryIndexApproxPos SearchIndex(const void *val_ptr) const = 0;
+
+    virtual u32 Epsilon() const = 0;
+
+    // number of levels of segments searched above the keys
+    virtual SizeT Height() const = 0;
+
+    virtual SizeT SizeInBytes() const = 0;
 };
 
-template <typename IndexValueType>
+template <typename IndexValueType, SizeT EpsilonValue>
 class SecondaryPGMIndexTemplate final : public SecondaryPGMIndex {
-    UniquePtr<PGMWithExtraFunction<IndexValueType>> pgm_index_;
+    UniquePtr<PGMWithExtraFunction<IndexValueType, EpsilonValue>> pgm_index_;
     bool initialized_{false};
 
 public:
@@ -157,7 +174,7 @@ public:
         if (initialized_) {
             UnrecoverableError("Already initialized.");
         }
-        pgm_index_ = MakeUnique<PGMWithExtraFunction<IndexValueType>>();
+        pgm_index_ = MakeUnique<PGMWithExtraFunction<IndexValueType, EpsilonValue>>();
         pgm_index_->Load(file_handler);
         initialized_ = true;
     }
@@ -167,7 +184,7 @@ public:
             UnrecoverableError("Already initialized.");
         }
         auto typed_data_ptr = static_cast<const IndexValueType *>(data_ptr);
-        pgm_index_ = MakeUnique<PGMWithExtraFunction<IndexValueType>>(typed_data_ptr, typed_data_ptr + data_cnt);
+        pgm_index_ = MakeUnique<PGMWithExtraFunction<IndexValueType, EpsilonValue>>(typed_data_ptr, typed_data_ptr + data_cnt);
         initialized_ = true;
     }
 
@@ -179,11 +196,64 @@ public:
         auto [pos, lo, hi] = pgm_index_->search(val);
         return {pos, lo, hi};
     }
+
+    u32 Epsilon() const final { return EpsilonValue; }
+
+    SizeT Height() const final {
+        if (!initialized_) {
+            UnrecoverableError("Not initialized yet.");
+        }
+        return pgm_index_->height();
+    }
+
+    SizeT SizeInBytes() const final {
+        if (!initialized_) {
+            UnrecoverableError("Not initialized yet.");
+        }
+        return pgm_index_->size_in_bytes();
+    }
 };
 
+// epsilon: one of kSecondaryPGMEpsilons
+export template <typename IndexValueType>
+inline UniquePtr<SecondaryPGMIndex> GenerateSecondaryPGMIndex(u32 epsilon) {
+    switch (epsilon) {
+        case 8: {
+            return MakeUnique<SecondaryPGMIndexTemplate<IndexValueType, 8>>();
+        }
+        case 16: {
+            return MakeUnique<SecondaryPGMIndexTemplate<IndexValueType, 16>>();
+        }
+        case 32: {
+            return MakeUnique<SecondaryPGMIndexTemplate<IndexValueType, 32>>();
+        }
+        case 64: {
+            return MakeUnique<SecondaryPGMIndexTemplate<IndexValueType, 64>>();
+        }
+        case 128: {
+            return MakeUnique<SecondaryPGMIndexTemplate<IndexValueType, 128>>();
+        }
+        default: {
+            UnrecoverableError(fmt::format("Unsupported PGM index epsilon: {}", epsilon));
+            return nullptr;
+        }
+    }
+}
+
+// Build the PGM index of the sorted keys with the error bound chosen by their distribution: the number of segments for an error bound
+// depends on how close to linear the keys are, so the error bounds are tried from the smallest until the index fits the target size.
 export template <typename IndexValueType>
-inline UniquePtr<SecondaryPGMIndex> GenerateSecondaryPGMIndex() {
-    return MakeUnique<SecondaryPGMIndexTemplate<IndexValueType>>();
+inline UniquePtr<SecondaryPGMIndex> BuildSecondaryPGMIndex(SizeT data_cnt, const IndexValueType *data_ptr) {
+    const SizeT target_size = std::max(data_cnt * sizeof(IndexValueType) / kSecondaryPGMSizeRatio, kSecondaryPGMMinSize);
+    UniquePtr<SecondaryPGMIndex> pgm_index;
+    for (u32 epsilon : kSecondaryPGMEpsilons) {
+        pgm_index = GenerateSecondaryPGMIndex<IndexValueType>(epsilon);
+        pgm_index->BuildIndex(data_cnt, data_ptr);
+        if (pgm_index->SizeInBytes() <= target_size) {
+            break;
+        }
+    }
+    return pgm_index;
 }
 
 } // namespace infinity
\ No newline at end of file
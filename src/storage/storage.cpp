@@ -23,6 +23,7 @@ module storage;
 
 import config;
 import stl;
+import cold_storage;
 import buffer_manager;
 import default_values;
 import wal_manager;
@@ -39,24 +40,61 @@ import status;
 import background_process;
 import status;
 import bg_task;
+import warmup_indexes_task;
 import periodic_trigger_thread;
 import periodic_trigger;
 import log_file;
+import knn_result_cache;
+import plan_cache;
+import huge_page_allocator;
+import options;
+import replica_manager;
+import replication_source;
 
 namespace infinity {
 
 Storage::Storage(const Config *config_ptr) : config_ptr_(config_ptr) {}
 
 void Storage::Init() {
+    HugePageAllocator::SetMode(config_ptr_->huge_page());
+
     // Construct buffer manager
-    buffer_mgr_ = MakeUnique<BufferManager>(config_ptr_->buffer_pool_size(), config_ptr_->data_dir(), config_ptr_->temp_dir());
+    UniquePtr<ColdStorage> cold_storage;
+    if (!config_ptr_->cold_data_dir().empty()) {
+        cold_storage = MakeUnique<ColdStorage>(*config_ptr_->data_dir(), config_ptr_->cold_data_dir(), config_ptr_->cold_data_cache_size());
+    }
+    buffer_mgr_ =
+        MakeUnique<BufferManager>(config_ptr_->buffer_pool_size(), config_ptr_->data_dir(), config_ptr_->temp_dir(), std::move(cold_storage));
+
+    knn_result_cache_ = MakeUnique<KnnResultCache>(KNN_RESULT_CACHE_CAPACITY);
+    plan_cache_ = MakeUnique<PlanCache>(PLAN_CACHE_CAPACITY);
 
     // Construct wal manager
     wal_mgr_ = MakeUnique<WalManager>(this,
                                       *config_ptr_->wal_dir(),
                                       config_ptr_->wal_size_threshold(),
                                       config_ptr_->delta_checkpoint_interval_wal_bytes(),
-                                      config_ptr_->flush_at_commit());
+                                      config_ptr_->flush_at_commit(),
+                                      config_ptr_->wal_group_commit_max_entries(),
+                                      config_ptr_->wal_group_commit_latency_us(),
+                                      config_ptr_->wal_compress_threshold());
+
+    switch (config_ptr_->replication_role()) {
+        case ReplicationRole::kFollower: {
+            // The replay below recovers the catalog of the leader from the copied files
+            replica_mgr_ =
+                MakeUnique<ReplicaManager>(this, config_ptr_->replication_leader_address(), config_ptr_->replication_poll_interval_ms());
+            replica_mgr_->Bootstrap();
+            break;
+        }
+        case ReplicationRole::kLeader: {
+            replication_source_ = MakeUnique<ReplicationSource>(this);
+            break;
+        }
+        case ReplicationRole::kStandalone: {
+            break;
+        }
+    }
 
     // Must init catalog before txn manager.
     // Replay wal file wrap init catalog
@@ -66,7 +104,7 @@ void Storage::Init() {
     builtin_functions.Init();
     // Catalog finish init here.
 
-    bg_processor_ = MakeUnique<BGTaskProcessor>(wal_mgr_.get(), new_catalog_.get());
+    bg_processor_ = MakeUnique<BGTaskProcessor>(wal_mgr_.get(), new_catalog_.get(), buffer_mgr_.get());
     // Construct txn manager
     txn_mgr_ = MakeUnique<TxnManager>(new_catalog_.get(),
                                       buffer_mgr_.get(),
@@ -74,14 +112,16 @@ void Storage::Init() {
                                       wal_mgr_.get(),
                                       new_catalog_->next_txn_id_,
                                       system_start_ts,
-                                      config_ptr_->enable_compaction());
+                                      // a follower gets the compactions of the leader
+                                      config_ptr_->enable_compaction() && replica_mgr_.get() == nullptr,
+                                      config_ptr_->fulltext_merge_rate_limit(),
+                                      config_ptr_->checkpoint_flush_rate_limit(),
+                                      config_ptr_->zone_map_row_count());
 
     txn_mgr_->Start();
     // start WalManager after TxnManager since it depends on TxnManager.
     wal_mgr_->Start();
 
-    new_catalog_->MemIndexRecover(buffer_mgr_.get());
-
     bg_processor_->Start();
 
     auto txn = txn_mgr_->BeginTxn();
@@ -90,6 +130,12 @@ void Storage::Init() {
     force_ckp_task->Wait();
     txn_mgr_->CommitTxn(txn);
 
+    bg_processor_->Submit(MakeShared<WarmupIndexesTask>(new_catalog_.get(), txn_mgr_->BeginTxn()));
+
+    if (replica_mgr_.get() != nullptr) {
+        replica_mgr_->Start();
+    }
+
     {
         periodic_trigger_thread_ = MakeUnique<PeriodicTriggerThread>();
 
@@ -101,6 +147,14 @@ void Storage::Init() {
             LOG_WARN("Cleanup interval is not set, auto cleanup task will not be triggered");
         }
 
+        std::chrono::seconds ttl_interval = config_ptr_->ttl_interval();
+        if (ttl_interval.count() > 0) {
+            periodic_trigger_thread_->AddTrigger(
+                MakeUnique<TTLPeriodicTrigger>(ttl_interval, bg_processor_.get(), new_catalog_.get(), txn_mgr_.get()));
+        } else {
+            LOG_WARN("TTL interval is not set, the expired rows will NOT be dropped");
+        }
+
         i64 full_checkpoint_interval_sec = config_ptr_->full_checkpoint_interval_sec();
         if (full_checkpoint_interval_sec > 0) {
             periodic_trigger_thread_->AddTrigger(
@@ -124,22 +178,30 @@ void Storage::Init() {
 void Storage::UnInit() {
     fmt::print("Shutdown storage ...\n");
     periodic_trigger_thread_->Stop();
+    if (replica_mgr_.get() != nullptr) {
+        replica_mgr_->Stop();
+    }
     bg_processor_->Stop();
 
     wal_mgr_->Stop();
+    // the cached plans hold the block indexes of their snapshots
+    plan_cache_.reset();
+    replica_mgr_.reset();
+    replication_source_.reset();
     txn_mgr_.reset();
     bg_processor_.reset();
     wal_mgr_.reset();
     // Buffer Manager need to be destroyed before catalog. since buffer manage hold the raw pointer owned by catalog:
     // such as index definition and index base of IndexFileWorker
     buffer_mgr_.reset();
+    knn_result_cache_.reset();
     new_catalog_.reset();
     config_ptr_ = nullptr;
     fmt::print("Shutdown storage successfully\n");
 }
 
 void Storage::AttachCatalog(const FullCatalogFileInfo &full_ckp_info, const Vector<DeltaCatalogFileInfo> &delta_ckp_infos) {
-    new_catalog_ = Catalog::LoadFromFiles(full_ckp_info, delta_ckp_infos, buffer_mgr_.get());
+    new_catalog_ = Catalog::LoadFromFiles(full_ckp_info, delta_ckp_infos, buffer_mgr_.get(), config_ptr_->lazy_catalog_load());
 }
 
 void Storage::InitNewCatalog() {
@@ -23,6 +23,10 @@ import wal_manager;
 import background_process;
 import periodic_trigger_thread;
 import log_file;
+import knn_result_cache;
+import plan_cache;
+import replica_manager;
+import replication_source;
 
 export module storage;
 
@@ -42,6 +46,16 @@ public:
 
     [[nodiscard]] inline BGTaskProcessor *bg_processor() const noexcept { return bg_processor_.get(); }
 
+    [[nodiscard]] inline KnnResultCache *knn_result_cache() const noexcept { return knn_result_cache_.get(); }
+
+    [[nodiscard]] inline PlanCache *plan_cache() const noexcept { return plan_cache_.get(); }
+
+    // Set on a follower only
+    [[nodiscard]] inline ReplicaManager *replica_manager() const noexcept { return replica_mgr_.get(); }
+
+    // Set on a leader only
+    [[nodiscard]] inline ReplicationSource *replication_source() const noexcept { return replication_source_.get(); }
+
     void Init();
 
     void UnInit();
@@ -59,7 +73,11 @@ private:
     UniquePtr<TxnManager> txn_mgr_{};
     UniquePtr<WalManager> wal_mgr_{};
     UniquePtr<BGTaskProcessor> bg_processor_{};
+    UniquePtr<KnnResultCache> knn_result_cache_{};
+    UniquePtr<PlanCache> plan_cache_{};
     UniquePtr<PeriodicTriggerThread> periodic_trigger_thread_{};
+    UniquePtr<ReplicaManager> replica_mgr_{};
+    UniquePtr<ReplicationSource> replication_source_{};
 };
 
 } // namespace infinity
@@ -113,6 +113,30 @@ Status Txn::Delete(const String &db_name, const String &table_name, const Vector
     return delete_status;
 }
 
+Status Txn::Update(const String &db_name,
+                   const String &table_name,
+                   const Vector<RowID> &row_ids,
+                   const Vector<ColumnID> &column_ids,
+                   SharedPtr<DataBlock> values,
+                   bool check_conflict) {
+    this->CheckTxn(db_name);
+
+    auto [table_entry, status] = GetTableByName(db_name, table_name);
+    if (!status.ok()) {
+        return status;
+    }
+    if (check_conflict && table_entry->CheckUpdateConflict(row_ids, txn_id_, BeginTS())) {
+        LOG_WARN(fmt::format("Rollback update in table {} due to conflict.", table_name));
+        RecoverableError(Status::TxnRollback(TxnID()));
+    }
+
+    TxnTableStore *table_store = this->GetTxnTableStore(table_name);
+
+    wal_entry_->cmds_.push_back(MakeShared<WalCmdUpdate>(db_name, table_name, row_ids, column_ids, values));
+    auto [err_msg, update_status] = table_store->Update(row_ids, column_ids, std::move(values));
+    return update_status;
+}
+
 Status
 Txn::Compact(TableEntry *table_entry, Vector<Pair<SharedPtr<SegmentEntry>, Vector<SegmentEntry *>>> &&segment_data, CompactSegmentsTaskType type) {
     const String &table_name = *table_entry->GetTableName();
@@ -278,9 +302,11 @@ Tuple<SharedPtr<TableIndexInfo>, Status> Txn::GetTableIndexInfo(const String &db
 }
 
 Status Txn::CreateIndexPrepare(TableIndexEntry *table_index_entry, BaseTableRef *table_ref, bool prepare, bool check_ts) {
-    auto *table_entry = table_ref->table_entry_ptr_;
-    auto [segment_index_entries, status] =
-        table_index_entry->CreateIndexPrepare(table_entry, table_ref->block_index_.get(), this, prepare, false, check_ts);
+    return CreateIndexPrepare(table_index_entry, table_ref->table_entry_ptr_, table_ref->block_index_.get(), prepare, check_ts);
+}
+
+Status Txn::CreateIndexPrepare(TableIndexEntry *table_index_entry, TableEntry *table_entry, BlockIndex *block_index, bool prepare, bool check_ts) {
+    auto [segment_index_entries, status] = table_index_entry->CreateIndexPrepare(table_entry, block_index, this, prepare, false, check_ts);
     if (!status.ok()) {
         return Status::OK();
     }
@@ -418,11 +444,13 @@ TxnTimeStamp Txn::Commit() {
     }
     // Put wal entry to the manager in the same order as commit_ts.
     wal_entry_->txn_id_ = txn_id_;
+    txn_mgr_->BeginWriteCommit();
     txn_mgr_->SendToWAL(this);
 
     // Wait until CommitTxnBottom is done.
     std::unique_lock<std::mutex> lk(lock_);
     cond_var_.wait(lk, [this] { return done_bottom_; });
+    txn_mgr_->EndWriteCommit();
     LOG_TRACE(fmt::format("Txn: {} is committed. commit ts: {}", txn_id_, this->CommitTS()));
 
     // Don't need to write empty CatalogDeltaEntry (read-only transactions).
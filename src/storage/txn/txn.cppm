@@ -31,6 +31,7 @@ import database_detail;
 import status;
 import extra_ddl_info;
 import internal_types;
+import block_index;
 
 namespace infinity {
 
@@ -133,6 +134,8 @@ public:
 
     Status CreateIndexPrepare(TableIndexEntry *table_index_entry, BaseTableRef *table_ref, bool prepare, bool check_ts = true);
 
+    Status CreateIndexPrepare(TableIndexEntry *table_index_entry, TableEntry *table_entry, BlockIndex *block_index, bool prepare, bool check_ts);
+
     Status CreateIndexDo(BaseTableRef *table_ref, const String &index_name, HashMap<SegmentID, atomic_u64> &create_index_idxes);
 
     Status CreateIndexFinish(const String &db_name, const String &table_name, const SharedPtr<IndexBase> &indef);
@@ -158,6 +161,14 @@ public:
 
     Status Delete(const String &db_name, const String &table_name, const Vector<RowID> &row_ids, bool check_conflict = true);
 
+    // Overwrite the fixed-width columns of the rows in place, values hold only the updated columns.
+    Status Update(const String &db_name,
+                  const String &table_name,
+                  const Vector<RowID> &row_ids,
+                  const Vector<ColumnID> &column_ids,
+                  SharedPtr<DataBlock> values,
+                  bool check_conflict = true);
+
     Status
     Compact(TableEntry *table_entry, Vector<Pair<SharedPtr<SegmentEntry>, Vector<SegmentEntry *>>> &&segment_data, CompactSegmentsTaskType type);
 
@@ -31,6 +31,7 @@ import background_process;
 import catalog_delta_entry;
 import default_values;
 import wal_manager;
+import wal_entry;
 import bg_task;
 
 namespace infinity {
@@ -41,9 +42,13 @@ TxnManager::TxnManager(Catalog *catalog,
                        WalManager *wal_mgr,
                        TransactionID start_txn_id,
                        TxnTimeStamp start_ts,
-                       bool enable_compaction)
+                       bool enable_compaction,
+                       u64 fulltext_merge_rate_limit,
+                       u64 checkpoint_flush_rate_limit,
+                       u64 zone_map_row_count)
     : catalog_(catalog), buffer_mgr_(buffer_mgr), bg_task_processor_(bg_task_processor), wal_mgr_(wal_mgr), start_txn_id_(start_txn_id),
-      start_ts_(start_ts), is_running_(false), enable_compaction_(enable_compaction) {
+      start_ts_(start_ts), is_running_(false), enable_compaction_(enable_compaction), fulltext_merge_rate_limit_(fulltext_merge_rate_limit),
+      checkpoint_flush_rate_limit_(checkpoint_flush_rate_limit), zone_map_row_count_(zone_map_row_count) {
     catalog_->SetTxnMgr(this);
 }
 
@@ -53,12 +58,14 @@ Txn *TxnManager::BeginTxn() {
         UnrecoverableError("TxnManager is not running, cannot create txn");
     }
 
-    rw_locker_.lock();
-
     // Assign a new txn id
     u64 new_txn_id = ++catalog_->next_txn_id_;
 
-    // Record the start ts of the txn
+    TxnMapShard &shard = GetShard(new_txn_id);
+    std::unique_lock w_locker(shard.rw_locker_);
+
+    // Record the start ts of the txn. It is taken under the lock of the shard, so GetMinUnflushedTS either finds the txn or reads
+    // the start ts before it.
     TxnTimeStamp ts = ++start_ts_;
 
     // Create txn instance
@@ -66,19 +73,17 @@ Txn *TxnManager::BeginTxn() {
 
     // Storage txn in txn manager
     Txn *res = new_txn.get();
-    txn_map_[new_txn_id] = std::move(new_txn);
-    ts_map_.emplace(ts, new_txn_id);
-    rw_locker_.unlock();
+    shard.txn_map_[new_txn_id] = std::move(new_txn);
+    w_locker.unlock();
 
     LOG_TRACE(fmt::format("Txn: {} is Begin. begin ts: {}", new_txn_id, ts));
     return res;
 }
 
 Txn *TxnManager::GetTxn(TransactionID txn_id) {
-    rw_locker_.lock_shared();
-    Txn *res = txn_map_.at(txn_id).get();
-    rw_locker_.unlock_shared();
-    return res;
+    TxnMapShard &shard = GetShard(txn_id);
+    std::shared_lock r_locker(shard.rw_locker_);
+    return shard.txn_map_.at(txn_id).get();
 }
 
 TxnState TxnManager::GetTxnState(TransactionID txn_id) { return GetTxn(txn_id)->GetTxnState(); }
@@ -102,7 +107,10 @@ void TxnManager::SendToWAL(Txn *txn) {
         UnrecoverableError("TxnManager is null");
     }
 
-    wal_mgr_->PutEntry(txn->GetWALEntry(), txn);
+    WalEntry *wal_entry = txn->GetWALEntry();
+    // Compress on the committing thread rather than the single flush thread
+    wal_entry->Compress(wal_mgr_->cfg_compress_threshold_);
+    wal_mgr_->PutEntry(wal_entry, txn);
 }
 
 void TxnManager::AddDeltaEntry(UniquePtr<CatalogDeltaEntry> delta_entry) {
@@ -128,17 +136,19 @@ void TxnManager::Stop() {
     }
 
     LOG_INFO("Txn manager is stopping...");
-    std::unique_lock<std::shared_mutex> w_locker(rw_locker_);
-    auto it = txn_map_.begin();
-    while (it != txn_map_.end()) {
-        // remove and notify the wal manager condition variable
-        Txn *txn_ptr = it->second.get();
-        if (txn_ptr != nullptr) {
-            txn_ptr->CancelCommitBottom();
+    for (TxnMapShard &shard : txn_map_shards_) {
+        std::unique_lock<std::shared_mutex> w_locker(shard.rw_locker_);
+        auto it = shard.txn_map_.begin();
+        while (it != shard.txn_map_.end()) {
+            // remove and notify the wal manager condition variable
+            Txn *txn_ptr = it->second.get();
+            if (txn_ptr != nullptr) {
+                txn_ptr->CancelCommitBottom();
+            }
+            ++it;
         }
-        ++it;
+        shard.txn_map_.clear();
     }
-    txn_map_.clear();
     LOG_INFO("TxnManager is stopped");
 }
 
@@ -146,17 +156,17 @@ bool TxnManager::Stopped() { return !is_running_.load(); }
 
 TxnTimeStamp TxnManager::CommitTxn(Txn *txn) {
     TxnTimeStamp txn_ts = txn->Commit();
-    rw_locker_.lock();
-    txn_map_.erase(txn->TxnID());
-    rw_locker_.unlock();
+    TxnMapShard &shard = GetShard(txn->TxnID());
+    std::unique_lock w_locker(shard.rw_locker_);
+    shard.txn_map_.erase(txn->TxnID());
     return txn_ts;
 }
 
 void TxnManager::RollBackTxn(Txn *txn) {
     txn->Rollback();
-    rw_locker_.lock();
-    txn_map_.erase(txn->TxnID());
-    rw_locker_.unlock();
+    TxnMapShard &shard = GetShard(txn->TxnID());
+    std::unique_lock w_locker(shard.rw_locker_);
+    shard.txn_map_.erase(txn->TxnID());
 }
 
 void TxnManager::AddWaitFlushTxn(TransactionID txn_id) {
@@ -165,8 +175,10 @@ void TxnManager::AddWaitFlushTxn(TransactionID txn_id) {
     //     ss << txn_id << " ";
     // }
     // LOG_INFO(fmt::format("Current wait flush set: {}, add txn: {} to wait flush set", ss.str(), txn_id));
-    std::unique_lock w_lock(rw_locker_);
-    wait_flush_txns_.insert(txn_id);
+    // the txn is still in its shard
+    TxnTimeStamp begin_ts = GetTxn(txn_id)->BeginTS();
+    std::lock_guard lock(wait_flush_mutex_);
+    wait_flush_txns_.emplace(txn_id, begin_ts);
 }
 
 void TxnManager::RemoveWaitFlushTxns(const Vector<TransactionID> &txn_ids) {
@@ -179,7 +191,7 @@ void TxnManager::RemoveWaitFlushTxns(const Vector<TransactionID> &txn_ids) {
     //     ss2 << txn_id << " ";
     // }
     // LOG_INFO(fmt::format("Current wait flush set: {}, Remove txn: {} from wait flush set", ss1.str(), ss2.str()));
-    std::unique_lock w_lock(rw_locker_);
+    std::lock_guard lock(wait_flush_mutex_);
     for (auto txn_id : txn_ids) {
         if (!wait_flush_txns_.erase(txn_id)) {
             UnrecoverableError(fmt::format("Txn: {} not found in wait flush set", txn_id));
@@ -188,21 +200,21 @@ void TxnManager::RemoveWaitFlushTxns(const Vector<TransactionID> &txn_ids) {
 }
 
 TxnTimeStamp TxnManager::GetMinUnflushedTS() {
-    std::shared_lock r_locker(rw_locker_);
-    for (auto iter = ts_map_.begin(); iter != ts_map_.end();) {
-        auto &[ts, txn_id] = *iter;
-        if (txn_map_.find(txn_id) != txn_map_.end()) {
-            LOG_TRACE(fmt::format("Txn: {} not found in txn map", txn_id));
-            return ts;
+    // A txn begun after the start ts is read is newer than any result.
+    TxnTimeStamp min_ts = start_ts_.load();
+    for (TxnMapShard &shard : txn_map_shards_) {
+        std::shared_lock r_locker(shard.rw_locker_);
+        for (const auto &[_, txn] : shard.txn_map_) {
+            min_ts = std::min(min_ts, txn->BeginTS());
         }
-        if (wait_flush_txns_.find(txn_id) != wait_flush_txns_.end()) {
-            LOG_TRACE(fmt::format("Txn: {} wait flush", txn_id));
-            return ts;
-        }
-        iter = ts_map_.erase(iter);
     }
-    LOG_TRACE(fmt::format("No txn is active, return the next ts {}", start_ts_));
-    return start_ts_;
+    // Read after the shards: a committed txn waits for the flush before it leaves its shard.
+    std::lock_guard lock(wait_flush_mutex_);
+    for (const auto &[_, begin_ts] : wait_flush_txns_) {
+        min_ts = std::min(min_ts, begin_ts);
+    }
+    LOG_TRACE(fmt::format("The min unflushed ts is {}", min_ts));
+    return min_ts;
 }
 
 } // namespace infinity
@@ -37,7 +37,10 @@ public:
                         WalManager *wal_mgr,
                         TransactionID start_txn_id,
                         TxnTimeStamp start_ts,
-                        bool enable_compaction);
+                        bool enable_compaction,
+                        u64 fulltext_merge_rate_limit,
+                        u64 checkpoint_flush_rate_limit,
+                        u64 zone_map_row_count);
 
     ~TxnManager() { Stop(); }
 
@@ -47,10 +50,6 @@ public:
 
     TxnState GetTxnState(TransactionID txn_id);
 
-    inline void Lock() { rw_locker_.lock(); }
-
-    inline void UnLock() { rw_locker_.unlock(); }
-
     BufferManager *GetBufferMgr() const { return buffer_mgr_; }
 
     Catalog *GetCatalog() const { return catalog_; }
@@ -83,17 +82,49 @@ public:
 
     bool enable_compaction() const { return enable_compaction_; }
 
+    u64 fulltext_merge_rate_limit() const { return fulltext_merge_rate_limit_; }
+
+    u64 checkpoint_flush_rate_limit() const { return checkpoint_flush_rate_limit_; }
+
+    u64 zone_map_row_count() const { return zone_map_row_count_; }
+
     u64 NextSequence() { return ++sequence_; }
 
+    // Changed when a txn with writes begins and when it ends its commit. The data and the catalog visible to a new txn are the
+    // same as long as it is unchanged, if no commit was in flight when it was read.
+    u64 write_version() const { return write_version_.load(); }
+
+    bool HasCommittingWrite() const { return committing_write_count_.load() > 0; }
+
+    void BeginWriteCommit() {
+        ++committing_write_count_;
+        ++write_version_;
+    }
+
+    void EndWriteCommit() {
+        ++write_version_;
+        --committing_write_count_;
+    }
+
 private:
     TransactionID GetNewTxnID();
 
+    // Every query is a txn, so the running txns are spread over shards by txn id, and a txn begins and ends under the lock of
+    // its shard only.
+    static constexpr SizeT TXN_MAP_SHARD_NUM = 64;
+
+    struct alignas(64) TxnMapShard {
+        std::shared_mutex rw_locker_{};
+        HashMap<TransactionID, SharedPtr<Txn>> txn_map_{};
+    };
+
+    TxnMapShard &GetShard(TransactionID txn_id) { return txn_map_shards_[txn_id % TXN_MAP_SHARD_NUM]; }
+
 private:
     Catalog *catalog_{};
-    std::shared_mutex rw_locker_{};
     BufferManager *buffer_mgr_{};
     BGTaskProcessor *bg_task_processor_{};
-    HashMap<TransactionID, SharedPtr<Txn>> txn_map_{};
+    Array<TxnMapShard, TXN_MAP_SHARD_NUM> txn_map_shards_{};
     WalManager *wal_mgr_;
 
     TransactionID start_txn_id_{};
@@ -101,15 +132,21 @@ private:
     //    std::mutex mutex_;
     Atomic<TxnTimeStamp> start_ts_{}; // The next txn ts
     // Deque<TxnTimeStamp> ts_queue_{}; // the ts queue
-    Map<TxnTimeStamp, TransactionID> ts_map_{};
-    HashSet<TransactionID> wait_flush_txns_{};
+    std::mutex wait_flush_mutex_{};
+    HashMap<TransactionID, TxnTimeStamp> wait_flush_txns_{}; // the begin ts of the committed txns whose delta isn't flushed
 
     //    Map<TxnTimeStamp, SharedPtr<WalEntry>> priority_que_; // TODO: use C++23 std::flat_map?
     // For stop the txn manager
     atomic_bool is_running_{false};
     bool enable_compaction_{};
+    u64 fulltext_merge_rate_limit_{};
+    u64 checkpoint_flush_rate_limit_{};
+    u64 zone_map_row_count_{};
 
     u64 sequence_{};
+
+    Atomic<u64> write_version_{};
+    Atomic<u64> committing_write_count_{};
 };
 
 } // namespace infinity
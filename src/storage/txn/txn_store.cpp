@@ -36,7 +36,11 @@ import data_type;
 import background_process;
 import bg_task;
 import compact_segments_task;
+import rebuild_hnsw_task;
+import merge_fulltext_chunks_task;
+import chunk_index_entry;
 import build_fast_rough_filter_task;
+import cleanup_scanner;
 
 namespace infinity {
 
@@ -205,6 +209,26 @@ Tuple<UniquePtr<String>, Status> TxnTableStore::Delete(const Vector<RowID> &row_
     return {nullptr, Status::OK()};
 }
 
+Tuple<UniquePtr<String>, Status>
+TxnTableStore::Update(const Vector<RowID> &row_ids, const Vector<ColumnID> &column_ids, SharedPtr<DataBlock> values) {
+    UpdateBatch &update_batch = update_state_.batches_.emplace_back();
+    update_batch.column_ids_ = column_ids;
+    update_batch.values_ = std::move(values);
+    for (SizeT i = 0; i < row_ids.size(); ++i) {
+        const RowID &row_id = row_ids[i];
+        BlockID block_id = row_id.segment_offset_ / DEFAULT_BLOCK_CAPACITY;
+        BlockOffset block_offset = row_id.segment_offset_ % DEFAULT_BLOCK_CAPACITY;
+        update_batch.rows_[row_id.segment_id_][block_id].emplace_back(block_offset, i);
+    }
+
+    return {nullptr, Status::OK()};
+}
+
+void TxnTableStore::AddUpdatedColumns(const Vector<ColumnID> &column_ids) {
+    has_update_ = true;
+    updated_columns_.insert(column_ids.begin(), column_ids.end());
+}
+
 Tuple<UniquePtr<String>, Status> TxnTableStore::Compact(Vector<Pair<SharedPtr<SegmentEntry>, Vector<SegmentEntry *>>> &&segment_data,
                                                         CompactSegmentsTaskType type) {
     if (compact_state_.task_type_ != CompactSegmentsTaskType::kInvalid) {
@@ -212,6 +236,11 @@ Tuple<UniquePtr<String>, Status> TxnTableStore::Compact(Vector<Pair<SharedPtr<Se
     }
     compact_state_ = TxnCompactStore(type);
     for (auto &[new_segment, old_segments] : segment_data) {
+        if (new_segment.get() == nullptr) {
+            // the old segments are dropped without a new segment
+            compact_state_.compact_data_.emplace_back(TxnSegmentStore(), std::move(old_segments));
+            continue;
+        }
         auto txn_segment_store = TxnSegmentStore::AddSegmentStore(new_segment.get());
         compact_state_.compact_data_.emplace_back(std::move(txn_segment_store), std::move(old_segments));
 
@@ -237,6 +266,7 @@ void TxnTableStore::Rollback(TransactionID txn_id, TxnTimeStamp abort_ts) {
         Catalog::RemoveIndexEntry(index_name, table_index_entry, txn_id);
     }
     Catalog::RollbackCompact(table_entry_, txn_id, abort_ts, compact_state_);
+    table_entry_->RollbackUpdate(txn_id, update_state_);
     blocks_.clear();
 }
 
@@ -257,6 +287,8 @@ void TxnTableStore::PrepareCommit(TransactionID txn_id, TxnTimeStamp commit_ts,
 
     Catalog::Delete(table_entry_, txn_id, this, commit_ts, delete_state_);
 
+    Catalog::Update(table_entry_, txn_id, this, commit_ts, update_state_);
+
     LOG_TRACE(fmt::format("Transaction local storage table: {}, Complete commit preparing", *table_entry_->GetTableName()));
 }
 
@@ -296,6 +328,24 @@ void TxnTableStore::TryTriggerCompaction(BGTaskProcessor *bg_task_processor, Txn
         auto compact_task = CompactSegmentsTask::MakeTaskWithPickedSegments(table_entry_, std::move(to_compacts), txn);
         bg_task_processor->Submit(std::move(compact_task));
     }
+    for (const auto &[segment_id, delete_map] : delete_state_.rows_) {
+        auto rebuild_task = RebuildHnswTask::MakeTask(table_entry_, segment_id, generate_txn);
+        if (rebuild_task.get() != nullptr) {
+            bg_task_processor->Submit(std::move(rebuild_task));
+        }
+    }
+    for (const auto &[index_name, index_store] : txn_indexes_store_) {
+        HashSet<SegmentIndexEntry *> segment_index_entries;
+        for (auto *chunk_index_entry : index_store->chunk_index_entries_) {
+            segment_index_entries.insert(chunk_index_entry->segment_index_entry_);
+        }
+        for (auto *segment_index_entry : segment_index_entries) {
+            auto merge_task = MergeFulltextChunksTask::MakeTask(table_entry_, index_store->table_index_entry_, segment_index_entry, generate_txn);
+            if (merge_task.get() != nullptr) {
+                bg_task_processor->Submit(std::move(merge_task));
+            }
+        }
+    }
 }
 
 void TxnTableStore::AddSegmentStore(SegmentEntry *segment_entry) {
@@ -334,9 +384,23 @@ void TxnTableStore::AddDeltaOp(CatalogDeltaEntry *local_delta_ops,
         segment_store.AddDeltaOp(local_delta_ops, append_state_.get(), commit_ts);
     }
 
+    // The filters of the blocks filled up in the unsealed segments are built now, so that point lookups can skip them before the
+    // segment is sealed. They are kept in memory and recorded with the segment filter once the segment is sealed.
+    for (const auto &[segment_id, segment_store] : txn_segments_) {
+        SegmentEntry *segment_entry = segment_store.segment_entry_;
+        if (segment_entry->status() != SegmentStatus::kUnsealed ||
+            std::find(set_sealed_segments_.begin(), set_sealed_segments_.end(), segment_entry) != set_sealed_segments_.end()) {
+            continue;
+        }
+        for (auto *block_entry : segment_store.block_entries_) {
+            if (block_entry->row_count() == block_entry->row_capacity()) {
+                BuildFastRoughFilterTask::ExecuteOnFullBlock(segment_entry, block_entry, txn_->buffer_mgr(), commit_ts, txn_->txn_mgr()->zone_map_row_count());
+            }
+        }
+    }
     for (auto *sealed_segment : set_sealed_segments_) {
         // build minmax filter
-        BuildFastRoughFilterTask::ExecuteOnNewSealedSegment(sealed_segment, txn_->buffer_mgr(), commit_ts);
+        BuildFastRoughFilterTask::ExecuteOnNewSealedSegment(sealed_segment, txn_->buffer_mgr(), commit_ts, txn_->txn_mgr()->zone_map_row_count());
         // now have minmax filter and optional bloom filter
         // serialize filter
         if (!sealed_segment->SetSealed()) {
@@ -350,6 +414,19 @@ void TxnTableStore::AddDeltaOp(CatalogDeltaEntry *local_delta_ops,
                 MakeUnique<SetBlockStatusSealedOp>(block_entry.get(), block_entry->GetFastRoughFilter()->SerializeToString(), commit_ts));
         }
     }
+    // The filters of the sealed segments updated in place are recorded as invalidated.
+    for (const auto &update_batch : update_state_.batches_) {
+        for (const auto &[segment_id, block_row_hashmap] : update_batch.rows_) {
+            SegmentEntry *segment_entry = txn_segments_.at(segment_id).segment_entry_;
+            if (segment_entry->status() == SegmentStatus::kUnsealed) {
+                continue;
+            }
+            local_delta_ops->AddOperation(MakeUnique<SetSegmentStatusSealedOp>(segment_entry, String(), commit_ts));
+            for (const auto &[block_id, _] : block_row_hashmap) {
+                local_delta_ops->AddOperation(MakeUnique<SetBlockStatusSealedOp>(segment_entry->GetBlockEntryByID(block_id).get(), String(), commit_ts));
+            }
+        }
+    }
     if (compact_state_.task_type_ != CompactSegmentsTaskType::kInvalid) {
         compact_state_.AddDeltaOp(local_delta_ops, commit_ts);
     }
@@ -414,6 +491,18 @@ void TxnStore::AddDeltaOp(CatalogDeltaEntry *local_delta_ops, BGTaskProcessor *b
     for (const auto &[table_name, table_store] : txn_tables_store_) {
         table_store->AddDeltaOp(local_delta_ops, enable_compaction, bg_task_processor, txn_mgr, commit_ts);
     }
+
+    // The entries this commit makes obsolete are in the databases and tables it changed, the cleanups walk only them.
+    CleanupQueue *cleanup_queue = catalog_->cleanup_queue();
+    for (auto [db_entry, ptr_seq_n] : txn_dbs_vec) {
+        cleanup_queue->Mark(*db_entry->db_name_ptr(), "", commit_ts);
+    }
+    for (auto [table_entry, ptr_seq_n] : txn_tables_vec) {
+        cleanup_queue->Mark(*table_entry->GetDBName(), *table_entry->GetTableName(), commit_ts);
+    }
+    for (const auto &[table_name, table_store] : txn_tables_store_) {
+        cleanup_queue->Mark(*table_store->table_entry_->GetDBName(), table_name, commit_ts);
+    }
 }
 
 void TxnStore::PrepareCommit(TransactionID txn_id, TxnTimeStamp commit_ts, BufferManager *buffer_mgr) {
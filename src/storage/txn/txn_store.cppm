@@ -104,6 +104,16 @@ public:
 
     Tuple<UniquePtr<String>, Status> Delete(const Vector<RowID> &row_ids);
 
+    // The values hold only the updated columns, row i of the values is written to row_ids[i].
+    Tuple<UniquePtr<String>, Status> Update(const Vector<RowID> &row_ids, const Vector<ColumnID> &column_ids, SharedPtr<DataBlock> values);
+
+    // UPDATE appends the rows it deletes again with only these columns changed
+    void AddUpdatedColumns(const Vector<ColumnID> &column_ids);
+
+    // Whether the rows appended by the txn are rows appended again by UPDATE without changing the column.
+    // It is a hint for reusing the analyzed terms of the column, other rows appended by the txn may be counted in.
+    bool ColumnKeptByUpdate(ColumnID column_id) const { return has_update_ and !updated_columns_.contains(column_id); }
+
     Tuple<UniquePtr<String>, Status> Compact(Vector<Pair<SharedPtr<SegmentEntry>, Vector<SegmentEntry *>>> &&segment_data,
                                              CompactSegmentsTaskType type);
 
@@ -144,12 +154,16 @@ private:
 
     TxnCompactStore compact_state_;
 
+    bool has_update_{false};
+    HashSet<ColumnID> updated_columns_{};
+
 public:
     Txn *const txn_{};
     Vector<SharedPtr<DataBlock>> blocks_{};
 
     UniquePtr<AppendState> append_state_{};
     DeleteState delete_state_{};
+    UpdateState update_state_{};
 
     SizeT current_block_id_{0};
 
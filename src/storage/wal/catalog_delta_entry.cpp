@@ -278,6 +278,10 @@ UniquePtr<AddTableEntryOp> AddTableEntryOp::ReadAdv(char *&ptr, char *ptr_end) {
     add_table_op->row_count_ = ReadBufAdv<SizeT>(ptr);
     add_table_op->unsealed_id_ = ReadBufAdv<SegmentID>(ptr);
     add_table_op->next_segment_id_ = ReadBufAdv<SegmentID>(ptr);
+    add_table_op->segment_capacity_ = ReadBufAdv<SizeT>(ptr);
+    add_table_op->sort_column_id_ = ReadBufAdv<ColumnID>(ptr);
+    add_table_op->ttl_column_id_ = ReadBufAdv<ColumnID>(ptr);
+    add_table_op->ttl_seconds_ = ReadBufAdv<u64>(ptr);
     return add_table_op;
 }
 
@@ -421,6 +425,10 @@ void AddTableEntryOp::WriteAdv(char *&buf) const {
     WriteBufAdv(buf, this->row_count_);
     WriteBufAdv(buf, this->unsealed_id_);
     WriteBufAdv(buf, this->next_segment_id_);
+    WriteBufAdv(buf, this->segment_capacity_);
+    WriteBufAdv(buf, this->sort_column_id_);
+    WriteBufAdv(buf, this->ttl_column_id_);
+    WriteBufAdv(buf, this->ttl_seconds_);
 }
 
 void AddSegmentEntryOp::WriteAdv(char *&buf) const {
@@ -530,7 +538,9 @@ const String AddTableEntryOp::ToString() const {
         sstream << fmt::format(" column_def: {}", column_def->ToString());
     }
     sstream << fmt::format(" row_count: {}", row_count_) << fmt::format(" unsealed_id: {}", unsealed_id_)
-            << fmt::format(" next_segment_id: {}", next_segment_id_);
+            << fmt::format(" next_segment_id: {}", next_segment_id_) << fmt::format(" segment_capacity: {}", segment_capacity_)
+            << fmt::format(" sort_column_id: {}", sort_column_id_) << fmt::format(" ttl_column_id: {}", ttl_column_id_)
+            << fmt::format(" ttl_seconds: {}", ttl_seconds_);
     return sstream.str();
 }
 
@@ -644,7 +654,9 @@ bool AddTableEntryOp::operator==(const CatalogDeltaOperation &rhs) const {
     bool res = rhs_op != nullptr && CatalogDeltaOperation::operator==(rhs) && IsEqual(*db_name_, *rhs_op->db_name_) &&
                IsEqual(*table_name_, *rhs_op->table_name_) && IsEqual(*table_entry_dir_, *rhs_op->table_entry_dir_) &&
                table_entry_type_ == rhs_op->table_entry_type_ && row_count_ == rhs_op->row_count_ && unsealed_id_ == rhs_op->unsealed_id_ &&
-               next_segment_id_ == rhs_op->next_segment_id_ && column_defs_.size() == rhs_op->column_defs_.size();
+               next_segment_id_ == rhs_op->next_segment_id_ && segment_capacity_ == rhs_op->segment_capacity_ &&
+               sort_column_id_ == rhs_op->sort_column_id_ && ttl_column_id_ == rhs_op->ttl_column_id_ && ttl_seconds_ == rhs_op->ttl_seconds_ &&
+               column_defs_.size() == rhs_op->column_defs_.size();
     if (!res) {
         return false;
     }
@@ -786,13 +798,28 @@ void AddChunkIndexEntryOp::Merge(UniquePtr<CatalogDeltaOperation> other) {
     *this = std::move(*static_cast<AddChunkIndexEntryOp *>(other.get()));
 }
 
-void SetSegmentStatusSealedOp::Merge(UniquePtr<CatalogDeltaOperation> other) { UnrecoverableError("SetSegmentStatusSealedOp::Merge not allowed"); }
+// An in-place update records the segment again with the filter invalidated, the later one wins.
+void SetSegmentStatusSealedOp::Merge(UniquePtr<CatalogDeltaOperation> other) {
+    if (other->type_ != CatalogDeltaOpType::SET_SEGMENT_STATUS_SEALED) {
+        UnrecoverableError(fmt::format("Merge failed, other type: {}", other->GetTypeStr()));
+    }
+    MergeFlag flag = this->NextDeleteFlag(other->merge_flag_);
+    *this = std::move(*static_cast<SetSegmentStatusSealedOp *>(other.get()));
+    this->merge_flag_ = flag;
+}
 
-void SetBlockStatusSealedOp::Merge(UniquePtr<CatalogDeltaOperation> other) { UnrecoverableError("SetBlockStatusSealedOp::Merge not allowed"); }
+void SetBlockStatusSealedOp::Merge(UniquePtr<CatalogDeltaOperation> other) {
+    if (other->type_ != CatalogDeltaOpType::SET_BLOCK_STATUS_SEALED) {
+        UnrecoverableError(fmt::format("Merge failed, other type: {}", other->GetTypeStr()));
+    }
+    MergeFlag flag = this->NextDeleteFlag(other->merge_flag_);
+    *this = std::move(*static_cast<SetBlockStatusSealedOp *>(other.get()));
+    this->merge_flag_ = flag;
+}
 
-void AddBlockEntryOp::FlushDataToDisk(TxnTimeStamp max_commit_ts) {
+SizeT AddBlockEntryOp::FlushDataToDisk(TxnTimeStamp max_commit_ts) {
     LOG_TRACE(fmt::format("BlockEntry {} flush to disk", block_entry_->block_id()));
-    block_entry_->Flush(max_commit_ts);
+    return block_entry_->Flush(max_commit_ts);
 }
 
 void AddSegmentIndexEntryOp::Flush(TxnTimeStamp max_commit_ts) { segment_index_entry_->Flush(max_commit_ts); }
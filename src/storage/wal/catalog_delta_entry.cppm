@@ -176,7 +176,9 @@ public:
         : CatalogDeltaOperation(CatalogDeltaOpType::ADD_TABLE_ENTRY, table_entry, commit_ts), db_name_(table_entry->GetDBName()),
           table_name_(table_entry->GetTableName()), table_entry_dir_(table_entry->TableEntryDir()), column_defs_(table_entry->column_defs()),
           row_count_(table_entry->row_count()), // TODO: fix it
-          unsealed_id_(table_entry->unsealed_id()), next_segment_id_(table_entry->next_segment_id()) {}
+          unsealed_id_(table_entry->unsealed_id()), next_segment_id_(table_entry->next_segment_id()),
+          segment_capacity_(table_entry->segment_capacity()), sort_column_id_(table_entry->sort_column_id()),
+          ttl_column_id_(table_entry->ttl_column_id()), ttl_seconds_(table_entry->ttl_seconds()) {}
 
     CatalogDeltaOpType GetType() const final { return CatalogDeltaOpType::ADD_TABLE_ENTRY; }
     String GetTypeStr() const final { return "ADD_TABLE_ENTRY"; }
@@ -199,6 +201,10 @@ public:
 
         total_size += sizeof(SizeT);
         total_size += sizeof(SegmentID) * 2;
+        total_size += sizeof(SizeT);
+        total_size += sizeof(ColumnID);
+        total_size += sizeof(ColumnID);
+        total_size += sizeof(u64);
         return total_size;
     }
     void WriteAdv(char *&buf) const final;
@@ -216,6 +222,10 @@ public:
     SizeT row_count_{0};
     SegmentID unsealed_id_{};
     SegmentID next_segment_id_{0};
+    SizeT segment_capacity_{DEFAULT_SEGMENT_CAPACITY};
+    ColumnID sort_column_id_{INVALID_COLUMN_ID};
+    ColumnID ttl_column_id_{INVALID_COLUMN_ID};
+    u64 ttl_seconds_{0};
 };
 
 /// class AddSegmentEntryOp
@@ -308,7 +318,7 @@ public:
     bool operator==(const CatalogDeltaOperation &rhs) const override;
     void Merge(UniquePtr<CatalogDeltaOperation> other) override;
 
-    void FlushDataToDisk(TxnTimeStamp max_commit_ts);
+    SizeT FlushDataToDisk(TxnTimeStamp max_commit_ts);
 
 public:
     BlockEntry *block_entry_{};
@@ -524,7 +534,8 @@ public:
     explicit SetSegmentStatusSealedOp(SegmentEntry *segment_entry, String &&segment_filter_binary_data, TxnTimeStamp commit_ts)
         : CatalogDeltaOperation(CatalogDeltaOpType::SET_SEGMENT_STATUS_SEALED, segment_entry, commit_ts),
           db_name_(segment_entry->GetTableEntry()->GetDBName()), table_name_(segment_entry->GetTableEntry()->GetTableName()),
-          segment_id_(segment_entry->segment_id()), segment_filter_binary_data_(std::move(segment_filter_binary_data)) {}
+          segment_id_(segment_entry->segment_id()), segment_filter_binary_data_(std::move(segment_filter_binary_data)),
+          segment_entry_(segment_entry) {}
 
     CatalogDeltaOpType GetType() const final { return CatalogDeltaOpType::SET_SEGMENT_STATUS_SEALED; }
     String GetTypeStr() const final { return "SET_SEGMENT_STATUS_SEALED"; }
@@ -548,6 +559,9 @@ public:
     SegmentID segment_id_{};
     // following data include: 1. minmax filter for all valid columns 2. bloom filter for selected columns
     String segment_filter_binary_data_{};
+
+    // not serialized, null when replayed. The segment is offloaded after its blocks are flushed.
+    SegmentEntry *segment_entry_{};
 };
 
 // used when a segment is sealed (import, append, compact)
@@ -58,9 +58,9 @@ Optional<Pair<FullCatalogFileInfo, Vector<DeltaCatalogFileInfo>>> CatalogFile::P
     return res;
 }
 
-String CatalogFile::FullCheckpoingFilename(TxnTimeStamp max_commit_ts) { return fmt::format("FULL.{}.json", max_commit_ts); }
+String CatalogFile::FullCheckpoingFilename(TxnTimeStamp max_commit_ts) { return fmt::format("FULL.{}.bin", max_commit_ts); }
 
-String CatalogFile::TempFullCheckpointFilename(TxnTimeStamp max_commit_ts) { return fmt::format("_FULL.{}.json", max_commit_ts); }
+String CatalogFile::TempFullCheckpointFilename(TxnTimeStamp max_commit_ts) { return fmt::format("_FULL.{}.bin", max_commit_ts); }
 
 String CatalogFile::DeltaCheckpointFilename(TxnTimeStamp max_commit_ts) { return fmt::format("DELTA.{}", max_commit_ts); }
 
@@ -109,7 +109,8 @@ Pair<Vector<FullCatalogFileInfo>, Vector<DeltaCatalogFileInfo>> CatalogFile::Par
             continue;
         }
         auto suffix = filename.substr(dot_pos + 1);
-        if (IsEqual(suffix, String("json"))) {
+        // .json for the full catalogs written before the binary format
+        if (IsEqual(suffix, String("bin")) || IsEqual(suffix, String("json"))) {
             if (dot_pos == 0) {
                 LOG_WARN(fmt::format("Catalog file {} has wrong file name", entry->path().string()));
                 continue;
@@ -15,6 +15,7 @@
 module;
 
 #include <fstream>
+#include <lz4.h>
 #include <vector>
 
 module wal_entry;
@@ -201,6 +202,21 @@ SharedPtr<WalCmd> WalCmd::ReadAdv(char *&ptr, i32 max_bytes) {
             cmd = MakeShared<WalCmdAppend>(db_name, table_name, block);
             break;
         }
+        case WalCommandType::APPEND_LZ4: {
+            String db_name = ReadBufAdv<String>(ptr);
+            String table_name = ReadBufAdv<String>(ptr);
+            i32 block_size = ReadBufAdv<i32>(ptr);
+            String compressed_block = ReadBufAdv<String>(ptr);
+            Vector<char> block_buf(block_size);
+            i32 decompressed_size = LZ4_decompress_safe(compressed_block.data(), block_buf.data(), compressed_block.size(), block_size);
+            if (decompressed_size != block_size) {
+                UnrecoverableError(fmt::format("Failed to decompress the appended block of {}.{} in wal", db_name, table_name));
+            }
+            char *block_ptr = block_buf.data();
+            SharedPtr<DataBlock> block = DataBlock::ReadAdv(block_ptr, block_size);
+            cmd = MakeShared<WalCmdAppend>(db_name, table_name, block);
+            break;
+        }
         case WalCommandType::DELETE: {
             String db_name = ReadBufAdv<String>(ptr);
             String table_name = ReadBufAdv<String>(ptr);
@@ -213,6 +229,23 @@ SharedPtr<WalCmd> WalCmd::ReadAdv(char *&ptr, i32 max_bytes) {
             cmd = MakeShared<WalCmdDelete>(db_name, table_name, row_ids);
             break;
         }
+        case WalCommandType::UPDATE: {
+            String db_name = ReadBufAdv<String>(ptr);
+            String table_name = ReadBufAdv<String>(ptr);
+            i32 row_cnt = ReadBufAdv<i32>(ptr);
+            Vector<RowID> row_ids;
+            for (i32 i = 0; i < row_cnt; ++i) {
+                row_ids.push_back(ReadBufAdv<RowID>(ptr));
+            }
+            i32 column_cnt = ReadBufAdv<i32>(ptr);
+            Vector<ColumnID> column_ids;
+            for (i32 i = 0; i < column_cnt; ++i) {
+                column_ids.push_back(ReadBufAdv<ColumnID>(ptr));
+            }
+            SharedPtr<DataBlock> block = DataBlock::ReadAdv(ptr, ptr_end - ptr);
+            cmd = MakeShared<WalCmdUpdate>(db_name, table_name, row_ids, column_ids, block);
+            break;
+        }
         case WalCommandType::SET_SEGMENT_STATUS_SEALED: {
             String db_name = ReadBufAdv<String>(ptr);
             String table_name = ReadBufAdv<String>(ptr);
@@ -333,6 +366,15 @@ bool WalCmdAppend::operator==(const WalCmd &other) const {
     return true;
 }
 
+bool WalCmdUpdate::operator==(const WalCmd &other) const {
+    auto other_cmd = dynamic_cast<const WalCmdUpdate *>(&other);
+    if (other_cmd == nullptr || !IsEqual(db_name_, other_cmd->db_name_) || !IsEqual(table_name_, other_cmd->table_name_) ||
+        row_ids_ != other_cmd->row_ids_ || column_ids_ != other_cmd->column_ids_) {
+        return false;
+    }
+    return true;
+}
+
 bool WalCmdDelete::operator==(const WalCmd &other) const {
     auto other_cmd = dynamic_cast<const WalCmdDelete *>(&other);
     if (other_cmd == nullptr || !IsEqual(db_name_, other_cmd->db_name_) || !IsEqual(table_name_, other_cmd->table_name_) ||
@@ -420,6 +462,10 @@ i32 WalCmdImport::GetSizeInBytes() const {
 }
 
 i32 WalCmdAppend::GetSizeInBytes() const {
+    if (!compressed_block_.empty()) {
+        return sizeof(WalCommandType) + sizeof(i32) + this->db_name_.size() + sizeof(i32) + this->table_name_.size() + sizeof(i32) + sizeof(i32) +
+               compressed_block_.size();
+    }
     return sizeof(WalCommandType) + sizeof(i32) + this->db_name_.size() + sizeof(i32) + this->table_name_.size() + block_->GetSizeInBytes();
 }
 
@@ -428,6 +474,11 @@ i32 WalCmdDelete::GetSizeInBytes() const {
            row_ids_.size() * sizeof(RowID);
 }
 
+i32 WalCmdUpdate::GetSizeInBytes() const {
+    return sizeof(WalCommandType) + sizeof(i32) + this->db_name_.size() + sizeof(i32) + this->table_name_.size() + sizeof(i32) +
+           row_ids_.size() * sizeof(RowID) + sizeof(i32) + column_ids_.size() * sizeof(ColumnID) + block_->GetSizeInBytes();
+}
+
 i32 WalCmdSetSegmentStatusSealed::GetSizeInBytes() const {
     i32 sz = sizeof(WalCommandType) + ::infinity::GetSizeInBytes(db_name_) + ::infinity::GetSizeInBytes(table_name_) +
              ::infinity::GetSizeInBytes(segment_id_) + ::infinity::GetSizeInBytes(segment_filter_binary_data_);
@@ -505,12 +556,44 @@ void WalCmdImport::WriteAdv(char *&buf) const {
 }
 
 void WalCmdAppend::WriteAdv(char *&buf) const {
+    if (!compressed_block_.empty()) {
+        WriteBufAdv(buf, WalCommandType::APPEND_LZ4);
+        WriteBufAdv(buf, this->db_name_);
+        WriteBufAdv(buf, this->table_name_);
+        WriteBufAdv(buf, this->block_size_);
+        WriteBufAdv(buf, this->compressed_block_);
+        return;
+    }
     WriteBufAdv(buf, WalCommandType::APPEND);
     WriteBufAdv(buf, this->db_name_);
     WriteBufAdv(buf, this->table_name_);
     block_->WriteAdv(buf);
 }
 
+void WalCmdAppend::Compress(SizeT threshold) {
+    if (threshold == 0 || !compressed_block_.empty()) {
+        return;
+    }
+    i32 exp_size = block_->GetSizeInBytes();
+    if (SizeT(exp_size) < threshold) {
+        return;
+    }
+    Vector<char> block_buf(exp_size);
+    char *ptr = block_buf.data();
+    block_->WriteAdv(ptr);
+    i32 block_size = ptr - block_buf.data();
+
+    String compressed_block(LZ4_compressBound(block_size), '\0');
+    i32 compressed_size = LZ4_compress_default(block_buf.data(), compressed_block.data(), block_size, compressed_block.size());
+    if (compressed_size <= 0 || compressed_size >= block_size) {
+        // e.g. random embeddings, keep them plain
+        return;
+    }
+    compressed_block.resize(compressed_size);
+    compressed_block_ = std::move(compressed_block);
+    block_size_ = block_size;
+}
+
 void WalCmdDelete::WriteAdv(char *&buf) const {
     WriteBufAdv(buf, WalCommandType::DELETE);
     WriteBufAdv(buf, this->db_name_);
@@ -523,6 +606,21 @@ void WalCmdDelete::WriteAdv(char *&buf) const {
     }
 }
 
+void WalCmdUpdate::WriteAdv(char *&buf) const {
+    WriteBufAdv(buf, WalCommandType::UPDATE);
+    WriteBufAdv(buf, this->db_name_);
+    WriteBufAdv(buf, this->table_name_);
+    WriteBufAdv(buf, static_cast<i32>(this->row_ids_.size()));
+    for (const auto &row_id : this->row_ids_) {
+        WriteBufAdv(buf, row_id);
+    }
+    WriteBufAdv(buf, static_cast<i32>(this->column_ids_.size()));
+    for (ColumnID column_id : this->column_ids_) {
+        WriteBufAdv(buf, column_id);
+    }
+    block_->WriteAdv(buf);
+}
+
 void WalCmdSetSegmentStatusSealed::WriteAdv(char *&buf) const {
     WriteBufAdv(buf, WalCommandType::SET_SEGMENT_STATUS_SEALED);
     WriteBufAdv(buf, this->db_name_);
@@ -672,6 +770,14 @@ SharedPtr<WalEntry> WalEntry::ReadAdv(char *&ptr, i32 max_bytes) {
     return entry;
 }
 
+void WalEntry::Compress(SizeT threshold) {
+    for (const auto &cmd : cmds_) {
+        if (cmd->GetType() == WalCommandType::APPEND) {
+            static_cast<WalCmdAppend *>(cmd.get())->Compress(threshold);
+        }
+    }
+}
+
 bool WalEntry::IsCheckPoint(Vector<SharedPtr<WalEntry>> replay_entries, WalCmdCheckpoint *&checkpoint_cmd) const {
     auto iter = cmds_.begin();
     while (iter != cmds_.end()) {
@@ -729,6 +835,21 @@ String WalEntry::ToString() const {
                 ss << row_id.ToString() << " ";
             }
             ss << std::endl;
+        } else if (cmd->GetType() == WalCommandType::UPDATE) {
+            auto update_cmd = dynamic_cast<const WalCmdUpdate *>(cmd.get());
+            ss << "db name: " << update_cmd->db_name_ << std::endl;
+            ss << "table name: " << update_cmd->table_name_ << std::endl;
+            ss << "row ids: ";
+            for (const auto &row_id : update_cmd->row_ids_) {
+                ss << row_id.ToString() << " ";
+            }
+            ss << std::endl;
+            ss << "column ids: ";
+            for (ColumnID column_id : update_cmd->column_ids_) {
+                ss << column_id << " ";
+            }
+            ss << std::endl;
+            ss << update_cmd->block_->ToString();
         } else if (cmd->GetType() == WalCommandType::CREATE_INDEX) {
             auto create_index_cmd = dynamic_cast<const WalCmdCreateIndex *>(cmd.get());
             ss << "db name: " << create_index_cmd->db_name_ << std::endl;
@@ -780,6 +901,9 @@ String WalCmd::WalCommandTypeToString(WalCommandType type) {
         case WalCommandType::DELETE:
             command = "DELETE";
             break;
+        case WalCommandType::UPDATE:
+            command = "UPDATE";
+            break;
         case WalCommandType::SET_SEGMENT_STATUS_SEALED:
             command = "SET_SEGMENT_STATUS_SEALED";
             break;
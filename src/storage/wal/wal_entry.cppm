@@ -51,6 +51,8 @@ export enum class WalCommandType : i8 {
     IMPORT = 20,
     APPEND = 21,
     DELETE = 22,
+    APPEND_LZ4 = 23, // APPEND with the block compressed, only in the wal file
+    UPDATE = 24,     // fixed-width columns updated in place
 
     // -----------------------------
     // SEGMENT STATUS
@@ -244,9 +246,16 @@ export struct WalCmdAppend : public WalCmd {
     [[nodiscard]] i32 GetSizeInBytes() const override;
     void WriteAdv(char *&buf) const override;
 
+    // Compress the serialized block with LZ4 if it has at least threshold bytes, 0 to disable.
+    // Called on the committing thread, so the flush thread only copies the compressed bytes.
+    void Compress(SizeT threshold);
+
     String db_name_{};
     String table_name_{};
     SharedPtr<DataBlock> block_{};
+
+    String compressed_block_{}; // empty if the block isn't compressed
+    i32 block_size_{};          // serialized size of the compressed block
 };
 
 export struct WalCmdDelete : public WalCmd {
@@ -263,6 +272,22 @@ export struct WalCmdDelete : public WalCmd {
     Vector<RowID> row_ids_{};
 };
 
+export struct WalCmdUpdate : public WalCmd {
+    WalCmdUpdate(String db_name, String table_name, const Vector<RowID> &row_ids, const Vector<ColumnID> &column_ids, const SharedPtr<DataBlock> &block)
+        : db_name_(std::move(db_name)), table_name_(std::move(table_name)), row_ids_(row_ids), column_ids_(column_ids), block_(block) {}
+
+    WalCommandType GetType() override { return WalCommandType::UPDATE; }
+    bool operator==(const WalCmd &other) const override;
+    [[nodiscard]] i32 GetSizeInBytes() const override;
+    void WriteAdv(char *&buf) const override;
+
+    String db_name_{};
+    String table_name_{};
+    Vector<RowID> row_ids_{};
+    Vector<ColumnID> column_ids_{};
+    SharedPtr<DataBlock> block_{}; // the new values of column_ids_, row i for row_ids_[i]
+};
+
 // used when append op turn an old unsealed segment full and sealed
 // will always have necessary minmax filter
 // may have user-defined bloom filter
@@ -380,6 +405,9 @@ export struct WalEntry : WalEntryHeader {
     // Read from a serialized version
     static SharedPtr<WalEntry> ReadAdv(char *&ptr, i32 max_bytes);
 
+    // Compress the large blocks of the append commands, see WalCmdAppend::Compress
+    void Compress(SizeT threshold);
+
     Vector<SharedPtr<WalCmd>> cmds_{};
 
     [[nodiscard]] bool IsCheckPoint(Vector<SharedPtr<WalEntry>> replay_entries, WalCmdCheckpoint *&checkpoint_cmd) const;
@@ -58,16 +58,27 @@ public:
         full_cv_.notify_one();
     }
 
-    void DequeueBulk(Deque<WalEntry*> &output_array) {
+    // Dequeue at most max_count entries, 0 for no limit. When fewer are queued, wait up to max_wait for more so that they are
+    // written and synced as one batch.
+    void DequeueBulk(Deque<WalEntry*> &output_array, SizeT max_count = 0, std::chrono::microseconds max_wait = std::chrono::microseconds(0)) {
         std::unique_lock<std::mutex> lock(queue_mutex_);
         empty_cv_.wait(lock, [this] {
             return !queue_.empty();
         });
+        auto batch_full = [&] { return (max_count > 0 && queue_.size() >= max_count) || queue_.back() == nullptr; };
+        if (max_wait.count() > 0 && !batch_full()) {
+            empty_cv_.wait_for(lock, max_wait, batch_full);
+        }
 
-        output_array.swap(queue_);
-//        output_array.insert(output_array.end(), queue_.begin(), queue_.end());
-        queue_.clear();
-        full_cv_.notify_one();
+        if (max_count == 0 || queue_.size() <= max_count) {
+            output_array.swap(queue_);
+//            output_array.insert(output_array.end(), queue_.begin(), queue_.end());
+            queue_.clear();
+        } else {
+            output_array.insert(output_array.end(), queue_.begin(), queue_.begin() + max_count);
+            queue_.erase(queue_.begin(), queue_.begin() + max_count);
+        }
+        full_cv_.notify_all();
     }
 
     [[nodiscard]] SizeT Size() const {
@@ -52,14 +52,67 @@ import table_index_entry;
 import log_file;
 import default_values;
 import defer_op;
+import engine_metrics;
+import buffer_manager;
+import file_system;
+import file_system_type;
+import io_stats;
+import trace_span;
 
 module wal_manager;
 
 namespace infinity {
 
-WalManager::WalManager(Storage *storage, String wal_dir, u64 wal_size_threshold, u64 delta_checkpoint_interval_wal_bytes, FlushOption flush_option)
-    : cfg_wal_size_threshold_(wal_size_threshold), cfg_delta_checkpoint_interval_wal_bytes_(delta_checkpoint_interval_wal_bytes), wal_dir_(wal_dir),
-      wal_path_(wal_dir + "/" + WalFile::TempWalFilename()), storage_(storage), running_(false), flush_option_(flush_option), last_ckp_wal_size_(0),
+namespace {
+
+// The table of a command changing only the data of one table, which is replayed in order with the other commands of the table only
+bool ReplayTableOf(WalCmd *cmd, Pair<String, String> &table) {
+    switch (cmd->GetType()) {
+        case WalCommandType::IMPORT: {
+            auto *import_cmd = static_cast<WalCmdImport *>(cmd);
+            table = {import_cmd->db_name_, import_cmd->table_name_};
+            return true;
+        }
+        case WalCommandType::APPEND: {
+            auto *append_cmd = static_cast<WalCmdAppend *>(cmd);
+            table = {append_cmd->db_name_, append_cmd->table_name_};
+            return true;
+        }
+        case WalCommandType::DELETE: {
+            auto *delete_cmd = static_cast<WalCmdDelete *>(cmd);
+            table = {delete_cmd->db_name_, delete_cmd->table_name_};
+            return true;
+        }
+        case WalCommandType::UPDATE: {
+            auto *update_cmd = static_cast<WalCmdUpdate *>(cmd);
+            table = {update_cmd->db_name_, update_cmd->table_name_};
+            return true;
+        }
+        case WalCommandType::COMPACT: {
+            auto *compact_cmd = static_cast<WalCmdCompact *>(cmd);
+            table = {compact_cmd->db_name_, compact_cmd->table_name_};
+            return true;
+        }
+        default: {
+            return false;
+        }
+    }
+}
+
+} // namespace
+
+WalManager::WalManager(Storage *storage,
+                       String wal_dir,
+                       u64 wal_size_threshold,
+                       u64 delta_checkpoint_interval_wal_bytes,
+                       FlushOption flush_option,
+                       u64 group_commit_max_entries,
+                       u64 group_commit_latency_us,
+                       u64 compress_threshold)
+    : cfg_wal_size_threshold_(wal_size_threshold), cfg_delta_checkpoint_interval_wal_bytes_(delta_checkpoint_interval_wal_bytes),
+      cfg_compress_threshold_(compress_threshold), wal_dir_(wal_dir),
+      wal_path_(wal_dir + "/" + WalFile::TempWalFilename()), storage_(storage), running_(false), flush_option_(flush_option),
+      group_commit_max_entries_(group_commit_max_entries), group_commit_latency_(group_commit_latency_us), last_ckp_wal_size_(0),
       checkpoint_in_progress_(false), last_ckp_ts_(UNCOMMIT_TS), last_full_ckp_ts_(UNCOMMIT_TS) {}
 
 WalManager::~WalManager() {
@@ -79,13 +132,13 @@ void WalManager::Start() {
         fs.CreateDirectory(wal_dir_);
     }
     // TODO: recovery from wal checkpoint
-    ofs_ = std::ofstream(wal_path_, std::ios::app | std::ios::binary);
-    if (!ofs_.is_open()) {
-        UnrecoverableError(fmt::format("Failed to open wal file: {}", wal_path_));
-    }
+    wal_file_ = fs.OpenFile(wal_path_, FileFlags::WRITE_FLAG | FileFlags::CREATE_FLAG | FileFlags::APPEND_FLAG, FileLockType::kNoLock);
     LOG_INFO(fmt::format("Open wal file: {}", wal_path_));
 
     wal_size_ = 0;
+    sync_stopped_ = false;
+    last_sync_time_ = std::chrono::steady_clock::now();
+    sync_thread_ = Thread([this] { SyncLoop(); });
     flush_thread_ = Thread([this] { Flush(); });
     // checkpoint_thread_ = Thread([this] { CheckpointTimer(); });
     LOG_INFO("WAL manager is started.");
@@ -112,8 +165,11 @@ void WalManager::Stop() {
     // Wait for flush thread to stop
     LOG_TRACE("WalManager::Stop flush thread join");
     flush_thread_.join();
+    // The flush thread has waited for the last batch and stopped the sync thread
+    sync_thread_.join();
 
-    ofs_.close();
+    wal_file_->Close();
+    wal_file_.reset();
     LOG_INFO("WAL manager is stopped.");
 }
 
@@ -148,12 +204,15 @@ void WalManager::Flush() {
 
     Deque<WalEntry *> log_batch{};
     while (running_.load()) {
-        blocking_queue_.DequeueBulk(log_batch);
+        blocking_queue_.DequeueBulk(log_batch, group_commit_max_entries_, group_commit_latency_);
         if (log_batch.empty()) {
             LOG_WARN("WalManager::Dequeue empty batch logs");
             continue;
         }
-        // auto [max_commit_ts, wal_size] = GetWalState();
+        // Serialize the batch while the previous one is still being synced
+        wal_buf_.clear();
+        TxnTimeStamp max_commit_ts = max_commit_ts_;
+        TxnTimeStamp checkpoint_ts = 0;
         for (const auto &entry : log_batch) {
             // Empty WalEntry (read-only transactions) shouldn't go into WalManager.
             if (entry == nullptr) {
@@ -165,55 +224,36 @@ void WalManager::Flush() {
                 UnrecoverableError(fmt::format("WalEntry of txn_id {} commands is empty", entry->txn_id_));
             }
             i32 exp_size = entry->GetSizeInBytes();
-            Vector<char> buf(exp_size);
-            char *ptr = buf.data();
+            SizeT offset = wal_buf_.size();
+            wal_buf_.resize(offset + exp_size);
+            char *ptr = wal_buf_.data() + offset;
             entry->WriteAdv(ptr);
-            i32 act_size = ptr - buf.data();
+            i32 act_size = ptr - (wal_buf_.data() + offset);
             if (exp_size != act_size) {
                 UnrecoverableError(fmt::format("WalManager::Flush WalEntry estimated size {} differ with the actual one {}", exp_size, act_size));
             }
-            ofs_.write(buf.data(), ptr - buf.data());
-            LOG_TRACE(fmt::format("WalManager::Flush done writing wal for txn_id {}, commit_ts {}", entry->txn_id_, entry->commit_ts_));
-
-            // update
-            max_commit_ts_ = entry->commit_ts_;
-            wal_size_ += act_size;
+            LOG_TRACE(fmt::format("WalManager::Flush done serializing wal for txn_id {}, commit_ts {}", entry->txn_id_, entry->commit_ts_));
+            max_commit_ts = entry->commit_ts_;
+            for (const auto &cmd : entry->cmds_) {
+                if (cmd->GetType() == WalCommandType::CHECKPOINT) {
+                    checkpoint_ts = entry->commit_ts_;
+                }
+            }
         }
 
         if (!running_.load()) {
             break;
         }
 
-        switch (flush_option_) {
-            case FlushOption::kFlushAtOnce: {
-                ofs_.flush();
-                break;
-            }
-            case FlushOption::kOnlyWrite: {
-                ofs_.flush(); // FIXME: not flush, only write
-                break;
-            }
-            case FlushOption::kFlushPerSecond: {
-                ofs_.flush(); // FIXME: not flush, flush per second
-                break;
-            }
-        }
-
-        TxnManager *txn_mgr = storage_->txn_manager();
-        // Commit sequentially so they get visible in the same order with wal.
-        for (const auto &entry : log_batch) {
-            Txn *txn = txn_mgr->GetTxn(entry->txn_id_);
-            if (txn != nullptr) {
-                txn->CommitBottom();
-            }
-        }
-        log_batch.clear();
+        // The previous batch is synced and committed after this, so the wal file can be swapped.
+        WaitForSync();
 
         // Check if the wal file is too large, swap to a new one.
         try {
             LocalFileSystem fs;
             auto file_size = fs.GetFileSizeByPath(wal_path_);
             if (file_size > cfg_wal_size_threshold_) {
+                std::lock_guard wal_file_lock(wal_file_mutex_);
                 this->SwapWalFile(max_commit_ts_);
             }
         } catch (RecoverableException &e) {
@@ -232,11 +272,112 @@ void WalManager::Flush() {
                 LOG_TRACE("Skip delta checkpoint(size) because there is already a checkpoint task running.");
             }
         }
+
+        auto write_begin = std::chrono::steady_clock::now();
+        {
+            std::lock_guard wal_file_lock(wal_file_mutex_);
+            WriteWalFile(wal_buf_.data(), wal_buf_.size());
+            // update
+            max_commit_ts_ = max_commit_ts;
+        }
+        if (checkpoint_ts != 0) {
+            checkpoint_entry_ts_.store(checkpoint_ts);
+        }
+        EngineMetrics::instance().wal_batch_size_.Observe(log_batch.size());
+        wal_size_ += wal_buf_.size();
+
+        // Commit the batch on the sync thread, log_batch gets the emptied previous batch back.
+        SubmitSync(log_batch, max_commit_ts, write_begin);
         LOG_TRACE("WAL flush is finished.");
     }
+
+    WaitForSync();
+    {
+        std::lock_guard lock(sync_mutex_);
+        sync_stopped_ = true;
+    }
+    sync_cv_.notify_all();
     LOG_TRACE("WalManager::Flush mainloop end");
 }
 
+void WalManager::WriteWalFile(const char *data, SizeT size) {
+    IOPurposeScope io_purpose_scope(IOPurpose::kWal);
+    TraceSpan write_span("wal", "write", size);
+    LocalFileSystem fs;
+    while (size > 0) {
+        i64 written = fs.Write(*wal_file_, data, size);
+        data += written;
+        size -= written;
+    }
+}
+
+void WalManager::SubmitSync(Deque<WalEntry *> &log_batch, TxnTimeStamp max_commit_ts, std::chrono::steady_clock::time_point write_begin) {
+    {
+        std::lock_guard lock(sync_mutex_);
+        sync_batch_.swap(log_batch);
+        sync_max_commit_ts_ = max_commit_ts;
+        sync_write_begin_ = write_begin;
+        sync_pending_ = true;
+    }
+    sync_cv_.notify_all();
+}
+
+void WalManager::WaitForSync() {
+    std::unique_lock lock(sync_mutex_);
+    sync_cv_.wait(lock, [this] { return !sync_pending_; });
+}
+
+void WalManager::SyncLoop() {
+    LOG_TRACE("WalManager::SyncLoop mainloop begin");
+    std::unique_lock lock(sync_mutex_);
+    while (true) {
+        sync_cv_.wait(lock, [this] { return sync_pending_ || sync_stopped_; });
+        if (!sync_pending_) {
+            break;
+        }
+        lock.unlock();
+
+        bool do_sync = false;
+        switch (flush_option_) {
+            case FlushOption::kFlushAtOnce: {
+                do_sync = true;
+                break;
+            }
+            case FlushOption::kOnlyWrite: {
+                break;
+            }
+            case FlushOption::kFlushPerSecond: {
+                do_sync = std::chrono::steady_clock::now() - last_sync_time_ >= std::chrono::seconds(1);
+                break;
+            }
+        }
+        if (do_sync) {
+            TraceSpan sync_span("wal", "sync", sync_batch_.size());
+            LocalFileSystem fs;
+            fs.SyncFile(*wal_file_);
+            last_sync_time_ = std::chrono::steady_clock::now();
+        }
+        auto flush_duration = std::chrono::steady_clock::now() - sync_write_begin_;
+        EngineMetrics::instance().wal_flush_duration_us_.Observe(std::chrono::duration_cast<MicroSeconds>(flush_duration).count());
+        durable_commit_ts_.store(sync_max_commit_ts_);
+
+        TxnManager *txn_mgr = storage_->txn_manager();
+        // Commit sequentially so they get visible in the same order with wal.
+        for (const auto &entry : sync_batch_) {
+            Txn *txn = txn_mgr->GetTxn(entry->txn_id_);
+            if (txn != nullptr) {
+                txn->CommitBottom();
+            }
+        }
+        sync_batch_.clear();
+
+        lock.lock();
+        sync_pending_ = false;
+        sync_cv_.notify_all();
+    }
+    LOG_TRACE("WalManager::SyncLoop mainloop end");
+}
+
 bool WalManager::TrySubmitCheckpointTask(SharedPtr<CheckpointTaskBase> ckp_task) {
     bool expect = false;
     if (checkpoint_in_progress_.compare_exchange_strong(expect, true)) {
@@ -296,9 +437,12 @@ void WalManager::CheckpointInner(bool is_full_checkpoint, Txn *txn, TxnTimeStamp
                              txn->BeginTS(),
                              max_commit_ts));
 
+        auto checkpoint_begin = std::chrono::steady_clock::now();
         if (!txn->Checkpoint(max_commit_ts, is_full_checkpoint)) {
             return;
         }
+        auto checkpoint_duration = std::chrono::steady_clock::now() - checkpoint_begin;
+        EngineMetrics::instance().checkpoint_duration_us_.Observe(std::chrono::duration_cast<MicroSeconds>(checkpoint_duration).count());
         SetLastCkpWalSize(wal_size);
 
         LOG_INFO(fmt::format("{} Checkpoint is done for commit_ts <= {}", is_full_checkpoint ? "FULL" : "DELTA", max_commit_ts));
@@ -309,6 +453,9 @@ void WalManager::CheckpointInner(bool is_full_checkpoint, Txn *txn, TxnTimeStamp
         throw e;
     }
     last_ckp_ts_ = max_commit_ts;
+    if (recycled_ts_.load() < max_commit_ts) {
+        recycled_ts_.store(max_commit_ts);
+    }
     WalFile::RecycleWalFile(max_commit_ts, wal_dir_);
     if (is_full_checkpoint) {
         last_full_ckp_ts_ = max_commit_ts;
@@ -327,8 +474,9 @@ void WalManager::CheckpointInner(bool is_full_checkpoint, Txn *txn, TxnTimeStamp
  * current wal file.
  */
 void WalManager::SwapWalFile(const TxnTimeStamp max_commit_ts) {
-    if (ofs_.is_open()) {
-        ofs_.close();
+    if (wal_file_.get() != nullptr) {
+        wal_file_->Close();
+        wal_file_.reset();
     }
 
     String new_file_path = fmt::format("{}/{}", wal_dir_, WalFile::WalFilename(max_commit_ts));
@@ -339,13 +487,94 @@ void WalManager::SwapWalFile(const TxnTimeStamp max_commit_ts) {
     fs.Rename(wal_path_, new_file_path);
 
     // Create a new wal file with the original name.
-    ofs_ = std::ofstream(wal_path_, std::ios::app | std::ios::binary);
-    if (!ofs_.is_open()) {
-        UnrecoverableError(fmt::format("Failed to open wal file: {}", wal_path_));
-    }
+    wal_file_ = fs.OpenFile(wal_path_, FileFlags::WRITE_FLAG | FileFlags::CREATE_FLAG | FileFlags::APPEND_FLAG, FileLockType::kNoLock);
     LOG_INFO(fmt::format("Open new wal file {}", wal_path_));
 }
 
+bool WalManager::ReadEntriesFrom(TxnTimeStamp from_ts, SizeT max_bytes, String &entries) {
+    TxnTimeStamp durable_ts = DurableCommitTS();
+    TxnTimeStamp recycled_ts = recycled_ts_.load();
+
+    // The files are opened under the lock of the writes, so the bytes up to their sizes are whole entries. An opened file is still
+    // read after it is renamed by a swap or removed by a recycle.
+    Vector<Pair<std::ifstream, i64>> wal_files; // the newest first
+    {
+        std::lock_guard wal_file_lock(wal_file_mutex_);
+        auto [temp_wal_info, wal_infos] = WalFile::ParseWalFilenames(wal_dir_);
+        std::sort(wal_infos.begin(), wal_infos.end(), [](const WalFileInfo &a, const WalFileInfo &b) {
+            return a.max_commit_ts_ > b.max_commit_ts_;
+        });
+        Vector<String> wal_paths;
+        if (temp_wal_info.has_value()) {
+            wal_paths.push_back(temp_wal_info->path_);
+        }
+        for (const auto &wal_info : wal_infos) {
+            wal_paths.push_back(wal_info.path_);
+        }
+        for (const auto &wal_path : wal_paths) {
+            std::ifstream ifs(wal_path.c_str(), std::ios::binary | std::ios::ate);
+            if (!ifs.is_open()) {
+                break;
+            }
+            i64 file_size = ifs.tellg();
+            wal_files.emplace_back(std::move(ifs), file_size);
+        }
+    }
+
+    // Walk back from the end of the newest file by the size after each entry, until the entry before from_ts.
+    struct EntryPosition {
+        SizeT file_idx_{};
+        i64 offset_{};
+        i32 size_{};
+        TxnTimeStamp commit_ts_{};
+    };
+    Vector<EntryPosition> positions;
+    bool reached = false;
+    for (SizeT file_idx = 0; file_idx < wal_files.size() && !reached; ++file_idx) {
+        auto &[ifs, end] = wal_files[file_idx];
+        while (end >= i64(sizeof(WalEntryHeader) + sizeof(i32))) {
+            i32 entry_size = 0;
+            ifs.seekg(end - sizeof(i32));
+            ifs.read(reinterpret_cast<char *>(&entry_size), sizeof(i32));
+            if (!ifs || entry_size < i32(sizeof(WalEntryHeader)) || entry_size > end) {
+                break;
+            }
+            WalEntryHeader header;
+            ifs.seekg(end - entry_size);
+            ifs.read(reinterpret_cast<char *>(&header), sizeof(WalEntryHeader));
+            if (!ifs) {
+                break;
+            }
+            if (header.commit_ts_ < from_ts) {
+                reached = true;
+                break;
+            }
+            if (header.commit_ts_ <= durable_ts) {
+                positions.push_back({file_idx, end - entry_size, entry_size, header.commit_ts_});
+            }
+            end -= entry_size;
+        }
+    }
+    if (!reached && from_ts <= recycled_ts && (positions.empty() || positions.back().commit_ts_ != from_ts)) {
+        return false;
+    }
+
+    SizeT read_bytes = 0;
+    for (auto iter = positions.rbegin(); iter != positions.rend() && (read_bytes == 0 || read_bytes + iter->size_ <= max_bytes); ++iter) {
+        std::ifstream &ifs = wal_files[iter->file_idx_].first;
+        SizeT offset = entries.size();
+        entries.resize(offset + iter->size_);
+        ifs.seekg(iter->offset_);
+        ifs.read(entries.data() + offset, iter->size_);
+        if (!ifs) {
+            entries.resize(offset);
+            break;
+        }
+        read_bytes += iter->size_;
+    }
+    return true;
+}
+
 /*****************************************************************************
  * REPLAY WAL FILE
  *****************************************************************************/
@@ -437,6 +666,7 @@ i64 WalManager::ReplayWalFile() {
                 max_commit_ts = checkpoint_cmd->max_commit_ts_;
                 catalog_dir = Path(checkpoint_cmd->catalog_path_).parent_path().string();
                 system_start_ts = wal_entry->commit_ts_;
+                checkpoint_entry_ts_.store(wal_entry->commit_ts_);
                 break;
             }
             replay_entries.push_back(wal_entry);
@@ -472,22 +702,43 @@ i64 WalManager::ReplayWalFile() {
     }
     auto &[full_catalog_fileinfo, delta_catalog_fileinfos] = catalog_fileinfo.value();
     storage_->AttachCatalog(full_catalog_fileinfo, delta_catalog_fileinfos);
+    // the wal files before the checkpoint may be recycled
+    recycled_ts_.store(max_commit_ts);
 
     // phase 3: replay the entries
+    // The data commands of a table only need the commit order among themselves, so they are queued by table and the tables are
+    // replayed in parallel. An entry with any other command is a barrier: the queues are drained before it is replayed alone.
     LOG_INFO(fmt::format("Replay phase 3: replay {} entries", replay_entries.size()));
     std::reverse(replay_entries.begin(), replay_entries.end());
     TransactionID last_txn_id = 0;
 
+    ThreadPool replay_pool(WAL_REPLAY_THREAD_NUM);
+    ReplayTableCmds table_cmds;
     for (SizeT replay_count = 0; replay_count < replay_entries.size(); ++replay_count) {
-        if (replay_entries[replay_count]->commit_ts_ < max_commit_ts) {
+        const WalEntry &entry = *replay_entries[replay_count];
+        if (entry.commit_ts_ < max_commit_ts) {
             UnrecoverableError("Wal Replay: Commit ts should be greater than max commit ts");
         }
-        system_start_ts = replay_entries[replay_count]->commit_ts_;
-        last_txn_id = replay_entries[replay_count]->txn_id_;
+        system_start_ts = entry.commit_ts_;
+        last_txn_id = entry.txn_id_;
 
-        ReplayWalEntry(*replay_entries[replay_count]);
-        LOG_INFO(replay_entries[replay_count]->ToString());
+        Vector<Pair<String, String>> cmd_tables(entry.cmds_.size());
+        bool data_only = !entry.cmds_.empty();
+        for (SizeT i = 0; i < entry.cmds_.size() && data_only; ++i) {
+            data_only = ReplayTableOf(entry.cmds_[i].get(), cmd_tables[i]);
+        }
+        if (data_only) {
+            for (SizeT i = 0; i < entry.cmds_.size(); ++i) {
+                table_cmds[cmd_tables[i]].push_back({entry.cmds_[i].get(), entry.txn_id_, entry.commit_ts_});
+            }
+        } else {
+            ReplayTables(replay_pool, table_cmds, false);
+            ReplayWalEntry(entry);
+        }
+        LOG_INFO(entry.ToString());
     }
+    // The memory indexes of a table are recovered right after its last commands, overlapping the replay of the other tables.
+    ReplayTables(replay_pool, table_cmds, true);
 
     LOG_TRACE(fmt::format("System start ts: {}, lastest txn id: {}", system_start_ts, last_txn_id));
     storage_->catalog()->next_txn_id_ = last_txn_id;
@@ -498,56 +749,97 @@ i64 WalManager::ReplayWalFile() {
     return system_start_ts;
 }
 
+void WalManager::ReplayTables(ThreadPool &pool, ReplayTableCmds &table_cmds, bool recover_mem_index) {
+    BufferManager *buffer_mgr = storage_->buffer_manager();
+    auto replay_cmds = [this](const Vector<ReplayTableCmd> &cmds) {
+        for (const auto &[cmd, txn_id, commit_ts] : cmds) {
+            ReplayWalCmd(cmd, txn_id, commit_ts);
+        }
+    };
+    Vector<Future<void>> futures;
+    if (recover_mem_index) {
+        for (TableEntry *table_entry : storage_->catalog()->GetTableEntriesNolock()) {
+            Vector<ReplayTableCmd> cmds;
+            if (auto iter = table_cmds.find({*table_entry->GetDBName(), *table_entry->GetTableName()}); iter != table_cmds.end()) {
+                cmds = std::move(iter->second);
+                table_cmds.erase(iter);
+            }
+            futures.push_back(pool.push([&replay_cmds, table_entry, buffer_mgr, cmds = std::move(cmds)](int) {
+                replay_cmds(cmds);
+                table_entry->MemIndexRecover(buffer_mgr);
+            }));
+        }
+    }
+    for (const auto &[_, cmds] : table_cmds) {
+        futures.push_back(pool.push([&replay_cmds, &cmds](int) { replay_cmds(cmds); }));
+    }
+    // wait for all before an error is rethrown, the tasks refer to table_cmds
+    for (auto &future : futures) {
+        future.wait();
+    }
+    for (auto &future : futures) {
+        future.get();
+    }
+    table_cmds.clear();
+}
+
 void WalManager::ReplayWalEntry(const WalEntry &entry) {
     for (const auto &cmd : entry.cmds_) {
-        LOG_TRACE(fmt::format("Replay wal cmd: {}, commit ts: {}", WalCmd::WalCommandTypeToString(cmd->GetType()).c_str(), entry.commit_ts_));
-        switch (cmd->GetType()) {
-            case WalCommandType::CREATE_DATABASE:
-                WalCmdCreateDatabaseReplay(*dynamic_cast<const WalCmdCreateDatabase *>(cmd.get()), entry.txn_id_, entry.commit_ts_);
-                break;
-            case WalCommandType::DROP_DATABASE:
-                WalCmdDropDatabaseReplay(*dynamic_cast<const WalCmdDropDatabase *>(cmd.get()), entry.txn_id_, entry.commit_ts_);
-                break;
-            case WalCommandType::CREATE_TABLE:
-                WalCmdCreateTableReplay(*dynamic_cast<const WalCmdCreateTable *>(cmd.get()), entry.txn_id_, entry.commit_ts_);
-                break;
-            case WalCommandType::DROP_TABLE:
-                WalCmdDropTableReplay(*dynamic_cast<const WalCmdDropTable *>(cmd.get()), entry.txn_id_, entry.commit_ts_);
-                break;
-            case WalCommandType::ALTER_INFO:
-                RecoverableError(Status::NotSupport("WalCmdAlterInfo Replay Not implemented"));
-                break;
-            case WalCommandType::CREATE_INDEX:
-                WalCmdCreateIndexReplay(*dynamic_cast<const WalCmdCreateIndex *>(cmd.get()), entry.txn_id_, entry.commit_ts_);
-                break;
-            case WalCommandType::DROP_INDEX:
-                WalCmdDropIndexReplay(*dynamic_cast<const WalCmdDropIndex *>(cmd.get()), entry.txn_id_, entry.commit_ts_);
-                break;
-            case WalCommandType::IMPORT:
-                WalCmdImportReplay(*dynamic_cast<const WalCmdImport *>(cmd.get()), entry.txn_id_, entry.commit_ts_);
-                break;
-            case WalCommandType::APPEND:
-                WalCmdAppendReplay(*dynamic_cast<const WalCmdAppend *>(cmd.get()), entry.txn_id_, entry.commit_ts_);
-                break;
-            case WalCommandType::DELETE:
-                WalCmdDeleteReplay(*dynamic_cast<const WalCmdDelete *>(cmd.get()), entry.txn_id_, entry.commit_ts_);
-                break;
-            // case WalCommandType::SET_SEGMENT_STATUS_SEALED:
-            //     WalCmdSetSegmentStatusSealedReplay(*dynamic_cast<const WalCmdSetSegmentStatusSealed *>(cmd.get()), entry.txn_id_,
-            //     entry.commit_ts_); break;
-            // case WalCommandType::UPDATE_SEGMENT_BLOOM_FILTER_DATA:
-            //     WalCmdUpdateSegmentBloomFilterDataReplay(*dynamic_cast<const WalCmdUpdateSegmentBloomFilterData *>(cmd.get()),
-            //                                              entry.txn_id_,
-            //                                              entry.commit_ts_);
-            //     break;
-            case WalCommandType::CHECKPOINT:
-                break;
-            case WalCommandType::COMPACT:
-                WalCmdCompactReplay(*static_cast<const WalCmdCompact *>(cmd.get()), entry.txn_id_, entry.commit_ts_);
-                break;
-            default: {
-                UnrecoverableError("WalManager::ReplayWalEntry unknown wal command type");
-            }
+        ReplayWalCmd(cmd.get(), entry.txn_id_, entry.commit_ts_);
+    }
+}
+
+void WalManager::ReplayWalCmd(WalCmd *cmd, TransactionID txn_id, TxnTimeStamp commit_ts) {
+    LOG_TRACE(fmt::format("Replay wal cmd: {}, commit ts: {}", WalCmd::WalCommandTypeToString(cmd->GetType()).c_str(), commit_ts));
+    switch (cmd->GetType()) {
+        case WalCommandType::CREATE_DATABASE:
+            WalCmdCreateDatabaseReplay(*dynamic_cast<const WalCmdCreateDatabase *>(cmd), txn_id, commit_ts);
+            break;
+        case WalCommandType::DROP_DATABASE:
+            WalCmdDropDatabaseReplay(*dynamic_cast<const WalCmdDropDatabase *>(cmd), txn_id, commit_ts);
+            break;
+        case WalCommandType::CREATE_TABLE:
+            WalCmdCreateTableReplay(*dynamic_cast<const WalCmdCreateTable *>(cmd), txn_id, commit_ts);
+            break;
+        case WalCommandType::DROP_TABLE:
+            WalCmdDropTableReplay(*dynamic_cast<const WalCmdDropTable *>(cmd), txn_id, commit_ts);
+            break;
+        case WalCommandType::ALTER_INFO:
+            RecoverableError(Status::NotSupport("WalCmdAlterInfo Replay Not implemented"));
+            break;
+        case WalCommandType::CREATE_INDEX:
+            WalCmdCreateIndexReplay(*dynamic_cast<const WalCmdCreateIndex *>(cmd), txn_id, commit_ts);
+            break;
+        case WalCommandType::DROP_INDEX:
+            WalCmdDropIndexReplay(*dynamic_cast<const WalCmdDropIndex *>(cmd), txn_id, commit_ts);
+            break;
+        case WalCommandType::IMPORT:
+            WalCmdImportReplay(*dynamic_cast<const WalCmdImport *>(cmd), txn_id, commit_ts);
+            break;
+        case WalCommandType::APPEND:
+            WalCmdAppendReplay(*dynamic_cast<const WalCmdAppend *>(cmd), txn_id, commit_ts);
+            break;
+        case WalCommandType::DELETE:
+            WalCmdDeleteReplay(*dynamic_cast<const WalCmdDelete *>(cmd), txn_id, commit_ts);
+            break;
+        case WalCommandType::UPDATE:
+            WalCmdUpdateReplay(*dynamic_cast<const WalCmdUpdate *>(cmd), txn_id, commit_ts);
+            break;
+        // case WalCommandType::SET_SEGMENT_STATUS_SEALED:
+        //     WalCmdSetSegmentStatusSealedReplay(*dynamic_cast<const WalCmdSetSegmentStatusSealed *>(cmd), txn_id,
+        //     commit_ts); break;
+        // case WalCommandType::UPDATE_SEGMENT_BLOOM_FILTER_DATA:
+        //     WalCmdUpdateSegmentBloomFilterDataReplay(*dynamic_cast<const WalCmdUpdateSegmentBloomFilterData *>(cmd),
+        //                                              txn_id,
+        //                                              commit_ts);
+        //     break;
+        case WalCommandType::CHECKPOINT:
+            break;
+        case WalCommandType::COMPACT:
+            WalCmdCompactReplay(*static_cast<const WalCmdCompact *>(cmd), txn_id, commit_ts);
+            break;
+        default: {
+            UnrecoverableError("WalManager::ReplayWalCmd unknown wal command type");
         }
     }
 }
@@ -581,7 +873,11 @@ void WalManager::WalCmdCreateTableReplay(const WalCmdCreateTable &cmd, Transacti
                                                 commit_ts,
                                                 0 /*row_count*/,
                                                 INVALID_SEGMENT_ID /*unsealed_id*/,
-                                                0 /*next_segment_id*/);
+                                                0 /*next_segment_id*/,
+                                                cmd.table_def_->segment_capacity(),
+                                                cmd.table_def_->sort_column_id(),
+                                                cmd.table_def_->ttl_column_id(),
+                                                cmd.table_def_->ttl_seconds());
         },
         txn_id,
         0 /*begin_ts*/);
@@ -727,6 +1023,20 @@ void WalManager::WalCmdDeleteReplay(const WalCmdDelete &cmd, TransactionID txn_i
     Catalog::CommitWrite(table_store->table_entry_, fake_txn->TxnID(), commit_ts, table_store->txn_segments());
 }
 
+void WalManager::WalCmdUpdateReplay(const WalCmdUpdate &cmd, TransactionID txn_id, TxnTimeStamp commit_ts) {
+    auto [table_entry, table_status] = storage_->catalog()->GetTableByName(cmd.db_name_, cmd.table_name_, txn_id, commit_ts);
+    if (!table_status.ok()) {
+        UnrecoverableError(fmt::format("Wal Replay: Get table failed {}", table_status.message()));
+    }
+
+    auto fake_txn = Txn::NewReplayTxn(storage_->buffer_manager(), storage_->txn_manager(), storage_->catalog(), txn_id);
+    auto table_store = fake_txn->GetTxnTableStore(table_entry);
+    table_store->Update(cmd.row_ids_, cmd.column_ids_, cmd.block_);
+    fake_txn->FakeCommit(commit_ts);
+    Catalog::Update(table_store->table_entry_, fake_txn->TxnID(), (void *)table_store, fake_txn->CommitTS(), table_store->update_state_);
+    Catalog::CommitWrite(table_store->table_entry_, fake_txn->TxnID(), commit_ts, table_store->txn_segments());
+}
+
 void WalManager::WalCmdCompactReplay(const WalCmdCompact &cmd, TransactionID txn_id, TxnTimeStamp commit_ts) {
     auto [table_entry, table_status] = storage_->catalog()->GetTableByName(cmd.db_name_, cmd.table_name_, txn_id, commit_ts);
     if (!table_status.ok()) {
@@ -22,6 +22,7 @@ import wal_entry;
 import options;
 import catalog_delta_entry;
 import wal_entry_blocking_queue;
+import file_system;
 
 namespace infinity {
 
@@ -33,7 +34,14 @@ class SegmentEntry;
 
 export class WalManager {
 public:
-    WalManager(Storage *storage, String wal_dir, u64 wal_size_threshold, u64 delta_checkpoint_interval_wal_bytes, FlushOption flush_option);
+    WalManager(Storage *storage,
+               String wal_dir,
+               u64 wal_size_threshold,
+               u64 delta_checkpoint_interval_wal_bytes,
+               FlushOption flush_option,
+               u64 group_commit_max_entries,
+               u64 group_commit_latency_us,
+               u64 compress_threshold);
 
     ~WalManager();
 
@@ -49,8 +57,13 @@ public:
     // wal and do parallel committing. Each sync cost ~1s. Each checkpoint cost
     // ~10s. So it's necessary to sync for a batch of transactions, and to
     // checkpoint for a batch of sync.
+    // The batches are pipelined: batch N+1 is collected and serialized while batch N is synced and committed by the sync thread.
     void Flush();
 
+    // The max commit ts of the txns whose wal is written with the flush option, i.e. synced to disk under flush_at_once.
+    // The txns are committed only after that.
+    TxnTimeStamp DurableCommitTS() const { return durable_commit_ts_.load(); }
+
     bool TrySubmitCheckpointTask(SharedPtr<CheckpointTaskBase> ckp_task);
 
     void Checkpoint(bool is_full_checkpoint, TxnTimeStamp max_commit_ts, i64 wal_size);
@@ -63,15 +76,43 @@ public:
 
     void ReplayWalEntry(const WalEntry &entry);
 
+    void ReplayWalCmd(WalCmd *cmd, TransactionID txn_id, TxnTimeStamp commit_ts);
+
     void RecycleWalFile(TxnTimeStamp full_ckp_ts);
 
+    // Appends the wal entries with a commit ts from from_ts up to the durable commit ts to entries, oldest first and as they are in
+    // the wal files, for a follower. At least one entry is appended if there is any, then they stop at max_bytes. Returns false if
+    // the entries from from_ts may be recycled already.
+    bool ReadEntriesFrom(TxnTimeStamp from_ts, SizeT max_bytes, String &entries);
+
+    // The commit ts of the last checkpoint entry written to the wal
+    TxnTimeStamp LastCheckpointEntryTS() const { return checkpoint_entry_ts_.load(); }
+
     // Should only call in `Flush` thread
     i64 WalSize() const { return wal_size_; }
 
 private:
+    // Replay helpers
+    struct ReplayTableCmd {
+        WalCmd *cmd_{};
+        TransactionID txn_id_{};
+        TxnTimeStamp commit_ts_{};
+    };
+    // the queued data commands by db name and table name
+    using ReplayTableCmds = Map<Pair<String, String>, Vector<ReplayTableCmd>>;
+
+    void ReplayTables(ThreadPool &pool, ReplayTableCmds &table_cmds, bool recover_mem_index);
+
     // Checkpoint Helper
     void CheckpointInner(bool is_full_checkpoint, Txn *txn, TxnTimeStamp max_commit_ts, i64 wal_size);
 
+    // Sync thread helpers
+    void SyncLoop();
+    void SubmitSync(Deque<WalEntry *> &log_batch, TxnTimeStamp max_commit_ts, std::chrono::steady_clock::time_point write_begin);
+    void WaitForSync();
+
+    void WriteWalFile(const char *data, SizeT size);
+
     void SetLastCkpWalSize(i64 wal_size);
     i64 GetLastCkpWalSize();
 
@@ -88,6 +129,7 @@ private:
 
     void WalCmdImportReplay(const WalCmdImport &cmd, TransactionID txn_id, TxnTimeStamp commit_ts);
     void WalCmdDeleteReplay(const WalCmdDelete &cmd, TransactionID txn_id, TxnTimeStamp commit_ts);
+    void WalCmdUpdateReplay(const WalCmdUpdate &cmd, TransactionID txn_id, TxnTimeStamp commit_ts);
     // void WalCmdSetSegmentStatusSealedReplay(const WalCmdSetSegmentStatusSealed &cmd, TransactionID txn_id, TxnTimeStamp commit_ts);
     // void WalCmdUpdateSegmentBloomFilterDataReplay(const WalCmdUpdateSegmentBloomFilterData &cmd, TransactionID txn_id, TxnTimeStamp commit_ts);
     void WalCmdCompactReplay(const WalCmdCompact &cmd, TransactionID txn_id, TxnTimeStamp commit_ts);
@@ -95,6 +137,7 @@ private:
 public:
     u64 cfg_wal_size_threshold_{};
     u64 cfg_delta_checkpoint_interval_wal_bytes_{};
+    u64 cfg_compress_threshold_{};
 
 private:
     // Concurrent writing WAL is disallowed. So put all WAL writing into a queue
@@ -111,11 +154,35 @@ private:
     // TxnManager and Flush thread access following members
     WALEntryBlockingQueue blocking_queue_{};
 
-    // Only Flush thread access following members
-    std::ofstream ofs_{};
+    // Held by the Flush thread while it writes or swaps the wal file, the file then only has whole entries for the followers
+    std::mutex wal_file_mutex_{};
+    // the entries up to the ts may be in the recycled wal files
+    Atomic<TxnTimeStamp> recycled_ts_{};
+    Atomic<TxnTimeStamp> checkpoint_entry_ts_{};
+
+    // Only Flush thread access following members, the sync thread uses them only while a batch is handed to it
+    UniquePtr<FileHandler> wal_file_{};
+    Vector<char> wal_buf_{};
     TxnTimeStamp max_commit_ts_{};
     i64 wal_size_{};
     FlushOption flush_option_{FlushOption::kOnlyWrite};
+    SizeT group_commit_max_entries_{};
+    std::chrono::microseconds group_commit_latency_{};
+
+    // Flush and sync threads access following members
+    Thread sync_thread_{};
+    std::mutex sync_mutex_{};
+    std::condition_variable sync_cv_{};
+    bool sync_pending_{false};
+    bool sync_stopped_{false};
+    Deque<WalEntry *> sync_batch_{};
+    TxnTimeStamp sync_max_commit_ts_{};
+    // when the batch began to be written, for the flush duration
+    std::chrono::steady_clock::time_point sync_write_begin_{};
+    Atomic<TxnTimeStamp> durable_commit_ts_{};
+
+    // Only sync thread access following members
+    std::chrono::steady_clock::time_point last_sync_time_{};
 
     // Flush and Checkpoint threads access following members
     std::mutex mutex2_{};
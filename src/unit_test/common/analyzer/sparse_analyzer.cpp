@@ -0,0 +1,46 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "unit_test/base_test.h"
+
+import stl;
+import term;
+import sparse_analyzer;
+
+using namespace infinity;
+
+class SparseAnalyzerTest : public BaseTest {};
+
+TEST_F(SparseAnalyzerTest, test1) {
+    SparseAnalyzer analyzer;
+    TermList term_list;
+    String input("apple:0.5 fruit:1.25,red  tree:0 sky:-1 a:b:2");
+    analyzer.Analyze(input, term_list);
+
+    ASSERT_EQ(term_list.size(), 4U);
+    ASSERT_EQ(term_list[0].text_, String("apple"));
+    ASSERT_EQ(term_list[0].word_offset_, 500U);
+    ASSERT_EQ(term_list[1].text_, String("fruit"));
+    ASSERT_EQ(term_list[1].word_offset_, 1250U);
+    ASSERT_EQ(term_list[2].text_, String("red"));
+    ASSERT_EQ(term_list[2].word_offset_, 1000U);
+    ASSERT_EQ(term_list[3].text_, String("a:b"));
+    ASSERT_EQ(term_list[3].word_offset_, 2000U);
+}
+
+TEST_F(SparseAnalyzerTest, test2) {
+    ASSERT_EQ(QuantizeSparseWeight(0.0001F), 1U);
+    ASSERT_EQ(QuantizeSparseWeight(1000.0F), u32(SPARSE_WEIGHT_MAX * SPARSE_WEIGHT_SCALE));
+    ASSERT_FLOAT_EQ(DequantizeSparseWeight(QuantizeSparseWeight(0.731F)), 0.731F);
+}
@@ -117,6 +117,34 @@ TEST_F(StandardAnalyzerTest, test5) {
     //    ASSERT_EQ(term_list[3].word_offset_, 3U);
 }
 
+TEST_F(StandardAnalyzerTest, test6) {
+    // the tokens are longer than a SIMD block, and the repeated words are stemmed from the cache
+    StandardAnalyzer analyzer;
+    TermList term_list;
+    String long_word(70, 'a');
+    String input = long_word + "Tests " + long_word + "-b tests\xc3\xa9 tests";
+    analyzer.Analyze(input, term_list);
+
+    ASSERT_EQ(term_list.size(), 8U);
+    ASSERT_EQ(term_list[0].text_, long_word + "tests");
+    ASSERT_EQ(term_list[0].word_offset_, 0U);
+    ASSERT_EQ(term_list[1].text_, long_word + "test");
+    ASSERT_EQ(term_list[1].word_offset_, 0U);
+    ASSERT_EQ(term_list[2].text_, long_word);
+    ASSERT_EQ(term_list[2].word_offset_, 1U);
+    // the delimiters are not extracted, but each of them takes an offset
+    ASSERT_EQ(term_list[3].text_, String("b"));
+    ASSERT_EQ(term_list[3].word_offset_, 3U);
+    ASSERT_EQ(term_list[4].text_, String("tests"));
+    ASSERT_EQ(term_list[4].word_offset_, 4U);
+    ASSERT_EQ(term_list[5].text_, String("test"));
+    ASSERT_EQ(term_list[5].word_offset_, 4U);
+    ASSERT_EQ(term_list[6].text_, String("tests"));
+    ASSERT_EQ(term_list[6].word_offset_, 7U);
+    ASSERT_EQ(term_list[7].text_, String("test"));
+    ASSERT_EQ(term_list[7].word_offset_, 7U);
+}
+
 /*
 TEST_F(StandardAnalyzerTest, test6) {
     static const std::string ROOT_PATH = "../../../resource";
@@ -0,0 +1,55 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "unit_test/base_test.h"
+
+import stl;
+import huge_page_allocator;
+
+using namespace infinity;
+
+class HugePageAllocatorTest : public BaseTest {
+public:
+    void TearDown() override {
+        HugePageAllocator::SetMode(HugePageMode::kOff);
+        BaseTest::TearDown();
+    }
+
+    static void CheckAllocation(SizeT size, SizeT align) {
+        auto *ptr = static_cast<char *>(HugePageAllocator::Allocate(size, align));
+        ASSERT_NE(ptr, nullptr);
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(ptr) % align, 0u);
+        if (size >= HugePageAllocator::HUGE_PAGE_SIZE) {
+            EXPECT_EQ(reinterpret_cast<uintptr_t>(ptr) % HugePageAllocator::HUGE_PAGE_SIZE, 0u);
+        }
+        EXPECT_EQ(std::count(ptr, ptr + size, 0), (i64)size);
+        std::memset(ptr, 0xab, size);
+        HugePageAllocator::Deallocate(ptr, size, align);
+    }
+};
+
+TEST_F(HugePageAllocatorTest, test_small) {
+    CheckAllocation(1, 8);
+    CheckAllocation(4096, 64);
+    CheckAllocation(HugePageAllocator::HUGE_PAGE_SIZE - 1, 32);
+}
+
+TEST_F(HugePageAllocatorTest, test_large) {
+    for (auto mode : {HugePageMode::kOff, HugePageMode::kTransparent, HugePageMode::kExplicit}) {
+        HugePageAllocator::SetMode(mode);
+        CheckAllocation(HugePageAllocator::HUGE_PAGE_SIZE, 64);
+        CheckAllocation(3 * HugePageAllocator::HUGE_PAGE_SIZE + 17, 32);
+    }
+}
@@ -0,0 +1,62 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "unit_test/base_test.h"
+
+import stl;
+import memory_pool;
+import pool_allocator;
+import default_values;
+
+using namespace infinity;
+
+class MemoryPoolTest : public BaseTest {};
+
+TEST_F(MemoryPoolTest, test_pool_vector) {
+    MemoryPool pool(DEFAULT_QUERY_POOL_CHUNK_SIZE);
+    using PoolVector = Vector<Pair<f32, u32>, PoolAllocator<Pair<f32, u32>>>;
+    PoolVector values{PoolAllocator<Pair<f32, u32>>(&pool)};
+    for (u32 i = 0; i < 10000; ++i) {
+        values.emplace_back(static_cast<f32>(i), i);
+    }
+    EXPECT_TRUE(pool.IsInPool(values.data()));
+    EXPECT_EQ(values[9999].second, 9999u);
+
+    PoolVector moved{PoolAllocator<Pair<f32, u32>>(&pool)};
+    moved = std::move(values);
+    EXPECT_EQ(moved.size(), 10000u);
+    EXPECT_TRUE(pool.IsInPool(moved.data()));
+}
+
+TEST_F(MemoryPoolTest, test_reset_reuses_chunks) {
+    MemoryPool pool(DEFAULT_QUERY_POOL_CHUNK_SIZE);
+    for (SizeT i = 0; i < 64; ++i) {
+        pool.Allocate(4096);
+    }
+    SizeT total_bytes = pool.GetTotalBytes();
+    EXPECT_GE(total_bytes, 64 * 4096u);
+
+    // the next statement allocates from the chunks of the last one
+    pool.Reset();
+    EXPECT_EQ(pool.GetAllocatedSize(), 0u);
+    for (SizeT i = 0; i < 64; ++i) {
+        pool.Allocate(4096);
+    }
+    EXPECT_EQ(pool.GetTotalBytes(), total_bytes);
+
+    // a chunk over the chunk size is freed by the reset
+    pool.Allocate(2 * DEFAULT_QUERY_POOL_CHUNK_SIZE);
+    pool.Reset();
+    EXPECT_EQ(pool.GetTotalBytes(), total_bytes);
+}
@@ -0,0 +1,41 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "unit_test/base_test.h"
+
+import stl;
+import hardware_counter;
+
+class HardwareCounterTest : public BaseTest {};
+
+TEST_F(HardwareCounterTest, test1) {
+    infinity::HardwareCounter begin;
+    if (!infinity::ReadThreadHardwareCounter(begin)) {
+        // perf events are not allowed in the environment, the counter is left unchanged
+        EXPECT_EQ(begin.cycles_, 0u);
+        EXPECT_EQ(begin.instructions_, 0u);
+        GTEST_SKIP();
+    }
+
+    volatile infinity::u64 sum = 0;
+    for (infinity::u64 i = 0; i < 1'000'000; ++i) {
+        sum = sum + i;
+    }
+
+    infinity::HardwareCounter end;
+    ASSERT_TRUE(infinity::ReadThreadHardwareCounter(end));
+    EXPECT_GT(end.instructions_, begin.instructions_ + 1'000'000);
+    EXPECT_GE(end.cycles_, begin.cycles_);
+    EXPECT_GE(end.llc_misses_, begin.llc_misses_);
+}
@@ -0,0 +1,69 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "unit_test/base_test.h"
+
+import stl;
+import trace_span;
+import default_values;
+import third_party;
+
+using namespace infinity;
+
+class TraceSpanTest : public BaseTest {};
+
+TEST_F(TraceSpanTest, test1) {
+    TraceRecorder::Stop();
+    { TraceSpan span("test", "span_before_start"); }
+
+    TraceRecorder::Start();
+    { TraceSpan span("test", "span_while_started", 42); }
+    // a span begun before the stop is recorded at its end
+    {
+        TraceSpan span("test", "span_across_stop");
+        TraceRecorder::Stop();
+    }
+    { TraceSpan span("test", "span_after_stop"); }
+
+    String trace = TraceRecorder::DumpChromeTrace();
+    EXPECT_EQ(trace.find("span_before_start"), String::npos);
+    EXPECT_NE(trace.find(R"("name":"span_while_started","cat":"test","ph":"X")"), String::npos);
+    EXPECT_NE(trace.find(R"("args":{"arg":42})"), String::npos);
+    EXPECT_NE(trace.find("span_across_stop"), String::npos);
+    EXPECT_EQ(trace.find("span_after_stop"), String::npos);
+}
+
+TEST_F(TraceSpanTest, test2) {
+    TraceRecorder::Start();
+    constexpr i64 first_arg = 1'000'000;
+    for (i64 arg = first_arg; arg <= first_arg + static_cast<i64>(TRACE_RING_CAPACITY); ++arg) {
+        TraceSpan span("test", "ring", arg);
+    }
+    // spans of other threads are kept in their own rings
+    std::thread thread([] { TraceSpan span("test", "other_thread"); });
+    thread.join();
+    TraceRecorder::Stop();
+
+    String trace = TraceRecorder::DumpChromeTrace();
+    // the oldest span is overwritten
+    EXPECT_EQ(trace.find(fmt::format(R"("arg":{}}})", first_arg)), String::npos);
+    EXPECT_NE(trace.find(fmt::format(R"("arg":{}}})", first_arg + 1)), String::npos);
+    EXPECT_NE(trace.find(fmt::format(R"("arg":{}}})", first_arg + TRACE_RING_CAPACITY)), String::npos);
+    EXPECT_NE(trace.find("other_thread"), String::npos);
+
+    // a new trace drops the spans of the last one
+    TraceRecorder::Start();
+    TraceRecorder::Stop();
+    EXPECT_EQ(TraceRecorder::DumpChromeTrace(), R"({"displayTimeUnit":"ns","traceEvents":[]})");
+}
@@ -0,0 +1,138 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "unit_test/base_test.h"
+
+import stl;
+import catalog;
+import scalar_function;
+import add;
+import multiply;
+import greater;
+import function_set;
+import scalar_function_set;
+import function;
+import base_expression;
+import value_expression;
+import reference_expression;
+import function_expression;
+import fused_expression;
+import column_vector;
+import value;
+import data_block;
+import selection;
+import default_values;
+import logical_type;
+import internal_types;
+import data_type;
+
+using namespace infinity;
+
+class FusedExpressionTest : public BaseTest {
+protected:
+    void SetUp() override {
+        BaseTest::SetUp();
+        catalog_ = MakeUnique<Catalog>(MakeShared<String>("/tmp/infinity/data"));
+        RegisterAddFunction(catalog_);
+        RegisterMulFunction(catalog_);
+        RegisterGreaterFunction(catalog_);
+    }
+
+    SharedPtr<BaseExpression> MakeFunction(const String &name, Vector<SharedPtr<BaseExpression>> arguments) {
+        SharedPtr<FunctionSet> function_set = Catalog::GetFunctionSetByName(catalog_.get(), name);
+        auto scalar_function_set = std::static_pointer_cast<ScalarFunctionSet>(function_set);
+        ScalarFunction function = scalar_function_set->GetMostMatchFunction(arguments);
+        return MakeShared<FunctionExpression>(function, arguments);
+    }
+
+    static SharedPtr<DataBlock> MakeInput(SizeT row_count, BigIntT first) {
+        auto column_ptr = MakeShared<ColumnVector>(MakeShared<DataType>(LogicalType::kBigInt));
+        column_ptr->Initialize(ColumnVectorType::kFlat, DEFAULT_VECTOR_SIZE);
+        for (SizeT i = 0; i < row_count; ++i) {
+            column_ptr->AppendValue(Value::MakeBigInt(first + static_cast<BigIntT>(i)));
+        }
+        SharedPtr<DataBlock> input_data_block = DataBlock::Make();
+        input_data_block->Init({column_ptr});
+        return input_data_block;
+    }
+
+    UniquePtr<Catalog> catalog_{};
+};
+
+TEST_F(FusedExpressionTest, arithmetic) {
+    // c1 * 3 + 1
+    SharedPtr<BaseExpression> col_expr = ReferenceExpression::Make(DataType(LogicalType::kBigInt), "t1", "c1", String(), 0);
+    SharedPtr<BaseExpression> multiply_expr = MakeFunction("*", {col_expr, MakeShared<ValueExpression>(Value::MakeBigInt(3))});
+    SharedPtr<BaseExpression> add_expr = MakeFunction("+", {multiply_expr, MakeShared<ValueExpression>(Value::MakeBigInt(1))});
+
+    SharedPtr<FusedExpression> fused_expression = FusedExpression::Compile(add_expr);
+    ASSERT_NE(fused_expression, nullptr);
+    EXPECT_FALSE(fused_expression->IsBoolean());
+
+    SizeT row_count = 1000;
+    SharedPtr<DataBlock> input_data_block = MakeInput(row_count, 0);
+    ColumnVector output(MakeShared<DataType>(LogicalType::kBigInt));
+    output.Initialize(ColumnVectorType::kFlat, DEFAULT_VECTOR_SIZE);
+    EXPECT_TRUE(fused_expression->Execute(*input_data_block, output));
+    EXPECT_EQ(output.Size(), row_count);
+    for (SizeT i = 0; i < row_count; ++i) {
+        EXPECT_EQ(output.GetValue(i).value_.big_int, static_cast<BigIntT>(i * 3 + 1));
+    }
+
+    // The same expression finds the same program
+    EXPECT_EQ(FusedExpression::Get(add_expr), FusedExpression::Get(add_expr));
+}
+
+TEST_F(FusedExpressionTest, overflow) {
+    SharedPtr<BaseExpression> col_expr = ReferenceExpression::Make(DataType(LogicalType::kBigInt), "t1", "c1", String(), 0);
+    SharedPtr<BaseExpression> multiply_expr = MakeFunction("*", {col_expr, MakeShared<ValueExpression>(Value::MakeBigInt(4))});
+    SharedPtr<FusedExpression> fused_expression = FusedExpression::Compile(multiply_expr);
+    ASSERT_NE(fused_expression, nullptr);
+
+    // The product doesn't fit a BigInt, the block is left to the interpreter which makes it null
+    SharedPtr<DataBlock> input_data_block = MakeInput(10, std::numeric_limits<BigIntT>::max() / 2);
+    ColumnVector output(MakeShared<DataType>(LogicalType::kBigInt));
+    output.Initialize(ColumnVectorType::kFlat, DEFAULT_VECTOR_SIZE);
+    EXPECT_FALSE(fused_expression->Execute(*input_data_block, output));
+}
+
+TEST_F(FusedExpressionTest, select) {
+    // c1 + 1 > 500
+    SharedPtr<BaseExpression> col_expr = ReferenceExpression::Make(DataType(LogicalType::kBigInt), "t1", "c1", String(), 0);
+    SharedPtr<BaseExpression> add_expr = MakeFunction("+", {col_expr, MakeShared<ValueExpression>(Value::MakeBigInt(1))});
+    SharedPtr<BaseExpression> greater_expr = MakeFunction(">", {add_expr, MakeShared<ValueExpression>(Value::MakeBigInt(500))});
+
+    SharedPtr<FusedExpression> fused_expression = FusedExpression::Compile(greater_expr);
+    ASSERT_NE(fused_expression, nullptr);
+    EXPECT_TRUE(fused_expression->IsBoolean());
+
+    SizeT row_count = 1000;
+    SharedPtr<DataBlock> input_data_block = MakeInput(row_count, 0);
+    Selection selection;
+    selection.Initialize(row_count);
+    EXPECT_TRUE(fused_expression->Select(*input_data_block, selection));
+    ASSERT_EQ(selection.Size(), 500u);
+    for (SizeT i = 0; i < selection.Size(); ++i) {
+        EXPECT_EQ(selection.Get(i), 500 + i);
+    }
+}
+
+TEST_F(FusedExpressionTest, unsupported) {
+    // A lone column has no program
+    SharedPtr<BaseExpression> col_expr = ReferenceExpression::Make(DataType(LogicalType::kBigInt), "t1", "c1", String(), 0);
+    EXPECT_EQ(FusedExpression::Compile(col_expr), nullptr);
+
+    SharedPtr<BaseExpression> varchar_expr = ReferenceExpression::Make(DataType(LogicalType::kVarchar), "t1", "c2", String(), 1);
+    EXPECT_EQ(FusedExpression::Get(varchar_expr), nullptr);
+}
@@ -0,0 +1,122 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "unit_test/base_test.h"
+
+import stl;
+import hash_table;
+import column_vector;
+import value;
+import logical_type;
+import internal_types;
+import data_type;
+import default_values;
+import third_party;
+
+class HashTableTest : public BaseTest {};
+
+TEST_F(HashTableTest, fixed_width_key) {
+    using namespace infinity;
+
+    SharedPtr<DataType> int_type = MakeShared<DataType>(LogicalType::kInteger);
+    SharedPtr<DataType> bigint_type = MakeShared<DataType>(LogicalType::kBigInt);
+    HashTable hash_table;
+    hash_table.Init({int_type, bigint_type});
+
+    SizeT row_count = DEFAULT_VECTOR_SIZE;
+    SharedPtr<ColumnVector> column1 = ColumnVector::Make(int_type);
+    SharedPtr<ColumnVector> column2 = ColumnVector::Make(bigint_type);
+    column1->Initialize();
+    column2->Initialize();
+    for (SizeT row_idx = 0; row_idx < row_count; ++row_idx) {
+        column1->AppendValue(Value::MakeInt(row_idx % 100));
+        column2->AppendValue(Value::MakeBigInt(row_idx % 3));
+    }
+    Vector<SharedPtr<ColumnVector>> key_columns{column1, column2};
+
+    Vector<u32> group_ids;
+    hash_table.FindOrInsert(key_columns, row_count, group_ids);
+    EXPECT_EQ(hash_table.GroupCount(), 300u);
+    for (SizeT row_idx = 0; row_idx < row_count; ++row_idx) {
+        EXPECT_EQ(group_ids[row_idx], group_ids[row_idx % 300]);
+    }
+    // Group ids are assigned in the order of rows.
+    for (SizeT row_idx = 0; row_idx < 300; ++row_idx) {
+        EXPECT_EQ(group_ids[row_idx], row_idx);
+    }
+
+    Vector<u32> find_ids;
+    hash_table.Find(key_columns, row_count, find_ids);
+    EXPECT_EQ(find_ids, group_ids);
+
+    SharedPtr<ColumnVector> absent1 = ColumnVector::Make(int_type);
+    SharedPtr<ColumnVector> absent2 = ColumnVector::Make(bigint_type);
+    absent1->Initialize();
+    absent2->Initialize();
+    absent1->AppendValue(Value::MakeInt(1000));
+    absent2->AppendValue(Value::MakeBigInt(0));
+    hash_table.Find({absent1, absent2}, 1, find_ids);
+    EXPECT_EQ(find_ids[0], INVALID_GROUP_ID);
+    EXPECT_EQ(hash_table.GroupCount(), 300u);
+}
+
+TEST_F(HashTableTest, varchar_key) {
+    using namespace infinity;
+
+    SharedPtr<DataType> varchar_type = MakeShared<DataType>(LogicalType::kVarchar);
+    HashTable hash_table;
+    hash_table.Init({varchar_type});
+
+    SizeT row_count = 1000;
+    SharedPtr<ColumnVector> column = ColumnVector::Make(varchar_type);
+    column->Initialize();
+    for (SizeT row_idx = 0; row_idx < row_count; ++row_idx) {
+        // Both the inlined and the not inlined varchar
+        String str = row_idx % 2 == 0 ? fmt::format("k{}", row_idx % 10) : fmt::format("a_long_varchar_key_not_inlined_{}", row_idx % 10);
+        column->AppendValue(Value::MakeVarchar(str));
+    }
+
+    Vector<u32> group_ids;
+    hash_table.FindOrInsert({column}, row_count, group_ids);
+    EXPECT_EQ(hash_table.GroupCount(), 10u);
+    for (SizeT row_idx = 0; row_idx < row_count; ++row_idx) {
+        EXPECT_EQ(group_ids[row_idx], group_ids[row_idx % 10]);
+    }
+}
+
+TEST_F(HashTableTest, null_key) {
+    using namespace infinity;
+
+    SharedPtr<DataType> int_type = MakeShared<DataType>(LogicalType::kInteger);
+    HashTable hash_table;
+    hash_table.Init({int_type});
+
+    SharedPtr<ColumnVector> column = ColumnVector::Make(int_type);
+    column->Initialize();
+    column->AppendValue(Value::MakeInt(0));
+    column->AppendValue(Value::MakeInt(0));
+    column->AppendValue(Value::MakeInt(1));
+    column->nulls_ptr_->SetFalse(1);
+
+    Vector<u32> group_ids;
+    hash_table.FindOrInsert({column}, 3, group_ids);
+    // NULL is a group different from 0.
+    EXPECT_EQ(hash_table.GroupCount(), 3u);
+
+    Vector<bool> has_null;
+    HashTable::HasNull({column}, 3, has_null);
+    EXPECT_FALSE(has_null[0]);
+    EXPECT_TRUE(has_null[1]);
+    EXPECT_FALSE(has_null[2]);
+}
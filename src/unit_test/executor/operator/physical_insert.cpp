@@ -0,0 +1,128 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "unit_test/base_test.h"
+
+import stl;
+import global_resource_usage;
+import infinity_context;
+import infinity;
+import query_result;
+import data_block;
+import value;
+import default_values;
+import third_party;
+
+using namespace infinity;
+
+class PhysicalInsertTest : public BaseTest {
+protected:
+    void SetUp() override {
+        system("rm -rf /tmp/infinity");
+#ifdef INFINITY_DEBUG
+        infinity::GlobalResourceUsage::Init();
+#endif
+        std::shared_ptr<std::string> config_path = std::make_shared<std::string>(std::string(test_data_path()) + "/config/test_insert_bulk.toml");
+        infinity::InfinityContext::instance().Init(config_path);
+    }
+
+    void TearDown() override {
+        infinity::InfinityContext::instance().UnInit();
+#ifdef INFINITY_DEBUG
+        EXPECT_EQ(infinity::GlobalResourceUsage::GetObjectCount(), 0);
+        EXPECT_EQ(infinity::GlobalResourceUsage::GetRawMemoryCount(), 0);
+        infinity::GlobalResourceUsage::UnInit();
+#endif
+        BaseTest::TearDown();
+    }
+
+    // the integers of the first column of the result, in the order of the result
+    static Vector<i32> QueryIntegers(Infinity *infinity, const String &sql) {
+        QueryResult result = infinity->Query(sql);
+        EXPECT_TRUE(result.IsOk()) << result.ErrorMsg();
+        Vector<i32> values;
+        for (SizeT block_id = 0; block_id < result.result_table_->DataBlockCount(); ++block_id) {
+            SharedPtr<DataBlock> data_block = result.result_table_->GetDataBlockById(block_id);
+            for (SizeT row_id = 0; row_id < data_block->row_count(); ++row_id) {
+                values.push_back(data_block->GetValue(0, row_id).value_.integer);
+            }
+        }
+        return values;
+    }
+
+    static SizeT SegmentCount(Infinity *infinity, const String &table_name) {
+        QueryResult result = infinity->ShowSegments("default", table_name);
+        EXPECT_TRUE(result.IsOk()) << result.ErrorMsg();
+        SizeT segment_count = 0;
+        for (SizeT block_id = 0; block_id < result.result_table_->DataBlockCount(); ++block_id) {
+            segment_count += result.result_table_->GetDataBlockById(block_id)->row_count();
+        }
+        return segment_count;
+    }
+};
+
+TEST_F(PhysicalInsertTest, test_bulk_insert) {
+    SharedPtr<Infinity> infinity = Infinity::LocalConnect();
+    ASSERT_TRUE(infinity->Query("CREATE TABLE t1 (c1 INTEGER, c2 VARCHAR) PROPERTIES (sort_key = c1)").IsOk());
+
+    // fewer rows than the threshold are appended
+    ASSERT_TRUE(infinity->Query("INSERT INTO t1 VALUES (11, 'b'), (10, 'a')").IsOk());
+    EXPECT_EQ(SegmentCount(infinity.get(), "t1"), 1u);
+
+    // each bulk insert is a new segment, sorted by the sort key
+    ASSERT_TRUE(infinity->Query("INSERT INTO t1 VALUES (104, 'e'), (102, 'c'), (100, 'a'), (103, 'd'), (101, 'b')").IsOk());
+    EXPECT_EQ(SegmentCount(infinity.get(), "t1"), 2u);
+    ASSERT_TRUE(infinity->Query("INSERT INTO t1 VALUES (203, 'd'), (202, 'c'), (201, 'b'), (200, 'a')").IsOk());
+    EXPECT_EQ(SegmentCount(infinity.get(), "t1"), 3u);
+
+    Vector<i32> all = QueryIntegers(infinity.get(), "SELECT c1 FROM t1");
+    std::sort(all.begin(), all.end());
+    EXPECT_EQ(all, (Vector<i32>{10, 11, 100, 101, 102, 103, 104, 200, 201, 202, 203}));
+
+    EXPECT_EQ(QueryIntegers(infinity.get(), "SELECT c1 FROM t1 WHERE c1 >= 100 AND c1 < 200"), (Vector<i32>{100, 101, 102, 103, 104}));
+    EXPECT_EQ(QueryIntegers(infinity.get(), "SELECT c1 FROM t1 WHERE c1 >= 200"), (Vector<i32>{200, 201, 202, 203}));
+    // the other columns are moved with the key
+    {
+        QueryResult result = infinity->Query("SELECT c2 FROM t1 WHERE c1 = 103");
+        ASSERT_TRUE(result.IsOk());
+        ASSERT_EQ(result.result_table_->DataBlockCount(), 1u);
+        EXPECT_EQ(result.result_table_->GetDataBlockById(0)->GetValue(0, 0).GetVarchar(), "d");
+    }
+}
+
+TEST_F(PhysicalInsertTest, test_bulk_insert_columnar) {
+    SharedPtr<Infinity> infinity = Infinity::LocalConnect();
+    ASSERT_TRUE(infinity->Query("CREATE TABLE t2 (c1 INTEGER, c2 INTEGER) PROPERTIES (sort_key = c1)").IsOk());
+
+    // two blocks of rows in descending order
+    constexpr i32 row_count = 10000;
+    Vector<i32> c1(row_count);
+    Vector<i32> c2(row_count);
+    for (i32 i = 0; i < row_count; ++i) {
+        c1[i] = row_count - 1 - i;
+        c2[i] = c1[i] * 2;
+    }
+    Vector<Vector<std::string_view>> column_data(2);
+    column_data[0].emplace_back(reinterpret_cast<const char *>(c1.data()), row_count * sizeof(i32));
+    column_data[1].emplace_back(reinterpret_cast<const char *>(c2.data()), row_count * sizeof(i32));
+    ASSERT_TRUE(infinity->InsertColumnar("default", "t2", nullptr, std::move(column_data)).IsOk());
+    EXPECT_EQ(SegmentCount(infinity.get(), "t2"), 1u);
+
+    EXPECT_EQ(QueryIntegers(infinity.get(), "SELECT c1 FROM t2").size(), SizeT(row_count));
+    // the first block holds the smallest keys in order
+    Vector<i32> expected(DEFAULT_BLOCK_CAPACITY);
+    std::iota(expected.begin(), expected.end(), 0);
+    EXPECT_EQ(QueryIntegers(infinity.get(), fmt::format("SELECT c1 FROM t2 WHERE c1 < {}", DEFAULT_BLOCK_CAPACITY)), expected);
+    EXPECT_EQ(QueryIntegers(infinity.get(), "SELECT c2 FROM t2 WHERE c1 = 5000"), (Vector<i32>{10000}));
+}
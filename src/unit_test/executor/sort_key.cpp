@@ -0,0 +1,165 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "unit_test/base_test.h"
+
+import stl;
+import sort_key;
+import column_vector;
+import value;
+import logical_type;
+import internal_types;
+import data_type;
+import select_statement;
+import third_party;
+
+class SortKeyTest : public BaseTest {};
+
+TEST_F(SortKeyTest, integer_order) {
+    using namespace infinity;
+
+    SharedPtr<DataType> bigint_type = MakeShared<DataType>(LogicalType::kBigInt);
+    Vector<i64> values{0, -1, 1, std::numeric_limits<i64>::min(), std::numeric_limits<i64>::max(), -1000, 1000};
+    SharedPtr<ColumnVector> column = ColumnVector::Make(bigint_type);
+    column->Initialize();
+    for (i64 value : values) {
+        column->AppendValue(Value::MakeBigInt(value));
+    }
+
+    SortKeyEncoder asc_encoder({bigint_type}, {OrderType::kAsc});
+    SortKeys asc_keys;
+    asc_encoder.Encode({column}, values.size(), asc_keys);
+    SortKeyEncoder desc_encoder({bigint_type}, {OrderType::kDesc});
+    SortKeys desc_keys;
+    desc_encoder.Encode({column}, values.size(), desc_keys);
+    EXPECT_EQ(asc_keys.Count(), values.size());
+    for (SizeT i = 0; i < values.size(); ++i) {
+        for (SizeT j = 0; j < values.size(); ++j) {
+            EXPECT_EQ(asc_keys.Key(i) < asc_keys.Key(j), values[i] < values[j]);
+            EXPECT_EQ(desc_keys.Key(i) < desc_keys.Key(j), values[i] > values[j]);
+        }
+    }
+}
+
+TEST_F(SortKeyTest, double_order) {
+    using namespace infinity;
+
+    SharedPtr<DataType> double_type = MakeShared<DataType>(LogicalType::kDouble);
+    Vector<f64> values{0.0, -0.5, 0.5, -1e100, 1e100, -3.25, 3.25};
+    SharedPtr<ColumnVector> column = ColumnVector::Make(double_type);
+    column->Initialize();
+    for (f64 value : values) {
+        column->AppendValue(Value::MakeDouble(value));
+    }
+
+    SortKeyEncoder encoder({double_type}, {OrderType::kAsc});
+    SortKeys keys;
+    encoder.Encode({column}, values.size(), keys);
+    for (SizeT i = 0; i < values.size(); ++i) {
+        for (SizeT j = 0; j < values.size(); ++j) {
+            EXPECT_EQ(keys.Key(i) < keys.Key(j), values[i] < values[j]);
+        }
+    }
+}
+
+TEST_F(SortKeyTest, varchar_and_multiple_keys) {
+    using namespace infinity;
+
+    SharedPtr<DataType> varchar_type = MakeShared<DataType>(LogicalType::kVarchar);
+    SharedPtr<DataType> int_type = MakeShared<DataType>(LogicalType::kInteger);
+    // A prefix is less than the longer string, and the second key is only compared on equal strings.
+    Vector<String> strings{"abc", "ab", "abc", "a_long_varchar_not_inlined_b", "a_long_varchar_not_inlined_a", ""};
+    Vector<i32> integers{2, 5, 1, 0, 9, 3};
+    SharedPtr<ColumnVector> varchar_column = ColumnVector::Make(varchar_type);
+    SharedPtr<ColumnVector> int_column = ColumnVector::Make(int_type);
+    varchar_column->Initialize();
+    int_column->Initialize();
+    for (SizeT row_idx = 0; row_idx < strings.size(); ++row_idx) {
+        varchar_column->AppendValue(Value::MakeVarchar(strings[row_idx]));
+        int_column->AppendValue(Value::MakeInt(integers[row_idx]));
+    }
+
+    SortKeyEncoder encoder({varchar_type, int_type}, {OrderType::kAsc, OrderType::kDesc});
+    SortKeys keys;
+    encoder.Encode({varchar_column, int_column}, strings.size(), keys);
+    for (SizeT i = 0; i < strings.size(); ++i) {
+        for (SizeT j = 0; j < strings.size(); ++j) {
+            bool expected_less = strings[i] < strings[j] || (strings[i] == strings[j] && integers[i] > integers[j]);
+            EXPECT_EQ(keys.Key(i) < keys.Key(j), expected_less);
+        }
+    }
+}
+
+TEST_F(SortKeyTest, loser_tree) {
+    using namespace infinity;
+
+    Vector<Vector<String>> runs{{"b", "d", "f"}, {}, {"a", "d", "e", "g"}, {"c"}, {"d"}};
+    Vector<SizeT> positions(runs.size(), 0);
+    Vector<Optional<std::string_view>> first_keys;
+    for (const auto &run : runs) {
+        first_keys.emplace_back(run.empty() ? Optional<std::string_view>() : Optional<std::string_view>(run[0]));
+    }
+
+    SortKeyLoserTree loser_tree(std::move(first_keys));
+    Vector<Pair<String, SizeT>> merged;
+    while (!loser_tree.Empty()) {
+        SizeT run_idx = loser_tree.Winner();
+        merged.emplace_back(String(loser_tree.WinnerKey()), run_idx);
+        SizeT next_pos = ++positions[run_idx];
+        loser_tree.ReplaceWinner(next_pos < runs[run_idx].size() ? Optional<std::string_view>(runs[run_idx][next_pos]) : Optional<std::string_view>());
+    }
+
+    // Equal keys are merged in the order of runs.
+    Vector<Pair<String, SizeT>> expected{{"a", 2}, {"b", 0}, {"c", 3}, {"d", 0}, {"d", 2}, {"d", 4}, {"e", 2}, {"f", 0}, {"g", 2}};
+    EXPECT_EQ(merged, expected);
+}
+
+TEST_F(SortKeyTest, fixed_width_order) {
+    using namespace infinity;
+
+    SharedPtr<DataType> int_type = MakeShared<DataType>(LogicalType::kInteger);
+    SharedPtr<DataType> float_type = MakeShared<DataType>(LogicalType::kFloat);
+    EXPECT_TRUE(SortKeyEncoder::FixedWidth(*int_type));
+    EXPECT_TRUE(SortKeyEncoder::FixedWidth(*float_type));
+    EXPECT_FALSE(SortKeyEncoder::FixedWidth(DataType(LogicalType::kVarchar)));
+
+    Vector<i32> integers{0, -1, 1, std::numeric_limits<i32>::min(), std::numeric_limits<i32>::max(), -7};
+    Vector<f32> floats{0.0f, -0.5f, 0.5f, -1e30f, 1e30f, -7.0f};
+    SharedPtr<ColumnVector> int_column = ColumnVector::Make(int_type);
+    SharedPtr<ColumnVector> float_column = ColumnVector::Make(float_type);
+    int_column->Initialize();
+    float_column->Initialize();
+    for (SizeT row_idx = 0; row_idx < integers.size(); ++row_idx) {
+        int_column->AppendValue(Value::MakeInt(integers[row_idx]));
+        float_column->AppendValue(Value::MakeFloat(floats[row_idx]));
+    }
+
+    for (SizeT i = 0; i < integers.size(); ++i) {
+        for (SizeT j = 0; j < integers.size(); ++j) {
+            u64 asc_i = SortKeyEncoder::EncodeFixed(*int_column, *int_type, OrderType::kAsc, i);
+            u64 asc_j = SortKeyEncoder::EncodeFixed(*int_column, *int_type, OrderType::kAsc, j);
+            EXPECT_EQ(asc_i < asc_j, integers[i] < integers[j]);
+            u64 desc_i = SortKeyEncoder::EncodeFixed(*float_column, *float_type, OrderType::kDesc, i);
+            u64 desc_j = SortKeyEncoder::EncodeFixed(*float_column, *float_type, OrderType::kDesc, j);
+            EXPECT_EQ(desc_i < desc_j, floats[i] > floats[j]);
+        }
+    }
+}
+
+TEST_F(SortKeyTest, order_by_fixed_keys) {
+    Vector<u64> keys{5, 3, 9, 1, 7, 3};
+    EXPECT_EQ(OrderByFixedKeys(keys), (Vector<u32>{3, 1, 5, 0, 4, 2}));
+    EXPECT_TRUE(OrderByFixedKeys(Vector<u64>{}).empty());
+}
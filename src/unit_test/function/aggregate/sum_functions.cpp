@@ -242,3 +242,130 @@ TEST_F(SumFunctionTest, avg_func) {
         EXPECT_THROW(aggregate_function_set->GetMostMatchFunction(col_expr_ptr), UnrecoverableException);
     }
 }
+
+TEST_F(SumFunctionTest, sum_func_nulls) {
+    using namespace infinity;
+
+    UniquePtr<Catalog> catalog_ptr = MakeUnique<Catalog>(MakeShared<String>("/tmp/infinity/data"));
+
+    RegisterSumFunction(catalog_ptr);
+
+    String op = "sum";
+    SharedPtr<FunctionSet> function_set = Catalog::GetFunctionSetByName(catalog_ptr.get(), op);
+    EXPECT_EQ(function_set->type_, FunctionType::kAggregate);
+    SharedPtr<AggregateFunctionSet> aggregate_function_set = std::static_pointer_cast<AggregateFunctionSet>(function_set);
+
+    // The rows cover an all-null unit of the null mask, a mixed one, an all-valid one and a trailing partial one.
+    // The null rows hold a large value, the result is checked against the rows reduced one by one.
+    SizeT row_count = 200;
+    auto is_null = [](SizeT i) { return i < 64 || (i < 128 && i % 3 == 0) || (i >= 192 && i % 2 == 0); };
+    auto row_value = [](SizeT i) { return static_cast<i64>(i * 37 % 101) - 50; };
+    {
+        SharedPtr<DataType> data_type = MakeShared<DataType>(LogicalType::kBigInt);
+        SharedPtr<ColumnExpression> col_expr_ptr = MakeShared<ColumnExpression>(*data_type, "t1", 1, "c1", 0, 0);
+
+        AggregateFunction func = aggregate_function_set->GetMostMatchFunction(col_expr_ptr);
+        EXPECT_STREQ("SUM(BigInt)->BigInt", func.ToString().c_str());
+
+        Vector<SharedPtr<DataType>> column_types;
+        column_types.emplace_back(data_type);
+
+        DataBlock data_block;
+        data_block.Init(column_types);
+
+        auto data_state = func.InitState();
+        func.init_func_(data_state.get());
+        BigIntT expected = *(BigIntT *)func.finalize_func_(data_state.get());
+        for (SizeT i = 0; i < row_count; ++i) {
+            if (is_null(i)) {
+                data_block.AppendValue(0, Value::MakeBigInt(1000000));
+                continue;
+            }
+            BigIntT value = row_value(i);
+            data_block.AppendValue(0, Value::MakeBigInt(value));
+            expected += value;
+        }
+        data_block.Finalize();
+        for (SizeT i = 0; i < row_count; ++i) {
+            if (is_null(i)) {
+                data_block.column_vectors[0]->nulls_ptr_->SetFalse(i);
+            }
+        }
+
+        func.update_func_(data_state.get(), data_block.column_vectors[0]);
+        BigIntT result;
+        result = *(BigIntT *)func.finalize_func_(data_state.get());
+
+        EXPECT_EQ(expected, result);
+    }
+
+    {
+        SharedPtr<DataType> data_type = MakeShared<DataType>(LogicalType::kDouble);
+        SharedPtr<ColumnExpression> col_expr_ptr = MakeShared<ColumnExpression>(*data_type, "t1", 1, "c1", 0, 0);
+
+        AggregateFunction func = aggregate_function_set->GetMostMatchFunction(col_expr_ptr);
+        EXPECT_STREQ("SUM(Double)->Double", func.ToString().c_str());
+
+        Vector<SharedPtr<DataType>> column_types;
+        column_types.emplace_back(data_type);
+
+        DataBlock data_block;
+        data_block.Init(column_types);
+
+        auto data_state = func.InitState();
+        func.init_func_(data_state.get());
+        DoubleT expected = *(DoubleT *)func.finalize_func_(data_state.get());
+        for (SizeT i = 0; i < row_count; ++i) {
+            if (is_null(i)) {
+                data_block.AppendValue(0, Value::MakeDouble(1000000));
+                continue;
+            }
+            DoubleT value = row_value(i);
+            data_block.AppendValue(0, Value::MakeDouble(value));
+            expected += value;
+        }
+        data_block.Finalize();
+        for (SizeT i = 0; i < row_count; ++i) {
+            if (is_null(i)) {
+                data_block.column_vectors[0]->nulls_ptr_->SetFalse(i);
+            }
+        }
+
+        func.update_func_(data_state.get(), data_block.column_vectors[0]);
+        DoubleT result;
+        result = *(DoubleT *)func.finalize_func_(data_state.get());
+
+        EXPECT_EQ(expected, result);
+    }
+
+    {
+        // only nulls leave the initial state
+        SharedPtr<DataType> data_type = MakeShared<DataType>(LogicalType::kBigInt);
+        SharedPtr<ColumnExpression> col_expr_ptr = MakeShared<ColumnExpression>(*data_type, "t1", 1, "c1", 0, 0);
+
+        AggregateFunction func = aggregate_function_set->GetMostMatchFunction(col_expr_ptr);
+
+        Vector<SharedPtr<DataType>> column_types;
+        column_types.emplace_back(data_type);
+
+        DataBlock data_block;
+        data_block.Init(column_types);
+
+        auto data_state = func.InitState();
+        func.init_func_(data_state.get());
+        BigIntT expected = *(BigIntT *)func.finalize_func_(data_state.get());
+        for (SizeT i = 0; i < row_count; ++i) {
+            data_block.AppendValue(0, Value::MakeBigInt(1000000));
+        }
+        data_block.Finalize();
+        for (SizeT i = 0; i < row_count; ++i) {
+            data_block.column_vectors[0]->nulls_ptr_->SetFalse(i);
+        }
+
+        func.update_func_(data_state.get(), data_block.column_vectors[0]);
+        BigIntT result;
+        result = *(BigIntT *)func.finalize_func_(data_state.get());
+
+        EXPECT_EQ(expected, result);
+    }
+}
@@ -37,6 +37,8 @@ import internal_types;
 import logical_type;
 import data_type;
 import logical_type;
+import bound_cast_func;
+import embedding_info;
 
 class VarcharTest : public BaseTest {};
 
@@ -291,3 +293,36 @@ TEST_F(VarcharTest, varchar_cast1) {
         EXPECT_FLOAT_EQ(target, -1000000000345345.4565544);
     }
 }
+
+TEST_F(VarcharTest, varchar_cast_embedding) {
+    using namespace infinity;
+    SharedPtr<DataType> source_type = MakeShared<DataType>(LogicalType::kVarchar);
+    auto input_column_vector = MakeShared<ColumnVector>(source_type);
+    input_column_vector->Initialize();
+    Vector<String> strs = {"[1.5,2,3.25]", "[ 4 , 5 6 ]", "[1,2,3,4]", "[1,x,3]", "[7.5,8.5,9.5,       ]"};
+    for (const String &str : strs) {
+        input_column_vector->AppendValue(Value::MakeVarchar(str));
+    }
+
+    auto embedding_info = EmbeddingInfo::Make(EmbeddingDataType::kElemFloat, 3);
+    SharedPtr<DataType> target_type = MakeShared<DataType>(LogicalType::kEmbedding, embedding_info);
+    auto cast_func = BindVarcharCast(*source_type, *target_type);
+    EXPECT_NE(cast_func.function, nullptr);
+    auto target_column_vector = MakeShared<ColumnVector>(target_type);
+    target_column_vector->Initialize();
+    CastParameters cast_parameters;
+    // the third string has too many elements and the fourth isn't a number, so they are cast to null
+    EXPECT_FALSE(cast_func.function(input_column_vector, target_column_vector, strs.size(), cast_parameters));
+
+    const auto *data = reinterpret_cast<const float *>(target_column_vector->data());
+    Vector<float> expected = {1.5f, 2.0f, 3.25f, 4.0f, 5.0f, 6.0f};
+    for (SizeT i = 0; i < expected.size(); ++i) {
+        EXPECT_FLOAT_EQ(data[i], expected[i]);
+    }
+    EXPECT_TRUE(target_column_vector->nulls_ptr_->IsTrue(0));
+    EXPECT_TRUE(target_column_vector->nulls_ptr_->IsTrue(1));
+    EXPECT_FALSE(target_column_vector->nulls_ptr_->IsTrue(2));
+    EXPECT_FALSE(target_column_vector->nulls_ptr_->IsTrue(3));
+    EXPECT_TRUE(target_column_vector->nulls_ptr_->IsTrue(4));
+    EXPECT_FLOAT_EQ(data[14], 9.5f);
+}
@@ -500,3 +500,62 @@ TEST_F(LessFunctionsTest, less_func) {
     }
 #endif
 }
+
+TEST_F(LessFunctionsTest, less_func_with_null) {
+    using namespace infinity;
+
+    UniquePtr<Catalog> catalog_ptr = MakeUnique<Catalog>(MakeShared<String>("/tmp/infinity/data"));
+
+    RegisterLessFunction(catalog_ptr);
+
+    String op = "<";
+    SharedPtr<FunctionSet> function_set = Catalog::GetFunctionSetByName(catalog_ptr.get(), op);
+    SharedPtr<ScalarFunctionSet> scalar_function_set = std::static_pointer_cast<ScalarFunctionSet>(function_set);
+
+    Vector<SharedPtr<BaseExpression>> inputs;
+
+    SharedPtr<DataType> data_type = MakeShared<DataType>(LogicalType::kInteger);
+    SharedPtr<DataType> result_type = MakeShared<DataType>(LogicalType::kBoolean);
+    SharedPtr<ColumnExpression> col1_expr_ptr = MakeShared<ColumnExpression>(*data_type, "t1", 1, "c1", 0, 0);
+    SharedPtr<ColumnExpression> col2_expr_ptr = MakeShared<ColumnExpression>(*data_type, "t1", 1, "c2", 1, 0);
+
+    inputs.emplace_back(col1_expr_ptr);
+    inputs.emplace_back(col2_expr_ptr);
+
+    ScalarFunction func = scalar_function_set->GetMostMatchFunction(inputs);
+    EXPECT_STREQ("<(Integer, Integer)->Boolean", func.ToString().c_str());
+
+    Vector<SharedPtr<DataType>> column_types;
+    column_types.emplace_back(data_type);
+    column_types.emplace_back(data_type);
+
+    // not a multiple of the 64 rows of a unit, some units have nulls and some are all valid
+    SizeT row_count = 1000;
+
+    DataBlock data_block;
+    data_block.Init(column_types);
+
+    for (SizeT i = 0; i < row_count; ++i) {
+        data_block.AppendValue(0, Value::MakeInt(static_cast<i32>(i)));
+        data_block.AppendValue(1, Value::MakeInt(static_cast<i32>(i % 3 == 0 ? i : i + 1)));
+    }
+    data_block.Finalize();
+    for (SizeT i = 0; i < 256; i += 7) {
+        data_block.column_vectors[0]->nulls_ptr_->SetFalse(i);
+    }
+
+    SharedPtr<ColumnVector> result = MakeShared<ColumnVector>(result_type);
+    result->Initialize();
+    func.function_(data_block, result);
+
+    for (SizeT i = 0; i < row_count; ++i) {
+        if (i < 256 && i % 7 == 0) {
+            EXPECT_FALSE(result->nulls_ptr_->IsTrue(i));
+            continue;
+        }
+        EXPECT_TRUE(result->nulls_ptr_->IsTrue(i));
+        Value v = result->GetValue(i);
+        EXPECT_EQ(v.type_.type(), LogicalType::kBoolean);
+        EXPECT_EQ(v.value_.boolean, i % 3 != 0);
+    }
+}
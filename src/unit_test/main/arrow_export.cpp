@@ -0,0 +1,110 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "unit_test/base_test.h"
+
+import stl;
+import infinity;
+import query_result;
+import arrow_export;
+import status;
+
+class ArrowExportTest : public BaseTest {
+    void SetUp() override {
+        BaseTest::SetUp();
+        system("rm -rf /tmp/infinity/log /tmp/infinity/data /tmp/infinity/wal");
+    }
+    void TearDown() override {
+        system("rm -rf /tmp/infinity/log /tmp/infinity/data /tmp/infinity/wal");
+        BaseTest::TearDown();
+    }
+};
+
+TEST_F(ArrowExportTest, test_export_result) {
+    using namespace infinity;
+    String path = "/tmp/infinity";
+
+    Infinity::LocalInit(path);
+
+    SharedPtr<Infinity> infinity = Infinity::LocalConnect();
+
+    {
+        QueryResult result = infinity->Query("CREATE TABLE arrow_export (c1 INT, c2 VARCHAR, c3 EMBEDDING(FLOAT, 2));");
+        EXPECT_TRUE(result.IsOk());
+        result = infinity->Query("INSERT INTO arrow_export VALUES (1, 'a', [0.1, 0.2]), (2, 'abcdefghijklmnopq', [0.3, 0.4]);");
+        EXPECT_TRUE(result.IsOk());
+    }
+
+    {
+        QueryResult result = infinity->Query("SELECT c1, c2, c3 FROM arrow_export;");
+        EXPECT_TRUE(result.IsOk());
+        ArrowArrayStream stream{};
+        Status status = ArrowExport::ExportResult(result, &stream);
+        EXPECT_TRUE(status.ok());
+
+        ArrowSchema schema{};
+        EXPECT_EQ(stream.get_schema(&stream, &schema), 0);
+        EXPECT_STREQ(schema.format, "+s");
+        EXPECT_EQ(schema.n_children, 3);
+        EXPECT_STREQ(schema.children[0]->format, "i");
+        EXPECT_STREQ(schema.children[0]->name, "c1");
+        EXPECT_STREQ(schema.children[1]->format, "u");
+        EXPECT_STREQ(schema.children[2]->format, "+w:2");
+        EXPECT_STREQ(schema.children[2]->children[0]->format, "f");
+        schema.release(&schema);
+
+        ArrowArray array{};
+        EXPECT_EQ(stream.get_next(&stream, &array), 0);
+        EXPECT_EQ(array.length, 2);
+        EXPECT_EQ(array.n_children, 3);
+
+        const ArrowArray *c1 = array.children[0];
+        const auto *c1_values = static_cast<const i32 *>(c1->buffers[1]);
+        EXPECT_EQ(c1->null_count, 0);
+        EXPECT_EQ(c1_values[0], 1);
+        EXPECT_EQ(c1_values[1], 2);
+        // The integers are not copied, the array points at the column vector of the result.
+        EXPECT_EQ(c1->buffers[1], static_cast<const void *>(result.result_table_->GetDataBlockById(0)->column_vectors[0]->data()));
+
+        const ArrowArray *c2 = array.children[1];
+        const auto *c2_offsets = static_cast<const i32 *>(c2->buffers[1]);
+        const auto *c2_chars = static_cast<const char *>(c2->buffers[2]);
+        EXPECT_EQ(String(c2_chars + c2_offsets[0], c2_offsets[1] - c2_offsets[0]), "a");
+        EXPECT_EQ(String(c2_chars + c2_offsets[1], c2_offsets[2] - c2_offsets[1]), "abcdefghijklmnopq");
+
+        const ArrowArray *c3_elements = array.children[2]->children[0];
+        const auto *c3_values = static_cast<const f32 *>(c3_elements->buffers[1]);
+        EXPECT_EQ(c3_elements->length, 4);
+        EXPECT_FLOAT_EQ(c3_values[3], 0.4f);
+
+        // The exported stream and arrays keep the columns alive after the result is gone.
+        result = QueryResult::UnusedResult();
+        EXPECT_EQ(c1_values[1], 2);
+        array.release(&array);
+        EXPECT_EQ(array.release, nullptr);
+
+        EXPECT_EQ(stream.get_next(&stream, &array), 0);
+        EXPECT_EQ(array.release, nullptr);
+        stream.release(&stream);
+    }
+
+    {
+        QueryResult result = infinity->Query("DROP TABLE arrow_export;");
+        EXPECT_TRUE(result.IsOk());
+    }
+
+    infinity->LocalDisconnect();
+
+    Infinity::LocalUnInit();
+}
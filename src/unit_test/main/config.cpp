@@ -19,6 +19,8 @@ import config;
 import infinity_exception;
 import third_party;
 import compilation_config;
+import options;
+import status;
 
 class ConfigTest : public BaseTest {};
 
@@ -48,6 +50,7 @@ TEST_F(ConfigTest, test1) {
     EXPECT_EQ(config.pg_port(), 5432);
     EXPECT_EQ(config.http_port(), 23820u);
     EXPECT_EQ(config.sdk_port(), 23817u);
+    EXPECT_EQ(config.mux_sdk_port(), 23818u);
 
     // Log
     EXPECT_EQ(*config.log_filename(), "infinity.log");
@@ -85,6 +88,7 @@ TEST_F(ConfigTest, test2) {
     EXPECT_EQ(config.pg_port(), 25432);
     EXPECT_EQ(config.http_port(), 24821u);
     EXPECT_EQ(config.sdk_port(), 24817u);
+    EXPECT_EQ(config.mux_sdk_port(), 24818u);
 
     EXPECT_EQ(*config.log_filename(), "info.log");
     EXPECT_EQ(*config.log_dir(), "/var/infinity/log");
@@ -101,3 +105,71 @@ TEST_F(ConfigTest, test2) {
     EXPECT_EQ(config.buffer_pool_size(), 3 * 1024ul * 1024ul * 1024ul);
     EXPECT_EQ(*config.temp_dir(), "/tmp");
 }
+
+TEST_F(ConfigTest, test_sharding) {
+    using namespace infinity;
+    {
+        SharedPtr<String> path = nullptr;
+        Config config;
+        config.Init(path);
+        EXPECT_TRUE(config.shard_addresses().empty());
+        EXPECT_EQ(config.shard_timeout_ms(), 1000u);
+    }
+    {
+        SharedPtr<String> path = MakeShared<String>(String(test_data_path()) + "/config/test_sharding.toml");
+        Config config;
+        config.Init(path);
+        EXPECT_EQ(config.shard_addresses(), (Vector<String>{"10.0.0.1:23820", "10.0.0.2:23820", "10.0.0.3:23820"}));
+        EXPECT_EQ(config.shard_key(), "id");
+        EXPECT_EQ(config.shard_timeout_ms(), 200u);
+    }
+}
+
+TEST_F(ConfigTest, test_wal_group_commit) {
+    using namespace infinity;
+    {
+        SharedPtr<String> path = nullptr;
+        Config config;
+        config.Init(path);
+        EXPECT_EQ(config.wal_group_commit_max_entries(), 1024u);
+        EXPECT_EQ(config.wal_group_commit_latency_us(), 0u);
+    }
+    {
+        SharedPtr<String> path = MakeShared<String>(String(test_data_path()) + "/config/test_wal_group_commit.toml");
+        Config config;
+        Status status = config.Init(path);
+        EXPECT_TRUE(status.ok());
+        EXPECT_EQ(config.flush_at_commit(), FlushOption::kFlushAtOnce);
+        EXPECT_EQ(config.wal_group_commit_max_entries(), 4u);
+        EXPECT_EQ(config.wal_group_commit_latency_us(), 200u);
+    }
+    {
+        SharedPtr<String> path = MakeShared<String>(String(test_data_path()) + "/config/test_wal_group_commit_invalid.toml");
+        Config config;
+        Status status = config.Init(path);
+        EXPECT_EQ(status.code(), ErrorCode::kConfigurationLimitExceed);
+    }
+}
+
+TEST_F(ConfigTest, test_ttl_interval) {
+    using namespace infinity;
+    {
+        SharedPtr<String> path = nullptr;
+        Config config;
+        config.Init(path);
+        EXPECT_EQ(config.ttl_interval(), std::chrono::seconds(60));
+    }
+    {
+        SharedPtr<String> path = MakeShared<String>(String(test_data_path()) + "/config/test_ttl_interval.toml");
+        Config config;
+        Status status = config.Init(path);
+        EXPECT_TRUE(status.ok());
+        EXPECT_EQ(config.ttl_interval(), std::chrono::seconds(600));
+    }
+    {
+        SharedPtr<String> path = MakeShared<String>(String(test_data_path()) + "/config/test_ttl_interval_invalid.toml");
+        Config config;
+        Status status = config.Init(path);
+        EXPECT_EQ(status.code(), ErrorCode::kInvalidParameterValue);
+    }
+}
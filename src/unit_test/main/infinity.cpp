@@ -283,6 +283,11 @@ TEST_F(InfinityTest, test2) {
         EXPECT_EQ(result.IsOk(), true);
     }
 
+    {
+        QueryResult result = infinity->ShowVariable("background_task_queue");
+        EXPECT_EQ(result.IsOk(), true);
+    }
+
     {
         QueryResult result = infinity->ShowVariable("error");
         EXPECT_EQ(result.IsOk(), false);
@@ -90,4 +90,42 @@ TEST_F(QueryProfilerTest, test3) {
     profiler.StopPhase(infinity::QueryPhase::kExecution);
 
     std::cout << profiler.ToString() << std::endl;
-}
\ No newline at end of file
+}
+TEST_F(QueryProfilerTest, test4) {
+    infinity::QueryPhaseTimer timer;
+    EXPECT_FALSE(timer.started());
+    timer.Begin();
+    EXPECT_TRUE(timer.started());
+    timer.StartPhase(infinity::QueryPhase::kParser);
+    usleep(10 * 1000);
+    timer.StopPhase();
+    timer.StartPhase(infinity::QueryPhase::kExecution);
+    usleep(10 * 1000);
+    infinity::u64 duration_ns = timer.End();
+    EXPECT_FALSE(timer.started());
+
+    // The phase left running is stopped at the end
+    EXPECT_GE(timer.PhaseNanoSeconds(infinity::QueryPhase::kParser), 5'000'000u);
+    EXPECT_GE(timer.PhaseNanoSeconds(infinity::QueryPhase::kExecution), 5'000'000u);
+    EXPECT_EQ(timer.PhaseNanoSeconds(infinity::QueryPhase::kOptimizer), 0u);
+    EXPECT_GE(duration_ns, timer.PhaseNanoSeconds(infinity::QueryPhase::kParser));
+}
+
+TEST_F(QueryProfilerTest, test5) {
+    infinity::SlowQueryLog slow_query_log(3);
+    EXPECT_TRUE(slow_query_log.GetRecords().empty());
+    for (infinity::u64 session_id = 1; session_id <= 5; ++session_id) {
+        infinity::SlowQueryRecord record;
+        record.session_id_ = session_id;
+        record.query_text_ = "select " + std::to_string(session_id);
+        slow_query_log.Append(std::move(record));
+    }
+
+    // The oldest records are dropped, the rest are from the oldest to the latest
+    auto records = slow_query_log.GetRecords();
+    ASSERT_EQ(records.size(), 3u);
+    EXPECT_EQ(records[0].session_id_, 3u);
+    EXPECT_EQ(records[1].session_id_, 4u);
+    EXPECT_EQ(records[2].session_id_, 5u);
+    EXPECT_EQ(records[2].query_text_, "select 5");
+}
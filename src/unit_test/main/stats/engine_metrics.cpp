@@ -0,0 +1,61 @@
+// Copyright(C) 2024 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "unit_test/base_test.h"
+
+import stl;
+import engine_metrics;
+
+using namespace infinity;
+
+class EngineMetricsTest : public BaseTest {};
+
+TEST_F(EngineMetricsTest, counter_test) {
+    MetricCounter counter;
+    Vector<Thread> threads;
+    for (SizeT thread_idx = 0; thread_idx < 4; ++thread_idx) {
+        threads.emplace_back([&counter] {
+            for (SizeT i = 0; i < 1000; ++i) {
+                counter.Add();
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(counter.Value(), 4000u);
+}
+
+TEST_F(EngineMetricsTest, histogram_test) {
+    MetricHistogram histogram({10, 100});
+    histogram.Observe(5);
+    histogram.Observe(10);
+    histogram.Observe(50);
+    histogram.Observe(1000);
+
+    Vector<u64> bucket_counts;
+    u64 sum = 0;
+    histogram.Collect(bucket_counts, sum);
+    EXPECT_EQ(bucket_counts, Vector<u64>({2, 3, 4}));
+    EXPECT_EQ(sum, 1065u);
+
+    MetricsWriter writer;
+    writer.WriteHistogram("latency", "kind=\"a\"", histogram, 0.5);
+    EXPECT_EQ(writer.text(),
+              "latency_bucket{kind=\"a\",le=\"5\"} 2\n"
+              "latency_bucket{kind=\"a\",le=\"50\"} 3\n"
+              "latency_bucket{kind=\"a\",le=\"+Inf\"} 4\n"
+              "latency_sum{kind=\"a\"} 532.5\n"
+              "latency_count{kind=\"a\"} 4\n");
+}
@@ -0,0 +1,85 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "unit_test/base_test.h"
+
+import stl;
+import index_build_progress;
+
+class IndexBuildProgressTest : public BaseTest {};
+
+TEST_F(IndexBuildProgressTest, progress_test) {
+    using namespace infinity;
+
+    IndexBuildProgress progress("default_db", "t1", "idx1", IndexBuildPhase::kCreate);
+    IndexBuildProgressInfo info = progress.Snapshot();
+    EXPECT_EQ(info.rows_total_, 0u);
+    EXPECT_EQ(info.current_segment_, -1);
+    EXPECT_EQ(info.eta_ns_, -1);
+
+    progress.AddSegment(8192);
+    progress.AddSegment(1808);
+    progress.BeginSegment(0);
+    progress.AddRowsDone(4096);
+    info = progress.Snapshot();
+    EXPECT_EQ(info.db_name_, "default_db");
+    EXPECT_EQ(info.table_name_, "t1");
+    EXPECT_EQ(info.index_name_, "idx1");
+    EXPECT_EQ(info.phase_, IndexBuildPhase::kCreate);
+    EXPECT_EQ(info.rows_done_, 4096u);
+    EXPECT_EQ(info.rows_total_, 10000u);
+    EXPECT_EQ(info.segments_done_, 0u);
+    EXPECT_EQ(info.segments_total_, 2u);
+    EXPECT_EQ(info.current_segment_, 0);
+    EXPECT_GT(info.rows_per_second_, 0);
+    EXPECT_GE(info.eta_ns_, 0);
+
+    progress.AddRowsDone(4096);
+    progress.FinishSegment();
+    progress.BeginSegment(1);
+    progress.AddRowsDone(1808);
+    progress.FinishSegment();
+    info = progress.Snapshot();
+    EXPECT_EQ(info.rows_done_, info.rows_total_);
+    EXPECT_EQ(info.segments_done_, 2u);
+    EXPECT_EQ(info.current_segment_, 1);
+    EXPECT_EQ(info.eta_ns_, 0);
+}
+
+TEST_F(IndexBuildProgressTest, registry_test) {
+    using namespace infinity;
+
+    IndexBuildRegistry &registry = IndexBuildRegistry::instance();
+    SharedPtr<IndexBuildProgress> build2 = registry.Begin("default_db", "t2", "idx1", IndexBuildPhase::kOptimize);
+    SharedPtr<IndexBuildProgress> build1 = registry.Begin("default_db", "t1", "idx1", IndexBuildPhase::kCreate);
+    build1->AddSegment(100);
+
+    Vector<IndexBuildProgressInfo> builds = registry.Builds();
+    ASSERT_EQ(builds.size(), 2u);
+    EXPECT_EQ(builds[0].table_name_, "t1");
+    EXPECT_EQ(builds[0].rows_total_, 100u);
+    EXPECT_EQ(builds[1].table_name_, "t2");
+    EXPECT_EQ(IndexBuildPhaseToString(builds[1].phase_), "optimize");
+
+    builds = registry.Builds("default_db", "t2", "idx1");
+    ASSERT_EQ(builds.size(), 1u);
+    EXPECT_EQ(builds[0].phase_, IndexBuildPhase::kOptimize);
+    EXPECT_TRUE(registry.Builds("default_db", "t2", "idx2").empty());
+
+    registry.End(build1.get());
+    registry.End(build2.get());
+    // ending a build twice is harmless
+    registry.End(build2.get());
+    EXPECT_TRUE(registry.Builds().empty());
+}
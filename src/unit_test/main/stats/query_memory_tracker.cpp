@@ -0,0 +1,57 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "unit_test/base_test.h"
+
+import stl;
+import query_memory_tracker;
+import global_resource_usage;
+import infinity_exception;
+
+class QueryMemoryTrackerTest : public BaseTest {};
+
+TEST_F(QueryMemoryTrackerTest, reservation_test) {
+    using namespace infinity;
+
+    i64 global_usage = GlobalResourceUsage::GetQueryMemoryUsage();
+    QueryMemoryTracker tracker;
+    tracker.SetLimit(1000);
+    {
+        MemoryReservation reservation1;
+        MemoryReservation reservation2;
+        // Not charged before Init
+        EXPECT_TRUE(reservation1.Resize(2000));
+        EXPECT_EQ(tracker.used(), 0);
+        reservation1.Resize(0);
+
+        reservation1.Init(&tracker);
+        reservation2.Init(&tracker);
+        EXPECT_TRUE(reservation1.Resize(600));
+        EXPECT_TRUE(reservation1.Resize(400));
+        EXPECT_EQ(tracker.used(), 400);
+        EXPECT_EQ(GlobalResourceUsage::GetQueryMemoryUsage(), global_usage + 400);
+
+        EXPECT_FALSE(reservation2.Resize(700));
+        EXPECT_TRUE(tracker.OverLimit());
+        EXPECT_EQ(tracker.peak(), 1100);
+        EXPECT_THROW(reservation2.ResizeOrFail(800, "test"), RecoverableException);
+
+        EXPECT_TRUE(reservation2.Resize(100));
+        EXPECT_EQ(tracker.used(), 500);
+    }
+    // Released with the reservations
+    EXPECT_EQ(tracker.used(), 0);
+    EXPECT_EQ(tracker.peak(), 1200);
+    EXPECT_EQ(GlobalResourceUsage::GetQueryMemoryUsage(), global_usage);
+}
@@ -0,0 +1,105 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "unit_test/base_test.h"
+
+import stl;
+import query_progress;
+import query_memory_tracker;
+import session_manager;
+import session;
+import physical_operator_type;
+
+class QueryProgressTest : public BaseTest {};
+
+TEST_F(QueryProgressTest, progress_test) {
+    using namespace infinity;
+
+    QueryMemoryTracker tracker;
+    QueryProgress progress;
+    progress.Begin(7, 3, "SELECT * FROM t1", &tracker);
+    progress.AddFragment(4);
+    progress.AddFragment(1);
+    progress.FinishTask();
+    progress.FinishTask();
+    progress.AddRowsScanned(8192);
+    progress.AddRowsScanned(100);
+    progress.SetCurrentOperator(PhysicalOperatorType::kTableScan);
+    tracker.Charge(1024);
+
+    QueryProgressInfo info = progress.Snapshot();
+    EXPECT_EQ(info.query_id_, 7u);
+    EXPECT_EQ(info.session_id_, 3u);
+    EXPECT_EQ(info.query_text_, "SELECT * FROM t1");
+    EXPECT_EQ(info.fragments_done_, 0u);
+    EXPECT_EQ(info.fragments_total_, 2u);
+    EXPECT_EQ(info.tasks_done_, 2u);
+    EXPECT_EQ(info.tasks_total_, 5u);
+    EXPECT_EQ(info.rows_scanned_, 8292u);
+    EXPECT_EQ(info.memory_bytes_, 1024);
+    EXPECT_EQ(info.current_operator_, PhysicalOperatorType::kTableScan);
+
+    progress.FinishFragment();
+    EXPECT_EQ(progress.Snapshot().fragments_done_, 1u);
+    tracker.Charge(-1024);
+
+    // the counters of the next statement start from zero
+    progress.Begin(8, 3, "SELECT 1", &tracker);
+    info = progress.Snapshot();
+    EXPECT_EQ(info.query_id_, 8u);
+    EXPECT_EQ(info.tasks_total_, 0u);
+    EXPECT_EQ(info.rows_scanned_, 0u);
+    EXPECT_EQ(info.current_operator_, PhysicalOperatorType::kInvalid);
+}
+
+TEST_F(QueryProgressTest, running_queries_test) {
+    using namespace infinity;
+
+    SessionManager session_manager;
+    SharedPtr<LocalSession> session1 = session_manager.CreateLocalSession();
+    SharedPtr<LocalSession> session2 = session_manager.CreateLocalSession();
+
+    QueryProgress progress1;
+    QueryProgress progress2;
+    u64 query_id1 = session_manager.NextQueryID();
+    u64 query_id2 = session_manager.NextQueryID();
+    EXPECT_LT(query_id1, query_id2);
+    progress2.Begin(query_id2, session2->session_id(), "query 2", nullptr);
+    progress1.Begin(query_id1, session1->session_id(), "query 1", nullptr);
+    session_manager.RegisterQuery(&progress2);
+    session_manager.RegisterQuery(&progress1);
+
+    Vector<QueryProgressInfo> queries = session_manager.RunningQueries();
+    ASSERT_EQ(queries.size(), 2u);
+    EXPECT_EQ(queries[0].query_id_, query_id1);
+    EXPECT_EQ(queries[0].query_text_, "query 1");
+    EXPECT_EQ(queries[1].query_id_, query_id2);
+    EXPECT_EQ(queries[1].session_id_, session2->session_id());
+
+    // only the session of the killed query is cancelled
+    EXPECT_TRUE(session_manager.CancelQuery(query_id2));
+    EXPECT_TRUE(session2->query_canceled());
+    EXPECT_FALSE(session1->query_canceled());
+
+    session_manager.UnregisterQuery(query_id2);
+    EXPECT_FALSE(session_manager.CancelQuery(query_id2));
+    queries = session_manager.RunningQueries();
+    ASSERT_EQ(queries.size(), 1u);
+    EXPECT_EQ(queries[0].query_id_, query_id1);
+
+    session_manager.UnregisterQuery(query_id1);
+    EXPECT_TRUE(session_manager.RunningQueries().empty());
+    session_manager.RemoveSessionByID(session1->session_id());
+    session_manager.RemoveSessionByID(session2->session_id());
+}
@@ -1517,4 +1517,36 @@ TEST_F(SelectStatementParsingTest, good_search_test) {
     EXPECT_EQ(select_statement->where_expr_->type_, ParsedExprType::kFunction);
 
     result->Reset();
-}
\ No newline at end of file
+}
+TEST_F(SelectStatementParsingTest, good_parameter_test) {
+    using namespace infinity;
+    SharedPtr<SQLParser> parser = MakeShared<SQLParser>();
+    SharedPtr<ParserResult> result = MakeShared<ParserResult>();
+
+    {
+        // $n of the extended query protocol, rewritten to ?n
+        String input_sql = "SELECT a FROM t WHERE a > ?1 AND b = ?2 LIMIT ?1;";
+        parser->Parse(input_sql, result.get());
+
+        EXPECT_TRUE(result->error_message_.empty());
+        EXPECT_FALSE(result->statements_ptr_ == nullptr);
+        EXPECT_EQ(result->parameter_exprs_.size(), 3u);
+        for (ConstantExpr *parameter : result->parameter_exprs_) {
+            EXPECT_EQ(parameter->literal_type_, LiteralType::kParameter);
+        }
+
+        SelectStatement *select = (SelectStatement *)((*result->statements_ptr_)[0]);
+        FunctionExpr *and_expr = (FunctionExpr *)select->where_expr_;
+        FunctionExpr *gt_expr = (FunctionExpr *)(*and_expr->arguments_)[0];
+        ConstantExpr *arg1 = (ConstantExpr *)(*gt_expr->arguments_)[1];
+        EXPECT_EQ(arg1->literal_type_, LiteralType::kParameter);
+        EXPECT_EQ(arg1->integer_value_, 1);
+        EXPECT_EQ(arg1->ToString(), "$1");
+
+        ConstantExpr *limit = (ConstantExpr *)select->limit_expr_;
+        EXPECT_EQ(limit->integer_value_, 1);
+
+        result->Reset();
+        EXPECT_TRUE(result->parameter_exprs_.empty());
+    }
+}
@@ -99,6 +99,37 @@ TEST_F(StatementParsingTest, good_test1) {
         result->Reset();
     }
 
+    {
+        String input_sql = "CREATE TABLE IF NOT EXISTS t1 CLONE db1.t2;";
+        parser->Parse(input_sql, result.get());
+
+        EXPECT_TRUE(result->error_message_.empty());
+        EXPECT_FALSE(result->statements_ptr_ == nullptr);
+
+        for (auto &statement : *result->statements_ptr_) {
+            EXPECT_EQ(statement->type_, StatementType::kCreate);
+            auto *create_statement = (CreateStatement *)(statement);
+            EXPECT_EQ(create_statement->create_info_->type_, DDLType::kTable);
+            EXPECT_EQ(create_statement->create_info_->conflict_type_, ConflictType::kIgnore);
+            CreateTableInfo *table_info = (CreateTableInfo *)create_statement->create_info_.get();
+            EXPECT_EQ(table_info->table_name_, "t1");
+            EXPECT_EQ(table_info->clone_schema_name_, "db1");
+            EXPECT_EQ(table_info->clone_table_name_, "t2");
+            EXPECT_TRUE(table_info->column_defs_.empty());
+        }
+
+        result->Reset();
+    }
+
+    {
+        String input_sql = "CREATE TABLE t1 MIRROR t2;";
+        parser->Parse(input_sql, result.get());
+
+        EXPECT_FALSE(result->error_message_.empty());
+
+        result->Reset();
+    }
+
     {
         String input_sql = "UPDATE t1 SET a = 1, b = 2 WHERE c = 'O''K';";
         parser->Parse(input_sql, result.get());
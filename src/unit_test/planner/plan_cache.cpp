@@ -0,0 +1,88 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "unit_test/base_test.h"
+
+import stl;
+import global_resource_usage;
+import infinity_context;
+import txn_manager;
+import txn;
+import status;
+import extra_ddl_info;
+import plan_cache;
+
+using namespace infinity;
+
+class PlanCacheTest : public BaseTest {
+    void SetUp() override {
+        system("rm -rf /tmp/infinity");
+#ifdef INFINITY_DEBUG
+        infinity::GlobalResourceUsage::Init();
+#endif
+        std::shared_ptr<std::string> config_path = nullptr;
+        infinity::InfinityContext::instance().Init(config_path);
+    }
+
+    void TearDown() override {
+        infinity::InfinityContext::instance().UnInit();
+#ifdef INFINITY_DEBUG
+        EXPECT_EQ(infinity::GlobalResourceUsage::GetObjectCount(), 0);
+        EXPECT_EQ(infinity::GlobalResourceUsage::GetRawMemoryCount(), 0);
+        infinity::GlobalResourceUsage::UnInit();
+#endif
+        BaseTest::TearDown();
+    }
+};
+
+TEST_F(PlanCacheTest, test_commit_between_cache_and_reuse) {
+    TxnManager *txn_mgr = infinity::InfinityContext::instance().storage()->txn_manager();
+    PlanCache plan_cache(8);
+
+    // txn1 begins, then txn2 commits a write
+    u64 version1 = txn_mgr->write_version();
+    Txn *txn1 = txn_mgr->BeginTxn();
+
+    Txn *txn2 = txn_mgr->BeginTxn();
+    Status status = txn2->CreateDatabase("db1", ConflictType::kError);
+    EXPECT_TRUE(status.ok());
+    txn_mgr->CommitTxn(txn2);
+    EXPECT_NE(txn_mgr->write_version(), version1);
+
+    // txn3 begins after the commit and caches its plan
+    EXPECT_FALSE(txn_mgr->HasCommittingWrite());
+    u64 version3 = txn_mgr->write_version();
+    Txn *txn3 = txn_mgr->BeginTxn();
+    auto plan = MakeShared<CachedPlan>();
+    plan->write_version_ = version3;
+    plan_cache.Put("select", std::move(plan));
+
+    // txn1 sees the snapshot before the commit, it can't run the plan of txn3
+    SharedPtr<const CachedPlan> cached_plan = plan_cache.Get("select");
+    ASSERT_NE(cached_plan.get(), nullptr);
+    EXPECT_FALSE(cached_plan->UsableBy(version1, txn_mgr->write_version()));
+    EXPECT_TRUE(cached_plan->UsableBy(version3, txn_mgr->write_version()));
+    txn_mgr->CommitTxn(txn1);
+
+    // a txn begun after txn3 reuses it until the next write
+    u64 version4 = txn_mgr->write_version();
+    EXPECT_TRUE(cached_plan->UsableBy(version4, txn_mgr->write_version()));
+    Txn *txn4 = txn_mgr->BeginTxn();
+    status = txn4->CreateDatabase("db2", ConflictType::kError);
+    EXPECT_TRUE(status.ok());
+    txn_mgr->CommitTxn(txn4);
+    EXPECT_FALSE(cached_plan->UsableBy(version3, txn_mgr->write_version()));
+    EXPECT_FALSE(cached_plan->UsableBy(txn_mgr->write_version(), txn_mgr->write_version()));
+    txn_mgr->CommitTxn(txn3);
+}
@@ -56,9 +56,30 @@ class BGProcessTest : public BaseTest {
 TEST_F(BGProcessTest, test1) {
     using namespace infinity;
 
-    BGTaskProcessor processor(infinity::InfinityContext::instance().storage()->wal_manager(), nullptr);
+    BGTaskProcessor processor(infinity::InfinityContext::instance().storage()->wal_manager(), nullptr, nullptr);
 
     processor.Start();
 
     processor.Stop();
 }
+
+TEST_F(BGProcessTest, test_lanes) {
+    using namespace infinity;
+
+    EXPECT_EQ(BGTaskProcessor::LaneOf(BGTaskType::kCheckpoint), BGTaskLane::kCheckpoint);
+    EXPECT_EQ(BGTaskProcessor::LaneOf(BGTaskType::kAddDeltaEntry), BGTaskLane::kCheckpoint);
+    EXPECT_EQ(BGTaskProcessor::LaneOf(BGTaskType::kCompactSegments), BGTaskLane::kCompaction);
+    EXPECT_EQ(BGTaskProcessor::LaneOf(BGTaskType::kRebuildHnswIndex), BGTaskLane::kIndexBuild);
+    EXPECT_EQ(BGTaskProcessor::LaneOf(BGTaskType::kMergeFulltextChunks), BGTaskLane::kIndexBuild);
+    EXPECT_EQ(BGTaskProcessor::LaneOf(BGTaskType::kCleanup), BGTaskLane::kCleanup);
+
+    BGTaskProcessor processor(infinity::InfinityContext::instance().storage()->wal_manager(), nullptr, nullptr);
+    Vector<Pair<BGTaskLane, SizeT>> queue_lengths = processor.QueueLengths();
+    EXPECT_EQ(queue_lengths.size(), 4u);
+    for (const auto &[lane, queue_length] : queue_lengths) {
+        EXPECT_EQ(queue_length, 0u);
+    }
+
+    processor.Start();
+    processor.Stop();
+}
@@ -39,6 +39,7 @@ import third_party;
 import base_table_ref;
 import index_secondary;
 import infinity_exception;
+import cleanup_scanner;
 
 using namespace infinity;
 
@@ -470,4 +471,32 @@ TEST_F(CleanupTaskTest, test_with_index_compact_and_cleanup) {
     WaitCleanup(catalog, txn_mgr, last_commit_ts);
 
     InfinityContext::instance().UnInit();
-}
\ No newline at end of file
+}
+TEST_F(CleanupTaskTest, test_cleanup_queue) {
+    CleanupQueue cleanup_queue;
+    {
+        // The first cleanup after the start walks the whole catalog.
+        CleanupTargets targets = cleanup_queue.Take(10);
+        EXPECT_TRUE(targets.all_);
+        EXPECT_FALSE(cleanup_queue.Take(10).all_);
+    }
+
+    cleanup_queue.Mark("db1", "tbl1", 5);
+    cleanup_queue.Mark("db1", "tbl2", 20);
+    cleanup_queue.Mark("db2", "", 5);
+    EXPECT_EQ(cleanup_queue.Size(), 3u);
+    {
+        CleanupTargets targets = cleanup_queue.Take(10);
+        EXPECT_FALSE(targets.all_);
+        EXPECT_TRUE(targets.whole_dbs_.contains("db2"));
+        EXPECT_EQ(targets.tables_["db1"].size(), 2u);
+    }
+    // tbl2 is committed after the visible ts, so the next cleanup walks it again.
+    EXPECT_EQ(cleanup_queue.Size(), 1u);
+    {
+        CleanupTargets targets = cleanup_queue.Take(30);
+        EXPECT_TRUE(targets.whole_dbs_.empty());
+        EXPECT_TRUE(targets.tables_["db1"].contains("tbl2"));
+    }
+    EXPECT_EQ(cleanup_queue.Size(), 0u);
+}
@@ -0,0 +1,42 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "unit_test/base_test.h"
+
+import stl;
+import default_values;
+import merge_fulltext_chunks_task;
+
+using namespace infinity;
+
+class MergeFulltextChunksTaskTest : public BaseTest {};
+
+TEST_F(MergeFulltextChunksTaskTest, test_pick_chunks) {
+    constexpr u32 tier0 = FULL_TEXT_CHUNK_MERGE_S / 2;
+    constexpr u32 tier1 = FULL_TEXT_CHUNK_MERGE_S * FULL_TEXT_CHUNK_MERGE_C;
+    static_assert(FULL_TEXT_CHUNK_MERGE_C == 4);
+    using Range = Pair<SizeT, SizeT>;
+
+    EXPECT_EQ(PickFulltextChunksToMerge({}), Range(0, 0));
+    EXPECT_EQ(PickFulltextChunksToMerge({tier0, tier0, tier0}), Range(0, 0));
+    EXPECT_EQ(PickFulltextChunksToMerge({tier0, tier0, tier0, tier0}), Range(0, 4));
+    // the larger chunk is left alone
+    EXPECT_EQ(PickFulltextChunksToMerge({tier1, tier0, tier0, tier0, tier0}), Range(1, 5));
+    // chunks of a tier are not merged across a larger chunk
+    EXPECT_EQ(PickFulltextChunksToMerge({tier0, tier1, tier0, tier0, tier0}), Range(0, 0));
+    // a smaller chunk stranded between chunks of a tier is merged with them
+    EXPECT_EQ(PickFulltextChunksToMerge({tier1, tier1, tier0, tier1, tier1}), Range(0, 5));
+    // the lowest tier goes first
+    EXPECT_EQ(PickFulltextChunksToMerge({tier1, tier1, tier1, tier1, tier0, tier0, tier0, tier0}), Range(4, 8));
+}
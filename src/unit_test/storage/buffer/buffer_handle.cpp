@@ -147,4 +147,58 @@ TEST_F(BufferHandleTest, test1) {
             EXPECT_EQ(data[i], int(2 * i));
         }
     }
-}
\ No newline at end of file
+}
+TEST_F(BufferHandleTest, test_memory_pressure) {
+    using namespace infinity;
+
+    auto temp_dir = MakeShared<String>("/tmp/infinity/spill");
+    auto base_dir = MakeShared<String>("/tmp/infinity/data");
+    BufferManager buffer_manager(1000, base_dir, temp_dir);
+
+    auto file_dir = MakeShared<String>("/tmp/infinity/data/dir1");
+    auto buf1 = buffer_manager.Allocate(MakeUnique<DataFileWorker>(file_dir, MakeShared<String>("test1"), 500));
+    auto buf2 = buffer_manager.Allocate(MakeUnique<DataFileWorker>(file_dir, MakeShared<String>("test2"), 460));
+
+    auto buf_handle1 = buf1->Load();
+    EXPECT_EQ(buffer_manager.memory_pressure(), MemoryPressure::kLow);
+    {
+        auto buf_handle2 = buf2->Load();
+        EXPECT_EQ(buffer_manager.memory_pressure(), MemoryPressure::kCritical);
+        EXPECT_FALSE(buffer_manager.WaitForMemoryPressureBelow(MemoryPressure::kHigh, std::chrono::milliseconds(20)));
+    }
+    // an unloaded buffer can be freed, it doesn't count
+    EXPECT_EQ(buffer_manager.memory_pressure(), MemoryPressure::kLow);
+    EXPECT_TRUE(buffer_manager.WaitForMemoryPressureBelow(MemoryPressure::kHigh, std::chrono::milliseconds(20)));
+}
+
+TEST_F(BufferHandleTest, test_pin) {
+    using namespace infinity;
+
+    auto temp_dir = MakeShared<String>("/tmp/infinity/spill");
+    auto base_dir = MakeShared<String>("/tmp/infinity/data");
+    BufferManager buffer_manager(1000, base_dir, temp_dir);
+
+    auto file_dir = MakeShared<String>("/tmp/infinity/data/dir1");
+    auto buf1 = buffer_manager.Allocate(MakeUnique<DataFileWorker>(file_dir, MakeShared<String>("test1"), 500));
+    auto buf2 = buffer_manager.Allocate(MakeUnique<DataFileWorker>(file_dir, MakeShared<String>("test2"), 460));
+    auto buf3 = buffer_manager.Allocate(MakeUnique<DataFileWorker>(file_dir, MakeShared<String>("test3"), 400));
+
+    buf1->Pin();
+    { auto buf_handle1 = buf1->Load(); }
+    { auto buf_handle2 = buf2->Load(); }
+    {
+        // only the unpinned buffer is freed to make room
+        auto buf_handle3 = buf3->Load();
+        EXPECT_EQ(buf1->status(), BufferStatus::kUnloaded);
+        EXPECT_EQ(buf2->status(), BufferStatus::kFreed);
+    }
+    // a pinned buffer counts as in use
+    EXPECT_EQ(buffer_manager.memory_usage(), 900u);
+    EXPECT_EQ(buffer_manager.memory_pressure(), MemoryPressure::kLow);
+
+    buf1->Unpin();
+    auto buf_handle3 = buf3->Load();
+    auto buf_handle2 = buf2->Load();
+    EXPECT_EQ(buf1->status(), BufferStatus::kFreed);
+    EXPECT_EQ(buffer_manager.memory_usage(), 860u);
+}
@@ -809,4 +809,110 @@ TEST_F(BufferObjTest, test_multiple_threads_read) {
     for (SizeT i = 0; i < kThreadN; ++i) {
         ths[i].join();
     }
-}
\ No newline at end of file
+}
+// A prefetch reads a freed buffer back into memory, the following load finds it unloaded instead of freed.
+TEST_F(BufferObjTest, test_prefetch) {
+    SizeT memory_limit = 1024;
+    auto temp_dir = MakeShared<String>("/tmp/infinity/spill");
+    auto base_dir = MakeShared<String>("/tmp/infinity/data");
+
+    BufferManager buffer_manager(memory_limit, base_dir, temp_dir);
+
+    SizeT test_size = 1024;
+    auto file_dir1 = MakeShared<String>("/tmp/infinity/data/dir1");
+    auto test_fname1 = MakeShared<String>("test1");
+    auto buf1 = buffer_manager.Allocate(MakeUnique<DataFileWorker>(file_dir1, test_fname1, test_size));
+
+    auto file_dir2 = MakeShared<String>("/tmp/infinity/data/dir2");
+    auto test_fname2 = MakeShared<String>("test2");
+    auto buf2 = buffer_manager.Allocate(MakeUnique<DataFileWorker>(file_dir2, test_fname2, test_size));
+
+    { auto handle1 = buf1->Load(); }
+    SaveBufferObj(buf1);
+    { auto handle2 = buf2->Load(); }
+    EXPECT_EQ(buf1->status(), BufferStatus::kFreed);
+
+    buffer_manager.Prefetch(buf1).wait();
+    EXPECT_EQ(buf1->status(), BufferStatus::kUnloaded);
+    EXPECT_EQ(buf2->status(), BufferStatus::kFreed);
+    buf1->CheckState();
+
+    // A buffer which is in memory is left alone.
+    buffer_manager.Prefetch(buf1).wait();
+    EXPECT_EQ(buf1->status(), BufferStatus::kUnloaded);
+    buf1->CheckState();
+}
+
+// A large column file is mapped when it is read, and its pages are copied before the first write.
+TEST_F(BufferObjTest, test_mapped_data_file) {
+    SizeT memory_limit = 3 * 1024 * 1024;
+    auto temp_dir = MakeShared<String>("/tmp/infinity/spill");
+    auto base_dir = MakeShared<String>("/tmp/infinity/data");
+
+    BufferManager buffer_manager(memory_limit, base_dir, temp_dir);
+
+    SizeT test_size = 2 * 1024 * 1024;
+    SizeT value_n = test_size / sizeof(u32);
+    auto file_dir = MakeShared<String>("/tmp/infinity/data/dir1");
+    auto buf1 = buffer_manager.Allocate(MakeUnique<DataFileWorker>(file_dir, MakeShared<String>("test1"), test_size));
+    auto buf2 = buffer_manager.Allocate(MakeUnique<DataFileWorker>(file_dir, MakeShared<String>("test2"), test_size));
+
+    {
+        auto handle1 = buf1->Load();
+        auto *data = static_cast<u32 *>(handle1.GetDataMut());
+        for (SizeT i = 0; i < value_n; ++i) {
+            data[i] = i;
+        }
+    }
+    SaveBufferObj(buf1);
+    { auto handle2 = buf2->Load(); }
+    EXPECT_EQ(buf1->status(), BufferStatus::kFreed);
+
+    {
+        auto handle1 = buf1->Load();
+        EXPECT_EQ(buf1->type(), BufferType::kPersistent);
+        const auto *data = static_cast<const u32 *>(handle1.GetData());
+        for (SizeT i = 0; i < value_n; ++i) {
+            ASSERT_EQ(data[i], i);
+        }
+        auto *mut_data = static_cast<u32 *>(handle1.GetDataMut());
+        mut_data[0] = 42;
+        mut_data[value_n - 1] = 42;
+    }
+    SaveBufferObj(buf1);
+    { auto handle2 = buf2->Load(); }
+    EXPECT_EQ(buf1->status(), BufferStatus::kFreed);
+
+    auto handle1 = buf1->Load();
+    const auto *data = static_cast<const u32 *>(handle1.GetData());
+    EXPECT_EQ(data[0], 42u);
+    EXPECT_EQ(data[1], 1u);
+    EXPECT_EQ(data[value_n - 1], 42u);
+}
+
+// A buffer used twice stays in memory while a scan loads many buffers once.
+TEST_F(BufferObjTest, test_scan_resistance) {
+    SizeT test_size = 1024;
+    SizeT memory_limit = 3 * test_size;
+    auto temp_dir = MakeShared<String>("/tmp/infinity/spill");
+    auto base_dir = MakeShared<String>("/tmp/infinity/data");
+
+    BufferManager buffer_manager(memory_limit, base_dir, temp_dir);
+
+    auto file_dir = MakeShared<String>("/tmp/infinity/data/dir1");
+    auto hot_buf = buffer_manager.Allocate(MakeUnique<DataFileWorker>(file_dir, MakeShared<String>("hot"), test_size));
+    { auto handle = hot_buf->Load(); }
+    { auto handle = hot_buf->Load(); }
+
+    Vector<BufferObj *> scan_bufs;
+    for (SizeT i = 0; i < 6; ++i) {
+        auto scan_buf = buffer_manager.Allocate(MakeUnique<DataFileWorker>(file_dir, MakeShared<String>(fmt::format("scan{}", i)), test_size));
+        { auto handle = scan_buf->Load(); }
+        scan_bufs.push_back(scan_buf);
+    }
+    EXPECT_EQ(hot_buf->status(), BufferStatus::kUnloaded);
+    hot_buf->CheckState();
+    EXPECT_EQ(scan_bufs[0]->status(), BufferStatus::kFreed);
+    EXPECT_EQ(scan_bufs[5]->status(), BufferStatus::kUnloaded);
+    EXPECT_LE(buffer_manager.memory_usage(), memory_limit);
+}
@@ -0,0 +1,93 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "unit_test/base_test.h"
+
+import infinity_exception;
+
+import column_vector;
+import value;
+
+import default_values;
+import third_party;
+import stl;
+import internal_types;
+import logical_type;
+import data_type;
+
+class ColumnVectorDictionaryTest : public BaseTest {};
+
+TEST_F(ColumnVectorDictionaryTest, integer_dictionary) {
+    using namespace infinity;
+
+    SharedPtr<DataType> data_type = MakeShared<DataType>(LogicalType::kInteger);
+    ColumnVector column_vector(data_type);
+    column_vector.Initialize();
+    for (i64 i = 0; i < DEFAULT_VECTOR_SIZE; ++i) {
+        column_vector.AppendValue(Value::MakeInt(static_cast<IntegerT>(i % 5)));
+    }
+    for (i64 i = 0; i < DEFAULT_VECTOR_SIZE; i += 7) {
+        column_vector.nulls_ptr_->SetFalse(i);
+    }
+
+    SharedPtr<ColumnVector> dictionary_vector = ColumnVector::DictionaryEncode(column_vector, 16);
+    ASSERT_NE(dictionary_vector, nullptr);
+    EXPECT_EQ(dictionary_vector->vector_type(), ColumnVectorType::kDictionary);
+    EXPECT_EQ(dictionary_vector->Size(), column_vector.Size());
+    EXPECT_LE(dictionary_vector->dictionary()->Size(), 5u);
+
+    SharedPtr<ColumnVector> flat_vector = dictionary_vector->Flatten();
+    EXPECT_EQ(flat_vector->vector_type(), ColumnVectorType::kFlat);
+    for (i64 i = 0; i < DEFAULT_VECTOR_SIZE; ++i) {
+        bool valid = i % 7 != 0;
+        EXPECT_EQ(dictionary_vector->nulls_ptr_->IsTrue(i), valid);
+        EXPECT_EQ(flat_vector->nulls_ptr_->IsTrue(i), valid);
+        if (valid) {
+            EXPECT_EQ(dictionary_vector->GetValue(i), column_vector.GetValue(i));
+            EXPECT_EQ(flat_vector->GetValue(i), column_vector.GetValue(i));
+        }
+    }
+
+    // too many distinct values
+    EXPECT_EQ(ColumnVector::DictionaryEncode(column_vector, 4), nullptr);
+}
+
+TEST_F(ColumnVectorDictionaryTest, varchar_dictionary) {
+    using namespace infinity;
+
+    SharedPtr<DataType> data_type = MakeShared<DataType>(LogicalType::kVarchar);
+    ColumnVector column_vector(data_type);
+    column_vector.Initialize();
+    for (i64 i = 0; i < DEFAULT_VECTOR_SIZE; ++i) {
+        String s = (i % 3 == 0) ? "short" : fmt::format("a long varchar value of group {}", i % 3);
+        column_vector.AppendValue(Value::MakeVarchar(s));
+    }
+
+    SharedPtr<ColumnVector> dictionary_vector = ColumnVector::DictionaryEncode(column_vector, 16);
+    ASSERT_NE(dictionary_vector, nullptr);
+    EXPECT_EQ(dictionary_vector->dictionary()->Size(), 3u);
+
+    // appending codes of the same dictionary keeps the vector encoded
+    ColumnVector copy_vector(data_type);
+    copy_vector.Initialize(*dictionary_vector, 0, dictionary_vector->Size());
+    EXPECT_EQ(copy_vector.vector_type(), ColumnVectorType::kDictionary);
+    EXPECT_EQ(copy_vector.dictionary(), dictionary_vector->dictionary());
+
+    SharedPtr<ColumnVector> flat_vector = dictionary_vector->Flatten();
+    for (i64 i = 0; i < DEFAULT_VECTOR_SIZE; ++i) {
+        EXPECT_EQ(dictionary_vector->GetValue(i), column_vector.GetValue(i));
+        EXPECT_EQ(copy_vector.GetValue(i), column_vector.GetValue(i));
+        EXPECT_EQ(flat_vector->GetValue(i), column_vector.GetValue(i));
+    }
+}
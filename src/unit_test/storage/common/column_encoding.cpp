@@ -0,0 +1,94 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "unit_test/base_test.h"
+
+import stl;
+import column_encoding;
+import infinity_exception;
+
+using namespace infinity;
+
+class ColumnEncodingTest : public BaseTest {
+public:
+    template <typename T>
+    static ColumnEncodingType RoundTrip(const Vector<T> &values) {
+        const char *data = reinterpret_cast<const char *>(values.data());
+        SizeT size = values.size() * sizeof(T);
+        Vector<char> encoded;
+        ColumnEncodingType type = EncodeColumn(data, size, sizeof(T), encoded);
+        if (type == ColumnEncodingType::kPlain) {
+            EXPECT_TRUE(encoded.empty());
+            return type;
+        }
+        EXPECT_LT(encoded.size(), size);
+        Vector<T> decoded(values.size());
+        DecodeColumn(type, encoded.data(), encoded.size(), sizeof(T), reinterpret_cast<char *>(decoded.data()), size);
+        EXPECT_EQ(decoded, values);
+        return type;
+    }
+};
+
+TEST_F(ColumnEncodingTest, test_rle) {
+    Vector<i64> values(8192, 0);
+    std::fill(values.begin(), values.begin() + 100, 7);
+    EXPECT_EQ(RoundTrip(values), ColumnEncodingType::kRLE);
+}
+
+TEST_F(ColumnEncodingTest, test_dictionary) {
+    // 16 bytes values such as the inline part of short varchars
+    Vector<Array<i64, 2>> values;
+    for (i64 i = 0; i < 8192; ++i) {
+        values.push_back({(i * 7919) % 5 * 1000003, -(i % 3)});
+    }
+    EXPECT_EQ(RoundTrip(values), ColumnEncodingType::kDictionary);
+}
+
+TEST_F(ColumnEncodingTest, test_bit_packing) {
+    Vector<i32> values;
+    for (i32 i = 0; i < 8192; ++i) {
+        values.push_back(-500 + (i * 7919) % 1000);
+    }
+    EXPECT_EQ(RoundTrip(values), ColumnEncodingType::kBitPacking);
+
+    Vector<i64> extremes;
+    for (i64 i = 0; i < 8192; ++i) {
+        extremes.push_back(i % 2 ? std::numeric_limits<i64>::max() - (i * 31) % 977 : std::numeric_limits<i64>::max() - 1000);
+    }
+    RoundTrip(extremes);
+}
+
+TEST_F(ColumnEncodingTest, test_plain) {
+    Vector<u64> values;
+    u64 x = 88172645463325252ull;
+    for (SizeT i = 0; i < 8192; ++i) {
+        x ^= x << 13;
+        x ^= x >> 7;
+        x ^= x << 17;
+        values.push_back(x);
+    }
+    EXPECT_EQ(RoundTrip(values), ColumnEncodingType::kPlain);
+}
+
+TEST_F(ColumnEncodingTest, test_corrupted) {
+    Vector<i64> values(8192, 42);
+    Vector<char> encoded;
+    ColumnEncodingType type = EncodeColumn(reinterpret_cast<const char *>(values.data()), values.size() * sizeof(i64), sizeof(i64), encoded);
+    ASSERT_NE(type, ColumnEncodingType::kPlain);
+    Vector<i64> decoded(values.size());
+    EXPECT_THROW(
+        DecodeColumn(type, encoded.data(), encoded.size() - 1, sizeof(i64), reinterpret_cast<char *>(decoded.data()), values.size() * sizeof(i64)),
+        RecoverableException);
+}
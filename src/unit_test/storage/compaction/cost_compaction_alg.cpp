@@ -0,0 +1,175 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "unit_test/base_test.h"
+
+import stl;
+import storage;
+import txn_manager;
+import infinity_context;
+import segment_entry;
+import cost_compaction_alg;
+import txn;
+
+using namespace infinity;
+
+namespace {
+
+class CostMockSegmentEntry : public SegmentEntry {
+    static SegmentID cur_segment_id_;
+
+public:
+    static SharedPtr<CostMockSegmentEntry> Make(SizeT row_cnt) { return MakeShared<CostMockSegmentEntry>(cur_segment_id_++, row_cnt); }
+
+    CostMockSegmentEntry(SegmentID segment_id, SizeT row_cnt) : SegmentEntry(nullptr, nullptr, segment_id, 0, 0, SegmentStatus::kSealed) {
+        this->IncreaseRowCount(row_cnt);
+    }
+
+    void ShrinkSegment(SizeT row_cnt) { this->DecreaseRemainRow(row_cnt); }
+};
+
+SegmentID CostMockSegmentEntry::cur_segment_id_ = 0;
+
+CostCompactionConfig MakeTestConfig() {
+    CostCompactionConfig config;
+    config.max_segment_capacity_ = 1000;
+    config.max_small_segments_ = 3;
+    config.delete_ratio_ = 0.5;
+    config.min_interval_ = std::chrono::milliseconds(0);
+    config.min_segment_age_ = std::chrono::milliseconds(0);
+    return config;
+}
+
+} // namespace
+
+class CostCompactionTest : public BaseTest {
+public:
+    void SetUp() override {
+        system("rm -rf /tmp/infinity");
+        std::shared_ptr<std::string> config_path = nullptr;
+        infinity::InfinityContext::instance().Init(config_path);
+    }
+
+    void TearDown() override {
+        infinity::InfinityContext::instance().UnInit();
+        system("rm -rf /tmp/infinity");
+    }
+};
+
+TEST_F(CostCompactionTest, MergeSmallSegments) {
+    TxnManager *txn_mgr = infinity::InfinityContext::instance().storage()->txn_manager();
+    std::function<Txn *()> GetTxn = [&]() { return txn_mgr->BeginTxn(); };
+    CostCompactionAlg compaction(MakeTestConfig());
+    compaction.Enable(Vector<SegmentEntry *>{});
+
+    Vector<SharedPtr<SegmentEntry>> segment_entries; // hold lifetime
+    // a full segment is never picked
+    {
+        auto segment_entry = CostMockSegmentEntry::Make(900);
+        segment_entries.emplace_back(segment_entry);
+        EXPECT_FALSE(compaction.AddSegment(segment_entry.get(), GetTxn).has_value());
+    }
+    for (SizeT row_cnt : {100, 300, 200}) {
+        auto segment_entry = CostMockSegmentEntry::Make(row_cnt);
+        segment_entries.emplace_back(segment_entry);
+        EXPECT_FALSE(compaction.AddSegment(segment_entry.get(), GetTxn).has_value());
+    }
+    // the fourth small segment exceeds the bound, the smallest segments filling one segment are merged
+    auto segment_entry = CostMockSegmentEntry::Make(400);
+    segment_entries.emplace_back(segment_entry);
+    auto ret = compaction.AddSegment(segment_entry.get(), GetTxn);
+    ASSERT_TRUE(ret.has_value());
+    auto [segments, txn] = ret.value();
+    Vector<SizeT> row_cnts;
+    for (auto *segment : segments) {
+        row_cnts.push_back(segment->actual_row_count());
+    }
+    EXPECT_EQ(row_cnts, (Vector<SizeT>{100, 200, 300, 400}));
+
+    compaction.CommitCompact(txn->TxnID());
+    txn_mgr->CommitTxn(txn);
+    compaction.Disable();
+}
+
+TEST_F(CostCompactionTest, CompactDeletedFirst) {
+    TxnManager *txn_mgr = infinity::InfinityContext::instance().storage()->txn_manager();
+    std::function<Txn *()> GetTxn = [&]() { return txn_mgr->BeginTxn(); };
+    CostCompactionAlg compaction(MakeTestConfig());
+    compaction.Enable(Vector<SegmentEntry *>{});
+
+    auto large_segment = CostMockSegmentEntry::Make(900);
+    auto small_segment = CostMockSegmentEntry::Make(50);
+    EXPECT_FALSE(compaction.AddSegment(large_segment.get(), GetTxn).has_value());
+    EXPECT_FALSE(compaction.AddSegment(small_segment.get(), GetTxn).has_value());
+
+    // under the delete ratio, nothing to do
+    large_segment->ShrinkSegment(100);
+    EXPECT_FALSE(compaction.DeleteInSegment(large_segment->segment_id(), GetTxn).has_value());
+
+    // over the delete ratio, the segment is compacted with the small segments that fit
+    large_segment->ShrinkSegment(400);
+    auto ret = compaction.DeleteInSegment(large_segment->segment_id(), GetTxn);
+    ASSERT_TRUE(ret.has_value());
+    auto [segments, txn] = ret.value();
+    ASSERT_EQ(segments.size(), 2u);
+    EXPECT_EQ(segments[0], large_segment.get());
+    EXPECT_EQ(segments[1], small_segment.get());
+
+    // the compacting segment is ignored
+    EXPECT_FALSE(compaction.DeleteInSegment(large_segment->segment_id(), GetTxn).has_value());
+
+    compaction.CommitCompact(txn->TxnID());
+    txn_mgr->CommitTxn(txn);
+    compaction.Disable();
+}
+
+TEST_F(CostCompactionTest, RollbackAndWriteHot) {
+    TxnManager *txn_mgr = infinity::InfinityContext::instance().storage()->txn_manager();
+    std::function<Txn *()> GetTxn = [&]() { return txn_mgr->BeginTxn(); };
+    CostCompactionConfig config = MakeTestConfig();
+    config.min_interval_ = std::chrono::hours(1);
+    CostCompactionAlg compaction(config);
+    compaction.Enable(Vector<SegmentEntry *>{});
+
+    Vector<SharedPtr<SegmentEntry>> segment_entries; // hold lifetime
+    auto add_segment = [&](SizeT row_cnt) {
+        auto segment_entry = CostMockSegmentEntry::Make(row_cnt);
+        segment_entries.emplace_back(segment_entry);
+        return compaction.AddSegment(segment_entry.get(), GetTxn);
+    };
+    for (SizeT i = 0; i < 3; ++i) {
+        EXPECT_FALSE(add_segment(10).has_value());
+    }
+    auto ret = add_segment(10);
+    ASSERT_TRUE(ret.has_value());
+    {
+        auto [segments, txn] = ret.value();
+        EXPECT_EQ(segments.size(), 4u);
+        compaction.RollbackCompact(txn->TxnID());
+        txn_mgr->RollBackTxn(txn);
+    }
+
+    // compacted just now: wait for the interval until the table has twice the small segments
+    EXPECT_FALSE(add_segment(10).has_value());
+    EXPECT_FALSE(add_segment(10).has_value());
+    ret = add_segment(10);
+    ASSERT_TRUE(ret.has_value());
+    {
+        auto [segments, txn] = ret.value();
+        EXPECT_EQ(segments.size(), 7u);
+        compaction.CommitCompact(txn->TxnID());
+        txn_mgr->CommitTxn(txn);
+    }
+    compaction.Disable();
+}
@@ -34,6 +34,8 @@ import embedding_info;
 import array_info;
 import knn_expr;
 import data_type;
+import selection;
+import column_vector;
 
 class DataBlockTest : public BaseTest {};
 
@@ -214,6 +216,59 @@ TEST_F(DataBlockTest, test3) {
     }
 }
 
+TEST_F(DataBlockTest, SelectionBlock) {
+    using namespace infinity;
+
+    Vector<SharedPtr<DataType>> column_types;
+    column_types.emplace_back(MakeShared<DataType>(LogicalType::kInteger));
+    column_types.emplace_back(MakeShared<DataType>(LogicalType::kBigInt));
+
+    SizeT row_count = DEFAULT_VECTOR_SIZE;
+    DataBlock input_block;
+    input_block.Init(column_types);
+    for (SizeT i = 0; i < row_count; ++i) {
+        input_block.AppendValue(0, Value::MakeInt(static_cast<i32>(i)));
+        input_block.AppendValue(1, Value::MakeBigInt(static_cast<i64>(i) * 10));
+    }
+    input_block.Finalize();
+
+    // Select the odd rows
+    SharedPtr<Selection> selection = MakeShared<Selection>();
+    selection->Initialize(row_count);
+    for (SizeT i = 1; i < row_count; i += 2) {
+        selection->Append(i);
+    }
+
+    DataBlock selected_block;
+    selected_block.InitWithSelection(&input_block, selection);
+    EXPECT_TRUE(selected_block.HasSelection());
+    EXPECT_EQ(selected_block.row_count(), row_count / 2);
+    // The columns are shared with the input
+    EXPECT_EQ(selected_block.column_vectors[0].get(), input_block.column_vectors[0].get());
+    for (SizeT i = 0; i < row_count / 2; ++i) {
+        EXPECT_EQ(selected_block.GetValue(0, i).value_.integer, static_cast<i32>(i * 2 + 1));
+    }
+
+    SharedPtr<ColumnVector> dense_column = selected_block.MaterializeColumn(1);
+    EXPECT_EQ(dense_column->Size(), row_count / 2);
+    EXPECT_EQ(dense_column->GetValue(3).value_.big_int, 70);
+
+    selected_block.Materialize();
+    EXPECT_FALSE(selected_block.HasSelection());
+    EXPECT_EQ(selected_block.row_count(), row_count / 2);
+    EXPECT_NE(selected_block.column_vectors[0].get(), input_block.column_vectors[0].get());
+    for (SizeT i = 0; i < row_count / 2; ++i) {
+        EXPECT_EQ(selected_block.GetValue(0, i).value_.integer, static_cast<i32>(i * 2 + 1));
+        EXPECT_EQ(selected_block.GetValue(1, i).value_.big_int, static_cast<i64>(i * 2 + 1) * 10);
+    }
+
+    // A block with a selection can't be the input of another selection
+    DataBlock nested_block;
+    DataBlock another_selected_block;
+    another_selected_block.InitWithSelection(&input_block, selection);
+    EXPECT_THROW(nested_block.InitWithSelection(&another_selected_block, selection), UnrecoverableException);
+}
+
 TEST_F(DataBlockTest, ReadWrite) {
     using namespace infinity;
 
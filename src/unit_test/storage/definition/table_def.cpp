@@ -27,6 +27,7 @@ import internal_types;
 import logical_type;
 import column_def;
 import data_type;
+import default_values;
 
 class TableDefTest : public BaseTest {};
 
@@ -95,3 +96,29 @@ TEST_F(TableDefTest, ReadWrite) {
     EXPECT_NE(table_def2, nullptr);
     EXPECT_EQ(*table_def2, table_def);
 }
+
+TEST_F(TableDefTest, ReadWriteSegmentCapacity) {
+    using namespace infinity;
+
+    Vector<SharedPtr<ColumnDef>> columns;
+    columns.emplace_back(MakeShared<ColumnDef>(0, MakeShared<DataType>(LogicalType::kBigInt), "c1", HashSet<ConstraintType>{}));
+    TableDef table_def(MakeShared<String>("default"), MakeShared<String>("t1"), columns);
+    EXPECT_EQ(table_def.segment_capacity(), DEFAULT_SEGMENT_CAPACITY);
+    table_def.set_segment_capacity(4 * DEFAULT_BLOCK_CAPACITY);
+
+    int32_t exp_size = table_def.GetSizeInBytes();
+    Vector<char> buf(exp_size, char(0));
+    char *ptr = buf.data();
+    table_def.WriteAdv(ptr);
+    EXPECT_EQ(ptr - buf.data(), exp_size);
+
+    ptr = buf.data();
+    SharedPtr<TableDef> table_def2 = table_def.ReadAdv(ptr, exp_size);
+    ASSERT_NE(table_def2, nullptr);
+    EXPECT_EQ(table_def2->segment_capacity(), SizeT(4 * DEFAULT_BLOCK_CAPACITY));
+    EXPECT_EQ(*table_def2, table_def);
+
+    // the capacity is part of the definition
+    table_def2->set_segment_capacity(DEFAULT_SEGMENT_CAPACITY);
+    EXPECT_FALSE(*table_def2 == table_def);
+}
@@ -0,0 +1,76 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "unit_test/base_test.h"
+
+import stl;
+import column_statistics;
+
+using namespace infinity;
+
+class ColumnStatisticsTest : public BaseTest {};
+
+TEST_F(ColumnStatisticsTest, DistinctCountAndHistogram) {
+    ColumnStatisticsCollector collector(true);
+    for (u64 i = 0; i < 200000; ++i) {
+        collector.AddValue(i % 50000, static_cast<double>(i % 50000));
+    }
+    for (u64 i = 0; i < 10; ++i) {
+        collector.AddNull();
+    }
+    ColumnStatistics statistics = collector.Finish();
+    EXPECT_EQ(statistics.row_count_, 200010u);
+    EXPECT_EQ(statistics.null_count_, 10u);
+    EXPECT_NEAR(static_cast<double>(statistics.DistinctCount()), 50000.0, 50000.0 * 0.1);
+    ASSERT_TRUE(statistics.LessEqualFraction(25000).has_value());
+    EXPECT_NEAR(*statistics.LessEqualFraction(25000), 0.5, 0.05);
+    EXPECT_EQ(*statistics.LessEqualFraction(-1), 0.0);
+    EXPECT_EQ(*statistics.LessEqualFraction(50000), 1.0);
+
+    // few values are counted exactly
+    ColumnStatisticsCollector small_collector(false);
+    for (u64 i = 0; i < 1000; ++i) {
+        small_collector.AddValue(i % 5);
+    }
+    ColumnStatistics small_statistics = small_collector.Finish();
+    EXPECT_EQ(small_statistics.DistinctCount(), 5u);
+    EXPECT_FALSE(small_statistics.LessEqualFraction(0).has_value());
+}
+
+TEST_F(ColumnStatisticsTest, MergeAndSerialize) {
+    ColumnStatisticsCollector collector1(true);
+    for (u64 i = 0; i < 200000; ++i) {
+        collector1.AddValue(i % 50000, static_cast<double>(i % 50000));
+    }
+    ColumnStatisticsCollector collector2(true);
+    for (u64 i = 0; i < 100000; ++i) {
+        collector2.AddValue(40000 + i % 30000, static_cast<double>(40000 + i % 30000));
+    }
+    ColumnStatistics statistics = collector1.Finish();
+    statistics.Merge(collector2.Finish());
+    EXPECT_EQ(statistics.row_count_, 300000u);
+    EXPECT_NEAR(static_cast<double>(statistics.DistinctCount()), 70000.0, 70000.0 * 0.1);
+    EXPECT_NEAR(*statistics.LessEqualFraction(40000), 160000.0 / 300000, 0.05);
+
+    String binary;
+    OStringStream os(std::move(binary));
+    statistics.SerializeToStringStream(os);
+    EXPECT_EQ(os.view().size(), statistics.GetSerializeSizeInBytes());
+    IStringStream is(std::move(os).str());
+    ColumnStatistics loaded;
+    loaded.DeserializeFromStringStream(is);
+    EXPECT_EQ(loaded.row_count_, statistics.row_count_);
+    EXPECT_EQ(loaded.DistinctCount(), statistics.DistinctCount());
+    EXPECT_EQ(*loaded.LessEqualFraction(40000), *statistics.LessEqualFraction(40000));
+}
@@ -0,0 +1,146 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "unit_test/base_test.h"
+
+import stl;
+import global_resource_usage;
+import storage;
+import infinity_context;
+import txn_manager;
+import txn;
+import status;
+import table_def;
+import data_block;
+import value;
+import logical_type;
+import internal_types;
+import extra_ddl_info;
+import column_def;
+import data_type;
+import default_values;
+import table_entry;
+import segment_entry;
+import block_entry;
+import fast_rough_filter;
+import filter_expression_push_down_helper;
+
+using namespace infinity;
+
+namespace {
+
+// c1 <compare_type> value, the only filter term
+class ColumnRangeEvaluator final : public FastRoughFilterEvaluator {
+public:
+    ColumnRangeEvaluator(Value value, FilterCompareType compare_type) : value_(std::move(value)), compare_type_(compare_type) {}
+
+    bool EvaluateInner(TxnTimeStamp, const FastRoughFilter &filter) const override { return filter.MayInRange(0, value_, compare_type_); }
+
+    bool EvaluateZoneInner(const FastRoughFilter &filter, u32 zone_id) const override {
+        return filter.ZoneMayInRange(zone_id, 0, value_, compare_type_);
+    }
+
+private:
+    Value value_;
+    FilterCompareType compare_type_;
+};
+
+} // namespace
+
+class ZoneMapTest : public BaseTest {
+    void SetUp() override {
+        system("rm -rf /tmp/infinity");
+#ifdef INFINITY_DEBUG
+        infinity::GlobalResourceUsage::Init();
+#endif
+        std::shared_ptr<std::string> config_path = nullptr;
+        infinity::InfinityContext::instance().Init(config_path);
+    }
+
+    void TearDown() override {
+        infinity::InfinityContext::instance().UnInit();
+#ifdef INFINITY_DEBUG
+        EXPECT_EQ(infinity::GlobalResourceUsage::GetObjectCount(), 0);
+        EXPECT_EQ(infinity::GlobalResourceUsage::GetRawMemoryCount(), 0);
+        infinity::GlobalResourceUsage::UnInit();
+#endif
+        system("rm -rf /tmp/infinity");
+    }
+};
+
+TEST_F(ZoneMapTest, evaluate_zones) {
+    TxnManager *txn_mgr = infinity::InfinityContext::instance().storage()->txn_manager();
+    const u32 zone_row_count = txn_mgr->zone_map_row_count();
+    ASSERT_EQ(zone_row_count, 1024u);
+    {
+        Vector<SharedPtr<ColumnDef>> columns;
+        columns.emplace_back(MakeShared<ColumnDef>(0, MakeShared<DataType>(LogicalType::kBigInt), "c1", HashSet<ConstraintType>{}));
+        auto tbl1_def = MakeUnique<TableDef>(MakeShared<String>("default"), MakeShared<String>("tbl1"), columns);
+        auto *txn = txn_mgr->BeginTxn();
+        Status status = txn->CreateTable("default", std::move(tbl1_def), ConflictType::kError);
+        EXPECT_TRUE(status.ok());
+        txn_mgr->CommitTxn(txn);
+    }
+    TxnTimeStamp before_build_ts = 0;
+    {
+        // a full block of c1 = row offset, its filters and zone map are built at commit
+        auto *txn = txn_mgr->BeginTxn();
+        before_build_ts = txn->BeginTS();
+        auto input_block = MakeShared<DataBlock>();
+        input_block->Init({MakeShared<DataType>(LogicalType::kBigInt)}, DEFAULT_BLOCK_CAPACITY);
+        for (i64 i = 0; i < DEFAULT_BLOCK_CAPACITY; ++i) {
+            input_block->AppendValue(0, Value::MakeBigInt(i));
+        }
+        input_block->Finalize();
+        Status status = txn->Append("default", "tbl1", input_block);
+        EXPECT_TRUE(status.ok());
+        txn_mgr->CommitTxn(txn);
+    }
+
+    auto *txn = txn_mgr->BeginTxn();
+    const TxnTimeStamp query_ts = txn->BeginTS();
+    auto [table_entry, status] = txn->GetTableByName("default", "tbl1");
+    ASSERT_TRUE(status.ok());
+    SharedPtr<BlockEntry> block_entry = table_entry->GetSegmentByID(0, query_ts)->GetBlockEntryByID(0);
+    FastRoughFilter *filter = block_entry->GetFastRoughFilter();
+    const u32 row_count = block_entry->row_count();
+    ASSERT_EQ(filter->zone_row_count(), zone_row_count);
+    ASSERT_EQ(filter->zone_count(), DEFAULT_BLOCK_CAPACITY / zone_row_count);
+
+    using RowRanges = Vector<Pair<u32, u32>>;
+    auto evaluate_zones = [&](i64 value, FilterCompareType compare_type, u32 rows = 0) {
+        ColumnRangeEvaluator evaluator(Value::MakeBigInt(value), compare_type);
+        return evaluator.EvaluateZones(query_ts, *filter, rows == 0 ? row_count : rows);
+    };
+    EXPECT_EQ(evaluate_zones(1000, FilterCompareType::kLess), RowRanges({{0, 1024}}));
+    EXPECT_EQ(evaluate_zones(2048, FilterCompareType::kEqual), RowRanges({{2048, 3072}}));
+    // adjacent zones are merged
+    EXPECT_EQ(evaluate_zones(5000, FilterCompareType::kGreater), RowRanges({{4096, 8192}}));
+    EXPECT_EQ(evaluate_zones(1023, FilterCompareType::kLessEqual), RowRanges({{0, 1024}}));
+    EXPECT_EQ(evaluate_zones(1024, FilterCompareType::kLessEqual), RowRanges({{0, 2048}}));
+    // every zone is ruled out
+    EXPECT_EQ(evaluate_zones(DEFAULT_BLOCK_CAPACITY, FilterCompareType::kGreaterEqual), RowRanges());
+    // only the zones of the rows read
+    EXPECT_EQ(evaluate_zones(100000, FilterCompareType::kLess, 1500), RowRanges({{0, 1500}}));
+
+    // a query older than the zone map can't use it
+    {
+        ColumnRangeEvaluator evaluator(Value::MakeBigInt(1000), FilterCompareType::kLess);
+        EXPECT_FALSE(evaluator.EvaluateZones(before_build_ts, *filter, row_count).has_value());
+    }
+    // nor can a query after the values are updated in place
+    filter->Invalidate();
+    EXPECT_FALSE(evaluate_zones(1000, FilterCompareType::kLess).has_value());
+    txn_mgr->CommitTxn(txn);
+}
@@ -0,0 +1,51 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "unit_test/base_test.h"
+
+import stl;
+import bp_reorder;
+
+using namespace infinity;
+
+class BPReorderTest : public BaseTest {};
+
+TEST_F(BPReorderTest, test_clusters) {
+    // docs of cluster 0 have the terms 0..9, docs of cluster 1 the terms 10..19, mixed in both halves of the input
+    constexpr u32 doc_count = 128;
+    auto cluster = [](u32 doc) -> u32 { return doc < doc_count / 2 ? doc % 4 == 0 : doc % 4 != 0; };
+    Vector<u32> doc_term_offsets{0};
+    Vector<u32> doc_terms;
+    for (u32 doc = 0; doc < doc_count; ++doc) {
+        u32 base = cluster(doc) * 10;
+        for (u32 term = 0; term < 10; ++term) {
+            doc_terms.push_back(base + term);
+        }
+        doc_term_offsets.push_back(doc_terms.size());
+    }
+    Vector<u32> order = BPReorder(doc_term_offsets, doc_terms, 20);
+    ASSERT_EQ(order.size(), doc_count);
+    Vector<u32> sorted_order = order;
+    std::sort(sorted_order.begin(), sorted_order.end());
+    for (u32 doc = 0; doc < doc_count; ++doc) {
+        EXPECT_EQ(sorted_order[doc], doc);
+    }
+    // each half of the new order is a single cluster
+    for (u32 i = 1; i < doc_count / 2; ++i) {
+        EXPECT_EQ(cluster(order[i]), cluster(order[0]));
+        EXPECT_EQ(cluster(order[doc_count / 2 + i]), cluster(order[doc_count / 2]));
+    }
+    EXPECT_NE(cluster(order[0]), cluster(order[doc_count / 2]));
+}
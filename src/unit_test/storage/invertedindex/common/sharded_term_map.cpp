@@ -0,0 +1,59 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "unit_test/base_test.h"
+#include <thread>
+
+import stl;
+import sharded_term_map;
+
+using namespace infinity;
+
+class ShardedTermMapTest : public BaseTest {};
+
+TEST_F(ShardedTermMapTest, test_concurrent_add) {
+    ShardedTermMap<SharedPtr<u32>> term_map;
+    constexpr u32 thread_num = 8;
+    constexpr u32 term_num = 10000;
+    Vector<std::thread> threads;
+    for (u32 t = 0; t < thread_num; ++t) {
+        // every thread adds the same terms, only the first add of each term makes a value
+        threads.emplace_back([&term_map, t] {
+            for (u32 i = 0; i < term_num; ++i) {
+                SharedPtr<u32> value;
+                term_map.GetOrAdd(std::to_string(i), value, [t] { return MakeShared<u32>(t); });
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    auto items = term_map.UnsafeSortedItems();
+    ASSERT_EQ(items.size(), term_num);
+    for (SizeT i = 1; i < items.size(); ++i) {
+        EXPECT_LT(items[i - 1].first, items[i].first);
+    }
+    SharedPtr<u32> value;
+    EXPECT_TRUE(term_map.Get("42", value));
+    EXPECT_FALSE(term_map.Get("abc", value));
+
+    Vector<String> keys;
+    term_map.PrefixKeys("999", 3, keys);
+    EXPECT_EQ(keys, (Vector<String>{"999", "9990", "9991"}));
+
+    term_map.Clear();
+    EXPECT_TRUE(term_map.UnsafeSortedItems().empty());
+    EXPECT_FALSE(term_map.Get("42", value));
+}
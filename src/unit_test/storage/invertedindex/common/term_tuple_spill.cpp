@@ -0,0 +1,65 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "unit_test/base_test.h"
+
+import stl;
+import term_tuple_spill;
+
+using namespace infinity;
+
+class TermTupleSpillTest : public BaseTest {};
+
+TEST_F(TermTupleSpillTest, test_runs) {
+    // term -> number of tuples, the large term spans many read buffers
+    const Vector<Vector<Pair<String, u32>>> runs = {{{"apple", 3}, {"b", 100000}, {"cherry", 1}}, {{"a_longer_term_of_odd_length", 7}, {"b", 2}}};
+    TermTupleSpillFile spill_file("./term_tuple_spill.tmp");
+    u32 doc_id = 0;
+    for (const auto &run : runs) {
+        spill_file.BeginRun();
+        for (const auto &[term, tuple_count] : run) {
+            spill_file.AddTerm(term, tuple_count);
+            for (u32 i = 0; i < tuple_count; ++i) {
+                spill_file.AddTuple(doc_id++, i);
+            }
+        }
+        spill_file.EndRun();
+    }
+    spill_file.FinishWrite();
+    EXPECT_EQ(spill_file.RunCount(), runs.size());
+    EXPECT_EQ(spill_file.TupleCount(), doc_id);
+
+    ThreadPool read_ahead_pool(1);
+    // the smallest read buffers
+    auto readers = spill_file.OpenRunReaders(0, read_ahead_pool);
+    ASSERT_EQ(readers.size(), runs.size());
+    doc_id = 0;
+    for (SizeT run_idx = 0; run_idx < runs.size(); ++run_idx) {
+        auto &reader = readers[run_idx];
+        for (const auto &[term, tuple_count] : runs[run_idx]) {
+            ASSERT_TRUE(reader->NextTerm());
+            EXPECT_EQ(reader->term(), term);
+            u32 read_count = 0;
+            const SpillTuple *tuples = nullptr;
+            for (SizeT tuple_num = reader->ReadTuples(tuples); tuple_num > 0; tuple_num = reader->ReadTuples(tuples)) {
+                for (SizeT i = 0; i < tuple_num; ++i, ++read_count) {
+                    ASSERT_EQ(tuples[i].doc_id_, doc_id++);
+                    ASSERT_EQ(tuples[i].term_pos_, read_count);
+                }
+            }
+            EXPECT_EQ(read_count, tuple_count);
+        }
+        EXPECT_FALSE(reader->NextTerm());
+    }
+}
@@ -120,3 +120,32 @@ TEST_F(FstTest, Iterate) {
     }
     EXPECT_EQ(i, b2_num);
 }
+
+TEST_F(FstTest, IteratePrefix) {
+    Vector<u8> buffer;
+    BufferWriter wtr(buffer);
+    FstBuilder builder(wtr);
+    for (auto &month : months) {
+        builder.Insert((u8 *)month.first.c_str(), month.first.length(), month.second);
+    }
+    builder.Finish();
+
+    Fst f(buffer.data(), buffer.size());
+    FstStream s(f);
+    Vector<u8> key;
+    u64 val;
+    for (const String prefix : {"J", "Ju", "M", "Ma", "Mar", "O", "Z", "\xff"}) {
+        Vector<String> expected;
+        for (auto &month : months) {
+            if (month.first.starts_with(prefix)) {
+                expected.push_back(month.first);
+            }
+        }
+        s.Reset((u8 *)prefix.c_str(), prefix.length());
+        Vector<String> got;
+        while (s.Next(key, val)) {
+            got.emplace_back((char *)key.data(), key.size());
+        }
+        EXPECT_EQ(got, expected);
+    }
+}
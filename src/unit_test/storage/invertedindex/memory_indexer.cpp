@@ -41,6 +41,8 @@ import inmem_posting_decoder;
 import inmem_position_list_decoder;
 import inmem_index_segment_reader;
 import segment_posting;
+import term_stats;
+import term_list_cache;
 
 using namespace infinity;
 
@@ -217,3 +219,81 @@ TEST_F(MemoryIndexerTest, SpillLoadTest) {
     }
 }
 
+
+TEST_F(MemoryIndexerTest, TermStats) {
+    auto fake_segment_index_entry_1 = SegmentIndexEntry::CreateFakeEntry();
+    String column_length_file_path_1 = String("/tmp/infinity/fulltext_tbl1_col1/chunk1") + LENGTH_SUFFIX;
+    auto column_length_file_handler_1 =
+        MakeShared<FullTextColumnLengthFileHandler>(MakeUnique<LocalFileSystem>(), column_length_file_path_1, fake_segment_index_entry_1.get());
+    MemoryIndexer
+        indexer1("/tmp/infinity/fulltext_tbl1_col1", "chunk1", RowID(0U, 0U), flag_, "standard", byte_slice_pool_, buffer_pool_, thread_pool_);
+    indexer1.Insert(column_, 0, 4, std::move(column_length_file_handler_1), true);
+    indexer1.Dump(true);
+    String column_length_file_path_2 = String("/tmp/infinity/fulltext_tbl1_col1/chunk2") + LENGTH_SUFFIX;
+    auto column_length_file_handler_2 =
+        MakeShared<FullTextColumnLengthFileHandler>(MakeUnique<LocalFileSystem>(), column_length_file_path_2, fake_segment_index_entry_1.get());
+    MemoryIndexer
+        indexer2("/tmp/infinity/fulltext_tbl1_col1", "chunk2", RowID(0U, 4U), flag_, "standard", byte_slice_pool_, buffer_pool_, thread_pool_);
+    indexer2.Insert(column_, 4, 1, std::move(column_length_file_handler_2), true);
+    indexer2.Dump(true);
+
+    FullTextTermStats term_stats;
+    term_stats.Sync("/tmp/infinity/fulltext_tbl1_col1", {"chunk1", "chunk2"}, flag_);
+    EXPECT_EQ(term_stats.GetDocFreq("fst"), 3u);
+    EXPECT_EQ(term_stats.GetDocFreq("transducer"), 2u);
+    EXPECT_EQ(term_stats.GetDocFreq("nonexistent"), 0u);
+    // a removed chunk is subtracted
+    term_stats.Sync("/tmp/infinity/fulltext_tbl1_col1", {"chunk1"}, flag_);
+    EXPECT_EQ(term_stats.GetDocFreq("fst"), 3u);
+    EXPECT_EQ(term_stats.GetDocFreq("transducer"), 1u);
+    term_stats.Sync("/tmp/infinity/fulltext_tbl1_col1", {"chunk1", "chunk2"}, flag_);
+    EXPECT_EQ(term_stats.GetDocFreq("transducer"), 2u);
+
+    fake_segment_index_entry_1->AddChunkIndexEntry("chunk1", RowID(0U, 0U).ToUint64(), 4U);
+    fake_segment_index_entry_1->AddChunkIndexEntry("chunk2", RowID(0U, 4U).ToUint64(), 1U);
+    Map<SegmentID, SharedPtr<SegmentIndexEntry>> index_by_segment = {{0, fake_segment_index_entry_1}};
+    ColumnIndexReader reader;
+    reader.Open(flag_, "/tmp/infinity/fulltext_tbl1_col1", std::move(index_by_segment), &term_stats);
+    Check(reader);
+}
+
+TEST_F(MemoryIndexerTest, ReuseTerms) {
+    auto fake_segment_index_entry_1 = SegmentIndexEntry::CreateFakeEntry();
+    String column_length_file_path = String("/tmp/infinity/fulltext_tbl1_col1/chunk1") + LENGTH_SUFFIX;
+    auto column_length_file_handler =
+        MakeShared<FullTextColumnLengthFileHandler>(MakeUnique<LocalFileSystem>(), column_length_file_path, fake_segment_index_entry_1.get());
+    auto indexer1 = MakeUnique<MemoryIndexer>("/tmp/infinity/fulltext_tbl1_col1",
+                                              "chunk1",
+                                              RowID(0U, 0U),
+                                              flag_,
+                                              "standard",
+                                              byte_slice_pool_,
+                                              buffer_pool_,
+                                              thread_pool_);
+    // an online insert fills the cache
+    indexer1->Insert(column_, 0, 5, column_length_file_handler);
+    while (indexer1->GetInflightTasks() > 0) {
+        sleep(1);
+        indexer1->CommitSync();
+    }
+    TermListCache &term_list_cache = indexer1->GetTermListCache();
+    EXPECT_EQ(term_list_cache.size(), 5u);
+    EXPECT_GT(term_list_cache.bytes(), 0u);
+
+    // the same texts appended again, as UPDATE does for a column it keeps, are indexed from the cache
+    indexer1->Insert(column_, 0, 5, std::move(column_length_file_handler), false, true);
+    while (indexer1->GetInflightTasks() > 0) {
+        sleep(1);
+        indexer1->CommitSync();
+    }
+    EXPECT_EQ(term_list_cache.size(), 5u);
+
+    fake_segment_index_entry_1->SetMemoryIndexer(std::move(indexer1));
+    Map<SegmentID, SharedPtr<SegmentIndexEntry>> index_by_segment = {{0, fake_segment_index_entry_1}};
+    ColumnIndexReader reader;
+    reader.Open(flag_, "/tmp/infinity/fulltext_tbl1_col1", std::move(index_by_segment));
+    expected_postings_ = {{"fst", {0, 1, 2, 5, 6, 7}, {4, 2, 2, 4, 2, 2}},
+                          {"automaton", {0, 3, 5, 8}, {2, 5, 2, 5}},
+                          {"transducer", {0, 4, 5, 9}, {1, 4, 1, 4}}};
+    Check(reader);
+}
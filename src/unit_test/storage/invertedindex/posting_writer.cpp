@@ -26,6 +26,7 @@ import term_meta;
 import internal_types;
 import segment_posting;
 import posting_iterator;
+import byte_slice;
 
 using namespace infinity;
 
@@ -102,3 +103,110 @@ TEST_F(PostingWriterTest, test1) {
         }
     }
 }
+
+TEST_F(PostingWriterTest, StreamVByte) {
+    // two full records and a remainder long enough for the simd StreamVByte path
+    Vector<docid_t> expected;
+    for (u32 i = 0; i < 300; ++i) {
+        expected.push_back(i * 3 + 1);
+    }
+    optionflag_t flag = flag_ | of_stream_vbyte;
+    std::shared_mutex column_length_mutex;
+    Vector<u32> column_length_array(1000, 10);
+    {
+        SharedPtr<PostingWriter> posting =
+            MakeShared<PostingWriter>(&byte_slice_pool_, &buffer_pool_, PostingFormatOption(flag), column_length_mutex, column_length_array);
+        for (u32 i = 0; i < expected.size(); ++i) {
+            posting->AddPosition(1);
+            posting->EndDocument(expected[i], 0);
+        }
+        SharedPtr<FileWriter> file_writer = MakeShared<FileWriter>(fs_, file_, 128000);
+        TermMeta term_meta(posting->GetDF(), posting->GetTotalTF());
+        posting->Dump(file_writer, term_meta, true);
+        file_writer->Sync();
+    }
+    {
+        SharedPtr<PostingWriter> posting =
+            MakeShared<PostingWriter>(&byte_slice_pool_, &buffer_pool_, PostingFormatOption(flag), column_length_mutex, column_length_array);
+        SharedPtr<FileReader> file_reader = MakeShared<FileReader>(fs_, file_, 128000);
+        posting->Load(file_reader);
+
+        SharedPtr<Vector<SegmentPosting>> seg_postings = MakeShared<Vector<SegmentPosting>>();
+        SegmentPosting seg_posting;
+        seg_posting.Init(0, posting);
+        seg_postings->push_back(seg_posting);
+        PostingIterator iter(flag, &byte_slice_pool_);
+        iter.Init(seg_postings, 0);
+        for (SizeT j = 0; j < expected.size(); ++j) {
+            RowID doc_id = iter.SeekDoc(expected[j]);
+            ASSERT_EQ(doc_id, expected[j]);
+            ASSERT_EQ(iter.GetCurrentTF(), (u32)1);
+        }
+    }
+}
+
+TEST_F(PostingWriterTest, SkipIndex) {
+    // long enough for a skip index over the doc skip list
+    Vector<docid_t> expected;
+    for (u32 i = 0; i < 2 * SKIP_INDEX_MIN_DOC_FREQ; ++i) {
+        expected.push_back(i * 2 + 1);
+    }
+    optionflag_t flag = flag_ | of_skip_index;
+    std::shared_mutex column_length_mutex;
+    Vector<u32> column_length_array(expected.back() + 1, 10);
+    TermMeta term_meta;
+    {
+        SharedPtr<PostingWriter> posting =
+            MakeShared<PostingWriter>(&byte_slice_pool_, &buffer_pool_, PostingFormatOption(flag), column_length_mutex, column_length_array);
+        for (u32 i = 0; i < expected.size(); ++i) {
+            for (u32 j = 0; j <= i % 7; ++j) {
+                posting->AddPosition(j);
+            }
+            posting->EndDocument(expected[i], 0);
+        }
+        SharedPtr<FileWriter> file_writer = MakeShared<FileWriter>(fs_, file_, 128000);
+        term_meta = TermMeta(posting->GetDF(), posting->GetTotalTF());
+        posting->Dump(file_writer, term_meta);
+        file_writer->Sync();
+    }
+    SizeT file_size = LocalFileSystem::GetFileSizeByPath(file_);
+    ByteSlice *slice = ByteSlice::CreateSlice(file_size);
+    {
+        SharedPtr<FileReader> file_reader = MakeShared<FileReader>(fs_, file_, 128000);
+        file_reader->Read((char *)slice->data_, file_size);
+    }
+    auto seek = [&](PostingIterator &iter, u32 i) {
+        RowID doc_id = iter.SeekDoc(expected[i]);
+        ASSERT_EQ(doc_id, expected[i]);
+        ASSERT_EQ(iter.GetCurrentTF(), i % 7 + 1);
+    };
+    SharedPtr<Vector<SegmentPosting>> seg_postings = MakeShared<Vector<SegmentPosting>>();
+    SegmentPosting seg_posting;
+    seg_posting.Init(MakeShared<ByteSliceList>(slice), 0, term_meta.GetDocFreq(), term_meta);
+    seg_postings->push_back(seg_posting);
+    {
+        // every doc, crossing every buffer of the skip list
+        PostingIterator iter(flag, &byte_slice_pool_);
+        iter.Init(seg_postings, 0);
+        for (u32 i = 0; i < expected.size(); ++i) {
+            seek(iter, i);
+        }
+        ASSERT_EQ(iter.SeekDoc(expected.back() + 1), INVALID_ROWID);
+    }
+    {
+        // long jumps, landing between docs as well
+        PostingIterator iter(flag, &byte_slice_pool_);
+        iter.Init(seg_postings, 0);
+        for (u32 i = 5; i < expected.size(); i += 10007) {
+            ASSERT_EQ(iter.SeekDoc(expected[i] - 1), expected[i]);
+            seek(iter, i);
+        }
+        // the range of blocks from a doc is bounded by the max tf of the whole range
+        RowID range_last_doc_id = INVALID_ROWID;
+        Pair<u32, u16> max_info;
+        ASSERT_TRUE(iter.GetSkipRangeMaxInfo(expected[expected.size() - 1000], range_last_doc_id, max_info));
+        ASSERT_GE(range_last_doc_id, expected[expected.size() - 1000]);
+        ASSERT_EQ(max_info.first, 7u);
+        ASSERT_FALSE(iter.GetSkipRangeMaxInfo(expected.back() + 1, range_last_doc_id, max_info));
+    }
+}
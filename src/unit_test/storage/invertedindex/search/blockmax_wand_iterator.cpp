@@ -0,0 +1,394 @@
+//  Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+
+#include "unit_test/base_test.h"
+#include <random>
+
+import stl;
+import index_defines;
+import internal_types;
+import doc_iterator;
+import or_iterator;
+import early_terminate_iterator;
+import blockmax_wand_iterator;
+import blockmax_maxscore_iterator;
+import fulltext_score_result_heap;
+
+using namespace infinity;
+
+namespace {
+
+constexpr u32 MOCK_BLOCK_SIZE = 16;
+
+// the scores are multiples of 1/8, so their sums are exact in any order
+struct MockPosting {
+    Vector<RowID> doc_ids_;
+    Vector<float> scores_;
+};
+
+class MockPostingDocIterator final : public DocIterator {
+public:
+    explicit MockPostingDocIterator(const MockPosting &posting) : doc_ids_(posting.doc_ids_) { DoSeek(0); }
+
+    void DoSeek(RowID doc_id) override {
+        while (idx_ < doc_ids_.size() and doc_ids_[idx_] < doc_id) {
+            ++idx_;
+        }
+        doc_id_ = idx_ < doc_ids_.size() ? doc_ids_[idx_] : INVALID_ROWID;
+    }
+
+    u32 GetDF() const override { return doc_ids_.size(); }
+
+private:
+    Vector<RowID> doc_ids_;
+    u32 idx_ = 0;
+};
+
+// a term posting list split into blocks of MOCK_BLOCK_SIZE docs, like BlockMaxTermDocIterator.
+// The blocks whose docs are read are recorded in decoded_blocks as (term_id, block id).
+class MockBlockMaxTermIterator final : public EarlyTerminateIterator {
+public:
+    MockBlockMaxTermIterator(const MockPosting &posting, u32 term_id, Set<Pair<u32, u32>> *decoded_blocks)
+        : posting_(posting), term_id_(term_id), decoded_blocks_(decoded_blocks) {
+        doc_freq_ = posting_.doc_ids_.size();
+        for (u32 i = 0; i < posting_.scores_.size(); i += MOCK_BLOCK_SIZE) {
+            const u32 end = std::min<u32>(i + MOCK_BLOCK_SIZE, posting_.scores_.size());
+            block_max_scores_.push_back(*std::max_element(posting_.scores_.begin() + i, posting_.scores_.begin() + end));
+        }
+        if (!block_max_scores_.empty()) {
+            bm25_score_upper_bound_ = *std::max_element(block_max_scores_.begin(), block_max_scores_.end());
+        }
+    }
+
+    Pair<RowID, float> NextWithThreshold(float threshold) override { return BlockNextWithThreshold(threshold); }
+
+    Pair<RowID, float> BlockNextWithThreshold(float threshold) override {
+        for (; next_idx_ < posting_.doc_ids_.size(); ++next_idx_) {
+            if (posting_.scores_[next_idx_] >= threshold) {
+                doc_id_ = posting_.doc_ids_[next_idx_];
+                return {doc_id_, posting_.scores_[next_idx_++]};
+            }
+        }
+        return {INVALID_ROWID, 0.0F};
+    }
+
+    void UpdateScoreThreshold(float) override {}
+
+    bool BlockSkipTo(RowID doc_id, float threshold) override {
+        if (threshold > BM25ScoreUpperBound()) {
+            return false;
+        }
+        const u32 idx = LowerBound(doc_id);
+        for (u32 block = idx / MOCK_BLOCK_SIZE; idx < posting_.doc_ids_.size() and block < block_max_scores_.size(); ++block) {
+            if (block_max_scores_[block] >= threshold) {
+                block_ = block;
+                return true;
+            }
+        }
+        block_ = block_max_scores_.size();
+        doc_id_ = INVALID_ROWID;
+        return false;
+    }
+
+    RowID BlockMinPossibleDocID() const override {
+        if (Exhausted()) {
+            return INVALID_ROWID;
+        }
+        return block_ == 0 ? RowID(0, 0) : posting_.doc_ids_[block_ * MOCK_BLOCK_SIZE - 1] + 1;
+    }
+
+    RowID BlockLastDocID() const override {
+        if (Exhausted()) {
+            return INVALID_ROWID;
+        }
+        return posting_.doc_ids_[std::min<u32>((block_ + 1) * MOCK_BLOCK_SIZE, posting_.doc_ids_.size()) - 1];
+    }
+
+    float BlockMaxBM25Score() override { return Exhausted() ? 0.0F : block_max_scores_[block_]; }
+
+    Tuple<bool, float, RowID> SeekInBlockRange(RowID doc_id, float threshold, RowID doc_id_no_beyond) override {
+        if (threshold > BlockMaxBM25Score()) {
+            return {false, 0.0F, INVALID_ROWID};
+        }
+        const RowID seek_end = std::min(doc_id_no_beyond, BlockLastDocID());
+        if (Exhausted() or doc_id > seek_end) {
+            return {false, 0.0F, INVALID_ROWID};
+        }
+        decoded_blocks_->emplace(term_id_, block_);
+        for (u32 idx = LowerBound(doc_id); idx < posting_.doc_ids_.size(); ++idx) {
+            doc_id_ = posting_.doc_ids_[idx];
+            if (doc_id_ > seek_end) {
+                break;
+            }
+            if (posting_.scores_[idx] >= threshold) {
+                return {true, posting_.scores_[idx], doc_id_};
+            }
+        }
+        return {false, 0.0F, INVALID_ROWID};
+    }
+
+    Pair<bool, RowID> PeekInBlockRange(RowID doc_id, RowID doc_id_no_beyond) override {
+        const RowID seek_end = std::min(doc_id_no_beyond, BlockLastDocID());
+        if (Exhausted() or doc_id > seek_end) {
+            return {false, INVALID_ROWID};
+        }
+        decoded_blocks_->emplace(term_id_, block_);
+        if (const u32 idx = LowerBound(doc_id); idx < posting_.doc_ids_.size() and posting_.doc_ids_[idx] <= seek_end) {
+            return {true, posting_.doc_ids_[idx]};
+        }
+        return {false, INVALID_ROWID};
+    }
+
+private:
+    // BlockSkipTo() failed, or there is no doc at all
+    bool Exhausted() const { return block_ >= block_max_scores_.size(); }
+
+    u32 LowerBound(RowID doc_id) const {
+        return std::lower_bound(posting_.doc_ids_.begin(), posting_.doc_ids_.end(), doc_id) - posting_.doc_ids_.begin();
+    }
+
+    const MockPosting &posting_;
+    const u32 term_id_ = 0;
+    Set<Pair<u32, u32>> *decoded_blocks_ = nullptr;
+    Vector<float> block_max_scores_;
+    u32 block_ = 0;
+    u32 next_idx_ = 0;
+};
+
+// doc ids in [0, max_doc_id], scores in [1/8, 8]
+MockPosting RandomPosting(std::mt19937 &rng, u32 doc_count, u32 max_doc_id) {
+    std::uniform_int_distribution<u32> gen_id(0, max_doc_id);
+    std::uniform_int_distribution<u32> gen_score(1, 64);
+    Vector<RowID> doc_ids;
+    for (u32 i = 0; i < doc_count; ++i) {
+        doc_ids.push_back(RowID(0, gen_id(rng)));
+    }
+    std::sort(doc_ids.begin(), doc_ids.end());
+    doc_ids.erase(std::unique(doc_ids.begin(), doc_ids.end()), doc_ids.end());
+    MockPosting posting;
+    posting.doc_ids_ = std::move(doc_ids);
+    for (SizeT i = 0; i < posting.doc_ids_.size(); ++i) {
+        posting.scores_.push_back(gen_score(rng) / 8.0f);
+    }
+    return posting;
+}
+
+using DocScores = Vector<Pair<RowID, float>>;
+
+} // namespace
+
+class BlockMaxWandIteratorTest : public BaseTest {
+public:
+    void SetUp() override {
+        std::mt19937 rng(2024);
+        // uneven children: a long one, a short one ending early, a rare one, and an empty one exhausted from the start
+        postings_.push_back(RandomPosting(rng, 20'000, 100'000));
+        postings_.push_back(RandomPosting(rng, 3'000, 10'000));
+        postings_.push_back(RandomPosting(rng, 200, 100'000));
+        postings_.push_back(MockPosting{});
+        for (const auto &posting : postings_) {
+            for (SizeT i = 0; i < posting.doc_ids_.size(); ++i) {
+                expect_scores_[posting.doc_ids_[i].ToUint64()] += posting.scores_[i];
+            }
+        }
+    }
+
+    void TearDown() override {}
+
+    template <typename T>
+    UniquePtr<EarlyTerminateIterator> MakeUnion() {
+        Vector<UniquePtr<EarlyTerminateIterator>> children;
+        for (u32 i = 0; i < postings_.size(); ++i) {
+            children.emplace_back(MakeUnique<MockBlockMaxTermIterator>(postings_[i], i, &decoded_blocks_));
+        }
+        return MakeUnique<T>(std::move(children));
+    }
+
+    // all the docs scoring at least threshold, the threshold doesn't change
+    static DocScores CollectAbove(EarlyTerminateIterator &iter, float threshold) {
+        DocScores result;
+        while (true) {
+            auto [id, score] = iter.BlockNextWithThreshold(threshold);
+            if (id == INVALID_ROWID) {
+                return result;
+            }
+            result.emplace_back(id, score);
+        }
+    }
+
+    // the top_n loop of PhysicalMatch, the threshold rises with the results
+    static DocScores CollectTopN(EarlyTerminateIterator &iter, u32 top_n) {
+        Vector<float> scores(top_n);
+        Vector<RowID> row_ids(top_n);
+        FullTextScoreResultHeap result_heap(top_n, scores.data(), row_ids.data());
+        while (true) {
+            auto [id, score] = iter.BlockNextWithThreshold(result_heap.GetScoreThreshold());
+            if (id == INVALID_ROWID) {
+                break;
+            }
+            if (result_heap.AddResult(score, id)) {
+                iter.UpdateScoreThreshold(result_heap.GetScoreThreshold());
+            }
+        }
+        result_heap.Sort();
+        DocScores result;
+        for (u32 i = 0; i < result_heap.GetResultSize(); ++i) {
+            result.emplace_back(row_ids[i], scores[i]);
+        }
+        return result;
+    }
+
+    DocScores ExpectAbove(float threshold) const {
+        DocScores result;
+        for (auto [doc_id, score] : expect_scores_) {
+            if (score >= threshold) {
+                result.emplace_back(RowID(doc_id), score);
+            }
+        }
+        return result;
+    }
+
+    DocScores ExpectTopN(u32 top_n) const {
+        DocScores result = ExpectAbove(0.0f);
+        std::sort(result.begin(), result.end(), [](const auto &a, const auto &b) {
+            return a.second > b.second or (a.second == b.second and a.first < b.first);
+        });
+        result.resize(std::min<SizeT>(result.size(), top_n));
+        return result;
+    }
+
+    Vector<MockPosting> postings_;
+    Map<u64, float> expect_scores_;
+    Set<Pair<u32, u32>> decoded_blocks_;
+};
+
+TEST_F(BlockMaxWandIteratorTest, test_union) {
+    // the same docs as OrIterator
+    Vector<UniquePtr<DocIterator>> or_children;
+    for (const auto &posting : postings_) {
+        or_children.emplace_back(MakeUnique<MockPostingDocIterator>(posting));
+    }
+    OrIterator or_it(std::move(or_children));
+    Vector<RowID> or_doc_ids;
+    for (RowID doc_id = or_it.Doc(); doc_id != INVALID_ROWID; doc_id = or_it.Next()) {
+        or_doc_ids.push_back(doc_id);
+    }
+
+    auto wand_it = MakeUnion<BlockMaxWandIterator>();
+    EXPECT_EQ(wand_it->DocFreq(), or_it.GetDF());
+    DocScores wand_result = CollectAbove(*wand_it, 0.0f);
+    ASSERT_EQ(wand_result.size(), or_doc_ids.size());
+    for (SizeT i = 0; i < or_doc_ids.size(); ++i) {
+        EXPECT_EQ(wand_result[i].first, or_doc_ids[i]);
+    }
+    // with the scores summed over the children
+    EXPECT_EQ(wand_result, ExpectAbove(0.0f));
+
+    auto maxscore_it = MakeUnion<BlockMaxMaxscoreIterator>();
+    EXPECT_EQ(CollectAbove(*maxscore_it, 0.0f), wand_result);
+}
+
+TEST_F(BlockMaxWandIteratorTest, test_threshold) {
+    for (float threshold : {1.0f, 4.0f, 8.5f, 12.0f, 16.125f, 24.0f}) {
+        auto wand_it = MakeUnion<BlockMaxWandIterator>();
+        auto maxscore_it = MakeUnion<BlockMaxMaxscoreIterator>();
+        DocScores wand_result = CollectAbove(*wand_it, threshold);
+        EXPECT_EQ(wand_result, ExpectAbove(threshold));
+        EXPECT_EQ(CollectAbove(*maxscore_it, threshold), wand_result);
+    }
+    // no doc can reach it
+    auto wand_it = MakeUnion<BlockMaxWandIterator>();
+    EXPECT_EQ(wand_it->BlockNextWithThreshold(wand_it->BM25ScoreUpperBound() + 1.0f).first, INVALID_ROWID);
+}
+
+TEST_F(BlockMaxWandIteratorTest, test_top_n) {
+    for (u32 top_n : {1u, 10u, 100u, 10'000u, 100'000u}) {
+        auto wand_it = MakeUnion<BlockMaxWandIterator>();
+        auto maxscore_it = MakeUnion<BlockMaxMaxscoreIterator>();
+        DocScores wand_result = CollectTopN(*wand_it, top_n);
+        EXPECT_EQ(wand_result, ExpectTopN(top_n));
+        EXPECT_EQ(CollectTopN(*maxscore_it, top_n), wand_result);
+    }
+}
+
+TEST_F(BlockMaxWandIteratorTest, test_next_with_threshold) {
+    auto block_it = MakeUnion<BlockMaxWandIterator>();
+    auto it = MakeUnion<BlockMaxWandIterator>();
+    for (float threshold : {0.0f, 2.0f, 9.0f}) {
+        while (true) {
+            auto result = it->NextWithThreshold(threshold);
+            EXPECT_EQ(result, block_it->BlockNextWithThreshold(threshold));
+            if (result.first == INVALID_ROWID) {
+                break;
+            }
+        }
+    }
+}
+
+TEST_F(BlockMaxWandIteratorTest, test_exhausted_children) {
+    // every child is empty
+    postings_ = {MockPosting{}, MockPosting{}};
+    auto wand_it = MakeUnion<BlockMaxWandIterator>();
+    EXPECT_EQ(wand_it->BlockNextWithThreshold(0.0f).first, INVALID_ROWID);
+
+    // one child only, the others run out before it
+    std::mt19937 rng(7);
+    postings_ = {RandomPosting(rng, 10, 100), RandomPosting(rng, 1, 50), RandomPosting(rng, 5'000, 100'000), MockPosting{}};
+    expect_scores_.clear();
+    for (const auto &posting : postings_) {
+        for (SizeT i = 0; i < posting.doc_ids_.size(); ++i) {
+            expect_scores_[posting.doc_ids_[i].ToUint64()] += posting.scores_[i];
+        }
+    }
+    wand_it = MakeUnion<BlockMaxWandIterator>();
+    EXPECT_EQ(CollectAbove(*wand_it, 0.0f), ExpectAbove(0.0f));
+    // called again after the end
+    EXPECT_EQ(wand_it->BlockNextWithThreshold(0.0f).first, INVALID_ROWID);
+    wand_it = MakeUnion<BlockMaxWandIterator>();
+    EXPECT_EQ(CollectTopN(*wand_it, 20), ExpectTopN(20));
+}
+
+TEST_F(BlockMaxWandIteratorTest, test_block_skip) {
+    // three children with the same upper bound, so the upper bounds alone never skip a doc once the threshold is their sum.
+    // All of them score 8 on the docs of their first block, and 1/8 on the rest.
+    postings_.clear();
+    expect_scores_.clear();
+    constexpr u32 doc_count = 2'000;
+    for (u32 i = 0; i < 3; ++i) {
+        MockPosting posting;
+        for (u32 doc = 0; doc < doc_count; ++doc) {
+            posting.doc_ids_.push_back(RowID(0, doc * 3 + (doc < MOCK_BLOCK_SIZE ? 0 : i)));
+            posting.scores_.push_back(doc < MOCK_BLOCK_SIZE ? 8.0f : 0.125f);
+        }
+        postings_.push_back(std::move(posting));
+    }
+    for (const auto &posting : postings_) {
+        for (SizeT i = 0; i < posting.doc_ids_.size(); ++i) {
+            expect_scores_[posting.doc_ids_[i].ToUint64()] += posting.scores_[i];
+        }
+    }
+    const u32 total_blocks = 3 * (doc_count / MOCK_BLOCK_SIZE);
+
+    auto wand_it = MakeUnion<BlockMaxWandIterator>();
+    EXPECT_EQ(wand_it->BM25ScoreUpperBound(), 24.0f);
+    EXPECT_EQ(CollectTopN(*wand_it, 10), ExpectTopN(10));
+    // the threshold reaches 24 in the first blocks, the block max scores of the others rule them out without reading them
+    EXPECT_LE(decoded_blocks_.size(), 3 * 2u);
+    EXPECT_LT(decoded_blocks_.size(), total_blocks);
+
+    decoded_blocks_.clear();
+    wand_it = MakeUnion<BlockMaxWandIterator>();
+    EXPECT_EQ(CollectAbove(*wand_it, 0.0f).size(), expect_scores_.size());
+    EXPECT_EQ(decoded_blocks_.size(), total_blocks);
+}
@@ -0,0 +1,39 @@
+//  Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+
+#include "unit_test/base_test.h"
+import stl;
+import highlighter;
+
+using namespace infinity;
+
+class HighlighterTest : public BaseTest {};
+
+TEST_F(HighlighterTest, test_words) {
+    // stemmed terms are extended to the end of the word, and only match at the start of a word
+    Highlighter highlighter({"harm", "chemic"}, 0);
+    EXPECT_EQ(highlighter.Highlight("Harmful chemicals, not harm or pharmacy."),
+              "<em>Harmful</em> <em>chemicals</em>, not <em>harm</em> or pharmacy.");
+    EXPECT_EQ(highlighter.Highlight("nothing here"), "nothing here");
+    // terms without word boundaries match anywhere
+    Highlighter cjk_highlighter({"中文"}, 0);
+    EXPECT_EQ(cjk_highlighter.Highlight("我们的中文分词"), "我们的<em>中文</em>分词");
+}
+
+TEST_F(HighlighterTest, test_snippet) {
+    Highlighter highlighter({"target"}, 16);
+    EXPECT_EQ(highlighter.Highlight("aaaa bbbb cccc dddd target eeee ffff gggg"), "...ddd <em>target</em> eeee ...");
+    EXPECT_EQ(highlighter.Highlight("aaaa bbbb cccc dddd eeee ffff gggg"), "aaaa bbbb cccc d...");
+    EXPECT_EQ(highlighter.Highlight("short target"), "short <em>target</em>");
+}
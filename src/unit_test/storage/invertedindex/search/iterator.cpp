@@ -22,6 +22,7 @@ import doc_iterator;
 import and_iterator;
 import or_iterator;
 import and_not_iterator;
+import phrase_doc_iterator;
 import internal_types;
 
 using namespace infinity;
@@ -203,3 +204,19 @@ TEST_F(SearchIteratorTestN, test_and_not) {
         EXPECT_EQ(and_not_it.Doc(), expect_res.Doc());
     }
 }
+
+class PhrasePositionsMatchTest : public BaseTest {};
+
+TEST_F(PhrasePositionsMatchTest, test1) {
+    // "a b c": exact match at 3, 4, 5
+    Vector<Vector<pos_t>> positions = {{0, 3, 9}, {4, 7}, {2, 5}};
+    EXPECT_TRUE(PhrasePositionsMatch(positions, 0));
+    // "a b c": nearest is a at 3, b at 7, c at 5
+    positions = {{0, 3}, {7}, {5}};
+    EXPECT_FALSE(PhrasePositionsMatch(positions, 0));
+    EXPECT_FALSE(PhrasePositionsMatch(positions, 2));
+    EXPECT_TRUE(PhrasePositionsMatch(positions, 3));
+    // missing term
+    positions = {{0, 3}, {}};
+    EXPECT_FALSE(PhrasePositionsMatch(positions, 100));
+}
@@ -77,6 +77,10 @@ name:dune
 #basic_filter_boost with implicit field
 dune^1.2
 
+#phrase
+"dune god"
+name:"dune god"^1.2
+
 #basic_filter_boost with explicit field
 name:dune^1.2
 
@@ -0,0 +1,103 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "unit_test/base_test.h"
+import stl;
+import term;
+import term_list_cache;
+
+using namespace infinity;
+
+class TermListCacheTest : public BaseTest {
+protected:
+    // a term list of the words of the text
+    static SharedPtr<const TermList> MakeTerms(const String &text) {
+        auto terms = MakeShared<TermList>();
+        u32 offset = 0;
+        SizeT begin = 0;
+        while (begin < text.size()) {
+            SizeT end = text.find(' ', begin);
+            if (end == String::npos) {
+                end = text.size();
+            }
+            terms->Add(text.data() + begin, end - begin, offset++, 0, 0);
+            begin = end + 1;
+        }
+        return terms;
+    }
+};
+
+TEST_F(TermListCacheTest, test1) {
+    const String text_a = "apple banana";
+    const String text_b = "banana cherry";
+    const String text_c = "cherry grape";
+    SizeT entry_bytes = TermListCache::EntryBytes(text_a, *MakeTerms(text_a));
+    ASSERT_EQ(TermListCache::EntryBytes(text_b, *MakeTerms(text_b)), entry_bytes + 2);
+    ASSERT_EQ(TermListCache::EntryBytes(text_c, *MakeTerms(text_c)), entry_bytes);
+
+    // room for a and b, not for c as well
+    TermListCache cache(2 * entry_bytes + 2);
+    ASSERT_EQ(cache.Get(text_a).get(), nullptr);
+    cache.Put(text_a, MakeTerms(text_a));
+    cache.Put(text_b, MakeTerms(text_b));
+    ASSERT_EQ(cache.size(), 2u);
+    ASSERT_EQ(cache.bytes(), 2 * entry_bytes + 2);
+
+    SharedPtr<const TermList> terms = cache.Get(text_a);
+    ASSERT_NE(terms.get(), nullptr);
+    ASSERT_EQ(terms->size(), 2u);
+    ASSERT_EQ((*terms)[0].text_, "apple");
+    ASSERT_EQ((*terms)[1].text_, "banana");
+    ASSERT_EQ((*terms)[1].word_offset_, 1u);
+
+    // b is the least recently used
+    cache.Put(text_c, MakeTerms(text_c));
+    ASSERT_EQ(cache.size(), 2u);
+    ASSERT_EQ(cache.bytes(), 2 * entry_bytes);
+    ASSERT_EQ(cache.Get(text_b).get(), nullptr);
+    ASSERT_NE(cache.Get(text_a).get(), nullptr);
+    ASSERT_NE(cache.Get(text_c).get(), nullptr);
+
+    // a text put again replaces its terms and becomes the most recently used
+    cache.Put(text_a, MakeTerms("apple"));
+    ASSERT_EQ(cache.size(), 2u);
+    ASSERT_EQ(cache.Get(text_a)->size(), 1u);
+    ASSERT_LT(cache.bytes(), 2 * entry_bytes);
+    cache.Put(text_b, MakeTerms(text_b));
+    ASSERT_EQ(cache.Get(text_c).get(), nullptr);
+    ASSERT_NE(cache.Get(text_a).get(), nullptr);
+    ASSERT_NE(cache.Get(text_b).get(), nullptr);
+    ASSERT_LE(cache.bytes(), 2 * entry_bytes + 2);
+
+    cache.Clear();
+    ASSERT_EQ(cache.size(), 0u);
+    ASSERT_EQ(cache.bytes(), 0u);
+    ASSERT_EQ(cache.Get(text_a).get(), nullptr);
+}
+
+TEST_F(TermListCacheTest, test_entry_larger_than_capacity) {
+    const String text = "apple banana cherry";
+    SizeT entry_bytes = TermListCache::EntryBytes(text, *MakeTerms(text));
+
+    TermListCache cache(entry_bytes - 1);
+    cache.Put(text, MakeTerms(text));
+    ASSERT_EQ(cache.size(), 0u);
+    ASSERT_EQ(cache.bytes(), 0u);
+    ASSERT_EQ(cache.Get(text).get(), nullptr);
+
+    // an entry that fits is kept alone
+    cache.Put("apple", MakeTerms("apple"));
+    ASSERT_EQ(cache.size(), 1u);
+    ASSERT_NE(cache.Get("apple").get(), nullptr);
+}
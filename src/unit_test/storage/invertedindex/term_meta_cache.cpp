@@ -0,0 +1,96 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "unit_test/base_test.h"
+import stl;
+import term_meta;
+import term_meta_cache;
+
+using namespace infinity;
+
+class TermMetaCacheTest : public BaseTest {
+protected:
+    static TermMeta MakeTermMeta(u64 doc_start) {
+        TermMeta term_meta(3, 5);
+        term_meta.doc_start_ = doc_start;
+        term_meta.pos_start_ = doc_start + 10;
+        term_meta.pos_end_ = doc_start + 20;
+        return term_meta;
+    }
+};
+
+TEST_F(TermMetaCacheTest, test1) {
+    TermMetaCache cache(4);
+    String key_a = TermMetaCache::MakeKey("/chunk_0.pos", 10, "a");
+    String key_b = TermMetaCache::MakeKey("/chunk_0.pos", 10, "b");
+    cache.Put(key_a, MakeTermMeta(100));
+    cache.Put(key_b, MakeTermMeta(200));
+    ASSERT_EQ(cache.size(), 2u);
+
+    // the file offsets survive the cache
+    TermMeta term_meta;
+    ASSERT_TRUE(cache.Get(key_a, term_meta));
+    ASSERT_EQ(term_meta.doc_freq_, 3u);
+    ASSERT_EQ(term_meta.total_tf_, 5u);
+    ASSERT_EQ(term_meta.doc_start_, 100u);
+    ASSERT_EQ(term_meta.pos_start_, 110u);
+    ASSERT_EQ(term_meta.pos_end_, 120u);
+
+    // b is the least recently used
+    for (SizeT i = 0; i < 3; ++i) {
+        cache.Put(TermMetaCache::MakeKey("/chunk_1.pos", 20, std::to_string(i)), MakeTermMeta(i));
+    }
+    ASSERT_EQ(cache.size(), 4u);
+    ASSERT_FALSE(cache.Get(key_b, term_meta));
+    ASSERT_TRUE(cache.Get(key_a, term_meta));
+
+    // the same chunk committed again is another entry
+    ASSERT_FALSE(cache.Get(TermMetaCache::MakeKey("/chunk_1.pos", 30, "2"), term_meta));
+    ASSERT_TRUE(cache.Get(TermMetaCache::MakeKey("/chunk_1.pos", 20, "2"), term_meta));
+    ASSERT_EQ(term_meta.doc_start_, 2u);
+}
+
+TEST_F(TermMetaCacheTest, test_erase) {
+    TermMetaCache cache(16);
+    TermMeta term_meta;
+    String key_a = TermMetaCache::MakeKey("/chunk_0.pos", 10, "a");
+    ASSERT_FALSE(cache.Get(key_a, term_meta));
+    cache.Put(key_a, MakeTermMeta(100));
+    ASSERT_TRUE(cache.Get(key_a, term_meta));
+    // another term of the chunk and the same term of another chunk miss
+    ASSERT_FALSE(cache.Get(TermMetaCache::MakeKey("/chunk_0.pos", 10, "b"), term_meta));
+    ASSERT_FALSE(cache.Get(TermMetaCache::MakeKey("/chunk_1.pos", 10, "a"), term_meta));
+
+    for (SizeT i = 0; i < 3; ++i) {
+        cache.Put(TermMetaCache::MakeKey("/chunk_0.pos", 20, std::to_string(i)), MakeTermMeta(i));
+        cache.Put(TermMetaCache::MakeKey("/chunk_1.pos", 10, std::to_string(i)), MakeTermMeta(i));
+        cache.Put(TermMetaCache::MakeKey("/chunk_10.pos", 10, std::to_string(i)), MakeTermMeta(i));
+    }
+    ASSERT_EQ(cache.size(), 10u);
+
+    // the entries of a removed chunk are gone whatever their commit ts, the others stay
+    cache.Erase({"/chunk_0.pos", "/chunk_2.pos"});
+    ASSERT_EQ(cache.size(), 6u);
+    ASSERT_FALSE(cache.Get(key_a, term_meta));
+    ASSERT_FALSE(cache.Get(TermMetaCache::MakeKey("/chunk_0.pos", 20, "0"), term_meta));
+    ASSERT_TRUE(cache.Get(TermMetaCache::MakeKey("/chunk_1.pos", 10, "0"), term_meta));
+    ASSERT_TRUE(cache.Get(TermMetaCache::MakeKey("/chunk_10.pos", 10, "2"), term_meta));
+    ASSERT_EQ(term_meta.doc_start_, 2u);
+
+    // a chunk looked up again after the erase is cached again
+    cache.Put(key_a, MakeTermMeta(300));
+    ASSERT_TRUE(cache.Get(key_a, term_meta));
+    ASSERT_EQ(term_meta.doc_start_, 300u);
+    ASSERT_EQ(cache.size(), 7u);
+}
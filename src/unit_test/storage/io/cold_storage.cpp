@@ -0,0 +1,85 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "unit_test/base_test.h"
+#include <filesystem>
+#include <fstream>
+
+import stl;
+import cold_storage;
+import third_party;
+
+using namespace infinity;
+
+class ColdStorageTest : public BaseTest {
+protected:
+    void SetUp() override {
+        BaseTest::SetUp();
+        std::filesystem::remove_all(data_dir_);
+        std::filesystem::remove_all(cold_dir_);
+    }
+
+    void TearDown() override {
+        std::filesystem::remove_all(data_dir_);
+        std::filesystem::remove_all(cold_dir_);
+        BaseTest::TearDown();
+    }
+
+    String WriteFile(SizeT i, SizeT size) {
+        String path = fmt::format("{}/seg/{}", data_dir_, i);
+        std::filesystem::create_directories(Path(path).parent_path());
+        std::ofstream(path) << String(size, 'a');
+        return path;
+    }
+
+    const String data_dir_ = "/tmp/infinity/unit_test/cold_storage_data";
+    const String cold_dir_ = "/tmp/infinity/unit_test/cold_storage_cold";
+};
+
+TEST_F(ColdStorageTest, test_evict_and_fetch) {
+    ColdStorage cold_storage(data_dir_, cold_dir_, 250);
+    Vector<String> paths;
+    for (SizeT i = 0; i < 3; ++i) {
+        paths.push_back(WriteFile(i, 100));
+        cold_storage.Upload(paths.back());
+    }
+    cold_storage.WaitForUploads();
+    for (SizeT i = 0; i < 3; ++i) {
+        EXPECT_TRUE(std::filesystem::exists(fmt::format("{}/seg/{}", cold_dir_, i)));
+    }
+    // the least recently uploaded file is evicted
+    EXPECT_FALSE(std::filesystem::exists(paths[0]));
+    EXPECT_EQ(cold_storage.local_cache_usage(), 200u);
+
+    EXPECT_TRUE(cold_storage.Fetch(paths[0]));
+    EXPECT_EQ(std::filesystem::file_size(paths[0]), 100u);
+    EXPECT_FALSE(std::filesystem::exists(paths[1]));
+    EXPECT_TRUE(std::filesystem::exists(paths[2]));
+    EXPECT_FALSE(cold_storage.Fetch(fmt::format("{}/seg/none", data_dir_)));
+
+    cold_storage.Remove(paths[1]);
+    EXPECT_FALSE(std::filesystem::exists(fmt::format("{}/seg/1", cold_dir_)));
+    EXPECT_FALSE(cold_storage.Fetch(paths[1]));
+}
+
+TEST_F(ColdStorageTest, test_remove_during_upload) {
+    ColdStorage cold_storage(data_dir_, cold_dir_, 1000);
+    String path = WriteFile(0, 100);
+    cold_storage.Upload(path);
+    cold_storage.Remove(path);
+    cold_storage.WaitForUploads();
+    EXPECT_FALSE(std::filesystem::exists(fmt::format("{}/seg/0", cold_dir_)));
+    EXPECT_EQ(cold_storage.local_cache_usage(), 0u);
+}
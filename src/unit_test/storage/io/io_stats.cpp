@@ -0,0 +1,81 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "unit_test/base_test.h"
+
+import stl;
+import file_system;
+import local_file_system;
+import file_system_type;
+import io_stats;
+
+class IOStatsTest : public BaseTest {};
+
+TEST_F(IOStatsTest, table_io_test) {
+    using namespace infinity;
+    LocalFileSystem local_file_system;
+    String path = "/tmp/infinity/unit_test/io_stats.test";
+    local_file_system.CreateDirectory("/tmp/infinity/unit_test");
+
+    IOStatsRegistry &registry = IOStatsRegistry::instance();
+    SharedPtr<TableIOStats> table_io_stats = registry.NewTableIOStats("default_db", "t1");
+    IOStatsInfo compaction_write_before = registry.PurposeSnapshot(IOPurpose::kCompaction, IODirection::kWrite);
+    IOStatsInfo compaction_read_before = registry.PurposeSnapshot(IOPurpose::kCompaction, IODirection::kRead);
+
+    char data[100]{};
+    {
+        IOPurposeScope io_purpose_scope(IOPurpose::kCompaction);
+        IOTableScope io_table_scope(table_io_stats.get());
+        {
+            // the nested scope overrides the purpose, the table is kept
+            IOPurposeScope nested_scope(IOPurpose::kCheckpoint);
+            EXPECT_EQ(ThreadIOContext().purpose_, IOPurpose::kCheckpoint);
+            EXPECT_EQ(ThreadIOContext().table_io_stats_, table_io_stats.get());
+        }
+        EXPECT_EQ(ThreadIOContext().purpose_, IOPurpose::kCompaction);
+
+        UniquePtr<FileHandler> file_handler =
+            local_file_system.OpenFile(path, FileFlags::WRITE_FLAG | FileFlags::TRUNCATE_CREATE, FileLockType::kWriteLock);
+        EXPECT_EQ(local_file_system.Write(*file_handler, data, sizeof(data)), 100);
+        EXPECT_EQ(local_file_system.Write(*file_handler, data, 50), 50);
+        file_handler->Close();
+
+        file_handler = local_file_system.OpenFile(path, FileFlags::READ_FLAG, FileLockType::kReadLock);
+        EXPECT_EQ(local_file_system.Read(*file_handler, data, sizeof(data)), 100);
+        file_handler->Close();
+    }
+    EXPECT_EQ(ThreadIOContext().purpose_, IOPurpose::kOther);
+    EXPECT_EQ(ThreadIOContext().table_io_stats_, nullptr);
+
+    IOStatsInfo table_write = table_io_stats->Snapshot(IODirection::kWrite);
+    EXPECT_EQ(table_write.bytes_, 150u);
+    EXPECT_EQ(table_write.ops_, 2u);
+    IOStatsInfo table_read = table_io_stats->Snapshot(IODirection::kRead);
+    EXPECT_EQ(table_read.bytes_, 100u);
+    EXPECT_EQ(table_read.ops_, 1u);
+
+    IOStatsInfo compaction_write = registry.PurposeSnapshot(IOPurpose::kCompaction, IODirection::kWrite);
+    EXPECT_EQ(compaction_write.bytes_ - compaction_write_before.bytes_, 150u);
+    EXPECT_EQ(compaction_write.ops_ - compaction_write_before.ops_, 2u);
+    IOStatsInfo compaction_read = registry.PurposeSnapshot(IOPurpose::kCompaction, IODirection::kRead);
+    EXPECT_EQ(compaction_read.bytes_ - compaction_read_before.bytes_, 100u);
+
+    // io outside of the scope isn't counted for the table
+    UniquePtr<FileHandler> file_handler = local_file_system.OpenFile(path, FileFlags::READ_FLAG, FileLockType::kReadLock);
+    local_file_system.Read(*file_handler, data, sizeof(data));
+    file_handler->Close();
+    EXPECT_EQ(table_io_stats->Snapshot(IODirection::kRead).ops_, 1u);
+
+    local_file_system.DeleteFile(path);
+}
@@ -27,6 +27,7 @@ import file_writer;
 import file_reader;
 import infinity_context;
 import file_system_type;
+import io_uring;
 
 class LocalFileSystemTest : public BaseTest {};
 
@@ -74,3 +75,60 @@ TEST_F(LocalFileSystemTest, dir_ops) {
     EXPECT_FALSE(local_file_system.Exists(path));
     EXPECT_FALSE(local_file_system.Exists(dir));
 }
+
+TEST_F(LocalFileSystemTest, sync_files) {
+    using namespace infinity;
+    LocalFileSystem local_file_system;
+    String dir = "/tmp/infinity/unit_test/sync_files";
+    local_file_system.CreateDirectory(dir);
+
+    // more files than the queue depth of the ring
+    constexpr SizeT file_count = 100;
+    Vector<UniquePtr<FileHandler>> file_handlers;
+    for (SizeT i = 0; i < file_count; ++i) {
+        String path = fmt::format("{}/{}", dir, i);
+        file_handlers.push_back(local_file_system.OpenFile(path, FileFlags::WRITE_FLAG | FileFlags::TRUNCATE_CREATE, FileLockType::kWriteLock));
+        file_handlers.back()->Write(&i, sizeof(i));
+    }
+    local_file_system.SyncFiles(file_handlers);
+    file_handlers.clear();
+    for (SizeT i = 0; i < file_count; ++i) {
+        EXPECT_EQ(LocalFileSystem::GetFileSizeByPath(fmt::format("{}/{}", dir, i)), sizeof(i));
+    }
+    local_file_system.DeleteDirectory(dir);
+}
+
+TEST_F(LocalFileSystemTest, io_uring) {
+    using namespace infinity;
+    IOUring ring(4);
+    if (!ring.Valid()) {
+        GTEST_SKIP() << "io_uring is not available";
+    }
+    LocalFileSystem local_file_system;
+    String path = "/tmp/test_io_uring.abc";
+    UniquePtr<FileHandler> file_handler =
+        local_file_system.OpenFile(path, FileFlags::READ_FLAG | FileFlags::WRITE_FLAG | FileFlags::TRUNCATE_CREATE, FileLockType::kWriteLock);
+    i32 fd = static_cast<LocalFileHandler *>(file_handler.get())->fd_;
+
+    String data(100, 'a');
+    Vector<i32> results(3, -1);
+    EXPECT_TRUE(ring.PrepareWrite(fd, data.data(), data.size(), 0, 0));
+    EXPECT_EQ(ring.SubmitAndWait(results), 0);
+    EXPECT_TRUE(ring.PrepareFsync(fd, 1));
+    EXPECT_EQ(ring.SubmitAndWait(results), 0);
+    String read_data(100, '\0');
+    EXPECT_TRUE(ring.PrepareRead(fd, read_data.data(), read_data.size(), 50, 2));
+    EXPECT_EQ(ring.SubmitAndWait(results), 0);
+    EXPECT_EQ(results, (Vector<i32>{100, 0, 50}));
+    EXPECT_EQ(read_data.substr(0, 50), data.substr(0, 50));
+
+    // the ring holds 4 requests
+    for (SizeT i = 0; i < 4; ++i) {
+        EXPECT_TRUE(ring.PrepareFsync(fd, 0));
+    }
+    EXPECT_FALSE(ring.PrepareFsync(fd, 0));
+    EXPECT_EQ(ring.SubmitAndWait(results), 0);
+
+    file_handler->Close();
+    local_file_system.DeleteFile(path);
+}
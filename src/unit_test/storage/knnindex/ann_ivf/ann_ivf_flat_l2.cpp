@@ -171,3 +171,32 @@ TEST_F(AnnIVFFlatL2Test, test1) {
         }
     }
 }
+
+TEST_F(AnnIVFFlatL2Test, test_batch) {
+    using namespace infinity;
+
+    // a batch scans the lists list by list with gemm, each query finds the base vector it copies
+    i64 dimension = 4;
+    i64 top_k = 2;
+    i64 base_embedding_count = 4;
+    i64 query_count = 10;
+    Vector<f32> base_embedding{0.1, 0.2, 0.3, 0.4, 0.2, 0.1, 0.3, 0.4, 0.3, 0.2, 0.1, 0.4, 0.4, 0.3, 0.2, 0.1};
+    Vector<f32> query_embedding(dimension * query_count);
+    for (i64 i = 0; i < query_count; ++i) {
+        Copy(base_embedding.begin() + (i % base_embedding_count) * dimension,
+             base_embedding.begin() + (i % base_embedding_count + 1) * dimension,
+             query_embedding.begin() + i * dimension);
+    }
+    auto ann_ivf_l2_index = AnnIVFFlatL2<f32>::CreateIndex(dimension, base_embedding_count, base_embedding.data(), 2);
+
+    for (u32 n_probes : {1u, 2u}) {
+        AnnIVFFlatL2<f32> ann_distance(query_embedding.data(), query_count, top_k, dimension, EmbeddingDataType::kElemFloat);
+        ann_distance.Begin();
+        ann_distance.Search(ann_ivf_l2_index.get(), 0, n_probes);
+        ann_distance.End();
+        for (i64 i = 0; i < query_count; ++i) {
+            EXPECT_NEAR(ann_distance.GetDistanceByIdx(i)[0], 0, 1e-5);
+            EXPECT_EQ(ann_distance.GetIDByIdx(i)[0].segment_offset_, u32(i % base_embedding_count));
+        }
+    }
+}
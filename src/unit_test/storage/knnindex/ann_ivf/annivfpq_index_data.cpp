@@ -0,0 +1,111 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "unit_test/base_test.h"
+#include <random>
+
+import stl;
+import index_base;
+import hnsw_common;
+import annivfpq_index_data;
+
+using namespace infinity;
+
+class AnnIVFPQTest : public BaseTest {
+protected:
+    // the last subspace is shorter than the others
+    static constexpr u32 dimension = 20;
+    static constexpr u32 vector_count = 4096;
+    static constexpr u32 partition_num = 16;
+
+    static Vector<f32> RandomVectors() {
+        std::default_random_engine rng;
+        std::normal_distribution<f32> dist(0, 1);
+        Vector<f32> vectors(vector_count * dimension);
+        for (auto &v : vectors) {
+            v = dist(rng);
+        }
+        return vectors;
+    }
+
+    // share of the queries whose own id is among the k nearest found
+    static f32 SelfRecall(const AnnIVFPQIndexData &index, const Vector<f32> &vectors, u32 query_count, SizeT k) {
+        u32 found = 0;
+        for (u32 i = 0; i < query_count; ++i) {
+            auto result = index.Search(vectors.data() + i * dimension, partition_num, k, [](SegmentOffset) { return true; });
+            EXPECT_LE(result.size(), k);
+            EXPECT_TRUE(std::is_sorted(result.begin(), result.end()));
+            for (const auto &[distance, id] : result) {
+                found += id == i;
+            }
+        }
+        return f32(found) / query_count;
+    }
+};
+
+TEST_F(AnnIVFPQTest, test_l2) {
+    Vector<f32> vectors = RandomVectors();
+    AnnIVFPQIndexData index(MetricType::kMetricL2, dimension, partition_num, 8);
+    DenseVectorIter<f32, SegmentOffset> iter(vectors.data(), dimension, vector_count);
+    index.BuildIndex(iter, dimension, vector_count);
+    EXPECT_EQ(index.data_num_, vector_count);
+    EXPECT_EQ(index.subspace_num_, 3u);
+
+    EXPECT_GE(SelfRecall(index, vectors, 100, 10), 0.9f);
+}
+
+TEST_F(AnnIVFPQTest, test_ip) {
+    Vector<f32> vectors = RandomVectors();
+    AnnIVFPQIndexData index(MetricType::kMetricInnerProduct, dimension, partition_num, 4);
+    DenseVectorIter<f32, SegmentOffset> iter(vectors.data(), dimension, vector_count);
+    index.BuildIndex(iter, dimension, vector_count);
+
+    // the inner product with itself is not always the largest, compare with the exact top k instead
+    constexpr SizeT k = 10;
+    constexpr SizeT candidate_k = 4 * k;
+    u32 found = 0;
+    for (u32 i = 0; i < 50; ++i) {
+        const f32 *query = vectors.data() + i * dimension;
+        Vector<Pair<f32, SegmentOffset>> exact;
+        for (u32 j = 0; j < vector_count; ++j) {
+            f32 ip = 0;
+            for (u32 d = 0; d < dimension; ++d) {
+                ip += query[d] * vectors[j * dimension + d];
+            }
+            exact.emplace_back(-ip, j);
+        }
+        std::partial_sort(exact.begin(), exact.begin() + k, exact.end());
+        auto result = index.Search(query, partition_num, candidate_k, [](SegmentOffset) { return true; });
+        for (SizeT e = 0; e < k; ++e) {
+            found += std::any_of(result.begin(), result.end(), [&](const auto &r) { return r.second == exact[e].second; });
+        }
+    }
+    EXPECT_GE(f32(found) / (50 * k), 0.8f);
+}
+
+TEST_F(AnnIVFPQTest, test_filter) {
+    Vector<f32> vectors = RandomVectors();
+    AnnIVFPQIndexData index(MetricType::kMetricL2, dimension, partition_num, 8);
+    DenseVectorIter<f32, SegmentOffset> iter(vectors.data(), dimension, vector_count);
+    index.BuildIndex(iter, dimension, vector_count);
+
+    auto odd = [](SegmentOffset id) { return id % 2 == 1; };
+    for (u32 i = 0; i < 10; ++i) {
+        auto result = index.Search(vectors.data() + i * dimension, 4, 10, odd);
+        EXPECT_EQ(result.size(), 10u);
+        for (const auto &[distance, id] : result) {
+            EXPECT_EQ(id % 2, 1u);
+        }
+    }
+}
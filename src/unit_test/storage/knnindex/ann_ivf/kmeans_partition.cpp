@@ -0,0 +1,59 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "unit_test/base_test.h"
+#include <random>
+
+import stl;
+import index_base;
+import kmeans_partition;
+
+using namespace infinity;
+
+class KMeansPartitionTest : public BaseTest {};
+
+TEST_F(KMeansPartitionTest, test_separated_clusters) {
+    // enough training vectors to be split across threads
+    constexpr u32 dimension = 8;
+    constexpr u32 cluster_num = 4;
+    constexpr u32 cluster_size = 8192;
+    constexpr u32 vector_count = cluster_num * cluster_size;
+    std::default_random_engine rng;
+    std::normal_distribution<f32> noise(0, 1);
+    Vector<f32> vectors(vector_count * dimension);
+    for (u32 i = 0; i < vector_count; ++i) {
+        for (u32 j = 0; j < dimension; ++j) {
+            vectors[i * dimension + j] = (j == i % cluster_num ? 100.0f : 0.0f) + noise(rng);
+        }
+    }
+
+    Vector<f32> centroids;
+    u32 partition_num =
+        GetKMeansCentroids<f32>(MetricType::kMetricL2, dimension, vector_count, vectors.data(), centroids, cluster_num, 0, 32, 1u << 20);
+    EXPECT_EQ(partition_num, cluster_num);
+
+    // every cluster center has a centroid next to it
+    for (u32 c = 0; c < cluster_num; ++c) {
+        bool found = false;
+        for (u32 p = 0; p < partition_num; ++p) {
+            f32 distance = 0;
+            for (u32 j = 0; j < dimension; ++j) {
+                f32 diff = centroids[p * dimension + j] - (j == c ? 100.0f : 0.0f);
+                distance += diff * diff;
+            }
+            found = found || distance < 1.0f;
+        }
+        EXPECT_TRUE(found);
+    }
+}
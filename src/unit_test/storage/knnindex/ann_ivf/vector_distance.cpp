@@ -0,0 +1,61 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "unit_test/base_test.h"
+#include <random>
+
+import stl;
+import vector_distance;
+
+using namespace infinity;
+
+class VectorDistanceTest : public BaseTest {};
+
+TEST_F(VectorDistanceTest, test_i8) {
+    constexpr SizeT dim = 203;
+    std::default_random_engine rng;
+    std::uniform_int_distribution<i32> dist(-128, 127);
+    Vector<i8> v1(dim), v2(dim);
+    for (SizeT i = 0; i < dim; ++i) {
+        v1[i] = dist(rng);
+        v2[i] = dist(rng);
+    }
+    i32 l2 = 0, ip = 0;
+    for (SizeT i = 0; i < dim; ++i) {
+        l2 += (i32(v1[i]) - v2[i]) * (i32(v1[i]) - v2[i]);
+        ip += i32(v1[i]) * v2[i];
+    }
+    EXPECT_EQ((L2Distance<f32, i8, i8, SizeT>(v1.data(), v2.data(), dim)), f32(l2));
+    EXPECT_EQ((IPDistance<f32, i8, i8, SizeT>(v1.data(), v2.data(), dim)), f32(ip));
+}
+
+TEST_F(VectorDistanceTest, test_hamming) {
+    // 13 bytes, one u64 word and a byte tail
+    constexpr SizeT byte_count = 13;
+    std::default_random_engine rng;
+    std::uniform_int_distribution<u32> dist(0, 255);
+    Vector<u8> v1(byte_count), v2(byte_count);
+    for (SizeT i = 0; i < byte_count; ++i) {
+        v1[i] = dist(rng);
+        v2[i] = dist(rng);
+    }
+    u32 expect = 0;
+    for (SizeT i = 0; i < byte_count; ++i) {
+        for (u32 bit = 0; bit < 8; ++bit) {
+            expect += ((v1[i] >> bit) & 1) != ((v2[i] >> bit) & 1);
+        }
+    }
+    EXPECT_EQ((HammingDistance<f32, SizeT>(v1.data(), v2.data(), byte_count)), f32(expect));
+    EXPECT_EQ((HammingDistance<f32, SizeT>(v1.data(), v1.data(), byte_count)), 0.0f);
+}
@@ -65,9 +65,12 @@ TEST_F(DistFuncTest, test1) {
         auto v1 = vecs1.get() + i * dim;
         auto v2 = vecs2.get() + i * dim;
 
-        int32_t res = I8IPSSEResidual(v1, v2, dim);
         int32_t res2 = I8IPTest(v1, v2, dim);
+#if defined(USE_SSE)
+        int32_t res = I8IPSSEResidual(v1, v2, dim);
         EXPECT_EQ(res, res2);
+#endif
+        EXPECT_EQ(GetI8IPFunc(dim)(v1, v2, dim), res2);
     }
 }
 
@@ -134,3 +137,36 @@ TEST_F(DistFuncTest, test2) {
         // EXPECT_NEAR(dist1, dist2, 1e-5);
     }
 }
+
+TEST_F(DistFuncTest, test_dispatch) {
+    // the kernels picked for the cpu agree with the scalar ones, for dimensions with and without a residual
+    std::default_random_engine rng;
+    std::uniform_int_distribution<int8_t> idist(-128, 127);
+    std::uniform_real_distribution<float> rdist(-1, 1);
+    for (size_t dim : {15, 16, 32, 64, 100, 128, 200, 256}) {
+        auto i1 = std::make_unique<int8_t[]>(dim);
+        auto i2 = std::make_unique<int8_t[]>(dim);
+        auto f1 = std::make_unique<float[]>(dim);
+        auto f2 = std::make_unique<float[]>(dim);
+        for (size_t i = 0; i < dim; ++i) {
+            i1[i] = idist(rng);
+            i2[i] = idist(rng);
+            f1[i] = rdist(rng);
+            f2[i] = rdist(rng);
+        }
+        EXPECT_EQ(GetI8IPFunc(dim)(i1.get(), i2.get(), dim), I8IPBF(i1.get(), i2.get(), dim));
+        EXPECT_NEAR(GetF32L2Func(dim)(f1.get(), f2.get(), dim), F32L2BF(f1.get(), f2.get(), dim), 1e-4);
+        EXPECT_NEAR(GetF32IPFunc(dim)(f1.get(), f2.get(), dim), F32IPBF(f1.get(), f2.get(), dim), 1e-4);
+    }
+
+    size_t subspace_num = 20;
+    auto table = std::make_unique<float[]>(subspace_num * 256);
+    auto codes = std::make_unique<uint8_t[]>(subspace_num);
+    for (size_t i = 0; i < subspace_num * 256; ++i) {
+        table[i] = rdist(rng);
+    }
+    for (size_t i = 0; i < subspace_num; ++i) {
+        codes[i] = uint8_t(i * 37);
+    }
+    EXPECT_NEAR(GetF32PQTableSumFunc()(table.get(), codes.get(), subspace_num), F32PQTableSumBF(table.get(), codes.get(), subspace_num), 1e-4);
+}
@@ -0,0 +1,62 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "unit_test/base_test.h"
+
+#include <random>
+
+import stl;
+import hnsw_alg;
+import plain_store;
+import dist_func_l2;
+
+using namespace infinity;
+
+class HnswBatchSearchTest : public BaseTest {};
+
+// A batch search returns the same results as searching the queries one by one.
+TEST_F(HnswBatchSearchTest, test_same_as_single) {
+    using LabelT = u64;
+    using Hnsw = KnnHnsw<float, LabelT, PlainStore<float, LabelT>, PlainL2Dist<float, LabelT>>;
+
+    constexpr SizeT dim = 16;
+    constexpr SizeT element_size = 1000;
+    constexpr SizeT query_n = 32;
+    constexpr SizeT topk = 10;
+
+    std::mt19937 rng;
+    rng.seed(0);
+    std::uniform_real_distribution<float> distrib_real;
+    auto data = MakeUnique<float[]>(dim * element_size);
+    for (SizeT i = 0; i < dim * element_size; ++i) {
+        data[i] = distrib_real(rng);
+    }
+
+    auto hnsw_index = Hnsw::Make(element_size, dim, 16, 200, {});
+    hnsw_index->InsertVecsRaw(data.get(), element_size);
+
+    const float *queries = data.get();
+    auto results = hnsw_index->KnnSearchBatch(queries, query_n, topk);
+    ASSERT_EQ(results.size(), query_n);
+    for (SizeT query_i = 0; query_i < query_n; ++query_i) {
+        auto [result_n, d_ptr, l_ptr] = hnsw_index->KnnSearch(queries + query_i * dim, topk);
+        auto &[batch_result_n, batch_d_ptr, batch_l_ptr] = results[query_i];
+        ASSERT_EQ(batch_result_n, result_n);
+        for (SizeT i = 0; i < result_n; ++i) {
+            EXPECT_EQ(batch_d_ptr[i], d_ptr[i]);
+            EXPECT_EQ(batch_l_ptr[i], l_ptr[i]);
+        }
+    }
+}
@@ -0,0 +1,131 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "unit_test/base_test.h"
+
+#include <algorithm>
+#include <random>
+
+import stl;
+import hnsw_mem_index;
+import index_hnsw;
+import index_base;
+import local_file_system;
+
+using namespace infinity;
+
+class HnswMemIndexTest : public BaseTest {
+public:
+    static constexpr SizeT dim = 16;
+    static constexpr SizeT element_size = 1000;
+    static constexpr SizeT topk = 10;
+    static constexpr SegmentOffset begin_offset = 4096; // the rows before it are in the segment index
+    const String file_dir_ = tmp_data_path();
+
+    // Each query is one of the inserted vectors, so its nearest neighbor is itself.
+    static void CheckSelfNearest(const HnswMemIndex &mem_index, const float *data) {
+        SizeT query_n = 50;
+        auto results = mem_index.KnnSearchBatch(data, query_n, topk);
+        ASSERT_EQ(results.size(), query_n);
+        for (SizeT query_i = 0; query_i < query_n; ++query_i) {
+            const auto &[result_n, d_ptr, l_ptr] = results[query_i];
+            ASSERT_GT(result_n, 0u);
+            SizeT nearest = std::min_element(d_ptr.get(), d_ptr.get() + result_n) - d_ptr.get();
+            EXPECT_EQ(l_ptr[nearest], begin_offset + query_i);
+        }
+    }
+};
+
+TEST_F(HnswMemIndexTest, test_insert_dump_load) {
+    std::mt19937 rng;
+    rng.seed(0);
+    std::uniform_real_distribution<float> distrib_real;
+    auto data = MakeUnique<float[]>(dim * element_size);
+    for (SizeT i = 0; i < dim * element_size; ++i) {
+        data[i] = distrib_real(rng);
+    }
+
+    // the chunk keeps full precision vectors even for a pq index
+    IndexHnsw index_hnsw(MakeShared<String>("idx"), "idx_file", {"col"}, MetricType::kMetricL2, HnswEncodeType::kPQ, 16, 200, 200);
+    HnswMemIndex mem_index(&index_hnsw, dim, element_size);
+    // rows come in at commit time, a few at a time
+    SizeT half = element_size / 2;
+    mem_index.Insert(data.get(), begin_offset, half);
+    mem_index.Insert(data.get() + half * dim, begin_offset + half, element_size - half);
+    EXPECT_EQ(mem_index.row_count(), element_size);
+    CheckSelfNearest(mem_index, data.get());
+
+    LocalFileSystem fs;
+    if (!fs.Exists(file_dir_)) {
+        fs.CreateDirectory(file_dir_);
+    }
+    String file_path = file_dir_ + "/hnsw_mem_index.bin";
+    if (fs.Exists(file_path)) {
+        fs.DeleteFile(file_path);
+    }
+    mem_index.Dump(file_path);
+    auto loaded_index = HnswMemIndex::Load(&index_hnsw, file_path);
+    EXPECT_EQ(loaded_index->row_count(), element_size);
+    CheckSelfNearest(*loaded_index, data.get());
+}
+
+TEST_F(HnswMemIndexTest, test_build_skip_deleted) {
+    std::mt19937 rng;
+    rng.seed(0);
+    std::uniform_real_distribution<float> distrib_real;
+    auto data = MakeUnique<float[]>(dim * element_size);
+    for (SizeT i = 0; i < dim * element_size; ++i) {
+        data[i] = distrib_real(rng);
+    }
+
+    // a rebuild leaves out the deleted rows, here the odd ones, and keeps the offsets of the others as labels
+    class EvenRowIter {
+    public:
+        EvenRowIter(const float *data, SizeT row_count) : data_(data), row_count_(row_count) {}
+
+        Optional<Pair<const float *, SegmentOffset>> Next() {
+            if (row_i_ >= row_count_) {
+                return None;
+            }
+            SizeT row_i = row_i_;
+            row_i_ += 2;
+            return std::make_pair(data_ + row_i * dim, begin_offset + SegmentOffset(row_i));
+        }
+
+    private:
+        const float *data_;
+        SizeT row_count_;
+        SizeT row_i_ = 0;
+    };
+
+    IndexHnsw index_hnsw(MakeShared<String>("idx"), "idx_file", {"col"}, MetricType::kMetricL2, HnswEncodeType::kLVQ, 16, 200, 200);
+    HnswMemIndex mem_index(&index_hnsw, dim, element_size, index_hnsw.encode_type_);
+    mem_index.Build(EvenRowIter(data.get(), element_size), element_size);
+    EXPECT_EQ(mem_index.row_count(), element_size / 2);
+    EXPECT_EQ(mem_index.encode_type(), HnswEncodeType::kLVQ);
+
+    SizeT query_n = 50;
+    auto results = mem_index.KnnSearchBatch(data.get(), query_n, topk);
+    for (SizeT query_i = 0; query_i < query_n; ++query_i) {
+        const auto &[result_n, d_ptr, l_ptr] = results[query_i];
+        ASSERT_GT(result_n, 0u);
+        for (SizeT i = 0; i < result_n; ++i) {
+            EXPECT_EQ((l_ptr[i] - begin_offset) % 2, 0u);
+        }
+        if (query_i % 2 == 0) {
+            SizeT nearest = std::min_element(d_ptr.get(), d_ptr.get() + result_n) - d_ptr.get();
+            EXPECT_EQ(l_ptr[nearest], begin_offset + query_i);
+        }
+    }
+}
@@ -0,0 +1,92 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "unit_test/base_test.h"
+
+#include <random>
+
+import stl;
+import hnsw_alg;
+import plain_store;
+import lvq_store;
+import dist_func_l2;
+import local_file_system;
+import file_system;
+import file_system_type;
+
+using namespace infinity;
+
+class HnswMmapTest : public BaseTest {
+public:
+    static constexpr SizeT dim = 16;
+    static constexpr SizeT element_size = 999; // odd, so the u32 labels need padding
+    static constexpr SizeT topk = 10;
+    const String file_dir_ = tmp_data_path();
+
+    // An index loaded from the mapped file returns the same results as the index that was saved.
+    template <typename Hnsw, typename InitArgs>
+    void TestSameResult(InitArgs init_args) {
+        std::mt19937 rng;
+        rng.seed(0);
+        std::uniform_real_distribution<float> distrib_real;
+        auto data = MakeUnique<float[]>(dim * element_size);
+        for (SizeT i = 0; i < dim * element_size; ++i) {
+            data[i] = distrib_real(rng);
+        }
+
+        LocalFileSystem fs;
+        if (!fs.Exists(file_dir_)) {
+            fs.CreateDirectory(file_dir_);
+        }
+        String file_path = file_dir_ + "/hnsw_mmap.bin";
+        if (fs.Exists(file_path)) {
+            fs.DeleteFile(file_path);
+        }
+
+        auto hnsw_index = Hnsw::Make(element_size, dim, 16, 200, init_args);
+        hnsw_index->InsertVecsRaw(data.get(), element_size);
+        {
+            u8 file_flags = FileFlags::WRITE_FLAG | FileFlags::CREATE_FLAG;
+            UniquePtr<FileHandler> file_handler = fs.OpenFile(file_path, file_flags, FileLockType::kWriteLock);
+            hnsw_index->Save(*file_handler);
+            file_handler->Close();
+        }
+
+        auto mapped_index = Hnsw::LoadFromMmap(file_path, init_args);
+        EXPECT_EQ(mapped_index->GetVertexNum(), element_size);
+        for (SizeT query_i = 0; query_i < 50; ++query_i) {
+            const float *query = data.get() + query_i * dim;
+            auto expect = hnsw_index->KnnSearchSorted(query, topk);
+            auto result = mapped_index->KnnSearchSorted(query, topk);
+            ASSERT_EQ(result.size(), expect.size());
+            for (SizeT i = 0; i < result.size(); ++i) {
+                EXPECT_EQ(result[i].first, expect[i].first);
+                EXPECT_EQ(result[i].second, expect[i].second);
+            }
+        }
+    }
+};
+
+TEST_F(HnswMmapTest, test_plain) {
+    using LabelT = u32;
+    using Hnsw = KnnHnsw<float, LabelT, PlainStore<float, LabelT>, PlainL2Dist<float, LabelT>>;
+    TestSameResult<Hnsw>(Tuple<>{});
+}
+
+TEST_F(HnswMmapTest, test_lvq) {
+    using LabelT = u32;
+    using Hnsw = KnnHnsw<float, LabelT, LVQStore<float, LabelT, i8, LVQL2Cache<float, i8>>, LVQL2Dist<float, LabelT, i8>>;
+    TestSameResult<Hnsw>(SizeT(0));
+}
@@ -0,0 +1,98 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "unit_test/base_test.h"
+
+#include <random>
+
+import stl;
+import hnsw_alg;
+import pq_store;
+import dist_func_l2;
+import dist_func_ip;
+
+using namespace infinity;
+
+class HnswPQTest : public BaseTest {
+public:
+    static constexpr SizeT dim = 32;
+    static constexpr SizeT element_size = 2000;
+    static constexpr SizeT query_n = 100;
+    static constexpr SizeT topk = 10;
+
+    // The fraction of queries whose exact nearest neighbor is among the topk results of the pq index.
+    template <typename Hnsw, typename ExactDist>
+    static float Recall(ExactDist exact_dist) {
+        std::mt19937 rng;
+        rng.seed(0);
+        std::uniform_real_distribution<float> distrib_real;
+        auto data = MakeUnique<float[]>(dim * element_size);
+        for (SizeT i = 0; i < dim * element_size; ++i) {
+            data[i] = distrib_real(rng);
+        }
+        auto queries = MakeUnique<float[]>(dim * query_n);
+        for (SizeT i = 0; i < dim * query_n; ++i) {
+            queries[i] = distrib_real(rng);
+        }
+
+        auto hnsw_index = Hnsw::Make(element_size, dim, 16, 200, {});
+        hnsw_index->InsertVecsRaw(data.get(), element_size);
+
+        SizeT found = 0;
+        for (SizeT query_i = 0; query_i < query_n; ++query_i) {
+            const float *query = queries.get() + query_i * dim;
+            SizeT nearest = 0;
+            for (SizeT i = 1; i < element_size; ++i) {
+                if (exact_dist(query, data.get() + i * dim) < exact_dist(query, data.get() + nearest * dim)) {
+                    nearest = i;
+                }
+            }
+            auto result = hnsw_index->KnnSearchSorted(query, topk);
+            for (const auto &[dist, label] : result) {
+                if (label == nearest) {
+                    ++found;
+                    break;
+                }
+            }
+        }
+        return float(found) / query_n;
+    }
+};
+
+TEST_F(HnswPQTest, test_l2) {
+    using LabelT = u64;
+    using Hnsw = KnnHnsw<float, LabelT, PQStore<float, LabelT, PQL2Metric<float>>, PQL2Dist<float, LabelT>>;
+    auto l2 = [](const float *v1, const float *v2) {
+        float res = 0;
+        for (SizeT i = 0; i < dim; ++i) {
+            res += (v1[i] - v2[i]) * (v1[i] - v2[i]);
+        }
+        return res;
+    };
+    EXPECT_GE(Recall<Hnsw>(l2), 0.5);
+}
+
+TEST_F(HnswPQTest, test_ip) {
+    using LabelT = u64;
+    using Hnsw = KnnHnsw<float, LabelT, PQStore<float, LabelT, PQIPMetric<float>>, PQIPDist<float, LabelT>>;
+    auto neg_ip = [](const float *v1, const float *v2) {
+        float res = 0;
+        for (SizeT i = 0; i < dim; ++i) {
+            res += v1[i] * v2[i];
+        }
+        return -res;
+    };
+    EXPECT_GE(Recall<Hnsw>(neg_ip), 0.5);
+}
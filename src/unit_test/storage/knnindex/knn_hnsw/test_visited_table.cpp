@@ -0,0 +1,55 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "unit_test/base_test.h"
+
+import stl;
+import hnsw_mem_pool;
+
+using namespace infinity;
+
+class HnswVisitedTableTest : public BaseTest {};
+
+TEST_F(HnswVisitedTableTest, test_reset) {
+    VisitedTable visited;
+    visited.Reset(10);
+    for (SizeT i = 0; i < 10; i += 2) {
+        visited.Visit(i);
+    }
+    for (SizeT i = 0; i < 10; ++i) {
+        EXPECT_EQ(visited.Visited(i), i % 2 == 0);
+    }
+
+    // a new search sees nothing visited, also on the grown part of the table
+    visited.Reset(20);
+    for (SizeT i = 0; i < 20; ++i) {
+        EXPECT_FALSE(visited.Visited(i));
+    }
+    visited.Visit(15);
+    EXPECT_TRUE(visited.Visited(15));
+}
+
+TEST_F(HnswVisitedTableTest, test_epoch_wrap) {
+    VisitedTable visited;
+    visited.Reset(4);
+    visited.Visit(1);
+    // the tag of vertex 1 would match the epoch again after it wraps around
+    for (SizeT i = 0; i < std::numeric_limits<u16>::max(); ++i) {
+        visited.Reset(4);
+        visited.Visit(0);
+    }
+    EXPECT_FALSE(visited.Visited(1));
+    EXPECT_TRUE(visited.Visited(0));
+}
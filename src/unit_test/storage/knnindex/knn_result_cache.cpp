@@ -0,0 +1,70 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "unit_test/base_test.h"
+
+import stl;
+import knn_result_cache;
+import internal_types;
+
+using namespace infinity;
+
+class KnnResultCacheTest : public BaseTest {
+protected:
+    static SharedPtr<const KnnCacheEntry> MakeEntry(TxnTimeStamp compute_ts, f32 distance) {
+        auto entry = MakeShared<KnnCacheEntry>();
+        entry->compute_ts_ = compute_ts;
+        entry->results_.push_back(Vector<Pair<f32, RowID>>{{distance, RowID(0, 1)}});
+        return entry;
+    }
+};
+
+TEST_F(KnnResultCacheTest, get_put) {
+    KnnResultCache cache(4);
+    EXPECT_EQ(cache.Get("q1"), nullptr);
+
+    cache.Put("q1", MakeEntry(10, 0.5f));
+    auto entry = cache.Get("q1");
+    ASSERT_NE(entry, nullptr);
+    EXPECT_EQ(entry->compute_ts_, 10u);
+    ASSERT_EQ(entry->results_.size(), 1u);
+    EXPECT_EQ(entry->results_[0][0].first, 0.5f);
+    EXPECT_EQ(entry->results_[0][0].second, RowID(0, 1));
+
+    // a later query of the same key replaces the entry, a reader keeps the old one
+    cache.Put("q1", MakeEntry(20, 0.25f));
+    EXPECT_EQ(cache.size(), 1u);
+    EXPECT_EQ(cache.Get("q1")->compute_ts_, 20u);
+    EXPECT_EQ(entry->compute_ts_, 10u);
+}
+
+TEST_F(KnnResultCacheTest, evict_least_recently_used) {
+    KnnResultCache cache(2);
+    cache.Put("q1", MakeEntry(1, 1.0f));
+    cache.Put("q2", MakeEntry(2, 2.0f));
+    // q1 is used, so q2 is the least recently used one
+    EXPECT_NE(cache.Get("q1"), nullptr);
+    cache.Put("q3", MakeEntry(3, 3.0f));
+    EXPECT_EQ(cache.size(), 2u);
+    EXPECT_NE(cache.Get("q1"), nullptr);
+    EXPECT_EQ(cache.Get("q2"), nullptr);
+    EXPECT_NE(cache.Get("q3"), nullptr);
+}
+
+TEST_F(KnnResultCacheTest, zero_capacity) {
+    KnnResultCache cache(0);
+    cache.Put("q1", MakeEntry(1, 1.0f));
+    EXPECT_EQ(cache.size(), 0u);
+    EXPECT_EQ(cache.Get("q1"), nullptr);
+}
@@ -0,0 +1,147 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "unit_test/base_test.h"
+#include <random>
+
+import stl;
+import merge_knn;
+import knn_result_handler;
+import vector_distance;
+import bitmask;
+import internal_types;
+import index_base;
+
+using namespace infinity;
+
+class MergeKnnTest : public BaseTest {
+protected:
+    static constexpr u32 dimension = 16;
+    static constexpr u32 query_count = 10;
+    static constexpr u32 row_count = 3000;
+    static constexpr u32 topk = 5;
+
+    // the gemm search of a block finds the same rows as the per query search
+    template <template <typename, typename> typename C>
+    static void CheckSameResult(MetricType metric, bool filter) {
+        std::default_random_engine rng;
+        std::uniform_real_distribution<f32> dist(-1, 1);
+        Vector<f32> queries(query_count * dimension);
+        Vector<f32> data(row_count * dimension);
+        for (auto &v : queries) {
+            v = dist(rng);
+        }
+        for (auto &v : data) {
+            v = dist(rng);
+        }
+        Bitmask bitmask;
+        bitmask.Initialize(std::bit_ceil(row_count));
+        if (filter) {
+            for (u32 i = 0; i < row_count; i += 3) {
+                bitmask.SetFalse(i);
+            }
+        }
+        f32 (*dist_func)(const f32 *, const f32 *, SizeT) = L2Distance<f32, f32, f32, SizeT>;
+        if (metric == MetricType::kMetricInnerProduct) {
+            dist_func = IPDistance<f32, f32, f32, SizeT>;
+        } else if (metric == MetricType::kMetricCosine) {
+            dist_func = CosineDistance<f32, f32, f32, SizeT>;
+            for (u32 i = 0; i < query_count; ++i) {
+                L2Normalize(queries.data() + i * dimension, queries.data() + i * dimension, dimension);
+            }
+        }
+
+        MergeKnn<f32, C> expected(query_count, topk);
+        expected.Begin();
+        expected.Search(queries.data(), data.data(), dimension, dist_func, row_count, 0, 1, bitmask);
+        expected.End();
+        MergeKnn<f32, C> actual(query_count, topk);
+        actual.Begin();
+        actual.SearchGemm(queries.data(), data.data(), dimension, metric, row_count, 0, 1, bitmask);
+        actual.End();
+
+        EXPECT_EQ(actual.total_count(), expected.total_count());
+        for (u32 i = 0; i < query_count; ++i) {
+            for (u32 j = 0; j < topk; ++j) {
+                EXPECT_EQ(actual.GetIDsByIdx(i)[j], expected.GetIDsByIdx(i)[j]);
+                EXPECT_NEAR(actual.GetDistancesByIdx(i)[j], expected.GetDistancesByIdx(i)[j], 1e-3);
+            }
+        }
+    }
+};
+
+TEST_F(MergeKnnTest, test_gemm_l2) {
+    CheckSameResult<CompareMax>(MetricType::kMetricL2, false);
+    CheckSameResult<CompareMax>(MetricType::kMetricL2, true);
+}
+
+TEST_F(MergeKnnTest, test_gemm_ip) {
+    CheckSameResult<CompareMin>(MetricType::kMetricInnerProduct, false);
+    CheckSameResult<CompareMin>(MetricType::kMetricInnerProduct, true);
+}
+
+TEST_F(MergeKnnTest, test_gemm_cosine) {
+    CheckSameResult<CompareMin>(MetricType::kMetricCosine, false);
+    CheckSameResult<CompareMin>(MetricType::kMetricCosine, true);
+}
+
+TEST_F(MergeKnnTest, test_range) {
+    // rows on a line, the distance to the query at the origin is the squared row index
+    constexpr u32 line_rows = 100;
+    Vector<f32> query(dimension, 0);
+    Vector<f32> data(line_rows * dimension, 0);
+    for (u32 i = 0; i < line_rows; ++i) {
+        data[i * dimension] = i;
+    }
+    Bitmask bitmask;
+    bitmask.Initialize(std::bit_ceil(line_rows));
+    bitmask.SetFalse(3);
+
+    // the threshold keeps more rows than topk
+    MergeKnn<f32, CompareMax> merge_knn(1, topk, 49.0f);
+    EXPECT_TRUE(merge_knn.IsRangeSearch());
+    merge_knn.Begin();
+    merge_knn.Search(query.data(), data.data(), dimension, L2Distance<f32, f32, f32, SizeT>, line_rows, 0, 0, bitmask);
+    merge_knn.End();
+
+    Vector<u32> expected_offsets{0, 1, 2, 4, 5, 6, 7};
+    ASSERT_EQ(merge_knn.ResultCount(0), i64(expected_offsets.size()));
+    for (SizeT i = 0; i < expected_offsets.size(); ++i) {
+        EXPECT_EQ(merge_knn.GetIDsByIdx(0)[i].segment_offset_, expected_offsets[i]);
+        EXPECT_EQ(merge_knn.GetDistancesByIdx(0)[i], f32(expected_offsets[i] * expected_offsets[i]));
+    }
+}
+
+TEST_F(MergeKnnTest, test_maxsim) {
+    // rows of 3 tokens of dimension 2, the last token of row 1 is padding
+    constexpr u32 token_dim = 2;
+    Vector<f32> query{1, 0, 0, 1};
+    Vector<f32> data{1, 0, 0, 2, -1, -1, 0.5, 0.5, 0, 0.5, 0, 0, -1, 0, 0, -1, -1, -1};
+    Bitmask bitmask;
+    bitmask.Initialize(std::bit_ceil(3u));
+
+    MergeKnn<f32, CompareMin> merge_knn(1, 3);
+    merge_knn.Begin();
+    merge_knn.SearchMaxSim(query.data(), 2 * token_dim, data.data(), 3 * token_dim, token_dim, 3, 0, 0, bitmask);
+    merge_knn.End();
+
+    // row 0: 1 + 2, row 1: 0.5 + 0.5, row 2: 0 + 0
+    ASSERT_EQ(merge_knn.ResultCount(0), 3);
+    Vector<u32> expected_offsets{0, 1, 2};
+    Vector<f32> expected_scores{3, 1, 0};
+    for (SizeT i = 0; i < 3; ++i) {
+        EXPECT_EQ(merge_knn.GetIDsByIdx(0)[i].segment_offset_, expected_offsets[i]);
+        EXPECT_FLOAT_EQ(merge_knn.GetDistancesByIdx(0)[i], expected_scores[i]);
+    }
+}
@@ -14,6 +14,9 @@
 
 #include "unit_test/base_test.h"
 
+#include <filesystem>
+#include <fstream>
+
 import infinity_context;
 import infinity_exception;
 
@@ -33,6 +36,8 @@ import status;
 import extra_ddl_info;
 
 import base_entry;
+import log_file;
+import buffer_manager;
 
 class CatalogTest : public BaseTest {
     void SetUp() override {
@@ -248,3 +253,107 @@ TEST_F(CatalogTest, concurrent_test) {
         txn_mgr->CommitTxn(txn7);
     }
 }
+
+TEST_F(CatalogTest, full_catalog_round_trip) {
+    using namespace infinity;
+
+    TxnManager *txn_mgr = infinity::InfinityContext::instance().storage()->txn_manager();
+    BufferManager *buffer_mgr = infinity::InfinityContext::instance().storage()->buffer_manager();
+    Catalog *catalog = infinity::InfinityContext::instance().storage()->catalog();
+
+    auto *txn1 = txn_mgr->BeginTxn();
+    EXPECT_TRUE(txn1->CreateDatabase("db1", ConflictType::kError).ok());
+    EXPECT_TRUE(txn1->CreateDatabase("db2", ConflictType::kError).ok());
+    txn_mgr->CommitTxn(txn1);
+
+    auto *txn2 = txn_mgr->BeginTxn();
+    TxnTimeStamp max_commit_ts = txn2->BeginTS();
+    String full_path;
+    catalog->SaveFullCatalog(max_commit_ts, full_path);
+    EXPECT_TRUE(full_path.ends_with(CatalogFile::FullCheckpoingFilename(max_commit_ts)));
+
+    // the file starts with the magic and the version
+    {
+        std::ifstream file(full_path, std::ios::binary);
+        String header(Catalog::FULL_CKP_MAGIC.size() + sizeof(u32), '\0');
+        file.read(header.data(), header.size());
+        EXPECT_EQ(header.substr(0, Catalog::FULL_CKP_MAGIC.size()), Catalog::FULL_CKP_MAGIC);
+        u32 version = 0;
+        std::memcpy(&version, header.data() + Catalog::FULL_CKP_MAGIC.size(), sizeof(version));
+        EXPECT_EQ(version, Catalog::FULL_CKP_VERSION);
+    }
+
+    auto loaded_catalog = Catalog::LoadFromFiles(FullCatalogFileInfo{full_path, max_commit_ts}, {}, buffer_mgr);
+    EXPECT_EQ(loaded_catalog->Serialize(max_commit_ts)["next_txn_id"], catalog->Serialize(max_commit_ts)["next_txn_id"]);
+    EXPECT_EQ(loaded_catalog->db_meta_map().size(), catalog->db_meta_map().size());
+    for (const String &db_name : {"default", "db1", "db2"}) {
+        auto [db_entry, status] = loaded_catalog->GetDatabase(db_name, txn2->TxnID(), txn2->BeginTS());
+        EXPECT_TRUE(status.ok());
+    }
+    txn_mgr->CommitTxn(txn2);
+}
+
+TEST_F(CatalogTest, full_catalog_version_mismatch) {
+    using namespace infinity;
+
+    TxnManager *txn_mgr = infinity::InfinityContext::instance().storage()->txn_manager();
+    BufferManager *buffer_mgr = infinity::InfinityContext::instance().storage()->buffer_manager();
+    Catalog *catalog = infinity::InfinityContext::instance().storage()->catalog();
+
+    auto *txn = txn_mgr->BeginTxn();
+    TxnTimeStamp max_commit_ts = txn->BeginTS();
+    txn_mgr->CommitTxn(txn);
+    String full_path;
+    catalog->SaveFullCatalog(max_commit_ts, full_path);
+
+    // a file of an unknown version is rejected instead of being decoded
+    {
+        std::fstream file(full_path, std::ios::binary | std::ios::in | std::ios::out);
+        u32 version = Catalog::FULL_CKP_VERSION + 1;
+        file.seekp(Catalog::FULL_CKP_MAGIC.size());
+        file.write(reinterpret_cast<const char *>(&version), sizeof(version));
+    }
+    EXPECT_THROW(Catalog::LoadFromFiles(FullCatalogFileInfo{full_path, max_commit_ts}, {}, buffer_mgr), RecoverableException);
+
+    // a file without the magic is neither the binary format nor json text
+    {
+        std::ofstream file(full_path, std::ios::binary | std::ios::trunc);
+        file << "INFCATLX" << String(16, '\1');
+    }
+    EXPECT_ANY_THROW(Catalog::LoadFromFiles(FullCatalogFileInfo{full_path, max_commit_ts}, {}, buffer_mgr));
+}
+
+TEST_F(CatalogTest, full_catalog_legacy_json) {
+    using namespace infinity;
+
+    TxnManager *txn_mgr = infinity::InfinityContext::instance().storage()->txn_manager();
+    BufferManager *buffer_mgr = infinity::InfinityContext::instance().storage()->buffer_manager();
+    Catalog *catalog = infinity::InfinityContext::instance().storage()->catalog();
+
+    auto *txn1 = txn_mgr->BeginTxn();
+    EXPECT_TRUE(txn1->CreateDatabase("db1", ConflictType::kError).ok());
+    txn_mgr->CommitTxn(txn1);
+
+    // a full catalog written as json text by an older version
+    auto *txn2 = txn_mgr->BeginTxn();
+    TxnTimeStamp max_commit_ts = txn2->BeginTS();
+    String legacy_dir = "/tmp/infinity/legacy_catalog";
+    std::filesystem::remove_all(legacy_dir);
+    std::filesystem::create_directories(legacy_dir);
+    {
+        std::ofstream file(fmt::format("{}/FULL.{}.json", legacy_dir, max_commit_ts));
+        file << catalog->Serialize(max_commit_ts).dump();
+    }
+
+    auto catalog_files = CatalogFile::ParseValidCheckpointFilenames(legacy_dir, max_commit_ts);
+    ASSERT_TRUE(catalog_files.has_value());
+    const FullCatalogFileInfo &full_info = catalog_files->first;
+    EXPECT_TRUE(full_info.path_.ends_with(".json"));
+    EXPECT_EQ(full_info.max_commit_ts_, max_commit_ts);
+
+    auto loaded_catalog = Catalog::LoadFromFiles(full_info, {}, buffer_mgr);
+    auto [db_entry, status] = loaded_catalog->GetDatabase("db1", txn2->TxnID(), txn2->BeginTS());
+    EXPECT_TRUE(status.ok());
+    txn_mgr->CommitTxn(txn2);
+    std::filesystem::remove_all(legacy_dir);
+}
@@ -42,6 +42,7 @@ import column_def;
 import data_type;
 
 import table_entry;
+import segment_entry;
 
 class TableEntryTest : public BaseTest {
     void SetUp() override {
@@ -406,3 +407,50 @@ TEST_F(TableEntryTest, test2) {
         txn_mgr->CommitTxn(new_txn);
     }
 }
+
+TEST_F(TableEntryTest, test_segment_capacity) {
+    using namespace infinity;
+
+    TxnManager *txn_mgr = infinity::InfinityContext::instance().storage()->txn_manager();
+    constexpr SizeT segment_capacity = 2 * DEFAULT_BLOCK_CAPACITY;
+    {
+        Vector<SharedPtr<ColumnDef>> columns;
+        columns.emplace_back(MakeShared<ColumnDef>(0, MakeShared<DataType>(LogicalType::kBigInt), "c1", HashSet<ConstraintType>{}));
+        auto tbl1_def = MakeUnique<TableDef>(MakeShared<String>("default"), MakeShared<String>("tbl1"), columns);
+        tbl1_def->set_segment_capacity(segment_capacity);
+        Txn *txn = txn_mgr->BeginTxn();
+        Status status = txn->CreateTable("default", std::move(tbl1_def), ConflictType::kError);
+        EXPECT_TRUE(status.ok());
+        txn_mgr->CommitTxn(txn);
+    }
+    // the rows of three blocks fill a segment of two blocks, the rest goes to a new segment
+    for (SizeT i = 0; i < 3; ++i) {
+        Txn *txn = txn_mgr->BeginTxn();
+        auto input_block = MakeShared<DataBlock>();
+        input_block->Init({MakeShared<DataType>(LogicalType::kBigInt)}, DEFAULT_BLOCK_CAPACITY);
+        for (SizeT row = 0; row < SizeT(DEFAULT_BLOCK_CAPACITY); ++row) {
+            input_block->AppendValue(0, Value::MakeBigInt(static_cast<i64>(row)));
+        }
+        input_block->Finalize();
+        Status status = txn->Append("default", "tbl1", input_block);
+        EXPECT_TRUE(status.ok());
+        txn_mgr->CommitTxn(txn);
+    }
+    {
+        Txn *txn = txn_mgr->BeginTxn();
+        auto [table_entry, status] = txn->GetTableByName("default", "tbl1");
+        ASSERT_TRUE(status.ok());
+        EXPECT_EQ(table_entry->segment_capacity(), segment_capacity);
+        EXPECT_EQ(table_entry->Serialize(txn->BeginTS())["segment_capacity"], segment_capacity);
+
+        auto segment0 = table_entry->GetSegmentByID(0, txn->BeginTS());
+        ASSERT_NE(segment0, nullptr);
+        EXPECT_EQ(segment0->row_capacity(), segment_capacity);
+        EXPECT_EQ(segment0->row_count(), segment_capacity);
+        auto segment1 = table_entry->GetSegmentByID(1, txn->BeginTS());
+        ASSERT_NE(segment1, nullptr);
+        EXPECT_EQ(segment1->row_count(), SizeT(DEFAULT_BLOCK_CAPACITY));
+        EXPECT_EQ(table_entry->GetSegmentByID(2, txn->BeginTS()), nullptr);
+        txn_mgr->CommitTxn(txn);
+    }
+}
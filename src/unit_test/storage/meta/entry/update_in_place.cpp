@@ -0,0 +1,307 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "unit_test/base_test.h"
+
+import stl;
+import global_resource_usage;
+import storage;
+import infinity_context;
+import txn_manager;
+import txn;
+import status;
+import table_def;
+import data_block;
+import value;
+import column_vector;
+import buffer_manager;
+import compact_segments_task;
+import logical_type;
+import internal_types;
+import extra_ddl_info;
+import column_def;
+import data_type;
+import table_entry;
+import segment_entry;
+import block_entry;
+import block_column_entry;
+
+using namespace infinity;
+
+class UpdateInPlaceTest : public BaseTest {
+    void SetUp() override { system("rm -rf /tmp/infinity"); }
+
+    void TearDown() override { system("rm -rf /tmp/infinity"); }
+
+protected:
+    static constexpr SizeT kRowCount = 8;
+
+    static void Init(bool close_ckp) {
+#ifdef INFINITY_DEBUG
+        infinity::GlobalResourceUsage::Init();
+#endif
+        std::shared_ptr<std::string> config_path = nullptr;
+        if (close_ckp) {
+            config_path = std::make_shared<std::string>(std::string(test_data_path()) + "/config/test_close_ckp.toml");
+        }
+        infinity::InfinityContext::instance().Init(config_path);
+    }
+
+    static void UnInit() {
+        infinity::InfinityContext::instance().UnInit();
+#ifdef INFINITY_DEBUG
+        EXPECT_EQ(infinity::GlobalResourceUsage::GetObjectCount(), 0);
+        EXPECT_EQ(infinity::GlobalResourceUsage::GetRawMemoryCount(), 0);
+        infinity::GlobalResourceUsage::UnInit();
+#endif
+    }
+
+    // tbl1 (c1 BIGINT, c2 HUGEINT) with the rows (i, (i, i))
+    static void CreateTable(TxnManager *txn_mgr) {
+        Vector<SharedPtr<ColumnDef>> columns;
+        HashSet<ConstraintType> constraints;
+        columns.emplace_back(MakeShared<ColumnDef>(0, MakeShared<DataType>(LogicalType::kBigInt), "c1", constraints));
+        columns.emplace_back(MakeShared<ColumnDef>(1, MakeShared<DataType>(LogicalType::kHugeInt), "c2", constraints));
+        {
+            auto tbl1_def = MakeUnique<TableDef>(MakeShared<String>("default"), MakeShared<String>("tbl1"), columns);
+            auto *txn = txn_mgr->BeginTxn();
+            Status status = txn->CreateTable("default", std::move(tbl1_def), ConflictType::kError);
+            EXPECT_TRUE(status.ok());
+            txn_mgr->CommitTxn(txn);
+        }
+        {
+            auto *txn = txn_mgr->BeginTxn();
+            auto input_block = MakeShared<DataBlock>();
+            input_block->Init({MakeShared<DataType>(LogicalType::kBigInt), MakeShared<DataType>(LogicalType::kHugeInt)}, kRowCount);
+            for (SizeT i = 0; i < kRowCount; ++i) {
+                input_block->AppendValue(0, Value::MakeBigInt(static_cast<i64>(i)));
+                input_block->AppendValue(1, Value::MakeHugeInt(HugeIntT(i, i)));
+            }
+            input_block->Finalize();
+            Status status = txn->Append("default", "tbl1", input_block);
+            EXPECT_TRUE(status.ok());
+            txn_mgr->CommitTxn(txn);
+        }
+    }
+
+    // Set c1 of the rows to value
+    static void UpdateRows(TxnManager *txn_mgr, SegmentID segment_id, const Vector<SegmentOffset> &offsets, i64 value) {
+        auto *txn = txn_mgr->BeginTxn();
+        Vector<RowID> row_ids;
+        auto values = MakeShared<DataBlock>();
+        values->Init({MakeShared<DataType>(LogicalType::kBigInt)}, offsets.size());
+        for (SegmentOffset offset : offsets) {
+            row_ids.emplace_back(segment_id, offset);
+            values->AppendValue(0, Value::MakeBigInt(value));
+        }
+        values->Finalize();
+        Status status = txn->Update("default", "tbl1", row_ids, {0}, std::move(values));
+        EXPECT_TRUE(status.ok());
+        txn_mgr->CommitTxn(txn);
+    }
+
+    // c1 of the first block of the segment as begin_ts sees it
+    static Vector<i64> ReadColumn(Txn *txn, SegmentID segment_id, TxnTimeStamp begin_ts) {
+        BufferManager *buffer_mgr = infinity::InfinityContext::instance().storage()->buffer_manager();
+        auto [table_entry, status] = txn->GetTableByName("default", "tbl1");
+        EXPECT_TRUE(status.ok());
+        auto segment_entry = table_entry->GetSegmentByID(segment_id, txn->BeginTS());
+        EXPECT_NE(segment_entry, nullptr);
+        auto block_entry = segment_entry->GetBlockEntryByID(0);
+        BlockColumnEntry *column_entry = block_entry->GetColumnBlockEntry(0);
+
+        ColumnVector base = column_entry->GetColumnVector(buffer_mgr);
+        ColumnVector output(MakeShared<DataType>(LogicalType::kBigInt));
+        output.Initialize();
+        column_entry->ReadRows(output, base, 0, block_entry->row_count(), begin_ts);
+
+        Vector<i64> result;
+        for (SizeT i = 0; i < output.Size(); ++i) {
+            result.push_back(output.GetValue(i).GetValue<BigIntT>());
+        }
+        return result;
+    }
+};
+
+TEST_F(UpdateInPlaceTest, test_snapshot_visibility) {
+    Init(false);
+    TxnManager *txn_mgr = infinity::InfinityContext::instance().storage()->txn_manager();
+    CreateTable(txn_mgr);
+
+    auto *old_txn = txn_mgr->BeginTxn();
+    UpdateRows(txn_mgr, 0, {1, 3}, 100);
+    auto *mid_txn = txn_mgr->BeginTxn();
+    UpdateRows(txn_mgr, 0, {3}, 200);
+
+    // a txn begun before an update keeps the old values
+    EXPECT_EQ(ReadColumn(old_txn, 0, old_txn->BeginTS()), Vector<i64>({0, 1, 2, 3, 4, 5, 6, 7}));
+    EXPECT_EQ(ReadColumn(mid_txn, 0, mid_txn->BeginTS()), Vector<i64>({0, 100, 2, 100, 4, 5, 6, 7}));
+    auto *new_txn = txn_mgr->BeginTxn();
+    EXPECT_EQ(ReadColumn(new_txn, 0, new_txn->BeginTS()), Vector<i64>({0, 100, 2, 200, 4, 5, 6, 7}));
+
+    // the rows that aren't read from the block start are restored too
+    {
+        BufferManager *buffer_mgr = infinity::InfinityContext::instance().storage()->buffer_manager();
+        auto [table_entry, status] = old_txn->GetTableByName("default", "tbl1");
+        BlockColumnEntry *column_entry = table_entry->GetSegmentByID(0, old_txn->BeginTS())->GetBlockEntryByID(0)->GetColumnBlockEntry(0);
+        ColumnVector base = column_entry->GetColumnVector(buffer_mgr);
+        ColumnVector output(MakeShared<DataType>(LogicalType::kBigInt));
+        output.Initialize();
+        output.AppendValue(Value::MakeBigInt(-1));
+        column_entry->ReadRows(output, base, 3, 2, old_txn->BeginTS());
+        EXPECT_EQ(output.Size(), 3u);
+        EXPECT_EQ(output.GetValue(0).GetValue<BigIntT>(), -1);
+        EXPECT_EQ(output.GetValue(1).GetValue<BigIntT>(), 3);
+        EXPECT_EQ(output.GetValue(2).GetValue<BigIntT>(), 4);
+    }
+
+    txn_mgr->CommitTxn(old_txn);
+    txn_mgr->CommitTxn(mid_txn);
+    txn_mgr->CommitTxn(new_txn);
+    UnInit();
+}
+
+TEST_F(UpdateInPlaceTest, test_trim_undo) {
+    Init(false);
+    TxnManager *txn_mgr = infinity::InfinityContext::instance().storage()->txn_manager();
+    CreateTable(txn_mgr);
+
+    auto *old_txn = txn_mgr->BeginTxn();
+    TxnTimeStamp old_ts = old_txn->BeginTS();
+    txn_mgr->CommitTxn(old_txn);
+    UpdateRows(txn_mgr, 0, {0}, 100);
+
+    auto *txn = txn_mgr->BeginTxn();
+    auto [table_entry, status] = txn->GetTableByName("default", "tbl1");
+    auto segment_entry = table_entry->GetSegmentByID(0, txn->BeginTS());
+
+    // the undo of an update after visible_ts is kept
+    segment_entry->TrimUndo(old_ts);
+    EXPECT_EQ(ReadColumn(txn, 0, old_ts)[0], 0);
+
+    // no reader is older than the update, its undo is dropped
+    segment_entry->TrimUndo(txn->BeginTS());
+    EXPECT_EQ(ReadColumn(txn, 0, old_ts)[0], 100);
+    EXPECT_EQ(ReadColumn(txn, 0, txn->BeginTS())[0], 100);
+    txn_mgr->CommitTxn(txn);
+    UnInit();
+}
+
+TEST_F(UpdateInPlaceTest, test_compact_folds_undo) {
+    Init(false);
+    Storage *storage = infinity::InfinityContext::instance().storage();
+    TxnManager *txn_mgr = storage->txn_manager();
+    CreateTable(txn_mgr);
+    {
+        auto *txn = txn_mgr->BeginTxn();
+        auto [table_entry, status] = txn->GetTableByName("default", "tbl1");
+        table_entry->SetCompactionAlg(nullptr); // close auto compaction to test manual compaction
+        txn_mgr->CommitTxn(txn);
+    }
+    UpdateRows(txn_mgr, 0, {2, 5}, 100);
+    {
+        auto *txn = txn_mgr->BeginTxn();
+        auto [table_entry, status] = txn->GetTableByName("default", "tbl1");
+        auto compact_task = CompactSegmentsTask::MakeTaskWithWholeTable(table_entry, txn);
+        compact_task->Execute();
+        txn_mgr->CommitTxn(txn);
+    }
+    {
+        auto *txn = txn_mgr->BeginTxn();
+        auto [table_entry, status] = txn->GetTableByName("default", "tbl1");
+        auto old_segment = table_entry->GetSegmentByID(0, txn->BeginTS());
+        EXPECT_EQ(old_segment->status(), SegmentStatus::kDeprecated);
+
+        // the compacted segment copies the updated values and has no undo to apply
+        auto new_segment = table_entry->GetSegmentByID(1, txn->BeginTS());
+        ASSERT_NE(new_segment, nullptr);
+        BlockEntry *block_entry = new_segment->GetBlockEntryByID(0).get();
+        EXPECT_EQ(block_entry->last_update_ts(), 0u);
+        EXPECT_EQ(block_entry->GetColumnBlockEntry(0)->last_update_ts(), 0u);
+        EXPECT_EQ(ReadColumn(txn, 1, 0), Vector<i64>({0, 1, 100, 3, 4, 100, 6, 7}));
+        txn_mgr->CommitTxn(txn);
+    }
+    UnInit();
+}
+
+TEST_F(UpdateInPlaceTest, test_wal_replay_update) {
+    {
+        Init(true);
+        TxnManager *txn_mgr = infinity::InfinityContext::instance().storage()->txn_manager();
+        CreateTable(txn_mgr);
+        UpdateRows(txn_mgr, 0, {0, 7}, 100);
+        UpdateRows(txn_mgr, 0, {7}, 200);
+        UnInit();
+    }
+    // Restart the db instance, the updates are replayed from the wal
+    {
+        Init(true);
+        TxnManager *txn_mgr = infinity::InfinityContext::instance().storage()->txn_manager();
+        auto *txn = txn_mgr->BeginTxn();
+        EXPECT_EQ(ReadColumn(txn, 0, txn->BeginTS()), Vector<i64>({100, 1, 2, 3, 4, 5, 6, 200}));
+        txn_mgr->CommitTxn(txn);
+
+        // the replayed rows can be updated again
+        UpdateRows(txn_mgr, 0, {0}, 300);
+        txn = txn_mgr->BeginTxn();
+        EXPECT_EQ(ReadColumn(txn, 0, txn->BeginTS())[0], 300);
+        txn_mgr->CommitTxn(txn);
+        UnInit();
+    }
+}
+
+TEST_F(UpdateInPlaceTest, test_read_during_update) {
+    Init(false);
+    Storage *storage = infinity::InfinityContext::instance().storage();
+    BufferManager *buffer_mgr = storage->buffer_manager();
+    TxnManager *txn_mgr = storage->txn_manager();
+    CreateTable(txn_mgr);
+
+    auto *txn = txn_mgr->BeginTxn();
+    auto [table_entry, status] = txn->GetTableByName("default", "tbl1");
+    BlockColumnEntry *column_entry = table_entry->GetSegmentByID(0, txn->BeginTS())->GetBlockEntryByID(0)->GetColumnBlockEntry(1);
+    ColumnVector base = column_entry->GetColumnVector(buffer_mgr);
+
+    // the writer sets c2 of every row to (i, i), a reader must never see the halves of two values
+    constexpr i64 kUpdateCount = 2000;
+    Atomic<bool> stop{false};
+    Thread writer([&] {
+        Vector<Pair<BlockOffset, SizeT>> rows;
+        for (SizeT row = 0; row < kRowCount; ++row) {
+            rows.emplace_back(row, 0);
+        }
+        for (i64 i = 1; i <= kUpdateCount; ++i) {
+            ColumnVector values(MakeShared<DataType>(LogicalType::kHugeInt));
+            values.Initialize();
+            values.AppendValue(Value::MakeHugeInt(HugeIntT(i, i)));
+            column_entry->UpdateInPlace(rows, values, txn->BeginTS() + i, buffer_mgr);
+        }
+        stop = true;
+    });
+    SizeT torn_count = 0;
+    do {
+        ColumnVector output(MakeShared<DataType>(LogicalType::kHugeInt));
+        output.Initialize();
+        column_entry->ReadRows(output, base, 0, kRowCount, txn->BeginTS() + kUpdateCount);
+        for (SizeT row = 0; row < kRowCount; ++row) {
+            HugeIntT value = output.GetValue(row).GetValue<HugeIntT>();
+            torn_count += value.upper != value.lower;
+        }
+    } while (!stop);
+    writer.join();
+    EXPECT_EQ(torn_count, 0u);
+
+    txn_mgr->CommitTxn(txn);
+    UnInit();
+}
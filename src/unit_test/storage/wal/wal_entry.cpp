@@ -258,6 +258,42 @@ TEST_F(WalEntryTest, ReadWrite) {
     EXPECT_EQ(ptr - buf_beg, exp_size);
 }
 
+TEST_F(WalEntryTest, CompressedAppend) {
+    SharedPtr<DataBlock> data_block = DataBlock::Make();
+    Vector<SharedPtr<DataType>> column_types;
+    column_types.emplace_back(MakeShared<DataType>(LogicalType::kBigInt));
+    SizeT row_count = DEFAULT_VECTOR_SIZE;
+    data_block->Init(column_types);
+    for (SizeT i = 0; i < row_count; ++i) {
+        data_block->AppendValue(0, Value::MakeBigInt(i % 16));
+    }
+    data_block->Finalize();
+
+    SharedPtr<WalEntry> entry = MakeShared<WalEntry>();
+    auto append_cmd = MakeShared<WalCmdAppend>("db1", "tbl1", data_block);
+    entry->cmds_.push_back(append_cmd);
+    i32 plain_size = entry->GetSizeInBytes();
+    entry->Compress(1024);
+    EXPECT_FALSE(append_cmd->compressed_block_.empty());
+
+    i32 exp_size = entry->GetSizeInBytes();
+    EXPECT_LT(exp_size, plain_size);
+    Vector<char> buf(exp_size, char(0));
+    char *buf_beg = buf.data();
+    char *ptr = buf_beg;
+    entry->WriteAdv(ptr);
+    EXPECT_EQ(ptr - buf_beg, exp_size);
+
+    ptr = buf_beg;
+    SharedPtr<WalEntry> entry2 = WalEntry::ReadAdv(ptr, exp_size);
+    EXPECT_NE(entry2, nullptr);
+    EXPECT_EQ(*entry == *entry2, true);
+    EXPECT_EQ(entry2->cmds_[0]->GetType(), WalCommandType::APPEND);
+    auto *append_cmd2 = static_cast<WalCmdAppend *>(entry2->cmds_[0].get());
+    EXPECT_EQ(append_cmd2->block_->row_count(), row_count);
+    EXPECT_EQ(append_cmd2->block_->GetValue(0, 21), Value::MakeBigInt(5));
+}
+
 void Println(const String &message1, const String &message2) { std::cout << message1 << message2 << std::endl; }
 
 TEST_F(WalEntryTest, WalEntryIterator) {
@@ -0,0 +1,89 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "unit_test/base_test.h"
+#include <chrono>
+#include <thread>
+
+import stl;
+import wal_entry;
+import wal_entry_blocking_queue;
+
+using namespace infinity;
+
+class WalEntryBlockingQueueTest : public BaseTest {};
+
+TEST_F(WalEntryBlockingQueueTest, dequeue_bulk_max_count) {
+    WALEntryBlockingQueue queue;
+    Vector<WalEntry> entries(5);
+    for (auto &entry : entries) {
+        queue.Enqueue(&entry, nullptr);
+    }
+
+    Deque<WalEntry *> batch;
+    queue.DequeueBulk(batch, 2);
+    ASSERT_EQ(batch.size(), 2u);
+    EXPECT_EQ(batch[0], &entries[0]);
+    EXPECT_EQ(batch[1], &entries[1]);
+    EXPECT_EQ(queue.Size(), 3u);
+
+    // no limit
+    batch.clear();
+    queue.DequeueBulk(batch);
+    ASSERT_EQ(batch.size(), 3u);
+    EXPECT_EQ(batch[2], &entries[4]);
+    EXPECT_EQ(queue.Size(), 0u);
+}
+
+TEST_F(WalEntryBlockingQueueTest, dequeue_bulk_latency) {
+    WALEntryBlockingQueue queue;
+    Vector<WalEntry> entries(4);
+    queue.Enqueue(&entries[0], nullptr);
+
+    // the batch waits for the entries enqueued within the latency, and returns once it is full
+    Thread producer([&] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        for (SizeT i = 1; i < entries.size(); ++i) {
+            queue.Enqueue(&entries[i], nullptr);
+        }
+    });
+    Deque<WalEntry *> batch;
+    auto begin = std::chrono::steady_clock::now();
+    queue.DequeueBulk(batch, entries.size(), std::chrono::seconds(10));
+    auto duration = std::chrono::steady_clock::now() - begin;
+    producer.join();
+    EXPECT_EQ(batch.size(), entries.size());
+    EXPECT_LT(duration, std::chrono::seconds(10));
+
+    // a smaller batch is returned after the latency
+    queue.Enqueue(&entries[0], nullptr);
+    batch.clear();
+    queue.DequeueBulk(batch, entries.size(), std::chrono::milliseconds(1));
+    EXPECT_EQ(batch.size(), 1u);
+}
+
+TEST_F(WalEntryBlockingQueueTest, dequeue_bulk_terminate) {
+    WALEntryBlockingQueue queue;
+    WalEntry entry;
+    queue.Enqueue(&entry, nullptr);
+    // the terminate entry ends the wait at once
+    queue.Enqueue(nullptr, nullptr);
+
+    Deque<WalEntry *> batch;
+    auto begin = std::chrono::steady_clock::now();
+    queue.DequeueBulk(batch, 1024, std::chrono::seconds(10));
+    EXPECT_LT(std::chrono::steady_clock::now() - begin, std::chrono::seconds(10));
+    ASSERT_EQ(batch.size(), 2u);
+    EXPECT_EQ(batch[1], nullptr);
+}
@@ -14,6 +14,9 @@
 
 #include "type/complex/embedding_type.h"
 #include "unit_test/base_test.h"
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
 #include <memory>
 
 import stl;
@@ -999,3 +1002,149 @@ TEST_F(WalReplayTest, wal_replay_create_index_hnsw) {
 #endif
     }
 }
+
+TEST_F(WalReplayTest, wal_replay_parallel_tables) {
+    // The appends and deletes of the tables are interleaved in the wal, they are replayed per table in parallel. The drop and
+    // the create of tbl3 are barriers: the rows appended before the drop must not end up in the new tbl3.
+    auto make_block = [](SizeT row_count, i64 value) {
+        auto input_block = MakeShared<DataBlock>();
+        input_block->Init({MakeShared<DataType>(LogicalType::kBigInt)}, row_count);
+        for (SizeT i = 0; i < row_count; ++i) {
+            input_block->AppendValue(0, Value::MakeBigInt(value));
+        }
+        input_block->Finalize();
+        return input_block;
+    };
+    auto create_table = [](TxnManager *txn_mgr, const String &table_name) {
+        Vector<SharedPtr<ColumnDef>> columns;
+        columns.emplace_back(MakeShared<ColumnDef>(0, MakeShared<DataType>(LogicalType::kBigInt), "c1", HashSet<ConstraintType>{}));
+        auto table_def = MakeUnique<TableDef>(MakeShared<String>("default"), MakeShared<String>(table_name), columns);
+        auto *txn = txn_mgr->BeginTxn();
+        Status status = txn->CreateTable("default", std::move(table_def), ConflictType::kError);
+        EXPECT_TRUE(status.ok());
+        txn_mgr->CommitTxn(txn);
+    };
+    const Vector<String> table_names{"tbl1", "tbl2", "tbl3"};
+    {
+#ifdef INFINITY_DEBUG
+        infinity::GlobalResourceUsage::Init();
+#endif
+        std::shared_ptr<std::string> config_path = WalReplayTest::config_path();
+        infinity::InfinityContext::instance().Init(config_path);
+        TxnManager *txn_mgr = infinity::InfinityContext::instance().storage()->txn_manager();
+
+        for (const String &table_name : table_names) {
+            create_table(txn_mgr, table_name);
+        }
+        for (SizeT round = 0; round < 4; ++round) {
+            for (SizeT i = 0; i < table_names.size(); ++i) {
+                auto *txn = txn_mgr->BeginTxn();
+                Status status = txn->Append("default", table_names[i], make_block(i + 1, static_cast<i64>(round)));
+                EXPECT_TRUE(status.ok());
+                txn_mgr->CommitTxn(txn);
+            }
+        }
+        {
+            auto *txn = txn_mgr->BeginTxn();
+            Status status = txn->Delete("default", "tbl2", {RowID(0, 0), RowID(0, 3)});
+            EXPECT_TRUE(status.ok());
+            txn_mgr->CommitTxn(txn);
+        }
+        {
+            auto *txn = txn_mgr->BeginTxn();
+            Status status = txn->DropTableCollectionByName("default", "tbl3", ConflictType::kError);
+            EXPECT_TRUE(status.ok());
+            txn_mgr->CommitTxn(txn);
+        }
+        create_table(txn_mgr, "tbl3");
+        {
+            auto *txn = txn_mgr->BeginTxn();
+            Status status = txn->Append("default", "tbl3", make_block(5, 100));
+            EXPECT_TRUE(status.ok());
+            txn_mgr->CommitTxn(txn);
+        }
+        infinity::InfinityContext::instance().UnInit();
+#ifdef INFINITY_DEBUG
+        EXPECT_EQ(infinity::GlobalResourceUsage::GetObjectCount(), 0);
+        EXPECT_EQ(infinity::GlobalResourceUsage::GetRawMemoryCount(), 0);
+        infinity::GlobalResourceUsage::UnInit();
+#endif
+    }
+    // Restart the db instance
+    {
+#ifdef INFINITY_DEBUG
+        infinity::GlobalResourceUsage::Init();
+#endif
+        std::shared_ptr<std::string> config_path = WalReplayTest::config_path();
+        infinity::InfinityContext::instance().Init(config_path);
+        TxnManager *txn_mgr = infinity::InfinityContext::instance().storage()->txn_manager();
+        {
+            auto *txn = txn_mgr->BeginTxn();
+            TxnTimeStamp begin_ts = txn->BeginTS();
+            const Vector<SizeT> expect_row_counts{4, 8 - 2, 5};
+            for (SizeT i = 0; i < table_names.size(); ++i) {
+                auto [table_entry, status] = txn->GetTableByName("default", table_names[i]);
+                ASSERT_TRUE(status.ok());
+                auto segment_entry = table_entry->GetSegmentByID(0, begin_ts);
+                ASSERT_NE(segment_entry, nullptr);
+                EXPECT_EQ(segment_entry->actual_row_count(), expect_row_counts[i]);
+            }
+            txn_mgr->CommitTxn(txn);
+        }
+        infinity::InfinityContext::instance().UnInit();
+#ifdef INFINITY_DEBUG
+        EXPECT_EQ(infinity::GlobalResourceUsage::GetObjectCount(), 0);
+        EXPECT_EQ(infinity::GlobalResourceUsage::GetRawMemoryCount(), 0);
+        infinity::GlobalResourceUsage::UnInit();
+#endif
+    }
+}
+
+TEST_F(WalReplayTest, wal_replay_table_failure) {
+    {
+#ifdef INFINITY_DEBUG
+        infinity::GlobalResourceUsage::Init();
+#endif
+        std::shared_ptr<std::string> config_path = WalReplayTest::config_path();
+        infinity::InfinityContext::instance().Init(config_path);
+        TxnManager *txn_mgr = infinity::InfinityContext::instance().storage()->txn_manager();
+
+        Vector<SharedPtr<ColumnDef>> columns;
+        columns.emplace_back(MakeShared<ColumnDef>(0, MakeShared<DataType>(LogicalType::kBigInt), "c1", HashSet<ConstraintType>{}));
+        auto table_def = MakeUnique<TableDef>(MakeShared<String>("default"), MakeShared<String>("tbl1"), columns);
+        auto *txn = txn_mgr->BeginTxn();
+        Status status = txn->CreateTable("default", std::move(table_def), ConflictType::kError);
+        EXPECT_TRUE(status.ok());
+        txn_mgr->CommitTxn(txn);
+
+        infinity::InfinityContext::instance().UnInit();
+#ifdef INFINITY_DEBUG
+        infinity::GlobalResourceUsage::UnInit();
+#endif
+    }
+    // A delete of a table which doesn't exist is replayed on the replay pool, its error must fail the replay.
+    {
+        auto entry = MakeShared<WalEntry>();
+        entry->txn_id_ = 1000;
+        entry->commit_ts_ = 1000000;
+        entry->cmds_.push_back(MakeShared<WalCmdDelete>("default", "no_such_table", Vector<RowID>{RowID(0, 0)}));
+        Vector<char> buf(entry->GetSizeInBytes());
+        char *ptr = buf.data();
+        entry->WriteAdv(ptr);
+        auto ofs = std::ofstream("/tmp/infinity/wal/wal.log", std::ios::app | std::ios::binary);
+        ASSERT_TRUE(ofs.is_open());
+        ofs.write(buf.data(), ptr - buf.data());
+    }
+    // The failed boot leaves threads behind, so it runs in a child process.
+    GTEST_FLAG_SET(death_test_style, "threadsafe");
+    EXPECT_DEATH(
+        {
+            try {
+                infinity::InfinityContext::instance().Init(WalReplayTest::config_path());
+            } catch (const UnrecoverableException &e) {
+                std::fprintf(stderr, "%s\n", e.what());
+                std::abort();
+            }
+        },
+        "Get table failed");
+}
@@ -0,0 +1,100 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "unit_test/base_test.h"
+
+import stl;
+import global_resource_usage;
+import storage;
+import infinity_context;
+import txn_manager;
+import txn;
+import third_party;
+import wal_manager;
+import wal_entry;
+import extra_ddl_info;
+import status;
+
+using namespace infinity;
+
+class WalShippingTest : public BaseTest {
+protected:
+    void SetUp() override { system("rm -rf /tmp/infinity"); }
+
+    void TearDown() override { system("rm -rf /tmp/infinity"); }
+
+    static Vector<TxnTimeStamp> EntryCommitTS(String &entries) {
+        Vector<TxnTimeStamp> commit_ts_list;
+        char *ptr = entries.data();
+        char *const end = ptr + entries.size();
+        while (ptr < end) {
+            i32 entry_size = reinterpret_cast<const WalEntryHeader *>(ptr)->size_;
+            char *entry_ptr = ptr;
+            SharedPtr<WalEntry> entry = WalEntry::ReadAdv(entry_ptr, entry_size);
+            EXPECT_NE(entry.get(), nullptr);
+            commit_ts_list.push_back(entry->commit_ts_);
+            ptr += entry_size;
+        }
+        return commit_ts_list;
+    }
+};
+
+TEST_F(WalShippingTest, read_entries_from) {
+#ifdef INFINITY_DEBUG
+    infinity::GlobalResourceUsage::Init();
+#endif
+    std::shared_ptr<std::string> config_path = nullptr;
+    infinity::InfinityContext::instance().Init(config_path);
+
+    Storage *storage = infinity::InfinityContext::instance().storage();
+    TxnManager *txn_mgr = storage->txn_manager();
+    WalManager *wal_mgr = storage->wal_manager();
+
+    Vector<TxnTimeStamp> commit_ts_list;
+    for (SizeT i = 0; i < 3; ++i) {
+        auto *txn = txn_mgr->BeginTxn();
+        auto status = txn->CreateDatabase(fmt::format("db{}", i), ConflictType::kError);
+        ASSERT_TRUE(status.ok());
+        commit_ts_list.push_back(txn_mgr->CommitTxn(txn));
+    }
+    while (wal_mgr->DurableCommitTS() < commit_ts_list.back()) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    {
+        String entries;
+        ASSERT_TRUE(wal_mgr->ReadEntriesFrom(commit_ts_list[0], 1 << 20, entries));
+        EXPECT_EQ(EntryCommitTS(entries), commit_ts_list);
+    }
+    {
+        // at least one entry, however small max_bytes is
+        String entries;
+        ASSERT_TRUE(wal_mgr->ReadEntriesFrom(commit_ts_list[1], 1, entries));
+        EXPECT_EQ(EntryCommitTS(entries), Vector<TxnTimeStamp>{commit_ts_list[1]});
+    }
+    {
+        // nothing committed after the last one yet
+        String entries;
+        ASSERT_TRUE(wal_mgr->ReadEntriesFrom(commit_ts_list.back() + 1, 1 << 20, entries));
+        EXPECT_TRUE(entries.empty());
+    }
+    EXPECT_NE(wal_mgr->LastCheckpointEntryTS(), 0u);
+
+    infinity::InfinityContext::instance().UnInit();
+#ifdef INFINITY_DEBUG
+    EXPECT_EQ(infinity::GlobalResourceUsage::GetObjectCount(), 0);
+    EXPECT_EQ(infinity::GlobalResourceUsage::GetRawMemoryCount(), 0);
+    infinity::GlobalResourceUsage::UnInit();
+#endif
+}
@@ -0,0 +1,165 @@
+# generate 'test/sql/dml/import/test_big_parallel_import_csv.slt' and 'test/sql/dml/import/test_big_parallel_import_jsonl.slt'
+
+import os
+import argparse
+import json
+
+
+def generate_csv(generate_if_exists: bool, copy_dir: str):
+    # a file of at least two 64MB ranges is parsed in parallel
+    row_n = 1400000
+    table_name = "test_big_parallel_import_csv"
+
+    csv_dir = "./test/data/csv"
+    slt_dir = "./test/sql/dml/import"
+    csv_name = "/{}.csv".format(table_name)
+    slt_name = "/{}.slt".format(table_name)
+
+    csv_path = csv_dir + csv_name
+    slt_path = slt_dir + slt_name
+
+    os.makedirs(csv_dir, exist_ok=True)
+    os.makedirs(slt_dir, exist_ok=True)
+    if os.path.exists(csv_path) and os.path.exists(slt_path) and not generate_if_exists:
+        print(
+            "File {} and {} already existed exists. Skip Generating.".format(
+                slt_path, csv_path
+            )
+        )
+        return
+
+    # every row has a quoted field with a delimiter and a newline, so some range bounds fall inside quotes
+    padding = "x" * 64
+    with open(csv_path, "w") as csv_file:
+        for i in range(row_n):
+            csv_file.write('{},"row {}, first line\n{}",{}\n'.format(i, i, padding, i))
+
+    with open(slt_path, "w") as slt_file:
+        slt_file.write("statement ok\n")
+        slt_file.write("DROP TABLE IF EXISTS {};\n".format(table_name))
+        slt_file.write("\n")
+
+        slt_file.write("statement ok\n")
+        slt_file.write(
+            "CREATE TABLE {} (c1 BIGINT, c2 VARCHAR, c3 BIGINT);\n".format(table_name)
+        )
+        slt_file.write("\n")
+
+        slt_file.write("query I\n")
+        slt_file.write(
+            "COPY {} FROM '{}{}' WITH ( DELIMITER ',' );\n".format(
+                table_name, copy_dir, csv_name
+            )
+        )
+        slt_file.write("----\n")
+        slt_file.write("\n")
+
+        slt_file.write("query II\n")
+        slt_file.write("SELECT count(*), sum(c1) FROM {};\n".format(table_name))
+        slt_file.write("----\n")
+        slt_file.write("{} {}\n".format(row_n, row_n * (row_n - 1) // 2))
+        slt_file.write("\n")
+
+        # no row is split or shifted at a range bound
+        slt_file.write("query I\n")
+        slt_file.write("SELECT count(*) FROM {} WHERE c1 <> c3;\n".format(table_name))
+        slt_file.write("----\n")
+        slt_file.write("0\n")
+        slt_file.write("\n")
+
+        slt_file.write("statement ok\n")
+        slt_file.write("DROP TABLE {};\n".format(table_name))
+
+
+def generate_jsonl(generate_if_exists: bool, copy_dir: str):
+    # a file of at least two 64MB ranges is parsed in parallel
+    row_n = 1100000
+    dim = 16
+    table_name = "test_big_parallel_import_jsonl"
+
+    jsonl_dir = "./test/data/jsonl"
+    slt_dir = "./test/sql/dml/import"
+    jsonl_name = "/{}.jsonl".format(table_name)
+    slt_name = "/{}.slt".format(table_name)
+
+    jsonl_path = jsonl_dir + jsonl_name
+    slt_path = slt_dir + slt_name
+
+    os.makedirs(jsonl_dir, exist_ok=True)
+    os.makedirs(slt_dir, exist_ok=True)
+    if os.path.exists(jsonl_path) and os.path.exists(slt_path) and not generate_if_exists:
+        print(
+            "File {} and {} already existed exists. Skip Generating.".format(
+                slt_path, jsonl_path
+            )
+        )
+        return
+
+    with open(jsonl_path, "w") as jsonl_file:
+        for i in range(row_n):
+            row = {"c1": i, "c2": [(i + j) % 100 / 4 for j in range(dim)], "c3": i}
+            jsonl_file.write(json.dumps(row) + "\n")
+
+    with open(slt_path, "w") as slt_file:
+        slt_file.write("statement ok\n")
+        slt_file.write("DROP TABLE IF EXISTS {};\n".format(table_name))
+        slt_file.write("\n")
+
+        slt_file.write("statement ok\n")
+        slt_file.write(
+            "CREATE TABLE {} (c1 BIGINT, c2 EMBEDDING(FLOAT, {}), c3 BIGINT);\n".format(
+                table_name, dim
+            )
+        )
+        slt_file.write("\n")
+
+        slt_file.write("query I\n")
+        slt_file.write(
+            "COPY {} FROM '{}{}' WITH (FORMAT JSONL);\n".format(
+                table_name, copy_dir, jsonl_name
+            )
+        )
+        slt_file.write("----\n")
+        slt_file.write("\n")
+
+        slt_file.write("query II\n")
+        slt_file.write("SELECT count(*), sum(c1) FROM {};\n".format(table_name))
+        slt_file.write("----\n")
+        slt_file.write("{} {}\n".format(row_n, row_n * (row_n - 1) // 2))
+        slt_file.write("\n")
+
+        # no line is split or shifted at a range bound
+        slt_file.write("query I\n")
+        slt_file.write("SELECT count(*) FROM {} WHERE c1 <> c3;\n".format(table_name))
+        slt_file.write("----\n")
+        slt_file.write("0\n")
+        slt_file.write("\n")
+
+        slt_file.write("statement ok\n")
+        slt_file.write("DROP TABLE {};\n".format(table_name))
+
+
+def generate(generate_if_exists: bool, copy_dir: str):
+    generate_csv(generate_if_exists, copy_dir)
+    generate_jsonl(generate_if_exists, copy_dir)
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(description="Generate parallel import for test")
+
+    parser.add_argument(
+        "-g",
+        "--generate",
+        type=bool,
+        default=False,
+        dest="generate_if_exists",
+    )
+    parser.add_argument(
+        "-c",
+        "--copy",
+        type=str,
+        default="/tmp/infinity/test_data",
+        dest="copy_dir",
+    )
+    args = parser.parse_args()
+    generate(args.generate_if_exists, args.copy_dir)
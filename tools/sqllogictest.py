@@ -21,6 +21,7 @@ from generate_index_scan import generate as generate10
 from generate_many_import import generate as generate11
 from generate_big_point_query_test_fastroughfilter import generate as generate12
 from generate_many_import_drop import generate as generate13
+from generate_parallel_import import generate as generate14
 
 
 class SpinnerThread(threading.Thread):
@@ -153,6 +154,7 @@ if __name__ == "__main__":
     generate11(args.generate_if_exists, args.copy)
     generate12(args.generate_if_exists, args.copy)
     generate13(args.generate_if_exists, args.copy)
+    generate14(args.generate_if_exists, args.copy)
     print("Generate file finshed.")
 
     print("Start copying data...")